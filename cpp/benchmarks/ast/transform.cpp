@@ -38,7 +38,7 @@ template <typename key_type, TreeType tree_type, bool reuse_columns, bool Nullab
 class AST : public cudf::benchmark {
 };
 
-template <typename key_type, TreeType tree_type, bool reuse_columns, bool Nullable>
+template <typename key_type, TreeType tree_type, bool reuse_columns, bool Nullable, bool Jit>
 static void BM_ast_transform(benchmark::State& state)
 {
   auto const table_size{static_cast<cudf::size_type>(state.range(0))};
@@ -87,10 +87,17 @@ static void BM_ast_transform(benchmark::State& state)
 
   auto const& expression_tree_root = expressions.back();
 
+  auto const compute = [&]() {
+    return Jit ? cudf::jit_compute_column(table, expression_tree_root)
+               : cudf::compute_column(table, expression_tree_root);
+  };
+  // Compile the JIT kernel outside of the timed region
+  if (Jit) { compute(); }
+
   // Execute benchmark
   for (auto _ : state) {
     cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
-    cudf::compute_column(table, expression_tree_root);
+    compute();
   }
 
   // Use the number of bytes read from global memory
@@ -109,27 +116,74 @@ static void CustomRanges(benchmark::internal::Benchmark* b)
   }
 }
 
-#define AST_TRANSFORM_BENCHMARK_DEFINE(name, key_type, tree_type, reuse_columns, nullable) \
-  BENCHMARK_TEMPLATE_DEFINE_F(AST, name, key_type, tree_type, reuse_columns, nullable)     \
-  (::benchmark::State & st)                                                                \
-  {                                                                                        \
-    BM_ast_transform<key_type, tree_type, reuse_columns, nullable>(st);                    \
-  }                                                                                        \
-  BENCHMARK_REGISTER_F(AST, name)                                                          \
-    ->Apply(CustomRanges)                                                                  \
-    ->Unit(benchmark::kMillisecond)                                                        \
+// Deep trees, on which the JIT-compiled kernel is compared with the interpreter
+static void DeepRanges(benchmark::internal::Benchmark* b)
+{
+  auto row_counts       = std::vector<cudf::size_type>{1'000'000, 10'000'000};
+  auto operation_counts = std::vector<cudf::size_type>{10, 50, 100};
+  for (auto const& row_count : row_counts) {
+    for (auto const& operation_count : operation_counts) {
+      b->Args({row_count, operation_count});
+    }
+  }
+}
+
+#define AST_TRANSFORM_BENCHMARK_DEFINE(                                                  \
+  name, key_type, tree_type, reuse_columns, nullable, jit, ranges)                       \
+  BENCHMARK_TEMPLATE_DEFINE_F(AST, name, key_type, tree_type, reuse_columns, nullable)   \
+  (::benchmark::State & st)                                                              \
+  {                                                                                      \
+    BM_ast_transform<key_type, tree_type, reuse_columns, nullable, jit>(st);             \
+  }                                                                                      \
+  BENCHMARK_REGISTER_F(AST, name)                                                        \
+    ->Apply(ranges)                                                                      \
+    ->Unit(benchmark::kMillisecond)                                                      \
     ->UseManualTime();
 
+AST_TRANSFORM_BENCHMARK_DEFINE(ast_int32_imbalanced_unique,
+                               int32_t,
+                               TreeType::IMBALANCED_LEFT,
+                               false,
+                               false,
+                               false,
+                               CustomRanges);
 AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_int32_imbalanced_unique, int32_t, TreeType::IMBALANCED_LEFT, false, false);
-AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_int32_imbalanced_reuse, int32_t, TreeType::IMBALANCED_LEFT, true, false);
-AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_double_imbalanced_unique, double, TreeType::IMBALANCED_LEFT, false, false);
+  ast_int32_imbalanced_reuse, int32_t, TreeType::IMBALANCED_LEFT, true, false, false, CustomRanges);
+AST_TRANSFORM_BENCHMARK_DEFINE(ast_double_imbalanced_unique,
+                               double,
+                               TreeType::IMBALANCED_LEFT,
+                               false,
+                               false,
+                               false,
+                               CustomRanges);
+
+AST_TRANSFORM_BENCHMARK_DEFINE(ast_int32_imbalanced_unique_nulls,
+                               int32_t,
+                               TreeType::IMBALANCED_LEFT,
+                               false,
+                               true,
+                               false,
+                               CustomRanges);
+AST_TRANSFORM_BENCHMARK_DEFINE(ast_int32_imbalanced_reuse_nulls,
+                               int32_t,
+                               TreeType::IMBALANCED_LEFT,
+                               true,
+                               true,
+                               false,
+                               CustomRanges);
+AST_TRANSFORM_BENCHMARK_DEFINE(ast_double_imbalanced_unique_nulls,
+                               double,
+                               TreeType::IMBALANCED_LEFT,
+                               false,
+                               true,
+                               false,
+                               CustomRanges);
 
 AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_int32_imbalanced_unique_nulls, int32_t, TreeType::IMBALANCED_LEFT, false, true);
+  ast_int32_deep_reuse, int32_t, TreeType::IMBALANCED_LEFT, true, false, false, DeepRanges);
+AST_TRANSFORM_BENCHMARK_DEFINE(
+  ast_int32_deep_reuse_jit, int32_t, TreeType::IMBALANCED_LEFT, true, false, true, DeepRanges);
 AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_int32_imbalanced_reuse_nulls, int32_t, TreeType::IMBALANCED_LEFT, true, true);
+  ast_double_deep_reuse_nulls, double, TreeType::IMBALANCED_LEFT, true, true, false, DeepRanges);
 AST_TRANSFORM_BENCHMARK_DEFINE(
-  ast_double_imbalanced_unique_nulls, double, TreeType::IMBALANCED_LEFT, false, true);
+  ast_double_deep_reuse_nulls_jit, double, TreeType::IMBALANCED_LEFT, true, true, true, DeepRanges);
@@ -62,6 +62,7 @@ static void BM_concatenate(benchmark::State& state)
   BENCHMARK_REGISTER_F(Concatenate, BM_concatenate##_##nullable_##nullable) \
     ->RangeMultiplier(8)                                                    \
     ->Ranges({{1 << 6, 1 << 18}, {2, 1024}})                                \
+    ->Args({1 << 6, 10000})                                                 \
     ->Unit(benchmark::kMillisecond)                                         \
     ->UseManualTime();
 
@@ -104,6 +105,7 @@ static void BM_concatenate_tables(benchmark::State& state)
   BENCHMARK_REGISTER_F(Concatenate, BM_concatenate_tables##_##nullable_##nullable) \
     ->RangeMultiplier(8)                                                           \
     ->Ranges({{1 << 8, 1 << 12}, {2, 32}, {2, 128}})                               \
+    ->Args({1 << 6, 8, 10000})                                                     \
     ->Unit(benchmark::kMillisecond)                                                \
     ->UseManualTime();
 
@@ -164,6 +166,7 @@ static void BM_concatenate_strings(benchmark::State& state)
   BENCHMARK_REGISTER_F(Concatenate, BM_concatenate_strings##_##nullable_##nullable) \
     ->RangeMultiplier(8)                                                            \
     ->Ranges({{1 << 8, 1 << 14}, {8, 128}, {2, 256}})                               \
+    ->Args({1 << 6, 8, 10000})                                                      \
     ->Unit(benchmark::kMillisecond)                                                 \
     ->UseManualTime();
 
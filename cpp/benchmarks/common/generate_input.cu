@@ -24,6 +24,7 @@
 #include <cudf/filling.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -48,11 +49,13 @@
 #include <thrust/random/uniform_int_distribution.h>
 #include <thrust/random/uniform_real_distribution.h>
 #include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -84,6 +87,17 @@ T get_distribution_mean(distribution_params<T> const& dist)
       else
         return dist.lower_bound - (1. / p);
     }
+    case distribution_id::ZIPF: {
+      auto const range_size = dist.lower_bound < dist.upper_bound
+                                ? dist.upper_bound - dist.lower_bound
+                                : dist.lower_bound - dist.upper_bound;
+      // mean of (range_size + 1)^u - 1, with u uniform in [0, 1)
+      auto const mean_offset = range_size / std::log1p(static_cast<double>(range_size)) - 1.;
+      if (dist.lower_bound < dist.upper_bound)
+        return dist.lower_bound + mean_offset;
+      else
+        return dist.lower_bound - mean_offset;
+    }
     default: CUDF_FAIL("Unsupported distribution type.");
   }
 }
@@ -335,19 +349,27 @@ auto create_run_length_dist(cudf::size_type avg_run_len)
  * @brief Generate indices within range [0 , cardinality) repeating with average run length
  * `avg_run_len`
  *
- * @param avg_run_len  Average run length of the generated indices
- * @param cardinality  Number of unique values in the output vector
- * @param num_rows     Number of indices to generate
- * @param engine       Random engine
+ * With `run_order::CLUSTERED` and `run_order::SORTED` the indices are sorted, so all occurrences
+ * of an index are adjacent.
+ *
+ * @param avg_run_len     Average run length of the generated indices
+ * @param cardinality     Number of unique values in the output vector
+ * @param num_rows        Number of indices to generate
+ * @param sample_dist_id  Distribution of the indices; with ZIPF, low indices are the most frequent
+ * @param order           Order of the runs of indices
+ * @param engine          Random engine
  * @return Generated indices of type `cudf::size_type`
  */
 rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(cudf::size_type avg_run_len,
                                                                     cudf::size_type cardinality,
                                                                     cudf::size_type num_rows,
+                                                                    distribution_id sample_dist_id,
+                                                                    run_order order,
                                                                     thrust::minstd_rand& engine)
 {
   auto sample_dist = random_value_fn<cudf::size_type>{
-    distribution_params<cudf::size_type>{distribution_id::UNIFORM, 0, cardinality - 1}};
+    distribution_params<cudf::size_type>{sample_dist_id, 0, cardinality - 1}};
+  rmm::device_uvector<cudf::size_type> indices(0, cudf::default_stream_value);
   if (avg_run_len > 1) {
     auto avglen_dist =
       random_value_fn<int>{distribution_params<int>{distribution_id::UNIFORM, 1, 2 * avg_run_len}};
@@ -365,17 +387,17 @@ rmm::device_uvector<cudf::size_type> sample_indices_with_run_length(cudf::size_t
         auto sample_idx = thrust::upper_bound(thrust::seq, rb, re, i) - rb;
         return samples_indices[sample_idx];
       });
-    rmm::device_uvector<cudf::size_type> repeated_sample_indices(num_rows,
-                                                                 cudf::default_stream_value);
+    indices = rmm::device_uvector<cudf::size_type>(num_rows, cudf::default_stream_value);
     thrust::copy(thrust::device,
                  avg_repeated_sample_indices_iterator,
                  avg_repeated_sample_indices_iterator + num_rows,
-                 repeated_sample_indices.begin());
-    return repeated_sample_indices;
+                 indices.begin());
   } else {
     // generate n samples.
-    return sample_dist(engine, num_rows);
+    indices = sample_dist(engine, num_rows);
   }
+  if (order != run_order::RANDOM) { thrust::sort(thrust::device, indices.begin(), indices.end()); }
+  return indices;
 }
 
 /**
@@ -403,7 +425,9 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
   rmm::device_uvector<T> data(0, cudf::default_stream_value);
   rmm::device_uvector<bool> null_mask(0, cudf::default_stream_value);
 
-  if (profile.get_cardinality() == 0 and avg_run_len == 1) {
+  auto const order = profile.get_run_order();
+  if (profile.get_cardinality() == 0 and avg_run_len == 1 and order == run_order::RANDOM and
+      profile.get_sample_distribution() == distribution_id::UNIFORM) {
     data      = value_dist(engine, num_rows);
     null_mask = valid_dist(engine, num_rows);
   } else {
@@ -413,9 +437,14 @@ std::unique_ptr<cudf::column> create_random_column(data_profile const& profile,
     }();
     rmm::device_uvector<bool> samples_null_mask = valid_dist(engine, cardinality);
     rmm::device_uvector<T> samples              = value_dist(engine, cardinality);
+    // sorted samples gathered with sorted indices give a sorted column
+    if (order == run_order::SORTED) {
+      thrust::sort_by_key(
+        thrust::device, samples.begin(), samples.end(), samples_null_mask.begin());
+    }
     // generate n samples and gather.
-    auto const sample_indices =
-      sample_indices_with_run_length(avg_run_len, cardinality, num_rows, engine);
+    auto const sample_indices = sample_indices_with_run_length(
+      avg_run_len, cardinality, num_rows, profile.get_sample_distribution(), order, engine);
     data      = rmm::device_uvector<T>(num_rows, cudf::default_stream_value);
     null_mask = rmm::device_uvector<bool>(num_rows, cudf::default_stream_value);
     thrust::gather(
@@ -531,15 +560,21 @@ std::unique_ptr<cudf::column> create_random_column<cudf::string_view>(data_profi
 {
   auto const cardinality = std::min(profile.get_cardinality(), num_rows);
   auto const avg_run_len = profile.get_avg_run_length();
+  auto const order       = profile.get_run_order();
 
   auto sample_strings =
     create_random_utf8_string_column(profile, engine, cardinality == 0 ? num_rows : cardinality);
+  if (order == run_order::SORTED) {
+    auto sorted    = cudf::sort(cudf::table_view{{sample_strings->view()}});
+    sample_strings = std::move(sorted->release()[0]);
+  }
   if (cardinality == 0) { return sample_strings; }
-  auto sample_indices = sample_indices_with_run_length(avg_run_len, cardinality, num_rows, engine);
-  auto str_table      = cudf::detail::gather(cudf::table_view{{sample_strings->view()}},
-                                        sample_indices,
-                                        cudf::out_of_bounds_policy::DONT_CHECK,
-                                        cudf::detail::negative_index_policy::NOT_ALLOWED);
+  auto sample_indices = sample_indices_with_run_length(
+    avg_run_len, cardinality, num_rows, profile.get_sample_distribution(), order, engine);
+  auto str_table = cudf::detail::gather(cudf::table_view{{sample_strings->view()}},
+                                         sample_indices,
+                                         cudf::out_of_bounds_policy::DONT_CHECK,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED);
   return std::move(str_table->release()[0]);
 }
 
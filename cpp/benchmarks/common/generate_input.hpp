@@ -60,6 +60,17 @@ enum class distribution_id : int8_t {
               ///< simulating real-world numeric data.
   GEOMETRIC,  ///< Geometric sampling - highest chance to sample close to the lower bound. Good for
               ///< simulating real data with asymmetric distribution (unsigned values, timestamps).
+  ZIPF,       ///< Zipfian sampling - the chance to sample a value is inversely proportional to its
+              ///< distance from the lower bound. Good for simulating hot keys and skewed lengths.
+};
+
+/**
+ * @brief Identifies the order of the runs of repeated values in a generated column.
+ */
+enum class run_order : int8_t {
+  RANDOM,     ///< Runs are in random order; equal values can appear anywhere in the column.
+  CLUSTERED,  ///< Runs of equal values are adjacent, but the values themselves are not sorted.
+  SORTED,     ///< Values are sorted in ascending order.
 };
 
 // Default distribution types for each type
@@ -232,6 +243,8 @@ class data_profile {
   std::optional<double> null_frequency = 0.01;
   cudf::size_type cardinality          = 2000;
   cudf::size_type avg_run_length       = 4;
+  distribution_id sample_distribution  = distribution_id::UNIFORM;
+  run_order value_order                = run_order::RANDOM;
 
  public:
   template <typename T,
@@ -317,6 +330,8 @@ class data_profile {
   auto get_null_frequency() const { return null_frequency; };
   [[nodiscard]] auto get_cardinality() const { return cardinality; };
   [[nodiscard]] auto get_avg_run_length() const { return avg_run_length; };
+  [[nodiscard]] auto get_sample_distribution() const { return sample_distribution; };
+  [[nodiscard]] auto get_run_order() const { return value_order; };
 
   // Users should pass integral values for bounds when setting the parameters for types that have
   // discrete distributions (integers, strings, lists). Otherwise the call with have no effect.
@@ -374,6 +389,14 @@ class data_profile {
   void set_null_frequency(std::optional<double> f) { null_frequency = f; }
   void set_cardinality(cudf::size_type c) { cardinality = c; }
   void set_avg_run_length(cudf::size_type avg_rl) { avg_run_length = avg_rl; }
+  /**
+   * @brief Sets the distribution used to pick among the `cardinality` unique values.
+   *
+   * With `distribution_id::ZIPF`, a few of the unique values make up most of the rows, as with
+   * the hot keys of real data.
+   */
+  void set_sample_distribution(distribution_id dist) { sample_distribution = dist; }
+  void set_run_order(run_order order) { value_order = order; }
 
   void set_list_depth(cudf::size_type max_depth)
   {
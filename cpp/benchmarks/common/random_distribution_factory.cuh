@@ -26,6 +26,7 @@
 #include <thrust/random.h>
 #include <thrust/random/normal_distribution.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
 #include <thrust/tabulate.h>
 
 #include <algorithm>
@@ -106,6 +107,42 @@ class geometric_distribution : public thrust::random::normal_distribution<integr
   }
 };
 
+/**
+ * @brief Generates a Zipfian distribution between lower_bound and upper_bound.
+ *
+ * The chance to sample a value is inversely proportional to its rank, i.e. its distance from the
+ * lower bound plus one. This distribution is an approximation: the logarithm of the rank is
+ * sampled uniformly, which is the continuous form of Zipf's law with exponent 1.
+ *
+ * @tparam T Result type of the number to produce.
+ */
+template <typename T>
+class zipf_distribution : public thrust::random::uniform_real_distribution<double> {
+  using super_t = thrust::random::uniform_real_distribution<double>;
+  T _lower_bound;
+  T _upper_bound;
+
+ public:
+  using result_type = T;
+  __host__ __device__ explicit zipf_distribution(T lower_bound, T upper_bound)
+    : super_t(0, 1), _lower_bound(lower_bound), _upper_bound(upper_bound)
+  {
+  }
+
+  template <typename UniformRandomNumberGenerator>
+  __host__ __device__ result_type operator()(UniformRandomNumberGenerator& urng)
+  {
+    auto const range_size = _lower_bound < _upper_bound
+                              ? static_cast<double>(_upper_bound) - _lower_bound
+                              : static_cast<double>(_lower_bound) - _upper_bound;
+    // rank - 1 of the sampled value, in [0, range_size]
+    auto offset = exp(super_t::operator()(urng) * log1p(range_size)) - 1;
+    if constexpr (cuda::std::is_integral_v<T>) { offset = floor(offset); }
+    return _lower_bound < _upper_bound ? _lower_bound + static_cast<T>(offset)
+                                       : _lower_bound - static_cast<T>(offset);
+  }
+};
+
 template <typename T, typename Generator>
 struct value_generator {
   using result_type = T;
@@ -176,6 +213,17 @@ distribution_fn<T> make_distribution(distribution_id dist_id, T lower_bound, T u
                          value_generator{lower_bound, upper_bound, engine, dist});
         return result;
       };
+    case distribution_id::ZIPF:
+      // most samples are close to lower_bound, with a long tail towards upper_bound.
+      return [lower_bound, upper_bound, dist = zipf_distribution<T>(lower_bound, upper_bound)](
+               thrust::minstd_rand& engine, size_t size) -> rmm::device_uvector<T> {
+        rmm::device_uvector<T> result(size, cudf::default_stream_value);
+        thrust::tabulate(thrust::device,
+                         result.begin(),
+                         result.end(),
+                         value_generator{lower_bound, upper_bound, engine, dist});
+        return result;
+      };
     default: CUDF_FAIL("Unsupported probability distribution");
   }
 }
@@ -50,6 +50,31 @@ static void BM_copy_if_else(benchmark::State& state, bool nulls)
   }
 }
 
+// Selects the rows of whole tables, either at once or column by column
+template <class TypeParam>
+static void BM_copy_if_else_table(benchmark::State& state, bool by_column)
+{
+  cudf::size_type const n_rows{(cudf::size_type)state.range(0)};
+  cudf::size_type const n_cols{(cudf::size_type)state.range(1)};
+  auto const input_types = cycle_dtypes({cudf::type_to_id<TypeParam>()}, n_cols);
+  auto const lhs         = create_random_table(input_types, row_count{n_rows});
+  auto const rhs         = create_random_table(input_types, row_count{n_rows}, data_profile{}, 2);
+  auto const decision    = create_random_table({cudf::type_id::BOOL8}, row_count{n_rows});
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, cudf::default_stream_value);
+    if (by_column) {
+      for (cudf::size_type c = 0; c < n_cols; ++c) {
+        cudf::copy_if_else(lhs->get_column(c), rhs->get_column(c), decision->get_column(0));
+      }
+    } else {
+      cudf::copy_if_else(lhs->view(), rhs->view(), decision->get_column(0));
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * n_rows * n_cols * 3 *
+                          sizeof(TypeParam));
+}
+
 #define COPY_BENCHMARK_DEFINE(name, type, b)                  \
   BENCHMARK_DEFINE_F(CopyIfElse, name)                        \
   (::benchmark::State & st) { BM_copy_if_else<type>(st, b); } \
@@ -65,3 +90,17 @@ COPY_BENCHMARK_DEFINE(float64, double, true)
 COPY_BENCHMARK_DEFINE(int16_no_nulls, int16_t, false)
 COPY_BENCHMARK_DEFINE(uint32_no_nulls, uint32_t, false)
 COPY_BENCHMARK_DEFINE(float64_no_nulls, double, false)
+
+#define COPY_TABLE_BENCHMARK_DEFINE(name, type, b)                  \
+  BENCHMARK_DEFINE_F(CopyIfElse, name)                              \
+  (::benchmark::State & st) { BM_copy_if_else_table<type>(st, b); } \
+  BENCHMARK_REGISTER_F(CopyIfElse, name)                            \
+    ->RangeMultiplier(8)                                            \
+    ->Ranges({{1 << 12, 1 << 24}, {1, 64}})                         \
+    ->UseManualTime()                                               \
+    ->Unit(benchmark::kMillisecond);
+
+COPY_TABLE_BENCHMARK_DEFINE(table_int32, int32_t, false)
+COPY_TABLE_BENCHMARK_DEFINE(table_int32_by_column, int32_t, true)
+COPY_TABLE_BENCHMARK_DEFINE(table_float64, double, false)
+COPY_TABLE_BENCHMARK_DEFINE(table_float64_by_column, double, true)
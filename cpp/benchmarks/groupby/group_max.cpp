@@ -26,13 +26,16 @@ void bench_groupby_max(nvbench::state& state, nvbench::type_list<Type>)
 {
   cudf::rmm_pool_raii pool_raii;
   const auto size = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  // with ZIPF, a few hot keys make up most of the rows
+  auto const key_dist = state.get_string("key_distribution") == "ZIPF" ? distribution_id::ZIPF
+                                                                        : distribution_id::UNIFORM;
 
   auto const keys_table = [&] {
     data_profile profile;
     profile.set_null_frequency(std::nullopt);
     profile.set_cardinality(0);
     profile.set_distribution_params<int32_t>(
-      cudf::type_to_id<int32_t>(), distribution_id::UNIFORM, 0, 100);
+      cudf::type_to_id<int32_t>(), key_dist, 0, 100);
     return create_random_table({cudf::type_to_id<int32_t>()}, row_count{size}, profile);
   }();
 
@@ -70,4 +73,5 @@ NVBENCH_BENCH_TYPES(bench_groupby_max,
                     NVBENCH_TYPE_AXES(nvbench::type_list<int32_t, int64_t, float, double>))
   .set_name("groupby_max")
   .add_int64_power_of_two_axis("num_rows", {12, 18, 24})
-  .add_float64_axis("null_frequency", {0, 0.1, 0.9});
+  .add_float64_axis("null_frequency", {0, 0.1, 0.9})
+  .add_string_axis("key_distribution", {"UNIFORM", "ZIPF"});
@@ -19,6 +19,7 @@
 #include <benchmarks/synchronization/synchronization.hpp>
 
 #include <cudf/hashing.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -40,6 +41,24 @@ static void BM_hash(benchmark::State& state, cudf::hash_id hid, contains_nulls h
   }
 }
 
+static void BM_hash_strings(benchmark::State& state, cudf::hash_id hid)
+{
+  cudf::size_type const n_rows{(cudf::size_type)state.range(0)};
+  cudf::size_type const max_str_length{(cudf::size_type)state.range(1)};
+  data_profile profile;
+  profile.set_distribution_params(
+    cudf::type_id::STRING, distribution_id::NORMAL, 0, max_str_length);
+  auto const data = create_random_table({cudf::type_id::STRING}, row_count{n_rows}, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, cudf::default_stream_value);
+    cudf::hash(data->view(), hid);
+  }
+
+  state.SetBytesProcessed(state.iterations() *
+                          cudf::strings_column_view(data->get_column(0)).chars_size());
+}
+
 #define concat(a, b, c) a##b##c
 
 #define H_BENCHMARK_DEFINE(name, hid, n)                                            \
@@ -53,10 +72,33 @@ static void BM_hash(benchmark::State& state, cudf::hash_id hid, contains_nulls h
 
 #define HASH_BENCHMARK_DEFINE(hid, n) H_BENCHMARK_DEFINE(concat(hid, _, n), hid, n)
 
+// Short strings fit in a single message chunk while long strings span many chunks
+#define S_BENCHMARK_DEFINE(name, hid)                                    \
+  BENCHMARK_DEFINE_F(HashBenchmark, name)                                \
+  (::benchmark::State & st) { BM_hash_strings(st, cudf::hash_id::hid); } \
+  BENCHMARK_REGISTER_F(HashBenchmark, name)                              \
+    ->RangeMultiplier(4)                                                 \
+    ->Ranges({{1 << 14, 1 << 20}, {32, 2048}})                           \
+    ->UseManualTime()                                                    \
+    ->Unit(benchmark::kMillisecond);
+
+#define HASH_STRINGS_BENCHMARK_DEFINE(hid) S_BENCHMARK_DEFINE(concat(hid, _, strings), hid)
+
 HASH_BENCHMARK_DEFINE(HASH_MURMUR3, nulls)
 HASH_BENCHMARK_DEFINE(HASH_SPARK_MURMUR3, nulls)
 HASH_BENCHMARK_DEFINE(HASH_MD5, nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA1, nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA256, nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA512, nulls)
 
 HASH_BENCHMARK_DEFINE(HASH_MURMUR3, no_nulls)
 HASH_BENCHMARK_DEFINE(HASH_SPARK_MURMUR3, no_nulls)
 HASH_BENCHMARK_DEFINE(HASH_MD5, no_nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA1, no_nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA256, no_nulls)
+HASH_BENCHMARK_DEFINE(HASH_SHA512, no_nulls)
+
+HASH_STRINGS_BENCHMARK_DEFINE(HASH_MD5)
+HASH_STRINGS_BENCHMARK_DEFINE(HASH_SHA1)
+HASH_STRINGS_BENCHMARK_DEFINE(HASH_SHA256)
+HASH_STRINGS_BENCHMARK_DEFINE(HASH_SHA512)
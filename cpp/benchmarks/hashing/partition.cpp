@@ -21,6 +21,7 @@
 #include <cudf/partitioning.hpp>
 
 #include <algorithm>
+#include <optional>
 
 class Hashing : public cudf::benchmark {
 };
@@ -52,7 +53,7 @@ BENCHMARK_DEFINE_F(Hashing, hash_partition)
 static void CustomRanges(benchmark::internal::Benchmark* b)
 {
   for (int columns = 1; columns <= 256; columns *= 16) {
-    for (int partitions = 64; partitions <= 1024; partitions *= 2) {
+    for (int partitions = 64; partitions <= 8192; partitions *= 2) {
       for (int rows = 1 << 17; rows <= 1 << 21; rows *= 2) {
         b->Args({rows, columns, partitions});
       }
@@ -64,3 +65,49 @@ BENCHMARK_REGISTER_F(Hashing, hash_partition)
   ->Apply(CustomRanges)
   ->Unit(benchmark::kMillisecond)
   ->UseManualTime();
+
+template <class T>
+void BM_hash_partition_skewed(benchmark::State& state, distribution_id key_dist)
+{
+  auto const num_rows       = static_cast<cudf::size_type>(state.range(0));
+  auto const num_partitions = state.range(1);
+
+  // with ZIPF, most rows have a few hot keys and land in a few partitions
+  data_profile profile;
+  profile.set_null_frequency(std::nullopt);
+  profile.set_cardinality(0);
+  profile.set_distribution_params<T>(
+    cudf::type_to_id<T>(), key_dist, static_cast<T>(0), static_cast<T>(num_rows - 1));
+  auto const input_table =
+    create_random_table({cudf::type_to_id<T>()}, row_count{num_rows}, profile);
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+    auto output = cudf::hash_partition(input_table->view(), {0}, num_partitions);
+  }
+}
+
+BENCHMARK_DEFINE_F(Hashing, hash_partition_uniform_keys)
+(::benchmark::State& state) { BM_hash_partition_skewed<int64_t>(state, distribution_id::UNIFORM); }
+
+BENCHMARK_DEFINE_F(Hashing, hash_partition_zipf_keys)
+(::benchmark::State& state) { BM_hash_partition_skewed<int64_t>(state, distribution_id::ZIPF); }
+
+static void SkewedRanges(benchmark::internal::Benchmark* b)
+{
+  for (int partitions = 64; partitions <= 8192; partitions *= 8) {
+    for (int rows = 1 << 17; rows <= 1 << 23; rows *= 4) {
+      b->Args({rows, partitions});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(Hashing, hash_partition_uniform_keys)
+  ->Apply(SkewedRanges)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
+
+BENCHMARK_REGISTER_F(Hashing, hash_partition_zipf_keys)
+  ->Apply(SkewedRanges)
+  ->Unit(benchmark::kMillisecond)
+  ->UseManualTime();
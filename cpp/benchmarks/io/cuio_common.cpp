@@ -20,7 +20,9 @@
 #include <fstream>
 #include <numeric>
 #include <string>
+#include <thread>
 
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace cudf_io = cudf::io;
@@ -38,8 +40,69 @@ std::string random_file_in_dir(std::string const& dir_path)
   return filename;
 }
 
-cuio_source_sink_pair::cuio_source_sink_pair(io_type type)
-  : type{type}, file_name{random_file_in_dir(tmpdir.path())}
+throttled_datasource::throttled_datasource(std::unique_ptr<cudf_io::datasource> source,
+                                           storage_throttle throttle)
+  : _source{std::move(source)}, _throttle{throttle}
+{
+  CUDF_EXPECTS(_throttle.bytes_per_second > 0, "Bandwidth must be positive");
+}
+
+void throttled_datasource::wait_for_transfer(size_t size) const
+{
+  auto const transfer_time = std::chrono::duration<double>(size / _throttle.bytes_per_second);
+  std::this_thread::sleep_for(_throttle.latency + transfer_time);
+}
+
+std::unique_ptr<cudf_io::datasource::buffer> throttled_datasource::host_read(size_t offset,
+                                                                              size_t size)
+{
+  wait_for_transfer(size);
+  return _source->host_read(offset, size);
+}
+
+size_t throttled_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  wait_for_transfer(size);
+  return _source->host_read(offset, size, dst);
+}
+
+bool throttled_datasource::supports_device_read() const { return _source->supports_device_read(); }
+
+bool throttled_datasource::is_device_read_preferred(size_t size) const
+{
+  return _source->is_device_read_preferred(size);
+}
+
+std::unique_ptr<cudf_io::datasource::buffer> throttled_datasource::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  wait_for_transfer(size);
+  return _source->device_read(offset, size, stream);
+}
+
+size_t throttled_datasource::device_read(size_t offset,
+                                         size_t size,
+                                         uint8_t* dst,
+                                         rmm::cuda_stream_view stream)
+{
+  wait_for_transfer(size);
+  return _source->device_read(offset, size, dst, stream);
+}
+
+std::future<size_t> throttled_datasource::device_read_async(size_t offset,
+                                                            size_t size,
+                                                            uint8_t* dst,
+                                                            rmm::cuda_stream_view stream)
+{
+  return std::async(std::launch::async, [this, offset, size, dst, stream] {
+    return device_read(offset, size, dst, stream);
+  });
+}
+
+size_t throttled_datasource::size() const { return _source->size(); }
+
+cuio_source_sink_pair::cuio_source_sink_pair(io_type type, storage_throttle throttle)
+  : type{type}, throttle{throttle}, file_name{random_file_in_dir(tmpdir.path())}
 {
 }
 
@@ -48,6 +111,10 @@ cudf_io::source_info cuio_source_sink_pair::make_source_info()
   switch (type) {
     case io_type::FILEPATH: return cudf_io::source_info(file_name);
     case io_type::HOST_BUFFER: return cudf_io::source_info(buffer.data(), buffer.size());
+    case io_type::USER_IMPLEMENTED:
+      throttled_source =
+        std::make_unique<throttled_datasource>(cudf_io::datasource::create(file_name), throttle);
+      return cudf_io::source_info(throttled_source.get());
     default: CUDF_FAIL("invalid input type");
   }
 }
@@ -56,7 +123,8 @@ cudf_io::sink_info cuio_source_sink_pair::make_sink_info()
 {
   switch (type) {
     case io_type::VOID: return cudf_io::sink_info(&void_sink);
-    case io_type::FILEPATH: return cudf_io::sink_info(file_name);
+    case io_type::FILEPATH:
+    case io_type::USER_IMPLEMENTED: return cudf_io::sink_info(file_name);
     case io_type::HOST_BUFFER: return cudf_io::sink_info(&buffer);
     default: CUDF_FAIL("invalid output type");
   }
@@ -67,6 +135,7 @@ size_t cuio_source_sink_pair::size()
   switch (type) {
     case io_type::VOID: return void_sink.bytes_written();
     case io_type::FILEPATH:
+    case io_type::USER_IMPLEMENTED:
       return static_cast<size_t>(
         std::ifstream(file_name, std::ifstream::ate | std::ifstream::binary).tellg());
     case io_type::HOST_BUFFER: return buffer.size();
@@ -74,6 +143,19 @@ size_t cuio_source_sink_pair::size()
   }
 }
 
+void cuio_source_sink_pair::evict_from_page_cache()
+{
+  if (type != io_type::FILEPATH) { return; }
+
+  auto const fd = open(file_name.c_str(), O_RDONLY);
+  CUDF_EXPECTS(fd != -1, "Cannot open the benchmark file");
+  // only clean pages are evicted, so write back the dirty ones first
+  auto const is_evicted =
+    fdatasync(fd) == 0 and posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0;
+  close(fd);
+  CUDF_EXPECTS(is_evicted, "Failed to evict the benchmark file from the page cache");
+}
+
 std::vector<cudf::type_id> dtypes_for_column_selection(std::vector<cudf::type_id> const& data_types,
                                                        column_selection col_sel)
 {
@@ -22,6 +22,9 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/types.hpp>
 
+#include <chrono>
+#include <memory>
+
 using cudf::io::io_type;
 
 #define RD_BENCHMARK_DEFINE_ALL_SOURCES(benchmark, name, type_or_group)                  \
@@ -35,8 +38,61 @@ using cudf::io::io_type;
 
 std::string random_file_in_dir(std::string const& dir_path);
 
+/**
+ * @brief Latency and bandwidth of a simulated storage device.
+ */
+struct storage_throttle {
+  std::chrono::microseconds latency;  ///< Time to the first byte of each read
+  double bytes_per_second;            ///< Transfer rate of each read
+};
+
+/**
+ * @brief Datasource that delays the reads of another datasource to model remote storage.
+ *
+ * Each read blocks for the latency plus the time to transfer its bytes at the given bandwidth
+ * before it reads from the wrapped source. Concurrent reads are delayed independently, like the
+ * requests to an object store.
+ */
+class throttled_datasource : public cudf::io::datasource {
+ public:
+  throttled_datasource(std::unique_ptr<cudf::io::datasource> source, storage_throttle throttle);
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  [[nodiscard]] bool supports_device_read() const override;
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override;
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] size_t size() const override;
+
+ private:
+  void wait_for_transfer(size_t size) const;
+
+  std::unique_ptr<cudf::io::datasource> const _source;
+  storage_throttle const _throttle;
+};
+
 /**
  * @brief Class to create a coupled `source_info` and `sink_info` of given type.
+ *
+ * With `io_type::USER_IMPLEMENTED` the data is written to a file and read through a
+ * `throttled_datasource` with the given throttle.
  */
 class cuio_source_sink_pair {
   class bytes_written_only_sink : public cudf::io::data_sink {
@@ -49,7 +105,7 @@ class cuio_source_sink_pair {
   };
 
  public:
-  cuio_source_sink_pair(io_type type);
+  cuio_source_sink_pair(io_type type, storage_throttle throttle = {});
   ~cuio_source_sink_pair()
   {
     // delete the temporary file
@@ -77,13 +133,26 @@ class cuio_source_sink_pair {
 
   [[nodiscard]] size_t size();
 
+  /**
+   * @brief Evicts the file of an `io_type::FILEPATH` pair from the OS page cache
+   *
+   * The next read then comes from the storage device, as when a dataset is read for the first
+   * time. Unlike `try_drop_l3_cache`, this does not need root access. Has no effect for other
+   * types.
+   *
+   * @throw cudf::logic_error if the file cannot be evicted
+   */
+  void evict_from_page_cache();
+
  private:
   static temp_directory const tmpdir;
 
   io_type const type;
+  storage_throttle const throttle;
   std::vector<char> buffer;
   std::string const file_name;
   bytes_written_only_sink void_sink;
+  std::unique_ptr<throttled_datasource> throttled_source;
 };
 
 /**
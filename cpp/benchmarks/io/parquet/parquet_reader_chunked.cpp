@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/io/parquet.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+constexpr size_t data_size           = 512 << 20;
+constexpr size_t row_group_size      = 32 << 20;
+constexpr cudf::size_type num_cols   = 64;
+constexpr size_t default_chunk_limit = 64 << 20;
+
+namespace cudf_io = cudf::io;
+
+void nvbench_parquet_read_chunked(nvbench::state& state)
+{
+  auto const source_type    = static_cast<io_type>(state.get_int64("io_type"));
+  auto const pipeline_depth = static_cast<cudf::size_type>(state.get_int64("pipeline_depth"));
+  auto const compression    = state.get_int64("compression") ? cudf_io::compression_type::SNAPPY
+                                                             : cudf_io::compression_type::NONE;
+
+  auto const tbl =
+    create_random_table(cycle_dtypes(get_type_or_group({int32_t(type_group_id::INTEGRAL),
+                                                        int32_t(type_group_id::FLOATING_POINT),
+                                                        int32_t(cudf::type_id::STRING)}),
+                                     num_cols),
+                        table_size_bytes{data_size});
+  auto const view = tbl->view();
+
+  cuio_source_sink_pair source_sink(source_type);
+  cudf_io::parquet_writer_options write_opts =
+    cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+      .compression(compression)
+      .row_group_size_bytes(row_group_size);
+  cudf_io::write_parquet(write_opts);
+
+  cudf_io::parquet_reader_options const read_opts =
+    cudf_io::parquet_reader_options::builder(source_sink.make_source_info())
+      .pipeline_depth(pipeline_depth);
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.add_global_memory_reads<int64_t>(data_size);
+  state.add_element_count(view.num_columns() * view.num_rows());
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               try_drop_l3_cache();
+
+               timer.start();
+               auto reader = cudf_io::chunked_parquet_reader(default_chunk_limit, read_opts);
+               cudf::size_type num_rows_read = 0;
+               while (reader.has_next()) {
+                 num_rows_read += reader.read_chunk().tbl->num_rows();
+               }
+               timer.stop();
+
+               CUDF_EXPECTS(num_rows_read == view.num_rows(),
+                            "Benchmark did not read the entire table");
+             });
+
+  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+  state.add_buffer_size(source_sink.size(), "efs", "Encoded File Size");
+}
+
+NVBENCH_BENCH(nvbench_parquet_read_chunked)
+  .set_name("parquet_read_chunked")
+  .set_min_samples(4)
+  .add_int64_axis("io_type", {int64_t(io_type::FILEPATH), int64_t(io_type::HOST_BUFFER)})
+  .add_int64_axis("pipeline_depth", {0, 1, 2})
+  .add_int64_axis("compression", {0, 1});
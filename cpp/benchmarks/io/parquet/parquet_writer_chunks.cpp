@@ -60,6 +60,7 @@ void PQ_write_chunked(benchmark::State& state)
 {
   cudf::size_type num_cols   = state.range(0);
   cudf::size_type num_tables = state.range(1);
+  auto const sink_type       = static_cast<io_type>(state.range(2));
 
   std::vector<std::unique_ptr<cudf::table>> tables;
   for (cudf::size_type idx = 0; idx < num_tables; idx++) {
@@ -68,7 +69,7 @@ void PQ_write_chunked(benchmark::State& state)
   }
 
   auto mem_stats_logger = cudf::memory_stats_logger();
-  cuio_source_sink_pair source_sink(io_type::VOID);
+  cuio_source_sink_pair source_sink(sink_type);
   for (auto _ : state) {
     cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
     cudf_io::chunked_parquet_writer_options opts =
@@ -95,19 +96,23 @@ void PQ_write_chunked(benchmark::State& state)
 PWBM_BENCHMARK_DEFINE(3Gb8Cols, data_size, 8);
 PWBM_BENCHMARK_DEFINE(3Gb1024Cols, data_size, 1024);
 
-#define PWCBM_BENCHMARK_DEFINE(name, num_columns, num_chunks)               \
+#define PWCBM_BENCHMARK_DEFINE(name, num_columns, num_chunks, sink_type)    \
   BENCHMARK_DEFINE_F(ParquetWriteChunked, name)(::benchmark::State & state) \
   {                                                                         \
     PQ_write_chunked(state);                                                \
   }                                                                         \
   BENCHMARK_REGISTER_F(ParquetWriteChunked, name)                           \
-    ->Args({num_columns, num_chunks})                                       \
+    ->Args({num_columns, num_chunks, static_cast<int32_t>(sink_type)})      \
     ->Unit(benchmark::kMillisecond)                                         \
     ->UseManualTime()                                                       \
     ->Iterations(4)
 
-PWCBM_BENCHMARK_DEFINE(3Gb8Cols64Chunks, 8, 8);
-PWCBM_BENCHMARK_DEFINE(3Gb1024Cols64Chunks, 1024, 8);
+PWCBM_BENCHMARK_DEFINE(3Gb8Cols64Chunks, 8, 8, io_type::VOID);
+PWCBM_BENCHMARK_DEFINE(3Gb1024Cols64Chunks, 1024, 8, io_type::VOID);
+
+PWCBM_BENCHMARK_DEFINE(3Gb8Cols128Chunks, 8, 64, io_type::VOID);
+PWCBM_BENCHMARK_DEFINE(3Gb1024Cols128Chunks, 1024, 64, io_type::VOID);
 
-PWCBM_BENCHMARK_DEFINE(3Gb8Cols128Chunks, 8, 64);
-PWCBM_BENCHMARK_DEFINE(3Gb1024Cols128Chunks, 1024, 64);
+// Host sinks, where writing the encoded chunks overlaps with encoding the next table
+PWCBM_BENCHMARK_DEFINE(3Gb512Cols64ChunksFile, 512, 64, io_type::FILEPATH);
+PWCBM_BENCHMARK_DEFINE(3Gb512Cols64ChunksHostBuffer, 512, 64, io_type::HOST_BUFFER);
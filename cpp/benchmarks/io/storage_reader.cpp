@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/io/orc.hpp>
+#include <cudf/io/parquet.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+//
+// Reads from the storage the datasets actually live on rather than from warm host memory:
+//  - host_buffer: the file is in host memory, as a baseline
+//  - hot_file:    a local file that is in the OS page cache
+//  - cold_file:   a local file evicted from the page cache before every read
+//  - remote:      a local file behind a datasource with the latency and bandwidth of an object
+//                 store
+// Set LIBCUDF_CUFILE_POLICY=GDS to read local files into device memory with cuFile (GDS).
+
+constexpr size_t data_size         = 512 << 20;
+constexpr cudf::size_type num_cols = 64;
+
+constexpr storage_throttle object_store_throttle{std::chrono::milliseconds{10}, 500e6};
+
+namespace cudf_io = cudf::io;
+
+namespace {
+
+cuio_source_sink_pair make_source_sink(std::string const& storage)
+{
+  if (storage == "host_buffer") { return cuio_source_sink_pair(io_type::HOST_BUFFER); }
+  if (storage == "remote") {
+    return cuio_source_sink_pair(io_type::USER_IMPLEMENTED, object_store_throttle);
+  }
+  return cuio_source_sink_pair(io_type::FILEPATH);
+}
+
+std::unique_ptr<cudf::table> make_table()
+{
+  return create_random_table(cycle_dtypes(get_type_or_group({int32_t(type_group_id::INTEGRAL),
+                                                             int32_t(type_group_id::FLOATING_POINT),
+                                                             int32_t(cudf::type_id::STRING)}),
+                                          num_cols),
+                             table_size_bytes{data_size});
+}
+
+template <typename Read>
+void time_reads(nvbench::state& state,
+                cuio_source_sink_pair& source_sink,
+                cudf::size_type num_rows,
+                Read read)
+{
+  auto const is_cold = state.get_string("storage") == "cold_file";
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.add_global_memory_reads<int64_t>(data_size);
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               if (is_cold) { source_sink.evict_from_page_cache(); }
+
+               timer.start();
+               auto const num_rows_read = read();
+               timer.stop();
+
+               CUDF_EXPECTS(num_rows_read == num_rows, "Benchmark did not read the entire table");
+             });
+
+  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+  state.add_buffer_size(source_sink.size(), "efs", "Encoded File Size");
+}
+
+}  // namespace
+
+void nvbench_parquet_read_storage(nvbench::state& state)
+{
+  auto const tbl   = make_table();
+  auto source_sink = make_source_sink(state.get_string("storage"));
+  cudf_io::write_parquet(
+    cudf_io::parquet_writer_options::builder(source_sink.make_sink_info(), tbl->view()));
+
+  auto const read_opts =
+    cudf_io::parquet_reader_options::builder(source_sink.make_source_info()).build();
+  time_reads(state, source_sink, tbl->num_rows(), [&] {
+    return cudf_io::read_parquet(read_opts).tbl->num_rows();
+  });
+}
+
+void nvbench_orc_read_storage(nvbench::state& state)
+{
+  auto const tbl   = make_table();
+  auto source_sink = make_source_sink(state.get_string("storage"));
+  cudf_io::write_orc(
+    cudf_io::orc_writer_options::builder(source_sink.make_sink_info(), tbl->view()));
+
+  auto const read_opts =
+    cudf_io::orc_reader_options::builder(source_sink.make_source_info()).build();
+  time_reads(state, source_sink, tbl->num_rows(), [&] {
+    return cudf_io::read_orc(read_opts).tbl->num_rows();
+  });
+}
+
+NVBENCH_BENCH(nvbench_parquet_read_storage)
+  .set_name("parquet_read_storage")
+  .set_min_samples(4)
+  .add_string_axis("storage", {"host_buffer", "hot_file", "cold_file", "remote"});
+
+NVBENCH_BENCH(nvbench_orc_read_storage)
+  .set_name("orc_read_storage")
+  .set_min_samples(4)
+  .add_string_axis("storage", {"host_buffer", "hot_file", "cold_file", "remote"});
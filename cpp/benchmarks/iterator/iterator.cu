@@ -20,6 +20,7 @@
 #include <cudf_test/column_wrapper.hpp>
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/reduction.cuh>
 #include <cudf/detail/utilities/device_operators.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -34,6 +35,7 @@
 #include <thrust/pair.h>
 #include <thrust/reduce.h>
 
+#include <optional>
 #include <random>
 
 template <typename T>
@@ -223,6 +225,46 @@ void BM_pair_iterator(benchmark::State& state)
                           sizeof(TypeParam));
 }
 
+// -----------------------------------------------------------------------------
+template <typename T>
+void tile_validity_bench(cudf::column_view& col)
+{
+  auto d_col = cudf::column_device_view::create(col);
+  auto op    = cudf::reduction::op::sum{};
+  cudf::reduction::detail::reduce_valid_elements<T>(*d_col,
+                                                    op.template get_element_transformer<T>(),
+                                                    op,
+                                                    std::optional<T>{},
+                                                    cudf::default_stream_value,
+                                                    rmm::mr::get_current_device_resource());
+}
+
+template <class TypeParam, bool tiles_or_iterator>
+void BM_null_iterator(benchmark::State& state)
+{
+  const cudf::size_type column_size{(cudf::size_type)state.range(0)};
+  using T      = TypeParam;
+  auto num_gen = thrust::counting_iterator<cudf::size_type>(0);
+  auto null_gen =
+    thrust::make_transform_iterator(num_gen, [](cudf::size_type row) { return row % 2 == 0; });
+
+  cudf::test::fixed_width_column_wrapper<T> wrap_hasnull_T(
+    num_gen, num_gen + column_size, null_gen);
+  cudf::column_view hasnull_T = wrap_hasnull_T;
+
+  auto dev_result = cudf::detail::make_zeroed_device_uvector_sync<TypeParam>(1);
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if (tiles_or_iterator) {
+      tile_validity_bench<T>(hasnull_T);  // validities read one bitmask word per 32 rows
+    } else {
+      iterator_bench_cub<T, true>(hasnull_T, dev_result);  // driven by iterator with nulls
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * column_size *
+                          sizeof(TypeParam));
+}
+
 #define ITER_BM_BENCHMARK_DEFINE(name, type, cub_or_thrust, raw_or_iterator) \
   BENCHMARK_DEFINE_F(Iterator, name)(::benchmark::State & state)             \
   {                                                                          \
@@ -252,3 +294,17 @@ ITER_BM_BENCHMARK_DEFINE(double_thrust_iter, double, false, false);
 
 PAIRITER_BM_BENCHMARK_DEFINE(double_cub_pair, double, true);
 PAIRITER_BM_BENCHMARK_DEFINE(double_thrust_pair, double, false);
+
+#define NULLITER_BM_BENCHMARK_DEFINE(name, type, tiles_or_iterator) \
+  BENCHMARK_DEFINE_F(Iterator, name)(::benchmark::State & state)    \
+  {                                                                 \
+    BM_null_iterator<type, tiles_or_iterator>(state);               \
+  }                                                                 \
+  BENCHMARK_REGISTER_F(Iterator, name)                              \
+    ->RangeMultiplier(10)                                           \
+    ->Range(1000, 10000000)                                         \
+    ->UseManualTime()                                               \
+    ->Unit(benchmark::kMillisecond);
+
+NULLITER_BM_BENCHMARK_DEFINE(double_cub_null_iter, double, false);
+NULLITER_BM_BENCHMARK_DEFINE(double_tile_validity, double, true);
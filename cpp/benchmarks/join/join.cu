@@ -14,9 +14,19 @@
  * limitations under the License.
  */
 
+#include <benchmarks/common/generate_input.hpp>
 #include <benchmarks/fixture/rmm_pool_raii.hpp>
 #include <benchmarks/join/join_common.hpp>
 
+#include <cudf/copying.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <rmm/cuda_stream_pool.hpp>
+
+#include <thread>
+#include <vector>
+
 void skip_helper(nvbench::state& state)
 {
   auto const build_table_size = state.get_int64("Build Table Size");
@@ -93,6 +103,94 @@ void nvbench_full_join(nvbench::state& state,
   BM_join<key_type, payload_type, Nullable>(state, join);
 }
 
+template <typename key_type>
+void nvbench_inner_join_streams(nvbench::state& state, nvbench::type_list<key_type>)
+{
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const build_table_size = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const num_streams      = static_cast<cudf::size_type>(state.get_int64("Streams"));
+
+  auto build_keys =
+    cudf::make_numeric_column(cudf::data_type(cudf::type_to_id<key_type>()), build_table_size);
+  auto probe_keys =
+    cudf::make_numeric_column(cudf::data_type(cudf::type_to_id<key_type>()), probe_table_size);
+  generate_input_tables<key_type, cudf::size_type>(build_keys->mutable_view().data<key_type>(),
+                                                   build_table_size,
+                                                   probe_keys->mutable_view().data<key_type>(),
+                                                   probe_table_size,
+                                                   0.3,
+                                                   1);
+
+  // the hash table is built once and shared by all streams
+  cudf::hash_join hj_obj(cudf::table_view{{build_keys->view()}}, cudf::null_equality::UNEQUAL);
+
+  // every stream probes its own batch of the probe table from its own host thread
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type i = 1; i < num_streams; i++) {
+    splits.push_back(static_cast<cudf::size_type>(int64_t{probe_table_size} * i / num_streams));
+  }
+  auto const batches = cudf::split(probe_keys->view(), splits);
+  rmm::cuda_stream_pool stream_pool(num_streams);
+
+  state.add_element_count(probe_table_size);
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               timer.start();
+               std::vector<std::thread> threads;
+               for (cudf::size_type i = 0; i < num_streams; i++) {
+                 threads.emplace_back([&, i]() {
+                   auto const stream = stream_pool.get_stream(i);
+                   auto result = hj_obj.inner_join(cudf::table_view{{batches[i]}}, {}, stream);
+                   stream.synchronize();
+                 });
+               }
+               for (auto& thread : threads) {
+                 thread.join();
+               }
+               timer.stop();
+             });
+}
+
+template <typename key_type>
+void nvbench_inner_join_skewed(nvbench::state& state, nvbench::type_list<key_type>)
+{
+  skip_helper(state);
+
+  // TODO: to be replaced by nvbench fixture once it's ready
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const build_table_size = static_cast<cudf::size_type>(state.get_int64("Build Table Size"));
+  auto const probe_table_size = static_cast<cudf::size_type>(state.get_int64("Probe Table Size"));
+  auto const probe_dist = state.get_string("Probe Key Distribution") == "ZIPF"
+                            ? distribution_id::ZIPF
+                            : distribution_id::UNIFORM;
+
+  // unique build keys, so that the output size is the probe table size for any distribution
+  auto const build_keys = cudf::sequence(build_table_size, cudf::numeric_scalar<key_type>(0));
+
+  // with ZIPF, most probe rows hit a few hot keys at the start of the build table
+  data_profile profile;
+  profile.set_null_frequency(std::nullopt);
+  profile.set_cardinality(0);
+  profile.set_distribution_params<key_type>(cudf::type_to_id<key_type>(),
+                                            probe_dist,
+                                            static_cast<key_type>(0),
+                                            static_cast<key_type>(build_table_size - 1));
+  auto const probe_table =
+    create_random_table({cudf::type_to_id<key_type>()}, row_count{probe_table_size}, profile);
+
+  cudf::hash_join hj_obj(cudf::table_view{{build_keys->view()}}, cudf::null_equality::UNEQUAL);
+
+  state.add_element_count(probe_table_size);
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = hj_obj.inner_join(probe_table->view());
+  });
+}
+
 // inner join -----------------------------------------------------------------------
 NVBENCH_BENCH_TYPES(nvbench_inner_join,
                     NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t>,
@@ -132,6 +230,22 @@ NVBENCH_BENCH_TYPES(nvbench_inner_join,
   .add_int64_axis("Build Table Size", {40'000'000, 50'000'000})
   .add_int64_axis("Probe Table Size", {50'000'000, 120'000'000});
 
+NVBENCH_BENCH_TYPES(nvbench_inner_join_streams,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t>))
+  .set_name("inner_join_32bit_streams")
+  .set_type_axes_names({"Key Type"})
+  .add_int64_axis("Build Table Size", {10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000, 100'000'000})
+  .add_int64_axis("Streams", {1, 2, 4, 8, 16});
+
+NVBENCH_BENCH_TYPES(nvbench_inner_join_skewed,
+                    NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t, nvbench::int64_t>))
+  .set_name("inner_join_skewed")
+  .set_type_axes_names({"Key Type"})
+  .add_int64_axis("Build Table Size", {100'000, 10'000'000})
+  .add_int64_axis("Probe Table Size", {10'000'000, 100'000'000})
+  .add_string_axis("Probe Key Distribution", {"UNIFORM", "ZIPF"});
+
 // left join ------------------------------------------------------------------------
 NVBENCH_BENCH_TYPES(nvbench_left_join,
                     NVBENCH_TYPE_AXES(nvbench::type_list<nvbench::int32_t>,
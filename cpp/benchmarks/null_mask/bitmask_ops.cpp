@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table_view.hpp>
+
+class BitmaskOps : public cudf::benchmark {
+};
+
+template <bool is_and>
+void BM_bitmask_binop(benchmark::State& state)
+{
+  auto const num_rows = static_cast<cudf::size_type>(state.range(0));
+  auto const num_cols = static_cast<cudf::size_type>(state.range(1));
+  auto const input =
+    create_sequence_table(cycle_dtypes({cudf::type_id::INT8}, num_cols), row_count{num_rows}, 0.1);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    auto result = is_and ? cudf::bitmask_and(input->view()) : cudf::bitmask_or(input->view());
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * (num_cols + 1) * num_rows /
+                          8);
+}
+
+#define BITMASK_BINOP_BENCHMARK_DEFINE(name, is_and)                \
+  BENCHMARK_DEFINE_F(BitmaskOps, name)                              \
+  (::benchmark::State & state) { BM_bitmask_binop<is_and>(state); } \
+  BENCHMARK_REGISTER_F(BitmaskOps, name)                            \
+    ->ArgsProduct({{1 << 20, 1 << 24}, /* row count */              \
+                   {1, 2, 4, 16, 64}}) /* column count */           \
+    ->UseManualTime();
+
+BITMASK_BINOP_BENCHMARK_DEFINE(bitmask_and, true);
+BITMASK_BINOP_BENCHMARK_DEFINE(bitmask_or, false);
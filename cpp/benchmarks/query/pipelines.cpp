@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/join.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <memory>
+#include <vector>
+
+// Pipelines of libcudf calls shaped like TPC-H queries, to catch regressions in the cost of
+// composing operators: intermediate allocations, launches and synchronizations.
+
+namespace {
+
+constexpr cudf::size_type lineitem_rows_per_sf = 6'000'000;
+constexpr cudf::size_type orders_rows_per_sf   = 1'500'000;
+constexpr int32_t num_ship_days                = 2557;  // days from 1992-01-01 to 1998-12-31
+
+// column indices of the generated tables
+enum lineitem_column : cudf::size_type {
+  l_orderkey,
+  l_quantity,
+  l_extendedprice,
+  l_discount,
+  l_shipdate,
+  l_returnflag
+};
+enum orders_column : cudf::size_type { o_orderkey, o_custkey, o_orderdate };
+
+template <typename T>
+std::unique_ptr<cudf::column> make_uniform_column(cudf::size_type num_rows,
+                                                  T lower,
+                                                  T upper,
+                                                  unsigned seed)
+{
+  data_profile profile;
+  profile.set_null_frequency(std::nullopt);
+  profile.set_cardinality(0);
+  profile.set_avg_run_length(1);
+  profile.set_distribution_params(cudf::type_to_id<T>(), distribution_id::UNIFORM, lower, upper);
+  auto columns =
+    create_random_table({cudf::type_to_id<T>()}, row_count{num_rows}, profile, seed)->release();
+  return std::move(columns.front());
+}
+
+std::unique_ptr<cudf::table> make_lineitem(double scale_factor)
+{
+  auto const num_rows   = static_cast<cudf::size_type>(lineitem_rows_per_sf * scale_factor);
+  auto const num_orders = static_cast<cudf::size_type>(orders_rows_per_sf * scale_factor);
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, num_orders - 1, 1));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 1, 50, 2));
+  columns.push_back(make_uniform_column<double>(num_rows, 900., 105'000., 3));
+  columns.push_back(make_uniform_column<double>(num_rows, 0., 0.1, 4));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, num_ship_days - 1, 5));
+  columns.push_back(make_uniform_column<int8_t>(num_rows, 0, 2, 6));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+std::unique_ptr<cudf::table> make_orders(double scale_factor)
+{
+  auto const num_rows = static_cast<cudf::size_type>(orders_rows_per_sf * scale_factor);
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  auto keys = create_sequence_table({cudf::type_id::INT32}, row_count{num_rows})->release();
+  columns.push_back(std::move(keys.front()));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, num_rows / 10, 7));
+  columns.push_back(make_uniform_column<int32_t>(num_rows, 0, num_ship_days - 152, 8));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+// rows of `input` whose `column` compares to `value` with `op`
+std::unique_ptr<cudf::table> filter_rows(cudf::table_view const& input,
+                                         cudf::size_type column,
+                                         cudf::binary_operator op,
+                                         int32_t value)
+{
+  auto const mask = cudf::binary_operation(input.column(column),
+                                           cudf::numeric_scalar<int32_t>(value),
+                                           op,
+                                           cudf::data_type{cudf::type_id::BOOL8});
+  return cudf::apply_boolean_mask(input, mask->view());
+}
+
+// extendedprice * (1 - discount)
+std::unique_ptr<cudf::column> discounted_price(cudf::column_view const& extendedprice,
+                                               cudf::column_view const& discount)
+{
+  auto const float64        = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const one_minus_disc = cudf::binary_operation(
+    cudf::numeric_scalar<double>(1.), discount, cudf::binary_operator::SUB, float64);
+  return cudf::binary_operation(
+    extendedprice, one_minus_disc->view(), cudf::binary_operator::MUL, float64);
+}
+
+}  // namespace
+
+// TPC-H Q1: Parquet scan, filter, computed column, groupby with several aggregations, sort
+void bench_scan_filter_groupby_sort(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+  auto const scale_factor = state.get_float64("scale_factor");
+
+  auto const lineitem = make_lineitem(scale_factor);
+  cuio_source_sink_pair source_sink(io_type::HOST_BUFFER);
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), lineitem->view()));
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(source_sink.make_source_info()).build();
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.add_element_count(lineitem->num_rows(), "lineitem rows");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto const scan     = cudf::io::read_parquet(read_opts).tbl;
+    auto const filtered = filter_rows(
+      scan->view(), l_shipdate, cudf::binary_operator::LESS_EQUAL, num_ship_days - 90);
+    auto const rows = filtered->view();
+    auto const disc_price =
+      discounted_price(rows.column(l_extendedprice), rows.column(l_discount));
+
+    std::vector<cudf::groupby::aggregation_request> requests(4);
+    requests[0].values = rows.column(l_quantity);
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    requests[1].values = rows.column(l_extendedprice);
+    requests[1].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[2].values = disc_price->view();
+    requests[2].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    requests[3].values = rows.column(l_discount);
+    requests[3].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    requests[3].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+
+    cudf::groupby::groupby grouper(cudf::table_view{{rows.column(l_returnflag)}});
+    auto const [keys, results] = grouper.aggregate(requests);
+
+    std::vector<cudf::column_view> output{keys->view().column(0)};
+    for (auto const& result : results) {
+      for (auto const& column : result.results) {
+        output.push_back(column->view());
+      }
+    }
+    auto const sorted = cudf::sort_by_key(cudf::table_view{output}, keys->view());
+  });
+  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+}
+
+// TPC-H Q3: filter two tables, hash join, computed column, groupby, top 10
+void bench_filter_join_groupby_topk(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+  auto const scale_factor = state.get_float64("scale_factor");
+
+  auto const lineitem = make_lineitem(scale_factor);
+  auto const orders   = make_orders(scale_factor);
+  auto const cutoff   = num_ship_days / 2;
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.add_element_count(lineitem->num_rows() + orders->num_rows(), "input rows");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto const open_orders =
+      filter_rows(orders->view(), o_orderdate, cudf::binary_operator::LESS, cutoff);
+    auto const shipped_items =
+      filter_rows(lineitem->view(), l_shipdate, cudf::binary_operator::GREATER, cutoff);
+
+    auto const [order_map, item_map] =
+      cudf::inner_join(open_orders->view().select({o_orderkey}),
+                       shipped_items->view().select({l_orderkey}));
+    auto const joined_orders = cudf::gather(
+      open_orders->view(),
+      cudf::column_view{cudf::device_span<cudf::size_type const>{*order_map}});
+    auto const joined_items = cudf::gather(
+      shipped_items->view(),
+      cudf::column_view{cudf::device_span<cudf::size_type const>{*item_map}});
+
+    auto const revenue = discounted_price(joined_items->view().column(l_extendedprice),
+                                          joined_items->view().column(l_discount));
+
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = revenue->view();
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    cudf::groupby::groupby grouper(cudf::table_view{
+      {joined_items->view().column(l_orderkey), joined_orders->view().column(o_orderdate)}});
+    auto const [keys, results] = grouper.aggregate(requests);
+
+    auto const top_order = cudf::top_k_order(cudf::table_view{{results[0].results[0]->view()}},
+                                             10,
+                                             {cudf::order::DESCENDING},
+                                             {cudf::null_order::AFTER});
+    auto const top_keys  = cudf::gather(keys->view(), top_order->view());
+  });
+  state.add_buffer_size(mem_stats_logger.peak_memory_usage(), "pmu", "Peak Memory Usage");
+}
+
+NVBENCH_BENCH(bench_scan_filter_groupby_sort)
+  .set_name("scan_filter_groupby_sort")
+  .add_float64_axis("scale_factor", {0.1, 1.0});
+
+NVBENCH_BENCH(bench_filter_join_groupby_topk)
+  .set_name("filter_join_groupby_topk")
+  .add_float64_axis("scale_factor", {0.1, 1.0});
@@ -21,6 +21,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
@@ -28,19 +29,43 @@ class ReductionScan : public cudf::benchmark {
 };
 
 template <typename type>
-static void BM_reduction_scan(benchmark::State& state, bool include_nulls)
+static void BM_reduction_scan(benchmark::State& state,
+                              bool include_nulls,
+                              cudf::aggregation::Kind kind = cudf::aggregation::MIN,
+                              cudf::null_policy null_handling = cudf::null_policy::EXCLUDE)
 {
   cudf::size_type const n_rows{(cudf::size_type)state.range(0)};
   auto const dtype = cudf::type_to_id<type>();
   auto const table = create_random_table({dtype}, row_count{n_rows});
   if (!include_nulls) table->get_column(0).set_null_mask(rmm::device_buffer{}, 0);
   cudf::column_view input(table->view().column(0));
+  auto const agg = kind == cudf::aggregation::SUM
+                     ? cudf::make_sum_aggregation<cudf::scan_aggregation>()
+                     : cudf::make_min_aggregation<cudf::scan_aggregation>();
 
   for (auto _ : state) {
     cuda_event_timer timer(state, true);
-    auto result = cudf::scan(
-      input, cudf::make_min_aggregation<cudf::scan_aggregation>(), cudf::scan_type::INCLUSIVE);
+    auto result = cudf::scan(input, agg, cudf::scan_type::INCLUSIVE, null_handling);
   }
+
+  // one read of the input and one write of the output
+  state.SetBytesProcessed(state.iterations() * 2 * n_rows * sizeof(type));
+}
+
+static void BM_reduction_scan_strings(benchmark::State& state)
+{
+  cudf::size_type const n_rows{(cudf::size_type)state.range(0)};
+  auto const table = create_random_table({cudf::type_id::STRING}, row_count{n_rows});
+  cudf::strings_column_view input(table->view().column(0));
+
+  for (auto _ : state) {
+    cuda_event_timer timer(state, true);
+    auto result = cudf::scan(input.parent(),
+                             cudf::make_min_aggregation<cudf::scan_aggregation>(),
+                             cudf::scan_type::INCLUSIVE);
+  }
+
+  state.SetBytesProcessed(state.iterations() * input.chars_size());
 }
 
 #define SCAN_BENCHMARK_DEFINE(name, type, nulls)                          \
@@ -61,3 +86,27 @@ SCAN_BENCHMARK_DEFINE(float_no_nulls, float, false);
 SCAN_BENCHMARK_DEFINE(int16_nulls, int16_t, true);
 SCAN_BENCHMARK_DEFINE(uint32_nulls, uint32_t, true);
 SCAN_BENCHMARK_DEFINE(double_nulls, double, true);
+
+#define SUM_SCAN_BENCHMARK_DEFINE(name, type, nulls, null_handling)                         \
+  BENCHMARK_DEFINE_F(ReductionScan, name)                                                   \
+  (::benchmark::State & state)                                                              \
+  {                                                                                         \
+    BM_reduction_scan<type>(state, nulls, cudf::aggregation::SUM, null_handling);           \
+  }                                                                                         \
+  BENCHMARK_REGISTER_F(ReductionScan, name)                                                 \
+    ->UseManualTime()                                                                       \
+    ->Arg(1000000)     /* 1M */                                                             \
+    ->Arg(100000000)   /* 100M */                                                           \
+    ->Arg(1000000000); /* 1B */
+
+SUM_SCAN_BENCHMARK_DEFINE(sum_int32_no_nulls, int32_t, false, cudf::null_policy::EXCLUDE);
+SUM_SCAN_BENCHMARK_DEFINE(sum_int32_nulls_exclude, int32_t, true, cudf::null_policy::EXCLUDE);
+SUM_SCAN_BENCHMARK_DEFINE(sum_int32_nulls_include, int32_t, true, cudf::null_policy::INCLUDE);
+
+BENCHMARK_DEFINE_F(ReductionScan, strings_min)
+(::benchmark::State& state) { BM_reduction_scan_strings(state); }
+BENCHMARK_REGISTER_F(ReductionScan, strings_min)
+  ->UseManualTime()
+  ->Arg(10000)     /* 10k */
+  ->Arg(1000000)   /* 1M */
+  ->Arg(10000000); /* 10M */
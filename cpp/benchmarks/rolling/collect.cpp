@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/rolling.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <optional>
+
+void bench_rolling_collect_list(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const num_rows    = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const window_size = static_cast<cudf::size_type>(state.get_int64("window_size"));
+  auto const null_freq   = state.get_float64("null_frequency");
+  auto const exclude     = static_cast<bool>(state.get_int64("exclude_nulls"));
+
+  // Keep the collected child column, one element per row of every window, within device memory
+  if (static_cast<int64_t>(num_rows) * window_size > (int64_t{1} << 30)) {
+    state.skip("Result too large");
+    return;
+  }
+
+  data_profile profile;
+  profile.set_null_frequency(null_freq > 0 ? std::optional{null_freq} : std::nullopt);
+  profile.set_cardinality(0);
+  profile.set_distribution_params<int32_t>(
+    cudf::type_to_id<int32_t>(), distribution_id::UNIFORM, 0, 1000);
+  auto const input_table =
+    create_random_table({cudf::type_to_id<int32_t>()}, row_count{num_rows}, profile);
+  auto const& input = input_table->get_column(0);
+
+  auto const agg = cudf::make_collect_list_aggregation<cudf::rolling_aggregation>(
+    exclude ? cudf::null_policy::EXCLUDE : cudf::null_policy::INCLUDE);
+
+  state.add_element_count(static_cast<int64_t>(num_rows) * window_size, "collected_elements");
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::default_stream_value.value()));
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const result = cudf::rolling_window(input, window_size, 0, 1, *agg);
+  });
+}
+
+NVBENCH_BENCH(bench_rolling_collect_list)
+  .set_name("rolling_collect_list")
+  .add_int64_axis("num_rows", {10'000, 100'000, 1'000'000})
+  .add_int64_axis("window_size", {1'000, 4'000, 10'000})
+  .add_float64_axis("null_frequency", {0, 0.1})
+  .add_int64_axis("exclude_nulls", {0, 1});
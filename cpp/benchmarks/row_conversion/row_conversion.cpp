@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+std::vector<cudf::type_id> const fixed_width_types{cudf::type_id::INT8,
+                                                   cudf::type_id::INT32,
+                                                   cudf::type_id::INT16,
+                                                   cudf::type_id::INT64,
+                                                   cudf::type_id::FLOAT32,
+                                                   cudf::type_id::BOOL8,
+                                                   cudf::type_id::UINT16,
+                                                   cudf::type_id::FLOAT64};
+
+std::vector<cudf::type_id> const mixed_types{cudf::type_id::INT32,
+                                             cudf::type_id::STRING,
+                                             cudf::type_id::INT64,
+                                             cudf::type_id::FLOAT64,
+                                             cudf::type_id::STRING,
+                                             cudf::type_id::INT8};
+
+std::unique_ptr<cudf::table> create_input_table(nvbench::state& state)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const num_cols    = static_cast<cudf::size_type>(state.get_int64("num_cols"));
+  auto const has_strings = static_cast<bool>(state.get_int64("has_strings"));
+
+  data_profile profile;
+  profile.set_null_frequency(0.1);
+  profile.set_distribution_params(cudf::type_id::STRING, distribution_id::NORMAL, 0, 32);
+
+  return create_random_table(cycle_dtypes(has_strings ? mixed_types : fixed_width_types, num_cols),
+                             row_count{num_rows},
+                             profile);
+}
+
+std::vector<cudf::data_type> schema_of(cudf::table_view const& tbl)
+{
+  std::vector<cudf::data_type> schema;
+  std::transform(tbl.begin(), tbl.end(), std::back_inserter(schema), [](auto const& col) {
+    return col.type();
+  });
+  return schema;
+}
+}  // namespace
+
+static void bench_to_rows(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+  auto const table = create_input_table(state);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const stream_view             = rmm::cuda_stream_view{launch.get_stream()};
+    [[maybe_unused]] auto const result = cudf::detail::convert_to_rows(table->view(), stream_view);
+  });
+}
+
+static void bench_from_rows(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+  auto const table  = create_input_table(state);
+  auto const schema = schema_of(table->view());
+  auto const rows   = cudf::detail::convert_to_rows(table->view());
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const stream_view = rmm::cuda_stream_view{launch.get_stream()};
+    for (auto const& batch : rows) {
+      [[maybe_unused]] auto const result =
+        cudf::detail::convert_from_rows(cudf::lists_column_view{*batch}, schema, stream_view);
+    }
+  });
+}
+
+static void bench_to_rows_fixed_width_optimized(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+  auto const table = create_input_table(state);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const stream_view = rmm::cuda_stream_view{launch.get_stream()};
+    [[maybe_unused]] auto const result =
+      cudf::detail::convert_to_rows_fixed_width_optimized(table->view(), stream_view);
+  });
+}
+
+NVBENCH_BENCH(bench_to_rows)
+  .set_name("to_rows")
+  .add_int64_power_of_two_axis("num_rows", {16, 20, 22})
+  .add_int64_axis("num_cols", {8, 64, 212})
+  .add_int64_axis("has_strings", {0, 1});
+
+NVBENCH_BENCH(bench_from_rows)
+  .set_name("from_rows")
+  .add_int64_power_of_two_axis("num_rows", {16, 20, 22})
+  .add_int64_axis("num_cols", {8, 64, 212})
+  .add_int64_axis("has_strings", {0, 1});
+
+NVBENCH_BENCH(bench_to_rows_fixed_width_optimized)
+  .set_name("to_rows_fixed_width_optimized")
+  .add_int64_power_of_two_axis("num_rows", {16, 20, 22})
+  .add_int64_axis("num_cols", {8, 64})
+  .add_int64_axis("has_strings", {0});
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/rmm_pool_raii.hpp>
+
+#include <cudf/detail/sorting.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+void nvbench_segmented_sort(nvbench::state& state)
+{
+  cudf::rmm_pool_raii pool_raii;
+
+  auto const stable       = static_cast<bool>(state.get_int64("stable"));
+  auto const dtype        = cudf::type_to_id<int32_t>();
+  auto const segment_size = static_cast<cudf::size_type>(state.get_int64("SegmentSize"));
+  auto const num_rows     = static_cast<cudf::size_type>(state.get_int64("NumRows"));
+  auto const num_segments = num_rows / segment_size;
+  auto const has_nulls    = static_cast<bool>(state.get_int64("Nulls"));
+
+  data_profile profile;
+  profile.set_null_frequency(has_nulls ? std::optional{0.1} : std::nullopt);
+  profile.set_cardinality(0);
+  profile.set_distribution_params<int32_t>(dtype, distribution_id::UNIFORM, 0, 1000);
+  auto const keys = create_random_table({dtype}, row_count{num_rows}, profile);
+
+  // all segments have segment_size elements
+  auto const offsets = cudf::sequence(num_segments + 1,
+                                      cudf::numeric_scalar<cudf::size_type>(0),
+                                      cudf::numeric_scalar<cudf::size_type>(segment_size));
+
+  state.add_element_count(num_rows, "NumRows");
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    rmm::cuda_stream_view stream_view{launch.get_stream()};
+    auto const result = stable ? cudf::detail::stable_segmented_sorted_order(
+                                   keys->view(), offsets->view(), {}, {}, stream_view)
+                               : cudf::detail::segmented_sorted_order(
+                                   keys->view(), offsets->view(), {}, {}, stream_view);
+  });
+}
+
+NVBENCH_BENCH(nvbench_segmented_sort)
+  .set_name("segmented_sort")
+  .add_int64_axis("stable", {0, 1})
+  .add_int64_power_of_two_axis("NumRows", {20, 24})
+  .add_int64_axis("SegmentSize", {4, 16, 32, 256, 4096, 65536})
+  .add_int64_axis("Nulls", {0, 1});
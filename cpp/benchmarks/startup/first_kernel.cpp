@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file first_kernel.cpp
+ * @brief Measures the time a new process takes to create its CUDA context and to complete the
+ * first call of common libcudf APIs.
+ *
+ * Each benchmark runs a single iteration, so that it times the loading of the modules used by the
+ * API as well as the call itself: the benchmarks are only meaningful when each one runs once in a
+ * new process, in registration order, e.g. by comparing runs with `CUDA_MODULE_LOADING=EAGER` and
+ * `CUDA_MODULE_LOADING=LAZY`. The inputs of each API are created before its timer starts.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr cudf::size_type num_rows = 1 << 20;
+
+std::unique_ptr<cudf::column> make_sequence(cudf::data_type type)
+{
+  auto const sequence =
+    cudf::sequence(num_rows, cudf::numeric_scalar<int32_t>(0), cudf::numeric_scalar<int32_t>(7));
+  return type.id() == cudf::type_id::INT32 ? std::make_unique<cudf::column>(sequence->view())
+                                           : cudf::cast(sequence->view(), type);
+}
+
+/**
+ * @brief Times the first call of `api`, until the work it submitted to the device completes.
+ */
+template <typename Api>
+void time_first_call(benchmark::State& state, Api api)
+{
+  for (auto _ : state) {
+    auto const start = std::chrono::steady_clock::now();
+    api();
+    CUDF_CUDA_TRY(cudaDeviceSynchronize());
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+    state.SetIterationTime(elapsed.count());
+  }
+}
+
+}  // namespace
+
+static void BM_context_creation(benchmark::State& state)
+{
+  time_first_call(state, [] { CUDF_CUDA_TRY(cudaFree(nullptr)); });
+}
+
+static void BM_first_binary_operation(benchmark::State& state)
+{
+  auto const input = make_sequence(cudf::data_type{cudf::type_id::INT64});
+  time_first_call(state, [&] {
+    cudf::binary_operation(input->view(),
+                           input->view(),
+                           cudf::binary_operator::ADD,
+                           cudf::data_type{cudf::type_id::INT64});
+  });
+}
+
+static void BM_first_sort(benchmark::State& state)
+{
+  auto const input = make_sequence(cudf::data_type{cudf::type_id::INT64});
+  time_first_call(state, [&] { cudf::sorted_order(cudf::table_view{{input->view()}}); });
+}
+
+static void BM_first_groupby(benchmark::State& state)
+{
+  auto const keys   = make_sequence(cudf::data_type{cudf::type_id::INT32});
+  auto const values = make_sequence(cudf::data_type{cudf::type_id::FLOAT64});
+  time_first_call(state, [&] {
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values = values->view();
+    requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    cudf::groupby::groupby{cudf::table_view{{keys->view()}}}.aggregate(requests);
+  });
+}
+
+// Rarely used types should not make the first call of the API slower than for common types
+static void BM_first_decimal128_sort(benchmark::State& state)
+{
+  auto const input = make_sequence(cudf::data_type{cudf::type_id::DECIMAL128, -2});
+  time_first_call(state, [&] { cudf::sorted_order(cudf::table_view{{input->view()}}); });
+}
+
+#define FIRST_KERNEL_BENCHMARK_DEFINE(name) \
+  BENCHMARK(name)->Iterations(1)->UseManualTime()->Unit(benchmark::kMillisecond);
+
+FIRST_KERNEL_BENCHMARK_DEFINE(BM_context_creation)
+FIRST_KERNEL_BENCHMARK_DEFINE(BM_first_binary_operation)
+FIRST_KERNEL_BENCHMARK_DEFINE(BM_first_sort)
+FIRST_KERNEL_BENCHMARK_DEFINE(BM_first_groupby)
+FIRST_KERNEL_BENCHMARK_DEFINE(BM_first_decimal128_sort)
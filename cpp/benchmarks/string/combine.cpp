@@ -20,6 +20,7 @@
 #include <benchmarks/fixture/benchmark_fixture.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/combine.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -49,6 +50,32 @@ static void BM_combine(benchmark::State& state)
   state.SetBytesProcessed(state.iterations() * (input1.chars_size() + input2.chars_size()));
 }
 
+static void BM_join_list_elements(benchmark::State& state)
+{
+  cudf::size_type const n_rows{static_cast<cudf::size_type>(state.range(0))};
+  cudf::size_type const max_list_length{static_cast<cudf::size_type>(state.range(1))};
+  // the geometric distribution makes most lists short and a few lists much longer
+  auto const list_length_dist =
+    state.range(2) ? distribution_id::GEOMETRIC : distribution_id::UNIFORM;
+  data_profile table_profile;
+  table_profile.set_null_frequency(std::nullopt);
+  table_profile.set_list_depth(1);
+  table_profile.set_list_type(cudf::type_id::STRING);
+  table_profile.set_distribution_params(cudf::type_id::LIST, list_length_dist, 0, max_list_length);
+  table_profile.set_distribution_params(cudf::type_id::STRING, distribution_id::NORMAL, 0, 16);
+  auto const table = create_random_table({cudf::type_id::LIST}, row_count{n_rows}, table_profile);
+  cudf::lists_column_view input(table->view().column(0));
+  cudf::string_scalar separator(",");
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, cudf::default_stream_value);
+    cudf::strings::join_list_elements(input, separator);
+  }
+
+  state.SetBytesProcessed(state.iterations() *
+                          cudf::strings_column_view(input.child()).chars_size());
+}
+
 static void generate_bench_args(benchmark::internal::Benchmark* b)
 {
   int const min_rows   = 1 << 12;
@@ -69,3 +96,12 @@ static void generate_bench_args(benchmark::internal::Benchmark* b)
     ->Unit(benchmark::kMillisecond);
 
 STRINGS_BENCHMARK_DEFINE(concat)
+
+BENCHMARK_DEFINE_F(StringCombine, join_list_elements)
+(::benchmark::State& st) { BM_join_list_elements(st); }
+BENCHMARK_REGISTER_F(StringCombine, join_list_elements)
+  ->ArgsProduct({{4096, 32768},    /* row count */
+                 {16, 256, 2048}, /* max list length */
+                 {0, 1}})         /* skewed list lengths */
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
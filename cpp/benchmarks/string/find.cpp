@@ -20,6 +20,7 @@
 
 #include <cudf_test/column_wrapper.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/find_multiple.hpp>
@@ -27,6 +28,8 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <limits>
+#include <optional>
+#include <vector>
 
 enum FindAPI { find, find_multi, contains, starts_with, ends_with };
 
@@ -37,10 +40,25 @@ static void BM_find_scalar(benchmark::State& state, FindAPI find_api)
 {
   cudf::size_type const n_rows{static_cast<cudf::size_type>(state.range(0))};
   cudf::size_type const max_str_length{static_cast<cudf::size_type>(state.range(1))};
+  bool const skewed{state.range(2) != 0};
+  bool const has_nulls{state.range(3) != 0};
   data_profile table_profile;
+  if (!has_nulls) { table_profile.set_null_frequency(std::nullopt); }
   table_profile.set_distribution_params(
     cudf::type_id::STRING, distribution_id::NORMAL, 0, max_str_length);
-  auto const table = create_random_table({cudf::type_id::STRING}, row_count{n_rows}, table_profile);
+  auto table = create_random_table({cudf::type_id::STRING}, row_count{n_rows}, table_profile);
+  if (skewed) {
+    // append a few very long strings to the short ones
+    cudf::size_type const long_rows{16};
+    cudf::size_type const long_length{1 << 20};
+    data_profile long_profile;
+    if (!has_nulls) { long_profile.set_null_frequency(std::nullopt); }
+    long_profile.set_distribution_params(
+      cudf::type_id::STRING, distribution_id::UNIFORM, long_length, long_length);
+    auto const long_table =
+      create_random_table({cudf::type_id::STRING}, row_count{long_rows}, long_profile);
+    table = cudf::concatenate(std::vector<cudf::table_view>{table->view(), long_table->view()});
+  }
   cudf::strings_column_view input(table->view().column(0));
   cudf::string_scalar target("+");
   cudf::test::strings_column_wrapper targets({"+", "-"});
@@ -74,9 +92,13 @@ static void generate_bench_args(benchmark::internal::Benchmark* b)
       // avoid generating combinations that exceed the cudf column limit
       size_t total_chars = static_cast<size_t>(row_count) * rowlen;
       if (total_chars < static_cast<size_t>(std::numeric_limits<cudf::size_type>::max())) {
-        b->Args({row_count, rowlen});
+        // with and without nulls
+        b->Args({row_count, rowlen, 0, 0});
+        b->Args({row_count, rowlen, 0, 1});
       }
     }
+    // short strings with a few very long strings
+    b->Args({row_count, min_rowlen, 1, 1});
   }
 }
 
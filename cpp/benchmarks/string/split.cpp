@@ -30,7 +30,7 @@
 class StringSplit : public cudf::benchmark {
 };
 
-enum split_type { split, split_ws, record, record_ws };
+enum split_type { split, split_ws, split_cols, split_cols_ws, record, record_ws };
 
 static void BM_split(benchmark::State& state, split_type rt)
 {
@@ -48,6 +48,8 @@ static void BM_split(benchmark::State& state, split_type rt)
     switch (rt) {
       case split: cudf::strings::split(input, target); break;
       case split_ws: cudf::strings::split(input); break;
+      case split_cols: cudf::strings::split_to_columns(input, 4, target); break;
+      case split_cols_ws: cudf::strings::split_to_columns(input, 4); break;
       case record: cudf::strings::split_record(input, target); break;
       case record_ws: cudf::strings::split_record(input); break;
     }
@@ -85,5 +87,7 @@ static void generate_bench_args(benchmark::internal::Benchmark* b)
 
 STRINGS_BENCHMARK_DEFINE(split)
 STRINGS_BENCHMARK_DEFINE(split_ws)
+STRINGS_BENCHMARK_DEFINE(split_cols)
+STRINGS_BENCHMARK_DEFINE(split_cols_ws)
 STRINGS_BENCHMARK_DEFINE(record)
 STRINGS_BENCHMARK_DEFINE(record_ws)
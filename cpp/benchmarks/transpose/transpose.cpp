@@ -20,37 +20,43 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+template <typename T>
 static void BM_transpose(benchmark::State& state)
 {
   auto count = state.range(0);
-  auto int_column_generator =
+  auto column_generator =
     thrust::make_transform_iterator(thrust::counting_iterator(0), [count](int i) {
       return cudf::make_numeric_column(
-        cudf::data_type{cudf::type_id::INT32}, count, cudf::mask_state::ALL_VALID);
+        cudf::data_type{cudf::type_to_id<T>()}, count, cudf::mask_state::ALL_VALID);
     });
 
-  auto input_table = cudf::table(std::vector(int_column_generator, int_column_generator + count));
+  auto input_table = cudf::table(std::vector(column_generator, column_generator + count));
   auto input       = input_table.view();
 
   for (auto _ : state) {
     cuda_event_timer raii(state, true);
     auto output = cudf::transpose(input);
   }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * 2 * count * count *
+                          sizeof(T));
 }
 
 class Transpose : public cudf::benchmark {
 };
 
-#define TRANSPOSE_BM_BENCHMARK_DEFINE(name)                                                \
-  BENCHMARK_DEFINE_F(Transpose, name)(::benchmark::State & state) { BM_transpose(state); } \
-  BENCHMARK_REGISTER_F(Transpose, name)                                                    \
-    ->RangeMultiplier(4)                                                                   \
-    ->Range(4, 4 << 13)                                                                    \
-    ->UseManualTime()                                                                      \
+#define TRANSPOSE_BM_BENCHMARK_DEFINE(name, type, max_count)                                     \
+  BENCHMARK_DEFINE_F(Transpose, name)(::benchmark::State & state) { BM_transpose<type>(state); } \
+  BENCHMARK_REGISTER_F(Transpose, name)                                                          \
+    ->RangeMultiplier(4)                                                                         \
+    ->Range(4, max_count)                                                                        \
+    ->UseManualTime()                                                                            \
     ->Unit(benchmark::kMillisecond);
 
-TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_simple);
+TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_simple, int32_t, 4 << 13);
+TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_double, double, 4 << 12);
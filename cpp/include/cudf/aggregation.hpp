@@ -116,7 +116,9 @@ class aggregation {
     COVARIANCE,      ///< covariance between two sets of elements
     CORRELATION,     ///< correlation between two sets of elements
     TDIGEST,         ///< create a tdigest from a set of input values
-    MERGE_TDIGEST    ///< create a tdigest by merging multiple tdigests together
+    MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
+    HLL,             ///< create a HyperLogLog sketch from a set of input values
+    MERGE_HLL        ///< create a HyperLogLog sketch by merging multiple sketches together
   };
 
   aggregation() = delete;
@@ -710,5 +712,43 @@ std::unique_ptr<Base> make_tdigest_aggregation(int max_centroids = 1000);
 template <typename Base>
 std::unique_ptr<Base> make_merge_tdigest_aggregation(int max_centroids = 1000);
 
+/**
+ * @brief Factory to create a HLL aggregation
+ *
+ * Produces a HyperLogLog sketch (http://algo.inria.fr/flajolet/Publications/FlFuGaMe07.pdf) of
+ * the input values, from which `cudf::estimate_distinct_count` approximates the number of
+ * distinct values. Nulls are ignored. Input values of any type are hashed to 64 bits.
+ *
+ * The sketch column produced is a `LIST<UINT8>` column. Each output row is a single sketch made
+ * of the `2^precision` registers of the estimator, each holding the largest position of the
+ * leading set bit observed among the hashes falling into it.
+ *
+ * The relative standard error of the estimates is about `1.04 / sqrt(2^precision)`, e.g. 1.6%
+ * for the default precision of 12, at the cost of `2^precision` bytes per sketch.
+ *
+ * @throws cudf::logic_error if `precision` is outside of the range [4, 18]
+ *
+ * @param precision Number of hash bits selecting a register
+ *
+ * @return A HLL aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_hll_aggregation(int precision = 12);
+
+/**
+ * @brief Factory to create a MERGE_HLL aggregation
+ *
+ * Merges the sketches resulting from a previous `make_hll_aggregation` or
+ * `make_merge_hll_aggregation` aggregation by taking the maximum of each register. The merged
+ * sketch is identical to the sketch of all the values the input sketches were built from. All
+ * the non-null input sketches must have the same precision. Null sketches are ignored.
+ *
+ * The sketch column produced has the structure described in `make_hll_aggregation`.
+ *
+ * @return A MERGE_HLL aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_merge_hll_aggregation();
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -24,8 +25,12 @@
 #include <thrust/scan.h>
 
 #include <functional>
+#include <list>
+#include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
+#include <vector>
 
 namespace cudf {
 namespace ast {
@@ -121,6 +126,12 @@ struct expression_device_view {
  * the expressions and constructing vectors of information that are later used by the device for
  * evaluating the abstract syntax tree as a "linear" list of operators whose input dependencies are
  * resolved into intermediate data storage in shared memory.
+ *
+ * Two simplifications are applied while linearizing. Structurally identical operations (the same
+ * operator applied to the same columns, literals or subexpressions) are evaluated once, and their
+ * intermediate is kept until its last use. Operations on numeric literals only are folded into a
+ * literal evaluated once on the host, unless they use a null-aware operator on a null literal or
+ * divide integers by zero or minus one.
  */
 class expression_parser {
  public:
@@ -141,8 +152,11 @@ class expression_parser {
       _right{right},
       _expression_count{0},
       _intermediate_counter{},
-      _has_nulls(has_nulls)
+      _has_nulls(has_nulls),
+      _stream{stream},
+      _mr{mr}
   {
+    number_subexpressions(expr);
     expr.accept(*this);
     move_to_device(stream, mr);
   }
@@ -273,7 +287,7 @@ class expression_parser {
 
     _device_data_buffer = rmm::device_buffer(h_data_buffer.data(), buffer_size, stream, mr);
 
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
 
     // Create device pointers to components of plan
     auto device_data_buffer_ptr            = static_cast<char const*>(_device_data_buffer.data());
@@ -314,6 +328,23 @@ class expression_parser {
   std::vector<cudf::size_type> visit_operands(
     std::vector<std::reference_wrapper<expression const>> operands);
 
+  /**
+   * @brief Assigns a value number to every node of the expression, the same for structurally
+   * identical nodes, and counts the uses of every distinct operation by the other ones.
+   *
+   * @param expr The expression to number.
+   * @return The value number of `expr`.
+   */
+  cudf::size_type number_subexpressions(expression const& expr);
+
+  /**
+   * @brief Evaluates an operation on literals only on the host.
+   *
+   * @param expr The operation to fold.
+   * @return The literal holding the result, or nullptr if the operation cannot be folded.
+   */
+  literal const* fold_constant(operation const& expr);
+
   /**
    * @brief Add a data reference to the internal list.
    *
@@ -336,6 +367,17 @@ class expression_parser {
   std::vector<ast_operator> _operators;
   std::vector<cudf::size_type> _operator_source_indices;
   std::vector<cudf::detail::fixed_width_scalar_device_view_base> _literals;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  // Common subexpression elimination and constant folding
+  std::map<std::vector<std::int64_t>, cudf::size_type> _value_keys;
+  std::map<expression const*, cudf::size_type> _value_numbers;
+  std::vector<bool> _is_constant;
+  std::vector<cudf::size_type> _remaining_uses;
+  std::vector<std::optional<cudf::size_type>> _value_data_references;
+  std::vector<std::unique_ptr<cudf::scalar>> _folded_scalars;
+  std::list<literal> _folded_literals;
 };
 
 }  // namespace detail
@@ -16,10 +16,13 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <cuda/std/chrono>
 #include <cuda/std/type_traits>
 
 #include <cmath>
@@ -121,6 +124,15 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::NULL_LOGICAL_OR:
       f.template operator()<ast_operator::NULL_LOGICAL_OR>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::ENDS_WITH:
+      f.template operator()<ast_operator::ENDS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CONTAINS:
+      f.template operator()<ast_operator::CONTAINS>(std::forward<Ts>(args)...);
+      break;
     case ast_operator::IDENTITY:
       f.template operator()<ast_operator::IDENTITY>(std::forward<Ts>(args)...);
       break;
@@ -199,6 +211,18 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::CAST_TO_FLOAT64:
       f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::EXTRACT_YEAR:
+      f.template operator()<ast_operator::EXTRACT_YEAR>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::EXTRACT_MONTH:
+      f.template operator()<ast_operator::EXTRACT_MONTH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::EXTRACT_DAY:
+      f.template operator()<ast_operator::EXTRACT_DAY>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::EXTRACT_HOUR:
+      f.template operator()<ast_operator::EXTRACT_HOUR>(std::forward<Ts>(args)...);
+      break;
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -232,7 +256,7 @@ struct operator_functor<ast_operator::ADD, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs + rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs + rhs)
   {
     return lhs + rhs;
   }
@@ -243,7 +267,7 @@ struct operator_functor<ast_operator::SUB, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs - rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs - rhs)
   {
     return lhs - rhs;
   }
@@ -254,7 +278,7 @@ struct operator_functor<ast_operator::MUL, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs * rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs * rhs)
   {
     return lhs * rhs;
   }
@@ -265,7 +289,7 @@ struct operator_functor<ast_operator::DIV, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs / rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs / rhs)
   {
     return lhs / rhs;
   }
@@ -276,7 +300,7 @@ struct operator_functor<ast_operator::TRUE_DIV, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(static_cast<double>(lhs) / static_cast<double>(rhs))
   {
     return static_cast<double>(lhs) / static_cast<double>(rhs);
@@ -288,7 +312,7 @@ struct operator_functor<ast_operator::FLOOR_DIV, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(floor(static_cast<double>(lhs) / static_cast<double>(rhs)))
   {
     return floor(static_cast<double>(lhs) / static_cast<double>(rhs));
@@ -303,7 +327,7 @@ struct operator_functor<ast_operator::MOD, false> {
             typename RHS,
             typename CommonType                               = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_integral_v<CommonType>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(static_cast<CommonType>(lhs) % static_cast<CommonType>(rhs))
   {
     return static_cast<CommonType>(lhs) % static_cast<CommonType>(rhs);
@@ -313,7 +337,7 @@ struct operator_functor<ast_operator::MOD, false> {
             typename RHS,
             typename CommonType                                  = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_same_v<CommonType, float>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(fmodf(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs)))
   {
     return fmodf(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs));
@@ -323,7 +347,7 @@ struct operator_functor<ast_operator::MOD, false> {
             typename RHS,
             typename CommonType                                   = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_same_v<CommonType, double>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(fmod(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs)))
   {
     return fmod(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs));
@@ -338,7 +362,7 @@ struct operator_functor<ast_operator::PYMOD, false> {
             typename RHS,
             typename CommonType                               = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_integral_v<CommonType>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(((static_cast<CommonType>(lhs) % static_cast<CommonType>(rhs)) +
                  static_cast<CommonType>(rhs)) %
                 static_cast<CommonType>(rhs))
@@ -352,7 +376,7 @@ struct operator_functor<ast_operator::PYMOD, false> {
             typename RHS,
             typename CommonType                                  = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_same_v<CommonType, float>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(fmodf(fmodf(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs)) +
                         static_cast<CommonType>(rhs),
                       static_cast<CommonType>(rhs)))
@@ -366,7 +390,7 @@ struct operator_functor<ast_operator::PYMOD, false> {
             typename RHS,
             typename CommonType                                   = std::common_type_t<LHS, RHS>,
             std::enable_if_t<std::is_same_v<CommonType, double>>* = nullptr>
-  __device__ inline auto operator()(LHS lhs, RHS rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs)
     -> decltype(fmod(fmod(static_cast<CommonType>(lhs), static_cast<CommonType>(rhs)) +
                        static_cast<CommonType>(rhs),
                      static_cast<CommonType>(rhs)))
@@ -382,7 +406,7 @@ struct operator_functor<ast_operator::POW, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(std::pow(lhs, rhs))
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(std::pow(lhs, rhs))
   {
     return std::pow(lhs, rhs);
   }
@@ -393,7 +417,7 @@ struct operator_functor<ast_operator::EQUAL, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs == rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs == rhs)
   {
     return lhs == rhs;
   }
@@ -410,7 +434,7 @@ struct operator_functor<ast_operator::NOT_EQUAL, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs != rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs != rhs)
   {
     return lhs != rhs;
   }
@@ -421,7 +445,7 @@ struct operator_functor<ast_operator::LESS, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs < rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs < rhs)
   {
     return lhs < rhs;
   }
@@ -432,7 +456,7 @@ struct operator_functor<ast_operator::GREATER, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs > rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs > rhs)
   {
     return lhs > rhs;
   }
@@ -443,7 +467,7 @@ struct operator_functor<ast_operator::LESS_EQUAL, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs <= rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs <= rhs)
   {
     return lhs <= rhs;
   }
@@ -454,7 +478,7 @@ struct operator_functor<ast_operator::GREATER_EQUAL, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs >= rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs >= rhs)
   {
     return lhs >= rhs;
   }
@@ -465,7 +489,7 @@ struct operator_functor<ast_operator::BITWISE_AND, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs & rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs & rhs)
   {
     return lhs & rhs;
   }
@@ -476,7 +500,7 @@ struct operator_functor<ast_operator::BITWISE_OR, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs | rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs | rhs)
   {
     return lhs | rhs;
   }
@@ -487,7 +511,7 @@ struct operator_functor<ast_operator::BITWISE_XOR, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs ^ rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs ^ rhs)
   {
     return lhs ^ rhs;
   }
@@ -498,7 +522,7 @@ struct operator_functor<ast_operator::LOGICAL_AND, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs && rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs && rhs)
   {
     return lhs && rhs;
   }
@@ -515,7 +539,7 @@ struct operator_functor<ast_operator::LOGICAL_OR, false> {
   static constexpr auto arity{2};
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs || rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> decltype(lhs || rhs)
   {
     return lhs || rhs;
   }
@@ -527,12 +551,67 @@ struct operator_functor<ast_operator::NULL_LOGICAL_OR, false>
   : public operator_functor<ast_operator::LOGICAL_OR, false> {
 };
 
+template <typename LHS, typename RHS>
+constexpr bool are_strings_v =
+  std::is_same_v<LHS, cudf::string_view> && std::is_same_v<RHS, cudf::string_view>;
+
+/**
+ * @brief Returns whether the bytes of `str` starting at byte `position` are those of `target`.
+ */
+CUDF_HOST_DEVICE inline bool bytes_match_at(cudf::string_view const& str,
+                                            cudf::size_type position,
+                                            cudf::string_view const& target)
+{
+  for (cudf::size_type i = 0; i < target.size_bytes(); ++i) {
+    if (str.data()[position + i] != target.data()[i]) { return false; }
+  }
+  return true;
+}
+
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings_v<LHS, RHS>>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs.size_bytes() >= rhs.size_bytes() && bytes_match_at(lhs, 0, rhs);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::ENDS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings_v<LHS, RHS>>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs.size_bytes() >= rhs.size_bytes() &&
+           bytes_match_at(lhs, lhs.size_bytes() - rhs.size_bytes(), rhs);
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::CONTAINS, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings_v<LHS, RHS>>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    for (cudf::size_type position = 0; position + rhs.size_bytes() <= lhs.size_bytes();
+         ++position) {
+      if (bytes_match_at(lhs, position, rhs)) { return true; }
+    }
+    return false;
+  }
+};
+
 template <>
 struct operator_functor<ast_operator::IDENTITY, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(input)
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(input)
   {
     return input;
   }
@@ -543,7 +622,7 @@ struct operator_functor<ast_operator::SIN, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::sin(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::sin(input))
   {
     return std::sin(input);
   }
@@ -554,7 +633,7 @@ struct operator_functor<ast_operator::COS, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::cos(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::cos(input))
   {
     return std::cos(input);
   }
@@ -565,7 +644,7 @@ struct operator_functor<ast_operator::TAN, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::tan(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::tan(input))
   {
     return std::tan(input);
   }
@@ -576,7 +655,7 @@ struct operator_functor<ast_operator::ARCSIN, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::asin(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::asin(input))
   {
     return std::asin(input);
   }
@@ -587,7 +666,7 @@ struct operator_functor<ast_operator::ARCCOS, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::acos(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::acos(input))
   {
     return std::acos(input);
   }
@@ -598,7 +677,7 @@ struct operator_functor<ast_operator::ARCTAN, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::atan(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::atan(input))
   {
     return std::atan(input);
   }
@@ -609,7 +688,7 @@ struct operator_functor<ast_operator::SINH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::sinh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::sinh(input))
   {
     return std::sinh(input);
   }
@@ -620,7 +699,7 @@ struct operator_functor<ast_operator::COSH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::cosh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::cosh(input))
   {
     return std::cosh(input);
   }
@@ -631,7 +710,7 @@ struct operator_functor<ast_operator::TANH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::tanh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::tanh(input))
   {
     return std::tanh(input);
   }
@@ -642,7 +721,7 @@ struct operator_functor<ast_operator::ARCSINH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::asinh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::asinh(input))
   {
     return std::asinh(input);
   }
@@ -653,7 +732,7 @@ struct operator_functor<ast_operator::ARCCOSH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::acosh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::acosh(input))
   {
     return std::acosh(input);
   }
@@ -664,7 +743,7 @@ struct operator_functor<ast_operator::ARCTANH, false> {
   static constexpr auto arity{1};
 
   template <typename InputT, std::enable_if_t<std::is_floating_point_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::atanh(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::atanh(input))
   {
     return std::atanh(input);
   }
@@ -675,7 +754,7 @@ struct operator_functor<ast_operator::EXP, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::exp(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::exp(input))
   {
     return std::exp(input);
   }
@@ -686,7 +765,7 @@ struct operator_functor<ast_operator::LOG, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::log(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::log(input))
   {
     return std::log(input);
   }
@@ -697,7 +776,7 @@ struct operator_functor<ast_operator::SQRT, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::sqrt(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::sqrt(input))
   {
     return std::sqrt(input);
   }
@@ -708,7 +787,7 @@ struct operator_functor<ast_operator::CBRT, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::cbrt(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::cbrt(input))
   {
     return std::cbrt(input);
   }
@@ -719,7 +798,7 @@ struct operator_functor<ast_operator::CEIL, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::ceil(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::ceil(input))
   {
     return std::ceil(input);
   }
@@ -730,7 +809,7 @@ struct operator_functor<ast_operator::FLOOR, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::floor(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::floor(input))
   {
     return std::floor(input);
   }
@@ -742,13 +821,13 @@ struct operator_functor<ast_operator::ABS, false> {
 
   // Only accept signed or unsigned types (both require is_arithmetic<T> to be true)
   template <typename InputT, std::enable_if_t<std::is_signed_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(std::abs(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::abs(input))
   {
     return std::abs(input);
   }
 
   template <typename InputT, std::enable_if_t<std::is_unsigned_v<InputT>>* = nullptr>
-  __device__ inline auto operator()(InputT input) -> decltype(input)
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(input)
   {
     return input;
   }
@@ -759,7 +838,7 @@ struct operator_functor<ast_operator::RINT, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(std::rint(input))
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(std::rint(input))
   {
     return std::rint(input);
   }
@@ -770,7 +849,7 @@ struct operator_functor<ast_operator::BIT_INVERT, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(~input)
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(~input)
   {
     return ~input;
   }
@@ -781,7 +860,7 @@ struct operator_functor<ast_operator::NOT, false> {
   static constexpr auto arity{1};
 
   template <typename InputT>
-  __device__ inline auto operator()(InputT input) -> decltype(!input)
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> decltype(!input)
   {
     return !input;
   }
@@ -791,7 +870,7 @@ template <typename To>
 struct cast {
   static constexpr auto arity{1};
   template <typename From>
-  __device__ inline auto operator()(From f) -> decltype(static_cast<To>(f))
+  CUDF_HOST_DEVICE inline auto operator()(From f) -> decltype(static_cast<To>(f))
   {
     return static_cast<To>(f);
   }
@@ -807,6 +886,62 @@ template <>
 struct operator_functor<ast_operator::CAST_TO_FLOAT64, false> : cast<double> {
 };
 
+/**
+ * @brief Returns the calendar date of a timestamp.
+ */
+template <typename Timestamp>
+CUDF_HOST_DEVICE inline cuda::std::chrono::year_month_day to_year_month_day(Timestamp input)
+{
+  return cuda::std::chrono::year_month_day{
+    cuda::std::chrono::floor<cuda::std::chrono::days>(input)};
+}
+
+template <>
+struct operator_functor<ast_operator::EXTRACT_YEAR, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT, std::enable_if_t<cudf::is_timestamp<InputT>()>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> int16_t
+  {
+    return static_cast<int16_t>(static_cast<int>(to_year_month_day(input).year()));
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::EXTRACT_MONTH, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT, std::enable_if_t<cudf::is_timestamp<InputT>()>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> int16_t
+  {
+    return static_cast<int16_t>(static_cast<unsigned>(to_year_month_day(input).month()));
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::EXTRACT_DAY, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT, std::enable_if_t<cudf::is_timestamp<InputT>()>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> int16_t
+  {
+    return static_cast<int16_t>(static_cast<unsigned>(to_year_month_day(input).day()));
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::EXTRACT_HOUR, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT, std::enable_if_t<cudf::is_timestamp<InputT>()>* = nullptr>
+  CUDF_HOST_DEVICE inline auto operator()(InputT input) -> int16_t
+  {
+    auto const time_of_day = input - cuda::std::chrono::floor<cuda::std::chrono::days>(input);
+    return static_cast<int16_t>(
+      cuda::std::chrono::duration_cast<cuda::std::chrono::hours>(time_of_day).count());
+  }
+};
+
 /*
  * The default specialization of nullable operators is to fall back to the non-nullable
  * implementation
@@ -820,7 +955,7 @@ struct operator_functor<op, true> {
             typename RHS,
             std::size_t arity_placeholder             = arity,
             std::enable_if_t<arity_placeholder == 2>* = nullptr>
-  __device__ inline auto operator()(LHS const lhs, RHS const rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS const lhs, RHS const rhs)
     -> possibly_null_value_t<decltype(NonNullOperator{}(*lhs, *rhs)), true>
   {
     using Out = possibly_null_value_t<decltype(NonNullOperator{}(*lhs, *rhs)), true>;
@@ -830,7 +965,7 @@ struct operator_functor<op, true> {
   template <typename Input,
             std::size_t arity_placeholder             = arity,
             std::enable_if_t<arity_placeholder == 1>* = nullptr>
-  __device__ inline auto operator()(Input const input)
+  CUDF_HOST_DEVICE inline auto operator()(Input const input)
     -> possibly_null_value_t<decltype(NonNullOperator{}(*input)), true>
   {
     using Out = possibly_null_value_t<decltype(NonNullOperator{}(*input)), true>;
@@ -846,7 +981,7 @@ struct operator_functor<ast_operator::NULL_EQUAL, true> {
   static constexpr auto arity = NonNullOperator::arity;
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS const lhs, RHS const rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS const lhs, RHS const rhs)
     -> possibly_null_value_t<decltype(NonNullOperator{}(*lhs, *rhs)), true>
   {
     // Case 1: Neither is null, so the output is given by the operation.
@@ -867,7 +1002,7 @@ struct operator_functor<ast_operator::NULL_LOGICAL_AND, true> {
   static constexpr auto arity = NonNullOperator::arity;
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS const lhs, RHS const rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS const lhs, RHS const rhs)
     -> possibly_null_value_t<decltype(NonNullOperator{}(*lhs, *rhs)), true>
   {
     // Case 1: Neither is null, so the output is given by the operation.
@@ -890,7 +1025,7 @@ struct operator_functor<ast_operator::NULL_LOGICAL_OR, true> {
   static constexpr auto arity = NonNullOperator::arity;
 
   template <typename LHS, typename RHS>
-  __device__ inline auto operator()(LHS const lhs, RHS const rhs)
+  CUDF_HOST_DEVICE inline auto operator()(LHS const lhs, RHS const rhs)
     -> possibly_null_value_t<decltype(NonNullOperator{}(*lhs, *rhs)), true>
   {
     // Case 1: Neither is null, so the output is given by the operation.
@@ -19,9 +19,14 @@
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
 #include <cstdint>
+#include <memory>
 
 namespace cudf {
 namespace ast {
@@ -110,33 +115,40 @@ enum class ast_operator : int32_t {
                      ///< NULL_LOGICAL_OR(null, true) is true,
                      ///< NULL_LOGICAL_OR(null, false) is null, and NULL_LOGICAL_OR(valid, valid) ==
                      ///< LOGICAL_OR(valid, valid)
+  STARTS_WITH,       ///< Whether the lhs string starts with the rhs string
+  ENDS_WITH,         ///< Whether the lhs string ends with the rhs string
+  CONTAINS,          ///< Whether the lhs string contains the rhs string
   // Unary operators
-  IDENTITY,        ///< Identity function
-  SIN,             ///< Trigonometric sine
-  COS,             ///< Trigonometric cosine
-  TAN,             ///< Trigonometric tangent
-  ARCSIN,          ///< Trigonometric sine inverse
-  ARCCOS,          ///< Trigonometric cosine inverse
-  ARCTAN,          ///< Trigonometric tangent inverse
-  SINH,            ///< Hyperbolic sine
-  COSH,            ///< Hyperbolic cosine
-  TANH,            ///< Hyperbolic tangent
-  ARCSINH,         ///< Hyperbolic sine inverse
-  ARCCOSH,         ///< Hyperbolic cosine inverse
-  ARCTANH,         ///< Hyperbolic tangent inverse
-  EXP,             ///< Exponential (base e, Euler number)
-  LOG,             ///< Natural Logarithm (base e)
-  SQRT,            ///< Square-root (x^0.5)
-  CBRT,            ///< Cube-root (x^(1.0/3))
-  CEIL,            ///< Smallest integer value not less than arg
-  FLOOR,           ///< largest integer value not greater than arg
-  ABS,             ///< Absolute value
-  RINT,            ///< Rounds the floating-point argument arg to an integer value
-  BIT_INVERT,      ///< Bitwise Not (~)
-  NOT,             ///< Logical Not (!)
-  CAST_TO_INT64,   ///< Cast value to int64_t
-  CAST_TO_UINT64,  ///< Cast value to uint64_t
-  CAST_TO_FLOAT64  ///< Cast value to double
+  IDENTITY,         ///< Identity function
+  SIN,              ///< Trigonometric sine
+  COS,              ///< Trigonometric cosine
+  TAN,              ///< Trigonometric tangent
+  ARCSIN,           ///< Trigonometric sine inverse
+  ARCCOS,           ///< Trigonometric cosine inverse
+  ARCTAN,           ///< Trigonometric tangent inverse
+  SINH,             ///< Hyperbolic sine
+  COSH,             ///< Hyperbolic cosine
+  TANH,             ///< Hyperbolic tangent
+  ARCSINH,          ///< Hyperbolic sine inverse
+  ARCCOSH,          ///< Hyperbolic cosine inverse
+  ARCTANH,          ///< Hyperbolic tangent inverse
+  EXP,              ///< Exponential (base e, Euler number)
+  LOG,              ///< Natural Logarithm (base e)
+  SQRT,             ///< Square-root (x^0.5)
+  CBRT,             ///< Cube-root (x^(1.0/3))
+  CEIL,             ///< Smallest integer value not less than arg
+  FLOOR,            ///< largest integer value not greater than arg
+  ABS,              ///< Absolute value
+  RINT,             ///< Rounds the floating-point argument arg to an integer value
+  BIT_INVERT,       ///< Bitwise Not (~)
+  NOT,              ///< Logical Not (!)
+  CAST_TO_INT64,    ///< Cast value to int64_t
+  CAST_TO_UINT64,   ///< Cast value to uint64_t
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  EXTRACT_YEAR,     ///< Year of a timestamp
+  EXTRACT_MONTH,    ///< Month of a timestamp, from 1 to 12
+  EXTRACT_DAY,      ///< Day of the month of a timestamp, from 1 to 31
+  EXTRACT_HOUR      ///< Hour of a timestamp, from 0 to 23
 };
 
 /**
@@ -191,6 +203,17 @@ class literal : public expression {
   {
   }
 
+  /**
+   * @brief Construct a new literal object.
+   *
+   * The literal copies a `string_view` of the scalar to device memory it owns, so the scalar
+   * must outlive the literal like any other scalar.
+   *
+   * @param value A string scalar value
+   * @param stream CUDA stream used for device memory operations
+   */
+  literal(cudf::string_scalar& value, rmm::cuda_stream_view stream = cudf::default_stream_value);
+
   /**
    * @brief Get the data type.
    *
@@ -208,6 +231,13 @@ class literal : public expression {
     return value;
   }
 
+  /**
+   * @brief Get the underlying scalar.
+   *
+   * @return The host scalar object backing this literal
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @brief Accepts a visitor class.
    *
@@ -236,6 +266,7 @@ class literal : public expression {
 
  private:
   cudf::scalar const& scalar;
+  std::shared_ptr<rmm::device_buffer> string_view_storage;  // device copy of a string scalar view
   cudf::detail::fixed_width_scalar_device_view_base const value;
 };
 
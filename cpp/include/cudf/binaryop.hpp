@@ -22,6 +22,8 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 
@@ -194,6 +196,28 @@ std::unique_ptr<column> binary_operation(
   data_type output_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A PTX binary function together with the types it is applied to.
+ */
+struct ptx_binary_operation_signature {
+  std::string ptx;        ///< String containing the PTX of a binary function
+  data_type lhs_type;     ///< Type of the left operand column
+  data_type rhs_type;     ///< Type of the right operand column
+  data_type output_type;  ///< Type of the output column
+};
+
+/**
+ * @brief Compiles the kernels used by `binary_operation` for the given PTX functions ahead of
+ * time.
+ *
+ * The compiled kernels are kept in the JIT kernel cache, in memory and on disk, so that later
+ * calls of `binary_operation` with the same PTX and types do not pay the compilation cost.
+ *
+ * @param signatures The PTX functions and types to compile kernels for
+ * @throw cudf::logic_error if any of the types isn't supported by the PTX `binary_operation`
+ */
+void precompile_binary_operations(std::vector<ptx_binary_operation_signature> const& signatures);
+
 /**
  * @brief Computes the `scale` for a `fixed_point` number based on given binary operator `op`
  *
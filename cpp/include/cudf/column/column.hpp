@@ -97,8 +97,8 @@ class column {
           "The device_uvector size exceeds the maximum size_type.");
         return static_cast<size_type>(other.size());
       }()},
-      _data{other.release()},
-      _null_mask{std::move(null_mask)},
+      _data{std::make_shared<rmm::device_buffer>(other.release())},
+      _null_mask{std::make_shared<rmm::device_buffer>(std::move(null_mask))},
       _null_count{null_count}
   {
   }
@@ -128,8 +128,8 @@ class column {
          std::vector<std::unique_ptr<column>>&& children = {})
     : _type{dtype},
       _size{size},
-      _data{std::forward<B1>(data)},
-      _null_mask{std::forward<B2>(null_mask)},
+      _data{std::make_shared<rmm::device_buffer>(std::forward<B1>(data))},
+      _null_mask{std::make_shared<rmm::device_buffer>(std::forward<B2>(null_mask))},
       _null_count{null_count},
       _children{std::move(children)}
   {
@@ -223,6 +223,29 @@ class column {
    */
   void set_null_count(size_type new_null_count);
 
+  /**
+   * @brief Returns the facts known about the elements of the column.
+   *
+   * @return The properties of the column, or `nullptr` if none are known
+   */
+  [[nodiscard]] std::shared_ptr<column_properties const> const& properties() const noexcept
+  {
+    return _properties;
+  }
+
+  /**
+   * @brief Attaches the facts known about the elements of the column.
+   *
+   * The properties are dropped when the elements may change: by `mutable_view()`,
+   * `set_null_mask()` or `release()`.
+   *
+   * @param properties The facts known about the elements, or `nullptr` to drop them
+   */
+  void set_properties(std::shared_ptr<column_properties const> properties) noexcept
+  {
+    _properties = std::move(properties);
+  }
+
   /**
    * @brief Indicates whether it is possible for the column to contain null
    * values, i.e., it has an allocated null mask.
@@ -235,7 +258,7 @@ class column {
    * @return true The column can hold null values
    * @return false The column cannot hold null values
    */
-  [[nodiscard]] bool nullable() const noexcept { return (_null_mask.size() > 0); }
+  [[nodiscard]] bool nullable() const noexcept { return _null_mask && _null_mask->size() > 0; }
 
   /**
    * @brief Indicates whether the column contains null elements.
@@ -294,10 +317,35 @@ class column {
    * - `null_count() == 0`
    * - `num_children() == 0`
    *
+   * If the column shares its buffers with other columns, see `share()`, the
+   * released buffers are copies of them.
+   *
    * @return A `contents` struct containing the data, null mask, and children of
    * the column.
    */
-  contents release() noexcept;
+  contents release();
+
+  /**
+   * @brief Returns a new column sharing the device memory of this column.
+   *
+   * No device memory is copied: the data and null masks of the column and of its
+   * children are shared by both columns, which own them together. The shared
+   * buffers are copied on write: the first `mutable_view()` or `release()` of
+   * either column while they are shared gives that column its own copy of them.
+   *
+   * @note Views created from a column before its `mutable_view()` copied the
+   * shared buffers keep viewing the buffers of the other column, and are only
+   * valid as long as that column is.
+   *
+   * @note The columns sharing buffers must not be mutated, released or
+   * destroyed concurrently from different threads, because whether a buffer
+   * is still shared is only known from its owners. The copy made on write is
+   * complete before `mutable_view()` or `release()` returns, so the other
+   * owner may then write its buffers in place on any stream.
+   *
+   * @return A column equal to this column
+   */
+  [[nodiscard]] std::unique_ptr<column> share() const;
 
   /**
    * @brief Creates an immutable, non-owning view of the column's data and
@@ -325,7 +373,10 @@ class column {
    * `null_count()` by setting it to `UNKNOWN_NULL_COUNT`. The user can
    * either explicitly update the null count with `set_null_count()`, or
    * if not, the null count will be recomputed on the next invocation of
-   *`null_count()`.
+   *`null_count()`. It also drops the column's `properties()`.
+   *
+   * @note If the column shares its buffers with other columns, see `share()`,
+   * they are copied first so that the other columns are not modified.
    *
    * @return mutable_column_view The mutable, non-owning view
    */
@@ -350,13 +401,15 @@ class column {
  private:
   cudf::data_type _type{type_id::EMPTY};  ///< Logical type of elements in the column
   cudf::size_type _size{};                ///< The number of elements in the column
-  rmm::device_buffer _data{};             ///< Dense, contiguous, type erased device memory
-                                          ///< buffer containing the column elements
-  rmm::device_buffer _null_mask{};        ///< Bitmask used to represent null values.
-                                          ///< May be empty if `null_count() == 0`
+  std::shared_ptr<rmm::device_buffer> _data{};  ///< Dense, contiguous, type erased device
+                                                ///< memory buffer containing the column
+                                                ///< elements, may be shared by `share()`
+  std::shared_ptr<rmm::device_buffer> _null_mask{};  ///< Bitmask used to represent null values.
+                                                     ///< May be empty if `null_count() == 0`
   mutable cudf::size_type _null_count{UNKNOWN_NULL_COUNT};  ///< The number of null elements
   std::vector<std::unique_ptr<column>> _children{};         ///< Depending on element type, child
                                                             ///< columns may contain additional data
+  std::shared_ptr<column_properties const> _properties{};  ///< Facts known about the elements
 };
 
 /** @} */  // end of group
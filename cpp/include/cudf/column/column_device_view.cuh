@@ -446,10 +446,16 @@ class alignas(16) column_device_view : public detail::column_device_view_base {
   __device__ T element(size_type element_index) const noexcept
   {
     size_type index       = element_index + offset();  // account for this view's _offset
-    const auto* d_offsets = d_children[strings_column_view::offsets_column_index].data<int32_t>();
+    auto const& d_offsets = d_children[strings_column_view::offsets_column_index];
     const char* d_strings = d_children[strings_column_view::chars_column_index].data<char>();
-    size_type offset      = d_offsets[index];
-    return string_view{d_strings + offset, d_offsets[index + 1] - offset};
+    // INT64 offsets still address a chars child of at most size_type bytes
+    auto const offset_at = [&d_offsets](size_type i) -> size_type {
+      return d_offsets.type().id() == type_id::INT64
+               ? static_cast<size_type>(d_offsets.element<int64_t>(i))
+               : d_offsets.element<int32_t>(i);
+    };
+    size_type offset = offset_at(index);
+    return string_view{d_strings + offset, offset_at(index + 1) - offset};
   }
 
  private:
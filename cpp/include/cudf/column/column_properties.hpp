@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <optional>
+
+/**
+ * @file
+ * @brief Class definition for cudf::column_properties
+ */
+
+namespace cudf {
+
+class scalar;
+
+/**
+ * @addtogroup column_classes
+ * @{
+ */
+
+/**
+ * @brief Facts known about the elements of a column, cached alongside it so that operations do
+ * not recompute them.
+ *
+ * Every fact is optional: an unset fact is unknown, not false. Producers such as `cudf::sort` or
+ * the Parquet reader attach the facts they know to their output columns with
+ * `column::set_properties`, and consumers pick faster algorithms when a fact allows it, e.g.
+ * `cudf::sort` returns a copy of a column already sorted in the requested order.
+ *
+ * The properties are immutable once attached. A `column_view` takes a snapshot of the properties
+ * of its column when it is created, like it does of the null count. Views created by slicing or
+ * from raw device memory have no properties.
+ */
+struct column_properties {
+  /// The order in which the column is sorted, as by `cudf::sort`, if it is known to be sorted
+  std::optional<order> sorted_order;
+  /// Where the nulls of a sorted column are; ignored if the column has no nulls
+  null_order sorted_null_precedence{null_order::BEFORE};
+  /// Lower bound of the non-null elements, of the type of the column
+  std::shared_ptr<scalar const> min;
+  /// Upper bound of the non-null elements, of the type of the column
+  std::shared_ptr<scalar const> max;
+  /// Estimate of the number of distinct elements
+  std::optional<size_type> approx_distinct_count;
+
+  /**
+   * @brief Returns whether the column is known to be sorted in the given order.
+   *
+   * @param column_order The order of the elements
+   * @param null_precedence Where the nulls must be
+   * @param has_nulls Whether the column contains nulls
+   * @return `true` if the column is known to be sorted in `column_order` with its nulls
+   * placed as by `null_precedence`
+   */
+  [[nodiscard]] bool is_sorted(order column_order,
+                               null_order null_precedence,
+                               bool has_nulls) const noexcept
+  {
+    return sorted_order == column_order &&
+           (not has_nulls || sorted_null_precedence == null_precedence);
+  }
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/column/column_properties.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -22,6 +23,7 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <limits>
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -455,11 +457,33 @@ class column_view : public detail::column_view_base {
     return device_span<T const>(data<T>(), size());
   }
 
+  /**
+   * @brief Returns the facts known about the elements of the column.
+   *
+   * @return The properties of the column, or `nullptr` if none are known
+   */
+  [[nodiscard]] std::shared_ptr<column_properties const> const& properties() const noexcept
+  {
+    return _properties;
+  }
+
+  /**
+   * @brief Returns a copy of this view with the given properties attached.
+   *
+   * The caller is responsible for the properties holding for the elements of this view.
+   *
+   * @param properties The facts known about the elements of the column
+   * @return A view of the same elements with `properties` attached
+   */
+  [[nodiscard]] column_view with_properties(
+    std::shared_ptr<column_properties const> properties) const;
+
  private:
   friend column_view bit_cast(column_view const& input, data_type type);
 
   std::vector<column_view> _children{};  ///< Based on element type, children
                                          ///< may contain additional data
+  std::shared_ptr<column_properties const> _properties{};  ///< Facts known about the elements
 };                                       // namespace cudf
 
 /**
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup utility_spilling
+ * @{
+ * @file
+ */
+
+/// Default number of rows of the slices of a `compressed_table`
+constexpr size_type default_compressed_slice_rows = 1'000'000;
+
+/**
+ * @brief A table kept compressed in device memory and decompressed on demand.
+ *
+ * The rows of the table are split in slices of `slice_rows` rows with `cudf::contiguous_split`.
+ * The contiguous buffer of every slice is compressed with nvCOMP, in chunks of 1 MiB compressed
+ * by a single batch, and the compressed chunks are stored back to back in one device buffer.
+ *
+ * Decompressing a range of rows decompresses only the slices holding them, with a single batch.
+ * Large slices compress better, small slices make decompressing short ranges cheaper.
+ */
+class compressed_table {
+ public:
+  /**
+   * @brief Compresses a table.
+   *
+   * The table is copied uncompressed once while it is compressed.
+   *
+   * @throws cudf::logic_error if `compression` is not one of `SNAPPY`, `LZ4` or `ZSTD`
+   * @throws cudf::logic_error if `slice_rows` is not positive
+   *
+   * @param input The table to compress
+   * @param compression The compression to apply
+   * @param slice_rows The number of rows of each compressed slice
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the compressed data
+   */
+  compressed_table(table_view const& input,
+                   io::compression_type compression    = io::compression_type::LZ4,
+                   size_type slice_rows                = default_compressed_slice_rows,
+                   rmm::cuda_stream_view stream        = cudf::default_stream_value,
+                   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Decompresses the whole table.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table
+   * @return The decompressed table
+   */
+  [[nodiscard]] std::unique_ptr<table> decompress(
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Decompresses the rows `[begin, end)` of the table.
+   *
+   * @throws cudf::logic_error if the range is not within the rows of the table
+   *
+   * @param begin The first row to decompress
+   * @param end One past the last row to decompress
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table
+   * @return The decompressed rows
+   */
+  [[nodiscard]] std::unique_ptr<table> decompress(
+    size_type begin,
+    size_type end,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of rows of the table.
+   *
+   * @return The number of rows
+   */
+  [[nodiscard]] size_type num_rows() const noexcept { return _num_rows; }
+
+  /**
+   * @brief Returns the compression applied to the table.
+   *
+   * @return The compression type
+   */
+  [[nodiscard]] io::compression_type compression() const noexcept { return _compression; }
+
+  /**
+   * @brief Returns the number of bytes of device memory of the compressed table.
+   *
+   * @return The compressed size
+   */
+  [[nodiscard]] std::size_t compressed_size() const noexcept { return _data.size(); }
+
+  /**
+   * @brief Returns the number of bytes of device memory of the slices once decompressed.
+   *
+   * @return The uncompressed size
+   */
+  [[nodiscard]] std::size_t uncompressed_size() const noexcept;
+
+ private:
+  // A slice of `slice_rows` rows packed by `cudf::contiguous_split`
+  struct slice {
+    std::vector<uint8_t> metadata;  // packed metadata of the columns
+    std::size_t size;               // size of the packed device data
+    std::size_t first_chunk;        // index of its first compressed chunk
+    std::size_t compressed_offset;  // offset of its first compressed chunk in `_data`
+  };
+
+  size_type _num_rows;
+  size_type _slice_rows;
+  io::compression_type _compression;
+  rmm::device_buffer _data;               // compressed chunks of all slices, back to back
+  std::vector<std::size_t> _chunk_sizes;  // compressed size of each chunk
+  std::vector<slice> _slices;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
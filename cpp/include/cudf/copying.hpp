@@ -23,10 +23,15 @@
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace cudf {
@@ -77,6 +82,7 @@ enum class out_of_bounds_policy : bool {
  * use `DONT_CHECK` when they are certain that the gather_map contains only valid indices for
  * better performance. If `policy` is set to `DONT_CHECK` and there are out-of-bounds indices
  * in the gather map, the behavior is undefined. Defaults to `DONT_CHECK`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return std::unique_ptr<table> Result of the gather
  */
@@ -84,6 +90,36 @@ std::unique_ptr<table> gather(
   table_view const& source_table,
   column_view const& gather_map,
   out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Gathers the rows of many tables, each according to its own gather map.
+ *
+ * @ingroup copy_gather
+ *
+ * Equivalent to calling `cudf::gather(source_tables[i], gather_maps[i], bounds_policy)` for every
+ * `i`, but the fixed-width and strings columns of all the tables are gathered together by a few
+ * kernels over a flattened list of the columns. This avoids the kernel launches of gathering each
+ * column of each table separately, which dominate when gathering from many small tables. Columns
+ * of other types are gathered with `cudf::gather`.
+ *
+ * @throws cudf::logic_error if the number of source tables and gather maps differ
+ * @throws cudf::logic_error if any gather map contains null values
+ *
+ * @param source_tables The tables whose rows will be gathered
+ * @param gather_maps Non-nullable columns of integral indices, one for each source table
+ * @param bounds_policy Policy to apply to account for possible out-of-bounds indices, as for
+ * `cudf::gather`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned tables' device memory
+ * @return The result of gathering each source table
+ */
+std::vector<std::unique_ptr<table>> batched_gather(
+  host_span<table_view const> source_tables,
+  host_span<column_view const> gather_maps,
+  out_of_bounds_policy bounds_policy  = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -97,11 +133,13 @@ std::unique_ptr<table> gather(
  * ```
  *
  * @param source_table Table that will be reversed
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return Reversed table
  */
 std::unique_ptr<table> reverse(
   table_view const& source_table,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -115,11 +153,13 @@ std::unique_ptr<table> reverse(
  * ```
  *
  * @param source_column Column that will be reversed
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return Reversed column
  */
 std::unique_ptr<column> reverse(
   column_view const& source_column,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -156,6 +196,7 @@ std::unique_ptr<column> reverse(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return Result of scattering values from source to target
  */
@@ -164,6 +205,7 @@ std::unique_ptr<table> scatter(
   column_view const& scatter_map,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -196,6 +238,7 @@ std::unique_ptr<table> scatter(
  * are to be scattered
  * @param check_bounds Optionally perform bounds checking on the values of
  * `scatter_map` and throw an error if any of its values are out of bounds.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return Result of scattering values from source to target
  */
@@ -204,6 +247,7 @@ std::unique_ptr<table> scatter(
   column_view const& indices,
   table_view const& target,
   bool check_bounds                   = false,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -238,6 +282,7 @@ std::unique_ptr<column> empty_like(scalar const& input);
  *
  * @param[in] input Immutable view of input column to emulate
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  * @return A column with sufficient uninitialized capacity to hold the same
  * number of elements as `input` of the same type as `input.type()`
@@ -245,6 +290,7 @@ std::unique_ptr<column> empty_like(scalar const& input);
 std::unique_ptr<column> allocate_like(
   column_view const& input,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -255,6 +301,7 @@ std::unique_ptr<column> allocate_like(
  * @param[in] input Immutable view of input column to emulate
  * @param[in] size The desired number of elements that the new column should have capacity for
  * @param[in] mask_alloc Optional, Policy for allocating null mask. Defaults to RETAIN
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  * @return A column with sufficient uninitialized capacity to hold the specified number of elements
  * as `input` of the same type as `input.type()`
@@ -263,6 +310,7 @@ std::unique_ptr<column> allocate_like(
   column_view const& input,
   size_type size,
   mask_allocation_policy mask_alloc   = mask_allocation_policy::RETAIN,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -340,6 +388,7 @@ void copy_range_in_place(column_view const& source,
  * @param source_end The index of the last element in the source range
  * (exclusive)
  * @param target_begin The starting index of the target range (inclusive)
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> The result target column
  */
@@ -349,6 +398,7 @@ std::unique_ptr<column> copy_range(
   size_type source_begin,
   size_type source_end,
   size_type target_begin,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -380,6 +430,7 @@ std::unique_ptr<column> copy_range(
  * @param input      Column to be shifted
  * @param offset     The offset by which to shift the input
  * @param fill_value Fill value for indeterminable outputs
+ * @param stream     CUDA stream used for device memory operations and kernel launches
  * @param mr         Device memory resource used to allocate the returned result's device memory
  *
  * @throw cudf::logic_error if @p input dtype is neither fixed-width nor string type
@@ -391,6 +442,7 @@ std::unique_ptr<column> shift(
   column_view const& input,
   size_type offset,
   scalar const& fill_value,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -667,6 +719,7 @@ struct packed_table {
  *
  * @param input View of a table to split
  * @param splits A vector of indices where the view will be split
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned result's device memory
  * @return The set of requested views of `input` indicated by the `splits` and the viewed memory
  * buffer.
@@ -674,6 +727,7 @@ struct packed_table {
 std::vector<packed_table> contiguous_split(
   cudf::table_view const& input,
   std::vector<size_type> const& splits,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -684,11 +738,13 @@ std::vector<packed_table> contiguous_split(
  * `cudf::unpack` to deserialize.
  *
  * @param input View of the table to pack
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Optional, The resource to use for all returned device allocations
  * @return packed_columns A struct containing the serialized metadata and data in contiguous host
  *         and device memory respectively
  */
 packed_columns pack(cudf::table_view const& input,
+                    rmm::cuda_stream_view stream        = cudf::default_stream_value,
                     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -743,6 +799,102 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+namespace detail {
+struct chunked_pack_state;
+}  // namespace detail
+
+/**
+ * @brief Packs a table into a bounded, caller-owned device buffer, one piece at a time.
+ *
+ * `cudf::pack` allocates a buffer for the whole packed table. `chunked_pack` instead copies the
+ * packed table through a user buffer of fixed size, e.g. a pinned bounce buffer or a buffer of a
+ * spill pool, so that tables larger than the available device memory can be packed.
+ *
+ * Each call to `next()` writes the next consecutive bytes of the same layout that `cudf::pack`
+ * produces. Appending the results of every call to `next()` yields a buffer of
+ * `get_total_contiguous_size()` bytes that can be unpacked with
+ * `cudf::unpack(metadata.data(), buffer)` where `metadata` is the result of `build_metadata()`.
+ *
+ * @code{.pseudo}
+ * chunked_pack packer(input, user_buffer.size());
+ * while (packer.has_next()) {
+ *   auto const bytes_copied = packer.next(user_buffer);
+ *   // consume the first bytes_copied bytes of user_buffer
+ * }
+ * auto const metadata = packer.build_metadata();
+ * @endcode
+ *
+ * The input table must outlive the `chunked_pack`.
+ */
+class chunked_pack {
+ public:
+  /**
+   * @brief Construct a `chunked_pack` for the given table.
+   *
+   * The layout of the packed table is computed on construction; no data is copied until `next()`
+   * is called.
+   *
+   * @throws cudf::logic_error if `user_buffer_size` is less than 1MB
+   *
+   * @param input View of the table to pack
+   * @param user_buffer_size The size in bytes of the buffer passed to every call to `next()`
+   * @param temp_mr The resource used for the scratch memory held by the packer
+   */
+  explicit chunked_pack(
+    cudf::table_view const& input,
+    std::size_t user_buffer_size,
+    rmm::mr::device_memory_resource* temp_mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destroy the `chunked_pack` and its scratch memory.
+   */
+  ~chunked_pack();
+
+  /**
+   * @brief Returns the total size in bytes of the packed table.
+   *
+   * This is the sum of the values returned by every call to `next()` and the size of the buffer
+   * that `cudf::pack` would allocate for the same table.
+   *
+   * @return The total size of the packed table
+   */
+  [[nodiscard]] std::size_t get_total_contiguous_size() const;
+
+  /**
+   * @brief Returns whether there is data left to copy with `next()`.
+   *
+   * @return `true` if `next()` should be called again
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Copies the next bytes of the packed table into `user_buffer`.
+   *
+   * The copy is performed on the default stream and is not synchronized.
+   *
+   * @throws cudf::logic_error if `has_next()` is false
+   * @throws cudf::logic_error if the size of `user_buffer` is not the size given on construction
+   *
+   * @param user_buffer The device buffer to copy into
+   * @return The number of bytes written at the start of `user_buffer`
+   */
+  std::size_t next(cudf::device_span<uint8_t> const& user_buffer);
+
+  /**
+   * @brief Builds the metadata of the packed table.
+   *
+   * The metadata is identical to the one returned by `cudf::pack` for the same table.
+   *
+   * @throws cudf::logic_error if `has_next()` is true
+   *
+   * @return The metadata used to `unpack` the packed table
+   */
+  [[nodiscard]] packed_columns::metadata build_metadata() const;
+
+ private:
+  std::unique_ptr<detail::chunked_pack_state> state;
+};
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -758,6 +910,7 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
  * @param[in] rhs right-hand column_view
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -766,6 +919,7 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -782,6 +936,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand column_view
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -790,6 +945,7 @@ std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
   column_view const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -806,6 +962,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand scalar
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -814,6 +971,7 @@ std::unique_ptr<column> copy_if_else(
   column_view const& lhs,
   scalar const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -828,6 +986,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] rhs right-hand scalar
  * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
  * boolean for each element. null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned column's device memory
  *
  * @returns new column with the selected elements
@@ -836,6 +995,39 @@ std::unique_ptr<column> copy_if_else(
   scalar const& lhs,
   scalar const& rhs,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief   Returns a new table, where each row is selected from either @p lhs or
+ *          @p rhs based on the value of the corresponding element in @p boolean_mask
+ *
+ * Selects each row i of the output table from either @p rhs or @p lhs using the following
+ * rule: `output[i] = (boolean_mask.valid(i) and boolean_mask[i]) ? lhs[i] : rhs[i]`
+ *
+ * This is equivalent to calling `copy_if_else` on each pair of columns, but the boolean mask is
+ * read once for all the fixed-width columns, which are selected together.
+ *
+ * @throws cudf::logic_error if lhs and rhs do not have the same number of columns
+ * @throws cudf::logic_error if any column of lhs and the same column of rhs are not of the
+ * same type
+ * @throws cudf::logic_error if lhs and rhs are not of the same length
+ * @throws cudf::logic_error if boolean mask is not of type bool
+ * @throws cudf::logic_error if boolean mask is not of the same length as lhs and rhs
+ * @param[in] lhs left-hand table_view
+ * @param[in] rhs right-hand table_view
+ * @param[in] boolean_mask column of `type_id::BOOL8` representing "left (true) / right (false)"
+ * boolean for each row. Null element represents false.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns new table with the selected rows
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -870,6 +1062,7 @@ std::unique_ptr<column> copy_if_else(
  * @param[in] input table_view (set of dense columns) to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`
@@ -878,6 +1071,7 @@ std::unique_ptr<table> boolean_mask_scatter(
   table_view const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -907,6 +1101,7 @@ std::unique_ptr<table> boolean_mask_scatter(
  * @param[in] input scalars to scatter
  * @param[in] target table_view to modify with scattered values from `input`
  * @param[in] boolean_mask column_view which acts as boolean mask
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate device memory of the returned table
  *
  * @returns Returns a table by scattering `input` into `target` as per `boolean_mask`
@@ -915,6 +1110,7 @@ std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -927,12 +1123,14 @@ std::unique_ptr<table> boolean_mask_scatter(
  *
  * @param input Column view to get the element from
  * @param index Index into `input` to get the element at
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned scalar's device memory
  * @return std::unique_ptr<scalar> Scalar containing the single value
  */
 std::unique_ptr<scalar> get_element(
   column_view const& input,
   size_type index,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -946,6 +1144,12 @@ enum class sample_with_replacement : bool {
 /**
  * @brief Gather `n` samples from given `input` randomly
  *
+ * Without replacement, every row is given a random key computed from `seed` and its index, and
+ * the sample consists of the `n` rows with the smallest keys, in the order of their keys. Only the
+ * rows whose keys fall below a threshold expected to let slightly more than `n` rows through are
+ * kept and sorted, so no permutation of all rows is materialized. The sample equals the result of
+ * a `reservoir_sampler` fed with the rows of `input` in any number of batches.
+ *
  * @code{.pseudo}
  * Example:
  * input: {col1: {1, 2, 3, 4, 5}, col2: {6, 7, 8, 9, 10}}
@@ -966,6 +1170,7 @@ enum class sample_with_replacement : bool {
  * @param n non-negative number of samples expected from `input`
  * @param replacement Allow or disallow sampling of the same row more than once
  * @param seed Seed value to initiate random number generator
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  *
  * @return std::unique_ptr<table> Table containing samples from `input`
@@ -975,8 +1180,111 @@ std::unique_ptr<table> sample(
   size_type const n,
   sample_with_replacement replacement = sample_with_replacement::FALSE,
   int64_t const seed                  = 0,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Samples each row of `input` independently with the given probability.
+ *
+ * Every row is kept if its random key, computed from `seed` and its index, falls below
+ * `probability`, so the rows are filtered in a single pass in their input order. The number of
+ * rows of the sample follows a binomial distribution of mean `probability * input.num_rows()`.
+ * To sample consecutive batches of a larger table, pass the index of the first row of each batch
+ * as `first_row_index`.
+ *
+ * @code{.pseudo}
+ * input: {col1: {1, 2, 3, 4, 5}, col2: {6, 7, 8, 9, 10}}
+ * probability: 0.5
+ *
+ * output: {col1: {2, 3, 5}, col2: {7, 8, 10}}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `probability` is not in `[0, 1]`.
+ *
+ * @param input View of a table to sample
+ * @param probability Probability of every row to be sampled
+ * @param seed Seed value of the random keys
+ * @param first_row_index Index of the first row of `input` in the table it is a batch of
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return Table containing the sampled rows of `input`
+ */
+std::unique_ptr<table> bernoulli_sample(
+  table_view const& input,
+  double probability,
+  int64_t seed                        = 0,
+  int64_t first_row_index             = 0,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Samples `n` rows without replacement from a table that arrives in batches.
+ *
+ * The sampler keeps the `n` rows with the smallest random keys seen so far, the keys being
+ * computed from the seed and the index of each row in the concatenation of the batches. Once the
+ * reservoir is full, only the rows of a batch whose keys are below the largest key of the
+ * reservoir are gathered, so the cost of a batch is a single pass over it plus the few rows that
+ * enter the reservoir. Device memory use is bounded by the reservoir, not by the number of rows
+ * seen.
+ *
+ * The sample after any sequence of batches equals `sample(concatenate(batches), n,
+ * sample_with_replacement::FALSE, seed)`.
+ *
+ * All batches must have the same columns.
+ */
+class reservoir_sampler {
+ public:
+  /**
+   * @brief Constructs an empty sampler.
+   *
+   * @throws cudf::logic_error if `n` < 0.
+   *
+   * @param n The number of rows to sample
+   * @param seed Seed value of the random keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  reservoir_sampler(size_type n,
+                    int64_t seed                 = 0,
+                    rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Adds the rows of the next batch to the sampled rows.
+   *
+   * @throws cudf::logic_error if the batch has other columns than the previous batches.
+   *
+   * @param batch The next batch of rows
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void add(table_view const& batch, rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Returns the sample of the rows added so far, in the order of their keys.
+   *
+   * The sample has `min(n, num_rows_seen())` rows. It has no columns if no batch was added.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return The sampled rows
+   */
+  [[nodiscard]] std::unique_ptr<table> sample(
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of rows added so far.
+   */
+  [[nodiscard]] int64_t num_rows_seen() const { return _num_rows_seen; }
+
+ private:
+  size_type _n;
+  int64_t _seed;
+  int64_t _num_rows_seen{0};
+  std::unique_ptr<table> _reservoir;    ///< The sampled rows, in the order of their keys
+  rmm::device_uvector<uint64_t> _keys;  ///< The keys of the sampled rows
+  std::optional<uint64_t> _max_key;     ///< The largest key of the reservoir once it is full
+};
+
 /**
  * @brief Checks if a column or its descendants have non-empty null rows
  *
@@ -1047,12 +1355,14 @@ bool may_have_nonempty_nulls(column_view const& input);
  * may have child/descendant columns that are LIST or STRING.
  *
  * @param input The column whose null rows are to be checked and purged
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> Column with equivalent contents to `input`, but with
  * the contents of null rows purged
  */
 std::unique_ptr<column> purge_nonempty_nulls(
   lists_column_view const& input,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -1083,12 +1393,14 @@ std::unique_ptr<column> purge_nonempty_nulls(
  * may have child/descendant columns that are LIST or STRING.
  *
  * @param input The column whose null rows are to be checked and purged
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> Column with equivalent contents to `input`, but with
  * the contents of null rows purged
  */
 std::unique_ptr<column> purge_nonempty_nulls(
   strings_column_view const& input,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -1119,12 +1431,14 @@ std::unique_ptr<column> purge_nonempty_nulls(
  * may have child/descendant columns that are LIST or STRING.
  *
  * @param input The column whose null rows are to be checked and purged
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> Column with equivalent contents to `input`, but with
  * the contents of null rows purged
  */
 std::unique_ptr<column> purge_nonempty_nulls(
   structs_column_view const& input,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /** @} */
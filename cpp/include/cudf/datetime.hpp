@@ -21,6 +21,8 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -133,6 +135,39 @@ std::unique_ptr<cudf::column> extract_second(
   cudf::column_view const& column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Fields of a timestamp that `extract_components` can compute.
+ */
+enum class datetime_component : int32_t {
+  YEAR,         ///< Year, as `extract_year`
+  MONTH,        ///< Month from 1 to 12, as `extract_month`
+  DAY,          ///< Day of the month from 1 to 31, as `extract_day`
+  WEEKDAY,      ///< ISO day of the week from 1 (Monday) to 7, as `extract_weekday`
+  HOUR,         ///< Hour from 0 to 23, as `extract_hour`
+  MINUTE,       ///< Minute from 0 to 59, as `extract_minute`
+  SECOND,       ///< Second from 0 to 59, as `extract_second`
+  DAY_OF_YEAR,  ///< Day of the year from 1 to 366, as `day_of_year`
+  QUARTER       ///< Quarter from 1 to 4, as `extract_quarter`
+};
+
+/**
+ * @brief Extracts several components from any date time type in a single pass.
+ *
+ * This returns the same columns as calling the function extracting each component separately,
+ * but decodes the date of each timestamp only once.
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components Components to extract, in the order of the output columns
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ *
+ * @returns Table of int16_t columns, one per element of `components`, with the nulls of `column`
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
@@ -346,6 +381,38 @@ std::unique_ptr<cudf::column> round_datetimes(
   rounding_frequency freq,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts local times of one timezone to the local times of another.
+ *
+ * Each timestamp is read as the wall-clock time in `from_timezone`, converted to UTC and then to
+ * the wall-clock time in `to_timezone`, following the daylight saving time rules of both zones.
+ * The rules come from the system's TZif files under `/usr/share/zoneinfo`. The transition table
+ * of each timezone is built once and cached in device memory for the lifetime of the process.
+ *
+ * A local time that is skipped or repeated by a transition of `from_timezone` maps to one of the
+ * instants next to the transition. "UTC" and the empty string name UTC.
+ *
+ * @code{.pseudo}
+ * column = ["2022-07-01 12:00:00", "2022-12-01 12:00:00"]
+ * convert_timezone(column, "UTC", "America/New_York")
+ *        = ["2022-07-01 08:00:00", "2022-12-01 07:00:00"]
+ * @endcode
+ *
+ * @throw cudf::logic_error if input column datatype is not a TIMESTAMP or is TIMESTAMP_DAYS.
+ * @throw cudf::logic_error if the TZif file of a timezone cannot be read.
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param from_timezone Name of the timezone of the input, for example "Europe/Paris"
+ * @param to_timezone Name of the timezone of the output
+ * @param mr Device memory resource used to allocate device memory of the returned column
+ * @return cudf::column of the same datetime resolution as the input column
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& column,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace datetime
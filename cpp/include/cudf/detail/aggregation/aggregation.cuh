@@ -275,6 +275,35 @@ struct update_target_element<
   }
 };
 
+template <typename Source, bool target_has_nulls, bool source_has_nulls>
+struct update_target_element<
+  Source,
+  aggregation::SUM,
+  target_has_nulls,
+  source_has_nulls,
+  std::enable_if_t<is_fixed_point<Source>() &&
+                   !cudf::has_atomic_support<device_storage_type_t<Source>>() &&
+                   std::is_same_v<device_storage_type_t<Source>, __int128_t>>> {
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    if (source_has_nulls and source.is_null(source_index)) { return; }
+
+    using Target       = target_type_t<Source, aggregation::SUM>;
+    using DeviceTarget = device_storage_type_t<Target>;
+    using DeviceSource = device_storage_type_t<Source>;
+
+    // There is no 128-bit atomicAdd, the sum is accumulated in two 64-bit words instead
+    cudf::detail::atomic_add_two_words(
+      &target.element<DeviceTarget>(target_index),
+      static_cast<DeviceTarget>(source.element<DeviceSource>(source_index)));
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
 /**
  * @brief Function object to update a single element in a target column using
  * the dictionary key addressed by the specific index.
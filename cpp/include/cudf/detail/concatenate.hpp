@@ -29,7 +29,8 @@ namespace cudf {
 //! Inner interfaces and implementations
 namespace detail {
 /**
- * @copydoc cudf::concatenate(host_span<column_view const>,rmm::mr::device_memory_resource*)
+ * @copydoc cudf::concatenate(host_span<column_view const>, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -39,7 +40,8 @@ std::unique_ptr<column> concatenate(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::concatenate(host_span<table_view const>,rmm::mr::device_memory_resource*)
+ * @copydoc cudf::concatenate(host_span<table_view const>, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -139,7 +139,7 @@ std::vector<table_view> split(table_view const& input,
                               rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
- * @copydoc cudf::shift(column_view const&,size_type,scalar const&,
+ * @copydoc cudf::shift(column_view const&,size_type,scalar const&, rmm::cuda_stream_view,
  * rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
@@ -214,7 +214,7 @@ packed_columns pack(cudf::table_view const& input,
 
 /**
  * @copydoc cudf::allocate_like(column_view const&, size_type, mask_allocation_policy,
- * rmm::mr::device_memory_resource*)
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -226,8 +226,8 @@ std::unique_ptr<column> allocate_like(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::copy_if_else( column_view const&, column_view const&,
- * column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::copy_if_else( column_view const&, column_view const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -239,8 +239,8 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::copy_if_else( scalar const&, column_view const&,
- * column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::copy_if_else( scalar const&, column_view const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -252,8 +252,8 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::copy_if_else( column_view const&, scalar const&,
- * column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::copy_if_else( column_view const&, scalar const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -265,8 +265,8 @@ std::unique_ptr<column> copy_if_else(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::copy_if_else( scalar const&, scalar const&,
- * column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::copy_if_else( scalar const&, scalar const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -277,6 +277,19 @@ std::unique_ptr<column> copy_if_else(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::copy_if_else( table_view const&, table_view const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> copy_if_else(
+  table_view const& lhs,
+  table_view const& rhs,
+  column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::sample
  *
@@ -290,6 +303,16 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::bernoulli_sample
+ */
+std::unique_ptr<table> bernoulli_sample(table_view const& input,
+                                        double probability,
+                                        int64_t seed,
+                                        int64_t first_row_index,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc cudf::get_element
  *
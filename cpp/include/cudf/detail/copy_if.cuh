@@ -23,6 +23,8 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/detail/utilities/small_allocation.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
@@ -251,7 +253,8 @@ struct scatter_gather_functor {
 
     cudf::detail::grid_1d grid{input.size(), block_size, per_thread};
 
-    rmm::device_scalar<cudf::size_type> null_count{0, stream};
+    rmm::device_scalar<cudf::size_type> null_count{
+      0, stream, cudf::detail::small_allocation_resource(sizeof(cudf::size_type))};
     if (output.nullable()) {
       // Have to initialize the output mask to all zeros because we may update
       // it with atomicOr().
@@ -378,7 +381,7 @@ std::unique_ptr<table> copy_if(
     cudaMemcpyDefault,
     stream.value()));
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   if (output_size == input.num_rows()) {
     return std::make_unique<table>(input, stream, mr);
@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <cudf/datetime.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace datetime {
@@ -94,6 +97,18 @@ std::unique_ptr<cudf::column> extract_second(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::datetime::extract_components(cudf::column_view const&,
+ * std::vector<datetime_component> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::table> extract_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::last_day_of_month(cudf::column_view const&, rmm::mr::device_memory_resource *)
  *
@@ -153,6 +168,19 @@ std::unique_ptr<cudf::column> extract_quarter(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::datetime::convert_timezone(cudf::column_view const&, std::string const&,
+ * std::string const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<cudf::column> convert_timezone(
+  cudf::column_view const& column,
+  std::string const& from_timezone,
+  std::string const& to_timezone,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace datetime
 }  // namespace cudf
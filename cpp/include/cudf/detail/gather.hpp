@@ -25,6 +25,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 
@@ -84,5 +85,20 @@ std::unique_ptr<table> gather(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::batched_gather
+ *
+ * @param neg_indices Whether negative indices of signed gather maps count from the end of the
+ * source table
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::unique_ptr<table>> batched_gather(
+  host_span<table_view const> source_tables,
+  host_span<column_view const> gather_maps,
+  out_of_bounds_policy bounds_policy,
+  negative_index_policy neg_indices,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
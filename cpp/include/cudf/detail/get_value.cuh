@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -54,7 +55,7 @@ T get_value(column_view const& col_view, size_type element_index, rmm::cuda_stre
                                 sizeof(T),
                                 cudaMemcpyDeviceToHost,
                                 stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return result;
 }
 
@@ -63,6 +63,24 @@ struct sort_groupby_helper {
                       null_policy include_null_keys = null_policy::EXCLUDE,
                       sorted keys_pre_sorted        = sorted::NO);
 
+  /**
+   * @brief Construct a helper object whose grouping of `keys` is taken from a plan produced by
+   * `grouping_plan()` instead of being computed.
+   *
+   * @throw cudf::logic_error if `plan` does not have the layout of `grouping_plan()` or does not
+   * match the rows of `keys`
+   *
+   * @param keys table to group by
+   * @param include_null_keys Include rows in keys with nulls. Must be the same policy that the
+   * plan was computed with.
+   * @param plan The key sort order and the group labels of the sorted keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  sort_groupby_helper(table_view const& keys,
+                      null_policy include_null_keys,
+                      table_view const& plan,
+                      rmm::cuda_stream_view stream);
+
   ~sort_groupby_helper()                          = default;
   sort_groupby_helper(sort_groupby_helper const&) = delete;
   sort_groupby_helper& operator=(sort_groupby_helper const&) = delete;
@@ -120,6 +138,20 @@ struct sort_groupby_helper {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+  /**
+   * @brief Get the computed grouping of `keys` as a table that can be given back to the
+   * `plan` constructor
+   *
+   * The first column is the full sort order of `keys`, including the rows with null keys that are
+   * excluded from grouping. The second column is the group label of every row in that order, null
+   * for the excluded rows.
+   *
+   * @return a new table of the key sort order and group labels
+   */
+  std::unique_ptr<table> grouping_plan(
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Get the number of groups in `keys`
    */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+namespace hyperloglog {
+
+/**
+ * @brief Generate a HyperLogLog sketch column from a grouped set of input values.
+ *
+ * The sketch column produced is a `LIST<UINT8>` column holding the `2^precision` registers of
+ * one sketch per row. Null values are ignored.
+ *
+ * @param values Grouped values to insert in the sketches
+ * @param group_labels 0-based ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param precision Number of hash bits selecting a register
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Sketch column, with 1 sketch per group
+ */
+std::unique_ptr<column> group_hll(column_view const& values,
+                                  cudf::device_span<size_type const> group_labels,
+                                  size_type num_groups,
+                                  int precision,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merges the HyperLogLog sketches within the same group into a new sketch.
+ *
+ * Null sketches are ignored. If there is no non-null sketch at all, every output row is null.
+ *
+ * @throws cudf::logic_error if `sketches` is not a `LIST<UINT8>` column
+ * @throws cudf::logic_error if the non-null sketches do not all have the same valid number of
+ * registers
+ *
+ * @param sketches Grouped sketches to merge
+ * @param group_labels 0-based ID of group that the corresponding sketch belongs to
+ * @param num_groups Number of groups
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Sketch column, with 1 sketch per group
+ */
+std::unique_ptr<column> group_merge_hll(column_view const& sketches,
+                                        cudf::device_span<size_type const> group_labels,
+                                        size_type num_groups,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Generate a HyperLogLog sketch scalar from all the input values.
+ *
+ * @param values Values to insert in the sketch
+ * @param precision Number of hash bits selecting a register
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ *
+ * @returns Sketch scalar
+ */
+std::unique_ptr<scalar> reduce_hll(column_view const& values,
+                                   int precision,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Merges all the HyperLogLog sketches of a column into a new sketch.
+ *
+ * @param sketches Sketches to merge
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ *
+ * @returns Sketch scalar, null if all the sketches are null
+ */
+std::unique_ptr<scalar> reduce_merge_hll(column_view const& sketches,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr);
+
+}  // namespace hyperloglog
+
+/**
+ * @copydoc cudf::estimate_distinct_count
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> estimate_distinct_count(
+  lists_column_view const& sketches,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::approx_distinct_count
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision,
+                                      rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+}  // namespace detail
+}  // namespace cudf
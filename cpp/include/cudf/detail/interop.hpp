@@ -47,6 +47,11 @@ DLManagedTensor* to_dlpack(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::view_from_dlpack
+ */
+table_view view_from_dlpack(DLManagedTensor const* managed_tensor);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
@@ -107,6 +112,13 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
                                        rmm::cuda_stream_view stream = cudf::default_stream_value,
                                        arrow::MemoryPool* ar_mr     = arrow::default_memory_pool());
 
+/**
+ * @copydoc cudf::to_arrow_async
+ */
+std::shared_ptr<arrow::Table> to_arrow_async(table_view input,
+                                             std::vector<column_metadata> const& metadata,
+                                             rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::arrow_to_cudf
  *
@@ -117,5 +129,32 @@ std::unique_ptr<table> from_arrow(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::to_arrow_schema
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                host_span<column_metadata const> metadata = {});
+
+/**
+ * @copydoc cudf::to_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+unique_device_array_t to_arrow_device(
+  cudf::table&& table,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::from_arrow_device
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+unique_table_view_t from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
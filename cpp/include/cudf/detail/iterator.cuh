@@ -156,6 +156,37 @@ struct validity_accessor {
   }
 };
 
+/**
+ * @brief Validity accessor of a column reading one bitmask word per tile of 32 rows.
+ *
+ * `validity_accessor` and the pair and null replacement iterators load and shift the bitmask
+ * word of every row they access. This accessor is instead called by all the lanes of a warp
+ * together, each lane with the row of its lane index in the same tile `[32 * t, 32 * t + 32)`:
+ * the first lane loads the bitmask word of the tile, realigned to the offset of the column, and
+ * broadcasts it to the other lanes.
+ *
+ * Every lane of the warp must call it, including those whose row is past the end of the column,
+ * as long as the first row of the tile is within the column. The validity of the rows past the
+ * end of the column is unspecified.
+ */
+struct tile_validity_accessor {
+  column_device_view const col;
+  bool const has_nulls;  ///< If false, every row is valid and the bitmask is not read
+
+  __device__ inline bool operator()(cudf::size_type i) const
+  {
+    if (not has_nulls) { return true; }
+    constexpr auto tile_size = static_cast<cudf::size_type>(size_in_bits<bitmask_type>());
+    bitmask_type word{0};
+    if (threadIdx.x % tile_size == 0) {
+      word = get_mask_offset_word(
+        col.null_mask(), i / tile_size, col.offset(), col.offset() + col.size());
+    }
+    word = __shfl_sync(0xffffffff, word, 0);
+    return word & (bitmask_type{1} << (i % tile_size));
+  }
+};
+
 /**
  * @brief Constructs an iterator over a column's values that replaces null
  * elements with a specified value.
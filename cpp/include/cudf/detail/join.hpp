@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/table/table_view.hpp>
@@ -93,6 +94,26 @@ struct hash_join {
             cudf::null_equality compare_nulls,
             rmm::cuda_stream_view stream = cudf::default_stream_value);
 
+  /**
+   * @brief Constructor that rebuilds the hash table from the output of `pack()` without hashing
+   * the build rows again.
+   *
+   * @throw cudf::logic_error if `packed` was not produced by `pack()`.
+   *
+   * @param packed The packed build table and row hashes of a hash join.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  hash_join(cudf::packed_columns const& packed,
+            cudf::null_equality compare_nulls,
+            rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @copydoc cudf::hash_join::pack
+   */
+  [[nodiscard]] packed_columns pack(rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr) const;
+
   /**
    * @copydoc cudf::hash_join::inner_join
    */
@@ -143,6 +164,18 @@ struct hash_join {
                              rmm::mr::device_memory_resource* mr) const;
 
  private:
+  /**
+   * @brief Constructor that builds the hash table from `build` and, if given, the precomputed
+   * `row_hashes` of its rows.
+   *
+   * @param build The build table and the optional hashes of its rows.
+   * @param compare_nulls Controls whether null join-key values should match or not.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   */
+  hash_join(std::pair<cudf::table_view, std::optional<cudf::column_view>> const& build,
+            cudf::null_equality compare_nulls,
+            rmm::cuda_stream_view stream);
+
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
    * and returns the output indices of `build_table` and `probe_table` as a combined table,
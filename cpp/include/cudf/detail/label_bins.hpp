@@ -54,6 +54,50 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::label_bins(column_view const&, double, double, size_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> label_bins(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::histogram(column_view const&, double, double, size_type,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::histogram(column_view const&, column_view const&, size_type, double, double,
+ * size_type, rmm::mr::device_memory_resource*)
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& group_labels,
+  size_type num_groups,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace detail
 }  // namespace cudf
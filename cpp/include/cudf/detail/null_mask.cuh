@@ -38,8 +38,10 @@
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <iterator>
 #include <optional>
+#include <type_traits>
 #include <vector>
 
 namespace cudf {
@@ -107,6 +109,103 @@ __global__ void offset_bitmask_binop(Binop op,
   if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
 }
 
+/**
+ * @brief Combines a pair of bitmask words using a binary operator.
+ */
+template <typename Binop>
+__device__ inline bitmask_type combine_words(Binop op, bitmask_type lhs, bitmask_type rhs)
+{
+  return op(lhs, rhs);
+}
+
+/**
+ * @brief Combines a pair of vectors of four bitmask words using a binary operator.
+ */
+template <typename Binop>
+__device__ inline uint4 combine_words(Binop op, uint4 lhs, uint4 rhs)
+{
+  return uint4{op(lhs.x, rhs.x), op(lhs.y, rhs.y), op(lhs.z, rhs.z), op(lhs.w, rhs.w)};
+}
+
+/**
+ * @brief Computes the merger of an array of word-aligned bitmasks using a binary operator
+ *
+ * This is `offset_bitmask_binop` for source masks which all begin at a word boundary, so that
+ * their words are combined without being shifted. If `vectorized`, the source masks and the
+ * destination are 16-byte aligned and are accessed four words at a time.
+ *
+ * @tparam block_size Number of threads in each thread block
+ * @tparam vectorized Whether to load and store four words at a time
+ * @tparam Binop Type of binary operator
+ *
+ * @param op The binary operator used to combine the bitmasks
+ * @param destination The bitmask to write result into
+ * @param source Array of pointers to the first word of each source mask
+ * @param source_size_bits Number of bits in each mask in @p source
+ * @param count_ptr Pointer to counter of set bits
+ */
+template <int block_size, bool vectorized, typename Binop>
+__global__ void aligned_bitmask_binop(Binop op,
+                                      device_span<bitmask_type> destination,
+                                      device_span<bitmask_type const* const> source,
+                                      size_type source_size_bits,
+                                      size_type* count_ptr)
+{
+  using load_type = std::conditional_t<vectorized, uint4, bitmask_type>;
+  constexpr size_type words_per_load{sizeof(load_type) / sizeof(bitmask_type)};
+  constexpr auto const word_size{detail::size_in_bits<bitmask_type>()};
+
+  // The slack bits of the last word are not counted
+  auto const last_word_index = cudf::word_index(source_size_bits - 1);
+  auto const num_slack_bits  = word_size - ((source_size_bits - 1) % word_size) - 1;
+  auto const count_bits      = [&](size_type word_index, bitmask_type word) {
+    if (word_index > last_word_index) { return 0; }
+    if (word_index == last_word_index && num_slack_bits > 0) {
+      word &= ~set_most_significant_bits(num_slack_bits);
+    }
+    return __popc(word);
+  };
+
+  auto const tid       = threadIdx.x + blockIdx.x * blockDim.x;
+  auto const stride    = blockDim.x * gridDim.x;
+  auto const num_loads = destination.size() / words_per_load;
+
+  size_type thread_count = 0;
+
+  for (size_type load_index = tid; load_index < num_loads; load_index += stride) {
+    auto words = reinterpret_cast<load_type const*>(source[0])[load_index];
+    for (size_type i = 1; i < source.size(); i++) {
+      words = combine_words(op, words, reinterpret_cast<load_type const*>(source[i])[load_index]);
+    }
+    reinterpret_cast<load_type*>(destination.data())[load_index] = words;
+
+    auto const word_index = load_index * words_per_load;
+    if constexpr (vectorized) {
+      thread_count += count_bits(word_index, words.x) + count_bits(word_index + 1, words.y) +
+                      count_bits(word_index + 2, words.z) + count_bits(word_index + 3, words.w);
+    } else {
+      thread_count += count_bits(word_index, words);
+    }
+  }
+
+  // The words after the last vector
+  for (size_type word_index = num_loads * words_per_load + tid; word_index < destination.size();
+       word_index += stride) {
+    auto word = source[0][word_index];
+    for (size_type i = 1; i < source.size(); i++) {
+      word = op(word, source[i][word_index]);
+    }
+    destination[word_index] = word;
+    thread_count += count_bits(word_index, word);
+  }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type block_count = BlockReduce(temp_storage).Sum(thread_count);
+
+  if (threadIdx.x == 0) { atomicAdd(count_ptr, block_count); }
+}
+
 /**
  * @copydoc bitmask_binop(Binop op, host_span<bitmask_type const* const>, host_span<size_type>
  * const, size_type, rmm::mr::device_memory_resource *)
@@ -165,6 +264,43 @@ size_type inplace_bitmask_binop(Binop op,
 
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource();
   rmm::device_scalar<size_type> d_counter{0, stream, mr};
+  auto constexpr block_size = 256;
+
+  // Masks which all begin at a word boundary are combined word by word, without shifting, and
+  // four words at a time if they are also 16-byte aligned
+  auto constexpr word_size = detail::size_in_bits<bitmask_type>();
+  if (std::all_of(masks_begin_bits.begin(), masks_begin_bits.end(), [](auto b) {
+        return b % word_size == 0;
+      })) {
+    std::vector<bitmask_type const*> aligned_masks(masks.size());
+    std::transform(masks.begin(),
+                   masks.end(),
+                   masks_begin_bits.begin(),
+                   aligned_masks.begin(),
+                   [](auto mask, auto begin_bit) { return mask + word_index(begin_bit); });
+    auto const d_masks = make_device_uvector_async(aligned_masks, stream, mr);
+
+    auto const is_vector_aligned = [](void const* ptr) {
+      return reinterpret_cast<std::uintptr_t>(ptr) % sizeof(uint4) == 0;
+    };
+    if (is_vector_aligned(dest_mask.data()) and
+        std::all_of(aligned_masks.begin(), aligned_masks.end(), is_vector_aligned)) {
+      auto constexpr words_per_vector = sizeof(uint4) / sizeof(bitmask_type);
+      cudf::detail::grid_1d config(
+        std::max<size_type>(dest_mask.size() / words_per_vector, 1), block_size);
+      aligned_bitmask_binop<block_size, true>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+          op, dest_mask, d_masks, mask_size_bits, d_counter.data());
+    } else {
+      cudf::detail::grid_1d config(dest_mask.size(), block_size);
+      aligned_bitmask_binop<block_size, false>
+        <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+          op, dest_mask, d_masks, mask_size_bits, d_counter.data());
+    }
+    CUDF_CHECK_CUDA(stream.value());
+    return d_counter.value(stream);
+  }
+
   rmm::device_uvector<bitmask_type const*> d_masks(masks.size(), stream, mr);
   rmm::device_uvector<size_type> d_begin_bits(masks_begin_bits.size(), stream, mr);
 
@@ -176,7 +312,6 @@ size_type inplace_bitmask_binop(Binop op,
                                 cudaMemcpyHostToDevice,
                                 stream.value()));
 
-  auto constexpr block_size = 256;
   cudf::detail::grid_1d config(dest_mask.size(), block_size);
   offset_bitmask_binop<block_size>
     <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
@@ -18,6 +18,8 @@
 
 #include "nvtx3.hpp"
 
+#include <memory>
+
 namespace cudf {
 /**
  * @brief Tag type for libcudf's NVTX domain.
@@ -31,6 +33,35 @@ struct libcudf_domain {
  */
 using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
 
+namespace detail {
+/**
+ * @brief Reports the lifetime of a libcudf API call to the installed `api_call_observer`.
+ *
+ * While sync points are recorded, the outermost scope also names the API that the host sync
+ * points of its thread are attributed to. Does nothing when neither is on as the scope is entered.
+ *
+ * @see cudf::set_api_call_observer
+ * @see cudf::start_recording_sync_points
+ */
+class api_call_scope {
+ public:
+  /**
+   * @brief Starts measuring the call to the function `name` if it is observed.
+   *
+   * @param name Name of the called function, which must outlive the scope
+   */
+  explicit api_call_scope(char const* name);
+  ~api_call_scope();
+
+  api_call_scope(api_call_scope const&) = delete;
+  api_call_scope& operator=(api_call_scope const&) = delete;
+
+ private:
+  struct measurement;
+  std::unique_ptr<measurement> _measurement;  ///< Null when the call is not observed
+  bool _is_outermost{false};                  ///< Whether the scope names the running API
+};
+}  // namespace detail
 }  // namespace cudf
 
 /**
@@ -38,7 +69,7 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The call is also reported to the `api_call_observer`, if one is installed.
  *
  * Example:
  * ```
@@ -48,4 +79,6 @@ using thread_range = ::nvtx3::domain_thread_range<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                   \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain) \
+  cudf::detail::api_call_scope const cudf_api_call_scope__{__func__}
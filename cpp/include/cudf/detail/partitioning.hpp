@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::partition
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
+  table_view const& t,
+  column_view const& partition_map,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::range_partition_splitters
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> range_partition_splitters(table_view const& sample,
+                                                 size_type num_partitions,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::range_partition(table_view const&, std::vector<size_type> const&,
+ * table_view const&, std::vector<order> const&, std::vector<null_order> const&,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @copydoc cudf::range_partition(table_view const&, std::vector<size_type> const&, size_type,
+ * std::vector<order> const&, std::vector<null_order> const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -20,6 +20,9 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -38,6 +41,43 @@ std::unique_ptr<column> quantile(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::quantile_unsorted()
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> quantile_unsorted(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                = interpolation::LINEAR,
+  bool exact                          = true,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Finds the rows holding the values at the given positions of the sorted valid values
+ * of a column.
+ *
+ * Element `i` of the result is the index of a row of `input` whose value would be at position
+ * `positions[i]` if the valid values of `input` were sorted in ascending order. Rows with equal
+ * values are interchangeable, so the returned row may differ from the one a sort would put there.
+ *
+ * Columns of numeric, chrono and 32 or 64-bit fixed-point types are not sorted. A sample of the
+ * values brackets each position with a range of values, one pass counts the values below and
+ * within each range, and only the values within the ranges are sorted. Other columns are sorted.
+ *
+ * @throws cudf::logic_error if `positions` is not sorted in ascending order.
+ * @throws cudf::logic_error if a position is negative or not less than the number of valid rows.
+ *
+ * @param input Column to select from
+ * @param positions Positions within the sorted valid values, in ascending order
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Index of the row at each position
+ */
+rmm::device_uvector<size_type> select_sorted_positions(column_view const& input,
+                                                       std::vector<size_type> const& positions,
+                                                       rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::quantiles()
  *
@@ -18,20 +18,28 @@
 
 #include "reduction_operators.cuh"
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/small_allocation.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/block/block_reduce.cuh>
 #include <cub/device/device_reduce.cuh>
 #include <cub/device/device_segmented_reduce.cuh>
 
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace reduction {
 namespace detail {
@@ -65,7 +73,8 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
 {
   auto const binary_op     = op.get_binary_op();
   auto const initial_value = init.value_or(op.template get_identity<OutputType>());
-  auto dev_result          = rmm::device_scalar<OutputType>{initial_value, stream, mr};
+  auto dev_result          = rmm::device_scalar<OutputType>{
+    initial_value, stream, cudf::detail::small_allocation_resource(sizeof(OutputType), mr)};
 
   // Allocate temporary storage
   rmm::device_buffer d_temp_storage;
@@ -125,7 +134,8 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
 {
   auto const binary_op     = op.get_binary_op();
   auto const initial_value = init.value_or(op.template get_identity<OutputType>());
-  auto dev_result          = rmm::device_scalar<OutputType>{initial_value, stream};
+  auto dev_result          = rmm::device_scalar<OutputType>{
+    initial_value, stream, cudf::detail::small_allocation_resource(sizeof(OutputType))};
 
   // Allocate temporary storage
   rmm::device_buffer d_temp_storage;
@@ -155,6 +165,95 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
   return std::unique_ptr<scalar>(s);
 }
 
+/**
+ * @brief Reduces tiles of 32 rows of a column to one partial result per block.
+ *
+ * The validity of a tile is read with a single bitmask word load for the whole warp, rather than
+ * a load per row as by the pair iterator of the column.
+ */
+template <int block_size,
+          typename ElementType,
+          typename Transformer,
+          typename BinaryOp,
+          typename OutputType>
+__global__ void reduce_tiles_kernel(column_device_view col,
+                                    Transformer transformer,
+                                    BinaryOp binary_op,
+                                    OutputType identity,
+                                    OutputType* block_results)
+{
+  constexpr auto tile_size = static_cast<size_type>(cudf::detail::size_in_bits<bitmask_type>());
+  auto const lane          = static_cast<size_type>(threadIdx.x % tile_size);
+  auto const validity      = cudf::detail::tile_validity_accessor{col, col.nullable()};
+
+  auto result     = identity;
+  auto const step = static_cast<int64_t>(block_size) * gridDim.x;
+  // The loop is uniform across the warp: every lane calls the validity accessor of the tile
+  for (auto tile_begin = static_cast<int64_t>(blockIdx.x) * block_size + threadIdx.x - lane;
+       tile_begin < col.size();
+       tile_begin += step) {
+    auto const i     = static_cast<size_type>(tile_begin) + lane;
+    auto const valid = validity(i);
+    if (i < col.size() and valid) {
+      result = binary_op(result, transformer(col.element<ElementType>(i)));
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<OutputType, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  result = BlockReduce(temp_storage).Reduce(result, binary_op);
+  if (threadIdx.x == 0) { block_results[blockIdx.x] = result; }
+}
+
+/**
+ * @brief Compute the specified simple reduction over the valid elements of a column.
+ *
+ * Equivalent to reducing the null replacing transform of the pair iterator of the column, with
+ * the validities read one bitmask word per 32 rows. The blocks reduce their rows to partial
+ * results, which are then reduced with `init`.
+ *
+ * @param[in] col         the column to reduce
+ * @param[in] transformer the transform applied to the valid elements
+ * @param[in] op          the reduction operator
+ * @param[in] init        Optional initial value of the reduction
+ * @param[in] stream      CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr          Device memory resource used to allocate the returned scalar's device
+ * memory
+ * @returns   Output scalar in device memory
+ *
+ * @tparam ElementType      the type of the elements of the column
+ * @tparam Op               the reduction operator with device binary operator
+ * @tparam Transformer      the element transformer of the reduction operator
+ * @tparam OutputType       the output type of reduction
+ */
+template <typename ElementType,
+          typename Op,
+          typename Transformer,
+          typename OutputType,
+          std::enable_if_t<is_fixed_width<OutputType>() &&
+                           not cudf::is_fixed_point<OutputType>()>* = nullptr>
+std::unique_ptr<scalar> reduce_valid_elements(column_device_view const& col,
+                                              Transformer transformer,
+                                              op::simple_op<Op> op,
+                                              std::optional<OutputType> init,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  constexpr int block_size      = 256;
+  constexpr int rows_per_thread = 8;
+  auto const num_blocks =
+    std::max(1, util::div_rounding_up_safe(col.size(), block_size * rows_per_thread));
+
+  rmm::device_uvector<OutputType> block_results(num_blocks, stream);
+  reduce_tiles_kernel<block_size, ElementType>
+    <<<num_blocks, block_size, 0, stream.value()>>>(col,
+                                                    transformer,
+                                                    op.get_binary_op(),
+                                                    op.template get_identity<OutputType>(),
+                                                    block_results.data());
+  return reduce(block_results.begin(), num_blocks, op, init, stream, mr);
+}
+
 /**
  * @brief compute reduction by the compound operator (reduce and transform)
  *
@@ -192,7 +291,8 @@ std::unique_ptr<scalar> reduce(InputIterator d_in,
   auto const binary_op     = op.get_binary_op();
   auto const initial_value = op.template get_identity<IntermediateType>();
 
-  rmm::device_scalar<IntermediateType> intermediate_result{initial_value, stream};
+  rmm::device_scalar<IntermediateType> intermediate_result{
+    initial_value, stream, cudf::detail::small_allocation_resource(sizeof(IntermediateType))};
 
   // Allocate temporary storage
   rmm::device_buffer d_temp_storage;
@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -338,6 +340,31 @@ std::unique_ptr<scalar> merge_sets(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the fusable aggregations of `aggs` over the input column in a single pass
+ *
+ * MIN, MAX, SUM, SUM_OF_SQUARES, MEAN, VARIANCE and STD of a non-boolean arithmetic column are
+ * fusable when `output_dtypes` asks for the type that their single reduction accumulates in: the
+ * input type for MIN and MAX, `int64_t` or the floating point input type for SUM and
+ * SUM_OF_SQUARES, and FLOAT64 for MEAN, VARIANCE and STD. Nothing is computed when fewer than
+ * two aggregations are fusable.
+ *
+ * The input column must contain at least one valid element.
+ *
+ * @param col input column to reduce
+ * @param aggs aggregations to compute
+ * @param output_dtypes data type of the result of each aggregation
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @return The result of each aggregation, or `nullptr` for the ones that were not computed
+ */
+std::vector<std::unique_ptr<scalar>> fused_reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Compute sum of each segment in input column.
  *
@@ -504,5 +531,112 @@ std::unique_ptr<column> segmented_all(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes sum of squares of each segment in input column.
+ *
+ * If an input segment is empty, the segment result is null.
+ *
+ * @throw cudf::logic_error if input column type is not convertible to `output_dtype`.
+ * @throw cudf::logic_error if `output_dtype` is not an arithmetic type.
+ *
+ * @param col Input column to compute sum of squares
+ * @param offsets Indices to identify segment boundaries
+ * @param output_dtype Data type of return type and typecast elements of input column
+ * @param null_handling If `null_policy::INCLUDE`, all elements in a segment must be valid for the
+ * reduced value to be valid. If `null_policy::EXCLUDE`, the reduced value is valid if any element
+ * in the segment is valid.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sums of squares of segments in type `output_dtype`
+ */
+std::unique_ptr<column> segmented_sum_of_squares(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes mean of each segment in input column.
+ *
+ * If an input segment has no valid elements, the segment result is null.
+ *
+ * @throw cudf::logic_error if input column type is not arithmetic type
+ * @throw cudf::logic_error if `output_dtype` is not floating point type
+ *
+ * @param col Input column to compute mean
+ * @param offsets Indices to identify segment boundaries
+ * @param output_dtype Data type of return type and typecast elements of input column
+ * @param null_handling If `null_policy::INCLUDE`, all elements in a segment must be valid for the
+ * reduced value to be valid. If `null_policy::EXCLUDE`, null elements are skipped.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Means of segments in type `output_dtype`
+ */
+std::unique_ptr<column> segmented_mean(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes variance of each segment in input column.
+ *
+ * If an input segment has no more than `ddof` valid elements, the segment result is null.
+ *
+ * @throw cudf::logic_error if input column type is not arithmetic type
+ * @throw cudf::logic_error if `output_dtype` is not floating point type
+ *
+ * @param col Input column to compute variance
+ * @param offsets Indices to identify segment boundaries
+ * @param output_dtype Data type of return type and typecast elements of input column
+ * @param null_handling If `null_policy::INCLUDE`, all elements in a segment must be valid for the
+ * reduced value to be valid. If `null_policy::EXCLUDE`, null elements are skipped.
+ * @param ddof Delta degrees of freedom. The divisor used is N - ddof, where N represents the
+ * number of valid elements of the segment.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Variances of segments in type `output_dtype`
+ */
+std::unique_ptr<column> segmented_variance(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  size_type ddof,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes standard deviation of each segment in input column.
+ *
+ * If an input segment has no more than `ddof` valid elements, the segment result is null.
+ *
+ * @throw cudf::logic_error if input column type is not arithmetic type
+ * @throw cudf::logic_error if `output_dtype` is not floating point type
+ *
+ * @param col Input column to compute standard deviation
+ * @param offsets Indices to identify segment boundaries
+ * @param output_dtype Data type of return type and typecast elements of input column
+ * @param null_handling If `null_policy::INCLUDE`, all elements in a segment must be valid for the
+ * reduced value to be valid. If `null_policy::EXCLUDE`, null elements are skipped.
+ * @param ddof Delta degrees of freedom. The divisor used is N - ddof, where N represents the
+ * number of valid elements of the segment.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Standard deviations of segments in type `output_dtype`
+ */
+std::unique_ptr<column> segmented_standard_deviation(
+  column_view const& col,
+  device_span<size_type const> offsets,
+  data_type const output_dtype,
+  null_policy null_handling,
+  size_type ddof,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace reduction
 }  // namespace cudf
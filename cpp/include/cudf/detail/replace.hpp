@@ -61,6 +61,28 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::replace_nulls_in_place(mutable_column_view&, replace_policy const&)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+void replace_nulls_in_place(mutable_column_view& input,
+                            replace_policy const& replace_policy,
+                            rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+/**
+ * @copydoc cudf::segmented_replace_nulls(column_view const&, column_view const&,
+ * replace_policy const&, rmm::mr::device_memory_resource*)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_replace_nulls(
+  column_view const& input,
+  column_view const& offsets,
+  replace_policy const& replace_policy,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::replace_nans(column_view const&, column_view const&,
  * rmm::mr::device_memory_resource*)
@@ -40,5 +40,25 @@ struct replace_policy_functor {
   }
 };
 
+/**
+ * @brief Functor used by `replace_nulls(replace_policy)` to fill the null rows of a fixed-width
+ * column in a single scan.
+ *
+ * Binary functor passed to `inclusive_scan` or `inclusive_scan_by_key` over tuples of value and
+ * validity of a row. Returns the current row if it is valid, otherwise the nearest valid row.
+ *
+ * @tparam T Storage type of the column
+ */
+template <typename T>
+struct fill_nulls_functor {
+  using value_valid_pair = thrust::tuple<T, bool>;
+
+  __device__ value_valid_pair operator()(value_valid_pair const& lhs,
+                                         value_valid_pair const& rhs) const
+  {
+    return thrust::get<1>(rhs) ? rhs : lhs;
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -126,10 +126,8 @@ std::unique_ptr<table> scatter(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::boolean_mask_scatter(
-                      table_view const& source, table_view const& target,
- *                    column_view const& boolean_mask,
- *                    rmm::mr::device_memory_resource *mr)
+ * @copydoc cudf::boolean_mask_scatter(table_view const&, table_view const&, column_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -141,11 +139,8 @@ std::unique_ptr<table> boolean_mask_scatter(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::boolean_mask_scatter(
- *                    std::vector<std::reference_wrapper<scalar>> const& source,
- *                    table_view const& target,
- *                    column_view const& boolean_mask,
- *                    rmm::mr::device_memory_resource *mr)
+ * @copydoc cudf::boolean_mask_scatter(std::vector<std::reference_wrapper<scalar const>> const&,
+ * table_view const&, column_view const&, rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
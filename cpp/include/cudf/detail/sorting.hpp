@@ -143,5 +143,61 @@ std::unique_ptr<table> sort(
   rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns whether the rows of a table are known to be sorted from the cached properties of
+ * its columns, without reading their elements.
+ *
+ * Only a single column can be known to sort the rows: a sorted first column does not order the
+ * rows that compare equal on it.
+ *
+ * @param input The table to check
+ * @param column_order The requested order of each column, ascending if empty
+ * @param null_precedence Where the nulls of each column must be, first if empty
+ * @return `true` if the rows are known to be sorted, `false` if unknown
+ */
+bool is_known_sorted(table_view const& input,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence);
+
+/**
+ * @copydoc cudf::top_k_order
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::top_k
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::segmented_top_k_order
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> segmented_top_k_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace cudf
@@ -27,8 +27,8 @@
 namespace cudf {
 namespace detail {
 /**
- * @copydoc cudf::drop_nulls(table_view const&, std::vector<size_type> const&,
- *                           cudf::size_type, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::drop_nulls(table_view const&, std::vector<size_type> const&, cudf::size_type,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -40,8 +40,8 @@ std::unique_ptr<table> drop_nulls(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::drop_nans(table_view const&, std::vector<size_type> const&,
- *                          cudf::size_type, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::drop_nans(table_view const&, std::vector<size_type> const&, cudf::size_type,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -63,6 +63,17 @@ std::unique_ptr<table> apply_boolean_mask(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::filter
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::unique
  *
@@ -142,7 +153,48 @@ rmm::device_uvector<size_type> get_distinct_indices(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::unique_count(column_view const&, null_policy, nan_policy)
+ * @brief Find the index of one row of every group of equal rows and the size of that group.
+ *
+ * @param input The input table
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ * @return Pair of device_uvectors with the representative row indices and the group sizes
+ */
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>>
+get_distinct_indices_and_counts(
+  table_view const& input,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Assigns every row the code of its group of equal rows, the groups being numbered in the
+ * order of their first rows.
+ *
+ * The rows are inserted into a hash table, and every row then finds the row of its group that
+ * was inserted. No sorting or searching of the rows is involved.
+ *
+ * @param input The input table
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ * @return Pair of device_uvectors with the index of the first row of every group, in increasing
+ * order, and the code of every row, i.e. the position of the first row of its group in the first
+ * vector
+ */
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> get_distinct_row_codes(
+  table_view const& input,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::unique_count(column_view const&, null_policy, nan_policy, rmm::cuda_stream_view)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -152,7 +204,7 @@ cudf::size_type unique_count(column_view const& input,
                              rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
- * @copydoc cudf::unique_count(table_view const&, null_equality)
+ * @copydoc cudf::unique_count(table_view const&, null_equality, rmm::cuda_stream_view)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -161,7 +213,7 @@ cudf::size_type unique_count(table_view const& input,
                              rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
- * @copydoc cudf::distinct_count(column_view const&, null_policy, nan_policy)
+ * @copydoc cudf::distinct_count(column_view const&, null_policy, nan_policy, rmm::cuda_stream_view)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -171,7 +223,7 @@ cudf::size_type distinct_count(column_view const& input,
                                rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
- * @copydoc cudf::distinct_count(table_view const&, null_equality)
+ * @copydoc cudf::distinct_count(table_view const&, null_equality, rmm::cuda_stream_view)
  *
  * @param[in] stream CUDA stream used for device memory operations and kernel launches.
  */
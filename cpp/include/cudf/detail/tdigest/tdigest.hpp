@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
@@ -328,6 +329,52 @@ std::unique_ptr<scalar> reduce_merge_tdigest(column_view const& input,
                                              rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @copydoc cudf::update_tdigest
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> update_tdigest(
+  cudf::tdigest::tdigest_column_view const& input,
+  column_view const& values,
+  int max_centroids,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Adds a grouped set of numeric input values to the tdigest of each group.
+ *
+ * Row `i` of the result merges row `i` of `input` with the tdigest of the values of group `i`.
+ * Only the new values need to be grouped and sorted, so a stream of batches can be summarized
+ * in memory bounded by the number of groups and `max_centroids` instead of the number of values
+ * seen so far.
+ *
+ * @throws cudf::logic_error if `input` is not a valid tdigest column.
+ * @throws cudf::logic_error if `input` does not have `num_groups` rows.
+ *
+ * @param input tdigest column with one tdigest per group, summarizing the previous values.
+ * @param values Grouped (and sorted) values to add.
+ * @param group_offsets Offsets of groups' starting points within @p values.
+ * @param group_labels 0-based ID of group that the corresponding value belongs to
+ * @param group_valid_counts Per-group counts of valid elements.
+ * @param num_groups Number of groups.
+ * @param max_centroids Parameter controlling the level of compression of the tdigest. Higher
+ * values result in a larger, more precise tdigest.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns tdigest column, with 1 tdigest per row
+ */
+std::unique_ptr<column> group_update_tdigest(column_view const& input,
+                                             column_view const& values,
+                                             cudf::device_span<size_type const> group_offsets,
+                                             cudf::device_span<size_type const> group_labels,
+                                             cudf::device_span<size_type const> group_valid_counts,
+                                             size_type num_groups,
+                                             int max_centroids,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr);
+
 }  // namespace tdigest
 }  // namespace detail
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/ast/expressions.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -37,6 +38,31 @@ std::unique_ptr<column> transform(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, data_type, bool,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> transform(
+  table_view const& input,
+  std::string const& unary_udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::transform(table_view const&, std::string const&, mutable_table_view, bool)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+void transform(table_view const& input,
+               std::string const& unary_udf,
+               mutable_table_view output,
+               bool is_ptx,
+               rmm::cuda_stream_view stream = cudf::default_stream_value);
+
 /**
  * @copydoc cudf::compute_column
  *
@@ -48,6 +74,17 @@ std::unique_ptr<column> compute_column(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::jit_compute_column
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> jit_compute_column(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -69,7 +106,7 @@ std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> bools_to_mask(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
- * @copydoc cudf::encode
+ * @copydoc cudf::encode(cudf::table_view const&, rmm::mr::device_memory_resource*)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
@@ -78,6 +115,18 @@ std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::encode(cudf::table_view const&, encode_key_order,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
+  cudf::table_view const& input,
+  encode_key_order key_order,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @copydoc cudf::one_hot_encode
  *
@@ -111,5 +160,23 @@ std::unique_ptr<column> row_bit_count(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::estimate_size
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::size_t estimate_size(table_view const& t,
+                          rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+/**
+ * @copydoc cudf::estimate_split_sizes(table_view const&, std::vector<size_type> const&)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::size_t> estimate_split_sizes(
+  table_view const& t,
+  host_span<size_type const> splits,
+  rmm::cuda_stream_view stream = cudf::default_stream_value);
+
 }  // namespace detail
 }  // namespace cudf
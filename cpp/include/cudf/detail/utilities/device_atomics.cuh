@@ -405,6 +405,30 @@ struct typesAtomicCASImpl<T, 8> {
   }
 };
 
+/**
+ * @brief Adds `update_value` to the 128-bit integer at `address` with two 64-bit atomic additions.
+ *
+ * CUDA has no 128-bit atomic addition. The low words are added first, and the carry out of their
+ * sum, known from the old low word that the addition returns, is added to the high word along
+ * with the high word of `update_value`. A concurrent read may thus see the low word of an addition
+ * but not yet its high word. Once all concurrent additions are done, though, the 128-bit integer
+ * holds their exact sum, modulo 2^128.
+ *
+ * @param address The address of the 128-bit integer in global or shared memory
+ * @param update_value The value to add
+ */
+__forceinline__ __device__ void atomic_add_two_words(__int128_t* address, __int128_t update_value)
+{
+  using T_word = unsigned long long int;
+  auto const words = reinterpret_cast<T_word*>(address);
+  auto const low   = static_cast<T_word>(update_value);
+  auto const high  = static_cast<T_word>(static_cast<__uint128_t>(update_value) >> 64);
+
+  auto const old_low = atomicAdd(words, low);
+  auto const carry   = static_cast<T_word>(old_low + low < old_low);
+  if (high + carry != 0) { atomicAdd(words + 1, high + carry); }
+}
+
 }  // namespace detail
 
 /**
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns the `Resource` of the current device, creating it on first use.
+ *
+ * Each device gets its own `Resource`, constructed from a `cuda_memory_resource` upstream
+ * followed by `args`. The resources are never destroyed, so memory held by objects that outlive
+ * `main` is never returned to a destroyed resource.
+ *
+ * @tparam Resource Type of the memory resource, taking its upstream as first constructor argument
+ * @param args Other arguments of the constructor, only used when the resource is created
+ *
+ * @return The resource of the current device
+ */
+template <typename Resource, typename... Args>
+Resource* get_or_create_device_resource(Args const&... args)
+{
+  static std::mutex resources_mutex;
+  static std::map<int, Resource*> resources;
+  static rmm::mr::cuda_memory_resource cuda_mr;
+
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+
+  std::lock_guard<std::mutex> lock(resources_mutex);
+  auto resource = resources.find(device);
+  if (resource == resources.end()) {
+    resource = resources.emplace(device, new Resource(&cuda_mr, args...)).first;
+  }
+  return resource->second;
+}
+
+}  // namespace detail
+}  // namespace cudf
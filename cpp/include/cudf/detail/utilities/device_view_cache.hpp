@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Returns whether the device views created on `stream` are cached.
+ *
+ * Only the device views created on the default stream are cached: the memory of a cached view is
+ * freed on the stream it was created on when the view is evicted, so the stream must outlive the
+ * cache. The cache holds up to `LIBCUDF_DEVICE_VIEW_CACHE_SIZE` views of each kind (256 by
+ * default); setting it to 0 disables the cache.
+ *
+ * @param stream Stream the device views are created on
+ * @return true if the views are looked up in and added to the cache
+ */
+bool is_device_view_cache_enabled(rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the maximum number of device views of each kind held by the cache.
+ *
+ * @return The capacity of the cache
+ */
+std::size_t device_view_cache_capacity();
+
+/**
+ * @brief Returns the resource allocating the device memory of cached device views.
+ *
+ * The resource is a pool of the current device that is never destroyed, so cached views may
+ * outlive the memory resources set by the application.
+ *
+ * @return The resource to allocate cached device views from
+ */
+rmm::mr::device_memory_resource* device_view_cache_resource();
+
+/**
+ * @brief Returns a key identifying the device view of a column and its descendants.
+ *
+ * The key covers the current device and every member of the device views: column views with the
+ * same key produce identical device views, whichever columns own their data.
+ *
+ * @param source Column view the device view is created from
+ * @return The key of the device view
+ */
+std::string device_view_cache_key(column_view const& source);
+
+/**
+ * @copydoc device_view_cache_key(column_view const&)
+ */
+std::string device_view_cache_key(table_view const& source);
+
+/**
+ * @brief Least recently used cache of device views, with the device memory holding them.
+ *
+ * Creating a device view of a nested column or of a table allocates device memory and copies the
+ * views of the descendants to it, synchronizing the stream. Operations called repeatedly on the
+ * same columns, as in a pipeline of operations on small batches, reuse the views from the cache
+ * instead.
+ *
+ * @tparam Value Host object referencing the device memory of a view
+ */
+template <typename Value>
+class device_view_cache {
+ public:
+  /// Cached host object, with the device memory it references
+  using entry = std::pair<Value, std::shared_ptr<rmm::device_buffer>>;
+
+  /**
+   * @brief Returns the cached view of a key, if any, marking it as the most recently used.
+   *
+   * @param key Key of the view
+   * @return The cached view, or `std::nullopt`
+   */
+  std::optional<entry> find(std::string const& key)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto const it = index_.find(key);
+    if (it == index_.end()) { return std::nullopt; }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  /**
+   * @brief Adds a view to the cache, evicting the least recently used views beyond the capacity.
+   *
+   * The device memory of an evicted view is freed once no device view references it.
+   *
+   * @param key Key of the view
+   * @param value The view to cache
+   */
+  void insert(std::string const& key, entry const& value)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (index_.count(key) > 0) { return; }
+    entries_.emplace_front(key, value);
+    index_.emplace(key, entries_.begin());
+    while (entries_.size() > device_view_cache_capacity()) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+  /**
+   * @brief Returns the cache of this kind of views.
+   *
+   * The cache is never destroyed, so that no device memory is freed after the CUDA runtime is
+   * torn down at exit.
+   *
+   * @return The cache
+   */
+  static device_view_cache& instance()
+  {
+    static auto* const cache = new device_view_cache{};
+    return *cache;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::list<std::pair<std::string, entry>> entries_;  // most recently used first
+  std::unordered_map<std::string, typename decltype(entries_)::iterator> index_;
+};
+
+}  // namespace detail
+}  // namespace cudf
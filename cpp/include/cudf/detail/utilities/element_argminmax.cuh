@@ -30,11 +30,12 @@ namespace detail {
  * @brief Binary `argmin`/`argmax` operator
  *
  * @tparam T Type of the underlying column. Must support '<' operator.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
  */
-template <typename T>
+template <typename T, typename Nullate = nullate::DYNAMIC>
 struct element_argminmax_fn {
   column_device_view const d_col;
-  bool const has_nulls;
+  Nullate const has_nulls;
   bool const arg_min;
 
   __device__ inline auto operator()(size_type const& lhs_idx, size_type const& rhs_idx) const
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/utilities/assert.cuh>
@@ -109,18 +110,25 @@ struct hash_circular_buffer {
   __device__ inline void put(uint8_t const* in, int size)
   {
     int copy_start = 0;
-    while (size >= available_space) {
-      // The buffer will be filled by this chunk of data. Copy a chunk of the
-      // data to fill the buffer and trigger a hash step.
-      memcpy(cur, in + copy_start, available_space);
+    if (available_space < capacity && size >= available_space) {
+      // Complete the partially filled buffer and trigger a hash step.
+      memcpy(cur, in, available_space);
       hash_step(storage);
       size -= available_space;
       copy_start += available_space;
       cur             = storage;
       available_space = capacity;
     }
+    while (size >= capacity) {
+      // The buffer is empty so whole chunks are hashed directly from the input without
+      // being copied. The hash step reads the words of the chunk byte-wise so the input
+      // does not need to be aligned.
+      hash_step(*reinterpret_cast<uint8_t const(*)[capacity]>(in + copy_start));
+      size -= capacity;
+      copy_start += capacity;
+    }
     // The buffer will not be filled by the remaining data. That is, `size >= 0
-    // && size < capacity`. We copy the remaining data into the buffer but do
+    // && size < available_space`. We copy the remaining data into the buffer but do
     // not trigger a hash step.
     memcpy(cur, in + copy_start, size);
     cur += size;
@@ -346,6 +354,177 @@ hash_value_type __device__ inline MurmurHash3_32<cudf::struct_view>::operator()(
   CUDF_UNREACHABLE("Direct hashing of struct_view is not supported");
 }
 
+/**
+ * @brief 64-bit xxHash (XXH64) of the bytes of a key.
+ *
+ * `compute_bytes` is usable from both host and device code, e.g. to build Bloom filters on the
+ * device and probe them from the host. Reference implementation: https://github.com/Cyan4973/xxHash
+ *
+ * Like `MurmurHash3_32`, keys are normalized before hashing so equal floating point values
+ * (e.g. -0.0 and 0.0 or any NaNs) produce the same hash value.
+ */
+template <typename Key>
+struct XXHash_64 {
+  using result_type = uint64_t;
+
+  constexpr XXHash_64() = default;
+  constexpr XXHash_64(uint64_t seed) : m_seed(seed) {}
+
+  __device__ inline result_type operator()(Key const& key) const
+  {
+    return compute(detail::normalize_nans_and_zeros(key));
+  }
+
+  template <typename T>
+  __device__ inline result_type compute(T const& key) const
+  {
+    return compute_bytes(reinterpret_cast<std::byte const*>(&key), sizeof(T));
+  }
+
+  CUDF_HOST_DEVICE result_type compute_bytes(std::byte const* data, std::size_t const len) const
+  {
+    std::size_t offset = 0;
+    uint64_t h;
+    if (len >= 32) {
+      uint64_t v1 = m_seed + prime1 + prime2;
+      uint64_t v2 = m_seed + prime2;
+      uint64_t v3 = m_seed;
+      uint64_t v4 = m_seed - prime1;
+      for (; offset + 32 <= len; offset += 32) {
+        v1 = round(v1, getblock64(data, offset));
+        v2 = round(v2, getblock64(data, offset + 8));
+        v3 = round(v3, getblock64(data, offset + 16));
+        v4 = round(v4, getblock64(data, offset + 24));
+      }
+      h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+      h = merge_round(h, v1);
+      h = merge_round(h, v2);
+      h = merge_round(h, v3);
+      h = merge_round(h, v4);
+    } else {
+      h = m_seed + prime5;
+    }
+    h += len;
+
+    // Process the remaining bytes
+    for (; offset + 8 <= len; offset += 8) {
+      h ^= round(0, getblock64(data, offset));
+      h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (offset + 4 <= len) {
+      h ^= static_cast<uint64_t>(getblock32(data, offset)) * prime1;
+      h = rotl(h, 23) * prime2 + prime3;
+      offset += 4;
+    }
+    for (; offset < len; offset++) {
+      h ^= std::to_integer<uint8_t>(data[offset]) * prime5;
+      h = rotl(h, 11) * prime1;
+    }
+
+    // Finalize hash
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+ private:
+  CUDF_HOST_DEVICE static inline uint64_t rotl(uint64_t x, uint32_t r)
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  CUDF_HOST_DEVICE static inline uint64_t round(uint64_t acc, uint64_t input)
+  {
+    return rotl(acc + input * prime2, 31) * prime1;
+  }
+
+  CUDF_HOST_DEVICE static inline uint64_t merge_round(uint64_t acc, uint64_t val)
+  {
+    return (acc ^ round(0, val)) * prime1 + prime4;
+  }
+
+  // Blocks at aligned addresses are read with a single load. Otherwise, the blocks are read
+  // as individual bytes for safe unaligned access (very likely for string types).
+  CUDF_HOST_DEVICE static inline uint32_t getblock32(std::byte const* data, std::size_t offset)
+  {
+    auto const ptr = data + offset;
+    if (reinterpret_cast<std::uintptr_t>(ptr) % sizeof(uint32_t) == 0) {
+      return *reinterpret_cast<uint32_t const*>(ptr);
+    }
+    auto const block = reinterpret_cast<uint8_t const*>(ptr);
+    return block[0] | (block[1] << 8) | (block[2] << 16) | (static_cast<uint32_t>(block[3]) << 24);
+  }
+
+  CUDF_HOST_DEVICE static inline uint64_t getblock64(std::byte const* data, std::size_t offset)
+  {
+    auto const ptr = data + offset;
+    if (reinterpret_cast<std::uintptr_t>(ptr) % sizeof(uint64_t) == 0) {
+      return *reinterpret_cast<uint64_t const*>(ptr);
+    }
+    return getblock32(data, offset) | (static_cast<uint64_t>(getblock32(data, offset + 4)) << 32);
+  }
+
+  uint64_t m_seed{0};
+  static constexpr uint64_t prime1 = 0x9e3779b185ebca87ull;
+  static constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr uint64_t prime3 = 0x165667b19e3779f9ull;
+  static constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ull;
+  static constexpr uint64_t prime5 = 0x27d4eb2f165667c5ull;
+};
+
+template <>
+uint64_t __device__ inline XXHash_64<bool>::operator()(bool const& key) const
+{
+  return compute(static_cast<uint8_t>(key));
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<cudf::string_view>::operator()(
+  cudf::string_view const& key) const
+{
+  auto const data = reinterpret_cast<std::byte const*>(key.data());
+  auto const len  = key.size_bytes();
+  return compute_bytes(data, len);
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<numeric::decimal32>::operator()(
+  numeric::decimal32 const& key) const
+{
+  return compute(key.value());
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<numeric::decimal64>::operator()(
+  numeric::decimal64 const& key) const
+{
+  return compute(key.value());
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<numeric::decimal128>::operator()(
+  numeric::decimal128 const& key) const
+{
+  return compute(key.value());
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<cudf::list_view>::operator()(
+  cudf::list_view const& key) const
+{
+  CUDF_UNREACHABLE("List column hashing is not supported");
+}
+
+template <>
+uint64_t __device__ inline XXHash_64<cudf::struct_view>::operator()(
+  cudf::struct_view const& key) const
+{
+  CUDF_UNREACHABLE("Direct hashing of struct_view is not supported");
+}
+
 /**
  * @brief  This hash function simply returns the value that is asked to be hash
  * reinterpreted as the result_type of the functor.
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/// Minimum number of work items, e.g. rows, of a launch for it to be used to tune its kernel
+constexpr std::size_t kernel_tuning_min_work_items = 1 << 20;
+
+/**
+ * @brief Launches a tunable kernel with the block size tuned for the current device.
+ *
+ * The block size tuned for `kernel_name` on the current device is looked up in memory and, on
+ * first use, in the tuning file of the JIT kernel cache directory. If there is none, `launch` is
+ * called with the first of `block_sizes`, unless tuning is enabled and the launch has at least
+ * `kernel_tuning_min_work_items` work items. In that case every candidate block size is timed on
+ * `stream` and the fastest one is kept and appended to the tuning file.
+ *
+ * Since tuning calls `launch` several times with each candidate, it must produce the same output
+ * every time it is called, e.g. by zeroing any output it accumulates into with atomics before
+ * launching the kernel. Tuning synchronizes `stream`.
+ *
+ * @see cudf::set_kernel_tuning
+ *
+ * @throws cudf::logic_error if `block_sizes` is empty
+ *
+ * @param kernel_name Name identifying the kernel and how it is launched
+ * @param num_work_items Number of work items of this launch
+ * @param block_sizes Block sizes the kernel can be launched with, the first being its default
+ * @param launch Launches the kernel on `stream` with the block size it is passed
+ * @param stream CUDA stream used for the kernel launches
+ * @return The block size the kernel was launched with
+ */
+int launch_tuned_kernel(std::string const& kernel_name,
+                        std::size_t num_work_items,
+                        std::vector<int> const& block_sizes,
+                        std::function<void(int)> const& launch,
+                        rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cstddef>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief The largest allocation served by `small_allocation_resource`.
+ */
+constexpr std::size_t max_small_allocation_size = 256;
+
+/**
+ * @brief Returns the resource to allocate `bytes` bytes with in place of `mr`.
+ *
+ * Allocations of at most `max_small_allocation_size` bytes requested from the current device
+ * resource are served from fixed-size blocks that libcudf keeps in per-stream free lists for the
+ * current device, so small results such as scalars and counters do not each go through the
+ * memory resource. The blocks are carved from slabs that libcudf allocates with `cudaMalloc` and
+ * never releases. Any other allocation, including one from a resource the caller chose
+ * explicitly, keeps using `mr`.
+ *
+ * The returned resource must be used for both the allocation and the deallocation, which
+ * `rmm::device_buffer` and the containers built on it do.
+ *
+ * @param bytes Size of the allocation
+ * @param mr Resource the allocation was requested from
+ * @return The resource to allocate from
+ */
+rmm::mr::device_memory_resource* small_allocation_resource(
+  std::size_t bytes, rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace detail
+}  // namespace cudf
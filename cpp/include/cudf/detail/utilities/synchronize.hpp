@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Blocks the calling host thread until all work on `stream` is complete.
+ *
+ * libcudf synchronizes a stream through this function instead of `stream.synchronize()` so that
+ * the wait is recorded as a host sync point while recording is on.
+ *
+ * @see cudf::start_recording_sync_points
+ *
+ * @param stream CUDA stream to synchronize
+ */
+void synchronize_stream(rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
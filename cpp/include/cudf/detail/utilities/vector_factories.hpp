@@ -21,6 +21,7 @@
  * @file vector_factories.hpp
  */
 
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -77,7 +78,7 @@ rmm::device_uvector<T> make_zeroed_device_uvector_sync(
 {
   rmm::device_uvector<T> ret(size, stream, mr);
   CUDF_CUDA_TRY(cudaMemsetAsync(ret.data(), 0, size * sizeof(T), stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return ret;
 }
 
@@ -205,7 +206,7 @@ rmm::device_uvector<T> make_device_uvector_sync(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   auto ret = make_device_uvector_async(source_data, stream, mr);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return ret;
 }
 
@@ -253,7 +254,7 @@ rmm::device_uvector<T> make_device_uvector_sync(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   auto ret = make_device_uvector_async(source_data, stream, mr);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return ret;
 }
 
@@ -346,7 +347,7 @@ template <typename T>
 std::vector<T> make_std_vector_sync(device_span<T const> v, rmm::cuda_stream_view stream)
 {
   auto result = make_std_vector_async(v, stream);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return result;
 }
 
@@ -427,7 +428,7 @@ thrust::host_vector<T> make_host_vector_sync(
   device_span<T const> v, rmm::cuda_stream_view stream = cudf::default_stream_value)
 {
   auto result = make_host_vector_async(v, stream);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return result;
 }
 
@@ -18,6 +18,7 @@
 
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/small_allocation.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -101,7 +102,8 @@ std::pair<rmm::device_buffer, size_type> valid_if(
 
   size_type null_count{0};
   if (size > 0) {
-    rmm::device_scalar<size_type> valid_count{0, stream};
+    rmm::device_scalar<size_type> valid_count{
+      0, stream, small_allocation_resource(sizeof(size_type))};
 
     constexpr size_type block_size{256};
     grid_1d grid{size, block_size};
@@ -84,6 +84,34 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a dictionary column with new keys from indices into the old keys.
+ *
+ * Each row with old key index `i` gets the new key index `old_to_new[i]`. Rows whose
+ * `old_to_new` value is negative become null, as do the null rows of `indices`. The gather through
+ * `old_to_new` and the cast to the indices type for the new keys are fused in one pass over the
+ * rows.
+ *
+ * ```
+ * Example:
+ * indices = [3, 0, 2, 1, 3], old_to_new = [1, -1, 2, 0]
+ * result indices = [0, 1, 2, x, 0], valids = [1, 1, 1, 0, 1]
+ * ```
+ *
+ * @param indices Indices of the rows into the old keys, with their offset, size and null mask
+ * @param old_to_new New index of each old key, or a negative value for a removed key
+ * @param keys The keys of the new dictionary column
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New dictionary column.
+ */
+std::unique_ptr<column> remap_indices(
+  column_view const& indices,
+  device_span<size_type const> old_to_new,
+  std::unique_ptr<column>&& keys,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create new dictionaries that have keys merged from dictionary columns
  * found in the provided tables.
@@ -98,6 +126,8 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
  *
  * Any null rows are left unchanged.
  *
+ * Dictionary columns that already share the same keys column are not rebuilt.
+ *
  * @param input Vector of cudf::table_views that include dictionary columns to be matched.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource used to allocate the returned column's device memory.
@@ -108,6 +138,35 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns true if all the dictionary columns have the same keys column.
+ *
+ * This only checks that the keys are the same view of the same device memory
+ * and not whether different keys columns contain the same values.
+ *
+ * @param input Dictionary columns to check.
+ * @return True if the keys of every column are identical.
+ */
+bool have_same_keys(cudf::host_span<dictionary_column_view const> input);
+
+/**
+ * @brief Replace each dictionary column in `input` with its indices.
+ *
+ * The keys of a dictionary column are unique and sorted, so comparing the indices of two rows
+ * is equivalent to comparing their keys, for both equality and ordering. Operations that only
+ * compare or hash rows can therefore run on the fixed-width indices instead of going through
+ * the keys for every element.
+ *
+ * The indices of dictionary columns in different tables are only comparable if the columns
+ * share their keys, for example after calling `match_dictionaries`.
+ *
+ * The returned indices include the offset, size and null mask of the dictionary column.
+ *
+ * @param input Table with any number of dictionary columns.
+ * @return Table view with each dictionary column replaced by its indices.
+ */
+table_view replace_dictionaries_with_indices(table_view const& input);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace dictionary {
+
+// forward declaration
+namespace detail {
+class dictionary_builder;
+}  // namespace detail
+
+/**
+ * @addtogroup dictionary_update
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Builds a dictionary incrementally from batches of rows, such as in streaming ingestion.
+ *
+ * The builder keeps its keys in a device hash map. Each batch added is looked up in the map and
+ * only the keys not seen before are inserted, appended after the existing keys in the order they
+ * first appear. Adding a batch therefore costs in proportion to the batch and its new keys rather
+ * than to all the rows encoded so far, unlike calling `cudf::dictionary::add_keys` per batch.
+ *
+ * Since keys are only ever appended, the indices returned for a batch remain valid as more batches
+ * are added. The keys are sorted, as a dictionary column requires, only when one is made with
+ * `make_dictionary`.
+ *
+ * @code{.pseudo}
+ * b = dictionary_builder(STRING)
+ * i1 = b.add(["c", "a", null, "c"])   // i1 is [0, 1, x, 0], b.keys() is ["c", "a"]
+ * i2 = b.add(["b", "a"])              // i2 is [2, 1], b.keys() is ["c", "a", "b"]
+ * d2 = b.make_dictionary(i2)          // d2 is {keys=["a", "b", "c"], indices=[1, 0]}
+ * @endcode
+ */
+class dictionary_builder {
+ public:
+  using impl_type = detail::dictionary_builder;  ///< Implementation type
+
+  dictionary_builder() = delete;
+  ~dictionary_builder();
+  dictionary_builder(dictionary_builder const&) = delete;
+  dictionary_builder(dictionary_builder&&)      = delete;
+  dictionary_builder& operator=(dictionary_builder const&) = delete;
+  dictionary_builder& operator=(dictionary_builder&&) = delete;
+
+  /**
+   * @brief Construct a builder with no keys.
+   *
+   * @throws cudf::logic_error if `keys_type` is a dictionary type
+   *
+   * @param keys_type The type of the keys
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  explicit dictionary_builder(data_type keys_type,
+                              rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Adds the keys of the rows of `input` and returns the index of the key of every row.
+   *
+   * Keys not already in the dictionary are appended after the existing keys in the order in which
+   * they first appear in `input`. Null rows add no key and are null in the returned indices.
+   *
+   * @throws cudf::logic_error if the type of `input` is not the type of the keys
+   *
+   * @param input The rows to encode
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return UINT32 column of the index in `keys()` of the key of every row of `input`
+   */
+  std::unique_ptr<column> add(
+    column_view const& input,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the keys added so far, in the order they were added.
+   *
+   * The view is invalidated by the next call to `add`.
+   *
+   * @return The unsorted keys
+   */
+  [[nodiscard]] column_view keys() const;
+
+  /**
+   * @brief Creates a dictionary column from indices returned by `add`.
+   *
+   * The keys of the dictionary column are a sorted copy of the keys added so far. The indices
+   * are remapped to the sorted keys in a single pass. The sorted order of the keys is kept until
+   * more keys are added, so making dictionary columns of many batches sorts the keys only once.
+   *
+   * @throws cudf::logic_error if `indices` is not a UINT32 column
+   *
+   * @param indices Indices returned by any previous call to `add`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return Dictionary column of the rows of `indices`
+   */
+  std::unique_ptr<column> make_dictionary(
+    column_view const& indices,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+ private:
+  std::unique_ptr<impl_type> _impl;
+};
+
+/** @} */  // end of group
+}  // namespace dictionary
+}  // namespace cudf
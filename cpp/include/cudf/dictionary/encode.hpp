@@ -18,9 +18,14 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <memory>
+#include <utility>
+
 namespace cudf {
 namespace dictionary {
 /**
@@ -79,6 +84,64 @@ std::unique_ptr<column> decode(
   dictionary_column_view const& dictionary_column,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replace each strings column of a keys table with dense integer codes.
+ *
+ * Each strings column is replaced by an INT32 column of codes where equal strings have equal
+ * codes. The codes are the positions of the strings in the sorted set of unique strings of the
+ * column. Hashing and comparing the codes is much cheaper than hashing and comparing the bytes
+ * of the strings when the keys are used by several operations like groupby or joins.
+ *
+ * Columns of any other type are copied unchanged.
+ * The null mask and null count of each column are copied to the output column.
+ *
+ * @code{.pseudo}
+ * keys = [["b","a","b",null], [1,2,3,4]]
+ * e = encode_keys(keys)
+ * e is now [[1,0,1,null], [1,2,3,4]]
+ * @endcode
+ *
+ * @param keys The key columns to encode.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return The encoded keys.
+ */
+std::unique_ptr<table> encode_keys(
+  table_view const& keys,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Replace each strings column of two keys tables with dense integer codes computed from
+ * a dictionary shared by both tables.
+ *
+ * This is intended for join keys: a string in `left` and a string in `right` have the same
+ * code if and only if they are equal, so joining the encoded tables produces the same rows as
+ * joining the original tables.
+ *
+ * Columns of any other type are copied unchanged.
+ * The null mask and null count of each column are copied to the output column.
+ *
+ * @code{.pseudo}
+ * left  = [["b","a","d"]]
+ * right = [["d","c"]]
+ * l, r = encode_keys(left, right)
+ * l is now [[1,0,3]]
+ * r is now [[3,2]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `left` and `right` have a different number of columns.
+ * @throw cudf::logic_error if a strings column of one table is paired with a column of
+ *        another type in the other table.
+ *
+ * @param left The left key columns to encode.
+ * @param right The right key columns to encode.
+ * @param mr Device memory resource used to allocate the returned tables' device memory.
+ * @return The encoded left and right keys.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> encode_keys(
+  table_view const& left,
+  table_view const& right,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace dictionary
 }  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -106,7 +107,8 @@ class groupby {
    * If the `keys` are already sorted, better performance may be achieved by
    * passing `keys_are_sorted == true` and indicating the  ascending/descending
    * order of each column and null order in  `column_order` and
-   * `null_precedence`, respectively.
+   * `null_precedence`, respectively. Keys of a single column whose `properties()` show it is
+   * sorted in ascending order with the nulls last are treated as sorted without being asked.
    *
    * @note This object does *not* maintain the lifetime of `keys`. It is the
    * user's responsibility to ensure the `groupby` object does not outlive the
@@ -129,6 +131,46 @@ class groupby {
                    std::vector<order> const& column_order         = {},
                    std::vector<null_order> const& null_precedence = {});
 
+  /**
+   * @brief Construct a groupby object with the specified `keys` grouped according to a plan
+   * exported by `export_plan()`
+   *
+   * The key sort order and group labels are taken from `plan` rather than computed, so grouping
+   * the same keys again, e.g. in a later stage of a pipeline, does not sort them again. All
+   * aggregations and scans of this object use the sort-based implementation.
+   *
+   * @note This object does *not* maintain the lifetime of `keys`. It is the
+   * user's responsibility to ensure the `groupby` object does not outlive the
+   * data viewed by the `keys` `table_view`.
+   *
+   * @throws cudf::logic_error if `plan` was not exported from a `groupby` on keys with the same
+   * number of rows and null rows as `keys`
+   *
+   * @param keys Table whose rows act as the groupby keys. Must be the keys the plan was
+   * exported for.
+   * @param plan The packed grouping plan of `keys`
+   * @param null_handling Indicates whether rows in `keys` that contain
+   * NULL values should be included. Must match the policy of the exporting `groupby`.
+   */
+  groupby(table_view const& keys,
+          packed_columns const& plan,
+          null_policy null_handling = null_policy::EXCLUDE);
+
+  /**
+   * @brief Exports the sort-based grouping of the keys as a plan that can be given to another
+   * `groupby` on the same keys
+   *
+   * The plan holds the sort order of the keys and the group label of every sorted row. It is
+   * computed on first use, unless an earlier sort-based aggregation or scan of this object already
+   * computed it. The result has the format of `cudf::pack`, so it can be serialized, shipped and
+   * cached like any packed table.
+   *
+   * @param mr Device memory resource used to allocate the returned device buffer
+   * @return The packed grouping plan
+   */
+  [[nodiscard]] packed_columns export_plan(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
   /**
    * @brief Performs grouped aggregations on the specified values.
    *
@@ -408,6 +450,103 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::mr::device_memory_resource* mr);
 };
+
+/**
+ * @brief Request for groupby aggregation(s) to accumulate over a column of every batch given to
+ * a `groupby_accumulator`.
+ */
+struct accumulation_request {
+  size_type values_index;  ///< Index of the column to aggregate in every batch
+  std::vector<std::unique_ptr<groupby_aggregation>> aggregations;  ///< Desired aggregations
+};
+
+/**
+ * @brief Accumulates groupby aggregations over a sequence of batches.
+ *
+ * Instead of concatenating all the batches and aggregating them at once, the accumulator keeps
+ * the unique keys seen so far together with the partial state of every aggregation for each of
+ * them. Every batch given to `update` is aggregated on its own and then merged into that state,
+ * so the memory held between batches is proportional to the number of groups rather than the
+ * number of rows.
+ *
+ * Supported aggregations are SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, MEAN, M2,
+ * COLLECT_LIST and COLLECT_SET.
+ *
+ * @code{.pseudo}
+ * keys   = {1, 2}, {2, 3}  (column 0 of the two batches)
+ * values = {5, 6}, {7, 8}  (column 1 of the two batches)
+ * requests = {{1, {SUM}}}
+ *
+ * groupby_accumulator acc({0}, requests);
+ * acc.update(batch_0);
+ * acc.update(batch_1);
+ * acc.finalize() = {{1, 2, 3}, {{5, 13, 8}}}  (group order may be different)
+ * @endcode
+ */
+class groupby_accumulator {
+ public:
+  groupby_accumulator() = delete;
+  ~groupby_accumulator();
+  groupby_accumulator(groupby_accumulator const&) = delete;
+  groupby_accumulator& operator=(groupby_accumulator const&) = delete;
+
+  /**
+   * @brief Construct an accumulator grouping the rows of every batch by the columns at
+   * `key_indices`.
+   *
+   * @throws cudf::logic_error if any aggregation of `requests` is not supported
+   *
+   * @param key_indices Indices of the key columns in every batch
+   * @param requests The columns to aggregate and the aggregations to compute on them
+   * @param include_null_keys Indicates whether rows in the keys that contain NULL values should
+   * be included
+   */
+  groupby_accumulator(std::vector<size_type> key_indices,
+                      std::vector<accumulation_request>&& requests,
+                      null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates `batch` and merges the result into the accumulated state.
+   *
+   * @throws cudf::logic_error if the key or values columns of `batch` differ in type from those
+   * of the previous batches
+   *
+   * @param batch The batch to accumulate
+   * @param mr Device memory resource used to allocate the accumulated state
+   */
+  void update(table_view const& batch,
+              rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Computes the aggregations of all the batches accumulated so far.
+   *
+   * The accumulated state is left untouched, so more batches may be accumulated afterwards.
+   *
+   * @throws cudf::logic_error if no batch has been accumulated
+   *
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each request in the same order as specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> finalize(
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::vector<size_type> _key_indices;                   ///< Indices of the key columns
+  std::vector<accumulation_request> _requests;           ///< Requested aggregations
+  null_policy _include_null_keys{null_policy::EXCLUDE};  ///< Include rows in keys
+                                                         ///< with NULLs
+  std::unique_ptr<table> _keys;                          ///< Unique keys accumulated so far
+  std::vector<std::unique_ptr<column>> _partials;        ///< Partial state of each aggregation
+  std::vector<data_type> _values_types;                  ///< Types of the aggregated columns
+
+  /**
+   * @brief Aggregates `batch` into the partial state of each requested aggregation.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> aggregate_batch(
+    table_view const& batch, rmm::mr::device_memory_resource* mr) const;
+};
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
@@ -37,7 +37,11 @@ enum class hash_id {
   HASH_IDENTITY = 0,   ///< Identity hash function that simply returns the key to be hashed
   HASH_MURMUR3,        ///< Murmur3 hash function
   HASH_SPARK_MURMUR3,  ///< Spark Murmur3 hash function
-  HASH_MD5             ///< MD5 hash function
+  HASH_MD5,            ///< MD5 hash function
+  HASH_XXHASH64,       ///< 64-bit xxHash (XXH64) hash function
+  HASH_SHA1,           ///< SHA-1 hash function
+  HASH_SHA256,         ///< SHA-256 hash function
+  HASH_SHA512          ///< SHA-512 hash function
 };
 
 /**
@@ -53,6 +57,11 @@ static constexpr uint32_t DEFAULT_HASH_SEED = 0;
  * @param seed Optional seed value to use for the hash function
  * @param mr Device memory resource used to allocate the returned column's device memory
  *
+ * The output is a UINT32 column for `HASH_MURMUR3`, an INT32 column for `HASH_SPARK_MURMUR3`,
+ * a UINT64 column for `HASH_XXHASH64` and a STRING column of lowercase hexadecimal digests for
+ * `HASH_MD5`, `HASH_SHA1`, `HASH_SHA256` and `HASH_SHA512`. The seed is ignored by the
+ * message digest functions.
+ *
  * @returns A column where each row is the hash of a column from the input
  */
 std::unique_ptr<column> hash(
@@ -17,17 +17,45 @@
 #pragma once
 
 #include <arrow/api.h>
+#include <arrow/c/abi.h>
 
 #include <cudf/column/column.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 struct DLManagedTensor;
 
+#ifndef ARROW_C_DEVICE_DATA_INTERFACE
+#define ARROW_C_DEVICE_DATA_INTERFACE
+
+// The Arrow C Device Data Interface, as specified by Apache Arrow. Arrow releases that provide it
+// define the same structures under the same guard.
+
+typedef int32_t ArrowDeviceType;
+
+#define ARROW_DEVICE_CPU 1
+#define ARROW_DEVICE_CUDA 2
+#define ARROW_DEVICE_CUDA_HOST 3
+#define ARROW_DEVICE_CUDA_MANAGED 13
+
+struct ArrowDeviceArray {
+  struct ArrowArray array;
+  int64_t device_id;
+  ArrowDeviceType device_type;
+  void* sync_event;
+  int64_t reserved[3];
+};
+
+#endif  // ARROW_C_DEVICE_DATA_INTERFACE
+
 namespace cudf {
 /**
  * @addtogroup interop_dlpack
@@ -78,6 +106,85 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief View a column-major DLPack DLTensor in device memory as a cudf table, without a copy
+ *
+ * Unlike `from_dlpack`, the columns of the returned table refer to the memory of the tensor,
+ * which must outlive them. The tensor has the same layout requirements as for `from_dlpack`, so
+ * its columns may be separated by more than their size, like the columns of a column-major matrix
+ * with a padded leading dimension. The `device_type` of the DLTensor must be `kDLCUDA` and its
+ * columns must be aligned to their data type.
+ *
+ * @note The managed tensor is not deleted by this function.
+ *
+ * @throw cudf::logic_error if the any of the DLTensor fields are unsupported
+ *
+ * @param managed_tensor a 1D or 2D column-major (Fortran order) tensor
+ *
+ * @return Table viewing the tensor data
+ */
+table_view view_from_dlpack(DLManagedTensor const* managed_tensor);
+
+/**
+ * @brief A column-major matrix in device memory that is exported to DLPack without a copy
+ *
+ * The columns of the matrix are consecutive slices of a single allocation. Operations write the
+ * columns directly through `mutable_view`, for example as the outputs of `cudf::fill_in_place`
+ * or `cudf::copy_range_in_place`, and `release` then hands the allocation to a DLPack tensor.
+ * This avoids the copy of every column that `to_dlpack` makes, for example when building the
+ * feature matrix of a model. The columns have no null mask.
+ */
+class dlpack_matrix {
+ public:
+  /**
+   * @brief Allocates a matrix with uninitialized values.
+   *
+   * @throw cudf::logic_error if `type` is not numeric or a dimension is negative
+   *
+   * @param type Data type of the values, which must be numeric
+   * @param num_rows Number of rows
+   * @param num_columns Number of columns
+   * @param mr Device memory resource used to allocate the matrix
+   */
+  dlpack_matrix(data_type type,
+                size_type num_rows,
+                size_type num_columns,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns a mutable view of the columns of the matrix.
+   *
+   * @return View of the columns, empty once the matrix is released
+   */
+  [[nodiscard]] mutable_table_view mutable_view();
+
+  /**
+   * @brief Returns a view of the columns of the matrix.
+   *
+   * @return View of the columns, empty once the matrix is released
+   */
+  [[nodiscard]] table_view view() const;
+
+  /**
+   * @brief Moves the matrix into a DLPack tensor.
+   *
+   * The tensor is 1D if the matrix has a single column and 2D otherwise, like the tensors of
+   * `to_dlpack`. The matrix is empty afterwards.
+   *
+   * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+   * free the memory of the tensor.
+   *
+   * @return DLPack tensor owning the matrix, or nullptr if the matrix has no rows or no columns
+   */
+  DLManagedTensor* release();
+
+ private:
+  data_type _type;
+  size_type _num_rows;
+  size_type _num_columns;
+  rmm::device_buffer _buffer;
+};
+
 /** @} */  // end of group
 
 /**
@@ -122,6 +229,30 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
                                        std::vector<column_metadata> const& metadata = {},
                                        arrow::MemoryPool* ar_mr = arrow::default_memory_pool());
 
+/**
+ * @brief Create `arrow::Table` from cudf table `input` without synchronizing `stream`
+ *
+ * Same as `to_arrow`, except for the host memory of the arrow Table. All the device-to-host
+ * copies are enqueued on `stream` into a single allocation of pinned host memory, taken from the
+ * pinned host memory pool shared with the readers and writers (see
+ * `cudf::io::set_pinned_memory_pool_size`), and the buffers of the arrow Table are slices of it.
+ * The memory is released once all the buffers that slice it have been released.
+ *
+ * The data of the returned arrow Table must not be accessed, and the arrow Table must not be
+ * released, until `stream` has been synchronized.
+ *
+ * @throws cudf::logic_error if `column_names` size doesn't match with number of columns.
+ *
+ * @param input table_view that needs to be converted to arrow Table
+ * @param metadata Contains hierarchy of names of columns and children
+ * @param stream CUDA stream on which the copies are enqueued
+ * @return arrow Table generated from `input`
+ */
+std::shared_ptr<arrow::Table> to_arrow_async(
+  table_view input,
+  std::vector<column_metadata> const& metadata = {},
+  rmm::cuda_stream_view stream                 = cudf::default_stream_value);
+
 /**
  * @brief Create `cudf::table` from given arrow Table input
  *
@@ -134,5 +265,110 @@ std::unique_ptr<table> from_arrow(
   arrow::Table const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief An `ArrowSchema` released with its release callback when the pointer is destroyed.
+ */
+using unique_schema_t = std::unique_ptr<ArrowSchema, void (*)(ArrowSchema*)>;
+
+/**
+ * @brief An `ArrowDeviceArray` released with its release callback when the pointer is destroyed.
+ */
+using unique_device_array_t = std::unique_ptr<ArrowDeviceArray, void (*)(ArrowDeviceArray*)>;
+
+/**
+ * @brief Deleter of a view that also owns the columns it had to create.
+ *
+ * @tparam ViewType The type of the view
+ */
+template <typename ViewType>
+struct custom_view_deleter {
+  /**
+   * @brief Construct a deleter owning `owned_mem`.
+   *
+   * @param owned_mem The columns the view refers to in addition to the memory it does not own
+   */
+  explicit custom_view_deleter(std::vector<std::unique_ptr<column>>&& owned_mem)
+    : owned_mem_{std::move(owned_mem)}
+  {
+  }
+
+  /**
+   * @brief Deletes the view.
+   *
+   * @param ptr The view to delete
+   */
+  void operator()(ViewType* ptr) const { delete ptr; }
+
+  std::vector<std::unique_ptr<column>> owned_mem_;  ///< The columns owned alongside the view
+};
+
+/**
+ * @brief A `table_view` that owns the columns it had to create.
+ */
+using unique_table_view_t = std::unique_ptr<table_view, custom_view_deleter<table_view>>;
+
+/**
+ * @brief Create the `ArrowSchema` of a table, as a struct whose children are its columns.
+ *
+ * Decimals keep their width through the optional bitwidth of the Arrow decimal format and
+ * `BOOL8` columns are described as Arrow booleans.
+ *
+ * @throws cudf::logic_error if `metadata` is not empty and its size differs from the number of
+ * columns
+ * @throws cudf::logic_error if a column has a type with no Arrow equivalent, such as
+ * `DURATION_DAYS` or a dictionary
+ *
+ * @param input The table to describe
+ * @param metadata Contains hierarchy of names of columns and children
+ * @return The schema of `input`
+ */
+unique_schema_t to_arrow_schema(table_view const& input,
+                                host_span<column_metadata const> metadata = {});
+
+/**
+ * @brief Export a table through the Arrow C Device Data Interface, without copying its data.
+ *
+ * The table is moved into the returned `ArrowDeviceArray`, a struct array whose children are the
+ * columns of the table, and its device buffers become the Arrow buffers. They are freed when the
+ * release callbacks of the array and of any child arrays moved out of it have been called. The
+ * only copies are the bit-packed values of `BOOL8` columns and the single offset of empty strings
+ * or lists columns, which Arrow requires. `sync_event` points to a CUDA event recorded after all
+ * the work on the device has been enqueued.
+ *
+ * The array matches the schema returned by `to_arrow_schema` for the same table.
+ *
+ * @throws cudf::logic_error if a column has a type with no Arrow equivalent
+ *
+ * @param table The table to export
+ * @param mr Device memory resource used to allocate the buffers that are converted
+ * @return The exported array
+ */
+unique_device_array_t to_arrow_device(
+  cudf::table&& table,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Import a table from the Arrow C Device Data Interface, without copying its data.
+ *
+ * `schema` must describe a struct whose children are the columns of the table, and `input` must
+ * be in CUDA device memory. The returned view refers to the buffers of `input`, which must not be
+ * released before the view is destroyed. Arrow booleans are converted to `BOOL8` columns owned by
+ * the view, since their layouts differ. If `input` has a `sync_event`, the default stream waits on
+ * it before any conversion.
+ *
+ * @throws cudf::logic_error if `input` is not in CUDA device memory
+ * @throws cudf::logic_error if `schema` is not a struct or has an unsupported type, such as large
+ * strings or lists
+ *
+ * @param schema The schema of `input`
+ * @param input The array to import
+ * @param mr Device memory resource used to allocate the columns that are converted
+ * @return A view of the imported table
+ */
+unique_table_view_t from_arrow_device(
+  ArrowSchema const* schema,
+  ArrowDeviceArray const* input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
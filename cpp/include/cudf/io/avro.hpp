@@ -29,6 +29,9 @@
 
 namespace cudf {
 namespace io {
+namespace detail::avro {
+class chunked_reader;
+}  // namespace detail::avro
 /**
  * @addtogroup io_readers
  * @{
@@ -218,6 +221,86 @@ table_with_metadata read_avro(
   avro_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked Avro reader class to read a set of Avro files into a series of tables, chunk
+ * by chunk.
+ *
+ * Each chunk is formed from consecutive whole blocks, possibly spanning several files, whose
+ * estimated device memory footprint stays within the given limit, except when a single block alone
+ * exceeds it. Blocks of files using different compression codecs are never read in the same chunk.
+ *
+ * All the sources must have the same schema. The metadata of every source is parsed once, at
+ * construction, and parsed schemas are cached, so a dataset of many small files sharing a schema
+ * parses that schema only once.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks:
+ * @code
+ *  auto source  = cudf::io::source_info(std::vector<std::string>{"a.avro", "b.avro"});
+ *  auto options = cudf::io::avro_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_avro_reader(512 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // process chunk.tbl
+ *  }
+ * @endcode
+ */
+class chunked_avro_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_avro_reader() = default;
+
+  /**
+   * @brief Constructor for the chunked reader.
+   *
+   * Selecting rows with `skip_rows` or `num_rows` is not supported.
+   *
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   * @param options Settings for controlling reading behavior
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_avro_reader(
+    std::size_t read_memory_limit,
+    avro_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_avro_reader();
+
+  /**
+   * @brief Check if there is any data in the given sources that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the next chunk of blocks of the given sources.
+   *
+   * The sequence of returned tables, if concatenated by their order, forms the same dataset as
+   * reading each source at once and concatenating the results.
+   *
+   * An empty table will be returned if the sources hold no rows, or all the data has been read
+   * and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::avro::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
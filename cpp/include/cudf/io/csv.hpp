@@ -31,6 +31,12 @@
 
 namespace cudf {
 namespace io {
+namespace detail::csv {
+class chunked_reader;
+}  // namespace detail::csv
+namespace text {
+class data_chunk_source;
+}  // namespace text
 
 /**
  * @addtogroup io_readers
@@ -132,6 +138,8 @@ class csv_reader_options {
   bool _dayfirst = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
+  // Whether to gather the type histogram while the data is parsed, instead of in a separate pass
+  bool _single_pass_inference = false;
 
   /**
    * @brief Constructor from source info.
@@ -470,6 +478,13 @@ class csv_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Whether to infer column types in the same pass over the data that parses it.
+   *
+   * @return `true` if type inference is overlapped with parsing
+   */
+  bool is_enabled_single_pass_inference() const { return _single_pass_inference; }
+
   /**
    * @brief Sets compression format of the source.
    *
@@ -801,6 +816,17 @@ class csv_reader_options {
    * @param type Dtype to which all timestamp column will be cast
    */
   void set_timestamp_type(data_type type) { _timestamp_type = type; }
+
+  /**
+   * @brief Sets whether to infer column types in the same pass over the data that parses it.
+   *
+   * Columns without a user-specified type are tokenized once; their raw fields are kept while the
+   * type histogram is gathered and are converted to the inferred type at the end. This avoids a
+   * second pass over the data at the cost of holding the field offsets of the inferred columns.
+   *
+   * @param val Boolean value to enable/disable
+   */
+  void enable_single_pass_inference(bool val) { _single_pass_inference = val; }
 };
 
 /**
@@ -1269,6 +1295,18 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets whether to infer column types in the same pass over the data that parses it.
+   *
+   * @param val Boolean value to enable/disable
+   * @return this for chaining
+   */
+  csv_reader_options_builder& single_pass_inference(bool val)
+  {
+    options._single_pass_inference = val;
+    return *this;
+  }
+
   /**
    * @brief move csv_reader_options member once it's built.
    */
@@ -1304,6 +1342,88 @@ table_with_metadata read_csv(
   csv_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class.
+ *
+ * Reads CSV rows from a `text::data_chunk_source` one chunk at a time, so that inputs much larger
+ * than device memory can be ingested with a bounded amount of memory. Rows are only split at row
+ * terminators outside of quotes; a row that straddles the end of a chunk is carried over and
+ * parsed together with the next chunk.
+ *
+ * The header, the skipped rows and the column selection are applied to the first chunk. Its
+ * column names and types, inferred or specified, are used for all the following chunks, so the
+ * type inference runs only once and all the returned tables have the same schema.
+ *
+ * The following code snippet demonstrates how to read a large file in chunks:
+ * @code
+ *  auto source  = cudf::io::text::make_source_from_file("dataset.csv");
+ *  auto options = cudf::io::csv_reader_options::builder(cudf::io::source_info{}).build();
+ *  auto reader  = cudf::io::chunked_csv_reader(*source, options, 512 * 1024 * 1024);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // process chunk.tbl
+ *  }
+ * @endcode
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for the chunked reader.
+   *
+   * The source set in `options` is not used, and the data must be uncompressed. Byte ranges,
+   * `nrows` and `skipfooter` are not supported.
+   *
+   * @param source Source of the CSV data; must outlive the reader
+   * @param options Settings for controlling reading behavior
+   * @param chunk_size Target number of bytes of input parsed by each call to `read_chunk()`;
+   *        a longer read is issued only when a single row, or the header with the first row, is
+   *        larger than this
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_csv_reader(
+    text::data_chunk_source const& source,
+    csv_reader_options const& options,
+    std::size_t chunk_size,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data in the source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the complete rows of the next chunk of the source.
+   *
+   * The sequence of returned tables, if concatenated by their order, forms the same dataset as
+   * reading the entire input at once with the types of the first chunk. An empty table will be
+   * returned if the chunk holds no rows.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
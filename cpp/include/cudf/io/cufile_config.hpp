@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_apis
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Sets the number of threads shared by the cuFile (GDS) reads and writes of all files.
+ *
+ * Waits for the cuFile operations in progress to complete before resizing the thread pool, and
+ * must not be called concurrently with new cuFile operations. The initial value is taken from the
+ * `LIBCUDF_CUFILE_THREAD_COUNT` environment variable and defaults to 16.
+ *
+ * @throws cudf::logic_error if `count` is zero
+ *
+ * @param count Number of threads
+ */
+void set_cufile_thread_count(unsigned int count);
+
+/**
+ * @brief Returns the number of threads shared by the cuFile (GDS) reads and writes of all files.
+ *
+ * @return Number of threads
+ */
+unsigned int get_cufile_thread_count();
+
+/**
+ * @brief Sets the maximum size of each cuFile (GDS) read or write; larger operations are split
+ * into slices that are issued in parallel.
+ *
+ * Applies to the operations issued after the call. Sizes below 1024 bytes are rounded up to 1024.
+ * The initial value is taken from the `LIBCUDF_CUFILE_SLICE_SIZE` environment variable and
+ * defaults to 4MB.
+ *
+ * @param size Maximum size of a single cuFile operation, in bytes
+ */
+void set_cufile_slice_size(std::size_t size);
+
+/**
+ * @brief Returns the maximum size of each cuFile (GDS) read or write.
+ *
+ * @return Maximum size of a single cuFile operation, in bytes
+ */
+std::size_t get_cufile_slice_size();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -37,6 +37,22 @@ namespace cudf {
 //! IO interfaces
 namespace io {
 
+/**
+ * @brief Options of the caching datasource created with `datasource::create_cached`.
+ */
+struct cached_source_options {
+  /// Granularity of the reads issued to the wrapped source; small reads are extended to whole
+  /// aligned blocks, so reads that are closer than a block are served by a single request
+  size_t block_size = 1 << 20;
+  /// Maximum total size of the blocks kept in the least-recently-used cache
+  size_t cache_size = 64 << 20;
+  /// Reads larger than this bypass the cache and are forwarded to the wrapped source
+  size_t max_cached_read_size = 4 << 20;
+  /// Number of reads issued to the wrapped source concurrently; values larger than one require the
+  /// wrapped source to support concurrent `host_read` calls
+  int num_parallel_reads = 1;
+};
+
 /**
  * @brief Interface class for providing input data to the readers.
  */
@@ -121,6 +137,25 @@ class datasource {
    */
   static std::unique_ptr<datasource> create(datasource* source);
 
+  /**
+   * @brief Creates a source that coalesces and caches the host reads of a user implemented
+   * datasource object.
+   *
+   * Intended for high-latency sources such as object storage. Small reads (e.g. file footers and
+   * metadata) are served from a cache of aligned blocks, and the blocks that are missing are read
+   * with as few requests as possible. Large reads bypass the cache and are split into concurrent
+   * requests. Device reads are forwarded to the wrapped source.
+   *
+   * @throws cudf::logic_error if `options.block_size` or `options.num_parallel_reads` is not
+   * positive
+   *
+   * @param[in] source Non-owning pointer to the datasource object
+   * @param[in] options Block size, cache size and read parallelism to use
+   * @return Constructed datasource object
+   */
+  static std::unique_ptr<datasource> create_cached(datasource* source,
+                                                   cached_source_options const& options = {});
+
   /**
    * @brief Creates a vector of datasources, one per element in the input vector.
    *
@@ -21,6 +21,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -42,6 +45,52 @@ table_with_metadata read_avro(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Class to read an Avro dataset chunk by chunk, with the memory used to read each chunk
+ * bounded by a given byte limit.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a read memory limit and an array of data sources with reader options.
+   *
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t read_memory_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          avro_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header.
+   *
+   * Since the declaration of the internal `_impl` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_avro_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_avro_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -17,10 +17,13 @@
 #pragma once
 
 #include <cudf/io/csv.hpp>
+#include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -41,6 +44,50 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Class to read CSV rows incrementally from a `data_chunk_source`.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a chunk source with reader options.
+   *
+   * @param source Source of the CSV data
+   * @param options Settings for controlling reading behavior
+   * @param chunk_size Number of bytes requested from the source for each chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(text::data_chunk_source const& source,
+                          csv_reader_options const& options,
+                          std::size_t chunk_size,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header.
+   *
+   * Since the declaration of the internal `_impl` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
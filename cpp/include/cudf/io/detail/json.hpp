@@ -17,10 +17,14 @@
 #pragma once
 
 #include <cudf/io/json.hpp>
+#include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -42,6 +46,87 @@ table_with_metadata read_json(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Parses JSON Lines records that are already loaded in both host and device memory.
+ *
+ * The byte range and compression settings of `options` are ignored; `h_data` and `d_data` must
+ * hold the same uncompressed records.
+ *
+ * @param options Settings for controlling reading behavior
+ * @param h_data Records in host memory
+ * @param d_data Records in device memory
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return cudf::table object that contains the array of cudf::column.
+ */
+table_with_metadata read_json_lines(json_reader_options const& options,
+                                    host_span<char const> h_data,
+                                    device_span<char const> d_data,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Class to read JSON Lines records incrementally from a `data_chunk_source`.
+ */
+class stream_reader {
+ public:
+  /**
+   * @brief Constructor from a chunk source with reader options.
+   *
+   * @param source Source of the JSON Lines data
+   * @param options Settings for controlling reading behavior
+   * @param chunk_size Number of bytes requested from the source for each chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit stream_reader(text::data_chunk_source const& source,
+                         json_reader_options const& options,
+                         std::size_t chunk_size,
+                         rmm::cuda_stream_view stream,
+                         rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header.
+   *
+   * Since the declaration of the internal `_impl` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~stream_reader();
+
+  /**
+   * @copydoc cudf::io::json_lines_stream_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::json_lines_stream_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief Writes a table to the JSON Lines format.
+ *
+ * @param sink Output sink
+ * @param table The set of columns
+ * @param metadata The metadata associated with the table
+ * @param options Settings for controlling behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(data_sink* sink,
+                table_view const& table,
+                table_metadata const* metadata,
+                json_writer_options const& options,
+                rmm::cuda_stream_view stream        = cudf::default_stream_value,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace json
 }  // namespace detail
 }  // namespace io
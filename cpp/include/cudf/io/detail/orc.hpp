@@ -43,10 +43,15 @@ namespace orc {
  * @brief Class to read ORC dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing.
+   */
+  explicit reader();
+
  public:
   /**
    * @brief Constructor from an array of datasources
@@ -78,6 +83,65 @@ class reader {
                            rmm::cuda_stream_view stream = cudf::default_stream_value);
 };
 
+/**
+ * @brief The reading wrapper class to read an ORC dataset chunk by chunk, with the memory used to
+ * read each chunk bounded by a given byte limit.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from a read memory limit and an array of data sources with reader options.
+   *
+   * The typical usage should be similar to this:
+   * ```
+   *  do {
+   *    auto const chunk = reader.read_chunk();
+   *    // Process chunk
+   *  } while (reader.has_next());
+   * ```
+   *
+   * If `read_memory_limit == 0` (i.e., no limit), a call to `read_chunk()` will read the whole
+   * selection and return a table containing all rows.
+   *
+   * The chunks are formed from whole stripes; a chunk may exceed `read_memory_limit` only when a
+   * single stripe alone is larger than the limit.
+   *
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t read_memory_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          orc_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header.
+   *
+   * Since the declaration of the internal `_impl` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  rmm::cuda_stream_view _stream;
+};
+
 /**
  * @brief Class to write ORC dataset data into columns.
  */
@@ -37,6 +37,7 @@ namespace io {
 class parquet_reader_options;
 class parquet_writer_options;
 class chunked_parquet_writer_options;
+struct parquet_metadata;
 
 namespace detail {
 namespace parquet {
@@ -45,10 +46,15 @@ namespace parquet {
  * @brief Class to read Parquet dataset data into columns.
  */
 class reader {
- private:
+ protected:
   class impl;
   std::unique_ptr<impl> _impl;
 
+  /**
+   * @brief Default constructor, needed for subclassing.
+   */
+  explicit reader();
+
  public:
   /**
    * @brief Constructor from an array of datasources
@@ -78,6 +84,71 @@ class reader {
   table_with_metadata read(parquet_reader_options const& options);
 };
 
+/**
+ * @brief The reading wrapper class to read a Parquet dataset chunk by chunk, with the output
+ * size of each chunk bounded by a given byte limit.
+ */
+class chunked_reader : private reader {
+ public:
+  /**
+   * @brief Constructor from a read size limit and an array of data sources with reader options.
+   *
+   * The typical usage should be similar to this:
+   * ```
+   *  do {
+   *    auto const chunk = reader.read_chunk();
+   *    // Process chunk
+   *  } while (reader.has_next());
+   * ```
+   *
+   * If `chunk_read_limit == 0` (i.e., no reading limit), a call to `read_chunk()` will read the
+   * whole selection and return a table containing all rows.
+   *
+   * The chunks are formed from whole row groups; a chunk may exceed `chunk_read_limit` only when
+   * a single row group alone is larger than the limit.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          parquet_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header.
+   *
+   * Since the declaration of the internal `_impl` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+};
+
+/**
+ * @brief Reads the metadata of a Parquet file from its footer.
+ *
+ * @param source Input `datasource` object to read the footer from
+ *
+ * @return Metadata of the file
+ */
+parquet_metadata read_metadata(datasource* source);
+
 /**
  * @brief Class to write parquet dataset data into columns.
  */
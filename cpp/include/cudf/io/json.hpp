@@ -23,13 +23,22 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <variant>
 #include <vector>
 
 namespace cudf {
 namespace io {
+namespace detail::json {
+class stream_reader;
+}  // namespace detail::json
+namespace text {
+class data_chunk_source;
+}  // namespace text
+
 /**
  * @addtogroup io_readers
  * @{
@@ -412,6 +421,312 @@ table_with_metadata read_json(
   json_reader_options options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The streaming JSON Lines reader class.
+ *
+ * Reads JSON Lines records from a `text::data_chunk_source` one chunk at a time, so that inputs
+ * much larger than device memory, or inputs still being written, can be processed with a bounded
+ * amount of memory. A record that straddles the end of a chunk is carried over and parsed together
+ * with the next chunk.
+ *
+ * The column names and types are determined by the first chunk, unless the types are specified in
+ * the options; the tables returned by later calls use the same columns in the same order, with
+ * nulls for the columns missing from all records of a chunk. Columns that first appear in a later
+ * chunk are not supported.
+ *
+ * The following code snippet demonstrates how to read a large log file in chunks:
+ * @code
+ *  auto source  = cudf::io::text::make_source_from_file("logs.jsonl");
+ *  auto options = cudf::io::json_reader_options::builder(cudf::io::source_info{}).lines(true);
+ *  auto reader  = cudf::io::json_lines_stream_reader(*source, options, 256 * 1024 * 1024);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // process chunk.tbl
+ *  }
+ * @endcode
+ */
+class json_lines_stream_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  json_lines_stream_reader() = default;
+
+  /**
+   * @brief Constructor for the streaming reader.
+   *
+   * The source set in `options` is not used, and the data must be uncompressed. Only the JSON
+   * Lines format is supported, and byte ranges are not supported.
+   *
+   * @param source Source of the JSON Lines data; must outlive the reader
+   * @param options Settings for controlling reading behavior
+   * @param chunk_size Number of bytes read from the source for each call to `read_chunk()`;
+   *        a longer read is issued only when a single record is larger than this
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  json_lines_stream_reader(
+    text::data_chunk_source const& source,
+    json_reader_options const& options,
+    std::size_t chunk_size,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~json_lines_stream_reader();
+
+  /**
+   * @brief Check if there is any data in the source that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the complete records of the next chunk of the source.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains every record of the
+   * source exactly once. An empty table will be returned if the chunk holds no records, for
+   * example when it only contains blank lines.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::json::stream_reader> reader;
+};
+
+/** @} */  // end of group
+
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Builder to build options for `write_json()`.
+ */
+class json_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_json()`.
+ *
+ * The table is written in the JSON Lines format: one JSON object per row, with one member per
+ * column. Struct columns are written as nested objects and list columns as arrays.
+ */
+class json_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // Whether to write the members of null values, as `null`, instead of omitting them
+  bool _include_nulls = false;
+  // maximum number of rows to write in each chunk (limits memory use)
+  size_type _rows_per_chunk = std::numeric_limits<size_type>::max();
+  // Optional associated metadata
+  table_metadata const* _metadata = nullptr;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit json_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table), _rows_per_chunk(table.num_rows())
+  {
+  }
+
+  friend json_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `json_writer_options`.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   *
+   * @return Builder to build json_writer_options
+   */
+  static json_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink used for writer output.
+   *
+   * @return sink used for writer output
+   */
+  [[nodiscard]] sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table that would be written to output.
+   *
+   * @return Table that would be written to output
+   */
+  [[nodiscard]] table_view const& get_table() const { return _table; }
+
+  /**
+   * @brief Returns optional associated metadata.
+   *
+   * The member names of the columns are taken from `schema_info` when it is set, and from
+   * `column_names` otherwise. Columns without a name are named by their index.
+   *
+   * @return Optional associated metadata
+   */
+  [[nodiscard]] table_metadata const* get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Whether the members of null values are written as `null` instead of being omitted.
+   *
+   * Null elements of lists are always written as `null`.
+   *
+   * @return `true` if the members of null values are written
+   */
+  [[nodiscard]] bool is_enabled_include_nulls() const { return _include_nulls; }
+
+  /**
+   * @brief Returns maximum number of rows to process for each file write.
+   *
+   * @return Maximum number of rows to process for each file write
+   */
+  [[nodiscard]] size_type get_rows_per_chunk() const { return _rows_per_chunk; }
+
+  // Setter
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata
+   */
+  void set_metadata(table_metadata const* metadata) { _metadata = metadata; }
+
+  /**
+   * @brief Enables/Disables writing the members of null values.
+   *
+   * @param val Boolean value to enable/disable
+   */
+  void enable_include_nulls(bool val) { _include_nulls = val; }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk
+   */
+  void set_rows_per_chunk(size_type val) { _rows_per_chunk = val; }
+};
+
+/**
+ * @brief Builder to build options for `write_json()`
+ */
+class json_writer_options_builder {
+  json_writer_options options;  ///< Options to be built.
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit json_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit json_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets optional associated metadata.
+   *
+   * @param metadata Associated metadata
+   * @return this for chaining
+   */
+  json_writer_options_builder& metadata(table_metadata const* metadata)
+  {
+    options._metadata = metadata;
+    return *this;
+  }
+
+  /**
+   * @brief Enables/Disables writing the members of null values.
+   *
+   * @param val Boolean value to enable/disable
+   * @return this for chaining
+   */
+  json_writer_options_builder& include_nulls(bool val)
+  {
+    options._include_nulls = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets maximum number of rows to process for each file write.
+   *
+   * @param val Number of rows per chunk
+   * @return this for chaining
+   */
+  json_writer_options_builder& rows_per_chunk(int val)
+  {
+    options._rows_per_chunk = val;
+    return *this;
+  }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   */
+  operator json_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move `json_writer_options` member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `json_writer_options` object's r-value reference
+   */
+  json_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a table to the JSON Lines format.
+ *
+ * Numbers and booleans are written as JSON numbers and literals, and non-finite floating-point
+ * values as `null`. Strings, timestamps and durations are written as JSON strings; timestamps in
+ * the ISO 8601 format. Dictionary columns are not supported.
+ *
+ * The following code snippet demonstrates how to write a table to a file:
+ * @code
+ *  auto destination = cudf::io::sink_info("dataset.jsonl");
+ *  auto options     = cudf::io::json_writer_options::builder(destination, table->view())
+ *    .metadata(&metadata)
+ *    .include_nulls(true);
+ *
+ *  cudf::io::write_json(options);
+ * @endcode
+ *
+ * @param options Settings for controlling writing behavior
+ * @param mr Device memory resource to use for device memory allocation
+ */
+void write_json(json_writer_options const& options,
+                rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -23,6 +24,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -40,6 +42,7 @@ namespace io {
 constexpr size_t default_stripe_size_bytes   = 64 * 1024 * 1024;  ///< 64MB default orc stripe size
 constexpr size_type default_stripe_size_rows = 1000000;  ///< 1M rows default orc stripe rows
 constexpr size_type default_row_index_stride = 10000;    ///< 10K rows default orc row index stride
+constexpr double default_bloom_filter_fpp    = 0.05;     ///< 5% default orc Bloom filter fpp
 
 /**
  * @brief Builds settings to use for `read_orc()`.
@@ -73,6 +76,9 @@ class orc_reader_options {
   // Columns that should be read as Decimal128
   std::vector<std::string> _decimal128_columns;
 
+  // Predicate filter as AST to filter output rows and prune stripes
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
   friend orc_reader_options_builder;
 
   /**
@@ -161,6 +167,13 @@ class orc_reader_options {
    */
   std::vector<std::string> const& get_decimal128_columns() const { return _decimal128_columns; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter; `nullopt` if the option is not set
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   // Setters
 
   /**
@@ -234,6 +247,20 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The column references in the expression are indices into the output table, i.e. into the
+   * columns selected by `set_columns()`, in order. Stripes whose statistics, or the statistics of
+   * all their row groups, prove that no row can satisfy the filter are skipped without being read
+   * or decompressed, and the remaining rows are filtered exactly before being returned. Stripes
+   * are only pruned when neither `skip_rows` nor `num_rows` is set. The expression must outlive
+   * the reading call.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
 };
 
 /**
@@ -353,6 +380,18 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -391,6 +430,88 @@ table_with_metadata read_orc(
   orc_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked orc reader class to read ORC file iteratively in to a series of tables,
+ * chunk by chunk.
+ *
+ * Reading all the selected stripes at once keeps the compressed and decompressed data of every
+ * stripe alive together with the output columns. This class bounds the peak memory usage by
+ * reading consecutive batches of stripes whose estimated memory footprint stays within the given
+ * limit, except when a single stripe alone exceeds it.
+ *
+ * The file footer and metadata of every source are parsed only once, at construction, and each
+ * stripe is read and decoded exactly once across all the calls to `read_chunk()`.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.orc");
+ *  auto options = cudf::io::orc_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_orc_reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // process chunk.tbl
+ *  }
+ * @endcode
+ */
+class chunked_orc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_orc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `orc_reader_options` parameter as in `cudf::read_orc()`,
+   * and an additional parameter to specify the memory limit of each reading. Selecting rows with
+   * `skip_rows` or `num_rows` is not supported; stripes can be selected with `stripes`.
+   *
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   * @param options The options used to read ORC file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_orc_reader(
+    std::size_t read_memory_limit,
+    orc_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_orc_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given ORC file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::orc::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -431,6 +552,8 @@ class orc_writer_options {
   size_type _stripe_size_rows = default_stripe_size_rows;
   // Row index stride (maximum number of rows in each row group)
   size_type _row_index_stride = default_row_index_stride;
+  // False positive probability of the Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
   // Set of columns to output
   table_view _table;
   // Optional associated metadata
@@ -525,6 +648,13 @@ class orc_writer_options {
     return unaligned_stride - unaligned_stride % 8;
   }
 
+  /**
+   * @brief Returns the false positive probability of the Bloom filters.
+   *
+   * @return False positive probability of the Bloom filters
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   /**
    * @brief Returns table to be written to output.
    *
@@ -608,6 +738,21 @@ class orc_writer_options {
     _row_index_stride = stride;
   }
 
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * Bloom filters are written for each row group of the columns that enable them with
+   * `column_in_metadata::set_bloom_filter`, sized for a row group of distinct values. A lower
+   * probability makes the filters larger.
+   *
+   * @param fpp False positive probability, in the (0, 1) range
+   */
+  void set_bloom_filter_fpp(double fpp)
+  {
+    CUDF_EXPECTS(fpp > 0 and fpp < 1, "Bloom filter false positive probability must be in (0, 1)");
+    _bloom_filter_fpp = fpp;
+  }
+
   /**
    * @brief Sets table to be written to output.
    *
@@ -722,6 +867,18 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param val False positive probability, in the (0, 1) range
+   * @return this for chaining
+   */
+  orc_writer_options_builder& bloom_filter_fpp(double val)
+  {
+    options.set_bloom_filter_fpp(val);
+    return *this;
+  }
+
   /**
    * @brief Sets table to be written to output.
    *
@@ -813,6 +970,8 @@ class chunked_orc_writer_options {
   size_type _stripe_size_rows = default_stripe_size_rows;
   // Row index stride (maximum number of rows in each row group)
   size_type _row_index_stride = default_row_index_stride;
+  // False positive probability of the Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
   // Optional associated metadata
   const table_input_metadata* _metadata = nullptr;
   // Optional footer key_value_metadata
@@ -890,6 +1049,13 @@ class chunked_orc_writer_options {
     return unaligned_stride - unaligned_stride % 8;
   }
 
+  /**
+   * @brief Returns the false positive probability of the Bloom filters.
+   *
+   * @return False positive probability of the Bloom filters
+   */
+  [[nodiscard]] double get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   /**
    * @brief Returns associated metadata.
    *
@@ -966,6 +1132,21 @@ class chunked_orc_writer_options {
     _row_index_stride = stride;
   }
 
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * Bloom filters are written for each row group of the columns that enable them with
+   * `column_in_metadata::set_bloom_filter`, sized for a row group of distinct values. A lower
+   * probability makes the filters larger.
+   *
+   * @param fpp False positive probability, in the (0, 1) range
+   */
+  void set_bloom_filter_fpp(double fpp)
+  {
+    CUDF_EXPECTS(fpp > 0 and fpp < 1, "Bloom filter false positive probability must be in (0, 1)");
+    _bloom_filter_fpp = fpp;
+  }
+
   /**
    * @brief Sets associated metadata.
    *
@@ -1070,6 +1251,18 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the false positive probability of the Bloom filters.
+   *
+   * @param val False positive probability, in the (0, 1) range
+   * @return this for chaining
+   */
+  chunked_orc_writer_options_builder& bloom_filter_fpp(double val)
+  {
+    options.set_bloom_filter_fpp(val);
+    return *this;
+  }
+
   /**
    * @brief Sets associated metadata.
    *
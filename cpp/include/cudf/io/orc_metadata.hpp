@@ -23,6 +23,7 @@
 
 #include <cudf/io/types.hpp>
 
+#include <cstdint>
 #include <optional>
 #include <variant>
 #include <vector>
@@ -206,5 +207,43 @@ struct parsed_orc_statistics {
  */
 parsed_orc_statistics read_parsed_orc_statistics(source_info const& src_info);
 
+/**
+ * @brief Holds the sizes of a stripe of an ORC file.
+ *
+ * The `column_lengths` member contains one element per column, in the order of
+ * `orc_metadata::column_names`, each the total size of the streams of the column in the stripe.
+ */
+struct orc_stripe_metadata {
+  uint64_t offset;                       ///< Offset of the stripe in the file
+  uint64_t num_rows;                     ///< Number of rows
+  uint64_t index_length;                 ///< Size of the index streams
+  uint64_t data_length;                  ///< Size of the data streams
+  uint64_t footer_length;                ///< Size of the stripe footer
+  std::vector<uint64_t> column_lengths;  ///< Size of the streams of each column
+};
+
+/**
+ * @brief Holds column names, the number of rows and the stripe sizes of an ORC file.
+ */
+struct orc_metadata {
+  std::vector<std::string> column_names;     ///< Column names
+  uint64_t num_rows;                         ///< Number of rows in the file
+  std::vector<orc_stripe_metadata> stripes;  ///< Sizes of each stripe
+};
+
+/**
+ * @brief Reads the number of rows and the stripe sizes of an ORC dataset.
+ *
+ * @ingroup io_readers
+ *
+ * Only the footers of the file and of its stripes are read. Statistics of the stripes are read by
+ * `read_parsed_orc_statistics`.
+ *
+ * @param src_info Dataset source
+ *
+ * @return Column names, number of rows and stripe sizes
+ */
+orc_metadata read_orc_metadata(source_info const& src_info);
+
 }  // namespace io
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -24,6 +25,7 @@
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -39,9 +41,10 @@ namespace io {
  */
 
 constexpr size_t default_row_group_size_bytes   = 128 * 1024 * 1024;  ///< 128MB per row group
-constexpr size_type default_row_group_size_rows = 1000000;     ///< 1 million rows per row group
-constexpr size_t default_max_page_size_bytes    = 512 * 1024;  ///< 512KB per page
-constexpr size_type default_max_page_size_rows  = 20000;       ///< 20k rows per page
+constexpr size_type default_row_group_size_rows = 1000000;      ///< 1 million rows per row group
+constexpr size_t default_max_page_size_bytes    = 512 * 1024;   ///< 512KB per page
+constexpr size_type default_max_page_size_rows  = 20000;        ///< 20k rows per page
+constexpr size_t default_max_dictionary_size    = 1024 * 1024;  ///< 1MB per dictionary
 
 class parquet_reader_options_builder;
 
@@ -56,15 +59,29 @@ class parquet_reader_options {
 
   // List of individual row groups to read (ignored if empty)
   std::vector<std::vector<size_type>> _row_groups;
+  // Number of rows to skip from the start
+  size_type _skip_rows = 0;
+  // Number of rows to read; -1 is all
+  size_type _num_rows = -1;
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to return dictionary-encoded string columns as dictionary columns
+  bool _keep_dictionary_encoding = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
+  // Whether to reuse the footers of files parsed by previous reads
+  bool _use_metadata_cache = false;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
   // Whether to store binary data as a string column
   std::optional<std::vector<bool>> _convert_binary_to_strings{std::nullopt};
+  // Predicate filter as AST to filter output rows and prune row groups
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  // Whether to decode the columns not referenced by the filter only for the rows passing it
+  bool _late_materialization = false;
+  // Number of chunks read ahead of the one being decoded by the chunked reader
+  size_type _pipeline_depth = 0;
 
   /**
    * @brief Constructor from source info.
@@ -109,6 +126,17 @@ class parquet_reader_options {
     return _convert_strings_to_categories;
   }
 
+  /**
+   * @brief Returns true/false depending on whether dictionary-encoded string columns are returned
+   * as dictionary columns or not.
+   *
+   * @return `true` if dictionary-encoded string columns are returned as dictionary columns
+   */
+  [[nodiscard]] bool is_enabled_keep_dictionary_encoding() const
+  {
+    return _keep_dictionary_encoding;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    *
@@ -116,6 +144,13 @@ class parquet_reader_options {
    */
   [[nodiscard]] bool is_enabled_use_pandas_metadata() const { return _use_pandas_metadata; }
 
+  /**
+   * @brief Returns true/false depending on whether parsed file footers are cached across reads.
+   *
+   * @return `true` if parsed file footers are cached across reads
+   */
+  [[nodiscard]] bool is_enabled_use_metadata_cache() const { return _use_metadata_cache; }
+
   /**
    * @brief Returns optional vector of true/false values depending on whether binary data should be
    * converted to strings or not.
@@ -143,6 +178,20 @@ class parquet_reader_options {
    */
   [[nodiscard]] auto const& get_row_groups() const { return _row_groups; }
 
+  /**
+   * @brief Returns number of rows to skip from the start.
+   *
+   * @return Number of rows to skip from the start
+   */
+  [[nodiscard]] size_type get_skip_rows() const { return _skip_rows; }
+
+  /**
+   * @brief Returns number of rows to read.
+   *
+   * @return Number of rows to read; `-1` if all the rows after `skip_rows` are read
+   */
+  [[nodiscard]] size_type get_num_rows() const { return _num_rows; }
+
   /**
    * @brief Returns timestamp type used to cast timestamp columns.
    *
@@ -150,6 +199,28 @@ class parquet_reader_options {
    */
   data_type get_timestamp_type() const { return _timestamp_type; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter; `nullopt` if the option is not set
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
+  /**
+   * @brief Returns true/false depending on whether the columns not referenced by the filter are
+   * decoded only for the rows passing the filter.
+   *
+   * @return `true` if late materialization is enabled
+   */
+  [[nodiscard]] bool is_enabled_late_materialization() const { return _late_materialization; }
+
+  /**
+   * @brief Returns the number of chunks whose data is read ahead by `chunked_parquet_reader`.
+   *
+   * @return Pipeline depth of the chunked reader
+   */
+  [[nodiscard]] size_type get_pipeline_depth() const { return _pipeline_depth; }
+
   /**
    * @brief Sets names of the columns to be read.
    *
@@ -157,6 +228,48 @@ class parquet_reader_options {
    */
   void set_columns(std::vector<std::string> col_names) { _columns = std::move(col_names); }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * The column references in the expression are indices into the output table, i.e. into the
+   * columns selected by `set_columns()`, in order. Row groups whose column chunk statistics prove
+   * that no row can satisfy the filter are skipped without being read or decompressed, and the
+   * remaining rows are filtered exactly before being returned. Unless late materialization is
+   * enabled, `read_parquet()` also skips the pages of the remaining row groups whose column index
+   * proves the same, when the chunks have a page index. The expression must outlive the reading
+   * call.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
+  /**
+   * @brief Sets to enable/disable late materialization of the columns not referenced by the
+   * filter.
+   *
+   * When enabled, `read_parquet()` first decodes only the columns referenced by the filter and
+   * evaluates the filter on them. The other columns are then decoded only over the ranges of rows
+   * that contain rows passing the filter; ranges of failing rows long enough to span whole pages
+   * are skipped, and only the pages covering the remaining ranges are read from the column chunks
+   * that have an offset index. This pays off for selective filters on wide tables. Ignored when no
+   * filter is set and by `chunked_parquet_reader`.
+   *
+   * @param val Boolean value whether to enable late materialization
+   */
+  void enable_late_materialization(bool val) { _late_materialization = val; }
+
+  /**
+   * @brief Sets the number of chunks whose data is read ahead by `chunked_parquet_reader`.
+   *
+   * With a depth of `N`, the compressed data of the next `N` chunks is read from the sources while
+   * the current chunk is decompressed and decoded, which hides the storage latency at the cost of
+   * holding up to `N` additional chunks of compressed data in device memory. Ignored by
+   * `read_parquet()`.
+   *
+   * @param depth Number of chunks to read ahead; `0` disables reading ahead
+   */
+  void set_pipeline_depth(size_type depth) { _pipeline_depth = depth; }
+
   /**
    * @brief Sets vector of individual row groups to read.
    *
@@ -164,9 +277,43 @@ class parquet_reader_options {
    */
   void set_row_groups(std::vector<std::vector<size_type>> row_groups)
   {
+    CUDF_EXPECTS(row_groups.empty() or (_skip_rows == 0),
+                 "Can't set row groups along with skip_rows");
+    CUDF_EXPECTS(row_groups.empty() or (_num_rows == -1),
+                 "Can't set row groups along with num_rows");
     _row_groups = std::move(row_groups);
   }
 
+  /**
+   * @brief Sets number of rows to skip from the start.
+   *
+   * Only the pages covering the selected rows are read and decoded for the column chunks that
+   * have an offset index, otherwise whole row groups are read. Row groups are not pruned with the
+   * filter when a row range is selected.
+   *
+   * @param rows Number of rows
+   */
+  void set_skip_rows(size_type rows)
+  {
+    CUDF_EXPECTS(rows >= 0, "skip_rows cannot be negative");
+    CUDF_EXPECTS(rows == 0 or _row_groups.empty(),
+                 "Can't set both skip_rows along with row groups");
+    _skip_rows = rows;
+  }
+
+  /**
+   * @brief Sets number of rows to read.
+   *
+   * @param nrows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   */
+  void set_num_rows(size_type nrows)
+  {
+    CUDF_EXPECTS(nrows >= -1, "num_rows cannot be less than -1");
+    CUDF_EXPECTS(nrows == -1 or _row_groups.empty(),
+                 "Can't set both num_rows along with row groups");
+    _num_rows = nrows;
+  }
+
   /**
    * @brief Sets to enable/disable conversion of strings to categories.
    *
@@ -174,6 +321,19 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable returning dictionary-encoded string columns as dictionary
+   * columns.
+   *
+   * When enabled, top-level string columns whose pages are all dictionary-encoded are returned
+   * as `DICTIONARY32` columns built directly from the Parquet dictionaries instead of being
+   * expanded into strings columns. Other string columns are dictionary-encoded after decoding.
+   * Ignored for columns converted to categories.
+   *
+   * @param val Boolean value to enable/disable dictionary column output
+   */
+  void enable_keep_dictionary_encoding(bool val) { _keep_dictionary_encoding = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -181,6 +341,16 @@ class parquet_reader_options {
    */
   void enable_use_pandas_metadata(bool val) { _use_pandas_metadata = val; }
 
+  /**
+   * @brief Sets to enable/disable caching of parsed file footers across reads.
+   *
+   * Only applies to file path sources. The footer of a file is parsed again when the size or
+   * modification time of the file changes.
+   *
+   * @param val Boolean value whether to cache parsed file footers
+   */
+  void enable_use_metadata_cache(bool val) { _use_metadata_cache = val; }
+
   /**
    * @brief Sets to enable/disable conversion of binary to strings per column.
    *
@@ -245,6 +415,67 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets number of rows to skip from the start.
+   *
+   * @param rows Number of rows
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& skip_rows(size_type rows)
+  {
+    options.set_skip_rows(rows);
+    return *this;
+  }
+
+  /**
+   * @brief Sets number of rows to read.
+   *
+   * @param nrows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& num_rows(size_type nrows)
+  {
+    options.set_num_rows(nrows);
+    return *this;
+  }
+
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * @param filter AST expression to use as filter
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable late materialization of the columns not referenced by the
+   * filter.
+   *
+   * @param val Boolean value whether to enable late materialization
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& late_materialization(bool val)
+  {
+    options.enable_late_materialization(val);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the number of chunks whose data is read ahead by `chunked_parquet_reader`.
+   *
+   * @param depth Number of chunks to read ahead; `0` disables reading ahead
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& pipeline_depth(size_type depth)
+  {
+    options.set_pipeline_depth(depth);
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of strings to categories.
    *
@@ -257,6 +488,19 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable returning dictionary-encoded string columns as dictionary
+   * columns.
+   *
+   * @param val Boolean value to enable/disable dictionary column output
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& keep_dictionary_encoding(bool val)
+  {
+    options._keep_dictionary_encoding = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -269,6 +513,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable caching of parsed file footers across reads.
+   *
+   * @param val Boolean value whether to cache parsed file footers
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& use_metadata_cache(bool val)
+  {
+    options._use_metadata_cache = val;
+    return *this;
+  }
+
   /**
    * @brief Sets enable/disable conversion of binary to strings per column.
    *
@@ -329,6 +585,89 @@ table_with_metadata read_parquet(
   parquet_reader_options const& options,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
+ * tables, chunk by chunk.
+ *
+ * This class is designed to address the reading issue when reading very large Parquet files such
+ * that the sizes of their column exceed the limit that can be stored in cudf column. By reading the
+ * file content by chunks using this class, each chunk is guaranteed to have its sizes stay within
+ * the given limit, except when a single row group alone exceeds it.
+ *
+ * The footer of every source is parsed only once, at construction, and each row group is read and
+ * decoded exactly once across all the calls to `read_chunk()`.
+ *
+ * The following code snippet demonstrates how to read a dataset in chunks:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.parquet");
+ *  auto options = cudf::io::parquet_reader_options::builder(source).build();
+ *  auto reader  = cudf::io::chunked_parquet_reader(1024 * 1024 * 1024, options);
+ *  while (reader.has_next()) {
+ *    auto chunk = reader.read_chunk();
+ *    // process chunk.tbl
+ *  }
+ * @endcode
+ */
+class chunked_parquet_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_parquet_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `parquet_reader_option` parameter as in
+   * `cudf::read_parquet()`, and an additional parameter to specify the size byte limit of the
+   * output table for each reading. Setting `skip_rows` or `num_rows` is not supported; row groups
+   * can be selected with `row_groups`.
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param options The options used to read Parquet file
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_parquet_reader(
+    std::size_t chunk_read_limit,
+    parquet_reader_options const& options,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_parquet_reader();
+
+  /**
+   * @brief Check if there is any data in the given file has not yet read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given Parquet file.
+   *
+   * The sequence of returned tables, if concatenated by their order, guarantees to form a complete
+   * dataset as reading the entire given file at once.
+   *
+   * An empty table will be returned if the given file is empty, or all the data in the file has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::parquet::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -369,6 +708,8 @@ class parquet_writer_options {
   size_t _max_page_size_bytes = default_max_page_size_bytes;
   // Maximum number of rows in a page
   size_type _max_page_size_rows = default_max_page_size_rows;
+  // Maximum size of the dictionary of a column chunk
+  size_t _max_dictionary_size = default_max_dictionary_size;
 
   /**
    * @brief Constructor from sink and table.
@@ -515,6 +856,13 @@ class parquet_writer_options {
     return std::min(_max_page_size_rows, get_row_group_size_rows());
   }
 
+  /**
+   * @brief Returns the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * @return Maximum dictionary size, in bytes
+   */
+  auto get_max_dictionary_size() const { return _max_dictionary_size; }
+
   /**
    * @brief Sets partitions.
    *
@@ -631,6 +979,13 @@ class parquet_writer_options {
       "The maximum page size cannot be smaller than the fragment size, which is 5000 rows.");
     _max_page_size_rows = size_rows;
   }
+
+  /**
+   * @brief Sets the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * @param size_bytes Maximum dictionary size, in bytes to set
+   */
+  void set_max_dictionary_size(size_t size_bytes) { _max_dictionary_size = size_bytes; }
 };
 
 /**
@@ -792,6 +1147,21 @@ class parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * The dictionary of a chunk holds the values of its leading pages until it would grow past
+   * this size, the remaining pages are encoded as PLAIN.
+   *
+   * @param val maximum dictionary size
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& max_dictionary_size(size_t val)
+  {
+    options.set_max_dictionary_size(val);
+    return *this;
+  }
+
   /**
    * @brief Sets whether int96 timestamps are written or not in parquet_writer_options.
    *
@@ -879,6 +1249,8 @@ class chunked_parquet_writer_options {
   size_t _max_page_size_bytes = default_max_page_size_bytes;
   // Maximum number of rows in a page
   size_type _max_page_size_rows = default_max_page_size_rows;
+  // Maximum size of the dictionary of a column chunk
+  size_t _max_dictionary_size = default_max_dictionary_size;
 
   /**
    * @brief Constructor from sink.
@@ -981,6 +1353,13 @@ class chunked_parquet_writer_options {
     return std::min(_max_page_size_rows, get_row_group_size_rows());
   }
 
+  /**
+   * @brief Returns the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * @return Maximum dictionary size, in bytes
+   */
+  auto get_max_dictionary_size() const { return _max_dictionary_size; }
+
   /**
    * @brief Sets metadata.
    *
@@ -1073,6 +1452,13 @@ class chunked_parquet_writer_options {
     _max_page_size_rows = size_rows;
   }
 
+  /**
+   * @brief Sets the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * @param size_bytes Maximum dictionary size, in bytes to set
+   */
+  void set_max_dictionary_size(size_t size_bytes) { _max_dictionary_size = size_bytes; }
+
   /**
    * @brief creates builder to build chunked_parquet_writer_options.
    *
@@ -1222,6 +1608,21 @@ class chunked_parquet_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the maximum size of the dictionary of a column chunk, in bytes.
+   *
+   * The dictionary of a chunk holds the values of its leading pages until it would grow past
+   * this size, the remaining pages are encoded as PLAIN.
+   *
+   * @param val maximum dictionary size
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& max_dictionary_size(size_t val)
+  {
+    options.set_max_dictionary_size(val);
+    return *this;
+  }
+
   /**
    * @brief move chunked_parquet_writer_options member once it's built.
    */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file parquet_metadata.hpp
+ * @brief cuDF-IO freeform API
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+/**
+ * @brief Node of the schema tree of a Parquet file.
+ *
+ * Types and repetitions are given by their names in the Parquet format, e.g. `"INT64"` and
+ * `"OPTIONAL"`.
+ */
+struct parquet_column_schema {
+  std::string name;                             ///< Column name
+  std::string physical_type;                    ///< Physical type of a leaf, empty for a group
+  std::string repetition;                       ///< `"REQUIRED"`, `"OPTIONAL"` or `"REPEATED"`
+  std::vector<parquet_column_schema> children;  ///< Child columns of a group
+};
+
+/**
+ * @brief Statistics of a column chunk, as stored in the file footer.
+ *
+ * The minimum and maximum are raw bytes in the PLAIN encoding of the physical type of the column.
+ */
+struct parquet_column_chunk_statistics {
+  std::optional<int64_t> null_count;      ///< Number of nulls
+  std::optional<int64_t> distinct_count;  ///< Number of distinct values
+  std::optional<std::string> min_value;   ///< Minimum value
+  std::optional<std::string> max_value;   ///< Maximum value
+};
+
+/**
+ * @brief Metadata of a column chunk of a row group.
+ *
+ * The sizes include the page headers. The number of values includes the nulls, and the empty
+ * lists and null parents of nested columns.
+ */
+struct parquet_column_chunk_metadata {
+  std::vector<std::string> path_in_schema;  ///< Names from the root to the column
+  std::string compression;                  ///< Compression codec, e.g. `"SNAPPY"`
+  std::vector<std::string> encodings;       ///< Encodings of the pages, e.g. `"PLAIN"`
+  int64_t num_values;                       ///< Number of values
+  int64_t compressed_size;                  ///< Size of the pages in the file
+  int64_t uncompressed_size;                ///< Size of the uncompressed pages
+  std::optional<parquet_column_chunk_statistics> statistics;  ///< Statistics, if written
+};
+
+/**
+ * @brief Metadata of a row group.
+ */
+struct parquet_row_group_metadata {
+  int64_t num_rows;                                    ///< Number of rows
+  int64_t total_byte_size;                             ///< Uncompressed size of the column data
+  std::vector<parquet_column_chunk_metadata> columns;  ///< Column chunks, one per leaf column
+};
+
+/**
+ * @brief Metadata of a Parquet file, as read from its footer.
+ */
+struct parquet_metadata {
+  parquet_column_schema schema;                           ///< Root of the schema tree
+  int64_t num_rows;                                       ///< Number of rows in the file
+  std::vector<parquet_row_group_metadata> row_groups;     ///< Metadata of each row group
+  std::map<std::string, std::string> key_value_metadata;  ///< Key-value metadata of the file
+};
+
+/**
+ * @brief Reads the schema, and the sizes, statistics and encodings of the row groups of a Parquet
+ * file.
+ *
+ * @ingroup io_readers
+ *
+ * Only the footer of the file is read, which makes this suitable to plan reads of large datasets.
+ *
+ * The following code snippet demonstrates how to read the metadata of a file:
+ * @code
+ *  auto metadata = cudf::io::read_parquet_metadata(cudf::io::source_info("dataset.parquet"));
+ * @endcode
+ *
+ * @param src_info Dataset source
+ *
+ * @return Metadata of the file
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info);
+
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace cudf {
+namespace io {
+/**
+ * @addtogroup io_apis
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Usage statistics of the pinned host memory pool used for IO staging buffers
+ */
+struct pinned_memory_pool_stats {
+  std::size_t pool_size;                 ///< Size of the pool in bytes
+  std::size_t bytes_in_use;              ///< Bytes currently allocated from the pool
+  std::size_t peak_bytes_in_use;         ///< Largest number of bytes allocated from the pool
+  std::size_t num_allocations;           ///< Total number of allocations served from the pool
+  std::size_t num_fallback_allocations;  ///< Allocations that did not fit and used cudaMallocHost
+};
+
+/**
+ * @brief Sets the size of the pinned host memory pool used by the readers and writers for their
+ * host staging buffers.
+ *
+ * The pool is allocated on first use, so setting the size does not allocate any memory. A size of
+ * zero disables the pool and every staging buffer is allocated with `cudaMallocHost`. Without a
+ * call to this function, the size is taken from the `LIBCUDF_PINNED_POOL_SIZE` environment
+ * variable and defaults to 64MB.
+ *
+ * @throws cudf::logic_error if allocations from the current pool are still in use
+ *
+ * @param size Size of the pool in bytes
+ */
+void set_pinned_memory_pool_size(std::size_t size);
+
+/**
+ * @brief Returns the usage statistics of the pinned host memory pool.
+ *
+ * @return Statistics of the pool
+ */
+pinned_memory_pool_stats get_pinned_memory_pool_stats();
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
+#include <cudf/io/types.hpp>
 #include <cudf/scalar/scalar.hpp>
 
 #include <rmm/device_buffer.hpp>
@@ -237,6 +238,22 @@ std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& file
   return std::make_unique<file_data_chunk_source>(filename);
 }
 
+/**
+ * @brief Creates a data source capable of producing device-buffered views of the decompressed
+ * contents of the file
+ *
+ * The file is inflated on the host in bounded blocks as chunks are requested, so memory use is
+ * independent of the file size. Each reader created from the source decompresses the file from
+ * the beginning, and skipped bytes are decompressed and discarded.
+ *
+ * @throw cudf::logic_error if `compression` is not `GZIP` or `ZLIB`
+ *
+ * @param filename Path of the compressed file
+ * @param compression Compression format of the file
+ */
+std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename,
+                                                         compression_type compression);
+
 /**
  * @brief Creates a data source capable of producing views of the given device string scalar
  */
@@ -83,6 +83,20 @@ struct trie_device_view {
    */
   constexpr bool is_match(uint16_t idx) { return static_cast<bool>(get_match_length(idx)); }
 
+  /**
+   * @brief returns true if any partial path in the given multistate ends in a matching state.
+   *
+   * Unlike checking only the deepest path, this also reports a delimiter which completes while a
+   * longer one is still partially matched.
+   */
+  constexpr bool is_match(multistate const& states)
+  {
+    for (uint8_t i = 0; i < states.size(); i++) {
+      if (is_match(states.get_tail(i))) { return true; }
+    }
+    return false;
+  }
+
   /**
    * @brief returns the match length if the given index is associated with a matching state,
    * otherwise zero.
@@ -25,6 +25,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -78,6 +80,65 @@ std::unique_ptr<cudf::column> multibyte_split(data_chunk_source const& source,
                                               std::string const& delimiter,
                                               rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Splits the source text into a strings column using a set of multiple byte delimiters.
+ *
+ * All delimiters are matched in the same pass over the source, so a record ends wherever any of
+ * them is found. This allows e.g. splitting text with mixed line endings by `{"\n", "\r\n"}`.
+ * Where one delimiter is a suffix of another, as with `"\n"` and `"\r\n"`, the record ends after
+ * the longer delimiter. Byte range semantics match those of the single delimiter overload.
+ *
+ * @throw cudf::logic_error if `delimiters` is empty or contains an empty delimiter
+ *
+ * @param source The source string
+ * @param delimiters UTF-8 encoded strings for which to find offsets in the source
+ * @param byte_range range in which to consider offsets relevant
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiters within the relevant byte
+ * range.
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  std::optional<byte_range_info> byte_range = std::nullopt,
+  rmm::mr::device_memory_resource* mr       = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Finds the record offsets `multibyte_split` would produce, without copying the records.
+ *
+ * Returns an INT64 column of `num_records + 1` byte offsets into the source, where record `i`
+ * spans `[offsets[i], offsets[i + 1])` and includes its trailing delimiter. The offsets are
+ * absolute positions in the source, not relative to the byte range. This lets callers which
+ * tokenize the records themselves, e.g. from a device copy of the source they already hold, skip
+ * materializing an intermediate strings column.
+ *
+ * @code{.pseudo}
+ * Examples:
+ *  source:     "abc..def..ghi..jkl.."
+ *  delimiters: [".."]
+ *
+ *  byte_range: nullopt
+ *  return:     [0, 5, 10, 15, 20, 20]
+ *
+ *  byte_range: [2, 9)
+ *  return:     [5, 10, 15]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `delimiters` is empty or contains an empty delimiter
+ *
+ * @param source The source string
+ * @param delimiters UTF-8 encoded strings for which to find offsets in the source
+ * @param byte_range range in which to consider offsets relevant
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The offsets of the records found by splitting the source by the delimiters within the
+ * relevant byte range.
+ */
+std::unique_ptr<cudf::column> multibyte_split_offsets(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  std::optional<byte_range_info> byte_range = std::nullopt,
+  rmm::mr::device_memory_resource* mr       = rmm::mr::get_current_device_resource());
+
 }  // namespace text
 }  // namespace io
 }  // namespace cudf
@@ -97,6 +97,15 @@ enum statistics_freq {
   STATISTICS_COLUMN   = 3,  ///< Full column and offset indices. Implies STATISTICS_ROWGROUP
 };
 
+/**
+ * @brief Data encoding of a column for the parquet writer
+ */
+enum class column_encoding {
+  USE_DEFAULT,          ///< Dictionary encoding when beneficial, plain encoding otherwise
+  DELTA_BINARY_PACKED,  ///< Delta encoding of integers, for INT32 and INT64 physical types
+  BYTE_STREAM_SPLIT,    ///< Byte stream split encoding, for FLOAT and DOUBLE physical types
+};
+
 /**
  * @brief Detailed name information for output columns.
  *
@@ -387,6 +396,9 @@ class column_in_metadata {
   bool _list_column_is_map  = false;
   bool _use_int96_timestamp = false;
   bool _output_as_binary    = false;
+  column_encoding _encoding = column_encoding::USE_DEFAULT;
+  bool _bloom_filter        = false;
+  bool _statistics          = true;
   std::optional<uint8_t> _decimal_precision;
   std::optional<int32_t> _parquet_field_id;
   std::vector<column_in_metadata> children;
@@ -503,6 +515,54 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Sets the data encoding to use for this column.
+   *
+   * Only applies to leaf columns. Dictionary encoding is not used for columns with an explicit
+   * encoding.
+   *
+   * @param encoding The encoding to use
+   * @return this for chaining
+   */
+  column_in_metadata& set_encoding(column_encoding encoding)
+  {
+    _encoding = encoding;
+    return *this;
+  }
+
+  /**
+   * @brief Specifies whether to write a Bloom filter for each column chunk of this column.
+   *
+   * Only applies to leaf columns. The parquet reader uses the filters to skip row groups that
+   * cannot match equality predicates of the read filter. The ORC writer writes a filter for each
+   * row group of integer, floating point, date and string columns, and the ORC reader uses them
+   * to skip stripes in the same way.
+   *
+   * @param enabled Boolean value to enable/disable writing Bloom filters
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool enabled)
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
+  /**
+   * @brief Specifies whether to write statistics for this column.
+   *
+   * Only applies to leaf columns, and only when the writer options enable statistics. The parquet
+   * writer skips computing the statistics of a disabled column, and writes neither chunk nor page
+   * statistics nor a ColumnIndex for it.
+   *
+   * @param enabled Boolean value to enable/disable writing statistics
+   * @return this for chaining
+   */
+  column_in_metadata& set_statistics(bool enabled)
+  {
+    _statistics = enabled;
+    return *this;
+  }
+
   /**
    * @brief Get reference to a child of this column
    *
@@ -602,6 +662,27 @@ class column_in_metadata {
    * @return Boolean indicating whether to encode this column as binary data
    */
   [[nodiscard]] bool is_enabled_output_as_binary() const { return _output_as_binary; }
+
+  /**
+   * @brief Get the data encoding requested for this column
+   *
+   * @return The requested encoding
+   */
+  [[nodiscard]] column_encoding get_encoding() const { return _encoding; }
+
+  /**
+   * @brief Get whether to write Bloom filters for this column
+   *
+   * @return Boolean indicating whether to write Bloom filters for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const { return _bloom_filter; }
+
+  /**
+   * @brief Get whether to write statistics for this column
+   *
+   * @return Boolean indicating whether to write statistics for this column
+   */
+  [[nodiscard]] bool is_enabled_statistics() const { return _statistics; }
 };
 
 /**
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -24,9 +26,12 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <functional>
+#include <memory>
 #include <optional>
 #include <utility>
 #include <vector>
@@ -87,6 +92,74 @@ inner_join(cudf::table_view const& left_keys,
            null_equality compare_nulls         = null_equality::EQUAL,
            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Callback receiving the join result of one hash partition of a partitioned join.
+ *
+ * The vectors hold matching row indices into the left and right tables respectively.
+ */
+using partitioned_join_callback =
+  std::function<void(std::unique_ptr<rmm::device_uvector<size_type>> left_indices,
+                     std::unique_ptr<rmm::device_uvector<size_type>> right_indices)>;
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, computed one hash partition at a time.
+ *
+ * Both tables are hash partitioned on their keys into `num_partitions` partitions, and each pair
+ * of corresponding partitions is joined separately. The hash table of each join therefore only
+ * covers one partition of the build side, which keeps it within cache or memory budgets for build
+ * tables that are too large to join in one pass. The result is the same set of index pairs as
+ * `inner_join` returns, in a different unspecified order.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of hash partitions to join separately
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys .
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  size_type num_partitions,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a partitioned inner join, passing the result of each partition to `callback`
+ * instead of concatenating them.
+ *
+ * The callback is invoked once for every partition with at least one match, with the index
+ * vectors of that partition only. This lets the caller spill each partition's result to host
+ * memory, or otherwise consume it, before the next partition is joined, so device memory use is
+ * bounded by the largest partition rather than by the whole join result.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::logic_error if `num_partitions` is not positive.
+ *
+ * @param[in] left_keys The left table
+ * @param[in] right_keys The right table
+ * @param[in] num_partitions The number of hash partitions to join separately
+ * @param[in] callback Receives the left and right row indices of each partition's matches
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the indices passed to `callback`
+ */
+void partitioned_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  size_type num_partitions,
+  partitioned_join_callback const& callback,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a pair of row index vectors corresponding to a
  * left join between the specified tables.
@@ -127,6 +200,139 @@ left_join(cudf::table_view const& left_keys,
           null_equality compare_nulls         = null_equality::EQUAL,
           rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, whose keys are both sorted in the given order.
+ *
+ * Instead of building a hash table, the matching rows of `right_keys` are found by a binary search
+ * for each row of `left_keys`, so no additional memory is needed beyond the result. The returned
+ * gather maps are ordered: the left indices are in ascending order, and so are the right indices
+ * matched to each left row. Gathering with them therefore produces a table that is still sorted on
+ * the join keys.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 3}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 3}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::logic_error if either table is not sorted according to `column_order` and
+ * `null_precedence`.
+ *
+ * @param[in] left_keys The left table, sorted
+ * @param[in] right_keys The right table, sorted the same way as `left_keys`
+ * @param[in] column_order The sort order of each key column. Empty means ascending for all columns
+ * @param[in] null_precedence The order of nulls in each key column. Empty means `BEFORE` for all
+ * columns
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of ordered vectors [`left_indices`, `right_indices`] that can be used to
+ * construct the result of performing an inner join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the specified
+ * tables, whose keys are both sorted in the given order.
+ *
+ * Like `sort_merge_inner_join`, except that every row of `left_keys` appears in the result. Rows
+ * without a match are paired with an unspecified out-of-bounds right index. The returned gather
+ * maps are ordered as for `sort_merge_inner_join`.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 3}}
+ * Right: {{1, 1, 2}}
+ * Result: {{0, 1, 1, 2}, {None, 0, 1, None}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys` mismatch.
+ * @throw cudf::logic_error if either table is not sorted according to `column_order` and
+ * `null_precedence`.
+ *
+ * @param[in] left_keys The left table, sorted
+ * @param[in] right_keys The right table, sorted the same way as `left_keys`
+ * @param[in] column_order The sort order of each key column. Empty means ascending for all columns
+ * @param[in] null_precedence The order of nulls in each key column. Empty means `BEFORE` for all
+ * columns
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of ordered vectors [`left_indices`, `right_indices`] that can be used to
+ * construct the result of performing a left join between two tables with `left_keys` and
+ * `right_keys` as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(
+  cudf::table_view const& left_keys,
+  cudf::table_view const& right_keys,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  null_equality compare_nulls                    = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner interval join between the
+ * specified tables.
+ *
+ * A row of the left tables matches a row of the right tables if their keys are equal and the
+ * left point lies within the closed interval `[start, end]` of the right row, as in
+ * `left.point BETWEEN right.start AND right.end`. The left rows are sorted by key and point, so
+ * the left rows matching a right row form the contiguous range between the lower bound of the
+ * right row's start and the upper bound of its end, and no pair of rows outside of the result is
+ * ever compared. Rows with a null point, start or end match nothing, and intervals whose start
+ * is greater than their end are empty.
+ *
+ * The result is ordered by right row, and the left rows matching a right row are ordered by
+ * point.
+ *
+ * @code{.pseudo}
+ * Left keys: {{0, 0, 1, 1}}
+ * Left points: {1, 5, 2, 3}
+ * Right keys: {{0, 1}}
+ * Right starts: {0, 2}
+ * Right ends: {4, 2}
+ * Result: {{0, 2}, {0, 1}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if the number of columns of `left_keys` and `right_keys` mismatch.
+ * @throw cudf::logic_error if the number of rows of `left_keys` and `left_points`, or of
+ * `right_keys`, `right_starts` and `right_ends` mismatch.
+ * @throw cudf::logic_error if `left_points`, `right_starts` and `right_ends` differ in type.
+ *
+ * @param[in] left_keys The equality keys of the left table, which may have no columns
+ * @param[in] left_points The points of the left table
+ * @param[in] right_keys The equality keys of the right table
+ * @param[in] right_starts The first point of the interval of each right row
+ * @param[in] right_ends The last point of the interval of each right row
+ * @param[in] compare_nulls controls whether null join-key values should match or not.
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct the
+ * result of performing an interval join between the two tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_inner_join(
+  cudf::table_view const& left_keys,
+  cudf::column_view const& left_points,
+  cudf::table_view const& right_keys,
+  cudf::column_view const& right_starts,
+  cudf::column_view const& right_ends,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a pair of row index vectors corresponding to a
  * full join between the specified tables.
@@ -256,12 +462,81 @@ std::unique_ptr<cudf::table> cross_join(
   cudf::table_view const& right,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Callback receiving one chunk of the result of a chunked cross join.
+ *
+ * The chunk holds the columns of the left table followed by the columns of the right table.
+ */
+using cross_join_callback = std::function<void(std::unique_ptr<cudf::table> chunk)>;
+
+/**
+ * @brief Performs a cross join on two tables (`left`, `right`), passing the result to `callback`
+ * in chunks of at most `max_chunk_rows` rows instead of materializing it at once.
+ *
+ * The chunks are passed in order and their concatenation equals the result of `cross_join`. Each
+ * chunk is gathered from the input tables through row indices computed for that chunk only, so
+ * device memory use is bounded by the chunk size rather than by `left.num_rows() *
+ * right.num_rows()`. The callback is not invoked if either table has no rows.
+ *
+ * @throw cudf::logic_error if the number of columns in either `left` or `right` table is 0
+ * @throw cudf::logic_error if `max_chunk_rows` is not positive
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param max_chunk_rows The maximum number of rows of a chunk
+ * @param callback Receives the chunks of the result
+ * @param mr Device memory resource used to allocate the chunks' device memory
+ */
+void chunked_cross_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  size_type max_chunk_rows,
+  cross_join_callback const& callback,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs a cross join on two tables (`left`, `right`) filtered by `binary_predicate`,
+ * passing the pairs of rows that satisfy it to `callback` in chunks.
+ *
+ * The cartesian product is split into tiles of at most `max_chunk_rows` pairs of rows, and each
+ * tile is joined with `conditional_inner_join` before the next one is processed. Only the
+ * matching pairs of a tile are gathered, so the full product is never materialized and every
+ * chunk has at most `max_chunk_rows` rows. The callback is not invoked for tiles without any
+ * match. The rows of the concatenated chunks are those of
+ * `conditional_inner_join(left, right, binary_predicate)` in an unspecified order.
+ *
+ * @throw cudf::logic_error if the number of columns in either `left` or `right` table is 0
+ * @throw cudf::logic_error if `max_chunk_rows` is not positive
+ * @throw cudf::logic_error if the binary predicate outputs a non-boolean result
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param binary_predicate The condition on which to keep a pair of rows
+ * @param max_chunk_rows The maximum number of pairs of rows joined at once
+ * @param callback Receives the chunks of the result
+ * @param mr Device memory resource used to allocate the chunks' device memory
+ */
+void chunked_cross_join(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  ast::expression const& binary_predicate,
+  size_type max_chunk_rows,
+  cross_join_callback const& callback,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
  *
  * This class enables the hash join scheme that builds hash table once, and probes as many times as
  * needed (possibly in parallel).
+ *
+ * All probe member functions are `const` and do not modify the object, so once the stream the
+ * object was constructed on has been synchronized, they may be called concurrently from multiple
+ * host threads, each on its own stream.
+ *
+ * The keys may contain struct and list columns. The rows of keys with list columns are hashed once
+ * in a separate pass before the hash table is built or probed.
  */
 class hash_join {
  public:
@@ -289,13 +564,49 @@ class hash_join {
             null_equality compare_nulls,
             rmm::cuda_stream_view stream = cudf::default_stream_value);
 
+  /**
+   * @brief Construct a hash join object from the output of `pack()`.
+   *
+   * This rebuilds the hash table of the packed hash join from its stored row hashes, so that the
+   * build rows are not hashed again. The packed data may have been copied from another process or
+   * device, e.g. to share a hash join over a dimension table instead of rebuilding it per query.
+   *
+   * @note The `hash_join` object must not outlive `packed`, else behavior is undefined.
+   *
+   * @throw cudf::logic_error if `packed` was not produced by `pack()`
+   *
+   * @param packed The packed build table and row hashes of a hash join
+   * @param compare_nulls Controls whether null join-key values should match or not. This should be
+   * the value the packed hash join was constructed with
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_join(packed_columns const& packed,
+            null_equality compare_nulls,
+            rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Pack the build table and the hashes of its rows into contiguous buffers.
+   *
+   * The result has the format of `cudf::pack`, so it can be serialized, shipped and cached like
+   * any packed table, and be turned back into a `hash_join` by the `packed_columns` constructor.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned device buffer
+   * @return The packed build table and row hashes
+   */
+  [[nodiscard]] packed_columns pack(
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the row indices that can be used to construct the result of performing
    * an inner join between two tables. @see cudf::inner_join(). Behavior is undefined if the
    * provided `output_size` is smaller than the actual output size.
    *
    * @param probe The probe table, from which the tuples are probed
-   * @param output_size Optional value which allows users to specify the exact output size
+   * @param output_size Optional value which allows users to specify the exact output size. If
+   * omitted, the output is allocated from a sampled estimate and filled in a single probe pass,
+   * which is only repeated if the estimate turns out too small
    * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
@@ -317,7 +628,9 @@ class hash_join {
    * provided `output_size` is smaller than the actual output size.
    *
    * @param probe The probe table, from which the tuples are probed
-   * @param output_size Optional value which allows users to specify the exact output size
+   * @param output_size Optional value which allows users to specify the exact output size. If
+   * omitted, the output is allocated from a sampled estimate and filled in a single probe pass,
+   * which is only repeated if the estimate turns out too small
    * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
@@ -339,7 +652,9 @@ class hash_join {
    * provided `output_size` is smaller than the actual output size.
    *
    * @param probe The probe table, from which the tuples are probed
-   * @param output_size Optional value which allows users to specify the exact output size
+   * @param output_size Optional value which allows users to specify the exact output size. If
+   * omitted, the output is allocated from a sampled estimate and filled in a single probe pass,
+   * which is only repeated if the estimate turns out too small
    * @param stream CUDA stream used for device memory operations and kernel launches
    * @param mr Device memory resource used to allocate the returned table and columns' device
    * memory.
@@ -402,6 +717,94 @@ class hash_join {
   const std::unique_ptr<const impl_type> _impl;
 };
 
+/**
+ * @brief Blocked Bloom filter over the rows of a key table.
+ *
+ * A compact, probabilistic summary of a build table which can cheaply rule out probe rows that
+ * have no match, e.g. before a semi join or a very selective inner join, so that most misses skip
+ * the hash table lookup. `contains` never returns false for a row that has a match in the build
+ * table, but may return true for a row that has none.
+ *
+ * The filter is split into blocks of 256 bits, and each row sets one bit in each of the eight
+ * 32-bit words of the block selected by its hash, so a lookup touches a single 32-byte sector.
+ * Rows are hashed with the same row hasher as the hash-based joins.
+ *
+ * The filter bits are exposed through `data()`, and a filter can be reconstructed from them, so a
+ * filter built on one rank can be shipped to and applied on another.
+ */
+class bloom_filter {
+ public:
+  /// Number of bits in each block of the filter
+  static constexpr std::size_t bits_per_block = 256;
+
+  bloom_filter() = delete;
+
+  /**
+   * @brief Construct a Bloom filter over the rows of `build`.
+   *
+   * @throw cudf::logic_error if `bits_per_row` is not positive
+   *
+   * @param build The table whose rows are inserted into the filter
+   * @param compare_nulls Controls whether null join-key values should match or not. If `UNEQUAL`,
+   * rows containing a null are not inserted and always miss
+   * @param bits_per_row Size of the filter in bits per row of `build`. About 10 bits per row give a
+   * false positive rate of around 1%
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the filter bits
+   */
+  bloom_filter(cudf::table_view const& build,
+               null_equality compare_nulls         = null_equality::EQUAL,
+               double bits_per_row                 = 10.0,
+               rmm::cuda_stream_view stream        = cudf::default_stream_value,
+               rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Reconstruct a Bloom filter from the bits of another filter, e.g. one built on a
+   * different rank.
+   *
+   * @throw cudf::logic_error if the size of `bits` is not a positive multiple of the block size
+   *
+   * @param bits The filter bits as returned by `data()`
+   * @param compare_nulls The null equality the filter was built with
+   */
+  bloom_filter(rmm::device_buffer&& bits, null_equality compare_nulls);
+
+  /**
+   * @brief Test which rows of `probe` may have a match in the filtered table.
+   *
+   * @throw cudf::logic_error if `probe` does not have the same number of columns as the table the
+   * filter was built from
+   *
+   * @param probe The table whose rows are tested
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column which is false for each row of `probe` that definitely has no match
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the bits of the filter, `bits_per_block / 8` bytes per block
+   *
+   * @return The device buffer holding the filter bits
+   */
+  [[nodiscard]] rmm::device_buffer const& data() const { return _bits; }
+
+  /**
+   * @brief Returns the number of blocks in the filter
+   *
+   * @return The number of blocks
+   */
+  [[nodiscard]] std::size_t num_blocks() const { return _bits.size() / (bits_per_block / 8); }
+
+ private:
+  rmm::device_buffer _bits;
+  null_equality _compare_nulls;
+  size_type _num_columns = -1;  ///< columns of the build table, unknown for reconstructed filters
+};
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs
  * of rows between the specified tables where the predicate evaluates to true.
@@ -729,6 +1132,87 @@ mixed_left_join(
   std::optional<std::pair<std::size_t, device_span<size_type const>>> output_size_data = {},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the same pairs of row indices as `mixed_inner_join`, evaluating the predicate with
+ * a kernel JIT-compiled for the expression instead of the AST interpreter.
+ *
+ * The pairs of rows with equal equality columns are found with a hash join, after which the
+ * predicate is evaluated on each of them by a kernel whose code is generated from the expression.
+ * The kernel is cached by the structure of the expression and the types and nullability of the
+ * columns it references, so joining other tables or using other literal values with the same
+ * shape of predicate does not recompile it. This is beneficial for predicates that are costly to
+ * interpret and are evaluated repeatedly.
+ *
+ * Only numeric and boolean columns and literals are supported. The operators on them are
+ * supported the same as for `cudf::jit_compute_column`.
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the binary predicate uses an unsupported operator, column type or
+ * literal type.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ *
+ * @param left_equality The left table used for the equality join
+ * @param right_equality The right table used for the equality join
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param binary_predicate The condition on which to join
+ * @param compare_nulls Whether or not null values join to each other or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed inner join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_inner_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the same pairs of row indices as `mixed_left_join`, evaluating the predicate with
+ * a kernel JIT-compiled for the expression instead of the AST interpreter.
+ *
+ * The predicate is evaluated as in `jit_mixed_inner_join`, with the same restrictions on the
+ * expression. Rows of the left tables without any match are paired with an out-of-bounds index.
+ *
+ * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+ * @throw cudf::logic_error If the binary predicate uses an unsupported operator, column type or
+ * literal type.
+ * @throw cudf::logic_error If the number of rows in left_equality and left_conditional do not
+ * match.
+ * @throw cudf::logic_error If the number of rows in right_equality and right_conditional do not
+ * match.
+ *
+ * @param left_equality The left table used for the equality join
+ * @param right_equality The right table used for the equality join
+ * @param left_conditional The left table used for the conditional join
+ * @param right_conditional The right table used for the conditional join
+ * @param binary_predicate The condition on which to join
+ * @param compare_nulls Whether or not null values join to each other or not
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a mixed left join between the four input tables.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_left_join(
+  table_view const& left_equality,
+  table_view const& right_equality,
+  table_view const& left_conditional,
+  table_view const& right_conditional,
+  ast::expression const& binary_predicate,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a pair of row index vectors corresponding to all pairs of
  * rows between the specified tables where the columns of the equality table
@@ -75,5 +75,90 @@ std::unique_ptr<column> label_bins(
   inclusive right_inclusive,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Labels elements based on membership in `num_bins` bins of equal width.
+ *
+ * The range `[lower, upper]` is split into `num_bins` bins of width `(upper - lower) / num_bins`.
+ * Bin `i` holds the values `v` with `lower + i * width <= v < lower + (i + 1) * width`, except
+ * that the last bin also holds `upper`. The label of each value is computed directly from the
+ * value instead of searching the edges, so this is faster than the overload taking edge columns.
+ *
+ * Notes:
+ *   - NULL elements in `input` belong to no bin and their corresponding label is NULL.
+ *   - NaN elements and elements outside of `[lower, upper]` belong to no bin and their
+ *     corresponding label is NULL.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric type.
+ * @throws cudf::logic_error if `num_bins <= 0` or `lower >= upper`.
+ *
+ * @param input The input elements to label according to the bins.
+ * @param lower Left edge of the first bin.
+ * @param upper Right edge of the last bin.
+ * @param num_bins Number of bins.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return The integer labels of the elements in `input` according to the bins.
+ */
+std::unique_ptr<column> label_bins(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements in each of `num_bins` bins of equal width.
+ *
+ * The bins are those of the uniform `label_bins` overload, and `output[i]` is the number of
+ * elements it would label `i`. Elements that it would label NULL are not counted. The counts
+ * are accumulated in shared memory per thread block without materializing the labels.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric type.
+ * @throws cudf::logic_error if `num_bins <= 0` or `lower >= upper`.
+ *
+ * @param input The input elements to count.
+ * @param lower Left edge of the first bin.
+ * @param upper Right edge of the last bin.
+ * @param num_bins Number of bins.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return INT64 column of the `num_bins` counts.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Counts the elements of each group in each of `num_bins` bins of equal width.
+ *
+ * Row `g` of the output is the histogram, as computed by the ungrouped `histogram`, of the
+ * elements `input[j]` with `group_labels[j] == g`. Elements whose group label is outside of
+ * `[0, num_groups)` are not counted. For example, the labels that `cudf::label_bins` gives to
+ * another column make a two-dimensional histogram.
+ *
+ * @throws cudf::logic_error if `input` is not a numeric type.
+ * @throws cudf::logic_error if `num_bins <= 0` or `lower >= upper`.
+ * @throws cudf::logic_error if `group_labels` is not INT32, has nulls or differs in size from
+ * `input`.
+ *
+ * @param input The input elements to count.
+ * @param group_labels Group of each element of `input`.
+ * @param num_groups Number of groups.
+ * @param lower Left edge of the first bin.
+ * @param upper Right edge of the last bin.
+ * @param num_bins Number of bins.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return LIST<INT64> column of `num_groups` rows of `num_bins` counts.
+ */
+std::unique_ptr<column> histogram(
+  column_view const& input,
+  column_view const& group_labels,
+  size_type num_groups,
+  double lower,
+  double upper,
+  size_type num_bins,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -172,6 +172,116 @@ std::unique_ptr<column> index_of(
   duplicate_find_option find_option   = duplicate_find_option::FIND_FIRST,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a column of `size_type` values indicating the position of a search key
+ * within each list row in the `lists` column, whose list rows are known to be sorted
+ *
+ * Returns the same result as `index_of(lists, search_key, find_option)`, but finds the key with
+ * a binary search in each list row instead of a linear scan. Long lists are searched
+ * cooperatively by the threads of a warp.
+ *
+ * The elements of every list row must be sorted in `column_order` with nulls placed according
+ * to `null_precedence`, as they are in the output of
+ * `sort_lists(lists, column_order, null_precedence)`. Otherwise the result is undefined.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param find_option Whether to return the position of the first match (`FIND_FIRST`) or
+ * last (`FIND_LAST`)
+ * @param column_order The order of the elements in each list row
+ * @param null_precedence The position of the null elements in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the location of the `search_key`
+ *
+ * @throw cudf::logic_error If `search_key` type does not match the element type in `lists`
+ * @throw cudf::logic_error If `search_key` is of a nested type, or `lists` contains nested
+ * elements (LIST, STRUCT)
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  duplicate_find_option find_option,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of `size_type` values indicating the position of a search key
+ * row within the corresponding list row in the `lists` column, whose list rows are known to be
+ * sorted
+ *
+ * Returns the same result as `index_of(lists, search_keys, find_option)`, but finds the keys
+ * with a binary search in each list row instead of a linear scan. Long lists are searched
+ * cooperatively by the threads of a warp.
+ *
+ * The elements of every list row must be sorted in `column_order` with nulls placed according
+ * to `null_precedence`, as they are in the output of
+ * `sort_lists(lists, column_order, null_precedence)`. Otherwise the result is undefined.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys A column of search keys to be looked up in each corresponding row of
+ * `lists`
+ * @param find_option Whether to return the position of the first match (`FIND_FIRST`) or
+ * last (`FIND_LAST`)
+ * @param column_order The order of the elements in each list row
+ * @param null_precedence The position of the null elements in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> INT32 column of `n` rows with the location of the `search_key`
+ *
+ * @throw cudf::logic_error If `search_keys` does not match `lists` in its number of rows
+ * @throw cudf::logic_error If `search_keys` type does not match the element type in `lists`
+ * @throw cudf::logic_error If `lists` or `search_keys` contains nested elements (LIST, STRUCT)
+ */
+std::unique_ptr<column> index_of(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  duplicate_find_option find_option,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of `bool` values indicating whether the specified scalar
+ * is an element of each row of a list column, whose list rows are known to be sorted
+ *
+ * Returns the same result as `contains(lists, search_key)` using the sorted search of
+ * `index_of(lists, search_key, find_option, column_order, null_precedence)`.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_key The scalar key to be looked up in each list row
+ * @param column_order The order of the elements in each list row
+ * @param null_precedence The position of the null elements in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains(
+  cudf::lists_column_view const& lists,
+  cudf::scalar const& search_key,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a column of `bool` values indicating whether the list rows of the first
+ * column, which are known to be sorted, contain the corresponding values in the second column
+ *
+ * Returns the same result as `contains(lists, search_keys)` using the sorted search of
+ * `index_of(lists, search_keys, find_option, column_order, null_precedence)`.
+ *
+ * @param lists Lists column whose `n` rows are to be searched
+ * @param search_keys Column of elements to be looked up in each list row
+ * @param column_order The order of the elements in each list row
+ * @param null_precedence The position of the null elements in each list row
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return std::unique_ptr<column> BOOL8 column of `n` rows with the result of the lookup
+ */
+std::unique_ptr<column> contains(
+  cudf::lists_column_view const& lists,
+  cudf::column_view const& search_keys,
+  order column_order,
+  null_order null_precedence,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace lists
 }  // namespace cudf
@@ -16,13 +16,18 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 /**
@@ -204,6 +209,71 @@ std::unique_ptr<table> explode_outer_position(
   size_type explode_column_idx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Explodes a list column's elements without duplicating any other column.
+ *
+ * Returns the elements of the lists in `input` together with the index of the row of `input` each
+ * element came from. Gathering any other column of the input table with the parent indices gives
+ * the rows `explode` would have produced for it, so a caller can defer or skip duplicating the
+ * columns it does not need. Example:
+ * ```
+ * input = [[5,10,15], [20,25], null, [], [30]]
+ * returns
+ * elements       = [5, 10, 15, 20, 25, 30]
+ * parent indices = [0,  0,  0,  1,  1,  4]
+ * ```
+ *
+ * As with `explode`, null and empty lists do not produce any element.
+ *
+ * @param input Lists column to explode.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ *
+ * @return The column of exploded elements and the `INT32` column of their parent row indices.
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_with_parent_indices(
+  lists_column_view const& input,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Groups the exploded elements of a list column by the keys of their parent rows and
+ * aggregates them, without exploding the list column.
+ *
+ * The result is the same as exploding `values` with `explode`, grouping the exploded rows by
+ * `keys` and computing `aggregations` on the exploded elements, except that the output type of
+ * `COUNT_VALID` and `COUNT_ALL` is `INT32` and the output type of `SUM` is the sum type of the
+ * partial sums. Each list is first reduced to one partial result per aggregation, and only the
+ * partial results are grouped, so neither `keys` nor the elements are duplicated. Example:
+ * ```
+ * keys         = [1,         2,       1,    3]
+ * values       = [[5,10,15], [20,25], [30], []]
+ * aggregations = [SUM, COUNT_VALID]
+ * returns
+ * group keys   = [1,  2]
+ * results      = [[60, 45], [4, 2]]
+ * ```
+ *
+ * Rows whose list is null or empty do not contribute, so a key appearing only with such lists
+ * does not appear in the output. Rows with a null key are excluded as in `groupby`. The order of
+ * the groups is unspecified.
+ *
+ * @throws cudf::logic_error if `keys` and `values` differ in their number of rows.
+ * @throws cudf::logic_error if an aggregation is not one of `SUM`, `MIN`, `MAX`, `COUNT_VALID`
+ * or `COUNT_ALL`.
+ *
+ * @param keys The keys of the rows of `values`.
+ * @param values Lists column whose elements are aggregated.
+ * @param aggregations The aggregations to compute on the elements of each group.
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory.
+ *
+ * @return The unique keys and one column of results per aggregation, in the order of
+ *         `aggregations`.
+ */
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> explode_groupby_aggregate(
+  table_view const& keys,
+  lists_column_view const& values,
+  std::vector<aggregation::Kind> const& aggregations,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
@@ -34,7 +34,8 @@ namespace cudf {
  * @brief Merge a set of sorted tables.
  *
  * Merges sorted tables into one sorted table
- * containing data from all tables.
+ * containing data from all tables. The merge is stable: rows whose keys
+ * compare equal keep the order of the tables they come from.
  *
  * ```
  * Example 1:
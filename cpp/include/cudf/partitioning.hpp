@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -72,6 +73,114 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   size_type num_partitions,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the splitters which divide sorted keys into `num_partitions` ranges of about
+ * equal size, from a sample of the keys.
+ *
+ * The sample is sorted, and the rows at the `num_partitions - 1` equally spaced positions
+ * `i * sample.num_rows() / num_partitions` for `i` in `[1, num_partitions)` are returned. The
+ * sample is typically taken with `cudf::sample`, possibly gathered from several processes so
+ * that all of them agree on the splitters.
+ *
+ * @code{.pseudo}
+ * sample         = {{7, 1, 9, 4, 3, 8, 2, 6}}
+ * num_partitions = 4
+ * result         = {{3, 6, 8}}
+ * @endcode
+ *
+ * @throw cudf::logic_error if `num_partitions` is not positive
+ * @throw cudf::logic_error if `sample` has no rows and `num_partitions` is larger than 1
+ *
+ * @param sample The sample of the keys to compute the splitters from
+ * @param num_partitions The number of ranges to divide the keys into
+ * @param column_order The desired sort order for each column of `sample`. Size must be equal to
+ * `sample.num_columns()` or empty. If empty, all columns will be sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for
+ * each column of `sample`. Size must be equal to `sample.num_columns()` or empty. If empty, all
+ * columns will be sorted with `null_order::BEFORE`.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A sorted table of `num_partitions - 1` splitter rows
+ */
+std::unique_ptr<table> range_partition_splitters(
+  table_view const& sample,
+  size_type num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions the rows of `input` into the ranges of their keys delimited by `splitters`.
+ *
+ * Row `i` belongs to partition `p` when `p` splitters are ordered before or equal to the keys of
+ * the row, i.e. `p` is the upper bound of the keys of the row in `splitters`. Rows with keys
+ * equal to a splitter therefore belong to the partition after that splitter. Concatenating the
+ * partitions after sorting each of them yields `input` sorted by its keys.
+ *
+ * The rows are rearranged as by `cudf::partition`, so the returned offsets have the same meaning
+ * and the order of the rows within each partition is undefined.
+ *
+ * @code{.pseudo}
+ * input     = {{5, 1, 9, 3, 6, 8}, {a, b, c, d, e, f}}
+ * key_cols  = {0}
+ * splitters = {{3, 6}}
+ * result    = {{1, 5, 3, 9, 6, 8}, {b, a, d, c, e, f}}, offsets = {0, 1, 3, 6}
+ * @endcode
+ *
+ * @throw std::out_of_range if an index in `key_cols` is invalid
+ * @throw cudf::logic_error if `splitters` does not have the columns and types of the keys
+ *
+ * @param input The table to partition
+ * @param key_cols Indices of the columns of `input` to partition by
+ * @param splitters The `num_partitions - 1` boundaries of the partitions, sorted by
+ * `column_order` and `null_precedence`
+ * @param column_order The sort order of each key column. Size must be equal to
+ * `key_cols.size()` or empty. If empty, all columns are ordered ascending.
+ * @param null_precedence The order of a null element compared to other elements for each key
+ * column. Size must be equal to `key_cols.size()` or empty. If empty, nulls are ordered before
+ * other elements.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Pair containing the reordered table and vector of `num_partitions + 1` offsets to each
+ * partition, or an empty table and no offsets if `input` is empty
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  table_view const& splitters,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions the rows of `input` into `num_partitions` ranges of their keys of about
+ * equal size.
+ *
+ * The splitters are computed by `range_partition_splitters` from a random sample of
+ * `num_partitions * 32` rows of the keys, or from all of them for smaller inputs. The rows are
+ * then partitioned as by `range_partition` with those splitters.
+ *
+ * @throw std::out_of_range if an index in `key_cols` is invalid
+ * @throw cudf::logic_error if `num_partitions` is not positive
+ *
+ * @param input The table to partition
+ * @param key_cols Indices of the columns of `input` to partition by
+ * @param num_partitions The number of partitions
+ * @param column_order The sort order of each key column. Size must be equal to
+ * `key_cols.size()` or empty. If empty, all columns are ordered ascending.
+ * @param null_precedence The order of a null element compared to other elements for each key
+ * column. Size must be equal to `key_cols.size()` or empty. If empty, nulls are ordered before
+ * other elements.
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Pair containing the reordered table and vector of `num_partitions + 1` offsets to each
+ * partition, or an empty table and no offsets if `input` is empty
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  size_type num_partitions,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Partitions rows from the input table into multiple output tables.
  *
@@ -101,6 +210,37 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash partitions rows from the input table into packed partitions.
+ *
+ * The rows are assigned to partitions as by `hash_partition`, and each partition is returned as
+ * a `packed_columns` that can be sent as is and unpacked with `unpack`. The result is equivalent
+ * to calling `contiguous_split` on the output of `hash_partition`, but when all columns of
+ * `input` are fixed-width the values are copied from `input` straight into the packed buffer of
+ * their partition, without materializing the partitioned table. Other tables are partitioned and
+ * then split.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device memory
+ *
+ * @returns The `num_partitions` packed partitions, or no partitions if `input` is empty
+ */
+std::vector<packed_columns> hash_partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
@@ -61,6 +61,33 @@ std::unique_ptr<column> quantile(
   bool exact                          = true,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes exact quantiles of an unsorted column with interpolation.
+ *
+ * Computes the same values as `quantile` over the valid values of `input` in sorted order, but
+ * without sorting `input`. The values at the positions the quantiles need are found by
+ * selection: a sample of `input` brackets each position with a small range of values, and only
+ * the values within those ranges are sorted. All quantiles are found together.
+ *
+ * Nulls are ignored. If `input` has no valid values every output element is null.
+ *
+ * @param[in] input           Column from which to compute quantile values
+ * @param[in] q               Specified quantiles in range [0, 1]
+ * @param[in] interp          Strategy used to select between values adjacent to
+ *                            a specified quantile.
+ * @param[in] exact           If true, returns doubles.
+ *                            If false, returns same type as input.
+ * @param[in] mr              Device memory resource used to allocate the returned column's device
+ *                            memory
+ * @returns Column of specified quantiles, with nulls for indeterminable values
+ */
+std::unique_ptr<column> quantile_unsorted(
+  column_view const& input,
+  std::vector<double> const& q,
+  interpolation interp                = interpolation::LINEAR,
+  bool exact                          = true,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the rows of the input corresponding to the requested quantiles.
  *
@@ -78,6 +105,9 @@ std::unique_ptr<column> quantile(
  * quantiles `<= 0` correspond to row `0`. (first)
  * quantiles `>= 1` correspond to row `input.size() - 1`. (last)
  *
+ * An unsorted table of a single column is not sorted: the rows are found by selection as in
+ * `quantile_unsorted`.
+ *
  * @param input           Table used to compute quantile rows
  * @param q               Desired quantiles in range [0, 1]
  * @param interp          Strategy used to select between the two rows on either
@@ -127,5 +157,33 @@ std::unique_ptr<column> percentile_approx(
   column_view const& percentiles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Adds a batch of values to a tdigest.
+ *
+ * Merges the tdigest in `input` with a tdigest built from `values`, producing the same kind of
+ * summary as computing a tdigest over all the values at once. Only the new values are sorted, so
+ * a stream of batches can be summarized in memory bounded by `max_centroids` rather than by the
+ * number of values seen so far. The first batch can be added to an empty tdigest, such as the
+ * result of a TDIGEST reduction of an empty column. Nulls in `values` are ignored.
+ *
+ * @param input           tdigest summarizing the previous values. Must have exactly one row
+ * @param values          Numeric values to add
+ * @param max_centroids   Parameter controlling the level of compression of the tdigest. Higher
+ *                        values result in a larger, more precise tdigest
+ * @param mr              Device memory resource used to allocate the returned column's device
+ * memory
+ *
+ * @throws cudf::logic_error if `input` is not a valid tdigest column.
+ * @throws cudf::logic_error if `input` does not have exactly one row.
+ * @throws cudf::logic_error if `values` is not numeric or fixed-point.
+ *
+ * @returns tdigest column with a single row summarizing the previous and the new values
+ */
+std::unique_ptr<column> update_tdigest(
+  tdigest::tdigest_column_view const& input,
+  column_view const& values,
+  int max_centroids                   = 1000,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
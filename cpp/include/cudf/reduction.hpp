@@ -18,10 +18,13 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <optional>
+#include <vector>
 
 namespace cudf {
 /**
@@ -94,6 +97,52 @@ std::unique_ptr<scalar> reduce(
   std::optional<std::reference_wrapper<scalar const>> init,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes several reductions of the values in all rows of a column.
+ *
+ * This is equivalent to calling `reduce` once per aggregation, except that MIN, MAX, SUM,
+ * SUM_OF_SQUARES, MEAN, VARIANCE and STD of an arithmetic column are computed together in a single
+ * pass over the column when their output type is the type the reduction accumulates in. That is
+ * the input type for MIN and MAX, `int64_t` for SUM and SUM_OF_SQUARES of integers or the input
+ * type for floating point, and FLOAT64 for MEAN, VARIANCE and STD. Other aggregations and output
+ * types are computed by the single-aggregation `reduce`.
+ *
+ * @throw cudf::logic_error if `aggs` and `output_dtypes` differ in size
+ * @throw cudf::logic_error for any aggregation and output type that `reduce` rejects
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reduction
+ * @param output_dtypes The computation and output precision of each aggregation
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Output scalar of each aggregation, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief  Computes several reductions of every column of a table.
+ *
+ * Each column is reduced as by the multi-aggregation `reduce` of a column, so that computing
+ * summary statistics of a table reads each column once. The output type of each aggregation is
+ * its default target type for the column, e.g. `int64_t` for the SUM of an integer column and
+ * FLOAT64 for its MEAN.
+ *
+ * @throw cudf::logic_error for any aggregation that `reduce` rejects for a column
+ *
+ * @param input Input table view
+ * @param aggs Aggregation operators applied to every column
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns For every column of `input`, the output scalar of each aggregation in the order of
+ * `aggs`
+ */
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Compute reduction of each segment in the input column
  *
@@ -104,7 +153,9 @@ std::unique_ptr<scalar> reduce(
  * Null values are treated as identities during reduction.
  *
  * If the segment is empty, the row corresponding to the result of the
- * segment is null.
+ * segment is null. For `mean`, `var` and `std` the result of a segment is also
+ * null if the segment does not have more valid elements than the `ddof` of the
+ * aggregation (zero for `mean`).
  *
  * If any index in @p offsets is out of bound of @p segmented_values , the behavior
  * is undefined.
@@ -192,6 +243,48 @@ std::unique_ptr<column> scan(
   null_policy null_handling           = null_policy::EXCLUDE,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the scan of each segment of a column.
+ *
+ * Every segment is scanned independently: the scan restarts at the first element of each
+ * segment. The segments must cover the whole input column, i.e. `offsets` must start with 0 and
+ * end with `input.size()`, otherwise the behavior is undefined.
+ *
+ * If `null_handling` is `null_policy::EXCLUDE`, null elements are skipped and an output element
+ * is null if the corresponding input element is null. If `null_handling` is
+ * `null_policy::INCLUDE`, an output element is null once a null element has been scanned within
+ * its segment.
+ *
+ * @code{.pseudo}
+ * input   = [1, 2, 3, 4, null, 6, 7]
+ * offsets = [0, 3, 7]
+ * segmented_scan(input, offsets, SUM, INCLUSIVE, EXCLUDE) -> [1, 3, 6, 4, null, 10, 17]
+ * segmented_scan(input, offsets, SUM, INCLUSIVE, INCLUDE) -> [1, 3, 6, 4, null, null, null]
+ * segmented_scan(input, offsets, SUM, EXCLUSIVE, EXCLUDE) -> [0, 1, 3, 0, null, 4, 10]
+ * @endcode
+ *
+ * @throws cudf::logic_error if `agg` is not SUM, PRODUCT, MIN or MAX.
+ * @throws cudf::logic_error if column datatype is not numeric type.
+ *
+ * @param input The input column view for the scan
+ * @param offsets Each segment's offset of @p input. A list of offsets with size
+ * `num_segments + 1`. The size of `i`th segment is `offsets[i+1] - offsets[i]`.
+ * @param agg unique_ptr to aggregation operator applied by the scan
+ * @param inclusive The flag for applying an inclusive scan if scan_type::INCLUSIVE, an
+ * exclusive scan if scan_type::EXCLUSIVE.
+ * @param null_handling Exclude null values when computing the result if null_policy::EXCLUDE.
+ * Include nulls if null_policy::INCLUDE.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Scanned output column
+ */
+std::unique_ptr<column> segmented_scan(
+  column_view const& input,
+  device_span<size_type const> offsets,
+  std::unique_ptr<scan_aggregation> const& agg,
+  scan_type inclusive,
+  null_policy null_handling           = null_policy::EXCLUDE,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Determines the minimum and maximum values of a column.
  *
@@ -89,6 +89,49 @@ std::unique_ptr<column> replace_nulls(
   replace_policy const& replace_policy,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in a fixed-width column in place with the first non-null value
+ * that precedes/follows.
+ *
+ * Same as `replace_nulls(column_view const&, replace_policy const&)` but writes the values and
+ * validity into `input` instead of a copy. Rows with no non-null value before (`PRECEDING`) or
+ * after (`FOLLOWING`) them remain null.
+ *
+ * @throws cudf::logic_error if `input` is not a fixed-width type
+ *
+ * @param[in,out] input A column whose null values will be replaced
+ * @param[in] replace_policy Specify the position of replacement values relative to null values
+ */
+void replace_nulls_in_place(mutable_column_view& input, replace_policy const& replace_policy);
+
+/**
+ * @brief Replaces all null values in each segment of a column with the first non-null value that
+ * precedes/follows within the same segment.
+ *
+ * The segments are contiguous and given by `offsets`, so no sorting or grouping of the rows is
+ * needed.
+ *
+ * @code{.pseudo}
+ * input   = {1, null, 3, null, null, 6, null}
+ * offsets = {0, 3, 7}
+ * replace_nulls(input, offsets, PRECEDING) = {1, 1, 3, null, null, 6, 6}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `offsets` is not INT32 or contains nulls
+ *
+ * @param[in] input A column whose null values will be replaced
+ * @param[in] offsets Offsets of the segments of `input`, `num_segments + 1` values
+ * @param[in] replace_policy Specify the position of replacement values relative to null values
+ * @param[in] mr Device memory resource used to allocate device memory of the returned column
+ *
+ * @returns Copy of `input` with null values replaced within each segment
+ */
+std::unique_ptr<column> segmented_replace_nulls(
+  column_view const& input,
+  column_view const& offsets,
+  replace_policy const& replace_policy,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
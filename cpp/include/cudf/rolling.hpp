@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
 #include <cudf/types.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cudf {
 /**
@@ -520,6 +523,46 @@ std::unique_ptr<column> grouped_range_rolling_window(
   rolling_aggregation const& aggr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A column of values and the rolling window aggregations to compute on it.
+ */
+struct rolling_request {
+  column_view values;                                              ///< The values to aggregate
+  std::vector<std::unique_ptr<rolling_aggregation>> aggregations;  ///< Aggregations on `values`
+};
+
+/**
+ * @brief Applies several grouping-aware, value range-based rolling window functions that share
+ * the same window specification.
+ *
+ * The result is the same as calling `grouped_range_rolling_window` for each aggregation of each
+ * request, but the group boundaries and the preceding/following window bounds of every row are
+ * computed only once and shared by all the aggregations.
+ *
+ * @throws cudf::logic_error if a request has a different number of rows than `orderby_column`
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] orderby_column The (pre-sorted) order-by column, for range comparisons
+ * @param[in] order  The order (ASCENDING/DESCENDING) in which the order-by column is sorted
+ * @param[in] requests The columns to aggregate and the aggregations to compute on each of them
+ * @param[in] preceding The interval value in the backward direction
+ * @param[in] following The interval value in the forward direction
+ * @param[in] min_periods Minimum number of observations in window required to have a value,
+ *                        otherwise element `i` is null.
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns For each request, one nullable output column per aggregation, in the same order
+ */
+std::vector<std::vector<std::unique_ptr<column>>> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  std::vector<rolling_request> const& requests,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  size_type min_periods,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a variable-size rolling window function to the values in a column.
  *
@@ -563,5 +606,27 @@ std::unique_ptr<column> rolling_window(
   rolling_aggregation const& agg,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief A user-defined rolling window function together with the types it is applied to.
+ */
+struct rolling_udf_signature {
+  udf_type type;          ///< Whether `source` is PTX or CUDA code
+  std::string source;     ///< Source of the user-defined aggregator
+  data_type input_type;   ///< Type of the input column
+  data_type output_type;  ///< Type of the output column
+};
+
+/**
+ * @brief Compiles the kernels used by `rolling_window` and `grouped_rolling_window` for the given
+ * user-defined functions ahead of time.
+ *
+ * Kernels are compiled for fixed, variable and grouped window sizes and kept in the JIT kernel
+ * cache, in memory and on disk, so that later rolling windows with the same user-defined
+ * aggregation do not pay the compilation cost.
+ *
+ * @param signatures The user-defined functions and types to compile kernels for
+ */
+void precompile_rolling_window_udfs(std::vector<rolling_udf_signature> const& signatures);
+
 /** @} */  // end of group
 }  // namespace cudf
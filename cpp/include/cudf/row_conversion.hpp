@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup interop_row_format
+ * @{
+ * @file
+ * @brief Conversion between the columnar format and the row-major JCUDF format
+ *
+ * In the JCUDF row format each row starts on an 8 byte boundary. The fixed-width values of a row
+ * come first in column order, each aligned to its own size. A string column takes an 8 byte slot
+ * holding the offset of the string data from the start of the row and its length, both as 32-bit
+ * integers and aligned to 4 bytes. The validity of the row follows as one bit per column, packed
+ * into bytes. The data of the strings of the row comes last, in column order, and the row is
+ * padded to a multiple of 8 bytes.
+ */
+
+/**
+ * @brief Converts a table to the JCUDF row format.
+ *
+ * Each row of the table becomes one list of bytes of the result. A column of lists can hold at
+ * most 2GB of bytes, so the rows are split into as many list columns as needed, in order. Every
+ * batch but the last holds a multiple of 32 rows.
+ *
+ * @throws cudf::logic_error if `tbl` has a column that is not fixed-width or a string column.
+ *
+ * @param tbl Table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return List columns of INT8 holding consecutive batches of rows
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& tbl,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts a table of fixed-width columns to the JCUDF row format.
+ *
+ * This produces the same rows as `convert_to_rows` but copies a whole row per thread through
+ * shared memory, which is faster for narrow tables of up to about 100 columns. The rows of a
+ * wider table may not fit in shared memory.
+ *
+ * @throws cudf::logic_error if `tbl` has a column that is not fixed-width.
+ * @throws cudf::logic_error if a row of `tbl` does not fit in shared memory.
+ *
+ * @param tbl Table to convert
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return List columns of INT8 holding consecutive batches of rows
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows_fixed_width_optimized(
+  table_view const& tbl,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts a batch of rows in the JCUDF row format to a table.
+ *
+ * This is the inverse of `convert_to_rows` for one of the list columns it returns.
+ *
+ * @throws cudf::logic_error if the child of `input` is not INT8 or UINT8.
+ * @throws cudf::logic_error if `input` holds less data than the rows of `schema` require.
+ *
+ * @param input List column of bytes where each list is one row
+ * @param schema Types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts a batch of rows in the JCUDF row format made of fixed-width columns to a
+ * table.
+ *
+ * This is the inverse of `convert_to_rows_fixed_width_optimized` for one of the list columns it
+ * returns.
+ *
+ * @throws cudf::logic_error if the child of `input` is not INT8 or UINT8.
+ * @throws cudf::logic_error if `schema` has a type that is not fixed-width.
+ * @throws cudf::logic_error if the size of `input` does not match the rows of `schema`.
+ *
+ * @param input List column of bytes where each list is one row
+ * @param schema Types of the columns of the rows
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The table of the rows
+ */
+std::unique_ptr<table> convert_from_rows_fixed_width_optimized(
+  lists_column_view const& input,
+  std::vector<data_type> const& schema,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
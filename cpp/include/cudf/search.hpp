@@ -20,12 +20,22 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace cudf {
+
+// forward declaration
+namespace detail {
+class row_hash_set;
+class sorted_searcher;
+}  // namespace detail
+
 /**
  * @addtogroup column_search
  * @{
@@ -157,5 +167,175 @@ std::unique_ptr<column> contains(
   column_view const& needles,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Check if the rows of the `needles` table exist in the `haystack` table.
+ *
+ * The new column will have type BOOL8, the same size as `needles` and no null mask. Row `i` is
+ * `true` if the `i`th row of `needles` compares equal to any row of `haystack`.
+ *
+ * To check many tables of needles against the same haystack, use a `row_hash_set`, which hashes
+ * the haystack only once.
+ *
+ * @code{.pseudo}
+ *   haystack = { {10, 20, 30}, {'a', 'b', 'c'} }
+ *   needles  = { {20, 20, 40}, {'b', 'c', 'a'} }
+ *   result   = { true, false, false }
+ * @endcode
+ *
+ * @throws cudf::logic_error If `haystack` and `needles` do not have the same number of columns
+ *
+ * @param haystack The table containing the search space
+ * @param needles A table of rows to check for existence in the search space
+ * @param compare_nulls Control whether nulls should be compared as equal or not
+ * @param compare_nans Control whether floating-point NaNs values should be compared as equal or not
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A BOOL8 column indicating if each row of `needles` exists in `haystack`
+ */
+std::unique_ptr<column> contains(
+  table_view const& haystack,
+  table_view const& needles,
+  null_equality compare_nulls         = null_equality::EQUAL,
+  nan_equality compare_nans           = nan_equality::ALL_EQUAL,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Hash set that inserts the rows of a haystack table in creation and checks the rows of
+ * needles tables against it in subsequent `contains` member function calls.
+ *
+ * This enables filtering many batches of rows against the same large table, such as IN-list
+ * filters, hashing the haystack only once.
+ *
+ * `contains` is `const` and does not modify the object, so once the stream the object was
+ * constructed on has been synchronized, it may be called concurrently from multiple host threads,
+ * each on its own stream.
+ */
+class row_hash_set {
+ public:
+  using impl_type = cudf::detail::row_hash_set;  ///< Implementation type
+
+  row_hash_set() = delete;
+  ~row_hash_set();
+  row_hash_set(row_hash_set const&) = delete;
+  row_hash_set(row_hash_set&&)      = delete;
+  row_hash_set& operator=(row_hash_set const&) = delete;
+  row_hash_set& operator=(row_hash_set&&) = delete;
+
+  /**
+   * @brief Construct a hash set of the rows of `haystack` for subsequent `contains` calls.
+   *
+   * @note The `row_hash_set` object must not outlive the table viewed by `haystack`, else
+   * behavior is undefined.
+   *
+   * @param haystack The table whose rows are inserted in the set
+   * @param compare_nulls Control whether nulls should be compared as equal or not
+   * @param compare_nans Control whether floating-point NaNs values should be compared as equal or
+   * not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  row_hash_set(table_view const& haystack,
+               null_equality compare_nulls  = null_equality::EQUAL,
+               nan_equality compare_nans    = nan_equality::ALL_EQUAL,
+               rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Check if the rows of the `needles` table exist in the haystack of the set.
+   * @see cudf::contains(table_view const&, table_view const&, null_equality, nan_equality,
+   * rmm::mr::device_memory_resource*).
+   *
+   * @throws cudf::logic_error If `needles` does not have the same number of columns as the
+   * haystack
+   *
+   * @param needles A table of rows to check for existence in the haystack
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column indicating if each row of `needles` exists in the haystack
+   */
+  std::unique_ptr<column> contains(
+    table_view const& needles,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  const std::unique_ptr<const impl_type> _impl;
+};
+
+/**
+ * @brief Binary searcher that prepares a sorted column once in creation and searches it in
+ * subsequent `lower_bound` and `upper_bound` member functions.
+ *
+ * The non-null elements of the haystack are copied in Eytzinger (breadth-first) order, so that
+ * the first steps of every search read the same few cache lines and the remaining steps read
+ * memory a fixed distance apart. This makes repeated searches against the same haystack, such as
+ * range partition boundaries or lookup tables, faster than `cudf::lower_bound` and
+ * `cudf::upper_bound`, which compare rows through the generic row comparator.
+ *
+ * The result of a search is the same as `cudf::lower_bound` or `cudf::upper_bound` of the
+ * haystack as a single column table with the same order and null precedence.
+ *
+ * The searcher owns its copy of the haystack, so it may outlive the column it was created from.
+ */
+class sorted_searcher {
+ public:
+  using impl_type = cudf::detail::sorted_searcher;  ///< Implementation type
+
+  sorted_searcher() = delete;
+  ~sorted_searcher();
+  sorted_searcher(sorted_searcher const&) = delete;
+  sorted_searcher(sorted_searcher&&)      = delete;
+  sorted_searcher& operator=(sorted_searcher const&) = delete;
+  sorted_searcher& operator=(sorted_searcher&&) = delete;
+
+  /**
+   * @brief Construct a searcher over a sorted column for subsequent search calls.
+   *
+   * @throws cudf::logic_error if `haystack` is not of a fixed-width type
+   *
+   * @param haystack The column to search, sorted by `column_order` and `null_precedence`
+   * @param column_order The order `haystack` is sorted in
+   * @param null_precedence The position of the nulls of `haystack` with respect to the non-null
+   * elements
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  sorted_searcher(column_view const& haystack,
+                  order column_order           = order::ASCENDING,
+                  null_order null_precedence   = null_order::BEFORE,
+                  rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Find the smallest indices in the haystack where the needles should be inserted to
+   * maintain order. @see cudf::lower_bound().
+   *
+   * @throws cudf::logic_error if `needles.type()` does not match the type of the haystack
+   *
+   * @param needles The values to search for
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of `size_type` elements containing the insertion points
+   */
+  std::unique_ptr<column> lower_bound(
+    column_view const& needles,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Find the largest indices in the haystack where the needles should be inserted to
+   * maintain order. @see cudf::upper_bound().
+   *
+   * @throws cudf::logic_error if `needles.type()` does not match the type of the haystack
+   *
+   * @param needles The values to search for
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of `size_type` elements containing the insertion points
+   */
+  std::unique_ptr<column> upper_bound(
+    column_view const& needles,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  const std::unique_ptr<const impl_type> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reorder_partition
+ * @{
+ * @file
+ * @brief Exchange of the rows of a table between processes
+ */
+
+/**
+ * @brief Communication layer of `hash_shuffle`, exchanging packed tables between the ranks.
+ *
+ * Implementations wrap a communication library such as NCCL or UCX, or the application's own
+ * messaging. Every rank of the shuffle calls `exchange` the same number of times, in the same
+ * order.
+ */
+class shuffle_transport {
+ public:
+  virtual ~shuffle_transport() = default;
+
+  /**
+   * @brief Returns the rank of this process in the shuffle, in `[0, num_ranks())`.
+   *
+   * @return The rank of this process
+   */
+  [[nodiscard]] virtual int rank() const = 0;
+
+  /**
+   * @brief Returns the number of processes taking part in the shuffle.
+   *
+   * @return The number of ranks
+   */
+  [[nodiscard]] virtual int num_ranks() const = 0;
+
+  /**
+   * @brief Sends a packed table to every other rank, and receives one from every other rank.
+   *
+   * The call may block until the exchange completes, and is made from a thread of `hash_shuffle`
+   * while the calling thread prepares the next exchange: implementations must allow calls to
+   * `exchange` from any thread, though never concurrently. The device data of `outgoing` is ready
+   * when `exchange` is called, and the transport takes ownership of it: work enqueued on `stream`
+   * to copy it may still run after `exchange` returns, as long as the transport keeps `outgoing`
+   * alive until that work completes. The received tables are only read once the work enqueued
+   * on `stream` by `exchange` completes.
+   *
+   * @param outgoing The tables to send, `outgoing[r]` to rank `r`; `outgoing[rank()]` is empty
+   * @param stream CUDA stream for the device work of the exchange
+   * @return The tables received, the one from rank `r` at index `r`; the one at index `rank()`
+   * is ignored
+   */
+  virtual std::vector<packed_columns> exchange(std::vector<packed_columns>&& outgoing,
+                                               rmm::cuda_stream_view stream) = 0;
+};
+
+/**
+ * @brief Shuffle transport calling an application-provided function for each exchange.
+ */
+class callback_shuffle_transport final : public shuffle_transport {
+ public:
+  /// The function exchanging the tables, see `shuffle_transport::exchange`
+  using exchange_function = std::function<std::vector<packed_columns>(
+    std::vector<packed_columns>&&, rmm::cuda_stream_view)>;
+
+  /**
+   * @brief Constructs a transport for rank `rank` of `num_ranks` ranks.
+   *
+   * @throws cudf::logic_error if `rank` is not in `[0, num_ranks)`
+   *
+   * @param rank The rank of this process
+   * @param num_ranks The number of processes taking part in the shuffle
+   * @param exchange The function exchanging the tables
+   */
+  callback_shuffle_transport(int rank, int num_ranks, exchange_function exchange);
+
+  [[nodiscard]] int rank() const override { return _rank; }
+  [[nodiscard]] int num_ranks() const override { return _num_ranks; }
+
+  std::vector<packed_columns> exchange(std::vector<packed_columns>&& outgoing,
+                                       rmm::cuda_stream_view stream) override
+  {
+    return _exchange(std::move(outgoing), stream);
+  }
+
+ private:
+  int _rank;
+  int _num_ranks;
+  exchange_function _exchange;
+};
+
+/**
+ * @brief Default number of rows partitioned and exchanged at once by `hash_shuffle`.
+ */
+constexpr size_type default_shuffle_chunk_rows = 1 << 22;
+
+/**
+ * @brief Exchanges the rows of tables between ranks so that the rows with equal keys end up on
+ * the same rank.
+ *
+ * Each rank calls `hash_shuffle` with its own part of a distributed table. The rows are assigned
+ * to ranks as by `hash_partition` with `num_ranks` partitions, so the same keys are assigned to
+ * the same rank on every rank. Each rank returns the rows assigned to it, ordered by the rank
+ * they come from and then by their order on that rank.
+ *
+ * The input is shuffled in chunks of `chunk_rows` rows: while the partitions of a chunk are
+ * exchanged on a separate thread, the next chunk is partitioned and packed with
+ * `hash_partition_and_pack`, so that the communication overlaps the computation. At most two
+ * chunks of the input are held in their partitioned form at any time. The received partitions are
+ * concatenated once all chunks are exchanged. The ranks first exchange their number of chunks, and
+ * ranks with fewer chunks than others send empty partitions until all ranks are done.
+ *
+ * @throws cudf::logic_error if `chunk_rows` is not positive
+ * @throws std::out_of_range if an index of `columns_to_hash` is invalid
+ *
+ * @param input The part of the table on this rank, with the same schema on all ranks
+ * @param columns_to_hash Indices of the key columns
+ * @param transport The communication layer between the ranks
+ * @param chunk_rows The number of rows of `input` exchanged at once
+ * @param hash_function Hash function assigning the rows to ranks
+ * @param seed Seed of the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The rows assigned to this rank
+ */
+std::unique_ptr<table> hash_shuffle(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  shuffle_transport& transport,
+  size_type chunk_rows                = default_shuffle_chunk_rows,
+  hash_id hash_function               = hash_id::HASH_MURMUR3,
+  uint32_t seed                       = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
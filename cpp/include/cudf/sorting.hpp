@@ -18,9 +18,13 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -43,6 +47,7 @@ namespace cudf {
  * @param null_precedence The desired order of null compared to other elements
  * for each column. Size must be equal to `input.num_columns()` or empty.
  * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return A non-nullable column of `size_type` elements containing the permuted row indices of
  * `input` if it were sorted
@@ -51,6 +56,7 @@ std::unique_ptr<column> sorted_order(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -65,6 +71,7 @@ std::unique_ptr<column> stable_sorted_order(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -80,12 +87,14 @@ std::unique_ptr<column> stable_sorted_order(
  *                              elements for each column. Size must be equal to
  *                              `input.num_columns()` or empty. If empty,
  *                              `null_order::BEFORE` is assumed for all columns.
+ * @param[in] stream            CUDA stream used for device memory operations and kernel launches
  *
  * @returns bool                true if sorted as expected, false if not
  */
 bool is_sorted(cudf::table_view const& table,
                std::vector<order> const& column_order,
-               std::vector<null_order> const& null_precedence);
+               std::vector<null_order> const& null_precedence,
+               rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
  * @brief Performs a lexicographic sort of the rows of a table
@@ -98,6 +107,7 @@ bool is_sorted(cudf::table_view const& table,
  * elements for each column in `input`. Size must be equal to
  * `input.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return New table containing the desired sorted order of `input`
  */
@@ -105,6 +115,7 @@ std::unique_ptr<table> sort(
   table_view const& input,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -124,6 +135,7 @@ std::unique_ptr<table> sort(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
@@ -133,6 +145,7 @@ std::unique_ptr<table> sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -154,6 +167,7 @@ std::unique_ptr<table> sort_by_key(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned table's device memory
  * @return The reordering of `values` determined by the lexicographic order of
  * the rows of `keys`.
@@ -163,6 +177,7 @@ std::unique_ptr<table> stable_sort_by_key(
   table_view const& keys,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -189,6 +204,7 @@ std::unique_ptr<table> stable_sort_by_key(
  * @param null_precedence The desired order of null compared to other elements
  * for column
  * @param percentage flag to convert ranks to percentage in range (0,1]
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return std::unique_ptr<column> A column of containing the rank of the each
  * element of the column of `input`. The output column type will be `size_type`
@@ -202,6 +218,7 @@ std::unique_ptr<column> rank(
   null_policy null_handling,
   null_order null_precedence,
   bool percentage,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -220,6 +237,7 @@ std::unique_ptr<column> rank(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to allocate any returned objects
  * @return sorted order of the segment sorted table
  *
@@ -229,6 +247,7 @@ std::unique_ptr<column> segmented_sorted_order(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -241,6 +260,7 @@ std::unique_ptr<column> stable_segmented_sorted_order(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -261,6 +281,7 @@ std::unique_ptr<column> stable_segmented_sorted_order(
  * elements for each column in `keys`. Size must be equal to
  * `keys.num_columns()` or empty. If empty, all columns will be sorted with
  * `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to allocate any returned objects
  * @return table with elements in each segment sorted
  *
@@ -271,6 +292,7 @@ std::unique_ptr<table> segmented_sort_by_key(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
 /**
@@ -284,7 +306,200 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   column_view const& segment_offsets,
   std::vector<order> const& column_order         = {},
   std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in stable lexicographic
+ * sorted order.
+ *
+ * The result equals the first `k` indices of `stable_sorted_order(keys)`, but large inputs are
+ * not sorted in full. A sorted sample of the keys gives a threshold row, only the rows not
+ * ordered after it are sorted, and the whole input is sorted only when the sample cannot bound
+ * the first `k` rows.
+ *
+ * @throws cudf::logic_error if `k` is negative
+ *
+ * @param keys The table that determines the ordering
+ * @param k Number of rows to return. All rows are returned if `k` exceeds `keys.num_rows()`.
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `size_type` elements containing the row indices of the first
+ * `min(k, keys.num_rows())` rows of `keys` in sorted order
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the first `k` rows of `keys` in stable lexicographic sorted order.
+ *
+ * @copydetails cudf::top_k_order
+ *
+ * @return The first `min(k, keys.num_rows())` rows of `keys` in sorted order
+ */
+std::unique_ptr<table> top_k(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the row indices of the first `k` rows of each segment of `keys` in stable
+ * lexicographic sorted order.
+ *
+ * The segments must cover `keys`, i.e. `segment_offsets` starts with 0 and ends with
+ * `keys.num_rows()`.
+ *
+ * @code{.pseudo}
+ * keys            = {3, 1, 2, 5, 4, 9}
+ * segment_offsets = {0, 3, 3, 6}
+ * k               = 2
+ * result          = {{1, 2}, {}, {4, 3}}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `k` is negative
+ * @throws cudf::logic_error if `segment_offsets` is not `size_type` column.
+ *
+ * @param keys The table that determines the ordering of elements in each segment
+ * @param segment_offsets The column of `size_type` type containing the `num_segments + 1` offsets
+ * of the segments
+ * @param k Number of rows to return per segment
+ * @param column_order The desired sort order for each column. Size must be
+ * equal to `keys.num_columns()` or empty. If empty, all columns will be sorted
+ * in ascending order.
+ * @param null_precedence The desired order of null compared to other elements
+ * for each column. Size must be equal to `keys.num_columns()` or empty.
+ * If empty, all columns will be sorted in `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A lists column of `size_type` row indices with the first `min(k, size)` sorted rows of
+ * each segment
+ */
+std::unique_ptr<column> segmented_top_k_order(
+  table_view const& keys,
+  column_view const& segment_offsets,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr            = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Sorts a sequence of tables that together may not fit in device memory.
+ *
+ * Every table given to `push` is sorted on the device and spilled to pinned host memory as a
+ * sorted run, split into packed chunks of at most `chunk_rows` rows. `finish` then k-way merges
+ * the runs back on the device while keeping at most one chunk of every run resident, and hands
+ * the sorted rows to a callback in tables of at most `chunk_rows` rows.
+ *
+ * Rows with equal keys coming from different runs may be emitted in any order.
+ *
+ * @code{.pseudo}
+ * external_sorter sorter({0}, {order::ASCENDING}, {}, 2);
+ * sorter.push({{5, 1, 4}});
+ * sorter.push({{3, 2}});
+ * sorter.finish(emit) calls emit with {{1, 2}}, {{3, 4}}, {{5}}
+ * @endcode
+ */
+class external_sorter {
+ public:
+  external_sorter() = delete;
+  ~external_sorter();
+  external_sorter(external_sorter const&) = delete;
+  external_sorter& operator=(external_sorter const&) = delete;
+
+  /**
+   * @brief Callback receiving each sorted chunk produced by `finish`.
+   */
+  using chunk_callback = std::function<void(std::unique_ptr<table>&&)>;
+
+  /**
+   * @brief Construct a sorter ordering rows by the columns at `key_indices`.
+   *
+   * @throws cudf::logic_error if `chunk_rows` is not positive
+   * @throws cudf::logic_error if `column_order` or `null_precedence` is neither empty nor of the
+   * same size as `key_indices`
+   *
+   * @param key_indices Indices of the key columns in every pushed table
+   * @param column_order The desired sort order for each key column. If empty, all key columns
+   * will be sorted in ascending order.
+   * @param null_precedence The desired order of null compared to other elements for each key
+   * column. If empty, all key columns will be sorted in `null_order::BEFORE`.
+   * @param chunk_rows Maximum number of rows of a spilled chunk and of an emitted table
+   */
+  external_sorter(std::vector<size_type> key_indices,
+                  std::vector<order> column_order         = {},
+                  std::vector<null_order> null_precedence = {},
+                  size_type chunk_rows                    = 1 << 22);
+
+  /**
+   * @brief Sorts `input` and spills it to host memory as a new run.
+   *
+   * @throws cudf::logic_error if the column types of `input` differ from those of the tables
+   * pushed before
+   * @throws cudf::logic_error if called after `finish`
+   *
+   * @param input The table to add to the sort
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the temporary sorted table
+   */
+  void push(table_view const& input,
+            rmm::cuda_stream_view stream        = cudf::default_stream_value,
+            rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Merges all the spilled runs and passes the sorted rows to `emit` in order.
+   *
+   * The spilled runs are released while they are merged, so `finish` may only be called once.
+   *
+   * @throws cudf::logic_error if called more than once
+   *
+   * @param emit Callback invoked with each sorted table of at most `chunk_rows` rows
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the emitted tables' device memory
+   */
+  void finish(chunk_callback const& emit,
+              rmm::cuda_stream_view stream        = cudf::default_stream_value,
+              rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the number of sorted runs spilled so far.
+   *
+   * @return Number of runs
+   */
+  [[nodiscard]] size_type num_runs() const;
+
+  /**
+   * @brief Returns the number of bytes of pinned host memory holding the spilled runs.
+   *
+   * @return Size of the spilled runs in bytes
+   */
+  [[nodiscard]] std::size_t spilled_bytes() const;
+
+ private:
+  struct sorted_run;
+
+  std::vector<size_type> _key_indices;                ///< Indices of the key columns
+  std::vector<order> _column_order;                   ///< Sort order of each key column
+  std::vector<null_order> _null_precedence;           ///< Null order of each key column
+  size_type _chunk_rows;                              ///< Rows per spilled or emitted chunk
+  std::vector<data_type> _types;                      ///< Column types of the pushed tables
+  std::vector<std::unique_ptr<sorted_run>> _runs;     ///< Spilled sorted runs
+  bool _finished{false};                              ///< Whether `finish` has been called
+};
+
 /** @} */  // end of group
 }  // namespace cudf
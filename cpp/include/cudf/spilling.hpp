@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/copying.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/detail/error.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+
+namespace cudf {
+/**
+ * @addtogroup utility_spilling
+ * @{
+ * @file
+ * @brief Spilling of the device memory of tables to host memory
+ */
+
+class spill_manager;
+
+/**
+ * @brief A table whose device memory can be spilled to host memory and reloaded on access.
+ *
+ * The table is stored in the contiguous layout of `cudf::pack`, so that spilling and reloading it
+ * are single copies. The table is registered with the `spill_manager` that created it until it is
+ * destroyed, and the manager spills it when device memory is needed. Accessing the table reloads
+ * it to device memory if it was spilled, and keeps it there while the returned accessor lives.
+ *
+ * All member functions are thread-safe.
+ */
+class spillable_table {
+ public:
+  /**
+   * @brief Keeps a spillable table in device memory while alive, and gives access to its view.
+   */
+  class accessor {
+   public:
+    accessor(accessor const&) = delete;
+    accessor& operator=(accessor const&) = delete;
+    accessor(accessor&& other) noexcept;
+    accessor& operator=(accessor&&) = delete;
+    ~accessor();
+
+    /**
+     * @brief Returns the view of the table, valid while this accessor lives.
+     *
+     * @return The view of the table
+     */
+    [[nodiscard]] table_view const& view() const { return _view; }
+
+   private:
+    friend class spillable_table;
+    accessor(spillable_table* table, table_view view) : _table{table}, _view{view} {}
+
+    spillable_table* _table;
+    table_view _view;
+  };
+
+  spillable_table(spillable_table const&) = delete;
+  spillable_table& operator=(spillable_table const&) = delete;
+  spillable_table(spillable_table&&)                 = delete;
+  spillable_table& operator=(spillable_table&&) = delete;
+
+  /**
+   * @brief Unregisters the table from its manager and frees its memory.
+   */
+  ~spillable_table();
+
+  /**
+   * @brief Returns access to the table, reloading it to device memory if it was spilled.
+   *
+   * The table is not spilled while the returned accessor lives.
+   *
+   * @throws rmm::bad_alloc if the device memory of a spilled table cannot be allocated
+   *
+   * @param stream CUDA stream used to reload the table
+   * @param mr Device memory resource used to allocate the reloaded table
+   * @return Accessor to the table
+   */
+  accessor access(rmm::cuda_stream_view stream     = cudf::default_stream_value,
+                  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Moves the device memory of the table to host memory.
+   *
+   * Nothing is spilled if the table is already spilled, is being accessed, or holds no device
+   * memory.
+   *
+   * @param stream CUDA stream used to copy the table
+   * @return The number of bytes of device memory freed
+   */
+  std::size_t spill(rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Returns whether the table is spilled to host memory.
+   *
+   * @return true if the table is in host memory
+   */
+  [[nodiscard]] bool is_spilled() const { return _is_spilled; }
+
+  /**
+   * @brief Returns the number of bytes of device memory the table occupies when not spilled.
+   *
+   * @return The size of the contiguous device memory of the table
+   */
+  [[nodiscard]] std::size_t size() const { return _size; }
+
+ private:
+  friend class spill_manager;
+  struct host_copy;
+
+  spillable_table(packed_columns&& packed, spill_manager* manager);
+
+  void release_accessor();
+
+  spill_manager* _manager;
+  std::size_t const _size;
+  std::mutex _mutex;                  // guards the members below, not `is_spilled()`
+  packed_columns _packed;             // the device data is empty while spilled
+  table_view _view;                   // view of `_packed` while not spilled
+  std::unique_ptr<host_copy> _spill;  // set while spilled
+  std::size_t _accessors{0};
+  std::atomic<bool> _is_spilled{false};
+  std::atomic<std::uint64_t> _last_access{0};
+};
+
+/**
+ * @brief Registry of the spillable tables, spilling the least recently used ones on demand.
+ *
+ * Spilled tables are copied to pinned host memory, optionally compressed on the device with
+ * nvCOMP first. Compression needs temporary device memory: if it cannot be allocated, the table
+ * is spilled uncompressed.
+ *
+ * All member functions are thread-safe. The manager must outlive the tables it creates.
+ */
+class spill_manager {
+ public:
+  /**
+   * @brief Constructs a manager spilling tables with the given compression.
+   *
+   * @throws cudf::logic_error if `compression` is not one of `NONE`, `SNAPPY`, `LZ4` or `ZSTD`
+   *
+   * @param compression Compression applied to the spilled tables
+   */
+  explicit spill_manager(io::compression_type compression = io::compression_type::NONE);
+
+  spill_manager(spill_manager const&) = delete;
+  spill_manager& operator=(spill_manager const&) = delete;
+
+  /**
+   * @brief Registers a packed table as spillable.
+   *
+   * @param packed The packed table to take ownership of
+   * @return The spillable table
+   */
+  std::unique_ptr<spillable_table> make_spillable(packed_columns&& packed);
+
+  /**
+   * @brief Packs a table and registers it as spillable.
+   *
+   * A single column is made spillable with a table view of that column.
+   *
+   * @param input The table to copy
+   * @param stream CUDA stream used to pack the table
+   * @param mr Device memory resource used to allocate the packed table
+   * @return The spillable table
+   */
+  std::unique_ptr<spillable_table> make_spillable(
+    table_view const& input,
+    rmm::cuda_stream_view stream        = cudf::default_stream_value,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Spills the least recently accessed tables until `bytes` of device memory are freed.
+   *
+   * Tables being accessed or reloaded by other threads are skipped. When called while this
+   * thread is spilling, e.g. by an allocation made to spill a table, nothing is spilled.
+   *
+   * @param bytes The number of bytes of device memory to free
+   * @param stream CUDA stream used to copy the tables
+   * @return The number of bytes of device memory freed, which may be less or more than `bytes`
+   */
+  std::size_t spill(std::size_t bytes,
+                    rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+  /**
+   * @brief Returns the number of bytes of device memory held by the tables that are not spilled.
+   *
+   * @return The device size of the tables in device memory
+   */
+  [[nodiscard]] std::size_t device_size() const;
+
+  /**
+   * @brief Returns the compression applied to the spilled tables.
+   *
+   * @return The compression type
+   */
+  [[nodiscard]] io::compression_type compression() const { return _compression; }
+
+ private:
+  friend class spillable_table;
+
+  void unregister(spillable_table* table);
+  [[nodiscard]] std::uint64_t next_access() { return ++_access_count; }
+
+  io::compression_type const _compression;
+  mutable std::mutex _mutex;
+  std::unordered_set<spillable_table*> _tables;
+  std::atomic<std::uint64_t> _access_count{0};
+};
+
+/**
+ * @brief Device memory resource adaptor that spills tables when an allocation fails.
+ *
+ * When the upstream resource runs out of memory, the adaptor spills the least recently accessed
+ * tables of the manager and retries, until the allocation succeeds or nothing is left to spill.
+ *
+ * @tparam Upstream Type of the upstream resource
+ */
+template <typename Upstream>
+class spilling_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Constructs an adaptor allocating from `upstream`.
+   *
+   * @param upstream The resource to allocate from, which must outlive the adaptor
+   * @param manager The manager of the tables to spill, which must outlive the adaptor
+   */
+  spilling_resource_adaptor(Upstream* upstream, spill_manager* manager)
+    : _upstream{upstream}, _manager{manager}
+  {
+    CUDF_EXPECTS(upstream != nullptr, "Unexpected null upstream resource");
+    CUDF_EXPECTS(manager != nullptr, "Unexpected null spill manager");
+  }
+
+  /**
+   * @brief Returns the upstream resource.
+   *
+   * @return The upstream resource
+   */
+  [[nodiscard]] Upstream* get_upstream() const noexcept { return _upstream; }
+
+  [[nodiscard]] bool supports_streams() const noexcept override
+  {
+    return _upstream->supports_streams();
+  }
+
+  [[nodiscard]] bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    while (true) {
+      try {
+        return _upstream->allocate(bytes, stream);
+      } catch (rmm::out_of_memory const&) {
+        if (_manager->spill(bytes, stream) == 0) { throw; }
+      }
+    }
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+  }
+
+  [[nodiscard]] bool do_is_equal(
+    rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    if (this == &other) { return true; }
+    auto const cast = dynamic_cast<spilling_resource_adaptor<Upstream> const*>(&other);
+    return cast != nullptr and _upstream->is_equal(*cast->get_upstream()) and
+           _manager == cast->_manager;
+  }
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> do_get_mem_info(
+    rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  Upstream* _upstream;
+  spill_manager* _manager;
+};
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -16,11 +16,16 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -64,6 +69,7 @@ namespace cudf {
  * @param[in] keys  vector of indices representing key columns from `input`
  * @param[in] keep_threshold The minimum number of non-null fields in a row
  *                           required to keep the row.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing all rows of the `input` with at least @p
  * keep_threshold non-null fields in @p keys.
@@ -72,6 +78,7 @@ std::unique_ptr<table> drop_nulls(
   table_view const& input,
   std::vector<size_type> const& keys,
   cudf::size_type keep_threshold,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -96,6 +103,7 @@ std::unique_ptr<table> drop_nulls(
  *
  * @param[in] input The input `table_view` to filter
  * @param[in] keys  vector of indices representing key columns from `input`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing all rows of the `input` without nulls in the columns
  * of @p keys.
@@ -103,6 +111,50 @@ std::unique_ptr<table> drop_nulls(
 std::unique_ptr<table> drop_nulls(
   table_view const& input,
   std::vector<size_type> const& keys,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters a table to remove null elements with threshold count.
+ *
+ * Same as the `table_view` overload, except that if no column of @p keys has
+ * nulls the returned table shares the device memory of @p input, see
+ * `table::share()`, instead of copying it.
+ *
+ * @param[in] input The input `table` to filter
+ * @param[in] keys  vector of indices representing key columns from `input`
+ * @param[in] keep_threshold The minimum number of non-null fields in a row
+ *                           required to keep the row.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing all rows of the `input` with at least @p
+ * keep_threshold non-null fields in @p keys.
+ */
+std::unique_ptr<table> drop_nulls(
+  table const& input,
+  std::vector<size_type> const& keys,
+  cudf::size_type keep_threshold,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters a table to remove null elements.
+ *
+ * Same as the `table_view` overload, except that if no column of @p keys has
+ * nulls the returned table shares the device memory of @p input, see
+ * `table::share()`, instead of copying it.
+ *
+ * @param[in] input The input `table` to filter
+ * @param[in] keys  vector of indices representing key columns from `input`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing all rows of the `input` without nulls in the columns
+ * of @p keys.
+ */
+std::unique_ptr<table> drop_nulls(
+  table const& input,
+  std::vector<size_type> const& keys,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -138,6 +190,7 @@ std::unique_ptr<table> drop_nulls(
  * @param[in] keys  vector of indices representing key columns from `input`
  * @param[in] keep_threshold The minimum number of non-NAN elements in a row
  *                           required to keep the row.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing all rows of the `input` with at least @p
  * keep_threshold non-NAN elements in @p keys.
@@ -146,6 +199,7 @@ std::unique_ptr<table> drop_nans(
   table_view const& input,
   std::vector<size_type> const& keys,
   cudf::size_type keep_threshold,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -171,6 +225,7 @@ std::unique_ptr<table> drop_nans(
  *
  * @param[in] input The input `table_view` to filter
  * @param[in] keys  vector of indices representing key columns from `input`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing all rows of the `input` without NANs in the columns
  * of @p keys.
@@ -178,6 +233,7 @@ std::unique_ptr<table> drop_nans(
 std::unique_ptr<table> drop_nans(
   table_view const& input,
   std::vector<size_type> const& keys,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -197,6 +253,7 @@ std::unique_ptr<table> drop_nans(
  * @param[in] input The input table_view to filter
  * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used
  * as a mask to filter the `input`.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  * @param[in] mr Device memory resource used to allocate the returned table's device memory
  * @return Table containing copy of all rows of @p input passing
  * the filter defined by @p boolean_mask.
@@ -204,6 +261,34 @@ std::unique_ptr<table> drop_nans(
 std::unique_ptr<table> apply_boolean_mask(
   table_view const& input,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Filters `input` using a boolean `predicate` expression evaluated on its rows.
+ *
+ * A row of `input` is copied to the output if `predicate` evaluates to non-null and `true` on
+ * it. This operation is stable: the input order is preserved. It is equivalent to
+ * `apply_boolean_mask(input, compute_column(input, predicate))`, but does not materialize the
+ * boolean column: the predicate is evaluated into a bitmask of the passing rows that the
+ * compaction reads directly.
+ *
+ * @note if @p input.num_rows() is zero, there is no error, and an empty table
+ * is returned.
+ *
+ * @throws cudf::logic_error if `predicate` does not produce a boolean output.
+ * @throws cudf::logic_error if `predicate` operates on table_reference::RIGHT.
+ *
+ * @param[in] input The input table_view to filter
+ * @param[in] predicate The boolean expression evaluated on the rows of `input`
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table containing copy of all rows of @p input passing @p predicate.
+ */
+std::unique_ptr<table> filter(
+  table_view const& input,
+  ast::expression const& predicate,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -238,6 +323,7 @@ enum class duplicate_keep_option {
  * @param[in] keep            keep any, first, last, or none of the found duplicates
  * @param[in] nulls_equal     flag to denote nulls are equal if null_equality::EQUAL, nulls are not
  *                            equal if null_equality::UNEQUAL
+ * @param[in] stream          CUDA stream used for device memory operations and kernel launches
  * @param[in] mr              Device memory resource used to allocate the returned table's device
  *                            memory
  *
@@ -248,6 +334,7 @@ std::unique_ptr<table> unique(
   std::vector<size_type> const& keys,
   duplicate_keep_option keep,
   null_equality nulls_equal           = null_equality::EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -267,6 +354,7 @@ std::unique_ptr<table> unique(
  * @param[in] keep            keep any, first, last, or none of the found duplicates
  * @param[in] nulls_equal     flag to control if nulls are compared equal or not
  * @param[in] nans_equal      flag to control if floating-point NaN values are compared equal or not
+ * @param[in] stream          CUDA stream used for device memory operations and kernel launches
  * @param[in] mr              Device memory resource used to allocate the returned table's device
  *                            memory
  *
@@ -278,6 +366,63 @@ std::unique_ptr<table> distinct(
   duplicate_keep_option keep          = duplicate_keep_option::KEEP_ANY,
   null_equality nulls_equal           = null_equality::EQUAL,
   nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the indices of the distinct rows of a table.
+ *
+ * Produces the same rows as `cudf::distinct(input, keys, keep, ...)` would as a gather map into
+ * the table, without gathering any column. If there are duplicate rows, which index is kept
+ * depends on the `keep` parameter.
+ *
+ * The order of the indices is not specified.
+ *
+ * @param[in] input           input table_view whose rows are compared
+ * @param[in] keep            keep any, first, last, or none of the found duplicates
+ * @param[in] nulls_equal     flag to control if nulls are compared equal or not
+ * @param[in] nans_equal      flag to control if floating-point NaN values are compared equal or not
+ * @param[in] stream          CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr              Device memory resource used to allocate the returned column's device
+ *                            memory
+ *
+ * @return Column of `size_type` indices of the distinct rows
+ */
+std::unique_ptr<column> distinct_indices(
+  table_view const& input,
+  duplicate_keep_option keep          = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Computes the index of one row of every group of equal rows and the size of the group.
+ *
+ * The counts are computed in the same hash pass that finds the distinct rows, which makes this a
+ * cheap equivalent of a groupby `COUNT_ALL` on `input` when only the index of a representative
+ * row of every group is needed. Which row represents a group is not specified.
+ *
+ * @code{.pseudo}
+ * input = {{7, 5, 7, 7, 5, 9}}
+ * distinct_indices_and_counts(input) = {{0, 1, 5}, {3, 2, 1}}  (in an unspecified order)
+ * @endcode
+ *
+ * @param[in] input           input table_view whose rows are compared
+ * @param[in] nulls_equal     flag to control if nulls are compared equal or not
+ * @param[in] nans_equal      flag to control if floating-point NaN values are compared equal or not
+ * @param[in] stream          CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr              Device memory resource used to allocate the returned columns' device
+ *                            memory
+ *
+ * @return Pair of `size_type` columns with the index of a representative row of each group of
+ * equal rows and the number of rows in that group
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> distinct_indices_and_counts(
+  table_view const& input,
+  null_equality nulls_equal           = null_equality::EQUAL,
+  nan_equality nans_equal             = nan_equality::ALL_EQUAL,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /**
@@ -292,12 +437,14 @@ std::unique_ptr<table> distinct(
  * @param[in] input The column_view whose consecutive groups of equivalent rows will be counted
  * @param[in] null_handling flag to include or ignore `null` while counting
  * @param[in] nan_handling flag to consider `NaN==null` or not
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return number of consecutive groups of equivalent rows in the column
  */
 cudf::size_type unique_count(column_view const& input,
                              null_policy null_handling,
-                             nan_policy nan_handling);
+                             nan_policy nan_handling,
+                             rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
  * @brief Count the number of consecutive groups of equivalent rows in a table.
@@ -305,11 +452,13 @@ cudf::size_type unique_count(column_view const& input,
  * @param[in] input Table whose consecutive groups of equivalent rows will be counted
  * @param[in] nulls_equal flag to denote if null elements should be considered equal
  *            nulls are not equal if null_equality::UNEQUAL.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return number of consecutive groups of equivalent rows in the column
  */
 cudf::size_type unique_count(table_view const& input,
-                             null_equality nulls_equal = null_equality::EQUAL);
+                             null_equality nulls_equal    = null_equality::EQUAL,
+                             rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
  * @brief Count the distinct elements in the column_view.
@@ -328,12 +477,14 @@ cudf::size_type unique_count(table_view const& input,
  * @param[in] input The column_view whose distinct elements will be counted
  * @param[in] null_handling flag to include or ignore `null` while counting
  * @param[in] nan_handling flag to consider `NaN==null` or not
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return number of distinct rows in the table
  */
 cudf::size_type distinct_count(column_view const& input,
                                null_policy null_handling,
-                               nan_policy nan_handling);
+                               nan_policy nan_handling,
+                               rmm::cuda_stream_view stream = cudf::default_stream_value);
 
 /**
  * @brief Count the distinct rows in a table.
@@ -341,11 +492,59 @@ cudf::size_type distinct_count(column_view const& input,
  * @param[in] input Table whose distinct rows will be counted
  * @param[in] nulls_equal flag to denote if null elements should be considered equal.
  *            nulls are not equal if null_equality::UNEQUAL.
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
  *
  * @return number of distinct rows in the table
  */
 cudf::size_type distinct_count(table_view const& input,
-                               null_equality nulls_equal = null_equality::EQUAL);
+                               null_equality nulls_equal    = null_equality::EQUAL,
+                               rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+/**
+ * @brief Approximately count the distinct elements of a column with a HyperLogLog sketch.
+ *
+ * Unlike `distinct_count`, the memory used does not depend on the number of distinct elements:
+ * a single sketch of `2^precision` registers is built from the hashes of the elements. The
+ * relative standard error of the result is about `1.04 / sqrt(2^precision)`. `null`s are
+ * ignored.
+ *
+ * @throws cudf::logic_error if `precision` is outside of the range [4, 18]
+ *
+ * @param input The column_view whose distinct elements will be counted
+ * @param precision Number of hash bits selecting a register of the sketch
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Approximate number of distinct elements in the column
+ */
+cudf::size_type approx_distinct_count(
+  column_view const& input,
+  int precision                = 12,
+  rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+/**
+ * @brief Estimates the number of distinct values summarized by each HyperLogLog sketch.
+ *
+ * The sketches are produced by the `HLL` and `MERGE_HLL` aggregations, see
+ * `cudf::make_hll_aggregation`.
+ *
+ * @code{.pseudo}
+ * values   = {1, 2, 2, 3, null}
+ * sketches = reduce(values, make_hll_aggregation(12))
+ * estimate_distinct_count(sketches) = {3}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `sketches` is not a `LIST<UINT8>` column
+ *
+ * @param sketches The sketches to estimate
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return INT64 column of the estimates, null where the sketch is null
+ */
+std::unique_ptr<column> estimate_distinct_count(
+  lists_column_view const& sketches,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 /** @} */
 }  // namespace cudf
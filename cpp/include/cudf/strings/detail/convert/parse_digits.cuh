@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Returns 8 bytes starting at `ptr` as an integer with the first byte in the lowest bits.
+ *
+ * The bytes are assembled individually since `ptr` may not be aligned.
+ *
+ * @param ptr Start of the bytes to load; at least 8 bytes must be readable
+ * @return The 8 bytes as a single integer
+ */
+CUDF_HOST_DEVICE inline uint64_t load_eight_bytes(char const* ptr)
+{
+  uint64_t chunk = 0;
+  for (int idx = 0; idx < 8; ++idx) {
+    chunk |= static_cast<uint64_t>(static_cast<uint8_t>(ptr[idx])) << (8 * idx);
+  }
+  return chunk;
+}
+
+/**
+ * @brief Returns true if all 8 bytes of `chunk` are the characters '0'-'9'.
+ *
+ * Each byte of a digit has 0x3 in its high nibble before and after adding 6 to it.
+ *
+ * @param chunk 8 bytes as returned by `load_eight_bytes`
+ * @return True if every byte is a decimal digit character
+ */
+CUDF_HOST_DEVICE inline bool is_eight_digits(uint64_t chunk)
+{
+  return ((chunk & 0xF0F0F0F0F0F0F0F0UL) |
+          (((chunk + 0x0606060606060606UL) & 0xF0F0F0F0F0F0F0F0UL) >> 4)) == 0x3333333333333333UL;
+}
+
+/**
+ * @brief Converts 8 decimal digit characters into their integer value.
+ *
+ * The digits are combined in pairs, then in groups of 4 and finally into 8 digits using
+ * 3 multiplies instead of 8 dependent multiply-adds.
+ *
+ * @param chunk 8 digit characters as returned by `load_eight_bytes`;
+ *        `is_eight_digits(chunk)` must be true
+ * @return The value of the 8 digits
+ */
+CUDF_HOST_DEVICE inline uint32_t parse_eight_digits(uint64_t chunk)
+{
+  chunk = ((chunk & 0x0F0F0F0F0F0F0F0FUL) * 2561) >> 8;
+  chunk = ((chunk & 0x00FF00FF00FF00FFUL) * 6553601) >> 16;
+  return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFFUL) * 42949672960001UL) >> 32);
+}
+
+/**
+ * @brief Appends the decimal digits starting at `begin` to `value`.
+ *
+ * Parsing stops at the first character that is not '0'-'9' or at `end`.
+ * Runs of 8 digits are converted at a time. Overflow of `T` is not detected.
+ *
+ * @tparam T Integral or floating-point type of the value
+ * @param begin First character to parse
+ * @param end End of the characters to parse
+ * @param[in,out] value Value to append the digits to
+ * @return Pointer to the first character that was not parsed
+ */
+template <typename T>
+CUDF_HOST_DEVICE inline char const* parse_digits(char const* begin, char const* end, T& value)
+{
+  while (end - begin >= 8) {
+    auto const chunk = load_eight_bytes(begin);
+    if (!is_eight_digits(chunk)) { break; }
+    value = (value * static_cast<T>(100000000)) + static_cast<T>(parse_eight_digits(chunk));
+    begin += 8;
+  }
+  while (begin < end && *begin >= '0' && *begin <= '9') {
+    value = (value * static_cast<T>(10)) + static_cast<T>(*begin - '0');
+    ++begin;
+  }
+  return begin;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
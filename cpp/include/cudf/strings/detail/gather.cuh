@@ -19,6 +19,7 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/strings/detail/offsets_accessor.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
@@ -28,6 +29,7 @@
 
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
@@ -303,8 +305,9 @@ std::unique_ptr<cudf::column> gather(
   auto out_offsets_column = make_numeric_column(
     data_type{type_id::INT32}, output_count + 1, mask_state::UNALLOCATED, stream, mr);
   auto const d_out_offsets = out_offsets_column->mutable_view().template data<int32_t>();
-  auto const d_in_offsets  = (strings_count > 0) ? strings.offsets_begin() : nullptr;
-  auto const d_strings     = column_device_view::create(strings.parent(), stream);
+  auto const d_in_offsets =
+    (strings_count > 0) ? make_offsets_accessor(strings) : offsets_accessor{nullptr, false};
+  auto const d_strings = column_device_view::create(strings.parent(), stream);
   thrust::transform(
     rmm::exec_policy(stream),
     begin,
@@ -313,7 +316,7 @@ std::unique_ptr<cudf::column> gather(
     [d_strings = *d_strings, d_in_offsets, strings_count] __device__(size_type in_idx) {
       if (NullifyOutOfBounds && (in_idx < 0 || in_idx >= strings_count)) return 0;
       if (not d_strings.is_valid(in_idx)) return 0;
-      return d_in_offsets[in_idx + 1] - d_in_offsets[in_idx];
+      return static_cast<int32_t>(d_in_offsets[in_idx + 1] - d_in_offsets[in_idx]);
     });
 
   // check total size is not too large
@@ -341,6 +344,17 @@ std::unique_ptr<cudf::column> gather(
                                        stream,
                                        mr);
 
+  // The output keeps the 64-bit offsets of the input
+  if (strings_count > 0 && strings.offsets().type().id() == type_id::INT64) {
+    auto wide_offsets_column = make_numeric_column(
+      data_type{type_id::INT64}, output_count + 1, mask_state::UNALLOCATED, stream, mr);
+    thrust::copy(rmm::exec_policy(stream),
+                 d_out_offsets,
+                 d_out_offsets + output_count + 1,
+                 wide_offsets_column->mutable_view().template data<int64_t>());
+    out_offsets_column = std::move(wide_offsets_column);
+  }
+
   return make_strings_column(output_count,
                              std::move(out_offsets_column),
                              std::move(out_chars_column),
@@ -18,6 +18,7 @@
 
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
@@ -37,6 +38,20 @@ std::unique_ptr<cudf::column> get_json_object(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * host_span<cudf::string_scalar const>, get_json_object_options,
+ * rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::unique_ptr<cudf::table> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Reads the offsets of a strings column as 64-bit values, whatever their stored type.
+ *
+ * The offsets child of a strings column is either INT32 or INT64. Kernels reading the offsets
+ * through this accessor handle both types without being instantiated for each of them.
+ */
+struct offsets_accessor {
+  void const* data;  ///< First offset of the column, accounting for the parent's offset
+  bool is_int64;     ///< True if the offsets are INT64, false if they are INT32
+
+  /**
+   * @brief Returns the offset at `index` relative to the first row of the column.
+   *
+   * @param index Index of the offset, in [0, size]
+   * @return The offset value
+   */
+  __device__ int64_t operator[](size_type index) const
+  {
+    return is_int64 ? static_cast<int64_t const*>(data)[index]
+                    : static_cast<int64_t>(static_cast<int32_t const*>(data)[index]);
+  }
+};
+
+/**
+ * @brief Creates an accessor for the offsets of a non-empty strings column.
+ *
+ * @param input Strings column instance
+ * @return Accessor for the offsets of `input`
+ */
+inline offsets_accessor make_offsets_accessor(strings_column_view const& input)
+{
+  auto const offsets  = input.offsets();
+  auto const is_int64 = offsets.type().id() == type_id::INT64;
+  CUDF_EXPECTS(is_int64 || offsets.type().id() == type_id::INT32,
+               "strings offsets must be INT32 or INT64");
+  auto const first = offsets.offset() + input.offset();
+  return is_int64 ? offsets_accessor{offsets.head<int64_t>() + first, true}
+                  : offsets_accessor{offsets.head<int32_t>() + first, false};
+}
+
+/**
+ * @copydoc make_offsets_accessor(strings_column_view const&)
+ */
+__device__ inline offsets_accessor make_offsets_accessor(column_device_view const& input)
+{
+  auto const& offsets = input.child(strings_column_view::offsets_column_index);
+  auto const is_int64 = offsets.type().id() == type_id::INT64;
+  return is_int64 ? offsets_accessor{offsets.data<int64_t>() + input.offset(), true}
+                  : offsets_accessor{offsets.data<int32_t>() + input.offset(), false};
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
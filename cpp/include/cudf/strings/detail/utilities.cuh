@@ -23,14 +23,17 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
 #include <thrust/scan.h>
 
+#include <limits>
 #include <mutex>
 #include <unordered_map>
 
@@ -184,6 +187,91 @@ auto make_strings_children(
   return make_strings_children(size_and_exec_fn, strings_count, strings_count, stream, mr);
 }
 
+/**
+ * @brief Creates child offsets and chars columns with a single write pass of the template
+ * function by writing each string into a temporary buffer sized from an upper bound of the
+ * size of each output string.
+ *
+ * The output strings are then compacted from the temporary buffer into the chars column.
+ * This avoids executing the size pass of `size_and_exec_fn` when a cheap upper bound of
+ * the output sizes is available. If the total of the upper bounds does not fit in
+ * `size_type`, this falls back to `make_strings_children`.
+ *
+ * @tparam SizeAndExecuteFunction Function must accept an index and return a size.
+ *         It must have members d_offsets and d_chars like for `make_strings_children`.
+ *         It must also have a member d_sizes and, when it is set, store the number of bytes
+ *         written for each non-null string there during the write pass.
+ * @tparam BoundIterator Iterator returning the maximum output size in bytes of each string.
+ *
+ * @param size_and_exec_fn This is called once to fill in the memory pointed to by d_chars
+ *        at the positions in d_offsets.
+ * @param bounds Upper bound of the output size of each string.
+ * @param strings_count Number of strings.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory.
+ * @return offsets child column and chars child column for a strings column
+ */
+template <typename SizeAndExecuteFunction, typename BoundIterator>
+auto make_strings_children_bounded(
+  SizeAndExecuteFunction size_and_exec_fn,
+  BoundIterator bounds,
+  size_type strings_count,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const total_bound =
+    thrust::reduce(rmm::exec_policy(stream), bounds, bounds + strings_count, int64_t{0});
+  if (total_bound > static_cast<int64_t>(std::numeric_limits<size_type>::max())) {
+    return make_strings_children(size_and_exec_fn, strings_count, stream, mr);
+  }
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, strings_count + 1, mask_state::UNALLOCATED, stream, mr);
+  auto offsets_view = offsets_column->mutable_view();
+  auto d_offsets    = offsets_view.template data<int32_t>();
+  // null strings and strings not written are empty
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(d_offsets, 0, (strings_count + 1) * sizeof(int32_t), stream.value()));
+  if (total_bound == 0) {
+    return std::pair(std::move(offsets_column), create_chars_child_column(0, stream, mr));
+  }
+
+  // position of each string in the temporary buffer
+  rmm::device_uvector<int32_t> positions(strings_count + 1, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), bounds, bounds + strings_count, positions.begin() + 1);
+  CUDF_CUDA_TRY(cudaMemsetAsync(positions.data(), 0, sizeof(int32_t), stream.value()));
+
+  // write each string and its size
+  rmm::device_uvector<char> buffer(total_bound, stream);
+  size_and_exec_fn.d_offsets = positions.data();
+  size_and_exec_fn.d_chars   = buffer.data();
+  size_and_exec_fn.d_sizes   = d_offsets;
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     size_and_exec_fn);
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), d_offsets, d_offsets + strings_count + 1, d_offsets);
+
+  // compact the strings into the chars column
+  auto const bytes = cudf::detail::get_value<int32_t>(offsets_view, strings_count, stream);
+  std::unique_ptr<column> chars_column = create_chars_child_column(bytes, stream, mr);
+  auto d_chars                         = chars_column->mutable_view().template data<char>();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    [d_buffer = buffer.data(), d_positions = positions.data(), d_offsets, d_chars] __device__(
+      size_type idx) {
+      memcpy(d_chars + d_offsets[idx],
+             d_buffer + d_positions[idx],
+             d_offsets[idx + 1] - d_offsets[idx]);
+    });
+
+  return std::pair(std::move(offsets_column), std::move(chars_column));
+}
+
 // This template is a thin wrapper around per-context singleton objects.
 // It maintains a single object for each CUDA context.
 template <typename TableType>
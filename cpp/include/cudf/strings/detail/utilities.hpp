@@ -54,6 +54,43 @@ rmm::device_uvector<string_view> create_string_vector_from_column(
   rmm::cuda_stream_view stream        = cudf::default_stream_value,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the indices of the rows with more than `threshold` bytes.
+ *
+ * Kernels that process a string per thread can use these to process the few long strings
+ * of a column with skewed lengths using many threads per string instead.
+ *
+ * @param input Strings column instance.
+ * @param threshold Number of bytes a row must exceed to be returned.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Indices of the long rows in ascending order.
+ */
+rmm::device_uvector<size_type> get_long_string_indices(strings_column_view const& input,
+                                                       size_type threshold,
+                                                       rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns true if every byte in the chars of `input` is an ASCII character.
+ *
+ * Functions can use this to process the bytes of ASCII-only columns directly without decoding
+ * UTF-8 characters. The entire chars child is checked even if `input` is sliced.
+ *
+ * @param input Strings column instance.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return True if all the chars are less than 0x80.
+ */
+bool is_all_ascii(strings_column_view const& input, rmm::cuda_stream_view stream);
+
+/**
+ * @brief Returns the value of an INT32 or INT64 strings offsets column at `index`.
+ *
+ * @param offsets Offsets child of a strings column.
+ * @param index Index of the offset, not accounting for the offset of the parent column.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The offset value.
+ */
+int64_t get_offset_value(column_view const& offsets, size_type index, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
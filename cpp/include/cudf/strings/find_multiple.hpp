@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
@@ -58,6 +59,41 @@ std::unique_ptr<column> find_multiple(
   strings_column_view const& targets,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of boolean columns identifying which of the target strings
+ * are found in each string.
+ *
+ * The output table has one column per target string and each column has `input.size()` rows.
+ *
+ * `output[j][i]` is true if `targets[j]` is found in `input[i]`
+ *
+ * All the targets are searched for in a single pass over each string so the work is
+ * proportional to the size of the input rather than the number of targets.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "def"]
+ * t = ["a", "c", "e"]
+ * r = contains_multiple(s, t)
+ * r is now {[ true, false],   // "a" found in "abc"
+ *           [ true, false],   // "c" found in "abc"
+ *           [false,  true]}   // "e" found in "def"
+ * @endcode
+ *
+ * Any null string entries return corresponding null entries in each output column.
+ *
+ * @throw cudf::logic_error if `targets` is empty or contains nulls
+ *
+ * @param input Strings instance for this operation.
+ * @param targets Strings to search for in each string.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return Table with a BOOL8 column for each target.
+ */
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/strings/regex/flags.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 
@@ -62,6 +63,35 @@ std::unique_ptr<table> findall(
   regex_flags const flags             = regex_flags::DEFAULT,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of strings columns for each matching occurrence of the
+ * regex pattern within each string.
+ *
+ * The number of output columns is determined by the string with the most
+ * matches.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["bunny","rabbit"]
+ * r = findall(s, "[ab]"")
+ * r is now a table of 3 columns:
+ *   ["b","a"]
+ *   [null,"b"]
+ *   [null,"b"]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param input Strings instance for this operation.
+ * @param prog Regex program instance.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of strings columns.
+ */
+std::unique_ptr<table> findall(
+  strings_column_view const& input,
+  regex_program const& prog,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a lists column of strings for each matching occurrence of the
  * regex pattern within each string.
@@ -96,6 +126,36 @@ std::unique_ptr<column> findall_record(
   regex_flags const flags             = regex_flags::DEFAULT,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a lists column of strings for each matching occurrence of the
+ * regex pattern within each string.
+ *
+ * Each output row includes all the substrings within the corresponding input row
+ * that match the given pattern. If no matches are found, the output row is empty.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["bunny", "rabbit", "hare", "dog"]
+ * r = findall_record(s, "[ab]")
+ * r is now a lists column like:
+ *  [ ["b"]
+ *    ["a","b","b"]
+ *    ["a"]
+ *    [] ]
+ * @endcode
+ *
+ * A null output row occurs if the corresponding input row is null.
+ *
+ * @param input Strings instance for this operation.
+ * @param prog Regex program instance.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of strings.
+ */
+std::unique_ptr<column> findall_record(
+  strings_column_view const& input,
+  regex_program const& prog,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 
@@ -167,6 +169,29 @@ std::unique_ptr<cudf::column> get_json_object(
   get_json_object_options options     = get_json_object_options{},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply multiple JSONPath strings to all rows in an input strings column.
+ *
+ * Equivalent to calling `get_json_object()` with each JSONPath string, but each row is read once
+ * for all the queries, and the parsing of the leading path operators that queries have in common
+ * (e.g. `$.a.b` in `$.a.b.c` and `$.a.b.d`) is shared between them. Use this to extract several
+ * fields from the same json strings.
+ *
+ * @throw cudf::logic_error if any of the JSONPath strings is invalid
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param options Options for controlling the behavior of the function
+ * @param mr Resource for allocating device memory.
+ * @return New table with one strings column per JSONPath string, in the order of `json_paths`,
+ * containing the retrieved json object strings
+ */
+std::unique_ptr<cudf::table> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<cudf::string_scalar const> json_paths,
+  get_json_object_options options     = get_json_object_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
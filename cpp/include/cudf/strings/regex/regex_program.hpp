@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/strings/regex/flags.hpp>
+#include <cudf/types.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+
+/**
+ * @addtogroup strings_contains
+ * @{
+ */
+
+/**
+ * @brief Regex program class
+ *
+ * Create an instance from the static `create` function and pass it to any of the regex APIs.
+ * The pattern is compiled once on creation. The device copy of the compiled program is
+ * created on the first call using a given stream and reused by all later calls on that stream.
+ *
+ * An instance may be shared by multiple threads. It must outlive the streams it was used on
+ * and all the APIs it is passed to.
+ */
+struct regex_program {
+  struct regex_program_impl;
+
+  /**
+   * @brief Create a program from a pattern
+   *
+   * @throw cudf::logic_error If pattern is invalid or contains unsupported features
+   *
+   * @param pattern Regex pattern
+   * @param flags Regex flags for interpreting special characters in the pattern
+   * @return Instance of this object
+   */
+  static std::unique_ptr<regex_program> create(std::string_view pattern,
+                                               regex_flags flags = regex_flags::DEFAULT);
+
+  regex_program()                     = delete;
+  regex_program(regex_program const&) = delete;
+  regex_program& operator=(regex_program const&) = delete;
+
+  /**
+   * @brief Move constructor
+   *
+   * @param other Object to move from
+   */
+  regex_program(regex_program&& other);
+
+  /**
+   * @brief Move operator assignment
+   *
+   * @param other Object to move from
+   * @return this object
+   */
+  regex_program& operator=(regex_program&& other);
+
+  ~regex_program();
+
+  /**
+   * @brief Return the pattern used to create this instance
+   *
+   * @return regex pattern as a string
+   */
+  [[nodiscard]] std::string pattern() const;
+
+  /**
+   * @brief Return the regex_flags used to create this instance
+   *
+   * @return regex flags setting
+   */
+  [[nodiscard]] regex_flags flags() const;
+
+  /**
+   * @brief Return the number of instructions in this instance
+   *
+   * @return Number of instructions
+   */
+  [[nodiscard]] int32_t instructions_count() const;
+
+  /**
+   * @brief Return the number of capture groups in this instance
+   *
+   * @return Number of groups
+   */
+  [[nodiscard]] int32_t groups_count() const;
+
+ private:
+  std::string _pattern;
+  regex_flags _flags;
+
+  std::unique_ptr<regex_program_impl> _impl;
+
+  /**
+   * @brief Constructor
+   *
+   * Called by create()
+   */
+  regex_program(std::string_view pattern, regex_flags flags);
+
+  friend struct regex_device_builder;
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
@@ -118,6 +118,8 @@ std::unique_ptr<column> replace_slice(
  * All occurrences found in each string are replaced.
  *
  * This does not use regex to match targets in the string.
+ * When more than one target matches at the same position, the first one in `targets` is
+ * replaced. Empty target strings are ignored.
  *
  * Null string entries will return null output string entries.
  *
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/regex/flags.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -58,6 +59,28 @@ std::unique_ptr<column> replace_re(
   regex_flags const flags                    = regex_flags::DEFAULT,
   rmm::mr::device_memory_resource* mr        = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief For each string, replaces any character sequence matching the given pattern
+ * with the provided replacement string.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Regex program instance.
+ * @param replacement The string used to replace the matched sequence in each string.
+ *        Default is an empty string.
+ * @param max_replace_count The maximum number of times to replace the matched pattern
+ *        within each string. Default replaces every substring that is matched.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column.
+ */
+std::unique_ptr<column> replace_re(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  string_scalar const& replacement           = string_scalar(""),
+  std::optional<size_type> max_replace_count = std::nullopt,
+  rmm::mr::device_memory_resource* mr        = rmm::mr::get_current_device_resource());
+
 /**
  * @brief For each string, replaces any character sequence matching the given patterns
  * with the corresponding string in the `replacements` column.
@@ -105,5 +128,26 @@ std::unique_ptr<column> replace_with_backrefs(
   regex_flags const flags             = regex_flags::DEFAULT,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief For each string, replaces any character sequence matching the given pattern
+ * using the replacement template for back-references.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @throw cudf::logic_error if capture index values in `replacement` are not in range 0-99, and also
+ * if the index exceeds the group count specified in the pattern
+ *
+ * @param strings Strings instance for this operation.
+ * @param prog Regex program instance.
+ * @param replacement The replacement template for creating the output string.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column.
+ */
+std::unique_ptr<column> replace_with_backrefs(
+  strings_column_view const& strings,
+  regex_program const& prog,
+  std::string_view replacement,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 }  // namespace strings
 }  // namespace cudf
@@ -85,6 +85,45 @@ std::unique_ptr<table> rsplit(
   size_type maxsplit                  = -1,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a table of exactly `num_columns` columns by splitting each string using the
+ * specified delimiter.
+ *
+ * The first `num_columns - 1` tokens of each string go into the first columns and the remainder
+ * of the string into the last column, as with `split()` using `maxsplit = num_columns - 1`.
+ * Null entries are added for a row where split results have been exhausted. Unlike `split()`,
+ * the output always has `num_columns` columns, even if every row has fewer tokens.
+ *
+ * Since the number of columns is known up front, the tokens of each string are located in a
+ * single pass over its characters. This is faster than `split()` when splitting strings of a
+ * known layout like the fields of CSV records.
+ *
+ * @code{.pseudo}
+ * s = ["a,b,c", "d,e", null, "f,g,h,i"]
+ * t = split_to_columns(s, 3, ",")
+ * t is [ ["a", "d", null, "f"],
+ *        ["b", "e", null, "g"],
+ *        ["c", null, null, "h,i"] ]
+ * @endcode
+ *
+ * Any null string entries return corresponding null output columns.
+ *
+ * @throw cudf::logic_error if `num_columns` is not positive.
+ * @throw cudf::logic_error if `delimiter` is invalid.
+ *
+ * @param strings_column Strings instance for this operation.
+ * @param num_columns Number of columns of the output table.
+ * @param delimiter UTF-8 encoded string indicating the split points in each string.
+ *        Default of empty string indicates split on whitespace.
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of `num_columns` strings columns.
+ */
+std::unique_ptr<table> split_to_columns(
+  strings_column_view const& strings_column,
+  size_type num_columns,
+  string_scalar const& delimiter      = string_scalar(""),
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Splits individual strings elements into a list of strings.
  *
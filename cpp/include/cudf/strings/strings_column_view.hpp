@@ -88,8 +88,10 @@ class strings_column_view : private column_view {
   /**
    * @brief Return an iterator for the offsets child column.
    *
-   * This automatically applies the offset of the parent.
+   * This automatically applies the offset of the parent. Columns with INT64 offsets must be
+   * read through `cudf::strings::detail::offsets_accessor` instead.
    *
+   * @throw cudf::logic_error if the offsets are not INT32
    * @return Iterator pointing to the first offset value.
    */
   [[nodiscard]] offset_iterator offsets_begin() const;
@@ -99,6 +101,7 @@ class strings_column_view : private column_view {
    *
    * This automatically applies the offset of the parent.
    *
+   * @throw cudf::logic_error if the offsets are not INT32
    * @return Iterator pointing 1 past the last offset value.
    */
   [[nodiscard]] offset_iterator offsets_end() const;
@@ -124,6 +124,16 @@ class table {
    */
   std::vector<std::unique_ptr<column>> release();
 
+  /**
+   * @brief Returns a new table whose columns share the device memory of the
+   * columns of this table.
+   *
+   * @see column::share()
+   *
+   * @returns A table equal to this table
+   */
+  [[nodiscard]] std::unique_ptr<table> share() const;
+
   /**
    * @brief Returns a table_view built from a range of column indices.
    *
@@ -16,12 +16,14 @@
 #pragma once
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <cassert>
 #include <memory>
@@ -150,8 +152,9 @@ class table_device_view_base {
    */
   table_device_view_base(HostTableView source_view, rmm::cuda_stream_view stream);
 
-  /// Pointer to device memory holding the descendant storage
-  rmm::device_buffer* _descendant_storage{};
+  /// Pointer to the owner of the device memory holding the descendant storage, which may be
+  /// shared with the device view cache
+  std::shared_ptr<rmm::device_buffer>* _descendant_storage{};
 };
 }  // namespace detail
 
@@ -234,10 +237,14 @@ class mutable_table_device_view
  * @tparam HostTableView The type of the table_view to copy from
  * @param source_view The table_view to copy from
  * @param stream The stream to use for device memory allocation
+ * @param mr Device memory resource used to allocate the device views
  * @return tuple of device_buffer and @p ColumnDeviceView device pointer
  */
 template <typename ColumnDeviceView, typename HostTableView>
-auto contiguous_copy_column_device_views(HostTableView source_view, rmm::cuda_stream_view stream)
+auto contiguous_copy_column_device_views(
+  HostTableView source_view,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   // First calculate the size of memory needed to hold the
   // table's ColumnDeviceViews. This is done by calling extent()
@@ -260,14 +267,15 @@ auto contiguous_copy_column_device_views(HostTableView source_view, rmm::cuda_st
   // ColumnDeviceViews so the column can set the pointer(s) for any
   // of its child objects.
   // align both h_ptr, d_ptr
-  auto descendant_storage = std::make_unique<rmm::device_buffer>(padded_views_size_bytes, stream);
-  void* h_ptr             = detail::align_ptr_for_type<ColumnDeviceView>(h_buffer.data());
+  auto descendant_storage =
+    std::make_unique<rmm::device_buffer>(padded_views_size_bytes, stream, mr);
+  void* h_ptr    = detail::align_ptr_for_type<ColumnDeviceView>(h_buffer.data());
   void* d_ptr    = detail::align_ptr_for_type<ColumnDeviceView>(descendant_storage->data());
   auto d_columns = detail::child_columns_to_device_array<ColumnDeviceView>(
     source_view.begin(), source_view.end(), h_ptr, d_ptr);
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(d_ptr, h_ptr, views_size_bytes, cudaMemcpyDefault, stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return std::make_tuple(std::move(descendant_storage), d_columns);
 }
 
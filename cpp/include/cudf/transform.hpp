@@ -22,6 +22,7 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -56,6 +57,59 @@ std::unique_ptr<column> transform(
   bool is_ptx,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Creates a new table by applying a unary function against every
+ * element of every column of an input table.
+ *
+ * Computes:
+ * `out[j][i] = F(in[j][i])`
+ *
+ * All the columns are transformed by a single kernel, so the UDF is compiled and
+ * launched once instead of once per column. The null mask of each output column
+ * is the same as the null mask of its input column.
+ *
+ * @throws cudf::logic_error if the columns of `input` do not all have the same fixed-width type.
+ *
+ * @param input         An immutable view of the input table to transform
+ * @param unary_udf     The PTX/CUDA string of the unary function to apply
+ * @param output_type   The output type that is compatible with the output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ * @param mr            Device memory resource used to allocate the returned table's device memory
+ * @return              The table resulting from applying the unary function to
+ *                      every element of the input
+ */
+std::unique_ptr<table> transform(
+  table_view const& input,
+  std::string const& unary_udf,
+  data_type output_type,
+  bool is_ptx,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Applies a unary function against every element of every column of an
+ * input table, writing the results into the columns of `output`.
+ *
+ * Computes:
+ * `output[j][i] = F(input[j][i])`
+ *
+ * All the columns are transformed by a single kernel. Only the data of `output` is
+ * written, its null masks are left to the caller.
+ *
+ * @throws cudf::logic_error if `input` and `output` differ in their number of columns or rows.
+ * @throws cudf::logic_error if the columns of `input` do not all have the same fixed-width type.
+ * @throws cudf::logic_error if the columns of `output` do not all have the same fixed-width type.
+ *
+ * @param input         An immutable view of the input table to transform
+ * @param unary_udf     The PTX/CUDA string of the unary function to apply
+ * @param output        The table the results are written to, whose type is compatible with the
+ *                      output type in the UDF
+ * @param is_ptx        true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ */
+void transform(table_view const& input,
+               std::string const& unary_udf,
+               mutable_table_view output,
+               bool is_ptx);
+
 /**
  * @brief Creates a null_mask from `input` by converting `NaN` to null and
  * preserving existing null values and also returns new null_count.
@@ -89,6 +143,34 @@ std::unique_ptr<column> compute_column(
   ast::expression const& expr,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the same column as `compute_column`, evaluating the expression with a kernel
+ * JIT-compiled for it instead of the AST interpreter.
+ *
+ * The generated kernel evaluates the whole expression tree for a row in registers, avoiding the
+ * per-operator dispatch and intermediate storage of the interpreter, which dominate the
+ * evaluation of deep expressions. The kernel is cached by the shape of the expression and the
+ * types and nullability of the referenced columns, so it is reused for other tables and literal
+ * values, but the first evaluation of a new expression pays for its compilation.
+ *
+ * Only numeric and boolean columns and literals are supported. All operators on them are
+ * supported, including the math operators and the null-aware `NULL_EQUAL`, `NULL_LOGICAL_AND`
+ * and `NULL_LOGICAL_OR`; the string and timestamp operators are not.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ * @throws cudf::logic_error if the expression uses an unsupported operator, column type or literal
+ * type.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param mr Device memory resource
+ * @return std::unique_ptr<column> Output column
+ */
+std::unique_ptr<column> jit_compute_column(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a bitmask from a column of boolean elements.
  *
@@ -108,6 +190,14 @@ std::pair<std::unique_ptr<rmm::device_buffer>, cudf::size_type> bools_to_mask(
   column_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Order of the distinct rows returned by `encode`.
+ */
+enum class encode_key_order : bool {
+  SORTED,           ///< Ascending order, with nulls at the end
+  FIRST_APPEARANCE  ///< Order of the first occurrence of every distinct row in the input
+};
+
 /**
  * @brief Encode the rows of the given table as integers
  *
@@ -136,6 +226,33 @@ std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
   cudf::table_view const& input,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Encode the rows of the given table as integers, with the distinct rows in the given
+ * order.
+ *
+ * The codes are assigned with a hash table: every row is inserted into it, and the code of a row
+ * is that of the group of equal rows it finds there. With `encode_key_order::FIRST_APPEARANCE`
+ * the keys are neither sorted nor searched at all. With `encode_key_order::SORTED` only the
+ * distinct rows are sorted and the codes remapped, which gives the same result as
+ * `encode(input, mr)`.
+ *
+ * @code{.pseudo}
+ * input: [{'b', 'a', 'b', 'c'}]
+ * key_order: FIRST_APPEARANCE
+ * output: [{'b', 'a', 'c'}], {0, 1, 0, 2}
+ * @endcode
+ *
+ * @param input Table containing values to be encoded
+ * @param key_order The order of the returned distinct rows, which the codes index
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return A pair containing the distinct rows of the input table in the given order, and a
+ * column of integer indices representing the encoded rows.
+ */
+std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
+  cudf::table_view const& input,
+  encode_key_order key_order,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Encodes `input` by generating a new column for each value in `categories` indicating the
  * presence of that value in `input`.
@@ -224,5 +341,50 @@ std::unique_ptr<column> row_bit_count(
   table_view const& t,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns an estimate of the size in bytes of all columns in the `table_view`.
+ *
+ * The estimate is the sum of `row_bit_count` over all the rows, rounded up to a whole number of
+ * bytes, with the same approximations: the terminating offsets of strings and lists columns, the
+ * padding of the allocations and the data of rows nullified by a parent struct are not
+ * accounted for exactly. The estimate of a slice of a table is obtained by passing the
+ * `table_view` of the slice.
+ *
+ * Unlike `row_bit_count`, the cost does not depend on the number of rows: the size of a table of
+ * fixed-width columns is computed on the host, and the offsets of strings and lists columns are
+ * only read at the bounds of the rows.
+ *
+ * @throws cudf::logic_error if the table contains dictionary columns
+ *
+ * @param t The table view to estimate the size of
+ * @return The estimated size of the table in bytes
+ */
+std::size_t estimate_size(table_view const& t);
+
+/**
+ * @brief Returns estimates of the sizes in bytes of the tables that `cudf::split` returns for
+ * the given split indices.
+ *
+ * The sizes of all the slices are computed in a single pass, each estimated as by
+ * `cudf::estimate_size`. This allows choosing the split indices of chunked IO or of
+ * `cudf::contiguous_split` from cheap candidate splits.
+ *
+ * @code{.pseudo}
+ * t      = {{1, 2, 3, 4, 5}, {"a", "bb", "ccc", "", "d"}}
+ * splits = {2, 4}
+ * output = {2 * 4 + 2 * 4 + 3, 2 * 4 + 2 * 4 + 3, 4 + 4 + 1} = {19, 19, 9}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `splits` is not sorted or has an index outside of
+ * `[0, t.num_rows()]`
+ * @throws cudf::logic_error if the table contains dictionary columns
+ *
+ * @param t The table view to estimate the sizes of the slices of
+ * @param splits The indices at which the table is split, as by `cudf::split`
+ * @return The estimated sizes in bytes of the `splits.size() + 1` slices
+ */
+std::vector<std::size_t> estimate_split_sizes(table_view const& t,
+                                              std::vector<size_type> const& splits);
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -119,6 +119,25 @@ std::unique_ptr<column> cast(
   data_type out_type,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Casts data from dtype specified in input to dtype specified in output.
+ *
+ * Same as the `column_view` overload, except that if `input` is already of `out_type`
+ * the returned column shares the device memory of `input`, see `column::share()`,
+ * instead of copying it.
+ *
+ * @param input Input column
+ * @param out_type Desired datatype of output column
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns Column of same size as `input` containing result of the cast operation
+ * @throw cudf::logic_error if `out_type` is not a fixed-width type
+ */
+std::unique_ptr<column> cast(
+  column const& input,
+  data_type out_type,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
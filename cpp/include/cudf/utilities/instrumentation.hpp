@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+
+/**
+ * @brief Measurements of one call to a libcudf API.
+ */
+struct api_call_info {
+  char const* name;              ///< Name of the called function
+  rmm::cuda_stream_view stream;  ///< Stream on which the GPU time was measured
+  float elapsed_ms;              ///< GPU time in milliseconds from the start to the end of the call
+  std::size_t bytes_allocated;   ///< Total bytes allocated during the call
+  std::size_t peak_bytes;        ///< Peak of the bytes allocated and not yet freed during the call
+};
+
+/**
+ * @brief Interface receiving the measurements of each libcudf API call.
+ *
+ * Only the outermost call is reported when a libcudf API calls another one on the same thread.
+ * `on_api_call` runs on the thread that made the call, so an observer shared by several threads
+ * must synchronize itself.
+ */
+class api_call_observer {
+ public:
+  virtual ~api_call_observer() = default;
+
+  /**
+   * @brief Called after each observed API call returns.
+   *
+   * @param info Measurements of the call
+   */
+  virtual void on_api_call(api_call_info const& info) = 0;
+};
+
+/**
+ * @brief Installs an observer of libcudf API calls, or removes it if `observer` is null.
+ *
+ * Instrumentation is off by default and costs nothing more than a flag check while no observer
+ * is installed. An observed call records CUDA events on `cudf::default_stream_value` around the
+ * call and waits for the end event, so calls no longer overlap with the host thread.
+ *
+ * Installing an observer wraps the current device memory resource in a resource adaptor that
+ * counts the bytes allocated by each thread, and removing it restores the wrapped resource. Only
+ * allocations made through the current device resource are counted, so memory allocated from a
+ * resource passed explicitly as `mr` is not included. The current device resource should not be
+ * replaced while an observer is installed.
+ *
+ * This function must not be called while libcudf calls are running on other threads.
+ *
+ * @param observer Observer to install, or null to turn the instrumentation off
+ */
+void set_api_call_observer(std::shared_ptr<api_call_observer> observer);
+
+/**
+ * @brief Returns the installed observer of libcudf API calls.
+ *
+ * @return The observer, or null if the instrumentation is off
+ */
+std::shared_ptr<api_call_observer> get_api_call_observer();
+
+/**
+ * @brief A point where libcudf blocked the host thread until a stream completed its work.
+ */
+struct sync_point_info {
+  char const* api;               ///< Outermost libcudf API that synchronized, empty outside any
+  rmm::cuda_stream_view stream;  ///< Synchronized stream
+  float elapsed_ms;              ///< Time in milliseconds the host thread waited for the stream
+};
+
+/**
+ * @brief Starts recording the host sync points of libcudf on all threads.
+ *
+ * Each time libcudf synchronizes a stream internally, for example to copy a size or a vector of
+ * results to the host, the sync point is recorded with the API that caused it. Recording adds a
+ * timer and a lock to every sync point and is off by default.
+ *
+ * Any sync points recorded since the previous start are discarded.
+ */
+void start_recording_sync_points();
+
+/**
+ * @brief Stops recording the host sync points of libcudf.
+ *
+ * @return The sync points recorded since `start_recording_sync_points` was called, in the order
+ * they completed
+ */
+std::vector<sync_point_info> stop_recording_sync_points();
+
+}  // namespace cudf
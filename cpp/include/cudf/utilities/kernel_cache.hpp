@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace cudf {
+/**
+ * @addtogroup utility_kernel_cache
+ * @{
+ * @file
+ * @brief Statistics and limits of the cache of runtime compiled (JIT) kernels, and the tuning
+ * of the block sizes of kernels
+ */
+
+/**
+ * @brief Counters of the kernel requests served by the JIT kernel cache.
+ *
+ * A request is a hit when the same kernel was already requested by this process, and a miss
+ * when the kernel had to be compiled or loaded from the on-disk cache.
+ */
+struct kernel_cache_statistics {
+  std::size_t hits{};                    ///< Number of kernels found in memory
+  std::size_t misses{};                  ///< Number of kernels compiled or loaded from disk
+  std::chrono::nanoseconds miss_time{};  ///< Total time spent serving the misses
+};
+
+/**
+ * @brief Returns the statistics of the JIT kernel cache since the last reset.
+ *
+ * @return Current kernel cache statistics
+ */
+kernel_cache_statistics get_kernel_cache_statistics();
+
+/**
+ * @brief Resets the hit and miss counters of the JIT kernel cache.
+ *
+ * Kernels already in the cache remain cached, so requesting them again counts as a hit.
+ */
+void reset_kernel_cache_statistics();
+
+/**
+ * @brief Sets the maximum number of kernels the JIT kernel cache keeps.
+ *
+ * These limits override the `LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS` and
+ * `LIBCUDF_KERNEL_CACHE_LIMIT_DISK` environment variables. When a limit is exceeded the least
+ * recently used kernels are evicted. A disk limit of zero disables the on-disk cache of the
+ * programs that are loaded after the call.
+ *
+ * @param max_kernels_per_process Maximum number of kernels kept in memory per program
+ * @param max_kernels_on_disk Maximum number of kernels kept on disk per program
+ */
+void set_kernel_cache_limits(std::size_t max_kernels_per_process, std::size_t max_kernels_on_disk);
+
+/**
+ * @brief Enables or disables the tuning of the block size of tunable kernels.
+ *
+ * When enabled, the first large enough launch of a tunable kernel on a device times each of its
+ * candidate block sizes, and the fastest one is used from then on. The tuned block sizes are
+ * appended to the file `kernel_tuning.txt` of the JIT kernel cache directory, which is per
+ * compute capability, so each kernel is only tuned once per device model. Whether enabled or not,
+ * kernels use the block sizes already tuned for the device and otherwise their default ones.
+ *
+ * This setting overrides the `LIBCUDF_KERNEL_TUNING` environment variable, which enables tuning
+ * when set to a nonzero value. Tuning is disabled by default.
+ *
+ * @param enable Whether to tune the kernels that have no tuned block size yet
+ */
+void set_kernel_tuning(bool enable);
+
+/**
+ * @brief Forgets the block sizes tuned for the compute capability of the current device.
+ *
+ * The tuning file of the current device is removed, so that kernels are launched with their
+ * default block sizes or, if tuning is enabled, tuned again.
+ */
+void clear_kernel_tunings();
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/utilities/instrumentation.hpp>
+
+namespace cudf {
+namespace test {
+
+/**
+ * @brief Fails the current test if libcudf synchronizes a stream during the lifetime of the
+ * object.
+ *
+ * Used to check that APIs documented as asynchronous do not block the host. Each sync point is
+ * reported as a separate failure naming the API that caused it.
+ *
+ * @code
+ * {
+ *   cudf::test::sync_point_checker no_syncs;
+ *   auto result = cudf::cast(input, cudf::data_type{cudf::type_id::INT64});
+ * }
+ * @endcode
+ */
+class sync_point_checker {
+ public:
+  sync_point_checker() { cudf::start_recording_sync_points(); }
+
+  ~sync_point_checker()
+  {
+    for (auto const& sync_point : cudf::stop_recording_sync_points()) {
+      ADD_FAILURE() << "Unexpected host sync point in \"" << sync_point.api << "\" on stream "
+                    << sync_point.stream.value();
+    }
+  }
+
+  sync_point_checker(sync_point_checker const&) = delete;
+  sync_point_checker& operator=(sync_point_checker const&) = delete;
+};
+
+}  // namespace test
+}  // namespace cudf
@@ -108,6 +108,7 @@
  *   @{
  *     @defgroup interop_dlpack DLPack
  *     @defgroup interop_arrow Arrow
+ *     @defgroup interop_row_format Row Format
  *   @}
  * @}
  * @defgroup datetime_apis DateTime
@@ -160,6 +161,7 @@
  *   @defgroup nvtext_normalize Normalizing
  *   @defgroup nvtext_stemmer Stemming
  *   @defgroup nvtext_edit_distance Edit Distance
+ *   @defgroup nvtext_minhash MinHash
  *   @defgroup nvtext_tokenize Tokenizing
  *   @defgroup nvtext_replace Replacing
  * @}
@@ -169,6 +171,8 @@
  *   @defgroup utility_dispatcher Type Dispatcher
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
+ *   @defgroup utility_kernel_cache JIT Kernel Cache
+ *   @defgroup utility_spilling Spilling
  * @}
  * @defgroup labeling_apis Labeling
  * @{
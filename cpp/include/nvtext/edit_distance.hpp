@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 //! NVText APIs
 namespace nvtext {
@@ -97,5 +98,40 @@ std::unique_ptr<cudf::column> edit_distance_matrix(
   cudf::strings_column_view const& strings,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the pairs of strings in the input column within `max_distance` edits
+ * of each other.
+ *
+ * This computes the same values as `edit_distance_matrix` but only for each pair once
+ * and only returns the pairs with an edit distance no greater than `max_distance`.
+ * Pairs whose lengths differ by more than `max_distance` are not computed at all.
+ *
+ * The output table has 3 INT32 columns: the row index of the first string, the row index
+ * of the second string, and the edit distance between them. The first row index is always
+ * less than the second row index and the pairs are ordered by the first and then the second.
+ *
+ * @code{.pseudo}
+ * s = ["hello", "hallo", "world", "hella"]
+ * t = edit_distance_pairs(s, 2)
+ * t is now [[0, 0, 1],
+ *           [1, 3, 3],
+ *           [1, 1, 2]]
+ * @endcode
+ *
+ * Null entries for `strings` are ignored and the edit distance
+ * is computed as though the null entry is an empty string.
+ *
+ * @throw cudf::logic_error if `max_distance < 0`
+ *
+ * @param strings Strings column of input strings
+ * @param max_distance Largest edit distance of the pairs to return
+ * @param mr Device memory resource used to allocate the returned table's device memory.
+ * @return New table of the row indices and edit distance of each pair.
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(
+  cudf::strings_column_view const& strings,
+  cudf::size_type max_distance,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -90,5 +91,65 @@ std::unique_ptr<cudf::column> generate_character_ngrams(
   cudf::size_type ngrams              = 2,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the hash of each ngram `generate_ngrams` would produce for the input.
+ *
+ * Each output row is the MurmurHash3_32 value, computed with `seed`, of the ngram string
+ * at the same row of the `generate_ngrams` output. The ngram strings themselves are
+ * never built.
+ *
+ * ```
+ * ["a", "bb", "ccc"] would generate bigram hashes as [hash("a_bb"), hash("bb_ccc")]
+ * ```
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ * @throw cudf::logic_error if `separator` is invalid
+ * @throw cudf::logic_error if there are not enough strings to generate any ngrams
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ * @param separator The string used for separating ngram tokens before hashing.
+ * @param seed The seed value for the hash algorithm.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New UINT32 column of ngram hashes.
+ */
+std::unique_ptr<cudf::column> hash_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams               = 2,
+  cudf::string_scalar const& separator = cudf::string_scalar{"_"},
+  uint32_t seed                        = cudf::DEFAULT_HASH_SEED,
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the hashes of the character ngrams within each string.
+ *
+ * Each character ngram `generate_character_ngrams` would produce for a string is
+ * hashed with MurmurHash3_32 using `seed` and the hashes are returned as a list
+ * for each input row. The ngram strings themselves are never built.
+ *
+ * ```
+ * ["abc", "de"] would generate bigram hashes as
+ * [[hash("ab"), hash("bc")], [hash("de")]]
+ * ```
+ *
+ * A string with fewer than `ngrams` characters produces an empty list.
+ * A null input element at row `i` produces a corresponding null list at row `i`.
+ *
+ * @throw cudf::logic_error if `ngrams < 2`
+ *
+ * @param strings Strings column to produce ngram hashes from.
+ * @param ngrams The ngram number to generate.
+ * @param seed The seed value for the hash algorithm.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New lists column of UINT32 hashes.
+ */
+std::unique_ptr<cudf::column> hash_character_ngrams(
+  cudf::strings_column_view const& strings,
+  cudf::size_type ngrams              = 2,
+  uint32_t seed                       = cudf::DEFAULT_HASH_SEED,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+//! NVText APIs
+namespace nvtext {
+/**
+ * @addtogroup nvtext_minhash
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Returns the minhash signature of each string using character n-grams.
+ *
+ * Each string is split into n-grams of `width` consecutive characters. For each seed, every
+ * n-gram is hashed using MurmurHash3_32 with that seed and the minimum hash value is kept.
+ * Strings with similar sets of n-grams have similar signatures so the fraction of equal
+ * values in the signatures of two strings estimates their Jaccard similarity.
+ *
+ * A string with fewer than `width` characters is hashed as a single n-gram.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abcdef", "abcdeg"]
+ * seeds = [0, 1]
+ * h = minhash(s, seeds, 4)
+ * h is a lists column with 2 hash values per row computed from
+ *   ["abcd", "bcde", "cdef"] and ["abcd", "bcde", "cdeg"]
+ * @endcode
+ *
+ * The output is a lists column of UINT32 values with `seeds.size()` values per row.
+ * Any null row entries result in corresponding null output rows.
+ * Empty strings result in the maximum UINT32 value for each seed.
+ *
+ * @throw cudf::logic_error if `width < 2`
+ * @throw cudf::logic_error if `seeds` is empty
+ * @throw cudf::logic_error if `seeds.size() * input.size()` exceeds the column size limit
+ *
+ * @param input Strings column to compute minhash signatures for
+ * @param seeds Seed values used for the hash algorithm
+ * @param width The number of characters in each n-gram
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of minhash values for each string
+ */
+std::unique_ptr<cudf::column> minhash(
+  cudf::strings_column_view const& input,
+  cudf::device_span<cudf::hash_value_type const> seeds,
+  cudf::size_type width               = 4,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the minhash signature of each string using word n-grams.
+ *
+ * This is the same as `minhash` except the n-grams are made of `width` consecutive
+ * words where words are separated by whitespace. Each n-gram is hashed as the substring
+ * from the first byte of its first word to the last byte of its last word so the
+ * whitespace between the words is included as is. Use `normalize_spaces` first
+ * if the whitespace between words should not change the signature.
+ *
+ * A string with fewer than `width` words is hashed as a single n-gram.
+ * Empty strings and strings with only whitespace result in the maximum UINT32
+ * value for each seed.
+ *
+ * @throw cudf::logic_error if `width < 1`
+ * @throw cudf::logic_error if `seeds` is empty
+ * @throw cudf::logic_error if `seeds.size() * input.size()` exceeds the column size limit
+ *
+ * @param input Strings column to compute minhash signatures for
+ * @param seeds Seed values used for the hash algorithm
+ * @param width The number of words in each n-gram
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of minhash values for each string
+ */
+std::unique_ptr<cudf::column> word_minhash(
+  cudf::strings_column_view const& input,
+  cudf::device_span<cudf::hash_value_type const> seeds,
+  cudf::size_type width               = 2,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns locality-sensitive hashing bucket IDs for minhash signatures.
+ *
+ * Each signature is divided into `bands` consecutive bands of equal size and the values
+ * in each band are hashed into a bucket ID. Two rows share a bucket ID for a band only if
+ * all the values in that band are equal, which is likely only for similar strings.
+ * Grouping the rows by bucket ID finds the candidate pairs of near-duplicates without
+ * comparing every pair of rows.
+ *
+ * The upper 32 bits of each bucket ID are the band index so bucket IDs from different
+ * bands never match.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = minhash(strings, seeds)  // 20 values per row
+ * b = minhash_buckets(s, 5)    // 5 bands of 4 values
+ * b is a lists column with 5 bucket IDs per row
+ * @endcode
+ *
+ * The output is a lists column of UINT64 values with `bands` values per row.
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw cudf::logic_error if `signatures` is not a lists column of UINT32 values
+ * @throw cudf::logic_error if the rows do not all have the same number of values
+ * @throw cudf::logic_error if `bands` is not positive or does not evenly divide the
+ *        number of values per row
+ *
+ * @param signatures Minhash values as returned by `minhash` or `word_minhash`
+ * @param bands Number of bands to divide each signature into
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of bucket IDs for each row
+ */
+std::unique_ptr<cudf::column> minhash_buckets(
+  cudf::lists_column_view const& signatures,
+  cudf::size_type bands,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace nvtext
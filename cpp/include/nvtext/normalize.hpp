@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 //! NVText APIs
@@ -101,5 +102,50 @@ std::unique_ptr<cudf::column> normalize_characters(
   bool do_lower_case,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Normalizes the characters of each string and returns the ngrams of
+ * the whitespace-delimited tokens.
+ *
+ * This produces the same result as calling `normalize_spaces` (optionally),
+ * `normalize_characters` and then `ngrams_tokenize` with an empty delimiter but
+ * tokenizes the normalized characters directly so the intermediate normalized
+ * strings column is never created.
+ *
+ * Specifying `ngrams = 1` returns the tokens themselves.
+ *
+ * @code{.pseudo}
+ * s = ["The Quick, Brown", "fox"]
+ * t = normalize_and_tokenize(s, true, 1)
+ * t is now ["the", "quick", ",", "brown", "fox"]
+ * t = normalize_and_tokenize(s, true, 2)
+ * t is now ["the_quick", "quick_,", ",_brown"]
+ * @endcode
+ *
+ * All null row entries are ignored and the output contains all valid rows.
+ *
+ * This function requires about 16x the number of character bytes in the input
+ * strings column as working memory.
+ *
+ * @throw cudf::logic_error if `ngrams < 1`
+ * @throw cudf::logic_error if `separator` is invalid
+ *
+ * @param strings The input strings to normalize and tokenize.
+ * @param do_lower_case If true, upper-case characters are converted to
+ *        lower-case and accents are stripped from those characters.
+ *        If false, accented and upper-case characters are not transformed.
+ * @param ngrams The ngram number to generate.
+ *               Default is 1 which returns the tokens.
+ * @param separator The string to use for separating ngram tokens.
+ *                  Default is "_" character.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column of tokens or ngrams.
+ */
+std::unique_ptr<cudf::column> normalize_and_tokenize(
+  cudf::strings_column_view const& strings,
+  bool do_lower_case,
+  cudf::size_type ngrams               = 1,
+  cudf::string_scalar const& separator = cudf::string_scalar{"_"},
+  rmm::mr::device_memory_resource* mr  = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
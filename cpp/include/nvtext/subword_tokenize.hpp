@@ -18,6 +18,11 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
 
 namespace nvtext {
 
@@ -162,5 +167,100 @@ tokenizer_result subword_tokenize(
   uint32_t max_rows_tensor,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Tokenizer that reuses its working memory for each batch of strings.
+ *
+ * Tokenizing a batch produces the same output as calling `subword_tokenize` with the
+ * same parameters. However, the working memory for batches of up to `max_batch_bytes`
+ * bytes is allocated once by the constructor and the output is written into tensors
+ * allocated by the caller. This makes it suitable for tokenizing many small batches
+ * where the allocations would otherwise take longer than the tokenizing itself.
+ *
+ * The `vocabulary_table` must remain valid for the lifetime of this object.
+ * An instance must not be used by more than one thread at a time.
+ *
+ * @code{.pseudo}
+ * auto vocab = load_vocabulary_file("hashed_vocab.txt");
+ * auto tokenizer = subword_tokenizer(*vocab, 64, 48, true, false, max_rows, max_bytes);
+ * // allocate token_ids, mask, metadata once for max_rows
+ * for (auto const& batch : batches) {
+ *   auto nrows = tokenizer.tokenize(batch, token_ids, mask, metadata);
+ *   // first nrows * 64 token_ids and mask values, and nrows * 3 metadata values are valid
+ * }
+ * @endcode
+ */
+class subword_tokenizer {
+ public:
+  subword_tokenizer() = delete;
+  ~subword_tokenizer();
+  subword_tokenizer(subword_tokenizer const&) = delete;
+  subword_tokenizer(subword_tokenizer&&)      = delete;
+  subword_tokenizer& operator=(subword_tokenizer const&) = delete;
+  subword_tokenizer& operator=(subword_tokenizer&&) = delete;
+
+  /**
+   * @brief Creates a tokenizer and allocates its working memory.
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw cudf::logic_error if `max_sequence_length * max_rows_tensor` is
+   *        larger than the max value for cudf::size_type
+   *
+   * @param vocabulary_table The vocabulary table pre-loaded into this object.
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string.
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string.
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters.
+   *        If false, accented and uppercase characters are not transformed.
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string. If false, it will use a new row
+   *        in the output token-ids to continue generating the output.
+   * @param max_rows_tensor Maximum number of output rows for a batch.
+   * @param max_batch_bytes Maximum number of character bytes in a batch that can be
+   *        tokenized without allocating additional working memory.
+   * @param mr Memory resource to allocate the working memory.
+   */
+  subword_tokenizer(hashed_vocabulary const& vocabulary_table,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_lower_case,
+                    bool do_truncate,
+                    uint32_t max_rows_tensor,
+                    std::size_t max_batch_bytes,
+                    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Tokenizes a batch of strings into the given output tensors.
+   *
+   * The output columns must be of type UINT32 and hold at least
+   * `max_rows_tensor * max_sequence_length` values for the token-ids and attention mask
+   * and `max_rows_tensor * 3` values for the metadata. Only the values for the returned
+   * number of rows are written. The layout of each output is described in `tokenizer_result`.
+   *
+   * Batches larger than `max_batch_bytes` are tokenized correctly but may allocate
+   * additional working memory.
+   *
+   * @throw cudf::logic_error if the output columns are not UINT32 or are too small
+   * @throw cudf::logic_error if the batch produces more than `max_rows_tensor` rows
+   *
+   * @param input The batch of strings to tokenize.
+   * @param tensor_token_ids Output token-ids.
+   * @param tensor_attention_mask Output attention mask identifying the valid token-ids.
+   * @param tensor_metadata Output metadata for each row.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @return Number of rows written to the output tensors
+   */
+  uint32_t tokenize(cudf::strings_column_view const& input,
+                    cudf::mutable_column_view tensor_token_ids,
+                    cudf::mutable_column_view tensor_attention_mask,
+                    cudf::mutable_column_view tensor_metadata,
+                    rmm::cuda_stream_view stream = cudf::default_stream_value);
+
+ private:
+  struct impl;
+  std::unique_ptr<impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace nvtext
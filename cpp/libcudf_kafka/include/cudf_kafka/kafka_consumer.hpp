@@ -18,6 +18,7 @@
 #include "kafka_callback.hpp"
 
 #include <cudf/io/datasource.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <librdkafka/rdkafkacpp.h>
 
@@ -26,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -92,6 +94,47 @@ class kafka_consumer : public cudf::io::datasource {
                  int batch_timeout,
                  std::string const& delimiter);
 
+  /**
+   * @brief Instantiate a Kafka consumer object that consumes a batch of messages directly into a
+   * pinned host buffer of fixed capacity.
+   *
+   * Each message payload, followed by `delimiter`, is copied from the librdkafka message into the
+   * pinned buffer exactly once, and the byte offset at which each message begins is recorded.
+   * Because the buffer is pinned, the consumer supports `device_read`, which transfers straight
+   * from the buffer to device memory.
+   *
+   * Consumption stops at `end_offset`, on timeout, at the partition end, or at the first message
+   * which does not fit in the remaining capacity. In the last case that message is not part of
+   * the batch and `next_message_offset()` returns its offset, so a new consumer can resume there.
+   *
+   * @throws cudf::logic_error if `batch_capacity` exceeds the maximum size of a strings column
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`.
+   * @param topic_name name of the Kafka topic to consume from
+   * @param partition partition index to consume from between `0` and `TOPIC_NUM_PARTITIONS - 1`
+   * inclusive
+   * @param start_offset seek position for the specified TOPPAR (Topic/Partition combo)
+   * @param end_offset position in the specified TOPPAR to read to
+   * @param batch_timeout maximum (millisecond) read time allowed. If end_offset is not reached
+   * before batch_timeout, a smaller subset will be returned
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   * @param batch_capacity size in bytes of the pinned buffer the batch is consumed into
+   */
+  kafka_consumer(std::map<std::string, std::string> configs,
+                 python_callable_type python_callable,
+                 kafka_oauth_callback_wrapper_type callable_wrapper,
+                 std::string const& topic_name,
+                 int partition,
+                 int64_t start_offset,
+                 int64_t end_offset,
+                 int batch_timeout,
+                 std::string const& delimiter,
+                 std::size_t batch_capacity);
+
   /**
    * @brief Returns a buffer with a subset of data from Kafka Topic
    *
@@ -120,6 +163,89 @@ class kafka_consumer : public cudf::io::datasource {
    */
   size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
 
+  /**
+   * @brief Returns whether the consumer supports `device_read`, which is the case for consumers
+   * created in batch mode
+   *
+   * @return bool Whether this source supports device_read() calls
+   */
+  [[nodiscard]] bool supports_device_read() const override { return batch_capacity > 0; }
+
+  /**
+   * @brief Returns a device buffer with a subset of the consumed data
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The data buffer in the device memory
+   */
+  std::unique_ptr<cudf::io::datasource::buffer> device_read(size_t offset,
+                                                            size_t size,
+                                                            rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Copies a subset of the consumed data from the pinned batch buffer into device memory
+   *
+   * The copy is ordered on `stream`; the source buffer stays valid for the consumer's lifetime.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   * @param[in] dst Address of the existing device memory
+   * @param[in] stream CUDA stream to use
+   *
+   * @return The number of bytes read (can be smaller than size)
+   */
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  /**
+   * @brief Returns the byte offsets at which each consumed message begins, followed by the total
+   * size of the data
+   *
+   * Message `i` spans `[offsets[i], offsets[i + 1])`, including its trailing delimiter. With an
+   * empty delimiter the offsets can be used directly as the offsets of a strings column over the
+   * data. Only populated for consumers created in batch mode.
+   *
+   * @return The message offsets
+   */
+  [[nodiscard]] host_span<int32_t const> message_offsets() const { return batch_offsets; }
+
+  /**
+   * @brief Returns the partition the messages are consumed from
+   *
+   * @return The partition index
+   */
+  [[nodiscard]] int consumed_partition() const { return partition; }
+
+  /**
+   * @brief Returns the Kafka offset of each consumed message, in the order they were consumed
+   *
+   * @return The Kafka offsets of the messages
+   */
+  [[nodiscard]] host_span<int64_t const> message_kafka_offsets() const { return kafka_offsets; }
+
+  /**
+   * @brief Returns the timestamp of each consumed message, in the order they were consumed
+   *
+   * Timestamps are in milliseconds since the epoch, or -1 for messages without a timestamp.
+   *
+   * @return The timestamps of the messages
+   */
+  [[nodiscard]] host_span<int64_t const> message_timestamps() const { return kafka_timestamps; }
+
+  /**
+   * @brief Returns the Kafka offset of the first message not included in the consumed data
+   *
+   * This is the offset to commit once the consumed data has been processed, and the start offset
+   * from which a new consumer would resume.
+   *
+   * @return The offset of the next message to consume
+   */
+  [[nodiscard]] int64_t next_message_offset() const { return next_offset; }
+
   /**
    * @brief Commits an offset to a specified Kafka Topic/Partition instance
    *
@@ -212,6 +338,19 @@ class kafka_consumer : public cudf::io::datasource {
 
   std::string buffer;
 
+  struct pinned_deleter {
+    void operator()(char* ptr) const;
+  };
+
+  std::size_t batch_capacity = 0;  // non-zero when consuming into the pinned batch buffer
+  std::unique_ptr<char, pinned_deleter> batch_buffer;
+  std::size_t batch_size = 0;
+  std::vector<int32_t> batch_offsets;
+  int64_t next_offset = -1;
+
+  std::vector<int64_t> kafka_offsets;     // Kafka offset of each consumed message
+  std::vector<int64_t> kafka_timestamps;  // timestamp of each consumed message
+
  private:
   RdKafka::ErrorCode update_consumer_topic_partition_assignment(std::string const& topic,
                                                                 int partition,
@@ -223,6 +362,15 @@ class kafka_consumer : public cudf::io::datasource {
   int64_t now();
 
   void consume_to_buffer();
+
+  void consume_to_batch();
+
+  void record_message(RdKafka::Message const& msg);
+
+  [[nodiscard]] char const* data() const
+  {
+    return batch_capacity > 0 ? batch_buffer.get() : buffer.data();
+  }
 };
 
 }  // namespace kafka
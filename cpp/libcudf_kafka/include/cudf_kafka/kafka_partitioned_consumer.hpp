@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "kafka_consumer.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief Range of messages to consume from one partition of a topic
+ */
+struct kafka_partition_range {
+  int partition;         ///< partition index between `0` and `TOPIC_NUM_PARTITIONS - 1` inclusive
+  int64_t start_offset;  ///< seek position in the partition
+  int64_t end_offset;    ///< position in the partition to read to
+};
+
+/**
+ * @brief Consumes several partitions of a Kafka topic concurrently
+ *
+ * Each partition is consumed by its own `kafka_consumer` on a separate thread, so the partitions
+ * are polled in parallel instead of one after another. Every partition's data is exposed as its
+ * own datasource. The consumed offsets are tracked per partition and are only committed on an
+ * explicit `commit_offsets()` call, so a caller can commit once the data has been parsed.
+ *
+ * @ingroup io_datasources
+ */
+class kafka_partitioned_consumer {
+ public:
+  /**
+   * @brief Instantiate the consumers and consume the given ranges of all partitions concurrently
+   *
+   * Documentation for librdkafka configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @throws cudf::logic_error if `ranges` is empty or contains a partition more than once, or if
+   * any of the consumers fails to be created
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to each librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`.
+   * @param topic_name name of the Kafka topic to consume from
+   * @param ranges partitions and the offsets to consume from each of them
+   * @param batch_timeout maximum (millisecond) read time allowed per partition
+   * @param delimiter optional delimiter to insert into the output between kafka messages, Ex: "\n"
+   * @param batch_capacity if non-zero, size in bytes of the pinned buffer each partition is
+   * consumed into, see the batch mode of `kafka_consumer`
+   */
+  kafka_partitioned_consumer(std::map<std::string, std::string> const& configs,
+                             python_callable_type python_callable,
+                             kafka_oauth_callback_wrapper_type callable_wrapper,
+                             std::string const& topic_name,
+                             std::vector<kafka_partition_range> const& ranges,
+                             int batch_timeout,
+                             std::string const& delimiter,
+                             std::size_t batch_capacity = 0);
+
+  /**
+   * @brief Returns the partitions being consumed, in the order they were given
+   *
+   * @return The partition indices
+   */
+  [[nodiscard]] std::vector<int> const& partitions() const { return _partitions; }
+
+  /**
+   * @brief Returns the datasource holding the data consumed from a partition
+   *
+   * @throws cudf::logic_error if `partition` is not being consumed
+   *
+   * @param partition Partition index
+   * @return The datasource of the partition
+   */
+  [[nodiscard]] kafka_consumer& source(int partition) const;
+
+  /**
+   * @brief Returns, for every partition, the offset of the first message not consumed
+   *
+   * @return Map of partition indices to the offset to commit for them
+   */
+  [[nodiscard]] std::map<int, int64_t> next_offsets() const;
+
+  /**
+   * @brief Commits the offsets returned by `next_offsets()` for all partitions
+   *
+   * @throws cudf::logic_error on failure to commit any of the partition offsets
+   */
+  void commit_offsets();
+
+  /**
+   * @brief Close the underlying connections of all partition consumers
+   *
+   * @throws cudf::logic_error on failure to close any of the connections
+   * @param timeout Max milliseconds to wait on a response
+   */
+  void close(int timeout);
+
+ private:
+  std::string _topic_name;
+  std::vector<int> _partitions;
+  std::vector<std::unique_ptr<kafka_consumer>> _consumers;
+};
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "kafka_consumer.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/csv.hpp>
+#include <cudf/io/json.hpp>
+#include <cudf/io/types.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief Table parsed from Kafka messages, along with the message each row was parsed from
+ */
+struct kafka_table_with_metadata {
+  table_with_metadata data;            ///< The rows parsed from the messages
+  std::unique_ptr<column> partitions;  ///< INT32 partition of the message of each row
+  std::unique_ptr<column> offsets;     ///< INT64 Kafka offset of the message of each row
+  std::unique_ptr<column> timestamps;  ///< TIMESTAMP_MILLISECONDS of the message of each row
+};
+
+/**
+ * @brief Reads a JSON lines table from the messages consumed by Kafka consumers, one row per
+ * message.
+ *
+ * The sources of `options` must all be `kafka_consumer`s, such as the consumer of each partition
+ * of a `kafka_partitioned_consumer`. Their messages are parsed as by `cudf::io::read_json`, and
+ * each row is matched with the partition, offset and timestamp recorded for its message when it
+ * was consumed, so there is no need to recover the message boundaries from the parsed data.
+ *
+ * The consumers should use the row terminator `"\n"` as message delimiter, and each message must
+ * hold exactly one row.
+ *
+ * @throws cudf::logic_error if a source of `options` is not a `kafka_consumer`
+ * @throws cudf::logic_error if the number of rows read is not the number of messages consumed
+ *
+ * @param options Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata and of the message columns
+ * @return The set of columns along with metadata and the message of each row
+ */
+kafka_table_with_metadata read_json(
+  json_reader_options options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Reads a CSV table from the messages consumed by a Kafka consumer, one row per message.
+ *
+ * The source of `options` must be a `kafka_consumer`. Its messages are parsed as by
+ * `cudf::io::read_csv`, and each row is matched with the partition, offset and timestamp recorded
+ * for its message when it was consumed.
+ *
+ * The consumer should use the row terminator of `options` as message delimiter, and each message
+ * must hold exactly one row. In particular, the messages do not include a header row.
+ *
+ * @throws cudf::logic_error if the source of `options` is not a `kafka_consumer`
+ * @throws cudf::logic_error if the number of rows read is not the number of messages consumed
+ *
+ * @param options Settings for controlling reading behavior
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata and of the message columns
+ * @return The set of columns along with metadata and the message of each row
+ */
+kafka_table_with_metadata read_csv(
+  csv_reader_options options,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
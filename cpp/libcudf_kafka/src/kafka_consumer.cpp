@@ -15,9 +15,17 @@
  */
 #include <cudf_kafka/kafka_consumer.hpp>
 
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
 #include <librdkafka/rdkafkacpp.h>
 
+#include <cuda_runtime_api.h>
+
 #include <chrono>
+#include <cstring>
+#include <limits>
 #include <memory>
 
 namespace cudf {
@@ -67,6 +75,29 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
                                int64_t end_offset,
                                int batch_timeout,
                                std::string const& delimiter)
+  : kafka_consumer(configs,
+                   python_callable,
+                   callback_wrapper,
+                   topic_name,
+                   partition,
+                   start_offset,
+                   end_offset,
+                   batch_timeout,
+                   delimiter,
+                   0)
+{
+}
+
+kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
+                               python_callable_type python_callable,
+                               kafka_oauth_callback_wrapper_type callback_wrapper,
+                               std::string const& topic_name,
+                               int partition,
+                               int64_t start_offset,
+                               int64_t end_offset,
+                               int batch_timeout,
+                               std::string const& delimiter,
+                               std::size_t batch_capacity)
   : configs(configs),
     python_callable_(python_callable),
     callable_wrapper_(callback_wrapper),
@@ -76,8 +107,13 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
     end_offset(end_offset),
     batch_timeout(batch_timeout),
     delimiter(delimiter),
+    batch_capacity(batch_capacity),
+    next_offset(start_offset),
     kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL))
 {
+  CUDF_EXPECTS(batch_capacity <= static_cast<std::size_t>(std::numeric_limits<int32_t>::max()),
+               "Kafka batch capacity exceeds the size limit of a strings column");
+
   for (auto const& key_value : configs) {
     std::string error_string;
     CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
@@ -104,25 +140,53 @@ kafka_consumer::kafka_consumer(std::map<std::string, std::string> configs,
 
   // Pre fill the local buffer with messages so the datasource->size() invocation
   // will return a valid size.
-  consume_to_buffer();
+  if (batch_capacity > 0) {
+    consume_to_batch();
+  } else {
+    consume_to_buffer();
+  }
 }
 
+void kafka_consumer::pinned_deleter::operator()(char* ptr) const { cudaFreeHost(ptr); }
+
 std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::host_read(size_t offset, size_t size)
 {
-  if (offset > buffer.size()) { return 0; }
-  size = std::min(size, buffer.size() - offset);
-  return std::make_unique<non_owning_buffer>((uint8_t*)buffer.data() + offset, size);
+  if (offset > this->size()) { return 0; }
+  size = std::min(size, this->size() - offset);
+  return std::make_unique<non_owning_buffer>((uint8_t*)data() + offset, size);
 }
 
 size_t kafka_consumer::host_read(size_t offset, size_t size, uint8_t* dst)
 {
-  if (offset > buffer.size()) { return 0; }
-  auto const read_size = std::min(size, buffer.size() - offset);
-  memcpy(dst, buffer.data() + offset, size);
+  if (offset > this->size()) { return 0; }
+  auto const read_size = std::min(size, this->size() - offset);
+  memcpy(dst, data() + offset, read_size);
+  return read_size;
+}
+
+std::unique_ptr<cudf::io::datasource::buffer> kafka_consumer::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer out_data(size, stream);
+  size_t read = device_read(offset, size, reinterpret_cast<uint8_t*>(out_data.data()), stream);
+  out_data.resize(read, stream);
+  return datasource::buffer::create(std::move(out_data));
+}
+
+size_t kafka_consumer::device_read(size_t offset,
+                                   size_t size,
+                                   uint8_t* dst,
+                                   rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(supports_device_read(), "Device reads require a Kafka consumer in batch mode");
+  if (offset > this->size()) { return 0; }
+  auto const read_size = std::min(size, this->size() - offset);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    dst, batch_buffer.get() + offset, read_size, cudaMemcpyHostToDevice, stream.value()));
   return read_size;
 }
 
-size_t kafka_consumer::size() const { return buffer.size(); }
+size_t kafka_consumer::size() const { return batch_capacity > 0 ? batch_size : buffer.size(); }
 
 /**
  * Change the TOPPAR assignment for this consumer instance
@@ -147,14 +211,61 @@ void kafka_consumer::consume_to_buffer()
       consumer->consume((end - std::chrono::steady_clock::now()).count())};
 
     if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
-      buffer.append(static_cast<char*>(msg->payload()));
+      buffer.append(static_cast<char*>(msg->payload()), msg->len());
       buffer.append(delimiter);
+      record_message(*msg);
+      next_offset = msg->offset() + 1;
+      messages_read++;
+    } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      // If there are no more messages return
+      break;
+    }
+  }
+}
+
+void kafka_consumer::consume_to_batch()
+{
+  char* ptr = nullptr;
+  CUDF_CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&ptr), batch_capacity));
+  batch_buffer.reset(ptr);
+
+  update_consumer_topic_partition_assignment(topic_name, partition, start_offset);
+
+  int64_t messages_read = 0;
+  auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+
+  while (messages_read < end_offset - start_offset && end > std::chrono::steady_clock::now()) {
+    std::unique_ptr<RdKafka::Message> msg{
+      consumer->consume((end - std::chrono::steady_clock::now()).count())};
+
+    if (msg->err() == RdKafka::ErrorCode::ERR_NO_ERROR) {
+      if (batch_size + msg->len() + delimiter.size() > batch_capacity) {
+        // the message is left for the next consumer rather than split across batches
+        next_offset = msg->offset();
+        break;
+      }
+      batch_offsets.push_back(static_cast<int32_t>(batch_size));
+      std::memcpy(batch_buffer.get() + batch_size, msg->payload(), msg->len());
+      std::memcpy(batch_buffer.get() + batch_size + msg->len(), delimiter.data(), delimiter.size());
+      batch_size += msg->len() + delimiter.size();
+      record_message(*msg);
+      next_offset = msg->offset() + 1;
       messages_read++;
     } else if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
       // If there are no more messages return
       break;
     }
   }
+  batch_offsets.push_back(static_cast<int32_t>(batch_size));
+}
+
+void kafka_consumer::record_message(RdKafka::Message const& msg)
+{
+  auto const timestamp = msg.timestamp();
+  kafka_offsets.push_back(msg.offset());
+  kafka_timestamps.push_back(
+    timestamp.type == RdKafka::MessageTimestamp::MSG_TIMESTAMP_NOT_AVAILABLE ? -1
+                                                                             : timestamp.timestamp);
 }
 
 std::map<std::string, std::string> kafka_consumer::current_configs()
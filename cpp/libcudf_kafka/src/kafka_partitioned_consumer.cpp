@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf_kafka/kafka_partitioned_consumer.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+kafka_partitioned_consumer::kafka_partitioned_consumer(
+  std::map<std::string, std::string> const& configs,
+  python_callable_type python_callable,
+  kafka_oauth_callback_wrapper_type callable_wrapper,
+  std::string const& topic_name,
+  std::vector<kafka_partition_range> const& ranges,
+  int batch_timeout,
+  std::string const& delimiter,
+  std::size_t batch_capacity)
+  : _topic_name(topic_name)
+{
+  CUDF_EXPECTS(not ranges.empty(), "At least one Kafka partition must be specified");
+  std::transform(ranges.cbegin(),
+                 ranges.cend(),
+                 std::back_inserter(_partitions),
+                 [](auto const& range) { return range.partition; });
+  auto sorted_partitions = _partitions;
+  std::sort(sorted_partitions.begin(), sorted_partitions.end());
+  CUDF_EXPECTS(
+    std::adjacent_find(sorted_partitions.cbegin(), sorted_partitions.cend()) ==
+      sorted_partitions.cend(),
+    "Each Kafka partition can only be consumed once");
+
+  // the consumers poll their partitions while being constructed, so creating them on separate
+  // threads consumes all partitions concurrently
+  std::vector<std::future<std::unique_ptr<kafka_consumer>>> pending;
+  for (auto const& range : ranges) {
+    pending.emplace_back(std::async(std::launch::async, [&, range]() {
+      return std::make_unique<kafka_consumer>(configs,
+                                              python_callable,
+                                              callable_wrapper,
+                                              topic_name,
+                                              range.partition,
+                                              range.start_offset,
+                                              range.end_offset,
+                                              batch_timeout,
+                                              delimiter,
+                                              batch_capacity);
+    }));
+  }
+  // wait for all threads before rethrowing, as they reference the arguments of this constructor
+  for (auto& consumer : pending) {
+    consumer.wait();
+  }
+  for (auto& consumer : pending) {
+    _consumers.emplace_back(consumer.get());
+  }
+}
+
+kafka_consumer& kafka_partitioned_consumer::source(int partition) const
+{
+  auto const it = std::find(_partitions.cbegin(), _partitions.cend(), partition);
+  CUDF_EXPECTS(it != _partitions.cend(), "Kafka partition is not being consumed");
+  return *_consumers[std::distance(_partitions.cbegin(), it)];
+}
+
+std::map<int, int64_t> kafka_partitioned_consumer::next_offsets() const
+{
+  std::map<int, int64_t> offsets;
+  for (std::size_t i = 0; i < _partitions.size(); i++) {
+    offsets.insert({_partitions[i], _consumers[i]->next_message_offset()});
+  }
+  return offsets;
+}
+
+void kafka_partitioned_consumer::commit_offsets()
+{
+  for (std::size_t i = 0; i < _partitions.size(); i++) {
+    _consumers[i]->commit_offset(_topic_name, _partitions[i], _consumers[i]->next_message_offset());
+  }
+}
+
+void kafka_partitioned_consumer::close(int timeout)
+{
+  for (auto& consumer : _consumers) {
+    consumer->close(timeout);
+  }
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf_kafka/kafka_reader.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+namespace {
+
+/**
+ * @brief Returns the Kafka consumers that are the sources of a reader
+ */
+std::vector<kafka_consumer const*> get_consumers(source_info const& source)
+{
+  CUDF_EXPECTS(source.type() == io_type::USER_IMPLEMENTED,
+               "The sources to read must be Kafka consumers");
+  std::vector<kafka_consumer const*> consumers;
+  for (auto const* datasource : source.user_sources()) {
+    auto const consumer = dynamic_cast<kafka_consumer const*>(datasource);
+    CUDF_EXPECTS(consumer != nullptr, "The sources to read must be Kafka consumers");
+    consumers.push_back(consumer);
+  }
+  return consumers;
+}
+
+/**
+ * @brief Copies host data into the storage of a fixed-width column
+ */
+template <typename T>
+void copy_to_column(std::vector<T> const& host_data, column& output, rmm::cuda_stream_view stream)
+{
+  CUDF_CUDA_TRY(cudaMemcpyAsync(output.mutable_view().data<T>(),
+                                host_data.data(),
+                                host_data.size() * sizeof(T),
+                                cudaMemcpyHostToDevice,
+                                stream.value()));
+}
+
+/**
+ * @brief Matches each row of a table read from Kafka consumers with its message
+ *
+ * The messages of the consumers are concatenated in the order of the consumers, as their data is
+ * by the readers.
+ */
+kafka_table_with_metadata add_message_columns(table_with_metadata&& data,
+                                              std::vector<kafka_consumer const*> const& consumers,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  std::vector<int32_t> partitions;
+  std::vector<int64_t> offsets;
+  std::vector<int64_t> timestamps;
+  for (auto const* consumer : consumers) {
+    auto const consumer_offsets    = consumer->message_kafka_offsets();
+    auto const consumer_timestamps = consumer->message_timestamps();
+    partitions.insert(partitions.end(), consumer_offsets.size(), consumer->consumed_partition());
+    offsets.insert(offsets.end(), consumer_offsets.begin(), consumer_offsets.end());
+    timestamps.insert(timestamps.end(), consumer_timestamps.begin(), consumer_timestamps.end());
+  }
+
+  auto const num_rows = data.tbl->num_rows();
+  CUDF_EXPECTS(static_cast<std::size_t>(num_rows) == offsets.size(),
+               "Each Kafka message must hold exactly one row");
+
+  auto const stream = cudf::default_stream_value;
+  auto result       = kafka_table_with_metadata{
+    std::move(data),
+    make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream, mr),
+    make_numeric_column(data_type{type_id::INT64}, num_rows, mask_state::UNALLOCATED, stream, mr),
+    make_timestamp_column(
+      data_type{type_id::TIMESTAMP_MILLISECONDS}, num_rows, mask_state::UNALLOCATED, stream, mr)};
+  copy_to_column(partitions, *result.partitions, stream);
+  copy_to_column(offsets, *result.offsets, stream);
+  copy_to_column(timestamps, *result.timestamps, stream);
+  // the host data is released on return
+  stream.synchronize();
+  return result;
+}
+
+}  // namespace
+
+kafka_table_with_metadata read_json(json_reader_options options,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const consumers = get_consumers(options.get_source());
+  return add_message_columns(cudf::io::read_json(std::move(options), mr), consumers, mr);
+}
+
+kafka_table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_resource* mr)
+{
+  auto const consumers = get_consumers(options.get_source());
+  return add_message_columns(cudf::io::read_csv(std::move(options), mr), consumers, mr);
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
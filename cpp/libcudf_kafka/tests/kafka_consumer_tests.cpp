@@ -15,6 +15,8 @@
  */
 
 #include <cudf_kafka/kafka_consumer.hpp>
+#include <cudf_kafka/kafka_partitioned_consumer.hpp>
+#include <cudf_kafka/kafka_reader.hpp>
 #include <gtest/gtest.h>
 #include <map>
 #include <memory>
@@ -22,6 +24,7 @@
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/json.hpp>
 
 namespace kafka = cudf::io::external::kafka;
 
@@ -66,3 +69,78 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
       kafka_configs, python_callable, callback_wrapper, "csv-topic", 0, 0, 3, 5000, "\n"),
     cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, BatchCapacityTooLarge)
+{
+  // the batch offsets must be usable as the offsets of a strings column
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+  kafka_configs["group.id"]          = "libcudf_kafka_test";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  EXPECT_THROW(kafka::kafka_consumer kc(kafka_configs,
+                                        python_callable,
+                                        callback_wrapper,
+                                        "csv-topic",
+                                        0,
+                                        0,
+                                        3,
+                                        5000,
+                                        "\n",
+                                        std::size_t{1} << 32),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, PartitionedInvalidRanges)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+  kafka_configs["group.id"]          = "libcudf_kafka_test";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  EXPECT_THROW(kafka::kafka_partitioned_consumer kc(
+                 kafka_configs, python_callable, callback_wrapper, "csv-topic", {}, 5000, "\n"),
+               cudf::logic_error);
+
+  std::vector<kafka::kafka_partition_range> const duplicate_ranges{{0, 0, 3}, {0, 3, 6}};
+  EXPECT_THROW(kafka::kafka_partitioned_consumer kc(kafka_configs,
+                                                    python_callable,
+                                                    callback_wrapper,
+                                                    "csv-topic",
+                                                    duplicate_ranges,
+                                                    5000,
+                                                    "\n"),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, PartitionedMissingGroupID)
+{
+  // errors from the per-partition consumers are rethrown
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+
+  std::vector<kafka::kafka_partition_range> const ranges{{0, 0, 3}, {1, 0, 3}};
+  EXPECT_THROW(kafka::kafka_partitioned_consumer kc(
+                 kafka_configs, python_callable, callback_wrapper, "csv-topic", ranges, 5000, "\n"),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, ReadNonKafkaSource)
+{
+  // rows can only be matched with messages recorded by Kafka consumers
+  std::string const data = "{\"a\": 1}\n{\"a\": 2}\n";
+  auto const source      = cudf::io::source_info{data.data(), data.size()};
+
+  auto const json_options = cudf::io::json_reader_options::builder(source).lines(true).build();
+  EXPECT_THROW(kafka::read_json(json_options), cudf::logic_error);
+
+  auto const csv_options = cudf::io::csv_reader_options::builder(source).build();
+  EXPECT_THROW(kafka::read_csv(csv_options), cudf::logic_error);
+}
@@ -218,6 +218,18 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, hll_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_hll_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 // aggregation_finalizer ----------------------------------------
 
 void aggregation_finalizer::visit(aggregation const& agg) {}
@@ -377,6 +389,16 @@ void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(hll_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_hll_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 }  // namespace detail
 
 std::vector<std::unique_ptr<aggregation>> aggregation::get_simple_aggregations(
@@ -492,6 +514,8 @@ template std::unique_ptr<aggregation> make_sum_of_squares_aggregation<aggregatio
 template std::unique_ptr<groupby_aggregation>
 make_sum_of_squares_aggregation<groupby_aggregation>();
 template std::unique_ptr<reduce_aggregation> make_sum_of_squares_aggregation<reduce_aggregation>();
+template std::unique_ptr<segmented_reduce_aggregation>
+make_sum_of_squares_aggregation<segmented_reduce_aggregation>();
 
 /// Factory to create a MEAN aggregation
 template <typename Base>
@@ -503,6 +527,8 @@ template std::unique_ptr<aggregation> make_mean_aggregation<aggregation>();
 template std::unique_ptr<rolling_aggregation> make_mean_aggregation<rolling_aggregation>();
 template std::unique_ptr<groupby_aggregation> make_mean_aggregation<groupby_aggregation>();
 template std::unique_ptr<reduce_aggregation> make_mean_aggregation<reduce_aggregation>();
+template std::unique_ptr<segmented_reduce_aggregation>
+make_mean_aggregation<segmented_reduce_aggregation>();
 
 /// Factory to create a M2 aggregation
 template <typename Base>
@@ -526,6 +552,8 @@ template std::unique_ptr<groupby_aggregation> make_variance_aggregation<groupby_
   size_type ddof);
 template std::unique_ptr<reduce_aggregation> make_variance_aggregation<reduce_aggregation>(
   size_type ddof);
+template std::unique_ptr<segmented_reduce_aggregation>
+make_variance_aggregation<segmented_reduce_aggregation>(size_type ddof);
 
 /// Factory to create a STD aggregation
 template <typename Base>
@@ -540,6 +568,8 @@ template std::unique_ptr<groupby_aggregation> make_std_aggregation<groupby_aggre
   size_type ddof);
 template std::unique_ptr<reduce_aggregation> make_std_aggregation<reduce_aggregation>(
   size_type ddof);
+template std::unique_ptr<segmented_reduce_aggregation>
+make_std_aggregation<segmented_reduce_aggregation>(size_type ddof);
 
 /// Factory to create a MEDIAN aggregation
 template <typename Base>
@@ -799,6 +829,27 @@ template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<gro
 template std::unique_ptr<reduce_aggregation> make_merge_tdigest_aggregation<reduce_aggregation>(
   int max_centroids);
 
+template <typename Base>
+std::unique_ptr<Base> make_hll_aggregation(int precision)
+{
+  CUDF_EXPECTS(precision >= 4 && precision <= 18, "HLL precision must be in the range [4, 18]");
+  return std::make_unique<detail::hll_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_hll_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_hll_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_hll_aggregation<reduce_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_merge_hll_aggregation()
+{
+  return std::make_unique<detail::merge_hll_aggregation>();
+}
+template std::unique_ptr<aggregation> make_merge_hll_aggregation<aggregation>();
+template std::unique_ptr<groupby_aggregation> make_merge_hll_aggregation<groupby_aggregation>();
+template std::unique_ptr<reduce_aggregation> make_merge_hll_aggregation<reduce_aggregation>();
+
 namespace detail {
 namespace {
 struct target_type_functor {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,12 +22,16 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iterator>
+#include <optional>
 
 namespace cudf {
 
@@ -35,6 +39,190 @@ namespace ast {
 
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Host value of a constant subexpression, stored like an intermediate.
+ */
+struct constant_value {
+  cudf::data_type type;
+  bool is_valid;
+  IntermediateDataType<false> storage;
+
+  template <typename T>
+  [[nodiscard]] T get() const
+  {
+    T value;
+    std::memcpy(&value, &storage, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  void set(T value)
+  {
+    type = cudf::data_type{cudf::type_to_id<T>()};
+    std::memcpy(&storage, &value, sizeof(T));
+  }
+};
+
+struct read_literal_functor {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  constant_value operator()(cudf::scalar const& value, rmm::cuda_stream_view stream)
+  {
+    auto result     = constant_value{value.type(), value.is_valid(stream), {}};
+    auto const data = static_cast<cudf::numeric_scalar<T> const&>(value).value(stream);
+    result.set(data);
+    return result;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_numeric<T>())>
+  constant_value operator()(cudf::scalar const&, rmm::cuda_stream_view)
+  {
+    CUDF_FAIL("Only numeric literals can be folded.");
+  }
+};
+
+template <typename OperatorFunctor>
+constexpr bool is_integer_division_v =
+  std::is_same_v<OperatorFunctor, operator_functor<ast_operator::DIV, false>> ||
+  std::is_same_v<OperatorFunctor, operator_functor<ast_operator::MOD, false>> ||
+  std::is_same_v<OperatorFunctor, operator_functor<ast_operator::PYMOD, false>>;
+
+/**
+ * @brief Functor evaluating an operator on valid constant operands on the host.
+ *
+ * Leaves `result` empty for non-numeric operands, and for the integer divisions by zero or minus
+ * one, whose behavior on the host differs from the device.
+ */
+struct fold_functor {
+  template <typename OperatorFunctor,
+            typename LHS,
+            typename RHS,
+            std::enable_if_t<is_valid_binary_op<OperatorFunctor, LHS, RHS>>* = nullptr>
+  void operator()(std::vector<constant_value> const& operands,
+                  std::optional<constant_value>& result)
+  {
+    // Only numeric constants are folded, the operators on other types may be device-only
+    if constexpr (cudf::is_numeric<LHS>() && cudf::is_numeric<RHS>()) {
+      auto const rhs = operands[1].get<RHS>();
+      if constexpr (std::is_integral_v<RHS> && is_integer_division_v<OperatorFunctor>) {
+        if (rhs == RHS{0} || rhs == static_cast<RHS>(-1)) { return; }
+      }
+      result = constant_value{{}, true, {}};
+      result->set(OperatorFunctor{}(operands[0].get<LHS>(), rhs));
+    }
+  }
+
+  template <typename OperatorFunctor,
+            typename LHS,
+            typename RHS,
+            std::enable_if_t<!is_valid_binary_op<OperatorFunctor, LHS, RHS>>* = nullptr>
+  void operator()(std::vector<constant_value> const&, std::optional<constant_value>&)
+  {
+    CUDF_FAIL("Invalid binary operation.");
+  }
+
+  template <typename OperatorFunctor,
+            typename T,
+            std::enable_if_t<is_valid_unary_op<OperatorFunctor, T>>* = nullptr>
+  void operator()(std::vector<constant_value> const& operands,
+                  std::optional<constant_value>& result)
+  {
+    if constexpr (cudf::is_numeric<T>()) {
+      result = constant_value{{}, true, {}};
+      result->set(OperatorFunctor{}(operands[0].get<T>()));
+    }
+  }
+
+  template <typename OperatorFunctor,
+            typename T,
+            std::enable_if_t<!is_valid_unary_op<OperatorFunctor, T>>* = nullptr>
+  void operator()(std::vector<constant_value> const&, std::optional<constant_value>&)
+  {
+    CUDF_FAIL("Invalid unary operation.");
+  }
+};
+
+/**
+ * @brief Evaluates an expression on numeric literals only on the host.
+ *
+ * @return The value of the expression, or an empty optional if it cannot be evaluated on the host.
+ */
+std::optional<constant_value> evaluate_constant(expression const& expr,
+                                                rmm::cuda_stream_view stream)
+{
+  if (auto const* lit = dynamic_cast<literal const*>(&expr)) {
+    return type_dispatcher(
+      lit->get_data_type(), read_literal_functor{}, lit->get_scalar(), stream);
+  }
+  auto const& op = dynamic_cast<operation const&>(expr);
+
+  std::vector<constant_value> operands;
+  for (auto const& operand : op.get_operands()) {
+    auto value = evaluate_constant(operand.get(), stream);
+    if (not value.has_value()) { return std::nullopt; }
+    operands.push_back(*value);
+  }
+  auto operand_types = std::vector<cudf::data_type>{};
+  std::transform(operands.cbegin(),
+                 operands.cend(),
+                 std::back_inserter(operand_types),
+                 [](auto const& operand) { return operand.type; });
+  if (std::adjacent_find(operand_types.cbegin(), operand_types.cend(), std::not_equal_to<>()) !=
+      operand_types.cend()) {
+    return std::nullopt;  // reported by the parser
+  }
+
+  auto const oper        = op.get_operator();
+  auto const output_type = ast_operator_return_type(oper, operand_types);
+  if (std::any_of(
+        operands.cbegin(), operands.cend(), [](auto const& operand) { return !operand.is_valid; })) {
+    // The null-aware operators are left to the device
+    if (oper == ast_operator::NULL_EQUAL || oper == ast_operator::NULL_LOGICAL_AND ||
+        oper == ast_operator::NULL_LOGICAL_OR) {
+      return std::nullopt;
+    }
+    return constant_value{output_type, false, {}};
+  }
+
+  auto result = std::optional<constant_value>{};
+  if (operands.size() == 1) {
+    unary_operator_dispatcher(oper, operand_types[0], fold_functor{}, operands, result);
+  } else {
+    binary_operator_dispatcher(
+      oper, operand_types[0], operand_types[1], fold_functor{}, operands, result);
+  }
+  return result;
+}
+
+struct make_literal_functor {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_numeric<T>())>
+  literal const* operator()(constant_value const& value,
+                            std::vector<std::unique_ptr<cudf::scalar>>& scalars,
+                            std::list<literal>& literals,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+  {
+    auto result =
+      std::make_unique<cudf::numeric_scalar<T>>(value.get<T>(), value.is_valid, stream, mr);
+    auto const& folded = literals.emplace_back(*result);
+    scalars.push_back(std::move(result));
+    return &folded;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_numeric<T>())>
+  literal const* operator()(constant_value const&,
+                            std::vector<std::unique_ptr<cudf::scalar>>&,
+                            std::list<literal>&,
+                            rmm::cuda_stream_view,
+                            rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Only numeric literals can be folded.");
+  }
+};
+
+}  // namespace
+
 device_data_reference::device_data_reference(device_data_reference_type reference_type,
                                              cudf::data_type data_type,
                                              cudf::size_type data_index,
@@ -133,6 +321,24 @@ cudf::size_type expression_parser::visit(column_reference const& expr)
 
 cudf::size_type expression_parser::visit(operation const& expr)
 {
+  // The temporary operations wrapping a literal or column reference root have no value number
+  auto const value_number = [&]() -> std::optional<cudf::size_type> {
+    auto const it = _value_numbers.find(&expr);
+    return it != _value_numbers.end() ? std::optional{it->second} : std::nullopt;
+  }();
+  if (value_number.has_value()) {
+    // Reuse the result of a structurally identical operation
+    auto const& evaluated = _value_data_references[*value_number];
+    if (evaluated.has_value()) { return *evaluated; }
+    if (_is_constant[*value_number]) {
+      if (auto const* folded = fold_constant(expr)) {
+        auto const index                      = visit(*folded);
+        _value_data_references[*value_number] = index;
+        return index;
+      }
+    }
+  }
+
   // Increment the expression index
   auto const expression_index = _expression_count++;
   // Visit children (operands) of this expression
@@ -149,17 +355,20 @@ cudf::size_type expression_parser::visit(operation const& expr)
     CUDF_FAIL("An AST expression was provided non-matching operand types.");
   }
 
-  // Give back intermediate storage locations that are consumed by this operation
-  std::for_each(
-    operand_data_ref_indices.cbegin(),
-    operand_data_ref_indices.cend(),
-    [this](auto const& data_reference_index) {
-      auto const operand_source = _data_references[data_reference_index];
-      if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
-        auto const intermediate_index = operand_source.data_index;
-        _intermediate_counter.give(intermediate_index);
-      }
-    });
+  // Give back intermediate storage locations that are consumed by this operation, unless they
+  // hold a common subexpression with uses left
+  auto const operands = expr.get_operands();
+  for (std::size_t i = 0; i < operands.size(); ++i) {
+    auto const operand_number = _value_numbers.find(&operands[i].get());
+    if (operand_number != _value_numbers.end() && --_remaining_uses[operand_number->second] > 0) {
+      continue;
+    }
+    auto const operand_source = _data_references[operand_data_ref_indices[i]];
+    if (operand_source.reference_type == detail::device_data_reference_type::INTERMEDIATE) {
+      auto const intermediate_index = operand_source.data_index;
+      _intermediate_counter.give(intermediate_index);
+    }
+  }
   // Resolve expression type
   auto const op        = expr.get_operator();
   auto const data_type = cudf::ast::detail::ast_operator_return_type(op, operand_types);
@@ -190,6 +399,7 @@ cudf::size_type expression_parser::visit(operation const& expr)
                                   operand_data_ref_indices.cbegin(),
                                   operand_data_ref_indices.cend());
   _operator_source_indices.push_back(index);
+  if (value_number.has_value()) { _value_data_references[*value_number] = index; }
   return index;
 }
 
@@ -210,6 +420,51 @@ std::vector<cudf::size_type> expression_parser::visit_operands(
   return operand_data_reference_indices;
 }
 
+cudf::size_type expression_parser::number_subexpressions(expression const& expr)
+{
+  // Literals are identified by their scalar, column references by their table and index, and
+  // operations by their operator and the value numbers of their operands.
+  auto key             = std::vector<std::int64_t>{};
+  auto is_constant     = false;
+  auto operand_numbers = std::vector<cudf::size_type>{};
+  if (auto const* lit = dynamic_cast<literal const*>(&expr)) {
+    key         = {0, reinterpret_cast<std::intptr_t>(&lit->get_scalar())};
+    is_constant = cudf::is_numeric(lit->get_data_type());
+  } else if (auto const* col = dynamic_cast<column_reference const*>(&expr)) {
+    key = {1, static_cast<std::int64_t>(col->get_table_source()), col->get_column_index()};
+  } else {
+    auto const& op = dynamic_cast<operation const&>(expr);
+    key            = {2, static_cast<std::int64_t>(op.get_operator())};
+    is_constant    = true;
+    for (auto const& operand : op.get_operands()) {
+      auto const number = number_subexpressions(operand.get());
+      key.push_back(number);
+      operand_numbers.push_back(number);
+      is_constant = is_constant && _is_constant[number];
+    }
+  }
+
+  auto const [it, inserted] = _value_keys.try_emplace(key, _is_constant.size());
+  if (inserted) {
+    _is_constant.push_back(is_constant);
+    _remaining_uses.push_back(0);
+    _value_data_references.emplace_back();
+    for (auto const number : operand_numbers) {
+      ++_remaining_uses[number];
+    }
+  }
+  _value_numbers[&expr] = it->second;
+  return it->second;
+}
+
+literal const* expression_parser::fold_constant(operation const& expr)
+{
+  auto const value = evaluate_constant(expr, _stream);
+  if (not value.has_value()) { return nullptr; }
+  return type_dispatcher(
+    value->type, make_literal_functor{}, *value, _folded_scalars, _folded_literals, _stream, _mr);
+}
+
 cudf::size_type expression_parser::add_data_reference(detail::device_data_reference data_ref)
 {
   // If an equivalent data reference already exists, return its index. Otherwise add this data
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,14 +16,41 @@
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
 namespace cudf {
 namespace ast {
+namespace {
+
+std::shared_ptr<rmm::device_buffer> make_string_view_storage(cudf::string_scalar const& value,
+                                                             rmm::cuda_stream_view stream)
+{
+  auto const view = cudf::string_view{value.data(), value.size()};
+  auto storage    = std::make_shared<rmm::device_buffer>(&view, sizeof(view), stream);
+  cudf::detail::synchronize_stream(stream);  // `view` goes out of scope
+  return storage;
+}
+
+}  // namespace
+
+literal::literal(cudf::string_scalar& value, rmm::cuda_stream_view stream)
+  : scalar(value),
+    string_view_storage(make_string_view_storage(value, stream)),
+    value(cudf::detail::fixed_width_scalar_device_view<cudf::string_view>(
+      value.type(),
+      static_cast<cudf::string_view*>(string_view_storage->data()),
+      value.validity_data()))
+{
+}
 
 operation::operation(ast_operator op, expression const& input) : op(op), operands({input})
 {
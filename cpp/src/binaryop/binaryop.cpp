@@ -43,6 +43,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <string>
+#include <vector>
 
 #include <thrust/optional.h>
 
@@ -132,27 +133,51 @@ bool is_same_scale_necessary(binary_operator op)
 }
 
 namespace jit {
-void binary_operation(mutable_column_view& out,
-                      column_view const& lhs,
-                      column_view const& rhs,
-                      const std::string& ptx,
-                      rmm::cuda_stream_view stream)
+// Check for datatype
+void check_ptx_types(data_type lhs_type, data_type rhs_type, data_type output_type)
+{
+  auto is_type_supported_ptx = [](data_type type) -> bool {
+    return is_fixed_width(type) and not is_fixed_point(type) and
+           type.id() != type_id::INT8;  // Numba PTX doesn't support int8
+  };
+
+  CUDF_EXPECTS(is_type_supported_ptx(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(rhs_type), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+}
+
+/**
+ * @brief Gets the kernel applying the binary function in `ptx`, compiling it if needed.
+ */
+jitify2::Kernel get_binary_operation_kernel(std::string const& ptx,
+                                            data_type lhs_type,
+                                            data_type rhs_type,
+                                            data_type output_type)
 {
-  std::string const output_type_name = cudf::jit::get_type_name(out.type());
+  std::string const output_type_name = cudf::jit::get_type_name(output_type);
 
-  std::string ptx_hash =
-    "prog_binop." + std::to_string(std::hash<std::string>{}(ptx + output_type_name));
   std::string cuda_source =
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
 
   std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
                               .instantiate(output_type_name,  // list of template arguments
-                                           cudf::jit::get_type_name(lhs.type()),
-                                           cudf::jit::get_type_name(rhs.type()),
+                                           cudf::jit::get_type_name(lhs_type),
+                                           cudf::jit::get_type_name(rhs_type),
                                            std::string("cudf::binops::jit::UserDefinedOp"));
 
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  return cudf::jit::get_kernel(*binaryop_jit_kernel_cu_jit,
+                               kernel_name,
+                               {{"binaryop/jit/operation-udf.hpp", cuda_source}},
+                               {"-arch=sm_."});
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      const std::string& ptx,
+                      rmm::cuda_stream_view stream)
+{
+  get_binary_operation_kernel(ptx, lhs.type(), rhs.type(), out.type())
     ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
@@ -353,15 +378,7 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  // Check for datatype
-  auto is_type_supported_ptx = [](data_type type) -> bool {
-    return is_fixed_width(type) and not is_fixed_point(type) and
-           type.id() != type_id::INT8;  // Numba PTX doesn't support int8
-  };
-
-  CUDF_EXPECTS(is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+  binops::jit::check_ptx_types(lhs.type(), rhs.type(), output_type);
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
@@ -437,4 +454,14 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   return detail::binary_operation(lhs, rhs, ptx, output_type, cudf::default_stream_value, mr);
 }
 
+void precompile_binary_operations(std::vector<ptx_binary_operation_signature> const& signatures)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& signature : signatures) {
+    binops::jit::check_ptx_types(signature.lhs_type, signature.rhs_type, signature.output_type);
+    binops::jit::get_binary_operation_kernel(
+      signature.ptx, signature.lhs_type, signature.rhs_type, signature.output_type);
+  }
+}
+
 }  // namespace cudf
@@ -21,11 +21,15 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <algorithm>
+#include <type_traits>
+
 namespace cudf {
 namespace binops {
 namespace compiled {
@@ -37,6 +41,19 @@ constexpr bool is_bool_result()
   return std::is_same_v<bool, ReturnType>;
 }
 
+/**
+ * @brief Returns `true` if `BinaryOperator` depends on the validity of its operands.
+ */
+template <typename BinaryOperator>
+constexpr bool is_null_dependent_op()
+{
+  return std::is_same_v<BinaryOperator, ops::NullEquals> or
+         std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
+         std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
+         std::is_same_v<BinaryOperator, ops::NullMax> or
+         std::is_same_v<BinaryOperator, ops::NullMin>;
+}
+
 /**
  * @brief Type casts each element of the column to `CastType`
  *
@@ -85,6 +102,9 @@ struct typed_casted_writer {
 /**
  * @brief Functor to launch only defined operations with common type.
  *
+ * Returns the validity of the output row, which is only computed by the operators depending on
+ * the validity of their operands.
+ *
  * @tparam BinaryOperator binary operator functor
  */
 template <typename BinaryOperator>
@@ -95,28 +115,18 @@ struct ops_wrapper {
   bool const& is_lhs_scalar;
   bool const& is_rhs_scalar;
   template <typename TypeCommon>
-  __device__ void operator()(size_type i)
+  __device__ bool operator()(size_type i, bool lhs_valid, bool rhs_valid)
   {
+    bool output_valid = true;
     if constexpr (std::is_invocable_v<BinaryOperator, TypeCommon, TypeCommon>) {
       TypeCommon x =
         type_dispatcher(lhs.type(), type_casted_accessor<TypeCommon>{}, i, lhs, is_lhs_scalar);
       TypeCommon y =
         type_dispatcher(rhs.type(), type_casted_accessor<TypeCommon>{}, i, rhs, is_rhs_scalar);
       auto result = [&]() {
-        if constexpr (std::is_same_v<BinaryOperator, ops::NullEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
-                      std::is_same_v<BinaryOperator, ops::NullMax> or
-                      std::is_same_v<BinaryOperator, ops::NullMin>) {
-          bool output_valid = false;
-          auto result       = BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(
-            x,
-            y,
-            lhs.is_valid(is_lhs_scalar ? 0 : i),
-            rhs.is_valid(is_rhs_scalar ? 0 : i),
-            output_valid);
-          if (out.nullable() && !output_valid) out.set_null(i);
-          return result;
+        if constexpr (is_null_dependent_op<BinaryOperator>()) {
+          return BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(
+            x, y, lhs_valid, rhs_valid, output_valid);
         } else {
           return BinaryOperator{}.template operator()<TypeCommon, TypeCommon>(x, y);
         }
@@ -129,12 +139,15 @@ struct ops_wrapper {
         type_dispatcher(out.type(), typed_casted_writer<decltype(result)>{}, i, out, result);
     }
     (void)i;
+    return output_valid;
   }
 };
 
 /**
  * @brief Functor to launch only defined operations without common type.
  *
+ * Returns the validity of the output row, as `ops_wrapper`.
+ *
  * @tparam BinaryOperator binary operator functor
  */
 template <typename BinaryOperator>
@@ -145,27 +158,17 @@ struct ops2_wrapper {
   bool const& is_lhs_scalar;
   bool const& is_rhs_scalar;
   template <typename TypeLhs, typename TypeRhs>
-  __device__ void operator()(size_type i)
+  __device__ bool operator()(size_type i, bool lhs_valid, bool rhs_valid)
   {
+    bool output_valid = true;
     if constexpr (!has_common_type_v<TypeLhs, TypeRhs> and
                   std::is_invocable_v<BinaryOperator, TypeLhs, TypeRhs>) {
       TypeLhs x   = lhs.element<TypeLhs>(is_lhs_scalar ? 0 : i);
       TypeRhs y   = rhs.element<TypeRhs>(is_rhs_scalar ? 0 : i);
       auto result = [&]() {
-        if constexpr (std::is_same_v<BinaryOperator, ops::NullEquals> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalAnd> or
-                      std::is_same_v<BinaryOperator, ops::NullLogicalOr> or
-                      std::is_same_v<BinaryOperator, ops::NullMax> or
-                      std::is_same_v<BinaryOperator, ops::NullMin>) {
-          bool output_valid = false;
-          auto result       = BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(
-            x,
-            y,
-            lhs.is_valid(is_lhs_scalar ? 0 : i),
-            rhs.is_valid(is_rhs_scalar ? 0 : i),
-            output_valid);
-          if (out.nullable() && !output_valid) out.set_null(i);
-          return result;
+        if constexpr (is_null_dependent_op<BinaryOperator>()) {
+          return BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(
+            x, y, lhs_valid, rhs_valid, output_valid);
         } else {
           return BinaryOperator{}.template operator()<TypeLhs, TypeRhs>(x, y);
         }
@@ -178,6 +181,7 @@ struct ops2_wrapper {
         type_dispatcher(out.type(), typed_casted_writer<decltype(result)>{}, i, out, result);
     }
     (void)i;
+    return output_valid;
   }
 };
 
@@ -197,12 +201,16 @@ struct binary_op_device_dispatcher {
   bool is_lhs_scalar;
   bool is_rhs_scalar;
 
-  __forceinline__ __device__ void operator()(size_type i)
+  __forceinline__ __device__ bool operator()(size_type i, bool lhs_valid, bool rhs_valid)
   {
-    type_dispatcher(common_data_type,
-                    ops_wrapper<BinaryOperator>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
-                    i);
+    return type_dispatcher(common_data_type,
+                           ops_wrapper<BinaryOperator>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
+                           i,
+                           lhs_valid,
+                           rhs_valid);
   }
+
+  __forceinline__ __device__ void operator()(size_type i) { (*this)(i, true, true); }
 };
 
 /**
@@ -220,13 +228,71 @@ struct binary_op_double_device_dispatcher {
   bool is_lhs_scalar;
   bool is_rhs_scalar;
 
-  __forceinline__ __device__ void operator()(size_type i)
+  __forceinline__ __device__ bool operator()(size_type i, bool lhs_valid, bool rhs_valid)
   {
-    double_type_dispatcher(
+    return double_type_dispatcher(
       lhs.type(),
       rhs.type(),
       ops2_wrapper<BinaryOperator>{out, lhs, rhs, is_lhs_scalar, is_rhs_scalar},
-      i);
+      i,
+      lhs_valid,
+      rhs_valid);
+  }
+
+  __forceinline__ __device__ void operator()(size_type i) { (*this)(i, true, true); }
+};
+
+/**
+ * @brief Returns `true` if `BinaryOperator` is applied to `fixed_point` columns of the same
+ * representation directly on their integer values.
+ */
+template <class BinaryOperator>
+constexpr bool is_fixed_point_rep_op()
+{
+  return std::is_same_v<BinaryOperator, ops::Add> or std::is_same_v<BinaryOperator, ops::Sub> or
+         std::is_same_v<BinaryOperator, ops::Mul> or std::is_same_v<BinaryOperator, ops::Div> or
+         std::is_same_v<BinaryOperator, ops::Equal> or
+         std::is_same_v<BinaryOperator, ops::NotEqual> or
+         std::is_same_v<BinaryOperator, ops::Less> or
+         std::is_same_v<BinaryOperator, ops::Greater> or
+         std::is_same_v<BinaryOperator, ops::LessEqual> or
+         std::is_same_v<BinaryOperator, ops::GreaterEqual>;
+}
+
+/**
+ * @brief Functor applying an operator to `fixed_point` columns of the same representation
+ * directly on their integer values.
+ *
+ * The multipliers aligning the operands and the output to the scales of the operation are
+ * computed once on the host, so no element goes through the type dispatch or the rescaling of
+ * `fixed_point`.
+ *
+ * @tparam BinaryOperator binary operator functor
+ * @tparam Rep representation type of the `fixed_point` columns
+ */
+template <class BinaryOperator, typename Rep>
+struct fixed_point_rep_device_op {
+  mutable_column_device_view out;
+  column_device_view lhs;
+  column_device_view rhs;
+  bool is_lhs_scalar;
+  bool is_rhs_scalar;
+  Rep lhs_multiplier;  ///< Shifts lhs to the scale of the operation
+  Rep rhs_multiplier;  ///< Shifts rhs to the scale of the operation
+  Rep out_multiplier;  ///< Shifts the result to a smaller output scale
+  Rep out_divisor;     ///< Shifts the result to a larger output scale
+
+  __forceinline__ __device__ void operator()(size_type i)
+  {
+    Rep const x = lhs.data<Rep>()[is_lhs_scalar ? 0 : i] * lhs_multiplier;
+    Rep const y = rhs.data<Rep>()[is_rhs_scalar ? 0 : i] * rhs_multiplier;
+    auto const result = BinaryOperator{}.template operator()<Rep, Rep>(x, y);
+    if constexpr (is_bool_result<BinaryOperator, Rep, Rep>()) {
+      out.data<bool>()[i] = result;
+    } else {
+      // The same branch is taken by every thread
+      out.data<Rep>()[i] = out_divisor == Rep{1} ? result * out_multiplier : result / out_divisor;
+    }
   }
 };
 
@@ -273,6 +339,129 @@ void for_each(rmm::cuda_stream_view stream, cudf::size_type size, Functor f)
   for_each_kernel<<<grid_size, block_size, 0, stream.value()>>>(size, std::forward<Functor&&>(f));
 }
 
+/**
+ * @brief for_each kernel of the operators depending on the validity of their operands.
+ *
+ * Each warp processes tiles of 32 rows: the validities of a tile are read with a single bitmask
+ * word load per operand column and the output validities are written with a single bitmask word
+ * store, instead of a load per row and operand and an atomic operation per null output row.
+ *
+ * @param out Output column, with no offset
+ * @param lhs Left operand, a single row if `is_lhs_scalar`
+ * @param rhs Right operand, a single row if `is_rhs_scalar`
+ * @param f Functor called with each row and the validities of its operands, returning the
+ * validity of the output row
+ */
+template <typename Functor>
+__global__ void null_dependent_for_each_kernel(mutable_column_device_view out,
+                                               column_device_view lhs,
+                                               column_device_view rhs,
+                                               bool is_lhs_scalar,
+                                               bool is_rhs_scalar,
+                                               Functor f)
+{
+  using cudf::detail::tile_validity_accessor;
+  constexpr auto tile_size = static_cast<size_type>(cudf::detail::size_in_bits<bitmask_type>());
+  auto const lane          = static_cast<size_type>(threadIdx.x % tile_size);
+  auto const size          = out.size();
+  auto const lhs_validity  = tile_validity_accessor{lhs, lhs.nullable() and !is_lhs_scalar};
+  auto const rhs_validity  = tile_validity_accessor{rhs, rhs.nullable() and !is_rhs_scalar};
+
+  auto const step = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  // The loop is uniform across the warp: every lane calls the validity accessors of the tile
+  for (auto tile_begin = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x - lane;
+       tile_begin < size;
+       tile_begin += step) {
+    auto const i         = static_cast<size_type>(tile_begin) + lane;
+    auto const lhs_valid = is_lhs_scalar ? lhs.is_valid(0) : lhs_validity(i);
+    auto const rhs_valid = is_rhs_scalar ? rhs.is_valid(0) : rhs_validity(i);
+    auto const valid     = i < size and f(i, lhs_valid, rhs_valid);
+    auto const word      = __ballot_sync(0xffffffff, valid);
+    if (out.nullable() and lane == 0) { out.null_mask()[tile_begin / tile_size] = word; }
+  }
+}
+
+/**
+ * @brief Launches `null_dependent_for_each_kernel` over the rows of `out`.
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param out Output column, with no offset
+ * @param lhs Left operand
+ * @param rhs Right operand
+ * @param is_lhs_scalar Whether `lhs` is a single row applied to every row
+ * @param is_rhs_scalar Whether `rhs` is a single row applied to every row
+ * @param f Functor called with each row and the validities of its operands
+ */
+template <typename Functor>
+void null_dependent_for_each(rmm::cuda_stream_view stream,
+                             mutable_column_device_view const& out,
+                             column_device_view const& lhs,
+                             column_device_view const& rhs,
+                             bool is_lhs_scalar,
+                             bool is_rhs_scalar,
+                             Functor f)
+{
+  // A multiple of the warp size, so that every warp holds whole tiles
+  constexpr int block_size = 256;
+  if (out.size() == 0) { return; }
+  // 2 elements per thread.
+  auto const grid_size = util::div_rounding_up_safe(out.size(), 2 * block_size);
+  null_dependent_for_each_kernel<<<grid_size, block_size, 0, stream.value()>>>(
+    out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, f);
+}
+
+/**
+ * @brief Applies `BinaryOperator` to `fixed_point` columns of the same representation
+ * directly on their integer values.
+ *
+ * @tparam BinaryOperator binary operator functor
+ * @tparam Rep representation type of the `fixed_point` columns
+ */
+template <class BinaryOperator, typename Rep>
+void apply_fixed_point_binary_op(mutable_column_view& out,
+                                 column_view const& lhs,
+                                 column_view const& rhs,
+                                 bool is_lhs_scalar,
+                                 bool is_rhs_scalar,
+                                 rmm::cuda_stream_view stream)
+{
+  constexpr bool is_mul = std::is_same_v<BinaryOperator, ops::Mul>;
+  constexpr bool is_div = std::is_same_v<BinaryOperator, ops::Div>;
+
+  auto const power_of_ten = [](int32_t exponent) {
+    auto value = Rep{1};
+    for (int32_t i = 0; i < exponent; ++i) {
+      value *= Rep{10};
+    }
+    return value;
+  };
+
+  // The scale of the result, as in the operators of `fixed_point`
+  auto const lhs_scale = lhs.type().scale();
+  auto const rhs_scale = rhs.type().scale();
+  auto const result_scale = is_mul   ? lhs_scale + rhs_scale
+                            : is_div ? lhs_scale - rhs_scale
+                                     : std::min(lhs_scale, rhs_scale);
+  auto const aligns_operands = not is_mul and not is_div;
+  auto const out_scale       = is_fixed_point(out.type()) ? out.type().scale() : result_scale;
+
+  auto lhsd = column_device_view::create(lhs, stream);
+  auto rhsd = column_device_view::create(rhs, stream);
+  auto outd = mutable_column_device_view::create(out, stream);
+  for_each(stream,
+           out.size(),
+           fixed_point_rep_device_op<BinaryOperator, Rep>{
+             *outd,
+             *lhsd,
+             *rhsd,
+             is_lhs_scalar,
+             is_rhs_scalar,
+             aligns_operands ? power_of_ten(lhs_scale - result_scale) : Rep{1},
+             aligns_operands ? power_of_ten(rhs_scale - result_scale) : Rep{1},
+             power_of_ten(result_scale - out_scale),
+             power_of_ten(out_scale - result_scale)});
+}
+
 template <class BinaryOperator>
 void apply_binary_op(mutable_column_view& out,
                      column_view const& lhs,
@@ -281,13 +470,53 @@ void apply_binary_op(mutable_column_view& out,
                      bool is_rhs_scalar,
                      rmm::cuda_stream_view stream)
 {
+  if constexpr (is_fixed_point_rep_op<BinaryOperator>()) {
+    auto const rep_out_id =
+      is_bool_result<BinaryOperator, int32_t, int32_t>() ? type_id::BOOL8 : lhs.type().id();
+    if (is_fixed_point(lhs.type()) and lhs.type().id() == rhs.type().id() and
+        out.type().id() == rep_out_id) {
+      switch (lhs.type().id()) {
+        case type_id::DECIMAL32:
+          return apply_fixed_point_binary_op<BinaryOperator, int32_t>(
+            out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+        case type_id::DECIMAL64:
+          return apply_fixed_point_binary_op<BinaryOperator, int64_t>(
+            out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+        default:
+          return apply_fixed_point_binary_op<BinaryOperator, __int128_t>(
+            out, lhs, rhs, is_lhs_scalar, is_rhs_scalar, stream);
+      }
+    }
+  }
+
   auto common_dtype = get_common_type(out.type(), lhs.type(), rhs.type());
 
   auto lhsd = column_device_view::create(lhs, stream);
   auto rhsd = column_device_view::create(rhs, stream);
   auto outd = mutable_column_device_view::create(out, stream);
   // Create binop functor instance
-  if (common_dtype) {
+  if constexpr (is_null_dependent_op<BinaryOperator>()) {
+    CUDF_EXPECTS(out.offset() == 0, "Unexpected offset of the binary operation output");
+    if (common_dtype) {
+      null_dependent_for_each(stream,
+                              *outd,
+                              *lhsd,
+                              *rhsd,
+                              is_lhs_scalar,
+                              is_rhs_scalar,
+                              binary_op_device_dispatcher<BinaryOperator>{
+                                *common_dtype, *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+    } else {
+      null_dependent_for_each(stream,
+                              *outd,
+                              *lhsd,
+                              *rhsd,
+                              is_lhs_scalar,
+                              is_rhs_scalar,
+                              binary_op_double_device_dispatcher<BinaryOperator>{
+                                *outd, *lhsd, *rhsd, is_lhs_scalar, is_rhs_scalar});
+    }
+  } else if (common_dtype) {
     // Execute it on every element
     for_each(stream,
              out.size(),
@@ -16,6 +16,7 @@
  */
 
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -39,7 +40,7 @@ bool is_element_valid_sync(column_view const& col_view,
                                 sizeof(bitmask_type),
                                 cudaMemcpyDeviceToHost,
                                 stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return static_cast<bool>(word & (bitmask_type{1} << intra_word_index(index)));
 }
 
@@ -20,6 +20,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/small_allocation.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/table/table_view.hpp>
@@ -321,7 +322,8 @@ cudf::size_type count_set_bits(bitmask_type const* bitmask,
 
   cudf::detail::grid_1d grid(num_words, block_size);
 
-  rmm::device_scalar<size_type> non_zero_count(0, stream);
+  rmm::device_scalar<size_type> non_zero_count(
+    0, stream, cudf::detail::small_allocation_resource(sizeof(size_type)));
 
   count_set_bits_kernel<block_size>
     <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
@@ -447,10 +449,11 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
     return std::pair(std::move(null_mask), 0);
   }
 
+  // Masks without nulls would not change the result, so they are not combined
   std::vector<bitmask_type const*> masks;
   std::vector<size_type> offsets;
   for (auto&& col : view) {
-    if (col.nullable()) {
+    if (col.has_nulls()) {
       masks.push_back(col.null_mask());
       offsets.push_back(col.offset());
     }
@@ -466,6 +469,11 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
       mr);
   }
 
+  // Nullable columns without nulls result in an all valid mask
+  if (cudf::nullable(view)) {
+    return std::pair(create_null_mask(view.num_rows(), mask_state::ALL_VALID, stream, mr), 0);
+  }
+
   return std::pair(std::move(null_mask), 0);
 }
 
@@ -480,26 +488,28 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
     return std::pair(std::move(null_mask), 0);
   }
 
-  std::vector<bitmask_type const*> masks;
-  std::vector<size_type> offsets;
-  for (auto&& col : view) {
-    if (col.nullable()) {
-      masks.push_back(col.null_mask());
-      offsets.push_back(col.offset());
+  // A single column without nulls makes every row valid, without combining any mask
+  if (std::any_of(view.begin(), view.end(), [](auto const& col) { return not col.has_nulls(); })) {
+    if (std::all_of(view.begin(), view.end(), [](auto const& col) { return col.nullable(); })) {
+      return std::pair(create_null_mask(view.num_rows(), mask_state::ALL_VALID, stream, mr), 0);
     }
+    return std::pair(std::move(null_mask), 0);
   }
 
-  if (static_cast<size_type>(masks.size()) == view.num_columns()) {
-    return cudf::detail::bitmask_binop(
-      [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
-      masks,
-      offsets,
-      view.num_rows(),
-      stream,
-      mr);
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> offsets;
+  for (auto&& col : view) {
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
   }
 
-  return std::pair(std::move(null_mask), 0);
+  return cudf::detail::bitmask_binop(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    masks,
+    offsets,
+    view.num_rows(),
+    stream,
+    mr);
 }
 
 }  // namespace detail
@@ -44,6 +44,35 @@
 #include <vector>
 
 namespace cudf {
+namespace {
+
+// Returns the device memory of a buffer that may be null
+void* buffer_data(std::shared_ptr<rmm::device_buffer> const& buffer)
+{
+  return buffer ? buffer->data() : nullptr;
+}
+
+// Deep copies a buffer that may be null
+std::shared_ptr<rmm::device_buffer> copy_buffer(std::shared_ptr<rmm::device_buffer> const& buffer,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  return buffer ? std::make_shared<rmm::device_buffer>(*buffer, stream, mr)
+                : std::make_shared<rmm::device_buffer>(0, stream, mr);
+}
+
+// Copies a buffer shared with other columns so that it can be modified. The copy is complete on
+// return: from then on, the other owners may write the source buffer in place on any stream.
+void unshare_buffer(std::shared_ptr<rmm::device_buffer>& buffer)
+{
+  if (buffer && buffer.use_count() > 1) {
+    auto const stream = cudf::default_stream_value;
+    buffer            = copy_buffer(buffer, stream, buffer->memory_resource());
+    stream.synchronize();
+  }
+}
+
+}  // namespace
 
 // Copy ctor w/ optional stream/mr
 column::column(column const& other,
@@ -51,9 +80,10 @@ column::column(column const& other,
                rmm::mr::device_memory_resource* mr)
   : _type{other._type},
     _size{other._size},
-    _data{other._data, stream, mr},
-    _null_mask{other._null_mask, stream, mr},
-    _null_count{other._null_count}
+    _data{copy_buffer(other._data, stream, mr)},
+    _null_mask{copy_buffer(other._null_mask, stream, mr)},
+    _null_count{other._null_count},
+    _properties{other._properties}
 {
   _children.reserve(other.num_children());
   for (auto const& c : other._children) {
@@ -68,7 +98,8 @@ column::column(column&& other) noexcept
     _data{std::move(other._data)},
     _null_mask{std::move(other._null_mask)},
     _null_count{other._null_count},
-    _children{std::move(other._children)}
+    _children{std::move(other._children)},
+    _properties{std::move(other._properties)}
 {
   other._size       = 0;
   other._null_count = 0;
@@ -76,14 +107,42 @@ column::column(column&& other) noexcept
 }
 
 // Release contents
-column::contents column::release() noexcept
+column::contents column::release()
 {
+  unshare_buffer(_data);
+  unshare_buffer(_null_mask);
+  auto const release_buffer = [](std::shared_ptr<rmm::device_buffer>& buffer) {
+    auto released = buffer ? std::make_unique<rmm::device_buffer>(std::move(*buffer))
+                           : std::make_unique<rmm::device_buffer>();
+    buffer.reset();
+    return released;
+  };
+
   _size       = 0;
   _null_count = 0;
   _type       = data_type{type_id::EMPTY};
-  return column::contents{std::make_unique<rmm::device_buffer>(std::move(_data)),
-                          std::make_unique<rmm::device_buffer>(std::move(_null_mask)),
-                          std::move(_children)};
+  _properties.reset();
+  return column::contents{release_buffer(_data), release_buffer(_null_mask), std::move(_children)};
+}
+
+// Share the buffers with a new column
+std::unique_ptr<column> column::share() const
+{
+  std::vector<std::unique_ptr<column>> children;
+  children.reserve(_children.size());
+  for (auto const& c : _children) {
+    children.emplace_back(c->share());
+  }
+
+  auto shared         = std::make_unique<column>();
+  shared->_type       = _type;
+  shared->_size       = _size;
+  shared->_data       = _data;
+  shared->_null_mask  = _null_mask;
+  shared->_null_count = _null_count;
+  shared->_children   = std::move(children);
+  shared->_properties = _properties;
+  return shared;
 }
 
 // Create immutable view
@@ -98,11 +157,12 @@ column_view column::view() const
 
   return column_view{type(),
                      size(),
-                     _data.data(),
-                     static_cast<bitmask_type const*>(_null_mask.data()),
+                     buffer_data(_data),
+                     static_cast<bitmask_type const*>(buffer_data(_null_mask)),
                      null_count(),
                      0,
-                     child_views};
+                     child_views}
+    .with_properties(_properties);
 }
 
 // Create mutable view
@@ -110,6 +170,10 @@ mutable_column_view column::mutable_view()
 {
   CUDF_FUNC_RANGE();
 
+  // the buffers shared with other columns must not change under them
+  unshare_buffer(_data);
+  unshare_buffer(_null_mask);
+
   // create views of children
   std::vector<mutable_column_view> child_views;
   child_views.reserve(_children.size());
@@ -128,11 +192,12 @@ mutable_column_view column::mutable_view()
   // existing `null_count` is no longer valid. Reset it to `UNKNOWN_NULL_COUNT` forcing it to be
   // recomputed on the next invocation of `this->null_count()`.
   set_null_count(cudf::UNKNOWN_NULL_COUNT);
+  _properties.reset();
 
   return mutable_column_view{type(),
                              size(),
-                             _data.data(),
-                             static_cast<bitmask_type*>(_null_mask.data()),
+                             buffer_data(_data),
+                             static_cast<bitmask_type*>(buffer_data(_null_mask)),
                              current_null_count,
                              0,
                              child_views};
@@ -143,8 +208,8 @@ size_type column::null_count() const
 {
   CUDF_FUNC_RANGE();
   if (_null_count <= cudf::UNKNOWN_NULL_COUNT) {
-    _null_count = cudf::detail::null_count(
-      static_cast<bitmask_type const*>(_null_mask.data()), 0, size(), cudf::default_stream_value);
+    auto const mask = static_cast<bitmask_type const*>(buffer_data(_null_mask));
+    _null_count     = cudf::detail::null_count(mask, 0, size(), cudf::default_stream_value);
   }
   return _null_count;
 }
@@ -156,8 +221,9 @@ void column::set_null_mask(rmm::device_buffer&& new_null_mask, size_type new_nul
                  "Column with null values must be nullable and the null mask \
                   buffer size should match the size of the column.");
   }
-  _null_mask  = std::move(new_null_mask);  // move
+  _null_mask  = std::make_shared<rmm::device_buffer>(std::move(new_null_mask));  // move
   _null_count = new_null_count;
+  _properties.reset();
 }
 
 void column::set_null_mask(rmm::device_buffer const& new_null_mask,
@@ -169,8 +235,9 @@ void column::set_null_mask(rmm::device_buffer const& new_null_mask,
                  "Column with null values must be nullable and the null mask \
                   buffer size should match the size of the column.");
   }
-  _null_mask  = rmm::device_buffer{new_null_mask, stream};  // copy
+  _null_mask  = std::make_shared<rmm::device_buffer>(new_null_mask, stream);  // copy
   _null_count = new_null_count;
+  _properties.reset();
 }
 
 void column::set_null_count(size_type new_null_count)
@@ -282,6 +349,8 @@ column::column(column_view view, rmm::cuda_stream_view stream, rmm::mr::device_m
      // an lvalue reference, which would otherwise dispatch to the copy constructor
     column{std::move(*type_dispatcher(view.type(), create_column_from_view{view, stream, mr}))}
 {
+  // The copy holds the same elements
+  _properties = view.properties();
 }
 
 }  // namespace cudf
@@ -16,15 +16,21 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_view_cache.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <functional>
+#include <memory>
 #include <numeric>
+#include <utility>
 
 namespace cudf {
 // Trivially copy all members but the children
@@ -42,10 +48,15 @@ column_device_view::column_device_view(column_view source)
 void column_device_view::destroy() { delete this; }
 
 namespace {
-// helper function for column_device_view::create and mutable_column_device::create methods
+// helper function for column_device_view::create and mutable_column_device::create methods.
+// returns the view and the device memory holding its children, which the view's deleter co-owns
 template <typename ColumnView, typename ColumnDeviceView>
-std::unique_ptr<ColumnDeviceView, std::function<void(ColumnDeviceView*)>>
-create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view stream)
+std::pair<std::unique_ptr<ColumnDeviceView, std::function<void(ColumnDeviceView*)>>,
+          std::shared_ptr<rmm::device_buffer>>
+create_device_view_from_view(
+  ColumnView const& source,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   size_type num_children = source.num_children();
   // First calculate the size of memory needed to hold the child columns. This is done by calling
@@ -65,15 +76,12 @@ create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view str
   // Each ColumnDeviceView instance may have child objects that
   // require setting some internal device pointers before being copied
   // from CPU to device.
-  rmm::device_buffer* const descendant_storage =
-    new rmm::device_buffer(descendant_storage_bytes, stream);
+  auto const descendant_storage =
+    std::make_shared<rmm::device_buffer>(descendant_storage_bytes, stream, mr);
 
-  auto deleter = [descendant_storage](ColumnDeviceView* v) {
-    v->destroy();
-    delete descendant_storage;
-  };
+  auto deleter = [descendant_storage](ColumnDeviceView* v) { v->destroy(); };
 
-  std::unique_ptr<ColumnDeviceView, decltype(deleter)> result{
+  std::unique_ptr<ColumnDeviceView, std::function<void(ColumnDeviceView*)>> result{
     new ColumnDeviceView(source, staging_buffer.data(), descendant_storage->data()), deleter};
 
   // copy the CPU memory with all the children into device memory
@@ -83,9 +91,9 @@ create_device_view_from_view(ColumnView const& source, rmm::cuda_stream_view str
                                 cudaMemcpyDefault,
                                 stream.value()));
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
-  return result;
+  return std::pair(std::move(result), descendant_storage);
 }
 
 }  // namespace
@@ -114,7 +122,23 @@ column_device_view::create(column_view source, rmm::cuda_stream_view stream)
     return std::unique_ptr<column_device_view>(new column_device_view(source));
   }
 
-  return create_device_view_from_view<column_view, column_device_view>(source, stream);
+  if (!detail::is_device_view_cache_enabled(stream)) {
+    return create_device_view_from_view<column_view, column_device_view>(source, stream).first;
+  }
+
+  // reuse the device view of a column with the same structure and data
+  using cache_type = detail::device_view_cache<column_device_view>;
+  auto& cache      = cache_type::instance();
+  auto const key   = detail::device_view_cache_key(source);
+  auto cached      = cache.find(key);
+  if (!cached.has_value()) {
+    auto [created, storage] = create_device_view_from_view<column_view, column_device_view>(
+      source, stream, detail::device_view_cache_resource());
+    cached = cache_type::entry{*created, storage};
+    cache.insert(key, *cached);
+  }
+  return {new column_device_view(cached->first),
+          [storage = cached->second](column_device_view* v) { v->destroy(); }};
 }
 
 std::size_t column_device_view::extent(column_view const& source)
@@ -158,10 +182,12 @@ void mutable_column_device_view::destroy() { delete this; }
 std::unique_ptr<mutable_column_device_view, std::function<void(mutable_column_device_view*)>>
 mutable_column_device_view::create(mutable_column_view source, rmm::cuda_stream_view stream)
 {
-  return source.num_children() == 0
-           ? std::unique_ptr<mutable_column_device_view>(new mutable_column_device_view(source))
-           : create_device_view_from_view<mutable_column_view, mutable_column_device_view>(source,
-                                                                                           stream);
+  if (source.num_children() == 0) {
+    return std::unique_ptr<mutable_column_device_view>(new mutable_column_device_view(source));
+  }
+  auto [view, storage] =
+    create_device_view_from_view<mutable_column_view, mutable_column_device_view>(source, stream);
+  return std::move(view);
 }
 
 std::size_t mutable_column_device_view::extent(mutable_column_view source)
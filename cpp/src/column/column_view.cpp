@@ -151,6 +151,13 @@ column_view::column_view(data_type type,
   }
 }
 
+column_view column_view::with_properties(std::shared_ptr<column_properties const> properties) const
+{
+  auto result        = *this;
+  result._properties = std::move(properties);
+  return result;
+}
+
 // Mutable view constructor
 mutable_column_view::mutable_column_view(data_type type,
                                          size_type size,
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "copy_element.cuh"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/indexalator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A column gathered by `batched_gather`.
+ *
+ * Fixed-width columns copy `element_size` bytes per row. Strings columns have an `element_size`
+ * of 0 and are gathered in two steps: the sizes of the strings are computed first, and their
+ * characters are copied once the output characters are allocated.
+ */
+struct gather_task {
+  input_indexalator map;            ///< The gather map
+  size_type map_size;               ///< The number of rows to gather
+  size_type source_size;            ///< The number of rows of the source column
+  bool wrap_negative;               ///< Whether negative indices count from the end of the source
+  size_type element_size;           ///< The size of a fixed-width element, 0 for strings
+  uint8_t const* source_data;       ///< The source elements, or the characters of strings
+  size_type const* source_offsets;  ///< The offsets of the source strings
+  bitmask_type const* source_mask;  ///< The source null mask, may be null
+  size_type source_mask_offset;     ///< The offset in bits of the source column in its null mask
+  void* target_data;                ///< The output elements, or the offsets of strings
+  char* target_chars;               ///< The characters of the output strings
+  bitmask_type* target_mask;        ///< The output null mask, may be null
+
+  /**
+   * @brief Returns the source row of an output row, or -1 if its index is out of bounds.
+   */
+  __device__ size_type source_row(size_type row) const
+  {
+    auto index = map[row];
+    if (wrap_negative && index < 0) { index += source_size; }
+    return (index >= 0 && index < source_size) ? index : -1;
+  }
+};
+
+/**
+ * @brief Functor returning the index of the task of a slot of the flattened rows.
+ */
+struct slot_to_task_fn {
+  int64_t const* slot_offsets;
+  size_type num_tasks;
+
+  __device__ size_type operator()(int64_t slot) const
+  {
+    return static_cast<size_type>(
+             thrust::upper_bound(thrust::seq, slot_offsets, slot_offsets + num_tasks, slot) -
+             slot_offsets) -
+           1;
+  }
+};
+
+/**
+ * @brief Gathers the fixed-width elements and null masks of all the tasks, and computes the sizes
+ * of the gathered strings.
+ *
+ * The rows of the tasks are flattened into slots. Each task is padded to a multiple of the warp
+ * size so that every warp works on a single task and builds whole words of its null mask.
+ *
+ * @param tasks The columns to gather
+ * @param to_task Functor returning the task of each slot
+ * @param num_slots The total number of slots, a multiple of the warp size
+ * @param first_string_slot The first slot of the strings tasks, which come last
+ * @param string_sizes The size of the string of each strings slot
+ * @param valid_counts The number of valid rows of each task
+ */
+template <int block_size>
+__global__ void batched_gather_kernel(gather_task const* tasks,
+                                      slot_to_task_fn to_task,
+                                      int64_t num_slots,
+                                      int64_t first_string_slot,
+                                      size_type* string_sizes,
+                                      size_type* valid_counts)
+{
+  auto slot = static_cast<int64_t>(threadIdx.x) + static_cast<int64_t>(blockIdx.x) * block_size;
+  auto const stride = static_cast<int64_t>(block_size) * gridDim.x;
+  for (; slot < num_slots; slot += stride) {
+    auto const task_index = to_task(slot);
+    auto const& task      = tasks[task_index];
+    auto const row        = static_cast<size_type>(slot - to_task.slot_offsets[task_index]);
+
+    bool valid     = false;
+    size_type size = 0;
+    if (row < task.map_size) {
+      auto const source_row = task.source_row(row);
+      if (source_row >= 0) {
+        valid = task.source_mask == nullptr ||
+                bit_is_set(task.source_mask, source_row + task.source_mask_offset);
+        if (task.element_size > 0) {
+          copy_element(task.source_data, task.target_data, task.element_size, source_row, row);
+        } else if (valid) {
+          size = task.source_offsets[source_row + 1] - task.source_offsets[source_row];
+        }
+      }
+    }
+    if (task.element_size == 0) { string_sizes[slot - first_string_slot] = size; }
+
+    // all the lanes of the warp belong to the same task
+    if (task.target_mask != nullptr) {
+      auto const word = __ballot_sync(0xFFFF'FFFF, valid);
+      if (threadIdx.x % warp_size == 0 && row < task.map_size) {
+        task.target_mask[word_index(row)] = word;
+        atomicAdd(valid_counts + task_index, __popc(word));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Writes the offsets and copies the characters of the gathered strings.
+ *
+ * @param tasks The columns to gather
+ * @param to_task Functor returning the task of each slot
+ * @param num_slots The total number of slots
+ * @param first_string_slot The first slot of the strings tasks
+ * @param string_offsets The offset of the string of each strings slot within its column
+ */
+template <int block_size>
+__global__ void batched_gather_chars_kernel(gather_task const* tasks,
+                                            slot_to_task_fn to_task,
+                                            int64_t num_slots,
+                                            int64_t first_string_slot,
+                                            size_type const* string_offsets)
+{
+  auto slot = first_string_slot + static_cast<int64_t>(threadIdx.x) +
+              static_cast<int64_t>(blockIdx.x) * block_size;
+  auto const stride = static_cast<int64_t>(block_size) * gridDim.x;
+  for (; slot < num_slots; slot += stride) {
+    auto const task_index = to_task(slot);
+    auto const& task      = tasks[task_index];
+    auto const row        = static_cast<size_type>(slot - to_task.slot_offsets[task_index]);
+    if (row > task.map_size) { continue; }
+
+    auto const offset                              = string_offsets[slot - first_string_slot];
+    static_cast<size_type*>(task.target_data)[row] = offset;
+    if (row == task.map_size) { continue; }
+
+    auto const size = string_offsets[slot - first_string_slot + 1] - offset;
+    if (size == 0) { continue; }
+    auto const source =
+      reinterpret_cast<char const*>(task.source_data) + task.source_offsets[task.source_row(row)];
+    thrust::copy(thrust::seq, source, source + size, task.target_chars + offset);
+  }
+}
+
+/**
+ * @brief Returns whether `batched_gather` gathers columns of this type itself.
+ */
+bool is_batched_type(data_type type)
+{
+  return type.id() == type_id::STRING || (is_fixed_width(type) && size_of(type) <= 16);
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   host_span<column_view const> gather_maps,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   negative_index_policy neg_indices,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(source_tables.size() == gather_maps.size(),
+               "The number of source tables and gather maps must match");
+  std::for_each(gather_maps.begin(), gather_maps.end(), [](column_view const& map) {
+    CUDF_EXPECTS(not map.has_nulls(), "gather_map contains nulls");
+  });
+
+  auto const num_tables = source_tables.size();
+  std::vector<std::vector<std::unique_ptr<column>>> columns(num_tables);
+
+  // build the tasks, fixed-width columns first, and gather the other columns by table
+  std::vector<gather_task> tasks;
+  std::vector<std::pair<std::size_t, size_type>> task_columns;
+  std::vector<rmm::device_uvector<size_type>> string_offsets;
+  std::vector<rmm::device_buffer> string_masks;
+  for (bool const strings : {false, true}) {
+    for (std::size_t t = 0; t < num_tables; ++t) {
+      auto const& source = source_tables[t];
+      auto const& map    = gather_maps[t];
+      auto const nullify = bounds_policy == out_of_bounds_policy::NULLIFY;
+      auto const wrap_negative =
+        neg_indices == negative_index_policy::ALLOWED && not is_unsigned(map.type());
+      columns[t].resize(source.num_columns());
+      for (size_type c = 0; c < source.num_columns(); ++c) {
+        auto const& col = source.column(c);
+        if (not is_batched_type(col.type()) || (col.type().id() == type_id::STRING) != strings) {
+          continue;
+        }
+        auto const has_mask   = col.nullable() || nullify;
+        auto const has_source = col.size() > 0;
+        gather_task task{indexalator_factory::make_input_iterator(map),
+                         map.size(),
+                         col.size(),
+                         wrap_negative,
+                         0,
+                         nullptr,
+                         nullptr,
+                         has_source ? col.null_mask() : nullptr,
+                         col.offset(),
+                         nullptr,
+                         nullptr,
+                         nullptr};
+        if (strings) {
+          if (has_source) {
+            strings_column_view const scv(col);
+            task.source_data    = reinterpret_cast<uint8_t const*>(scv.chars_begin());
+            task.source_offsets = scv.offsets_begin();
+          }
+          string_offsets.emplace_back(map.size() + 1, stream, mr);
+          task.target_data = string_offsets.back().data();
+          string_masks.push_back(
+            has_mask ? detail::create_null_mask(map.size(), mask_state::UNINITIALIZED, stream, mr)
+                     : rmm::device_buffer{0, stream, mr});
+          task.target_mask = static_cast<bitmask_type*>(string_masks.back().data());
+        } else {
+          task.element_size = static_cast<size_type>(size_of(col.type()));
+          task.source_data  = col.head<uint8_t>() + col.offset() * task.element_size;
+          columns[t][c]     = make_fixed_width_column(
+            col.type(),
+            map.size(),
+            has_mask ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+            stream,
+            mr);
+          auto target      = columns[t][c]->mutable_view();
+          task.target_data = target.head();
+          task.target_mask = target.null_mask();
+        }
+        tasks.push_back(task);
+        task_columns.emplace_back(t, c);
+      }
+    }
+  }
+  auto const num_fixed_width_tasks = tasks.size() - string_offsets.size();
+
+  // flatten the rows of the tasks, padding each one to whole warps with at least one extra slot
+  // for the final offset of strings
+  std::vector<int64_t> slot_offsets(tasks.size() + 1, 0);
+  std::transform(tasks.begin(), tasks.end(), slot_offsets.begin() + 1, [](auto const& task) {
+    return static_cast<int64_t>(util::round_up_safe(task.map_size + 1, warp_size));
+  });
+  std::partial_sum(slot_offsets.begin(), slot_offsets.end(), slot_offsets.begin());
+  auto const num_slots         = slot_offsets.back();
+  auto const first_string_slot = slot_offsets[num_fixed_width_tasks];
+
+  if (not tasks.empty()) {
+    auto d_tasks        = make_device_uvector_async(tasks, stream);
+    auto d_slot_offsets = make_device_uvector_async(slot_offsets, stream);
+    auto const to_task =
+      slot_to_task_fn{d_slot_offsets.data(), static_cast<size_type>(tasks.size())};
+    rmm::device_uvector<size_type> string_sizes(num_slots - first_string_slot, stream);
+    rmm::device_uvector<size_type> valid_counts(tasks.size(), stream);
+    CUDF_CUDA_TRY(cudaMemsetAsync(
+      valid_counts.data(), 0, valid_counts.size() * sizeof(size_type), stream.value()));
+
+    // the kernels stride over the slots, so the grid need not cover all of them
+    constexpr int block_size = 256;
+    auto const grid_size     = [](int64_t slots) {
+      return static_cast<size_type>(
+        std::min<int64_t>(slots, std::numeric_limits<size_type>::max() - block_size));
+    };
+    grid_1d const config(grid_size(num_slots), block_size);
+    batched_gather_kernel<block_size>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_tasks.data(),
+        to_task,
+        num_slots,
+        first_string_slot,
+        string_sizes.data(),
+        valid_counts.data());
+
+    if (not string_offsets.empty()) {
+      // the offsets of the strings of each column, ending with the size of their characters
+      auto const keys = thrust::make_transform_iterator(
+        thrust::make_counting_iterator<int64_t>(first_string_slot), to_task);
+      thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                    keys,
+                                    keys + string_sizes.size(),
+                                    string_sizes.begin(),
+                                    string_sizes.begin());
+
+      // allocate the characters of each column
+      std::vector<int64_t> chars_slots(string_offsets.size());
+      std::transform(tasks.begin() + num_fixed_width_tasks,
+                     tasks.end(),
+                     slot_offsets.begin() + num_fixed_width_tasks,
+                     chars_slots.begin(),
+                     [first_string_slot](auto const& task, auto slot_offset) {
+                       return slot_offset + task.map_size - first_string_slot;
+                     });
+      auto const d_chars_slots = make_device_uvector_async(chars_slots, stream);
+      rmm::device_uvector<size_type> d_chars_sizes(chars_slots.size(), stream);
+      thrust::gather(rmm::exec_policy(stream),
+                     d_chars_slots.begin(),
+                     d_chars_slots.end(),
+                     string_sizes.begin(),
+                     d_chars_sizes.begin());
+      auto const chars_sizes = make_std_vector_sync(d_chars_sizes, stream);
+
+      std::vector<rmm::device_uvector<char>> string_chars;
+      string_chars.reserve(chars_sizes.size());
+      for (std::size_t i = 0; i < chars_sizes.size(); ++i) {
+        string_chars.emplace_back(chars_sizes[i], stream, mr);
+        tasks[num_fixed_width_tasks + i].target_chars = string_chars.back().data();
+      }
+      CUDF_CUDA_TRY(cudaMemcpyAsync(d_tasks.data() + num_fixed_width_tasks,
+                                    tasks.data() + num_fixed_width_tasks,
+                                    string_offsets.size() * sizeof(gather_task),
+                                    cudaMemcpyHostToDevice,
+                                    stream.value()));
+
+      grid_1d const chars_config(grid_size(num_slots - first_string_slot), block_size);
+      batched_gather_chars_kernel<block_size>
+        <<<chars_config.num_blocks, chars_config.num_threads_per_block, 0, stream.value()>>>(
+          d_tasks.data(), to_task, num_slots, first_string_slot, string_sizes.data());
+
+      for (std::size_t i = 0; i < string_offsets.size(); ++i) {
+        auto const [t, c] = task_columns[num_fixed_width_tasks + i];
+        columns[t][c]     = make_strings_column(tasks[num_fixed_width_tasks + i].map_size,
+                                            std::move(string_offsets[i]),
+                                            std::move(string_chars[i]),
+                                            std::move(string_masks[i]),
+                                            0);
+      }
+    }
+
+    // the null counts are known once both kernels are done
+    auto const h_valid_counts = make_std_vector_sync(valid_counts, stream);
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+      auto const [t, c] = task_columns[i];
+      columns[t][c]->set_null_count(
+        tasks[i].target_mask == nullptr ? 0 : tasks[i].map_size - h_valid_counts[i]);
+    }
+  }
+
+  // gather the columns of the other types by table
+  for (std::size_t t = 0; t < num_tables; ++t) {
+    auto const& source = source_tables[t];
+    std::vector<size_type> indices;
+    for (size_type c = 0; c < source.num_columns(); ++c) {
+      if (not is_batched_type(source.column(c).type())) { indices.push_back(c); }
+    }
+    if (indices.empty()) { continue; }
+    auto gathered =
+      detail::gather(source.select(indices), gather_maps[t], bounds_policy, neg_indices, stream, mr)
+        ->release();
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+      columns[t][indices[i]] = std::move(gathered[i]);
+    }
+  }
+
+  std::vector<std::unique_ptr<table>> result;
+  result.reserve(num_tables);
+  std::transform(columns.begin(), columns.end(), std::back_inserter(result), [](auto& cols) {
+    return std::make_unique<table>(std::move(cols));
+  });
+  return result;
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<table>> batched_gather(host_span<table_view const> source_tables,
+                                                   host_span<column_view const> gather_maps,
+                                                   out_of_bounds_policy bounds_policy,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::batched_gather(source_tables,
+                                gather_maps,
+                                bounds_policy,
+                                detail::negative_index_policy::ALLOWED,
+                                stream,
+                                mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "copy_element.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/scatter.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A fixed-width output column of `select_rows`.
+ *
+ * Each output row is the row of `lhs` where the boolean mask is true, and the row of `rhs`
+ * otherwise.
+ */
+struct select_task {
+  size_type element_size;        ///< The size of an element
+  uint8_t const* lhs_data;       ///< The elements selected where the mask is true
+  bitmask_type const* lhs_mask;  ///< The null mask of the lhs column, may be null
+  size_type lhs_mask_offset;     ///< The offset in bits of the lhs column in its null mask
+  uint8_t const* rhs_data;       ///< The elements selected where the mask is false
+  bitmask_type const* rhs_mask;  ///< The null mask of the rhs column, may be null
+  size_type rhs_mask_offset;     ///< The offset in bits of the rhs column in its null mask
+  void* target_data;             ///< The output elements
+  bitmask_type* target_mask;     ///< The output null mask, may be null
+};
+
+/**
+ * @brief Selects the rows of all the tasks by a single boolean mask.
+ *
+ * Each thread reads the mask of its row once and copies that row of every task. The rows are
+ * padded to a multiple of the warp size so that every warp builds whole words of the null masks.
+ *
+ * @param tasks The columns to select
+ * @param num_tasks The number of tasks
+ * @param boolean_mask The mask choosing the lhs (true) or rhs (false, null) row
+ * @param lhs_rows The lhs row of each output row, or null if it is the output row itself
+ * @param num_rows The number of output rows
+ * @param num_padded_rows The number of output rows rounded up to a multiple of the warp size
+ * @param valid_counts The number of valid rows of each task
+ */
+template <int block_size>
+__global__ void select_rows_kernel(select_task const* tasks,
+                                   size_type num_tasks,
+                                   column_device_view boolean_mask,
+                                   size_type const* lhs_rows,
+                                   size_type num_rows,
+                                   int64_t num_padded_rows,
+                                   size_type* valid_counts)
+{
+  auto row = static_cast<int64_t>(threadIdx.x) + static_cast<int64_t>(blockIdx.x) * block_size;
+  auto const stride = static_cast<int64_t>(block_size) * gridDim.x;
+  for (; row < num_padded_rows; row += stride) {
+    auto const in_bounds  = row < num_rows;
+    auto const target_row = static_cast<size_type>(row);
+    auto const use_lhs =
+      in_bounds && boolean_mask.is_valid(target_row) && boolean_mask.element<bool>(target_row);
+    auto const source_row = (use_lhs && lhs_rows != nullptr) ? lhs_rows[target_row] : target_row;
+
+    // all the lanes of the warp go through the same tasks
+    for (size_type t = 0; t < num_tasks; ++t) {
+      auto const& task = tasks[t];
+      bool valid       = false;
+      if (in_bounds) {
+        auto const mask   = use_lhs ? task.lhs_mask : task.rhs_mask;
+        auto const offset = use_lhs ? task.lhs_mask_offset : task.rhs_mask_offset;
+        copy_element(use_lhs ? task.lhs_data : task.rhs_data,
+                     task.target_data,
+                     task.element_size,
+                     source_row,
+                     target_row);
+        valid = mask == nullptr || bit_is_set(mask, source_row + offset);
+      }
+      if (task.target_mask != nullptr) {
+        auto const word = __ballot_sync(0xFFFF'FFFF, valid);
+        if (threadIdx.x % warp_size == 0 && in_bounds) {
+          task.target_mask[word_index(target_row)] = word;
+          atomicAdd(valid_counts + t, __popc(word));
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Returns whether `select_rows` selects columns of this type.
+ */
+bool is_selected_type(data_type type) { return is_fixed_width(type) && size_of(type) <= 16; }
+
+/**
+ * @brief Selects the rows of the columns of `lhs` or `rhs` by `boolean_mask` in a single kernel.
+ *
+ * @param lhs The columns selected where the mask is true, all of a selected type
+ * @param rhs The columns selected where the mask is false, of the size of the mask
+ * @param nullable Whether each output column has a null mask
+ * @param boolean_mask The mask of type BOOL8, null rows select `rhs`
+ * @param lhs_rows The lhs row of each output row, or null if it is the output row itself
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The output columns
+ */
+std::vector<std::unique_ptr<column>> select_rows(table_view const& lhs,
+                                                 table_view const& rhs,
+                                                 std::vector<bool> const& nullable,
+                                                 column_view const& boolean_mask,
+                                                 size_type const* lhs_rows,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = boolean_mask.size();
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<select_task> tasks;
+  for (size_type c = 0; c < lhs.num_columns(); ++c) {
+    auto const& lhs_col     = lhs.column(c);
+    auto const& rhs_col     = rhs.column(c);
+    auto const element_size = static_cast<size_type>(size_of(lhs_col.type()));
+    columns.push_back(make_fixed_width_column(
+      lhs_col.type(),
+      num_rows,
+      nullable[c] ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+      stream,
+      mr));
+    auto target = columns.back()->mutable_view();
+    tasks.push_back({element_size,
+                     lhs_col.head<uint8_t>() + lhs_col.offset() * element_size,
+                     lhs_col.null_mask(),
+                     lhs_col.offset(),
+                     rhs_col.head<uint8_t>() + rhs_col.offset() * element_size,
+                     rhs_col.null_mask(),
+                     rhs_col.offset(),
+                     target.head(),
+                     target.null_mask()});
+  }
+  if (tasks.empty() || num_rows == 0) { return columns; }
+
+  auto const d_tasks = make_device_uvector_async(tasks, stream);
+  auto const d_mask  = column_device_view::create(boolean_mask, stream);
+  rmm::device_uvector<size_type> valid_counts(tasks.size(), stream);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    valid_counts.data(), 0, valid_counts.size() * sizeof(size_type), stream.value()));
+
+  // the kernel strides over the rows, so the grid need not cover all of them
+  constexpr int block_size   = 256;
+  auto const num_padded_rows = util::round_up_safe<int64_t>(num_rows, warp_size);
+  grid_1d const config(
+    static_cast<size_type>(
+      std::min<int64_t>(num_padded_rows, std::numeric_limits<size_type>::max() - block_size)),
+    block_size);
+  select_rows_kernel<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      d_tasks.data(),
+      static_cast<size_type>(tasks.size()),
+      *d_mask,
+      lhs_rows,
+      num_rows,
+      num_padded_rows,
+      valid_counts.data());
+
+  auto const h_valid_counts = make_std_vector_sync(valid_counts, stream);
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    columns[i]->set_null_count(nullable[i] ? num_rows - h_valid_counts[i] : 0);
+  }
+  return columns;
+}
+
+/**
+ * @brief Returns the indices of the columns of `input` that `select_rows` selects, or that it
+ * does not if `selected` is false.
+ */
+std::vector<size_type> column_indices(table_view const& input, bool selected)
+{
+  std::vector<size_type> indices;
+  for (size_type c = 0; c < input.num_columns(); ++c) {
+    if (is_selected_type(input.column(c).type()) == selected) { indices.push_back(c); }
+  }
+  return indices;
+}
+
+}  // namespace
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(lhs.num_columns() == rhs.num_columns(),
+               "Both tables must have the same number of columns");
+  CUDF_EXPECTS(boolean_mask.size() == lhs.num_rows(),
+               "Boolean mask column must be the same size as lhs and rhs columns");
+  CUDF_EXPECTS(lhs.num_rows() == rhs.num_rows(), "Both columns must be of the size");
+  CUDF_EXPECTS(std::equal(lhs.begin(),
+                          lhs.end(),
+                          rhs.begin(),
+                          [](auto const& l, auto const& r) { return l.type() == r.type(); }),
+               "Both inputs must be of the same type");
+  CUDF_EXPECTS(boolean_mask.type() == data_type(type_id::BOOL8),
+               "Boolean mask column must be of type type_id::BOOL8");
+
+  if (boolean_mask.is_empty()) { return empty_like(lhs); }
+
+  std::vector<std::unique_ptr<column>> columns(lhs.num_columns());
+
+  // the fixed-width columns are selected together
+  auto const selected = column_indices(lhs, true);
+  std::vector<bool> nullable;
+  std::transform(selected.begin(), selected.end(), std::back_inserter(nullable), [&](auto c) {
+    return lhs.column(c).has_nulls() || rhs.column(c).has_nulls();
+  });
+  auto selected_columns = select_rows(lhs.select(selected),
+                                      rhs.select(selected),
+                                      nullable,
+                                      boolean_mask,
+                                      nullptr,
+                                      stream,
+                                      mr);
+  for (std::size_t i = 0; i < selected.size(); ++i) {
+    columns[selected[i]] = std::move(selected_columns[i]);
+  }
+
+  for (auto const c : column_indices(lhs, false)) {
+    columns[c] = detail::copy_if_else(lhs.column(c), rhs.column(c), boolean_mask, stream, mr);
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
+                                            table_view const& target,
+                                            column_view const& boolean_mask,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.num_columns() == target.num_columns(),
+               "Mismatch in number of input columns and target columns");
+  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
+               "Boolean mask size and number of target rows mismatch");
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
+  CUDF_EXPECTS(std::equal(input.begin(),
+                          input.end(),
+                          target.begin(),
+                          [](auto const& in, auto const& tgt) {
+                            return in.type().id() == tgt.type().id();
+                          }),
+               "Type mismatch in input column and target column");
+
+  if (target.num_rows() == 0) { return empty_like(target); }
+
+  // the input row of each target row is the number of true rows of the mask before it
+  auto const num_rows = target.num_rows();
+  auto const d_mask   = column_device_view::create(boolean_mask, stream);
+  auto const is_true  = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [mask = *d_mask] __device__(size_type row) -> size_type {
+      return mask.is_valid(row) && mask.element<bool>(row);
+    });
+  rmm::device_uvector<size_type> input_rows(num_rows + 1, stream);
+  input_rows.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), is_true, is_true + num_rows, input_rows.begin() + 1);
+  auto const num_scattered = input_rows.back_element(stream);
+  CUDF_EXPECTS(num_scattered <= input.num_rows(),
+               "Size of scatter map must be equal to or less than source rows");
+
+  std::vector<std::unique_ptr<column>> columns(target.num_columns());
+
+  // the fixed-width columns are selected together
+  auto const selected = column_indices(target, true);
+  std::vector<bool> nullable;
+  std::transform(selected.begin(), selected.end(), std::back_inserter(nullable), [&](auto c) {
+    return input.column(c).nullable() || target.column(c).nullable();
+  });
+  auto selected_columns = select_rows(input.select(selected),
+                                      target.select(selected),
+                                      nullable,
+                                      boolean_mask,
+                                      input_rows.data(),
+                                      stream,
+                                      mr);
+  for (std::size_t i = 0; i < selected.size(); ++i) {
+    columns[selected[i]] = std::move(selected_columns[i]);
+  }
+
+  // the other columns are scattered together by the target rows of the true rows of the mask
+  auto const others = column_indices(target, false);
+  if (not others.empty()) {
+    rmm::device_uvector<size_type> scatter_map(num_scattered, stream);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    is_true,
+                    scatter_map.begin(),
+                    thrust::identity<size_type>{});
+    auto scattered = detail::scatter(
+      input.select(others), scatter_map, target.select(others), false, stream, mr);
+    auto scattered_columns = scattered->release();
+    for (std::size_t i = 0; i < others.size(); ++i) {
+      columns[others[i]] = std::move(scattered_columns[i]);
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> copy_if_else(table_view const& lhs,
+                                    table_view const& rhs,
+                                    column_view const& boolean_mask,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::copy_if_else(lhs, rhs, boolean_mask, stream, mr);
+}
+
+}  // namespace cudf
@@ -17,19 +17,24 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/structs/detail/concatenate.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -44,6 +49,7 @@
 #include <thrust/transform_scan.h>
 
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <utility>
 
@@ -290,6 +296,201 @@ std::unique_ptr<column> for_each_concatenate(host_span<column_view const> views,
   return col;
 }
 
+/**
+ * @brief A fixed-width column of one of the tables concatenated by `fused_concatenate_tables`.
+ */
+struct fixed_width_input {
+  uint8_t const* data;       ///< The elements of the column, from its offset
+  bitmask_type const* mask;  ///< The null mask of the column, may be null
+  size_type mask_offset;     ///< The offset of the column in its null mask
+};
+
+/**
+ * @brief A fixed-width column produced by `fused_concatenate_tables`.
+ */
+struct fixed_width_output {
+  void* data;              ///< The elements of the column
+  bitmask_type* mask;      ///< The null mask of the column, null if no input has nulls
+  size_type element_size;  ///< The size of an element of the column
+};
+
+/**
+ * @brief Copies a fixed-width element of `element_size` bytes.
+ */
+__device__ void copy_fixed_width_element(uint8_t const* source,
+                                         void* target,
+                                         size_type element_size,
+                                         size_type source_index,
+                                         size_type target_index)
+{
+  switch (element_size) {
+    case 1: static_cast<uint8_t*>(target)[target_index] = source[source_index]; break;
+    case 2:
+      static_cast<uint16_t*>(target)[target_index] =
+        reinterpret_cast<uint16_t const*>(source)[source_index];
+      break;
+    case 4:
+      static_cast<uint32_t*>(target)[target_index] =
+        reinterpret_cast<uint32_t const*>(source)[source_index];
+      break;
+    case 8:
+      static_cast<uint64_t*>(target)[target_index] =
+        reinterpret_cast<uint64_t const*>(source)[source_index];
+      break;
+    case 16:
+      static_cast<__int128_t*>(target)[target_index] =
+        reinterpret_cast<__int128_t const*>(source)[source_index];
+      break;
+    default: CUDF_UNREACHABLE("unsupported element size");
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width columns of many tables and their null masks.
+ *
+ * The rows of each output column are padded to a multiple of the warp size so that every warp
+ * works on a single column and builds whole words of its null mask.
+ *
+ * @param inputs The input columns, by output column then by table
+ * @param input_offsets Prefix sum of the number of rows of the tables
+ * @param num_tables The number of tables
+ * @param outputs The output columns
+ * @param padded_size The number of rows of the output rounded up to the warp size
+ * @param output_size The number of rows of the output
+ * @param num_slots The number of output columns times `padded_size`
+ * @param out_valid_counts The number of valid rows of each output column
+ */
+template <size_type block_size>
+__global__ void fused_concatenate_tables_kernel(fixed_width_input const* inputs,
+                                                size_t const* input_offsets,
+                                                size_type num_tables,
+                                                fixed_width_output const* outputs,
+                                                int64_t padded_size,
+                                                size_type output_size,
+                                                int64_t num_slots,
+                                                size_type* out_valid_counts)
+{
+  auto slot = static_cast<int64_t>(threadIdx.x) + static_cast<int64_t>(blockIdx.x) * block_size;
+  auto const stride = static_cast<int64_t>(block_size) * gridDim.x;
+  for (; slot < num_slots; slot += stride) {
+    auto const column_index = static_cast<size_type>(slot / padded_size);
+    auto const row          = static_cast<size_type>(slot % padded_size);
+    auto const& output      = outputs[column_index];
+
+    bool valid = false;
+    if (row < output_size) {
+      // Lookup input index by searching for output index in offsets
+      size_type const table_index =
+        thrust::upper_bound(thrust::seq, input_offsets, input_offsets + num_tables, row) -
+        input_offsets - 1;
+      auto const& input = inputs[static_cast<int64_t>(column_index) * num_tables + table_index];
+      auto const offset_index = static_cast<size_type>(row - input_offsets[table_index]);
+      copy_fixed_width_element(input.data, output.data, output.element_size, offset_index, row);
+      valid = input.mask == nullptr || bit_is_set(input.mask, offset_index + input.mask_offset);
+    }
+
+    // all the lanes of the warp belong to the same column
+    if (output.mask != nullptr) {
+      bitmask_type const new_word = __ballot_sync(0xFFFF'FFFF, valid);
+      if (threadIdx.x % detail::warp_size == 0 && row < output_size) {
+        output.mask[word_index(row)] = new_word;
+        atomicAdd(out_valid_counts + column_index, __popc(new_word));
+      }
+    }
+  }
+}
+
+/**
+ * @brief Concatenates the fixed-width columns `column_indices` of all the tables with a single
+ * kernel launch.
+ *
+ * The tables must have been checked with `bounds_and_type_check` and have at least one row.
+ *
+ * @return The concatenated columns, in the order of `column_indices`
+ */
+std::vector<std::unique_ptr<column>> fused_concatenate_tables(
+  host_span<table_view const> tables,
+  std::vector<size_type> const& column_indices,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_tables  = tables.size();
+  auto const num_columns = column_indices.size();
+
+  // one prefix sum of the table sizes is shared by all the columns
+  auto input_offsets = std::vector<size_t>(num_tables + 1, 0);
+  std::transform_inclusive_scan(
+    tables.begin(),
+    tables.end(),
+    std::next(input_offsets.begin()),
+    std::plus{},
+    [](table_view const& t) { return static_cast<size_t>(t.num_rows()); });
+  auto const output_size = static_cast<size_type>(input_offsets.back());
+
+  std::vector<fixed_width_input> inputs;
+  inputs.reserve(num_columns * num_tables);
+  std::vector<fixed_width_output> outputs;
+  outputs.reserve(num_columns);
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(num_columns);
+  for (auto const c : column_indices) {
+    auto const type         = tables.front().column(c).type();
+    auto const element_size = static_cast<size_type>(size_of(type));
+    bool const has_nulls    = std::any_of(
+      tables.begin(), tables.end(), [c](auto const& t) { return t.column(c).has_nulls(); });
+    std::transform(tables.begin(), tables.end(), std::back_inserter(inputs), [&](auto const& t) {
+      auto const& col = t.column(c);
+      return fixed_width_input{col.template head<uint8_t>() + col.offset() * element_size,
+                               has_nulls ? col.null_mask() : nullptr,
+                               col.offset()};
+    });
+
+    results.push_back(make_fixed_width_column(
+      type,
+      output_size,
+      has_nulls ? mask_state::UNINITIALIZED : mask_state::UNALLOCATED,
+      stream,
+      mr));
+    results.back()->set_null_count(0);  // prevent null count from being materialized
+    auto out_view = results.back()->mutable_view();
+    outputs.push_back({out_view.head(), out_view.null_mask(), element_size});
+  }
+
+  auto const d_inputs        = make_device_uvector_async(inputs, stream);
+  auto const d_input_offsets = make_device_uvector_async(input_offsets, stream);
+  auto const d_outputs       = make_device_uvector_async(outputs, stream);
+  auto d_valid_counts        = rmm::device_uvector<size_type>(num_columns, stream);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    d_valid_counts.data(), 0, d_valid_counts.size() * sizeof(size_type), stream.value()));
+
+  auto const padded_size = static_cast<int64_t>(
+    util::round_up_safe(static_cast<size_t>(output_size), static_cast<size_t>(warp_size)));
+  auto const num_slots = padded_size * static_cast<int64_t>(num_columns);
+
+  // the kernel strides over the slots, so the grid need not cover all of them
+  constexpr size_type block_size{256};
+  cudf::detail::grid_1d config(
+    static_cast<size_type>(
+      std::min<int64_t>(num_slots, std::numeric_limits<size_type>::max() - block_size)),
+    block_size);
+  fused_concatenate_tables_kernel<block_size>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      d_inputs.data(),
+      d_input_offsets.data(),
+      static_cast<size_type>(num_tables),
+      d_outputs.data(),
+      padded_size,
+      output_size,
+      num_slots,
+      d_valid_counts.data());
+
+  auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    if (outputs[i].mask != nullptr) { results[i]->set_null_count(output_size - valid_counts[i]); }
+  }
+  return results;
+}
+
 struct concatenate_dispatch {
   host_span<column_view const> views;
   rmm::cuda_stream_view stream;
@@ -384,15 +585,15 @@ void traverse_children::operator()<cudf::string_view>(host_span<column_view cons
       return a + (scv.is_empty() ? 0
                   // if the column is unsliced, skip the offset retrieval.
                   : scv.offset() > 0
-                    ? cudf::detail::get_value<offset_type>(
+                    ? cudf::strings::detail::get_offset_value(
                         scv.offsets(), scv.offset() + scv.size(), stream) -
-                        cudf::detail::get_value<offset_type>(scv.offsets(), scv.offset(), stream)
+                        cudf::strings::detail::get_offset_value(scv.offsets(), scv.offset(), stream)
                   // if the offset() is 0, it can still be sliced to a shorter length. in this case
                   // we only need to read a single offset. otherwise just return the full length
                   // (chars_size())
                   : scv.size() + 1 == scv.offsets().size()
                     ? scv.chars_size()
-                    : cudf::detail::get_value<offset_type>(scv.offsets(), scv.size(), stream));
+                    : cudf::strings::detail::get_offset_value(scv.offsets(), scv.size(), stream));
     });
   // note:  output text must include "exceeds size_type range" for python error handling
   CUDF_EXPECTS(total_char_count <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
@@ -509,7 +710,12 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                            }),
                "Mismatch in table columns to concatenate.");
 
-  std::vector<std::unique_ptr<column>> concat_columns;
+  bool const has_rows = std::any_of(tables_to_concat.begin(),
+                                    tables_to_concat.end(),
+                                    [](auto const& t) { return t.num_rows() > 0; });
+
+  std::vector<std::unique_ptr<column>> concat_columns(first_table.num_columns());
+  std::vector<size_type> fused_columns;
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
     std::vector<column_view> cols;
     std::transform(tables_to_concat.begin(),
@@ -519,7 +725,23 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
 
     // verify all types match and that we won't overflow size_type in output size
     bounds_and_type_check(cols, stream);
-    concat_columns.emplace_back(detail::concatenate(cols, stream, mr));
+
+    // the fixed-width columns that would use the fused kernel are all concatenated together
+    bool const has_nulls =
+      std::any_of(cols.begin(), cols.end(), [](auto const& col) { return col.has_nulls(); });
+    if (has_rows && is_fixed_width(cols.front().type()) &&
+        use_fused_kernel_heuristic(has_nulls, cols.size())) {
+      fused_columns.push_back(i);
+    } else {
+      concat_columns[i] = detail::concatenate(cols, stream, mr);
+    }
+  }
+
+  if (not fused_columns.empty()) {
+    auto fused = fused_concatenate_tables(tables_to_concat, fused_columns, stream, mr);
+    for (std::size_t i = 0; i < fused_columns.size(); ++i) {
+      concat_columns[fused_columns[i]] = std::move(fused[i]);
+    }
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
@@ -527,6 +749,7 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
 }  // namespace detail
 
 rmm::device_buffer concatenate_masks(host_span<column_view const> views,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   bool const has_nulls =
@@ -540,28 +763,29 @@ rmm::device_buffer concatenate_masks(host_span<column_view const> views,
     rmm::device_buffer null_mask =
       create_null_mask(total_element_count, mask_state::UNINITIALIZED, mr);
 
-    detail::concatenate_masks(
-      views, static_cast<bitmask_type*>(null_mask.data()), cudf::default_stream_value);
+    detail::concatenate_masks(views, static_cast<bitmask_type*>(null_mask.data()), stream);
 
     return null_mask;
   }
   // no nulls, so return an empty device buffer
-  return rmm::device_buffer{0, cudf::default_stream_value, mr};
+  return rmm::device_buffer{0, stream, mr};
 }
 
 // Concatenates the elements from a vector of column_views
 std::unique_ptr<column> concatenate(host_span<column_view const> columns_to_concat,
+                                    rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::concatenate(columns_to_concat, cudf::default_stream_value, mr);
+  return detail::concatenate(columns_to_concat, stream, mr);
 }
 
 std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
+                                   rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::concatenate(tables_to_concat, cudf::default_stream_value, mr);
+  return detail::concatenate(tables_to_concat, stream, mr);
 }
 
 }  // namespace cudf
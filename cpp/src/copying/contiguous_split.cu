@@ -22,6 +22,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_view.hpp>
@@ -44,8 +45,10 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
+#include <optional>
 
 namespace cudf {
 namespace {
@@ -54,6 +57,12 @@ namespace {
 // start at that alignment.
 static constexpr std::size_t split_align = 64;
 
+// the destination buffers are copied in chunks of at most this many bytes
+static constexpr std::size_t max_copy_chunk_size = 1 * 1024 * 1024;
+
+// block size of the copy kernel
+static constexpr int copy_block_size = 256;
+
 /**
  * @brief Struct which contains information on a source buffer.
  *
@@ -813,18 +822,53 @@ struct num_chunks_func {
   __device__ std::size_t operator()(size_type i) const { return thrust::get<0>(chunks[i]); }
 };
 
-void copy_data(int num_bufs,
-               int num_src_bufs,
-               uint8_t const** d_src_bufs,
-               uint8_t** d_dst_bufs,
-               dst_buf_info* _d_dst_buf_info,
-               rmm::cuda_stream_view stream)
+/**
+ * @brief Functor that maps the index of a chunk of a destination buffer to the index of the
+ * destination buffer.
+ */
+struct chunk_to_buf_index_fn {
+  offset_type const* chunk_offsets;
+  int num_bufs;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>(
+             thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_bufs + 1, i) -
+             chunk_offsets) -
+           1;
+  }
+};
+
+/**
+ * @brief The destination buffers of a contiguous_split subdivided into chunks of work for the
+ * copy kernel.
+ */
+struct copy_chunks {
+  rmm::device_uvector<dst_buf_info> info;          ///< Information on each chunk, in buffer order
+  rmm::device_uvector<offset_type> chunk_offsets;  ///< First chunk of each buffer
+};
+
+/**
+ * @brief Subdivides each destination buffer into chunks of at most `desired_chunk_size` bytes.
+ *
+ * The chunks of each buffer are consecutive and start at increasing `dst_offset`s.
+ *
+ * @param num_bufs Number of destination buffers
+ * @param num_src_bufs Number of source buffers
+ * @param _d_dst_buf_info Information on each destination buffer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Information on the chunks of all the destination buffers
+ */
+copy_chunks make_copy_chunks(int num_bufs,
+                             int num_src_bufs,
+                             dst_buf_info const* _d_dst_buf_info,
+                             rmm::cuda_stream_view stream)
 {
   // Since we parallelize at one block per copy, we are vulnerable to situations where we
   // have small numbers of copies to do (a combination of small numbers of splits and/or columns),
   // so we will take the actual set of outgoing source/destination buffers and further partition
   // them into much smaller chunks in order to drive up the number of blocks and overall occupancy.
-  auto const desired_chunk_size = std::size_t{1 * 1024 * 1024};
+  auto const desired_chunk_size = max_copy_chunk_size;
   rmm::device_uvector<thrust::pair<std::size_t, std::size_t>> chunks(num_bufs, stream);
   thrust::transform(
     rmm::exec_policy(stream),
@@ -862,12 +906,7 @@ void copy_data(int num_bufs,
                          chunk_offsets.begin(),
                          0);
 
-  auto out_to_in_index = [chunk_offsets = chunk_offsets.begin(), num_bufs] __device__(size_type i) {
-    return static_cast<size_type>(
-             thrust::upper_bound(thrust::seq, chunk_offsets, chunk_offsets + num_bufs + 1, i) -
-             chunk_offsets) -
-           1;
-  };
+  auto out_to_in_index = chunk_to_buf_index_fn{chunk_offsets.begin(), num_bufs};
 
   // apply the chunking.
   auto const num_chunks =
@@ -927,91 +966,178 @@ void copy_data(int num_bufs,
       // underneath the final structure of the output
     });
 
-  // perform the copy
-  constexpr size_type block_size = 256;
-  copy_partitions<block_size><<<new_buf_count, block_size, 0, stream.value()>>>(
-    d_src_bufs, d_dst_bufs, d_dst_buf_info.data());
+  return copy_chunks{std::move(d_dst_buf_info), std::move(chunk_offsets)};
+}
 
-  // postprocess valid_counts
+/**
+ * @brief Sums the valid counts of the chunks of each destination buffer.
+ *
+ * @param chunks The chunks of the destination buffers after they have been copied
+ * @param num_bufs Number of destination buffers
+ * @param _d_dst_buf_info Information on each destination buffer, receiving the valid counts
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void reduce_valid_counts(copy_chunks const& chunks,
+                         int num_bufs,
+                         dst_buf_info* _d_dst_buf_info,
+                         rmm::cuda_stream_view stream)
+{
   auto keys = cudf::detail::make_counting_transform_iterator(
-    0, [out_to_in_index] __device__(size_type i) { return out_to_in_index(i); });
+    0, chunk_to_buf_index_fn{chunks.chunk_offsets.begin(), num_bufs});
   auto values = thrust::make_transform_iterator(
-    d_dst_buf_info.begin(), [] __device__(dst_buf_info const& info) { return info.valid_count; });
+    chunks.info.begin(), [] __device__(dst_buf_info const& info) { return info.valid_count; });
   thrust::reduce_by_key(rmm::exec_policy(stream),
                         keys,
-                        keys + new_buf_count,
+                        keys + chunks.info.size(),
                         values,
                         thrust::make_discard_iterator(),
                         dst_valid_count_output_iterator{_d_dst_buf_info});
 }
 
-};  // anonymous namespace
+void copy_data(int num_bufs,
+               int num_src_bufs,
+               uint8_t const** d_src_bufs,
+               uint8_t** d_dst_bufs,
+               dst_buf_info* _d_dst_buf_info,
+               rmm::cuda_stream_view stream)
+{
+  auto const chunks = make_copy_chunks(num_bufs, num_src_bufs, _d_dst_buf_info, stream);
 
-namespace detail {
+  // perform the copy
+  copy_partitions<copy_block_size><<<chunks.info.size(), copy_block_size, 0, stream.value()>>>(
+    d_src_bufs, d_dst_bufs, chunks.info.data());
 
-std::vector<packed_table> contiguous_split(cudf::table_view const& input,
-                                           std::vector<size_type> const& splits,
-                                           rmm::cuda_stream_view stream,
-                                           rmm::mr::device_memory_resource* mr)
-{
-  if (input.num_columns() == 0) { return {}; }
-  if (splits.size() > 0) {
-    CUDF_EXPECTS(splits.back() <= input.column(0).size(),
-                 "splits can't exceed size of input columns");
-  }
+  // postprocess valid_counts
+  reduce_valid_counts(chunks, num_bufs, _d_dst_buf_info, stream);
+}
+
+/**
+ * @brief Computes the information on a destination buffer: the range of its source buffer
+ * that falls in its partition, and its size.
+ */
+struct dst_buf_info_fn {
+  std::size_t num_src_bufs;
+  size_type const* d_indices;
+  src_buf_info const* d_src_buf_info;
+  size_type* d_offset_stack;
+  int offset_stack_partition_size;
+
+  __device__ dst_buf_info operator()(std::size_t t) const
   {
-    size_type begin = 0;
-    for (std::size_t i = 0; i < splits.size(); i++) {
-      size_type end = splits[i];
-      CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
-      CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
-      CUDF_EXPECTS(end <= input.column(0).size(), "Slice range out of bounds.");
-      begin = end;
+    int const split_index   = t / num_src_bufs;
+    int const src_buf_index = t % num_src_bufs;
+    auto const& src_info    = d_src_buf_info[src_buf_index];
+
+    // apply nested offsets (lists and string columns).
+    //
+    // We can't just use the incoming row indices to figure out where to read from in a
+    // nested list situation.  We have to apply offsets every time we cross a boundary
+    // (list or string).  This loop applies those offsets so that our incoming row_index_start
+    // and row_index_end get transformed to our final values.
+    //
+    int const stack_pos = src_info.offset_stack_pos + (split_index * offset_stack_partition_size);
+    size_type* offset_stack  = &d_offset_stack[stack_pos];
+    int parent_offsets_index = src_info.parent_offsets_index;
+    int stack_size           = 0;
+    int root_column_offset   = src_info.column_offset;
+    while (parent_offsets_index >= 0) {
+      offset_stack[stack_size++] = parent_offsets_index;
+      root_column_offset         = d_src_buf_info[parent_offsets_index].column_offset;
+      parent_offsets_index       = d_src_buf_info[parent_offsets_index].parent_offsets_index;
+    }
+    // make sure to include the -column- offset on the root column in our calculation.
+    int row_start = d_indices[split_index] + root_column_offset;
+    int row_end   = d_indices[split_index + 1] + root_column_offset;
+    while (stack_size > 0) {
+      stack_size--;
+      auto const offsets = d_src_buf_info[offset_stack[stack_size]].offsets;
+      // this case can happen when you have empty string or list columns constructed with
+      // empty_like()
+      if (offsets != nullptr) {
+        row_start = offsets[row_start];
+        row_end   = offsets[row_end];
+      }
     }
-  }
-
-  std::size_t const num_partitions   = splits.size() + 1;
-  std::size_t const num_root_columns = input.num_columns();
 
-  // if inputs are empty, just return num_partitions empty tables
-  if (input.column(0).size() == 0) {
-    // sanitize the inputs (to handle corner cases like sliced tables)
-    std::vector<std::unique_ptr<column>> empty_columns;
-    empty_columns.reserve(input.num_columns());
-    std::transform(
-      input.begin(), input.end(), std::back_inserter(empty_columns), [](column_view const& col) {
-        return cudf::empty_like(col);
-      });
-    std::vector<cudf::column_view> empty_column_views;
-    empty_column_views.reserve(input.num_columns());
-    std::transform(empty_columns.begin(),
-                   empty_columns.end(),
-                   std::back_inserter(empty_column_views),
-                   [](std::unique_ptr<column> const& col) { return col->view(); });
-    table_view empty_inputs(empty_column_views);
+    // final element indices and row count
+    int const out_element_index = src_info.is_validity ? row_start / 32 : row_start;
+    int const num_rows          = row_end - row_start;
+    // if I am an offsets column, all my values need to be shifted
+    int const value_shift = src_info.offsets == nullptr ? 0 : src_info.offsets[row_start];
+    // if I am a validity column, we may need to shift bits
+    int const bit_shift = src_info.is_validity ? row_start % 32 : 0;
+    // # of rows isn't necessarily the same as # of elements to be copied.
+    auto const num_elements = [&]() {
+      if (src_info.offsets != nullptr && num_rows > 0) {
+        return num_rows + 1;
+      } else if (src_info.is_validity) {
+        return (num_rows + 31) / 32;
+      }
+      return num_rows;
+    }();
+    int const element_size = cudf::type_dispatcher(data_type{src_info.type}, size_of_helper{});
+    std::size_t const bytes =
+      static_cast<std::size_t>(num_elements) * static_cast<std::size_t>(element_size);
+
+    return dst_buf_info{util::round_up_unsafe(bytes, split_align),
+                        num_elements,
+                        element_size,
+                        num_rows,
+                        out_element_index,
+                        0,
+                        value_shift,
+                        bit_shift,
+                        src_info.is_validity ? 1 : 0,
+                        src_buf_index,
+                        split_index};
+  }
+};
 
-    // build the empty results
-    std::vector<packed_table> result;
-    result.reserve(num_partitions);
-    auto iter = thrust::make_counting_iterator(0);
-    std::transform(iter,
-                   iter + num_partitions,
-                   std::back_inserter(result),
-                   [&empty_inputs](int partition_index) {
-                     return packed_table{
-                       empty_inputs,
-                       packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
-                                        empty_inputs, static_cast<uint8_t const*>(nullptr), 0)),
-                                      std::make_unique<rmm::device_buffer>()}};
-                   });
+/**
+ * @brief The size of each partition of a contiguous_split and the information on each of its
+ * destination buffers, in host and device memory.
+ */
+struct dst_buf_layout {
+  std::size_t buf_sizes_size;     ///< Bytes of the partition sizes, including padding
+  std::size_t dst_buf_info_size;  ///< Bytes of the destination buffer info, including padding
+  std::vector<uint8_t> h_buf_sizes_and_dst_info;  ///< Host copy of the sizes and info
+  rmm::device_buffer d_buf_sizes_and_dst_info;    ///< Device copy of the sizes and info
 
-    return result;
+  [[nodiscard]] std::size_t* h_buf_sizes()
+  {
+    return reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
+  }
+  [[nodiscard]] dst_buf_info* h_dst_buf_info()
+  {
+    return reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
   }
+  [[nodiscard]] dst_buf_info* d_dst_buf_info()
+  {
+    return reinterpret_cast<dst_buf_info*>(
+      static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) + buf_sizes_size);
+  }
+};
 
-  // compute # of source buffers (column data, validity, children), # of partitions
-  // and total # of buffers
-  size_type const num_src_bufs = count_src_bufs(input.begin(), input.end());
-  std::size_t const num_bufs   = num_src_bufs * num_partitions;
+/**
+ * @brief Computes the size of every destination buffer of a contiguous_split and its location
+ * in its partition.
+ *
+ * The sizes of the partitions and the destination buffer info are copied back to the host before
+ * returning.
+ *
+ * @param input The table to split
+ * @param splits The indices where the table is split
+ * @param num_src_bufs The number of source buffers of `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The size of each partition and the information on each destination buffer
+ */
+dst_buf_layout compute_dst_buf_layout(cudf::table_view const& input,
+                                      std::vector<size_type> const& splits,
+                                      size_type num_src_bufs,
+                                      rmm::cuda_stream_view stream)
+{
+  std::size_t const num_partitions = splits.size() + 1;
+  std::size_t const num_bufs       = num_src_bufs * num_partitions;
 
   // packed block of memory 1. split indices and src_buf_info structs
   std::size_t const indices_size =
@@ -1058,96 +1184,25 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
     cudf::util::round_up_safe(num_partitions * sizeof(std::size_t), split_align);
   std::size_t const dst_buf_info_size =
     cudf::util::round_up_safe(num_bufs * sizeof(dst_buf_info), split_align);
-  // host-side
-  std::vector<uint8_t> h_buf_sizes_and_dst_info(buf_sizes_size + dst_buf_info_size);
-  std::size_t* h_buf_sizes = reinterpret_cast<std::size_t*>(h_buf_sizes_and_dst_info.data());
-  dst_buf_info* h_dst_buf_info =
-    reinterpret_cast<dst_buf_info*>(h_buf_sizes_and_dst_info.data() + buf_sizes_size);
-  // device-side
-  rmm::device_buffer d_buf_sizes_and_dst_info(
-    buf_sizes_size + dst_buf_info_size, stream, rmm::mr::get_current_device_resource());
-  std::size_t* d_buf_sizes     = reinterpret_cast<std::size_t*>(d_buf_sizes_and_dst_info.data());
-  dst_buf_info* d_dst_buf_info = reinterpret_cast<dst_buf_info*>(
-    static_cast<uint8_t*>(d_buf_sizes_and_dst_info.data()) + buf_sizes_size);
+  dst_buf_layout layout{buf_sizes_size,
+                        dst_buf_info_size,
+                        std::vector<uint8_t>(buf_sizes_size + dst_buf_info_size),
+                        rmm::device_buffer(buf_sizes_size + dst_buf_info_size,
+                                           stream,
+                                           rmm::mr::get_current_device_resource())};
+  std::size_t* d_buf_sizes = static_cast<std::size_t*>(layout.d_buf_sizes_and_dst_info.data());
+  dst_buf_info* d_dst_buf_info = layout.d_dst_buf_info();
 
   // compute sizes of each column in each partition, including alignment.
-  thrust::transform(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<std::size_t>(0),
-    thrust::make_counting_iterator<std::size_t>(num_bufs),
-    d_dst_buf_info,
-    [num_src_bufs,
-     d_indices,
-     d_src_buf_info,
-     d_offset_stack,
-     offset_stack_partition_size] __device__(std::size_t t) {
-      int const split_index   = t / num_src_bufs;
-      int const src_buf_index = t % num_src_bufs;
-      auto const& src_info    = d_src_buf_info[src_buf_index];
-
-      // apply nested offsets (lists and string columns).
-      //
-      // We can't just use the incoming row indices to figure out where to read from in a
-      // nested list situation.  We have to apply offsets every time we cross a boundary
-      // (list or string).  This loop applies those offsets so that our incoming row_index_start
-      // and row_index_end get transformed to our final values.
-      //
-      int const stack_pos = src_info.offset_stack_pos + (split_index * offset_stack_partition_size);
-      size_type* offset_stack  = &d_offset_stack[stack_pos];
-      int parent_offsets_index = src_info.parent_offsets_index;
-      int stack_size           = 0;
-      int root_column_offset   = src_info.column_offset;
-      while (parent_offsets_index >= 0) {
-        offset_stack[stack_size++] = parent_offsets_index;
-        root_column_offset         = d_src_buf_info[parent_offsets_index].column_offset;
-        parent_offsets_index       = d_src_buf_info[parent_offsets_index].parent_offsets_index;
-      }
-      // make sure to include the -column- offset on the root column in our calculation.
-      int row_start = d_indices[split_index] + root_column_offset;
-      int row_end   = d_indices[split_index + 1] + root_column_offset;
-      while (stack_size > 0) {
-        stack_size--;
-        auto const offsets = d_src_buf_info[offset_stack[stack_size]].offsets;
-        // this case can happen when you have empty string or list columns constructed with
-        // empty_like()
-        if (offsets != nullptr) {
-          row_start = offsets[row_start];
-          row_end   = offsets[row_end];
-        }
-      }
-
-      // final element indices and row count
-      int const out_element_index = src_info.is_validity ? row_start / 32 : row_start;
-      int const num_rows          = row_end - row_start;
-      // if I am an offsets column, all my values need to be shifted
-      int const value_shift = src_info.offsets == nullptr ? 0 : src_info.offsets[row_start];
-      // if I am a validity column, we may need to shift bits
-      int const bit_shift = src_info.is_validity ? row_start % 32 : 0;
-      // # of rows isn't necessarily the same as # of elements to be copied.
-      auto const num_elements = [&]() {
-        if (src_info.offsets != nullptr && num_rows > 0) {
-          return num_rows + 1;
-        } else if (src_info.is_validity) {
-          return (num_rows + 31) / 32;
-        }
-        return num_rows;
-      }();
-      int const element_size = cudf::type_dispatcher(data_type{src_info.type}, size_of_helper{});
-      std::size_t const bytes =
-        static_cast<std::size_t>(num_elements) * static_cast<std::size_t>(element_size);
-
-      return dst_buf_info{util::round_up_unsafe(bytes, split_align),
-                          num_elements,
-                          element_size,
-                          num_rows,
-                          out_element_index,
-                          0,
-                          value_shift,
-                          bit_shift,
-                          src_info.is_validity ? 1 : 0,
-                          src_buf_index,
-                          split_index};
-    });
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<std::size_t>(0),
+                    thrust::make_counting_iterator<std::size_t>(num_bufs),
+                    d_dst_buf_info,
+                    dst_buf_info_fn{static_cast<std::size_t>(num_src_bufs),
+                                    d_indices,
+                                    d_src_buf_info,
+                                    d_offset_stack,
+                                    offset_stack_partition_size});
 
   // compute total size of each partition
   {
@@ -1181,12 +1236,108 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   }
 
   // DtoH buf sizes and col info back to the host
-  CUDF_CUDA_TRY(cudaMemcpyAsync(h_buf_sizes,
+  CUDF_CUDA_TRY(cudaMemcpyAsync(layout.h_buf_sizes(),
                                 d_buf_sizes,
                                 buf_sizes_size + dst_buf_info_size,
                                 cudaMemcpyDeviceToHost,
                                 stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
+
+  return layout;
+}
+
+/**
+ * @brief Returns empty columns of the types of the columns of `input`.
+ *
+ * This sanitizes inputs without rows, handling corner cases like sliced tables.
+ */
+std::vector<std::unique_ptr<column>> make_empty_columns(cudf::table_view const& input)
+{
+  std::vector<std::unique_ptr<column>> empty_columns;
+  empty_columns.reserve(input.num_columns());
+  std::transform(
+    input.begin(), input.end(), std::back_inserter(empty_columns), [](column_view const& col) {
+      return cudf::empty_like(col);
+    });
+  return empty_columns;
+}
+
+/**
+ * @brief Returns views of `columns`.
+ */
+std::vector<column_view> make_column_views(std::vector<std::unique_ptr<column>> const& columns)
+{
+  std::vector<cudf::column_view> views;
+  views.reserve(columns.size());
+  std::transform(columns.begin(),
+                 columns.end(),
+                 std::back_inserter(views),
+                 [](std::unique_ptr<column> const& col) { return col->view(); });
+  return views;
+}
+
+};  // anonymous namespace
+
+namespace detail {
+
+std::vector<packed_table> contiguous_split(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_columns() == 0) { return {}; }
+  if (splits.size() > 0) {
+    CUDF_EXPECTS(splits.back() <= input.column(0).size(),
+                 "splits can't exceed size of input columns");
+  }
+  {
+    size_type begin = 0;
+    for (std::size_t i = 0; i < splits.size(); i++) {
+      size_type end = splits[i];
+      CUDF_EXPECTS(begin >= 0, "Starting index cannot be negative.");
+      CUDF_EXPECTS(end >= begin, "End index cannot be smaller than the starting index.");
+      CUDF_EXPECTS(end <= input.column(0).size(), "Slice range out of bounds.");
+      begin = end;
+    }
+  }
+
+  std::size_t const num_partitions   = splits.size() + 1;
+  std::size_t const num_root_columns = input.num_columns();
+
+  // if inputs are empty, just return num_partitions empty tables
+  if (input.column(0).size() == 0) {
+    // sanitize the inputs (to handle corner cases like sliced tables)
+    auto const empty_columns = make_empty_columns(input);
+    table_view empty_inputs(make_column_views(empty_columns));
+
+    // build the empty results
+    std::vector<packed_table> result;
+    result.reserve(num_partitions);
+    auto iter = thrust::make_counting_iterator(0);
+    std::transform(iter,
+                   iter + num_partitions,
+                   std::back_inserter(result),
+                   [&empty_inputs](int partition_index) {
+                     return packed_table{
+                       empty_inputs,
+                       packed_columns{std::make_unique<packed_columns::metadata>(pack_metadata(
+                                        empty_inputs, static_cast<uint8_t const*>(nullptr), 0)),
+                                      std::make_unique<rmm::device_buffer>()}};
+                   });
+
+    return result;
+  }
+
+  // compute # of source buffers (column data, validity, children), # of partitions
+  // and total # of buffers
+  size_type const num_src_bufs = count_src_bufs(input.begin(), input.end());
+  std::size_t const num_bufs   = num_src_bufs * num_partitions;
+
+  // compute the size and location of each destination buffer
+  auto layout                  = compute_dst_buf_layout(input, splits, num_src_bufs, stream);
+  std::size_t* h_buf_sizes     = layout.h_buf_sizes();
+  dst_buf_info* h_dst_buf_info = layout.h_dst_buf_info();
+  dst_buf_info* d_dst_buf_info = layout.d_dst_buf_info();
 
   // allocate output partition buffers
   std::vector<rmm::device_buffer> out_buffers;
@@ -1209,9 +1360,8 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   uint8_t const** h_src_bufs = reinterpret_cast<uint8_t const**>(h_src_and_dst_buffers.data());
   uint8_t** h_dst_bufs = reinterpret_cast<uint8_t**>(h_src_and_dst_buffers.data() + src_bufs_size);
   // device-side
-  rmm::device_buffer d_src_and_dst_buffers(src_bufs_size + dst_bufs_size + offset_stack_size,
-                                           stream,
-                                           rmm::mr::get_current_device_resource());
+  rmm::device_buffer d_src_and_dst_buffers(
+    src_bufs_size + dst_bufs_size, stream, rmm::mr::get_current_device_resource());
   auto const** d_src_bufs = reinterpret_cast<uint8_t const**>(d_src_and_dst_buffers.data());
   uint8_t** d_dst_bufs    = reinterpret_cast<uint8_t**>(
     reinterpret_cast<uint8_t*>(d_src_and_dst_buffers.data()) + src_bufs_size);
@@ -1232,10 +1382,13 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   copy_data(num_bufs, num_src_bufs, d_src_bufs, d_dst_bufs, d_dst_buf_info, stream);
 
   // DtoH dst info (to retrieve null counts)
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    h_dst_buf_info, d_dst_buf_info, dst_buf_info_size, cudaMemcpyDeviceToHost, stream.value()));
+  CUDF_CUDA_TRY(cudaMemcpyAsync(h_dst_buf_info,
+                                d_dst_buf_info,
+                                layout.dst_buf_info_size,
+                                cudaMemcpyDeviceToHost,
+                                stream.value()));
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   // build the output.
   std::vector<packed_table> result;
@@ -1262,14 +1415,177 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return result;
 }
 
+/**
+ * @brief The state of a `cudf::chunked_pack` between calls to `next()`.
+ *
+ * The layout of the packed table is computed up front exactly as for `pack`, without allocating
+ * the packed buffer. The destination buffers are subdivided into the same chunks of work as the
+ * copy of `contiguous_split`, and each call to `next()` copies the consecutive chunks that fit in
+ * the user buffer.
+ */
+struct chunked_pack_state {
+  chunked_pack_state(cudf::table_view const& input,
+                     std::size_t user_buffer_size,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* temp_mr)
+    : input{input}, user_buffer_size{user_buffer_size}, stream{stream}
+  {
+    CUDF_EXPECTS(user_buffer_size >= max_copy_chunk_size,
+                 "The user buffer size must be at least 1MB");
+
+    if (input.num_columns() == 0) { return; }
+    if (input.num_rows() == 0) {
+      // sanitize the inputs (to handle corner cases like sliced tables)
+      auto const empty_columns = make_empty_columns(input);
+      metadata                 = pack_metadata(
+        table_view(make_column_views(empty_columns)), static_cast<uint8_t const*>(nullptr), 0);
+      return;
+    }
+
+    num_src_bufs = count_src_bufs(input.begin(), input.end());
+    layout.emplace(compute_dst_buf_layout(input, {}, num_src_bufs, stream));
+    total_size = layout->h_buf_sizes()[0];
+
+    // the source buffer pointers followed by the destination pointer of the current chunk
+    std::size_t const src_bufs_size =
+      cudf::util::round_up_safe(num_src_bufs * sizeof(uint8_t*), split_align);
+    std::vector<uint8_t> h_src_and_dst_buffers(src_bufs_size + sizeof(uint8_t*));
+    setup_src_buf_data(
+      input.begin(), input.end(), reinterpret_cast<uint8_t const**>(h_src_and_dst_buffers.data()));
+    d_src_and_dst_buffers = rmm::device_buffer(h_src_and_dst_buffers.data(),
+                                               h_src_and_dst_buffers.size(),
+                                               stream,
+                                               temp_mr);
+    d_src_bufs = static_cast<uint8_t const**>(d_src_and_dst_buffers.data());
+    d_dst_bufs = reinterpret_cast<uint8_t**>(static_cast<uint8_t*>(d_src_and_dst_buffers.data()) +
+                                             src_bufs_size);
+
+    chunks.emplace(make_copy_chunks(num_src_bufs, num_src_bufs, layout->d_dst_buf_info(), stream));
+
+    // the packed offset of each chunk followed by the total size
+    chunk_dst_offsets.resize(chunks->info.size() + 1);
+    rmm::device_uvector<std::size_t> d_chunk_dst_offsets(chunks->info.size(), stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      chunks->info.begin(),
+                      chunks->info.end(),
+                      d_chunk_dst_offsets.begin(),
+                      [] __device__(dst_buf_info const& info) { return info.dst_offset; });
+    CUDF_CUDA_TRY(cudaMemcpyAsync(chunk_dst_offsets.data(),
+                                  d_chunk_dst_offsets.data(),
+                                  d_chunk_dst_offsets.size() * sizeof(std::size_t),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+    cudf::detail::synchronize_stream(stream);
+    chunk_dst_offsets.back() = total_size;
+  }
+
+  [[nodiscard]] bool has_next() const { return current_chunk + 1 < chunk_dst_offsets.size(); }
+
+  std::size_t next(device_span<uint8_t> const& user_buffer)
+  {
+    CUDF_EXPECTS(has_next(), "Cannot call next() on a chunked_pack with no remaining data");
+    CUDF_EXPECTS(user_buffer.size() == user_buffer_size,
+                 "The user buffer must be of the size given on construction");
+
+    // copy the consecutive chunks that fit in the user buffer. chunks are never larger than the
+    // user buffer, including the padding that aligns the next one.
+    auto const offset    = chunk_dst_offsets[current_chunk];
+    auto const end_chunk = static_cast<std::size_t>(
+      std::upper_bound(chunk_dst_offsets.begin() + current_chunk + 1,
+                       chunk_dst_offsets.end(),
+                       offset + user_buffer_size) -
+      chunk_dst_offsets.begin() - 1);
+
+    // chunk destinations are relative to the start of the packed table
+    h_dst_buf = user_buffer.data() - offset;
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      d_dst_bufs, &h_dst_buf, sizeof(uint8_t*), cudaMemcpyHostToDevice, stream.value()));
+
+    auto const num_chunks = end_chunk - current_chunk;
+    copy_partitions<copy_block_size><<<num_chunks, copy_block_size, 0, stream.value()>>>(
+      d_src_bufs, d_dst_bufs, chunks->info.data() + current_chunk);
+
+    current_chunk = end_chunk;
+    return chunk_dst_offsets[end_chunk] - offset;
+  }
+
+  [[nodiscard]] packed_columns::metadata build_metadata()
+  {
+    if (not layout.has_value()) { return metadata; }
+    CUDF_EXPECTS(not has_next(), "The metadata can only be built after all the data is packed");
+
+    // the null counts are only known once the validity buffers have been copied
+    auto const d_dst_buf_info = layout->d_dst_buf_info();
+    reduce_valid_counts(*chunks, num_src_bufs, d_dst_buf_info, stream);
+    auto const h_dst_buf_info = layout->h_dst_buf_info();
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_dst_buf_info,
+                                  d_dst_buf_info,
+                                  num_src_bufs * sizeof(dst_buf_info),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
+    cudf::detail::synchronize_stream(stream);
+
+    // the metadata only records offsets into the packed buffer so any base address will do, as
+    // long as it is not null
+    auto const base_ptr = reinterpret_cast<uint8_t const*>(split_align);
+    std::vector<column_view> cols;
+    cols.reserve(input.num_columns());
+    build_output_columns(
+      input.begin(), input.end(), h_dst_buf_info, std::back_inserter(cols), base_ptr);
+    return pack_metadata(table_view{cols}, base_ptr, total_size);
+  }
+
+  cudf::table_view const input;
+  std::size_t const user_buffer_size;
+  rmm::cuda_stream_view const stream;
+  size_type num_src_bufs{0};
+  std::size_t total_size{0};
+  packed_columns::metadata metadata;
+  std::optional<dst_buf_layout> layout;
+  std::optional<copy_chunks> chunks;
+  rmm::device_buffer d_src_and_dst_buffers;
+  uint8_t const** d_src_bufs{nullptr};
+  uint8_t** d_dst_bufs{nullptr};
+  uint8_t* h_dst_buf{nullptr};
+  std::vector<std::size_t> chunk_dst_offsets;
+  std::size_t current_chunk{0};
+};
+
 };  // namespace detail
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                                            std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
                                            rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::contiguous_split(input, splits, cudf::default_stream_value, mr);
+  return cudf::detail::contiguous_split(input, splits, stream, mr);
+}
+
+chunked_pack::chunked_pack(cudf::table_view const& input,
+                           std::size_t user_buffer_size,
+                           rmm::mr::device_memory_resource* temp_mr)
+  : state{std::make_unique<detail::chunked_pack_state>(
+      input, user_buffer_size, cudf::default_stream_value, temp_mr)}
+{
+}
+
+chunked_pack::~chunked_pack() = default;
+
+std::size_t chunked_pack::get_total_contiguous_size() const { return state->total_size; }
+
+bool chunked_pack::has_next() const { return state->has_next(); }
+
+std::size_t chunked_pack::next(device_span<uint8_t> const& user_buffer)
+{
+  CUDF_FUNC_RANGE();
+  return state->next(user_buffer);
+}
+
+packed_columns::metadata chunked_pack::build_metadata() const
+{
+  CUDF_FUNC_RANGE();
+  return state->build_metadata();
 }
 
 };  // namespace cudf
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Copies a fixed-width element of `element_size` bytes.
+ *
+ * Kernels that copy the rows of several fixed-width columns at once use this instead of
+ * dispatching on the type of each column, since only the size of the elements matters.
+ */
+__device__ inline void copy_element(uint8_t const* source,
+                                    void* target,
+                                    size_type element_size,
+                                    size_type source_row,
+                                    size_type target_row)
+{
+  switch (element_size) {
+    case 1: static_cast<uint8_t*>(target)[target_row] = source[source_row]; break;
+    case 2:
+      static_cast<uint16_t*>(target)[target_row] =
+        reinterpret_cast<uint16_t const*>(source)[source_row];
+      break;
+    case 4:
+      static_cast<uint32_t*>(target)[target_row] =
+        reinterpret_cast<uint32_t const*>(source)[source_row];
+      break;
+    case 8:
+      static_cast<uint64_t*>(target)[target_row] =
+        reinterpret_cast<uint64_t const*>(source)[source_row];
+      break;
+    case 16:
+      static_cast<__int128_t*>(target)[target_row] =
+        reinterpret_cast<__int128_t const*>(source)[source_row];
+      break;
+    default: CUDF_UNREACHABLE("unsupported element size");
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
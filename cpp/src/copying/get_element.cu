@@ -20,6 +20,7 @@
 #include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/is_element_valid.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/small_allocation.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/lists/detail/copying.hpp>
 #include <cudf/lists/lists_column_view.hpp>
@@ -68,8 +69,9 @@ struct get_element_functor {
   {
     auto device_col = column_device_view::create(input, stream);
 
-    rmm::device_scalar<string_view> temp_data(stream, mr);
-    rmm::device_scalar<bool> temp_valid(stream, mr);
+    rmm::device_scalar<string_view> temp_data(stream,
+                                              small_allocation_resource(sizeof(string_view), mr));
+    rmm::device_scalar<bool> temp_valid(stream, small_allocation_resource(sizeof(bool), mr));
 
     device_single_thread(
       [buffer   = temp_data.data(),
@@ -156,8 +158,8 @@ struct get_element_functor {
 
     auto device_col = column_device_view::create(input, stream);
 
-    rmm::device_scalar<Type> temp_data(stream, mr);
-    rmm::device_scalar<bool> temp_valid(stream, mr);
+    rmm::device_scalar<Type> temp_data(stream, small_allocation_resource(sizeof(Type), mr));
+    rmm::device_scalar<bool> temp_valid(stream, small_allocation_resource(sizeof(bool), mr));
 
     device_single_thread(
       [buffer   = temp_data.data(),
@@ -206,9 +208,10 @@ std::unique_ptr<scalar> get_element(column_view const& input,
 
 std::unique_ptr<scalar> get_element(column_view const& input,
                                     size_type index,
+                                    rmm::cuda_stream_view stream,
                                     rmm::mr::device_memory_resource* mr)
 {
-  return detail::get_element(input, index, cudf::default_stream_value, mr);
+  return detail::get_element(input, index, stream, mr);
 }
 
 }  // namespace cudf
@@ -107,30 +107,36 @@ bool may_have_nonempty_nulls(column_view const& input)
 bool has_nonempty_nulls(column_view const& input) { return detail::has_nonempty_nulls(input); }
 
 /**
- * @copydoc cudf::purge_nonempty_nulls(lists_column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::purge_nonempty_nulls(lists_column_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
  */
 std::unique_ptr<cudf::column> purge_nonempty_nulls(lists_column_view const& input,
+                                                   rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
-  return detail::purge_nonempty_nulls(input, cudf::default_stream_value, mr);
+  return detail::purge_nonempty_nulls(input, stream, mr);
 }
 
 /**
- * @copydoc cudf::purge_nonempty_nulls(structs_column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::purge_nonempty_nulls(structs_column_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
  */
 std::unique_ptr<cudf::column> purge_nonempty_nulls(structs_column_view const& input,
+                                                   rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
-  return detail::purge_nonempty_nulls(input, cudf::default_stream_value, mr);
+  return detail::purge_nonempty_nulls(input, stream, mr);
 }
 
 /**
- * @copydoc cudf::purge_nonempty_nulls(strings_column_view const&, rmm::mr::device_memory_resource*)
+ * @copydoc cudf::purge_nonempty_nulls(strings_column_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
  */
 std::unique_ptr<cudf::column> purge_nonempty_nulls(strings_column_view const& input,
+                                                   rmm::cuda_stream_view stream,
                                                    rmm::mr::device_memory_resource* mr)
 {
-  return detail::purge_nonempty_nulls(input, cudf::default_stream_value, mr);
+  return detail::purge_nonempty_nulls(input, stream, mr);
 }
 
 }  // namespace cudf
@@ -54,16 +54,19 @@ std::unique_ptr<column> reverse(column_view const& source_column,
 }
 }  // namespace detail
 
-std::unique_ptr<table> reverse(table_view const& source_table, rmm::mr::device_memory_resource* mr)
+std::unique_ptr<table> reverse(table_view const& source_table,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::reverse(source_table, cudf::default_stream_value, mr);
+  return detail::reverse(source_table, stream, mr);
 }
 
 std::unique_ptr<column> reverse(column_view const& source_column,
+                                rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::reverse(source_column, cudf::default_stream_value, mr);
+  return detail::reverse(source_column, stream, mr);
 }
 }  // namespace cudf
@@ -16,6 +16,10 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -23,16 +27,128 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
-#include <thrust/shuffle.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief The splitmix64 finalizer, which maps consecutive integers to uncorrelated ones.
+ */
+__host__ __device__ inline uint64_t mix64(uint64_t z)
+{
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns the random key of the row at `row_index` of a sample seeded with `seed`.
+ *
+ * The keys are uniformly distributed over all 64-bit integers. Being a hash of the seed and the
+ * row index, every key is computed independently of the others in a single pass over the rows.
+ */
+struct row_key_fn {
+  uint64_t seed_key;
+  int64_t first_row_index;
+
+  __device__ uint64_t operator()(size_type i) const
+  {
+    return mix64(seed_key + static_cast<uint64_t>(first_row_index + i) * 0x9e3779b97f4a7c15ull);
+  }
+};
+
+row_key_fn make_row_key_fn(int64_t seed, int64_t first_row_index)
+{
+  return row_key_fn{mix64(static_cast<uint64_t>(seed)), first_row_index};
+}
+
+/**
+ * @brief Indicates whether the key of a row is at most `bound`.
+ */
+struct key_at_most_fn {
+  row_key_fn row_key;
+  uint64_t bound;
+
+  __device__ bool operator()(size_type i) const { return row_key(i) <= bound; }
+};
+
+/**
+ * @brief Returns a bound on the keys that about `n` plus a few standard deviations of
+ * `num_rows` rows are expected to fall below.
+ */
+uint64_t initial_key_bound(size_type n, size_type num_rows)
+{
+  auto const expected = n + 4 * std::sqrt(static_cast<double>(n)) + 32;
+  if (expected >= num_rows) { return std::numeric_limits<uint64_t>::max(); }
+  return static_cast<uint64_t>(std::ldexp(expected / num_rows, 64));
+}
+
+/**
+ * @brief Returns the indices and keys of the at most `n` rows with the smallest keys, in the
+ * order of their keys.
+ *
+ * Only the rows whose keys are at most `bound`, or than an initial bound letting slightly more
+ * than `n` rows through, are collected and sorted. In the unlikely case that fewer than `n` rows
+ * fall below the initial bound, it is doubled until enough rows do.
+ *
+ * @param num_rows The number of rows
+ * @param row_key Functor computing the key of a row
+ * @param n The maximum number of rows to return
+ * @param bound If given, the largest key of a row to return
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<uint64_t>> smallest_key_rows(
+  size_type num_rows,
+  row_key_fn row_key,
+  size_type n,
+  std::optional<uint64_t> bound,
+  rmm::cuda_stream_view stream)
+{
+  auto constexpr max_key = std::numeric_limits<uint64_t>::max();
+  auto const rows        = thrust::make_counting_iterator<size_type>(0);
+  auto is_below = key_at_most_fn{row_key, bound.value_or(initial_key_bound(n, num_rows))};
+
+  auto count = static_cast<size_type>(
+    thrust::count_if(rmm::exec_policy(stream), rows, rows + num_rows, is_below));
+  while (count < n && not bound.has_value() && is_below.bound != max_key) {
+    is_below.bound = is_below.bound > max_key / 2 ? max_key : is_below.bound * 2 + 1;
+    count          = static_cast<size_type>(
+      thrust::count_if(rmm::exec_policy(stream), rows, rows + num_rows, is_below));
+  }
+
+  rmm::device_uvector<size_type> indices(count, stream);
+  thrust::copy_if(rmm::exec_policy(stream), rows, rows + num_rows, indices.begin(), is_below);
+  rmm::device_uvector<uint64_t> keys(count, stream);
+  thrust::transform(rmm::exec_policy(stream), indices.begin(), indices.end(), keys.begin(), row_key);
+  thrust::sort_by_key(rmm::exec_policy(stream), keys.begin(), keys.end(), indices.begin());
+
+  auto const size = std::min(count, n);
+  indices.resize(size, stream);
+  keys.resize(size, stream);
+  return {std::move(indices), std::move(keys)};
+}
+
+}  // namespace
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
@@ -62,38 +178,132 @@ std::unique_ptr<table> sample(table_view const& input,
 
     return detail::gather(input, begin, begin + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
   } else {
-    auto gather_map =
-      make_numeric_column(data_type{type_id::INT32}, num_rows, mask_state::UNALLOCATED, stream);
-    auto gather_map_mutable_view = gather_map->mutable_view();
-    // Shuffle all the row indices
-    thrust::shuffle_copy(rmm::exec_policy(stream),
-                         thrust::counting_iterator<size_type>(0),
-                         thrust::counting_iterator<size_type>(num_rows),
-                         gather_map_mutable_view.begin<size_type>(),
-                         thrust::default_random_engine(seed));
-
-    auto gather_map_view = (n == num_rows)
-                             ? gather_map->view()
-                             : cudf::detail::slice(gather_map->view(), {0, n}, stream)[0];
+    // The rows with the `n` smallest random keys, rather than the first `n` rows of a shuffle
+    auto const [gather_map, keys] =
+      smallest_key_rows(num_rows, make_row_key_fn(seed, 0), n, std::nullopt, stream);
     return detail::gather(input,
-                          gather_map_view.begin<size_type>(),
-                          gather_map_view.end<size_type>(),
+                          gather_map,
                           out_of_bounds_policy::DONT_CHECK,
+                          negative_index_policy::NOT_ALLOWED,
                           stream,
                           mr);
   }
 }
 
+std::unique_ptr<table> bernoulli_sample(table_view const& input,
+                                        double probability,
+                                        int64_t seed,
+                                        int64_t first_row_index,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(probability >= 0 && probability <= 1, "The probability must be in [0, 1]");
+  if (probability == 0) { return empty_like(input); }
+  if (probability == 1) { return std::make_unique<table>(input, stream, mr); }
+
+  auto const row_key = make_row_key_fn(seed, first_row_index);
+  auto const bound   = static_cast<uint64_t>(std::ldexp(probability, 64));
+  return detail::copy_if(
+    input, [row_key, bound] __device__(size_type i) { return row_key(i) < bound; }, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
                               size_type const n,
                               sample_with_replacement replacement,
                               int64_t const seed,
+                              rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
 
-  return detail::sample(input, n, replacement, seed, cudf::default_stream_value, mr);
+  return detail::sample(input, n, replacement, seed, stream, mr);
+}
+
+std::unique_ptr<table> bernoulli_sample(table_view const& input,
+                                        double probability,
+                                        int64_t seed,
+                                        int64_t first_row_index,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bernoulli_sample(input, probability, seed, first_row_index, stream, mr);
+}
+
+reservoir_sampler::reservoir_sampler(size_type n, int64_t seed, rmm::cuda_stream_view stream)
+  : _n{n}, _seed{seed}, _keys{0, stream}
+{
+  CUDF_EXPECTS(n >= 0, "expected number of samples should be non-negative");
 }
+
+void reservoir_sampler::add(table_view const& batch, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (_reservoir) {
+    CUDF_EXPECTS(std::equal(_reservoir->view().begin(),
+                            _reservoir->view().end(),
+                            batch.begin(),
+                            batch.end(),
+                            [](auto const& lhs, auto const& rhs) { return lhs.type() == rhs.type(); }),
+                 "The batches of a reservoir sampler must have the same columns");
+  } else {
+    _reservoir = empty_like(batch);
+  }
+
+  auto const row_key = detail::make_row_key_fn(_seed, _num_rows_seen);
+  _num_rows_seen += batch.num_rows();
+  // A row only enters a full reservoir if its key is below the largest key of the reservoir
+  if (_n == 0 || batch.num_rows() == 0 || _max_key == uint64_t{0}) { return; }
+  auto const bound = _max_key.has_value() ? std::optional<uint64_t>{*_max_key - 1} : std::nullopt;
+
+  auto [indices, keys] = detail::smallest_key_rows(batch.num_rows(), row_key, _n, bound, stream);
+  if (indices.is_empty()) { return; }
+  auto candidates = detail::gather(batch,
+                                   indices,
+                                   out_of_bounds_policy::DONT_CHECK,
+                                   detail::negative_index_policy::NOT_ALLOWED,
+                                   stream,
+                                   rmm::mr::get_current_device_resource());
+
+  if (_reservoir->num_rows() == 0) {
+    _reservoir = std::move(candidates);
+    _keys      = std::move(keys);
+  } else {
+    // Keep the `n` rows with the smallest keys of the reservoir and the candidates
+    auto const merged = detail::concatenate(std::vector<table_view>{_reservoir->view(), candidates->view()},
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+    rmm::device_uvector<uint64_t> merged_keys(_keys.size() + keys.size(), stream);
+    thrust::copy(rmm::exec_policy(stream), _keys.begin(), _keys.end(), merged_keys.begin());
+    thrust::copy(
+      rmm::exec_policy(stream), keys.begin(), keys.end(), merged_keys.begin() + _keys.size());
+    rmm::device_uvector<size_type> order(merged_keys.size(), stream);
+    thrust::sequence(rmm::exec_policy(stream), order.begin(), order.end());
+    thrust::sort_by_key(
+      rmm::exec_policy(stream), merged_keys.begin(), merged_keys.end(), order.begin());
+
+    auto const size = std::min(merged_keys.size(), static_cast<std::size_t>(_n));
+    _reservoir      = detail::gather(merged->view(),
+                                device_span<size_type const>{order.data(), size},
+                                out_of_bounds_policy::DONT_CHECK,
+                                detail::negative_index_policy::NOT_ALLOWED,
+                                stream,
+                                rmm::mr::get_current_device_resource());
+    merged_keys.resize(size, stream);
+    _keys = std::move(merged_keys);
+  }
+
+  if (_reservoir->num_rows() == _n) { _max_key = _keys.back_element(stream); }
+}
+
+std::unique_ptr<table> reservoir_sampler::sample(rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  if (not _reservoir) { return std::make_unique<table>(); }
+  return std::make_unique<table>(_reservoir->view(), stream, mr);
+}
+
 }  // namespace cudf
@@ -22,7 +22,6 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/scatter.hpp>
-#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/dictionary/detail/search.hpp>
 #include <cudf/lists/list_view.hpp>
@@ -41,7 +40,6 @@
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/scatter.h>
-#include <thrust/sequence.h>
 
 namespace cudf {
 namespace detail {
@@ -386,35 +384,6 @@ std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>>
   return std::make_unique<table>(std::move(result));
 }
 
-std::unique_ptr<column> boolean_mask_scatter(column_view const& input,
-                                             column_view const& target,
-                                             column_view const& boolean_mask,
-                                             rmm::cuda_stream_view stream,
-                                             rmm::mr::device_memory_resource* mr)
-{
-  auto indices = cudf::make_numeric_column(
-    data_type{type_id::INT32}, target.size(), mask_state::UNALLOCATED, stream);
-  auto mutable_indices = indices->mutable_view();
-
-  thrust::sequence(rmm::exec_policy(stream),
-                   mutable_indices.begin<size_type>(),
-                   mutable_indices.end<size_type>(),
-                   0);
-
-  // The scatter map is actually a table with only one column, which is scatter map.
-  auto scatter_map =
-    detail::apply_boolean_mask(table_view{{indices->view()}}, boolean_mask, stream);
-  auto output_table = detail::scatter(table_view{{input}},
-                                      scatter_map->get_column(0).view(),
-                                      table_view{{target}},
-                                      false,
-                                      stream,
-                                      mr);
-
-  // There is only one column in output_table
-  return std::make_unique<column>(std::move(output_table->get_column(0)));
-}
-
 std::unique_ptr<column> boolean_mask_scatter(scalar const& input,
                                              column_view const& target,
                                              column_view const& boolean_mask,
@@ -424,43 +393,6 @@ std::unique_ptr<column> boolean_mask_scatter(scalar const& input,
   return detail::copy_if_else(input, target, boolean_mask, stream, mr);
 }
 
-std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
-                                            table_view const& target,
-                                            column_view const& boolean_mask,
-                                            rmm::cuda_stream_view stream,
-                                            rmm::mr::device_memory_resource* mr)
-{
-  CUDF_EXPECTS(input.num_columns() == target.num_columns(),
-               "Mismatch in number of input columns and target columns");
-  CUDF_EXPECTS(boolean_mask.size() == target.num_rows(),
-               "Boolean mask size and number of target rows mismatch");
-  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be of Boolean type");
-  // Count valid pair of input and columns as per type at each column index i
-  CUDF_EXPECTS(
-    std::all_of(thrust::counting_iterator<size_type>(0),
-                thrust::counting_iterator<size_type>(target.num_columns()),
-                [&input, &target](auto index) {
-                  return ((input.column(index).type().id()) == (target.column(index).type().id()));
-                }),
-    "Type mismatch in input column and target column");
-
-  if (target.num_rows() != 0) {
-    std::vector<std::unique_ptr<column>> out_columns(target.num_columns());
-    std::transform(
-      input.begin(),
-      input.end(),
-      target.begin(),
-      out_columns.begin(),
-      [&boolean_mask, mr, stream](auto const& input_column, auto const& target_column) {
-        return boolean_mask_scatter(input_column, target_column, boolean_mask, stream, mr);
-      });
-
-    return std::make_unique<table>(std::move(out_columns));
-  } else {
-    return empty_like(target);
-  }
-}
-
 std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
@@ -506,39 +438,43 @@ std::unique_ptr<table> scatter(table_view const& source,
                                column_view const& scatter_map,
                                table_view const& target,
                                bool check_bounds,
+                               rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, scatter_map, target, check_bounds, cudf::default_stream_value, mr);
+  return detail::scatter(source, scatter_map, target, check_bounds, stream, mr);
 }
 
 std::unique_ptr<table> scatter(std::vector<std::reference_wrapper<const scalar>> const& source,
                                column_view const& indices,
                                table_view const& target,
                                bool check_bounds,
+                               rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::scatter(source, indices, target, check_bounds, cudf::default_stream_value, mr);
+  return detail::scatter(source, indices, target, check_bounds, stream, mr);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(table_view const& input,
                                             table_view const& target,
                                             column_view const& boolean_mask,
+                                            rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, cudf::default_stream_value, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
 }
 
 std::unique_ptr<table> boolean_mask_scatter(
   std::vector<std::reference_wrapper<const scalar>> const& input,
   table_view const& target,
   column_view const& boolean_mask,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::boolean_mask_scatter(input, target, boolean_mask, cudf::default_stream_value, mr);
+  return detail::boolean_mask_scatter(input, target, boolean_mask, stream, mr);
 }
 
 }  // namespace cudf
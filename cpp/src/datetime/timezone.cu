@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <io/orc/timezone.cuh>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/datetime.hpp>
+#include <cudf/detail/datetime.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+#include <cudf/wrappers/durations.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <thrust/transform.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace cudf {
+namespace datetime {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the transition table of a timezone on the current device, building it on first
+ * use.
+ *
+ * The tables are allocated with `cudaMalloc` rather than from the current device resource and are
+ * never freed, so a cached table outlives any resource the application sets and resets.
+ */
+cudf::io::timezone_table_view get_timezone_table(std::string const& timezone_name,
+                                                 rmm::cuda_stream_view stream)
+{
+  static std::mutex cache_mutex;
+  static std::map<std::pair<int, std::string>, cudf::io::timezone_table const*> cache;
+  static rmm::mr::cuda_memory_resource cuda_mr;
+
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  auto const key = std::pair{device, timezone_name};
+  auto table     = cache.find(key);
+  if (table == cache.end()) {
+    auto const built = new cudf::io::timezone_table(
+      cudf::io::build_timezone_transition_table(timezone_name, stream, &cuda_mr));
+    table = cache.emplace(key, built).first;
+  }
+  return table->second->view();
+}
+
+/**
+ * @brief Offset of the local time from UTC, in seconds, at the UTC time `utc_seconds`.
+ */
+__device__ int64_t utc_offset(cudf::io::timezone_table_view const& table, int64_t utc_seconds)
+{
+  // UTC has an empty table
+  if (table.ttimes.empty()) { return 0; }
+  return cudf::io::get_gmt_offset(table.ttimes, table.offsets, utc_seconds);
+}
+
+template <typename Timestamp>
+struct convert_timezone_fn {
+  cudf::io::timezone_table_view from;
+  cudf::io::timezone_table_view to;
+
+  __device__ Timestamp operator()(Timestamp timestamp) const
+  {
+    auto const local_seconds =
+      cuda::std::chrono::floor<cudf::duration_s>(timestamp.time_since_epoch()).count();
+    // the offset at the local time read as UTC is off by the offset itself near a transition, so
+    // look the offset up again at the UTC time it gives
+    auto const utc_estimate = local_seconds - utc_offset(from, local_seconds);
+    auto const utc_seconds  = local_seconds - utc_offset(from, utc_estimate);
+    auto const shift        = utc_seconds - local_seconds + utc_offset(to, utc_seconds);
+    return Timestamp{timestamp.time_since_epoch() +
+                     cuda::std::chrono::duration_cast<typename Timestamp::duration>(
+                       cudf::duration_s{shift})};
+  }
+};
+
+struct dispatch_convert_timezone {
+  template <typename Timestamp>
+  std::enable_if_t<cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    cudf::column_view const& column,
+    cudf::io::timezone_table_view from,
+    cudf::io::timezone_table_view to,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(not std::is_same_v<Timestamp, cudf::timestamp_D>,
+                 "Timezone conversion needs a timestamp resolution finer than days");
+    auto output = make_fixed_width_column(column.type(),
+                                          column.size(),
+                                          cudf::detail::copy_bitmask(column, stream, mr),
+                                          column.null_count(),
+                                          stream,
+                                          mr);
+
+    thrust::transform(rmm::exec_policy(stream),
+                      column.begin<Timestamp>(),
+                      column.end<Timestamp>(),
+                      output->mutable_view().begin<Timestamp>(),
+                      convert_timezone_fn<Timestamp>{from, to});
+
+    return output;
+  }
+
+  template <typename Timestamp, typename... Args>
+  std::enable_if_t<!cudf::is_timestamp<Timestamp>(), std::unique_ptr<cudf::column>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Must be cudf::timestamp");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> convert_timezone(cudf::column_view const& column,
+                                               std::string const& from_timezone,
+                                               std::string const& to_timezone,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+  if (column.is_empty()) { return make_empty_column(column.type()); }
+
+  return type_dispatcher(column.type(),
+                         dispatch_convert_timezone{},
+                         column,
+                         get_timezone_table(from_timezone, stream),
+                         get_timezone_table(to_timezone, stream),
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> convert_timezone(cudf::column_view const& column,
+                                               std::string const& from_timezone,
+                                               std::string const& to_timezone,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(
+    column, from_timezone, to_timezone, cudf::default_stream_value, mr);
+}
+
+}  // namespace datetime
+}  // namespace cudf
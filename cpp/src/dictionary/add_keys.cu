@@ -14,22 +14,27 @@
  * limitations under the License.
  */
 
-#include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/gather.hpp>
-#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
+#include <cudf/detail/sequence.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
-#include <cudf/detail/unary.hpp>
-#include <cudf/dictionary/detail/encode.hpp>
-#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/update_keys.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -37,6 +42,9 @@ namespace detail {
  * @brief Create a new dictionary column by adding the new keys elements
  * to the existing dictionary_column.
  *
+ * Only the new keys not found in the existing keys are sorted. They are merged with the
+ * existing keys, which are already sorted, and the indices are remapped in a single pass.
+ *
  * ```
  * Example:
  * d1 = {[a, b, c, d, f], {4, 0, 3, 1, 2, 2, 2, 4, 0}}
@@ -44,85 +52,73 @@ namespace detail {
  * d2 is now {[a, b, c, d, e, f], [5, 0, 3, 1, 2, 2, 2, 5, 0]}
  * ```
  */
-std::unique_ptr<column> add_keys(
-  dictionary_column_view const& dictionary_column,
-  column_view const& new_keys,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+std::unique_ptr<column> add_keys(dictionary_column_view const& dictionary_column,
+                                 column_view const& new_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(!new_keys.has_nulls(), "Keys must not have nulls");
   auto old_keys = dictionary_column.keys();  // [a,b,c,d,f]
   CUDF_EXPECTS(new_keys.type() == old_keys.type(), "Keys must be the same type");
-  // first, concatenate the keys together
-  // [a,b,c,d,f] + [d,b,e] = [a,b,c,d,f,d,b,e]
-  auto combined_keys =
-    cudf::detail::concatenate(std::vector<column_view>{old_keys, new_keys}, stream);
 
-  // Drop duplicates from the combined keys, then sort the result.
-  // sort(distinct([a,b,c,d,f,d,b,e])) = [a,b,c,d,e,f]
-  auto table_keys = cudf::detail::distinct(table_view{{combined_keys->view()}},
-                                           std::vector<size_type>{0},  // only one key column
-                                           duplicate_keep_option::KEEP_ANY,
-                                           null_equality::EQUAL,
-                                           nan_equality::ALL_EQUAL,
-                                           stream,
-                                           mr);
+  // first, hash the existing keys to find the new keys not already in the dictionary
+  // contains([a,b,c,d,f],[d,b,e]) = [1,1,0] => [e]
+  auto const found =
+    cudf::detail::contains(old_keys, new_keys, stream, rmm::mr::get_current_device_resource());
+  auto const d_found    = found->view().data<bool>();
+  auto const added_keys = cudf::detail::copy_if(
+    table_view{{new_keys}}, [d_found] __device__(size_type idx) { return !d_found[idx]; }, stream);
+
+  // Drop duplicates from the added keys only, then sort them.
+  auto const distinct_keys = cudf::detail::distinct(added_keys->view(),
+                                                    std::vector<size_type>{0},
+                                                    duplicate_keep_option::KEEP_ANY,
+                                                    null_equality::EQUAL,
+                                                    nan_equality::ALL_EQUAL,
+                                                    stream);
   std::vector<order> column_order{order::ASCENDING};
   std::vector<null_order> null_precedence{null_order::AFTER};  // should be no nulls here
-  auto sorted_keys =
-    cudf::detail::sort(table_keys->view(), column_order, null_precedence, stream, mr)->release();
+  auto const sorted_keys =
+    cudf::detail::sort(distinct_keys->view(), column_order, null_precedence, stream);
+
+  // merge the sorted keys, each tagged with its old position or -1 for the added keys
+  // merge([a,b,c,d,f]+[0,1,2,3,4], [e]+[-1]) = [a,b,c,d,e,f]+[0,1,2,3,-1,4]
+  auto const old_positions   = cudf::detail::sequence(
+    old_keys.size(), numeric_scalar<size_type>(0, true, stream), stream);
+  auto const added_positions = cudf::detail::sequence(sorted_keys->num_rows(),
+                                                      numeric_scalar<size_type>(-1, true, stream),
+                                                      numeric_scalar<size_type>(0, true, stream),
+                                                      stream);
+  auto merged =
+    cudf::detail::merge({table_view{{old_keys, old_positions->view()}},
+                         table_view{{sorted_keys->get_column(0).view(), added_positions->view()}}},
+                        std::vector<size_type>{0},
+                        column_order,
+                        null_precedence,
+                        stream,
+                        mr)
+      ->release();
 
-  std::unique_ptr<column> keys_column(std::move(sorted_keys.front()));
   // create a map for the indices
-  // lower_bound([a,b,c,d,e,f],[a,b,c,d,f]) = [0,1,2,3,5]
-  auto map_indices = cudf::detail::lower_bound(table_view{{keys_column->view()}},
-                                               table_view{{old_keys}},
-                                               column_order,
-                                               null_precedence,
-                                               stream,
-                                               mr);
-  // now create the indices column -- map old values to the new ones
-  // gather([4,0,3,1,2,2,2,4,0],[0,1,2,3,5]) = [5,0,3,1,2,2,2,5,0]
-  column_view indices_view(dictionary_column.indices().type(),
-                           dictionary_column.size(),
-                           dictionary_column.indices().head(),
-                           nullptr,
-                           0,
-                           dictionary_column.offset());
-  // the result may contain nulls if the input contains nulls
-  // and the corresponding index is therefore invalid/undefined
-  auto table_indices = cudf::detail::gather(table_view{{map_indices->view()}},
-                                            indices_view,
-                                            cudf::out_of_bounds_policy::NULLIFY,
-                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                            stream,
-                                            mr)
-                         ->release();
-  // The output of lower_bound is INT32 but we need to convert to unsigned indices.
-  auto const indices_type = get_indices_type_for_size(keys_column->size());
-  auto indices_column     = [&] {
-    column_view gather_result = table_indices.front()->view();
-    auto const indices_size   = gather_result.size();
-    // we can just use the lower-bound/gather data directly for UINT32 case
-    if (indices_type.id() == type_id::UINT32) {
-      auto contents = table_indices.front()->release();
-      return std::make_unique<column>(data_type{type_id::UINT32},
-                                      indices_size,
-                                      std::move(*(contents.data.release())),
-                                      rmm::device_buffer{0, stream, mr},
-                                      0);
-    }
-    // otherwise we need to convert the gather result
-    column_view cast_view(gather_result.type(), indices_size, gather_result.head(), nullptr, 0);
-    return cudf::detail::cast(cast_view, indices_type, stream, mr);
-  }();
+  // scatter([0,1,2,3,4,5],[0,1,2,3,-1,4]) = [0,1,2,3,5]
+  auto const merged_positions = merged[1]->view();
+  rmm::device_uvector<size_type> old_to_new(old_keys.size(), stream);
+  thrust::scatter_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(merged_positions.size()),
+                     merged_positions.begin<size_type>(),
+                     merged_positions.begin<size_type>(),
+                     old_to_new.begin(),
+                     [] __device__(size_type position) { return position >= 0; });
 
-  // create new dictionary column with keys_column and indices_column
+  // now create the indices column -- map old values to the new ones
+  // remap([4,0,3,1,2,2,2,4,0],[0,1,2,3,5]) = [5,0,3,1,2,2,2,5,0]
   // null mask has not changed
-  return make_dictionary_column(std::move(keys_column),
-                                std::move(indices_column),
-                                cudf::detail::copy_bitmask(dictionary_column.parent(), stream, mr),
-                                dictionary_column.null_count());
+  return remap_indices(dictionary_column.get_indices_annotated(),
+                       old_to_new,
+                       std::move(merged.front()),
+                       stream,
+                       mr);
 }
 
 }  // namespace detail
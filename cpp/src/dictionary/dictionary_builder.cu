@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/dictionary/dictionary_builder.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+
+#include <cuco/static_map.cuh>
+
+#include <limits>
+#include <vector>
+
+namespace cudf {
+namespace dictionary {
+namespace detail {
+namespace {
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+
+using nan_equal_comparator =
+  cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+
+using hash_table_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+
+/// Value found for rows whose key is not in the map
+constexpr size_type missing_key = -1;
+
+/**
+ * @brief Hashes the rows of the keys, or of the rows looked up, by their strong index.
+ */
+template <typename Hasher>
+struct strong_index_hasher {
+  strong_index_hasher(Hasher const& hasher) : _hasher{hasher} {}
+
+  template <typename Index>
+  __device__ auto operator()(Index const idx) const noexcept
+  {
+    return _hasher(static_cast<size_type>(idx));
+  }
+
+ private:
+  Hasher const _hasher;
+};
+
+/**
+ * @brief Compares two keys when inserting keys into the map.
+ */
+template <typename Comparator>
+struct keys_comparator {
+  keys_comparator(Comparator const& comparator) : _comparator{comparator} {}
+
+  __device__ bool operator()(lhs_index_type const lhs, lhs_index_type const rhs) const noexcept
+  {
+    return _comparator(static_cast<size_type>(lhs), static_cast<size_type>(rhs));
+  }
+
+ private:
+  Comparator const _comparator;
+};
+
+}  // namespace
+
+/**
+ * @brief Implementation of `cudf::dictionary::dictionary_builder`.
+ *
+ * The map holds the index of every key, hashed and compared through the keys column. Keys are
+ * looked up with the strong `rhs_index_type` index of the row being encoded, so that the two
+ * table comparator knows which row belongs to which table.
+ */
+class dictionary_builder {
+ public:
+  using map_type = cuco::static_map<lhs_index_type,
+                                    size_type,
+                                    cuda::thread_scope_device,
+                                    hash_table_allocator_type>;
+
+  dictionary_builder(data_type keys_type, rmm::cuda_stream_view stream)
+    : _keys{make_empty_column(keys_type)}, _old_to_new{0, stream}
+  {
+    CUDF_EXPECTS(keys_type.id() != type_id::DICTIONARY32,
+                 "Dictionary keys cannot be a dictionary type");
+  }
+
+  std::unique_ptr<column> add(column_view const& input,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(input.type() == _keys->type(), "Keys must be the same type");
+    auto const num_rows = input.size();
+
+    rmm::device_uvector<size_type> indices(num_rows, stream, mr);
+    find_keys(input, indices.data(), stream);
+
+    // Encoding the rows having no key yet adds the distinct ones in the order they first appear
+    // Example: keys=[c,a], input=[b,a,null,d,b] => missing rows=[0,3,4], new keys=[b,d]
+    auto const d_input = column_device_view::create(input, stream);
+    rmm::device_uvector<size_type> missing_rows(num_rows, stream);
+    auto const missing_end = thrust::copy_if(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_rows),
+      missing_rows.begin(),
+      [d_input = *d_input, d_indices = indices.data()] __device__(size_type idx) {
+        return d_input.is_valid(idx) && d_indices[idx] == missing_key;
+      });
+    missing_rows.resize(thrust::distance(missing_rows.begin(), missing_end), stream);
+
+    if (!missing_rows.is_empty()) {
+      auto const missing = cudf::detail::gather(table_view{{input}},
+                                                missing_rows,
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                stream);
+      auto first_rows    = cudf::detail::get_distinct_indices(missing->view(),
+                                                           duplicate_keep_option::KEEP_FIRST,
+                                                           null_equality::EQUAL,
+                                                           nan_equality::ALL_EQUAL,
+                                                           stream);
+      thrust::sort(rmm::exec_policy(stream), first_rows.begin(), first_rows.end());
+      auto const new_keys = cudf::detail::gather(missing->view(),
+                                                 first_rows,
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                                 stream);
+      insert_keys(new_keys->get_column(0).view(), stream);
+      find_keys(input, indices.data(), stream);
+    }
+
+    return std::make_unique<column>(data_type{type_id::UINT32},
+                                    num_rows,
+                                    indices.release(),
+                                    cudf::detail::copy_bitmask(input, stream, mr),
+                                    input.null_count());
+  }
+
+  [[nodiscard]] column_view keys() const { return _keys->view(); }
+
+  std::unique_ptr<column> make_dictionary(column_view const& indices,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+  {
+    CUDF_EXPECTS(indices.type().id() == type_id::UINT32, "Indices must be of type UINT32");
+
+    // Sort the keys only once for as long as no keys are added
+    // Example: keys=[c,a,b] => sorted order=[1,2,0], old_to_new=[2,0,1]
+    if (!_sorted_keys || _sorted_keys->size() != _keys->size()) {
+      auto const keys         = table_view{{_keys->view()}};
+      auto const sorted_order = cudf::detail::sorted_order(
+        keys, {order::ASCENDING}, {null_order::AFTER}, stream);  // should be no nulls here
+      auto sorted_keys = cudf::detail::gather(keys,
+                                              sorted_order->view(),
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              stream)
+                           ->release();
+      _sorted_keys = std::move(sorted_keys.front());
+      _old_to_new.resize(keys.num_rows(), stream);
+      thrust::scatter(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(keys.num_rows()),
+                      sorted_order->view().begin<size_type>(),
+                      _old_to_new.begin());
+    }
+
+    return remap_indices(
+      indices, _old_to_new, std::make_unique<column>(_sorted_keys->view(), stream, mr), stream, mr);
+  }
+
+ private:
+  /**
+   * @brief Writes the index of the key of every row of `input`, or `missing_key`.
+   */
+  void find_keys(column_view const& input, size_type* output, rmm::cuda_stream_view stream) const
+  {
+    if (!_map) {
+      thrust::fill(rmm::exec_policy(stream), output, output + input.size(), missing_key);
+      return;
+    }
+
+    auto const keys      = table_view{{_keys->view()}};
+    auto const rows      = table_view{{input}};
+    auto const has_nulls = nullate::DYNAMIC{input.has_nulls()};
+
+    auto const hasher   = cudf::experimental::row::hash::row_hasher(rows, stream);
+    auto const d_hasher = strong_index_hasher{hasher.device_hasher(has_nulls)};
+    auto const comparator =
+      cudf::experimental::row::equality::two_table_comparator(keys, rows, stream);
+    auto const d_equal =
+      comparator.equal_to(has_nulls, null_equality::EQUAL, nan_equal_comparator{});
+
+    auto const rows_begin = cudf::detail::make_counting_transform_iterator(
+      0, [] __device__(size_type idx) { return rhs_index_type{idx}; });
+    _map->find(rows_begin, rows_begin + input.size(), output, d_hasher, d_equal, stream.value());
+  }
+
+  /**
+   * @brief Appends `new_keys` to the keys and inserts them into the map.
+   *
+   * The map is rebuilt with twice the capacity it needs when it would become too full.
+   */
+  void insert_keys(column_view const& new_keys, rmm::cuda_stream_view stream)
+  {
+    auto first_key = _keys->size();
+
+    // Only the keys are copied, which are usually far fewer than the rows encoded
+    _keys = cudf::detail::concatenate(std::vector<column_view>{_keys->view(), new_keys}, stream);
+
+    auto const num_keys = _keys->size();
+    if (!_map || _map->get_capacity() < compute_hash_table_size(num_keys)) {
+      _map = std::make_unique<map_type>(
+        2 * compute_hash_table_size(num_keys),
+        cuco::sentinel::empty_key{lhs_index_type{std::numeric_limits<size_type>::max()}},
+        cuco::sentinel::empty_value{missing_key},
+        hash_table_allocator_type{default_allocator<char>{}, stream},
+        stream.value());
+      first_key = 0;
+    }
+
+    auto const keys       = table_view{{_keys->view()}};
+    auto const has_nulls  = nullate::DYNAMIC{false};  // keys have no nulls
+    auto const hasher     = cudf::experimental::row::hash::row_hasher(keys, stream);
+    auto const d_hasher   = strong_index_hasher{hasher.device_hasher(has_nulls)};
+    auto const comparator = cudf::experimental::row::equality::self_comparator(keys, stream);
+    auto const d_equal    = keys_comparator{
+      comparator.equal_to(has_nulls, null_equality::EQUAL, nan_equal_comparator{})};
+
+    auto const pairs_begin =
+      cudf::detail::make_counting_transform_iterator(first_key, [] __device__(size_type idx) {
+        return cuco::make_pair(lhs_index_type{idx}, idx);
+      });
+    _map->insert(
+      pairs_begin, pairs_begin + (num_keys - first_key), d_hasher, d_equal, stream.value());
+  }
+
+  std::unique_ptr<column> _keys;               // the keys in the order they were added
+  std::unique_ptr<map_type> _map;              // the index of every key
+  std::unique_ptr<column> _sorted_keys;        // the keys sorted for `make_dictionary`
+  rmm::device_uvector<size_type> _old_to_new;  // the index of every key in `_sorted_keys`
+};
+
+}  // namespace detail
+
+dictionary_builder::~dictionary_builder() = default;
+
+dictionary_builder::dictionary_builder(data_type keys_type, rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl_type>(keys_type, stream)}
+{
+}
+
+std::unique_ptr<column> dictionary_builder::add(column_view const& input,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->add(input, stream, mr);
+}
+
+column_view dictionary_builder::keys() const { return _impl->keys(); }
+
+std::unique_ptr<column> dictionary_builder::make_dictionary(column_view const& indices,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->make_dictionary(indices, stream, mr);
+}
+
+}  // namespace dictionary
+}  // namespace cudf
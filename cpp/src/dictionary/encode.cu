@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -30,6 +31,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <vector>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -73,6 +76,96 @@ std::unique_ptr<column> encode(column_view const& input_column,
                                 input_column.null_count());
 }
 
+namespace {
+
+/**
+ * @brief Returns the INT32 codes of the strings of all the `columns` in a shared dictionary.
+ *
+ * The codes of each column are returned separately with the null mask of that column.
+ */
+std::vector<std::unique_ptr<column>> encode_strings(std::vector<column_view> const& columns,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  // the codes are the positions of the strings in the sorted unique strings of all the columns
+  auto const combined = columns.size() == 1
+                          ? std::unique_ptr<column>{}
+                          : cudf::detail::concatenate(columns, stream);
+  auto const input    = combined ? combined->view() : columns.front();
+  auto const codes    = cudf::detail::encode(cudf::table_view({input}), stream).second;
+
+  std::vector<size_type> splits;
+  size_type offset = 0;
+  for (auto const& col : columns) {
+    splits.push_back(offset);
+    offset += col.size();
+    splits.push_back(offset);
+  }
+  auto const parts = cudf::detail::slice(codes->view(), splits, stream);
+
+  std::vector<std::unique_ptr<column>> results;
+  for (std::size_t idx = 0; idx < columns.size(); ++idx) {
+    auto result = std::make_unique<column>(parts[idx], stream, mr);
+    result->set_null_mask(cudf::detail::copy_bitmask(columns[idx], stream, mr),
+                          columns[idx].null_count());
+    results.emplace_back(std::move(result));
+  }
+  return results;
+}
+
+}  // namespace
+
+/**
+ * @copydoc cudf::dictionary::detail::encode_keys(table_view const&, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<table> encode_keys(table_view const& keys,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> columns;
+  for (auto const& col : keys) {
+    columns.emplace_back(col.type().id() == type_id::STRING
+                           ? std::move(encode_strings({col}, stream, mr).front())
+                           : std::make_unique<column>(col, stream, mr));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @copydoc cudf::dictionary::detail::encode_keys(table_view const&, table_view const&,
+ * rmm::cuda_stream_view, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> encode_keys(
+  table_view const& left,
+  table_view const& right,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left.num_columns() == right.num_columns(),
+               "Mismatch in number of columns of the left and right keys");
+
+  std::vector<std::unique_ptr<column>> left_columns;
+  std::vector<std::unique_ptr<column>> right_columns;
+  for (size_type idx = 0; idx < left.num_columns(); ++idx) {
+    auto const& left_col  = left.column(idx);
+    auto const& right_col = right.column(idx);
+    auto const is_strings = left_col.type().id() == type_id::STRING;
+    CUDF_EXPECTS(is_strings == (right_col.type().id() == type_id::STRING),
+                 "Strings key columns must be paired with strings key columns");
+    if (is_strings) {
+      auto codes = encode_strings({left_col, right_col}, stream, mr);
+      left_columns.emplace_back(std::move(codes.front()));
+      right_columns.emplace_back(std::move(codes.back()));
+    } else {
+      left_columns.emplace_back(std::make_unique<column>(left_col, stream, mr));
+      right_columns.emplace_back(std::make_unique<column>(right_col, stream, mr));
+    }
+  }
+  return std::make_pair(std::make_unique<table>(std::move(left_columns)),
+                        std::make_unique<table>(std::move(right_columns)));
+}
+
 /**
  * @copydoc cudf::dictionary::detail::get_indices_type_for_size
  */
@@ -95,5 +188,18 @@ std::unique_ptr<column> encode(column_view const& input_column,
   return detail::encode(input_column, indices_type, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<table> encode_keys(table_view const& keys, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::encode_keys(keys, cudf::default_stream_value, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<table>> encode_keys(
+  table_view const& left, table_view const& right, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::encode_keys(left, right, cudf::default_stream_value, mr);
+}
+
 }  // namespace dictionary
 }  // namespace cudf
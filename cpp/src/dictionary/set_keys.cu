@@ -24,103 +24,71 @@
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/detail/encode.hpp>
-#include <cudf/dictionary/detail/iterator.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/binary_search.h>
-#include <thrust/distance.h>
-#include <thrust/execution_policy.h>
-#include <thrust/functional.h>
+#include <thrust/extrema.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
 #include <algorithm>
 #include <iterator>
+#include <vector>
 
 namespace cudf {
 namespace dictionary {
 namespace detail {
-namespace {
 
-/**
- * @brief Type-dispatch functor for remapping the old indices to new values based on the new
- * key-set.
- *
- * The dispatch is based on the key type.
- * The output column is the new indices column for the new dictionary column.
- */
-struct dispatch_compute_indices {
-  template <typename Element>
-  std::enable_if_t<cudf::is_relationally_comparable<Element, Element>(), std::unique_ptr<column>>
-  operator()(dictionary_column_view const& input,
-             column_view const& new_keys,
-             rmm::cuda_stream_view stream,
-             rmm::mr::device_memory_resource* mr)
-  {
-    auto dictionary_view = column_device_view::create(input.parent(), stream);
-    auto dictionary_itr  = make_dictionary_iterator<Element>(*dictionary_view);
-    auto new_keys_view   = column_device_view::create(new_keys, stream);
-
-    auto begin = new_keys_view->begin<Element>();
-    auto end   = new_keys_view->end<Element>();
-
-    // create output indices column
-    auto result = make_numeric_column(get_indices_type_for_size(new_keys.size()),
-                                      input.size(),
-                                      mask_state::UNALLOCATED,
-                                      stream,
-                                      mr);
-    auto result_itr =
-      cudf::detail::indexalator_factory::make_output_iterator(result->mutable_view());
-
-#ifdef NDEBUG
-    thrust::lower_bound(rmm::exec_policy(stream),
-                        begin,
-                        end,
-                        dictionary_itr,
-                        dictionary_itr + input.size(),
-                        result_itr,
-                        thrust::less<Element>());
-#else
-    // There is a problem with thrust::lower_bound and the output_indexalator
-    // https://github.com/NVIDIA/thrust/issues/1452; thrust team created nvbug 3322776
-    // This is a workaround.
-    thrust::transform(rmm::exec_policy(stream),
-                      dictionary_itr,
-                      dictionary_itr + input.size(),
-                      result_itr,
-                      [begin, end] __device__(auto key) {
-                        auto itr = thrust::lower_bound(thrust::seq, begin, end, key);
-                        return static_cast<size_type>(thrust::distance(begin, itr));
-                      });
-#endif
-    result->set_null_count(0);
-
-    return result;
-  }
-
-  template <typename Element, typename... Args>
-  std::enable_if_t<!cudf::is_relationally_comparable<Element, Element>(), std::unique_ptr<column>>
-  operator()(Args&&...)
-  {
-    CUDF_FAIL("dictionary set_keys not supported for this column type");
-  }
-};
+std::unique_ptr<column> remap_indices(column_view const& indices,
+                                      device_span<size_type const> old_to_new,
+                                      std::unique_ptr<column>&& keys,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = indices.size();
+  auto new_indices    = make_numeric_column(
+    get_indices_type_for_size(keys->size()), num_rows, mask_state::UNALLOCATED, stream, mr);
+
+  auto const indices_view = column_device_view::create(indices, stream);
+  auto const indices_itr  = cudf::detail::indexalator_factory::make_input_iterator(indices);
+  auto const d_map        = old_to_new.data();
+
+  // the new index of every row, negative for the null rows
+  auto const new_index = [d_indices = *indices_view, indices_itr, d_map] __device__(size_type idx) {
+    return d_indices.is_null(idx) ? size_type{-1} : d_map[indices_itr[idx]];
+  };
+
+  // gather and cast in one pass -- the new null rows get index 0
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    cudf::detail::indexalator_factory::make_output_iterator(new_indices->mutable_view()),
+    [new_index] __device__(size_type idx) { return thrust::max(new_index(idx), size_type{0}); });
+
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [new_index] __device__(size_type idx) { return new_index(idx) >= 0; },
+    stream,
+    mr);
 
-}  // namespace
+  if (null_count == 0) { null_mask = rmm::device_buffer{0, stream, mr}; }
+  return make_dictionary_column(
+    std::move(keys), std::move(new_indices), std::move(null_mask), null_count);
+}
 
-//
-std::unique_ptr<column> set_keys(
-  dictionary_column_view const& dictionary_column,
-  column_view const& new_keys,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+std::unique_ptr<column> set_keys(dictionary_column_view const& dictionary_column,
+                                 column_view const& new_keys,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_EXPECTS(!new_keys.has_nulls(), "keys parameter must not have nulls");
   auto keys = dictionary_column.keys();
@@ -143,36 +111,28 @@ std::unique_ptr<column> set_keys(
                        ->release();
   std::unique_ptr<column> keys_column(std::move(sorted_keys.front()));
 
-  // compute the new nulls
-  auto matches   = cudf::detail::contains(keys_column->view(), keys, stream, mr);
-  auto d_matches = matches->view().data<bool>();
-  auto indices_itr =
-    cudf::detail::indexalator_factory::make_input_iterator(dictionary_column.indices());
-  auto d_null_mask = dictionary_column.null_mask();
-  auto new_nulls   = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset()),
-    thrust::make_counting_iterator<size_type>(dictionary_column.offset() +
-                                              dictionary_column.size()),
-    [d_null_mask, indices_itr, d_matches] __device__(size_type idx) {
-      if (d_null_mask && !bit_is_set(d_null_mask, idx)) return false;
-      return d_matches[indices_itr[idx]];
-    },
-    stream,
-    mr);
-
-  // compute the new indices
-  auto indices_column = type_dispatcher(keys_column->type(),
-                                        dispatch_compute_indices{},
-                                        dictionary_column,
-                                        keys_column->view(),
-                                        stream,
-                                        mr);
-
-  // create column with keys_column and indices_column
-  return make_dictionary_column(std::move(keys_column),
-                                std::move(indices_column),
-                                std::move(new_nulls.first),
-                                new_nulls.second);
+  // map the old keys to their position in the new keys -- searching the keys, not the rows
+  // Example: keys=[a,c,d], new keys=[b,c,d] => matches=[0,1,1], old_to_new=[-1,1,2]
+  auto const matches   = cudf::detail::contains(keys_column->view(), keys, stream, mr);
+  auto const positions = cudf::detail::lower_bound(table_view{{keys_column->view()}},
+                                                   table_view{{keys}},
+                                                   std::vector<order>{order::ASCENDING},
+                                                   std::vector<null_order>{null_order::BEFORE},
+                                                   stream,
+                                                   mr);
+  rmm::device_uvector<size_type> old_to_new(keys.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    matches->view().begin<bool>(),
+                    matches->view().end<bool>(),
+                    positions->view().begin<size_type>(),
+                    old_to_new.begin(),
+                    [] __device__(bool matched, size_type position) {
+                      return matched ? position : size_type{-1};
+                    });
+
+  // keys not in the new keys make their rows null
+  return remap_indices(
+    dictionary_column.get_indices_annotated(), old_to_new, std::move(keys_column), stream, mr);
 }
 
 std::vector<std::unique_ptr<column>> match_dictionaries(
@@ -213,6 +173,8 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
         tables.begin(), tables.end(), std::back_inserter(dict_views), [col_idx](auto& t) {
           return dictionary_column_view(t.column(col_idx));
         });
+      // columns sharing the same keys already match
+      if (have_same_keys(dict_views)) { continue; }
       // now match the keys in these dictionary columns
       auto dict_cols = dictionary::detail::match_dictionaries(dict_views, stream, mr);
       // replace the updated_columns vector entries for the set of columns at col_idx
@@ -236,6 +198,29 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
   return {std::move(dictionary_columns), std::move(updated_tables)};
 }
 
+bool have_same_keys(cudf::host_span<dictionary_column_view const> input)
+{
+  // empty dictionary columns may not have a keys child
+  auto const has_keys = [](auto const& col) { return col.num_children() == 2; };
+  if (input.empty() || !std::all_of(input.begin(), input.end(), has_keys)) { return false; }
+  return std::all_of(input.begin(), input.end(), [first = input.front().keys()](auto const& col) {
+    auto const keys = col.keys();
+    return keys.type() == first.type() && keys.size() == first.size() &&
+           keys.offset() == first.offset() && keys.head() == first.head();
+  });
+}
+
+table_view replace_dictionaries_with_indices(table_view const& input)
+{
+  std::vector<column_view> columns(input.begin(), input.end());
+  std::transform(columns.begin(), columns.end(), columns.begin(), [](auto const& col) {
+    return (col.type().id() == type_id::DICTIONARY32 && col.num_children() == 2)
+             ? dictionary_column_view(col).get_indices_annotated()
+             : col;
+  });
+  return table_view{columns};
+}
+
 }  // namespace detail
 
 // external API
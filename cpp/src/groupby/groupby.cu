@@ -25,6 +25,7 @@
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -58,6 +59,29 @@ groupby::groupby(table_view const& keys,
     _column_order{column_order},
     _null_precedence{null_precedence}
 {
+  // Keys known to be sorted in the order sort groupby would sort them, ascending with the nulls
+  // last, need no sorting
+  if (_keys_are_sorted == sorted::NO and
+      cudf::detail::is_known_sorted(
+        _keys, {}, std::vector<null_order>(_keys.num_columns(), null_order::AFTER))) {
+    _keys_are_sorted = sorted::YES;
+  }
+}
+
+groupby::groupby(table_view const& keys, packed_columns const& plan, null_policy include_null_keys)
+  : _keys{keys},
+    _include_null_keys{include_null_keys},
+    _helper{std::make_unique<detail::sort::sort_groupby_helper>(
+      keys, include_null_keys, cudf::unpack(plan), cudf::default_stream_value)}
+{
+}
+
+packed_columns groupby::export_plan(rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = cudf::default_stream_value;
+  auto const plan   = helper().grouping_plan(stream);
+  return cudf::detail::pack(plan->view(), stream, mr);
 }
 
 // Select hash vs. sort groupby implementation
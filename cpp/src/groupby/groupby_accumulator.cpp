@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+/**
+ * @brief Returns the number of partial state columns accumulated for `agg`
+ *
+ * MEAN is accumulated as a SUM and a COUNT_VALID, M2 as the structs column of (COUNT_VALID,
+ * MEAN, M2) merged by MERGE_M2 and every other aggregation as a single column.
+ */
+std::size_t num_partials(aggregation const& agg)
+{
+  return agg.kind == aggregation::MEAN ? 2 : 1;
+}
+
+/**
+ * @brief Returns the aggregations computing the partial state of `agg` over a single batch
+ */
+std::vector<std::unique_ptr<groupby_aggregation>> make_partial_aggregations(aggregation const& agg)
+{
+  std::vector<std::unique_ptr<groupby_aggregation>> aggs;
+  switch (agg.kind) {
+    case aggregation::SUM: aggs.push_back(make_sum_aggregation<groupby_aggregation>()); break;
+    case aggregation::PRODUCT:
+      aggs.push_back(make_product_aggregation<groupby_aggregation>());
+      break;
+    case aggregation::MIN: aggs.push_back(make_min_aggregation<groupby_aggregation>()); break;
+    case aggregation::MAX: aggs.push_back(make_max_aggregation<groupby_aggregation>()); break;
+    case aggregation::COUNT_VALID:
+      aggs.push_back(make_count_aggregation<groupby_aggregation>(null_policy::EXCLUDE));
+      break;
+    case aggregation::COUNT_ALL:
+      aggs.push_back(make_count_aggregation<groupby_aggregation>(null_policy::INCLUDE));
+      break;
+    case aggregation::MEAN:
+      aggs.push_back(make_sum_aggregation<groupby_aggregation>());
+      aggs.push_back(make_count_aggregation<groupby_aggregation>(null_policy::EXCLUDE));
+      break;
+    case aggregation::M2:
+      aggs.push_back(make_count_aggregation<groupby_aggregation>(null_policy::EXCLUDE));
+      aggs.push_back(make_mean_aggregation<groupby_aggregation>());
+      aggs.push_back(make_m2_aggregation<groupby_aggregation>());
+      break;
+    case aggregation::COLLECT_LIST: {
+      auto const& collect = dynamic_cast<cudf::detail::collect_list_aggregation const&>(agg);
+      aggs.push_back(make_collect_list_aggregation<groupby_aggregation>(collect._null_handling));
+      break;
+    }
+    case aggregation::COLLECT_SET: {
+      auto const& collect = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      aggs.push_back(make_collect_set_aggregation<groupby_aggregation>(
+        collect._null_handling, collect._nulls_equal, collect._nans_equal));
+      break;
+    }
+    default: CUDF_FAIL("Unsupported aggregation in groupby_accumulator");
+  }
+  return aggs;
+}
+
+/**
+ * @brief Returns the aggregation merging the partial states of `agg`
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::PRODUCT: return make_product_aggregation<groupby_aggregation>();
+    case aggregation::MIN: return make_min_aggregation<groupby_aggregation>();
+    case aggregation::MAX: return make_max_aggregation<groupby_aggregation>();
+    case aggregation::M2: return make_merge_m2_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_LIST: return make_merge_lists_aggregation<groupby_aggregation>();
+    case aggregation::COLLECT_SET: {
+      auto const& collect = dynamic_cast<cudf::detail::collect_set_aggregation const&>(agg);
+      return make_merge_sets_aggregation<groupby_aggregation>(collect._nulls_equal,
+                                                              collect._nans_equal);
+    }
+    // SUM, COUNT_VALID, COUNT_ALL and both partials of MEAN
+    default: return make_sum_aggregation<groupby_aggregation>();
+  }
+}
+
+/**
+ * @brief Indicates whether the partial state at `partial_index` of `agg` is a count
+ */
+bool is_count_partial(aggregation const& agg, std::size_t partial_index)
+{
+  return agg.kind == aggregation::COUNT_VALID || agg.kind == aggregation::COUNT_ALL ||
+         (agg.kind == aggregation::MEAN && partial_index == 1);
+}
+
+std::vector<data_type> column_types(table_view const& table)
+{
+  std::vector<data_type> types(table.num_columns());
+  std::transform(
+    table.begin(), table.end(), types.begin(), [](column_view const& col) { return col.type(); });
+  return types;
+}
+
+}  // namespace
+
+groupby_accumulator::groupby_accumulator(std::vector<size_type> key_indices,
+                                         std::vector<accumulation_request>&& requests,
+                                         null_policy include_null_keys)
+  : _key_indices{std::move(key_indices)},
+    _requests{std::move(requests)},
+    _include_null_keys{include_null_keys}
+{
+  // validate the aggregations up front rather than on the first batch
+  for (auto const& request : _requests) {
+    for (auto const& agg : request.aggregations) {
+      make_partial_aggregations(*agg);
+    }
+  }
+}
+
+// Needs to be in source file because column and table are forward declared
+groupby_accumulator::~groupby_accumulator() = default;
+
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>>
+groupby_accumulator::aggregate_batch(table_view const& batch,
+                                     rmm::mr::device_memory_resource* mr) const
+{
+  auto const stream = cudf::default_stream_value;
+
+  std::vector<aggregation_request> requests;
+  for (auto const& request : _requests) {
+    aggregation_request partial_request;
+    partial_request.values = batch.column(request.values_index);
+    for (auto const& agg : request.aggregations) {
+      auto partial_aggs = make_partial_aggregations(*agg);
+      std::move(partial_aggs.begin(),
+                partial_aggs.end(),
+                std::back_inserter(partial_request.aggregations));
+    }
+    requests.push_back(std::move(partial_request));
+  }
+
+  auto [keys, results] =
+    groupby(batch.select(_key_indices), _include_null_keys).aggregate(requests, mr);
+
+  // the COUNT_VALID, MEAN and M2 of each M2 aggregation are packed into its merge input
+  std::vector<std::unique_ptr<column>> partials;
+  for (std::size_t i = 0; i < _requests.size(); ++i) {
+    auto result = results[i].results.begin();
+    for (auto const& agg : _requests[i].aggregations) {
+      if (agg->kind == aggregation::M2) {
+        std::vector<std::unique_ptr<column>> children;
+        std::move(result, result + 3, std::back_inserter(children));
+        partials.push_back(make_structs_column(
+          keys->num_rows(), std::move(children), 0, rmm::device_buffer{}, stream, mr));
+        result += 3;
+      } else {
+        std::move(result, result + num_partials(*agg), std::back_inserter(partials));
+        result += num_partials(*agg);
+      }
+    }
+  }
+  return std::pair(std::move(keys), std::move(partials));
+}
+
+void groupby_accumulator::update(table_view const& batch, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const stream = cudf::default_stream_value;
+
+  std::vector<data_type> values_types;
+  for (auto const& request : _requests) {
+    auto const& values = batch.column(request.values_index);
+    values_types.push_back(is_dictionary(values.type())
+                             ? dictionary_column_view(values).keys().type()
+                             : values.type());
+  }
+  if (_keys) {
+    CUDF_EXPECTS(column_types(batch.select(_key_indices)) == column_types(_keys->view()),
+                 "Mismatch in the types of the keys of the batches");
+    CUDF_EXPECTS(values_types == _values_types,
+                 "Mismatch in the types of the values of the batches");
+  }
+
+  auto [batch_keys, batch_partials] = aggregate_batch(batch, mr);
+  if (not _keys) {
+    _keys         = std::move(batch_keys);
+    _partials     = std::move(batch_partials);
+    _values_types = std::move(values_types);
+    return;
+  }
+
+  // regroup the accumulated and the new partial states by key and merge them
+  std::vector<table_view> const keys_to_concat{_keys->view(), batch_keys->view()};
+  auto const keys = cudf::detail::concatenate(keys_to_concat, stream);
+
+  std::vector<std::unique_ptr<column>> partials;
+  std::vector<aggregation_request> requests;
+  for (std::size_t i = 0; i < _partials.size(); ++i) {
+    std::vector<column_view> const partials_to_concat{_partials[i]->view(),
+                                                      batch_partials[i]->view()};
+    partials.push_back(cudf::detail::concatenate(partials_to_concat, stream));
+  }
+  std::size_t partial = 0;
+  for (auto const& request : _requests) {
+    for (auto const& agg : request.aggregations) {
+      for (std::size_t j = 0; j < num_partials(*agg); ++j, ++partial) {
+        aggregation_request merge_request;
+        merge_request.values = partials[partial]->view();
+        merge_request.aggregations.push_back(make_merge_aggregation(*agg));
+        requests.push_back(std::move(merge_request));
+      }
+    }
+  }
+
+  auto [merged_keys, results] = groupby(keys->view(), _include_null_keys).aggregate(requests, mr);
+
+  // summed counts are widened by SUM and are narrowed back so that they concatenate with the
+  // counts of the next batch
+  partial = 0;
+  for (auto const& request : _requests) {
+    for (auto const& agg : request.aggregations) {
+      for (std::size_t j = 0; j < num_partials(*agg); ++j, ++partial) {
+        auto& merged = results[partial].results.front();
+        if (is_count_partial(*agg, j)) {
+          merged =
+            cudf::detail::cast(merged->view(), data_type{type_to_id<size_type>()}, stream, mr);
+        }
+        _partials[partial] = std::move(merged);
+      }
+    }
+  }
+  _keys = std::move(merged_keys);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby_accumulator::finalize(
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr, "groupby_accumulator has not accumulated any batch");
+  auto const stream = cudf::default_stream_value;
+
+  std::vector<aggregation_result> results(_requests.size());
+  std::size_t partial = 0;
+  for (std::size_t i = 0; i < _requests.size(); ++i) {
+    for (auto const& agg : _requests[i].aggregations) {
+      auto const& state = _partials[partial]->view();
+      if (agg->kind == aggregation::MEAN) {
+        auto const& count = _partials[partial + 1]->view();
+        results[i].results.push_back(cudf::detail::binary_operation(
+          state,
+          count,
+          binary_operator::DIV,
+          cudf::detail::target_type(_values_types[i], aggregation::MEAN),
+          stream,
+          mr));
+      } else if (agg->kind == aggregation::M2) {
+        // the M2 is the last child of the merged (COUNT_VALID, MEAN, M2) state
+        results[i].results.push_back(
+          std::make_unique<column>(structs_column_view{state}.get_sliced_child(2), stream, mr));
+      } else {
+        results[i].results.push_back(std::make_unique<column>(state, stream, mr));
+      }
+      partial += num_partials(*agg);
+    }
+  }
+  return std::pair(std::make_unique<table>(_keys->view(), stream, mr), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
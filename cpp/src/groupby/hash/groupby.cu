@@ -28,12 +28,16 @@
 #include <cudf/detail/binaryop.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/replace.hpp>
+#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -44,15 +48,26 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/traits.cuh>
 #include <cudf/utilities/traits.hpp>
-#include <hash/concurrent_unordered_map.cuh>
+#include <hash/hash_allocator.cuh>
+#include <hash/helper_functions.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/polymorphic_allocator.hpp>
 
 #include <thrust/copy.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
 
+#include <cuco/static_map.cuh>
+
+#include <algorithm>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -65,20 +80,56 @@ namespace detail {
 namespace hash {
 namespace {
 
-// TODO: replace it with `cuco::static_map`
-// https://github.com/rapidsai/cudf/issues/10401
-using map_type = concurrent_unordered_map<
-  cudf::size_type,
-  cudf::size_type,
+using row_hasher_type =
   cudf::experimental::row::hash::device_row_hasher<cudf::detail::default_hash,
-                                                   cudf::nullate::DYNAMIC>,
-  cudf::experimental::row::equality::device_row_comparator<cudf::nullate::DYNAMIC>>;
+                                                   cudf::nullate::DYNAMIC>;
+
+/**
+ * @brief Device functor returning the hash of a key row.
+ *
+ * Hashing a key row with list columns walks all of its nested elements, and every key row is
+ * hashed once to be inserted into the map and once more to find its group. Such keys are hashed
+ * once in a batched pass and their hashes are read from `row_hashes` instead.
+ */
+class key_row_hasher {
+ public:
+  key_row_hasher(row_hasher_type const& hasher, hash_value_type const* row_hashes)
+    : _hasher{hasher}, _row_hashes{row_hashes}
+  {
+  }
+
+  __device__ hash_value_type operator()(size_type i) const noexcept
+  {
+    return _row_hashes != nullptr ? _row_hashes[i] : _hasher(i);
+  }
+
+ private:
+  row_hasher_type _hasher;
+  hash_value_type const* _row_hashes;  ///< Precomputed row hashes, or `nullptr` if there are none
+};
+
+using key_equal_type =
+  cudf::experimental::row::equality::device_row_comparator<cudf::nullate::DYNAMIC>;
+
+/**
+ * @brief Open addressing hash map of the key rows, which maps the index of the first inserted row
+ * of every group to itself.
+ *
+ * The map stores row indices only, and is probed with `key_row_hasher` and `key_equal_type`
+ * hashing and comparing the rows at these indices.
+ */
+using map_allocator_type = rmm::mr::stream_allocator_adaptor<default_allocator<char>>;
+using map_type =
+  cuco::static_map<size_type, size_type, cuda::thread_scope_device, map_allocator_type>;
+
+/// Percentage of the capacity of the hash map occupied if every key row is a distinct group
+constexpr uint32_t hash_map_occupancy = DEFAULT_HASH_TABLE_OCCUPANCY;
 
 /**
  * @brief List of aggregation operations that can be computed with a hash-based
  * implementation.
  */
-constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
+constexpr std::array<aggregation::Kind, 13> hash_aggregations{aggregation::SUM,
                                                               aggregation::PRODUCT,
                                                               aggregation::MIN,
                                                               aggregation::MAX,
@@ -88,12 +139,30 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::ARGMAX,
                                                               aggregation::SUM_OF_SQUARES,
                                                               aggregation::MEAN,
+                                                              aggregation::M2,
                                                               aggregation::STD,
                                                               aggregation::VARIANCE};
 
+/**
+ * @brief List of aggregation operations that can be computed with per-block
+ * partial results in shared memory when there are few groups.
+ */
+constexpr std::array<aggregation::Kind, 7> shared_memory_aggregations{aggregation::SUM,
+                                                                      aggregation::PRODUCT,
+                                                                      aggregation::MIN,
+                                                                      aggregation::MAX,
+                                                                      aggregation::COUNT_VALID,
+                                                                      aggregation::COUNT_ALL,
+                                                                      aggregation::SUM_OF_SQUARES};
+
+// Largest number of groups whose partial results are kept in shared memory. The partial results
+// of one aggregation take at most 24KB of shared memory per block.
+constexpr std::size_t max_shared_memory_groups = 2048;
+constexpr size_type shared_memory_block_size   = 256;
+
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
-// Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
-// ARGMAX, ARGMIN
+// Compound: MEAN(SUM, COUNT_VALID), M2, VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
+// ARGMAX, ARGMIN, MIN/MAX of strings (ARGMIN/ARGMAX)
 
 // TODO replace with std::find in C++20 onwards.
 template <class T, size_t N>
@@ -154,6 +223,17 @@ class groupby_simple_aggregations_collector final
     return aggs;
   }
 
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::m2_aggregation const&) override
+  {
+    std::vector<std::unique_ptr<aggregation>> aggs;
+    aggs.push_back(make_sum_aggregation());
+    // COUNT_VALID
+    aggs.push_back(make_count_aggregation());
+
+    return aggs;
+  }
+
   std::vector<std::unique_ptr<aggregation>> visit(data_type,
                                                   cudf::detail::var_aggregation const&) override
   {
@@ -194,8 +274,7 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
   cudf::detail::result_cache* sparse_results;
   cudf::detail::result_cache* dense_results;
   device_span<size_type const> gather_map;
-  map_type const& map;
-  bitmask_type const* __restrict__ row_bitmask;
+  device_span<size_type const> target_rows;
   rmm::cuda_stream_view stream;
   rmm::mr::device_memory_resource* mr;
 
@@ -206,16 +285,14 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
                               cudf::detail::result_cache* sparse_results,
                               cudf::detail::result_cache* dense_results,
                               device_span<size_type const> gather_map,
-                              map_type const& map,
-                              bitmask_type const* row_bitmask,
+                              device_span<size_type const> target_rows,
                               rmm::cuda_stream_view stream,
                               rmm::mr::device_memory_resource* mr)
     : col(col),
       sparse_results(sparse_results),
       dense_results(dense_results),
       gather_map(gather_map),
-      map(map),
-      row_bitmask(row_bitmask),
+      target_rows(target_rows),
       stream(stream),
       mr(mr)
   {
@@ -310,6 +387,42 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     dense_results->add_result(col, agg, std::move(result));
   }
 
+  void visit(cudf::detail::m2_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto sum_agg   = make_sum_aggregation();
+    auto count_agg = make_count_aggregation();
+    this->visit(*sum_agg);
+    this->visit(*count_agg);
+    column_view sum_result   = sparse_results->get_result(col, *sum_agg);
+    column_view count_result = sparse_results->get_result(col, *count_agg);
+
+    auto values_view = column_device_view::create(col, stream);
+    auto sum_view    = column_device_view::create(sum_result, stream);
+    auto count_view  = column_device_view::create(count_result, stream);
+
+    // the M2 of a group stays null until one of its valid values is accumulated into it
+    auto m2_result = make_fixed_width_column(
+      cudf::detail::target_type(result_type, agg.kind), col.size(), mask_state::ALL_NULL, stream);
+    auto m2_result_view = mutable_column_device_view::create(m2_result->mutable_view(), stream);
+    thrust::fill(rmm::exec_policy(stream),
+                 m2_result->mutable_view().begin<double>(),
+                 m2_result->mutable_view().end<double>(),
+                 0.0);
+
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       col.size(),
+                       ::cudf::detail::m2_hash_functor<>{target_rows.data(),
+                                                         *m2_result_view,
+                                                         *values_view,
+                                                         *sum_view,
+                                                         *count_view});
+    sparse_results->add_result(col, agg, std::move(m2_result));
+    dense_results->add_result(col, agg, to_dense_agg_result(agg));
+  }
+
   void visit(cudf::detail::var_aggregation const& agg) override
   {
     if (dense_results->has_result(col, agg)) return;
@@ -335,8 +448,12 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
       rmm::exec_policy(stream),
       thrust::make_counting_iterator(0),
       col.size(),
-      ::cudf::detail::var_hash_functor<map_type>{
-        map, row_bitmask, *var_result_view, *values_view, *sum_view, *count_view, agg._ddof});
+      ::cudf::detail::var_hash_functor<>{target_rows.data(),
+                                         *var_result_view,
+                                         *values_view,
+                                         *sum_view,
+                                         *count_view,
+                                         agg._ddof});
     sparse_results->add_result(col, agg, std::move(var_result));
     dense_results->add_result(col, agg, to_dense_agg_result(agg));
   }
@@ -393,22 +510,14 @@ flatten_single_pass_aggs(host_span<aggregation_request const> requests)
  *
  * @see groupby_null_templated()
  */
-void sparse_to_dense_results(table_view const& keys,
-                             host_span<aggregation_request const> requests,
+void sparse_to_dense_results(host_span<aggregation_request const> requests,
                              cudf::detail::result_cache* sparse_results,
                              cudf::detail::result_cache* dense_results,
                              device_span<size_type const> gather_map,
-                             map_type const& map,
-                             bool keys_have_nulls,
-                             null_policy include_null_keys,
+                             device_span<size_type const> target_rows,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
-  auto row_bitmask = bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
-  bool skip_key_rows_with_nulls = keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
-  bitmask_type const* row_bitmask_ptr =
-    skip_key_rows_with_nulls ? static_cast<bitmask_type*>(row_bitmask.data()) : nullptr;
-
   for (auto const& request : requests) {
     auto const& agg_v = request.aggregations;
     auto const& col   = request.values;
@@ -416,7 +525,7 @@ void sparse_to_dense_results(table_view const& keys,
     // Given an aggregation, this will get the result from sparse_results and
     // convert and return dense, compacted result
     auto finalizer = hash_compound_agg_finalizer(
-      col, sparse_results, dense_results, gather_map, map, row_bitmask_ptr, stream, mr);
+      col, sparse_results, dense_results, gather_map, target_rows, stream, mr);
     for (auto&& agg : agg_v) {
       agg->finalize(finalizer);
     }
@@ -456,16 +565,181 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+/**
+ * @brief Dispatched functor aggregating a column into the sparse results through per-block
+ * partial results in shared memory.
+ *
+ * @see hash::shared_memory_aggregate
+ */
+struct shared_memory_aggregate_fn {
+  template <typename Source>
+  static constexpr bool is_supported()
+  {
+    return std::is_arithmetic_v<Source> and not std::is_same_v<Source, bool>;
+  }
+
+  template <typename Source, aggregation::Kind k>
+  static void launch(column_view const& source,
+                     mutable_column_view const& target,
+                     size_type const* group_ids,
+                     device_span<size_type const> group_rows,
+                     rmm::cuda_stream_view stream)
+  {
+    using Target                  = cudf::detail::target_type_t<Source, k>;
+    auto const d_source           = column_device_view::create(source, stream);
+    auto const d_target           = mutable_column_device_view::create(target, stream);
+    auto const num_groups         = static_cast<size_type>(group_rows.size());
+    auto const shared_memory_size = num_groups * (sizeof(Target) + sizeof(int));
+
+    // Every block merges all of its partial results, so only launch enough blocks to fill the
+    // device.
+    int device;
+    int num_sms;
+    CUDF_CUDA_TRY(cudaGetDevice(&device));
+    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+    auto const grid_size =
+      std::min(util::div_rounding_up_safe(source.size(), shared_memory_block_size), num_sms * 4);
+
+    hash::shared_memory_aggregate<Source, k>
+      <<<grid_size, shared_memory_block_size, shared_memory_size, stream.value()>>>(
+        *d_source, group_ids, num_groups, group_rows.data(), *d_target);
+  }
+
+  template <typename Source, std::enable_if_t<is_supported<Source>()>* = nullptr>
+  void operator()(column_view const& source,
+                  aggregation::Kind kind,
+                  mutable_column_view const& target,
+                  size_type const* group_ids,
+                  device_span<size_type const> group_rows,
+                  rmm::cuda_stream_view stream) const
+  {
+    switch (kind) {
+      case aggregation::SUM:
+        launch<Source, aggregation::SUM>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::PRODUCT:
+        launch<Source, aggregation::PRODUCT>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::MIN:
+        launch<Source, aggregation::MIN>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::MAX:
+        launch<Source, aggregation::MAX>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::COUNT_VALID:
+        launch<Source, aggregation::COUNT_VALID>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::COUNT_ALL:
+        launch<Source, aggregation::COUNT_ALL>(source, target, group_ids, group_rows, stream);
+        break;
+      case aggregation::SUM_OF_SQUARES:
+        launch<Source, aggregation::SUM_OF_SQUARES>(source, target, group_ids, group_rows, stream);
+        break;
+      default: CUDF_FAIL("Unsupported aggregation for shared memory groupby");
+    }
+  }
+
+  template <typename Source, typename... Args>
+  std::enable_if_t<not is_supported<Source>()> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported type for shared memory groupby");
+  }
+};
+
+/**
+ * @brief Indicates whether the single pass aggregations `aggs` of `values` can be computed in
+ * shared memory when there are few groups.
+ */
+bool can_use_shared_memory_aggs(table_view const& values,
+                                std::vector<aggregation::Kind> const& aggs)
+{
+  return std::all_of(values.begin(),
+                     values.end(),
+                     [](auto const& col) {
+                       return is_numeric(col.type()) and col.type().id() != type_id::BOOL8;
+                     }) and
+         std::all_of(aggs.begin(), aggs.end(), [](auto agg) {
+           return array_contains(shared_memory_aggregations, agg);
+         });
+}
+
+/**
+ * @brief Inserts the key rows into `map` and returns the row of the sparse results holding the
+ * aggregations of the group of every key row, or a negative value for the skipped rows.
+ *
+ * The row of a group is the index of the first of its rows inserted into the map, which is both
+ * the key and the value of its slot. All rows are inserted before they are looked up, both with
+ * the bulk operations of the map, which probe it with cooperative groups.
+ *
+ * @param num_keys The number of key rows
+ * @param map The map to insert into
+ * @param d_key_hash Device functor hashing the key rows
+ * @param d_key_equal Device functor comparing the key rows
+ * @param row_bitmask Bitmask of the key rows to insert, or `nullptr` to insert all of them
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+rmm::device_uvector<size_type> insert_keys(size_type num_keys,
+                                           map_type& map,
+                                           key_row_hasher const& d_key_hash,
+                                           key_equal_type const& d_key_equal,
+                                           bitmask_type const* row_bitmask,
+                                           rmm::cuda_stream_view stream)
+{
+  auto const pairs = cudf::detail::make_counting_transform_iterator(
+    size_type{0}, [] __device__(size_type i) { return cuco::make_pair(i, i); });
+  if (row_bitmask != nullptr) {
+    map.insert_if(
+      pairs,
+      pairs + num_keys,
+      thrust::make_counting_iterator<size_type>(0),
+      [row_bitmask] __device__(size_type i) { return cudf::bit_is_set(row_bitmask, i); },
+      d_key_hash,
+      d_key_equal,
+      stream.value());
+  } else {
+    map.insert(pairs, pairs + num_keys, d_key_hash, d_key_equal, stream.value());
+  }
+
+  // the rows which were not inserted are not found
+  rmm::device_uvector<size_type> target_rows(num_keys, stream);
+  map.find(thrust::make_counting_iterator<size_type>(0),
+           thrust::make_counting_iterator<size_type>(num_keys),
+           target_rows.begin(),
+           d_key_hash,
+           d_key_equal,
+           stream.value());
+  return target_rows;
+}
+
+/**
+ * @brief Computes and returns a device vector containing the row of every group, i.e. the rows
+ * which are their own target row.
+ */
+rmm::device_uvector<size_type> extract_populated_keys(device_span<size_type const> target_rows,
+                                                      rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> populated_keys(target_rows.size(), stream);
+
+  auto const end_it = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator(static_cast<size_type>(target_rows.size())),
+    populated_keys.begin(),
+    [target_rows] __device__(size_type i) { return target_rows[i] == i; });
+
+  populated_keys.resize(std::distance(populated_keys.begin(), end_it), stream);
+
+  return populated_keys;
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
  */
-void compute_single_pass_aggs(table_view const& keys,
-                              host_span<aggregation_request const> requests,
+void compute_single_pass_aggs(host_span<aggregation_request const> requests,
                               cudf::detail::result_cache* sparse_results,
-                              map_type& map,
-                              bool keys_have_nulls,
-                              null_policy include_null_keys,
+                              device_span<size_type const> target_rows,
+                              device_span<size_type const> group_rows,
                               rmm::cuda_stream_view stream)
 {
   // flatten the aggs to a table that can be operated on by aggregate_row
@@ -477,22 +751,45 @@ void compute_single_pass_aggs(table_view const& keys,
   auto d_sparse_table = mutable_table_device_view::create(sparse_table, stream);
   auto d_values       = table_device_view::create(flattened_values, stream);
   auto const d_aggs   = cudf::detail::make_device_uvector_async(agg_kinds, stream);
-  auto const skip_key_rows_with_nulls =
-    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
-
-  auto row_bitmask =
-    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
+  auto const num_rows = static_cast<size_type>(target_rows.size());
 
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn<map_type>{map,
-                                                *d_values,
-                                                *d_sparse_table,
-                                                d_aggs.data(),
-                                                static_cast<bitmask_type*>(row_bitmask.data()),
-                                                skip_key_rows_with_nulls});
+  if (not can_use_shared_memory_aggs(flattened_values, agg_kinds) or
+      group_rows.size() > max_shared_memory_groups) {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      num_rows,
+      hash::aggregate_rows_fn{*d_values, *d_sparse_table, d_aggs.data(), target_rows.data()});
+  } else {
+    // the dense index of every group, at the row of the group
+    rmm::device_uvector<size_type> group_ids(num_rows, stream);
+    thrust::scatter(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator(static_cast<size_type>(group_rows.size())),
+                    group_rows.begin(),
+                    group_ids.begin());
+    // the dense index of the group of every row
+    rmm::device_uvector<size_type> row_group_ids(num_rows, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      target_rows.begin(),
+                      target_rows.end(),
+                      row_group_ids.begin(),
+                      [group_ids = group_ids.data()] __device__(size_type row) {
+                        return row < 0 ? row : group_ids[row];
+                      });
+
+    auto const sparse_view = sparse_table.mutable_view();
+    for (size_type i = 0; i < flattened_values.num_columns(); ++i) {
+      type_dispatcher(flattened_values.column(i).type(),
+                      shared_memory_aggregate_fn{},
+                      flattened_values.column(i),
+                      agg_kinds[i],
+                      sparse_view.column(i),
+                      row_group_ids.data(),
+                      group_rows,
+                      stream);
+    }
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -502,31 +799,6 @@ void compute_single_pass_aggs(table_view const& keys,
   }
 }
 
-/**
- * @brief Computes and returns a device vector containing all populated keys in
- * `map`.
- */
-rmm::device_uvector<size_type> extract_populated_keys(map_type const& map,
-                                                      size_type num_keys,
-                                                      rmm::cuda_stream_view stream)
-{
-  rmm::device_uvector<size_type> populated_keys(num_keys, stream);
-
-  auto get_key    = [] __device__(auto const& element) { return element.first; };  // first = key
-  auto get_key_it = thrust::make_transform_iterator(map.data(), get_key);
-  auto key_used   = [unused = map.get_unused_key()] __device__(auto key) { return key != unused; };
-
-  auto end_it = thrust::copy_if(rmm::exec_policy(stream),
-                                get_key_it,
-                                get_key_it + map.capacity(),
-                                populated_keys.begin(),
-                                key_used);
-
-  populated_keys.resize(std::distance(populated_keys.begin(), end_it), stream);
-
-  return populated_keys;
-}
-
 /**
  * @brief Computes groupby using hash table.
  *
@@ -547,8 +819,8 @@ rmm::device_uvector<size_type> extract_populated_keys(map_type const& map,
  * first, in a combined kernel. Then using these results, aggregations that
  * require multiple passes, will be computed.
  *
- * Finally, using the hash map, we generate a vector of indices of populated
- * values in sparse result columns. Then, for each aggregation originally
+ * Finally, from the rows found in the hash map for every key row, we generate a
+ * vector of indices of populated values in sparse result columns. Then, for each aggregation originally
  * requested in `requests`, we gather sparse results into a column of dense
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
@@ -565,48 +837,66 @@ std::unique_ptr<table> groupby(table_view const& keys,
   auto const null_keys_are_equal = null_equality::EQUAL;
   auto const has_null            = nullate::DYNAMIC{cudf::has_nested_nulls(keys)};
 
-  auto preprocessed_keys = cudf::experimental::row::hash::preprocessed_table::create(keys, stream);
+  // dictionary keys are sorted and unique so the rows can be hashed and compared by the indices
+  auto const indexed_keys = cudf::dictionary::detail::replace_dictionaries_with_indices(keys);
+  // struct keys are hashed and compared through their validity and fields flattened into flat
+  // columns, with the parent nulls pushed down, instead of recursing into the struct children for
+  // every row; the flattened table must outlive the hash map
+  auto const has_list_keys =
+    std::any_of(indexed_keys.begin(), indexed_keys.end(), structs::detail::is_or_has_nested_lists);
+  auto const flattened_keys =
+    has_list_keys ? structs::detail::flattened_table{indexed_keys, {}, {}, {}, {}}
+                  : structs::detail::flatten_nested_columns(indexed_keys, {}, {});
+  auto preprocessed_keys = cudf::experimental::row::hash::preprocessed_table::create(
+    flattened_keys.flattened_columns(), stream);
   auto const comparator  = cudf::experimental::row::equality::self_comparator{preprocessed_keys};
   auto const row_hash    = cudf::experimental::row::hash::row_hasher{std::move(preprocessed_keys)};
   auto const d_key_equal = comparator.equal_to(has_null, null_keys_are_equal);
   auto const d_row_hash  = row_hash.device_hasher(has_null);
 
+  // rows with list columns are hashed once up front, see `key_row_hasher`
+  auto row_hashes = rmm::device_uvector<hash_value_type>(has_list_keys ? num_keys : 0, stream);
+  if (has_list_keys) {
+    thrust::tabulate(rmm::exec_policy(stream), row_hashes.begin(), row_hashes.end(), d_row_hash);
+  }
+  auto const d_key_hash = key_row_hasher{d_row_hash, has_list_keys ? row_hashes.data() : nullptr};
+
   size_type constexpr unused_key{std::numeric_limits<size_type>::max()};
-  size_type constexpr unused_value{std::numeric_limits<size_type>::max()};
+  size_type constexpr unused_value{-1};
 
-  using allocator_type = typename map_type::allocator_type;
+  auto map = map_type{compute_hash_table_size(num_keys, hash_map_occupancy),
+                      cuco::sentinel::empty_key{unused_key},
+                      cuco::sentinel::empty_value{unused_value},
+                      map_allocator_type{default_allocator<char>{}, stream},
+                      stream.value()};
 
-  auto map = map_type::create(compute_hash_table_size(num_keys),
-                              stream,
-                              unused_key,
-                              unused_value,
-                              d_row_hash,
-                              d_key_equal,
-                              allocator_type());
+  auto const skip_key_rows_with_nulls =
+    keys_have_nulls and include_null_keys == null_policy::EXCLUDE;
+  auto const row_bitmask =
+    skip_key_rows_with_nulls ? cudf::detail::bitmask_and(keys, stream).first : rmm::device_buffer{};
+
+  auto const target_rows =
+    insert_keys(num_keys,
+                map,
+                d_key_hash,
+                d_key_equal,
+                skip_key_rows_with_nulls ? static_cast<bitmask_type const*>(row_bitmask.data())
+                                         : nullptr,
+                stream);
+
+  // Extract the row of every group and create a gather map.
+  // Gathering using this map from sparse results will give dense results.
+  auto const gather_map = extract_populated_keys(target_rows, stream);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash map
   cudf::detail::result_cache sparse_results(requests.size());
 
   // Compute all single pass aggs first
-  compute_single_pass_aggs(
-    keys, requests, &sparse_results, *map, keys_have_nulls, include_null_keys, stream);
-
-  // Extract the populated indices from the hash map and create a gather map.
-  // Gathering using this map from sparse results will give dense results.
-  auto gather_map = extract_populated_keys(*map, keys.num_rows(), stream);
+  compute_single_pass_aggs(requests, &sparse_results, target_rows, gather_map, stream);
 
   // Compact all results from sparse_results and insert into cache
-  sparse_to_dense_results(keys,
-                          requests,
-                          &sparse_results,
-                          cache,
-                          gather_map,
-                          *map,
-                          keys_have_nulls,
-                          include_null_keys,
-                          stream,
-                          mr);
+  sparse_to_dense_results(requests, &sparse_results, cache, gather_map, target_rows, stream, mr);
 
   return cudf::detail::gather(keys,
                               gather_map,
@@ -637,10 +927,25 @@ bool can_use_hash_groupby(host_span<aggregation_request const> requests)
                           ? cudf::dictionary_column_view(r.values).keys().type()
                           : r.values.type();
 
+    // MIN/MAX of strings are gathered from the rows found by ARGMIN/ARGMAX, which don't need
+    // atomics on the strings themselves.
+    auto const is_string_minmax = [&r](auto const& a) {
+      return r.values.type().id() == type_id::STRING and
+             (a->kind == aggregation::MIN or a->kind == aggregation::MAX);
+    };
+
+    // Decimal128 sums, including the one of MEAN, are added up in two 64-bit atomic words
+    auto const is_decimal128_sum = [&v_type](auto const& a) {
+      return v_type.id() == type_id::DECIMAL128 and
+             (a->kind == aggregation::SUM or a->kind == aggregation::MEAN);
+    };
+
     return not(r.values.type().id() == type_id::STRUCT) and
-           std::all_of(r.aggregations.begin(), r.aggregations.end(), [v_type](auto const& a) {
-             return cudf::has_atomic_support(cudf::detail::target_type(v_type, a->kind)) and
-                    is_hash_aggregation(a->kind);
+           std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+             return (is_string_minmax(a) or is_decimal128_sum(a) or
+                     cudf::has_atomic_support(cudf::detail::target_type(v_type, a->kind))) and
+                    is_hash_aggregation(a->kind) and
+                    (a->kind != aggregation::M2 or cudf::is_numeric(v_type));
            });
   });
 }
@@ -19,6 +19,7 @@
 #include "multi_pass_kernels.cuh"
 #include <cudf/detail/aggregation/aggregation.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/groupby.hpp>
 #include <cudf/utilities/bit.hpp>
 
@@ -29,89 +30,107 @@ namespace groupby {
 namespace detail {
 namespace hash {
 /**
- * @brief Compute single-pass aggregations and store results into a sparse
- * `output_values` table, and populate `map` with indices of unique keys
+ * @brief Aggregates every row of `input_values` into the row of the sparse `output_values` of its
+ * group
  *
- * The hash map is built by inserting every row `i` from the `keys` and
- * `values` tables as a single (key,value) pair. When the pair is inserted, if
- * the key was not already present in the map, then the corresponding value is
- * simply copied to the output. If the key was already present in the map,
- * then the inserted `values` row is aggregated with the existing row. This
- * aggregation is done for every element `j` in the row by applying aggregation
- * operation `j` between the new and existing element.
- *
- * Instead of storing the entire rows from `input_keys` and `input_values` in
- * the hashmap, we instead store the row indices. For example, when inserting
- * row at index `i` from `input_keys` into the hash map, the value `i` is what
- * gets stored for the hash map's "key". It is assumed the `map` was constructed
- * with a custom comparator that uses these row indices to check for equality
- * between key rows. For example, comparing two keys `k0` and `k1` will compare
- * the two rows `input_keys[k0] ?= input_keys[k1]`
- *
- * Likewise, we store the row indices for the hash maps "values". These indices
- * index into the `output_values` table. For a given key `k` (which is an index
- * into `input_keys`), the corresponding value `v` indexes into `output_values`
- * and stores the result of aggregating rows from `input_values` from rows of
- * `input_keys` equivalent to the row at `k`.
- *
- * The exact size of the result is not known a priori, but can be upper bounded
- * by the number of rows in `input_keys` & `input_values`. Therefore, it is
- * assumed `output_values` has sufficient storage for an equivalent number of
- * rows. In this way, after all rows are aggregated, `output_values` will likely
- * be "sparse", meaning that not all rows contain the result of an aggregation.
- *
- * @tparam Map The type of the hash map
+ * The exact number of groups is not known a priori, but is bounded by the number of rows.
+ * `output_values` has as many rows as `input_values`, of which only the rows of the groups hold
+ * aggregations. `target_rows` holds the row of the group of every input row, which is the index of
+ * the first row of the group inserted into the hash map, or a negative value for skipped rows.
  */
-template <typename Map>
-struct compute_single_pass_aggs_fn {
-  Map map;
+struct aggregate_rows_fn {
   table_device_view input_values;
   mutable_table_device_view output_values;
   aggregation::Kind const* __restrict__ aggs;
-  bitmask_type const* __restrict__ row_bitmask;
-  bool skip_rows_with_nulls;
+  size_type const* __restrict__ target_rows;
 
-  /**
-   * @brief Construct a new compute_single_pass_aggs_fn functor object
-   *
-   * @param map Hash map object to insert key,value pairs into.
-   * @param input_values The table whose rows will be aggregated in the values
-   * of the hash map
-   * @param output_values Table that stores the results of aggregating rows of
-   * `input_values`.
-   * @param aggs The set of aggregation operations to perform across the
-   * columns of the `input_values` rows
-   * @param row_bitmask Bitmask where bit `i` indicates the presence of a null
-   * value in row `i` of input keys. Only used if `skip_rows_with_nulls` is `true`
-   * @param skip_rows_with_nulls Indicates if rows in `input_keys` containing
-   * null values should be skipped. It `true`, it is assumed `row_bitmask` is a
-   * bitmask where bit `i` indicates the presence of a null value in row `i`.
-   */
-  compute_single_pass_aggs_fn(Map map,
-                              table_device_view input_values,
-                              mutable_table_device_view output_values,
-                              aggregation::Kind const* aggs,
-                              bitmask_type const* row_bitmask,
-                              bool skip_rows_with_nulls)
-    : map(map),
-      input_values(input_values),
-      output_values(output_values),
-      aggs(aggs),
-      row_bitmask(row_bitmask),
-      skip_rows_with_nulls(skip_rows_with_nulls)
+  __device__ void operator()(size_type i)
   {
+    if (target_rows[i] >= 0) {
+      cudf::detail::aggregate_row<true, true>(output_values, target_rows[i], input_values, i, aggs);
+    }
   }
+};
 
-  __device__ void operator()(size_type i)
-  {
-    if (not skip_rows_with_nulls or cudf::bit_is_set(row_bitmask, i)) {
-      auto result = map.insert(thrust::make_pair(i, i));
+/**
+ * @brief Aggregates a column into per-block partial results in shared memory, which each block
+ * then merges into the sparse results.
+ *
+ * With few groups, the atomic updates of the sparse results of `aggregate_row` all contend for
+ * the same few addresses. Here each block only performs `num_groups` of them, and the updates of
+ * every row are shared memory atomics private to the block.
+ *
+ * The dynamic shared memory holds a `Target` partial result and a flag indicating whether any
+ * value was aggregated into it for each group.
+ *
+ * @param source The column to aggregate
+ * @param group_ids The dense group of each row of `source`, or -1 for skipped rows
+ * @param num_groups The number of groups
+ * @param group_rows The row of the sparse results of each group
+ * @param target The sparse results
+ */
+template <typename Source, aggregation::Kind k>
+__global__ void shared_memory_aggregate(column_device_view source,
+                                        size_type const* __restrict__ group_ids,
+                                        size_type num_groups,
+                                        size_type const* __restrict__ group_rows,
+                                        mutable_column_device_view target)
+{
+  using Target = cudf::detail::target_type_t<Source, k>;
+  extern __shared__ __align__(16) char shared_memory[];
+  auto const partials  = reinterpret_cast<Target*>(shared_memory);
+  auto const has_value = reinterpret_cast<int*>(partials + num_groups);
+
+  for (auto g = static_cast<size_type>(threadIdx.x); g < num_groups; g += blockDim.x) {
+    partials[g]  = cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+    has_value[g] = 0;
+  }
+  __syncthreads();
 
-      cudf::detail::aggregate_row<true, true>(
-        output_values, result.first->second, input_values, i, aggs);
+  for (auto i = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+       i < source.size();
+       i += blockDim.x * gridDim.x) {
+    auto const g = group_ids[i];
+    if (g < 0) { continue; }
+    if constexpr (k == aggregation::COUNT_ALL) {
+      atomicAdd(&partials[g], Target{1});
+    } else if (source.is_valid(i)) {
+      auto const value = static_cast<Target>(source.element<Source>(i));
+      if constexpr (k == aggregation::SUM) {
+        atomicAdd(&partials[g], value);
+      } else if constexpr (k == aggregation::SUM_OF_SQUARES) {
+        atomicAdd(&partials[g], value * value);
+      } else if constexpr (k == aggregation::PRODUCT) {
+        atomicMul(&partials[g], value);
+      } else if constexpr (k == aggregation::MIN) {
+        atomicMin(&partials[g], value);
+      } else if constexpr (k == aggregation::MAX) {
+        atomicMax(&partials[g], value);
+      } else {
+        atomicAdd(&partials[g], Target{1});
+      }
+    } else {
+      continue;
     }
+    has_value[g] = 1;
   }
-};
+  __syncthreads();
+
+  for (auto g = static_cast<size_type>(threadIdx.x); g < num_groups; g += blockDim.x) {
+    if (has_value[g] == 0) { continue; }
+    auto const row = group_rows[g];
+    if constexpr (k == aggregation::PRODUCT) {
+      atomicMul(&target.element<Target>(row), partials[g]);
+    } else if constexpr (k == aggregation::MIN) {
+      atomicMin(&target.element<Target>(row), partials[g]);
+    } else if constexpr (k == aggregation::MAX) {
+      atomicMax(&target.element<Target>(row), partials[g]);
+    } else {
+      atomicAdd(&target.element<Target>(row), partials[g]);
+    }
+    if (target.is_null(row)) { target.set_valid(row); }
+  }
+}
 
 }  // namespace hash
 }  // namespace detail
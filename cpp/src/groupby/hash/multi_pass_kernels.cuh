@@ -30,24 +30,28 @@
 namespace cudf {
 namespace detail {
 
-template <typename Map, bool target_has_nulls = true, bool source_has_nulls = true>
+/**
+ * @brief Accumulates the squared deviation from the group mean of every valid row into the
+ * variance of its group
+ *
+ * `target_rows` holds the row of the sparse results of the group of every row, or a negative
+ * value for the rows that are skipped.
+ */
+template <bool target_has_nulls = true, bool source_has_nulls = true>
 struct var_hash_functor {
-  Map const map;
-  bitmask_type const* __restrict__ row_bitmask;
+  size_type const* __restrict__ target_rows;
   mutable_column_device_view target;
   column_device_view source;
   column_device_view sum;
   column_device_view count;
   size_type ddof;
-  var_hash_functor(Map const map,
-                   bitmask_type const* row_bitmask,
+  var_hash_functor(size_type const* target_rows,
                    mutable_column_device_view target,
                    column_device_view source,
                    column_device_view sum,
                    column_device_view count,
                    size_type ddof)
-    : map(map),
-      row_bitmask(row_bitmask),
+    : target_rows(target_rows),
       target(target),
       source(source),
       sum(sum),
@@ -93,10 +97,81 @@ struct var_hash_functor {
   }
   __device__ inline void operator()(size_type source_index)
   {
-    if (row_bitmask == nullptr or cudf::bit_is_set(row_bitmask, source_index)) {
-      auto result       = map.find(source_index);
-      auto target_index = result->second;
+    auto const target_index = target_rows[source_index];
+    if (target_index >= 0) {
+      auto col         = source;
+      auto source_type = source.type();
+      if (source_type.id() == type_id::DICTIONARY32) {
+        col          = source.child(cudf::dictionary_column_view::keys_column_index);
+        source_type  = col.type();
+        source_index = static_cast<size_type>(source.element<dictionary32>(source_index));
+      }
+
+      type_dispatcher(source_type, *this, col, source_index, target_index);
+    }
+  }
+};
+
+/**
+ * @brief Accumulates the sum of squared deviations from the group mean of every valid row into
+ * the M2 of its group
+ *
+ * `target_rows` holds the row of the sparse results of the group of every row, or a negative
+ * value for the rows that are skipped.
+ */
+template <bool target_has_nulls = true, bool source_has_nulls = true>
+struct m2_hash_functor {
+  size_type const* __restrict__ target_rows;
+  mutable_column_device_view target;
+  column_device_view source;
+  column_device_view sum;
+  column_device_view count;
+  m2_hash_functor(size_type const* target_rows,
+                  mutable_column_device_view target,
+                  column_device_view source,
+                  column_device_view sum,
+                  column_device_view count)
+    : target_rows(target_rows), target(target), source(source), sum(sum), count(count)
+  {
+  }
+
+  template <typename Source>
+  constexpr static bool is_supported()
+  {
+    return is_numeric<Source>() && !is_fixed_point<Source>();
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<!is_supported<Source>()> operator()(column_device_view const& source,
+                                                                  size_type source_index,
+                                                                  size_type target_index) noexcept
+  {
+    CUDF_UNREACHABLE("Invalid source type for m2 aggregation.");
+  }
+
+  template <typename Source>
+  __device__ std::enable_if_t<is_supported<Source>()> operator()(column_device_view const& source,
+                                                                 size_type source_index,
+                                                                 size_type target_index) noexcept
+  {
+    using Target    = target_type_t<Source, aggregation::M2>;
+    using SumType   = target_type_t<Source, aggregation::SUM>;
+    using CountType = target_type_t<Source, aggregation::COUNT_VALID>;
 
+    if (source_has_nulls and source.is_null(source_index)) return;
+    CountType group_size = count.element<CountType>(target_index);
+    if (group_size == 0) return;
+
+    auto x    = static_cast<Target>(source.element<Source>(source_index));
+    auto mean = static_cast<Target>(sum.element<SumType>(target_index)) / group_size;
+    atomicAdd(&target.element<Target>(target_index), (x - mean) * (x - mean));
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+  __device__ inline void operator()(size_type source_index)
+  {
+    auto const target_index = target_rows[source_index];
+    if (target_index >= 0) {
       auto col         = source;
       auto source_type = source.type();
       if (source_type.id() == type_id::DICTIONARY32) {
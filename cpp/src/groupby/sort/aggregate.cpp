@@ -27,6 +27,7 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/unary.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -38,9 +39,12 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <initializer_list>
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -61,8 +65,45 @@ struct aggregate_result_functor final : store_result_functor {
   {
     CUDF_FAIL("Unsupported aggregation.");
   }
+
+  /**
+   * @brief Computes SUM, MIN, MAX and COUNT_VALID of the values in a single pass if at least two
+   * of them are needed by `aggs`
+   *
+   * MEAN, M2, VARIANCE and STD need both SUM and COUNT_VALID.
+   */
+  void compute_fused_reductions(std::vector<std::unique_ptr<groupby_aggregation>> const& aggs);
 };
 
+void aggregate_result_functor::compute_fused_reductions(
+  std::vector<std::unique_ptr<groupby_aggregation>> const& aggs)
+{
+  if (not detail::is_group_sum_min_max_count_supported(values.type())) { return; }
+
+  auto const needs_any_of = [&aggs](std::initializer_list<aggregation::Kind> kinds) {
+    return std::any_of(aggs.cbegin(), aggs.cend(), [kinds](auto const& agg) {
+      return std::find(kinds.begin(), kinds.end(), agg->kind) != kinds.end();
+    });
+  };
+  auto const needs_sum_and_count = needs_any_of(
+    {aggregation::MEAN, aggregation::M2, aggregation::VARIANCE, aggregation::STD});
+  auto const num_needed = int{needs_sum_and_count or needs_any_of({aggregation::SUM})} +
+                          int{needs_any_of({aggregation::MIN})} +
+                          int{needs_any_of({aggregation::MAX})} +
+                          int{needs_sum_and_count or needs_any_of({aggregation::COUNT_VALID})};
+  if (num_needed < 2) { return; }
+
+  auto results = detail::group_sum_min_max_count(
+    get_grouped_values(), helper.num_groups(stream), helper.group_labels(stream), stream, mr);
+  auto add_result = [&](std::unique_ptr<aggregation> const& agg, std::unique_ptr<column>&& result) {
+    if (not cache.has_result(values, *agg)) { cache.add_result(values, *agg, std::move(result)); }
+  };
+  add_result(make_sum_aggregation(), std::move(results[0]));
+  add_result(make_min_aggregation(), std::move(results[1]));
+  add_result(make_max_aggregation(), std::move(results[2]));
+  add_result(make_count_aggregation(), std::move(results[3]));
+}
+
 template <>
 void aggregate_result_functor::operator()<aggregation::COUNT_VALID>(aggregation const& agg)
 {
@@ -754,6 +795,44 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                               mr));
 }
 
+/**
+ * @brief Generate a HyperLogLog sketch column from a grouped set of input values.
+ *
+ * Each output row is the `LIST<UINT8>` of the `2^precision` registers of a single sketch.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::HLL>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::hll_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::detail::hyperloglog::group_hll(get_grouped_values(),
+                                                        helper.group_labels(stream),
+                                                        helper.num_groups(stream),
+                                                        precision,
+                                                        stream,
+                                                        mr));
+}
+
+/**
+ * @brief Generate a merged HyperLogLog sketch column from a grouped set of input sketches.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_HLL>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  cache.add_result(values,
+                   agg,
+                   cudf::detail::hyperloglog::group_merge_hll(get_grouped_values(),
+                                                              helper.group_labels(stream),
+                                                              helper.num_groups(stream),
+                                                              stream,
+                                                              mr));
+}
+
 }  // namespace detail
 
 // Sort-based groupby
@@ -770,8 +849,8 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::sort
   for (auto const& request : requests) {
     auto store_functor =
       detail::aggregate_result_functor(request.values, helper(), cache, stream, mr);
+    store_functor.compute_fused_reductions(request.aggregations);
     for (auto const& agg : request.aggregations) {
-      // TODO (dm): single pass compute all supported reductions
       cudf::detail::aggregation_dispatcher(agg->kind, store_functor, *agg);
     }
   }
@@ -23,6 +23,7 @@
 #include <rmm/cuda_stream_view.hpp>
 
 #include <memory>
+#include <vector>
 
 /** @internal @file Internal API in this file are mostly segmented reduction operations on column,
  * which are used in sort-based groupby aggregations.
@@ -54,6 +55,45 @@ std::unique_ptr<column> group_sum(column_view const& values,
                                   rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Internal API to calculate groupwise sum, minimum, maximum and valid count in a single
+ * pass over the group labels
+ *
+ * @code{.pseudo}
+ * values       = [2, 1, 4, -1, -2, <NA>, 4, <NA>]
+ * group_labels = [0, 0, 0,  1,  1,    2, 2,    3]
+ * num_groups   = 4
+ *
+ * group_sum_min_max_count = [[7, -3, 4, <NA>],
+ *                            [1, -2, 4, <NA>],
+ *                            [4, -1, 4, <NA>],
+ *                            [3,  2, 1,    0]]
+ * @endcode
+ *
+ * The columns are those of `group_sum`, `group_min`, `group_max` and `group_count_valid`.
+ *
+ * @throws cudf::logic_error if `is_group_sum_min_max_count_supported(values.type())` is false.
+ *
+ * @param values Grouped values to get sum, minimum, maximum and valid count of
+ * @param num_groups Number of groups
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ */
+std::vector<std::unique_ptr<column>> group_sum_min_max_count(
+  column_view const& values,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Returns whether `group_sum_min_max_count` supports values of type `type`.
+ *
+ * Only the numeric types other than BOOL8 are supported.
+ */
+bool is_group_sum_min_max_count_supported(data_type type);
+
 /**
  * @brief Internal API to calculate groupwise product
  *
@@ -14,11 +14,15 @@
  * limitations under the License.
  */
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/replace/nulls.cuh>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/replace.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/device_uvector.hpp>
 
@@ -36,12 +40,87 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 
+namespace {
+
+/**
+ * @brief Fills the null rows of each group of a fixed-width column with a single scan over the
+ * values and validities, instead of scanning for a gather map and gathering.
+ */
+struct group_fill_nulls_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_fixed_width<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(cudf::column_view const& grouped_value,
+                                     device_span<size_type const> group_labels,
+                                     cudf::replace_policy replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto const size      = grouped_value.size();
+    auto const device_in = cudf::column_device_view::create(grouped_value, stream);
+    auto const in_begin  = thrust::make_zip_iterator(
+      thrust::make_tuple(device_in->begin<T>(), cudf::detail::make_validity_iterator(*device_in)));
+
+    auto output = cudf::detail::allocate_like(
+      grouped_value, size, cudf::mask_allocation_policy::NEVER, stream, mr);
+    auto const output_begin = output->mutable_view().begin<T>();
+    rmm::device_uvector<bool> output_valid(size, stream);
+    auto const out_begin =
+      thrust::make_zip_iterator(thrust::make_tuple(output_begin, output_valid.begin()));
+
+    auto const func = cudf::detail::fill_nulls_functor<T>{};
+    thrust::equal_to<cudf::size_type> eq;
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                    group_labels.begin(),
+                                    group_labels.begin() + size,
+                                    in_begin,
+                                    out_begin,
+                                    eq,
+                                    func);
+    } else {
+      auto const gl_rbegin  = thrust::make_reverse_iterator(group_labels.begin() + size);
+      auto const in_rbegin  = thrust::make_reverse_iterator(in_begin + size);
+      auto const out_rbegin = thrust::make_reverse_iterator(out_begin + size);
+      thrust::inclusive_scan_by_key(
+        rmm::exec_policy(stream), gl_rbegin, gl_rbegin + size, in_rbegin, out_rbegin, eq, func);
+    }
+
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      output_valid.begin(), output_valid.end(), thrust::identity<bool>{}, stream, mr);
+    output->set_null_mask(std::move(null_mask), null_count);
+    return output;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Filling nulls in a single scan requires a fixed-width type");
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> group_replace_nulls(cudf::column_view const& grouped_value,
                                             device_span<size_type const> group_labels,
                                             cudf::replace_policy replace_policy,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
+  if (cudf::is_fixed_width(grouped_value.type())) {
+    return cudf::type_dispatcher<cudf::dispatch_storage_type>(grouped_value.type(),
+                                                              group_fill_nulls_fn{},
+                                                              grouped_value,
+                                                              group_labels,
+                                                              replace_policy,
+                                                              stream,
+                                                              mr);
+  }
+
   cudf::size_type size = grouped_value.size();
 
   auto device_in = cudf::column_device_view::create(grouped_value, stream);
@@ -37,6 +37,8 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/reduce.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace groupby {
 namespace detail {
@@ -77,17 +79,18 @@ struct value_accessor {
  *
  * @tparam SourceType Type of the underlying column. For dictionary column, type of the key column.
  * @tparam TargetType Type that is used for computation.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
  */
-template <typename SourceType, typename TargetType>
+template <typename SourceType, typename TargetType, typename Nullate>
 struct null_replaced_value_accessor : value_accessor<SourceType> {
   using super_t = value_accessor<SourceType>;
 
   TargetType const init;
-  bool const has_nulls;
+  Nullate const has_nulls;
 
   null_replaced_value_accessor(column_device_view const& col,
                                TargetType const& init,
-                               bool const has_nulls)
+                               Nullate const has_nulls)
     : super_t(col), init(init), has_nulls(has_nulls)
   {
   }
@@ -179,19 +182,28 @@ struct group_reduction_functor<K, T, std::enable_if_t<is_group_reduction_support
     auto const d_values_ptr = column_device_view::create(values, stream);
     auto const result_begin = result->mutable_view().template begin<ResultDType>();
 
-    if constexpr (K == aggregation::ARGMAX || K == aggregation::ARGMIN) {
-      auto const count_iter = thrust::make_counting_iterator<ResultType>(0);
-      auto const binop      = cudf::detail::element_argminmax_fn<T>{
-        *d_values_ptr, values.has_nulls(), K == aggregation::ARGMIN};
-      do_reduction(count_iter, result_begin, binop);
+    // the null checks are compiled out for the (common) columns without nulls
+    auto const reduce_values = [&](auto const has_nulls) {
+      using Nullate = std::decay_t<decltype(has_nulls)>;
+      if constexpr (K == aggregation::ARGMAX || K == aggregation::ARGMIN) {
+        auto const count_iter = thrust::make_counting_iterator<ResultType>(0);
+        auto const binop      = cudf::detail::element_argminmax_fn<T, Nullate>{
+          *d_values_ptr, has_nulls, K == aggregation::ARGMIN};
+        do_reduction(count_iter, result_begin, binop);
+      } else {
+        using OpType    = cudf::detail::corresponding_operator_t<K>;
+        auto init       = OpType::template identity<ResultDType>();
+        auto inp_values = cudf::detail::make_counting_transform_iterator(
+          0,
+          null_replaced_value_accessor<SourceDType, ResultDType, Nullate>{
+            *d_values_ptr, init, has_nulls});
+        do_reduction(inp_values, result_begin, OpType{});
+      }
+    };
+    if (values.has_nulls()) {
+      reduce_values(nullate::YES{});
     } else {
-      using OpType    = cudf::detail::corresponding_operator_t<K>;
-      auto init       = OpType::template identity<ResultDType>();
-      auto inp_values = cudf::detail::make_counting_transform_iterator(
-        0,
-        null_replaced_value_accessor<SourceDType, ResultDType>{
-          *d_values_ptr, init, values.has_nulls()});
-      do_reduction(inp_values, result_begin, OpType{});
+      reduce_values(nullate::NO{});
     }
 
     if (values.has_nulls()) {
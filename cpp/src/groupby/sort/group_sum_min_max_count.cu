@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <groupby/sort/group_reductions.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/tuple.h>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace {
+
+template <typename T>
+using sum_type_t = cudf::detail::target_type_t<T, aggregation::SUM>;
+
+/**
+ * @brief The sum, minimum, maximum and valid count of a range of values
+ */
+template <typename T>
+using partial_result = thrust::tuple<sum_type_t<T>, T, T, size_type>;
+
+/**
+ * @brief Returns the partial result of a single value, the identities if it is null
+ */
+template <typename T>
+struct partial_result_accessor {
+  column_device_view const values;
+  bool const has_nulls;
+
+  __device__ partial_result<T> operator()(size_type i) const
+  {
+    if (has_nulls and values.is_null_nocheck(i)) {
+      return {cudf::DeviceSum::identity<sum_type_t<T>>(),
+              cudf::DeviceMin::identity<T>(),
+              cudf::DeviceMax::identity<T>(),
+              0};
+    }
+    auto const value = values.element<T>(i);
+    return {static_cast<sum_type_t<T>>(value), value, value, 1};
+  }
+};
+
+template <typename T>
+struct combine_partial_results {
+  __device__ partial_result<T> operator()(partial_result<T> const& lhs,
+                                          partial_result<T> const& rhs) const
+  {
+    return {thrust::get<0>(lhs) + thrust::get<0>(rhs),
+            cudf::DeviceMin{}(thrust::get<1>(lhs), thrust::get<1>(rhs)),
+            cudf::DeviceMax{}(thrust::get<2>(lhs), thrust::get<2>(rhs)),
+            thrust::get<3>(lhs) + thrust::get<3>(rhs)};
+  }
+};
+
+template <typename T>
+constexpr bool is_sum_min_max_count_supported()
+{
+  return cudf::is_numeric<T>() and not cudf::is_boolean<T>();
+}
+
+struct group_sum_min_max_count_dispatcher {
+  template <typename T, CUDF_ENABLE_IF(is_sum_min_max_count_supported<T>())>
+  std::vector<std::unique_ptr<column>> operator()(column_view const& values,
+                                                  size_type num_groups,
+                                                  cudf::device_span<size_type const> group_labels,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+  {
+    auto make_result_column = [&](data_type type) {
+      return make_fixed_width_column(type, num_groups, mask_state::UNALLOCATED, stream, mr);
+    };
+    auto sums   = make_result_column(data_type{type_to_id<sum_type_t<T>>()});
+    auto mins   = make_result_column(values.type());
+    auto maxes  = make_result_column(values.type());
+    auto counts = make_result_column(data_type{type_to_id<size_type>()});
+
+    if (not values.is_empty()) {
+      // The group labels are read once for all the reductions
+      auto const d_values              = column_device_view::create(values, stream);
+      auto const partial_results_begin = cudf::detail::make_counting_transform_iterator(
+        0, partial_result_accessor<T>{*d_values, values.has_nulls()});
+      auto const results_begin =
+        thrust::make_zip_iterator(thrust::make_tuple(sums->mutable_view().begin<sum_type_t<T>>(),
+                                                     mins->mutable_view().begin<T>(),
+                                                     maxes->mutable_view().begin<T>(),
+                                                     counts->mutable_view().begin<size_type>()));
+      thrust::reduce_by_key(rmm::exec_policy(stream),
+                            group_labels.begin(),
+                            group_labels.end(),
+                            partial_results_begin,
+                            thrust::make_discard_iterator(),
+                            results_begin,
+                            thrust::equal_to{},
+                            combine_partial_results<T>{});
+
+      if (values.has_nulls()) {
+        // A group without valid values has a null sum, minimum and maximum
+        auto const counts_begin      = counts->view().begin<size_type>();
+        auto [null_mask, null_count] = cudf::detail::valid_if(
+          counts_begin,
+          counts_begin + num_groups,
+          [] __device__(size_type count) { return count > 0; },
+          stream,
+          mr);
+        sums->set_null_mask(rmm::device_buffer{null_mask, stream, mr}, null_count);
+        mins->set_null_mask(rmm::device_buffer{null_mask, stream, mr}, null_count);
+        maxes->set_null_mask(std::move(null_mask), null_count);
+      }
+    }
+
+    std::vector<std::unique_ptr<column>> results;
+    results.push_back(std::move(sums));
+    results.push_back(std::move(mins));
+    results.push_back(std::move(maxes));
+    results.push_back(std::move(counts));
+    return results;
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not is_sum_min_max_count_supported<T>())>
+  std::vector<std::unique_ptr<column>> operator()(column_view const&,
+                                                  size_type,
+                                                  cudf::device_span<size_type const>,
+                                                  rmm::cuda_stream_view,
+                                                  rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported groupby reduction type-agg combination.");
+  }
+};
+
+struct is_sum_min_max_count_supported_fn {
+  template <typename T>
+  constexpr bool operator()() const
+  {
+    return is_sum_min_max_count_supported<T>();
+  }
+};
+
+}  // namespace
+
+bool is_group_sum_min_max_count_supported(data_type type)
+{
+  return type_dispatcher(type, is_sum_min_max_count_supported_fn{});
+}
+
+std::vector<std::unique_ptr<column>> group_sum_min_max_count(
+  column_view const& values,
+  size_type num_groups,
+  cudf::device_span<size_type const> group_labels,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(values.type(),
+                         group_sum_min_max_count_dispatcher{},
+                         values,
+                         num_groups,
+                         group_labels,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
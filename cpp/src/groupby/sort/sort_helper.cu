@@ -22,6 +22,7 @@
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/scatter.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
@@ -33,6 +34,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/fill.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -116,6 +118,49 @@ sort_groupby_helper::sort_groupby_helper(table_view const& keys,
   }
 };
 
+sort_groupby_helper::sort_groupby_helper(table_view const& keys,
+                                         null_policy include_null_keys,
+                                         table_view const& plan,
+                                         rmm::cuda_stream_view stream)
+  : sort_groupby_helper(keys, include_null_keys, sorted::NO)
+{
+  auto const is_index_column = [](column_view const& col) {
+    return col.type().id() == type_to_id<size_type>();
+  };
+  CUDF_EXPECTS(plan.num_columns() == 2 and std::all_of(plan.begin(), plan.end(), is_index_column),
+               "Grouping plan must be a key sort order column and a group labels column");
+  CUDF_EXPECTS(plan.num_rows() == _keys.num_rows(),
+               "Grouping plan does not match the number of rows in keys");
+
+  auto const labels = plan.column(1);
+  CUDF_EXPECTS(labels.size() - labels.null_count() == num_keys(stream),
+               "Grouping plan does not match the null keys policy");
+
+  _key_sorted_order = std::make_unique<column>(plan.column(0), stream);
+
+  _group_labels = std::make_unique<index_vector>(num_keys(stream), stream);
+  thrust::copy(rmm::exec_policy(stream),
+               labels.begin<size_type>(),
+               labels.begin<size_type>() + num_keys(stream),
+               _group_labels->begin());
+
+  // Each group starts where the label of the sorted keys changes
+  _group_offsets      = std::make_unique<index_vector>(num_keys(stream) + 1, stream);
+  auto const d_labels = _group_labels->data();
+  auto const result_end =
+    thrust::unique_copy(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_keys(stream)),
+                        _group_offsets->begin(),
+                        [d_labels] __device__(size_type lhs, size_type rhs) {
+                          return d_labels[lhs] == d_labels[rhs];
+                        });
+
+  size_type num_groups = thrust::distance(_group_offsets->begin(), result_end);
+  _group_offsets->set_element(num_groups, num_keys(stream), stream);
+  _group_offsets->resize(num_groups + 1, stream);
+}
+
 size_type sort_groupby_helper::num_keys(rmm::cuda_stream_view stream)
 {
   if (_num_keys > -1) return _num_keys;
@@ -228,6 +273,37 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_labels(
   return group_labels;
 }
 
+std::unique_ptr<table> sort_groupby_helper::grouping_plan(rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  key_sort_order(stream);  // computes the full sort order held in _key_sorted_order
+  auto sort_order = std::make_unique<column>(_key_sorted_order->view(), stream, mr);
+
+  // Rows excluded because of null keys are at the end of the sort order and have no group
+  auto const num_rows = _keys.num_rows();
+  auto null_mask      = rmm::device_buffer{};
+  if (num_keys(stream) < num_rows) {
+    null_mask = cudf::detail::create_null_mask(num_rows, mask_state::ALL_NULL, stream, mr);
+    cudf::detail::set_null_mask(
+      static_cast<bitmask_type*>(null_mask.data()), 0, num_keys(stream), true, stream);
+  }
+  auto labels = make_numeric_column(data_type(type_to_id<size_type>()),
+                                    num_rows,
+                                    std::move(null_mask),
+                                    num_rows - num_keys(stream),
+                                    stream,
+                                    mr);
+  thrust::copy(rmm::exec_policy(stream),
+               group_labels(stream).begin(),
+               group_labels(stream).end(),
+               labels->mutable_view().begin<size_type>());
+
+  std::vector<std::unique_ptr<column>> columns;
+  columns.push_back(std::move(sort_order));
+  columns.push_back(std::move(labels));
+  return std::make_unique<table>(std::move(columns));
+}
+
 column_view sort_groupby_helper::unsorted_keys_labels(rmm::cuda_stream_view stream)
 {
   if (_unsorted_keys_labels) return _unsorted_keys_labels->view();
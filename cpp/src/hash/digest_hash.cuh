@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Passes each element of a row to a message digest hasher.
+ */
+template <typename Hasher>
+struct HasherDispatcher {
+  Hasher* hasher;
+  column_device_view const& input_col;
+
+  __device__ inline HasherDispatcher(Hasher* hasher, column_device_view const& input_col)
+    : hasher{hasher}, input_col{input_col}
+  {
+  }
+
+  template <typename Element>
+  void __device__ inline operator()(size_type const row_index) const
+  {
+    if constexpr ((is_fixed_width<Element>() && !is_chrono<Element>()) ||
+                  std::is_same_v<Element, string_view>) {
+      hasher->process(input_col.element<Element>(row_index));
+    } else {
+      (void)row_index;
+      CUDF_UNREACHABLE("Unsupported type for hash function.");
+    }
+  }
+};
+
+/**
+ * @brief Passes each valid element of a list row to a message digest hasher.
+ */
+template <typename Hasher>
+struct ListHasherDispatcher {
+  Hasher* hasher;
+  column_device_view const& input_col;
+
+  __device__ inline ListHasherDispatcher(Hasher* hasher, column_device_view const& input_col)
+    : hasher{hasher}, input_col{input_col}
+  {
+  }
+
+  template <typename Element>
+  void __device__ inline operator()(size_type const offset_begin, size_type const offset_end) const
+  {
+    if constexpr ((is_fixed_width<Element>() && !is_chrono<Element>()) ||
+                  std::is_same_v<Element, string_view>) {
+      for (size_type i = offset_begin; i < offset_end; i++) {
+        if (input_col.is_valid(i)) { hasher->process(input_col.element<Element>(i)); }
+      }
+    } else {
+      (void)offset_begin;
+      (void)offset_end;
+      CUDF_UNREACHABLE("Unsupported type for hash function.");
+    }
+  }
+};
+
+// Message digest supported leaf data type check
+constexpr inline bool digest_leaf_type_check(data_type dt)
+{
+  return (is_fixed_width(dt) && !is_chrono(dt)) || (dt.id() == type_id::STRING);
+}
+
+/**
+ * @brief Computes the message digest of each row as a hexadecimal string.
+ *
+ * The elements of each row are hashed sequentially left to right as a single message.
+ * Null elements are skipped.
+ *
+ * The `Hasher` is constructed with the output location of its row, is given each element
+ * with `process()` and writes the `Hasher::digest_size` hexadecimal characters of its digest
+ * when it is destroyed.
+ *
+ * @tparam Hasher Message digest algorithm to compute
+ * @param input The table of columns to hash
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Strings column of the hexadecimal digests
+ */
+template <typename Hasher>
+std::unique_ptr<column> digest_hash(table_view const& input,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0) { return make_empty_column(type_id::STRING); }
+
+  // Accepts string and fixed width columns, or single layer list columns holding those types
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](auto const& col) {
+                             if (col.type().id() == type_id::LIST) {
+                               return digest_leaf_type_check(lists_column_view(col).child().type());
+                             }
+                             return digest_leaf_type_check(col.type());
+                           }),
+               "Unsupported column type for hash function.");
+
+  // Digest size in hexadecimal characters
+  auto constexpr digest_size = Hasher::digest_size;
+  // Result column allocation and creation
+  auto begin = thrust::make_constant_iterator(digest_size);
+  auto offsets_column =
+    cudf::strings::detail::make_offsets_child_column(begin, begin + input.num_rows(), stream, mr);
+
+  auto chars_column =
+    strings::detail::create_chars_child_column(input.num_rows() * digest_size, stream, mr);
+  auto chars_view = chars_column->mutable_view();
+  auto d_chars    = chars_view.data<char>();
+
+  auto const device_input = table_device_view::create(input, stream);
+
+  // Hash each row, hashing each element sequentially left to right
+  thrust::for_each(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(input.num_rows()),
+    [d_chars, device_input = *device_input] __device__(auto row_index) {
+      Hasher hasher(d_chars + (static_cast<std::size_t>(row_index) * digest_size));
+      for (auto const& col : device_input) {
+        if (col.is_valid(row_index)) {
+          if (col.type().id() == type_id::LIST) {
+            auto const data_col = col.child(lists_column_view::child_column_index);
+            auto const offsets  = col.child(lists_column_view::offsets_column_index);
+            if (data_col.type().id() == type_id::LIST) {
+              CUDF_UNREACHABLE("Nested list unsupported");
+            }
+            auto const offset_begin = offsets.element<size_type>(row_index);
+            auto const offset_end   = offsets.element<size_type>(row_index + 1);
+            cudf::type_dispatcher<dispatch_storage_type>(
+              data_col.type(), ListHasherDispatcher(&hasher, data_col), offset_begin, offset_end);
+          } else {
+            cudf::type_dispatcher<dispatch_storage_type>(
+              col.type(), HasherDispatcher(&hasher, col), row_index);
+          }
+        }
+      }
+    });
+
+  rmm::device_buffer null_mask{0, stream, mr};
+
+  return make_strings_column(
+    input.num_rows(), std::move(offsets_column), std::move(chars_column), 0, std::move(null_mask));
+}
+
+}  // namespace detail
+}  // namespace cudf
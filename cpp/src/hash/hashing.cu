@@ -62,6 +62,10 @@ std::unique_ptr<column> hash(table_view const& input,
     case (hash_id::HASH_MURMUR3): return murmur_hash3_32(input, seed, stream, mr);
     case (hash_id::HASH_SPARK_MURMUR3): return spark_murmur_hash3_32(input, seed, stream, mr);
     case (hash_id::HASH_MD5): return md5_hash(input, stream, mr);
+    case (hash_id::HASH_XXHASH64): return xxhash_64(input, seed, stream, mr);
+    case (hash_id::HASH_SHA1): return sha1_hash(input, stream, mr);
+    case (hash_id::HASH_SHA256): return sha256_hash(input, stream, mr);
+    case (hash_id::HASH_SHA512): return sha512_hash(input, stream, mr);
     default: CUDF_FAIL("Unsupported hash function.");
   }
 }
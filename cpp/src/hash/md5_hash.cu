@@ -13,27 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-#include <cudf/column/column_device_view.cuh>
-#include <cudf/column/column_factories.hpp>
+#include <hash/digest_hash.cuh>
+
 #include <cudf/detail/hashing.hpp>
-#include <cudf/detail/iterator.cuh>
-#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/hash_functions.cuh>
-#include <cudf/lists/lists_column_view.hpp>
-#include <cudf/scalar/scalar.hpp>
-#include <cudf/strings/detail/utilities.cuh>
-#include <cudf/strings/string_view.hpp>
-#include <cudf/table/table_device_view.cuh>
-#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
-#include <rmm/exec_policy.hpp>
-
-#include <thrust/for_each.h>
-#include <thrust/iterator/constant_iterator.h>
-#include <thrust/iterator/counting_iterator.h>
-
-#include <iterator>
 
 namespace cudf {
 
@@ -60,6 +45,7 @@ const __constant__ uint32_t md5_hash_constants[64] = {
 
 struct MD5Hasher {
   static constexpr int message_chunk_size = 64;
+  static constexpr int digest_size        = 32;
 
   __device__ inline MD5Hasher(char* result_location)
     : result_location(result_location), buffer(md5_hash_step{hash_values})
@@ -158,129 +144,13 @@ struct MD5Hasher {
   uint32_t hash_values[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
 };
 
-template <typename Hasher>
-struct HasherDispatcher {
-  Hasher* hasher;
-  column_device_view const& input_col;
-
-  __device__ inline HasherDispatcher(Hasher* hasher, column_device_view const& input_col)
-    : hasher{hasher}, input_col{input_col}
-  {
-  }
-
-  template <typename Element>
-  void __device__ inline operator()(size_type const row_index) const
-  {
-    if constexpr ((is_fixed_width<Element>() && !is_chrono<Element>()) ||
-                  std::is_same_v<Element, string_view>) {
-      hasher->process(input_col.element<Element>(row_index));
-    } else {
-      (void)row_index;
-      CUDF_UNREACHABLE("Unsupported type for hash function.");
-    }
-  }
-};
-
-template <typename Hasher>
-struct ListHasherDispatcher {
-  Hasher* hasher;
-  column_device_view const& input_col;
-
-  __device__ inline ListHasherDispatcher(Hasher* hasher, column_device_view const& input_col)
-    : hasher{hasher}, input_col{input_col}
-  {
-  }
-
-  template <typename Element>
-  void __device__ inline operator()(size_type const offset_begin, size_type const offset_end) const
-  {
-    if constexpr ((is_fixed_width<Element>() && !is_chrono<Element>()) ||
-                  std::is_same_v<Element, string_view>) {
-      for (size_type i = offset_begin; i < offset_end; i++) {
-        if (input_col.is_valid(i)) { hasher->process(input_col.element<Element>(i)); }
-      }
-    } else {
-      (void)offset_begin;
-      (void)offset_end;
-      CUDF_UNREACHABLE("Unsupported type for hash function.");
-    }
-  }
-};
-
-// MD5 supported leaf data type check
-constexpr inline bool md5_leaf_type_check(data_type dt)
-{
-  return (is_fixed_width(dt) && !is_chrono(dt)) || (dt.id() == type_id::STRING);
-}
-
 }  // namespace
 
 std::unique_ptr<column> md5_hash(table_view const& input,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  if (input.num_columns() == 0 || input.num_rows() == 0) {
-    // Return the MD5 hash of a zero-length input.
-    string_scalar const string_128bit("d41d8cd98f00b204e9orig98ecf8427e");
-    return make_column_from_scalar(string_128bit, input.num_rows(), stream, mr);
-  }
-
-  // Accepts string and fixed width columns, or single layer list columns holding those types
-  CUDF_EXPECTS(std::all_of(input.begin(),
-                           input.end(),
-                           [](auto const& col) {
-                             if (col.type().id() == type_id::LIST) {
-                               return md5_leaf_type_check(lists_column_view(col).child().type());
-                             }
-                             return md5_leaf_type_check(col.type());
-                           }),
-               "Unsupported column type for hash function.");
-
-  // Digest size in bytes
-  auto constexpr digest_size = 32;
-  // Result column allocation and creation
-  auto begin = thrust::make_constant_iterator(digest_size);
-  auto offsets_column =
-    cudf::strings::detail::make_offsets_child_column(begin, begin + input.num_rows(), stream, mr);
-
-  auto chars_column =
-    strings::detail::create_chars_child_column(input.num_rows() * digest_size, stream, mr);
-  auto chars_view = chars_column->mutable_view();
-  auto d_chars    = chars_view.data<char>();
-
-  auto const device_input = table_device_view::create(input, stream);
-
-  // Hash each row, hashing each element sequentially left to right
-  thrust::for_each(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    thrust::make_counting_iterator(input.num_rows()),
-    [d_chars, device_input = *device_input] __device__(auto row_index) {
-      MD5Hasher hasher(d_chars + (row_index * digest_size));
-      for (auto const& col : device_input) {
-        if (col.is_valid(row_index)) {
-          if (col.type().id() == type_id::LIST) {
-            auto const data_col = col.child(lists_column_view::child_column_index);
-            auto const offsets  = col.child(lists_column_view::offsets_column_index);
-            if (data_col.type().id() == type_id::LIST) {
-              CUDF_UNREACHABLE("Nested list unsupported");
-            }
-            auto const offset_begin = offsets.element<size_type>(row_index);
-            auto const offset_end   = offsets.element<size_type>(row_index + 1);
-            cudf::type_dispatcher<dispatch_storage_type>(
-              data_col.type(), ListHasherDispatcher(&hasher, data_col), offset_begin, offset_end);
-          } else {
-            cudf::type_dispatcher<dispatch_storage_type>(
-              col.type(), HasherDispatcher(&hasher, col), row_index);
-          }
-        }
-      }
-    });
-
-  rmm::device_buffer null_mask{0, stream, mr};
-
-  return make_strings_column(
-    input.num_rows(), std::move(offsets_column), std::move(chars_column), 0, std::move(null_mask));
+  return digest_hash<MD5Hasher>(input, stream, mr);
 }
 
 }  // namespace detail
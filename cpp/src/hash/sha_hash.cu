@@ -0,0 +1,387 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <hash/digest_hash.cuh>
+
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstring>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+// The SHA algorithms and their constants are officially specified in FIPS 180-4:
+// https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.180-4.pdf
+const __constant__ uint32_t sha1_initial_values[5] = {
+  0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0};
+
+const __constant__ uint32_t sha256_initial_values[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+const __constant__ uint32_t sha256_hash_constants[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+const __constant__ uint64_t sha512_initial_values[8] = {0x6a09e667f3bcc908,
+                                                        0xbb67ae8584caa73b,
+                                                        0x3c6ef372fe94f82b,
+                                                        0xa54ff53a5f1d36f1,
+                                                        0x510e527fade682d1,
+                                                        0x9b05688c2b3e6c1f,
+                                                        0x1f83d9abfb41bd6b,
+                                                        0x5be0cd19137e2179};
+
+const __constant__ uint64_t sha512_hash_constants[80] = {
+  0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+  0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+  0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+  0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+  0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+  0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+  0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+  0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+  0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+  0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+  0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+  0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+  0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+  0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+  0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+  0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+  0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+  0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+  0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+  0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+// Loads a big-endian word from a possibly unaligned message chunk
+template <typename Word>
+__device__ inline Word load_big_endian(uint8_t const* bytes)
+{
+  Word word;
+  memcpy(&word, bytes, sizeof(Word));
+  return swap_endian(word);
+}
+
+/**
+ * @brief Processes a single 64-byte chunk with the SHA-1 compression function.
+ *
+ * The 80-word message schedule is computed in a rolling window of 16 words
+ * so that it stays in registers.
+ */
+struct sha1_hash_step {
+  using word_type                         = uint32_t;
+  static constexpr int message_chunk_size = 64;
+  static constexpr int state_words        = 5;
+  static constexpr int length_size        = 8;
+
+  word_type (&hash_values)[state_words];
+
+  static __device__ inline void initialize(word_type (&values)[state_words])
+  {
+    for (int i = 0; i < state_words; ++i) {
+      values[i] = sha1_initial_values[i];
+    }
+  }
+
+  void __device__ inline operator()(uint8_t const (&buffer)[message_chunk_size])
+  {
+    uint32_t w[16];
+    for (int i = 0; i < 16; ++i) {
+      w[i] = load_big_endian<uint32_t>(buffer + (i * 4));
+    }
+
+    uint32_t A = hash_values[0];
+    uint32_t B = hash_values[1];
+    uint32_t C = hash_values[2];
+    uint32_t D = hash_values[3];
+    uint32_t E = hash_values[4];
+
+    for (int t = 0; t < 80; ++t) {
+      if (t >= 16) {
+        w[t & 15] = rotate_bits_left(
+          w[(t - 3) & 15] ^ w[(t - 8) & 15] ^ w[(t - 14) & 15] ^ w[t & 15], 1);
+      }
+      uint32_t F;
+      uint32_t K;
+      // No default case is needed because t < 80. t / 20 is always 0, 1, 2, or 3.
+      switch (t / 20) {
+        case 0:
+          F = (B & C) | ((~B) & D);
+          K = 0x5a827999;
+          break;
+        case 1:
+          F = B ^ C ^ D;
+          K = 0x6ed9eba1;
+          break;
+        case 2:
+          F = (B & C) | (B & D) | (C & D);
+          K = 0x8f1bbcdc;
+          break;
+        case 3:
+          F = B ^ C ^ D;
+          K = 0xca62c1d6;
+          break;
+      }
+      uint32_t const temp = rotate_bits_left(A, 5) + F + E + K + w[t & 15];
+      E                   = D;
+      D                   = C;
+      C                   = rotate_bits_left(B, 30);
+      B                   = A;
+      A                   = temp;
+    }
+
+    hash_values[0] += A;
+    hash_values[1] += B;
+    hash_values[2] += C;
+    hash_values[3] += D;
+    hash_values[4] += E;
+  }
+};
+
+/**
+ * @brief Processes a single 64-byte chunk with the SHA-256 compression function.
+ */
+struct sha256_hash_step {
+  using word_type                         = uint32_t;
+  static constexpr int message_chunk_size = 64;
+  static constexpr int state_words        = 8;
+  static constexpr int length_size        = 8;
+
+  word_type (&hash_values)[state_words];
+
+  static __device__ inline void initialize(word_type (&values)[state_words])
+  {
+    for (int i = 0; i < state_words; ++i) {
+      values[i] = sha256_initial_values[i];
+    }
+  }
+
+  void __device__ inline operator()(uint8_t const (&buffer)[message_chunk_size])
+  {
+    uint32_t w[16];
+    for (int i = 0; i < 16; ++i) {
+      w[i] = load_big_endian<uint32_t>(buffer + (i * 4));
+    }
+
+    uint32_t s[state_words];
+    for (int i = 0; i < state_words; ++i) {
+      s[i] = hash_values[i];
+    }
+
+    for (int t = 0; t < 64; ++t) {
+      if (t >= 16) {
+        auto const w15 = w[(t - 15) & 15];
+        auto const w2  = w[(t - 2) & 15];
+        auto const s0  = rotate_bits_right(w15, 7) ^ rotate_bits_right(w15, 18) ^ (w15 >> 3);
+        auto const s1  = rotate_bits_right(w2, 17) ^ rotate_bits_right(w2, 19) ^ (w2 >> 10);
+        w[t & 15] += s0 + w[(t - 7) & 15] + s1;
+      }
+      auto const e  = s[4];
+      auto const S1 = rotate_bits_right(e, 6) ^ rotate_bits_right(e, 11) ^ rotate_bits_right(e, 25);
+      auto const ch = (e & s[5]) ^ ((~e) & s[6]);
+      auto const t1 = s[7] + S1 + ch + sha256_hash_constants[t] + w[t & 15];
+      auto const a  = s[0];
+      auto const S0 = rotate_bits_right(a, 2) ^ rotate_bits_right(a, 13) ^ rotate_bits_right(a, 22);
+      auto const maj = (a & s[1]) ^ (a & s[2]) ^ (s[1] & s[2]);
+      s[7]           = s[6];
+      s[6]           = s[5];
+      s[5]           = s[4];
+      s[4]           = s[3] + t1;
+      s[3]           = s[2];
+      s[2]           = s[1];
+      s[1]           = s[0];
+      s[0]           = t1 + S0 + maj;
+    }
+
+    for (int i = 0; i < state_words; ++i) {
+      hash_values[i] += s[i];
+    }
+  }
+};
+
+/**
+ * @brief Processes a single 128-byte chunk with the SHA-512 compression function.
+ */
+struct sha512_hash_step {
+  using word_type                         = uint64_t;
+  static constexpr int message_chunk_size = 128;
+  static constexpr int state_words        = 8;
+  static constexpr int length_size        = 16;
+
+  word_type (&hash_values)[state_words];
+
+  static __device__ inline void initialize(word_type (&values)[state_words])
+  {
+    for (int i = 0; i < state_words; ++i) {
+      values[i] = sha512_initial_values[i];
+    }
+  }
+
+  void __device__ inline operator()(uint8_t const (&buffer)[message_chunk_size])
+  {
+    uint64_t w[16];
+    for (int i = 0; i < 16; ++i) {
+      w[i] = load_big_endian<uint64_t>(buffer + (i * 8));
+    }
+
+    uint64_t s[state_words];
+    for (int i = 0; i < state_words; ++i) {
+      s[i] = hash_values[i];
+    }
+
+    for (int t = 0; t < 80; ++t) {
+      if (t >= 16) {
+        auto const w15 = w[(t - 15) & 15];
+        auto const w2  = w[(t - 2) & 15];
+        auto const s0  = rotate_bits_right(w15, 1) ^ rotate_bits_right(w15, 8) ^ (w15 >> 7);
+        auto const s1  = rotate_bits_right(w2, 19) ^ rotate_bits_right(w2, 61) ^ (w2 >> 6);
+        w[t & 15] += s0 + w[(t - 7) & 15] + s1;
+      }
+      auto const e = s[4];
+      auto const S1 =
+        rotate_bits_right(e, 14) ^ rotate_bits_right(e, 18) ^ rotate_bits_right(e, 41);
+      auto const ch = (e & s[5]) ^ ((~e) & s[6]);
+      auto const t1 = s[7] + S1 + ch + sha512_hash_constants[t] + w[t & 15];
+      auto const a  = s[0];
+      auto const S0 =
+        rotate_bits_right(a, 28) ^ rotate_bits_right(a, 34) ^ rotate_bits_right(a, 39);
+      auto const maj = (a & s[1]) ^ (a & s[2]) ^ (s[1] & s[2]);
+      s[7]           = s[6];
+      s[6]           = s[5];
+      s[5]           = s[4];
+      s[4]           = s[3] + t1;
+      s[3]           = s[2];
+      s[2]           = s[1];
+      s[1]           = s[0];
+      s[0]           = t1 + S0 + maj;
+    }
+
+    for (int i = 0; i < state_words; ++i) {
+      hash_values[i] += s[i];
+    }
+  }
+};
+
+/**
+ * @brief Computes a SHA message digest of the elements passed to `process()`.
+ *
+ * Each row is hashed by a single thread: the compression function is inherently serial
+ * over the chunks of a message. Whole chunks of long strings are hashed directly from the
+ * column data so only the partial chunks at element boundaries are buffered.
+ *
+ * @tparam HashStep The compression function of the SHA algorithm
+ */
+template <typename HashStep>
+struct SHAHasher {
+  using word_type                         = typename HashStep::word_type;
+  static constexpr int message_chunk_size = HashStep::message_chunk_size;
+  static constexpr int digest_size        = HashStep::state_words * sizeof(word_type) * 2;
+
+  __device__ inline SHAHasher(char* result_location)
+    : result_location(result_location), buffer(HashStep{hash_values})
+  {
+    HashStep::initialize(hash_values);
+  }
+
+  __device__ inline ~SHAHasher()
+  {
+    // On destruction, finalize the message buffer and write out the current
+    // hexadecimal hash value to the result location.
+    // Add a one byte flag 0b10000000 to signal the end of the message.
+    uint8_t constexpr end_of_message = 0x80;
+    // The big-endian message length is appended to the end of the last chunk processed.
+    uint64_t const message_length_in_bits = swap_endian(message_length * 8);
+
+    buffer.put(&end_of_message, sizeof(end_of_message));
+    buffer.pad(HashStep::length_size);
+    if constexpr (HashStep::length_size > sizeof(message_length_in_bits)) {
+      // The high bits of the 128-bit SHA-512 message length are always zero
+      uint64_t const high_bits = 0;
+      buffer.put(reinterpret_cast<uint8_t const*>(&high_bits), sizeof(high_bits));
+    }
+    buffer.put(reinterpret_cast<uint8_t const*>(&message_length_in_bits),
+               sizeof(message_length_in_bits));
+
+    // The digest is the big-endian bytes of the hash values
+    auto out = result_location;
+    for (int i = 0; i < HashStep::state_words; ++i) {
+      if constexpr (sizeof(word_type) == sizeof(uint64_t)) {
+        uint32ToLowercaseHexString(swap_endian(static_cast<uint32_t>(hash_values[i] >> 32)), out);
+        out += 8;
+      }
+      uint32ToLowercaseHexString(swap_endian(static_cast<uint32_t>(hash_values[i])), out);
+      out += 8;
+    }
+  }
+
+  SHAHasher(const SHAHasher&) = delete;
+  SHAHasher& operator=(const SHAHasher&) = delete;
+  SHAHasher(SHAHasher&&)                 = delete;
+  SHAHasher& operator=(SHAHasher&&) = delete;
+
+  template <typename Element>
+  void __device__ inline process(Element const& element)
+  {
+    auto const normalized_element  = normalize_nans_and_zeros(element);
+    auto const [element_ptr, size] = get_element_pointer_and_size(normalized_element);
+    buffer.put(element_ptr, size);
+    message_length += size;
+  }
+
+  char* result_location;
+  hash_circular_buffer<message_chunk_size, HashStep> buffer;
+  uint64_t message_length = 0;
+  word_type hash_values[HashStep::state_words];
+};
+
+}  // namespace
+
+std::unique_ptr<column> sha1_hash(table_view const& input,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return digest_hash<SHAHasher<sha1_hash_step>>(input, stream, mr);
+}
+
+std::unique_ptr<column> sha256_hash(table_view const& input,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return digest_hash<SHAHasher<sha256_hash_step>>(input, stream, mr);
+}
+
+std::unique_ptr<column> sha512_hash(table_view const& input,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return digest_hash<SHAHasher<sha512_hash_step>>(input, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/hashing.hpp>
+#include <cudf/detail/utilities/algorithm.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_device_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <functional>
+
+namespace cudf {
+namespace detail {
+
+namespace {
+
+using xxhash_64_value_type = uint64_t;
+
+/**
+ * @brief Computes the 64-bit xxHash value of a row in the given table.
+ *
+ * The output hash of each element is used as the seed for hashing the next element
+ * of the row. Nested columns are hashed by serially hashing the size of each list
+ * and then each leaf element of the row. The seed value (the previous element's hash
+ * value) is returned as the hash if an element is null.
+ *
+ * @tparam hash_function Hash functor to use for hashing elements. Must be XXHash_64.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
+ */
+template <template <typename> class hash_function, typename Nullate>
+class xxhash_64_device_row_hasher {
+  friend class cudf::experimental::row::hash::row_hasher;  ///< Allow row_hasher to access private
+
+ public:
+  /**
+   * @brief Return the hash value of a row in the given table.
+   *
+   * @param row_index The row index to compute the hash value of
+   * @return The hash value of the row
+   */
+  __device__ xxhash_64_value_type operator()(size_type row_index) const noexcept
+  {
+    return detail::accumulate(
+      _table.begin(),
+      _table.end(),
+      _seed,
+      [row_index, nulls = this->_check_nulls] __device__(auto hash, auto column) {
+        return cudf::type_dispatcher(
+          column.type(), element_hasher_adapter{nulls, hash}, column, row_index);
+      });
+  }
+
+ private:
+  /**
+   * @brief Computes the hash value of an element in the given column.
+   */
+  class element_hasher_adapter {
+   public:
+    __device__ element_hasher_adapter(Nullate check_nulls, xxhash_64_value_type seed) noexcept
+      : _check_nulls(check_nulls), _seed(seed)
+    {
+    }
+
+    template <typename T, CUDF_ENABLE_IF(column_device_view::has_element_accessor<T>())>
+    __device__ xxhash_64_value_type operator()(column_device_view const& col,
+                                               size_type row_index) const noexcept
+    {
+      if (_check_nulls && col.is_null(row_index)) { return _seed; }
+      return hash_function<T>{_seed}(col.element<T>(row_index));
+    }
+
+    template <typename T, CUDF_ENABLE_IF(cudf::is_nested<T>())>
+    __device__ xxhash_64_value_type operator()(column_device_view const& col,
+                                               size_type row_index) const noexcept
+    {
+      if (_check_nulls && col.is_null(row_index)) { return _seed; }
+      auto hash                   = _seed;
+      column_device_view curr_col = col.slice(row_index, 1);
+      while (is_nested(curr_col.type())) {
+        if (curr_col.type().id() == type_id::STRUCT) {
+          if (curr_col.num_child_columns() == 0) { return hash; }
+          // Non-empty structs are assumed to be decomposed and contain only one child
+          curr_col = detail::structs_column_device_view(curr_col).get_sliced_child(0);
+        } else if (curr_col.type().id() == type_id::LIST) {
+          // the list sizes are hashed so [[1], [2]] and [[1, 2]] are not the same
+          auto list_col   = detail::lists_column_device_view(curr_col);
+          auto list_sizes = make_list_size_iterator(list_col);
+          hash            = detail::accumulate(
+            list_sizes, list_sizes + list_col.size(), hash, [](auto hash, auto size) {
+              return hash_function<size_type>{hash}(size);
+            });
+          curr_col = list_col.get_sliced_child();
+        }
+      }
+      return detail::accumulate(
+        thrust::counting_iterator(0),
+        thrust::counting_iterator(curr_col.size()),
+        hash,
+        [curr_col, nulls = this->_check_nulls] __device__(auto hash, auto element_index) {
+          return cudf::type_dispatcher<cudf::experimental::dispatch_void_if_nested>(
+            curr_col.type(), element_hasher_adapter{nulls, hash}, curr_col, element_index);
+        });
+    }
+
+    template <typename T,
+              CUDF_ENABLE_IF(not column_device_view::has_element_accessor<T>() and
+                             not cudf::is_nested<T>())>
+    __device__ xxhash_64_value_type operator()(column_device_view const&,
+                                               size_type) const noexcept
+    {
+      CUDF_UNREACHABLE("Unsupported type in hash.");
+    }
+
+    Nullate const _check_nulls;         ///< Whether to check for nulls
+    xxhash_64_value_type const _seed;  ///< The seed to use for hashing, also returned for nulls
+  };
+
+  CUDF_HOST_DEVICE xxhash_64_device_row_hasher(Nullate check_nulls,
+                                               table_device_view t,
+                                               uint32_t seed = DEFAULT_HASH_SEED) noexcept
+    : _check_nulls{check_nulls}, _table{t}, _seed(seed)
+  {
+    // Error out if passed an unsupported hash_function
+    static_assert(std::is_base_of_v<XXHash_64<int>, hash_function<int>>,
+                  "xxhash_64_device_row_hasher only supports the XXHash_64 hash function");
+  }
+
+  Nullate const _check_nulls;
+  table_device_view const _table;
+  xxhash_64_value_type const _seed;
+};
+
+void check_hash_compatibility(table_view const& input)
+{
+  using column_checker_fn_t = std::function<void(column_view const&)>;
+
+  column_checker_fn_t check_column = [&](column_view const& c) {
+    if (c.type().id() == type_id::LIST) {
+      auto const& list_col = lists_column_view(c);
+      CUDF_EXPECTS(list_col.child().type().id() != type_id::STRUCT,
+                   "Cannot compute hash of a table with a LIST of STRUCT columns.");
+      check_column(list_col.child());
+    } else if (c.type().id() == type_id::STRUCT) {
+      for (auto child = c.child_begin(); child != c.child_end(); ++child) {
+        check_column(*child);
+      }
+    }
+  };
+
+  for (column_view const& c : input) {
+    check_column(c);
+  }
+}
+
+}  // namespace
+
+std::unique_ptr<column> xxhash_64(table_view const& input,
+                                  uint32_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto output = make_numeric_column(data_type(type_to_id<xxhash_64_value_type>()),
+                                    input.num_rows(),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+
+  // Return early if there's nothing to hash
+  if (input.num_columns() == 0 || input.num_rows() == 0) { return output; }
+
+  // Lists of structs are not supported
+  check_hash_compatibility(input);
+
+  bool const nullable   = has_nested_nulls(input);
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
+  auto output_view      = output->mutable_view();
+
+  // Compute the hash value for each row
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    output_view.begin<xxhash_64_value_type>(),
+    output_view.end<xxhash_64_value_type>(),
+    row_hasher.device_hasher<XXHash_64, xxhash_64_device_row_hasher>(nullable, seed));
+
+  return output;
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -14,7 +14,15 @@
  * limitations under the License.
  */
 
+#include "arrow_allocator.hpp"
+
+#include <io/utilities/pinned_memory_pool.hpp>
+
 #include <cudf/detail/interop.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstring>
 
 namespace cudf {
 namespace detail {
@@ -47,5 +55,55 @@ std::shared_ptr<arrow::Buffer> allocate_arrow_bitmap(const int64_t size, arrow::
   return std::move(result).ValueOrDie();
 }
 
+namespace {
+
+/**
+ * @brief A chunk of pinned host memory from the shared pool, freed with its last slice.
+ */
+class pinned_chunk : public arrow::MutableBuffer {
+ public:
+  explicit pinned_chunk(std::size_t size)
+    : arrow::MutableBuffer{
+        static_cast<uint8_t*>(cudf::io::detail::pinned_host_pool().allocate(size)),
+        static_cast<int64_t>(size)}
+  {
+  }
+  ~pinned_chunk() override
+  {
+    cudf::io::detail::pinned_host_pool().deallocate(mutable_data(),
+                                                    static_cast<std::size_t>(size()));
+  }
+};
+
+}  // namespace
+
+std::shared_ptr<arrow::Buffer> arrow_host_allocator::allocate_buffer(int64_t size)
+{
+  if (_ar_mr != nullptr) { return allocate_arrow_buffer(size, _ar_mr); }
+
+  // buffers keep the alignment and padding arrow allocates its own buffers with
+  auto const padded_size = static_cast<std::size_t>(
+    (size + arrow::kDefaultBufferAlignment - 1) / arrow::kDefaultBufferAlignment *
+    arrow::kDefaultBufferAlignment);
+  if (_chunk == nullptr or _chunk_used + padded_size > static_cast<std::size_t>(_chunk->size())) {
+    _chunk = std::make_shared<pinned_chunk>(
+      std::max({_chunk_size, padded_size, std::size_t{arrow::kDefaultBufferAlignment}}));
+    _chunk_used = 0;
+  }
+  auto buffer = arrow::SliceMutableBuffer(_chunk, static_cast<int64_t>(_chunk_used), size);
+  // the padding is zeroed like arrow does, the data is written by the copies from the device
+  if (padded_size > static_cast<std::size_t>(size)) {
+    std::memset(buffer->mutable_data() + size, 0, padded_size - size);
+  }
+  _chunk_used += padded_size;
+  return buffer;
+}
+
+std::shared_ptr<arrow::Buffer> arrow_host_allocator::allocate_bitmap(int64_t length)
+{
+  if (_ar_mr != nullptr) { return allocate_arrow_bitmap(length, _ar_mr); }
+  return allocate_buffer((length + 7) / 8);
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,9 @@
 
 #include <cudf/detail/interop.hpp>
 
+#include <cstddef>
+#include <memory>
+
 namespace cudf {
 namespace detail {
 
@@ -27,5 +30,46 @@ std::unique_ptr<arrow::Buffer> allocate_arrow_buffer(const int64_t size, arrow::
 // shared_ptr because that is what AllocateBitmap returns
 std::shared_ptr<arrow::Buffer> allocate_arrow_bitmap(const int64_t size, arrow::MemoryPool* ar_mr);
 
+/**
+ * @brief Allocates the host buffers of the arrow arrays created by `to_arrow`.
+ *
+ * The buffers come either from an arrow memory pool or from an arena of pinned host memory. An
+ * arena sub-allocates the buffers from chunks of the shared pinned host memory pool, so that the
+ * device-to-host copies into them are asynchronous and no further copy is needed to wrap them.
+ * Each buffer keeps its chunk alive.
+ */
+class arrow_host_allocator {
+ public:
+  /**
+   * @brief Construct an allocator using an arrow memory pool.
+   *
+   * @param ar_mr The arrow memory pool
+   */
+  explicit arrow_host_allocator(arrow::MemoryPool* ar_mr) : _ar_mr{ar_mr} {}
+
+  /**
+   * @brief Construct an allocator using a pinned arena.
+   *
+   * @param chunk_size Size of the first chunk of the arena, further chunks are allocated on demand
+   */
+  explicit arrow_host_allocator(std::size_t chunk_size) : _chunk_size{chunk_size} {}
+
+  /**
+   * @brief Allocates a buffer of `size` bytes.
+   */
+  std::shared_ptr<arrow::Buffer> allocate_buffer(int64_t size);
+
+  /**
+   * @brief Allocates a bitmap of `length` bits.
+   */
+  std::shared_ptr<arrow::Buffer> allocate_bitmap(int64_t length);
+
+ private:
+  arrow::MemoryPool* _ar_mr = nullptr;
+  std::size_t _chunk_size   = 0;
+  std::shared_ptr<arrow::Buffer> _chunk;
+  std::size_t _chunk_used = 0;
+};
+
 }  // namespace detail
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/lists/list_view.hpp>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -127,28 +128,58 @@ struct dltensor_context {
   }
 };
 
-}  // namespace
-
-namespace detail {
-std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
-                                   rmm::cuda_stream_view stream,
-                                   rmm::mr::device_memory_resource* mr)
+/**
+ * @brief Creates a column-major DLPack tensor that takes ownership of `buffer`.
+ */
+DLManagedTensor* make_managed_tensor(rmm::device_buffer&& buffer,
+                                     data_type type,
+                                     size_type num_rows,
+                                     size_type num_cols)
 {
-  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
-  auto const& tensor = managed_tensor->dl_tensor;
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
 
-  // We can copy from host or device pointers
-  CUDF_EXPECTS(tensor.device.device_type == kDLCPU || tensor.device.device_type == kDLCUDA ||
-                 tensor.device.device_type == kDLCUDAHost,
-               "DLTensor device type must be CPU, CUDA or CUDAHost");
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = data_type_to_DLDataType(type);
 
-  // Make sure the current device ID matches the Tensor's device ID
-  if (tensor.device.device_type != kDLCPU) {
-    int device_id = 0;
-    CUDF_CUDA_TRY(cudaGetDevice(&device_id));
-    CUDF_EXPECTS(tensor.device.device_id == device_id, "DLTensor device ID must be current device");
+  tensor.ndim     = (num_cols > 1) ? 2 : 1;
+  tensor.shape    = context->shape;
+  tensor.shape[0] = num_rows;
+  if (tensor.ndim > 1) {
+    tensor.shape[1]   = num_cols;
+    tensor.strides    = context->strides;
+    tensor.strides[0] = 1;
+    tensor.strides[1] = num_rows;
   }
 
+  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  context->buffer = std::move(buffer);
+  tensor.data     = context->buffer.data();
+
+  // Defer ownership of managed tensor to caller
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+/**
+ * @brief Layout of a DLTensor whose columns can be read as cudf columns
+ */
+struct tensor_layout {
+  data_type type;
+  size_type num_rows;
+  size_type num_columns;
+  uintptr_t data;             ///< Address of the first column
+  std::size_t column_stride;  ///< Number of bytes between the start of consecutive columns
+};
+
+/**
+ * @brief Validates the layout of a DLTensor and returns it.
+ */
+tensor_layout get_tensor_layout(DLTensor const& tensor)
+{
   // We only support 1D and 2D tensors with some restrictions on layout
   if (tensor.ndim == 1) {
     // 1D tensors must have dense layout (strides == nullptr <=> dense row-major)
@@ -176,14 +207,13 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
     CUDF_EXPECTS(tensor.shape[1] < std::numeric_limits<size_type>::max(),
                  "DLTensor second dim exceeds size supported by cudf");
   }
-  size_t const num_columns = (tensor.ndim == 2) ? static_cast<size_t>(tensor.shape[1]) : 1;
+  auto const num_columns = (tensor.ndim == 2) ? static_cast<size_type>(tensor.shape[1]) : 1;
 
   // Validate and convert data type to cudf
   data_type const dtype = DLDataType_to_data_type(tensor.dtype);
 
   size_t const byte_width = size_of(dtype);
-  auto const num_rows     = static_cast<size_t>(tensor.shape[0]);
-  size_t const bytes      = num_rows * byte_width;
+  auto const num_rows     = static_cast<size_type>(tensor.shape[0]);
 
   // For 2D tensors, if the strides pointer is not null, then strides[1] is the
   // number of elements (not bytes) between the start of each column
@@ -191,12 +221,45 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                               ? byte_width * tensor.strides[1]
                               : byte_width * num_rows;
 
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset;
+  return {dtype,
+          num_rows,
+          num_columns,
+          reinterpret_cast<uintptr_t>(tensor.data) + tensor.byte_offset,
+          col_stride};
+}
+
+}  // namespace
+
+namespace detail {
+std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  // We can copy from host or device pointers
+  CUDF_EXPECTS(tensor.device.device_type == kDLCPU || tensor.device.device_type == kDLCUDA ||
+                 tensor.device.device_type == kDLCUDAHost,
+               "DLTensor device type must be CPU, CUDA or CUDAHost");
+
+  // Make sure the current device ID matches the Tensor's device ID
+  if (tensor.device.device_type != kDLCPU) {
+    int device_id = 0;
+    CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+    CUDF_EXPECTS(tensor.device.device_id == device_id, "DLTensor device ID must be current device");
+  }
+
+  auto const layout        = get_tensor_layout(tensor);
+  size_t const num_columns = layout.num_columns;
+  auto const num_rows      = layout.num_rows;
+  size_t const bytes       = num_rows * size_of(layout.type);
+  auto tensor_data         = layout.data;
 
   // Allocate columns and copy data from tensor
   std::vector<std::unique_ptr<column>> columns(num_columns);
   for (auto& col : columns) {
-    col = make_numeric_column(dtype, num_rows, mask_state::UNALLOCATED, stream, mr);
+    col = make_numeric_column(layout.type, num_rows, mask_state::UNALLOCATED, stream, mr);
 
     CUDF_CUDA_TRY(cudaMemcpyAsync(col->mutable_view().head<void>(),
                                   reinterpret_cast<void*>(tensor_data),
@@ -204,7 +267,7 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                   cudaMemcpyDefault,
                                   stream.value()));
 
-    tensor_data += col_stride;
+    tensor_data += layout.column_stride;
   }
 
   return std::make_unique<table>(std::move(columns));
@@ -219,8 +282,8 @@ DLManagedTensor* to_dlpack(table_view const& input,
   if (num_rows == 0) { return nullptr; }
 
   // Ensure that type is convertible to DLDataType
-  data_type const type    = input.column(0).type();
-  DLDataType const dltype = data_type_to_DLDataType(type);
+  data_type const type = input.column(0).type();
+  data_type_to_DLDataType(type);
 
   // Ensure all columns are the same type
   CUDF_EXPECTS(
@@ -232,41 +295,21 @@ DLManagedTensor* to_dlpack(table_view const& input,
     std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
     "Input required to have null count zero");
 
-  auto managed_tensor = std::make_unique<DLManagedTensor>();
-  auto context        = std::make_unique<dltensor_context>();
-
-  DLTensor& tensor = managed_tensor->dl_tensor;
-  tensor.dtype     = dltype;
-
-  tensor.ndim     = (num_cols > 1) ? 2 : 1;
-  tensor.shape    = context->shape;
-  tensor.shape[0] = num_rows;
-  if (tensor.ndim > 1) {
-    tensor.shape[1]   = num_cols;
-    tensor.strides    = context->strides;
-    tensor.strides[0] = 1;
-    tensor.strides[1] = num_rows;
-  }
-
-  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
-  tensor.device.device_type = kDLCUDA;
-
   // If there is only one column, then a 1D tensor can just copy the pointer
   // to the data in the column, and the deleter should not delete the original
   // data. However, this is inconsistent with the 2D cases where we must do a
   // copy of each column's data into the dense tensor array. Also, if we don't
   // copy, then the original column data could be changed, which would change
   // the contents of the tensor, which might be surprising or cause issues.
-  // Therefore, for now we ALWAYS do a copy of the data. If this becomes
-  // a performance issue we can reevaluate in the future.
+  // Therefore, for now we ALWAYS do a copy of the data. Callers that build the
+  // table only to export it can write it directly into a `dlpack_matrix`.
 
   size_t const stride_bytes = num_rows * size_of(type);
   size_t const total_bytes  = stride_bytes * num_cols;
 
-  context->buffer = rmm::device_buffer(total_bytes, stream, mr);
-  tensor.data     = context->buffer.data();
+  rmm::device_buffer buffer(total_bytes, stream, mr);
 
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
+  auto tensor_data = reinterpret_cast<uintptr_t>(buffer.data());
   for (auto const& col : input) {
     CUDF_CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
                                   get_column_data(col),
@@ -276,20 +319,90 @@ DLManagedTensor* to_dlpack(table_view const& input,
     tensor_data += stride_bytes;
   }
 
-  // Defer ownership of managed tensor to caller
-  managed_tensor->deleter     = dltensor_context::deleter;
-  managed_tensor->manager_ctx = context.release();
+  auto managed_tensor = make_managed_tensor(std::move(buffer), type, num_rows, num_cols);
 
   // synchronize the stream because after the return the data may be accessed from the host before
   // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
   // memory is used).
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
-  return managed_tensor.release();
+  return managed_tensor;
+}
+
+table_view view_from_dlpack(DLManagedTensor const* managed_tensor)
+{
+  CUDF_EXPECTS(nullptr != managed_tensor, "managed_tensor is null");
+  auto const& tensor = managed_tensor->dl_tensor;
+
+  CUDF_EXPECTS(tensor.device.device_type == kDLCUDA, "DLTensor device type must be CUDA");
+  int device_id = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(tensor.device.device_id == device_id, "DLTensor device ID must be current device");
+
+  auto const layout = get_tensor_layout(tensor);
+  auto const width  = size_of(layout.type);
+  CUDF_EXPECTS(layout.data % width == 0 and layout.column_stride % width == 0,
+               "DLTensor columns must be aligned to their data type");
+
+  std::vector<column_view> columns;
+  columns.reserve(layout.num_columns);
+  for (size_type i = 0; i < layout.num_columns; ++i) {
+    columns.emplace_back(layout.type,
+                         layout.num_rows,
+                         reinterpret_cast<void const*>(layout.data + i * layout.column_stride));
+  }
+  return table_view{columns};
 }
 
 }  // namespace detail
 
+dlpack_matrix::dlpack_matrix(data_type type,
+                             size_type num_rows,
+                             size_type num_columns,
+                             rmm::mr::device_memory_resource* mr)
+  : _type{type}, _num_rows{num_rows}, _num_columns{num_columns}
+{
+  data_type_to_DLDataType(type);
+  CUDF_EXPECTS(num_rows >= 0 and num_columns >= 0, "Invalid dlpack_matrix dimensions");
+  _buffer = rmm::device_buffer(static_cast<std::size_t>(num_rows) * num_columns * size_of(type),
+                               cudf::default_stream_value,
+                               mr);
+}
+
+mutable_table_view dlpack_matrix::mutable_view()
+{
+  auto const stride = static_cast<std::size_t>(_num_rows) * size_of(_type);
+  std::vector<mutable_column_view> columns;
+  for (size_type i = 0; i < _num_columns; ++i) {
+    columns.emplace_back(_type, _num_rows, static_cast<uint8_t*>(_buffer.data()) + i * stride);
+  }
+  return mutable_table_view{columns};
+}
+
+table_view dlpack_matrix::view() const
+{
+  auto const stride = static_cast<std::size_t>(_num_rows) * size_of(_type);
+  std::vector<column_view> columns;
+  for (size_type i = 0; i < _num_columns; ++i) {
+    columns.emplace_back(
+      _type, _num_rows, static_cast<uint8_t const*>(_buffer.data()) + i * stride);
+  }
+  return table_view{columns};
+}
+
+DLManagedTensor* dlpack_matrix::release()
+{
+  if (_num_rows == 0 or _num_columns == 0) { return nullptr; }
+  auto managed_tensor = make_managed_tensor(std::move(_buffer), _type, _num_rows, _num_columns);
+  _num_rows = _num_columns = 0;
+
+  // the data may be accessed from the host or another stream after the return, like the data of
+  // the tensors from `to_dlpack`
+  cudf::detail::synchronize_stream(cudf::default_stream_value);
+
+  return managed_tensor;
+}
+
 std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::mr::device_memory_resource* mr)
 {
@@ -301,4 +414,9 @@ DLManagedTensor* to_dlpack(table_view const& input, rmm::mr::device_memory_resou
   return detail::to_dlpack(input, cudf::default_stream_value, mr);
 }
 
+table_view view_from_dlpack(DLManagedTensor const* managed_tensor)
+{
+  return detail::view_from_dlpack(managed_tensor);
+}
+
 }  // namespace cudf
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the cudf type of a fixed-width Arrow format, or `EMPTY` if it is not one.
+ */
+data_type fixed_width_type(std::string const& format)
+{
+  if (format.size() == 1) {
+    switch (format[0]) {
+      case 'c': return data_type{type_id::INT8};
+      case 's': return data_type{type_id::INT16};
+      case 'i': return data_type{type_id::INT32};
+      case 'l': return data_type{type_id::INT64};
+      case 'C': return data_type{type_id::UINT8};
+      case 'S': return data_type{type_id::UINT16};
+      case 'I': return data_type{type_id::UINT32};
+      case 'L': return data_type{type_id::UINT64};
+      case 'f': return data_type{type_id::FLOAT32};
+      case 'g': return data_type{type_id::FLOAT64};
+      default: break;
+    }
+  }
+  if (format == "tdD") { return data_type{type_id::TIMESTAMP_DAYS}; }
+  // timestamps may be followed by a timezone, which cudf does not keep
+  if (format.rfind("tss:", 0) == 0) { return data_type{type_id::TIMESTAMP_SECONDS}; }
+  if (format.rfind("tsm:", 0) == 0) { return data_type{type_id::TIMESTAMP_MILLISECONDS}; }
+  if (format.rfind("tsu:", 0) == 0) { return data_type{type_id::TIMESTAMP_MICROSECONDS}; }
+  if (format.rfind("tsn:", 0) == 0) { return data_type{type_id::TIMESTAMP_NANOSECONDS}; }
+  if (format == "tDs") { return data_type{type_id::DURATION_SECONDS}; }
+  if (format == "tDm") { return data_type{type_id::DURATION_MILLISECONDS}; }
+  if (format == "tDu") { return data_type{type_id::DURATION_MICROSECONDS}; }
+  if (format == "tDn") { return data_type{type_id::DURATION_NANOSECONDS}; }
+  if (format.rfind("d:", 0) == 0) {
+    // "d:precision,scale[,bitwidth]", where the bitwidth defaults to 128
+    auto const first  = format.find(',');
+    auto const second = format.find(',', first + 1);
+    CUDF_EXPECTS(first != std::string::npos, "Invalid arrow decimal format");
+    auto const scale = std::stoi(format.substr(first + 1, second - first - 1));
+    auto const bitwidth =
+      second == std::string::npos ? 128 : std::stoi(format.substr(second + 1));
+    switch (bitwidth) {
+      case 32: return data_type{type_id::DECIMAL32, -scale};
+      case 64: return data_type{type_id::DECIMAL64, -scale};
+      case 128: return data_type{type_id::DECIMAL128, -scale};
+      default: CUDF_FAIL("Unsupported arrow decimal bitwidth");
+    }
+  }
+  return data_type{type_id::EMPTY};
+}
+
+/**
+ * @brief Imports Arrow arrays as column views, keeping the columns it had to create.
+ */
+struct device_array_importer {
+  rmm::cuda_stream_view stream;
+  rmm::mr::device_memory_resource* mr;
+  std::vector<std::unique_ptr<column>> owned;
+
+  /**
+   * @brief Returns an owned offsets column holding a single zero, for empty arrays whose offsets
+   * buffer is null.
+   */
+  column_view zero_offsets()
+  {
+    owned.push_back(make_fixed_width_column(
+      data_type{type_to_id<offset_type>()}, 1, mask_state::UNALLOCATED, stream, mr));
+    auto view = owned.back()->mutable_view();
+    CUDF_CUDA_TRY(
+      cudaMemsetAsync(view.head<offset_type>(), 0, sizeof(offset_type), stream.value()));
+    return owned.back()->view();
+  }
+
+  /**
+   * @brief Imports `length` rows of an array, starting `extra_offset` rows past its own offset.
+   */
+  column_view operator()(ArrowSchema const* schema,
+                         ArrowArray const* array,
+                         int64_t extra_offset,
+                         int64_t length)
+  {
+    CUDF_EXPECTS(schema->dictionary == nullptr and array->dictionary == nullptr,
+                 "Arrow dictionaries are not supported");
+    auto const offset = array->offset + extra_offset;
+    CUDF_EXPECTS(offset + length <= std::numeric_limits<size_type>::max(),
+                 "Arrow array exceeds the column size limit");
+    auto const size = static_cast<size_type>(length);
+
+    std::string const format{schema->format};
+    if (format == "n") { return column_view{data_type{type_id::EMPTY}, size, nullptr}; }
+
+    auto const* null_mask = static_cast<bitmask_type const*>(array->buffers[0]);
+    auto const null_count = [&] {
+      if (null_mask == nullptr) { return size_type{0}; }
+      if (extra_offset != 0 or length != array->length or array->null_count < 0) {
+        return UNKNOWN_NULL_COUNT;
+      }
+      return static_cast<size_type>(array->null_count);
+    }();
+
+    if (format == "b") {
+      // Arrow booleans are bit-packed, so they are converted into a column owned by the view
+      auto bools = detail::mask_to_bools(static_cast<bitmask_type const*>(array->buffers[1]),
+                                         offset,
+                                         offset + size,
+                                         stream,
+                                         mr);
+      if (null_mask != nullptr) {
+        bools->set_null_mask(detail::copy_bitmask(null_mask, offset, offset + size, stream, mr),
+                             null_count);
+      }
+      owned.push_back(std::move(bools));
+      return owned.back()->view();
+    }
+
+    auto const type = fixed_width_type(format);
+    if (type.id() != type_id::EMPTY) {
+      return column_view{type, size, array->buffers[1], null_mask, null_count, offset};
+    }
+
+    if (format == "u") {
+      if (array->buffers[1] == nullptr) {
+        CUDF_EXPECTS(offset + size == 0, "Missing arrow string offsets");
+        return column_view{data_type{type_id::STRING}, 0, nullptr};
+      }
+      auto const* offsets = static_cast<offset_type const*>(array->buffers[1]);
+      offset_type chars_size{};
+      CUDF_CUDA_TRY(cudaMemcpyAsync(&chars_size,
+                                    offsets + offset + size,
+                                    sizeof(offset_type),
+                                    cudaMemcpyDeviceToHost,
+                                    stream.value()));
+      cudf::detail::synchronize_stream(stream);
+      // the offsets are not sliced, cudf applies the offset of the parent to them
+      auto const offsets_view = column_view{
+        data_type{type_to_id<offset_type>()}, static_cast<size_type>(offset + size + 1), offsets};
+      auto const chars_view =
+        column_view{data_type{type_id::INT8}, chars_size, array->buffers[2]};
+      return column_view{data_type{type_id::STRING},
+                         size,
+                         nullptr,
+                         null_mask,
+                         null_count,
+                         static_cast<size_type>(offset),
+                         {offsets_view, chars_view}};
+    }
+
+    if (format == "+l") {
+      CUDF_EXPECTS(schema->n_children == 1 and array->n_children == 1,
+                   "Arrow list must have exactly one child");
+      auto const child =
+        (*this)(schema->children[0], array->children[0], 0, array->children[0]->length);
+      CUDF_EXPECTS(array->buffers[1] != nullptr or offset + size == 0,
+                   "Missing arrow list offsets");
+      auto const offsets_view = array->buffers[1] == nullptr
+                                  ? zero_offsets()
+                                  : column_view{data_type{type_to_id<offset_type>()},
+                                                static_cast<size_type>(offset + size + 1),
+                                                array->buffers[1]};
+      return column_view{data_type{type_id::LIST},
+                         size,
+                         nullptr,
+                         null_mask,
+                         null_count,
+                         static_cast<size_type>(offset),
+                         {offsets_view, child}};
+    }
+
+    if (format == "+s") {
+      CUDF_EXPECTS(schema->n_children == array->n_children,
+                   "Arrow struct schema and array have different numbers of children");
+      std::vector<column_view> children;
+      for (int64_t i = 0; i < array->n_children; ++i) {
+        // cudf applies the offset of a struct to its children, which cannot have their own
+        CUDF_EXPECTS(array->children[i]->offset == 0,
+                     "Children of arrow structs with an offset are not supported");
+        children.push_back(
+          (*this)(schema->children[i], array->children[i], 0, array->children[i]->length));
+      }
+      return column_view{data_type{type_id::STRUCT},
+                         size,
+                         nullptr,
+                         null_mask,
+                         null_count,
+                         static_cast<size_type>(offset),
+                         children};
+    }
+
+    CUDF_FAIL("Unsupported arrow format: " + format);
+  }
+};
+
+}  // namespace
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(schema != nullptr and input != nullptr, "Null arrow schema or array");
+  CUDF_EXPECTS(input->device_type == ARROW_DEVICE_CUDA or
+                 input->device_type == ARROW_DEVICE_CUDA_MANAGED,
+               "Arrow array must be in CUDA device memory");
+  int device_id{};
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  CUDF_EXPECTS(input->device_id == device_id, "Arrow array must be on the current device");
+  if (input->sync_event != nullptr) {
+    CUDF_CUDA_TRY(
+      cudaStreamWaitEvent(stream.value(), *static_cast<cudaEvent_t*>(input->sync_event)));
+  }
+
+  auto const& root = input->array;
+  CUDF_EXPECTS(std::string{schema->format} == "+s", "Arrow table must be a struct array");
+  CUDF_EXPECTS(schema->n_children == root.n_children,
+               "Arrow struct schema and array have different numbers of children");
+  CUDF_EXPECTS(root.buffers[0] == nullptr or root.null_count == 0,
+               "Arrow table cannot have null rows");
+
+  device_array_importer importer{stream, mr, {}};
+  std::vector<column_view> columns;
+  for (int64_t i = 0; i < root.n_children; ++i) {
+    columns.push_back(importer(schema->children[i], root.children[i], root.offset, root.length));
+  }
+
+  return unique_table_view_t{new table_view{columns},
+                             custom_view_deleter<table_view>{std::move(importer.owned)}};
+}
+
+}  // namespace detail
+
+unique_table_view_t from_arrow_device(ArrowSchema const* schema,
+                                      ArrowDeviceArray const* input,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_arrow_device(schema, input, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
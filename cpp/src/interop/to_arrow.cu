@@ -18,8 +18,10 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/interop.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
@@ -36,6 +38,9 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <cstring>
+#include <numeric>
+
 #include "detail/arrow_allocator.hpp"
 
 namespace cudf {
@@ -47,12 +52,12 @@ namespace {
  */
 template <typename T>
 std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
-                                                 arrow::MemoryPool* ar_mr,
+                                                 arrow_host_allocator& ar_mr,
                                                  rmm::cuda_stream_view stream)
 {
   const int64_t data_size_in_bytes = sizeof(T) * input_view.size();
 
-  auto data_buffer = allocate_arrow_buffer(data_size_in_bytes, ar_mr);
+  auto data_buffer = ar_mr.allocate_buffer(data_size_in_bytes);
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
                                 input_view.data<T>(),
@@ -67,19 +72,19 @@ std::shared_ptr<arrow::Buffer> fetch_data_buffer(column_view input_view,
  * @brief Create arrow buffer of mask from given cudf column
  */
 std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
-                                                 arrow::MemoryPool* ar_mr,
+                                                 arrow_host_allocator& ar_mr,
                                                  rmm::cuda_stream_view stream)
 {
-  const int64_t mask_size_in_bytes = cudf::bitmask_allocation_size_bytes(input_view.size());
-
   if (input_view.has_nulls()) {
-    auto mask_buffer = allocate_arrow_bitmap(static_cast<int64_t>(input_view.size()), ar_mr);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(
-      mask_buffer->mutable_data(),
-      (input_view.offset() > 0) ? cudf::copy_bitmask(input_view).data() : input_view.null_mask(),
-      mask_size_in_bytes,
-      cudaMemcpyDeviceToHost,
-      stream.value()));
+    auto mask_buffer = ar_mr.allocate_bitmap(static_cast<int64_t>(input_view.size()));
+    // only the bytes of the arrow bitmap are copied, so that the copy never writes to its padding
+    CUDF_CUDA_TRY(cudaMemcpyAsync(mask_buffer->mutable_data(),
+                                  (input_view.offset() > 0)
+                                    ? detail::copy_bitmask(input_view, stream).data()
+                                    : input_view.null_mask(),
+                                  mask_buffer->size(),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.value()));
 
     // Resets all padded bits to 0
     mask_buffer->ZeroPadding();
@@ -100,7 +105,7 @@ struct dispatch_to_arrow {
   std::vector<std::shared_ptr<arrow::Array>> fetch_child_array(
     column_view input_view,
     std::vector<column_metadata> const& metadata,
-    arrow::MemoryPool* ar_mr,
+    arrow_host_allocator& ar_mr,
     rmm::cuda_stream_view stream)
   {
     std::vector<std::shared_ptr<arrow::Array>> child_arrays;
@@ -117,8 +122,11 @@ struct dispatch_to_arrow {
   }
 
   template <typename T, CUDF_ENABLE_IF(not is_rep_layout_compatible<T>())>
-  std::shared_ptr<arrow::Array> operator()(
-    column_view, cudf::type_id, column_metadata const&, arrow::MemoryPool*, rmm::cuda_stream_view)
+  std::shared_ptr<arrow::Array> operator()(column_view,
+                                           cudf::type_id,
+                                           column_metadata const&,
+                                           arrow_host_allocator&,
+                                           rmm::cuda_stream_view)
   {
     CUDF_FAIL("Unsupported type for to_arrow.");
   }
@@ -127,7 +135,7 @@ struct dispatch_to_arrow {
   std::shared_ptr<arrow::Array> operator()(column_view input_view,
                                            cudf::type_id id,
                                            column_metadata const&,
-                                           arrow::MemoryPool* ar_mr,
+                                           arrow_host_allocator& ar_mr,
                                            rmm::cuda_stream_view stream)
   {
     return to_arrow_array(id,
@@ -143,7 +151,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
   column_view input,
   cudf::type_id,
   column_metadata const&,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   using DeviceType                = int64_t;
@@ -162,7 +170,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
                    });
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
-  auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
+  auto data_buffer             = ar_mr.allocate_buffer(buf_size_in_bytes);
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
                                 buf.data(),
@@ -183,7 +191,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
   column_view input,
   cudf::type_id,
   column_metadata const&,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   using DeviceType = __int128_t;
@@ -196,7 +204,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
                buf.begin());
 
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
-  auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
+  auto data_buffer             = ar_mr.allocate_buffer(buf_size_in_bytes);
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
                                 buf.data(),
@@ -216,12 +224,12 @@ template <>
 std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<bool>(column_view input,
                                                                   cudf::type_id id,
                                                                   column_metadata const&,
-                                                                  arrow::MemoryPool* ar_mr,
+                                                                  arrow_host_allocator& ar_mr,
                                                                   rmm::cuda_stream_view stream)
 {
   auto bitmask = bools_to_mask(input, stream);
 
-  auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask.first->size()), ar_mr);
+  auto data_buffer = ar_mr.allocate_buffer(static_cast<int64_t>(bitmask.first->size()));
 
   CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
                                 bitmask.first->data(),
@@ -240,7 +248,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   column_view input,
   cudf::type_id,
   column_metadata const&,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   std::unique_ptr<column> tmp_column =
@@ -253,9 +261,9 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
   auto child_arrays      = fetch_child_array(input_view, {{}, {}}, ar_mr, stream);
   if (child_arrays.empty()) {
     // Empty string will have only one value in offset of 4 bytes
-    auto tmp_offset_buffer               = allocate_arrow_buffer(4, ar_mr);
-    auto tmp_data_buffer                 = allocate_arrow_buffer(0, ar_mr);
-    tmp_offset_buffer->mutable_data()[0] = 0;
+    auto tmp_offset_buffer = ar_mr.allocate_buffer(4);
+    auto tmp_data_buffer   = ar_mr.allocate_buffer(0);
+    std::memset(tmp_offset_buffer->mutable_data(), 0, 4);
 
     return std::make_shared<arrow::StringArray>(
       0, std::move(tmp_offset_buffer), std::move(tmp_data_buffer));
@@ -274,7 +282,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::struct_view>(
   column_view input,
   cudf::type_id,
   column_metadata const& metadata,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   CUDF_EXPECTS(metadata.children_meta.size() == static_cast<std::size_t>(input.num_children()),
@@ -310,7 +318,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
   column_view input,
   cudf::type_id,
   column_metadata const& metadata,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   std::unique_ptr<column> tmp_column = nullptr;
@@ -342,7 +350,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   column_view input,
   cudf::type_id,
   column_metadata const& metadata,
-  arrow::MemoryPool* ar_mr,
+  arrow_host_allocator& ar_mr,
   rmm::cuda_stream_view stream)
 {
   // Arrow dictionary requires indices to be signed integer
@@ -366,12 +374,47 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
   return std::make_shared<arrow::DictionaryArray>(
     arrow::dictionary(indices->type(), dictionary->type()), indices, dictionary);
 }
-}  // namespace
 
-std::shared_ptr<arrow::Table> to_arrow(table_view input,
-                                       std::vector<column_metadata> const& metadata,
-                                       rmm::cuda_stream_view stream,
-                                       arrow::MemoryPool* ar_mr)
+/**
+ * @brief Returns an upper bound of the host memory needed by the arrow arrays of a column.
+ */
+std::size_t host_size_upper_bound(column_view const& col)
+{
+  auto const padded = [](std::size_t size) {
+    return (size + arrow::kDefaultBufferAlignment - 1) / arrow::kDefaultBufferAlignment *
+           arrow::kDefaultBufferAlignment;
+  };
+  auto const num_rows = static_cast<std::size_t>(col.size());
+  auto size = col.nullable() ? padded(bitmask_allocation_size_bytes(col.size())) : 0;
+  switch (col.type().id()) {
+    case type_id::EMPTY: return 0;
+    case type_id::BOOL8: return size + padded(bitmask_allocation_size_bytes(col.size()));
+    case type_id::DECIMAL64:  // widened to 128 bits
+      return size + padded(num_rows * sizeof(__int128_t));
+    case type_id::DICTIONARY32:  // the indices are cast to INT32
+      size += padded(num_rows * sizeof(int32_t));
+      break;
+    default:
+      if (is_fixed_width(col.type())) { size += padded(num_rows * size_of(col.type())); }
+      break;
+  }
+  // the empty strings column allocates its offsets even without children
+  if (col.type().id() == type_id::STRING) { size += 2 * arrow::kDefaultBufferAlignment; }
+  return std::accumulate(
+    col.child_begin(), col.child_end(), size, [](std::size_t total, column_view const& child) {
+      return total + host_size_upper_bound(child);
+    });
+}
+
+/**
+ * @brief Converts a table into an arrow table whose host buffers come from `ar_mr`.
+ *
+ * The copies into the buffers are enqueued on `stream`, which is not synchronized.
+ */
+std::shared_ptr<arrow::Table> to_arrow_table(table_view input,
+                                             std::vector<column_metadata> const& metadata,
+                                             rmm::cuda_stream_view stream,
+                                             arrow_host_allocator& ar_mr)
 {
   CUDF_EXPECTS((metadata.size() == static_cast<std::size_t>(input.num_columns())),
                "columns' metadata should be equal to number of columns in table");
@@ -398,15 +441,39 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
     std::back_inserter(fields),
     [](auto const& array, auto const& meta) { return arrow::field(meta.name, array->type()); });
 
-  auto result = arrow::Table::Make(arrow::schema(fields), arrays);
+  return arrow::Table::Make(arrow::schema(fields), arrays);
+}
+
+}  // namespace
+
+std::shared_ptr<arrow::Table> to_arrow(table_view input,
+                                       std::vector<column_metadata> const& metadata,
+                                       rmm::cuda_stream_view stream,
+                                       arrow::MemoryPool* ar_mr)
+{
+  arrow_host_allocator allocator{ar_mr};
+  auto result = to_arrow_table(input, metadata, stream, allocator);
 
   // synchronize the stream because after the return the data may be accessed from the host before
   // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
   // memory is used).
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   return result;
 }
+
+std::shared_ptr<arrow::Table> to_arrow_async(table_view input,
+                                             std::vector<column_metadata> const& metadata,
+                                             rmm::cuda_stream_view stream)
+{
+  // a single pinned chunk is enough for all the buffers, unless the bound is exceeded
+  auto const arena_size = std::accumulate(
+    input.begin(), input.end(), std::size_t{0}, [](std::size_t total, column_view const& col) {
+      return total + host_size_upper_bound(col);
+    });
+  arrow_host_allocator allocator{arena_size};
+  return to_arrow_table(input, metadata, stream, allocator);
+}
 }  // namespace detail
 
 std::shared_ptr<arrow::Table> to_arrow(table_view input,
@@ -418,4 +485,13 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
   return detail::to_arrow(input, metadata, cudf::default_stream_value, ar_mr);
 }
 
+std::shared_ptr<arrow::Table> to_arrow_async(table_view input,
+                                             std::vector<column_metadata> const& metadata,
+                                             rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+
+  return detail::to_arrow_async(input, metadata, stream);
+}
+
 }  // namespace cudf
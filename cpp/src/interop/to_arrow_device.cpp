@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/interop.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the Arrow format string of a cudf type.
+ */
+std::string arrow_format(data_type type)
+{
+  switch (type.id()) {
+    case type_id::EMPTY: return "n";
+    case type_id::INT8: return "c";
+    case type_id::INT16: return "s";
+    case type_id::INT32: return "i";
+    case type_id::INT64: return "l";
+    case type_id::UINT8: return "C";
+    case type_id::UINT16: return "S";
+    case type_id::UINT32: return "I";
+    case type_id::UINT64: return "L";
+    case type_id::FLOAT32: return "f";
+    case type_id::FLOAT64: return "g";
+    case type_id::BOOL8: return "b";
+    case type_id::TIMESTAMP_DAYS: return "tdD";
+    case type_id::TIMESTAMP_SECONDS: return "tss:";
+    case type_id::TIMESTAMP_MILLISECONDS: return "tsm:";
+    case type_id::TIMESTAMP_MICROSECONDS: return "tsu:";
+    case type_id::TIMESTAMP_NANOSECONDS: return "tsn:";
+    case type_id::DURATION_SECONDS: return "tDs";
+    case type_id::DURATION_MILLISECONDS: return "tDm";
+    case type_id::DURATION_MICROSECONDS: return "tDu";
+    case type_id::DURATION_NANOSECONDS: return "tDn";
+    // cudf decimals have no precision, so they use the largest one of their width
+    case type_id::DECIMAL32: return "d:9," + std::to_string(-type.scale()) + ",32";
+    case type_id::DECIMAL64: return "d:18," + std::to_string(-type.scale()) + ",64";
+    case type_id::DECIMAL128: return "d:38," + std::to_string(-type.scale());
+    case type_id::STRING: return "u";
+    case type_id::LIST: return "+l";
+    case type_id::STRUCT: return "+s";
+    default: CUDF_FAIL("Unsupported type_id conversion to arrow");
+  }
+}
+
+/**
+ * @brief Returns the children of a column as Arrow sees them.
+ *
+ * Strings have none and lists have only their child, which is an empty column if it is missing
+ * from an empty lists column.
+ */
+std::vector<column_view> arrow_children(column_view const& col)
+{
+  switch (col.type().id()) {
+    case type_id::LIST:
+      if (col.num_children() > lists_column_view::child_column_index) {
+        return {col.child(lists_column_view::child_column_index)};
+      }
+      return {column_view{data_type{type_id::EMPTY}, 0, nullptr}};
+    case type_id::STRUCT: return {col.child_begin(), col.child_end()};
+    default: return {};
+  }
+}
+
+/**
+ * @brief Returns the metadata of the children of a column as Arrow sees them.
+ */
+std::vector<column_metadata> arrow_children_metadata(column_view const& col,
+                                                     column_metadata const& metadata)
+{
+  auto const num_children = arrow_children(col).size();
+  if (metadata.children_meta.empty()) { return std::vector<column_metadata>(num_children); }
+  if (col.type().id() == type_id::LIST) {
+    // the metadata follows the cudf children, the offsets then the child
+    CUDF_EXPECTS(metadata.children_meta.size() > lists_column_view::child_column_index,
+                 "Number of field names and number of children doesn't match\n");
+    return {metadata.children_meta[lists_column_view::child_column_index]};
+  }
+  CUDF_EXPECTS(metadata.children_meta.size() == num_children,
+               "Number of field names and number of children doesn't match\n");
+  return metadata.children_meta;
+}
+
+/**
+ * @brief The private data of an exported `ArrowSchema`.
+ */
+struct exported_schema {
+  std::string format;
+  std::string name;
+  std::vector<ArrowSchema> children;
+  std::vector<ArrowSchema*> children_ptrs;
+};
+
+void release_exported_schema(ArrowSchema* schema)
+{
+  auto* data = static_cast<exported_schema*>(schema->private_data);
+  for (auto& child : data->children) {
+    if (child.release != nullptr) { child.release(&child); }
+  }
+  delete data;
+  schema->release = nullptr;
+}
+
+/**
+ * @brief Fills `out` with a schema of the given format and children.
+ */
+void export_schema(std::string format,
+                   std::string name,
+                   std::vector<column_view> const& children,
+                   std::vector<column_metadata> const& children_meta,
+                   ArrowSchema* out);
+
+/**
+ * @brief Fills `out` with the schema of a column.
+ */
+void export_column_schema(column_view const& col,
+                          column_metadata const& metadata,
+                          ArrowSchema* out)
+{
+  export_schema(arrow_format(col.type()),
+                metadata.name,
+                arrow_children(col),
+                arrow_children_metadata(col, metadata),
+                out);
+  out->flags = ARROW_FLAG_NULLABLE;
+}
+
+void export_schema(std::string format,
+                   std::string name,
+                   std::vector<column_view> const& children,
+                   std::vector<column_metadata> const& children_meta,
+                   ArrowSchema* out)
+{
+  auto data    = std::make_unique<exported_schema>();
+  data->format = std::move(format);
+  data->name   = std::move(name);
+  data->children.resize(children.size());
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    export_column_schema(children[i], children_meta[i], &data->children[i]);
+    data->children_ptrs.push_back(&data->children[i]);
+  }
+
+  out->format       = data->format.c_str();
+  out->name         = data->name.c_str();
+  out->metadata     = nullptr;
+  out->flags        = 0;
+  out->n_children   = static_cast<int64_t>(children.size());
+  out->children     = data->children_ptrs.data();
+  out->dictionary   = nullptr;
+  out->release      = release_exported_schema;
+  out->private_data = data.release();
+}
+
+/**
+ * @brief The device memory shared with Arrow by `to_arrow_device`.
+ *
+ * Every exported array holds it, so it is freed once they are all released.
+ */
+struct exported_memory {
+  exported_memory(std::unique_ptr<cudf::table>&& table) : table{std::move(table)}
+  {
+    CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+  }
+  ~exported_memory() { cudaEventDestroy(event); }
+
+  std::unique_ptr<cudf::table> table;                          ///< The exported table
+  std::vector<std::unique_ptr<rmm::device_buffer>> converted;  ///< Buffers created for Arrow
+  cudaEvent_t event;  ///< Recorded once the exported memory is ready
+};
+
+/**
+ * @brief The private data of an exported `ArrowArray`.
+ */
+struct exported_array {
+  std::shared_ptr<exported_memory> memory;
+  std::vector<void const*> buffers;
+  std::vector<ArrowArray> children;
+  std::vector<ArrowArray*> children_ptrs;
+};
+
+void release_exported_array(ArrowArray* array)
+{
+  auto* data = static_cast<exported_array*>(array->private_data);
+  for (auto& child : data->children) {
+    if (child.release != nullptr) { child.release(&child); }
+  }
+  delete data;
+  array->release = nullptr;
+}
+
+/**
+ * @brief Fills `out` with an array of the given buffers and children.
+ */
+void export_array(std::shared_ptr<exported_memory> const& memory,
+                  int64_t length,
+                  int64_t null_count,
+                  int64_t offset,
+                  std::vector<void const*>&& buffers,
+                  std::vector<column_view> const& children,
+                  ArrowArray* out,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Returns a device buffer holding a single zero offset, for empty strings or lists
+ * columns that have no offsets.
+ */
+void const* zero_offset(exported_memory& memory,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  memory.converted.push_back(std::make_unique<rmm::device_buffer>(sizeof(offset_type), stream, mr));
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(memory.converted.back()->data(), 0, sizeof(offset_type), stream.value()));
+  return memory.converted.back()->data();
+}
+
+/**
+ * @brief Fills `out` with the array of a column, sharing its device buffers.
+ */
+void export_column_array(std::shared_ptr<exported_memory> const& memory,
+                         column_view const& col,
+                         ArrowArray* out,
+                         rmm::cuda_stream_view stream,
+                         rmm::mr::device_memory_resource* mr)
+{
+  std::vector<void const*> buffers;
+  int64_t offset = col.offset();
+  if (col.type().id() != type_id::EMPTY) { buffers.push_back(col.null_mask()); }
+  switch (col.type().id()) {
+    case type_id::EMPTY: break;
+    case type_id::BOOL8: {
+      // Arrow booleans are bit-packed, and the converted values start at the offset of the column
+      auto values = detail::bools_to_mask(col, stream, mr).first;
+      buffers.push_back(values->data());
+      memory->converted.push_back(std::move(values));
+      if (col.nullable() and offset != 0) {
+        memory->converted.push_back(
+          std::make_unique<rmm::device_buffer>(detail::copy_bitmask(col, stream, mr)));
+        buffers[0] = memory->converted.back()->data();
+      }
+      offset = 0;
+      break;
+    }
+    case type_id::STRING:
+      if (col.num_children() == 0) {
+        buffers.push_back(zero_offset(*memory, stream, mr));
+        buffers.push_back(nullptr);
+      } else {
+        strings_column_view const scv{col};
+        buffers.push_back(scv.offsets().head());
+        buffers.push_back(scv.chars().head());
+      }
+      break;
+    case type_id::LIST:
+      buffers.push_back(col.num_children() == 0 ? zero_offset(*memory, stream, mr)
+                                                : lists_column_view{col}.offsets().head());
+      break;
+    case type_id::STRUCT: break;
+    default:
+      arrow_format(col.type());  // fails for the unsupported types
+      buffers.push_back(col.head());
+      break;
+  }
+  export_array(memory,
+               col.size(),
+               col.null_count(),
+               offset,
+               std::move(buffers),
+               arrow_children(col),
+               out,
+               stream,
+               mr);
+}
+
+void export_array(std::shared_ptr<exported_memory> const& memory,
+                  int64_t length,
+                  int64_t null_count,
+                  int64_t offset,
+                  std::vector<void const*>&& buffers,
+                  std::vector<column_view> const& children,
+                  ArrowArray* out,
+                  rmm::cuda_stream_view stream,
+                  rmm::mr::device_memory_resource* mr)
+{
+  auto data     = std::make_unique<exported_array>();
+  data->memory  = memory;
+  data->buffers = std::move(buffers);
+  data->children.resize(children.size());
+  for (std::size_t i = 0; i < children.size(); ++i) {
+    export_column_array(memory, children[i], &data->children[i], stream, mr);
+    data->children_ptrs.push_back(&data->children[i]);
+  }
+
+  out->length       = length;
+  out->null_count   = null_count;
+  out->offset       = offset;
+  out->n_buffers    = static_cast<int64_t>(data->buffers.size());
+  out->n_children   = static_cast<int64_t>(children.size());
+  out->buffers      = data->buffers.data();
+  out->children     = data->children_ptrs.data();
+  out->dictionary   = nullptr;
+  out->release      = release_exported_array;
+  out->private_data = data.release();
+}
+
+void delete_schema(ArrowSchema* schema)
+{
+  if (schema->release != nullptr) { schema->release(schema); }
+  delete schema;
+}
+
+void delete_device_array(ArrowDeviceArray* array)
+{
+  if (array->array.release != nullptr) { array->array.release(&array->array); }
+  delete array;
+}
+
+}  // namespace
+
+unique_schema_t to_arrow_schema(table_view const& input, host_span<column_metadata const> metadata)
+{
+  CUDF_EXPECTS(metadata.empty() or metadata.size() == static_cast<std::size_t>(input.num_columns()),
+               "columns' metadata should be equal to number of columns in table");
+
+  unique_schema_t out{new ArrowSchema{}, delete_schema};
+  export_schema("+s",
+                "",
+                std::vector<column_view>(input.begin(), input.end()),
+                metadata.empty() ? std::vector<column_metadata>(input.num_columns())
+                                 : std::vector<column_metadata>(metadata.begin(), metadata.end()),
+                out.get());
+  return out;
+}
+
+unique_device_array_t to_arrow_device(cudf::table&& table,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = table.num_rows();
+  auto memory =
+    std::make_shared<exported_memory>(std::make_unique<cudf::table>(std::move(table)));
+  auto const input = memory->table->view();
+
+  unique_device_array_t out{new ArrowDeviceArray{}, delete_device_array};
+  export_array(memory,
+               num_rows,
+               0,
+               0,
+               {nullptr},
+               std::vector<column_view>(input.begin(), input.end()),
+               &out->array,
+               stream,
+               mr);
+
+  CUDF_CUDA_TRY(cudaGetDevice(reinterpret_cast<int*>(&out->device_id)));
+  CUDF_CUDA_TRY(cudaEventRecord(memory->event, stream.value()));
+  out->device_type = ARROW_DEVICE_CUDA;
+  out->sync_event  = &memory->event;
+  return out;
+}
+
+}  // namespace detail
+
+unique_schema_t to_arrow_schema(table_view const& input, host_span<column_metadata const> metadata)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_schema(input, metadata);
+}
+
+unique_device_array_t to_arrow_device(cudf::table&& table, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_arrow_device(std::move(table), cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
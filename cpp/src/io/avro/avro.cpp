@@ -17,6 +17,8 @@
 #include "avro.hpp"
 
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace cudf {
@@ -55,6 +57,80 @@ std::string container::get_encoded()
   return std::string(s, len);
 }
 
+namespace {
+
+/**
+ * @brief Extracts the primitive output columns of a schema
+ */
+std::vector<column_desc> get_columns(std::vector<schema_entry> const& schema)
+{
+  std::vector<column_desc> columns;
+  for (size_t i = 0; i < schema.size(); i++) {
+    type_kind_e kind = schema[i].kind;
+    if (kind > type_null && kind < type_record) {
+      // Primitive type column
+      column_desc col;
+      int parent_idx       = schema[i].parent_idx;
+      col.schema_data_idx  = (int32_t)i;
+      col.schema_null_idx  = -1;
+      col.parent_union_idx = -1;
+      col.name             = schema[i].name;
+      if (parent_idx >= 0) {
+        while (parent_idx >= 0) {
+          if (schema[parent_idx].kind == type_union) {
+            std::size_t pos = parent_idx + 1;
+            for (int num_children = schema[parent_idx].num_children; num_children > 0;
+                 --num_children) {
+              int skip = 1;
+              if (pos == i) {
+                col.parent_union_idx = schema[parent_idx].num_children - num_children;
+              } else if (schema[pos].kind == type_null) {
+                col.schema_null_idx = pos;
+                break;
+              }
+              do {
+                skip = skip + schema[pos].num_children - 1;
+                pos++;
+              } while (skip != 0);
+            }
+          }
+          // Ignore the root or array entries
+          if ((parent_idx != 0 && schema[parent_idx].kind != type_array) ||
+              col.name.length() == 0) {
+            if (col.name.length() > 0) { col.name.insert(0, 1, '.'); }
+            col.name.insert(0, schema[parent_idx].name);
+          }
+          parent_idx = schema[parent_idx].parent_idx;
+        }
+      }
+      columns.emplace_back(std::move(col));
+    }
+  }
+  return columns;
+}
+
+}  // namespace
+
+std::shared_ptr<parsed_schema const> parse_schema(std::string const& json_str)
+{
+  static std::mutex cache_mutex;
+  static std::unordered_map<std::string, std::shared_ptr<parsed_schema const>> cache;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (auto const it = cache.find(json_str); it != cache.end()) { return it->second; }
+  }
+
+  auto parsed = std::make_shared<parsed_schema>();
+  schema_parser sp;
+  if (!sp.parse(parsed->schema, json_str)) { return nullptr; }
+  parsed->columns = get_columns(parsed->schema);
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if (cache.size() >= max_cached_schemas) { cache.clear(); }
+  cache.emplace(json_str, parsed);
+  return parsed;
+}
+
 /**
  * @brief AVRO file metadata parser
  *
@@ -84,8 +160,10 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
       if (key == "avro.codec") {
         md->codec = value;
       } else if (key == "avro.schema") {
-        schema_parser sp;
-        if (!sp.parse(md->schema, value)) { return false; }
+        auto const parsed = parse_schema(value);
+        if (parsed == nullptr) { return false; }
+        md->schema  = parsed->schema;
+        md->columns = parsed->columns;
       } else {
         // printf("\"%s\" = \"%s\"\n", key.c_str(), value.c_str());
         md->user_data.emplace(key, value);
@@ -122,48 +200,6 @@ bool container::parse(file_metadata* md, size_t max_num_rows, size_t first_row)
   md->max_block_size  = max_block_size;
   md->num_rows        = total_object_count;
   md->total_data_size = m_cur - (m_base + md->metadata_size);
-  // Extract columns
-  for (size_t i = 0; i < md->schema.size(); i++) {
-    type_kind_e kind = md->schema[i].kind;
-    if (kind > type_null && kind < type_record) {
-      // Primitive type column
-      column_desc col;
-      int parent_idx       = md->schema[i].parent_idx;
-      col.schema_data_idx  = (int32_t)i;
-      col.schema_null_idx  = -1;
-      col.parent_union_idx = -1;
-      col.name             = md->schema[i].name;
-      if (parent_idx >= 0) {
-        while (parent_idx >= 0) {
-          if (md->schema[parent_idx].kind == type_union) {
-            std::size_t pos = parent_idx + 1;
-            for (int num_children = md->schema[parent_idx].num_children; num_children > 0;
-                 --num_children) {
-              int skip = 1;
-              if (pos == i) {
-                col.parent_union_idx = md->schema[parent_idx].num_children - num_children;
-              } else if (md->schema[pos].kind == type_null) {
-                col.schema_null_idx = pos;
-                break;
-              }
-              do {
-                skip = skip + md->schema[pos].num_children - 1;
-                pos++;
-              } while (skip != 0);
-            }
-          }
-          // Ignore the root or array entries
-          if ((parent_idx != 0 && md->schema[parent_idx].kind != type_array) ||
-              col.name.length() == 0) {
-            if (col.name.length() > 0) { col.name.insert(0, 1, '.'); }
-            col.name.insert(0, md->schema[parent_idx].name);
-          }
-          parent_idx = md->schema[parent_idx].parent_idx;
-        }
-      }
-      md->columns.emplace_back(std::move(col));
-    }
-  }
   return true;
 }
 
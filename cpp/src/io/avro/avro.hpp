@@ -24,6 +24,7 @@
 #include <cstdio>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -94,6 +95,30 @@ class schema_parser {
   const char* m_end;
 };
 
+/**
+ * @brief Schema entries and output columns parsed from a schema JSON
+ */
+struct parsed_schema {
+  std::vector<schema_entry> schema;
+  std::vector<column_desc> columns;
+};
+
+/// Number of parsed schemas kept by `parse_schema` before its cache is cleared
+constexpr std::size_t max_cached_schemas = 64;
+
+/**
+ * @brief Parses a schema JSON, reusing the result of a previous parse of the same schema.
+ *
+ * The files of a dataset usually share a single schema, so the recently parsed schemas are kept in
+ * a small process-wide cache keyed by their JSON text. The cache is cleared once it holds
+ * `max_cached_schemas` schemas.
+ *
+ * @param json_str Schema JSON
+ *
+ * @returns parsed schema, nullptr if error
+ */
+std::shared_ptr<parsed_schema const> parse_schema(std::string const& json_str);
+
 /**
  * @brief AVRO file container parsing class
  */
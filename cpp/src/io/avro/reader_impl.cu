@@ -22,6 +22,7 @@
 #include <io/utilities/hostdevice_vector.hpp>
 
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/avro.hpp>
@@ -43,6 +44,7 @@
 
 #include <nvcomp/snappy.h>
 
+#include <algorithm>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -446,6 +448,139 @@ std::vector<column_buffer> decode_data(metadata& meta,
   return out_buffers;
 }
 
+/**
+ * @brief Returns the data types of the selected columns
+ */
+std::vector<data_type> get_column_types(metadata const& meta,
+                                        std::vector<std::pair<int, std::string>> const& selection)
+{
+  std::vector<data_type> column_types;
+  for (auto const& col : selection) {
+    auto& col_schema = meta.schema[meta.columns[col.first].schema_data_idx];
+
+    auto col_type = to_type_id(&col_schema);
+    CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
+    column_types.emplace_back(col_type);
+  }
+  return column_types;
+}
+
+/**
+ * @brief Reads up to `size` bytes of block data at `offset` in the source into device memory
+ *
+ * @return The number of bytes read
+ */
+size_t read_block_data(datasource& source,
+                       size_t offset,
+                       size_t size,
+                       uint8_t* dst,
+                       rmm::cuda_stream_view stream)
+{
+  if (source.is_device_read_preferred(size)) {
+    return source.device_read(offset, size, dst, stream);
+  }
+  auto const buffer = source.host_read(offset, size);
+  CUDF_CUDA_TRY(
+    cudaMemcpyAsync(dst, buffer->data(), buffer->size(), cudaMemcpyHostToDevice, stream.value()));
+  return buffer->size();
+}
+
+/**
+ * @brief Decompresses and decodes the blocks of `meta` into the selected columns
+ *
+ * @param source Input `datasource` of the blocks
+ * @param meta Metadata of the blocks to decode, with offsets relative to `block_data`
+ * @param block_data Raw block data, starting with the first block
+ * @param selected_columns Columns to decode
+ * @param column_types Data types of the selected columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return The decoded columns
+ */
+std::vector<std::unique_ptr<column>> decode_blocks(
+  datasource& source,
+  metadata& meta,
+  rmm::device_buffer&& block_data,
+  std::vector<std::pair<int, std::string>> const& selected_columns,
+  std::vector<data_type> const& column_types,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  if (meta.codec != "" && meta.codec != "null") {
+    auto decomp_block_data = decompress_data(source, meta, block_data, stream);
+    block_data             = std::move(decomp_block_data);
+  } else {
+    auto dst_ofs = meta.block_list[0].offset;
+    for (size_t i = 0; i < meta.block_list.size(); i++) {
+      meta.block_list[i].offset -= dst_ofs;
+    }
+  }
+
+  size_t total_dictionary_entries = 0;
+  size_t dictionary_data_size     = 0;
+
+  auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
+
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    auto col_idx     = selected_columns[i].first;
+    auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
+    dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
+    dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
+    total_dictionary_entries += dict[i].second;
+    for (auto const& sym : col_schema.symbols) {
+      dictionary_data_size += sym.length();
+    }
+  }
+
+  auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
+  auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
+
+  if (total_dictionary_entries > 0) {
+    auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
+    auto h_global_dict_data = std::vector<char>(dictionary_data_size);
+    size_t dict_pos         = 0;
+
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      auto const col_idx          = selected_columns[i].first;
+      auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
+      auto const col_dict_entries = &(h_global_dict[dict[i].first]);
+      for (size_t j = 0; j < dict[i].second; j++) {
+        auto const& symbols = col_schema.symbols[j];
+
+        auto const data_dst        = h_global_dict_data.data() + dict_pos;
+        auto const len             = symbols.length();
+        col_dict_entries[j].first  = data_dst;
+        col_dict_entries[j].second = len;
+
+        std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
+        dict_pos += len;
+      }
+    }
+
+    d_global_dict      = cudf::detail::make_device_uvector_async(h_global_dict, stream);
+    d_global_dict_data = cudf::detail::make_device_uvector_async(h_global_dict_data, stream);
+
+    cudf::detail::synchronize_stream(stream);
+  }
+
+  auto out_buffers = decode_data(meta,
+                                 block_data,
+                                 dict,
+                                 d_global_dict,
+                                 meta.num_rows,
+                                 selected_columns,
+                                 column_types,
+                                 stream,
+                                 mr);
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, mr));
+  }
+  return out_columns;
+}
+
 table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                               avro_reader_options const& options,
                               rmm::cuda_stream_view stream,
@@ -467,99 +602,19 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
   auto selected_columns = meta.select_columns(options.get_columns());
   if (selected_columns.size() != 0) {
     // Get a list of column data types
-    std::vector<data_type> column_types;
-    for (auto const& col : selected_columns) {
-      auto& col_schema = meta.schema[meta.columns[col.first].schema_data_idx];
-
-      auto col_type = to_type_id(&col_schema);
-      CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
-      column_types.emplace_back(col_type);
-    }
+    auto const column_types = get_column_types(meta, selected_columns);
 
     if (meta.total_data_size > 0) {
-      rmm::device_buffer block_data;
-      if (source->is_device_read_preferred(meta.total_data_size)) {
-        block_data      = rmm::device_buffer{meta.total_data_size, stream};
-        auto read_bytes = source->device_read(meta.block_list[0].offset,
+      rmm::device_buffer block_data{meta.total_data_size, stream};
+      auto const read_bytes = read_block_data(*source,
+                                              meta.block_list[0].offset,
                                               meta.total_data_size,
                                               static_cast<uint8_t*>(block_data.data()),
                                               stream);
-        block_data.resize(read_bytes, stream);
-      } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.total_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
-      }
-
-      if (meta.codec != "" && meta.codec != "null") {
-        auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
-        block_data             = std::move(decomp_block_data);
-      } else {
-        auto dst_ofs = meta.block_list[0].offset;
-        for (size_t i = 0; i < meta.block_list.size(); i++) {
-          meta.block_list[i].offset -= dst_ofs;
-        }
-      }
-
-      size_t total_dictionary_entries = 0;
-      size_t dictionary_data_size     = 0;
-
-      auto dict = std::vector<std::pair<uint32_t, uint32_t>>(column_types.size());
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col_idx     = selected_columns[i].first;
-        auto& col_schema = meta.schema[meta.columns[col_idx].schema_data_idx];
-        dict[i].first    = static_cast<uint32_t>(total_dictionary_entries);
-        dict[i].second   = static_cast<uint32_t>(col_schema.symbols.size());
-        total_dictionary_entries += dict[i].second;
-        for (auto const& sym : col_schema.symbols) {
-          dictionary_data_size += sym.length();
-        }
-      }
-
-      auto d_global_dict      = rmm::device_uvector<string_index_pair>(0, stream);
-      auto d_global_dict_data = rmm::device_uvector<char>(0, stream);
-
-      if (total_dictionary_entries > 0) {
-        auto h_global_dict      = std::vector<string_index_pair>(total_dictionary_entries);
-        auto h_global_dict_data = std::vector<char>(dictionary_data_size);
-        size_t dict_pos         = 0;
+      block_data.resize(read_bytes, stream);
 
-        for (size_t i = 0; i < column_types.size(); ++i) {
-          auto const col_idx          = selected_columns[i].first;
-          auto const& col_schema      = meta.schema[meta.columns[col_idx].schema_data_idx];
-          auto const col_dict_entries = &(h_global_dict[dict[i].first]);
-          for (size_t j = 0; j < dict[i].second; j++) {
-            auto const& symbols = col_schema.symbols[j];
-
-            auto const data_dst        = h_global_dict_data.data() + dict_pos;
-            auto const len             = symbols.length();
-            col_dict_entries[j].first  = data_dst;
-            col_dict_entries[j].second = len;
-
-            std::copy(symbols.c_str(), symbols.c_str() + len, data_dst);
-            dict_pos += len;
-          }
-        }
-
-        d_global_dict      = cudf::detail::make_device_uvector_async(h_global_dict, stream);
-        d_global_dict_data = cudf::detail::make_device_uvector_async(h_global_dict_data, stream);
-
-        stream.synchronize();
-      }
-
-      auto out_buffers = decode_data(meta,
-                                     block_data,
-                                     dict,
-                                     d_global_dict,
-                                     num_rows,
-                                     selected_columns,
-                                     column_types,
-                                     stream,
-                                     mr);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, stream, mr));
-      }
+      out_columns = decode_blocks(
+        *source, meta, std::move(block_data), selected_columns, column_types, stream, mr);
     } else {
       // Create empty columns
       for (size_t i = 0; i < column_types.size(); ++i) {
@@ -580,6 +635,217 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata_out)};
 }
 
+/**
+ * @brief Implementation of the chunked reader.
+ *
+ * The metadata of all the sources is parsed at construction and split into chunks of consecutive
+ * blocks. The blocks of a chunk are read into a single buffer, so a chunk spanning several small
+ * files is decompressed and decoded with a single set of kernel launches.
+ */
+class chunked_reader::impl {
+ public:
+  impl(std::size_t read_memory_limit,
+       std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+       avro_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _sources(std::move(sources)), _stream(stream), _mr(mr)
+  {
+    CUDF_EXPECTS(options.get_skip_rows() == 0 and options.get_num_rows() == -1,
+                 "skip_rows and num_rows are not supported by the chunked reader");
+
+    for (size_t src_idx = 0; src_idx < _sources.size(); ++src_idx) {
+      auto& meta    = _metadata.emplace_back(_sources[src_idx].get());
+      int skip_rows = 0;
+      int num_rows  = -1;
+      meta.init_and_select_rows(skip_rows, num_rows);
+
+      auto selection = meta.select_columns(options.get_columns());
+      auto types     = get_column_types(meta, selection);
+      if (src_idx == 0) {
+        _selected_columns = std::move(selection);
+        _column_types     = std::move(types);
+      } else {
+        CUDF_EXPECTS(selection == _selected_columns and types == _column_types,
+                     "All sources must have the same schema");
+      }
+    }
+    compute_chunks(read_memory_limit);
+  }
+
+  [[nodiscard]] bool has_next() const { return _current_chunk < _chunks.size(); }
+
+  table_with_metadata read_chunk()
+  {
+    table_metadata metadata_out;
+    for (auto const& col : _selected_columns) {
+      metadata_out.column_names.push_back(col.second);
+    }
+
+    std::vector<std::unique_ptr<column>> out_columns;
+    if (not has_next() or _chunks[_current_chunk].empty()) {
+      if (has_next()) { ++_current_chunk; }
+      for (auto const& type : _column_types) {
+        out_columns.emplace_back(make_empty_column(type));
+      }
+      return {std::make_unique<table>(std::move(out_columns)), std::move(metadata_out)};
+    }
+
+    auto const& parts = _chunks[_current_chunk++];
+
+    // The blocks of all the parts are read back to back, with their offsets and first rows rebased
+    // to the chunk
+    auto chunk_meta        = metadata(nullptr);
+    auto const& first_meta = _metadata[parts.front().source];
+    chunk_meta.codec       = first_meta.codec;
+    chunk_meta.schema      = first_meta.schema;
+    chunk_meta.columns     = first_meta.columns;
+    chunk_meta.user_data   = first_meta.user_data;
+    std::vector<size_t> part_offsets{0};
+    for (auto const& part : parts) {
+      part_offsets.push_back(part_offsets.back() + part_size(part));
+    }
+    rmm::device_buffer block_data{part_offsets.back(), _stream};
+
+    for (size_t p = 0; p < parts.size(); ++p) {
+      auto const& part   = parts[p];
+      auto const& meta   = _metadata[part.source];
+      auto const& first  = meta.block_list[part.first_block];
+      auto const base    = part_offsets[p];
+      auto const row_ofs = chunk_meta.num_rows;
+      auto const read_bytes = read_block_data(*_sources[part.source],
+                                              first.offset,
+                                              part_offsets[p + 1] - base,
+                                              static_cast<uint8_t*>(block_data.data()) + base,
+                                              _stream);
+      CUDF_EXPECTS(read_bytes == part_offsets[p + 1] - base, "Unexpected end of Avro block data");
+      for (size_t b = part.first_block; b < part.first_block + part.num_blocks; ++b) {
+        auto const& block = meta.block_list[b];
+        chunk_meta.block_list.emplace_back(base + block.offset - first.offset,
+                                           block.size,
+                                           row_ofs + block.first_row - first.first_row,
+                                           block.num_rows);
+        chunk_meta.num_rows += block.num_rows;
+        chunk_meta.max_block_size = std::max(chunk_meta.max_block_size, block.size);
+      }
+      metadata_out.per_file_user_data.push_back({meta.user_data.begin(), meta.user_data.end()});
+    }
+    chunk_meta.total_data_size = part_offsets.back();
+
+    out_columns = decode_blocks(*_sources[parts.front().source],
+                                chunk_meta,
+                                std::move(block_data),
+                                _selected_columns,
+                                _column_types,
+                                _stream,
+                                _mr);
+
+    metadata_out.user_data = chunk_meta.user_data;
+    return {std::make_unique<table>(std::move(out_columns)), std::move(metadata_out)};
+  }
+
+ private:
+  /**
+   * @brief Consecutive blocks of a single source
+   */
+  struct chunk_part {
+    size_t source;
+    size_t first_block;
+    size_t num_blocks;
+  };
+
+  /**
+   * @brief Returns the number of bytes of block data spanned by a part, including the headers and
+   * sync markers between its blocks
+   */
+  [[nodiscard]] size_t part_size(chunk_part const& part) const
+  {
+    auto const& blocks = _metadata[part.source].block_list;
+    auto const& first  = blocks[part.first_block];
+    auto const& last   = blocks[part.first_block + part.num_blocks - 1];
+    return last.offset + last.size - first.offset;
+  }
+
+  void compute_chunks(std::size_t read_memory_limit)
+  {
+    // Estimates the device memory needed to read a block: the stored data, the decompressed data
+    // (assuming a compression ratio of two, as the inflate buffers do) and the decoded columns;
+    // string characters are bounded by the size of the block data
+    auto const estimate_block_size = [&](metadata const& meta, block_desc_s const& block) {
+      auto const is_compressed = meta.codec != "" && meta.codec != "null";
+      std::size_t const data_size =
+        is_compressed ? static_cast<std::size_t>(block.size) * 2 : block.size;
+      std::size_t size = block.size + (is_compressed ? data_size : 0);
+      for (auto const& type : _column_types) {
+        if (is_fixed_width(type)) {
+          size += static_cast<std::size_t>(block.num_rows) * cudf::size_of(type);
+        } else {
+          size += static_cast<std::size_t>(block.num_rows) *
+                    (sizeof(string_index_pair) + sizeof(size_type)) +
+                  data_size;
+        }
+      }
+      return size;
+    };
+
+    std::vector<chunk_part> current_chunk;
+    std::size_t current_size = 0;
+    for (size_t src_idx = 0; src_idx < _metadata.size(); ++src_idx) {
+      auto const& meta = _metadata[src_idx];
+      if (meta.total_data_size == 0) { continue; }
+      for (size_t b = 0; b < meta.block_list.size(); ++b) {
+        auto const block_size = estimate_block_size(meta, meta.block_list[b]);
+        // A block exceeding the limit on its own still forms a chunk; blocks with different codecs
+        // are decompressed separately
+        if (not current_chunk.empty() and
+            ((read_memory_limit > 0 and current_size + block_size > read_memory_limit) or
+             _metadata[current_chunk.front().source].codec != meta.codec)) {
+          _chunks.push_back(std::move(current_chunk));
+          current_chunk = {};
+          current_size  = 0;
+        }
+        if (current_chunk.empty() or current_chunk.back().source != src_idx) {
+          current_chunk.push_back({src_idx, b, 0});
+        }
+        current_chunk.back().num_blocks++;
+        current_size += block_size;
+      }
+    }
+    // Always produce at least one chunk, so that an empty dataset yields an empty table
+    if (not current_chunk.empty() or _chunks.empty()) {
+      _chunks.push_back(std::move(current_chunk));
+    }
+  }
+
+  std::vector<std::unique_ptr<cudf::io::datasource>> _sources;
+  std::vector<metadata> _metadata;
+  std::vector<std::pair<int, std::string>> _selected_columns;
+  std::vector<data_type> _column_types;
+  std::vector<std::vector<chunk_part>> _chunks;
+  size_t _current_chunk = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+};
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t read_memory_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               avro_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl{std::make_unique<impl>(read_memory_limit, std::move(sources), options, stream, mr)}
+{
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -82,8 +82,13 @@ For more information on these sources, see the manual.
 #include "io_uncomp.hpp"
 #include "unbz2.hpp"
 
+#include <io/utilities/host_worker_pool.hpp>
+
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <future>
 #include <vector>
 
 namespace cudf {
@@ -597,5 +602,159 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+namespace {
+
+// 48-bit signature at the start of each block
+constexpr uint64_t bz2_block_signature = 0x314159265359ull;
+
+/**
+ * @brief Output of decoding a single bzip2 block
+ */
+struct bz2_block_output {
+  int32_t status   = BZ_DATA_ERROR;
+  uint64_t end_bit = 0;       // bit offset of the data following the block
+  std::vector<uint8_t> data;  // decompressed bytes
+};
+
+/**
+ * @brief Returns the bit offsets of all the potential block signatures in the given byte range
+ *
+ * Compressed data can contain the signature by chance, so the offsets are only candidates.
+ */
+std::vector<uint64_t> find_block_candidates(const uint8_t* source,
+                                            size_t source_len,
+                                            size_t begin,
+                                            size_t end)
+{
+  std::vector<uint64_t> offsets;
+  // A 64-bit window over bytes [i - 7, i] holds every 48-bit pattern starting in byte i - 7
+  begin           = std::max<size_t>(begin, 7);
+  end             = std::min(end, source_len);
+  uint64_t window = 0;
+  for (size_t i = begin - 7; i < begin; ++i) {
+    window = (window << 8) | source[i];
+  }
+  for (size_t i = begin; i < end; ++i) {
+    window = (window << 8) | source[i];
+    for (uint32_t bit = 0; bit < 8; ++bit) {
+      if (((window >> (16 - bit)) & 0xffff'ffff'ffffull) == bz2_block_signature) {
+        offsets.push_back((i - 7) * 8 + bit);
+      }
+    }
+  }
+  return offsets;
+}
+
+/**
+ * @brief Decodes the single block starting at the given bit offset
+ */
+bz2_block_output decode_block(const uint8_t* source,
+                              size_t source_len,
+                              uint32_t block_size_100k,
+                              uint64_t bit_offset)
+{
+  bz2_block_output output;
+  unbz_state_s s{};
+  s.base   = source;
+  s.end    = source + source_len - 4;
+  s.cur    = source + (bit_offset >> 3);
+  s.bitpos = static_cast<uint32_t>(bit_offset & 7);
+  if (s.cur + 8 > s.end) { return output; }
+  uint64_t bits;
+  std::memcpy(&bits, s.cur, sizeof(bits));
+  s.bitbuf        = __builtin_bswap64(bits);
+  s.blockSize100k = block_size_100k;
+  s.tt.resize(block_size_100k * 100000);
+
+  auto const ret = bz2_decompress_block(&s);
+  if (ret != BZ_OK && ret != BZ_STREAM_END) {
+    output.status = ret;
+    return output;
+  }
+  output.end_bit = ((s.cur - s.base) << 3) + s.bitpos;
+
+  // The run-length decoding usually produces about one byte per symbol; if it produces more, run
+  // it again with the exact output size
+  output.data.resize(s.save_nblock);
+  for (int pass = 0; pass < 2; ++pass) {
+    s.out     = output.data.data();
+    s.outbase = s.out;
+    s.outend  = s.out + output.data.size();
+    bzUnRLE(&s);
+    if (s.out <= s.outend) { break; }
+    output.data.resize(s.out - s.outbase);
+  }
+  if (s.nblock_used != s.save_nblock + 1) { return output; }
+  output.data.resize(s.out - s.outbase);
+  output.status = ret;
+  return output;
+}
+
+}  // namespace
+
+int32_t cpu_bz2_uncompress_parallel(const uint8_t* source,
+                                    size_t sourceLen,
+                                    std::vector<uint8_t>& dest)
+{
+  if (source == nullptr || sourceLen < 12) return BZ_PARAM_ERROR;
+  if (source[0] != 'B' || source[1] != 'Z' || source[2] != 'h') return BZ_DATA_ERROR_MAGIC;
+  uint32_t const block_size_100k = source[3] - '0';
+  if (block_size_100k < 1 || block_size_100k > 9) return BZ_DATA_ERROR_MAGIC;
+
+  auto& pool = detail::host_worker_pool();
+
+  // Find the candidate block starts, in parallel over large byte ranges
+  constexpr size_t scan_range_size = 16 * 1024 * 1024;
+  std::vector<std::future<std::vector<uint64_t>>> scan_tasks;
+  for (size_t begin = 4; begin < sourceLen; begin += scan_range_size) {
+    scan_tasks.push_back(pool.submit(
+      [=]() { return find_block_candidates(source, sourceLen, begin, begin + scan_range_size); }));
+  }
+  std::vector<uint64_t> candidates;
+  for (auto& task : scan_tasks) {
+    auto const offsets = task.get();
+    candidates.insert(candidates.end(), offsets.begin(), offsets.end());
+  }
+
+  // Decode every candidate independently; false candidates are discarded below
+  std::vector<std::future<bz2_block_output>> decode_tasks;
+  decode_tasks.reserve(candidates.size());
+  for (auto const offset : candidates) {
+    decode_tasks.push_back(pool.submit(
+      [=]() { return decode_block(source, sourceLen, block_size_100k, offset); }));
+  }
+  std::vector<bz2_block_output> blocks;
+  blocks.reserve(decode_tasks.size());
+  for (auto& task : decode_tasks) {
+    blocks.push_back(task.get());
+  }
+
+  // The actual blocks form a chain starting right after the 32-bit stream header, each one ending
+  // where the next one starts
+  std::vector<size_t> chain;
+  size_t output_size = 0;
+  uint64_t bit_pos   = 32;
+  while (true) {
+    auto const it = std::lower_bound(candidates.begin(), candidates.end(), bit_pos);
+    if (it == candidates.end() || *it != bit_pos) return BZ_DATA_ERROR;
+    auto const idx = static_cast<size_t>(it - candidates.begin());
+    if (blocks[idx].status != BZ_OK && blocks[idx].status != BZ_STREAM_END) {
+      return blocks[idx].status;
+    }
+    chain.push_back(idx);
+    output_size += blocks[idx].data.size();
+    if (blocks[idx].status == BZ_STREAM_END) break;
+    bit_pos = blocks[idx].end_bit;
+  }
+
+  dest.resize(output_size);
+  size_t dest_pos = 0;
+  for (auto const idx : chain) {
+    std::copy(blocks[idx].data.begin(), blocks[idx].data.end(), dest.begin() + dest_pos);
+    dest_pos += blocks[idx].data.size();
+  }
+  return BZ_OK;
+}
+
 }  // namespace io
 }  // namespace cudf
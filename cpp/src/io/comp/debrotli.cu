@@ -59,6 +59,7 @@ THE SOFTWARE.
 
 #include <io/utilities/block_utils.cuh>
 
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -2112,7 +2113,7 @@ void gpu_debrotli(device_span<device_span<uint8_t const> const> inputs,
   while (cur < fb_heap_size && !(cur & 3)) {
     CUDF_CUDA_TRY(cudaMemcpyAsync(
       &dump[0], scratch_u8 + cur, 2 * sizeof(uint32_t), cudaMemcpyDeviceToHost, stream.value()));
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
     printf("@%d: next = %d, size = %d\n", cur, dump[0], dump[1]);
     cur = (dump[0] > cur) ? dump[0] : 0xffffffffu;
   }
@@ -19,6 +19,7 @@
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/config_utils.hpp>
 
+#include <nvcomp/lz4.h>
 #include <nvcomp/snappy.h>
 
 #define NVCOMP_ZSTD_HEADER <nvcomp/zstd.h>
@@ -44,6 +45,14 @@
 #define NVCOMP_HAS_TEMPSIZE_EX 0
 #endif
 
+// ZSTD compression is available in nvcomp 2.4.0 or newer
+#if NVCOMP_HAS_ZSTD and (NVCOMP_MAJOR_VERSION > 2 or \
+                         (NVCOMP_MAJOR_VERSION == 2 and NVCOMP_MINOR_VERSION >= 4))
+#define NVCOMP_HAS_ZSTD_COMPRESS 1
+#else
+#define NVCOMP_HAS_ZSTD_COMPRESS 0
+#endif
+
 // ZSTD is stable for nvcomp 2.3.2 or newer
 #if NVCOMP_MAJOR_VERSION > 2 or (NVCOMP_MAJOR_VERSION == 2 and NVCOMP_MINOR_VERSION > 3) or \
   (NVCOMP_MAJOR_VERSION == 2 and NVCOMP_MINOR_VERSION == 3 and NVCOMP_PATCH_VERSION >= 2)
@@ -68,6 +77,8 @@ nvcompStatus_t batched_decompress_get_temp_size_ex(compression_type compression,
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressGetTempSizeEx(std::forward<Args>(args)...);
     case compression_type::DEFLATE: [[fallthrough]];
     default: CUDF_FAIL("Unsupported compression type");
   }
@@ -94,6 +105,8 @@ auto batched_decompress_get_temp_size(compression_type compression, Args&&... ar
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
+    case compression_type::LZ4:
+      return nvcompBatchedLZ4DecompressGetTempSize(std::forward<Args>(args)...);
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
@@ -117,6 +130,7 @@ auto batched_decompress_async(compression_type compression, Args&&... args)
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
+    case compression_type::LZ4: return nvcompBatchedLZ4DecompressAsync(std::forward<Args>(args)...);
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
@@ -191,9 +205,9 @@ void batched_decompress(compression_type compression,
 }
 
 // Dispatcher for nvcompBatched<format>CompressGetTempSize
-auto batched_compress_temp_size(compression_type compression,
-                                size_t batch_size,
-                                size_t max_uncompressed_chunk_bytes)
+size_t batched_compress_temp_size(compression_type compression,
+                                  size_t batch_size,
+                                  uint32_t max_uncompressed_chunk_bytes)
 {
   size_t temp_size             = 0;
   nvcompStatus_t nvcomp_status = nvcompStatus_t::nvcompSuccess;
@@ -210,7 +224,18 @@ auto batched_compress_temp_size(compression_type compression,
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
-    case compression_type::ZSTD: [[fallthrough]];
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMPRESS
+      nvcomp_status = nvcompBatchedZstdCompressGetTempSize(
+        batch_size, max_uncompressed_chunk_bytes, nvcompBatchedZstdDefaultOpts, &temp_size);
+      break;
+#else
+      CUDF_FAIL("Unsupported compression type");
+#endif
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressGetTempSize(
+        batch_size, max_uncompressed_chunk_bytes, nvcompBatchedLZ4DefaultOpts, &temp_size);
+      break;
     default: CUDF_FAIL("Unsupported compression type");
   }
 
@@ -238,7 +263,18 @@ size_t batched_compress_get_max_output_chunk_size(compression_type compression,
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
-    case compression_type::ZSTD: [[fallthrough]];
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMPRESS
+      status = nvcompBatchedZstdCompressGetMaxOutputChunkSize(
+        max_uncompressed_chunk_bytes, nvcompBatchedZstdDefaultOpts, &max_comp_chunk_size);
+      break;
+#else
+      CUDF_FAIL("Unsupported compression type");
+#endif
+    case compression_type::LZ4:
+      status = nvcompBatchedLZ4CompressGetMaxOutputChunkSize(
+        max_uncompressed_chunk_bytes, nvcompBatchedLZ4DefaultOpts, &max_comp_chunk_size);
+      break;
     default: CUDF_FAIL("Unsupported compression type");
   }
 
@@ -289,7 +325,34 @@ static void batched_compress_async(compression_type compression,
 #else
       CUDF_FAIL("Unsupported compression type");
 #endif
-    case compression_type::ZSTD: [[fallthrough]];
+    case compression_type::ZSTD:
+#if NVCOMP_HAS_ZSTD_COMPRESS
+      nvcomp_status = nvcompBatchedZstdCompressAsync(device_uncompressed_ptrs,
+                                                     device_uncompressed_bytes,
+                                                     max_uncompressed_chunk_bytes,
+                                                     batch_size,
+                                                     device_temp_ptr,
+                                                     temp_bytes,
+                                                     device_compressed_ptrs,
+                                                     device_compressed_bytes,
+                                                     nvcompBatchedZstdDefaultOpts,
+                                                     stream.value());
+      break;
+#else
+      CUDF_FAIL("Unsupported compression type");
+#endif
+    case compression_type::LZ4:
+      nvcomp_status = nvcompBatchedLZ4CompressAsync(device_uncompressed_ptrs,
+                                                    device_uncompressed_bytes,
+                                                    max_uncompressed_chunk_bytes,
+                                                    batch_size,
+                                                    device_temp_ptr,
+                                                    temp_bytes,
+                                                    device_compressed_ptrs,
+                                                    device_compressed_bytes,
+                                                    nvcompBatchedLZ4DefaultOpts,
+                                                    stream.value());
+      break;
     default: CUDF_FAIL("Unsupported compression type");
   }
   CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "Error in compression");
@@ -302,10 +365,30 @@ void batched_compress(compression_type compression,
                       uint32_t max_uncomp_chunk_size,
                       rmm::cuda_stream_view stream)
 {
-  auto const num_chunks = inputs.size();
-
-  auto const temp_size = batched_compress_temp_size(compression, num_chunks, max_uncomp_chunk_size);
+  auto const temp_size =
+    batched_compress_temp_size(compression, inputs.size(), max_uncomp_chunk_size);
   rmm::device_buffer scratch(temp_size, stream);
+  batched_compress(compression,
+                   inputs,
+                   outputs,
+                   statuses,
+                   max_uncomp_chunk_size,
+                   {static_cast<uint8_t*>(scratch.data()), scratch.size()},
+                   stream);
+}
+
+void batched_compress(compression_type compression,
+                      device_span<device_span<uint8_t const> const> inputs,
+                      device_span<device_span<uint8_t> const> outputs,
+                      device_span<decompress_status> statuses,
+                      uint32_t max_uncomp_chunk_size,
+                      device_span<uint8_t> scratch,
+                      rmm::cuda_stream_view stream)
+{
+  auto const num_chunks = inputs.size();
+  CUDF_EXPECTS(
+    scratch.size() >= batched_compress_temp_size(compression, num_chunks, max_uncomp_chunk_size),
+    "Insufficient scratch space for compression");
 
   rmm::device_uvector<size_t> actual_compressed_data_sizes(num_chunks, stream);
   auto const nvcomp_args = create_batched_nvcomp_args(inputs, outputs, stream);
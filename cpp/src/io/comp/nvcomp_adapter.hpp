@@ -24,7 +24,7 @@
 
 namespace cudf::io::nvcomp {
 
-enum class compression_type { SNAPPY, ZSTD, DEFLATE };
+enum class compression_type { SNAPPY, ZSTD, DEFLATE, LZ4 };
 
 /**
  * @brief Device batch decompression of given type.
@@ -54,6 +54,18 @@ void batched_decompress(compression_type compression,
 size_t batched_compress_get_max_output_chunk_size(compression_type compression,
                                                   uint32_t max_uncomp_chunk_size);
 
+/**
+ * @brief Gets the size of the scratch space required to compress a batch.
+ *
+ * @param compression Compression type
+ * @param num_chunks Number of chunks in the batch
+ * @param max_uncomp_chunk_size Size of the largest uncompressed chunk in the batch
+ * @return Size of the scratch space in bytes
+ */
+size_t batched_compress_temp_size(compression_type compression,
+                                  size_t num_chunks,
+                                  uint32_t max_uncomp_chunk_size);
+
 /**
  * @brief Device batch compression of given type.
  *
@@ -71,4 +83,27 @@ void batched_compress(compression_type compression,
                       uint32_t max_uncomp_chunk_size,
                       rmm::cuda_stream_view stream);
 
+/**
+ * @brief Device batch compression of given type, using caller-provided scratch space.
+ *
+ * Allows writers to reuse a single scratch allocation across batches. The scratch space must be
+ * at least `batched_compress_temp_size` bytes and must not be used by other work on `stream`
+ * until the compression completes.
+ *
+ * @param[in] compression Compression type
+ * @param[in] inputs List of input buffers
+ * @param[out] outputs List of output buffers
+ * @param[out] statuses List of output status structures
+ * @param[in] max_uncomp_chunk_size Size of the largest uncompressed chunk in the batch
+ * @param[in] scratch Scratch space for the compression
+ * @param[in] stream CUDA stream to use
+ */
+void batched_compress(compression_type compression,
+                      device_span<device_span<uint8_t const> const> inputs,
+                      device_span<device_span<uint8_t> const> outputs,
+                      device_span<decompress_status> statuses,
+                      uint32_t max_uncomp_chunk_size,
+                      device_span<uint8_t> scratch,
+                      rmm::cuda_stream_view stream);
+
 }  // namespace cudf::io::nvcomp
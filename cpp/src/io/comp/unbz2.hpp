@@ -77,6 +77,10 @@ For more information on these sources, see the manual.
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 namespace cudf {
 namespace io {
 // If BZ_OUTBUFF_FULL is returned and block_start is non-NULL, dstlen will be updated to point to
@@ -102,5 +106,9 @@ int32_t cpu_bz2_uncompress(const uint8_t* input,
                            size_t* dstlen,
                            uint64_t* block_start = nullptr);
 
+// Decompresses a complete single-stream bzip2 input, decoding its blocks concurrently on the IO
+// worker pool. Returns BZ_OK on success, with `dst` resized to the decompressed data.
+int32_t cpu_bz2_uncompress_parallel(const uint8_t* input, size_t inlen, std::vector<uint8_t>& dst);
+
 }  // namespace io
 }  // namespace cudf
@@ -369,6 +369,12 @@ std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t
     return dst;
   }
   if (compression == compression_type::BZIP2) {
+    // Blocks are independent, so they are decoded in parallel; if the parallel decoder rejects
+    // the input, fall back to decoding it sequentially for the same error reporting as before
+    {
+      std::vector<uint8_t> dst;
+      if (cpu_bz2_uncompress_parallel(comp_data, comp_len, dst) == BZ_OK) { return dst; }
+    }
     size_t src_ofs = 0;
     size_t dst_ofs = 0;
     int bz_err     = 0;
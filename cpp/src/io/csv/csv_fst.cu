@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "csv_gpu.hpp"
+
+#include <io/fst/lookup_tables.cuh>
+#include <io/utilities/hostdevice_vector.hpp>
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/count.h>
+#include <thrust/iterator/discard_iterator.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace csv {
+namespace gpu {
+
+// CSV to row offsets DFA (Deterministic Finite Automaton)
+namespace to_row_offsets {
+
+// Type used to represent the target state in the transition table
+using StateT = char;
+
+/**
+ * @brief Definition of the DFA's states
+ *
+ * The states follow the row contexts of `gather_row_offsets`, split by the class of the previous
+ * character where the transitions depend on it, so that both paths find the same rows.
+ */
+enum class dfa_states : StateT {
+  // Outside of quotes, after a terminator or at the start of the input. Every character read in
+  // this state starts a row.
+  TT_ROW = 0U,
+
+  // Outside of quotes, after a delimiter. A quote starts a quoted field.
+  TT_DELIM,
+
+  // Outside of quotes, after a quote. A quote starts a quoted field, which makes a doubled quote
+  // within a quoted field an escaped quote.
+  TT_QUOTE,
+
+  // Outside of quotes, after any other character. A quote is ignored.
+  TT_OTHER,
+
+  // Within a quoted field. Terminators do not end the row.
+  TT_STR,
+
+  // Within a comment row. Everything up to the next terminator is ignored.
+  TT_COMMENT,
+
+  // Total number of states
+  TT_NUM_STATES
+};
+
+// Aliases for readability of the transition table
+constexpr auto TT_ROW     = dfa_states::TT_ROW;
+constexpr auto TT_DELIM   = dfa_states::TT_DELIM;
+constexpr auto TT_QUOTE   = dfa_states::TT_QUOTE;
+constexpr auto TT_OTHER   = dfa_states::TT_OTHER;
+constexpr auto TT_STR     = dfa_states::TT_STR;
+constexpr auto TT_COMMENT = dfa_states::TT_COMMENT;
+
+/**
+ * @brief Definition of the symbol groups
+ */
+enum class dfa_symbol_group_id : uint8_t {
+  TERMINATOR,        ///< Line terminator SG
+  DELIMITER,         ///< Field delimiter SG
+  QUOTE_CHAR,        ///< Quote character SG
+  COMMENT_CHAR,      ///< Comment character SG
+  OTHER_SYMBOLS,     ///< SG implicitly matching all other characters
+  NUM_SYMBOL_GROUPS  ///< Total number of symbol groups
+};
+
+constexpr auto TT_NUM_STATES     = static_cast<StateT>(dfa_states::TT_NUM_STATES);
+constexpr auto NUM_SYMBOL_GROUPS = static_cast<uint32_t>(dfa_symbol_group_id::NUM_SYMBOL_GROUPS);
+
+// Transition table
+std::array<std::array<dfa_states, NUM_SYMBOL_GROUPS>, TT_NUM_STATES> const transition_table{
+  {/* IN_STATE         TERM    DELIM     QUOTE   COMMENT     OTHER */
+   /* TT_ROW     */ {{TT_ROW, TT_DELIM, TT_STR, TT_COMMENT, TT_OTHER}},
+   /* TT_DELIM   */ {{TT_ROW, TT_DELIM, TT_STR, TT_OTHER, TT_OTHER}},
+   /* TT_QUOTE   */ {{TT_ROW, TT_DELIM, TT_STR, TT_OTHER, TT_OTHER}},
+   /* TT_OTHER   */ {{TT_ROW, TT_DELIM, TT_QUOTE, TT_OTHER, TT_OTHER}},
+   /* TT_STR     */ {{TT_STR, TT_STR, TT_QUOTE, TT_STR, TT_STR}},
+   /* TT_COMMENT */ {{TT_ROW, TT_COMMENT, TT_COMMENT, TT_COMMENT, TT_COMMENT}}}};
+
+// Translation table (i.e., for each transition, what are the symbols that we output): a row
+// starts at each character read after a terminator outside of quotes
+std::array<std::array<std::vector<char>, NUM_SYMBOL_GROUPS>, TT_NUM_STATES> const translation_table{
+  {/* IN_STATE          TERM   DELIM  QUOTE  COMMENT OTHER */
+   /* TT_ROW     */ {{{'r'}, {'r'}, {'r'}, {'r'}, {'r'}}},
+   /* TT_DELIM   */ {{{}, {}, {}, {}, {}}},
+   /* TT_QUOTE   */ {{{}, {}, {}, {}, {}}},
+   /* TT_OTHER   */ {{{}, {}, {}, {}, {}}},
+   /* TT_STR     */ {{{}, {}, {}, {}, {}}},
+   /* TT_COMMENT */ {{{}, {}, {}, {}, {}}}}};
+
+// The DFA's starting state
+constexpr auto start_state = static_cast<StateT>(TT_ROW);
+
+}  // namespace to_row_offsets
+
+bool is_fst_tokenizable(cudf::io::parse_options_view const& options)
+{
+  // The symbol group lookup of the FST only maps ASCII characters
+  auto const is_ascii = [](char c) { return static_cast<unsigned char>(c) < 0x80; };
+  return is_ascii(options.terminator) and is_ascii(options.delimiter) and
+         is_ascii(options.quotechar) and is_ascii(options.comment) and
+         not options.multi_delimiter;
+}
+
+rmm::device_uvector<uint64_t> gather_row_offsets_fst(cudf::io::parse_options_view const& options,
+                                                     device_span<char const> data,
+                                                     rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(is_fst_tokenizable(options), "Unsupported special characters for the CSV FST");
+
+  // Rows only start after a terminator, plus the first row and the end of the data
+  auto const max_row_offsets =
+    thrust::count(rmm::exec_policy(stream), data.begin(), data.end(), options.terminator) + 2;
+  rmm::device_uvector<uint64_t> row_offsets(max_row_offsets, stream);
+
+  // A null quote or comment character disables quoting or comments
+  auto const optional_symbol = [](char c) { return c ? std::string(1, c) : std::string{}; };
+  std::array<std::string, to_row_offsets::NUM_SYMBOL_GROUPS - 1> const symbol_groups{
+    {std::string(1, options.terminator),
+     std::string(1, options.delimiter),
+     optional_symbol(options.quotechar),
+     optional_symbol(options.comment)}};
+
+  using ToRowOffsetsFstT =
+    cudf::io::fst::detail::Dfa<char,
+                               static_cast<int32_t>(
+                                 to_row_offsets::dfa_symbol_group_id::NUM_SYMBOL_GROUPS),
+                               static_cast<int32_t>(to_row_offsets::dfa_states::TT_NUM_STATES)>;
+  ToRowOffsetsFstT csv_to_row_offsets_fst{
+    symbol_groups, to_row_offsets::transition_table, to_row_offsets::translation_table, stream};
+
+  hostdevice_vector<uint64_t> num_row_offsets(1, stream);
+  csv_to_row_offsets_fst.Transduce(data.data(),
+                                   static_cast<uint64_t>(data.size()),
+                                   thrust::make_discard_iterator(),
+                                   row_offsets.data(),
+                                   num_row_offsets.device_ptr(),
+                                   to_row_offsets::start_state,
+                                   stream);
+  num_row_offsets.device_to_host(stream, true);
+
+  // Add the end of the data as the last row offset, to infer the length of the last row
+  auto const num_rows  = num_row_offsets[0];
+  auto const data_size = static_cast<uint64_t>(data.size());
+  row_offsets.resize(num_rows + 1, stream);
+  row_offsets.set_element_async(num_rows, data_size, stream);
+  return row_offsets;
+}
+
+}  // namespace gpu
+}  // namespace csv
+}  // namespace io
+}  // namespace cudf
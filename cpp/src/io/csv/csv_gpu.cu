@@ -21,6 +21,7 @@
 #include <io/utilities/block_utils.cuh>
 #include <io/utilities/parsing_utils.cuh>
 
+#include <cudf/detail/utilities/kernel_tuning.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/lists/list_view.hpp>
@@ -36,6 +37,7 @@
 #include <io/utilities/trie.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/count.h>
@@ -44,6 +46,7 @@
 #include <thrust/transform.h>
 
 #include <type_traits>
+#include <vector>
 
 using namespace ::cudf::io;
 
@@ -54,9 +57,15 @@ namespace io {
 namespace csv {
 namespace gpu {
 
-/// Block dimension for dtype detection and conversion kernels
+/// Default block dimension for dtype detection and conversion kernels
 constexpr uint32_t csvparse_block_dim = 128;
 
+/// Largest block dimension the dtype detection and conversion kernels are launched with
+constexpr uint32_t csvparse_max_block_dim = 256;
+
+/// Candidate block dimensions when tuning the dtype detection and conversion kernels
+std::vector<int> const csvparse_block_dims{csvparse_block_dim, 64, csvparse_max_block_dim};
+
 /*
  * @brief Returns true is the input character is a valid digit.
  * Supports both decimal and hexadecimal digits (uppercase and lowercase).
@@ -157,6 +166,107 @@ __device__ __inline__ bool is_floatingpoint(long len,
   return true;
 }
 
+/**
+ * @brief Adds a single field to the type histogram of its column.
+ *
+ * @param opts A set of parsing options
+ * @param field_begin Pointer to the first character of the field
+ * @param field_end Pointer to the delimiter that ends the field
+ * @param flags Parsing behavior flags of the field's column
+ * @param stats The count for each data type of the field's column
+ */
+__device__ void infer_field_type(parse_options_view const& opts,
+                                 char const* field_begin,
+                                 char const* field_end,
+                                 column_parse::flags flags,
+                                 column_type_histogram& stats)
+{
+  auto const field_len = static_cast<size_t>(field_end - field_begin);
+  if (serialized_trie_contains(opts.trie_na, {field_begin, field_len})) {
+    atomicAdd(&stats.null_count, 1);
+  } else if (serialized_trie_contains(opts.trie_true, {field_begin, field_len}) ||
+             serialized_trie_contains(opts.trie_false, {field_begin, field_len})) {
+    atomicAdd(&stats.bool_count, 1);
+  } else if (cudf::io::is_infinity(field_begin, field_end)) {
+    atomicAdd(&stats.float_count, 1);
+  } else {
+    long count_number    = 0;
+    long count_decimal   = 0;
+    long count_thousands = 0;
+    long count_slash     = 0;
+    long count_dash      = 0;
+    long count_plus      = 0;
+    long count_colon     = 0;
+    long count_string    = 0;
+    long count_exponent  = 0;
+
+    // Modify field_begin & end to ignore whitespace and quotechars
+    // This could possibly result in additional empty fields
+    auto const trimmed_field_range = trim_whitespaces_quotes(field_begin, field_end);
+    auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
+
+    for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
+      if (is_digit(*cur)) {
+        count_number++;
+        continue;
+      }
+      if (*cur == opts.decimal) {
+        count_decimal++;
+        continue;
+      }
+      if (*cur == opts.thousands) {
+        count_thousands++;
+        continue;
+      }
+      // Looking for unique characters that will help identify column types.
+      switch (*cur) {
+        case '-': count_dash++; break;
+        case '+': count_plus++; break;
+        case '/': count_slash++; break;
+        case ':': count_colon++; break;
+        case 'e':
+        case 'E':
+          if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
+            count_exponent++;
+          break;
+        default: count_string++; break;
+      }
+    }
+
+    // Integers have to have the length of the string
+    // Off by one if they start with a minus sign
+    auto const int_req_number_cnt =
+      trimmed_field_len - count_thousands -
+      ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
+       trimmed_field_len > 1);
+
+    if (flags & column_parse::as_datetime) {
+      // PANDAS uses `object` dtype if the date is unparseable
+      if (is_datetime(count_string, count_decimal, count_colon, count_dash, count_slash)) {
+        atomicAdd(&stats.datetime_count, 1);
+      } else {
+        atomicAdd(&stats.string_count, 1);
+      }
+    } else if (count_number == int_req_number_cnt) {
+      auto const is_negative = (*trimmed_field_range.first == '-');
+      auto const data_begin =
+        trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
+      cudf::size_type* ptr = cudf::io::gpu::infer_integral_field_counter(
+        data_begin, data_begin + count_number, is_negative, stats);
+      atomicAdd(ptr, 1);
+    } else if (is_floatingpoint(trimmed_field_len,
+                                count_number,
+                                count_decimal,
+                                count_thousands,
+                                count_dash + count_plus,
+                                count_exponent)) {
+      atomicAdd(&stats.float_count, 1);
+    } else {
+      atomicAdd(&stats.string_count, 1);
+    }
+  }
+}
+
 /*
  * @brief CUDA kernel that parses and converts CSV data into cuDF column data.
  *
@@ -169,7 +279,7 @@ __device__ __inline__ bool is_floatingpoint(long len,
  * @param row_offsets The start the CSV data of interest
  * @param d_column_data The count for each column data type
  */
-__global__ void __launch_bounds__(csvparse_block_dim)
+__global__ void __launch_bounds__(csvparse_max_block_dim)
   data_type_detection(parse_options_view const opts,
                       device_span<char const> csv_text,
                       device_span<column_parse::flags const> const column_flags,
@@ -200,91 +310,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
 
     // Checking if this is a column that the user wants --- user can filter columns
     if (column_flags[col] & column_parse::inferred) {
-      // points to last character in the field
-      auto const field_len = static_cast<size_t>(next_delimiter - field_start);
-      if (serialized_trie_contains(opts.trie_na, {field_start, field_len})) {
-        atomicAdd(&d_column_data[actual_col].null_count, 1);
-      } else if (serialized_trie_contains(opts.trie_true, {field_start, field_len}) ||
-                 serialized_trie_contains(opts.trie_false, {field_start, field_len})) {
-        atomicAdd(&d_column_data[actual_col].bool_count, 1);
-      } else if (cudf::io::is_infinity(field_start, next_delimiter)) {
-        atomicAdd(&d_column_data[actual_col].float_count, 1);
-      } else {
-        long count_number    = 0;
-        long count_decimal   = 0;
-        long count_thousands = 0;
-        long count_slash     = 0;
-        long count_dash      = 0;
-        long count_plus      = 0;
-        long count_colon     = 0;
-        long count_string    = 0;
-        long count_exponent  = 0;
-
-        // Modify field_start & end to ignore whitespace and quotechars
-        // This could possibly result in additional empty fields
-        auto const trimmed_field_range = trim_whitespaces_quotes(field_start, next_delimiter);
-        auto const trimmed_field_len   = trimmed_field_range.second - trimmed_field_range.first;
-
-        for (auto cur = trimmed_field_range.first; cur < trimmed_field_range.second; ++cur) {
-          if (is_digit(*cur)) {
-            count_number++;
-            continue;
-          }
-          if (*cur == opts.decimal) {
-            count_decimal++;
-            continue;
-          }
-          if (*cur == opts.thousands) {
-            count_thousands++;
-            continue;
-          }
-          // Looking for unique characters that will help identify column types.
-          switch (*cur) {
-            case '-': count_dash++; break;
-            case '+': count_plus++; break;
-            case '/': count_slash++; break;
-            case ':': count_colon++; break;
-            case 'e':
-            case 'E':
-              if (cur > trimmed_field_range.first && cur < trimmed_field_range.second - 1)
-                count_exponent++;
-              break;
-            default: count_string++; break;
-          }
-        }
-
-        // Integers have to have the length of the string
-        // Off by one if they start with a minus sign
-        auto const int_req_number_cnt =
-          trimmed_field_len - count_thousands -
-          ((*trimmed_field_range.first == '-' || *trimmed_field_range.first == '+') &&
-           trimmed_field_len > 1);
-
-        if (column_flags[col] & column_parse::as_datetime) {
-          // PANDAS uses `object` dtype if the date is unparseable
-          if (is_datetime(count_string, count_decimal, count_colon, count_dash, count_slash)) {
-            atomicAdd(&d_column_data[actual_col].datetime_count, 1);
-          } else {
-            atomicAdd(&d_column_data[actual_col].string_count, 1);
-          }
-        } else if (count_number == int_req_number_cnt) {
-          auto const is_negative = (*trimmed_field_range.first == '-');
-          auto const data_begin =
-            trimmed_field_range.first + (is_negative || (*trimmed_field_range.first == '+'));
-          cudf::size_type* ptr = cudf::io::gpu::infer_integral_field_counter(
-            data_begin, data_begin + count_number, is_negative, d_column_data[actual_col]);
-          atomicAdd(ptr, 1);
-        } else if (is_floatingpoint(trimmed_field_len,
-                                    count_number,
-                                    count_decimal,
-                                    count_thousands,
-                                    count_dash + count_plus,
-                                    count_exponent)) {
-          atomicAdd(&d_column_data[actual_col].float_count, 1);
-        } else {
-          atomicAdd(&d_column_data[actual_col].string_count, 1);
-        }
-      }
+      infer_field_type(
+        opts, field_start, next_delimiter, column_flags[col], d_column_data[actual_col]);
       actual_col++;
     }
     next_field  = next_delimiter + 1;
@@ -496,15 +523,19 @@ struct decode_op {
  * @param[in] dtypes The data type of the column
  * @param[out] columns The output column data
  * @param[out] valids The bitmaps indicating whether column fields are valid
+ * @param[out] inferred_stats The count for each data type of each active column; when not empty,
+ * inferred columns, which must be given the STRING type, are added to the histogram and their
+ * fields are stored with their quotes
  */
-__global__ void __launch_bounds__(csvparse_block_dim)
+__global__ void __launch_bounds__(csvparse_max_block_dim)
   convert_csv_to_cudf(cudf::io::parse_options_view options,
                       device_span<char const> data,
                       device_span<column_parse::flags const> column_flags,
                       device_span<uint64_t const> row_offsets,
                       device_span<cudf::data_type const> dtypes,
                       device_span<void* const> columns,
-                      device_span<cudf::bitmask_type* const> valids)
+                      device_span<cudf::bitmask_type* const> valids,
+                      device_span<column_type_histogram> inferred_stats)
 {
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
@@ -531,6 +562,14 @@ __global__ void __launch_bounds__(csvparse_block_dim)
       auto const is_valid = !serialized_trie_contains(
         options.trie_na, {field_start, static_cast<size_t>(next_delimiter - field_start)});
 
+      // Inferred columns are read as raw strings while their type histogram is gathered
+      auto const is_deferred =
+        not inferred_stats.empty() && (column_flags[col] & column_parse::inferred);
+      if (is_deferred) {
+        infer_field_type(
+          options, field_start, next_delimiter, column_flags[col], inferred_stats[actual_col]);
+      }
+
       // Modify field_start & end to ignore whitespace and quotechars
       auto field_end = next_delimiter;
       if (is_valid && dtypes[actual_col].id() != cudf::type_id::STRING) {
@@ -543,7 +582,8 @@ __global__ void __launch_bounds__(csvparse_block_dim)
         // Type dispatcher does not handle STRING
         if (dtypes[actual_col].id() == cudf::type_id::STRING) {
           auto end = next_delimiter;
-          if (options.keepquotes == false) {
+          // quotes of deferred fields are removed once their type is known
+          if (options.keepquotes == false && not is_deferred) {
             if ((*field_start == options.quotechar) && (*(end - 1) == options.quotechar)) {
               ++field_start;
               --end;
@@ -579,6 +619,61 @@ __global__ void __launch_bounds__(csvparse_block_dim)
   }
 }
 
+/**
+ * @brief CUDA kernel that converts the raw fields of inferred columns to their resolved types.
+ *
+ * Data is processed one record at a time. Fields of STRING columns are unquoted in place.
+ *
+ * @param[in] options A set of parsing options
+ * @param[in] column_flags Per-column parsing behavior flags of the inferred columns
+ * @param[in] dtypes The resolved data type of each inferred column
+ * @param[in,out] fields The raw fields of each inferred column, as (pointer, length) pairs
+ * @param[out] columns The output column data, unused for STRING columns
+ * @param[out] valids The bitmaps indicating whether column fields are valid
+ * @param[in] num_records The number of records in each column
+ */
+__global__ void __launch_bounds__(csvparse_block_dim)
+  convert_inferred_fields(cudf::io::parse_options_view options,
+                          device_span<column_parse::flags const> column_flags,
+                          device_span<cudf::data_type const> dtypes,
+                          device_span<void* const> fields,
+                          device_span<void* const> columns,
+                          device_span<cudf::bitmask_type* const> valids,
+                          size_type num_records)
+{
+  long const rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  for (size_t col = 0; col < dtypes.size(); ++col) {
+    auto& field = static_cast<std::pair<const char*, size_t>*>(fields[col])[rec_id];
+    // N/A and missing fields stay null
+    if (field.first == nullptr) { continue; }
+
+    auto const field_start = field.first;
+    auto const field_end   = field_start + field.second;
+    if (dtypes[col].id() == cudf::type_id::STRING) {
+      if (options.keepquotes == false && field_end - field_start > 1 &&
+          (*field_start == options.quotechar) && (*(field_end - 1) == options.quotechar)) {
+        field.first  = field_start + 1;
+        field.second = field.second - 2;
+      }
+    } else {
+      auto const trimmed_field = trim_whitespaces_quotes(field_start, field_end, options.quotechar);
+      if (cudf::type_dispatcher(dtypes[col],
+                                decode_op{},
+                                columns[col],
+                                rec_id,
+                                dtypes[col],
+                                trimmed_field.first,
+                                trimmed_field.second,
+                                options,
+                                column_flags[col])) {
+        set_bit(valids[col], rec_id);
+      }
+    }
+  }
+}
+
 /*
  * @brief Merge two packed row contexts (each corresponding to a block of characters)
  * and return the packed row context corresponding to the merged character block
@@ -984,15 +1079,19 @@ std::vector<column_type_histogram> detect_column_types(
   size_t const num_active_columns,
   rmm::cuda_stream_view stream)
 {
-  // Calculate actual block count to use based on records count
-  const int block_size = csvparse_block_dim;
-  const int grid_size  = (row_starts.size() + block_size - 1) / block_size;
-
-  auto d_stats =
-    detail::make_zeroed_device_uvector_async<column_type_histogram>(num_active_columns, stream);
-
-  data_type_detection<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_starts, d_stats);
+  rmm::device_uvector<column_type_histogram> d_stats(num_active_columns, stream);
+
+  auto const launch = [&](int block_size) {
+    // Calculate actual block count to use based on records count
+    auto const grid_size = (row_starts.size() + block_size - 1) / block_size;
+    // the histogram is accumulated with atomics, so each launch starts from zero
+    CUDF_CUDA_TRY(cudaMemsetAsync(
+      d_stats.data(), 0, d_stats.size() * sizeof(column_type_histogram), stream.value()));
+    data_type_detection<<<grid_size, block_size, 0, stream.value()>>>(
+      options, data, column_flags, row_starts, d_stats);
+  };
+  detail::launch_tuned_kernel(
+    "csv::data_type_detection", row_starts.size(), csvparse_block_dims, launch, stream);
 
   return detail::make_std_vector_sync(d_stats, stream);
 }
@@ -1006,13 +1105,62 @@ void __host__ decode_row_column_data(cudf::io::parse_options_view const& options
                                      device_span<cudf::bitmask_type* const> valids,
                                      rmm::cuda_stream_view stream)
 {
-  // Calculate actual block count to use based on records count
+  auto const num_rows = row_offsets.size() - 1;
+
+  auto const launch = [&](int block_size) {
+    // Calculate actual block count to use based on records count
+    auto const grid_size = (num_rows + block_size - 1) / block_size;
+    convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
+      options, data, column_flags, row_offsets, dtypes, columns, valids, {});
+  };
+  detail::launch_tuned_kernel(
+    "csv::convert_csv_to_cudf", num_rows, csvparse_block_dims, launch, stream);
+}
+
+std::vector<column_type_histogram> decode_and_detect_column_types(
+  cudf::io::parse_options_view const& options,
+  device_span<char const> data,
+  device_span<column_parse::flags const> column_flags,
+  device_span<uint64_t const> row_offsets,
+  device_span<cudf::data_type const> dtypes,
+  device_span<void* const> columns,
+  device_span<cudf::bitmask_type* const> valids,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = row_offsets.size() - 1;
+
+  rmm::device_uvector<column_type_histogram> d_stats(dtypes.size(), stream);
+
+  auto const launch = [&](int block_size) {
+    // Calculate actual block count to use based on records count
+    auto const grid_size = (num_rows + block_size - 1) / block_size;
+    // the histogram is accumulated with atomics, so each launch starts from zero
+    CUDF_CUDA_TRY(cudaMemsetAsync(
+      d_stats.data(), 0, d_stats.size() * sizeof(column_type_histogram), stream.value()));
+    convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
+      options, data, column_flags, row_offsets, dtypes, columns, valids, d_stats);
+  };
+  detail::launch_tuned_kernel(
+    "csv::convert_csv_to_cudf_with_stats", num_rows, csvparse_block_dims, launch, stream);
+
+  return detail::make_std_vector_sync(d_stats, stream);
+}
+
+void __host__ convert_inferred_columns(cudf::io::parse_options_view const& options,
+                                       device_span<column_parse::flags const> column_flags,
+                                       device_span<cudf::data_type const> dtypes,
+                                       device_span<void* const> fields,
+                                       device_span<void* const> columns,
+                                       device_span<cudf::bitmask_type* const> valids,
+                                       size_type num_records,
+                                       rmm::cuda_stream_view stream)
+{
+  // Not tuned, since the kernel unquotes the fields in place and cannot be launched repeatedly
   auto const block_size = csvparse_block_dim;
-  auto const num_rows   = row_offsets.size() - 1;
-  auto const grid_size  = (num_rows + block_size - 1) / block_size;
+  auto const grid_size  = (num_records + block_size - 1) / block_size;
 
-  convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids);
+  convert_inferred_fields<<<grid_size, block_size, 0, stream.value()>>>(
+    options, column_flags, dtypes, fields, columns, valids, num_records);
 }
 
 uint32_t __host__ gather_row_offsets(const parse_options_view& options,
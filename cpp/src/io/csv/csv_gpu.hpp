@@ -22,6 +22,7 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
 using cudf::device_span;
 
@@ -162,6 +163,34 @@ uint32_t gather_row_offsets(cudf::io::parse_options_view const& options,
                             size_t skip_rows,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns whether the rows of data parsed with `options` can be found with
+ * `gather_row_offsets_fst`.
+ *
+ * @param options Options that control parsing of individual fields
+ */
+bool is_fst_tokenizable(cudf::io::parse_options_view const& options);
+
+/**
+ * @brief Gathers the offsets of the rows of the whole character data in a single finite-state
+ * transducer pass.
+ *
+ * Finds the same rows as the two phases of `gather_row_offsets` over the whole data, without a
+ * byte range or skipped rows: the first row starts at the beginning of the data and a row starts
+ * after each terminator outside of a quoted field. A comment row ends at the next terminator, and
+ * a doubled quote within a quoted field is an escaped quote. The last offset is the end of the
+ * data.
+ *
+ * @param options Options that control parsing of individual fields
+ * @param data Character data
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ *
+ * @return Row offsets, followed by the size of the data
+ */
+rmm::device_uvector<uint64_t> gather_row_offsets_fst(cudf::io::parse_options_view const& options,
+                                                     device_span<char const> data,
+                                                     rmm::cuda_stream_view stream);
+
 /**
  * Count the number of blank rows in the given row offset array
  *
@@ -228,6 +257,57 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
                             device_span<cudf::bitmask_type* const> valids,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for decoding row-column data while detecting the dtype of the inferred
+ * columns
+ *
+ * Inferred columns must be given the STRING dtype; their fields are stored with their quotes and
+ * are converted by `convert_inferred_columns` once the dtype is resolved from the histogram.
+ *
+ * @param[in] options Options that control individual field data conversion
+ * @param[in] data The row-column data
+ * @param[in] column_flags Flags that control individual column parsing
+ * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] dtypes List of dtype corresponding to each column
+ * @param[out] columns Device memory output of column data
+ * @param[out] valids Device memory output of column valids bitmap data
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return stats Histogram of each dtypes' occurrence for each active column
+ */
+std::vector<column_type_histogram> decode_and_detect_column_types(
+  cudf::io::parse_options_view const& options,
+  device_span<char const> data,
+  device_span<column_parse::flags const> column_flags,
+  device_span<uint64_t const> row_offsets,
+  device_span<cudf::data_type const> dtypes,
+  device_span<void* const> columns,
+  device_span<cudf::bitmask_type* const> valids,
+  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernel for converting the raw fields of inferred columns to their resolved dtype
+ *
+ * Fields of STRING columns are unquoted in place; other columns are decoded into `columns`.
+ *
+ * @param[in] options Options that control individual field data conversion
+ * @param[in] column_flags Flags that control parsing of each inferred column
+ * @param[in] dtypes Resolved dtype of each inferred column
+ * @param[in,out] fields Raw fields of each inferred column
+ * @param[out] columns Device memory output of column data
+ * @param[out] valids Device memory output of column valids bitmap data
+ * @param[in] num_records Number of records in each column
+ * @param[in] stream CUDA stream to use, default 0
+ */
+void convert_inferred_columns(cudf::io::parse_options_view const& options,
+                              device_span<column_parse::flags const> column_flags,
+                              device_span<cudf::data_type const> dtypes,
+                              device_span<void* const> fields,
+                              device_span<void* const> columns,
+                              device_span<cudf::bitmask_type* const> valids,
+                              size_type num_records,
+                              rmm::cuda_stream_view stream);
+
 }  // namespace gpu
 }  // namespace csv
 }  // namespace io
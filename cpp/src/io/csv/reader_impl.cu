@@ -29,6 +29,7 @@
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
 #include <cudf/io/csv.hpp>
@@ -41,9 +42,17 @@
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/count.h>
+#include <thrust/fill.h>
+#include <thrust/find.h>
+#include <thrust/functional.h>
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/scan.h>
 
 #include <algorithm>
 #include <iostream>
@@ -255,114 +264,124 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
     (load_whole_file) ? data.size() : std::min(buffer_size * 2, data.size()), stream};
   d_data.resize(0, stream);
   rmm::device_uvector<uint64_t> all_row_offsets{0, stream};
-  do {
-    size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
-    size_t chunk_size = target_pos - pos;
-
-    auto const previous_data_size = d_data.size();
-    d_data.resize(target_pos - buffer_pos, stream);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
-                                  data.begin() + buffer_pos + previous_data_size,
-                                  target_pos - buffer_pos - previous_data_size,
-                                  cudaMemcpyDefault,
-                                  stream.value()));
-
-    // Pass 1: Count the potential number of rows in each character block for each
-    // possible parser state at the beginning of the block.
-    uint32_t num_blocks = cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
-                                                                 row_ctx.device_ptr(),
-                                                                 device_span<uint64_t>(),
-                                                                 d_data,
-                                                                 chunk_size,
-                                                                 pos,
-                                                                 buffer_pos,
-                                                                 data.size(),
-                                                                 range_begin,
-                                                                 range_end,
-                                                                 skip_rows,
-                                                                 stream);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                  row_ctx.device_ptr(),
-                                  num_blocks * sizeof(uint64_t),
-                                  cudaMemcpyDeviceToHost,
-                                  stream.value()));
-    stream.synchronize();
-
-    // Sum up the rows in each character block, selecting the row count that
-    // corresponds to the current input context. Also stores the now known input
-    // context per character block that will be needed by the second pass.
-    for (uint32_t i = 0; i < num_blocks; i++) {
-      uint64_t ctx_next = cudf::io::csv::gpu::select_row_context(ctx, row_ctx[i]);
-      row_ctx[i]        = ctx;
-      ctx               = ctx_next;
-    }
-    size_t total_rows = ctx >> 2;
-    if (total_rows > skip_rows) {
-      // At least one row in range in this batch
-      all_row_offsets.resize(total_rows - skip_rows, stream);
+  if (load_whole_file and cudf::io::csv::gpu::is_fst_tokenizable(parse_opts.view())) {
+    // All rows are read, so the whole data is transferred at once and its rows are found in a
+    // single transduction pass
+    d_data.resize(data.size(), stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      d_data.begin(), data.begin(), data.size(), cudaMemcpyDefault, stream.value()));
+    all_row_offsets =
+      cudf::io::csv::gpu::gather_row_offsets_fst(parse_opts.view(), d_data, stream);
+  } else {
+    do {
+      size_t target_pos = std::min(pos + max_chunk_bytes, data.size());
+      size_t chunk_size = target_pos - pos;
+
+      auto const previous_data_size = d_data.size();
+      d_data.resize(target_pos - buffer_pos, stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(d_data.begin() + previous_data_size,
+                                    data.begin() + buffer_pos + previous_data_size,
+                                    target_pos - buffer_pos - previous_data_size,
+                                    cudaMemcpyDefault,
+                                    stream.value()));
 
-      CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.device_ptr(),
-                                    row_ctx.host_ptr(),
+      // Pass 1: Count the potential number of rows in each character block for each
+      // possible parser state at the beginning of the block.
+      uint32_t num_blocks = cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
+                                                                   row_ctx.device_ptr(),
+                                                                   device_span<uint64_t>(),
+                                                                   d_data,
+                                                                   chunk_size,
+                                                                   pos,
+                                                                   buffer_pos,
+                                                                   data.size(),
+                                                                   range_begin,
+                                                                   range_end,
+                                                                   skip_rows,
+                                                                   stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
+                                    row_ctx.device_ptr(),
                                     num_blocks * sizeof(uint64_t),
-                                    cudaMemcpyHostToDevice,
+                                    cudaMemcpyDeviceToHost,
                                     stream.value()));
+      cudf::detail::synchronize_stream(stream);
+
+      // Sum up the rows in each character block, selecting the row count that
+      // corresponds to the current input context. Also stores the now known input
+      // context per character block that will be needed by the second pass.
+      for (uint32_t i = 0; i < num_blocks; i++) {
+        uint64_t ctx_next = cudf::io::csv::gpu::select_row_context(ctx, row_ctx[i]);
+        row_ctx[i]        = ctx;
+        ctx               = ctx_next;
+      }
+      size_t total_rows = ctx >> 2;
+      if (total_rows > skip_rows) {
+        // At least one row in range in this batch
+        all_row_offsets.resize(total_rows - skip_rows, stream);
 
-      // Pass 2: Output row offsets
-      cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
-                                             row_ctx.device_ptr(),
-                                             all_row_offsets,
-                                             d_data,
-                                             chunk_size,
-                                             pos,
-                                             buffer_pos,
-                                             data.size(),
-                                             range_begin,
-                                             range_end,
-                                             skip_rows,
-                                             stream);
-      // With byte range, we want to keep only one row out of the specified range
-      if (range_end < data.size()) {
-        CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
-                                      row_ctx.device_ptr(),
+        CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.device_ptr(),
+                                      row_ctx.host_ptr(),
                                       num_blocks * sizeof(uint64_t),
-                                      cudaMemcpyDeviceToHost,
+                                      cudaMemcpyHostToDevice,
                                       stream.value()));
-        stream.synchronize();
 
-        size_t rows_out_of_range = 0;
-        for (uint32_t i = 0; i < num_blocks; i++) {
-          rows_out_of_range += row_ctx[i];
-        }
-        if (rows_out_of_range != 0) {
-          // Keep one row out of range (used to infer length of previous row)
-          auto new_row_offsets_size =
-            all_row_offsets.size() - std::min(rows_out_of_range - 1, all_row_offsets.size());
-          all_row_offsets.resize(new_row_offsets_size, stream);
-          // Implies we reached the end of the range
-          break;
-        }
-      }
-      // num_rows does not include blank rows
-      if (num_rows >= 0) {
-        if (all_row_offsets.size() > header_rows + static_cast<size_t>(num_rows)) {
-          size_t num_blanks = cudf::io::csv::gpu::count_blank_rows(
-            parse_opts.view(), d_data, all_row_offsets, stream);
-          if (all_row_offsets.size() - num_blanks > header_rows + static_cast<size_t>(num_rows)) {
-            // Got the desired number of rows
+        // Pass 2: Output row offsets
+        cudf::io::csv::gpu::gather_row_offsets(parse_opts.view(),
+                                               row_ctx.device_ptr(),
+                                               all_row_offsets,
+                                               d_data,
+                                               chunk_size,
+                                               pos,
+                                               buffer_pos,
+                                               data.size(),
+                                               range_begin,
+                                               range_end,
+                                               skip_rows,
+                                               stream);
+        // With byte range, we want to keep only one row out of the specified range
+        if (range_end < data.size()) {
+          CUDF_CUDA_TRY(cudaMemcpyAsync(row_ctx.host_ptr(),
+                                        row_ctx.device_ptr(),
+                                        num_blocks * sizeof(uint64_t),
+                                        cudaMemcpyDeviceToHost,
+                                        stream.value()));
+          cudf::detail::synchronize_stream(stream);
+
+          size_t rows_out_of_range = 0;
+          for (uint32_t i = 0; i < num_blocks; i++) {
+            rows_out_of_range += row_ctx[i];
+          }
+          if (rows_out_of_range != 0) {
+            // Keep one row out of range (used to infer length of previous row)
+            auto new_row_offsets_size =
+              all_row_offsets.size() - std::min(rows_out_of_range - 1, all_row_offsets.size());
+            all_row_offsets.resize(new_row_offsets_size, stream);
+            // Implies we reached the end of the range
             break;
           }
         }
+        // num_rows does not include blank rows
+        if (num_rows >= 0) {
+          if (all_row_offsets.size() > header_rows + static_cast<size_t>(num_rows)) {
+            size_t num_blanks = cudf::io::csv::gpu::count_blank_rows(
+              parse_opts.view(), d_data, all_row_offsets, stream);
+            if (all_row_offsets.size() - num_blanks > header_rows + static_cast<size_t>(num_rows)) {
+              // Got the desired number of rows
+              break;
+            }
+          }
+        }
+      } else {
+        // Discard data (all rows below skip_rows), keeping one character for history
+        size_t discard_bytes = std::max(d_data.size(), sizeof(char)) - sizeof(char);
+        if (discard_bytes != 0) {
+          erase_except_last(d_data, stream);
+          buffer_pos += discard_bytes;
+        }
       }
-    } else {
-      // Discard data (all rows below skip_rows), keeping one character for history
-      size_t discard_bytes = std::max(d_data.size(), sizeof(char)) - sizeof(char);
-      if (discard_bytes != 0) {
-        erase_except_last(d_data, stream);
-        buffer_pos += discard_bytes;
-      }
-    }
-    pos = target_pos;
-  } while (pos < data.size());
+      pos = target_pos;
+    } while (pos < data.size());
+  }
 
   auto const non_blank_row_offsets =
     io::csv::gpu::remove_blank_rows(parse_opts.view(), d_data, all_row_offsets, stream);
@@ -376,7 +395,7 @@ std::pair<rmm::device_uvector<char>, selected_rows_offsets> load_data_and_gather
                                   2 * sizeof(uint64_t),
                                   cudaMemcpyDeviceToHost,
                                   stream.value()));
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
 
     const auto header_start = buffer_pos + row_ctx[0];
     const auto header_end   = buffer_pos + row_ctx[1];
@@ -501,6 +520,43 @@ void get_data_types_from_column_names(std::map<std::string, data_type> const& us
   }
 }
 
+/**
+ * @brief Resolves the type of an inferred column from the histogram of its field types.
+ */
+data_type infer_type_from_histogram(column_type_histogram const& stats,
+                                    int32_t num_records,
+                                    data_type timestamp_type)
+{
+  unsigned long long int_count_total =
+    stats.big_int_count + stats.negative_small_int_count + stats.positive_small_int_count;
+
+  if (stats.null_count == num_records) {
+    // Entire column is NULL; allocate the smallest amount of memory
+    return data_type(cudf::type_id::INT8);
+  } else if (stats.string_count > 0L) {
+    return data_type(cudf::type_id::STRING);
+  } else if (stats.datetime_count > 0L) {
+    return timestamp_type.id() == cudf::type_id::EMPTY
+             ? data_type(cudf::type_id::TIMESTAMP_NANOSECONDS)
+             : timestamp_type;
+  } else if (stats.bool_count > 0L) {
+    return data_type(cudf::type_id::BOOL8);
+  } else if (stats.float_count > 0L ||
+             (stats.float_count == 0L && int_count_total > 0L && stats.null_count > 0L)) {
+    // The second condition has been added to conform to
+    // pandas which states that a column of integers with
+    // a single NULL record need to be treated as floats.
+    return data_type(cudf::type_id::FLOAT64);
+  } else if (stats.big_int_count == 0) {
+    return data_type(cudf::type_id::INT64);
+  } else if (stats.big_int_count != 0 && stats.negative_small_int_count != 0) {
+    return data_type(cudf::type_id::STRING);
+  } else {
+    // Integers are stored as 64-bit to conform to PANDAS
+    return data_type(cudf::type_id::UINT64);
+  }
+}
+
 void infer_column_types(parse_options const& parse_opts,
                         host_span<column_parse::flags const> column_flags,
                         device_span<char const> data,
@@ -532,40 +588,13 @@ void infer_column_types(parse_options const& parse_opts,
                                             row_offsets,
                                             num_inferred_columns,
                                             stream);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   auto inf_col_idx = 0;
   for (auto col_idx = 0u; col_idx < column_flags.size(); ++col_idx) {
     if (not(column_flags[col_idx] & column_parse::inferred)) { continue; }
-    auto const& stats = column_stats[inf_col_idx++];
-    unsigned long long int_count_total =
-      stats.big_int_count + stats.negative_small_int_count + stats.positive_small_int_count;
-
-    if (stats.null_count == num_records) {
-      // Entire column is NULL; allocate the smallest amount of memory
-      column_types[col_idx] = data_type(cudf::type_id::INT8);
-    } else if (stats.string_count > 0L) {
-      column_types[col_idx] = data_type(cudf::type_id::STRING);
-    } else if (stats.datetime_count > 0L) {
-      column_types[col_idx] = timestamp_type.id() == cudf::type_id::EMPTY
-                                ? data_type(cudf::type_id::TIMESTAMP_NANOSECONDS)
-                                : timestamp_type;
-    } else if (stats.bool_count > 0L) {
-      column_types[col_idx] = data_type(cudf::type_id::BOOL8);
-    } else if (stats.float_count > 0L ||
-               (stats.float_count == 0L && int_count_total > 0L && stats.null_count > 0L)) {
-      // The second condition has been added to conform to
-      // pandas which states that a column of integers with
-      // a single NULL record need to be treated as floats.
-      column_types[col_idx] = data_type(cudf::type_id::FLOAT64);
-    } else if (stats.big_int_count == 0) {
-      column_types[col_idx] = data_type(cudf::type_id::INT64);
-    } else if (stats.big_int_count != 0 && stats.negative_small_int_count != 0) {
-      column_types[col_idx] = data_type(cudf::type_id::STRING);
-    } else {
-      // Integers are stored as 64-bit to conform to PANDAS
-      column_types[col_idx] = data_type(cudf::type_id::UINT64);
-    }
+    column_types[col_idx] =
+      infer_type_from_histogram(column_stats[inf_col_idx++], num_records, timestamp_type);
   }
 }
 
@@ -578,6 +607,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
                                        int32_t num_records,
                                        int32_t num_actual_columns,
                                        int32_t num_active_columns,
+                                       std::vector<column_type_histogram>* inferred_stats,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
@@ -610,6 +640,19 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
     h_valid[i] = out_buffers[i].null_mask();
   }
 
+  if (inferred_stats != nullptr) {
+    *inferred_stats = cudf::io::csv::gpu::decode_and_detect_column_types(
+      parse_opts.view(),
+      data,
+      make_device_uvector_async(column_flags, stream),
+      row_offsets,
+      make_device_uvector_async(column_types, stream),
+      make_device_uvector_async(h_data, stream),
+      make_device_uvector_async(h_valid, stream),
+      stream);
+    return out_buffers;
+  }
+
   cudf::io::csv::gpu::decode_row_column_data(parse_opts.view(),
                                              data,
                                              make_device_uvector_async(column_flags, stream),
@@ -622,6 +665,79 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
   return out_buffers;
 }
 
+/**
+ * @brief Resolves the types of the columns whose raw fields were kept by a single-pass decode, and
+ * converts their fields to the resolved types.
+ *
+ * @param parse_opts Parsing options
+ * @param column_flags Per-column parsing behavior flags
+ * @param inferred_stats Type histogram of each active column
+ * @param num_records Number of records in each column
+ * @param timestamp_type Type of the inferred timestamp columns, EMPTY for the default
+ * @param column_types Types of the active columns, updated for the inferred columns
+ * @param out_buffers Buffers of the active columns, replaced for the inferred non-string columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the replaced buffers
+ */
+void convert_inferred_columns(parse_options const& parse_opts,
+                              host_span<column_parse::flags const> column_flags,
+                              host_span<column_type_histogram const> inferred_stats,
+                              int32_t num_records,
+                              data_type timestamp_type,
+                              host_span<data_type> column_types,
+                              std::vector<column_buffer>& out_buffers,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  std::vector<column_parse::flags> h_flags;
+  std::vector<data_type> h_types;
+  thrust::host_vector<void*> h_fields;
+  thrust::host_vector<void*> h_data;
+  thrust::host_vector<bitmask_type*> h_valid;
+  std::vector<std::pair<size_t, column_buffer>> converted_buffers;
+
+  for (size_t col = 0, active_col = 0; col < column_flags.size(); ++col) {
+    if (not(column_flags[col] & column_parse::enabled)) { continue; }
+    if (column_flags[col] & column_parse::inferred) {
+      auto const dtype =
+        infer_type_from_histogram(inferred_stats[active_col], num_records, timestamp_type);
+      column_types[active_col] = dtype;
+
+      h_flags.push_back(column_flags[col]);
+      h_types.push_back(dtype);
+      h_fields.push_back(out_buffers[active_col].data());
+      if (dtype.id() == type_id::STRING) {
+        // Fields are unquoted in place
+        h_data.push_back(nullptr);
+        h_valid.push_back(nullptr);
+      } else {
+        auto out_buffer         = column_buffer(dtype, num_records, true, stream, mr);
+        out_buffer.name         = out_buffers[active_col].name;
+        out_buffer.null_count() = UNKNOWN_NULL_COUNT;
+        h_data.push_back(out_buffer.data());
+        h_valid.push_back(out_buffer.null_mask());
+        converted_buffers.emplace_back(active_col, std::move(out_buffer));
+      }
+    }
+    ++active_col;
+  }
+  if (h_types.empty()) { return; }
+
+  cudf::io::csv::gpu::convert_inferred_columns(parse_opts.view(),
+                                               make_device_uvector_async(h_flags, stream),
+                                               make_device_uvector_async(h_types, stream),
+                                               make_device_uvector_async(h_fields, stream),
+                                               make_device_uvector_async(h_data, stream),
+                                               make_device_uvector_async(h_valid, stream),
+                                               num_records,
+                                               stream);
+
+  // The raw fields are freed in stream order, after the conversion
+  for (auto& [active_col, out_buffer] : converted_buffers) {
+    out_buffers[active_col] = std::move(out_buffer);
+  }
+}
+
 std::vector<data_type> determine_column_types(csv_reader_options const& reader_opts,
                                               parse_options const& parse_opts,
                                               host_span<std::string const> column_names,
@@ -629,6 +745,7 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
                                               device_span<uint64_t const> row_offsets,
                                               int32_t num_records,
                                               host_span<column_parse::flags> column_flags,
+                                              bool defer_inference,
                                               rmm::cuda_stream_view stream)
 {
   std::vector<data_type> column_types(column_flags.size());
@@ -643,14 +760,23 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
                }},
              reader_opts.get_dtypes());
 
-  infer_column_types(parse_opts,
-                     column_flags,
-                     data,
-                     row_offsets,
-                     num_records,
-                     reader_opts.get_timestamp_type(),
-                     column_types,
-                     stream);
+  if (defer_inference) {
+    // Inferred columns are read as raw strings until their types are resolved during decoding
+    for (auto col_idx = 0u; col_idx < column_flags.size(); ++col_idx) {
+      if (column_flags[col_idx] & column_parse::inferred) {
+        column_types[col_idx] = data_type(cudf::type_id::STRING);
+      }
+    }
+  } else {
+    infer_column_types(parse_opts,
+                       column_flags,
+                       data,
+                       row_offsets,
+                       num_records,
+                       reader_opts.get_timestamp_type(),
+                       column_types,
+                       stream);
+  }
 
   // compact column_types to only include active columns
   std::vector<data_type> active_col_types;
@@ -665,11 +791,20 @@ std::vector<data_type> determine_column_types(csv_reader_options const& reader_o
   return active_col_types;
 }
 
+/**
+ * @brief Layout of the columns of a CSV input, as resolved from its header and the options.
+ */
+struct column_layout {
+  std::vector<std::string> names;   ///< Names of all the columns, after renaming
+  std::vector<int> active_indexes;  ///< Indexes of the columns that are read, in ascending order
+};
+
 table_with_metadata read_csv(cudf::io::datasource* source,
                              csv_reader_options const& reader_opts,
                              parse_options const& parse_opts,
                              rmm::cuda_stream_view stream,
-                             rmm::mr::device_memory_resource* mr)
+                             rmm::mr::device_memory_resource* mr,
+                             column_layout* layout = nullptr)
 {
   std::vector<char> header;
 
@@ -810,16 +945,36 @@ table_with_metadata read_csv(cudf::io::datasource* source,
     }
   }
 
+  if (layout != nullptr) {
+    layout->names = column_names;
+    layout->active_indexes.clear();
+    for (size_t col = 0; col < column_flags.size(); ++col) {
+      if (column_flags[col] & column_parse::enabled) { layout->active_indexes.push_back(col); }
+    }
+  }
+
   // Return empty table rather than exception if nothing to load
   if (num_active_columns == 0) { return {std::make_unique<table>(), {}}; }
 
-  auto const column_types = determine_column_types(
-    reader_opts, parse_opts, column_names, data, row_offsets, num_records, column_flags, stream);
+  // Single-pass inference gathers the type histogram while decoding, so there is nothing to defer
+  // when the data is empty
+  auto const single_pass = reader_opts.is_enabled_single_pass_inference() && num_records != 0;
+
+  auto column_types = determine_column_types(reader_opts,
+                                             parse_opts,
+                                             column_names,
+                                             data,
+                                             row_offsets,
+                                             num_records,
+                                             column_flags,
+                                             single_pass,
+                                             stream);
 
   auto metadata    = table_metadata{};
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
   out_columns.reserve(column_types.size());
   if (num_records != 0) {
+    std::vector<column_type_histogram> inferred_stats;
     auto out_buffers = decode_data(  //
       parse_opts,
       column_flags,
@@ -830,8 +985,20 @@ table_with_metadata read_csv(cudf::io::datasource* source,
       num_records,
       num_actual_columns,
       num_active_columns,
+      single_pass ? &inferred_stats : nullptr,
       stream,
       mr);
+    if (single_pass) {
+      convert_inferred_columns(parse_opts,
+                               column_flags,
+                               inferred_stats,
+                               num_records,
+                               reader_opts.get_timestamp_type(),
+                               column_types,
+                               out_buffers,
+                               stream,
+                               mr);
+    }
     for (size_t i = 0; i < column_types.size(); ++i) {
       metadata.column_names.emplace_back(out_buffers[i].name);
       if (column_types[i].id() == type_id::STRING && parse_opts.quotechar != '\0' &&
@@ -962,6 +1129,51 @@ parse_options make_parse_options(csv_reader_options const& reader_opts,
   return parse_opts;
 }
 
+/**
+ * @brief Counts the complete rows at the start of `data`, and finds where the last one ends.
+ *
+ * `data` must begin at the start of a row, i.e. outside of quotes. A row terminator ends a row
+ * when it is preceded by an even number of quote characters.
+ *
+ * @return The number of complete rows, and the offset past the terminator of the last one
+ */
+std::pair<std::size_t, std::size_t> find_complete_rows(device_span<char const> data,
+                                                       parse_options const& parse_opts,
+                                                       rmm::cuda_stream_view stream)
+{
+  auto const quotechar  = parse_opts.quotechar;
+  auto const terminator = parse_opts.terminator;
+
+  // Quote parity of every character, inclusive of the character itself
+  rmm::device_uvector<uint8_t> in_quotes(data.size(), stream);
+  if (quotechar != '\0') {
+    thrust::transform_inclusive_scan(
+      rmm::exec_policy(stream),
+      data.begin(),
+      data.end(),
+      in_quotes.begin(),
+      [quotechar] __device__(char c) -> uint8_t { return c == quotechar; },
+      thrust::bit_xor<uint8_t>{});
+  } else {
+    thrust::fill(rmm::exec_policy(stream), in_quotes.begin(), in_quotes.end(), 0);
+  }
+
+  auto const is_row_end = [data, terminator, d_in_quotes = in_quotes.data()] __device__(
+                            std::size_t i) {
+    return data[i] == terminator and d_in_quotes[i] == 0;
+  };
+  auto const num_rows = thrust::count_if(rmm::exec_policy(stream),
+                                         thrust::make_counting_iterator<std::size_t>(0),
+                                         thrust::make_counting_iterator(data.size()),
+                                         is_row_end);
+  if (num_rows == 0) { return {0, 0}; }
+
+  auto const rbegin = thrust::make_reverse_iterator(thrust::make_counting_iterator(data.size()));
+  auto const rend   = thrust::make_reverse_iterator(thrust::make_counting_iterator<std::size_t>(0));
+  auto const last_row_end = thrust::find_if(rmm::exec_policy(stream), rbegin, rend, is_row_end);
+  return {num_rows, *last_row_end + 1};
+}
+
 }  // namespace
 
 table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
@@ -974,6 +1186,154 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
   return read_csv(source.get(), options, parse_options, stream, mr);
 }
 
+/**
+ * @brief Implementation of the chunked CSV reader.
+ *
+ * Every buffer that is parsed starts at the beginning of a row, so rows can be split from the
+ * buffer by quote parity alone; the incomplete row at the end of a chunk is the only parse state
+ * carried across chunks. It is kept on the device and prepended to the next chunk.
+ */
+class chunked_reader::impl {
+ public:
+  impl(text::data_chunk_source const& source,
+       csv_reader_options const& options,
+       std::size_t chunk_size,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _reader{source.create_reader()},
+      _options{options},
+      _parse_opts{make_parse_options(options, stream)},
+      _chunk_size{chunk_size},
+      _stream{stream},
+      _mr{mr},
+      _carry{0, stream}
+  {
+    CUDF_EXPECTS(_chunk_size > 0, "Chunk size must be positive.");
+    CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+                 "Byte ranges are not supported by the chunked CSV reader.");
+    CUDF_EXPECTS(_options.get_nrows() < 0 and _options.get_skipfooter() == 0,
+                 "nrows and skipfooter are not supported by the chunked CSV reader.");
+    CUDF_EXPECTS(_options.get_compression() == compression_type::NONE or
+                   _options.get_compression() == compression_type::AUTO,
+                 "Compressed input is not supported by the chunked CSV reader.");
+    _options.set_compression(compression_type::NONE);
+  }
+
+  [[nodiscard]] bool has_next() const { return not _source_exhausted or not _carry.is_empty(); }
+
+  table_with_metadata read_chunk()
+  {
+    // The first chunk must hold the skipped rows, the header rows and at least one data row, so the
+    // column types are not inferred from an empty chunk
+    std::size_t const min_rows =
+      _is_first_chunk
+        ? std::max(_options.get_skiprows(), 0) + std::max(_options.get_header(), -1) + 2
+        : 1;
+
+    auto buffer          = std::move(_carry);
+    std::size_t rows_end = 0;
+    while (not _source_exhausted) {
+      auto const chunk = _reader->get_next_chunk(_chunk_size, _stream);
+      // The readers only return fewer bytes than requested once they reach the end of the data
+      _source_exhausted = chunk->size() < _chunk_size;
+
+      auto const old_size = buffer.size();
+      buffer.resize(old_size + chunk->size(), _stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(buffer.data() + old_size,
+                                    chunk->data(),
+                                    chunk->size(),
+                                    cudaMemcpyDeviceToDevice,
+                                    _stream.value()));
+
+      auto const [num_rows, complete_rows_end] = find_complete_rows(buffer, _parse_opts, _stream);
+      rows_end                                 = complete_rows_end;
+      if (num_rows >= min_rows) { break; }
+    }
+    if (_source_exhausted) { rows_end = buffer.size(); }
+
+    _carry = rmm::device_uvector<char>(buffer.size() - rows_end, _stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(_carry.data(),
+                                  buffer.data() + rows_end,
+                                  _carry.size(),
+                                  cudaMemcpyDeviceToDevice,
+                                  _stream.value()));
+
+    auto const h_rows =
+      cudf::detail::make_std_vector_sync(device_span<char const>{buffer.data(), rows_end}, _stream);
+    if (h_rows.empty()) { return make_empty_chunk(); }
+
+    auto const source = datasource::create(host_buffer{h_rows.data(), h_rows.size()});
+    if (not _is_first_chunk) {
+      return read_csv(source.get(), _options, _parse_opts, _stream, _mr);
+    }
+
+    column_layout layout;
+    auto chunk = read_csv(source.get(), _options, _parse_opts, _stream, _mr, &layout);
+    _is_first_chunk = false;
+
+    // The following chunks have no header, and read the same columns with the same types
+    _column_names = chunk.metadata.column_names;
+    std::vector<data_type> dtypes(layout.names.size(), data_type{type_id::EMPTY});
+    for (size_type i = 0; i < chunk.tbl->num_columns(); ++i) {
+      _dtypes.push_back(chunk.tbl->get_column(i).type());
+      dtypes[layout.active_indexes[i]] = _dtypes.back();
+    }
+    _options.set_header(-1);
+    _options.set_skiprows(0);
+    _options.set_names(std::move(layout.names));
+    _options.set_use_cols_names({});
+    _options.set_use_cols_indexes(std::move(layout.active_indexes));
+    _options.set_dtypes(std::move(dtypes));
+
+    return chunk;
+  }
+
+ private:
+  /**
+   * @brief Returns an empty table with the columns of the input, if they are known yet.
+   */
+  [[nodiscard]] table_with_metadata make_empty_chunk() const
+  {
+    std::vector<std::unique_ptr<column>> columns;
+    for (auto const& type : _dtypes) {
+      columns.emplace_back(make_empty_column(type));
+    }
+    table_metadata metadata;
+    metadata.column_names = _column_names;
+    return {std::make_unique<table>(std::move(columns)), std::move(metadata)};
+  }
+
+  std::unique_ptr<text::data_chunk_reader> _reader;
+  csv_reader_options _options;
+  parse_options _parse_opts;
+  std::size_t _chunk_size;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  rmm::device_uvector<char> _carry;  // incomplete row at the end of the previous chunk
+  bool _source_exhausted = false;
+  bool _is_first_chunk   = true;
+
+  // The columns of the input, determined by the first chunk
+  std::vector<std::string> _column_names;
+  std::vector<data_type> _dtypes;
+};
+
+chunked_reader::chunked_reader(text::data_chunk_source const& source,
+                               csv_reader_options const& options,
+                               std::size_t chunk_size,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _impl{std::make_unique<impl>(source, options, chunk_size, stream, mr)}
+{
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -24,6 +24,8 @@
 #include "csv_common.hpp"
 #include "csv_gpu.hpp"
 
+#include <io/utilities/chunk_writer.hpp>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
@@ -273,6 +275,7 @@ struct column_to_strings_fn {
   rmm::cuda_stream_view stream_;
   rmm::mr::device_memory_resource* mr_;
 };
+
 }  // unnamed namespace
 
 // write the header: column names:
@@ -344,59 +347,6 @@ void write_chunked_begin(data_sink* out_sink,
   }
 }
 
-void write_chunked(data_sink* out_sink,
-                   strings_column_view const& str_column_view,
-                   table_metadata const* metadata,
-                   csv_writer_options const& options,
-                   rmm::cuda_stream_view stream,
-                   rmm::mr::device_memory_resource* mr)
-{
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options.get_line_terminator()};
-  auto p_str_col_w_nl =
-    cudf::strings::detail::join_strings(str_column_view, newline, string_scalar("", false), stream);
-  strings_column_view strings_column{p_str_col_w_nl->view()};
-
-  auto total_num_bytes      = strings_column.chars_size();
-  char const* ptr_all_bytes = strings_column.chars_begin();
-
-  if (out_sink->is_device_write_preferred(total_num_bytes)) {
-    // Direct write from device memory
-    out_sink->device_write(ptr_all_bytes, total_num_bytes, stream);
-  } else {
-    // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                                  ptr_all_bytes,
-                                  total_num_bytes * sizeof(char),
-                                  cudaMemcpyDeviceToHost,
-                                  stream.value()));
-    stream.synchronize();
-
-    out_sink->host_write(h_bytes.data(), total_num_bytes);
-  }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink->is_device_write_preferred(newline.size())) {
-    out_sink->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink->host_write(options.get_line_terminator().data(),
-                         options.get_line_terminator().size());
-  }
-}
-
 void write_csv(data_sink* out_sink,
                table_view const& table,
                table_metadata const* metadata,
@@ -442,6 +392,7 @@ void write_csv(data_sink* out_sink,
     // convert each chunk to CSV:
     //
     column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+    chunk_writer writer{out_sink, options.get_line_terminator(), stream};
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
@@ -476,8 +427,9 @@ void write_csv(data_sink* out_sink,
         return cudf::strings::detail::replace_nulls(str_table_view.column(0), narep, stream);
       }();
 
-      write_chunked(out_sink, str_concat_col->view(), metadata, options, stream, mr);
+      writer.write(str_concat_col->view());
     }
+    writer.finish();
   }
 }
 
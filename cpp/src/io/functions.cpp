@@ -29,6 +29,7 @@
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -159,6 +160,45 @@ table_with_metadata read_avro(avro_reader_options const& options,
   return avro::read_avro(std::move(datasources[0]), options, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_avro_reader::chunked_avro_reader
+ */
+chunked_avro_reader::chunked_avro_reader(std::size_t read_memory_limit,
+                                         avro_reader_options const& options,
+                                         rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail::avro::chunked_reader>(read_memory_limit,
+                                                          make_datasources(options.get_source()),
+                                                          options,
+                                                          cudf::default_stream_value,
+                                                          mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::~chunked_avro_reader
+ */
+chunked_avro_reader::~chunked_avro_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::has_next
+ */
+bool chunked_avro_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::read_chunk
+ */
+table_with_metadata chunked_avro_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 compression_type infer_compression_type(compression_type compression, source_info const& info)
 {
   if (compression != compression_type::AUTO) { return compression; }
@@ -201,6 +241,43 @@ table_with_metadata read_json(json_reader_options options, rmm::mr::device_memor
   return detail::json::read_json(datasources, options, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc cudf::io::json_lines_stream_reader::json_lines_stream_reader
+ */
+json_lines_stream_reader::json_lines_stream_reader(text::data_chunk_source const& source,
+                                                   json_reader_options const& options,
+                                                   std::size_t chunk_size,
+                                                   rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail::json::stream_reader>(
+      source, options, chunk_size, cudf::default_stream_value, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::json_lines_stream_reader::~json_lines_stream_reader
+ */
+json_lines_stream_reader::~json_lines_stream_reader() = default;
+
+/**
+ * @copydoc cudf::io::json_lines_stream_reader::has_next
+ */
+bool json_lines_stream_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::json_lines_stream_reader::read_chunk
+ */
+table_with_metadata json_lines_stream_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
@@ -220,6 +297,43 @@ table_with_metadata read_csv(csv_reader_options options, rmm::mr::device_memory_
     mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(text::data_chunk_source const& source,
+                                       csv_reader_options const& options,
+                                       std::size_t chunk_size,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail::csv::chunked_reader>(
+      source, options, chunk_size, cudf::default_stream_value, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resource* mr)
 {
@@ -237,6 +351,31 @@ void write_csv(csv_writer_options const& options, rmm::mr::device_memory_resourc
     mr);
 }
 
+// Returns builder for json_writer_options
+json_writer_options_builder json_writer_options::builder(sink_info const& sink,
+                                                         table_view const& table)
+{
+  return json_writer_options_builder{sink, table};
+}
+
+// Freeform API wraps the detail writer class API
+void write_json(json_writer_options const& options, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  using namespace cudf::io::detail;
+
+  auto sinks = make_datasinks(options.get_sink());
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for JSON writing");
+
+  return json::write_json(  //
+    sinks[0].get(),
+    options.get_table(),
+    options.get_metadata(),
+    options,
+    cudf::default_stream_value,
+    mr);
+}
+
 namespace detail_orc = cudf::io::detail::orc;
 
 raw_orc_statistics read_raw_orc_statistics(source_info const& src_info)
@@ -337,6 +476,51 @@ parsed_orc_statistics read_parsed_orc_statistics(source_info const& src_info)
   return result;
 }
 
+orc_metadata read_orc_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto stream      = cudf::default_stream_value;
+  auto datasources = make_datasources(src_info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  auto const source = datasources[0].get();
+
+  orc::metadata metadata(source, stream);
+
+  orc_metadata result;
+  for (auto i = 0; i < metadata.get_num_columns(); i++) {
+    result.column_names.push_back(metadata.column_name(i));
+  }
+  result.num_rows = metadata.get_total_rows();
+
+  for (auto const& stripe : metadata.ff.stripes) {
+    // The sizes of the column streams are only found in the footer of the stripe
+    auto const footer_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+    CUDF_EXPECTS(footer_offset + stripe.footerLength <= source->size(),
+                 "Invalid stripe information");
+    auto const buffer = source->host_read(footer_offset, stripe.footerLength);
+    auto const footer_data =
+      metadata.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+    orc::StripeFooter footer;
+    orc::ProtobufReader(footer_data.data(), footer_data.size()).read(footer);
+
+    std::vector<uint64_t> column_lengths(metadata.get_num_columns(), 0);
+    for (auto const& stream_info : footer.streams) {
+      if (stream_info.column_id.value_or(column_lengths.size()) < column_lengths.size()) {
+        column_lengths[*stream_info.column_id] += stream_info.length;
+      }
+    }
+    result.stripes.push_back({stripe.offset,
+                              stripe.numberOfRows,
+                              stripe.indexLength,
+                              stripe.dataLength,
+                              stripe.footerLength,
+                              std::move(column_lengths)});
+  }
+
+  return result;
+}
+
 /**
  * @copydoc cudf::io::read_orc
  */
@@ -351,6 +535,45 @@ table_with_metadata read_orc(orc_reader_options const& options, rmm::mr::device_
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_orc_reader::chunked_orc_reader
+ */
+chunked_orc_reader::chunked_orc_reader(std::size_t read_memory_limit,
+                                       orc_reader_options const& options,
+                                       rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_orc::chunked_reader>(read_memory_limit,
+                                                        make_datasources(options.get_source()),
+                                                        options,
+                                                        cudf::default_stream_value,
+                                                        mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::~chunked_orc_reader
+ */
+chunked_orc_reader::~chunked_orc_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::has_next
+ */
+bool chunked_orc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_orc_reader::read_chunk
+ */
+table_with_metadata chunked_orc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
 /**
  * @copydoc cudf::io::write_orc
  */
@@ -421,6 +644,57 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read(options);
 }
 
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::chunked_parquet_reader
+ */
+chunked_parquet_reader::chunked_parquet_reader(std::size_t chunk_read_limit,
+                                               parquet_reader_options const& options,
+                                               rmm::mr::device_memory_resource* mr)
+  : reader{std::make_unique<detail_parquet::chunked_reader>(chunk_read_limit,
+                                                            make_datasources(options.get_source()),
+                                                            options,
+                                                            cudf::default_stream_value,
+                                                            mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::~chunked_parquet_reader
+ */
+chunked_parquet_reader::~chunked_parquet_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::has_next
+ */
+bool chunked_parquet_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+ */
+table_with_metadata chunked_parquet_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_metadata
+ */
+parquet_metadata read_parquet_metadata(source_info const& src_info)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(src_info);
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  return detail_parquet::read_metadata(datasources[0].get());
+}
+
 /**
  * @copydoc cudf::io::merge_row_group_metadata
  */
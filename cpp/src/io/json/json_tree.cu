@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nested_json.hpp"
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+namespace cudf::io::json {
+namespace detail {
+namespace {
+
+/// Whether the token opens a node of the tree
+__device__ bool is_node_token(PdaTokenT token)
+{
+  switch (token) {
+    case token_t::StructBegin:
+    case token_t::ListBegin:
+    case token_t::FieldNameBegin:
+    case token_t::StringBegin:
+    case token_t::ValueBegin:
+    case token_t::ErrorBegin: return true;
+    default: return false;
+  }
+}
+
+/// Class of the node opened by the token
+__device__ NodeT token_to_node(PdaTokenT token)
+{
+  switch (token) {
+    case token_t::StructBegin: return NC_STRUCT;
+    case token_t::ListBegin: return NC_LIST;
+    case token_t::FieldNameBegin: return NC_FN;
+    case token_t::StringBegin: return NC_STR;
+    case token_t::ValueBegin: return NC_VAL;
+    default: return NC_ERR;
+  }
+}
+
+/// Token preceding the `i`-th token, or `NUM_TOKENS` for the first token
+__device__ PdaTokenT previous_token(device_span<PdaTokenT const> tokens, size_type i)
+{
+  return i > 0 ? tokens[i - 1] : static_cast<PdaTokenT>(token_t::NUM_TOKENS);
+}
+
+/// Whether the token opens a struct or a list
+__device__ bool is_container_begin(PdaTokenT token)
+{
+  return token == token_t::StructBegin or token == token_t::ListBegin;
+}
+
+/// Whether the node class can have children
+__device__ bool is_parent_node(NodeT category)
+{
+  return category == NC_STRUCT or category == NC_LIST or category == NC_FN;
+}
+
+/**
+ * @brief Level change that takes effect before the token, i.e., that determines its own level.
+ *
+ * The tokenizer does not emit a token at the end of a struct member, so the field name whose value
+ * just ended is closed by the next field name or by the end of the struct, unless that token
+ * directly follows the beginning of the struct.
+ */
+__device__ size_type pre_level_delta(PdaTokenT token, PdaTokenT prev)
+{
+  switch (token) {
+    case token_t::FieldNameBegin: return prev == token_t::StructBegin ? 0 : -1;
+    case token_t::StructEnd: return prev == token_t::StructBegin ? -1 : -2;
+    case token_t::ListEnd: return -1;
+    default: return 0;
+  }
+}
+
+/// Level change that takes effect after the token, i.e., that determines the level of its children
+__device__ size_type post_level_delta(PdaTokenT token)
+{
+  switch (token) {
+    case token_t::StructBegin:
+    case token_t::ListBegin:
+    case token_t::FieldNameBegin: return 1;
+    default: return 0;
+  }
+}
+
+/**
+ * @brief Orders the nodes of one level by the column they belong to.
+ *
+ * Column ids of the parent level must already be assigned.
+ */
+struct column_key_compare {
+  device_span<SymbolT const> input;
+  NodeT const* categories;
+  NodeIndexT const* parents;
+  NodeIndexT const* col_ids;
+  SymbolOffsetT const* range_begin;
+  SymbolOffsetT const* range_end;
+
+  __device__ int compare(NodeIndexT lhs, NodeIndexT rhs) const
+  {
+    auto const parent_column = [&](NodeIndexT node) {
+      return parents[node] < 0 ? NodeIndexT{-1} : col_ids[parents[node]];
+    };
+    auto const lhs_parent = parent_column(lhs);
+    auto const rhs_parent = parent_column(rhs);
+    if (lhs_parent != rhs_parent) { return lhs_parent < rhs_parent ? -1 : 1; }
+
+    // String and other values at the same path are resolved by type inference
+    auto const kind = [&](NodeIndexT node) {
+      return categories[node] == NC_STR ? NC_VAL : categories[node];
+    };
+    auto const lhs_kind = kind(lhs);
+    auto const rhs_kind = kind(rhs);
+    if (lhs_kind != rhs_kind) { return lhs_kind < rhs_kind ? -1 : 1; }
+    if (lhs_kind != NC_FN) { return 0; }
+
+    auto const name = [&](NodeIndexT node) {
+      return string_view{input.data() + range_begin[node],
+                         static_cast<size_type>(range_end[node] - range_begin[node])};
+    };
+    return name(lhs).compare(name(rhs));
+  }
+};
+
+}  // namespace
+
+tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
+                                    device_span<SymbolOffsetT const> token_indices,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto const num_tokens = static_cast<size_type>(tokens.size());
+  auto const policy     = rmm::exec_policy(stream);
+
+  // The level of every token is the exclusive sum of the level changes of the preceding tokens,
+  // plus its own pre-token level change
+  rmm::device_uvector<size_type> token_levels(num_tokens, stream);
+  auto const level_deltas = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [=] __device__(size_type i) {
+      return pre_level_delta(tokens[i], previous_token(tokens, i)) + post_level_delta(tokens[i]);
+    });
+  thrust::exclusive_scan(policy, level_deltas, level_deltas + num_tokens, token_levels.begin());
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_tokens),
+                    token_levels.begin(),
+                    token_levels.begin(),
+                    [=] __device__(size_type i, size_type level) {
+                      return level + pre_level_delta(tokens[i], previous_token(tokens, i));
+                    });
+
+  // Index of the node opened by every token
+  auto const is_node = [tokens] __device__(size_type i) { return is_node_token(tokens[i]); };
+  rmm::device_uvector<NodeIndexT> token_node_ids(num_tokens, stream);
+  thrust::transform_exclusive_scan(policy,
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(num_tokens),
+                                   token_node_ids.begin(),
+                                   is_node,
+                                   NodeIndexT{0},
+                                   thrust::plus<NodeIndexT>{});
+
+  auto const num_nodes = static_cast<size_type>(
+    thrust::count_if(policy, tokens.begin(), tokens.end(), [] __device__(PdaTokenT token) {
+      return is_node_token(token);
+    }));
+  rmm::device_uvector<size_type> node_token_ids(num_nodes, stream);
+  thrust::copy_if(policy,
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_tokens),
+                  node_token_ids.begin(),
+                  is_node);
+
+  tree_meta_t tree{rmm::device_uvector<NodeT>(num_nodes, stream, mr),
+                   rmm::device_uvector<NodeIndexT>(num_nodes, stream, mr),
+                   rmm::device_uvector<TreeDepthT>(num_nodes, stream, mr),
+                   rmm::device_uvector<SymbolOffsetT>(num_nodes, stream, mr),
+                   rmm::device_uvector<SymbolOffsetT>(num_nodes, stream, mr)};
+
+  // Node class, level and character range; strings, field names and other values end at the next
+  // token, while the end of structs and lists is found below
+  auto const d_token_levels = token_levels.data();
+  thrust::transform(
+    policy,
+    node_token_ids.begin(),
+    node_token_ids.end(),
+    thrust::make_zip_iterator(thrust::make_tuple(tree.node_categories.begin(),
+                                                 tree.node_levels.begin(),
+                                                 tree.node_range_begin.begin(),
+                                                 tree.node_range_end.begin())),
+    [=] __device__(size_type i) {
+      auto const token    = tokens[i];
+      auto const offset   = token_indices[i];
+      auto const is_quote = token == token_t::StringBegin or token == token_t::FieldNameBegin;
+      auto const has_end  = is_quote or token == token_t::ValueBegin;
+      auto const end      = has_end and i + 1 < num_tokens ? token_indices[i + 1] : offset + 1;
+      return thrust::make_tuple(token_to_node(token),
+                                static_cast<TreeDepthT>(d_token_levels[i]),
+                                is_quote ? offset + 1 : offset,
+                                end);
+    });
+
+  // Containers do not nest within a level, so once the begin and end tokens of structs and lists
+  // are stably sorted by level, every begin token is directly followed by its matching end token
+  auto const is_container_token = [=] __device__(size_type i) {
+    return is_container_begin(tokens[i]) or tokens[i] == token_t::StructEnd or
+           tokens[i] == token_t::ListEnd;
+  };
+  auto const num_container_tokens = static_cast<size_type>(
+    thrust::count_if(policy,
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(num_tokens),
+                     is_container_token));
+  rmm::device_uvector<size_type> container_token_ids(num_container_tokens, stream);
+  thrust::copy_if(policy,
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_tokens),
+                  container_token_ids.begin(),
+                  is_container_token);
+  rmm::device_uvector<size_type> container_levels(num_container_tokens, stream);
+  thrust::gather(policy,
+                 container_token_ids.begin(),
+                 container_token_ids.end(),
+                 token_levels.begin(),
+                 container_levels.begin());
+  thrust::stable_sort_by_key(
+    policy, container_levels.begin(), container_levels.end(), container_token_ids.begin());
+  thrust::for_each_n(
+    policy,
+    thrust::make_counting_iterator<size_type>(1),
+    num_container_tokens > 0 ? num_container_tokens - 1 : 0,
+    [=,
+     d_container_token_ids = container_token_ids.data(),
+     d_token_node_ids      = token_node_ids.data(),
+     d_range_end           = tree.node_range_end.data()] __device__(size_type i) {
+      auto const begin_token = d_container_token_ids[i - 1];
+      auto const end_token   = d_container_token_ids[i];
+      if (is_container_begin(tokens[begin_token]) and not is_container_begin(tokens[end_token])) {
+        d_range_end[d_token_node_ids[begin_token]] = token_indices[end_token] + 1;
+      }
+    });
+
+  // A node directly following its parent is the first child; any other node has the same parent
+  // as the preceding node at the same level
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<NodeIndexT>(0),
+                    thrust::make_counting_iterator<NodeIndexT>(num_nodes),
+                    tree.parent_node_ids.begin(),
+                    [d_categories = tree.node_categories.data(),
+                     d_levels     = tree.node_levels.data()] __device__(NodeIndexT node) {
+                      auto const previous = node - 1;
+                      return node > 0 and is_parent_node(d_categories[previous]) and
+                                 d_levels[previous] == d_levels[node] - 1
+                               ? previous
+                               : NodeIndexT{-1};
+                    });
+
+  rmm::device_uvector<TreeDepthT> sorted_levels(num_nodes, stream);
+  rmm::device_uvector<NodeIndexT> nodes_by_level(num_nodes, stream);
+  thrust::copy(policy, tree.node_levels.begin(), tree.node_levels.end(), sorted_levels.begin());
+  thrust::sequence(policy, nodes_by_level.begin(), nodes_by_level.end());
+  thrust::stable_sort_by_key(
+    policy, sorted_levels.begin(), sorted_levels.end(), nodes_by_level.begin());
+
+  // Node ids increase in input order, so a running maximum propagates the last first-child parent
+  rmm::device_uvector<NodeIndexT> sorted_parents(num_nodes, stream);
+  thrust::gather(policy,
+                 nodes_by_level.begin(),
+                 nodes_by_level.end(),
+                 tree.parent_node_ids.begin(),
+                 sorted_parents.begin());
+  thrust::inclusive_scan_by_key(policy,
+                                sorted_levels.begin(),
+                                sorted_levels.end(),
+                                sorted_parents.begin(),
+                                sorted_parents.begin(),
+                                thrust::equal_to<TreeDepthT>{},
+                                thrust::maximum<NodeIndexT>{});
+  thrust::scatter(policy,
+                  sorted_parents.begin(),
+                  sorted_parents.end(),
+                  nodes_by_level.begin(),
+                  tree.parent_node_ids.begin());
+
+  return tree;
+}
+
+rmm::device_uvector<NodeIndexT> get_column_ids(device_span<SymbolT const> d_input,
+                                               tree_meta_t const& tree,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
+{
+  auto const num_nodes = static_cast<size_type>(tree.node_categories.size());
+  auto const policy    = rmm::exec_policy(stream);
+
+  rmm::device_uvector<NodeIndexT> col_ids(num_nodes, stream, mr);
+  if (num_nodes == 0) { return col_ids; }
+
+  // Group the nodes by level, so each level can be keyed by the columns of its parents
+  rmm::device_uvector<TreeDepthT> sorted_levels(num_nodes, stream);
+  rmm::device_uvector<NodeIndexT> nodes_by_level(num_nodes, stream);
+  thrust::copy(policy, tree.node_levels.begin(), tree.node_levels.end(), sorted_levels.begin());
+  thrust::sequence(policy, nodes_by_level.begin(), nodes_by_level.end());
+  thrust::stable_sort_by_key(
+    policy, sorted_levels.begin(), sorted_levels.end(), nodes_by_level.begin());
+
+  // Only the boundaries of the levels are copied to the host
+  auto const num_levels = static_cast<size_type>(sorted_levels.back_element(stream)) + 1;
+  rmm::device_uvector<size_type> d_level_ends(num_levels, stream);
+  thrust::upper_bound(policy,
+                      sorted_levels.begin(),
+                      sorted_levels.end(),
+                      thrust::make_counting_iterator<TreeDepthT>(0),
+                      thrust::make_counting_iterator<TreeDepthT>(num_levels),
+                      d_level_ends.begin());
+  auto const level_ends = cudf::detail::make_std_vector_sync(d_level_ends, stream);
+
+  column_key_compare const key{d_input,
+                               tree.node_categories.data(),
+                               tree.parent_node_ids.data(),
+                               col_ids.data(),
+                               tree.node_range_begin.data(),
+                               tree.node_range_end.data()};
+
+  NodeIndexT num_columns = 0;
+  size_type level_begin  = 0;
+  rmm::device_uvector<NodeIndexT> level_col_ids(num_nodes, stream);
+  for (auto const level_end : level_ends) {
+    auto const num_level_nodes = level_end - level_begin;
+    auto const level_nodes     = nodes_by_level.begin() + level_begin;
+    if (num_level_nodes == 0) { continue; }
+    thrust::sort(policy,
+                 level_nodes,
+                 level_nodes + num_level_nodes,
+                 [key] __device__(NodeIndexT lhs, NodeIndexT rhs) {
+                   return key.compare(lhs, rhs) < 0;
+                 });
+
+    // Number the distinct keys of the level, following the columns of the previous levels
+    thrust::transform(
+      policy,
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_level_nodes),
+      level_col_ids.begin(),
+      [key, level_nodes = nodes_by_level.data() + level_begin] __device__(size_type i) {
+        return i > 0 and key.compare(level_nodes[i - 1], level_nodes[i]) != 0 ? 1 : 0;
+      });
+    thrust::inclusive_scan(policy,
+                           level_col_ids.begin(),
+                           level_col_ids.begin() + num_level_nodes,
+                           level_col_ids.begin());
+    auto const global_col_ids = thrust::make_transform_iterator(
+      level_col_ids.begin(), [num_columns] __device__(NodeIndexT id) { return num_columns + id; });
+    thrust::scatter(policy,
+                    global_col_ids,
+                    global_col_ids + num_level_nodes,
+                    level_nodes,
+                    col_ids.begin());
+
+    num_columns += level_col_ids.element(num_level_nodes - 1, stream) + 1;
+    level_begin = level_end;
+  }
+
+  return col_ids;
+}
+
+}  // namespace detail
+}  // namespace cudf::io::json
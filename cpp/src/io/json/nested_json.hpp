@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 namespace cudf::io::json {
 
@@ -76,6 +79,50 @@ enum token_t : PdaTokenT {
   NUM_TOKENS
 };
 
+/// Type used to represent the class of a node (or a node "category") within the tree representation
+using NodeT = char;
+
+/// Type used to index into the nodes within the tree of structs, lists, field names, and values
+using NodeIndexT = size_type;
+
+/// Type large enough to represent tree depth from [0, max-tree-depth); may be an unsigned type
+using TreeDepthT = StackLevelT;
+
+/**
+ * @brief Classes of the nodes of the tree representation of a JSON input
+ */
+enum node_t : NodeT {
+  /// A node representing a struct
+  NC_STRUCT,
+  /// A node representing a list
+  NC_LIST,
+  /// A node representing a field name
+  NC_FN,
+  /// A node representing a string value
+  NC_STR,
+  /// A node representing a numeric or literal value (e.g., true, false, null)
+  NC_VAL,
+  /// A node representing a parser error
+  NC_ERR,
+  /// Total number of node classes
+  NUM_NODE_CLASSES
+};
+
+/**
+ * @brief A tree representation of a JSON input, with one entry per node in input order
+ *
+ * A field name is the child of its struct and the parent of its value, and a list element is the
+ * child of its list. The character range of a string or field name excludes the quotes, and the
+ * range of a struct or list includes its brackets.
+ */
+struct tree_meta_t {
+  rmm::device_uvector<NodeT> node_categories;           ///< Class of every node
+  rmm::device_uvector<NodeIndexT> parent_node_ids;      ///< Parent of every node, `-1` for roots
+  rmm::device_uvector<TreeDepthT> node_levels;          ///< Nesting level of every node
+  rmm::device_uvector<SymbolOffsetT> node_range_begin;  ///< First character of every node
+  rmm::device_uvector<SymbolOffsetT> node_range_end;    ///< One past the last character
+};
+
 namespace detail {
 /**
  * @brief Identifies the stack context for each character from a JSON input. Specifically, we
@@ -110,6 +157,44 @@ void get_token_stream(device_span<SymbolT const> d_json_in,
                       SymbolOffsetT* d_tokens_indices,
                       SymbolOffsetT* d_num_written_tokens,
                       rmm::cuda_stream_view stream);
+
+/**
+ * @brief Builds the tree representation of a JSON input from its token stream.
+ *
+ * All the work, including the matching of every node with its parent, is done on the device. The
+ * token stream must be free of parser errors.
+ *
+ * @param[in] tokens The tokens of the JSON input, as emitted by `get_token_stream`
+ * @param[in] token_indices The offset within the JSON input of every token
+ * @param[in] stream The CUDA stream to which kernels are dispatched
+ * @param[in] mr Device memory resource used to allocate the returned tree's device memory
+ * @return The tree representation of the input
+ */
+tree_meta_t get_tree_representation(
+  device_span<PdaTokenT const> tokens,
+  device_span<SymbolOffsetT const> token_indices,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Assigns every node of the tree to the column it belongs to.
+ *
+ * Nodes share a column when their paths from the root match: at every level, the same field name
+ * for field names, or the same node class for structs and lists. String values and other values
+ * at the same path share a column, whose type is resolved by type inference later on. Column ids
+ * are numbered from 0 and are ordered by nesting level.
+ *
+ * @param[in] d_input The JSON input
+ * @param[in] tree The tree representation of \p d_input
+ * @param[in] stream The CUDA stream to which kernels are dispatched
+ * @param[in] mr Device memory resource used to allocate the returned column ids
+ * @return The column id of every node
+ */
+rmm::device_uvector<NodeIndexT> get_column_ids(
+  device_span<SymbolT const> d_input,
+  tree_meta_t const& tree,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 }  // namespace detail
 
 }  // namespace cudf::io::json
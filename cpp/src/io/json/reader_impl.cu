@@ -26,6 +26,7 @@
 #include <io/utilities/type_conversion.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
 #include <cudf/groupby.hpp>
@@ -370,7 +371,7 @@ std::pair<std::vector<std::string>, col_map_ptr_type> get_column_names_and_map(
                                 first_row_len * sizeof(char),
                                 cudaMemcpyDeviceToHost,
                                 stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   // Determine the row format between:
   //   JSON array - [val1, val2, ...] and
@@ -515,7 +516,7 @@ table_with_metadata convert_data_to_table(parse_options_view const& parse_opts,
   cudf::io::json::gpu::convert_json_to_columns(
     parse_opts, data, rec_starts, d_dtypes, column_map, d_data, d_valid, d_valid_counts, stream);
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   // postprocess columns
   auto target_chars   = std::vector<char>{'\\', '"', '\\', '\\', '\\', 't', '\\', 'r', '\\', 'b'};
@@ -559,7 +560,7 @@ table_with_metadata convert_data_to_table(parse_options_view const& parse_opts,
 
   // This is to ensure the stream-ordered make_stream_column calls above complete before
   // the temporary std::vectors are destroyed on exit from this function.
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   CUDF_EXPECTS(!out_columns.empty(), "No columns created from json input");
 
@@ -567,6 +568,51 @@ table_with_metadata convert_data_to_table(parse_options_view const& parse_opts,
                              {column_names, column_infos}};
 }
 
+/**
+ * @brief Creates the parsing options shared by all the JSON Lines inputs.
+ */
+parse_options make_parse_options(json_reader_options const& reader_opts,
+                                 rmm::cuda_stream_view stream)
+{
+  auto parse_opts = parse_options{',', '\n', '\"', '.'};
+
+  parse_opts.trie_true  = cudf::detail::create_serialized_trie({"true"}, stream);
+  parse_opts.trie_false = cudf::detail::create_serialized_trie({"false"}, stream);
+  parse_opts.trie_na    = cudf::detail::create_serialized_trie({"", "null"}, stream);
+
+  parse_opts.dayfirst = reader_opts.is_enabled_dayfirst();
+
+  return parse_opts;
+}
+
+/**
+ * @brief Converts the records starting at `rec_starts` into a table.
+ */
+table_with_metadata convert_records(json_reader_options const& reader_opts,
+                                    parse_options const& parse_opts,
+                                    host_span<char const> h_data,
+                                    device_span<uint64_t const> rec_starts,
+                                    device_span<char const> d_data,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  auto column_names_and_map =
+    get_column_names_and_map(parse_opts.view(), h_data, rec_starts, d_data, stream);
+
+  auto column_names = std::get<0>(column_names_and_map);
+  auto column_map   = std::move(std::get<1>(column_names_and_map));
+
+  CUDF_EXPECTS(not column_names.empty(), "Error determining column names.\n");
+
+  auto dtypes = get_data_types(
+    reader_opts, parse_opts.view(), column_names, column_map.get(), rec_starts, d_data, stream);
+
+  CUDF_EXPECTS(not dtypes.empty(), "Error in data type detection.\n");
+
+  return convert_data_to_table(
+    parse_opts.view(), dtypes, column_names, column_map.get(), rec_starts, d_data, stream, mr);
+}
+
 /**
  * @brief Read an entire set or a subset of data from the source
  *
@@ -589,13 +635,7 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
 
   CUDF_EXPECTS(reader_opts.is_enabled_lines(), "Only JSON Lines format is currently supported.\n");
 
-  auto parse_opts = parse_options{',', '\n', '\"', '.'};
-
-  parse_opts.trie_true  = cudf::detail::create_serialized_trie({"true"}, stream);
-  parse_opts.trie_false = cudf::detail::create_serialized_trie({"false"}, stream);
-  parse_opts.trie_na    = cudf::detail::create_serialized_trie({"", "null"}, stream);
-
-  parse_opts.dayfirst = reader_opts.is_enabled_dayfirst();
+  auto const parse_opts = make_parse_options(reader_opts, stream);
 
   auto range_offset      = reader_opts.get_byte_range_offset();
   auto range_size        = reader_opts.get_byte_range_size();
@@ -623,21 +663,30 @@ table_with_metadata read_json(std::vector<std::unique_ptr<datasource>>& sources,
 
   CUDF_EXPECTS(d_data.size() != 0, "Error uploading input data to the GPU.\n");
 
-  auto column_names_and_map =
-    get_column_names_and_map(parse_opts.view(), h_data, rec_starts, d_data, stream);
+  return convert_records(reader_opts, parse_opts, h_data, rec_starts, d_data, stream, mr);
+}
 
-  auto column_names = std::get<0>(column_names_and_map);
-  auto column_map   = std::move(std::get<1>(column_names_and_map));
+table_with_metadata read_json_lines(json_reader_options const& reader_opts,
+                                    host_span<char const> h_data,
+                                    device_span<char const> d_data,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(h_data.size() != 0 and h_data.size() == d_data.size(),
+               "Host and device records must be the same non-empty data.\n");
 
-  CUDF_EXPECTS(not column_names.empty(), "Error determining column names.\n");
+  auto const parse_opts = make_parse_options(reader_opts, stream);
 
-  auto dtypes = get_data_types(
-    reader_opts, parse_opts.view(), column_names, column_map.get(), rec_starts, d_data, stream);
+  // Record starts are always located on the device copy, as if the whole source was loaded
+  auto whole_source_opts = reader_opts;
+  whole_source_opts.set_byte_range_offset(0);
+  whole_source_opts.set_byte_range_size(0);
 
-  CUDF_EXPECTS(not dtypes.empty(), "Error in data type detection.\n");
+  auto const rec_starts = find_record_starts(whole_source_opts, h_data, d_data, stream);
 
-  return convert_data_to_table(
-    parse_opts.view(), dtypes, column_names, column_map.get(), rec_starts, d_data, stream, mr);
+  CUDF_EXPECTS(rec_starts.size() > 0, "Error enumerating records.\n");
+
+  return convert_records(reader_opts, parse_opts, h_data, rec_starts, d_data, stream, mr);
 }
 
 }  // namespace json
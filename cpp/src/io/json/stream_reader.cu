@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/io/text/data_chunk_source.hpp>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/distance.h>
+#include <thrust/find.h>
+#include <thrust/iterator/reverse_iterator.h>
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+/**
+ * @brief Implementation of the streaming JSON Lines reader.
+ *
+ * JSON Lines records are terminated by newlines, which cannot appear unescaped within a record, so
+ * the only parsing state that crosses a chunk boundary is the incomplete record at the end of the
+ * chunk. That tail is kept on the device and prepended to the next chunk read from the source.
+ */
+class stream_reader::impl {
+ public:
+  impl(text::data_chunk_source const& source,
+       json_reader_options const& options,
+       std::size_t chunk_size,
+       rmm::cuda_stream_view stream,
+       rmm::mr::device_memory_resource* mr)
+    : _reader{source.create_reader()},
+      _options{options},
+      _chunk_size{chunk_size},
+      _stream{stream},
+      _mr{mr},
+      _carry{0, stream}
+  {
+    CUDF_EXPECTS(_chunk_size > 0, "Chunk size must be positive.");
+    CUDF_EXPECTS(_options.is_enabled_lines(), "Only JSON Lines format is currently supported.");
+    CUDF_EXPECTS(not _options.is_enabled_experimental(),
+                 "The experimental JSON reader does not support streaming.");
+    CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+                 "Byte ranges are not supported when streaming JSON Lines.");
+    CUDF_EXPECTS(_options.get_compression() == compression_type::NONE or
+                   _options.get_compression() == compression_type::AUTO,
+                 "Compressed input is not supported when streaming JSON Lines.");
+  }
+
+  [[nodiscard]] bool has_next() const { return not _source_exhausted or not _carry.is_empty(); }
+
+  table_with_metadata read_chunk()
+  {
+    auto buffer             = std::move(_carry);
+    std::size_t records_end  = 0;
+    while (records_end == 0 and not _source_exhausted) {
+      auto const chunk = _reader->get_next_chunk(_chunk_size, _stream);
+      // The readers only return fewer bytes than requested once they reach the end of the data
+      _source_exhausted = chunk->size() < _chunk_size;
+
+      auto const old_size = buffer.size();
+      buffer.resize(old_size + chunk->size(), _stream);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(buffer.data() + old_size,
+                                    chunk->data(),
+                                    chunk->size(),
+                                    cudaMemcpyDeviceToDevice,
+                                    _stream.value()));
+      records_end = find_records_end(buffer, old_size);
+    }
+    if (_source_exhausted) { records_end = buffer.size(); }
+
+    _carry = rmm::device_uvector<char>(buffer.size() - records_end, _stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(_carry.data(),
+                                  buffer.data() + records_end,
+                                  _carry.size(),
+                                  cudaMemcpyDeviceToDevice,
+                                  _stream.value()));
+
+    auto const d_records = device_span<char const>{buffer.data(), records_end};
+    auto const h_records = cudf::detail::make_std_vector_sync(d_records, _stream);
+    auto const is_blank = std::all_of(
+      h_records.cbegin(), h_records.cend(), [](unsigned char c) { return std::isspace(c); });
+    if (is_blank) { return make_empty_chunk(); }
+
+    return conform_to_schema(read_json_lines(_options, h_records, d_records, _stream, _mr));
+  }
+
+ private:
+  /**
+   * @brief Returns the offset past the last newline in `buffer`, or `0` if there is none.
+   *
+   * The first `searched_size` bytes are known not to contain a newline.
+   */
+  std::size_t find_records_end(rmm::device_uvector<char> const& buffer,
+                               std::size_t searched_size) const
+  {
+    auto const rbegin = thrust::make_reverse_iterator(buffer.end());
+    auto const rend   = thrust::make_reverse_iterator(buffer.begin() + searched_size);
+    auto const it     = thrust::find(rmm::exec_policy(_stream), rbegin, rend, '\n');
+    return it == rend ? 0 : searched_size + thrust::distance(it, rend);
+  }
+
+  /**
+   * @brief Returns an empty table with the columns of the stream, if they are known yet.
+   */
+  [[nodiscard]] table_with_metadata make_empty_chunk() const
+  {
+    std::vector<std::unique_ptr<column>> columns;
+    std::transform(_dtypes.cbegin(), _dtypes.cend(), std::back_inserter(columns), [](auto type) {
+      return make_empty_column(type);
+    });
+    return {std::make_unique<table>(std::move(columns)), make_metadata()};
+  }
+
+  [[nodiscard]] table_metadata make_metadata() const
+  {
+    table_metadata metadata;
+    metadata.column_names = _column_names;
+    std::transform(_column_names.cbegin(),
+                   _column_names.cend(),
+                   std::back_inserter(metadata.schema_info),
+                   [](auto const& name) { return column_name_info{name}; });
+    return metadata;
+  }
+
+  /**
+   * @brief Records the columns of the first chunk, and reorders the columns of later chunks to
+   * match them.
+   */
+  table_with_metadata conform_to_schema(table_with_metadata&& chunk)
+  {
+    auto const& chunk_names = chunk.metadata.column_names;
+    if (_column_names.empty()) {
+      _column_names = chunk_names;
+      for (auto const& col : chunk.tbl->view()) {
+        _dtypes.push_back(col.type());
+      }
+      // Later chunks may hold fewer columns or a different key order, so their types are pinned
+      // by name rather than inferred again or matched by position
+      std::map<std::string, data_type> dtypes;
+      if (auto const* user_dtypes = std::get_if<std::map<std::string, data_type>>(
+            &_options.get_dtypes())) {
+        dtypes = *user_dtypes;
+      }
+      for (std::size_t i = 0; i < _column_names.size(); ++i) {
+        dtypes[_column_names[i]] = _dtypes[i];
+      }
+      _options.set_dtypes(dtypes);
+      return std::move(chunk);
+    }
+
+    for (auto const& name : chunk_names) {
+      CUDF_EXPECTS(std::find(_column_names.cbegin(), _column_names.cend(), name) !=
+                     _column_names.cend(),
+                   "Columns missing from the first chunk are not supported.");
+    }
+
+    auto const num_rows = chunk.tbl->num_rows();
+    auto chunk_columns  = chunk.tbl->release();
+    std::vector<std::unique_ptr<column>> columns;
+    for (std::size_t i = 0; i < _column_names.size(); ++i) {
+      auto const it = std::find(chunk_names.cbegin(), chunk_names.cend(), _column_names[i]);
+      if (it != chunk_names.cend()) {
+        columns.emplace_back(std::move(chunk_columns[std::distance(chunk_names.cbegin(), it)]));
+      } else {
+        auto const null_value = make_default_constructed_scalar(_dtypes[i], _stream);
+        columns.emplace_back(make_column_from_scalar(*null_value, num_rows, _stream, _mr));
+      }
+    }
+    return {std::make_unique<table>(std::move(columns)), make_metadata()};
+  }
+
+  std::unique_ptr<text::data_chunk_reader> _reader;
+  json_reader_options _options;
+  std::size_t _chunk_size;
+  rmm::cuda_stream_view _stream;
+  rmm::mr::device_memory_resource* _mr;
+
+  rmm::device_uvector<char> _carry;  // incomplete record at the end of the previous chunk
+  bool _source_exhausted = false;
+
+  // The columns of the stream, determined by the first chunk that holds records
+  std::vector<std::string> _column_names;
+  std::vector<data_type> _dtypes;
+};
+
+stream_reader::stream_reader(text::data_chunk_source const& source,
+                             json_reader_options const& options,
+                             std::size_t chunk_size,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+  : _impl{std::make_unique<impl>(source, options, chunk_size, stream, mr)}
+{
+}
+
+stream_reader::~stream_reader() = default;
+
+bool stream_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata stream_reader::read_chunk() const { return _impl->read_chunk(); }
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file write_json.cu
+ * @brief cuDF-IO JSON Lines writer implementation
+ */
+
+#include <io/utilities/chunk_writer.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/converters.hpp>
+#include <cudf/strings/detail/utilities.cuh>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace json {
+
+namespace {
+
+/**
+ * @brief Appends bytes to an output string, or only counts them in the sizing pass.
+ */
+struct output_buffer {
+  char* d_buffer;
+  offset_type bytes = 0;
+
+  __device__ void write(char const* data, size_type size)
+  {
+    if (d_buffer) { d_buffer = cudf::strings::detail::copy_and_increment(d_buffer, data, size); }
+    bytes += size;
+  }
+
+  __device__ void write(char chr) { write(&chr, 1); }
+};
+
+/**
+ * @brief Functor to write each string of a column as a JSON string.
+ *
+ * Quotes, backslashes and control characters are escaped. Other characters, including non-ASCII
+ * UTF-8 sequences, are copied as they are.
+ */
+struct escape_strings_fn {
+  column_device_view const d_column;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_column.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    auto const d_str = d_column.element<string_view>(idx);
+    output_buffer out{d_chars ? d_chars + d_offsets[idx] : nullptr};
+
+    out.write('\"');
+    for (size_type i = 0; i < d_str.size_bytes(); ++i) {
+      auto const chr = static_cast<unsigned char>(d_str.data()[i]);
+      switch (chr) {
+        case '\"': out.write("\\\"", 2); break;
+        case '\\': out.write("\\\\", 2); break;
+        case '\b': out.write("\\b", 2); break;
+        case '\f': out.write("\\f", 2); break;
+        case '\n': out.write("\\n", 2); break;
+        case '\r': out.write("\\r", 2); break;
+        case '\t': out.write("\\t", 2); break;
+        default:
+          if (chr < 0x20) {
+            constexpr char hex_digits[] = "0123456789abcdef";
+            char const escaped[] = {
+              '\\', 'u', '0', '0', hex_digits[chr >> 4], hex_digits[chr & 15]};
+            out.write(escaped, sizeof(escaped));
+          } else {
+            out.write(static_cast<char>(chr));
+          }
+      }
+    }
+    out.write('\"');
+
+    if (!d_chars) d_offsets[idx] = out.bytes;
+  }
+};
+
+/**
+ * @brief Functor to write each row of a set of members as a JSON object.
+ *
+ * The members are strings columns of JSON values, where a null is a null member. Rows where
+ * `parent_mask` is unset are null.
+ */
+struct struct_rows_fn {
+  table_device_view const d_members;
+  char const* d_keys;               // `"name":` of each member, concatenated
+  size_type const* d_key_offsets;   // offset of each member in `d_keys`
+  bitmask_type const* parent_mask;  // validity of the rows, or null if all rows are valid
+  size_type parent_offset;
+  bool include_nulls;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (parent_mask != nullptr and not bit_is_set(parent_mask, parent_offset + idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    output_buffer out{d_chars ? d_chars + d_offsets[idx] : nullptr};
+    out.write('{');
+    bool first = true;
+    for (size_type i = 0; i < d_members.num_columns(); ++i) {
+      auto const& member = d_members.column(i);
+      auto const is_null = member.is_null(idx);
+      if (is_null and not include_nulls) { continue; }
+      if (not first) { out.write(','); }
+      first = false;
+      out.write(d_keys + d_key_offsets[i], d_key_offsets[i + 1] - d_key_offsets[i]);
+      if (is_null) {
+        out.write("null", 4);
+      } else {
+        auto const value = member.element<string_view>(idx);
+        out.write(value.data(), value.size_bytes());
+      }
+    }
+    out.write('}');
+
+    if (!d_chars) d_offsets[idx] = out.bytes;
+  }
+};
+
+/**
+ * @brief Functor to write each row of a lists column as a JSON array.
+ *
+ * The elements are a strings column of JSON values, where a null is written as `null`.
+ */
+struct list_rows_fn {
+  column_device_view const d_lists;
+  offset_type const* d_list_offsets;  // offsets of the rows, starting at the first row
+  column_device_view const d_elements;
+  offset_type* d_offsets{};
+  char* d_chars{};
+
+  __device__ void operator()(size_type idx)
+  {
+    if (d_lists.is_null(idx)) {
+      if (!d_chars) d_offsets[idx] = 0;
+      return;
+    }
+
+    output_buffer out{d_chars ? d_chars + d_offsets[idx] : nullptr};
+    out.write('[');
+    auto const first_element = d_list_offsets[0];
+    for (auto i = d_list_offsets[idx]; i < d_list_offsets[idx + 1]; ++i) {
+      auto const element = i - first_element;
+      if (i != d_list_offsets[idx]) { out.write(','); }
+      if (d_elements.is_null(element)) {
+        out.write("null", 4);
+      } else {
+        auto const value = d_elements.element<string_view>(element);
+        out.write(value.data(), value.size_bytes());
+      }
+    }
+    out.write(']');
+
+    if (!d_chars) d_offsets[idx] = out.bytes;
+  }
+};
+
+template <typename T>
+struct is_finite_fn {
+  column_device_view const d_column;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    return d_column.is_valid(idx) and isfinite(d_column.element<T>(idx));
+  }
+};
+
+/**
+ * @brief Returns `name` as a JSON string followed by a colon.
+ */
+std::string make_member_key(std::string const& name)
+{
+  std::string key = "\"";
+  for (unsigned char const chr : name) {
+    switch (chr) {
+      case '\"': key += "\\\""; break;
+      case '\\': key += "\\\\"; break;
+      case '\b': key += "\\b"; break;
+      case '\f': key += "\\f"; break;
+      case '\n': key += "\\n"; break;
+      case '\r': key += "\\r"; break;
+      case '\t': key += "\\t"; break;
+      default:
+        if (chr < 0x20) {
+          char escaped[7];
+          std::snprintf(escaped, sizeof(escaped), "\\u%04x", chr);
+          key += escaped;
+        } else {
+          key += static_cast<char>(chr);
+        }
+    }
+  }
+  return key + "\":";
+}
+
+/**
+ * @brief Returns the name of child `index`, or the index when it has no name.
+ */
+std::string child_name(column_name_info const* names, size_type index)
+{
+  if (names != nullptr and index < static_cast<size_type>(names->children.size()) and
+      not names->children[index].name.empty()) {
+    return names->children[index].name;
+  }
+  return std::to_string(index);
+}
+
+column_name_info const* child_names(column_name_info const* names, size_type index)
+{
+  if (names == nullptr or index >= static_cast<size_type>(names->children.size())) {
+    return nullptr;
+  }
+  return &names->children[index];
+}
+
+std::unique_ptr<column> column_to_json(column_view const& column,
+                                       column_name_info const* names,
+                                       json_writer_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Writes each row of `members` as a JSON object, with the names of `names`.
+ *
+ * @param members Members of the objects, as strings columns of JSON values
+ * @param num_rows Number of objects, which `members` does not give when it has no columns
+ * @param names Names of the members
+ * @param parent Column whose null rows are null objects, or null if all rows are valid
+ */
+std::unique_ptr<column> members_to_json(table_view const& members,
+                                        size_type num_rows,
+                                        column_name_info const* names,
+                                        column_view const* parent,
+                                        json_writer_options const& options,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  std::string keys;
+  std::vector<size_type> key_offsets{0};
+  for (size_type i = 0; i < members.num_columns(); ++i) {
+    keys += make_member_key(child_name(names, i));
+    key_offsets.push_back(static_cast<size_type>(keys.size()));
+  }
+  auto const d_keys =
+    cudf::detail::make_device_uvector_async(host_span<char const>{keys.data(), keys.size()},
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+  auto const d_key_offsets = cudf::detail::make_device_uvector_async(
+    key_offsets, stream, rmm::mr::get_current_device_resource());
+
+  auto const d_members = table_device_view::create(members, stream);
+  auto const has_parent_mask = parent != nullptr and parent->nullable();
+  struct_rows_fn fn{*d_members,
+                    d_keys.data(),
+                    d_key_offsets.data(),
+                    has_parent_mask ? parent->null_mask() : nullptr,
+                    has_parent_mask ? parent->offset() : 0,
+                    options.is_enabled_include_nulls()};
+  auto children = cudf::strings::detail::make_strings_children(fn, num_rows, stream, mr);
+
+  if (not has_parent_mask) {
+    return make_strings_column(
+      num_rows, std::move(children.first), std::move(children.second), 0, rmm::device_buffer{});
+  }
+  return make_strings_column(num_rows,
+                             std::move(children.first),
+                             std::move(children.second),
+                             parent->null_count(),
+                             cudf::detail::copy_bitmask(*parent, stream, mr));
+}
+
+/**
+ * @brief Functor to convert the values of a column of a non-nested type to JSON values.
+ *
+ * Nulls are preserved as nulls of the output.
+ */
+struct column_to_json_fn {
+  json_writer_options const& options;
+  rmm::cuda_stream_view stream;
+  rmm::mr::device_memory_resource* mr;
+
+  template <typename T>
+  std::enable_if_t<std::is_same_v<T, bool>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_booleans(column,
+                                                string_scalar{"true", true, stream},
+                                                string_scalar{"false", true, stream},
+                                                stream,
+                                                mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_same_v<T, string_view>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto d_column = column_device_view::create(column, stream);
+    escape_strings_fn fn{*d_column};
+    auto children = cudf::strings::detail::make_strings_children(fn, column.size(), stream, mr);
+
+    return make_strings_column(column.size(),
+                               std::move(children.first),
+                               std::move(children.second),
+                               column.null_count(),
+                               cudf::detail::copy_bitmask(column, stream, mr));
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_integral_v<T> and not std::is_same_v<T, bool>, std::unique_ptr<column>>
+  operator()(column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(column, stream, mr);
+  }
+
+  // JSON has no literal for NaN and infinities, so they are written as nulls
+  template <typename T>
+  std::enable_if_t<std::is_floating_point_v<T>, std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto result         = cudf::strings::detail::from_floats(column, stream, mr);
+    auto const d_column = column_device_view::create(column, stream);
+    auto [null_mask, null_count] =
+      cudf::detail::valid_if(thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(column.size()),
+                             is_finite_fn<T>{*d_column},
+                             stream,
+                             mr);
+    result->set_null_mask(std::move(null_mask), null_count);
+    return result;
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_fixed_point<T>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_fixed_point(column, stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_timestamp<T>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    auto const format = [&]() {
+      if (std::is_same_v<cudf::timestamp_s, T>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%SZ\""};
+      } else if (std::is_same_v<cudf::timestamp_ms, T>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%3fZ\""};
+      } else if (std::is_same_v<cudf::timestamp_us, T>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%6fZ\""};
+      } else if (std::is_same_v<cudf::timestamp_ns, T>) {
+        return std::string{"\"%Y-%m-%dT%H:%M:%S.%9fZ\""};
+      } else {
+        return std::string{"\"%Y-%m-%d\""};
+      }
+    }();
+    return cudf::strings::detail::from_timestamps(
+      column,
+      format,
+      strings_column_view(column_view{data_type{type_id::STRING}, 0, nullptr}),
+      stream,
+      mr);
+  }
+
+  // durations are written as the number of ticks of their resolution
+  template <typename T>
+  std::enable_if_t<cudf::is_duration<T>(), std::unique_ptr<column>> operator()(
+    column_view const& column) const
+  {
+    return cudf::strings::detail::from_integers(
+      bit_cast(column, data_type{type_to_id<typename T::rep>()}), stream, mr);
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_nested<T>() or std::is_same_v<T, dictionary32>,
+                   std::unique_ptr<column>>
+  operator()(column_view const&) const
+  {
+    CUDF_FAIL("Unsupported column type.");
+  }
+};
+
+/**
+ * @brief Converts the values of a column to a strings column of JSON values.
+ *
+ * @param column Column to convert
+ * @param names Names of the children of the column, or null
+ */
+std::unique_ptr<column> column_to_json(column_view const& column,
+                                       column_name_info const* names,
+                                       json_writer_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  switch (column.type().id()) {
+    case type_id::STRUCT: {
+      structs_column_view const structs{column};
+      std::vector<std::unique_ptr<cudf::column>> members;
+      for (size_type i = 0; i < structs.num_children(); ++i) {
+        members.push_back(column_to_json(
+          structs.get_sliced_child(i), child_names(names, i), options, stream, mr));
+      }
+      auto const members_table = table{std::move(members)};
+      return members_to_json(
+        members_table.view(), column.size(), names, &column, options, stream, mr);
+    }
+    case type_id::LIST: {
+      lists_column_view const lists{column};
+      // the names of a list are those of its offsets and its elements
+      auto const element_names =
+        (names != nullptr and not names->children.empty()) ? &names->children.back() : nullptr;
+      auto const elements =
+        column_to_json(lists.get_sliced_child(stream), element_names, options, stream, mr);
+      auto const d_lists    = column_device_view::create(column, stream);
+      auto const d_elements = column_device_view::create(elements->view(), stream);
+      list_rows_fn fn{*d_lists, lists.offsets_begin(), *d_elements};
+      auto children = cudf::strings::detail::make_strings_children(fn, column.size(), stream, mr);
+      return make_strings_column(column.size(),
+                                 std::move(children.first),
+                                 std::move(children.second),
+                                 column.null_count(),
+                                 cudf::detail::copy_bitmask(column, stream, mr));
+    }
+    default:
+      return type_dispatcher(column.type(), column_to_json_fn{options, stream, mr}, column);
+  }
+}
+
+}  // namespace
+
+void write_json(data_sink* out_sink,
+                table_view const& table,
+                table_metadata const* metadata,
+                json_writer_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  if (table.num_rows() == 0) { return; }
+
+  // the names of the columns, as the children of the row objects
+  column_name_info root;
+  if (metadata != nullptr and not metadata->schema_info.empty()) {
+    CUDF_EXPECTS(metadata->schema_info.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    root.children = metadata->schema_info;
+  } else if (metadata != nullptr) {
+    CUDF_EXPECTS(metadata->column_names.size() == static_cast<size_t>(table.num_columns()),
+                 "Mismatch between number of column names and table columns.");
+    std::copy(metadata->column_names.begin(),
+              metadata->column_names.end(),
+              std::back_inserter(root.children));
+  }
+
+  auto const n_rows_per_chunk = options.get_rows_per_chunk();
+  CUDF_EXPECTS(n_rows_per_chunk > 0, "write_json: invalid chunk_rows; must be positive");
+
+  auto const num_rows = table.num_rows();
+  std::vector<table_view> vector_views;
+  if (num_rows <= n_rows_per_chunk) {
+    vector_views.push_back(table);
+  } else {
+    std::vector<size_type> splits((num_rows - 1) / n_rows_per_chunk);
+    thrust::tabulate(splits.begin(), splits.end(), [n_rows_per_chunk](auto idx) {
+      return (idx + 1) * n_rows_per_chunk;
+    });
+    vector_views = cudf::detail::split(table, splits, stream);
+  }
+
+  // convert each chunk to JSON Lines
+  chunk_writer writer{out_sink, "\n", stream};
+  for (auto const& sub_view : vector_views) {
+    std::vector<std::unique_ptr<column>> members;
+    std::transform(sub_view.begin(),
+                   sub_view.end(),
+                   std::back_inserter(members),
+                   [&, i = 0](auto const& current_col) mutable {
+                     return column_to_json(current_col,
+                                           child_names(&root, i++),
+                                           options,
+                                           stream,
+                                           rmm::mr::get_current_device_resource());
+                   });
+    auto const members_table = cudf::table{std::move(members)};
+    auto const rows          = members_to_json(members_table.view(),
+                                      sub_view.num_rows(),
+                                      &root,
+                                      nullptr,
+                                      options,
+                                      stream,
+                                      rmm::mr::get_current_device_resource());
+    writer.write(rows->view());
+  }
+  writer.finish();
+}
+
+}  // namespace json
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
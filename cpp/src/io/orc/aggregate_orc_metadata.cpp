@@ -41,6 +41,54 @@ column_hierarchy::column_hierarchy(nesting_map child_map) : children{std::move(c
 
 namespace {
 
+/**
+ * @brief Location of a stream within its stripe.
+ */
+struct stream_location {
+  uint64_t offset;
+  uint64_t length;
+};
+
+/**
+ * @brief Finds the index stream of the given kind of a column in a stripe.
+ *
+ * @return The location of the stream; `nullopt` if the stripe has no such stream
+ */
+std::optional<stream_location> find_index_stream(StripeInformation const& stripe,
+                                                 StripeFooter const& stripe_footer,
+                                                 StreamKind kind,
+                                                 size_type column_id)
+{
+  uint64_t src_offset = 0;
+  for (auto const& strm : stripe_footer.streams) {
+    // Index streams are stored first in the stripe
+    if (src_offset >= stripe.indexLength) { break; }
+    if (strm.kind == kind && strm.column_id == static_cast<uint32_t>(column_id)) {
+      return stream_location{src_offset, strm.length};
+    }
+    src_offset += strm.length;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Reads, decompresses and parses an index stream.
+ */
+template <typename T>
+T read_index_stream(metadata const& pfm,
+                    StripeInformation const& stripe,
+                    stream_location location,
+                    rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(stripe.offset + location.offset + location.length <= pfm.source->size(),
+               "Invalid index stream");
+  auto const buffer = pfm.source->host_read(stripe.offset + location.offset, location.length);
+  auto const data   = pfm.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+  T index;
+  ProtobufReader(data.data(), data.size()).read(index);
+  return index;
+}
+
 /**
  * @brief Goes up to the root to include the column with the given id and its parents.
  */
@@ -151,6 +199,50 @@ aggregate_orc_metadata::aggregate_orc_metadata(
   }
 }
 
+StripeFooter aggregate_orc_metadata::read_stripe_footer(size_type source_idx,
+                                                       StripeInformation const& stripe,
+                                                       rmm::cuda_stream_view stream) const
+{
+  auto const& pfm           = per_file_metadata[source_idx];
+  auto const sf_comp_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  auto const sf_comp_length = stripe.footerLength;
+  CUDF_EXPECTS(sf_comp_offset + sf_comp_length < pfm.source->size(),
+               "Invalid stripe information");
+  auto const buffer  = pfm.source->host_read(sf_comp_offset, sf_comp_length);
+  auto const sf_data =
+    pfm.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+  StripeFooter stripe_footer;
+  ProtobufReader(sf_data.data(), sf_data.size()).read(stripe_footer);
+  return stripe_footer;
+}
+
+std::optional<RowIndex> aggregate_orc_metadata::read_row_index(size_type source_idx,
+                                                               StripeInformation const& stripe,
+                                                               StripeFooter const& stripe_footer,
+                                                               size_type column_id,
+                                                               rmm::cuda_stream_view stream) const
+{
+  auto const location = find_index_stream(stripe, stripe_footer, ROW_INDEX, column_id);
+  if (not location.has_value()) { return std::nullopt; }
+  return read_index_stream<RowIndex>(per_file_metadata[source_idx], stripe, *location, stream);
+}
+
+std::optional<BloomFilterIndex> aggregate_orc_metadata::read_bloom_filter_index(
+  size_type source_idx,
+  StripeInformation const& stripe,
+  StripeFooter const& stripe_footer,
+  size_type column_id,
+  rmm::cuda_stream_view stream) const
+{
+  auto location = find_index_stream(stripe, stripe_footer, BLOOM_FILTER_UTF8, column_id);
+  if (not location.has_value()) {
+    location = find_index_stream(stripe, stripe_footer, BLOOM_FILTER, column_id);
+  }
+  if (not location.has_value()) { return std::nullopt; }
+  return read_index_stream<BloomFilterIndex>(
+    per_file_metadata[source_idx], stripe, *location, stream);
+}
+
 std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stripes(
   std::vector<std::vector<size_type>> const& user_specified_stripes,
   size_type& row_start,
@@ -228,18 +320,9 @@ std::vector<metadata::stripe_source_mapping> aggregate_orc_metadata::select_stri
       per_file_metadata[mapping.source_idx].stripefooters.resize(mapping.stripe_info.size());
 
       for (size_t i = 0; i < mapping.stripe_info.size(); i++) {
-        const auto stripe         = mapping.stripe_info[i].first;
-        const auto sf_comp_offset = stripe->offset + stripe->indexLength + stripe->dataLength;
-        const auto sf_comp_length = stripe->footerLength;
-        CUDF_EXPECTS(
-          sf_comp_offset + sf_comp_length < per_file_metadata[mapping.source_idx].source->size(),
-          "Invalid stripe information");
-        const auto buffer =
-          per_file_metadata[mapping.source_idx].source->host_read(sf_comp_offset, sf_comp_length);
-        auto sf_data = per_file_metadata[mapping.source_idx].decompressor->decompress_blocks(
-          {buffer->data(), buffer->size()}, stream);
-        ProtobufReader(sf_data.data(), sf_data.size())
-          .read(per_file_metadata[mapping.source_idx].stripefooters[i]);
+        const auto stripe = mapping.stripe_info[i].first;
+        per_file_metadata[mapping.source_idx].stripefooters[i] =
+          read_stripe_footer(mapping.source_idx, *stripe, stream);
         mapping.stripe_info[i].second = &per_file_metadata[mapping.source_idx].stripefooters[i];
         if (stripe->indexLength == 0) { row_grp_idx_present = false; }
       }
@@ -110,6 +110,38 @@ class aggregate_orc_metadata {
     return per_file_metadata[source_idx].column_path(column_id);
   }
 
+  /**
+   * @brief Reads and decompresses the footer of the given stripe of the given source.
+   */
+  [[nodiscard]] StripeFooter read_stripe_footer(size_type source_idx,
+                                                StripeInformation const& stripe,
+                                                rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Reads and decompresses the row index of the given column in the given stripe.
+   *
+   * @return The row index; `nullopt` if the stripe has no row index for the column
+   */
+  [[nodiscard]] std::optional<RowIndex> read_row_index(size_type source_idx,
+                                                       StripeInformation const& stripe,
+                                                       StripeFooter const& stripe_footer,
+                                                       size_type column_id,
+                                                       rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Reads and decompresses the Bloom filters of the given column in the given stripe.
+   *
+   * Filters from `BLOOM_FILTER_UTF8` streams are preferred over the original `BLOOM_FILTER` ones.
+   *
+   * @return The Bloom filters, one per row group; `nullopt` if the stripe has none for the column
+   */
+  [[nodiscard]] std::optional<BloomFilterIndex> read_bloom_filter_index(
+    size_type source_idx,
+    StripeInformation const& stripe,
+    StripeFooter const& stripe_footer,
+    size_type column_id,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Selects the stripes to read, based on the row/stripe selection parameters.
    *
@@ -22,6 +22,7 @@
 
 #include <thrust/tabulate.h>
 
+#include <cstring>
 #include <string>
 
 namespace cudf {
@@ -200,6 +201,58 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(RowIndexEntry& s, size_t maxlen)
+{
+  auto op =
+    std::make_tuple(make_packed_field_reader(1, s.positions), make_field_reader(2, s.statistics));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(RowIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.entry));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  auto const read_fixed64 = [&](uint8_t const* end) {
+    uint64_t v = 0;
+    if (m_cur + sizeof(v) <= end) { std::memcpy(&v, m_cur, sizeof(v)); }
+    m_cur += sizeof(v);
+    return v;
+  };
+  // 2:bitset is a repeated fixed64 field, packed or not; 3:utf8bitset holds the same
+  // little-endian words as bytes
+  auto* const end = std::min(m_cur + maxlen, m_end);
+  while (m_cur < end) {
+    auto const field = get<uint32_t>();
+    switch (field) {
+      case encode_field_number(1, ProtofType::VARINT): s.numHashFunctions = get<uint32_t>(); break;
+      case encode_field_number(2, ProtofType::FIXED64):
+        s.bitset.push_back(read_fixed64(end));
+        break;
+      case encode_field_number(2, ProtofType::FIXEDLEN):
+      case encode_field_number(3, ProtofType::FIXEDLEN): {
+        auto const field_end = std::min(m_cur + read_field_size(end), end);
+        while (m_cur + sizeof(uint64_t) <= field_end) {
+          s.bitset.push_back(read_fixed64(field_end));
+        }
+        m_cur = field_end;
+        break;
+      }
+      default: skip_struct_field(field & 7);
+    }
+  }
+  CUDF_EXPECTS(m_cur <= end, "Current pointer to metadata stream is out of bounds");
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::make_tuple(make_field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -267,6 +320,30 @@ void ProtobufWriter::put_row_index_entry(int32_t present_blk,
   }
 }
 
+/**
+ * @brief Add a single BloomFilterIndex.bloomFilter, with the bitset in the utf8bitset field
+ */
+void ProtobufWriter::put_bloom_filter(uint32_t num_hash_functions,
+                                      host_span<uint64_t const> bitset)
+{
+  auto const bitset_size = bitset.size() * sizeof(uint64_t);
+  auto const filter_size = 1 + varint_size(num_hash_functions) + 1 + varint_size(bitset_size) +
+                           bitset_size;
+
+  // 1:BloomFilterIndex.bloomFilter
+  put_uint(encode_field_number(1, ProtofType::FIXEDLEN));
+  put_uint(filter_size);
+  put_uint(encode_field_number(1, ProtofType::VARINT));  // 1:numHashFunctions
+  put_uint(num_hash_functions);
+  put_uint(encode_field_number(3, ProtofType::FIXEDLEN));  // 3:utf8bitset
+  put_uint(bitset_size);
+  for (auto word : bitset) {
+    for (size_t i = 0; i < sizeof(word); ++i) {
+      put_byte(static_cast<uint8_t>(word >> (8 * i)));
+    }
+  }
+}
+
 size_t ProtobufWriter::write(const PostScript& s)
 {
   ProtobufFieldWriter w(this);
@@ -380,7 +457,10 @@ OrcDecompressor::OrcDecompressor(CompressionKind kind, uint32_t blockSize) : m_b
       m_log2MaxRatio = 5;  // < 32:1
       break;
     case LZO: _compression = compression_type::LZO; break;
-    case LZ4: _compression = compression_type::LZ4; break;
+    case LZ4:
+      _compression   = compression_type::LZ4;
+      m_log2MaxRatio = 8;  // < 256:1
+      break;
     case ZSTD:
       m_log2MaxRatio = 11;
       _compression   = compression_type::ZSTD;
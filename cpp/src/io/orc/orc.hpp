@@ -129,6 +129,24 @@ struct StripeStatistics {
   std::vector<ColStatsBlob> colStats;  // Column statistics blobs
 };
 
+struct RowIndexEntry {
+  std::vector<uint64_t> positions;              // stream positions at the start of the row group
+  std::optional<column_statistics> statistics;  // statistics of the row group
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group of the stripe
+};
+
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;
+  std::vector<uint64_t> bitset;  // from either the `bitset` or the `utf8bitset` field
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group of the stripe
+};
+
 struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
@@ -220,6 +238,10 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(RowIndexEntry&, size_t maxlen);
+  void read(RowIndex&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
@@ -519,6 +541,7 @@ class ProtobufWriter {
                            int32_t data2_ofs,
                            TypeKind kind,
                            ColStatsBlob const* stats);
+  void put_bloom_filter(uint32_t num_hash_functions, host_span<uint64_t const> bitset);
 
  public:
   size_t write(const PostScript&);
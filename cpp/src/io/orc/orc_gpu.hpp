@@ -30,6 +30,10 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <cuco/static_map.cuh>
+
+#include <cstring>
+
 namespace cudf {
 namespace io {
 namespace orc {
@@ -38,6 +42,11 @@ namespace gpu {
 using cudf::detail::device_2dspan;
 using cudf::detail::host_2dspan;
 
+auto constexpr KEY_SENTINEL   = size_type{-1};
+auto constexpr VALUE_SENTINEL = size_type{-1};
+using map_type                = cuco::static_map<size_type, size_type>;
+using slot_type               = map_type::pair_atomic_type;
+
 struct CompressedStreamInfo {
   CompressedStreamInfo() = default;
   explicit constexpr CompressedStreamInfo(const uint8_t* compressed_data_, size_t compressed_size_)
@@ -174,14 +183,11 @@ struct StripeStream {
  */
 struct DictionaryChunk {
   uint32_t* dict_data;   // dictionary data (index of non-null rows)
-  uint32_t* dict_index;  // row indices of corresponding string (row from dictionary index)
   uint32_t start_row;    // start row of this chunk
   uint32_t num_rows;     // num rows in this chunk
-  uint32_t num_strings;  // number of strings in this chunk
+  uint32_t num_strings;  // number of non-null strings in this chunk
   uint32_t
     string_char_count;  // total size of string data (NOTE: assumes less than 4G bytes per chunk)
-  uint32_t num_dict_strings;  // number of strings in dictionary
-  uint32_t dict_char_count;   // size of dictionary string data for this chunk
 
   orc_column_device_view const* leaf_column;  //!< Pointer to string column
 };
@@ -197,10 +203,103 @@ struct StripeDictionary {
   uint32_t num_chunks;       // number of chunks in the stripe
   uint32_t num_strings;      // number of unique strings in the dictionary
   uint32_t dict_char_count;  // total size of dictionary string data
+  slot_type* map_slots;      // hash map storage of the unique strings of the stripe
+  uint32_t map_size;         // number of slots in the hash map
 
   orc_column_device_view const* leaf_column;  //!< Pointer to string column
 };
 
+/**
+ * @brief Struct to describe the Bloom filter of a column in a rowgroup
+ */
+struct BloomFilterChunk {
+  orc_column_device_view const* leaf_column;  //!< Pointer to the column
+  TypeKind kind;                              //!< ORC type of the column
+  size_type start_row;                        //!< First row of the rowgroup
+  size_type num_rows;                         //!< Number of rows in the rowgroup
+  uint64_t* bitset;                           //!< Zero-initialized bitset of the filter
+  uint32_t num_bits;                          //!< Number of bits in the bitset
+  uint32_t num_hash_functions;                //!< Number of bits set per value
+};
+
+/**
+ * @brief Hash of an integer value in ORC Bloom filters (Thomas Wang's 64-bit integer hash, with
+ * arithmetic right shifts as in the Java implementation)
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(int64_t value)
+{
+  auto const shift_right = [](uint64_t key, int bits) {
+    return static_cast<uint64_t>(static_cast<int64_t>(key) >> bits);
+  };
+  auto key = static_cast<uint64_t>(value);
+  key      = (~key) + (key << 21);
+  key      = key ^ shift_right(key, 24);
+  key      = (key + (key << 3)) + (key << 8);
+  key      = key ^ shift_right(key, 14);
+  key      = (key + (key << 2)) + (key << 4);
+  key      = key ^ shift_right(key, 28);
+  return key + (key << 31);
+}
+
+/**
+ * @brief Hash of a floating point value in ORC Bloom filters, the integer hash of its bits with
+ * all NaNs collapsed into the canonical one
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_double_hash(double value)
+{
+  int64_t bits = 0x7ff8000000000000L;
+  if (value == value) { memcpy(&bits, &value, sizeof(bits)); }
+  return bloom_filter_long_hash(bits);
+}
+
+/**
+ * @brief Hash of a string in ORC Bloom filters (the 64-bit variant of Murmur3 used by Hive)
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_bytes_hash(uint8_t const* data, uint32_t length)
+{
+  constexpr uint64_t c1   = 0x87c37b91114253d5UL;
+  constexpr uint64_t c2   = 0x4cf5ad432745937fUL;
+  constexpr uint64_t seed = 104729;
+  auto const rotate_left  = [](uint64_t x, int r) { return (x << r) | (x >> (64 - r)); };
+  auto const mix          = [&](uint64_t k) { return rotate_left(k * c1, 31) * c2; };
+
+  uint64_t hash         = seed;
+  auto const num_blocks = length / 8;
+  for (uint32_t i = 0; i < num_blocks; ++i) {
+    uint64_t k = 0;
+    for (int b = 7; b >= 0; --b) {
+      k = (k << 8) | data[i * 8 + b];
+    }
+    hash ^= mix(k);
+    hash = rotate_left(hash, 27) * 5 + 0x52dce729;
+  }
+  uint64_t k = 0;
+  for (int b = static_cast<int>(length % 8) - 1; b >= 0; --b) {
+    k = (k << 8) | data[num_blocks * 8 + b];
+  }
+  if (length % 8 != 0) { hash ^= mix(k); }
+
+  hash ^= length;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdUL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53UL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * @brief Returns the position of the i-th bit, 1-based, that a hash sets in an ORC Bloom filter
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit(uint64_t hash, uint32_t i, uint32_t num_bits)
+{
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + i * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
 constexpr uint32_t encode_block_size = 512;
 
 /**
@@ -353,6 +452,7 @@ void CompactOrcDataStreams(device_2dspan<StripeStream> strm_desc,
  * @param[out] comp_in Per-block compression input buffers
  * @param[out] comp_out Per-block compression output buffers
  * @param[out] comp_stat Per-block compression status
+ * @param[in] scratch Scratch space for the nvCOMP compression
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
  */
 void CompressOrcDataStreams(uint8_t* compressed_data,
@@ -365,16 +465,17 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
                             device_span<device_span<uint8_t const>> comp_in,
                             device_span<device_span<uint8_t>> comp_out,
                             device_span<decompress_status> comp_stat,
+                            device_span<uint8_t> scratch,
                             rmm::cuda_stream_view stream);
 
 /**
  * @brief Launches kernel for initializing dictionary chunks
  *
+ * Counts the non-null strings of each rowgroup and their total size.
+ *
  * @param[in] orc_columns Pre-order flattened device array of ORC column views
  * @param[in,out] chunks DictionaryChunk device array [rowgroup][column]
  * @param[in] dict_data dictionary data (index of non-null rows)
- * @param[in] dict_index row indices of corresponding string (row from dictionary index)
- * @param[in] tmp_indices Temporary buffer for dictionary indices
  * @param[in] rowgroup_bounds Ranges of rows in each rowgroup [rowgroup][column]
  * @param[in] str_col_indexes List of columns that are strings type
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
@@ -382,23 +483,55 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
 void InitDictionaryIndices(device_span<orc_column_device_view const> orc_columns,
                            device_2dspan<DictionaryChunk> chunks,
                            device_span<device_span<uint32_t>> dict_data,
-                           device_span<device_span<uint32_t>> dict_index,
-                           device_span<device_span<uint32_t>> tmp_indices,
                            device_2dspan<rowgroup_rows const> rowgroup_bounds,
                            device_span<uint32_t const> str_col_indexes,
                            rmm::cuda_stream_view stream);
 
 /**
- * @brief Launches kernel for building stripe dictionaries
+ * @brief Launches kernel for initializing the hash maps of the stripe dictionaries
+ *
+ * @param[in] stripes StripeDictionary device 2D array [stripe][column]
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void InitializeStripeHashMaps(device_2dspan<StripeDictionary const> stripes,
+                              rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernel for inserting the strings of the rowgroups into the hash map of their
+ * stripe
+ *
+ * Adds the number and size of the strings inserted first to `num_strings` and `dict_char_count`
+ * of each stripe dictionary. Stripe dictionaries without `dict_data` are skipped.
+ *
+ * @param[in,out] stripes StripeDictionary device 2D array [stripe][column]
+ * @param[in] chunks DictionaryChunk device array [rowgroup][column]
+ * @param[in] rowgroup_stripes Index of the stripe of each rowgroup
+ * @param[in] first_chunk_only Whether to insert only the first rowgroup of each stripe, as a
+ * sample, or all the other rowgroups
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void PopulateStripeHashMaps(device_2dspan<StripeDictionary> stripes,
+                            device_2dspan<DictionaryChunk const> chunks,
+                            device_span<uint32_t const> rowgroup_stripes,
+                            bool first_chunk_only,
+                            rmm::cuda_stream_view stream);
+
+/**
+ * @brief Launches kernels for building stripe dictionaries from their hash maps
+ *
+ * Collects and sorts the unique strings of each stripe, then sets the dictionary index of every
+ * row.
  *
  * @param[in] d_stripes StripeDictionary device 2D array [stripe][column]
  * @param[in] h_stripes StripeDictionary host 2D array [stripe][column]
  * @param[in] chunks DictionaryChunk device array [rowgroup][column]
+ * @param[in] rowgroup_stripes Index of the stripe of each rowgroup
  * @param[in] stream CUDA stream used for device memory operations and kernel launches
  */
-void BuildStripeDictionaries(device_2dspan<StripeDictionary> d_stripes,
+void BuildStripeDictionaries(device_2dspan<StripeDictionary const> d_stripes,
                              host_2dspan<StripeDictionary const> h_stripes,
                              device_2dspan<DictionaryChunk const> chunks,
+                             device_span<uint32_t const> rowgroup_stripes,
                              rmm::cuda_stream_view stream);
 
 /**
@@ -442,6 +575,15 @@ void orc_encode_statistics(uint8_t* blob_bfr,
                            uint32_t statistics_count,
                            rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel to add the non-null values of each rowgroup to its Bloom filter
+ *
+ * @param[in] chunks Bloom filters of the rowgroups of the columns that have them
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void orc_encode_bloom_filters(device_span<BloomFilterChunk const> chunks,
+                              rmm::cuda_stream_view stream);
+
 /**
  * @brief Number of set bits in pushdown masks, per rowgroup.
  *
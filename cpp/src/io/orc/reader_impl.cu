@@ -28,9 +28,13 @@
 #include <io/comp/gpuinflate.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/bit.hpp>
@@ -53,7 +57,12 @@
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
 
 namespace cudf {
 namespace io {
@@ -142,7 +151,7 @@ void generate_offsets_for_list(rmm::device_uvector<list_buffer_data> const& buff
       thrust::seq, list_data.data, list_data.data + list_data.size, list_data.data);
   };
   thrust::for_each(rmm::exec_policy(stream), buff_data.begin(), buff_data.end(), transformer);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 }
 
 /**
@@ -260,6 +269,105 @@ auto decimal_column_type(std::vector<std::string> const& decimal128_columns,
   return type_id::DECIMAL128;
 }
 
+/**
+ * @brief Converts ORC column statistics of a flat numeric column to a comparable form.
+ *
+ * Integer and floating point statistics are stored as 64-bit values, which `long double` holds
+ * exactly.
+ */
+column_chunk_stats decode_column_stats(orc::column_statistics const& stats, orc::TypeKind kind)
+{
+  column_chunk_stats result;
+  switch (kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+      if (stats.int_stats.has_value() and stats.int_stats->minimum.has_value() and
+          stats.int_stats->maximum.has_value()) {
+        result.has_range = true;
+        result.min       = static_cast<long double>(*stats.int_stats->minimum);
+        result.max       = static_cast<long double>(*stats.int_stats->maximum);
+      }
+      break;
+    case orc::FLOAT:
+    case orc::DOUBLE:
+      if (stats.double_stats.has_value() and stats.double_stats->minimum.has_value() and
+          stats.double_stats->maximum.has_value() and
+          not std::isnan(*stats.double_stats->minimum) and
+          not std::isnan(*stats.double_stats->maximum)) {
+        result.has_range = true;
+        result.min       = static_cast<long double>(*stats.double_stats->minimum);
+        result.max       = static_cast<long double>(*stats.double_stats->maximum);
+      }
+      break;
+    // Statistics of other types are not comparable against numeric literals
+    default: return result;
+  }
+  // numberOfValues counts the non-null values
+  result.all_nulls = stats.number_of_values.has_value() and *stats.number_of_values == 0;
+  return result;
+}
+
+/**
+ * @copydoc decode_column_stats(orc::column_statistics const&, orc::TypeKind)
+ */
+column_chunk_stats decode_column_stats(ColStatsBlob const& blob, orc::TypeKind kind)
+{
+  orc::column_statistics stats;
+  ProtobufReader(blob.data(), blob.size()).read(stats);
+  return decode_column_stats(stats, kind);
+}
+
+/**
+ * @brief Probes the Bloom filter of a row group of a flat numeric column for a value.
+ *
+ * Returns `false` only if the row group provably does not contain `value`; values whose hash is
+ * ambiguous (e.g. `-0.0` and `0.0`) are assumed to possibly match.
+ */
+bool bloom_filter_may_contain(orc::BloomFilter const& filter, orc::TypeKind kind, long double value)
+{
+  // Bit positions are non-negative 32-bit integers
+  if (filter.numHashFunctions == 0 or filter.bitset.empty() or
+      filter.bitset.size() > std::numeric_limits<int32_t>::max() / 64) {
+    return true;
+  }
+  auto const num_bits = static_cast<uint32_t>(filter.bitset.size() * 64);
+
+  std::optional<uint64_t> hash;
+  switch (kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+      if (value == std::trunc(value) and
+          value >= static_cast<long double>(std::numeric_limits<int64_t>::min()) and
+          value <= static_cast<long double>(std::numeric_limits<int64_t>::max())) {
+        hash = gpu::bloom_filter_long_hash(static_cast<int64_t>(value));
+      }
+      break;
+    // Float values are added as doubles
+    case orc::FLOAT:
+      if (value != 0 and static_cast<long double>(static_cast<float>(value)) == value) {
+        hash = gpu::bloom_filter_double_hash(static_cast<float>(value));
+      }
+      break;
+    case orc::DOUBLE:
+      if (value != 0 and static_cast<long double>(static_cast<double>(value)) == value) {
+        hash = gpu::bloom_filter_double_hash(static_cast<double>(value));
+      }
+      break;
+    default: break;
+  }
+  if (not hash.has_value()) { return true; }
+
+  for (uint32_t i = 1; i <= filter.numHashFunctions; ++i) {
+    auto const bit = gpu::bloom_filter_bit(*hash, i, num_bits);
+    if (((filter.bitset[bit / 64] >> (bit % 64)) & 1) == 0) { return false; }
+  }
+  return true;
+}
+
 }  // namespace
 
 __global__ void decompress_check_kernel(device_span<decompress_status const> stats,
@@ -410,6 +518,15 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                    total_decomp_size,
                                    stream);
         break;
+      case compression_type::LZ4:
+        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                   inflate_in_view,
+                                   inflate_out_view,
+                                   inflate_stats,
+                                   max_uncomp_block_size,
+                                   total_decomp_size,
+                                   stream);
+        break;
       default: CUDF_FAIL("Unexpected decompression dispatch"); break;
     }
     decompress_check(inflate_stats, any_block_failure.device_ptr(), stream);
@@ -594,7 +711,7 @@ void scan_null_counts(cudf::detail::hostdevice_2dvector<gpu::ColumnDesc> const&
                      thrust::inclusive_scan(thrust::seq, psums.begin(), psums.end(), psums.begin());
                    });
   // `prefix_sums_to_update` goes out of scope, copy has to be done before we return
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 }
 
 void reader::impl::decode_stream_data(cudf::detail::hostdevice_2dvector<gpu::ColumnDesc>& chunks,
@@ -905,13 +1022,216 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
 
   // Control decimals conversion
   decimal128_columns = options.get_decimal128_columns();
+
+  _filter = options.get_filter();
+}
+
+reader::impl::impl(std::size_t read_memory_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   orc_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(std::move(sources), options, stream, mr)
+{
+  CUDF_EXPECTS(options.get_skip_rows() == 0 and options.get_num_rows() < 0,
+               "skip_rows and num_rows are not supported by the chunked reader");
+  _chunk_stripes = compute_chunk_stripes(options.get_stripes(), read_memory_limit);
+}
+
+std::vector<std::vector<std::vector<size_type>>> reader::impl::compute_chunk_stripes(
+  std::vector<std::vector<size_type>> const& stripes, std::size_t read_memory_limit)
+{
+  auto const num_sources = _metadata.per_file_metadata.size();
+  CUDF_EXPECTS(stripes.empty() or stripes.size() == num_sources,
+               "Must specify stripes for each source");
+
+  std::vector<data_type> column_types;
+  for (auto const& col : selected_columns.levels[0]) {
+    column_types.emplace_back(to_type_id(_metadata.get_col_type(col.id),
+                                         _use_np_dtypes,
+                                         _timestamp_type.id(),
+                                         decimal_column_type(decimal128_columns, _metadata, col.id)));
+  }
+
+  // Estimates the device memory needed to read a stripe: the raw stream data, plus the decoded
+  // top-level columns; nested children are approximated by the stream data itself
+  auto const estimate_stripe_size = [&](size_t src_idx, size_type stripe_idx) {
+    auto const& pfm    = _metadata.per_file_metadata[src_idx];
+    auto const& stripe = pfm.ff.stripes[stripe_idx];
+    std::size_t size   = stripe.indexLength + stripe.dataLength;
+    for (size_t i = 0; i < column_types.size(); ++i) {
+      auto const& type = column_types[i];
+      if (is_fixed_width(type)) {
+        size += static_cast<std::size_t>(stripe.numberOfRows) * cudf::size_of(type);
+        continue;
+      }
+      size += static_cast<std::size_t>(stripe.numberOfRows) * sizeof(size_type);
+      auto const col_id = selected_columns.levels[0][i].id;
+      if (type.id() == type_id::STRING and
+          static_cast<size_t>(stripe_idx) < pfm.md.stripeStats.size() and
+          static_cast<size_t>(col_id) < pfm.md.stripeStats[stripe_idx].colStats.size()) {
+        auto const& blob = pfm.md.stripeStats[stripe_idx].colStats[col_id];
+        orc::column_statistics stats;
+        ProtobufReader(blob.data(), blob.size()).read(stats);
+        if (stats.string_stats.has_value() and stats.string_stats->sum.has_value()) {
+          size += *stats.string_stats->sum;
+        }
+      }
+    }
+    return size;
+  };
+
+  std::vector<std::vector<std::vector<size_type>>> chunks;
+  std::vector<std::vector<size_type>> current_chunk(num_sources);
+  std::size_t current_size = 0;
+  bool is_chunk_empty      = true;
+  for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+    auto const num_stripes = _metadata.per_file_metadata[src_idx].get_num_stripes();
+    std::vector<size_type> stripe_indices;
+    if (stripes.empty()) {
+      stripe_indices.resize(num_stripes);
+      std::iota(stripe_indices.begin(), stripe_indices.end(), 0);
+    } else {
+      stripe_indices = stripes[src_idx];
+    }
+
+    for (auto const stripe_idx : stripe_indices) {
+      CUDF_EXPECTS(stripe_idx >= 0 and stripe_idx < num_stripes, "Invalid stripe index");
+      auto const stripe_size = estimate_stripe_size(src_idx, stripe_idx);
+      // A stripe exceeding the limit on its own still forms a chunk
+      if (read_memory_limit > 0 and not is_chunk_empty and
+          current_size + stripe_size > read_memory_limit) {
+        chunks.push_back(std::move(current_chunk));
+        current_chunk = std::vector<std::vector<size_type>>(num_sources);
+        current_size  = 0;
+      }
+      current_chunk[src_idx].push_back(stripe_idx);
+      current_size += stripe_size;
+      is_chunk_empty = false;
+    }
+  }
+  // Always produce at least one chunk, so that an empty selection yields an empty table
+  if (not is_chunk_empty or chunks.empty()) { chunks.push_back(std::move(current_chunk)); }
+  return chunks;
+}
+
+bool reader::impl::has_next() const { return _current_chunk < _chunk_stripes.size(); }
+
+table_with_metadata reader::impl::read_chunk(rmm::cuda_stream_view stream)
+{
+  if (not has_next()) {
+    // Past the end, return an empty table with the same schema
+    return read(0, 0, std::vector<std::vector<size_type>>{}, stream);
+  }
+  return read(0, -1, _chunk_stripes[_current_chunk++], stream);
+}
+
+std::vector<std::vector<size_type>> reader::impl::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripes, rmm::cuda_stream_view stream)
+{
+  auto const& top_level_columns = selected_columns.levels[0];
+  auto const column_id          = [&](size_type col_idx) {
+    CUDF_EXPECTS(col_idx >= 0 && col_idx < static_cast<size_type>(top_level_columns.size()),
+                 "Filter column index is out of range");
+    return top_level_columns[col_idx].id;
+  };
+  auto const may_contain = [](size_type, long double) { return true; };
+
+  auto const num_sources = _metadata.per_file_metadata.size();
+  std::vector<std::vector<size_type>> filtered_stripes(num_sources);
+  for (size_t src_idx = 0; src_idx < num_sources; ++src_idx) {
+    auto const& pfm = _metadata.per_file_metadata[src_idx];
+    std::vector<size_type> stripe_indices;
+    if (stripes.empty()) {
+      stripe_indices.resize(pfm.get_num_stripes());
+      std::iota(stripe_indices.begin(), stripe_indices.end(), 0);
+    } else {
+      stripe_indices = stripes[src_idx];
+    }
+
+    for (auto const stripe_idx : stripe_indices) {
+      CUDF_EXPECTS(stripe_idx >= 0 and stripe_idx < pfm.get_num_stripes(), "Invalid stripe index");
+      auto const& stripe = pfm.ff.stripes[stripe_idx];
+
+      // Stripe-level statistics, from the file metadata
+      auto const get_stripe_stats = [&](size_type col_idx) {
+        auto const col_id = column_id(col_idx);
+        if (static_cast<size_t>(stripe_idx) >= pfm.md.stripeStats.size() or
+            static_cast<size_t>(col_id) >= pfm.md.stripeStats[stripe_idx].colStats.size()) {
+          return column_chunk_stats{};
+        }
+        return decode_column_stats(pfm.md.stripeStats[stripe_idx].colStats[col_id],
+                                   pfm.ff.types[col_id].kind);
+      };
+      auto const stripe_truth =
+        stats_expression_evaluator{get_stripe_stats, may_contain, stream}.evaluate(_filter->get());
+      if (not stripe_truth.can_be_true) { continue; }
+
+      // Row-group-level statistics, from the row indexes of the filter columns
+      auto const row_index_stride = pfm.get_row_index_stride();
+      if (stripe.indexLength == 0 or row_index_stride <= 0) {
+        filtered_stripes[src_idx].push_back(stripe_idx);
+        continue;
+      }
+      auto const num_row_groups =
+        cudf::util::div_rounding_up_safe<uint64_t>(stripe.numberOfRows, row_index_stride);
+      auto const stripe_footer = _metadata.read_stripe_footer(src_idx, stripe, stream);
+      std::map<size_type, std::optional<RowIndex>> row_indexes;
+      std::map<size_type, std::optional<BloomFilterIndex>> bloom_filters;
+      bool any_row_group_matches = false;
+      for (uint64_t rg = 0; rg < num_row_groups and not any_row_group_matches; ++rg) {
+        auto const get_row_group_stats = [&](size_type col_idx) {
+          auto const col_id = column_id(col_idx);
+          auto it           = row_indexes.find(col_id);
+          if (it == row_indexes.end()) {
+            auto row_index =
+              _metadata.read_row_index(src_idx, stripe, stripe_footer, col_id, stream);
+            it = row_indexes.emplace(col_id, std::move(row_index)).first;
+          }
+          auto const& row_index = it->second;
+          if (not row_index.has_value() or row_index->entry.size() != num_row_groups or
+              not row_index->entry[rg].statistics.has_value()) {
+            return column_chunk_stats{};
+          }
+          return decode_column_stats(*row_index->entry[rg].statistics, pfm.ff.types[col_id].kind);
+        };
+        auto const row_group_may_contain = [&](size_type col_idx, long double value) {
+          auto const col_id = column_id(col_idx);
+          auto it           = bloom_filters.find(col_id);
+          if (it == bloom_filters.end()) {
+            auto bloom_filter_index =
+              _metadata.read_bloom_filter_index(src_idx, stripe, stripe_footer, col_id, stream);
+            it = bloom_filters.emplace(col_id, std::move(bloom_filter_index)).first;
+          }
+          auto const& bloom_filter_index = it->second;
+          if (not bloom_filter_index.has_value() or
+              bloom_filter_index->bloomFilter.size() != num_row_groups) {
+            return true;
+          }
+          return bloom_filter_may_contain(
+            bloom_filter_index->bloomFilter[rg], pfm.ff.types[col_id].kind, value);
+        };
+        any_row_group_matches =
+          stats_expression_evaluator{get_row_group_stats, row_group_may_contain, stream}
+            .evaluate(_filter->get())
+            .can_be_true;
+      }
+      if (any_row_group_matches) { filtered_stripes[src_idx].push_back(stripe_idx); }
+    }
+  }
+  return filtered_stripes;
 }
 
 timezone_table reader::impl::compute_timezone_table(
   const std::vector<cudf::io::orc::metadata::stripe_source_mapping>& selected_stripes,
   rmm::cuda_stream_view stream)
 {
-  if (selected_stripes.empty()) return {};
+  // All stripes of all sources may have been filtered out
+  auto const first_mapping =
+    std::find_if(selected_stripes.cbegin(), selected_stripes.cend(), [](auto const& mapping) {
+      return not mapping.stripe_info.empty();
+    });
+  if (first_mapping == selected_stripes.cend()) return {};
 
   auto const has_timestamp_column = std::any_of(
     selected_columns.levels.cbegin(), selected_columns.levels.cend(), [&](auto& col_lvl) {
@@ -921,7 +1241,7 @@ timezone_table reader::impl::compute_timezone_table(
     });
   if (not has_timestamp_column) return {};
 
-  return build_timezone_transition_table(selected_stripes[0].stripe_info[0].second->writerTimezone,
+  return build_timezone_transition_table(first_mapping->stripe_info[0].second->writerTimezone,
                                          stream);
 }
 
@@ -935,6 +1255,9 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   CUDF_EXPECTS(skip_rows == 0 or selected_columns.num_levels() == 1,
                "skip_rows is not supported by nested columns");
 
+  // Reset the column metadata left over from a previous read
+  _col_meta = reader_column_meta{};
+
   std::vector<std::unique_ptr<column>> out_columns;
   // buffer and stripe data are stored as per nesting level
   std::vector<std::vector<column_buffer>> out_buffers(selected_columns.num_levels());
@@ -947,8 +1270,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (selected_columns.num_levels() == 0)
     return {std::make_unique<table>(), std::move(out_metadata)};
 
+  // Skip the stripes that cannot contain any row satisfying the filter; pruning would change the
+  // meaning of an explicit row range, so it is only done when reading whole stripes
+  auto const stripes_to_read = (_filter.has_value() and skip_rows == 0 and num_rows < 0)
+                                 ? filter_stripes(stripes, stream)
+                                 : stripes;
+
   // Select only stripes required (aka row groups)
-  const auto selected_stripes = _metadata.select_stripes(stripes, skip_rows, num_rows, stream);
+  const auto selected_stripes =
+    _metadata.select_stripes(stripes_to_read, skip_rows, num_rows, stream);
 
   auto const tz_table = compute_timezone_table(selected_stripes, stream);
 
@@ -1101,7 +1431,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
               CUDF_EXPECTS(buffer->size() == len, "Unexpected discrepancy in bytes read.");
               CUDF_CUDA_TRY(cudaMemcpyAsync(
                 d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream.value()));
-              stream.synchronize();
+              cudf::detail::synchronize_stream(stream);
             }
           }
 
@@ -1271,6 +1601,15 @@ table_with_metadata reader::impl::read(size_type skip_rows,
             generate_offsets_for_list(dev_buff_data, stream);
           }
         }
+
+        // Decoded string columns point into the stream data until the output columns are created;
+        // the stream data of other levels can be released as soon as they are decoded
+        if (std::none_of(column_types.cbegin(), column_types.cend(), [](auto const& type) {
+              return type.id() == type_id::STRING;
+            })) {
+          stripe_data.clear();
+          stripe_data.shrink_to_fit();
+        }
       }
     }
   }
@@ -1279,6 +1618,7 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   if (out_columns.empty()) {
     create_columns(std::move(out_buffers), out_columns, schema_info, stream);
   }
+  lvl_stripe_data.clear();
 
   // Return column names (must match order of returned columns)
   out_metadata.column_names.reserve(schema_info.size());
@@ -1305,7 +1645,20 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   out_metadata.user_data = {out_metadata.per_file_user_data[0].begin(),
                             out_metadata.per_file_user_data[0].end()};
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  if (_filter.has_value()) {
+    // Stripes surviving the pruning may still contain rows not satisfying the filter
+    auto const predicate = cudf::detail::compute_column(
+      out_table->view(),
+      dynamic_cast<ast::operation const&>(_filter->get()),
+      stream,
+      rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8,
+                 "The filter must evaluate to a boolean column");
+    out_table = cudf::detail::apply_boolean_mask(out_table->view(), predicate->view(), stream, _mr);
+  }
+
+  return {std::move(out_table), std::move(out_metadata)};
 }
 
 // Forward to implementation
@@ -1327,6 +1680,29 @@ table_with_metadata reader::read(orc_reader_options const& options, rmm::cuda_st
     options.get_skip_rows(), options.get_num_rows(), options.get_stripes(), stream);
 }
 
+// Default constructor, only used by derived classes
+reader::reader() = default;
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t read_memory_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               orc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+  : _stream{stream}
+{
+  _impl = std::make_unique<impl>(read_memory_limit, std::move(sources), options, stream, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(_stream); }
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
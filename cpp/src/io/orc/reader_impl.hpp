@@ -29,7 +29,9 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -87,6 +89,39 @@ class reader::impl {
                 rmm::cuda_stream_view stream,
                 rmm::mr::device_memory_resource* mr);
 
+  /**
+   * @brief Constructor from a read memory limit and a dataset source with reader options, for
+   * reading the dataset chunk by chunk.
+   *
+   * The stripes to read are split into consecutive chunks at construction time.
+   *
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t read_memory_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                orc_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @copydoc cudf::io::chunked_orc_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read the next chunk of stripes
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk(rmm::cuda_stream_view stream);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -205,6 +240,32 @@ class reader::impl {
                                               column_name_info& schema_info,
                                               rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Removes the stripes whose statistics prove that no row satisfies the filter.
+   *
+   * A stripe is removed if either its stripe-level statistics or the statistics of all of its row
+   * groups rule out the filter.
+   *
+   * @param stripes Lists of stripes to read, one per source; all stripes if empty
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return Lists of stripes that may contain rows satisfying the filter, one per source
+   */
+  std::vector<std::vector<size_type>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripes, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Splits the stripes to read into consecutive chunks within a memory limit.
+   *
+   * @param stripes Lists of stripes to read, one per source; all stripes if empty
+   * @param read_memory_limit Limit on the estimated device memory used to read each chunk, in
+   *        bytes, or `0` if there is no limit
+   *
+   * @return Lists of stripes to read per source, one entry per chunk
+   */
+  std::vector<std::vector<std::vector<size_type>>> compute_chunk_stripes(
+    std::vector<std::vector<size_type>> const& stripes, std::size_t read_memory_limit);
+
   /**
    * @brief Setup table for converting timestamp columns from local to UTC time
    *
@@ -224,7 +285,12 @@ class reader::impl {
   bool _use_np_dtypes{true};
   std::vector<std::string> decimal128_columns;
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
   reader_column_meta _col_meta{};
+
+  // Stripes to read per chunk [chunk][source][stripe], and the index of the next chunk to read
+  std::vector<std::vector<std::vector<size_type>>> _chunk_stripes;
+  std::size_t _current_chunk{0};
 };
 
 }  // namespace orc
@@ -403,6 +403,59 @@ void orc_encode_statistics(uint8_t* blob_bfr,
     blob_bfr, groups, chunks, statistics_count);
 }
 
+constexpr unsigned int bloom_filter_block_size = 256;
+
+/**
+ * @brief Hash of a value in ORC Bloom filters, based on the ORC type of the column
+ */
+__device__ uint64_t bloom_filter_hash(orc_column_device_view const& col,
+                                      TypeKind kind,
+                                      size_type row)
+{
+  switch (kind) {
+    case TypeKind::BYTE: return bloom_filter_long_hash(col.element<int8_t>(row));
+    case TypeKind::SHORT: return bloom_filter_long_hash(col.element<int16_t>(row));
+    case TypeKind::INT: return bloom_filter_long_hash(col.element<int32_t>(row));
+    case TypeKind::LONG: return bloom_filter_long_hash(col.element<int64_t>(row));
+    case TypeKind::DATE:
+      return bloom_filter_long_hash(col.element<cudf::timestamp_D>(row).time_since_epoch().count());
+    // Like the Java writer, float values are added as doubles
+    case TypeKind::FLOAT: return bloom_filter_double_hash(col.element<float>(row));
+    case TypeKind::DOUBLE: return bloom_filter_double_hash(col.element<double>(row));
+    case TypeKind::STRING: {
+      auto const str = col.element<string_view>(row);
+      return bloom_filter_bytes_hash(reinterpret_cast<uint8_t const*>(str.data()),
+                                     str.size_bytes());
+    }
+    default: return 0;
+  }
+}
+
+// blockDim {bloom_filter_block_size,1,1}
+__global__ void __launch_bounds__(bloom_filter_block_size)
+  gpu_encode_bloom_filters(device_span<BloomFilterChunk const> chunks)
+{
+  auto const& ck  = chunks[blockIdx.x];
+  auto const& col = *ck.leaf_column;
+  auto const end  = ck.start_row + ck.num_rows;
+  for (auto row = ck.start_row + static_cast<size_type>(threadIdx.x); row < end;
+       row += bloom_filter_block_size) {
+    if (not col.is_valid(row)) { continue; }
+    auto const hash = bloom_filter_hash(col, ck.kind, row);
+    for (uint32_t i = 1; i <= ck.num_hash_functions; ++i) {
+      auto const bit = bloom_filter_bit(hash, i, ck.num_bits);
+      atomicOr(reinterpret_cast<unsigned long long*>(ck.bitset + bit / 64), 1ull << (bit % 64));
+    }
+  }
+}
+
+void orc_encode_bloom_filters(device_span<BloomFilterChunk const> chunks,
+                              rmm::cuda_stream_view stream)
+{
+  if (chunks.empty()) { return; }
+  gpu_encode_bloom_filters<<<chunks.size(), bloom_filter_block_size, 0, stream.value()>>>(chunks);
+}
+
 }  // namespace gpu
 }  // namespace orc
 }  // namespace io
@@ -837,11 +837,7 @@ __global__ void __launch_bounds__(block_size)
           }
           case STRING:
             if (s->chunk.encoding_kind == DICTIONARY_V2) {
-              uint32_t dict_idx = s->chunk.dict_index[row];
-              if (dict_idx > 0x7fffffffu) {
-                dict_idx = s->chunk.dict_index[dict_idx & 0x7fffffffu];
-              }
-              s->vals.u32[nz_idx] = dict_idx;
+              s->vals.u32[nz_idx] = s->chunk.dict_index[row];
             } else {
               string_view value                       = column.element<string_view>(row);
               s->u.strenc.str_data[s->buf.u32[t] - 1] = value.data();
@@ -1312,6 +1308,7 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
                             device_span<device_span<uint8_t const>> comp_in,
                             device_span<device_span<uint8_t>> comp_out,
                             device_span<decompress_status> comp_stat,
+                            device_span<uint8_t> scratch,
                             rmm::cuda_stream_view stream)
 {
   dim3 dim_block_init(256, 1);
@@ -1328,8 +1325,13 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
   if (compression == SNAPPY) {
     try {
       if (detail::nvcomp_integration::is_stable_enabled()) {
-        nvcomp::batched_compress(
-          nvcomp::compression_type::SNAPPY, comp_in, comp_out, comp_stat, comp_blk_size, stream);
+        nvcomp::batched_compress(nvcomp::compression_type::SNAPPY,
+                                 comp_in,
+                                 comp_out,
+                                 comp_stat,
+                                 comp_blk_size,
+                                 scratch,
+                                 stream);
       } else {
         gpu_snap(comp_in, comp_out, comp_stat, stream);
       }
@@ -1343,8 +1345,23 @@ void CompressOrcDataStreams(uint8_t* compressed_data,
       // writing without compression
     }
   } else if (compression == ZLIB and detail::nvcomp_integration::is_all_enabled()) {
+    nvcomp::batched_compress(nvcomp::compression_type::DEFLATE,
+                             comp_in,
+                             comp_out,
+                             comp_stat,
+                             comp_blk_size,
+                             scratch,
+                             stream);
+  } else if ((compression == ZSTD or compression == LZ4) and
+             detail::nvcomp_integration::is_stable_enabled()) {
     nvcomp::batched_compress(
-      nvcomp::compression_type::DEFLATE, comp_in, comp_out, comp_stat, comp_blk_size, stream);
+      (compression == ZSTD) ? nvcomp::compression_type::ZSTD : nvcomp::compression_type::LZ4,
+      comp_in,
+      comp_out,
+      comp_stat,
+      comp_blk_size,
+      scratch,
+      stream);
   } else if (compression != NONE) {
     CUDF_FAIL("Unsupported compression type");
   }
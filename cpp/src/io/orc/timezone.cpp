@@ -15,6 +15,7 @@
  */
 #include "timezone.cuh"
 
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 
 #include <algorithm>
@@ -374,7 +375,8 @@ static int64_t get_transition_time(dst_transition_s const& trans, int year)
 }
 
 timezone_table build_timezone_transition_table(std::string const& timezone_name,
-                                               rmm::cuda_stream_view stream)
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
 {
   if (timezone_name == "UTC" || timezone_name.empty()) {
     // Return an empty table for UTC
@@ -461,10 +463,12 @@ timezone_table build_timezone_transition_table(std::string const& timezone_name,
                         .count();
   }
 
-  rmm::device_uvector<int64_t> d_ttimes  = cudf::detail::make_device_uvector_async(ttimes, stream);
-  rmm::device_uvector<int32_t> d_offsets = cudf::detail::make_device_uvector_async(offsets, stream);
+  rmm::device_uvector<int64_t> d_ttimes =
+    cudf::detail::make_device_uvector_async(ttimes, stream, mr);
+  rmm::device_uvector<int32_t> d_offsets =
+    cudf::detail::make_device_uvector_async(offsets, stream, mr);
   auto const gmt_offset                  = get_gmt_offset(ttimes, offsets, orc_utc_offset);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   return {gmt_offset, std::move(d_ttimes), std::move(d_offsets)};
 }
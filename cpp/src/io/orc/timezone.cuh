@@ -22,6 +22,7 @@
 #include <io/utilities/time_utils.cuh>
 
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <thrust/binary_search.h>
 #include <thrust/execution_policy.h>
 
@@ -134,11 +135,14 @@ class timezone_table {
  *
  * @param timezone_name standard timezone name (for example, "US/Pacific")
  * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the table's device memory
  *
  * @return The transition table for the given timezone
  */
-timezone_table build_timezone_transition_table(std::string const& timezone_name,
-                                               rmm::cuda_stream_view stream);
+timezone_table build_timezone_transition_table(
+  std::string const& timezone_name,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
 }  // namespace io
 }  // namespace cudf
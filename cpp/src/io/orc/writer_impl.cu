@@ -24,15 +24,19 @@
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
+#include <io/utilities/config_utils.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_pool.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
@@ -53,6 +57,8 @@
 #include <thrust/transform.h>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -77,12 +83,6 @@ struct row_group_index_info {
 };
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to ORC compression
  */
@@ -92,6 +92,8 @@ orc::CompressionKind to_orc_compression(compression_type compression)
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
     case compression_type::ZLIB: return orc::CompressionKind::ZLIB;
+    case compression_type::ZSTD: return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_FAIL("Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -196,6 +198,17 @@ class orc_column_view {
       name{metadata.get_name()}
   {
     if (metadata.is_nullability_defined()) { nullable_from_metadata = metadata.nullable(); }
+    switch (_type_kind) {
+      case TypeKind::BYTE:
+      case TypeKind::SHORT:
+      case TypeKind::INT:
+      case TypeKind::LONG:
+      case TypeKind::DATE:
+      case TypeKind::FLOAT:
+      case TypeKind::DOUBLE:
+      case TypeKind::STRING: _bloom_filter = metadata.is_enabled_bloom_filter(); break;
+      default: break;
+    }
     if (parent != nullptr) {
       parent->add_child(_index);
       _parent_index = parent->index();
@@ -278,6 +291,9 @@ class orc_column_view {
   [[nodiscard]] auto orc_encoding() const noexcept { return _encoding_kind; }
   [[nodiscard]] std::string_view orc_name() const noexcept { return name; }
 
+  // Whether Bloom filters are written for the rowgroups of the column
+  [[nodiscard]] bool has_bloom_filter() const noexcept { return _bloom_filter; }
+
  private:
   column_view cudf_column;
 
@@ -295,6 +311,7 @@ class orc_column_view {
   size_t _type_width = 0;
   int32_t _scale     = 0;
   int32_t _precision = 0;
+  bool _bloom_filter = false;
 
   // String dictionary-related members
   size_t _dict_stride                        = 0;
@@ -371,19 +388,17 @@ file_segmentation calculate_segmentation(host_span<orc_column_view const> column
 }
 
 /**
- * @brief Builds up column dictionaries indices
+ * @brief Counts the strings of each rowgroup of the string columns
  *
  * @param orc_table Non-owning view of a cuDF table w/ ORC-related info
  * @param rowgroup_bounds Ranges of rows in each rowgroup [rowgroup][column]
  * @param dict_data Dictionary data memory
- * @param dict_index Dictionary index memory
  * @param dict List of dictionary chunks
  * @param stream CUDA stream used for device memory operations and kernel launches
  */
 void init_dictionaries(orc_table_view& orc_table,
                        device_2dspan<rowgroup_rows const> rowgroup_bounds,
                        device_span<device_span<uint32_t>> dict_data,
-                       device_span<device_span<uint32_t>> dict_index,
                        hostdevice_2dvector<gpu::DictionaryChunk>* dict,
                        rmm::cuda_stream_view stream)
 {
@@ -394,32 +409,9 @@ void init_dictionaries(orc_table_view& orc_table,
     str_column.attach_dict_chunk(dict->base_host_ptr(), dict->base_device_ptr());
   }
 
-  // Allocate temporary memory for dictionary indices
-  std::vector<rmm::device_uvector<uint32_t>> dict_indices;
-  dict_indices.reserve(orc_table.num_string_columns());
-  std::transform(orc_table.string_column_indices.cbegin(),
-                 orc_table.string_column_indices.cend(),
-                 std::back_inserter(dict_indices),
-                 [&](auto& col_idx) {
-                   auto& str_column = orc_table.column(col_idx);
-                   return cudf::detail::make_zeroed_device_uvector_async<uint32_t>(
-                     str_column.size(), stream);
-                 });
-
-  // Create views of the temporary buffers in device memory
-  std::vector<device_span<uint32_t>> dict_indices_views;
-  dict_indices_views.reserve(dict_indices.size());
-  std::transform(
-    dict_indices.begin(), dict_indices.end(), std::back_inserter(dict_indices_views), [](auto& di) {
-      return device_span<uint32_t>{di};
-    });
-  auto d_dict_indices_views = cudf::detail::make_device_uvector_async(dict_indices_views, stream);
-
   gpu::InitDictionaryIndices(orc_table.d_columns,
                              *dict,
                              dict_data,
-                             dict_index,
-                             d_dict_indices_views,
                              rowgroup_bounds,
                              orc_table.d_string_column_indices,
                              stream);
@@ -430,11 +422,16 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
                                       host_span<stripe_rowgroups const> stripe_bounds,
                                       hostdevice_2dvector<gpu::DictionaryChunk> const& dict,
                                       host_span<rmm::device_uvector<uint32_t>> dict_index,
-                                      host_span<bool const> dictionary_enabled,
                                       hostdevice_2dvector<gpu::StripeDictionary>& stripe_dict)
 {
-  const auto num_rowgroups = dict.size().first;
+  // The stripe of each rowgroup
+  std::vector<uint32_t> h_rowgroup_stripes(dict.size().first);
+  for (auto const& stripe : stripe_bounds) {
+    std::fill_n(h_rowgroup_stripes.begin() + stripe.first, stripe.size, stripe.id);
+  }
+  auto const rowgroup_stripes = cudf::detail::make_device_uvector_async(h_rowgroup_stripes, stream);
 
+  std::vector<rmm::device_uvector<gpu::slot_type>> hash_maps_storage;
   for (size_t dict_idx = 0; dict_idx < orc_table.num_string_columns(); ++dict_idx) {
     auto& str_column = orc_table.string_column(dict_idx);
     str_column.attach_stripe_dict(stripe_dict.base_host_ptr(), stripe_dict.base_device_ptr());
@@ -446,42 +443,68 @@ void writer::impl::build_dictionaries(orc_table_view& orc_table,
       sd.column_id       = orc_table.string_column_indices[dict_idx];
       sd.start_chunk     = stripe.first;
       sd.num_chunks      = stripe.size;
+      sd.num_strings     = 0;
       sd.dict_char_count = 0;
-      sd.num_strings =
-        std::accumulate(stripe.cbegin(), stripe.cend(), 0, [&](auto dt_str_cnt, auto rg_idx) {
-          const auto& dt = dict[rg_idx][dict_idx];
-          return dt_str_cnt + dt.num_dict_strings;
+      sd.map_slots       = nullptr;
+      sd.map_size        = 0;
+      sd.leaf_column     = dict[0][dict_idx].leaf_column;
+      if (not enable_dictionary_) {
+        sd.dict_data = nullptr;
+        continue;
+      }
+
+      auto const num_strings =
+        std::accumulate(stripe.cbegin(), stripe.cend(), size_t{0}, [&](auto count, auto rg_idx) {
+          return count + dict[rg_idx][dict_idx].num_strings;
         });
-      sd.leaf_column = dict[0][dict_idx].leaf_column;
+      // cuCollections suggests using a hash map of size N * (1/0.7) = num_values * 1.43
+      auto& map_storage = hash_maps_storage.emplace_back(num_strings * 1.43 + 1, stream);
+      sd.map_slots      = map_storage.data();
+      sd.map_size       = map_storage.size();
     }
+  }
+  if (hash_maps_storage.empty()) {
+    stripe_dict.host_to_device(stream);
+    return;
+  }
 
-    if (enable_dictionary_) {
-      struct string_column_cost {
-        size_t direct     = 0;
-        size_t dictionary = 0;
-      };
-      auto const col_cost =
-        std::accumulate(stripe_bounds.front().cbegin(),
-                        stripe_bounds.back().cend(),
-                        string_column_cost{},
-                        [&](auto cost, auto rg_idx) -> string_column_cost {
-                          const auto& dt = dict[rg_idx][dict_idx];
-                          return {cost.direct + dt.string_char_count,
-                                  cost.dictionary + dt.dict_char_count + dt.num_dict_strings};
-                        });
-      // Disable dictionary if it does not reduce the output size
-      if (!dictionary_enabled[orc_table.string_column(dict_idx).index()] ||
-          col_cost.dictionary >= col_cost.direct) {
+  // Disables the dictionaries of the columns in which they do not reduce the output size, as
+  // estimated from the first rowgroup of each stripe or from all rowgroups
+  auto const disable_costly_dictionaries = [&](bool first_chunk_only) {
+    for (size_t dict_idx = 0; dict_idx < orc_table.num_string_columns(); ++dict_idx) {
+      size_t direct_cost     = 0;
+      size_t dictionary_cost = 0;
+      for (auto const& stripe : stripe_bounds) {
+        auto const num_chunks = first_chunk_only ? std::min(stripe.size, 1u) : stripe.size;
+        for (auto rg_idx = stripe.first; rg_idx < stripe.first + num_chunks; ++rg_idx) {
+          direct_cost += dict[rg_idx][dict_idx].string_char_count;
+        }
+        auto const& sd = stripe_dict[stripe.id][dict_idx];
+        dictionary_cost += sd.dict_char_count + sd.num_strings;
+      }
+      if (dictionary_cost >= direct_cost) {
         for (auto const& stripe : stripe_bounds) {
           stripe_dict[stripe.id][dict_idx].dict_data = nullptr;
         }
       }
     }
-  }
+    stripe_dict.host_to_device(stream);
+  };
 
   stripe_dict.host_to_device(stream);
-  gpu::BuildStripeDictionaries(stripe_dict, stripe_dict, dict, stream);
+  gpu::InitializeStripeHashMaps(stripe_dict, stream);
+
+  // A sample of each stripe skips the columns with too many distinct strings, before inserting
+  // the whole stripes
+  gpu::PopulateStripeHashMaps(stripe_dict, dict, rowgroup_stripes, true, stream);
   stripe_dict.device_to_host(stream, true);
+  disable_costly_dictionaries(true);
+
+  gpu::PopulateStripeHashMaps(stripe_dict, dict, rowgroup_stripes, false, stream);
+  stripe_dict.device_to_host(stream, true);
+  disable_costly_dictionaries(false);
+
+  gpu::BuildStripeDictionaries(stripe_dict, stripe_dict, dict, rowgroup_stripes, stream);
 }
 
 /**
@@ -1040,7 +1063,7 @@ encoded_data encode_columns(orc_table_view const& orc_table,
   }
   dictionaries.data.clear();
   dictionaries.index.clear();
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   return {std::move(encoded_data), std::move(chunk_streams)};
 }
@@ -1333,6 +1356,59 @@ writer::impl::encoded_footer_statistics writer::impl::finish_statistic_blobs(
   return {std::move(stripe_blobs), std::move(file_blobs)};
 }
 
+writer::impl::encoded_bloom_filters writer::impl::gather_bloom_filters(
+  orc_table_view const& orc_table, file_segmentation const& segmentation)
+{
+  encoded_bloom_filters bloom_filters;
+  bloom_filters.bitsets.resize(orc_table.num_columns());
+  std::vector<uint32_t> filter_columns;
+  for (auto const& column : orc_table.columns) {
+    if (column.has_bloom_filter()) { filter_columns.push_back(column.index()); }
+  }
+  auto const num_rowgroups = segmentation.num_rowgroups();
+  if (filter_columns.empty() or num_rowgroups == 0) { return bloom_filters; }
+
+  // Sized like the Java writer does, for a rowgroup of distinct values
+  auto const expected_entries = static_cast<double>(row_index_stride);
+  auto const ln2              = std::log(2.0);
+  auto const min_num_bits =
+    static_cast<uint32_t>(-expected_entries * std::log(bloom_filter_fpp_) / (ln2 * ln2));
+  auto const num_bits = min_num_bits + (64 - min_num_bits % 64);
+
+  bloom_filters.num_words = num_bits / 64;
+  bloom_filters.num_hash_functions =
+    std::max(1u, static_cast<uint32_t>(std::lround(num_bits / expected_entries * ln2)));
+
+  auto const num_chunks = filter_columns.size() * num_rowgroups;
+  rmm::device_uvector<uint64_t> bitsets(num_chunks * bloom_filters.num_words, stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(bitsets.data(), 0, bitsets.size() * sizeof(uint64_t), stream.value()));
+  hostdevice_vector<gpu::BloomFilterChunk> chunks(num_chunks, stream);
+  for (size_t i = 0; i < filter_columns.size(); ++i) {
+    auto const col_idx = filter_columns[i];
+    for (size_t rg = 0; rg < num_rowgroups; ++rg) {
+      auto& ck              = chunks[i * num_rowgroups + rg];
+      ck.leaf_column        = orc_table.d_columns.data() + col_idx;
+      ck.kind               = orc_table.column(col_idx).orc_kind();
+      ck.start_row          = segmentation.rowgroups[rg][col_idx].begin;
+      ck.num_rows           = segmentation.rowgroups[rg][col_idx].size();
+      ck.bitset             = bitsets.data() + (i * num_rowgroups + rg) * bloom_filters.num_words;
+      ck.num_bits           = num_bits;
+      ck.num_hash_functions = bloom_filters.num_hash_functions;
+    }
+  }
+  chunks.host_to_device(stream);
+  gpu::orc_encode_bloom_filters({chunks.device_ptr(), chunks.size()}, stream);
+
+  auto const h_bitsets    = cudf::detail::make_std_vector_sync(bitsets, stream);
+  auto const column_words = num_rowgroups * bloom_filters.num_words;
+  for (size_t i = 0; i < filter_columns.size(); ++i) {
+    bloom_filters.bitsets[filter_columns[i]].assign(h_bitsets.begin() + i * column_words,
+                                                    h_bitsets.begin() + (i + 1) * column_words);
+  }
+  return bloom_filters;
+}
+
 void writer::impl::write_index_stream(int32_t stripe_id,
                                       int32_t stream_id,
                                       host_span<orc_column_view const> columns,
@@ -1430,36 +1506,35 @@ void writer::impl::write_index_stream(int32_t stripe_id,
   stripe->indexLength += buffer_.size();
 }
 
-std::future<void> writer::impl::write_data_stream(gpu::StripeStream const& strm_desc,
-                                                  gpu::encoder_chunk_streams const& enc_stream,
-                                                  uint8_t const* compressed_data,
-                                                  uint8_t* stream_out,
-                                                  StripeInformation* stripe,
-                                                  orc_streams* streams)
+Stream writer::impl::write_bloom_filter_stream(int32_t stripe_id,
+                                               orc_column_view const& column,
+                                               file_segmentation const& segmentation,
+                                               encoded_bloom_filters const& bloom_filters,
+                                               StripeInformation* stripe,
+                                               ProtobufWriter* pbw)
 {
-  const auto length                                        = strm_desc.stream_size;
-  (*streams)[enc_stream.ids[strm_desc.stream_type]].length = length;
-  if (length == 0) {
-    return std::async(std::launch::deferred, [] {});
-  }
-
-  const auto* stream_in = (compression_kind_ == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
-                                                      : (compressed_data + strm_desc.bfr_offset);
+  auto const& bitsets = bloom_filters.bitsets[column.index()];
 
-  auto write_task = [&]() {
-    if (out_sink_->is_device_write_preferred(length)) {
-      return out_sink_->device_write_async(stream_in, length, stream);
-    } else {
-      CUDF_CUDA_TRY(
-        cudaMemcpyAsync(stream_out, stream_in, length, cudaMemcpyDeviceToHost, stream.value()));
-      stream.synchronize();
+  buffer_.resize((compression_kind_ != NONE) ? 3 : 0);
+  auto const& rowgroups_range = segmentation.stripes[stripe_id];
+  std::for_each(rowgroups_range.cbegin(), rowgroups_range.cend(), [&](auto rowgroup) {
+    pbw->put_bloom_filter(
+      bloom_filters.num_hash_functions,
+      {bitsets.data() + rowgroup * bloom_filters.num_words, bloom_filters.num_words});
+  });
+  // Unlike the row index, the filters of a stripe can exceed the compression block size
+  add_uncompressed_block_headers(buffer_);
+  out_sink_->host_write(buffer_.data(), buffer_.size());
+  stripe->indexLength += buffer_.size();
+  return Stream{BLOOM_FILTER_UTF8, column.id(), buffer_.size()};
+}
 
-      out_sink_->host_write(stream_out, length);
-      return std::async(std::launch::deferred, [] {});
-    }
-  }();
-  stripe->dataLength += length;
-  return write_task;
+uint8_t const* writer::impl::data_stream_device_ptr(gpu::StripeStream const& strm_desc,
+                                                    gpu::encoder_chunk_streams const& enc_stream,
+                                                    uint8_t const* compressed_data) const
+{
+  return (compression_kind_ == NONE) ? enc_stream.data_ptrs[strm_desc.stream_type]
+                                     : (compressed_data + strm_desc.bfr_offset);
 }
 
 void writer::impl::add_uncompressed_block_headers(std::vector<uint8_t>& v)
@@ -1494,6 +1569,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_kind_(to_orc_compression(options.get_compression())),
     compression_blocksize_(compression_block_size(compression_kind_)),
     stats_freq_(options.get_statistics_freq()),
+    bloom_filter_fpp_(options.get_bloom_filter_fpp()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
     out_sink_(std::move(sink))
@@ -1516,6 +1592,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     compression_kind_(to_orc_compression(options.get_compression())),
     compression_blocksize_(compression_block_size(compression_kind_)),
     stats_freq_(options.get_statistics_freq()),
+    bloom_filter_fpp_(options.get_bloom_filter_fpp()),
     single_write_mode(mode == SingleWriteMode::YES),
     kv_meta(options.get_key_value_metadata()),
     out_sink_(std::move(sink))
@@ -1918,18 +1995,8 @@ std::map<uint32_t, size_t> decimal_column_sizes(
 }
 
 string_dictionaries allocate_dictionaries(orc_table_view const& orc_table,
-                                          host_2dspan<rowgroup_rows const> rowgroup_bounds,
                                           rmm::cuda_stream_view stream)
 {
-  thrust::host_vector<bool> is_dict_enabled(orc_table.num_columns());
-  for (auto col_idx : orc_table.string_column_indices)
-    is_dict_enabled[col_idx] = std::all_of(
-      thrust::make_counting_iterator(0ul),
-      thrust::make_counting_iterator(rowgroup_bounds.size().first),
-      [&](auto rg_idx) {
-        return rowgroup_bounds[rg_idx][col_idx].size() < std::numeric_limits<uint16_t>::max();
-      });
-
   std::vector<rmm::device_uvector<uint32_t>> data;
   std::transform(orc_table.string_column_indices.begin(),
                  orc_table.string_column_indices.end(),
@@ -1946,22 +2013,14 @@ string_dictionaries allocate_dictionaries(orc_table_view const& orc_table,
                    return cudf::detail::make_zeroed_device_uvector_async<uint32_t>(
                      orc_table.columns[idx].size(), stream);
                  });
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   std::vector<device_span<uint32_t>> data_ptrs;
   std::transform(data.begin(), data.end(), std::back_inserter(data_ptrs), [](auto& uvec) {
     return device_span<uint32_t>{uvec};
   });
-  std::vector<device_span<uint32_t>> index_ptrs;
-  std::transform(index.begin(), index.end(), std::back_inserter(index_ptrs), [](auto& uvec) {
-    return device_span<uint32_t>{uvec};
-  });
-
-  return {std::move(data),
-          std::move(index),
-          cudf::detail::make_device_uvector_sync(data_ptrs, stream),
-          cudf::detail::make_device_uvector_sync(index_ptrs, stream),
-          std::move(is_dict_enabled)};
+  return {
+    std::move(data), std::move(index), cudf::detail::make_device_uvector_sync(data_ptrs, stream)};
 }
 
 struct string_length_functor {
@@ -2010,6 +2069,8 @@ auto to_nvcomp_compression_type(CompressionKind compression_kind)
 {
   if (compression_kind == SNAPPY) return nvcomp::compression_type::SNAPPY;
   if (compression_kind == ZLIB) return nvcomp::compression_type::DEFLATE;
+  if (compression_kind == ZSTD) return nvcomp::compression_type::ZSTD;
+  if (compression_kind == LZ4) return nvcomp::compression_type::LZ4;
   CUDF_FAIL("Unsupported compression type");
 }
 
@@ -2093,16 +2154,11 @@ void writer::impl::write(table_view const& table)
   auto rowgroup_bounds = calculate_rowgroup_bounds(orc_table, row_index_stride, stream);
 
   // Build per-column dictionary indices
-  auto dictionaries = allocate_dictionaries(orc_table, rowgroup_bounds, stream);
+  auto dictionaries = allocate_dictionaries(orc_table, stream);
   hostdevice_2dvector<gpu::DictionaryChunk> dict(
     rowgroup_bounds.size().first, orc_table.num_string_columns(), stream);
   if (not dict.is_empty()) {
-    init_dictionaries(orc_table,
-                      rowgroup_bounds,
-                      dictionaries.d_data_view,
-                      dictionaries.d_index_view,
-                      &dict,
-                      stream);
+    init_dictionaries(orc_table, rowgroup_bounds, dictionaries.d_data_view, &dict, stream);
   }
 
   // Decide stripe boundaries based on rowgroups and dict chunks
@@ -2113,12 +2169,7 @@ void writer::impl::write(table_view const& table)
   hostdevice_2dvector<gpu::StripeDictionary> stripe_dict(
     segmentation.num_stripes(), orc_table.num_string_columns(), stream);
   if (not stripe_dict.is_empty()) {
-    build_dictionaries(orc_table,
-                       segmentation.stripes,
-                       dict,
-                       dictionaries.index,
-                       dictionaries.dictionary_enabled,
-                       stripe_dict);
+    build_dictionaries(orc_table, segmentation.stripes, dict, dictionaries.index, stripe_dict);
   }
 
   auto dec_chunk_sizes = decimal_chunk_sizes(orc_table, segmentation, stream);
@@ -2142,37 +2193,17 @@ void writer::impl::write(table_view const& table)
     auto const max_compressed_block_size =
       get_compress_max_output_chunk_size(compression_kind_, compression_blocksize_);
 
-    auto stream_output = [&]() {
-      size_t max_stream_size = 0;
-      bool all_device_write  = true;
-
-      for (auto& ss : strm_descs.host_view().flat_view()) {
-        if (!out_sink_->is_device_write_preferred(ss.stream_size)) { all_device_write = false; }
-        size_t stream_size = ss.stream_size;
-        if (compression_kind_ != NONE) {
-          ss.first_block = num_compressed_blocks;
-          ss.bfr_offset  = compressed_bfr_size;
-
-          auto num_blocks = std::max<uint32_t>(
-            (stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
-          stream_size += num_blocks * block_header_size;
-          num_compressed_blocks += num_blocks;
-          compressed_bfr_size += compressed_block_size(max_compressed_block_size) * num_blocks;
-        }
-        max_stream_size = std::max(max_stream_size, stream_size);
-      }
+    for (auto& ss : strm_descs.host_view().flat_view()) {
+      if (compression_kind_ != NONE) {
+        ss.first_block = num_compressed_blocks;
+        ss.bfr_offset  = compressed_bfr_size;
 
-      if (all_device_write) {
-        return pinned_buffer<uint8_t>{nullptr, cudaFreeHost};
-      } else {
-        return pinned_buffer<uint8_t>{[](size_t size) {
-                                        uint8_t* ptr = nullptr;
-                                        CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                        return ptr;
-                                      }(max_stream_size),
-                                      cudaFreeHost};
+        auto num_blocks = std::max<uint32_t>(
+          (ss.stream_size + compression_blocksize_ - 1) / compression_blocksize_, 1);
+        num_compressed_blocks += num_blocks;
+        compressed_bfr_size += compressed_block_size(max_compressed_block_size) * num_blocks;
       }
-    }();
+    }
 
     // Compress the data streams
     rmm::device_buffer compressed_data(compressed_bfr_size, stream);
@@ -2180,6 +2211,16 @@ void writer::impl::write(table_view const& table)
     hostdevice_vector<device_span<uint8_t>> comp_out(num_compressed_blocks, stream);
     hostdevice_vector<decompress_status> comp_stats(num_compressed_blocks, stream);
     if (compression_kind_ != NONE) {
+      // The scratch space is kept across the write() calls of a chunked writer and only grows
+      auto const scratch_size =
+        (compression_kind_ == SNAPPY and not nvcomp_integration::is_stable_enabled())
+          ? 0
+          : nvcomp::batched_compress_temp_size(to_nvcomp_compression_type(compression_kind_),
+                                               num_compressed_blocks,
+                                               compression_blocksize_);
+      if (scratch_size > compression_scratch_.size()) {
+        compression_scratch_ = rmm::device_buffer(scratch_size, stream);
+      }
       strm_descs.host_to_device(stream);
       gpu::CompressOrcDataStreams(static_cast<uint8_t*>(compressed_data.data()),
                                   num_compressed_blocks,
@@ -2191,6 +2232,8 @@ void writer::impl::write(table_view const& table)
                                   comp_in,
                                   comp_out,
                                   comp_stats,
+                                  {static_cast<uint8_t*>(compression_scratch_.data()),
+                                   compression_scratch_.size()},
                                   stream);
       strm_descs.device_to_host(stream);
       comp_stats.device_to_host(stream, true);
@@ -2199,17 +2242,79 @@ void writer::impl::write(table_view const& table)
     ProtobufWriter pbw_(&buffer_);
 
     auto intermediate_stats = gather_statistic_blobs(stats_freq_, orc_table, segmentation);
+    auto const bloom_filters = gather_bloom_filters(orc_table, segmentation);
 
     if (intermediate_stats.stripe_stat_chunks.size() > 0) {
       persisted_stripe_statistics.persist(
         orc_table.num_rows(), single_write_mode, intermediate_stats, stream);
     }
 
+    // The data streams of a stripe are written back to back with a single write. They are
+    // gathered in device memory for the sinks that prefer device writes of the stripe's size, and
+    // staged in pinned memory otherwise. The copies of the next stripe run on a separate stream
+    // while the current stripe is written, with a single synchronization per stripe
+    std::vector<size_t> stripe_data_sizes(stripes.size());
+    std::vector<bool> is_device_write(stripes.size());
+    size_t max_staging_size = 0;
+    size_t max_gather_size  = 0;
+    for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
+      size_t size = 0;
+      for (auto const& strm_desc : strm_descs[stripe_id]) {
+        size += strm_desc.stream_size;
+      }
+      stripe_data_sizes[stripe_id] = size;
+      is_device_write[stripe_id]   = size != 0 and out_sink_->is_device_write_preferred(size);
+      if (is_device_write[stripe_id]) {
+        max_gather_size = std::max(max_gather_size, size);
+      } else {
+        max_staging_size = std::max(max_staging_size, size);
+      }
+    }
+    std::array<pinned_buffer<uint8_t>, 2> staging_buffers;
+    std::array<rmm::device_buffer, 2> gather_buffers;
+    for (size_t i = 0; i < staging_buffers.size(); ++i) {
+      staging_buffers[i] = make_pinned_buffer<uint8_t>(max_staging_size);
+      gather_buffers[i]  = rmm::device_buffer(max_gather_size, stream);
+    }
+    // The device writes of a gather buffer must complete before the buffer is reused
+    std::array<std::future<void>, 2> device_writes;
+    // The copy streams read the encoded and compressed data produced on `stream`
+    cudf::detail::synchronize_stream(stream);
+    auto copy_stream_pool   = rmm::cuda_stream_pool(staging_buffers.size());
+    auto const copy_streams = std::array<rmm::cuda_stream_view, 2>{
+      copy_stream_pool.get_stream(0), copy_stream_pool.get_stream(1)};
+    auto const stage_stripe = [&](size_t stripe_id) {
+      auto const buffer_id = stripe_id % 2;
+      if (is_device_write[stripe_id] and device_writes[buffer_id].valid()) {
+        device_writes[buffer_id].get();
+      }
+      auto buffer = is_device_write[stripe_id]
+                      ? static_cast<uint8_t*>(gather_buffers[buffer_id].data())
+                      : staging_buffers[buffer_id].get();
+      for (auto const& strm_desc : strm_descs[stripe_id]) {
+        if (strm_desc.stream_size == 0) { continue; }
+        auto const& enc_stream =
+          enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first];
+        CUDF_CUDA_TRY(cudaMemcpyAsync(
+          buffer,
+          data_stream_device_ptr(
+            strm_desc, enc_stream, static_cast<uint8_t const*>(compressed_data.data())),
+          strm_desc.stream_size,
+          is_device_write[stripe_id] ? cudaMemcpyDeviceToDevice : cudaMemcpyDeviceToHost,
+          copy_streams[buffer_id].value()));
+        buffer += strm_desc.stream_size;
+      }
+    };
+    if (not stripes.empty()) { stage_stripe(0); }
+
     // Write stripes
-    std::vector<std::future<void>> write_tasks;
     for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
       auto& stripe = stripes[stripe_id];
 
+      // The staging buffer of the next stripe was last read by the host writes of the previous
+      // stripe, which have completed; the device writes from its gather buffer are waited for
+      if (stripe_id + 1 < stripes.size()) { stage_stripe(stripe_id + 1); }
+
       stripe.offset = out_sink_->bytes_written();
 
       // Column (skippable) index streams appear at the start of the stripe
@@ -2226,21 +2331,36 @@ void writer::impl::write(table_view const& table)
                            &streams,
                            &pbw_);
       }
+      // Bloom filters are index streams as well, written after the row indexes
+      std::vector<Stream> bloom_filter_streams;
+      for (auto const& column : orc_table.columns) {
+        if (column.has_bloom_filter()) {
+          bloom_filter_streams.push_back(write_bloom_filter_stream(
+            stripe_id, column, segmentation, bloom_filters, &stripe, &pbw_));
+        }
+      }
 
       // Column data consisting one or more separate streams
       for (auto const& strm_desc : strm_descs[stripe_id]) {
-        write_tasks.push_back(write_data_stream(
-          strm_desc,
-          enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first],
-          static_cast<uint8_t const*>(compressed_data.data()),
-          stream_output.get(),
-          &stripe,
-          &streams));
+        auto const& enc_stream =
+          enc_data.streams[strm_desc.column_id][segmentation.stripes[stripe_id].first];
+        streams[enc_stream.ids[strm_desc.stream_type]].length = strm_desc.stream_size;
+      }
+      stripe.dataLength += stripe_data_sizes[stripe_id];
+      cudf::detail::synchronize_stream(copy_streams[stripe_id % 2]);
+      if (is_device_write[stripe_id]) {
+        device_writes[stripe_id % 2] = out_sink_->device_write_async(
+          gather_buffers[stripe_id % 2].data(), stripe_data_sizes[stripe_id], stream);
+      } else if (stripe_data_sizes[stripe_id] != 0) {
+        out_sink_->host_write(staging_buffers[stripe_id % 2].get(), stripe_data_sizes[stripe_id]);
       }
 
       // Write stripefooter consisting of stream information
       StripeFooter sf;
       sf.streams = streams;
+      sf.streams.insert(sf.streams.begin() + num_index_streams,
+                        bloom_filter_streams.cbegin(),
+                        bloom_filter_streams.cend());
       sf.columns.resize(orc_table.num_columns() + 1);
       sf.columns[0].kind = DIRECT;
       for (size_t i = 1; i < sf.columns.size(); ++i) {
@@ -2262,8 +2382,8 @@ void writer::impl::write(table_view const& table)
       }
       out_sink_->host_write(buffer_.data(), buffer_.size());
     }
-    for (auto const& task : write_tasks) {
-      task.wait();
+    for (auto& task : device_writes) {
+      if (task.valid()) { task.get(); }
     }
   }
   if (ff.headerLength == 0) {
@@ -30,6 +30,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
 #include <thrust/host_vector.h>
@@ -163,9 +164,6 @@ struct string_dictionaries {
   std::vector<rmm::device_uvector<uint32_t>> data;
   std::vector<rmm::device_uvector<uint32_t>> index;
   rmm::device_uvector<device_span<uint32_t>> d_data_view;
-  rmm::device_uvector<device_span<uint32_t>> d_index_view;
-  // Dictionaries are currently disabled for columns with a rowgroup larger than 2^15
-  thrust::host_vector<bool> dictionary_enabled;
 };
 
 /**
@@ -244,14 +242,12 @@ class writer::impl {
    * @param stripe_bounds List of stripe boundaries
    * @param dict List of dictionary chunks [rowgroup][column]
    * @param dict_index List of dictionary indices
-   * @param dictionary_enabled Whether dictionary encoding is enabled for a given column
    * @param stripe_dict List of stripe dictionaries
    */
   void build_dictionaries(orc_table_view& orc_table,
                           host_span<stripe_rowgroups const> stripe_bounds,
                           hostdevice_2dvector<gpu::DictionaryChunk> const& dict,
                           host_span<rmm::device_uvector<uint32_t>> dict_index,
-                          host_span<bool const> dictionary_enabled,
                           hostdevice_2dvector<gpu::StripeDictionary>& stripe_dict);
 
   /**
@@ -369,6 +365,25 @@ class writer::impl {
   encoded_footer_statistics finish_statistic_blobs(
     int num_stripes, writer::impl::persisted_statistics& incoming_stats);
 
+  /**
+   * @brief Bloom filters of the rowgroups of the columns that have them enabled
+   */
+  struct encoded_bloom_filters {
+    uint32_t num_hash_functions = 0;
+    size_t num_words            = 0;  // number of 64-bit words in each filter
+    std::vector<std::vector<uint64_t>> bitsets;  // [column][rowgroup * num_words + word]
+  };
+
+  /**
+   * @brief Computes the Bloom filters of the rowgroups of the columns that have them enabled.
+   *
+   * @param orc_table Table information to be written
+   * @param segmentation stripe and rowgroup ranges
+   * @return The Bloom filters; no bitset for columns without filters
+   */
+  encoded_bloom_filters gather_bloom_filters(orc_table_view const& orc_table,
+                                             file_segmentation const& segmentation);
+
   /**
    * @brief Writes the specified column's row index stream.
    *
@@ -397,22 +412,34 @@ class writer::impl {
                           ProtobufWriter* pbw);
 
   /**
-   * @brief Write the specified column's data streams
+   * @brief Writes the specified column's Bloom filter stream.
+   *
+   * @param[in] stripe_id Stripe's identifier
+   * @param[in] column Column of the stream
+   * @param[in] segmentation stripe and rowgroup ranges
+   * @param[in] bloom_filters Bloom filters of the rowgroups
+   * @param[in,out] stripe Stream's parent stripe
+   * @param[in,out] pbw Protobuf writer
+   * @return The written stream
+   */
+  Stream write_bloom_filter_stream(int32_t stripe_id,
+                                   orc_column_view const& column,
+                                   file_segmentation const& segmentation,
+                                   encoded_bloom_filters const& bloom_filters,
+                                   StripeInformation* stripe,
+                                   ProtobufWriter* pbw);
+
+  /**
+   * @brief Returns the device pointer to the specified data stream's final (compressed) data
    *
    * @param[in] strm_desc Stream's descriptor
    * @param[in] enc_stream Chunk's streams
    * @param[in] compressed_data Compressed stream data
-   * @param[in,out] stream_out Temporary host output buffer
-   * @param[in,out] stripe Stream's parent stripe
-   * @param[in,out] streams List of all streams
-   * @return An std::future that should be synchronized to ensure the writing is complete
+   * @return Device pointer to the data to be written for the stream
    */
-  std::future<void> write_data_stream(gpu::StripeStream const& strm_desc,
-                                      gpu::encoder_chunk_streams const& enc_stream,
-                                      uint8_t const* compressed_data,
-                                      uint8_t* stream_out,
-                                      StripeInformation* stripe,
-                                      orc_streams* streams);
+  [[nodiscard]] uint8_t const* data_stream_device_ptr(gpu::StripeStream const& strm_desc,
+                                                      gpu::encoder_chunk_streams const& enc_stream,
+                                                      uint8_t const* compressed_data) const;
 
   /**
    * @brief Insert 3-byte uncompressed block headers in a byte vector
@@ -430,9 +457,12 @@ class writer::impl {
   size_type row_index_stride;
   CompressionKind compression_kind_;
   size_t compression_blocksize_;
+  // Scratch space for the nvCOMP compression, reused across writes
+  rmm::device_buffer compression_scratch_;
 
   bool enable_dictionary_     = true;
   statistics_freq stats_freq_ = ORC_STATISTICS_ROW_GROUP;
+  double bloom_filter_fpp_    = default_bloom_filter_fpp;
 
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
   cudf::io::orc::FileFooter ff;
@@ -98,9 +98,54 @@ struct map_find_fn {
   }
 };
 
+/**
+ * @brief Size of a value in the dictionary page, as encoded with PLAIN
+ */
+__device__ size_type dict_entry_size(parquet_column_device_view const& col,
+                                     column_device_view const& data_col,
+                                     size_type val_idx)
+{
+  switch (col.physical_type) {
+    case Type::INT32: return 4;
+    case Type::INT64: return 8;
+    case Type::INT96: return 12;
+    case Type::FLOAT: return 4;
+    case Type::DOUBLE: return 8;
+    case Type::BYTE_ARRAY: {
+      auto const col_type = data_col.type().id();
+      if (col_type == type_id::STRING) {
+        // Strings are stored as 4 byte length + string bytes
+        return 4 + data_col.element<string_view>(val_idx).size_bytes();
+      } else if (col_type == type_id::LIST) {
+        // Binary is stored as 4 byte length + bytes
+        return 4 + get_element<statistics::byte_array_view>(data_col, val_idx).size_bytes();
+      }
+      CUDF_UNREACHABLE(
+        "Byte array only supports string and list<byte> column types for dictionary "
+        "encoding!");
+    }
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      if (data_col.type().id() == type_id::DECIMAL128) { return sizeof(__int128_t); }
+      CUDF_UNREACHABLE(
+        "Fixed length byte array only supports decimal 128 column types for dictionary "
+        "encoding!");
+    default: CUDF_UNREACHABLE("Unsupported type for dictionary encoding");
+  }
+}
+
+/**
+ * @brief Index of the first leaf value past the fragments encoded with the dictionary
+ */
+__device__ size_type dict_end_value_idx(EncColumnChunk const& chunk)
+{
+  auto const& last_frag = chunk.fragments[chunk.num_dict_fragments - 1];
+  return static_cast<size_type>(last_frag.start_value_idx + last_frag.num_leaf_values);
+}
+
 template <int block_size>
 __global__ void __launch_bounds__(block_size)
-  populate_chunk_hash_maps_kernel(cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+  populate_chunk_hash_maps_kernel(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                                  bool first_fragment_only)
 {
   auto col_idx = blockIdx.y;
   auto block_x = blockIdx.x;
@@ -110,6 +155,8 @@ __global__ void __launch_bounds__(block_size)
   auto col     = chunk->col_desc;
 
   if (not chunk->use_dictionary) { return; }
+  // The first fragment of each chunk is inserted on its own, as a sample of the chunk
+  if ((frag.start_row == chunk->start_row) != first_fragment_only) { return; }
 
   using block_reduce = cub::BlockReduce<size_type, block_size>;
   __shared__ typename block_reduce::TempStorage reduce_storage;
@@ -130,7 +177,6 @@ __global__ void __launch_bounds__(block_size)
                                   cuco::sentinel::empty_key{KEY_SENTINEL},
                                   cuco::sentinel::empty_value{VALUE_SENTINEL});
 
-  __shared__ size_type total_num_dict_entries;
   size_type val_idx = s_start_value_idx + t;
   while (val_idx - block_size < end_value_idx) {
     auto const is_valid =
@@ -142,54 +188,106 @@ __global__ void __launch_bounds__(block_size)
     if (is_valid) {
       is_unique =
         type_dispatcher(data_col.type(), map_insert_fn{hash_map_mutable}, data_col, val_idx);
-      uniq_elem_size = [&]() -> size_type {
-        if (not is_unique) { return 0; }
-        switch (col->physical_type) {
-          case Type::INT32: return 4;
-          case Type::INT64: return 8;
-          case Type::INT96: return 12;
-          case Type::FLOAT: return 4;
-          case Type::DOUBLE: return 8;
-          case Type::BYTE_ARRAY: {
-            auto const col_type = data_col.type().id();
-            if (col_type == type_id::STRING) {
-              // Strings are stored as 4 byte length + string bytes
-              return 4 + data_col.element<string_view>(val_idx).size_bytes();
-            } else if (col_type == type_id::LIST) {
-              // Binary is stored as 4 byte length + bytes
-              return 4 + get_element<statistics::byte_array_view>(data_col, val_idx).size_bytes();
-            }
-            CUDF_UNREACHABLE(
-              "Byte array only supports string and list<byte> column types for dictionary "
-              "encoding!");
-          }
-          case Type::FIXED_LEN_BYTE_ARRAY:
-            if (data_col.type().id() == type_id::DECIMAL128) { return sizeof(__int128_t); }
-            CUDF_UNREACHABLE(
-              "Fixed length byte array only supports decimal 128 column types for dictionary "
-              "encoding!");
-          default: CUDF_UNREACHABLE("Unsupported type for dictionary encoding");
-        }
-      }();
+      uniq_elem_size = is_unique ? dict_entry_size(*col, data_col, val_idx) : 0;
     }
 
-    auto num_unique = block_reduce(reduce_storage).Sum(is_unique);
-    __syncthreads();
-    auto uniq_data_size = block_reduce(reduce_storage).Sum(uniq_elem_size);
-    if (t == 0) {
-      total_num_dict_entries = atomicAdd(&chunk->num_dict_entries, num_unique);
-      total_num_dict_entries += num_unique;
-      atomicAdd(&chunk->uniq_data_size, uniq_data_size);
+    // The sizes are only needed for the sample, the per-fragment sizes of the whole chunk are
+    // counted by count_dictionary_entries
+    if (first_fragment_only) {
+      auto num_unique = block_reduce(reduce_storage).Sum(is_unique);
+      __syncthreads();
+      auto uniq_data_size = block_reduce(reduce_storage).Sum(uniq_elem_size);
+      if (t == 0) {
+        atomicAdd(&chunk->num_dict_entries, num_unique);
+        atomicAdd(&chunk->uniq_data_size, uniq_data_size);
+      }
+      __syncthreads();
     }
-    __syncthreads();
-
-    // Check if the num unique values in chunk has already exceeded max dict size and early exit
-    if (total_num_dict_entries > MAX_DICT_SIZE) { return; }
 
     val_idx += block_size;
   }  // while
 }
 
+/**
+ * @brief Lowers the mapped value of each entry of the hash maps to the first index at which the
+ * entry occurs in the chunk.
+ */
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  find_first_occurrences_kernel(cudf::detail::device_2dspan<gpu::PageFragment const> frags)
+{
+  auto frag  = frags[blockIdx.y][blockIdx.x];
+  auto chunk = frag.chunk;
+  auto col   = chunk->col_desc;
+
+  if (not chunk->use_dictionary) { return; }
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto map = map_type::device_view(chunk->dict_map_slots,
+                                   chunk->dict_map_size,
+                                   cuco::sentinel::empty_key{KEY_SENTINEL},
+                                   cuco::sentinel::empty_value{VALUE_SENTINEL});
+
+  size_type const start_value_idx = frag.start_value_idx;
+  size_type const end_value_idx   = start_value_idx + frag.num_leaf_values;
+  for (auto val_idx = start_value_idx + static_cast<size_type>(threadIdx.x);
+       val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+    auto found_slot = type_dispatcher(data_col.type(), map_find_fn{map}, data_col, val_idx);
+    cudf_assert(found_slot != map.end() && "Unable to find value in map");
+    if (found_slot != map.end()) {
+      atomicMin(reinterpret_cast<map_type::mapped_type*>(&found_slot->second), val_idx);
+    }
+  }
+}
+
+template <int block_size>
+__global__ void __launch_bounds__(block_size)
+  count_dictionary_entries_kernel(cudf::detail::device_2dspan<gpu::PageFragment> frags)
+{
+  auto& frag = frags[blockIdx.y][blockIdx.x];
+  auto chunk = frag.chunk;
+  auto col   = chunk->col_desc;
+  auto t     = threadIdx.x;
+
+  if (not chunk->use_dictionary) { return; }
+
+  using block_reduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  auto map = map_type::device_view(chunk->dict_map_slots,
+                                   chunk->dict_map_size,
+                                   cuco::sentinel::empty_key{KEY_SENTINEL},
+                                   cuco::sentinel::empty_value{VALUE_SENTINEL});
+
+  size_type num_entries           = 0;
+  size_type entries_size          = 0;
+  size_type const start_value_idx = frag.start_value_idx;
+  size_type const end_value_idx   = start_value_idx + frag.num_leaf_values;
+  for (auto val_idx = start_value_idx + static_cast<size_type>(t); val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (val_idx >= data_col.size() or not data_col.is_valid(val_idx)) { continue; }
+    auto found_slot = type_dispatcher(data_col.type(), map_find_fn{map}, data_col, val_idx);
+    if (found_slot != map.end() and
+        *reinterpret_cast<map_type::mapped_type*>(&found_slot->second) == val_idx) {
+      num_entries++;
+      entries_size += dict_entry_size(*col, data_col, val_idx);
+    }
+  }
+
+  num_entries = block_reduce(reduce_storage).Sum(num_entries);
+  __syncthreads();
+  entries_size = block_reduce(reduce_storage).Sum(entries_size);
+  if (t == 0) {
+    frag.num_dict_vals  = num_entries;
+    frag.dict_data_size = entries_size;
+  }
+}
+
 template <int block_size>
 __global__ void __launch_bounds__(block_size)
   collect_map_entries_kernel(device_span<EncColumnChunk> chunks)
@@ -203,6 +301,8 @@ __global__ void __launch_bounds__(block_size)
                                    cuco::sentinel::empty_key{KEY_SENTINEL},
                                    cuco::sentinel::empty_value{VALUE_SENTINEL});
 
+  auto const dict_end = dict_end_value_idx(chunk);
+
   __shared__ cuda::atomic<size_type, cuda::thread_scope_block> counter;
   using cuda::std::memory_order_relaxed;
   if (t == 0) { new (&counter) cuda::atomic<size_type, cuda::thread_scope_block>{0}; }
@@ -211,7 +311,9 @@ __global__ void __launch_bounds__(block_size)
     if (t + i < chunk.dict_map_size) {
       auto* slot = reinterpret_cast<map_type::value_type*>(map.begin_slot() + t + i);
       auto key   = slot->first;
-      if (key != KEY_SENTINEL) {
+      // The mapped value holds the first occurrence of the entry in the chunk
+      if (key != KEY_SENTINEL and
+          *reinterpret_cast<map_type::mapped_type*>(&slot->second) < dict_end) {
         auto loc = counter.fetch_add(1, memory_order_relaxed);
         cudf_assert(loc < MAX_DICT_SIZE && "Number of filled slots exceeds max dict size");
         chunk.dict_data[loc] = key;
@@ -245,6 +347,9 @@ __global__ void __launch_bounds__(block_size)
   auto const s_ck_start_val_idx = row_to_value_idx(chunk->start_row, *col);
   auto const end_value_idx      = row_to_value_idx(end_row, *col);
 
+  // The pages of the fragments past the dictionary are encoded as PLAIN
+  if (s_start_value_idx >= dict_end_value_idx(*chunk)) { return; }
+
   column_device_view const& data_col = *col->leaf_column;
 
   auto map = map_type::device_view(chunk->dict_map_slots,
@@ -278,11 +383,29 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
     <<<chunks.size(), block_size, 0, stream.value()>>>(chunks);
 }
 
+void sample_chunk_hash_maps(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                            rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  populate_chunk_hash_maps_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags, true);
+}
+
 void populate_chunk_hash_maps(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
                               rmm::cuda_stream_view stream)
 {
   dim3 const dim_grid(frags.size().second, frags.size().first);
   populate_chunk_hash_maps_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags, false);
+}
+
+void count_dictionary_entries(cudf::detail::device_2dspan<gpu::PageFragment> frags,
+                              rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  find_first_occurrences_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+  count_dictionary_entries_kernel<DEFAULT_BLOCK_SIZE>
     <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
 }
 
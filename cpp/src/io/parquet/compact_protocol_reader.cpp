@@ -245,7 +245,8 @@ bool CompactProtocolReader::read(ColumnChunkMetaData* c)
                             ParquetFieldInt64(9, c->data_page_offset),
                             ParquetFieldInt64(10, c->index_page_offset),
                             ParquetFieldInt64(11, c->dictionary_page_offset),
-                            ParquetFieldStructBlob(12, c->statistics_blob));
+                            ParquetFieldStructBlob(12, c->statistics_blob),
+                            ParquetFieldInt64(14, c->bloom_filter_offset));
   return function_builder(this, op);
 }
 
@@ -295,6 +296,33 @@ bool CompactProtocolReader::read(OffsetIndex* o)
   return function_builder(this, op);
 }
 
+bool CompactProtocolReader::read(BloomFilterAlgorithm* a)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, a->isset.BLOCK, a->BLOCK));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHash* h)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, h->isset.XXHASH, h->XXHASH));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterCompression* c)
+{
+  auto op = std::make_tuple(ParquetFieldUnion(1, c->isset.UNCOMPRESSED, c->UNCOMPRESSED));
+  return function_builder(this, op);
+}
+
+bool CompactProtocolReader::read(BloomFilterHeader* b)
+{
+  auto op = std::make_tuple(ParquetFieldInt32(1, b->num_bytes),
+                            ParquetFieldStruct(2, b->algorithm),
+                            ParquetFieldStruct(3, b->hash),
+                            ParquetFieldStruct(4, b->compression));
+  return function_builder(this, op);
+}
+
 bool CompactProtocolReader::read(ColumnIndex* c)
 {
   auto op = std::make_tuple(ParquetFieldBoolList(1, c->null_pages),
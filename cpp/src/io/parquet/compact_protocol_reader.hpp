@@ -117,6 +117,10 @@ class CompactProtocolReader {
   bool read(KeyValue* k);
   bool read(PageLocation* p);
   bool read(OffsetIndex* o);
+  bool read(BloomFilterAlgorithm* a);
+  bool read(BloomFilterHash* h);
+  bool read(BloomFilterCompression* c);
+  bool read(BloomFilterHeader* b);
   bool read(ColumnIndex* c);
   bool read(Statistics* s);
 
@@ -202,6 +202,7 @@ size_t CompactProtocolWriter::write(const ColumnChunkMetaData& s)
   if (s.index_page_offset != 0) { c.field_int(10, s.index_page_offset); }
   if (s.dictionary_page_offset != 0) { c.field_int(11, s.dictionary_page_offset); }
   if (s.statistics_blob.size() != 0) { c.field_struct_blob(12, s.statistics_blob); }
+  if (s.bloom_filter_offset != 0) { c.field_int(14, s.bloom_filter_offset); }
   return c.value();
 }
 
@@ -221,6 +222,37 @@ size_t CompactProtocolWriter::write(const OffsetIndex& s)
   return c.value();
 }
 
+size_t CompactProtocolWriter::write(const BloomFilterAlgorithm& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct(1, s.BLOCK);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHash& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct(1, s.XXHASH);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterCompression& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_struct(1, s.UNCOMPRESSED);
+  return c.value();
+}
+
+size_t CompactProtocolWriter::write(const BloomFilterHeader& s)
+{
+  CompactProtocolFieldWriter c(*this);
+  c.field_int(1, s.num_bytes);
+  c.field_struct(2, s.algorithm);
+  c.field_struct(3, s.hash);
+  c.field_struct(4, s.compression);
+  return c.value();
+}
+
 void CompactProtocolFieldWriter::put_byte(uint8_t v) { writer.m_buf.push_back(v); }
 
 void CompactProtocolFieldWriter::put_byte(const uint8_t* raw, uint32_t len)
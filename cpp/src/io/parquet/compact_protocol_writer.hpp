@@ -52,6 +52,10 @@ class CompactProtocolWriter {
   size_t write(const ColumnChunkMetaData&);
   size_t write(const PageLocation&);
   size_t write(const OffsetIndex&);
+  size_t write(const BloomFilterAlgorithm&);
+  size_t write(const BloomFilterHash&);
+  size_t write(const BloomFilterCompression&);
+  size_t write(const BloomFilterHeader&);
 
  protected:
   std::vector<uint8_t>& m_buf;
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "host_read_batch.hpp"
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+std::vector<host_read_batch> make_host_read_batches(
+  std::vector<host_read_batch::read_info> const& reads, size_t max_batch_size)
+{
+  std::vector<host_read_batch> batches;
+  for (size_t r = 0; r < reads.size();) {
+    auto const covers_no_chunk = reads[r].first_chunk == reads[r].last_chunk;
+    auto const group_end       = (covers_no_chunk && r + 1 < reads.size()) ? r + 2 : r + 1;
+    size_t group_size          = 0;
+    for (auto g = r; g < group_end; ++g) {
+      group_size += reads[g].size;
+    }
+    if (batches.empty() || batches.back().size + group_size > max_batch_size) {
+      batches.emplace_back();
+    }
+    for (; r < group_end; ++r) {
+      batches.back().reads.push_back(reads[r]);
+    }
+    batches.back().size += group_size;
+  }
+  return batches;
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
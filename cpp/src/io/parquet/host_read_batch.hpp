@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+/**
+ * @brief Host reads of column chunk data that are transferred to the device together.
+ */
+struct host_read_batch {
+  struct read_info {
+    size_type source;    // index of the source to read from
+    size_t offset;       // offset of the data in the source
+    size_t size;         // number of bytes to read
+    size_t first_chunk;  // first column chunk covered by the read
+    size_t last_chunk;   // index after the last column chunk covered by the read
+  };
+  std::vector<read_info> reads;
+  size_t size = 0;
+};
+
+/**
+ * @brief Groups host reads into batches of at most `max_batch_size` bytes, in order.
+ *
+ * Reads from any source share a batch, so that the data of many small files is copied to the
+ * device with a single allocation and transfer. A read covering no chunk, i.e. the dictionary page
+ * of a chunk whose leading data pages are skipped, stays in the batch of the read following it. A
+ * read larger than `max_batch_size` gets a batch of its own.
+ *
+ * @param reads Host reads, in the order their data is placed in the batches
+ * @param max_batch_size Largest size of a batch holding several reads, in bytes
+ *
+ * @return The batches
+ */
+std::vector<host_read_batch> make_host_read_batches(
+  std::vector<host_read_batch::read_info> const& reads, size_t max_batch_size);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -19,11 +19,15 @@
 #include <io/utilities/column_buffer.hpp>
 
 #include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/bit.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <cub/cub.cuh>
+
 #include <thrust/functional.h>
 #include <thrust/iterator/iterator_categories.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -56,6 +60,7 @@ struct page_state_s {
   const uint8_t* lvl_end;
   const uint8_t* dict_base;  // ptr to dictionary page data
   int32_t dict_size;         // size of dictionary data
+  int32_t first_row;         // First row in page to decode
   int32_t num_rows;          // Rows in page to decode
   int32_t num_input_values;  // total # of input/level values in the page
   int32_t dtype_len;         // Output data type length
@@ -233,6 +238,10 @@ __device__ uint32_t InitLevelSection(page_state_s* s,
 /**
  * @brief Decode values out of a definition or repetition stream
  *
+ * Each run is expanded up to the target in a single step, every lane writing every 32nd value, so
+ * long runs do not cost one iteration per 32 values. At least 32 values are decoded per step, so
+ * the target may be exceeded by up to 31 values.
+ *
  * @param[in,out] s Page state input/output
  * @param[in] t target_count Target count of stream values on output
  * @param[in] t Warp0 thread ID (0..31)
@@ -277,24 +286,26 @@ __device__ void gpuDecodeStream(
     }
     if (s->error) { break; }
 
-    batch_len = min(num_input_values - value_count, 32);
+    // literal runs are consumed in whole groups of 8 values
+    batch_len = min(num_input_values - value_count, max(32, (target_count - value_count + 7) & ~7));
     if (level_run & 1) {
       // Literal run
       int batch_len8;
       batch_len  = min(batch_len, (level_run >> 1) * 8);
       batch_len8 = (batch_len + 7) >> 3;
-      if (t < batch_len) {
-        int bitpos         = t * level_bits;
+      for (int i = t; i < batch_len; i += 32) {
+        int bitpos         = i * level_bits;
         const uint8_t* cur = cur_def + (bitpos >> 3);
+        int32_t val        = 0;
         bitpos &= 7;
-        if (cur < end) level_val = cur[0];
+        if (cur < end) val = cur[0];
         cur++;
         if (level_bits > 8 - bitpos && cur < end) {
-          level_val |= cur[0] << 8;
+          val |= cur[0] << 8;
           cur++;
-          if (level_bits > 16 - bitpos && cur < end) level_val |= cur[0] << 16;
+          if (level_bits > 16 - bitpos && cur < end) val |= cur[0] << 16;
         }
-        level_val = (level_val >> bitpos) & ((1 << level_bits) - 1);
+        output[rolling_index(value_count + i)] = (val >> bitpos) & ((1 << level_bits) - 1);
       }
       level_run -= batch_len8 * 2;
       cur_def += batch_len8 * level_bits;
@@ -302,10 +313,9 @@ __device__ void gpuDecodeStream(
       // Repeated value
       batch_len = min(batch_len, level_run >> 1);
       level_run -= batch_len * 2;
-    }
-    if (t < batch_len) {
-      int idx                                  = value_count + t;
-      output[idx & (non_zero_buffer_size - 1)] = level_val;
+      for (int i = t; i < batch_len; i += 32) {
+        output[rolling_index(value_count + i)] = level_val;
+      }
     }
     batch_coded_count += batch_len;
     value_count += batch_len;
@@ -862,11 +872,13 @@ static __device__ void gpuOutputGeneric(volatile page_state_s* s,
  * @param[in, out] s The local page state to be filled in
  * @param[in] p The global page to be copied from
  * @param[in] chunks The global list of chunks
+ * @param[in] min_row Row index to start reading at
  * @param[in] num_rows Maximum number of rows to process
  */
 static __device__ bool setupLocalPageInfo(page_state_s* const s,
                                           PageInfo const* p,
                                           device_span<ColumnChunkDesc const> chunks,
+                                          size_t min_row,
                                           size_t num_rows)
 {
   int const t = threadIdx.x;
@@ -958,10 +970,17 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
         s->dtype_len = 8;  // Convert to 64-bit timestamp
       }
 
+      // first row within the page to output
+      if (page_start_row >= min_row) {
+        s->first_row = 0;
+      } else {
+        s->first_row = (int32_t)min(min_row - page_start_row, (size_t)s->page.num_rows);
+      }
       // # of rows within the page to output
-      s->num_rows = s->page.num_rows;
-      if (page_start_row + s->num_rows > num_rows) {
-        s->num_rows = (int32_t)max((int64_t)(num_rows - page_start_row), INT64_C(0));
+      s->num_rows = s->page.num_rows - s->first_row;
+      if (page_start_row + s->first_row + s->num_rows > min_row + num_rows) {
+        s->num_rows = (int32_t)max(
+          (int64_t)(min_row + num_rows - (page_start_row + s->first_row)), INT64_C(0));
       }
 
       // during the decoding step we need to offset the global output buffers
@@ -969,13 +988,19 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       // is responsible for.
       // - for flat schemas, we can do this directly by using row counts
       // - for nested schemas, these offsets are computed during the preprocess step
+      // schemas without lists start reading at the first value of the page, so the values of the
+      // rows before first_row are given negative output positions and dropped
       if (s->col.column_data_base != nullptr) {
         int const max_depth = s->col.max_nesting_depth;
+        bool const has_repetition = s->col.max_level[level_type::REPETITION] > 0;
         for (int idx = 0; idx < max_depth; idx++) {
           PageNestingInfo* pni = &s->page.nesting[idx];
 
+          // a page that ends before min_row outputs no rows
           size_t const output_offset =
-            s->col.max_level[level_type::REPETITION] == 0 ? page_start_row : pni->page_start_value;
+            has_repetition ? pni->page_start_value
+                           : max(page_start_row + s->first_row, min_row) - min_row;
+          if (!has_repetition) { pni->value_count = -s->first_row; }
 
           pni->data_out = static_cast<uint8_t*>(s->col.column_data_base[idx]);
           if (pni->data_out != nullptr) {
@@ -1024,6 +1049,17 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
           if ((s->col.data_type & 7) == BOOLEAN) { s->dict_run = s->dict_size * 2 + 1; }
           break;
         case Encoding::RLE: s->dict_run = 0; break;
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::BYTE_STREAM_SPLIT:
+          // Values are expanded to plain layout by gpuDecodeDeltaAndSplitValues before the page is
+          // decoded; until then the raw encoded section is exposed through data_start/data_end
+          s->dict_val = 0;
+          if (s->page.decoded_data) {
+            s->dict_size = s->page.num_input_values * s->dtype_len_in;
+          } else {
+            s->dict_size = static_cast<int32_t>(end - cur);
+          }
+          break;
         default:
           s->error = 1;  // Unsupported encoding
           break;
@@ -1032,6 +1068,10 @@ static __device__ bool setupLocalPageInfo(page_state_s* const s,
       s->lvl_end    = cur;
       s->data_start = cur;
       s->data_end   = end;
+      if (s->page.decoded_data) {
+        s->data_start = s->page.decoded_data;
+        s->data_end   = s->data_start + s->dict_size;
+      }
     } else {
       s->error = 1;
     }
@@ -1190,8 +1230,9 @@ static __device__ void gpuUpdateValidityOffsetsAndRowIndices(int32_t target_inpu
     int32_t const thread_row_index =
       input_row_count + ((__popc(warp_row_count_mask & ((1 << t) - 1)) + is_new_row) - 1);
     input_row_count += __popc(warp_row_count_mask);
-    // is this thread within read row bounds?
-    int const in_row_bounds = thread_row_index < s->num_rows;
+    // is this thread within read row bounds? the rows before first_row are still processed to
+    // skip their values
+    int const in_row_bounds = thread_row_index < s->first_row + s->num_rows;
 
     // compute warp and thread value counts
     uint32_t const warp_count_mask =
@@ -1265,10 +1306,10 @@ static __device__ void gpuUpdateValidityOffsetsAndRowIndices(int32_t target_inpu
       // first value, even if that is before first_row, because we cannot trivially jump to
       // the correct position to start reading. since we are about to write the validity vector here
       // we need to adjust our computed mask to take into account the write row bounds.
+      bool const is_flat = s->col.max_level[level_type::REPETITION] == 0;
       int const in_write_row_bounds =
-        max_depth == 1 ? thread_row_index < s->num_rows : in_row_bounds;
-      int const first_thread_in_write_range =
-        max_depth == 1 ? __ffs(ballot(in_write_row_bounds)) - 1 : 0;
+        is_flat ? thread_row_index >= s->first_row && in_row_bounds : in_row_bounds;
+      int const first_thread_in_write_range = is_flat ? __ffs(ballot(in_write_row_bounds)) - 1 : 0;
       // # of bits to of the validity mask to write out
       int const warp_valid_mask_bit_count =
         first_thread_in_write_range < 0 ? 0 : warp_value_count - first_thread_in_write_range;
@@ -1351,15 +1392,20 @@ __device__ void gpuDecodeLevels(page_state_s* s, int32_t target_leaf_count, int
  * Each page represents one piece of the overall output column. The total output (cudf)
  * column sizes are the sum of the values in each individual page.
  *
+ * Runs on the whole block, which processes `block_size` level values at a time: the row index of
+ * each value comes from a prefix sum over the block and the counts from block-wide reductions.
+ *
  * @param[in] s The local page info
  * @param[in] target_input_value_count The # of repetition/definition levels to process up to
  * @param[in] t Thread index
  */
 static __device__ void gpuUpdatePageSizes(page_state_s* s, int32_t target_input_value_count, int t)
 {
+  using block_scan = cub::BlockScan<int, block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+
   // max nesting depth of the column
   int const max_depth = s->col.max_nesting_depth;
-  // bool has_repetition = s->col.max_level[level_type::REPETITION] > 0 ? true : false;
   // how many input level values we've processed in the page so far
   int input_value_count = s->input_value_count;
   // how many leaf values we've processed in the page so far
@@ -1373,15 +1419,15 @@ static __device__ void gpuUpdatePageSizes(page_state_s* s, int32_t target_input_
       start_depth, end_depth, d, s, input_value_count, target_input_value_count, t);
 
     // count rows and leaf values
-    int const is_new_row               = start_depth == 0 ? 1 : 0;
-    uint32_t const warp_row_count_mask = ballot(is_new_row);
+    int const is_new_row = start_depth == 0 ? 1 : 0;
+    int rows_before, new_rows;
+    block_scan(scan_storage).ExclusiveSum(is_new_row, rows_before, new_rows);
     int const is_new_leaf = (d >= s->page.nesting[max_depth - 1].max_def_level) ? 1 : 0;
-    uint32_t const warp_leaf_count_mask = ballot(is_new_leaf);
+    int const new_leaves  = __syncthreads_count(is_new_leaf);
 
     // is this thread within row bounds?
-    int32_t const thread_row_index =
-      input_row_count + ((__popc(warp_row_count_mask & ((1 << t) - 1)) + is_new_row) - 1);
-    int const in_row_bounds = thread_row_index < s->num_rows;
+    int32_t const thread_row_index = input_row_count + rows_before + is_new_row - 1;
+    int const in_row_bounds        = thread_row_index < s->num_rows;
 
     // increment counts across all nesting depths
     for (int s_idx = 0; s_idx < max_depth; s_idx++) {
@@ -1389,13 +1435,13 @@ static __device__ void gpuUpdatePageSizes(page_state_s* s, int32_t target_input_
       int const in_nesting_bounds =
         (s_idx >= start_depth && s_idx <= end_depth && in_row_bounds) ? 1 : 0;
 
-      uint32_t const count_mask = ballot(in_nesting_bounds);
-      if (!t) { s->page.nesting[s_idx].size += __popc(count_mask); }
+      int const count = __syncthreads_count(in_nesting_bounds);
+      if (!t) { s->page.nesting[s_idx].size += count; }
     }
 
-    input_value_count += min(32, (target_input_value_count - input_value_count));
-    input_row_count += __popc(warp_row_count_mask);
-    input_leaf_count += __popc(warp_leaf_count_mask);
+    input_value_count += min(block_size, (target_input_value_count - input_value_count));
+    input_row_count += new_rows;
+    input_leaf_count += new_leaves;
   }
 
   // update final page value count
@@ -1424,7 +1470,7 @@ __global__ void __launch_bounds__(block_size)
   int const t           = threadIdx.x;
   PageInfo* const pp    = &pages[page_idx];
 
-  if (!setupLocalPageInfo(s, pp, chunks, INT_MAX)) { return; }
+  if (!setupLocalPageInfo(s, pp, chunks, 0, INT_MAX)) { return; }
 
   // zero sizes
   int d = 0;
@@ -1435,42 +1481,204 @@ __global__ void __launch_bounds__(block_size)
   if (!t) {
     s->input_row_count   = 0;
     s->input_value_count = 0;
+    s->input_leaf_count  = 0;
   }
   __syncthreads();
 
   bool const has_repetition = s->col.max_level[level_type::REPETITION] > 0;
 
-  // optimization : it might be useful to have a version of gpuDecodeStream that could go wider than
-  // 1 warp.  Currently it only uses 1 warp so that it can overlap work with the value decoding step
-  // when in the actual value decoding kernel. However, during this preprocess step we have no such
-  // limits -  we could go as wide as block_size
-  if (t < 32) {
-    constexpr int batch_size = 32;
-    int target_input_count   = batch_size;
-    while (!s->error && s->input_value_count < s->num_input_values) {
-      // decode repetition and definition levels. these will attempt to decode at
-      // least up to the target, but may decode a few more.
+  // the level streams are expanded by the first warp, block_size values at a time, and the levels
+  // are then processed by the whole block. With the up to 31 values decoded past the target, the
+  // unprocessed levels always fit in the rep/def circular buffers
+  int target_input_count = block_size;
+  while (!s->error && s->input_value_count < s->num_input_values) {
+    // decode repetition and definition levels. these will attempt to decode at
+    // least up to the target, but may decode a few more.
+    if (t < 32) {
       if (has_repetition) {
         gpuDecodeStream(s->rep, s, target_input_count, t, level_type::REPETITION);
       }
       gpuDecodeStream(s->def, s, target_input_count, t, level_type::DEFINITION);
-      __syncwarp();
+    }
+    __syncthreads();
 
-      // we may have decoded different amounts from each stream, so only process what we've been
-      int const actual_input_count = has_repetition ? min(s->lvl_count[level_type::REPETITION],
-                                                          s->lvl_count[level_type::DEFINITION])
-                                                    : s->lvl_count[level_type::DEFINITION];
+    // we may have decoded different amounts from each stream, so only process what we've been
+    int const actual_input_count = has_repetition ? min(s->lvl_count[level_type::REPETITION],
+                                                        s->lvl_count[level_type::DEFINITION])
+                                                  : s->lvl_count[level_type::DEFINITION];
 
-      // process what we got back
-      gpuUpdatePageSizes(s, actual_input_count, t);
-      target_input_count = actual_input_count + batch_size;
-      __syncwarp();
-    }
+    // process what we got back
+    gpuUpdatePageSizes(s, actual_input_count, t);
+    target_input_count = actual_input_count + block_size;
+    __syncthreads();
   }
   // update # rows in the actual page
   if (!t) { pp->num_rows = s->page.nesting[0].size; }
 }
 
+/**
+ * @brief Reads a ULEB128 varint, returning the bits read so far if the input is exhausted
+ */
+inline __device__ uint64_t get_vlq64(uint8_t const*& cur, uint8_t const* end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    uint8_t const c = *cur++;
+    v |= static_cast<uint64_t>(c & 0x7f) << shift;
+    if (c < 0x80) { break; }
+  }
+  return v;
+}
+
+/**
+ * @brief Decodes a zigzag-encoded signed value
+ */
+inline __device__ uint64_t zigzag_decode(uint64_t v) { return (v >> 1) ^ (~(v & 1) + 1); }
+
+/**
+ * @brief Extracts the `bit_width`-bit little-endian value starting at bit `bit_pos` of `data`
+ */
+inline __device__ uint64_t unpack_bits(uint8_t const* data,
+                                       uint8_t const* end,
+                                       uint64_t bit_pos,
+                                       uint32_t bit_width)
+{
+  if (bit_width == 0) { return 0; }
+  uint8_t const* p      = data + (bit_pos >> 3);
+  uint32_t const shift  = bit_pos & 7;
+  uint32_t const nbytes = (shift + bit_width + 7) >> 3;
+  uint64_t v            = 0;
+  for (uint32_t b = 0; b < min(nbytes, 8u); b++) {
+    if (p + b < end) { v |= static_cast<uint64_t>(p[b]) << (8 * b); }
+  }
+  v >>= shift;
+  if (nbytes > 8 && p + 8 < end) { v |= static_cast<uint64_t>(p[8]) << (64 - shift); }
+  return bit_width < 64 ? v & ((uint64_t{1} << bit_width) - 1) : v;
+}
+
+/**
+ * @brief Decodes a DELTA_BINARY_PACKED value stream into `width`-byte little-endian values
+ *
+ * Deltas are accumulated with 64-bit wraparound; for 32-bit columns the low 4 bytes of the running
+ * sum are the value, which matches the 32-bit wraparound arithmetic of the encoder.
+ *
+ * @param[in] cur Start of the encoded stream
+ * @param[in] end End of the encoded stream
+ * @param[out] out Output buffer with room for `max_values` values
+ * @param[in] max_values Maximum number of values to decode
+ * @param[in] width Size of each output value in bytes
+ * @param[in] t Thread index within the block
+ */
+static __device__ void decode_delta_binary_packed(
+  uint8_t const* cur, uint8_t const* end, uint8_t* out, uint32_t max_values, int width, int t)
+{
+  using block_scan             = cub::BlockScan<uint64_t, block_size>;
+  constexpr int max_miniblocks = 32;
+  __shared__ typename block_scan::TempStorage scan_storage;
+  __shared__ uint8_t const* block_data;
+  __shared__ uint32_t bit_widths[max_miniblocks];
+  __shared__ uint32_t values_per_block, num_miniblocks, num_values;
+  __shared__ uint64_t min_delta, last_value;
+
+  if (!t) {
+    values_per_block = static_cast<uint32_t>(get_vlq64(cur, end));
+    num_miniblocks   = static_cast<uint32_t>(get_vlq64(cur, end));
+    num_values       = static_cast<uint32_t>(min(get_vlq64(cur, end), uint64_t{max_values}));
+    last_value       = zigzag_decode(get_vlq64(cur, end));
+    block_data       = cur;
+    // the number of values per miniblock must be a multiple of 32
+    if (num_miniblocks == 0 || num_miniblocks > max_miniblocks ||
+        values_per_block % (num_miniblocks * 32) != 0) {
+      num_values = 0;
+    }
+    if (num_values > 0) { memcpy(out, &last_value, width); }
+  }
+  __syncthreads();
+
+  uint32_t const values_per_miniblock = num_values > 0 ? values_per_block / num_miniblocks : 0;
+  uint32_t num_decoded                = min(num_values, 1u);
+  while (num_decoded < num_values) {
+    if (!t) {
+      uint8_t const* p = block_data;
+      min_delta        = zigzag_decode(get_vlq64(p, end));
+      for (uint32_t m = 0; m < num_miniblocks; m++) {
+        bit_widths[m] = (p < end) ? min(static_cast<uint32_t>(*p++), 64u) : 0;
+      }
+      block_data = p;
+    }
+    __syncthreads();
+
+    uint8_t const* miniblock = block_data;
+    for (uint32_t m = 0; m < num_miniblocks && num_decoded < num_values; m++) {
+      uint32_t const bit_width = bit_widths[m];
+      for (uint32_t i = 0; i < values_per_miniblock && num_decoded < num_values; i += block_size) {
+        uint32_t const count =
+          min(min(values_per_miniblock - i, uint32_t{block_size}), num_values - num_decoded);
+        uint64_t delta = 0;
+        if (t < count) {
+          delta = min_delta + unpack_bits(miniblock, end, uint64_t{i + t} * bit_width, bit_width);
+        }
+        uint64_t sum;
+        block_scan(scan_storage).InclusiveSum(delta, sum);
+        uint64_t const value = last_value + sum;
+        if (t < count) { memcpy(out + static_cast<size_t>(num_decoded + t) * width, &value, width); }
+        __syncthreads();
+        if (t == count - 1) { last_value = value; }
+        num_decoded += count;
+        __syncthreads();
+      }
+      miniblock += (values_per_miniblock * bit_width) >> 3;
+    }
+    __syncthreads();
+    if (!t) { block_data = miniblock; }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Kernel for expanding DELTA_BINARY_PACKED and BYTE_STREAM_SPLIT data pages into plain
+ * layout ahead of gpuDecodePageData
+ *
+ * @param pages List of pages
+ * @param chunks List of column chunks
+ * @param page_values Per-page output buffer for the plain values, nullptr for pages using other
+ * encodings
+ * @param min_row Row index to start reading at
+ * @param num_rows Maximum number of rows to read
+ */
+__global__ void __launch_bounds__(block_size)
+  gpuDecodeDeltaAndSplitValues(PageInfo* pages,
+                               device_span<ColumnChunkDesc const> chunks,
+                               device_span<uint8_t* const> page_values,
+                               size_t min_row,
+                               size_t num_rows)
+{
+  __shared__ __align__(16) page_state_s state_g;
+
+  page_state_s* const s = &state_g;
+  int const page_idx    = blockIdx.x;
+  int const t           = threadIdx.x;
+  uint8_t* const out    = page_values[page_idx];
+
+  if (out == nullptr) { return; }
+  if (!setupLocalPageInfo(s, &pages[page_idx], chunks, min_row, num_rows)) { return; }
+  if (!t) { pages[page_idx].decoded_data = out; }
+  if (s->error) { return; }
+
+  uint8_t const* const in = s->data_start;
+  int const width         = s->dtype_len_in;
+  if (s->page.encoding == Encoding::BYTE_STREAM_SPLIT) {
+    // byte k of value i is stored at offset k * num_values + i
+    size_t const num_values =
+      min(static_cast<size_t>(s->data_end - in) / width, static_cast<size_t>(s->num_input_values));
+    for (size_t i = t; i < num_values * width; i += block_size) {
+      out[i] = in[(i % width) * num_values + i / width];
+    }
+  } else {
+    decode_delta_binary_packed(in, s->data_end, out, s->num_input_values, width, t);
+  }
+}
+
 /**
  * @brief Kernel for co the column data stored in the pages
  *
@@ -1481,10 +1689,11 @@ __global__ void __launch_bounds__(block_size)
  *
  * @param pages List of pages
  * @param chunks List of column chunks
+ * @param min_row Row index to start reading at
  * @param num_rows Maximum number of rows to read
  */
-__global__ void __launch_bounds__(block_size)
-  gpuDecodePageData(PageInfo* pages, device_span<ColumnChunkDesc const> chunks, size_t num_rows)
+__global__ void __launch_bounds__(block_size) gpuDecodePageData(
+  PageInfo* pages, device_span<ColumnChunkDesc const> chunks, size_t min_row, size_t num_rows)
 {
   __shared__ __align__(16) page_state_s state_g;
 
@@ -1493,7 +1702,7 @@ __global__ void __launch_bounds__(block_size)
   int const t           = threadIdx.x;
   int out_thread0;
 
-  if (!setupLocalPageInfo(s, &pages[page_idx], chunks, num_rows)) { return; }
+  if (!setupLocalPageInfo(s, &pages[page_idx], chunks, min_row, num_rows)) { return; }
 
   if (s->dict_base) {
     out_thread0 = (s->dict_bits > 0) ? 64 : 32;
@@ -1773,14 +1982,44 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
  */
 void __host__ DecodePageData(hostdevice_vector<PageInfo>& pages,
                              hostdevice_vector<ColumnChunkDesc> const& chunks,
+                             size_t min_row,
                              size_t num_rows,
                              rmm::cuda_stream_view stream)
 {
   dim3 dim_block(block_size, 1);
   dim3 dim_grid(pages.size(), 1);  // 1 threadblock per page
 
+  // DELTA_BINARY_PACKED and BYTE_STREAM_SPLIT pages are expanded to plain layout first so the main
+  // decode kernel can read their values like any other fixed-width plain page
+  std::vector<size_t> value_offsets(pages.size() + 1, 0);
+  for (size_t p = 0; p < pages.size(); p++) {
+    auto const& page = pages[p];
+    size_t size      = 0;
+    if (!(page.flags & PAGEINFO_FLAGS_DICTIONARY) &&
+        (page.encoding == Encoding::DELTA_BINARY_PACKED ||
+         page.encoding == Encoding::BYTE_STREAM_SPLIT)) {
+      auto const physical_type = chunks[page.chunk_idx].data_type & 7;
+      size = page.num_input_values *
+             ((physical_type == INT64 || physical_type == DOUBLE) ? sizeof(int64_t)
+                                                                   : sizeof(int32_t));
+    }
+    value_offsets[p + 1] = value_offsets[p] + size;
+  }
+  rmm::device_buffer decoded_values(value_offsets.back(), stream);
+  if (value_offsets.back() > 0) {
+    std::vector<uint8_t*> page_values(pages.size());
+    for (size_t p = 0; p < pages.size(); p++) {
+      page_values[p] = value_offsets[p + 1] > value_offsets[p]
+                         ? static_cast<uint8_t*>(decoded_values.data()) + value_offsets[p]
+                         : nullptr;
+    }
+    auto const d_page_values = cudf::detail::make_device_uvector_async(page_values, stream);
+    gpuDecodeDeltaAndSplitValues<<<dim_grid, dim_block, 0, stream.value()>>>(
+      pages.device_ptr(), chunks, d_page_values, min_row, num_rows);
+  }
+
   gpuDecodePageData<<<dim_grid, dim_block, 0, stream.value()>>>(
-    pages.device_ptr(), chunks, num_rows);
+    pages.device_ptr(), chunks, min_row, num_rows);
 }
 
 }  // namespace gpu
@@ -20,6 +20,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -55,6 +56,13 @@ using ::cudf::detail::device_2dspan;
 
 constexpr uint32_t rle_buffer_size = (1 << 9);
 
+// DELTA_BINARY_PACKED layout: blocks of 128 deltas split into 4 miniblocks of 32 values
+constexpr uint32_t delta_block_size      = 128;
+constexpr uint32_t delta_miniblock_count = 4;
+constexpr uint32_t delta_miniblock_size  = delta_block_size / delta_miniblock_count;
+// Buffered values before they are delta-encoded; enough for a full block plus one more batch
+constexpr uint32_t delta_buffer_size = 2 * delta_block_size;
+
 struct frag_init_state_s {
   parquet_column_device_view col;
   PageFragment frag;
@@ -79,6 +87,36 @@ struct page_enc_state_s {
   uint32_t vals[rle_buffer_size];
 };
 
+/**
+ * @brief Shared state of the DELTA_BINARY_PACKED and BYTE_STREAM_SPLIT value encoders
+ */
+struct value_enc_state_s {
+  uint32_t num_valid;    //!< Number of non-null values in the page
+  uint32_t num_stored;   //!< Number of values written (BYTE_STREAM_SPLIT) or buffered in `vals`
+                         //!< (DELTA_BINARY_PACKED) so far
+  uint32_t num_encoded;  //!< Number of buffered values already delta-encoded
+  bool has_first_value;  //!< Whether the first value has been written to the header
+  int64_t prev_value;    //!< Value preceding the first unencoded buffered value
+  int64_t min_delta;     //!< Minimum delta of the current block
+  uint32_t bit_width[delta_miniblock_count];  //!< Bit width of each miniblock of the current block
+  int64_t vals[delta_buffer_size];            //!< Ring buffer of values waiting to be encoded
+  uint32_t packed[delta_miniblock_count][delta_miniblock_size * 64 / 32];  //!< Packed miniblocks
+};
+
+/**
+ * @brief Returns an upper bound on the size a DELTA_BINARY_PACKED page adds on top of the plain
+ * size of its values.
+ *
+ * The header takes at most 32 bytes, each block adds a min delta varint and the miniblock bit
+ * widths, and the last miniblock holding values is padded to 32 entries.
+ */
+constexpr uint32_t __device__ delta_binary_packed_overhead(uint32_t num_values)
+{
+  return 32 + ((num_values + delta_block_size - 1) / delta_block_size) *
+                (10 + delta_miniblock_count) +
+         (delta_miniblock_size - 1) * sizeof(int64_t);
+}
+
 /**
  * @brief Returns the size of the type in the Parquet file.
  */
@@ -202,10 +240,12 @@ __global__ void __launch_bounds__(128)
   uint32_t column_id            = blockIdx.x;
   auto num_fragments_per_column = fragments.size().second;
   statistics_group* const g     = &group_g[threadIdx.x >> 5];
+  // The groups of the columns without statistics are empty, so no row of them is read
   if (!lane_id && frag_id < num_fragments_per_column) {
     g->col       = &col_desc[column_id];
     g->start_row = fragments[column_id][frag_id].start_value_idx;
-    g->num_rows  = fragments[column_id][frag_id].num_leaf_values;
+    g->num_rows  =
+      col_desc[column_id].write_statistics ? fragments[column_id][frag_id].num_leaf_values : 0;
   }
   __syncthreads();
   if (frag_id < num_fragments_per_column and lane_id == 0) groups[column_id][frag_id] = *g;
@@ -319,8 +359,12 @@ __global__ void __launch_bounds__(128)
         frag_g.num_rows           = 0;
       }
       __syncwarp();
+      // The pages past the fragments of the dictionary fall back to PLAIN
+      bool const page_uses_dict = ck_g.use_dictionary and page_start < ck_g.num_dict_fragments;
+      bool const frag_uses_dict =
+        ck_g.use_dictionary and fragments_in_chunk < ck_g.num_dict_fragments;
       uint32_t fragment_data_size =
-        (ck_g.use_dictionary)
+        (frag_uses_dict)
           ? frag_g.num_leaf_values * 2  // Assume worst-case of 2-bytes per dictionary index
           : frag_g.fragment_data_size;
       // TODO (dm): this convoluted logic to limit page size needs refactoring
@@ -333,18 +377,22 @@ __global__ void __launch_bounds__(128)
 
       if (num_rows >= ck_g.num_rows ||
           (values_in_page > 0 && (page_size + fragment_data_size > this_max_page_size)) ||
-          rows_in_page >= max_page_size_rows) {
-        if (ck_g.use_dictionary) {
+          rows_in_page >= max_page_size_rows ||
+          (fragments_in_chunk > page_start && page_uses_dict != frag_uses_dict)) {
+        if (page_uses_dict) {
           page_size =
             1 + 5 + ((values_in_page * ck_g.dict_rle_bits + 7) >> 3) + (values_in_page >> 8);
+        } else if (col_g.requested_encoding == Encoding::DELTA_BINARY_PACKED) {
+          page_size += delta_binary_packed_overhead(leaf_values_in_page);
         }
         if (!t) {
-          page_g.num_fragments = fragments_in_chunk - page_start;
-          page_g.chunk         = &chunks[blockIdx.y][blockIdx.x];
-          page_g.chunk_id      = blockIdx.y * num_columns + blockIdx.x;
-          page_g.page_type     = PageType::DATA_PAGE;
-          page_g.hdr_size      = 0;
-          page_g.max_hdr_size  = 32;  // Max size excluding statistics
+          page_g.num_fragments  = fragments_in_chunk - page_start;
+          page_g.chunk          = &chunks[blockIdx.y][blockIdx.x];
+          page_g.chunk_id       = blockIdx.y * num_columns + blockIdx.x;
+          page_g.page_type      = PageType::DATA_PAGE;
+          page_g.use_dictionary = page_uses_dict;
+          page_g.hdr_size       = 0;
+          page_g.max_hdr_size   = 32;  // Max size excluding statistics
           if (ck_g.stats) {
             uint32_t stats_hdr_len = 16;
             if (col_g.stats_dtype == dtype_string || col_g.stats_dtype == dtype_byte_array) {
@@ -459,6 +507,27 @@ inline __device__ uint8_t* VlqEncode(uint8_t* p, uint32_t v)
   return p;
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ */
+inline __device__ uint8_t* VlqEncode(uint8_t* p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+/**
+ * @brief Zigzag-encode a signed integer so that small magnitudes map to small unsigned values
+ */
+inline __device__ uint64_t zigzag_encode(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
 /**
  * @brief Pack literal values in output bitstream (1,2,4,8,12 or 16 bits per value)
  */
@@ -757,6 +826,127 @@ static __device__ std::pair<duration_ns, duration_D> convert_nanoseconds(timesta
   return {last_day_ticks, julian_days};
 }
 
+/**
+ * @brief Writes the DELTA_BINARY_PACKED header
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] vs Value encode state
+ * @param[in] first_value First value of the page, ignored if the page has no values
+ */
+static __device__ void DeltaEncodeHeader(page_enc_state_s* s,
+                                         value_enc_state_s* vs,
+                                         int64_t first_value)
+{
+  uint8_t* dst = VlqEncode(s->cur, delta_block_size);
+  dst          = VlqEncode(dst, delta_miniblock_count);
+  dst          = VlqEncode(dst, vs->num_valid);
+  dst          = VlqEncode(dst, zigzag_encode(vs->num_valid > 0 ? first_value : 0));
+  s->cur       = dst;
+  vs->has_first_value = true;
+}
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder for one block of buffered values
+ *
+ * Thread `t` computes the delta of buffered value `t`, so each warp produces one miniblock. Deltas
+ * of 32-bit columns wrap around in 32 bits, so the packed values never exceed 32 bits.
+ *
+ * @param[in,out] s Page encode state
+ * @param[in,out] vs Value encode state
+ * @param[in] count Number of values to encode, at most `delta_block_size`
+ * @param[in] is_int32 Whether the column is stored as INT32
+ * @param[in] t thread id (0..127)
+ */
+template <int block_size>
+static __device__ void DeltaEncodeBlock(
+  page_enc_state_s* s, value_enc_state_s* vs, uint32_t count, bool is_int32, uint32_t t)
+{
+  using block_reduce = cub::BlockReduce<int64_t, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  bool const has_value = t < count;
+  int64_t delta        = 0;
+  if (has_value) {
+    auto const idx  = vs->num_encoded + t;
+    auto const cur  = vs->vals[idx % delta_buffer_size];
+    auto const prev = (t == 0) ? vs->prev_value : vs->vals[(idx - 1) % delta_buffer_size];
+    delta           = is_int32 ? static_cast<int32_t>(static_cast<uint32_t>(cur) -
+                                            static_cast<uint32_t>(prev))
+                               : static_cast<int64_t>(static_cast<uint64_t>(cur) -
+                                            static_cast<uint64_t>(prev));
+  }
+  auto const min_delta =
+    block_reduce(reduce_storage).Reduce(has_value ? delta : INT64_MAX, cub::Min());
+  for (uint32_t i = t; i < sizeof(vs->packed) / sizeof(uint32_t); i += block_size) {
+    (&vs->packed[0][0])[i] = 0;
+  }
+  if (t == 0) { vs->min_delta = min_delta; }
+  __syncthreads();
+
+  uint64_t const rel =
+    !has_value ? 0
+    : is_int32 ? static_cast<uint32_t>(static_cast<uint32_t>(delta) -
+                                       static_cast<uint32_t>(vs->min_delta))
+               : static_cast<uint64_t>(delta) - static_cast<uint64_t>(vs->min_delta);
+  uint64_t bits = rel;
+  for (uint32_t i = delta_miniblock_size / 2; i > 0; i >>= 1) {
+    bits |= __shfl_xor_sync(~0u, bits, i);
+  }
+  uint32_t const bit_width = bits == 0 ? 0 : 64 - __clzll(bits);
+  uint32_t const miniblock = t / delta_miniblock_size;
+  uint32_t const lane      = t % delta_miniblock_size;
+  if (lane == 0) { vs->bit_width[miniblock] = bit_width; }
+  if (bit_width != 0) {
+    uint32_t* const packed = vs->packed[miniblock];
+    uint32_t const bit_pos = lane * bit_width;
+    uint32_t const word    = bit_pos / 32;
+    uint32_t const shift   = bit_pos % 32;
+    atomicOr(&packed[word], static_cast<uint32_t>(rel << shift));
+    if (shift + bit_width > 32) {
+      atomicOr(&packed[word + 1], static_cast<uint32_t>(rel >> (32 - shift)));
+    }
+    if (shift + bit_width > 64) {
+      atomicOr(&packed[word + 2], static_cast<uint32_t>(rel >> (64 - shift)));
+    }
+  }
+  __syncthreads();
+
+  // Block header: min delta followed by the bit width of every miniblock. Miniblocks without
+  // values report a zero bit width and store no data.
+  uint32_t const num_miniblocks = (count + delta_miniblock_size - 1) / delta_miniblock_size;
+  uint64_t const zz_min_delta   = zigzag_encode(vs->min_delta);
+  uint32_t min_delta_len        = 1;
+  for (auto v = zz_min_delta; v > 0x7f; v >>= 7) {
+    min_delta_len++;
+  }
+  if (t == 0) { VlqEncode(s->cur, zz_min_delta); }
+  uint8_t* const dst = s->cur + min_delta_len;
+  uint32_t miniblock_ofs[delta_miniblock_count];
+  uint32_t data_size = 0;
+  for (uint32_t m = 0; m < delta_miniblock_count; m++) {
+    miniblock_ofs[m] = data_size;
+    if (m < num_miniblocks) { data_size += vs->bit_width[m] * delta_miniblock_size / 8; }
+  }
+  if (t < delta_miniblock_count) {
+    dst[t] = (t < num_miniblocks) ? vs->bit_width[t] : 0;
+  }
+  uint8_t* const data = dst + delta_miniblock_count;
+  for (uint32_t i = t; i < data_size; i += block_size) {
+    uint32_t m = 0;
+    while (m + 1 < num_miniblocks && i >= miniblock_ofs[m + 1]) {
+      m++;
+    }
+    data[i] = reinterpret_cast<uint8_t const*>(vs->packed[m])[i - miniblock_ofs[m]];
+  }
+  __syncthreads();
+  if (t == 0) {
+    s->cur         = data + data_size;
+    vs->prev_value = vs->vals[(vs->num_encoded + count - 1) % delta_buffer_size];
+    vs->num_encoded += count;
+  }
+  __syncthreads();
+}
+
 // blockDim(128, 1, 1)
 template <int block_size>
 __global__ void __launch_bounds__(128, 8)
@@ -766,11 +956,13 @@ __global__ void __launch_bounds__(128, 8)
                  device_span<decompress_status> comp_stats)
 {
   __shared__ __align__(8) page_enc_state_s state_g;
+  __shared__ __align__(8) value_enc_state_s value_state_g;
   using block_scan = cub::BlockScan<uint32_t, block_size>;
   __shared__ typename block_scan::TempStorage temp_storage;
 
-  page_enc_state_s* const s = &state_g;
-  uint32_t t                = threadIdx.x;
+  page_enc_state_s* const s  = &state_g;
+  value_enc_state_s* const vs = &value_state_g;
+  uint32_t t                 = threadIdx.x;
 
   if (t == 0) {
     state_g = page_enc_state_s{};
@@ -893,15 +1085,14 @@ __global__ void __launch_bounds__(128, 8)
   auto const type_id       = s->col.leaf_column->type().id();
   auto const dtype_len_out = physical_type_len(physical_type, type_id);
   auto const dtype_len_in  = [&]() -> uint32_t {
-    if (physical_type == INT32) { return int32_logical_len(type_id); }
+    if (physical_type == INT32) { return int32_logical_len(col_type); }
     if (physical_type == INT96) { return sizeof(int64_t); }
     return dtype_len_out;
   }();
 
   auto const dict_bits = (physical_type == BOOLEAN) ? 1
-                         : (s->ck.use_dictionary and s->page.page_type != PageType::DICTIONARY_PAGE)
-                           ? s->ck.dict_rle_bits
-                           : -1;
+                         : (s->page.use_dictionary) ? s->ck.dict_rle_bits
+                                                    : -1;
   if (t == 0) {
     uint8_t* dst   = s->cur;
     s->rle_run     = 0;
@@ -916,6 +1107,53 @@ __global__ void __launch_bounds__(128, 8)
     s->chunk_start_val = row_to_value_idx(s->ck.start_row, s->col);
   }
   __syncthreads();
+
+  auto const data_encoding = (s->page.page_type == PageType::DICTIONARY_PAGE)
+                               ? Encoding::PLAIN
+                               : s->col.requested_encoding;
+  if (data_encoding != Encoding::PLAIN) {
+    // Both encodings need the number of non-null values up front: BYTE_STREAM_SPLIT to place the
+    // byte streams and DELTA_BINARY_PACKED for its header
+    uint32_t num_valid = 0;
+    for (uint32_t i = 0; i < s->page.num_leaf_values; i += block_size) {
+      size_type const val_idx_in_leaf_col = s->page_start_val + i + t;
+      uint32_t const is_valid = (i + t < s->page.num_leaf_values &&
+                                 val_idx_in_leaf_col < s->col.leaf_column->size())
+                                  ? s->col.leaf_column->is_valid(val_idx_in_leaf_col)
+                                  : 0;
+      uint32_t pos, block_valid;
+      block_scan(temp_storage).ExclusiveSum(is_valid, pos, block_valid);
+      num_valid += block_valid;
+      __syncthreads();
+    }
+    if (t == 0) {
+      vs->num_valid       = num_valid;
+      vs->num_stored      = 0;
+      vs->num_encoded     = 0;
+      vs->has_first_value = false;
+    }
+    __syncthreads();
+  }
+
+  // Integer value of a DELTA_BINARY_PACKED column, read the same way as its plain encoding
+  auto const int_value = [&](uint32_t val_idx) -> int64_t {
+    if (physical_type == INT32) {
+      if (dtype_len_in == 4) { return s->col.leaf_column->element<int32_t>(val_idx); }
+      if (dtype_len_in == 2) { return s->col.leaf_column->element<int16_t>(val_idx); }
+      return s->col.leaf_column->element<int8_t>(val_idx);
+    }
+    int64_t v              = s->col.leaf_column->element<int64_t>(val_idx);
+    int32_t const ts_scale = s->col.ts_scale;
+    if (ts_scale != 0) {
+      if (ts_scale < 0) {
+        v /= -ts_scale;
+      } else {
+        v *= ts_scale;
+      }
+    }
+    return v;
+  };
+
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
     uint32_t nvals = min(s->page.num_leaf_values - cur_val_idx, 128);
     uint32_t len, pos;
@@ -937,7 +1175,7 @@ __global__ void __launch_bounds__(128, 8)
                      ? s->col.leaf_column->is_valid(val_idx_in_leaf_col)
                      : 0;
         val_idx =
-          (s->ck.use_dictionary) ? val_idx_in_leaf_col - s->chunk_start_val : val_idx_in_leaf_col;
+          (s->page.use_dictionary) ? val_idx_in_leaf_col - s->chunk_start_val : val_idx_in_leaf_col;
       }
       return std::make_tuple(is_valid, val_idx);
     }();
@@ -970,6 +1208,47 @@ __global__ void __launch_bounds__(128, 8)
       }
       if (t == 0) { s->cur = s->rle_out; }
       __syncthreads();
+    } else if (data_encoding == Encoding::BYTE_STREAM_SPLIT) {
+      // Byte k of the i-th non-null value goes to offset k * num_valid + i
+      uint32_t num_valid_in_block;
+      block_scan(temp_storage).ExclusiveSum(is_valid, pos, num_valid_in_block);
+      if (is_valid) {
+        uint8_t* const dst = s->cur + vs->num_stored + pos;
+        if (physical_type == FLOAT) {
+          auto const v = s->col.leaf_column->element<int32_t>(val_idx);
+          for (uint32_t k = 0; k < sizeof(v); k++) {
+            dst[k * vs->num_valid] = v >> (8 * k);
+          }
+        } else {
+          auto const v = s->col.leaf_column->element<double>(val_idx);
+          uint8_t bytes[sizeof(v)];
+          memcpy(bytes, &v, sizeof(v));
+          for (uint32_t k = 0; k < sizeof(v); k++) {
+            dst[k * vs->num_valid] = bytes[k];
+          }
+        }
+      }
+      __syncthreads();
+      if (t == 0) { vs->num_stored += num_valid_in_block; }
+      __syncthreads();
+    } else if (data_encoding == Encoding::DELTA_BINARY_PACKED) {
+      uint32_t num_valid_in_block;
+      block_scan(temp_storage).ExclusiveSum(is_valid, pos, num_valid_in_block);
+      if (is_valid) { vs->vals[(vs->num_stored + pos) % delta_buffer_size] = int_value(val_idx); }
+      __syncthreads();
+      if (t == 0) {
+        vs->num_stored += num_valid_in_block;
+        if (!vs->has_first_value && vs->num_stored > 0) {
+          // The first value lives in the header, deltas start with the second one
+          vs->prev_value = vs->vals[0];
+          vs->num_encoded = 1;
+          DeltaEncodeHeader(s, vs, vs->prev_value);
+        }
+      }
+      __syncthreads();
+      while (vs->num_stored - vs->num_encoded >= delta_block_size) {
+        DeltaEncodeBlock<block_size>(s, vs, delta_block_size, physical_type == INT32, t);
+      }
     } else {
       // Non-dictionary encoding
       uint8_t* dst = s->cur;
@@ -977,7 +1256,7 @@ __global__ void __launch_bounds__(128, 8)
       if (is_valid) {
         len = dtype_len_out;
         if (physical_type == BYTE_ARRAY) {
-          if (type_id == type_id::STRING) {
+          if (col_type == type_id::STRING) {
             len += s->col.leaf_column->element<string_view>(val_idx).size_bytes();
           } else if (s->col.output_as_byte_array && type_id == type_id::LIST) {
             len +=
@@ -1109,6 +1388,17 @@ __global__ void __launch_bounds__(128, 8)
       __syncthreads();
     }
   }
+  if (data_encoding == Encoding::BYTE_STREAM_SPLIT) {
+    if (t == 0) { s->cur += vs->num_valid * dtype_len_out; }
+    __syncthreads();
+  } else if (data_encoding == Encoding::DELTA_BINARY_PACKED) {
+    if (t == 0 && !vs->has_first_value) { DeltaEncodeHeader(s, vs, 0); }
+    __syncthreads();
+    if (vs->num_stored > vs->num_encoded) {
+      DeltaEncodeBlock<block_size>(
+        s, vs, vs->num_stored - vs->num_encoded, physical_type == INT32, t);
+    }
+  }
   if (t == 0) {
     uint8_t* base                = s->page.page_data + s->page.max_hdr_size;
     auto actual_data_size        = static_cast<uint32_t>(s->cur - base);
@@ -1421,7 +1711,8 @@ __global__ void __launch_bounds__(128)
     ck_g   = *page_g.chunk;
     col_g  = *ck_g.col_desc;
 
-    if (chunk_stats && &pages[blockIdx.x] == ck_g.pages) {  // Is this the first page in a chunk?
+    // Is this the first page in a chunk of a column with statistics?
+    if (chunk_stats && ck_g.stats && &pages[blockIdx.x] == ck_g.pages) {
       hdr_start = (ck_g.is_compressed) ? ck_g.compressed_bfr : ck_g.uncompressed_bfr;
       hdr_end =
         EncodeStatistics(hdr_start, &chunk_stats[page_g.chunk_id], col_g.stats_dtype, scratch);
@@ -1444,14 +1735,17 @@ __global__ void __launch_bounds__(128)
     Encoding encoding;
     if (enable_bool_rle) {
       encoding = (col_g.physical_type == BOOLEAN) ? Encoding::RLE
-                 : (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
+                 : (page_type == PageType::DICTIONARY_PAGE || page_g.use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
                    : Encoding::PLAIN;
     } else {
-      encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.chunk->use_dictionary)
+      encoding = (page_type == PageType::DICTIONARY_PAGE || page_g.use_dictionary)
                    ? Encoding::PLAIN_DICTIONARY
                    : Encoding::PLAIN;
     }
+    if (page_type == PageType::DATA_PAGE && col_g.requested_encoding != Encoding::PLAIN) {
+      encoding = col_g.requested_encoding;
+    }
     encoder.field_int32(1, page_type);
     encoder.field_int32(2, uncompressed_page_size);
     encoder.field_int32(3, compressed_page_size);
@@ -1463,7 +1757,7 @@ __global__ void __launch_bounds__(128)
       encoder.field_int32(3, Encoding::RLE);      // definition_level_encoding
       encoder.field_int32(4, Encoding::RLE);      // repetition_level_encoding
       // Optionally encode page-level statistics
-      if (not page_stats.empty()) {
+      if (not page_stats.empty() && ck_g.stats) {
         encoder.field_struct_begin(5);
         encoder.set_ptr(
           EncodeStatistics(encoder.get_ptr(), &page_stats[blockIdx.x], col_g.stats_dtype, scratch));
@@ -1484,6 +1778,90 @@ __global__ void __launch_bounds__(128)
   if (t == 0) pages[blockIdx.x] = page_g;
 }
 
+/**
+ * @brief Hashes the plain encoding of a non-null value for the column chunk Bloom filter
+ */
+static __device__ uint64_t plain_value_hash(parquet_column_device_view const& col,
+                                            type_id col_type,
+                                            size_type val_idx)
+{
+  auto const hash_bytes = [](void const* data, size_t size) {
+    return cudf::detail::XXHash_64<uint8_t>{}.compute_bytes(static_cast<std::byte const*>(data),
+                                                             size);
+  };
+  auto const& leaf = *col.leaf_column;
+  switch (col.physical_type) {
+    case INT32: {
+      auto const dtype_len_in = int32_logical_len(col_type);
+      int32_t const v         = (dtype_len_in == 4)   ? leaf.element<int32_t>(val_idx)
+                                : (dtype_len_in == 2) ? leaf.element<int16_t>(val_idx)
+                                                      : leaf.element<int8_t>(val_idx);
+      return hash_bytes(&v, sizeof(v));
+    }
+    case INT64: {
+      int64_t v = leaf.element<int64_t>(val_idx);
+      if (col.ts_scale < 0) {
+        v /= -col.ts_scale;
+      } else if (col.ts_scale > 0) {
+        v *= col.ts_scale;
+      }
+      return hash_bytes(&v, sizeof(v));
+    }
+    case FLOAT: {
+      auto const v = leaf.element<float>(val_idx);
+      return hash_bytes(&v, sizeof(v));
+    }
+    case DOUBLE: {
+      auto const v = leaf.element<double>(val_idx);
+      return hash_bytes(&v, sizeof(v));
+    }
+    case BYTE_ARRAY: {
+      if (col_type == type_id::STRING) {
+        auto const str = leaf.element<string_view>(val_idx);
+        return hash_bytes(str.data(), str.size_bytes());
+      }
+      auto const bytes = get_element<statistics::byte_array_view>(leaf, val_idx);
+      return hash_bytes(bytes.data(), bytes.size_bytes());
+    }
+    case FIXED_LEN_BYTE_ARRAY: {
+      // decimal128 values are stored big-endian
+      auto const v          = leaf.element<numeric::decimal128>(val_idx).value();
+      auto const v_char_ptr = reinterpret_cast<uint8_t const*>(&v);
+      uint8_t big_endian[sizeof(v)];
+      for (size_t i = 0; i < sizeof(v); i++) {
+        big_endian[i] = v_char_ptr[sizeof(v) - 1 - i];
+      }
+      return hash_bytes(big_endian, sizeof(v));
+    }
+    default: return 0;
+  }
+}
+
+// blockDim(128, 1, 1)
+__global__ void __launch_bounds__(128) gpuInitBloomFilters(device_span<EncColumnChunk const> chunks)
+{
+  __shared__ __align__(8) parquet_column_device_view col_g;
+
+  EncColumnChunk const& ck = chunks[blockIdx.x];
+  if (ck.bloom_filter == nullptr) { return; }
+  if (threadIdx.x == 0) { col_g = *ck.col_desc; }
+  __syncthreads();
+
+  auto const first_value = row_to_value_idx(ck.start_row, col_g);
+  auto const end_value   = row_to_value_idx(ck.start_row + ck.num_rows, col_g);
+  auto const num_blocks  = ck.bloom_filter_size / bloom_filter_block_size;
+  auto const col_type    = col_g.leaf_column->type().id();
+  for (size_type i = first_value + threadIdx.x; i < end_value; i += blockDim.x) {
+    if (not col_g.leaf_column->is_valid(i)) { continue; }
+    auto const hash = plain_value_hash(col_g, col_type, i);
+    uint32_t* const block =
+      ck.bloom_filter + bloom_filter_block(hash, num_blocks) * bloom_filter_block_words;
+    for (uint32_t w = 0; w < bloom_filter_block_words; w++) {
+      atomicOr(block + w, bloom_filter_mask(hash, w));
+    }
+  }
+}
+
 // blockDim(1024, 1, 1)
 __global__ void __launch_bounds__(1024)
   gpuGatherPages(device_span<EncColumnChunk> chunks, device_span<gpu::EncPage const> pages)
@@ -1658,7 +2036,10 @@ __global__ void __launch_bounds__(1)
 
   if (column_stats.empty()) { return; }
 
-  EncColumnChunk* ck_g             = &chunks[blockIdx.x];
+  EncColumnChunk* ck_g = &chunks[blockIdx.x];
+  // Columns without statistics get no column index
+  if (ck_g->stats == nullptr) { return; }
+
   uint32_t num_pages               = ck_g->num_pages;
   parquet_column_device_view col_g = *ck_g->col_desc;
   size_t first_data_page           = ck_g->use_dictionary ? 1 : 0;
@@ -1784,6 +2165,11 @@ void EncodePageHeaders(device_span<EncPage> pages,
     pages, comp_stats, page_stats, chunk_stats);
 }
 
+void InitBloomFilters(device_span<EncColumnChunk const> chunks, rmm::cuda_stream_view stream)
+{
+  gpuInitBloomFilters<<<chunks.size(), 128, 0, stream.value()>>>(chunks);
+}
+
 void GatherPages(device_span<EncColumnChunk> chunks,
                  device_span<gpu::EncPage const> pages,
                  rmm::cuda_stream_view stream)
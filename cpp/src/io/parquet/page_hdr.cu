@@ -364,8 +364,9 @@ __global__ void __launch_bounds__(128)
       // this computation is only valid for flat schemas. for nested schemas,
       // they will be recomputed in the preprocess step by examining repetition and
       // definition levels
-      bs->page.chunk_row = 0;
-      bs->page.num_rows  = 0;
+      bs->page.chunk_row    = 0;
+      bs->page.num_rows     = 0;
+      bs->page.decoded_data = nullptr;
     }
     num_values     = bs->ck.num_values;
     page_info      = bs->ck.page_info;
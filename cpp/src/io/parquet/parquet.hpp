@@ -236,6 +236,7 @@ struct ColumnChunkMetaData {
   int64_t dictionary_page_offset =
     0;  // Byte offset from the beginning of file to first (only) dictionary page
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
+  int64_t bloom_filter_offset = 0;       // Byte offset from beginning of file to Bloom filter data
 };
 
 /**
@@ -362,6 +363,49 @@ struct ColumnIndex {
   std::vector<int64_t> null_counts;  // Optional count of null values per page
 };
 
+struct SplitBlockAlgorithm {
+};
+struct XxHash {
+};
+struct Uncompressed {
+};
+
+/**
+ * @brief Thrift-derived unions of the Bloom filter header, each with a single possible member
+ */
+struct BloomFilterAlgorithm {
+  struct {
+    bool BLOCK{false};
+  } isset;
+  SplitBlockAlgorithm BLOCK;
+};
+
+struct BloomFilterHash {
+  struct {
+    bool XXHASH{false};
+  } isset;
+  XxHash XXHASH;
+};
+
+struct BloomFilterCompression {
+  struct {
+    bool UNCOMPRESSED{false};
+  } isset;
+  Uncompressed UNCOMPRESSED;
+};
+
+/**
+ * @brief Thrift-derived struct describing the header of a column chunk Bloom filter.
+ *
+ * The header is followed by `num_bytes` bytes of filter bitset.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 // bit space we are reserving in column_buffer::user_data
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xffffff);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
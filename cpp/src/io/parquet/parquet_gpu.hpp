@@ -134,6 +134,9 @@ struct PageInfo {
   Encoding encoding;       // Encoding for data or dictionary page
   Encoding definition_level_encoding;  // Encoding used for definition levels (data page)
   Encoding repetition_level_encoding;  // Encoding used for repetition levels (data page)
+  // Values of a DELTA_BINARY_PACKED or BYTE_STREAM_SPLIT data page decoded into plain layout,
+  // nullptr for all other encodings
+  uint8_t* decoded_data;
 
   // nesting information (input/output) for each page
   int num_nesting_levels;
@@ -239,6 +242,9 @@ struct parquet_column_device_view : stats_column_desc {
                                //!< nullability of parent_column. May be different from
                                //!< col.nullable() in case of chunked writing.
   bool output_as_byte_array;   //!< Indicates this list column is being written as a byte array
+  Encoding requested_encoding;  //!< Data page encoding requested for this column, PLAIN if the
+                                //!< writer should choose between dictionary and plain encoding
+  bool write_statistics;        //!< Indicates statistics are computed and written for this column
 };
 
 constexpr int max_page_fragment_size = 5000;  //!< Max number of rows in a page fragment
@@ -250,14 +256,14 @@ struct EncColumnChunk;
  */
 struct PageFragment {
   uint32_t fragment_data_size;  //!< Size of fragment data in bytes
-  uint32_t dict_data_size;      //!< Size of dictionary for this fragment
+  uint32_t dict_data_size;      //!< Size of the dictionary entries first seen in this fragment
   uint32_t num_values;  //!< Number of values in fragment. Different from num_rows for nested type
   uint32_t start_value_idx;
   uint32_t num_leaf_values;  //!< Number of leaf values in fragment. Does not include nulls at
                              //!< non-leaf level
   size_type start_row;       //!< First row in fragment
   uint16_t num_rows;         //!< Number of rows in fragment
-  uint16_t num_dict_vals;    //!< Number of unique dictionary entries
+  uint32_t num_dict_vals;    //!< Number of dictionary entries first seen in this fragment
   EncColumnChunk* chunk;     //!< The chunk that this fragment belongs to
 };
 
@@ -279,6 +285,36 @@ inline uint32_t __device__ int32_logical_len(type_id id)
   }
 }
 
+/**
+ * @brief Split block Bloom filter layout: blocks of eight 32-bit words, one bit set per word
+ */
+constexpr uint32_t bloom_filter_block_words = 8;
+constexpr uint32_t bloom_filter_block_size  = bloom_filter_block_words * sizeof(uint32_t);
+
+/**
+ * @brief Returns the block of a split block Bloom filter that a hash maps to
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_block(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit a hash sets in word `word` of its split block Bloom filter block
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_mask(uint64_t hash, uint32_t word)
+{
+  uint32_t const salt[bloom_filter_block_words] = {0x47b6137bu,
+                                                   0x44974d91u,
+                                                   0x8824ad5bu,
+                                                   0xa2b7289du,
+                                                   0x705495c7u,
+                                                   0x2df1424bu,
+                                                   0x9efc4947u,
+                                                   0x5c6bfb31u};
+  return 1u << ((static_cast<uint32_t>(hash) * salt[word]) >> 27);
+}
+
 /**
  * @brief Translate the row index of a parent column_device_view into the index of the first value
  * in the leaf child.
@@ -354,8 +390,12 @@ struct EncColumnChunk {
   size_type* dict_index;  //!< Index of value in dictionary page. column[dict_data[dict_index[row]]]
   uint8_t dict_rle_bits;  //!< Bit size for encoding dictionary indices
   bool use_dictionary;    //!< True if the chunk uses dictionary encoding
+  uint32_t num_dict_fragments;  //!< Number of leading fragments encoded with the dictionary, the
+                                //!< pages of the remaining fragments fall back to PLAIN
   uint8_t* column_index_blob;  //!< Binary blob containing encoded column index for this chunk
   uint32_t column_index_size;  //!< Size of column index blob
+  uint32_t* bloom_filter;      //!< Bloom filter bitset of this chunk, nullptr if not written
+  uint32_t bloom_filter_size;  //!< Size of the Bloom filter bitset in bytes
 };
 
 /**
@@ -377,6 +417,7 @@ struct EncPage {
   uint32_t num_values;  //!< Number of def/rep level values in page. Includes null/empty elements in
                         //!< non-leaf levels
   decompress_status* comp_stat;  //!< Ptr to compression status
+  bool use_dictionary;           //!< True if the data page is dictionary encoded
 };
 
 /**
@@ -434,11 +475,13 @@ void PreprocessColumnData(hostdevice_vector<PageInfo>& pages,
  *
  * @param[in,out] pages All pages to be decoded
  * @param[in] chunks All chunks to be decoded
+ * @param[in] min_row Row index to start reading at
  * @param[in] num_rows Total number of rows to read
  * @param[in] stream CUDA stream to use, default 0
  */
 void DecodePageData(hostdevice_vector<PageInfo>& pages,
                     hostdevice_vector<ColumnChunkDesc> const& chunks,
+                    size_t min_row,
                     size_t num_rows,
                     rmm::cuda_stream_view stream);
 
@@ -484,7 +527,20 @@ void InitFragmentStatistics(cudf::detail::device_2dspan<statistics_group> groups
 void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream);
 
 /**
- * @brief Insert chunk values into their respective hash maps
+ * @brief Insert the values of the first fragment of each chunk into the chunk's hash map
+ *
+ * Counts the entries and their size in chunk.num_dict_entries and chunk.uniq_data_size, as an
+ * estimate of the cardinality of the chunk.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void sample_chunk_hash_maps(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
+                            rmm::cuda_stream_view stream);
+
+/**
+ * @brief Insert the values of the remaining fragments of each chunk into their respective hash
+ * maps
  *
  * @param frags Column fragments
  * @param stream CUDA stream to use
@@ -492,9 +548,23 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
 void populate_chunk_hash_maps(cudf::detail::device_2dspan<gpu::PageFragment const> frags,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Count the dictionary entries first seen in each fragment of a chunk
+ *
+ * Stores the count and size of the entries in frag.num_dict_vals and frag.dict_data_size, so that
+ * the dictionary of a chunk can be limited to the entries of its leading fragments.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void count_dictionary_entries(cudf::detail::device_2dspan<gpu::PageFragment> frags,
+                              rmm::cuda_stream_view stream);
+
 /**
  * @brief Compact dictionary hash map entries into chunk.dict_data
  *
+ * Only the entries first seen in the leading chunk.num_dict_fragments fragments are collected.
+ *
  * @param chunks Flat span of chunks to compact hash maps for
  * @param stream CUDA stream to use
  */
@@ -578,6 +648,16 @@ void EncodePageHeaders(device_span<EncPage> pages,
                        const statistics_chunk* chunk_stats,
                        rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel to insert the values of each column chunk into its Bloom filter
+ *
+ * Values are hashed with xxHash64 over their plain encoding, as required by the Parquet spec.
+ *
+ * @param[in,out] chunks Column chunks, those without a Bloom filter are skipped
+ * @param[in] stream CUDA stream to use
+ */
+void InitBloomFilters(device_span<EncColumnChunk const> chunks, rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel to gather pages to a single contiguous block per chunk
  *
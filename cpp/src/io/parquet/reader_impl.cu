@@ -26,30 +26,66 @@
 #include <io/comp/gpuinflate.hpp>
 #include <io/comp/nvcomp_adapter.hpp>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/host_worker_pool.hpp>
+#include <io/utilities/stats_filter.hpp>
 #include <io/utilities/time_utils.cuh>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_properties.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/io/parquet_metadata.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/distance.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <regex>
+#include <tuple>
+#include <unordered_map>
+
+#include <sys/stat.h>
 
 namespace cudf {
 namespace io {
@@ -256,6 +292,469 @@ inline void decompress_check(device_span<decompress_status const> stats,
                               [] __device__(auto const& stat) { return stat.status == 0; }),
                "Error during decompression");
 }
+
+/**
+ * @brief Creates a dictionary column from decoded string values pointing into dictionaries.
+ *
+ * @param values Decoded values, each either null or pointing to one of `entries`
+ * @param entries Dictionary entries referenced by `values`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @return Dictionary column whose keys are the unique entries
+ */
+std::unique_ptr<column> make_dictionary_from_entries(
+  device_span<string_index_pair const> values,
+  device_span<string_index_pair const> entries,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  // The keys are the sorted unique entries of all the dictionaries, each entry maps to one key
+  auto encoded = [&] {
+    auto const entry_strings =
+      make_strings_column(entries, stream, rmm::mr::get_current_device_resource());
+    return cudf::dictionary::detail::encode(
+      entry_strings->view(), data_type{type_id::UINT32}, stream, mr);
+  }();
+  auto const entry_keys = dictionary_column_view(encoded->view()).indices();
+
+  // Decoded values point to the dictionary entries, so the entry of a value is found by address
+  rmm::device_uvector<char const*> entry_ptrs(entries.size(), stream);
+  rmm::device_uvector<uint32_t> entry_key_indices(entries.size(), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    entries.begin(),
+                    entries.end(),
+                    entry_ptrs.begin(),
+                    [] __device__(string_index_pair const& entry) { return entry.first; });
+  thrust::copy(rmm::exec_policy(stream),
+               entry_keys.begin<uint32_t>(),
+               entry_keys.end<uint32_t>(),
+               entry_key_indices.begin());
+  thrust::sort_by_key(
+    rmm::exec_policy(stream), entry_ptrs.begin(), entry_ptrs.end(), entry_key_indices.begin());
+
+  auto constexpr not_found = std::numeric_limits<uint32_t>::max();
+  rmm::device_uvector<uint32_t> indices(values.size(), stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    values.begin(),
+                    values.end(),
+                    indices.begin(),
+                    [ptrs     = entry_ptrs.data(),
+                     keys     = entry_key_indices.data(),
+                     num_ptrs = entry_ptrs.size(),
+                     not_found] __device__(string_index_pair const& value) {
+                      if (value.first == nullptr) { return 0u; }
+                      auto const it =
+                        thrust::lower_bound(thrust::seq, ptrs, ptrs + num_ptrs, value.first);
+                      return (it == ptrs + num_ptrs || *it != value.first) ? not_found
+                                                                           : keys[it - ptrs];
+                    });
+  // a value pointing elsewhere would otherwise silently get a wrong key
+  CUDF_EXPECTS(
+    thrust::none_of(rmm::exec_policy(stream),
+                    indices.begin(),
+                    indices.end(),
+                    [not_found] __device__(uint32_t index) { return index == not_found; }),
+    "Decoded dictionary string does not point to a dictionary entry");
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    values.begin(),
+    values.end(),
+    [] __device__(string_index_pair const& value) { return value.first != nullptr; },
+    stream,
+    mr);
+
+  auto const num_rows = static_cast<size_type>(indices.size());
+  auto keys = std::move(encoded->release().children[dictionary_column_view::keys_column_index]);
+  return cudf::make_dictionary_column(
+    std::move(keys),
+    std::make_unique<column>(data_type{type_id::UINT32}, num_rows, indices.release()),
+    null_count > 0 ? std::move(null_mask) : rmm::device_buffer{},
+    null_count);
+}
+
+constexpr bool is_unsigned_type_id(type_id id)
+{
+  return id == type_id::UINT8 || id == type_id::UINT16 || id == type_id::UINT32 ||
+         id == type_id::UINT64;
+}
+
+/**
+ * @brief Decodes the plain encoded min/max bounds of a flat numeric column.
+ *
+ * `long double` holds every 64-bit integer exactly, so comparisons against integral literals
+ * are not subject to rounding.
+ *
+ * @return The [min, max] bounds, or `nullopt` if the column type is not numeric or a bound cannot
+ * be decoded
+ */
+std::optional<std::pair<long double, long double>> decode_stats_bounds(
+  std::vector<uint8_t> const& min_bytes,
+  std::vector<uint8_t> const& max_bytes,
+  SchemaElement const& schema,
+  type_id col_type_id)
+{
+  bool const is_unsigned = is_unsigned_type_id(col_type_id);
+  switch (col_type_id) {
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+    case type_id::INT64:
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64:
+    case type_id::FLOAT32:
+    case type_id::FLOAT64: break;
+    default: return std::nullopt;
+  }
+
+  auto const decode = [&](std::vector<uint8_t> const& bytes) -> std::optional<long double> {
+    auto const read_as = [&](auto value) -> std::optional<long double> {
+      if (bytes.size() != sizeof(value)) { return std::nullopt; }
+      std::memcpy(&value, bytes.data(), sizeof(value));
+      if constexpr (std::is_floating_point_v<decltype(value)>) {
+        if (std::isnan(value)) { return std::nullopt; }
+      }
+      return static_cast<long double>(value);
+    };
+    switch (schema.type) {
+      case parquet::INT32: return is_unsigned ? read_as(uint32_t{}) : read_as(int32_t{});
+      case parquet::INT64: return is_unsigned ? read_as(uint64_t{}) : read_as(int64_t{});
+      case parquet::FLOAT: return read_as(float{});
+      case parquet::DOUBLE: return read_as(double{});
+      default: return std::nullopt;
+    }
+  };
+  auto const min = decode(min_bytes);
+  auto const max = decode(max_bytes);
+  if (!min.has_value() || !max.has_value()) { return std::nullopt; }
+  return std::pair{*min, *max};
+}
+
+/**
+ * @brief Decodes the min/max statistics of a flat numeric column chunk.
+ */
+column_chunk_stats decode_chunk_stats(ColumnChunkMetaData const& col_meta,
+                                      SchemaElement const& schema,
+                                      type_id col_type_id)
+{
+  column_chunk_stats stats;
+  if (col_meta.statistics_blob.empty()) { return stats; }
+
+  Statistics chunk_stats;
+  CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+  if (!cp.read(&chunk_stats)) { return stats; }
+  stats.all_nulls = chunk_stats.null_count >= 0 && chunk_stats.null_count == col_meta.num_values;
+
+  // The deprecated min/max fields use signed ordering, which is only correct for signed types
+  bool const use_deprecated = chunk_stats.min_value.empty() || chunk_stats.max_value.empty();
+  if (use_deprecated && is_unsigned_type_id(col_type_id)) { return stats; }
+  auto const& min_bytes = use_deprecated ? chunk_stats.min : chunk_stats.min_value;
+  auto const& max_bytes = use_deprecated ? chunk_stats.max : chunk_stats.max_value;
+  auto const bounds     = decode_stats_bounds(min_bytes, max_bytes, schema, col_type_id);
+  if (bounds.has_value()) {
+    stats.has_range = true;
+    stats.min       = bounds->first;
+    stats.max       = bounds->second;
+  }
+  return stats;
+}
+
+/**
+ * @brief Decodes the min/max statistics of a page of a flat numeric column from the column index
+ * of its chunk.
+ */
+column_chunk_stats decode_page_stats(ColumnIndex const& column_index,
+                                     std::size_t page,
+                                     SchemaElement const& schema,
+                                     type_id col_type_id)
+{
+  column_chunk_stats stats;
+  if (column_index.null_pages[page]) {
+    stats.all_nulls = true;
+    return stats;
+  }
+  auto const bounds = decode_stats_bounds(
+    column_index.min_values[page], column_index.max_values[page], schema, col_type_id);
+  if (bounds.has_value()) {
+    stats.has_range = true;
+    stats.min       = bounds->first;
+    stats.max       = bounds->second;
+  }
+  return stats;
+}
+
+/**
+ * @brief Creates a scalar of an integral column type holding a bound read from the statistics.
+ */
+struct make_bound_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_integral<T>() and not std::is_same_v<T, bool>)>
+  std::unique_ptr<scalar> operator()(long double value, rmm::cuda_stream_view stream) const
+  {
+    return std::make_unique<numeric_scalar<T>>(static_cast<T>(value), true, stream);
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_integral<T>() or std::is_same_v<T, bool>),
+            typename... Args>
+  std::unique_ptr<scalar> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Statistics bounds are only attached to integral columns");
+  }
+};
+
+/**
+ * @brief Probes the split block Bloom filter of a flat numeric column chunk for a value.
+ *
+ * Returns `false` only if the chunk provably does not contain `value`; chunks without a readable
+ * filter, and values whose plain encoding is ambiguous (e.g. `-0.0` and `0.0`), are assumed to
+ * possibly match.
+ */
+bool bloom_filter_may_contain(datasource& source,
+                              ColumnChunkMetaData const& col_meta,
+                              SchemaElement const& schema,
+                              type_id col_type_id,
+                              long double value)
+{
+  if (col_meta.bloom_filter_offset <= 0) { return true; }
+  auto const offset = static_cast<size_t>(col_meta.bloom_filter_offset);
+  if (offset >= source.size()) { return true; }
+
+  // Plain encoding of the value in the physical type of the column
+  std::array<uint8_t, sizeof(int64_t)> plain{};
+  size_t plain_size = 0;
+  auto const encode = [&](auto v, parquet::Type physical_type) {
+    if (schema.type != physical_type) { return; }
+    std::memcpy(plain.data(), &v, sizeof(v));
+    plain_size = sizeof(v);
+  };
+  auto const is_integral_in = [&](auto lo, auto hi) {
+    return value == std::trunc(value) && value >= static_cast<long double>(lo) &&
+           value <= static_cast<long double>(hi);
+  };
+  switch (col_type_id) {
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+      if (is_integral_in(std::numeric_limits<int32_t>::min(),
+                         std::numeric_limits<int32_t>::max())) {
+        encode(static_cast<int32_t>(value), parquet::INT32);
+      }
+      break;
+    case type_id::UINT32:
+      if (is_integral_in(0, std::numeric_limits<uint32_t>::max())) {
+        encode(static_cast<uint32_t>(value), parquet::INT32);
+      }
+      break;
+    case type_id::INT64:
+      if (is_integral_in(std::numeric_limits<int64_t>::min(),
+                         std::numeric_limits<int64_t>::max())) {
+        encode(static_cast<int64_t>(value), parquet::INT64);
+      }
+      break;
+    case type_id::UINT64:
+      if (is_integral_in(0, std::numeric_limits<uint64_t>::max())) {
+        encode(static_cast<uint64_t>(value), parquet::INT64);
+      }
+      break;
+    case type_id::FLOAT32:
+      if (value != 0 && static_cast<long double>(static_cast<float>(value)) == value) {
+        encode(static_cast<float>(value), parquet::FLOAT);
+      }
+      break;
+    case type_id::FLOAT64:
+      if (value != 0 && static_cast<long double>(static_cast<double>(value)) == value) {
+        encode(static_cast<double>(value), parquet::DOUBLE);
+      }
+      break;
+    default: break;
+  }
+  if (plain_size == 0) { return true; }
+
+  // The header is a handful of bytes; read a generous prefix and the bitset that follows it
+  constexpr size_t max_header_size = 64;
+  auto const header_buffer =
+    source.host_read(offset, std::min(max_header_size, source.size() - offset));
+  BloomFilterHeader header;
+  CompactProtocolReader cp(header_buffer->data(), header_buffer->size());
+  if (!cp.read(&header)) { return true; }
+  if (!header.algorithm.isset.BLOCK || !header.hash.isset.XXHASH ||
+      !header.compression.isset.UNCOMPRESSED) {
+    return true;
+  }
+  auto const num_blocks    = static_cast<uint32_t>(header.num_bytes) / gpu::bloom_filter_block_size;
+  auto const bitset_offset = offset + cp.bytecount();
+  if (header.num_bytes <= 0 || num_blocks == 0 ||
+      bitset_offset + header.num_bytes > source.size()) {
+    return true;
+  }
+
+  auto const hash = cudf::detail::XXHash_64<uint8_t>{}.compute_bytes(
+    reinterpret_cast<std::byte const*>(plain.data()), plain_size);
+  auto const block_offset =
+    gpu::bloom_filter_block(hash, num_blocks) * size_t{gpu::bloom_filter_block_size};
+  auto const block = source.host_read(bitset_offset + block_offset, gpu::bloom_filter_block_size);
+  if (block->size() != gpu::bloom_filter_block_size) { return true; }
+  for (uint32_t w = 0; w < gpu::bloom_filter_block_words; w++) {
+    uint32_t word;
+    std::memcpy(&word, block->data() + w * sizeof(uint32_t), sizeof(word));
+    if ((word & gpu::bloom_filter_mask(hash, w)) == 0) { return false; }
+  }
+  return true;
+}
+
+/**
+ * @brief Marks the output columns referenced by an AST expression.
+ *
+ * @param expr Expression to walk
+ * @param referenced Whether each output column is referenced, updated in place
+ */
+void mark_column_references(ast::expression const& expr, std::vector<bool>& referenced)
+{
+  if (auto const op = dynamic_cast<ast::operation const*>(&expr)) {
+    for (auto const& operand : op->get_operands()) {
+      mark_column_references(operand.get(), referenced);
+    }
+  } else if (auto const col = dynamic_cast<ast::column_reference const*>(&expr)) {
+    auto const col_idx = col->get_column_index();
+    CUDF_EXPECTS(col_idx >= 0 && col_idx < static_cast<size_type>(referenced.size()),
+                 "Filter column index is out of range");
+    referenced[col_idx] = true;
+  }
+}
+
+// Runs of rows failing the filter shorter than this are decoded along with the rows around them,
+// as they seldom span a whole page
+constexpr size_type late_materialization_min_gap = 20000;
+// Largest number of ranges of rows decoded separately by a late materialized read
+constexpr std::size_t late_materialization_max_ranges = 64;
+
+/**
+ * @brief Returns the ranges of rows to decode to cover all the rows satisfying a filter.
+ *
+ * Runs of failing rows of at least `late_materialization_min_gap` rows separate the ranges; the
+ * longest runs are kept when there are more than `late_materialization_max_ranges` ranges.
+ *
+ * @param predicate Result of the filter; null rows do not satisfy it
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Ranges of rows `[begin, end)`, in increasing order
+ */
+std::vector<std::pair<size_type, size_type>> passing_row_ranges(column_view const& predicate,
+                                                                rmm::cuda_stream_view stream)
+{
+  auto const d_predicate = column_device_view::create(predicate, stream);
+  rmm::device_uvector<size_type> rows(predicate.size(), stream);
+  auto const rows_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(predicate.size()),
+                    rows.begin(),
+                    [predicate = *d_predicate] __device__(size_type row) {
+                      return predicate.is_valid(row) && predicate.element<bool>(row);
+                    });
+  auto const num_rows = static_cast<size_type>(thrust::distance(rows.begin(), rows_end));
+  if (num_rows == 0) { return {}; }
+
+  // Each gap lies between two consecutive passing rows far enough apart
+  rmm::device_uvector<size_type> gap_firsts(num_rows - 1, stream);
+  rmm::device_uvector<size_type> gap_lasts(num_rows - 1, stream);
+  auto const row_pairs =
+    thrust::make_zip_iterator(thrust::make_tuple(rows.begin(), rows.begin() + 1));
+  auto const gaps_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(gap_firsts.begin(), gap_lasts.begin()));
+  auto const gaps_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    row_pairs,
+    row_pairs + (num_rows - 1),
+    gaps_begin,
+    [] __device__(thrust::tuple<size_type, size_type> const& pair) {
+      return thrust::get<1>(pair) - thrust::get<0>(pair) > late_materialization_min_gap;
+    });
+  auto const num_gaps = static_cast<std::size_t>(thrust::distance(gaps_begin, gaps_end));
+
+  auto const h_gap_firsts = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>{gap_firsts.data(), num_gaps}, stream);
+  auto const h_gap_lasts = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>{gap_lasts.data(), num_gaps}, stream);
+  std::vector<std::pair<size_type, size_type>> gaps;
+  for (std::size_t i = 0; i < num_gaps; ++i) {
+    gaps.emplace_back(h_gap_firsts[i], h_gap_lasts[i]);
+  }
+  if (gaps.size() >= late_materialization_max_ranges) {
+    auto const last_kept = gaps.begin() + (late_materialization_max_ranges - 1);
+    std::nth_element(gaps.begin(), last_kept, gaps.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.second - lhs.first > rhs.second - rhs.first;
+    });
+    gaps.erase(last_kept, gaps.end());
+    std::sort(gaps.begin(), gaps.end());
+  }
+
+  std::vector<std::pair<size_type, size_type>> ranges;
+  auto range_begin = rows.element(0, stream);
+  for (auto const& [last_passing, next_passing] : gaps) {
+    ranges.emplace_back(range_begin, last_passing + 1);
+    range_begin = next_passing;
+  }
+  ranges.emplace_back(range_begin, rows.element(num_rows - 1, stream) + 1);
+  return ranges;
+}
+
+// Largest number of ranges of pages decoded separately by a read pruning pages with the filter
+constexpr std::size_t page_filter_max_ranges = 64;
+
+/**
+ * @brief Merges the ranges of rows separated by the shortest gaps until at most `max_ranges`
+ * remain.
+ *
+ * @param ranges Ranges of rows `[begin, end)`, in increasing order
+ * @param max_ranges Largest number of ranges to return
+ *
+ * @return Ranges of rows covering `ranges`, in increasing order
+ */
+std::vector<std::pair<size_type, size_type>> merge_row_ranges(
+  std::vector<std::pair<size_type, size_type>> const& ranges, std::size_t max_ranges)
+{
+  if (ranges.size() <= max_ranges) { return ranges; }
+
+  // Each gap is identified by the index of the range it follows
+  std::vector<std::size_t> gaps(ranges.size() - 1);
+  std::iota(gaps.begin(), gaps.end(), 0);
+  auto const gap_size = [&](std::size_t gap) {
+    return ranges[gap + 1].first - ranges[gap].second;
+  };
+  auto const last_kept = gaps.begin() + (max_ranges - 1);
+  std::nth_element(gaps.begin(), last_kept, gaps.end(), [&](auto lhs, auto rhs) {
+    return gap_size(lhs) > gap_size(rhs);
+  });
+  gaps.erase(last_kept, gaps.end());
+  std::sort(gaps.begin(), gaps.end());
+
+  std::vector<std::pair<size_type, size_type>> merged;
+  auto range_begin = ranges.front().first;
+  for (auto const gap : gaps) {
+    merged.emplace_back(range_begin, ranges[gap].second);
+    range_begin = ranges[gap + 1].first;
+  }
+  merged.emplace_back(range_begin, ranges.back().second);
+  return merged;
+}
+
+/**
+ * @brief Concatenates the tables decoded from consecutive ranges of rows.
+ */
+std::unique_ptr<table> concatenate_pieces(std::vector<std::unique_ptr<table>>&& pieces,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  if (pieces.size() == 1) { return std::move(pieces.front()); }
+  std::vector<table_view> views;
+  std::transform(pieces.begin(), pieces.end(), std::back_inserter(views), [](auto const& t) {
+    return t->view();
+  });
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
 }  // namespace
 
 std::string name_from_path(const std::vector<std::string>& path_in_schema)
@@ -322,21 +821,107 @@ struct metadata : public FileMetaData {
   }
 };
 
+namespace {
+
+/**
+ * @brief Process-wide cache of parsed file footers, keyed by file path.
+ *
+ * An entry is only used while the size and modification time of the file are unchanged.
+ */
+class footer_cache {
+  struct file_stamp {
+    off_t size;
+    timespec mtime;
+
+    bool operator==(file_stamp const& other) const
+    {
+      return size == other.size && mtime.tv_sec == other.mtime.tv_sec &&
+             mtime.tv_nsec == other.mtime.tv_nsec;
+    }
+  };
+
+  static std::optional<file_stamp> stamp_of(std::string const& path)
+  {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) { return std::nullopt; }
+    return file_stamp{st.st_size, st.st_mtim};
+  }
+
+ public:
+  /**
+   * @brief Returns the footer of the file at `path`, parsing it from `source` if not cached.
+   */
+  metadata get(std::string const& path, datasource* source)
+  {
+    auto const stamp = stamp_of(path);
+    if (stamp.has_value()) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto const it = _entries.find(path);
+      if (it != _entries.end() && it->second.first == *stamp) { return it->second.second; }
+    }
+
+    auto md = metadata(source);
+    if (stamp.has_value()) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      // Keep memory bounded for long-running processes reading ever-changing datasets
+      if (_entries.size() >= _max_entries) { _entries.clear(); }
+      _entries.insert_or_assign(path, std::pair{*stamp, md});
+    }
+    return md;
+  }
+
+ private:
+  std::mutex _mutex;
+  std::unordered_map<std::string, std::pair<file_stamp, metadata>> _entries;
+  std::size_t const _max_entries =
+    getenv_or<std::size_t>("LIBCUDF_PARQUET_METADATA_CACHE_SIZE", 4096);
+};
+
+footer_cache& get_footer_cache()
+{
+  static footer_cache cache;
+  return cache;
+}
+
+}  // namespace
+
 class aggregate_reader_metadata {
   std::vector<metadata> per_file_metadata;
   std::vector<std::unordered_map<std::string, std::string>> keyval_maps;
-  size_type num_rows;
+  int64_t num_rows;
   size_type num_row_groups;
   /**
    * @brief Create a metadata object from each element in the source vector
    */
-  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources)
+  auto metadatas_from_sources(std::vector<std::unique_ptr<datasource>> const& sources,
+                              std::vector<std::string> const& cache_paths)
   {
+    auto parse = [&](size_t src_idx) {
+      return cache_paths.empty() ? metadata(sources[src_idx].get())
+                                 : get_footer_cache().get(cache_paths[src_idx],
+                                                          sources[src_idx].get());
+    };
+
     std::vector<metadata> metadatas;
-    std::transform(
-      sources.cbegin(), sources.cend(), std::back_inserter(metadatas), [](auto const& source) {
-        return metadata(source.get());
-      });
+    if (sources.size() == 1) {
+      metadatas.push_back(parse(0));
+      return metadatas;
+    }
+
+    // Footers of datasets with many files are parsed concurrently
+    std::vector<std::future<metadata>> tasks;
+    tasks.reserve(sources.size());
+    for (size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+      tasks.push_back(host_worker_pool().submit(parse, src_idx));
+    }
+    // Wait for all the tasks before any exception propagates, since they access `sources`
+    for (auto& task : tasks) {
+      task.wait();
+    }
+    metadatas.reserve(sources.size());
+    for (auto& task : tasks) {
+      metadatas.push_back(task.get());
+    }
     return metadatas;
   }
 
@@ -366,10 +951,10 @@ class aggregate_reader_metadata {
   /**
    * @brief Sums up the number of rows of each source
    */
-  [[nodiscard]] size_type calc_num_rows() const
+  [[nodiscard]] int64_t calc_num_rows() const
   {
     return std::accumulate(
-      per_file_metadata.begin(), per_file_metadata.end(), 0, [](auto& sum, auto& pfm) {
+      per_file_metadata.begin(), per_file_metadata.end(), int64_t{0}, [](auto& sum, auto& pfm) {
         return sum + pfm.num_rows;
       });
   }
@@ -386,8 +971,16 @@ class aggregate_reader_metadata {
   }
 
  public:
-  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources)
-    : per_file_metadata(metadatas_from_sources(sources)),
+  /**
+   * @brief Parses the footers of the given sources.
+   *
+   * @param sources Dataset sources
+   * @param cache_paths File paths of the sources whose footers are looked up in and added to the
+   *        process-wide footer cache, or empty to always parse the footers
+   */
+  aggregate_reader_metadata(std::vector<std::unique_ptr<datasource>> const& sources,
+                            std::vector<std::string> const& cache_paths = {})
+    : per_file_metadata(metadatas_from_sources(sources, cache_paths)),
       keyval_maps(collect_keyval_metadata()),
       num_rows(calc_num_rows()),
       num_row_groups(calc_num_row_groups())
@@ -417,9 +1010,9 @@ class aggregate_reader_metadata {
     return per_file_metadata[src_idx].row_groups[row_group_index];
   }
 
-  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
-                                                size_type src_idx,
-                                                int schema_idx) const
+  [[nodiscard]] auto const& get_column_chunk(size_type row_group_index,
+                                             size_type src_idx,
+                                             int schema_idx) const
   {
     auto col = std::find_if(
       per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
@@ -427,7 +1020,14 @@ class aggregate_reader_metadata {
       [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx ? true : false; });
     CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
                  "Found no metadata for schema index");
-    return col->meta_data;
+    return *col;
+  }
+
+  [[nodiscard]] auto const& get_column_metadata(size_type row_group_index,
+                                                size_type src_idx,
+                                                int schema_idx) const
+  {
+    return get_column_chunk(row_group_index, src_idx, schema_idx).meta_data;
   }
 
   [[nodiscard]] auto get_num_rows() const { return num_rows; }
@@ -526,16 +1126,6 @@ class aggregate_reader_metadata {
     return names;
   }
 
-  struct row_group_info {
-    size_type const index;
-    size_t const start_row;  // TODO source index
-    size_type const source_index;
-    row_group_info(size_type index, size_t start_row, size_type source_index)
-      : index(index), start_row(start_row), source_index(source_index)
-    {
-    }
-  };
-
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -543,46 +1133,61 @@ class aggregate_reader_metadata {
    *
    * @return List of row group info structs and the total number of rows
    */
-  [[nodiscard]] std::pair<std::vector<row_group_info>, size_type> select_row_groups(
+  [[nodiscard]] std::pair<std::vector<row_group_info>, int64_t> select_row_groups(
     std::vector<std::vector<size_type>> const& row_groups) const
   {
-    size_type row_count = 0;
-
-    if (!row_groups.empty()) {
-      std::vector<row_group_info> selection;
-      CUDF_EXPECTS(row_groups.size() == per_file_metadata.size(),
-                   "Must specify row groups for each source");
-
-      row_count = 0;
-      for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
-        for (auto const& rowgroup_idx : row_groups[src_idx]) {
-          CUDF_EXPECTS(
-            rowgroup_idx >= 0 &&
-              rowgroup_idx < static_cast<size_type>(per_file_metadata[src_idx].row_groups.size()),
-            "Invalid rowgroup index");
-          selection.emplace_back(rowgroup_idx, row_count, src_idx);
-          row_count += get_row_group(rowgroup_idx, src_idx).num_rows;
-        }
+    std::vector<std::vector<int64_t>> row_group_num_rows;
+    row_group_num_rows.reserve(per_file_metadata.size());
+    for (auto const& pfm : per_file_metadata) {
+      auto& num_rows = row_group_num_rows.emplace_back();
+      num_rows.reserve(pfm.row_groups.size());
+      for (auto const& rg : pfm.row_groups) {
+        num_rows.push_back(rg.num_rows);
       }
-      return {selection, row_count};
     }
+    return cudf::io::detail::parquet::select_row_groups(row_groups, row_group_num_rows);
+  }
 
-    row_count = static_cast<size_type>(
-      std::min<int64_t>(get_num_rows(), std::numeric_limits<size_type>::max()));
-    CUDF_EXPECTS(row_count >= 0, "Invalid row count");
+  /**
+   * @brief Selects the row groups of a selection overlapping a range of its rows
+   *
+   * The start rows of the returned row groups are relative to the first returned row group.
+   *
+   * @param row_groups Selected row groups, with start rows relative to the first one
+   * @param skip_rows Number of rows of the selection to skip
+   * @param num_rows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   *
+   * @return List of row group info structs, the number of rows of the first row group to skip and
+   * the number of rows to read
+   */
+  [[nodiscard]] std::tuple<std::vector<row_group_info>, size_type, size_type> select_row_range(
+    std::vector<row_group_info> const& row_groups, size_type skip_rows, size_type num_rows) const
+  {
+    int64_t total_rows = 0;
+    for (auto const& rg : row_groups) {
+      total_rows += get_row_group(rg.index, rg.source_index).num_rows;
+    }
+    total_rows           = std::min<int64_t>(total_rows, std::numeric_limits<size_type>::max());
+    auto const row_begin = std::min<int64_t>(skip_rows, total_rows);
+    auto const row_end =
+      num_rows < 0 ? total_rows : std::min<int64_t>(row_begin + num_rows, total_rows);
+    if (row_begin == row_end) { return {{}, 0, 0}; }
 
     std::vector<row_group_info> selection;
-    size_type count = 0;
-    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      for (size_t rg_idx = 0; rg_idx < per_file_metadata[src_idx].row_groups.size(); ++rg_idx) {
-        auto const chunk_start_row = count;
-        count += get_row_group(rg_idx, src_idx).num_rows;
-        selection.emplace_back(rg_idx, chunk_start_row, src_idx);
-        if (count >= row_count) { break; }
-      }
+    int64_t first_start_row = 0;
+    int64_t count           = 0;
+    for (auto const& rg : row_groups) {
+      if (count >= row_end) { break; }
+      auto const start_row = count;
+      count += get_row_group(rg.index, rg.source_index).num_rows;
+      if (count <= row_begin) { continue; }
+      if (selection.empty()) { first_start_row = start_row; }
+      selection.emplace_back(rg.index, start_row - first_start_row, rg.source_index);
     }
 
-    return {selection, row_count};
+    return {selection,
+            static_cast<size_type>(row_begin - first_start_row),
+            static_cast<size_type>(row_end - row_begin)};
   }
 
   /**
@@ -980,21 +1585,50 @@ std::future<void> reader::impl::read_column_chunks(
   size_t begin_chunk,
   size_t end_chunk,
   const std::vector<size_t>& column_chunk_offsets,
+  std::vector<std::pair<size_t, size_t>> const& dictionary_ranges,
   std::vector<size_type> const& chunk_source_map)
 {
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
+  // Pending host reads, batched separately for uncompressed [0] and compressed [1] chunks
+  std::array<std::vector<host_read_batch::read_info>, 2> host_reads;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     const size_t io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+
+    // The dictionary page of a chunk whose leading data pages are skipped is read separately and
+    // placed in front of the data pages
+    auto const [dict_offset, dict_size] = dictionary_ranges[chunk];
+    if (dict_size != 0) {
+      auto const source    = chunk_source_map[chunk];
+      auto const data_size = io_size - dict_size;
+      if (_sources[source]->is_device_read_preferred(data_size)) {
+        auto buffer     = rmm::device_buffer(io_size, _stream);
+        auto* const dst = static_cast<uint8_t*>(buffer.data());
+        read_tasks.emplace_back(
+          _sources[source]->device_read_async(dict_offset, dict_size, dst, _stream));
+        read_tasks.emplace_back(
+          _sources[source]->device_read_async(io_offset, data_size, dst + dict_size, _stream));
+        page_data[chunk]              = datasource::buffer::create(std::move(buffer));
+        chunks[chunk].compressed_data = page_data[chunk]->data();
+      } else {
+        // the dictionary read covers no chunk so that the chunk data starts at the dictionary
+        host_reads[is_compressed].push_back({source, dict_offset, dict_size, chunk, chunk});
+        host_reads[is_compressed].push_back({source, io_offset, data_size, chunk, next_chunk});
+      }
+      chunk = next_chunk;
+      continue;
+    }
+
+    while (next_chunk < end_chunk && dictionary_ranges[next_chunk].second == 0) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
-        // Can't merge if not contiguous or mixing compressed and uncompressed
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          chunk_source_map[next_chunk] != chunk_source_map[chunk]) {
+        // Can't merge if not contiguous, mixing compressed and uncompressed or mixing sources
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
         break;
@@ -1010,23 +1644,66 @@ std::future<void> reader::impl::read_column_chunks(
           io_offset, io_size, static_cast<uint8_t*>(buffer.data()), _stream);
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
+        auto d_compdata  = page_data[chunk]->data();
+        for (auto c = chunk; c < next_chunk; ++c) {
+          chunks[c].compressed_data = d_compdata;
+          d_compdata += chunks[c].compressed_size;
+        }
       } else {
-        auto const buffer = source->host_read(io_offset, io_size);
-        page_data[chunk] =
-          datasource::buffer::create(rmm::device_buffer(buffer->data(), buffer->size(), _stream));
+        host_reads[is_compressed].push_back(
+          {chunk_source_map[chunk], io_offset, io_size, chunk, next_chunk});
       }
-      auto d_compdata = page_data[chunk]->data();
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
-    } else {
-      chunk = next_chunk;
     }
+    chunk = next_chunk;
   }
+
+  // Host reads run on the IO worker threads so that they overlap with each other and with the
+  // decoding of previously read data; reads from the same source are serialized since datasources
+  // are not required to support concurrent reads. Small reads, typical of datasets made of many
+  // small files, share a batch across row groups and sources so that they are copied to the
+  // device with a single allocation and transfer
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  for (auto const& reads : host_reads) {
+    for (auto& batch : make_host_read_batches(reads, host_read_batch_size)) {
+      // Pointers into heap storage remain valid when the owning containers are moved
+      auto read_fn = [device,
+                      batch           = std::move(batch),
+                      sources         = _sources.data(),
+                      source_mutexes  = _source_mutexes.data(),
+                      chunk_descs     = chunks.host_ptr(),
+                      chunk_page_data = page_data.data(),
+                      stream          = _stream]() -> size_t {
+        CUDF_CUDA_TRY(cudaSetDevice(device));
+        std::vector<uint8_t> h_data(batch.size);
+        for (size_t r = 0, data_ofs = 0; r < batch.reads.size(); ++r) {
+          auto const& read = batch.reads[r];
+          std::lock_guard<std::mutex> lock(source_mutexes[read.source]);
+          auto const read_size =
+            sources[read.source]->host_read(read.offset, read.size, h_data.data() + data_ofs);
+          CUDF_EXPECTS(read_size == read.size, "Unexpected end of data source");
+          data_ofs += read.size;
+        }
+        // The first chunk of the batch owns the device data of all the chunks in the batch
+        auto& owner     = chunk_page_data[batch.reads.front().first_chunk];
+        owner           = datasource::buffer::create(
+          rmm::device_buffer(h_data.data(), h_data.size(), stream));
+        auto d_compdata = owner->data();
+        for (auto const& read : batch.reads) {
+          for (auto c = read.first_chunk; c < read.last_chunk; ++c) {
+            chunk_descs[c].compressed_data = d_compdata;
+            d_compdata += chunk_descs[c].compressed_size;
+          }
+        }
+        return batch.size;
+      };
+      read_tasks.emplace_back(host_worker_pool().submit(std::move(read_fn)));
+    }
+  }
+
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
-      task.wait();
+      task.get();
     }
   };
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
@@ -1104,7 +1781,8 @@ rmm::device_buffer reader::impl::decompress_page_data(
   std::array codecs{codec_stats{parquet::GZIP},
                     codec_stats{parquet::SNAPPY},
                     codec_stats{parquet::BROTLI},
-                    codec_stats{parquet::ZSTD}};
+                    codec_stats{parquet::ZSTD},
+                    codec_stats{parquet::LZ4_RAW}};
 
   auto is_codec_supported = [&codecs](int8_t codec) {
     if (codec == parquet::UNCOMPRESSED) return true;
@@ -1198,6 +1876,15 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                    codec.total_decomp_size,
                                    _stream);
         break;
+      case parquet::LZ4_RAW:
+        nvcomp::batched_decompress(nvcomp::compression_type::LZ4,
+                                   d_comp_in,
+                                   d_comp_out,
+                                   d_comp_stats_view,
+                                   codec.max_decompressed_size,
+                                   codec.total_decomp_size,
+                                   _stream);
+        break;
       case parquet::BROTLI:
         gpu_debrotli(d_comp_in,
                      d_comp_out,
@@ -1364,17 +2051,19 @@ void reader::impl::preprocess_columns(hostdevice_vector<gpu::ColumnChunkDesc>& c
     // preprocess per-nesting level sizes by page
     gpu::PreprocessColumnData(
       pages, chunks, _input_columns, _output_columns, num_rows, _stream, _mr);
-    _stream.synchronize();
+    cudf::detail::synchronize_stream(_stream);
   }
 }
 
 /**
  * @copydoc cudf::io::detail::parquet::decode_page_data
  */
-void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                    hostdevice_vector<gpu::PageInfo>& pages,
-                                    hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
-                                    size_t total_rows)
+rmm::device_uvector<string_index_pair> reader::impl::decode_page_data(
+  hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+  hostdevice_vector<gpu::PageInfo>& pages,
+  hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+  size_t min_row,
+  size_t total_rows)
 {
   auto is_dict_chunk = [](const gpu::ColumnChunkDesc& chunk) {
     return (chunk.data_type & 0x7) == BYTE_ARRAY && chunk.num_dict_pages > 0;
@@ -1495,10 +2184,10 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
     gpu::BuildStringDictionaryIndex(chunks.device_ptr(), chunks.size(), _stream);
   }
 
-  gpu::DecodePageData(pages, chunks, total_rows, _stream);
+  gpu::DecodePageData(pages, chunks, min_row, total_rows, _stream);
   pages.device_to_host(_stream);
   page_nesting.device_to_host(_stream);
-  _stream.synchronize();
+  cudf::detail::synchronize_stream(_stream);
 
   // for list columns, add the final offset to every offset buffer.
   // TODO : make this happen in more efficiently. Maybe use thrust::for_each
@@ -1556,7 +2245,77 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chu
     }
   }
 
-  _stream.synchronize();
+  cudf::detail::synchronize_stream(_stream);
+
+  return str_dict_index;
+}
+
+/**
+ * @copydoc cudf::io::detail::parquet::make_dictionary_output_column
+ */
+std::unique_ptr<column> reader::impl::make_dictionary_output_column(
+  size_t col,
+  hostdevice_vector<gpu::ColumnChunkDesc> const& chunks,
+  hostdevice_vector<gpu::PageInfo> const& pages,
+  device_span<string_index_pair const> str_dict_index,
+  column_name_info* schema_info)
+{
+  auto& buf = _output_columns[col];
+  if (schema_info != nullptr) { schema_info->name = buf.name; }
+
+  auto const input_col =
+    std::find_if(_input_columns.begin(), _input_columns.end(), [&](auto const& input) {
+      return input.nesting_depth() == 1 && input.nesting[0] == static_cast<int>(col);
+    });
+  auto const input_col_idx = static_cast<int32_t>(std::distance(_input_columns.begin(), input_col));
+
+  // Decoded values can only be traced back to the dictionary entries if every data page of the
+  // column references the dictionary of its chunk
+  bool all_dict_encoded = input_col != _input_columns.end();
+  std::vector<std::pair<size_t, size_t>> dict_ranges;  // offset and size in str_dict_index
+  for (size_t c = 0, page_count = 0; c < chunks.size() && all_dict_encoded; c++) {
+    auto const& chunk = chunks[c];
+    if (chunk.src_col_index == input_col_idx) {
+      all_dict_encoded = chunk.str_dict_index != nullptr;
+      for (auto p = page_count + chunk.num_dict_pages;
+           p < page_count + chunk.max_num_pages && all_dict_encoded;
+           ++p) {
+        all_dict_encoded = pages[p].encoding == Encoding::PLAIN_DICTIONARY ||
+                           pages[p].encoding == Encoding::RLE_DICTIONARY;
+      }
+      if (all_dict_encoded) {
+        dict_ranges.emplace_back(chunk.str_dict_index - str_dict_index.data(),
+                                 pages[page_count].num_input_values);
+      }
+    }
+    page_count += chunk.max_num_pages;
+  }
+
+  if (not all_dict_encoded) {
+    auto const strings =
+      make_column(buf, nullptr, _stream, rmm::mr::get_current_device_resource());
+    return cudf::dictionary::detail::encode(
+      strings->view(), data_type{type_id::UINT32}, _stream, _mr);
+  }
+
+  // Gather the dictionary entries of all the chunks of the column
+  auto const num_entries = std::accumulate(
+    dict_ranges.begin(), dict_ranges.end(), size_t{0}, [](size_t sum, auto const& range) {
+      return sum + range.second;
+    });
+  rmm::device_uvector<string_index_pair> entries(num_entries, _stream);
+  for (size_t r = 0, entry_ofs = 0; r < dict_ranges.size(); ++r) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(entries.data() + entry_ofs,
+                                  str_dict_index.data() + dict_ranges[r].first,
+                                  dict_ranges[r].second * sizeof(string_index_pair),
+                                  cudaMemcpyDeviceToDevice,
+                                  _stream.value()));
+    entry_ofs += dict_ranges[r].second;
+  }
+
+  auto col = make_dictionary_from_entries(*buf._strings, entries, _stream, _mr);
+  buf._strings.reset();
+  return col;
 }
 
 reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
@@ -1566,7 +2325,14 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   : _stream(stream), _mr(mr), _sources(std::move(sources))
 {
   // Open and parse the source dataset metadata
-  _metadata = std::make_unique<aggregate_reader_metadata>(_sources);
+  // Footers of files may be reused from previous reads
+  auto const& source = options.get_source();
+  auto const cache_paths =
+    options.is_enabled_use_metadata_cache() && source.type() == io_type::FILEPATH
+      ? source.filepaths()
+      : std::vector<std::string>{};
+  _metadata = std::make_unique<aggregate_reader_metadata>(_sources, cache_paths);
+  _source_mutexes = std::vector<std::mutex>(_sources.size());
 
   // Override output timestamp resolution if requested
   if (options.get_timestamp_type().id() != type_id::EMPTY) {
@@ -1576,9 +2342,18 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  // Dictionary-encoded strings may be returned as dictionary columns
+  _keep_dictionary_encoding = options.is_enabled_keep_dictionary_encoding();
+
   // Binary columns can be read as binary or strings
   _force_binary_columns_as_strings = options.get_convert_binary_to_strings();
 
+  // Row groups are pruned using the filter and the surviving rows are filtered exactly
+  _filter = options.get_filter();
+  CUDF_EXPECTS(!_filter.has_value() || dynamic_cast<ast::operation const*>(&_filter->get()),
+               "The filter must be an AST operation");
+  _late_materialization = options.is_enabled_late_materialization();
+
   // Select only columns required by the options
   std::tie(_input_columns, _output_columns, _output_column_schemas) =
     _metadata->select_columns(options.get_columns(),
@@ -1587,112 +2362,702 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
                               _timestamp_type.id());
 }
 
-table_with_metadata reader::impl::read(std::vector<std::vector<size_type>> const& row_group_list)
+reader::impl::impl(std::size_t chunk_read_limit,
+                   std::vector<std::unique_ptr<datasource>>&& sources,
+                   parquet_reader_options const& options,
+                   rmm::cuda_stream_view stream,
+                   rmm::mr::device_memory_resource* mr)
+  : impl(std::move(sources), options, stream, mr)
 {
-  // Select only row groups required
-  const auto [selected_row_groups, num_rows] = _metadata->select_row_groups(row_group_list);
+  CUDF_EXPECTS(options.get_pipeline_depth() >= 0, "Pipeline depth cannot be negative");
+  CUDF_EXPECTS(options.get_skip_rows() == 0 && options.get_num_rows() == -1,
+               "The chunked reader does not support skip_rows and num_rows");
+  _pipeline_depth = options.get_pipeline_depth();
+  compute_chunk_row_groups(options.get_row_groups(), chunk_read_limit);
+}
 
-  table_metadata out_metadata;
+void reader::impl::compute_chunk_row_groups(
+  std::vector<std::vector<size_type>> const& row_group_indices, std::size_t chunk_read_limit)
+{
+  auto const selected_row_groups =
+    _metadata
+      ->select_row_groups(_filter.has_value() ? filter_row_groups(row_group_indices)
+                                              : row_group_indices)
+      .first;
+
+  // Estimate the size of the output columns decoded from a single row group; fixed-width data is
+  // sized exactly while variable-width data is approximated by its uncompressed page size.
+  auto const row_group_output_size = [&](auto const& rg) {
+    std::size_t size = 0;
+    for (auto const& col : _input_columns) {
+      auto const& col_meta =
+        _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+      auto const& schema = _metadata->get_schema(col.schema_idx);
+      auto const type =
+        to_data_type(to_type_id(schema, _strings_to_categorical, _timestamp_type.id()), schema);
+      auto const num_values = static_cast<std::size_t>(col_meta.num_values);
+      size += is_fixed_width(type)
+                ? num_values * size_of(type)
+                : static_cast<std::size_t>(col_meta.total_uncompressed_size) +
+                    num_values * sizeof(size_type);
+      if (schema.max_definition_level > 0) { size += bitmask_allocation_size_bytes(num_values); }
+    }
+    return size;
+  };
 
-  // output cudf columns as determined by the top level schema
-  std::vector<std::unique_ptr<column>> out_columns;
-  out_columns.reserve(_output_columns.size());
+  // Besides the byte limit, the rows of a chunk must fit in a column
+  auto constexpr max_chunk_rows = static_cast<int64_t>(std::numeric_limits<size_type>::max());
+  auto const empty_chunk        = std::vector<std::vector<size_type>>(_sources.size());
+  auto current_chunk            = empty_chunk;
+  std::size_t current_size      = 0;
+  int64_t current_rows          = 0;
+  size_type current_num_rgs     = 0;
+  for (auto const& rg : selected_row_groups) {
+    auto const rg_size = row_group_output_size(rg);
+    auto const rg_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+    CUDF_EXPECTS(rg_rows <= max_chunk_rows, "A row group exceeds the column size limit");
+    if (current_num_rgs > 0 &&
+        ((chunk_read_limit > 0 && current_size + rg_size > chunk_read_limit) ||
+         current_rows + rg_rows > max_chunk_rows)) {
+      _chunk_row_groups.push_back(std::move(current_chunk));
+      current_chunk   = empty_chunk;
+      current_size    = 0;
+      current_rows    = 0;
+      current_num_rgs = 0;
+    }
+    current_chunk[rg.source_index].push_back(rg.index);
+    current_size += rg_size;
+    current_rows += rg_rows;
+    ++current_num_rgs;
+  }
+  // Always produce at least one (possibly empty) chunk so the output schema is returned
+  if (current_num_rgs > 0 || _chunk_row_groups.empty()) {
+    _chunk_row_groups.push_back(std::move(current_chunk));
+  }
+}
 
-  if (selected_row_groups.size() != 0 && _input_columns.size() != 0) {
-    // Descriptors for all the chunks that make up the selected columns
-    const auto num_input_columns = _input_columns.size();
-    const auto num_chunks        = selected_row_groups.size() * num_input_columns;
-    hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, _stream);
-
-    // Association between each column chunk and its source
-    std::vector<size_type> chunk_source_map(num_chunks);
-
-    // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<std::unique_ptr<datasource::buffer>> page_data(num_chunks);
-
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
-
-    // if there are lists present, we need to preprocess
-    bool has_lists = false;
-
-    // Initialize column chunk information
-    size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
-    std::vector<std::future<void>> read_rowgroup_tasks;
-    for (const auto& rg : selected_row_groups) {
-      const auto& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
-      auto const row_group_start  = rg.start_row;
-      auto const row_group_source = rg.source_index;
-      auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto const io_chunk_idx     = chunks.size();
-
-      // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
-      for (size_t i = 0; i < num_input_columns; ++i) {
-        auto col = _input_columns[i];
-        // look up metadata
-        auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
-        auto& schema   = _metadata->get_schema(col.schema_idx);
-
-        // this column contains repetition levels and will require a preprocess
-        if (schema.max_repetition_level > 0) { has_lists = true; }
-
-        // Spec requires each row group to contain exactly one chunk for every
-        // column. If there are too many or too few, continue with best effort
-        if (chunks.size() >= chunks.max_size()) {
-          std::cerr << "Detected too many column chunks" << std::endl;
-          continue;
-        }
+std::vector<std::vector<size_type>> reader::impl::filter_row_groups(
+  std::vector<std::vector<size_type>> const& row_group_indices)
+{
+  auto const selected_row_groups = _metadata->select_row_groups(row_group_indices).first;
+
+  std::vector<std::vector<size_type>> filtered_row_groups(_sources.size());
+  for (auto const& rg : selected_row_groups) {
+    // Only flat leaf columns have chunk statistics that map directly to the output column
+    auto const flat_column_meta = [&](size_type col_idx) -> ColumnChunkMetaData const* {
+      CUDF_EXPECTS(col_idx >= 0 && col_idx < static_cast<size_type>(_output_column_schemas.size()),
+                   "Filter column index is out of range");
+      auto const schema_idx = _output_column_schemas[col_idx];
+      auto const& schema    = _metadata->get_schema(schema_idx);
+      if (schema.num_children != 0 || schema.max_repetition_level != 0) { return nullptr; }
+      return &_metadata->get_column_metadata(rg.index, rg.source_index, schema_idx);
+    };
+    auto const get_stats = [&](size_type col_idx) {
+      auto const col_meta = flat_column_meta(col_idx);
+      if (col_meta == nullptr) { return column_chunk_stats{}; }
+      return decode_chunk_stats(*col_meta,
+                                _metadata->get_schema(_output_column_schemas[col_idx]),
+                                _output_columns[col_idx].type.id());
+    };
+    auto const may_contain = [&](size_type col_idx, long double value) {
+      auto const col_meta = flat_column_meta(col_idx);
+      if (col_meta == nullptr) { return true; }
+      return bloom_filter_may_contain(*_sources[rg.source_index],
+                                      *col_meta,
+                                      _metadata->get_schema(_output_column_schemas[col_idx]),
+                                      _output_columns[col_idx].type.id(),
+                                      value);
+    };
+    auto const truth =
+      stats_expression_evaluator{get_stats, may_contain, _stream}.evaluate(_filter->get());
+    if (truth.can_be_true) { filtered_row_groups[rg.source_index].push_back(rg.index); }
+  }
+  return filtered_row_groups;
+}
+
+std::optional<std::pair<ColumnIndex, OffsetIndex>> reader::impl::read_page_index(
+  size_type row_group_index, size_type source_index, int schema_idx)
+{
+  auto const& chunk = _metadata->get_column_chunk(row_group_index, source_index, schema_idx);
+  if (chunk.column_index_length <= 0 || chunk.offset_index_length <= 0) { return std::nullopt; }
+
+  auto const [column_index_buffer, offset_index_buffer] = [&] {
+    std::lock_guard<std::mutex> lock(_source_mutexes[source_index]);
+    auto& source = *_sources[source_index];
+    return std::pair{source.host_read(chunk.column_index_offset, chunk.column_index_length),
+                     source.host_read(chunk.offset_index_offset, chunk.offset_index_length)};
+  }();
+  std::pair<ColumnIndex, OffsetIndex> page_index;
+  auto& [column_index, offset_index] = page_index;
+  CompactProtocolReader column_index_cp(column_index_buffer->data(), column_index_buffer->size());
+  CompactProtocolReader offset_index_cp(offset_index_buffer->data(), offset_index_buffer->size());
+  if (!column_index_cp.read(&column_index) || !offset_index_cp.read(&offset_index)) {
+    return std::nullopt;
+  }
+
+  // Both indexes must describe the same pages, the first of which starts the chunk
+  auto const& locations = offset_index.page_locations;
+  auto const num_pages  = locations.size();
+  if (num_pages == 0 || locations.front().first_row_index != 0 ||
+      column_index.null_pages.size() != num_pages || column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages) {
+    return std::nullopt;
+  }
+  auto const is_increasing = std::adjacent_find(
+    locations.begin(), locations.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.first_row_index >= rhs.first_row_index;
+    }) == locations.end();
+  if (!is_increasing) { return std::nullopt; }
+  return page_index;
+}
+
+std::vector<std::pair<size_type, size_type>> reader::impl::filter_page_ranges(
+  std::vector<row_group_info> const& selected_row_groups, size_type num_rows)
+{
+  std::vector<bool> is_filter_column(_output_columns.size(), false);
+  mark_column_references(_filter->get(), is_filter_column);
+
+  std::vector<std::pair<size_type, size_type>> ranges;
+  auto const add_range = [&](int64_t begin, int64_t end) {
+    begin = std::min<int64_t>(begin, num_rows);
+    end   = std::min<int64_t>(end, num_rows);
+    if (begin >= end) { return; }
+    if (!ranges.empty() && ranges.back().second == begin) {
+      ranges.back().second = end;
+    } else {
+      ranges.emplace_back(begin, end);
+    }
+  };
 
-        auto [type_width, clock_rate, converted_type] =
-          conversion_info(to_type_id(schema, _strings_to_categorical, _timestamp_type.id()),
-                          _timestamp_type.id(),
-                          schema.type,
-                          schema.converted_type,
-                          schema.type_length);
-
-        column_chunk_offsets[chunks.size()] =
-          (col_meta.dictionary_page_offset != 0)
-            ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
-            : col_meta.data_page_offset;
-
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
-                                           nullptr,
-                                           col_meta.num_values,
-                                           schema.type,
-                                           type_width,
-                                           row_group_start,
-                                           row_group_rows,
-                                           schema.max_definition_level,
-                                           schema.max_repetition_level,
-                                           _metadata->get_output_nesting_depth(col.schema_idx),
-                                           required_bits(schema.max_definition_level),
-                                           required_bits(schema.max_repetition_level),
-                                           col_meta.codec,
-                                           converted_type,
-                                           schema.logical_type,
-                                           schema.decimal_scale,
-                                           clock_rate,
-                                           i,
-                                           col.schema_idx));
-
-        // Map each column chunk to its column index and its source index
-        chunk_source_map[chunks.size() - 1] = row_group_source;
-
-        if (col_meta.codec != Compression::UNCOMPRESSED) {
-          total_decompressed_size += col_meta.total_uncompressed_size;
+  for (auto const& rg : selected_row_groups) {
+    auto const row_group_rows = _metadata->get_row_group(rg.index, rg.source_index).num_rows;
+
+    // Flat filter columns are evaluated over their pages when their chunk has a page index and
+    // over the whole chunk otherwise
+    std::vector<std::optional<std::pair<ColumnIndex, OffsetIndex>>> page_indexes(
+      _output_columns.size());
+    std::vector<column_chunk_stats> chunk_stats(_output_columns.size());
+    // Rows starting a page of any of the filter columns, plus the end of the row group
+    std::vector<int64_t> page_bounds{0, row_group_rows};
+    for (size_t col = 0; col < _output_columns.size(); ++col) {
+      if (!is_filter_column[col]) { continue; }
+      auto const schema_idx = _output_column_schemas[col];
+      auto const& schema    = _metadata->get_schema(schema_idx);
+      if (schema.num_children != 0 || schema.max_repetition_level != 0) { continue; }
+      page_indexes[col] = read_page_index(rg.index, rg.source_index, schema_idx);
+      if (!page_indexes[col].has_value()) {
+        chunk_stats[col] =
+          decode_chunk_stats(_metadata->get_column_metadata(rg.index, rg.source_index, schema_idx),
+                             schema,
+                             _output_columns[col].type.id());
+        continue;
+      }
+      for (auto const& page : page_indexes[col]->second.page_locations) {
+        if (page.first_row_index < row_group_rows) { page_bounds.push_back(page.first_row_index); }
+      }
+    }
+    std::sort(page_bounds.begin(), page_bounds.end());
+    page_bounds.erase(std::unique(page_bounds.begin(), page_bounds.end()), page_bounds.end());
+
+    // Within each interval between consecutive bounds, every filter column lies in a single page
+    for (size_t b = 0; b + 1 < page_bounds.size(); ++b) {
+      auto const first_row = page_bounds[b];
+      auto const get_stats = [&](size_type col_idx) {
+        auto const& page_index = page_indexes[col_idx];
+        if (!page_index.has_value()) { return chunk_stats[col_idx]; }
+        // last page starting at or before the first row of the interval
+        auto const& locations = page_index->second.page_locations;
+        auto const page_end   = std::upper_bound(
+          locations.begin(), locations.end(), first_row, [](int64_t row, auto const& location) {
+            return row < location.first_row_index;
+          });
+        return decode_page_stats(page_index->first,
+                                 std::distance(locations.begin(), page_end) - 1,
+                                 _metadata->get_schema(_output_column_schemas[col_idx]),
+                                 _output_columns[col_idx].type.id());
+      };
+      // The Bloom filters were already probed for the whole row group
+      auto const may_contain = [](size_type, long double) { return true; };
+      auto const truth =
+        stats_expression_evaluator{get_stats, may_contain, _stream}.evaluate(_filter->get());
+      if (truth.can_be_true) {
+        add_range(rg.start_row + first_row, rg.start_row + page_bounds[b + 1]);
+      }
+    }
+  }
+  return merge_row_ranges(ranges, page_filter_max_ranges);
+}
+
+bool reader::impl::has_next() { return _current_chunk < _chunk_row_groups.size(); }
+
+table_with_metadata reader::impl::read_chunk()
+{
+  // Return an empty table with the output schema once all the chunks have been read
+  if (!has_next()) { return read(0, -1, std::vector<std::vector<size_type>>(_sources.size())); }
+
+  // Issue the reads of the upcoming chunks so that their IO overlaps with decoding this one
+  auto const num_chunks_to_load =
+    std::min(_chunk_row_groups.size() - _current_chunk, static_cast<size_t>(_pipeline_depth) + 1);
+  while (_prefetched_chunks.size() < num_chunks_to_load) {
+    _prefetched_chunks.push_back(
+      load_row_group_data(_chunk_row_groups[_current_chunk + _prefetched_chunks.size()]));
+  }
+
+  auto data = std::move(_prefetched_chunks.front());
+  _prefetched_chunks.pop_front();
+  ++_current_chunk;
+  return decode_row_group_data(std::move(data));
+}
+
+std::vector<OffsetIndex> reader::impl::read_offset_indexes(size_type row_group_index,
+                                                           size_type source_index)
+{
+  std::vector<OffsetIndex> offset_indexes(_input_columns.size());
+  auto const get_chunk = [&](size_t col) -> ColumnChunk const& {
+    return _metadata->get_column_chunk(
+      row_group_index, source_index, _input_columns[col].schema_idx);
+  };
+
+  // The writer stores the offset indexes of the chunks of a row group next to each other, so they
+  // are fetched with a single read
+  int64_t begin = std::numeric_limits<int64_t>::max();
+  int64_t end   = 0;
+  for (size_t col = 0; col < _input_columns.size(); ++col) {
+    auto const& chunk = get_chunk(col);
+    if (chunk.offset_index_length <= 0) { continue; }
+    begin = std::min(begin, chunk.offset_index_offset);
+    end   = std::max(end, chunk.offset_index_offset + chunk.offset_index_length);
+  }
+  if (begin >= end) { return offset_indexes; }
+
+  auto const buffer = [&] {
+    std::lock_guard<std::mutex> lock(_source_mutexes[source_index]);
+    return _sources[source_index]->host_read(begin, end - begin);
+  }();
+  for (size_t col = 0; col < _input_columns.size(); ++col) {
+    auto const& chunk = get_chunk(col);
+    if (chunk.offset_index_length <= 0) { continue; }
+    CompactProtocolReader cp(buffer->data() + (chunk.offset_index_offset - begin),
+                             chunk.offset_index_length);
+    auto& locations = offset_indexes[col].page_locations;
+    // An index that does not start at the first row of the chunk cannot be used
+    if (!cp.read(&offset_indexes[col]) || locations.empty() ||
+        locations.front().first_row_index != 0) {
+      locations.clear();
+    }
+  }
+  return offset_indexes;
+}
+
+std::tuple<std::vector<row_group_info>, size_type, size_type> reader::impl::select_rows(
+  std::vector<std::vector<size_type>> const& row_group_list,
+  size_type skip_rows,
+  size_type num_rows)
+{
+  // Row groups are not pruned with the filter when a range of rows is read, so that the range
+  // refers to the rows of the sources
+  if (skip_rows != 0 || num_rows != -1) {
+    return _metadata->select_row_range(_metadata->select_row_groups({}).first, skip_rows, num_rows);
+  }
+  auto const filtered_row_groups =
+    _filter.has_value() ? filter_row_groups(row_group_list) : row_group_list;
+  auto [selection, row_count] = _metadata->select_row_groups(filtered_row_groups);
+  CUDF_EXPECTS(row_count <= std::numeric_limits<size_type>::max(),
+               "The number of rows to read exceeds the column size limit, use the chunked reader");
+  return {std::move(selection), 0, static_cast<size_type>(row_count)};
+}
+
+reader::impl::row_group_data reader::impl::load_row_group_data(
+  std::vector<std::vector<size_type>> const& row_group_list,
+  size_type skip_rows,
+  size_type num_rows)
+{
+  auto const [selected_row_groups, min_row, rows_to_read] =
+    select_rows(row_group_list, skip_rows, num_rows);
+  return load_row_group_data(
+    selected_row_groups, min_row, rows_to_read, skip_rows != 0 || num_rows != -1);
+}
+
+reader::impl::row_group_data reader::impl::load_row_group_data(
+  std::vector<row_group_info> const& selected_row_groups,
+  size_type min_row,
+  size_type rows_to_read,
+  bool use_offset_indexes)
+{
+  row_group_data data;
+
+  // this column contains repetition levels and will require a preprocess
+  data.has_lists = std::any_of(_input_columns.begin(), _input_columns.end(), [&](auto const& col) {
+    return _metadata->get_schema(col.schema_idx).max_repetition_level > 0;
+  });
+
+  // Lists cannot start decoding in the middle of a page, so their rows are decoded from the start
+  // of the first row group and the rows before `min_row` are dropped after decoding
+  data.min_row          = data.has_lists ? 0 : min_row;
+  data.first_output_row = data.has_lists ? min_row : 0;
+  data.num_rows         = rows_to_read + data.first_output_row;
+  for (auto const& rg : selected_row_groups) {
+    data.row_groups.emplace_back(rg.index, rg.source_index);
+  }
+  if (selected_row_groups.size() == 0 || _input_columns.size() == 0) { return data; }
+
+  // Descriptors for all the chunks that make up the selected columns
+  const auto num_input_columns = _input_columns.size();
+  const auto num_chunks        = selected_row_groups.size() * num_input_columns;
+  data.chunks                  = hostdevice_vector<gpu::ColumnChunkDesc>(0, num_chunks, _stream);
+  auto& chunks                 = data.chunks;
+
+  // Association between each column chunk and its source
+  std::vector<size_type> chunk_source_map(num_chunks);
+
+  // Tracker for eventually deallocating compressed and uncompressed data
+  data.page_data.resize(num_chunks);
+
+  // Keep track of column chunk file offsets
+  std::vector<size_t> column_chunk_offsets(num_chunks);
+  // Dictionary pages read separately from the data pages of their chunk, {offset, size}
+  std::vector<std::pair<size_t, size_t>> dictionary_ranges(num_chunks);
+
+  // Initialize column chunk information
+  auto remaining_rows = data.min_row + data.num_rows;
+  for (const auto& rg : selected_row_groups) {
+    const auto& row_group       = _metadata->get_row_group(rg.index, rg.source_index);
+    auto const row_group_start  = rg.start_row;
+    auto const row_group_source = rg.source_index;
+    auto const row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
+
+    // Only the pages covering the rows to read are fetched from chunks with an offset index
+    auto const offset_indexes = use_offset_indexes
+                                  ? read_offset_indexes(rg.index, rg.source_index)
+                                  : std::vector<OffsetIndex>(num_input_columns);
+    auto const rows_begin =
+      std::max<int64_t>(static_cast<int64_t>(data.min_row) - row_group_start, 0);
+    auto const rows_end = static_cast<int64_t>(row_group_rows);
+
+    // generate ColumnChunkDesc objects for everything to be decoded (all input columns)
+    for (size_t i = 0; i < num_input_columns; ++i) {
+      auto col = _input_columns[i];
+      // look up metadata
+      auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
+      auto& schema   = _metadata->get_schema(col.schema_idx);
+
+      // Spec requires each row group to contain exactly one chunk for every
+      // column. If there are too many or too few, continue with best effort
+      if (chunks.size() >= chunks.max_size()) {
+        std::cerr << "Detected too many column chunks" << std::endl;
+        continue;
+      }
+
+      auto [type_width, clock_rate, converted_type] =
+        conversion_info(to_type_id(schema, _strings_to_categorical, _timestamp_type.id()),
+                        _timestamp_type.id(),
+                        schema.type,
+                        schema.converted_type,
+                        schema.type_length);
+
+      auto const chunk_offset =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+      column_chunk_offsets[chunks.size()] = chunk_offset;
+      size_t chunk_size                   = col_meta.total_compressed_size;
+      size_t chunk_start_row              = row_group_start;
+      uint32_t chunk_rows                 = row_group_rows;
+
+      auto const& page_locations = offset_indexes[i].page_locations;
+      if (!page_locations.empty()) {
+        // last page starting at or before the first row to read, first page starting after the
+        // last row to read
+        auto const first_page = std::prev(std::upper_bound(
+          page_locations.begin(),
+          page_locations.end(),
+          rows_begin,
+          [](int64_t row, PageLocation const& page) { return row < page.first_row_index; }));
+        auto const end_page = std::lower_bound(
+          std::next(first_page),
+          page_locations.end(),
+          rows_end,
+          [](PageLocation const& page, int64_t row) { return page.first_row_index < row; });
+        auto const last_page = std::prev(end_page);
+        auto const data_end  = last_page->offset + last_page->compressed_page_size;
+        // the pages before the first data page hold the dictionary
+        auto const dictionary_size = page_locations.front().offset - chunk_offset;
+        if (first_page != page_locations.begin()) {
+          column_chunk_offsets[chunks.size()] = first_page->offset;
+          if (dictionary_size > 0) {
+            dictionary_ranges[chunks.size()] = {chunk_offset, dictionary_size};
+          }
         }
+        chunk_size = data_end - column_chunk_offsets[chunks.size()] +
+                     dictionary_ranges[chunks.size()].second;
+        auto const end_row =
+          end_page == page_locations.end() ? row_group.num_rows : end_page->first_row_index;
+        chunk_start_row = row_group_start + first_page->first_row_index;
+        chunk_rows      = std::min<int64_t>(end_row, row_group_rows) - first_page->first_row_index;
       }
-      // Read compressed chunk data to device memory
-      read_rowgroup_tasks.push_back(read_column_chunks(
-        page_data, chunks, io_chunk_idx, chunks.size(), column_chunk_offsets, chunk_source_map));
 
-      remaining_rows -= row_group.num_rows;
+      chunks.insert(gpu::ColumnChunkDesc(chunk_size,
+                                         nullptr,
+                                         col_meta.num_values,
+                                         schema.type,
+                                         type_width,
+                                         chunk_start_row,
+                                         chunk_rows,
+                                         schema.max_definition_level,
+                                         schema.max_repetition_level,
+                                         _metadata->get_output_nesting_depth(col.schema_idx),
+                                         required_bits(schema.max_definition_level),
+                                         required_bits(schema.max_repetition_level),
+                                         col_meta.codec,
+                                         converted_type,
+                                         schema.logical_type,
+                                         schema.decimal_scale,
+                                         clock_rate,
+                                         i,
+                                         col.schema_idx));
+
+      // Map each column chunk to its column index and its source index
+      chunk_source_map[chunks.size() - 1] = row_group_source;
+
+      if (col_meta.codec != Compression::UNCOMPRESSED) {
+        data.total_decompressed_size += col_meta.total_uncompressed_size;
+      }
     }
-    for (auto& task : read_rowgroup_tasks) {
-      task.wait();
+
+    remaining_rows -= row_group.num_rows;
+  }
+  assert(remaining_rows <= 0);
+
+  // Read compressed chunk data of all row groups to device memory at once, so that host reads
+  // from different row groups and sources can share a batch
+  data.read_tasks.push_back(read_column_chunks(data.page_data,
+                                               chunks,
+                                               0,
+                                               chunks.size(),
+                                               column_chunk_offsets,
+                                               dictionary_ranges,
+                                               chunk_source_map));
+
+  return data;
+}
+
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       std::vector<std::vector<size_type>> const& row_group_list)
+{
+  if (_late_materialization && _filter.has_value()) {
+    return read_late_materialized(skip_rows, num_rows, row_group_list);
+  }
+  if (_filter.has_value() && skip_rows == 0 && num_rows == -1) {
+    return read_filtered_pages(row_group_list);
+  }
+  return decode_row_group_data(load_row_group_data(row_group_list, skip_rows, num_rows));
+}
+
+table_with_metadata reader::impl::read_filtered_pages(
+  std::vector<std::vector<size_type>> const& row_group_list)
+{
+  auto const selection            = select_rows(row_group_list, 0, -1);
+  auto const& selected_row_groups = std::get<0>(selection);
+  auto const min_row              = std::get<1>(selection);
+  auto const rows_to_read         = std::get<2>(selection);
+
+  auto const ranges = filter_page_ranges(selected_row_groups, rows_to_read);
+  if (ranges.empty()) {
+    return decode_row_group_data(load_row_group_data(std::vector<row_group_info>{}, 0, 0, false));
+  }
+  if (ranges.size() == 1 && ranges.front().first == 0 && ranges.front().second == rows_to_read) {
+    return decode_row_group_data(
+      load_row_group_data(selected_row_groups, min_row, rows_to_read, false));
+  }
+
+  // Only the pages covering each range are read, the next range being read while the current one
+  // is decoded
+  auto const load_range = [&](std::pair<size_type, size_type> const& range) {
+    auto const [range_row_groups, range_min_row, range_rows] = _metadata->select_row_range(
+      selected_row_groups, min_row + range.first, range.second - range.first);
+    return load_row_group_data(range_row_groups, range_min_row, range_rows, true);
+  };
+  std::vector<std::unique_ptr<table>> pieces;
+  table_metadata out_metadata;
+  auto next_data = load_range(ranges.front());
+  for (size_t r = 0; r < ranges.size(); ++r) {
+    auto data = std::move(next_data);
+    if (r + 1 < ranges.size()) { next_data = load_range(ranges[r + 1]); }
+    auto decoded = decode_row_group_data(std::move(data));
+    if (r == 0) { out_metadata = std::move(decoded.metadata); }
+    pieces.push_back(std::move(decoded.tbl));
+  }
+  return {concatenate_pieces(std::move(pieces), _stream, _mr), std::move(out_metadata)};
+}
+
+reader::impl::column_selection reader::impl::select_column_subset(
+  std::vector<size_type> const& columns)
+{
+  column_selection all_columns{std::move(_input_columns),
+                               std::move(_output_columns),
+                               std::move(_output_column_schemas),
+                               _force_binary_columns_as_strings};
+  _input_columns.clear();
+  _output_columns.clear();
+  _output_column_schemas.clear();
+  if (_force_binary_columns_as_strings.has_value()) {
+    _force_binary_columns_as_strings->clear();
+  }
+
+  std::vector<int> subset_index(all_columns.output_columns.size(), -1);
+  for (auto const col : columns) {
+    subset_index[col] = static_cast<int>(_output_columns.size());
+    _output_columns.push_back(std::move(all_columns.output_columns[col]));
+    _output_column_schemas.push_back(all_columns.output_column_schemas[col]);
+    if (_force_binary_columns_as_strings.has_value()) {
+      auto const& as_strings = *all_columns.binary_as_strings;
+      _force_binary_columns_as_strings->push_back(
+        static_cast<size_t>(col) >= as_strings.size() || as_strings[col]);
+    }
+  }
+  // The first nesting level of an input column is the index of its top-level output column
+  for (auto const& input_col : all_columns.input_columns) {
+    if (subset_index[input_col.nesting[0]] < 0) { continue; }
+    _input_columns.push_back(input_col);
+    _input_columns.back().nesting[0] = subset_index[input_col.nesting[0]];
+  }
+  return all_columns;
+}
+
+void reader::impl::restore_columns(column_selection&& all_columns,
+                                   std::vector<size_type> const& columns)
+{
+  for (size_t i = 0; i < columns.size(); ++i) {
+    all_columns.output_columns[columns[i]] = std::move(_output_columns[i]);
+  }
+  _input_columns                   = std::move(all_columns.input_columns);
+  _output_columns                  = std::move(all_columns.output_columns);
+  _output_column_schemas           = std::move(all_columns.output_column_schemas);
+  _force_binary_columns_as_strings = std::move(all_columns.binary_as_strings);
+}
+
+table_with_metadata reader::impl::read_late_materialized(
+  size_type skip_rows,
+  size_type num_rows,
+  std::vector<std::vector<size_type>> const& row_group_list)
+{
+  auto const& filter = dynamic_cast<ast::operation const&>(_filter->get());
+  std::vector<bool> is_filter_column(_output_columns.size(), false);
+  mark_column_references(filter, is_filter_column);
+  std::vector<size_type> filter_columns;
+  std::vector<size_type> other_columns;
+  for (size_type i = 0; i < static_cast<size_type>(_output_columns.size()); ++i) {
+    (is_filter_column[i] ? filter_columns : other_columns).push_back(i);
+  }
+  if (filter_columns.empty() || other_columns.empty()) {
+    return decode_row_group_data(load_row_group_data(row_group_list, skip_rows, num_rows));
+  }
+
+  // The row groups are selected (and pruned) once, the ranges of rows decoded by both phases are
+  // relative to the selection
+  auto const selection            = select_rows(row_group_list, skip_rows, num_rows);
+  auto const& selected_row_groups = std::get<0>(selection);
+  auto const min_row              = std::get<1>(selection);
+
+  // Decode the columns referenced by the filter and evaluate it
+  auto all_columns  = select_column_subset(filter_columns);
+  auto filter_table = decode_row_group_data(
+    load_row_group_data(
+      selected_row_groups, min_row, std::get<2>(selection), skip_rows != 0 || num_rows != -1),
+    false);
+  restore_columns(std::move(all_columns), filter_columns);
+
+  // The filter refers to the columns by their index in the output table; the columns it does not
+  // reference are stood in for by all-null columns without data
+  auto const num_filter_rows = filter_table.tbl->num_rows();
+  std::vector<column_view> filter_input(
+    _output_columns.size(),
+    column_view{data_type{type_id::EMPTY}, num_filter_rows, nullptr, nullptr, num_filter_rows});
+  for (size_t i = 0; i < filter_columns.size(); ++i) {
+    filter_input[filter_columns[i]] = filter_table.tbl->get_column(i).view();
+  }
+  auto const predicate = cudf::detail::compute_column(
+    table_view{filter_input}, filter, _stream, rmm::mr::get_current_device_resource());
+  CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8,
+               "The filter must evaluate to a boolean column");
+  auto filtered = cudf::detail::apply_boolean_mask(
+    filter_table.tbl->view(), predicate->view(), _stream, _mr);
+
+  // Decode the other columns over the ranges of rows containing passing rows only, reading the
+  // next range while the current one is decoded
+  auto const ranges     = passing_row_ranges(predicate->view(), _stream);
+  auto const load_range = [&](std::pair<size_type, size_type> const& range) {
+    auto const [range_row_groups, range_min_row, range_rows] = _metadata->select_row_range(
+      selected_row_groups, min_row + range.first, range.second - range.first);
+    return load_row_group_data(range_row_groups, range_min_row, range_rows, true);
+  };
+  all_columns = select_column_subset(other_columns);
+  std::vector<std::unique_ptr<table>> pieces;
+  table_metadata other_metadata;
+  auto next_data = ranges.empty() ? row_group_data{} : load_range(ranges.front());
+  for (size_t r = 0; r < std::max<size_t>(ranges.size(), 1); ++r) {
+    auto data = std::move(next_data);
+    if (r + 1 < ranges.size()) { next_data = load_range(ranges[r + 1]); }
+    auto decoded = decode_row_group_data(std::move(data), false);
+    if (r == 0) { other_metadata = std::move(decoded.metadata); }
+    if (ranges.empty()) {
+      pieces.push_back(std::move(decoded.tbl));
+      continue;
+    }
+    auto const range_predicate =
+      cudf::slice(predicate->view(), {ranges[r].first, ranges[r].second}).front();
+    pieces.push_back(
+      cudf::detail::apply_boolean_mask(decoded.tbl->view(), range_predicate, _stream, _mr));
+  }
+  restore_columns(std::move(all_columns), other_columns);
+
+  auto other_table = concatenate_pieces(std::move(pieces), _stream, _mr);
+
+  // Interleave the columns of both phases back into the output order
+  auto out_metadata  = std::move(filter_table.metadata);
+  auto filter_output = filtered->release();
+  auto other_output  = other_table->release();
+  std::vector<std::unique_ptr<column>> out_columns;
+  std::vector<column_name_info> schema_info;
+  std::vector<std::string> column_names;
+  size_t next_filter_col = 0;
+  size_t next_other_col  = 0;
+  for (size_t i = 0; i < _output_columns.size(); ++i) {
+    auto const is_filter = is_filter_column[i];
+    auto const idx       = is_filter ? next_filter_col++ : next_other_col++;
+    auto& metadata       = is_filter ? out_metadata : other_metadata;
+    out_columns.push_back(std::move(is_filter ? filter_output[idx] : other_output[idx]));
+    schema_info.push_back(std::move(metadata.schema_info[idx]));
+    column_names.push_back(std::move(metadata.column_names[idx]));
+  }
+  out_metadata.schema_info  = std::move(schema_info);
+  out_metadata.column_names = std::move(column_names);
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+}
+
+table_with_metadata reader::impl::decode_row_group_data(row_group_data&& data, bool apply_filter)
+{
+  table_metadata out_metadata;
+
+  // output cudf columns as determined by the top level schema
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(_output_columns.size());
+
+  if (data.chunks.size() != 0) {
+    auto& chunks                       = data.chunks;
+    auto& page_data                    = data.page_data;
+    auto const min_row                 = data.min_row;
+    auto const num_rows                = data.num_rows;
+    auto const has_lists               = data.has_lists;
+    auto const total_decompressed_size = data.total_decompressed_size;
+
+    // Wait for the compressed chunk data to land in device memory
+    for (auto& task : data.read_tasks) {
+      task.get();
     }
-    assert(remaining_rows <= 0);
+    data.read_tasks.clear();
 
     // Process dataset chunk pages into output columns
     const auto total_pages = count_page_headers(chunks);
@@ -1742,7 +3107,8 @@ table_with_metadata reader::impl::read(std::vector<std::vector<size_type>> const
       preprocess_columns(chunks, pages, num_rows, has_lists);
 
       // decoding of column data itself
-      decode_page_data(chunks, pages, page_nesting_info, num_rows);
+      auto const str_dict_index =
+        decode_page_data(chunks, pages, page_nesting_info, min_row, num_rows);
 
       auto make_output_column = [&](column_buffer& buf, column_name_info* schema_info, int i) {
         auto col = make_column(buf, schema_info, _stream, _mr);
@@ -1765,7 +3131,10 @@ table_with_metadata reader::impl::read(std::vector<std::vector<size_type>> const
       // create the final output cudf columns
       for (size_t i = 0; i < _output_columns.size(); ++i) {
         column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-        out_columns.emplace_back(make_output_column(_output_columns[i], &col_name, i));
+        out_columns.emplace_back(
+          should_write_dictionary(i)
+            ? make_dictionary_output_column(i, chunks, pages, str_dict_index, &col_name)
+            : make_output_column(_output_columns[i], &col_name, i));
       }
     }
   }
@@ -1773,7 +3142,12 @@ table_with_metadata reader::impl::read(std::vector<std::vector<size_type>> const
   // Create empty columns as needed (this can happen if we've ended up with no actual data to read)
   for (size_t i = out_columns.size(); i < _output_columns.size(); ++i) {
     column_name_info& col_name = out_metadata.schema_info.emplace_back("");
-    out_columns.emplace_back(io::detail::empty_like(_output_columns[i], &col_name, _stream, _mr));
+    auto col = io::detail::empty_like(_output_columns[i], &col_name, _stream, _mr);
+    if (should_write_dictionary(i)) {
+      col_name.children.clear();
+      col = cudf::dictionary::detail::encode(col->view(), data_type{type_id::UINT32}, _stream, _mr);
+    }
+    out_columns.emplace_back(std::move(col));
   }
 
   // Return column names (must match order of returned columns)
@@ -1788,7 +3162,59 @@ table_with_metadata reader::impl::read(std::vector<std::vector<size_type>> const
   out_metadata.user_data          = {out_metadata.per_file_user_data[0].begin(),
                             out_metadata.per_file_user_data[0].end()};
 
-  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+  auto out_table = std::make_unique<table>(std::move(out_columns));
+  if (data.first_output_row > 0 && out_table->num_rows() > 0) {
+    auto const rows =
+      cudf::slice(out_table->view(), {data.first_output_row, out_table->num_rows()});
+    out_table = std::make_unique<table>(rows.front(), _stream, _mr);
+  }
+  if (apply_filter && _filter.has_value()) {
+    // Row groups surviving the pruning may still contain rows not satisfying the filter
+    auto const predicate = cudf::detail::compute_column(
+      out_table->view(),
+      dynamic_cast<ast::operation const&>(_filter->get()),
+      _stream,
+      rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->type().id() == type_id::BOOL8,
+                 "The filter must evaluate to a boolean column");
+    out_table =
+      cudf::detail::apply_boolean_mask(out_table->view(), predicate->view(), _stream, _mr);
+  }
+
+  // Bounds from the chunk statistics hold for any subset of the rows of the row groups
+  for (size_t i = 0; i < _output_columns.size(); ++i) {
+    auto const type = _output_columns[i].type;
+    if (not cudf::is_integral(type) or type.id() == type_id::BOOL8 or should_write_dictionary(i) or
+        data.row_groups.empty()) {
+      continue;
+    }
+    auto const schema_idx = _output_column_schemas[i];
+    auto const& schema    = _metadata->get_schema(schema_idx);
+    if (schema.num_children != 0 || schema.max_repetition_level != 0) { continue; }
+
+    std::optional<std::pair<long double, long double>> range;
+    bool all_chunks_have_range = true;
+    for (auto const& [rg_index, source_index] : data.row_groups) {
+      auto const stats = decode_chunk_stats(
+        _metadata->get_column_metadata(rg_index, source_index, schema_idx), schema, type.id());
+      if (stats.all_nulls) { continue; }
+      if (not stats.has_range) {
+        all_chunks_have_range = false;
+        break;
+      }
+      range = range.has_value() ? std::pair{std::min(range->first, stats.min),
+                                            std::max(range->second, stats.max)}
+                                : std::pair{stats.min, stats.max};
+    }
+    if (not all_chunks_have_range or not range.has_value()) { continue; }
+
+    auto properties = std::make_shared<column_properties>();
+    properties->min = type_dispatcher(type, make_bound_fn{}, range->first, _stream);
+    properties->max = type_dispatcher(type, make_bound_fn{}, range->second, _stream);
+    out_table->get_column(i).set_properties(std::move(properties));
+  }
+
+  return {std::move(out_table), std::move(out_metadata)};
 }
 
 // Forward to implementation
@@ -1800,13 +3226,164 @@ reader::reader(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
 {
 }
 
+reader::reader() = default;
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
 // Forward to implementation
 table_with_metadata reader::read(parquet_reader_options const& options)
 {
-  return _impl->read(options.get_row_groups());
+  return _impl->read(options.get_skip_rows(), options.get_num_rows(), options.get_row_groups());
+}
+
+// Forward to implementation
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               parquet_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr)
+{
+  _impl = std::make_unique<impl>(chunk_read_limit, std::move(sources), options, stream, mr);
+}
+
+// Destructor within this translation unit
+chunked_reader::~chunked_reader() = default;
+
+// Forward to implementation
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata chunked_reader::read_chunk() const { return _impl->read_chunk(); }
+
+namespace {
+
+std::string type_name(Type type)
+{
+  switch (type) {
+    case BOOLEAN: return "BOOLEAN";
+    case INT32: return "INT32";
+    case INT64: return "INT64";
+    case INT96: return "INT96";
+    case FLOAT: return "FLOAT";
+    case DOUBLE: return "DOUBLE";
+    case BYTE_ARRAY: return "BYTE_ARRAY";
+    case FIXED_LEN_BYTE_ARRAY: return "FIXED_LEN_BYTE_ARRAY";
+    default: return "";
+  }
+}
+
+std::string repetition_name(FieldRepetitionType repetition)
+{
+  switch (repetition) {
+    case OPTIONAL: return "OPTIONAL";
+    case REPEATED: return "REPEATED";
+    default: return "REQUIRED";
+  }
+}
+
+std::string encoding_name(Encoding encoding)
+{
+  switch (encoding) {
+    case Encoding::PLAIN: return "PLAIN";
+    case Encoding::GROUP_VAR_INT: return "GROUP_VAR_INT";
+    case Encoding::PLAIN_DICTIONARY: return "PLAIN_DICTIONARY";
+    case Encoding::RLE: return "RLE";
+    case Encoding::BIT_PACKED: return "BIT_PACKED";
+    case Encoding::DELTA_BINARY_PACKED: return "DELTA_BINARY_PACKED";
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY: return "DELTA_LENGTH_BYTE_ARRAY";
+    case Encoding::DELTA_BYTE_ARRAY: return "DELTA_BYTE_ARRAY";
+    case Encoding::RLE_DICTIONARY: return "RLE_DICTIONARY";
+    case Encoding::BYTE_STREAM_SPLIT: return "BYTE_STREAM_SPLIT";
+    default: return "UNKNOWN";
+  }
+}
+
+std::string compression_name(Compression compression)
+{
+  switch (compression) {
+    case UNCOMPRESSED: return "UNCOMPRESSED";
+    case SNAPPY: return "SNAPPY";
+    case GZIP: return "GZIP";
+    case LZO: return "LZO";
+    case BROTLI: return "BROTLI";
+    case LZ4: return "LZ4";
+    case ZSTD: return "ZSTD";
+    case LZ4_RAW: return "LZ4_RAW";
+    default: return "UNKNOWN";
+  }
+}
+
+parquet_column_schema make_column_schema(std::vector<SchemaElement> const& schema, size_t idx)
+{
+  auto const& element = schema[idx];
+  parquet_column_schema column{
+    element.name, type_name(element.type), repetition_name(element.repetition_type), {}};
+  for (auto const child_idx : element.children_idx) {
+    column.children.push_back(make_column_schema(schema, child_idx));
+  }
+  return column;
+}
+
+std::optional<parquet_column_chunk_statistics> parse_statistics(
+  ColumnChunkMetaData const& chunk_meta)
+{
+  if (chunk_meta.statistics_blob.empty()) { return std::nullopt; }
+  Statistics stats;
+  CompactProtocolReader cp(chunk_meta.statistics_blob.data(), chunk_meta.statistics_blob.size());
+  if (not cp.read(&stats)) { return std::nullopt; }
+
+  // The deprecated min and max are only written by older writers, which lack the new ones
+  auto const to_value = [](std::vector<uint8_t> const& value,
+                           std::vector<uint8_t> const& deprecated_value) {
+    auto const& bytes = value.empty() ? deprecated_value : value;
+    return bytes.empty() ? std::nullopt
+                         : std::optional<std::string>{std::string(bytes.begin(), bytes.end())};
+  };
+
+  parquet_column_chunk_statistics result;
+  if (stats.null_count >= 0) { result.null_count = stats.null_count; }
+  if (stats.distinct_count >= 0) { result.distinct_count = stats.distinct_count; }
+  result.min_value = to_value(stats.min_value, stats.min);
+  result.max_value = to_value(stats.max_value, stats.max);
+  return result;
+}
+
+}  // namespace
+
+parquet_metadata read_metadata(datasource* source)
+{
+  auto const md = metadata(source);
+
+  parquet_metadata result;
+  result.schema   = make_column_schema(md.schema, 0);
+  result.num_rows = md.num_rows;
+  for (auto const& kv : md.key_value_metadata) {
+    result.key_value_metadata.insert_or_assign(kv.key, kv.value);
+  }
+
+  result.row_groups.reserve(md.row_groups.size());
+  for (auto const& rg : md.row_groups) {
+    auto& row_group = result.row_groups.emplace_back(
+      parquet_row_group_metadata{rg.num_rows, rg.total_byte_size, {}});
+    row_group.columns.reserve(rg.columns.size());
+    for (auto const& chunk : rg.columns) {
+      auto const& chunk_meta = chunk.meta_data;
+      std::vector<std::string> encodings;
+      std::transform(chunk_meta.encodings.cbegin(),
+                     chunk_meta.encodings.cend(),
+                     std::back_inserter(encodings),
+                     encoding_name);
+      row_group.columns.push_back({chunk_meta.path_in_schema,
+                                   compression_name(chunk_meta.codec),
+                                   std::move(encodings),
+                                   chunk_meta.num_values,
+                                   chunk_meta.total_compressed_size,
+                                   chunk_meta.total_uncompressed_size,
+                                   parse_statistics(chunk_meta)});
+    }
+  }
+  return result;
 }
 
 }  // namespace parquet
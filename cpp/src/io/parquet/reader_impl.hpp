@@ -21,8 +21,10 @@
 
 #pragma once
 
+#include "host_read_batch.hpp"
 #include "parquet.hpp"
 #include "parquet_gpu.hpp"
+#include "row_group_selection.hpp"
 
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
@@ -30,11 +32,19 @@
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -69,13 +79,252 @@ class reader::impl {
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` reads all the rows after `skip_rows`
    * @param row_group_indices Lists of row groups to read, one per source
    *
    * @return The set of columns along with metadata
    */
-  table_with_metadata read(std::vector<std::vector<size_type>> const& row_group_indices);
+  table_with_metadata read(size_type skip_rows,
+                           size_type num_rows,
+                           std::vector<std::vector<size_type>> const& row_group_indices);
+
+  /**
+   * @brief Constructor from a chunk read limit and an array of dataset sources with reader options.
+   *
+   * The selected row groups are split into consecutive chunks, each with an estimated output size
+   * not exceeding `chunk_read_limit` bytes (a single row group larger than the limit forms a chunk
+   * of its own).
+   *
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   * @param sources Dataset sources
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit impl(std::size_t chunk_read_limit,
+                std::vector<std::unique_ptr<datasource>>&& sources,
+                parquet_reader_options const& options,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::has_next
+   */
+  bool has_next();
+
+  /**
+   * @copydoc cudf::io::chunked_parquet_reader::read_chunk
+   */
+  table_with_metadata read_chunk();
 
  private:
+  /**
+   * @brief Column chunk descriptors and compressed page data of a set of row groups, along with
+   * the outstanding reads that fill the data.
+   */
+  struct row_group_data {
+    size_type min_row          = 0;  // first row to decode, relative to the first row group
+    size_type num_rows         = 0;  // number of rows to decode
+    size_type first_output_row = 0;  // number of decoded rows dropped from the output
+    hostdevice_vector<gpu::ColumnChunkDesc> chunks;
+    std::vector<std::unique_ptr<datasource::buffer>> page_data;
+    std::vector<std::future<void>> read_tasks;
+    bool has_lists                 = false;
+    size_t total_decompressed_size = 0;
+    std::vector<std::pair<size_type, size_type>> row_groups;  // {index, source index} of each
+                                                              // row group the data comes from
+
+    row_group_data()                            = default;
+    row_group_data(row_group_data&&)            = default;
+    row_group_data& operator=(row_group_data&&) = default;
+    ~row_group_data()
+    {
+      // Outstanding reads write into the buffers owned by this object
+      for (auto& task : read_tasks) {
+        if (task.valid()) { task.wait(); }
+      }
+    }
+  };
+
+  /**
+   * @brief The input columns decoded by the reader and the output columns built from them.
+   */
+  struct column_selection {
+    std::vector<input_column_info> input_columns;
+    std::vector<column_buffer> output_columns;
+    std::vector<int> output_column_schemas;
+    std::optional<std::vector<bool>> binary_as_strings;
+  };
+
+  /**
+   * @brief Selects the row groups and the range of their rows to read.
+   *
+   * When a range of rows is given, the row groups of the sources overlapping the range are
+   * selected, otherwise the given row groups surviving the filter are.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   *
+   * @return The selected row groups, the number of rows of the first one to skip and the number
+   * of rows to read
+   */
+  std::tuple<std::vector<row_group_info>, size_type, size_type> select_rows(
+    std::vector<std::vector<size_type>> const& row_group_indices,
+    size_type skip_rows,
+    size_type num_rows);
+
+  /**
+   * @brief Sets up the column chunk descriptors of the given row groups and issues the reads of
+   * their compressed data, without waiting for the reads to complete.
+   *
+   * When a range of rows is given, the row groups overlapping the range are selected instead, and
+   * only the pages covering the range are read from the column chunks that have an offset index.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   *
+   * @return The column chunks along with the pending reads
+   */
+  row_group_data load_row_group_data(std::vector<std::vector<size_type>> const& row_group_indices,
+                                     size_type skip_rows = 0,
+                                     size_type num_rows  = -1);
+
+  /**
+   * @brief Sets up the column chunk descriptors of a range of rows of the selected row groups and
+   * issues the reads of their compressed data, without waiting for the reads to complete.
+   *
+   * @param selected_row_groups Selected row groups, with start rows relative to the first one
+   * @param min_row Number of rows of the first row group to skip
+   * @param rows_to_read Number of rows to read
+   * @param use_offset_indexes Whether to read only the pages covering the rows from the column
+   * chunks that have an offset index
+   *
+   * @return The column chunks along with the pending reads
+   */
+  row_group_data load_row_group_data(std::vector<row_group_info> const& selected_row_groups,
+                                     size_type min_row,
+                                     size_type rows_to_read,
+                                     bool use_offset_indexes);
+
+  /**
+   * @brief Reads the offset indexes of the input column chunks of a row group.
+   *
+   * @param row_group_index Index of the row group in its source
+   * @param source_index Index of the source
+   *
+   * @return Offset index of each input column; without page locations if the chunk has none
+   */
+  std::vector<OffsetIndex> read_offset_indexes(size_type row_group_index, size_type source_index);
+
+  /**
+   * @brief Waits for the reads of the given row group data and decodes it into output columns.
+   *
+   * @param data Column chunks returned by `load_row_group_data()`
+   * @param apply_filter Whether to drop the rows not satisfying the filter
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata decode_row_group_data(row_group_data&& data, bool apply_filter = true);
+
+  /**
+   * @brief Reads the columns referenced by the filter first, then the other columns only over the
+   * ranges of rows containing rows that satisfy the filter.
+   *
+   * @param skip_rows Number of rows to skip from the start
+   * @param num_rows Number of rows to read; `-1` reads all the rows after `skip_rows`
+   * @param row_group_indices Lists of row groups to read, one per source
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_late_materialized(
+    size_type skip_rows,
+    size_type num_rows,
+    std::vector<std::vector<size_type>> const& row_group_indices);
+
+  /**
+   * @brief Narrows the columns to decode to a subset of the output columns.
+   *
+   * @param columns Indices of the output columns to decode, in increasing order
+   *
+   * @return The columns decoded before the call, to be put back with `restore_columns()`
+   */
+  column_selection select_column_subset(std::vector<size_type> const& columns);
+
+  /**
+   * @brief Puts back the columns replaced by `select_column_subset()`.
+   *
+   * @param all_columns Columns returned by `select_column_subset()`
+   * @param columns Indices of the output columns passed to `select_column_subset()`
+   */
+  void restore_columns(column_selection&& all_columns, std::vector<size_type> const& columns);
+
+  /**
+   * @brief Splits the selected row groups into chunks bounded by the given byte limit.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   * @param chunk_read_limit Limit on total number of bytes to be returned per read,
+   *        or `0` if there is no limit
+   */
+  void compute_chunk_row_groups(std::vector<std::vector<size_type>> const& row_group_indices,
+                                std::size_t chunk_read_limit);
+
+  /**
+   * @brief Removes the row groups whose statistics prove that no row satisfies the filter.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   *
+   * @return Lists of row groups that may contain rows satisfying the filter, one per source
+   */
+  std::vector<std::vector<size_type>> filter_row_groups(
+    std::vector<std::vector<size_type>> const& row_group_indices);
+
+  /**
+   * @brief Reads the page index, i.e. the column index and the offset index, of a column chunk.
+   *
+   * @param row_group_index Index of the row group in its source
+   * @param source_index Index of the source
+   * @param schema_idx Schema index of the column
+   *
+   * @return The column index and the offset index, or `nullopt` if the chunk has no usable page
+   * index
+   */
+  std::optional<std::pair<ColumnIndex, OffsetIndex>> read_page_index(size_type row_group_index,
+                                                                     size_type source_index,
+                                                                     int schema_idx);
+
+  /**
+   * @brief Returns the ranges of rows of the selected row groups whose page statistics do not
+   * prove that no row satisfies the filter.
+   *
+   * The pages of the flat columns referenced by the filter are evaluated through the column index
+   * of their chunk; chunks without a page index are evaluated through their chunk statistics.
+   *
+   * @param selected_row_groups Selected row groups, with start rows relative to the first one
+   * @param num_rows Number of rows of the selected row groups
+   *
+   * @return Ranges of rows `[begin, end)` relative to the selection, in increasing order
+   */
+  std::vector<std::pair<size_type, size_type>> filter_page_ranges(
+    std::vector<row_group_info> const& selected_row_groups, size_type num_rows);
+
+  /**
+   * @brief Reads and decodes only the pages of the row groups surviving the filter that may
+   * contain rows satisfying it, then filters the rows exactly.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_filtered_pages(
+    std::vector<std::vector<size_type>> const& row_group_indices);
+
+  // Host reads are batched together until a batch reaches this size
+  static constexpr size_t host_read_batch_size = 16 * 1024 * 1024;
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -84,14 +333,19 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param dictionary_ranges File offset and size of the dictionary pages read separately from
+   * the data pages of their chunk, size 0 for chunks read in a single range
+   * @param chunk_source_map Source index of all chunks
    *
    */
-  std::future<void> read_column_chunks(std::vector<std::unique_ptr<datasource::buffer>>& page_data,
-                                       hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                                       size_t begin_chunk,
-                                       size_t end_chunk,
-                                       const std::vector<size_t>& column_chunk_offsets,
-                                       std::vector<size_type> const& chunk_source_map);
+  std::future<void> read_column_chunks(
+    std::vector<std::unique_ptr<datasource::buffer>>& page_data,
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    size_t begin_chunk,
+    size_t end_chunk,
+    const std::vector<size_t>& column_chunk_offsets,
+    std::vector<std::pair<size_t, size_t>> const& dictionary_ranges,
+    std::vector<size_type> const& chunk_source_map);
 
   /**
    * @brief Returns the number of total pages from the given column chunks
@@ -167,12 +421,51 @@ class reader::impl {
    * @param chunks List of column chunk descriptors
    * @param pages List of page information
    * @param page_nesting Page nesting array
+   * @param min_row First row to output
    * @param total_rows Number of rows to output
+   *
+   * @return Index of the string dictionary entries referenced by `chunks`
    */
-  void decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
-                        hostdevice_vector<gpu::PageInfo>& pages,
-                        hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
-                        size_t total_rows);
+  rmm::device_uvector<string_index_pair> decode_page_data(
+    hostdevice_vector<gpu::ColumnChunkDesc>& chunks,
+    hostdevice_vector<gpu::PageInfo>& pages,
+    hostdevice_vector<gpu::PageNestingInfo>& page_nesting,
+    size_t min_row,
+    size_t total_rows);
+
+  /**
+   * @brief Creates a dictionary column from a decoded top-level string column.
+   *
+   * If every data page of the column is dictionary-encoded, the keys are built from the Parquet
+   * dictionaries and the indices from the decoded dictionary references, without expanding the
+   * strings. Otherwise the decoded strings column is dictionary-encoded.
+   *
+   * @param col Index of the output column
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param str_dict_index Index of the string dictionary entries returned by `decode_page_data`
+   * @param schema_info Output schema information of the column
+   *
+   * @return The dictionary column
+   */
+  std::unique_ptr<column> make_dictionary_output_column(
+    size_t col,
+    hostdevice_vector<gpu::ColumnChunkDesc> const& chunks,
+    hostdevice_vector<gpu::PageInfo> const& pages,
+    device_span<string_index_pair const> str_dict_index,
+    column_name_info* schema_info);
+
+  /**
+   * @brief Indicates if a column should be returned as a dictionary column
+   *
+   * @param col column to check
+   * @return true if the column is a flat string column to be returned as a dictionary column
+   */
+  bool should_write_dictionary(int col)
+  {
+    return _keep_dictionary_encoding && _output_columns[col].type.id() == type_id::STRING &&
+           _output_columns[col].children.empty() && !should_write_byte_array(col);
+  }
 
   /**
    * @brief Indicates if a column should be written as a byte array
@@ -202,9 +495,23 @@ class reader::impl {
   // _output_columns associated schema indices
   std::vector<int> _output_column_schemas;
 
-  bool _strings_to_categorical = false;
+  bool _strings_to_categorical   = false;
+  bool _keep_dictionary_encoding = false;
   std::optional<std::vector<bool>> _force_binary_columns_as_strings;
   data_type _timestamp_type{type_id::EMPTY};
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+  bool _late_materialization = false;
+
+  // Serializes host reads issued concurrently to the same source
+  std::vector<std::mutex> _source_mutexes;
+
+  // Row groups to read for each chunk, one list per source (chunked reading only)
+  std::vector<std::vector<std::vector<size_type>>> _chunk_row_groups;
+  std::size_t _current_chunk = 0;
+  // Number of chunks whose reads are issued ahead of the chunk being decoded
+  size_type _pipeline_depth = 0;
+  // Chunks whose reads are in flight, starting with chunk `_current_chunk`
+  std::deque<row_group_data> _prefetched_chunks;
 };
 
 }  // namespace parquet
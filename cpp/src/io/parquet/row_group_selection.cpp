@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "row_group_selection.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+std::pair<std::vector<row_group_info>, int64_t> select_row_groups(
+  std::vector<std::vector<size_type>> const& row_groups,
+  std::vector<std::vector<int64_t>> const& row_group_num_rows)
+{
+  std::vector<row_group_info> selection;
+  int64_t row_count = 0;
+  auto const select = [&](size_type rg_idx, size_type src_idx) {
+    auto const num_rows = row_group_num_rows[src_idx][rg_idx];
+    CUDF_EXPECTS(num_rows >= 0, "Invalid row count");
+    selection.emplace_back(rg_idx, row_count, src_idx);
+    row_count += num_rows;
+  };
+
+  if (!row_groups.empty()) {
+    CUDF_EXPECTS(row_groups.size() == row_group_num_rows.size(),
+                 "Must specify row groups for each source");
+    for (size_t src_idx = 0; src_idx < row_groups.size(); ++src_idx) {
+      for (auto const& rowgroup_idx : row_groups[src_idx]) {
+        CUDF_EXPECTS(
+          rowgroup_idx >= 0 &&
+            rowgroup_idx < static_cast<size_type>(row_group_num_rows[src_idx].size()),
+          "Invalid rowgroup index");
+        select(rowgroup_idx, src_idx);
+      }
+    }
+    return {std::move(selection), row_count};
+  }
+
+  for (size_t src_idx = 0; src_idx < row_group_num_rows.size(); ++src_idx) {
+    for (size_t rg_idx = 0; rg_idx < row_group_num_rows[src_idx].size(); ++rg_idx) {
+      select(rg_idx, src_idx);
+    }
+  }
+  return {std::move(selection), row_count};
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+
+/**
+ * @brief A row group selected for reading
+ */
+struct row_group_info {
+  size_type const index;
+  size_t const start_row;  // TODO source index
+  size_type const source_index;
+  row_group_info(size_type index, size_t start_row, size_type source_index)
+    : index(index), start_row(start_row), source_index(source_index)
+  {
+  }
+};
+
+/**
+ * @brief Selects row groups of the sources and computes the first row of each within the
+ * selection.
+ *
+ * The rows are counted with 64 bits, so a selection may hold more rows than a column can; readers
+ * producing a single table check the total, while the chunked reader splits the selection.
+ *
+ * @param row_groups Lists of row groups to select, one per source; empty to select all the row
+ *        groups of all the sources
+ * @param row_group_num_rows Number of rows of each row group, one list per source
+ *
+ * @return The selected row groups and their total number of rows
+ */
+std::pair<std::vector<row_group_info>, int64_t> select_row_groups(
+  std::vector<std::vector<size_type>> const& row_groups,
+  std::vector<std::vector<int64_t>> const& row_group_num_rows);
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -24,13 +24,16 @@
 #include "compact_protocol_reader.hpp"
 #include "compact_protocol_writer.hpp"
 
+#include <io/comp/nvcomp_adapter.hpp>
 #include <io/statistics/column_statistics.cuh>
 #include <io/utilities/column_utils.cuh>
 #include <io/utilities/config_utils.hpp>
+#include <io/utilities/host_worker_pool.hpp>
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/linked_column.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/detail/dremel.hpp>
 #include <cudf/lists/lists_column_view.hpp>
@@ -53,6 +56,7 @@
 #include <thrust/tuple.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -65,12 +69,6 @@ using namespace cudf::io::parquet;
 using namespace cudf::io;
 
 namespace {
-/**
- * @brief Helper for pinned host memory
- */
-template <typename T>
-using pinned_buffer = std::unique_ptr<T, decltype(&cudaFreeHost)>;
-
 /**
  * @brief Function that translates GDF compression to parquet compression
  */
@@ -79,11 +77,27 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD: return parquet::Compression::ZSTD;
+    // nvCOMP produces raw LZ4 blocks, without the framing of the deprecated LZ4 codec
+    case compression_type::LZ4: return parquet::Compression::LZ4_RAW;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
 
+/**
+ * @brief Function that translates parquet compression to nvCOMP compression
+ */
+nvcomp::compression_type to_nvcomp_compression_type(parquet::Compression codec)
+{
+  switch (codec) {
+    case parquet::Compression::SNAPPY: return nvcomp::compression_type::SNAPPY;
+    case parquet::Compression::ZSTD: return nvcomp::compression_type::ZSTD;
+    case parquet::Compression::LZ4_RAW: return nvcomp::compression_type::LZ4;
+    default: CUDF_FAIL("Unsupported compression type");
+  }
+}
+
 /**
  * @brief Function to calculate the memory needed to encode the column index of the given
  * column chunk
@@ -113,6 +127,25 @@ size_t column_index_buffer_size(gpu::EncColumnChunk* ck)
   return ck->ck_stat_size * ck->num_pages;
 }
 
+/**
+ * @brief Function to calculate the size of the split block Bloom filter bitset of a column chunk
+ *
+ * The filter is sized for a false positive probability of 1% assuming all the values of the chunk
+ * are distinct, i.e. about 9.6 bits per value, rounded up to a power of two so blocks can be
+ * selected with a multiply-shift and clamped to [32B, 1MB].
+ */
+uint32_t bloom_filter_size(size_type num_values)
+{
+  constexpr uint32_t min_size = gpu::bloom_filter_block_size;
+  constexpr uint32_t max_size = 1024 * 1024;
+  auto const num_bits         = static_cast<uint64_t>(std::ceil(9.6 * num_values));
+  auto size                   = min_size;
+  while (size < max_size && uint64_t{size} * 8 < num_bits) {
+    size *= 2;
+  }
+  return size;
+}
+
 }  // namespace
 
 struct aggregate_writer_metadata {
@@ -218,6 +251,7 @@ struct aggregate_writer_metadata {
     std::vector<KeyValue> key_value_metadata;
     std::vector<OffsetIndex> offset_indexes;
     std::vector<std::vector<uint8_t>> column_indexes;
+    std::vector<std::vector<uint8_t>> bloom_filters;  // empty for chunks without a Bloom filter
   };
   std::vector<per_file_metadata> files;
   std::string created_by         = "";
@@ -233,11 +267,18 @@ struct aggregate_writer_metadata {
  * 2. stats_dtype: datatype for statistics calculation required for the data stream of a leaf node.
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
+ * 4. requested_encoding: data page encoding requested for a leaf node, PLAIN if the writer should
+ *    choose between dictionary and plain encoding
+ * 5. bloom_filter: whether a split block Bloom filter is written for each chunk of a leaf node
+ * 6. statistics: whether statistics are computed and written for a leaf node
  */
 struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
   statistics_dtype stats_dtype;
   int32_t ts_scale;
+  Encoding requested_encoding = Encoding::PLAIN;
+  bool bloom_filter           = false;
+  bool statistics             = true;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -699,6 +740,28 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.parent_idx  = parent_idx;
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
+
+        switch (col_meta.get_encoding()) {
+          case column_encoding::DELTA_BINARY_PACKED:
+            CUDF_EXPECTS(col_schema.type == Type::INT32 || col_schema.type == Type::INT64,
+                         "DELTA_BINARY_PACKED encoding is only supported for columns stored as "
+                         "INT32 or INT64");
+            col_schema.requested_encoding = Encoding::DELTA_BINARY_PACKED;
+            break;
+          case column_encoding::BYTE_STREAM_SPLIT:
+            CUDF_EXPECTS(col_schema.type == Type::FLOAT || col_schema.type == Type::DOUBLE,
+                         "BYTE_STREAM_SPLIT encoding is only supported for FLOAT and DOUBLE "
+                         "columns");
+            col_schema.requested_encoding = Encoding::BYTE_STREAM_SPLIT;
+            break;
+          default: break;
+        }
+        if (col_meta.is_enabled_bloom_filter()) {
+          CUDF_EXPECTS(col_schema.type != Type::BOOLEAN && col_schema.type != Type::INT96,
+                       "Bloom filters are not supported for BOOLEAN and INT96 columns");
+          col_schema.bloom_filter = true;
+        }
+        col_schema.statistics = col_meta.is_enabled_statistics();
         schema.push_back(col_schema);
       }
     };
@@ -734,6 +797,8 @@ struct parquet_column_view {
   [[nodiscard]] column_view cudf_column_view() const { return cudf_col; }
   [[nodiscard]] parquet::Type physical_type() const { return schema_node.type; }
   [[nodiscard]] parquet::ConvertedType converted_type() const { return schema_node.converted_type; }
+  [[nodiscard]] bool has_bloom_filter() const { return schema_node.bloom_filter; }
+  [[nodiscard]] bool has_statistics() const { return schema_node.statistics; }
 
   std::vector<std::string> const& get_path_in_schema() { return path_in_schema; }
 
@@ -857,7 +922,7 @@ parquet_column_view::parquet_column_view(schema_tree_node const& schema_node,
     _def_level      = std::move(dremel.def_level);
     _data_count     = dremel.leaf_data_size;  // Needed for knowing what size dictionary to allocate
 
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
   } else {
     // For non-list struct, the size of the root column is the same as the size of the leaf column
     _data_count = cudf_col.size();
@@ -900,6 +965,8 @@ gpu::parquet_column_device_view parquet_column_view::get_device_view(
   desc.physical_type        = physical_type();
   desc.converted_type       = converted_type();
   desc.output_as_byte_array = schema_node.output_as_byte_array;
+  desc.requested_encoding   = schema_node.requested_encoding;
+  desc.write_statistics     = schema_node.statistics;
 
   desc.level_bits = CompactProtocolReader::NumRequiredBits(max_rep_level()) << 4 |
                     CompactProtocolReader::NumRequiredBits(max_def_level());
@@ -935,7 +1002,7 @@ void writer::impl::gather_fragment_statistics(
                                                                       num_fragments * num_columns,
                                                                       stream,
                                                                       int96_timestamps);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 }
 
 auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
@@ -943,6 +1010,7 @@ auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                      uint32_t num_columns,
                      size_t max_page_size_bytes,
                      size_type max_page_size_rows,
+                     Compression compression_codec,
                      rmm::cuda_stream_view stream)
 {
   if (chunks.is_empty()) { return hostdevice_vector<size_type>{}; }
@@ -987,12 +1055,12 @@ auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
 
   // Get per-page max compressed size
   hostdevice_vector<size_type> comp_page_sizes(num_pages, stream);
-  std::transform(page_sizes.begin(), page_sizes.end(), comp_page_sizes.begin(), [](auto page_size) {
-    size_t page_comp_max_size = 0;
-    nvcompBatchedSnappyCompressGetMaxOutputChunkSize(
-      page_size, nvcompBatchedSnappyDefaultOpts, &page_comp_max_size);
-    return page_comp_max_size;
-  });
+  std::transform(
+    page_sizes.begin(), page_sizes.end(), comp_page_sizes.begin(), [&](auto page_size) {
+      if (compression_codec == Compression::UNCOMPRESSED) { return page_size; }
+      return static_cast<size_type>(nvcomp::batched_compress_get_max_output_chunk_size(
+        to_nvcomp_compression_type(compression_codec), page_size));
+    });
   comp_page_sizes.host_to_device(stream);
 
   // Use per-page max compressed size to calculate chunk.compressed_size
@@ -1013,7 +1081,8 @@ auto init_page_sizes(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
 
 auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
                               host_span<gpu::parquet_column_device_view const> col_desc,
-                              device_2dspan<gpu::PageFragment const> frags,
+                              hostdevice_2dvector<gpu::PageFragment>& frags,
+                              size_t max_dictionary_size,
                               rmm::cuda_stream_view stream)
 {
   // At this point, we know all chunks and their sizes. We want to allocate dictionaries for each
@@ -1032,7 +1101,8 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   for (auto& chunk : h_chunks) {
     if (col_desc[chunk.col_desc_id].physical_type == Type::BOOLEAN ||
         (col_desc[chunk.col_desc_id].output_as_byte_array &&
-         col_desc[chunk.col_desc_id].physical_type == Type::BYTE_ARRAY)) {
+         col_desc[chunk.col_desc_id].physical_type == Type::BYTE_ARRAY) ||
+        col_desc[chunk.col_desc_id].requested_encoding != Encoding::PLAIN) {
       chunk.use_dictionary = false;
     } else {
       chunk.use_dictionary = true;
@@ -1047,33 +1117,79 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   chunks.host_to_device(stream);
 
   gpu::initialize_chunk_hash_maps(chunks.device_view().flat_view(), stream);
-  gpu::populate_chunk_hash_maps(frags, stream);
+  gpu::sample_chunk_hash_maps(frags, stream);
 
   chunks.device_to_host(stream, true);
 
+  // Size of the dictionary indices of `num_values` values into a dictionary of `num_entries`
+  auto const rle_bits_and_size = [](size_type num_entries, size_type num_values) {
+    // If we have N unique values then the idx for the last value is N - 1 and nbits is the number
+    // of bits required to encode indices into the dictionary
+    auto max_dict_index = (num_entries > 0) ? num_entries - 1 : 0;
+    auto nbits          = CompactProtocolReader::NumRequiredBits(max_dict_index);
+
+    // Only these bit sizes are allowed for RLE encoding because it's compute optimized
+    constexpr auto allowed_bitsizes = std::array<size_type, 7>{1, 2, 4, 8, 12, 16, 24};
+
+    // ceil to (1/2/4/8/12/16/24)
+    auto rle_bits = *std::lower_bound(allowed_bitsizes.begin(), allowed_bitsizes.end(), nbits);
+    return std::pair(rle_bits, util::div_rounding_up_safe(num_values * rle_bits, 8));
+  };
+
+  auto const h_frags = frags.host_view().flat_view();
+
+  // Estimate the cardinality of each chunk from its first fragment, and skip building the
+  // dictionaries that would not pay off for it; high cardinality chunks are not inserted further
+  for (auto& ck : h_chunks) {
+    if (not ck.use_dictionary or ck.num_dict_entries == 0) { continue; }
+    auto const& sample         = h_frags[ck.first_fragment];
+    auto const sample_rle_size = rle_bits_and_size(ck.num_dict_entries, sample.num_values).second;
+    ck.use_dictionary =
+      static_cast<size_t>(ck.uniq_data_size) <= max_dictionary_size and
+      ck.uniq_data_size + sample_rle_size < static_cast<size_type>(sample.fragment_data_size);
+  }
+
+  chunks.host_to_device(stream);
+  gpu::populate_chunk_hash_maps(frags, stream);
+  gpu::count_dictionary_entries(frags, stream);
+  frags.device_to_host(stream, true);
+
   // Make decision about which chunks have dictionary
   for (auto& ck : h_chunks) {
     if (not ck.use_dictionary) { continue; }
-    std::tie(ck.use_dictionary, ck.dict_rle_bits) = [&]() {
-      // calculate size of chunk if dictionary is used
-
-      // If we have N unique values then the idx for the last value is N - 1 and nbits is the number
-      // of bits required to encode indices into the dictionary
-      auto max_dict_index = (ck.num_dict_entries > 0) ? ck.num_dict_entries - 1 : 0;
-      auto nbits          = CompactProtocolReader::NumRequiredBits(max_dict_index);
 
-      // We don't use dictionary if the indices are > 24 bits because that's the maximum bitpacking
+    // The dictionary holds the entries of the leading fragments that fit in the size limits, the
+    // pages of the remaining fragments fall back to PLAIN
+    size_t num_dict_entries     = 0;
+    size_t dict_data_size       = 0;
+    size_type dict_num_values   = 0;
+    size_type dict_plain_size   = 0;
+    uint32_t num_dict_fragments = 0;
+    for (uint32_t rows = 0; rows < ck.num_rows; ++num_dict_fragments) {
+      auto const& frag = h_frags[ck.first_fragment + num_dict_fragments];
+      // We don't use dictionary indices wider than 24 bits because that's the maximum bitpacking
       // bitsize we efficiently support
-      if (nbits > 24) { return std::pair(false, 0); }
+      if (num_dict_entries + frag.num_dict_vals > static_cast<size_t>(MAX_DICT_SIZE) or
+          dict_data_size + frag.dict_data_size > max_dictionary_size) {
+        break;
+      }
+      num_dict_entries += frag.num_dict_vals;
+      dict_data_size += frag.dict_data_size;
+      dict_num_values += frag.num_values;
+      dict_plain_size += frag.fragment_data_size;
+      rows += frag.num_rows;
+    }
+    ck.num_dict_fragments = num_dict_fragments;
+    ck.num_dict_entries   = num_dict_entries;
+    ck.uniq_data_size     = dict_data_size;
 
-      // Only these bit sizes are allowed for RLE encoding because it's compute optimized
-      constexpr auto allowed_bitsizes = std::array<size_type, 7>{1, 2, 4, 8, 12, 16, 24};
+    std::tie(ck.use_dictionary, ck.dict_rle_bits) = [&]() {
+      if (num_dict_fragments == 0) { return std::pair(false, 0); }
 
-      // ceil to (1/2/4/8/12/16/24)
-      auto rle_bits = *std::lower_bound(allowed_bitsizes.begin(), allowed_bitsizes.end(), nbits);
-      auto rle_byte_size = util::div_rounding_up_safe(ck.num_values * rle_bits, 8);
+      // calculate size of chunk if dictionary is used
+      auto [rle_bits, rle_byte_size] = rle_bits_and_size(ck.num_dict_entries, dict_num_values);
 
-      auto dict_enc_size = ck.uniq_data_size + rle_byte_size;
+      auto dict_enc_size = ck.uniq_data_size + rle_byte_size + ck.plain_data_size - dict_plain_size;
 
       bool use_dict = (ck.plain_data_size > dict_enc_size);
       if (not use_dict) { rle_bits = 0; }
@@ -1088,8 +1204,7 @@ auto build_chunk_dictionaries(hostdevice_2dvector<gpu::EncColumnChunk>& chunks,
   for (auto& chunk : h_chunks) {
     if (not chunk.use_dictionary) { continue; }
 
-    size_t dict_data_size     = std::min(MAX_DICT_SIZE, chunk.dict_map_size);
-    auto& inserted_dict_data  = dict_data.emplace_back(dict_data_size, stream);
+    auto& inserted_dict_data  = dict_data.emplace_back(chunk.num_dict_entries, stream);
     auto& inserted_dict_index = dict_index.emplace_back(chunk.num_values, stream);
     chunk.dict_data           = inserted_dict_data.data();
     chunk.dict_index          = inserted_dict_index.data();
@@ -1136,7 +1251,7 @@ void writer::impl::init_encoder_pages(hostdevice_2dvector<gpu::EncColumnChunk>&
         stream);
     }
   }
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 }
 
 void snappy_compress(device_span<device_span<uint8_t const> const> comp_in,
@@ -1250,6 +1365,27 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
         gpu_snap(comp_in, comp_out, comp_stats, stream);
       }
       break;
+    case parquet::Compression::ZSTD:
+    case parquet::Compression::LZ4_RAW: {
+      CUDF_EXPECTS(nvcomp_integration::is_stable_enabled(),
+                   "nvCOMP is required for ZSTD and LZ4 compression");
+      auto const nvcomp_type = to_nvcomp_compression_type(compression_);
+      // The scratch space is kept across batches and writes, and only grows
+      auto const scratch_size =
+        nvcomp::batched_compress_temp_size(nvcomp_type, comp_in.size(), max_page_uncomp_data_size);
+      if (scratch_size > compression_scratch_.size()) {
+        compression_scratch_ = rmm::device_buffer(scratch_size, stream);
+      }
+      nvcomp::batched_compress(
+        nvcomp_type,
+        comp_in,
+        comp_out,
+        comp_stats,
+        max_page_uncomp_data_size,
+        {static_cast<uint8_t*>(compression_scratch_.data()), compression_scratch_.size()},
+        stream);
+      break;
+    }
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -1271,7 +1407,7 @@ void writer::impl::encode_pages(hostdevice_2dvector<gpu::EncColumnChunk>& chunks
                                 d_chunks_in_batch.flat_view().size_bytes(),
                                 cudaMemcpyDeviceToHost,
                                 stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 }
 
 writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
@@ -1285,6 +1421,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     max_row_group_rows{options.get_row_group_size_rows()},
     max_page_size_bytes(options.get_max_page_size_bytes()),
     max_page_size_rows(options.get_max_page_size_rows()),
+    max_dictionary_size(options.get_max_dictionary_size()),
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
@@ -1309,6 +1446,7 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     max_row_group_rows{options.get_row_group_size_rows()},
     max_page_size_bytes(options.get_max_page_size_bytes()),
     max_page_size_rows(options.get_max_page_size_rows()),
+    max_dictionary_size(options.get_max_dictionary_size()),
     compression_(to_parquet_compression(options.get_compression())),
     stats_granularity_(options.get_stats_level()),
     int96_timestamps(options.is_enabled_int96_timestamps()),
@@ -1513,8 +1651,10 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         ck.col_desc    = col_desc.device_ptr() + c;
         ck.col_desc_id = c;
         ck.fragments   = &fragments.device_view()[c][f];
-        ck.stats =
-          (not frag_stats.is_empty()) ? frag_stats.data() + c * num_fragments + f : nullptr;
+        // Chunks without fragment statistics get neither chunk nor page statistics
+        ck.stats = (not frag_stats.is_empty() and parquet_columns[c].has_statistics())
+                     ? frag_stats.data() + c * num_fragments + f
+                     : nullptr;
         ck.start_row         = start_row;
         ck.num_rows          = (uint32_t)row_group.num_rows;
         ck.first_fragment    = c * num_fragments + f;
@@ -1532,9 +1672,15 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
           chunk_fragments.begin(), chunk_fragments.end(), 0, [](int sum, gpu::PageFragment frag) {
             return sum + frag.fragment_data_size;
           });
+        if (parquet_columns[c].has_bloom_filter()) {
+          ck.bloom_filter_size = bloom_filter_size(ck.num_values);
+        }
         auto& column_chunk_meta          = row_group.columns[c].meta_data;
         column_chunk_meta.type           = parquet_columns[c].physical_type();
         column_chunk_meta.encodings      = {Encoding::PLAIN, Encoding::RLE};
+        if (col_desc[c].requested_encoding != Encoding::PLAIN) {
+          column_chunk_meta.encodings.push_back(col_desc[c].requested_encoding);
+        }
         column_chunk_meta.path_in_schema = parquet_columns[c].get_path_in_schema();
         column_chunk_meta.codec          = UNCOMPRESSED;
         column_chunk_meta.num_values     = ck.num_values;
@@ -1545,7 +1691,8 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   }
 
   fragments.host_to_device(stream);
-  auto dict_info_owner = build_chunk_dictionaries(chunks, col_desc, fragments, stream);
+  auto dict_info_owner =
+    build_chunk_dictionaries(chunks, col_desc, fragments, max_dictionary_size, stream);
   for (size_t p = 0; p < partitions.size(); p++) {
     for (int rg = 0; rg < num_rg_in_part[p]; rg++) {
       size_t global_rg = global_rowgroup_base[p] + rg;
@@ -1560,7 +1707,13 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
 
   // Build chunk dictionaries and count pages
   hostdevice_vector<size_type> comp_page_sizes =
-    init_page_sizes(chunks, col_desc, num_columns, max_page_size_bytes, max_page_size_rows, stream);
+    init_page_sizes(chunks,
+                    col_desc,
+                    num_columns,
+                    max_page_size_bytes,
+                    max_page_size_rows,
+                    compression_,
+                    stream);
 
   // Get the maximum page size across all chunks
   size_type max_page_uncomp_data_size =
@@ -1583,11 +1736,11 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   size_t max_bytes_in_batch    = 1024 * 1024 * 1024;  // 1GB - TODO: Tune this
   size_t max_uncomp_bfr_size   = 0;
   size_t max_comp_bfr_size     = 0;
-  size_t max_chunk_bfr_size    = 0;
   size_type max_pages_in_batch = 0;
   size_t bytes_in_batch        = 0;
   size_t comp_bytes_in_batch   = 0;
   size_t column_index_bfr_size = 0;
+  size_t bloom_filter_bfr_size = 0;
   for (size_type r = 0, groups_in_batch = 0, pages_in_batch = 0; r <= num_rowgroups; r++) {
     size_t rowgroup_size      = 0;
     size_t comp_rowgroup_size = 0;
@@ -1599,11 +1752,10 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         pages_in_batch += ck->num_pages;
         rowgroup_size += ck->bfr_size;
         comp_rowgroup_size += ck->compressed_size;
-        max_chunk_bfr_size =
-          std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
         if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
           column_index_bfr_size += column_index_buffer_size(ck);
         }
+        bloom_filter_bfr_size += ck->bloom_filter_size / sizeof(uint32_t);
       }
     }
     // TBD: We may want to also shorten the batch if we have enough pages (not just based on size)
@@ -1634,6 +1786,11 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
   rmm::device_buffer uncomp_bfr(max_uncomp_bfr_size, stream);
   rmm::device_buffer comp_bfr(max_comp_bfr_size, stream);
   rmm::device_buffer col_idx_bfr(column_index_bfr_size, stream);
+  // Bloom filters of all the chunks are kept until the end of the write; they are small compared to
+  // the chunk data
+  auto bloom_filter_bfr =
+    cudf::detail::make_zeroed_device_uvector_async<uint32_t>(bloom_filter_bfr_size, stream);
+  auto bfr_b = bloom_filter_bfr.data();
   rmm::device_uvector<gpu::EncPage> pages(num_pages, stream);
 
   // This contains stats for both the pages and the rowgroups. TODO: make them separate.
@@ -1648,6 +1805,10 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         ck.uncompressed_bfr     = bfr;
         ck.compressed_bfr       = bfr_c;
         ck.column_index_blob    = bfr_i;
+        if (ck.bloom_filter_size != 0) {
+          ck.bloom_filter = bfr_b;
+          bfr_b += ck.bloom_filter_size / sizeof(uint32_t);
+        }
         bfr += ck.bfr_size;
         bfr_c += ck.compressed_size;
         if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
@@ -1668,10 +1829,13 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                        num_pages,
                        num_stats_bfr);
   }
-
-  pinned_buffer<uint8_t> host_bfr{nullptr, cudaFreeHost};
+  if (bloom_filter_bfr_size != 0) {
+    gpu::InitBloomFilters(chunks.device_view().flat_view(), stream);
+  }
 
   // Encode row groups in batches
+  std::vector<std::future<void>> write_tasks;
+  rmm::device_buffer gather_bfr(0, stream);
   for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
     // Count pages in this batch
     auto const rnext               = r + batch_list[b];
@@ -1679,6 +1843,12 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     auto const first_page_in_next_batch =
       (rnext < num_rowgroups) ? chunks[rnext][0].first_page : num_pages;
     auto const pages_in_batch = first_page_in_next_batch - first_page_in_batch;
+
+    // The device writes of the previous batch read from the encoding buffers
+    for (auto const& task : write_tasks) {
+      task.wait();
+    }
+    write_tasks.clear();
     encode_pages(
       chunks,
       {pages.data(), pages.size()},
@@ -1692,57 +1862,111 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
                                                                : nullptr,
       (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) ? page_stats.data() : nullptr);
 
-    std::vector<std::future<void>> write_tasks;
-    for (; r < rnext; r++) {
+    // The host writes of the previous batch overlapped with the encoding of this batch; they
+    // must complete before the staging buffer is reused
+    if (pending_host_writes.valid()) { pending_host_writes.get(); }
+
+    // Stage the statistics of all the chunks of the batch, along with the data of the chunks
+    // written from host memory, with a single synchronization. The chunks of the row groups
+    // written from device memory are gathered into a contiguous device buffer instead, so that
+    // each row group takes a single device write
+    struct chunk_write {
+      bool is_device_write;
+      size_t staging_offset;  // offset of the chunk in the staging buffer
+    };
+    struct row_group_write {
+      uint8_t const* dev_data;  // device data, only set for device writes
+      size_t size;              // size of the row group, zero for host writes
+    };
+    std::vector<chunk_write> chunk_writes;
+    std::vector<row_group_write> row_group_writes;
+    size_t staging_size    = 0;
+    size_t gather_size     = 0;
+    bool has_device_writes = false;
+    for (auto rr = r; rr < rnext; rr++) {
+      auto const p          = rg_to_part[rr];
+      size_t row_group_size = 0;
+      for (auto i = 0; i < num_columns; i++) {
+        row_group_size += chunks[rr][i].compressed_size;
+      }
+      auto const is_device_write =
+        row_group_size != 0 and out_sink_[p]->is_device_write_preferred(row_group_size);
+      for (auto i = 0; i < num_columns; i++) {
+        gpu::EncColumnChunk const& ck = chunks[rr][i];
+        chunk_writes.push_back({is_device_write, staging_size});
+        staging_size += ck.ck_stat_size + (is_device_write ? 0 : ck.compressed_size);
+      }
+      row_group_writes.push_back({nullptr, is_device_write ? row_group_size : 0});
+      if (is_device_write and num_columns > 1) { gather_size += row_group_size; }
+      has_device_writes |= is_device_write;
+    }
+    if (staging_size > host_bfr_size) {
+      host_bfr.reset();
+      host_bfr      = make_pinned_buffer<uint8_t>(staging_size);
+      host_bfr_size = staging_size;
+    }
+    gather_bfr    = rmm::device_buffer(gather_size, stream);
+    auto gathered = static_cast<uint8_t*>(gather_bfr.data());
+    for (auto rr = r, w = 0; rr < rnext; rr++) {
+      auto& row_group_write = row_group_writes[rr - r];
+      if (row_group_write.size != 0) {
+        gpu::EncColumnChunk const& ck = chunks[rr][0];
+        uint8_t const* dev_bfr        = ck.is_compressed ? ck.compressed_bfr : ck.uncompressed_bfr;
+        // A single chunk is written in place
+        row_group_write.dev_data = num_columns > 1 ? gathered : dev_bfr + ck.ck_stat_size;
+      }
+      for (auto i = 0; i < num_columns; i++, w++) {
+        gpu::EncColumnChunk const& ck = chunks[rr][i];
+        uint8_t const* dev_bfr        = ck.is_compressed ? ck.compressed_bfr : ck.uncompressed_bfr;
+        auto const copy_size =
+          ck.ck_stat_size + (chunk_writes[w].is_device_write ? 0 : ck.compressed_size);
+        if (copy_size != 0) {
+          CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr.get() + chunk_writes[w].staging_offset,
+                                        dev_bfr,
+                                        copy_size,
+                                        cudaMemcpyDeviceToHost,
+                                        stream.value()));
+        }
+        if (chunk_writes[w].is_device_write and num_columns > 1 and ck.compressed_size != 0) {
+          CUDF_CUDA_TRY(cudaMemcpyAsync(gathered,
+                                        dev_bfr + ck.ck_stat_size,
+                                        ck.compressed_size,
+                                        cudaMemcpyDeviceToDevice,
+                                        stream.value()));
+          gathered += ck.compressed_size;
+        }
+      }
+    }
+    cudf::detail::synchronize_stream(stream);
+
+    // Host writes are deferred when no device write needs to be ordered after them
+    std::vector<std::pair<int, host_span<uint8_t const>>> host_writes;
+    for (auto w = 0, g = 0; r < rnext; r++, g++) {
       int p           = rg_to_part[r];
       int global_r    = global_rowgroup_base[p] + r - first_rg_in_part[p];
       auto& row_group = md->file(p).row_groups[global_r];
-      for (auto i = 0; i < num_columns; i++) {
+      if (row_group_writes[g].size != 0) {
+        // let the writer do what it wants to retrieve the data from the gpu.
+        write_tasks.push_back(out_sink_[p]->device_write_async(
+          row_group_writes[g].dev_data, row_group_writes[g].size, stream));
+      }
+      for (auto i = 0; i < num_columns; i++, w++) {
         gpu::EncColumnChunk& ck = chunks[r][i];
         auto& column_chunk_meta = row_group.columns[i].meta_data;
-        uint8_t* dev_bfr;
-        if (ck.is_compressed) {
-          column_chunk_meta.codec = compression_;
-          dev_bfr                 = ck.compressed_bfr;
-        } else {
-          dev_bfr = ck.uncompressed_bfr;
-        }
+        if (ck.is_compressed) { column_chunk_meta.codec = compression_; }
 
-        if (out_sink_[p]->is_device_write_preferred(ck.compressed_size)) {
-          // let the writer do what it wants to retrieve the data from the gpu.
-          write_tasks.push_back(out_sink_[p]->device_write_async(
-            dev_bfr + ck.ck_stat_size, ck.compressed_size, stream));
-          // we still need to do a (much smaller) memcpy for the statistics.
-          if (ck.ck_stat_size != 0) {
-            column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
-            CUDF_CUDA_TRY(cudaMemcpyAsync(column_chunk_meta.statistics_blob.data(),
-                                          dev_bfr,
-                                          ck.ck_stat_size,
-                                          cudaMemcpyDeviceToHost,
-                                          stream.value()));
-            stream.synchronize();
-          }
+        auto const staged = host_bfr.get() + chunk_writes[w].staging_offset;
+        if (ck.ck_stat_size != 0) {
+          column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
+          memcpy(column_chunk_meta.statistics_blob.data(), staged, ck.ck_stat_size);
+        }
+        if (chunk_writes[w].is_device_write) {
+          // written along with the rest of its row group
+        } else if (has_device_writes) {
+          out_sink_[p]->host_write(staged + ck.ck_stat_size, ck.compressed_size);
         } else {
-          if (!host_bfr) {
-            host_bfr = pinned_buffer<uint8_t>{[](size_t size) {
-                                                uint8_t* ptr = nullptr;
-                                                CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
-                                                return ptr;
-                                              }(max_chunk_bfr_size),
-                                              cudaFreeHost};
-          }
-          // copy the full data
-          CUDF_CUDA_TRY(cudaMemcpyAsync(host_bfr.get(),
-                                        dev_bfr,
-                                        ck.ck_stat_size + ck.compressed_size,
-                                        cudaMemcpyDeviceToHost,
-                                        stream.value()));
-          stream.synchronize();
-          out_sink_[p]->host_write(host_bfr.get() + ck.ck_stat_size, ck.compressed_size);
-          if (ck.ck_stat_size != 0) {
-            column_chunk_meta.statistics_blob.resize(ck.ck_stat_size);
-            memcpy(column_chunk_meta.statistics_blob.data(), host_bfr.get(), ck.ck_stat_size);
-          }
+          host_writes.emplace_back(p, host_span<uint8_t const>{staged + ck.ck_stat_size,
+                                                               ck.compressed_size});
         }
         row_group.total_byte_size += ck.compressed_size;
         column_chunk_meta.data_page_offset =
@@ -1754,15 +1978,36 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
         current_chunk_offset[p] += ck.compressed_size;
       }
     }
-    for (auto const& task : write_tasks) {
-      task.wait();
+    if (not host_writes.empty()) {
+      pending_host_writes = host_worker_pool().submit(
+        [sinks = out_sink_.data(), host_writes = std::move(host_writes)]() {
+          for (auto const& [p, data] : host_writes) {
+            sinks[p]->host_write(data.data(), data.size());
+          }
+        });
+    }
+  }
+
+  // add Bloom filters to metadata, one entry per chunk so they line up with the row groups
+  {
+    auto const h_bloom_filters = bloom_filter_bfr_size != 0
+                                   ? cudf::detail::make_std_vector_sync(bloom_filter_bfr, stream)
+                                   : std::vector<uint32_t>{};
+    auto const* h_filter       = reinterpret_cast<uint8_t const*>(h_bloom_filters.data());
+    for (auto r = 0; r < num_rowgroups; r++) {
+      int p = rg_to_part[r];
+      for (auto i = 0; i < num_columns; i++) {
+        auto const size = chunks[r][i].bloom_filter_size;
+        md->file(p).bloom_filters.emplace_back(h_filter, h_filter + size);
+        h_filter += size;
+      }
     }
   }
 
   if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
     // need pages on host to create offset_indexes
     thrust::host_vector<gpu::EncPage> h_pages = cudf::detail::make_host_vector_async(pages, stream);
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
 
     // add column and offset indexes to metadata
     for (auto b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
@@ -1802,7 +2047,7 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
             curr_pg_offset += this_page_size;
           }
 
-          stream.synchronize();
+          cudf::detail::synchronize_stream(stream);
           md->file(p).offset_indexes.push_back(offset_idx);
           md->file(p).column_indexes.push_back(column_idx);
         }
@@ -1810,12 +2055,18 @@ void writer::impl::write(table_view const& table, std::vector<partition_info> co
     }
   }
 
+  // The device writes of the last batch overlap with the metadata processing above
+  for (auto const& task : write_tasks) {
+    task.wait();
+  }
   last_write_successful = true;
 }
 
 std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
   std::vector<std::string> const& column_chunks_file_path)
 {
+  // Complete the writes of the last batch before anything else is written to the sinks
+  if (pending_host_writes.valid()) { pending_host_writes.get(); }
   if (closed) { return nullptr; }
   closed = true;
   if (not last_write_successful) { return nullptr; }
@@ -1824,6 +2075,28 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
     CompactProtocolWriter cpw(&buffer);
     file_ender_s fendr;
 
+    // write Bloom filters, updating column metadata along the way
+    {
+      auto& fmd    = md->file(p);
+      int chunkidx = 0;
+      for (auto& r : fmd.row_groups) {
+        for (auto& c : r.columns) {
+          auto const& bitset = fmd.bloom_filters[chunkidx++];
+          if (bitset.empty()) { continue; }
+          BloomFilterHeader header;
+          header.num_bytes                      = bitset.size();
+          header.algorithm.isset.BLOCK          = true;
+          header.hash.isset.XXHASH              = true;
+          header.compression.isset.UNCOMPRESSED = true;
+          buffer.resize(0);
+          cpw.write(header);
+          c.meta_data.bloom_filter_offset = out_sink_[p]->bytes_written();
+          out_sink_[p]->host_write(buffer.data(), buffer.size());
+          out_sink_[p]->host_write(bitset.data(), bitset.size());
+        }
+      }
+    }
+
     if (stats_granularity_ == statistics_freq::STATISTICS_COLUMN) {
       auto& fmd = md->file(p);
 
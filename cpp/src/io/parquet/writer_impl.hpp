@@ -26,6 +26,7 @@
 
 #include <cudf/io/data_sink.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/pinned_memory_pool.hpp>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/detail/parquet.hpp>
@@ -34,7 +35,9 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -204,7 +207,10 @@ class writer::impl {
   size_type max_row_group_rows       = default_row_group_size_rows;
   size_t max_page_size_bytes         = default_max_page_size_bytes;
   size_type max_page_size_rows       = default_max_page_size_rows;
+  size_t max_dictionary_size         = default_max_dictionary_size;
   Compression compression_           = Compression::UNCOMPRESSED;
+  // Scratch space for the nvCOMP compression, reused across batches and writes
+  rmm::device_buffer compression_scratch_;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
   bool int96_timestamps              = false;
   // Overall file metadata.  Filled in during the process and written during write_chunked_end()
@@ -219,6 +225,11 @@ class writer::impl {
   bool last_write_successful = false;
   // current write position for rowgroups/chunks
   std::vector<std::size_t> current_chunk_offset;
+  // pinned staging buffer for the device to host copies of encoded chunks, and its size
+  pinned_buffer<uint8_t> host_bfr;
+  size_t host_bfr_size = 0;
+  // host writes of the last encoded batch, overlapping with the encoding of the next batch
+  std::future<void> pending_host_writes;
   // special parameter only used by detail::write() to indicate that we are guaranteeing
   // a single table write.  this enables some internal optimizations.
   bool const single_write_mode = true;
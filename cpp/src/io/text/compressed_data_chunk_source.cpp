@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/text/data_chunk_source.hpp>
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace text {
+namespace {
+
+class gzip_device_data_chunk : public device_data_chunk {
+ public:
+  gzip_device_data_chunk(rmm::device_uvector<char>&& data) : _data(std::move(data)) {}
+
+  [[nodiscard]] char const* data() const override { return _data.data(); }
+  [[nodiscard]] std::size_t size() const override { return _data.size(); }
+  operator device_span<char const>() const override { return _data; }
+
+ private:
+  rmm::device_uvector<char> _data;
+};
+
+/**
+ * @brief a reader which inflates a gzip or zlib file in bounded blocks and produces views of device
+ * memory which contain a copy of the decompressed data.
+ *
+ * Only a fixed-size block of compressed input and the two host staging buffers are held at any
+ * time, so memory use does not depend on the size of the file. Concatenated gzip members are
+ * decompressed as one stream, as `gunzip` does.
+ */
+class gzip_data_chunk_reader : public data_chunk_reader {
+  static constexpr std::size_t input_block_size = 1 << 20;
+
+  struct host_ticket {
+    cudaEvent_t event;
+    thrust::host_vector<char, thrust::system::cuda::experimental::pinned_allocator<char>> buffer;
+  };
+
+ public:
+  gzip_data_chunk_reader(std::string const& filename)
+    : _file(filename, std::ifstream::in | std::ifstream::binary),
+      _input(input_block_size),
+      _tickets(2)
+  {
+    CUDF_EXPECTS(_file.is_open(), "Cannot open compressed source file");
+    // 15 window bits plus 32 selects automatic detection of the gzip or zlib header
+    CUDF_EXPECTS(inflateInit2(&_zstream, 15 + 32) == Z_OK, "Cannot initialize zlib inflate");
+    for (std::size_t i = 0; i < _tickets.size(); i++) {
+      CUDF_CUDA_TRY(cudaEventCreate(&(_tickets[i].event)));
+    }
+  }
+
+  ~gzip_data_chunk_reader()
+  {
+    for (std::size_t i = 0; i < _tickets.size(); i++) {
+      CUDF_CUDA_TRY(cudaEventDestroy(_tickets[i].event));
+    }
+    inflateEnd(&_zstream);
+  }
+
+  void skip_bytes(std::size_t size) override
+  {
+    // the decompressed stream has no random access, so skipped bytes are inflated and discarded
+    _skip_buffer.resize(std::min(size, input_block_size));
+    while (size > 0) {
+      auto const inflated = inflate_into(_skip_buffer.data(), std::min(size, _skip_buffer.size()));
+      if (inflated == 0) { break; }
+      size -= inflated;
+    }
+  }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+
+    auto& h_ticket = _tickets[_next_ticket_idx];
+
+    _next_ticket_idx = (_next_ticket_idx + 1) % _tickets.size();
+
+    // synchronize on the last host-to-device copy, so we don't clobber the host buffer.
+    CUDF_CUDA_TRY(cudaEventSynchronize(h_ticket.event));
+
+    if (h_ticket.buffer.size() < read_size) { h_ticket.buffer.resize(read_size); }
+
+    read_size = inflate_into(h_ticket.buffer.data(), read_size);
+
+    auto chunk = rmm::device_uvector<char>(read_size, stream);
+
+    CUDF_CUDA_TRY(cudaMemcpyAsync(  //
+      chunk.data(),
+      h_ticket.buffer.data(),
+      read_size,
+      cudaMemcpyHostToDevice,
+      stream.value()));
+
+    CUDF_CUDA_TRY(cudaEventRecord(h_ticket.event, stream.value()));
+
+    return std::make_unique<gzip_device_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  /**
+   * @brief Inflates up to `size` bytes into `dst`, reading compressed input as needed
+   *
+   * @return The number of bytes written, less than `size` only at the end of the stream
+   */
+  std::size_t inflate_into(char* dst, std::size_t size)
+  {
+    _zstream.next_out  = reinterpret_cast<Bytef*>(dst);
+    _zstream.avail_out = static_cast<uInt>(size);
+    while (_zstream.avail_out > 0) {
+      if (_zstream.avail_in == 0) {
+        _file.read(reinterpret_cast<char*>(_input.data()), _input.size());
+        _zstream.next_in  = _input.data();
+        _zstream.avail_in = static_cast<uInt>(_file.gcount());
+        if (_zstream.avail_in == 0) {
+          CUDF_EXPECTS(not _in_member, "Unexpected end of compressed data");
+          break;
+        }
+      }
+      _in_member     = true;
+      auto const ret = inflate(&_zstream, Z_NO_FLUSH);
+      if (ret == Z_STREAM_END) {
+        _in_member = false;
+        CUDF_EXPECTS(inflateReset(&_zstream) == Z_OK, "Cannot reset zlib inflate");
+      } else {
+        CUDF_EXPECTS(ret == Z_OK || ret == Z_BUF_ERROR, "Error inflating compressed data");
+      }
+    }
+    return size - _zstream.avail_out;
+  }
+
+  std::ifstream _file;
+  z_stream _zstream{};
+  bool _in_member = false;
+  std::vector<Bytef> _input;
+  std::vector<char> _skip_buffer;
+  std::size_t _next_ticket_idx = 0;
+  std::vector<host_ticket> _tickets;
+};
+
+/**
+ * @brief a compressed file data source which creates a gzip_data_chunk_reader
+ */
+class gzip_file_data_chunk_source : public data_chunk_source {
+ public:
+  gzip_file_data_chunk_source(std::string filename) : _filename(std::move(filename)) {}
+  [[nodiscard]] std::unique_ptr<data_chunk_reader> create_reader() const override
+  {
+    return std::make_unique<gzip_data_chunk_reader>(_filename);
+  }
+
+ private:
+  std::string _filename;
+};
+
+}  // namespace
+
+std::unique_ptr<data_chunk_source> make_source_from_file(std::string const& filename,
+                                                         compression_type compression)
+{
+  CUDF_EXPECTS(compression == compression_type::GZIP || compression == compression_type::ZLIB,
+               "Unsupported compression type for a data chunk source");
+  return std::make_unique<gzip_file_data_chunk_source>(filename);
+}
+
+}  // namespace text
+}  // namespace io
+}  // namespace cudf
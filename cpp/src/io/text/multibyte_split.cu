@@ -48,8 +48,11 @@
 
 #pragma GCC diagnostic pop
 
+#include <algorithm>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace {
 
@@ -79,7 +82,7 @@ struct PatternScan {
                               cudf::io::text::detail::scan_tile_state_view<multistate> tile_state,
                               cudf::io::text::detail::trie_device_view trie,
                               char (&thread_data)[ITEMS_PER_THREAD],
-                              uint32_t (&thread_state)[ITEMS_PER_THREAD])
+                              bool (&thread_match)[ITEMS_PER_THREAD])
   {
     auto thread_multistate = trie.transition_init(thread_data[0]);
 
@@ -95,7 +98,7 @@ struct PatternScan {
     for (uint32_t i = 0; i < ITEMS_PER_THREAD; i++) {
       thread_multistate = trie.transition(thread_data[i], thread_multistate);
 
-      thread_state[i] = thread_multistate.max_tail();
+      thread_match[i] = trie.is_match(thread_multistate);
     }
   }
 };
@@ -174,18 +177,18 @@ __global__ void multibyte_split_kernel(
 
   // STEP 2: Scan inputs to determine absolute thread states
 
-  uint32_t thread_states[ITEMS_PER_THREAD];
+  bool thread_matches[ITEMS_PER_THREAD];
 
   __syncthreads();  // required before temp_memory re-use
   PatternScan(temp_storage.pattern_scan)
-    .Scan(tile_idx, tile_multistates, trie, thread_chars, thread_states);
+    .Scan(tile_idx, tile_multistates, trie, thread_chars, thread_matches);
 
   // STEP 3: Flag matches
 
   int64_t thread_offsets[ITEMS_PER_THREAD];
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_offsets[i] = i < thread_input_size and trie.is_match(thread_states[i]);
+    thread_offsets[i] = i < thread_input_size and thread_matches[i];
   }
 
   // STEP 4: Scan flags to determine absolute thread output offset
@@ -200,7 +203,7 @@ __global__ void multibyte_split_kernel(
 
   if (abs_output_delimiter_offsets.size() > 0) {
     for (int32_t i = 0; i < ITEMS_PER_THREAD and i < thread_input_size; i++) {
-      if (trie.is_match(thread_states[i])) {
+      if (thread_matches[i]) {
         auto const match_end =
           static_cast<int64_t>(base_tile_idx) * ITEMS_PER_TILE + thread_input_offset + i + 1;
         abs_output_delimiter_offsets[thread_offsets[i]] = match_end;
@@ -325,15 +328,33 @@ int64_t multibyte_split_scan_full_source(cudf::io::text::data_chunk_source const
   return chunk_offset;
 }
 
-std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
-                                              std::string const& delimiter,
-                                              byte_range_info byte_range,
-                                              rmm::cuda_stream_view stream,
-                                              rmm::mr::device_memory_resource* mr,
-                                              rmm::cuda_stream_pool& stream_pool)
+/**
+ * @brief Record offsets found by splitting a source, with the range of them inside the byte range
+ */
+struct record_offsets {
+  rmm::device_uvector<int64_t> offsets;  ///< start of every record plus the end of the source
+  int64_t begin;                         ///< index of the first offset relevant to the byte range
+  int64_t end;                           ///< one past the index of the last relevant offset
+};
+
+/**
+ * @brief Finds the offsets of all records in the source and the subset relevant to the byte range
+ */
+record_offsets find_record_offsets(cudf::io::text::data_chunk_source const& source,
+                                   std::vector<std::string> const& delimiters,
+                                   byte_range_info byte_range,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr,
+                                   rmm::cuda_stream_pool& stream_pool)
 {
   CUDF_FUNC_RANGE();
-  auto const trie = cudf::io::text::detail::trie::create({delimiter}, stream);
+  CUDF_EXPECTS(not delimiters.empty(), "at least one delimiter is required");
+  CUDF_EXPECTS(std::none_of(delimiters.begin(),
+                            delimiters.end(),
+                            [](auto const& delimiter) { return delimiter.empty(); }),
+               "delimiters cannot be empty");
+
+  auto const trie = cudf::io::text::detail::trie::create(delimiters, stream);
 
   CUDF_EXPECTS(trie.max_duplicate_tokens() < multistate::max_segment_count,
                "delimiter contains too many duplicate tokens to produce a deterministic result.");
@@ -369,7 +390,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     cudf::util::div_rounding_up_safe(bytes_total, static_cast<int64_t>(ITEMS_PER_TILE));
   auto num_results = tile_offsets.get_inclusive_prefix(num_tiles - 1, stream);
 
-  auto string_offsets = rmm::device_uvector<int64_t>(num_results + 2, stream);
+  auto string_offsets = rmm::device_uvector<int64_t>(num_results + 2, stream, mr);
 
   // first and last element are set manually to zero and size of input, respectively.
   // kernel is only responsible for determining delimiter offsets
@@ -411,14 +432,31 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   bool byte_range_exact_end = byte_range.offset() + byte_range.size() == bytes_total;
   if (last_field_empty && byte_range_exact_end) { ++relevant_offsets_end; }
 
+  auto const begin = static_cast<int64_t>(relevant_offsets_begin - string_offsets.begin());
+  auto const end   = static_cast<int64_t>(relevant_offsets_end - string_offsets.begin());
+  return {std::move(string_offsets), begin, end};
+}
+
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              byte_range_info byte_range,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr,
+                                              rmm::cuda_stream_pool& stream_pool)
+{
+  CUDF_FUNC_RANGE();
+  auto const records = find_record_offsets(
+    source, delimiters, byte_range, stream, rmm::mr::get_current_device_resource(), stream_pool);
+  auto const& string_offsets  = records.offsets;
+  auto relevant_offsets_begin = string_offsets.begin() + records.begin;
+  auto relevant_offsets_end   = string_offsets.begin() + records.end;
+
   auto string_offsets_out_size = relevant_offsets_end - relevant_offsets_begin;
 
   auto string_offsets_out = rmm::device_uvector<int32_t>(string_offsets_out_size, stream, mr);
 
-  auto relevant_offset_first =
-    string_offsets.element(relevant_offsets_begin - string_offsets.begin(), stream);
-  auto relevant_offset_last =
-    string_offsets.element(relevant_offsets_end - string_offsets.begin() - 1, stream);
+  auto relevant_offset_first = string_offsets.element(records.begin, stream);
+  auto relevant_offset_last  = string_offsets.element(records.end - 1, stream);
 
   auto string_chars_size = relevant_offset_last - relevant_offset_first;
   auto string_chars      = rmm::device_uvector<char>(string_chars_size, stream, mr);
@@ -451,6 +489,34 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     string_count, std::move(string_offsets_out), std::move(string_chars));
 }
 
+std::unique_ptr<cudf::column> multibyte_split_offsets(
+  cudf::io::text::data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  byte_range_info byte_range,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr,
+  rmm::cuda_stream_pool& stream_pool)
+{
+  CUDF_FUNC_RANGE();
+  auto records = find_record_offsets(source, delimiters, byte_range, stream, mr, stream_pool);
+
+  // when every offset is relevant the scan output is returned as-is, without another copy
+  if (records.begin == 0 && records.end == static_cast<int64_t>(records.offsets.size())) {
+    auto const size = static_cast<size_type>(records.offsets.size());
+    return std::make_unique<cudf::column>(
+      data_type{type_id::INT64}, size, records.offsets.release(), rmm::device_buffer{}, 0);
+  }
+
+  auto const size = static_cast<size_type>(records.end - records.begin);
+  auto result     =
+    make_numeric_column(data_type{type_id::INT64}, size, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy(stream),
+               records.offsets.begin() + records.begin,
+               records.offsets.begin() + records.end,
+               result->mutable_view().begin<int64_t>());
+  return result;
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
@@ -461,12 +527,41 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
   auto stream      = cudf::default_stream_value;
   auto stream_pool = rmm::cuda_stream_pool(2);
 
-  auto result = detail::multibyte_split(
-    source, delimiter, byte_range.value_or(create_byte_range_info_max()), stream, mr, stream_pool);
+  auto result = detail::multibyte_split(source,
+                                        std::vector<std::string>{delimiter},
+                                        byte_range.value_or(create_byte_range_info_max()),
+                                        stream,
+                                        mr,
+                                        stream_pool);
 
   return result;
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              std::optional<byte_range_info> byte_range,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto stream      = cudf::default_stream_value;
+  auto stream_pool = rmm::cuda_stream_pool(2);
+
+  return detail::multibyte_split(
+    source, delimiters, byte_range.value_or(create_byte_range_info_max()), stream, mr, stream_pool);
+}
+
+std::unique_ptr<cudf::column> multibyte_split_offsets(
+  cudf::io::text::data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  std::optional<byte_range_info> byte_range,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto stream      = cudf::default_stream_value;
+  auto stream_pool = rmm::cuda_stream_pool(2);
+
+  return detail::multibyte_split_offsets(
+    source, delimiters, byte_range.value_or(create_byte_range_info_max()), stream, mr, stream_pool);
+}
+
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
                                               std::string const& delimiter,
                                               rmm::mr::device_memory_resource* mr)
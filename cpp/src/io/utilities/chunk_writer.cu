@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chunk_writer.hpp"
+
+#include "host_worker_pool.hpp"
+
+#include <cudf/detail/utilities/synchronize.hpp>
+#include <cudf/strings/detail/combine.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cstring>
+
+namespace cudf::io::detail {
+
+chunk_writer::chunk_writer(data_sink* sink,
+                           std::string const& line_terminator,
+                           rmm::cuda_stream_view stream)
+  : sink_{sink},
+    line_terminator_{line_terminator},
+    d_line_terminator_{line_terminator, true, stream},
+    stream_{stream},
+    copy_stream_pool_{1}
+{
+  CUDF_CUDA_TRY(cudaEventCreateWithFlags(&converted_event_, cudaEventDisableTiming));
+}
+
+chunk_writer::~chunk_writer()
+{
+  // The copy stream and the worker thread may still be using the staging buffers if writing was
+  // interrupted
+  cudaStreamSynchronize(copy_stream_pool_.get_stream().value());
+  if (host_write_.valid()) { host_write_.wait(); }
+  cudaEventDestroy(converted_event_);
+}
+
+void chunk_writer::write(strings_column_view const& rows)
+{
+  CUDF_EXPECTS(rows.size() > 0, "Unexpected empty strings column.");
+
+  auto joined = cudf::strings::detail::join_strings(
+    rows, d_line_terminator_, string_scalar("", false), stream_);
+  strings_column_view const joined_view{joined->view()};
+  auto const num_bytes = static_cast<size_t>(joined_view.chars_size());
+  char const* chars    = joined_view.chars_begin();
+
+  // The copy of the previous chunk ran while this chunk was converted
+  write_staged();
+
+  if (sink_->is_device_write_preferred(num_bytes)) {
+    wait_for_host_write();
+    // Direct write from device memory
+    sink_->device_write(chars, num_bytes, stream_);
+    // Needs newline at the end, to separate from next chunk
+    if (sink_->is_device_write_preferred(d_line_terminator_.size())) {
+      sink_->device_write(d_line_terminator_.data(), d_line_terminator_.size(), stream_);
+    } else {
+      sink_->host_write(line_terminator_.data(), line_terminator_.size());
+    }
+    return;
+  }
+
+  // The staging buffer was last read by the write of the chunk before the previous one, which
+  // has completed
+  auto& staging           = staging_buffers_[next_slot_];
+  auto const staged_bytes = num_bytes + line_terminator_.size();
+  if (staging.get_deleter().size < staged_bytes) {
+    staging = make_pinned_buffer<char>(staged_bytes);
+  }
+  auto const copy_stream = copy_stream_pool_.get_stream();
+  CUDF_CUDA_TRY(cudaEventRecord(converted_event_, stream_.value()));
+  CUDF_CUDA_TRY(cudaStreamWaitEvent(copy_stream.value(), converted_event_, 0));
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    staging.get(), chars, num_bytes, cudaMemcpyDeviceToHost, copy_stream.value()));
+  std::memcpy(staging.get() + num_bytes, line_terminator_.data(), line_terminator_.size());
+
+  staged_rows_  = std::move(joined);
+  staged_bytes_ = staged_bytes;
+  next_slot_ ^= 1;
+}
+
+void chunk_writer::finish()
+{
+  write_staged();
+  wait_for_host_write();
+}
+
+void chunk_writer::write_staged()
+{
+  if (staged_rows_ == nullptr) { return; }
+  cudf::detail::synchronize_stream(copy_stream_pool_.get_stream());
+  staged_rows_.reset();
+
+  wait_for_host_write();
+  host_write_ = host_worker_pool().submit(
+    [sink = sink_, data = staging_buffers_[next_slot_ ^ 1].get(), size = staged_bytes_]() {
+      sink->host_write(data, size);
+    });
+}
+
+void chunk_writer::wait_for_host_write()
+{
+  if (host_write_.valid()) { host_write_.get(); }
+}
+
+}  // namespace cudf::io::detail
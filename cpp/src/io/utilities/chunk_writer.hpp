@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/column/column.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <rmm/cuda_stream_pool.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <array>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Writes chunks of formatted text rows to a sink, overlapping the transfer and the write of
+ * each chunk with the conversion of the next one.
+ *
+ * Used by the text writers (CSV, JSON Lines), which convert a table to one string per row in
+ * chunks of rows.
+ *
+ * Chunks written from host memory are copied into one of two pinned staging buffers on a separate
+ * stream, so that the copy runs while the next chunk is converted on the main stream, and are then
+ * written by a worker thread. Chunks are written in order, and at most one host write is in flight
+ * at any time.
+ */
+class chunk_writer {
+ public:
+  /**
+   * @brief Constructor from a sink and the terminator that follows each row.
+   *
+   * @param sink Sink to write the rows to; must outlive the writer
+   * @param line_terminator String written after each row
+   * @param stream CUDA stream the rows are converted on
+   */
+  chunk_writer(data_sink* sink, std::string const& line_terminator, rmm::cuda_stream_view stream);
+
+  chunk_writer(chunk_writer const&) = delete;
+  chunk_writer& operator=(chunk_writer const&) = delete;
+
+  ~chunk_writer();
+
+  /**
+   * @brief Writes the rows of a chunk, each followed by the line terminator.
+   *
+   * @param rows Non-empty column of the formatted rows
+   */
+  void write(strings_column_view const& rows);
+
+  /**
+   * @brief Writes the last staged chunk and waits for all the writes to complete.
+   */
+  void finish();
+
+ private:
+  void write_staged();
+
+  void wait_for_host_write();
+
+  data_sink* sink_;
+  std::string line_terminator_;
+  string_scalar d_line_terminator_;
+  rmm::cuda_stream_view stream_;
+  rmm::cuda_stream_pool copy_stream_pool_;
+  cudaEvent_t converted_event_{};
+  std::array<pinned_buffer<char>, 2> staging_buffers_;
+  int next_slot_ = 0;
+  std::unique_ptr<column> staged_rows_;  // rows being copied to the last used staging buffer
+  size_t staged_bytes_ = 0;
+  std::future<void> host_write_;
+};
+
+}  // namespace cudf::io::detail
@@ -30,7 +30,8 @@ void column_buffer::create(size_type _size,
                            rmm::cuda_stream_view stream,
                            rmm::mr::device_memory_resource* mr)
 {
-  size = _size;
+  size        = _size;
+  _null_count = 0;
 
   switch (type.id()) {
     case type_id::STRING:
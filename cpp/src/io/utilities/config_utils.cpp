@@ -18,6 +18,7 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <atomic>
 #include <cstdlib>
 #include <string>
 
@@ -49,6 +50,19 @@ usage_policy get_env_policy()
   if (env_val == "KVIKIO") return usage_policy::KVIKIO;
   CUDF_FAIL("Invalid LIBCUDF_CUFILE_POLICY value: " + env_val);
 }
+
+std::atomic<unsigned int>& thread_count_setting()
+{
+  // The benefit from multithreaded read plateaus around 16 threads
+  static std::atomic<unsigned int> count{getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16u)};
+  return count;
+}
+
+std::atomic<size_t>& slice_size_setting()
+{
+  static std::atomic<size_t> size{getenv_or<size_t>("LIBCUDF_CUFILE_SLICE_SIZE", 4 * 1024 * 1024)};
+  return size;
+}
 }  // namespace
 
 bool is_always_enabled() { return get_env_policy() == usage_policy::ALWAYS; }
@@ -57,6 +71,18 @@ bool is_gds_enabled() { return is_always_enabled() or get_env_policy() == usage_
 
 bool is_kvikio_enabled() { return get_env_policy() == usage_policy::KVIKIO; }
 
+unsigned int thread_count() { return thread_count_setting(); }
+
+void set_thread_count(unsigned int count)
+{
+  CUDF_EXPECTS(count > 0, "cuFile thread count must be positive");
+  thread_count_setting() = count;
+}
+
+size_t slice_size() { return slice_size_setting(); }
+
+void set_slice_size(size_t size) { slice_size_setting() = size; }
+
 }  // namespace cufile_integration
 
 namespace nvcomp_integration {
@@ -86,4 +112,16 @@ bool is_stable_enabled() { return is_all_enabled() or get_env_policy() == usage_
 
 }  // namespace nvcomp_integration
 
+namespace host_register_integration {
+
+bool is_mmap_register_enabled()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_MMAP_REGISTER_POLICY", "OFF");
+  if (env_val == "OFF") return false;
+  if (env_val == "ON") return true;
+  CUDF_FAIL("Invalid LIBCUDF_MMAP_REGISTER_POLICY value: " + env_val);
+}
+
+}  // namespace host_register_integration
+
 }  // namespace cudf::io::detail
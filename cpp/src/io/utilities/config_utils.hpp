@@ -15,26 +15,14 @@
  */
 #pragma once
 
-#include <sstream>
+#include <cudf/detail/utilities/getenv_or.hpp>
+
+#include <cstddef>
 #include <string>
 
 namespace cudf::io::detail {
 
-/**
- * @brief Returns the value of the environment variable, or a default value if the variable is not
- * present.
- */
-template <typename T>
-T getenv_or(std::string_view env_var_name, T default_val)
-{
-  auto const env_val = std::getenv(env_var_name.data());
-  if (env_val == nullptr) { return default_val; }
-
-  std::stringstream sstream(env_val);
-  T converted_val;
-  sstream >> converted_val;
-  return converted_val;
-}
+using cudf::detail::getenv_or;
 
 namespace cufile_integration {
 
@@ -53,6 +41,26 @@ bool is_gds_enabled();
  */
 bool is_kvikio_enabled();
 
+/**
+ * @brief Returns the number of threads used for cuFile operations.
+ */
+unsigned int thread_count();
+
+/**
+ * @brief Sets the number of threads used for cuFile operations.
+ */
+void set_thread_count(unsigned int count);
+
+/**
+ * @brief Returns the maximum size of a single cuFile read or write.
+ */
+size_t slice_size();
+
+/**
+ * @brief Sets the maximum size of a single cuFile read or write.
+ */
+void set_slice_size(size_t size);
+
 }  // namespace cufile_integration
 
 namespace nvcomp_integration {
@@ -69,4 +77,14 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+namespace host_register_integration {
+
+/**
+ * @brief Returns true if memory mapped file regions should be registered with CUDA as pinned
+ * memory, so that device reads can copy directly from the mapping.
+ */
+bool is_mmap_register_enabled();
+
+}  // namespace host_register_integration
+
 }  // namespace cudf::io::detail
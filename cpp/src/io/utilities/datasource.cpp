@@ -15,7 +15,9 @@
  */
 
 #include "file_io_utilities.hpp"
+#include "thread_pool.hpp"
 
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/utilities/error.hpp>
 #include <io/utilities/config_utils.hpp>
@@ -23,10 +25,17 @@
 #include <kvikio/file_handle.hpp>
 #include <rmm/device_buffer.hpp>
 
+#include <cuda_runtime.h>
+
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 namespace cudf {
 namespace io {
 namespace {
@@ -103,18 +112,29 @@ class file_source : public datasource {
  *
  * Unlike Arrow's memory mapped IO class, this implementation allows memory mapping a subset of the
  * file where the starting offset may not be zero.
+ *
+ * Each read advises the kernel to read ahead the requested range and the range of the same size
+ * that follows it, since the readers mostly request consecutive column chunks or stripes. When
+ * enabled through `LIBCUDF_MMAP_REGISTER_POLICY`, the mapping is also registered as pinned memory
+ * and device reads are served with a direct copy from the mapping.
  */
 class memory_mapped_source : public file_source {
  public:
   explicit memory_mapped_source(const char* filepath, size_t offset, size_t size)
     : file_source(filepath)
   {
-    if (_file.size() != 0) map(_file.desc(), offset, size);
+    if (_file.size() != 0) {
+      map(_file.desc(), offset, size);
+      register_mmap_buffer();
+    }
   }
 
   ~memory_mapped_source() override
   {
-    if (_map_addr != nullptr) { munmap(_map_addr, _map_size); }
+    if (_map_addr != nullptr) {
+      unregister_mmap_buffer();
+      munmap(_map_addr, _map_size);
+    }
   }
 
   std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
@@ -123,6 +143,7 @@ class memory_mapped_source : public file_source {
 
     // Clamp length to available data in the mapped region
     auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+    prefetch(offset, read_size);
 
     return std::make_unique<non_owning_buffer>(
       static_cast<uint8_t*>(_map_addr) + (offset - _map_offset), read_size);
@@ -134,12 +155,45 @@ class memory_mapped_source : public file_source {
 
     // Clamp length to available data in the mapped region
     auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+    prefetch(offset, read_size);
 
     auto const src = static_cast<uint8_t*>(_map_addr) + (offset - _map_offset);
     std::memcpy(dst, src, read_size);
     return read_size;
   }
 
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _is_map_registered || file_source::supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _is_map_registered || file_source::is_device_read_preferred(size);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    if (not _is_map_registered) {
+      return file_source::device_read_async(offset, size, dst, stream);
+    }
+
+    CUDF_EXPECTS(offset >= _map_offset, "Requested offset is outside mapping");
+
+    // Clamp length to available data in the mapped region
+    auto const read_size = std::min(size, _map_size - (offset - _map_offset));
+
+    auto const src = static_cast<uint8_t*>(_map_addr) + (offset - _map_offset);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst, src, read_size, cudaMemcpyHostToDevice, stream.value()));
+    return std::async(std::launch::deferred, [stream, read_size]() {
+      cudf::detail::synchronize_stream(stream);
+      return read_size;
+    });
+  }
+
  private:
   void map(int fd, size_t offset, size_t size)
   {
@@ -158,10 +212,47 @@ class memory_mapped_source : public file_source {
     CUDF_EXPECTS(_map_addr != MAP_FAILED, "Cannot create memory mapping");
   }
 
+  /**
+   * @brief Registers the mapped region as pinned memory, if enabled.
+   *
+   * Registration faults in the whole mapping, so it only pays off when most of the mapped range is
+   * read. Failure to register is not an error; reads then go through the regular paths.
+   */
+  void register_mmap_buffer()
+  {
+    if (not detail::host_register_integration::is_mmap_register_enabled()) { return; }
+
+    _is_map_registered =
+      cudaHostRegister(_map_addr, _map_size, cudaHostRegisterReadOnly) == cudaSuccess;
+    // clear the sticky error state left by a failed registration
+    if (not _is_map_registered) { cudaGetLastError(); }
+  }
+
+  void unregister_mmap_buffer()
+  {
+    if (_is_map_registered) { cudaHostUnregister(_map_addr); }
+  }
+
+  /**
+   * @brief Asks the kernel to read ahead the given range and the range of the same size after it.
+   */
+  void prefetch(size_t offset, size_t size) const
+  {
+    if (size == 0) { return; }
+
+    auto const page_size   = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    auto const begin       = offset - _map_offset;
+    auto const end         = std::min(begin + 2 * size, _map_size);
+    auto const page_offset = begin & ~(page_size - 1);
+    // advice is only a hint, so errors are ignored
+    madvise(static_cast<uint8_t*>(_map_addr) + page_offset, end - page_offset, MADV_WILLNEED);
+  }
+
  private:
-  size_t _map_size   = 0;
-  size_t _map_offset = 0;
-  void* _map_addr    = nullptr;
+  size_t _map_size        = 0;
+  size_t _map_offset      = 0;
+  void* _map_addr         = nullptr;
+  bool _is_map_registered = false;
 };
 
 /**
@@ -246,6 +337,226 @@ class user_datasource_wrapper : public datasource {
   datasource* const source;  ///< A non-owning pointer to the user-implemented datasource
 };
 
+/**
+ * @brief Wrapper class that coalesces and caches the host reads of a user implemented data source
+ *
+ * The source is divided into aligned blocks of `block_size` bytes. Reads up to
+ * `max_cached_read_size` bytes are served from a least-recently-used cache of blocks; each run of
+ * consecutive missing blocks is fetched with a single read of the wrapped source, and separate
+ * runs are fetched concurrently. Larger reads are split into `num_parallel_reads` concurrent reads
+ * that bypass the cache.
+ *
+ * The wrapped source is held with a non-owning pointer.
+ */
+class cached_source : public datasource {
+  using block_data = std::shared_ptr<std::vector<uint8_t> const>;
+
+ public:
+  explicit cached_source(datasource* const source, cached_source_options const& options)
+    : _source(source), _options(options)
+  {
+    CUDF_EXPECTS(_options.block_size > 0, "Block size must be positive");
+    CUDF_EXPECTS(_options.num_parallel_reads > 0, "Number of parallel reads must be positive");
+    if (_options.num_parallel_reads > 1) {
+      // a dedicated pool, since the readers may call `host_read` from the shared IO worker pool
+      _read_pool = std::make_unique<cudf::detail::thread_pool>(_options.num_parallel_reads);
+    }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> data(std::min(size, this->size() - std::min(offset, this->size())));
+    host_read(offset, data.size(), data.data());
+    return buffer::create(std::move(data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    CUDF_EXPECTS(offset <= this->size(), "Offset is past end of source");
+
+    // Clamp length to available data
+    auto const read_size = std::min(size, this->size() - offset);
+    if (read_size == 0) { return 0; }
+    if (read_size > _options.max_cached_read_size) {
+      read_uncached(offset, read_size, dst);
+      return read_size;
+    }
+
+    auto const block_size  = _options.block_size;
+    auto const first_block = offset / block_size;
+    auto const blocks      = get_blocks(first_block, (offset + read_size - 1) / block_size + 1);
+    for (size_t b = 0, dst_offset = 0; b < blocks.size(); ++b) {
+      auto const block_offset = b == 0 ? offset - first_block * block_size : 0;
+      auto const copy_size    = std::min(blocks[b]->size() - block_offset, read_size - dst_offset);
+      std::copy_n(blocks[b]->data() + block_offset, copy_size, dst + dst_offset);
+      dst_offset += copy_size;
+    }
+    return read_size;
+  }
+
+  [[nodiscard]] bool supports_device_read() const override
+  {
+    return _source->supports_device_read();
+  }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override
+  {
+    return _source->is_device_read_preferred(size);
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, dst, stream);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read(offset, size, stream);
+  }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return _source->device_read_async(offset, size, dst, stream);
+  }
+
+  [[nodiscard]] size_t size() const override { return _source->size(); }
+
+ private:
+  /**
+   * @brief Reads the exact range from the wrapped source with a single read.
+   */
+  void read_exact(size_t offset, size_t size, uint8_t* dst)
+  {
+    CUDF_EXPECTS(_source->host_read(offset, size, dst) == size, "Unexpected end of data source");
+  }
+
+  /**
+   * @brief Reads the exact range from the wrapped source, using concurrent reads when enabled.
+   */
+  void read_uncached(size_t offset, size_t size, uint8_t* dst)
+  {
+    if (_read_pool == nullptr) { return read_exact(offset, size, dst); }
+
+    auto const num_reads = static_cast<size_t>(_options.num_parallel_reads);
+    auto const part_size = std::max(_options.block_size, (size + num_reads - 1) / num_reads);
+    auto const read_part = [this](size_t offset, size_t size, uint8_t* dst) {
+      read_exact(offset, size, dst);
+    };
+    std::vector<std::future<void>> reads;
+    for (size_t part_offset = 0; part_offset < size; part_offset += part_size) {
+      auto const part_read_size = std::min(part_size, size - part_offset);
+      reads.emplace_back(
+        _read_pool->submit(read_part, offset + part_offset, part_read_size, dst + part_offset));
+    }
+    for (auto& read : reads) {
+      read.get();
+    }
+  }
+
+  /**
+   * @brief Returns the blocks in the range [begin, end), reading the ones that are not cached.
+   */
+  std::vector<block_data> get_blocks(size_t begin, size_t end)
+  {
+    std::vector<block_data> blocks(end - begin);
+    {
+      std::lock_guard<std::mutex> lock(_cache_mutex);
+      for (auto b = begin; b < end; ++b) {
+        auto const it = _cache_index.find(b);
+        if (it != _cache_index.end()) {
+          _lru.splice(_lru.begin(), _lru, it->second);
+          blocks[b - begin] = it->second->second;
+        }
+      }
+    }
+
+    // Runs of consecutive missing blocks, each fetched with a single read
+    std::vector<std::pair<size_t, size_t>> missing_runs;
+    for (auto b = begin; b < end; ++b) {
+      if (blocks[b - begin] != nullptr) { continue; }
+      if (missing_runs.empty() || missing_runs.back().second != b) {
+        missing_runs.emplace_back(b, b + 1);
+      } else {
+        ++missing_runs.back().second;
+      }
+    }
+    if (missing_runs.empty()) { return blocks; }
+
+    // Runs are bounded by the requested range rounded out to whole blocks, so each is fetched with
+    // a single read
+    auto const read_run = [this](size_t run_begin, size_t run_end) {
+      auto const offset = run_begin * _options.block_size;
+      std::vector<uint8_t> data(std::min(run_end * _options.block_size, size()) - offset);
+      read_exact(offset, data.size(), data.data());
+      return data;
+    };
+    std::vector<std::vector<uint8_t>> run_data;
+    if (_read_pool == nullptr || missing_runs.size() == 1) {
+      for (auto const& [run_begin, run_end] : missing_runs) {
+        run_data.emplace_back(read_run(run_begin, run_end));
+      }
+    } else {
+      std::vector<std::future<std::vector<uint8_t>>> reads;
+      for (auto const& [run_begin, run_end] : missing_runs) {
+        reads.emplace_back(_read_pool->submit(read_run, run_begin, run_end));
+      }
+      for (auto& read : reads) {
+        run_data.emplace_back(read.get());
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(_cache_mutex);
+    for (size_t r = 0; r < missing_runs.size(); ++r) {
+      auto const [run_begin, run_end] = missing_runs[r];
+      auto const& data                = run_data[r];
+      for (auto b = run_begin; b < run_end; ++b) {
+        auto const block_begin = (b - run_begin) * _options.block_size;
+        auto const block_end   = std::min(block_begin + _options.block_size, data.size());
+        auto block             = std::make_shared<std::vector<uint8_t> const>(
+          data.begin() + block_begin, data.begin() + block_end);
+        blocks[b - begin] = block;
+        insert_block(b, std::move(block));
+      }
+    }
+    return blocks;
+  }
+
+  /**
+   * @brief Adds a block to the cache, evicting the least recently used blocks to stay within the
+   * cache size. Must be called with `_cache_mutex` held.
+   */
+  void insert_block(size_t index, block_data block)
+  {
+    if (_cache_index.count(index) != 0 || block->size() > _options.cache_size) { return; }
+
+    _cached_size += block->size();
+    _lru.emplace_front(index, std::move(block));
+    _cache_index.emplace(index, _lru.begin());
+    while (_cached_size > _options.cache_size) {
+      _cached_size -= _lru.back().second->size();
+      _cache_index.erase(_lru.back().first);
+      _lru.pop_back();
+    }
+  }
+
+  datasource* const _source;  ///< A non-owning pointer to the user-implemented datasource
+  cached_source_options const _options;
+  std::unique_ptr<cudf::detail::thread_pool> _read_pool;
+
+  std::mutex _cache_mutex;
+  std::list<std::pair<size_t, block_data>> _lru;  ///< Cached blocks, most recently used first
+  std::unordered_map<size_t, std::list<std::pair<size_t, block_data>>::iterator> _cache_index;
+  size_t _cached_size = 0;
+};
+
 }  // namespace
 
 std::unique_ptr<datasource> datasource::create(const std::string& filepath,
@@ -275,5 +586,11 @@ std::unique_ptr<datasource> datasource::create(datasource* source)
   return std::make_unique<user_datasource_wrapper>(source);
 }
 
+std::unique_ptr<datasource> datasource::create_cached(datasource* source,
+                                                      cached_source_options const& options)
+{
+  return std::make_unique<cached_source>(source, options);
+}
+
 }  // namespace io
 }  // namespace cudf
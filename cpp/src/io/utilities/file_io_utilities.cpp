@@ -15,6 +15,7 @@
  */
 #include "file_io_utilities.hpp"
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/io/cufile_config.hpp>
 #include <io/utilities/config_utils.hpp>
 
 #include <rmm/device_buffer.hpp>
@@ -167,13 +168,20 @@ void cufile_registered_file::register_handle()
 
 cufile_registered_file::~cufile_registered_file() { shim->handle_deregister(cf_handle); }
 
+cudf::detail::thread_pool& cufile_worker_pool()
+{
+  static auto& pool = []() -> cudf::detail::thread_pool& {
+    static cudf::detail::thread_pool pool(cufile_integration::thread_count());
+    // poll frequently for new slices, small reads are latency sensitive
+    pool.sleep_duration = 10;
+    return pool;
+  }();
+  return pool;
+}
+
 cufile_input_impl::cufile_input_impl(std::string const& filepath)
-  : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_RDONLY | O_DIRECT),
-    // The benefit from multithreaded read plateaus around 16 threads
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+  : shim{cufile_shim::instance()}, cf_file(shim, filepath, O_RDONLY | O_DIRECT)
 {
-  pool.sleep_duration = 10;
 }
 
 namespace {
@@ -184,9 +192,7 @@ template <typename DataT,
 std::vector<std::future<ResultT>> make_sliced_tasks(
   F function, DataT* ptr, size_t offset, size_t size, cudf::detail::thread_pool& pool)
 {
-  constexpr size_t default_max_slice_size = 4 * 1024 * 1024;
-  static auto const max_slice_size = getenv_or("LIBCUDF_CUFILE_SLICE_SIZE", default_max_slice_size);
-  auto const slices                = make_file_io_slices(size, max_slice_size);
+  auto const slices = make_file_io_slices(size, cufile_integration::slice_size());
   std::vector<std::future<ResultT>> slice_tasks;
   std::transform(slices.cbegin(), slices.cend(), std::back_inserter(slice_tasks), [&](auto& slice) {
     return pool.submit(function, ptr + slice.offset, slice.size, offset + slice.offset);
@@ -212,7 +218,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
     return read_size;
   };
 
-  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(read_slice, dst, offset, size, cufile_worker_pool());
 
   auto waiter = [](auto slice_tasks) -> size_t {
     return std::accumulate(slice_tasks.begin(), slice_tasks.end(), 0, [](auto sum, auto& task) {
@@ -226,8 +232,7 @@ std::future<size_t> cufile_input_impl::read_async(size_t offset,
 
 cufile_output_impl::cufile_output_impl(std::string const& filepath)
   : shim{cufile_shim::instance()},
-    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664),
-    pool(getenv_or("LIBCUDF_CUFILE_THREAD_COUNT", 16))
+    cf_file(shim, filepath, O_CREAT | O_RDWR | O_DIRECT, 0664)
 {
 }
 
@@ -245,7 +250,7 @@ std::future<void> cufile_output_impl::write_async(void const* data, size_t offse
   };
 
   auto source      = static_cast<uint8_t const*>(data);
-  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size, pool);
+  auto slice_tasks = make_sliced_tasks(write_slice, source, offset, size, cufile_worker_pool());
 
   auto waiter = [](auto slice_tasks) -> void {
     for (auto const& task : slice_tasks) {
@@ -303,5 +308,20 @@ std::vector<file_io_slice> make_file_io_slices(size_t size, size_t max_slice_siz
 }
 
 }  // namespace detail
+
+void set_cufile_thread_count(unsigned int count)
+{
+  detail::cufile_integration::set_thread_count(count);
+#ifdef CUFILE_FOUND
+  detail::cufile_worker_pool().reset(count);
+#endif
+}
+
+unsigned int get_cufile_thread_count() { return detail::cufile_integration::thread_count(); }
+
+void set_cufile_slice_size(std::size_t size) { detail::cufile_integration::set_slice_size(size); }
+
+std::size_t get_cufile_slice_size() { return detail::cufile_integration::slice_size(); }
+
 }  // namespace io
 }  // namespace cudf
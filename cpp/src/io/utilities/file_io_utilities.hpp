@@ -154,6 +154,13 @@ struct cufile_registered_file {
   cufile_shim const* shim  = nullptr;
 };
 
+/**
+ * @brief Returns the pool of threads shared by the cuFile reads and writes of all files.
+ *
+ * The number of threads is set with `set_cufile_thread_count`.
+ */
+cudf::detail::thread_pool& cufile_worker_pool();
+
 /**
  * @brief Adapter for the `cuFileRead` API.
  *
@@ -171,7 +178,6 @@ class cufile_input_impl final : public cufile_input {
  private:
   cufile_shim const* shim = nullptr;
   cufile_registered_file const cf_file;
-  cudf::detail::thread_pool pool;
 };
 
 /**
@@ -188,7 +194,6 @@ class cufile_output_impl final : public cufile_output {
  private:
   cufile_shim const* shim = nullptr;
   cufile_registered_file const cf_file;
-  cudf::detail::thread_pool pool;
 };
 #else
 
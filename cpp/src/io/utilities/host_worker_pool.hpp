@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "thread_pool.hpp"
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Returns the process-wide pool of host threads used for blocking IO work in the readers
+ * and writers.
+ *
+ * The pool is created on first use. Its size is controlled by the `LIBCUDF_IO_THREAD_COUNT`
+ * environment variable and defaults to 8 threads.
+ *
+ * Tasks that launch CUDA work must set the device of the submitting thread before doing so, since
+ * the worker threads start on the default device.
+ *
+ * @return Reference to the shared thread pool
+ */
+cudf::detail::thread_pool& host_worker_pool();
+
+}  // namespace cudf::io::detail
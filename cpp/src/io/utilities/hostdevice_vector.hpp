@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include "pinned_memory_pool.hpp"
+
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -30,7 +33,8 @@
  * This abstraction allocates a specified fixed chunk of device memory that can
  * initialized upfront, or gradually initialized as required.
  * The host-side memory can be used to manipulate data on the CPU before and
- * after operating on the same data on the GPU.
+ * after operating on the same data on the GPU. It is allocated from the shared pinned host memory
+ * pool.
  */
 template <typename T>
 class hostdevice_vector {
@@ -42,6 +46,7 @@ class hostdevice_vector {
   hostdevice_vector(hostdevice_vector&& v) { move(std::move(v)); }
   hostdevice_vector& operator=(hostdevice_vector&& v)
   {
+    free_host();
     move(std::move(v));
     return *this;
   }
@@ -55,18 +60,13 @@ class hostdevice_vector {
     : max_elements(max_size), num_elements(initial_size)
   {
     if (max_elements != 0) {
-      CUDF_CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&h_data), sizeof(T) * max_elements));
+      h_data = static_cast<T*>(
+        cudf::io::detail::pinned_host_pool().allocate(sizeof(T) * max_elements));
       d_data.resize(sizeof(T) * max_elements, stream);
     }
   }
 
-  ~hostdevice_vector()
-  {
-    if (max_elements != 0) {
-      [[maybe_unused]] auto const free_result = cudaFreeHost(h_data);
-      assert(free_result == cudaSuccess);
-    }
-  }
+  ~hostdevice_vector() { free_host(); }
 
   bool insert(const T& data)
   {
@@ -124,7 +124,7 @@ class hostdevice_vector {
                                   sizeof(value),
                                   cudaMemcpyDefault,
                                   stream.value()));
-    stream.synchronize();
+    cudf::detail::synchronize_stream(stream);
     return value;
   }
 
@@ -138,17 +138,24 @@ class hostdevice_vector {
   {
     CUDF_CUDA_TRY(cudaMemcpyAsync(
       d_data.data(), h_data, memory_size(), cudaMemcpyHostToDevice, stream.value()));
-    if (synchronize) { stream.synchronize(); }
+    if (synchronize) { cudf::detail::synchronize_stream(stream); }
   }
 
   void device_to_host(rmm::cuda_stream_view stream, bool synchronize = false)
   {
     CUDF_CUDA_TRY(cudaMemcpyAsync(
       h_data, d_data.data(), memory_size(), cudaMemcpyDeviceToHost, stream.value()));
-    if (synchronize) { stream.synchronize(); }
+    if (synchronize) { cudf::detail::synchronize_stream(stream); }
   }
 
  private:
+  void free_host()
+  {
+    if (max_elements != 0) {
+      cudf::io::detail::pinned_host_pool().deallocate(h_data, sizeof(T) * max_elements);
+    }
+  }
+
   void move(hostdevice_vector&& v)
   {
     stream       = v.stream;
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/io/types.hpp>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/utilities/span.hpp>
 #include <io/utilities/trie.cuh>
 
@@ -194,6 +195,18 @@ constexpr T parse_numeric(const char* begin,
   // Handle the whole part of the number
   // auto index = begin;
   while (begin < end) {
+    // runs of 8 digits are converted together
+    if constexpr (base == 10 && !std::is_same_v<T, bool>) {
+      if (end - begin >= 8) {
+        auto const chunk = strings::detail::load_eight_bytes(begin);
+        if (strings::detail::is_eight_digits(chunk)) {
+          value = (value * static_cast<T>(100000000)) +
+                  static_cast<T>(strings::detail::parse_eight_digits(chunk));
+          begin += 8;
+          continue;
+        }
+      }
+    }
     if (*begin == opts.decimal) {
       ++begin;
       break;
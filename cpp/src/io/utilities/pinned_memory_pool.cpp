@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "pinned_memory_pool.hpp"
+
+#include "config_utils.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+
+namespace cudf::io {
+namespace detail {
+
+namespace {
+// Allocations are rounded up so that every block in the pool stays aligned
+constexpr std::size_t pinned_allocation_alignment = 256;
+
+std::size_t aligned_size(std::size_t size)
+{
+  return (size + pinned_allocation_alignment - 1) / pinned_allocation_alignment *
+         pinned_allocation_alignment;
+}
+}  // namespace
+
+pinned_memory_pool::pinned_memory_pool(std::size_t size) : _size{aligned_size(size)} {}
+
+pinned_memory_pool::~pinned_memory_pool() { release_pool(); }
+
+void* pinned_memory_pool::allocate(std::size_t size)
+{
+  if (size == 0) { return nullptr; }
+  auto const alloc_size = aligned_size(size);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_pool == nullptr and _size != 0) {
+      CUDF_CUDA_TRY(cudaMallocHost(reinterpret_cast<void**>(&_pool), _size));
+      _free_blocks     = {{0, _size}};
+      _stats.pool_size = _size;
+    }
+    auto const block = std::find_if(_free_blocks.begin(), _free_blocks.end(), [&](auto const& b) {
+      return b.second >= alloc_size;
+    });
+    if (block != _free_blocks.end()) {
+      auto const [offset, block_size] = *block;
+      _free_blocks.erase(block);
+      if (block_size > alloc_size) {
+        _free_blocks.emplace(offset + alloc_size, block_size - alloc_size);
+      }
+
+      _stats.bytes_in_use += alloc_size;
+      _stats.peak_bytes_in_use = std::max(_stats.peak_bytes_in_use, _stats.bytes_in_use);
+      ++_stats.num_allocations;
+      return _pool + offset;
+    }
+    ++_stats.num_fallback_allocations;
+  }
+
+  void* ptr = nullptr;
+  CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
+  return ptr;
+}
+
+void pinned_memory_pool::deallocate(void* ptr, std::size_t size)
+{
+  if (ptr == nullptr) { return; }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto const p = static_cast<uint8_t*>(ptr);
+    if (_pool != nullptr and p >= _pool and p < _pool + _size) {
+      auto offset     = static_cast<std::size_t>(p - _pool);
+      auto block_size = aligned_size(size);
+      _stats.bytes_in_use -= block_size;
+
+      // merge with the free neighbors
+      auto next = _free_blocks.lower_bound(offset);
+      if (next != _free_blocks.end() and offset + block_size == next->first) {
+        block_size += next->second;
+        next = _free_blocks.erase(next);
+      }
+      if (next != _free_blocks.begin()) {
+        auto const prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+          offset = prev->first;
+          block_size += prev->second;
+          _free_blocks.erase(prev);
+        }
+      }
+      _free_blocks.emplace(offset, block_size);
+      return;
+    }
+  }
+
+  [[maybe_unused]] auto const free_result = cudaFreeHost(ptr);
+  assert(free_result == cudaSuccess);
+}
+
+void pinned_memory_pool::resize(std::size_t size)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  CUDF_EXPECTS(_stats.bytes_in_use == 0,
+               "Cannot resize the pinned memory pool while its memory is in use");
+  release_pool();
+  _size            = aligned_size(size);
+  _stats.pool_size = 0;
+}
+
+pinned_memory_pool_stats pinned_memory_pool::stats() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _stats;
+}
+
+void pinned_memory_pool::release_pool()
+{
+  if (_pool != nullptr) {
+    [[maybe_unused]] auto const free_result = cudaFreeHost(_pool);
+    assert(free_result == cudaSuccess);
+    _pool = nullptr;
+  }
+  _free_blocks.clear();
+}
+
+pinned_memory_pool& pinned_host_pool()
+{
+  // never destroyed, so that the pool is not freed after the CUDA runtime has shut down
+  static auto* pool =
+    new pinned_memory_pool(getenv_or<std::size_t>("LIBCUDF_PINNED_POOL_SIZE", 64 << 20));
+  return *pool;
+}
+
+}  // namespace detail
+
+void set_pinned_memory_pool_size(std::size_t size) { detail::pinned_host_pool().resize(size); }
+
+pinned_memory_pool_stats get_pinned_memory_pool_stats()
+{
+  return detail::pinned_host_pool().stats();
+}
+
+}  // namespace cudf::io
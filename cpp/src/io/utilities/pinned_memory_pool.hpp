@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/pinned_memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Pool of pinned host memory shared by the staging buffers of the readers and writers.
+ *
+ * The pool is a single pinned allocation, created on first use, that is split into blocks with a
+ * first-fit policy; freed blocks are merged with their free neighbors. Requests that do not fit in
+ * the pool are served by `cudaMallocHost` directly. All member functions are thread-safe.
+ */
+class pinned_memory_pool {
+ public:
+  explicit pinned_memory_pool(std::size_t size);
+  ~pinned_memory_pool();
+
+  pinned_memory_pool(pinned_memory_pool const&) = delete;
+  pinned_memory_pool& operator=(pinned_memory_pool const&) = delete;
+
+  /**
+   * @brief Allocates `size` bytes of pinned host memory.
+   *
+   * @param size Number of bytes to allocate
+   * @return Pointer to the allocated memory, nullptr if `size` is zero
+   */
+  void* allocate(std::size_t size);
+
+  /**
+   * @brief Frees memory returned by `allocate`.
+   *
+   * @param ptr Pointer returned by `allocate`
+   * @param size Size passed to `allocate`
+   */
+  void deallocate(void* ptr, std::size_t size);
+
+  /**
+   * @brief Replaces the pool with one of the given size; see `set_pinned_memory_pool_size`.
+   */
+  void resize(std::size_t size);
+
+  /**
+   * @brief Returns the usage statistics of the pool.
+   */
+  [[nodiscard]] pinned_memory_pool_stats stats() const;
+
+ private:
+  void release_pool();
+
+  mutable std::mutex _mutex;
+  std::size_t _size;
+  uint8_t* _pool = nullptr;
+  std::map<std::size_t, std::size_t> _free_blocks;  // offset -> size
+  pinned_memory_pool_stats _stats{};
+};
+
+/**
+ * @brief Returns the process-wide pinned host memory pool.
+ *
+ * The initial size of the pool is read from the `LIBCUDF_PINNED_POOL_SIZE` environment variable.
+ *
+ * @return Reference to the shared pool
+ */
+pinned_memory_pool& pinned_host_pool();
+
+/**
+ * @brief Deleter for buffers allocated from the pinned host memory pool
+ */
+struct pinned_buffer_deleter {
+  std::size_t size = 0;
+
+  void operator()(void* ptr) const { pinned_host_pool().deallocate(ptr, size); }
+};
+
+/**
+ * @brief Helper for pinned host memory allocated from the shared pool
+ */
+template <typename T>
+using pinned_buffer = std::unique_ptr<T, pinned_buffer_deleter>;
+
+/**
+ * @brief Allocates a pinned buffer of `num_elements` elements of type `T` from the shared pool.
+ *
+ * The elements are not initialized.
+ */
+template <typename T>
+pinned_buffer<T> make_pinned_buffer(std::size_t num_elements)
+{
+  auto const size = num_elements * sizeof(T);
+  return pinned_buffer<T>{static_cast<T*>(pinned_host_pool().allocate(size)),
+                          pinned_buffer_deleter{size}};
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/**
+ * @file stats_filter.hpp
+ * @brief Evaluation of AST filters against column statistics, used by the readers to skip data
+ * that cannot satisfy the filter
+ */
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cmath>
+#include <functional>
+#include <optional>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+
+/**
+ * @brief The boolean values an expression may evaluate to over a range of rows, e.g. a Parquet
+ * row group or an ORC stripe.
+ *
+ * Both flags are conservative: `can_be_true == false` proves that no row of the range satisfies
+ * the expression.
+ */
+struct stats_truth {
+  bool can_be_true  = true;
+  bool can_be_false = true;
+};
+
+/**
+ * @brief Statistics of a column over a range of rows in a form comparable against numeric
+ * literals.
+ */
+struct column_chunk_stats {
+  bool has_range = false;  // whether `min` and `max` are valid
+  bool all_nulls = false;  // whether every value in the range is null
+  long double min{};
+  long double max{};
+};
+
+/**
+ * @brief Converts a numeric AST literal into a `long double`, if possible.
+ */
+struct literal_value_fn {
+  template <typename T, std::enable_if_t<cudf::is_numeric<T>()>* = nullptr>
+  std::optional<long double> operator()(cudf::scalar const& value, rmm::cuda_stream_view stream)
+  {
+    auto const v = static_cast<cudf::numeric_scalar<T> const&>(value).value(stream);
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(v)) { return std::nullopt; }
+    }
+    return static_cast<long double>(v);
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_numeric<T>()>* = nullptr>
+  std::optional<long double> operator()(cudf::scalar const&, rmm::cuda_stream_view)
+  {
+    return std::nullopt;
+  }
+};
+
+/**
+ * @brief Evaluates an AST filter over the column statistics of a range of rows.
+ *
+ * Comparisons between a column reference and a numeric literal are evaluated against the
+ * [min, max] range of the column and combined through logical operators. Equality comparisons
+ * that the range cannot rule out are further checked through `may_contain`, e.g. against a Bloom
+ * filter. Any other expression is assumed to possibly evaluate to either value.
+ */
+class stats_expression_evaluator {
+ public:
+  stats_expression_evaluator(std::function<column_chunk_stats(size_type)> get_stats,
+                             std::function<bool(size_type, long double)> may_contain,
+                             rmm::cuda_stream_view stream)
+    : _get_stats(std::move(get_stats)), _may_contain(std::move(may_contain)), _stream(stream)
+  {
+  }
+
+  [[nodiscard]] stats_truth evaluate(ast::expression const& expr) const
+  {
+    auto const op_expr = dynamic_cast<ast::operation const*>(&expr);
+    if (op_expr == nullptr) { return {}; }
+    auto const operands = op_expr->get_operands();
+    switch (op_expr->get_operator()) {
+      case ast::ast_operator::LOGICAL_AND:
+      case ast::ast_operator::NULL_LOGICAL_AND: {
+        auto const lhs = evaluate(operands[0]);
+        auto const rhs = evaluate(operands[1]);
+        return {lhs.can_be_true && rhs.can_be_true, lhs.can_be_false || rhs.can_be_false};
+      }
+      case ast::ast_operator::LOGICAL_OR:
+      case ast::ast_operator::NULL_LOGICAL_OR: {
+        auto const lhs = evaluate(operands[0]);
+        auto const rhs = evaluate(operands[1]);
+        return {lhs.can_be_true || rhs.can_be_true, lhs.can_be_false && rhs.can_be_false};
+      }
+      case ast::ast_operator::NOT: {
+        auto const arg = evaluate(operands[0]);
+        return {arg.can_be_false, arg.can_be_true};
+      }
+      case ast::ast_operator::EQUAL:
+      case ast::ast_operator::NOT_EQUAL:
+      case ast::ast_operator::LESS:
+      case ast::ast_operator::GREATER:
+      case ast::ast_operator::LESS_EQUAL:
+      case ast::ast_operator::GREATER_EQUAL:
+        return compare(op_expr->get_operator(), operands[0], operands[1]);
+      default: return {};
+    }
+  }
+
+ private:
+  [[nodiscard]] stats_truth compare(ast::ast_operator op,
+                                    ast::expression const& lhs,
+                                    ast::expression const& rhs) const
+  {
+    auto col = dynamic_cast<ast::column_reference const*>(&lhs);
+    auto lit = dynamic_cast<ast::literal const*>(&rhs);
+    if (col == nullptr || lit == nullptr) {
+      // Normalize `literal op column` into `column op' literal`
+      col = dynamic_cast<ast::column_reference const*>(&rhs);
+      lit = dynamic_cast<ast::literal const*>(&lhs);
+      if (col == nullptr || lit == nullptr) { return {}; }
+      switch (op) {
+        case ast::ast_operator::LESS: op = ast::ast_operator::GREATER; break;
+        case ast::ast_operator::GREATER: op = ast::ast_operator::LESS; break;
+        case ast::ast_operator::LESS_EQUAL: op = ast::ast_operator::GREATER_EQUAL; break;
+        case ast::ast_operator::GREATER_EQUAL: op = ast::ast_operator::LESS_EQUAL; break;
+        default: break;
+      }
+    }
+    if (col->get_table_source() != ast::table_reference::LEFT) { return {}; }
+    if (not lit->is_valid(_stream)) { return {}; }
+
+    auto const& value = lit->get_scalar();
+    auto const v      = type_dispatcher(value.type(), literal_value_fn{}, value, _stream);
+    if (not v.has_value()) { return {}; }
+
+    auto const stats = _get_stats(col->get_column_index());
+    if (not stats.has_range) {
+      // Comparisons against nulls are never true
+      if (stats.all_nulls) { return {false, false}; }
+      // Without a range, an equality can still be ruled out by `may_contain`
+      switch (op) {
+        case ast::ast_operator::EQUAL: return {_may_contain(col->get_column_index(), *v), true};
+        case ast::ast_operator::NOT_EQUAL: return {true, _may_contain(col->get_column_index(), *v)};
+        default: return {};
+      }
+    }
+
+    auto const min      = stats.min;
+    auto const max      = stats.max;
+    auto const in_range = [&]() {
+      return min <= *v && *v <= max && _may_contain(col->get_column_index(), *v);
+    };
+    switch (op) {
+      case ast::ast_operator::EQUAL: return {in_range(), !(min == *v && max == *v)};
+      case ast::ast_operator::NOT_EQUAL: return {!(min == *v && max == *v), in_range()};
+      case ast::ast_operator::LESS: return {min < *v, max >= *v};
+      case ast::ast_operator::LESS_EQUAL: return {min <= *v, max > *v};
+      case ast::ast_operator::GREATER: return {max > *v, min <= *v};
+      case ast::ast_operator::GREATER_EQUAL: return {max >= *v, min < *v};
+      default: return {};
+    }
+  }
+
+  std::function<column_chunk_stats(size_type)> _get_stats;
+  std::function<bool(size_type, long double)> _may_contain;
+  rmm::cuda_stream_view _stream;
+};
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
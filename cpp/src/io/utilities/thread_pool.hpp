@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -25,14 +25,15 @@
 #include <atomic>       // std::atomic
 #include <chrono>       // std::chrono
 #include <cstdint>      // std::int_fast64_t, std::uint_fast32_t
+#include <deque>        // std::deque
 #include <functional>   // std::function
 #include <future>       // std::future, std::promise
 #include <memory>       // std::shared_ptr, std::unique_ptr
 #include <mutex>        // std::mutex, std::scoped_lock
-#include <queue>        // std::queue
 #include <thread>       // std::this_thread, std::thread
 #include <type_traits>  // std::decay_t, std::enable_if_t, std::is_void_v, std::invoke_result_t
 #include <utility>      // std::move, std::swap
+#include <vector>       // std::vector
 
 namespace cudf {
 namespace detail {
@@ -42,6 +43,11 @@ namespace detail {
  * thread becomes available, it pops a task from the queue and executes it. Each task is
  * automatically assigned a future, which can be used to wait for the task to finish executing
  * and/or obtain its eventual return value.
+ *
+ * Each thread has its own task queue, each guarded by its own mutex. Tasks submitted from one of
+ * the pool's threads go to that thread's queue, other tasks are distributed over the queues in a
+ * round-robin fashion. A thread whose queue is empty steals tasks from the other queues, so that
+ * submitting many small tasks does not contend on a single lock.
  */
 class thread_pool {
   using ui32 = int;
@@ -57,7 +63,8 @@ class thread_pool {
    */
   thread_pool(const ui32& _thread_count = std::thread::hardware_concurrency())
     : thread_count(_thread_count ? _thread_count : std::thread::hardware_concurrency()),
-      threads(new std::thread[_thread_count ? _thread_count : std::thread::hardware_concurrency()])
+      threads(new std::thread[thread_count]),
+      queues(new task_queue[thread_count])
   {
     create_threads();
   }
@@ -81,8 +88,13 @@ class thread_pool {
    */
   [[nodiscard]] size_t get_tasks_queued() const
   {
-    const std::scoped_lock lock(queue_mutex);
-    return tasks.size();
+    size_t num_queued = 0;
+    for (ui32 i = 0; i < thread_count; i++) {
+      const std::scoped_lock lock(queues[i].mutex);
+      num_queued += queues[i].tasks.size();
+    }
+    const std::scoped_lock lock(continuations_mutex);
+    return num_queued + continuations.size();
   }
 
   /**
@@ -157,9 +169,12 @@ class thread_pool {
   void push_task(const F& task)
   {
     tasks_total++;
+    // Tasks submitted by the pool's own threads stay local to the submitting thread
+    auto const queue_idx =
+      (current_pool == this) ? current_thread : (ui32)(next_queue++ % (size_t)thread_count);
     {
-      const std::scoped_lock lock(queue_mutex);
-      tasks.push(std::function<void()>(task));
+      const std::scoped_lock lock(queues[queue_idx].mutex);
+      queues[queue_idx].tasks.emplace_back(task);
     }
   }
 
@@ -186,7 +201,7 @@ class thread_pool {
    * completed, then destroys all threads in the pool and creates a new thread pool with the new
    * number of threads. Any tasks that were waiting in the queue before the pool was reset will then
    * be executed by the new threads. If the pool was paused before resetting it, the new pool will
-   * be paused as well.
+   * be paused as well. Must not be called concurrently with the submission of new tasks.
    *
    * @param _thread_count The number of threads to use. The default value is the total number of
    * hardware threads available, as reported by the implementation. With a hyperthreaded CPU, this
@@ -200,11 +215,24 @@ class thread_pool {
     wait_for_tasks();
     running = false;
     destroy_threads();
+
+    // Move the tasks that are still queued to the queues of the new threads
+    std::vector<std::function<void()>> queued_tasks;
+    for (ui32 i = 0; i < thread_count; i++) {
+      for (auto& task : queues[i].tasks) {
+        queued_tasks.push_back(std::move(task));
+      }
+    }
     thread_count = _thread_count ? _thread_count : std::thread::hardware_concurrency();
     threads.reset(new std::thread[thread_count]);
-    paused = was_paused;
-    create_threads();
+    queues.reset(new task_queue[thread_count]);
+    for (size_t i = 0; i < queued_tasks.size(); i++) {
+      queues[i % thread_count].tasks.push_back(std::move(queued_tasks[i]));
+    }
+
+    paused  = was_paused;
     running = true;
+    create_threads();
   }
 
   /**
@@ -241,6 +269,51 @@ class thread_pool {
     return future;
   }
 
+  /**
+   * @brief Submit a continuation that is executed by the pool once the given future is ready, and
+   * get a future for its eventual returned value.
+   *
+   * No thread is blocked while the future is not ready; whenever the threads run out of tasks,
+   * they check the pending continuations and execute the ones whose input is ready. A deferred
+   * future is considered ready, and is evaluated by the continuation's thread. This allows chaining
+   * asynchronous steps, e.g. decompressing a buffer once the read that produces it completes.
+   *
+   * @tparam T The type of the value of the input future.
+   * @tparam F The type of the continuation. Should take the ready input future as its argument.
+   * @tparam R The return type of the continuation.
+   * @param future The future whose completion triggers the continuation.
+   * @param continuation The function to execute.
+   * @return A future to be used later to obtain the continuation's returned value.
+   */
+  template <typename T,
+            typename F,
+            typename R = std::invoke_result_t<std::decay_t<F>, std::future<T>>>
+  std::future<R> then(std::future<T>&& future, const F& continuation)
+  {
+    auto input   = std::make_shared<std::future<T>>(std::move(future));
+    auto promise = std::make_shared<std::promise<R>>();
+    auto result  = promise->get_future();
+    tasks_total++;
+    const std::scoped_lock lock(continuations_mutex);
+    continuations.emplace_back([input, continuation, promise]() {
+      if (input->wait_for(std::chrono::seconds(0)) == std::future_status::timeout) {
+        return false;
+      }
+      try {
+        if constexpr (std::is_void_v<R>) {
+          continuation(std::move(*input));
+          promise->set_value();
+        } else {
+          promise->set_value(continuation(std::move(*input)));
+        }
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+      return true;
+    });
+    return result;
+  }
+
   /**
    * @brief Wait for tasks to be completed. Normally, this function waits for all tasks, both those
    * that are currently running in the threads and those that are still waiting in the queue.
@@ -282,7 +355,7 @@ class thread_pool {
   void create_threads()
   {
     for (ui32 i = 0; i < thread_count; i++) {
-      threads[i] = std::thread(&thread_pool::worker, this);
+      threads[i] = std::thread(&thread_pool::worker, this, i);
     }
   }
 
@@ -297,22 +370,65 @@ class thread_pool {
   }
 
   /**
-   * @brief Try to pop a new task out of the queue.
+   * @brief Try to pop a new task out of the queue of the given thread, or steal one from the queues
+   * of the other threads if it is empty.
    *
-   * @param task A reference to the task. Will be populated with a function if the queue is not
-   * empty.
-   * @return true if a task was found, false if the queue is empty.
+   * @param thread_idx The index of the thread looking for a task.
+   * @param task A reference to the task. Will be populated with a function if a task was found.
+   * @return true if a task was found, false if all the queues are empty.
    */
-  bool pop_task(std::function<void()>& task)
+  bool pop_task(ui32 thread_idx, std::function<void()>& task)
   {
-    const std::scoped_lock lock(queue_mutex);
-    if (tasks.empty())
-      return false;
-    else {
-      task = std::move(tasks.front());
-      tasks.pop();
-      return true;
+    {
+      auto& queue = queues[thread_idx];
+      const std::scoped_lock lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+      }
+    }
+    // Steal from the back, away from the end where the owner takes its tasks
+    for (ui32 i = 1; i < thread_count; i++) {
+      auto& queue = queues[(thread_idx + i) % thread_count];
+      const std::scoped_lock lock(queue.mutex);
+      if (!queue.tasks.empty()) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Execute the pending continuations whose input is ready.
+   *
+   * @return true if any continuation was executed.
+   */
+  bool run_ready_continuations()
+  {
+    std::vector<std::function<bool()>> pending;
+    {
+      const std::scoped_lock lock(continuations_mutex);
+      pending.swap(continuations);
+    }
+    if (pending.empty()) return false;
+
+    std::vector<std::function<bool()>> not_ready;
+    for (auto& continuation : pending) {
+      if (continuation()) {
+        tasks_total--;
+      } else {
+        not_ready.push_back(std::move(continuation));
+      }
     }
+    bool const executed = not_ready.size() < pending.size();
+    const std::scoped_lock lock(continuations_mutex);
+    for (auto& continuation : not_ready) {
+      continuations.push_back(std::move(continuation));
+    }
+    return executed;
   }
 
   /**
@@ -329,25 +445,34 @@ class thread_pool {
 
   /**
    * @brief A worker function to be assigned to each thread in the pool. Continuously pops tasks out
-   * of the queue and executes them, as long as the atomic variable running is set to true.
+   * of the queues and executes them, as long as the atomic variable running is set to true.
+   *
+   * @param thread_idx The index of the thread, and of the queue it owns.
    */
-  void worker()
+  void worker(ui32 thread_idx)
   {
+    current_pool   = this;
+    current_thread = thread_idx;
     while (running) {
       std::function<void()> task;
-      if (!paused && pop_task(task)) {
+      if (!paused && pop_task(thread_idx, task)) {
         task();
         tasks_total--;
-      } else {
+      } else if (paused || !run_ready_continuations()) {
         sleep_or_yield();
       }
     }
+    current_pool = nullptr;
   }
 
   /**
-   * @brief A mutex to synchronize access to the task queue by different threads.
+   * @brief A queue of tasks owned by one thread, with a mutex to synchronize access to it by
+   * different threads.
    */
-  mutable std::mutex queue_mutex;
+  struct task_queue {
+    mutable std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
 
   /**
    * @brief An atomic variable indicating to the workers to keep running. When set to false, the
@@ -355,11 +480,6 @@ class thread_pool {
    */
   std::atomic<bool> running = true;
 
-  /**
-   * @brief A queue of tasks to be executed by the threads.
-   */
-  std::queue<std::function<void()>> tasks;
-
   /**
    * @brief The number of threads in the pool.
    */
@@ -370,6 +490,37 @@ class thread_pool {
    */
   std::unique_ptr<std::thread[]> threads;
 
+  /**
+   * @brief The task queues, one per thread.
+   */
+  std::unique_ptr<task_queue[]> queues;
+
+  /**
+   * @brief The index of the queue that receives the next task submitted from outside the pool.
+   */
+  std::atomic<size_t> next_queue = 0;
+
+  /**
+   * @brief A mutex to synchronize access to the pending continuations.
+   */
+  mutable std::mutex continuations_mutex;
+
+  /**
+   * @brief Continuations waiting for their input to be ready. Each one returns true if it was
+   * executed and false if its input is not ready yet.
+   */
+  std::vector<std::function<bool()>> continuations;
+
+  /**
+   * @brief The pool that the current thread belongs to, or nullptr for threads outside any pool.
+   */
+  static inline thread_local thread_pool const* current_pool = nullptr;
+
+  /**
+   * @brief The index of the current thread within `current_pool`.
+   */
+  static inline thread_local ui32 current_thread = 0;
+
   /**
    * @brief An atomic variable to keep track of the total number of unfinished tasks - either still
    * in the queue, or running in a thread.
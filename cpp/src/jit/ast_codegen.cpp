@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <jit/ast_codegen.hpp>
+#include <jit/type.hpp>
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace jit {
+
+int ast_codegen::emit(ast::expression const& expr)
+{
+  if (auto const* literal = dynamic_cast<ast::literal const*>(&expr)) {
+    return emit_literal(*literal);
+  }
+  if (auto const* column = dynamic_cast<ast::column_reference const*>(&expr)) {
+    return emit_column(*column);
+  }
+  if (auto const* operation = dynamic_cast<ast::operation const*>(&expr)) {
+    return emit_operation(*operation);
+  }
+  CUDF_FAIL("Unsupported expression node in JIT-compiled expression");
+}
+
+int ast_codegen::emit_literal(ast::literal const& literal)
+{
+  auto const type = literal.get_data_type();
+  CUDF_EXPECTS(is_numeric(type), "JIT-compiled expressions only support numeric literals");
+  auto const index = _literals.size();
+  _literals.push_back(&literal);
+
+  auto const id = _next_id++;
+  _body << "  auto const v" << id << " = *static_cast<" << get_type_name(type)
+        << " const*>(literal_data[" << index << "]);\n"
+        << "  bool const n" << id << " = *literal_valid[" << index << "];\n";
+  return id;
+}
+
+int ast_codegen::emit_column(ast::column_reference const& column)
+{
+  auto const source = column.get_table_source();
+  CUDF_EXPECTS(source != ast::table_reference::OUTPUT,
+               "JIT-compiled expressions cannot reference output columns");
+  auto const is_left = source == ast::table_reference::LEFT;
+  CUDF_EXPECTS(is_left or _right != nullptr,
+               "JIT-compiled expressions on a single table cannot reference the right table");
+  auto const& table = is_left ? _left : *_right;
+  auto const index  = column.get_column_index();
+  CUDF_EXPECTS(index < table.num_columns(), "Column reference out of bounds");
+  auto const& col = table.column(index);
+  CUDF_EXPECTS(is_numeric(col.type()), "JIT-compiled expressions only support numeric columns");
+
+  auto const side = std::string{is_left ? "left" : "right"};
+  auto const id   = _next_id++;
+  _body << "  auto const v" << id << " = static_cast<" << get_type_name(col.type()) << " const*>("
+        << side << "_data[" << index << "])[" << side << "_row];\n"
+        << "  bool const n" << id << " = ";
+  if (col.nullable()) {
+    _body << "cudf::bit_is_set(" << side << "_masks[" << index << "], " << side << "_offsets["
+          << index << "] + " << side << "_row);\n";
+  } else {
+    _body << "true;\n";
+  }
+  return id;
+}
+
+int ast_codegen::emit_operation(ast::operation const& operation)
+{
+  auto const operands = operation.get_operands();
+  std::vector<int> args;
+  for (auto const& operand : operands) {
+    args.push_back(emit(operand.get()));
+  }
+
+  auto const op = operation.get_operator();
+  auto const id = _next_id++;
+  auto value    = [&](int i) { return "v" + std::to_string(args[i]); };
+  auto valid    = [&](int i) { return "n" + std::to_string(args[i]); };
+
+  // null-aware operators
+  if (op == ast::ast_operator::NULL_EQUAL) {
+    _body << "  bool const v" << id << " = (" << valid(0) << " && " << valid(1) << ") ? ("
+          << value(0) << " == " << value(1) << ") : (" << valid(0) << " == " << valid(1)
+          << ");\n"
+          << "  bool const n" << id << " = true;\n";
+    return id;
+  }
+  if (op == ast::ast_operator::NULL_LOGICAL_AND || op == ast::ast_operator::NULL_LOGICAL_OR) {
+    // a valid false (true) operand decides the result of a logical and (or) on its own
+    auto const is_and   = op == ast::ast_operator::NULL_LOGICAL_AND;
+    auto const decisive = [&](int i) {
+      return "(" + valid(i) + " && " + (is_and ? "!" : "") + value(i) + ")";
+    };
+    _body << "  bool const n" << id << " = (" << valid(0) << " && " << valid(1) << ") || "
+          << decisive(0) << " || " << decisive(1) << ";\n"
+          << "  bool const v" << id << " = ";
+    if (is_and) {
+      _body << "!" << decisive(0) << " && !" << decisive(1) << ";\n";
+    } else {
+      _body << decisive(0) << " || " << decisive(1) << ";\n";
+    }
+    return id;
+  }
+
+  std::string expr;
+  if (args.size() == 2) {
+    auto const lhs  = value(0);
+    auto const rhs  = value(1);
+    auto const call = [&](std::string const& f) { return f + "(" + lhs + ", " + rhs + ")"; };
+    switch (op) {
+      case ast::ast_operator::ADD: expr = lhs + " + " + rhs; break;
+      case ast::ast_operator::SUB: expr = lhs + " - " + rhs; break;
+      case ast::ast_operator::MUL: expr = lhs + " * " + rhs; break;
+      case ast::ast_operator::DIV: expr = lhs + " / " + rhs; break;
+      case ast::ast_operator::TRUE_DIV:
+        expr = "static_cast<double>(" + lhs + ") / static_cast<double>(" + rhs + ")";
+        break;
+      case ast::ast_operator::FLOOR_DIV: expr = call("cudf::jit::ast::floor_div"); break;
+      case ast::ast_operator::MOD: expr = call("cudf::jit::ast::mod"); break;
+      case ast::ast_operator::PYMOD: expr = call("cudf::jit::ast::pymod"); break;
+      case ast::ast_operator::POW: expr = call("cudf::jit::ast::pow"); break;
+      case ast::ast_operator::EQUAL: expr = lhs + " == " + rhs; break;
+      case ast::ast_operator::NOT_EQUAL: expr = lhs + " != " + rhs; break;
+      case ast::ast_operator::LESS: expr = lhs + " < " + rhs; break;
+      case ast::ast_operator::GREATER: expr = lhs + " > " + rhs; break;
+      case ast::ast_operator::LESS_EQUAL: expr = lhs + " <= " + rhs; break;
+      case ast::ast_operator::GREATER_EQUAL: expr = lhs + " >= " + rhs; break;
+      case ast::ast_operator::BITWISE_AND: expr = lhs + " & " + rhs; break;
+      case ast::ast_operator::BITWISE_OR: expr = lhs + " | " + rhs; break;
+      case ast::ast_operator::BITWISE_XOR: expr = lhs + " ^ " + rhs; break;
+      case ast::ast_operator::LOGICAL_AND: expr = lhs + " && " + rhs; break;
+      case ast::ast_operator::LOGICAL_OR: expr = lhs + " || " + rhs; break;
+      default: CUDF_FAIL("Unsupported binary operator in JIT-compiled expression");
+    }
+  } else {
+    auto const arg  = value(0);
+    auto const call = [&](std::string const& f) { return f + "(" + arg + ")"; };
+    switch (op) {
+      case ast::ast_operator::IDENTITY: expr = arg; break;
+      case ast::ast_operator::SIN: expr = call("sin"); break;
+      case ast::ast_operator::COS: expr = call("cos"); break;
+      case ast::ast_operator::TAN: expr = call("tan"); break;
+      case ast::ast_operator::ARCSIN: expr = call("asin"); break;
+      case ast::ast_operator::ARCCOS: expr = call("acos"); break;
+      case ast::ast_operator::ARCTAN: expr = call("atan"); break;
+      case ast::ast_operator::SINH: expr = call("sinh"); break;
+      case ast::ast_operator::COSH: expr = call("cosh"); break;
+      case ast::ast_operator::TANH: expr = call("tanh"); break;
+      case ast::ast_operator::ARCSINH: expr = call("asinh"); break;
+      case ast::ast_operator::ARCCOSH: expr = call("acosh"); break;
+      case ast::ast_operator::ARCTANH: expr = call("atanh"); break;
+      case ast::ast_operator::EXP: expr = call("exp"); break;
+      case ast::ast_operator::LOG: expr = call("log"); break;
+      case ast::ast_operator::SQRT: expr = call("sqrt"); break;
+      case ast::ast_operator::CBRT: expr = call("cbrt"); break;
+      case ast::ast_operator::CEIL: expr = call("ceil"); break;
+      case ast::ast_operator::FLOOR: expr = call("floor"); break;
+      case ast::ast_operator::ABS: expr = call("cudf::jit::ast::abs"); break;
+      case ast::ast_operator::RINT: expr = call("rint"); break;
+      case ast::ast_operator::NOT: expr = "!" + arg; break;
+      case ast::ast_operator::BIT_INVERT: expr = "~" + arg; break;
+      case ast::ast_operator::CAST_TO_INT64: expr = "static_cast<int64_t>(" + arg + ")"; break;
+      case ast::ast_operator::CAST_TO_UINT64: expr = "static_cast<uint64_t>(" + arg + ")"; break;
+      case ast::ast_operator::CAST_TO_FLOAT64: expr = "static_cast<double>(" + arg + ")"; break;
+      default: CUDF_FAIL("Unsupported unary operator in JIT-compiled expression");
+    }
+  }
+
+  _body << "  auto const v" << id << " = " << expr << ";\n"
+        << "  bool const n" << id << " = " << valid(0);
+  if (args.size() == 2) { _body << " && " << valid(1); }
+  _body << ";\n";
+  return id;
+}
+
+device_table_arrays make_device_table_arrays(table_view const& table,
+                                             rmm::cuda_stream_view stream)
+{
+  std::vector<void const*> data;
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> offsets;
+  for (auto const& col : table) {
+    data.push_back(is_numeric(col.type()) ? get_data_ptr(col) : nullptr);
+    masks.push_back(col.null_mask());
+    offsets.push_back(col.offset());
+  }
+  return {cudf::detail::make_device_uvector_async(data, stream),
+          cudf::detail::make_device_uvector_async(masks, stream),
+          cudf::detail::make_device_uvector_async(offsets, stream)};
+}
+
+device_literal_arrays make_device_literal_arrays(std::vector<ast::literal const*> const& literals,
+                                                 rmm::cuda_stream_view stream)
+{
+  std::vector<void const*> data;
+  std::vector<bool const*> valid;
+  for (auto const* literal : literals) {
+    data.push_back(get_data_ptr(literal->get_scalar()));
+    valid.push_back(literal->get_scalar().validity_data());
+  }
+  return {cudf::detail::make_device_uvector_async(data, stream),
+          cudf::detail::make_device_uvector_async(valid, stream)};
+}
+
+}  // namespace jit
+}  // namespace cudf
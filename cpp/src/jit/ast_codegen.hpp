@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace jit {
+
+/**
+ * @brief Generates the CUDA statements evaluating an AST expression on a row, or on a pair of
+ * rows of a left and a right table.
+ *
+ * Every node of the expression is emitted as a value variable `v<id>` and a validity variable
+ * `n<id>`, following the null propagation rules of the AST interpreter. The statements read the
+ * referenced columns from the `left_data`, `left_masks` and `left_offsets` arrays at `left_row`,
+ * their `right_` counterparts at `right_row`, and the literals from the `literal_data` and
+ * `literal_valid` arrays, which the enclosing function must declare. The source therefore only
+ * depends on the shape of the expression and on the types and nullability of the referenced
+ * columns, and a compiled kernel is reused for other tables and literal values.
+ *
+ * The operators whose result depends on the operand types call the functions of
+ * `jit/ast_operators.hpp`, which the JIT-compiled kernel must include. The expression must have
+ * been validated by `ast::detail::expression_parser`, which checks the operand types.
+ */
+class ast_codegen {
+ public:
+  /**
+   * @brief Construct a generator for expressions on `left`, and on `right` if it is not null.
+   *
+   * @param left The table referenced by `table_reference::LEFT`
+   * @param right The table referenced by `table_reference::RIGHT`, or nullptr if the expression
+   * is evaluated on a single table
+   */
+  ast_codegen(table_view const& left, table_view const* right) : _left{left}, _right{right} {}
+
+  /**
+   * @brief Emits the statements evaluating `expr`.
+   *
+   * @throw cudf::logic_error if the expression uses an unsupported operator, column type or
+   * literal type
+   *
+   * @param expr The expression to evaluate
+   * @return The id of the variables holding the result
+   */
+  int emit(ast::expression const& expr);
+
+  /**
+   * @brief Returns the statements emitted so far.
+   */
+  [[nodiscard]] std::string body() const { return _body.str(); }
+
+  /**
+   * @brief Returns the literals of the expression, in the order the generated source reads them.
+   */
+  [[nodiscard]] std::vector<ast::literal const*> const& literals() const { return _literals; }
+
+ private:
+  int emit_literal(ast::literal const& literal);
+  int emit_column(ast::column_reference const& column);
+  int emit_operation(ast::operation const& operation);
+
+  table_view const& _left;
+  table_view const* _right;
+  std::vector<ast::literal const*> _literals;
+  std::ostringstream _body;
+  int _next_id = 0;
+};
+
+/**
+ * @brief Device arrays of the data pointers, null masks and offsets of the columns of a table, as
+ * read by the statements of `ast_codegen`
+ */
+struct device_table_arrays {
+  rmm::device_uvector<void const*> data;           ///< Data pointers, null for non-numeric columns
+  rmm::device_uvector<bitmask_type const*> masks;  ///< Null masks
+  rmm::device_uvector<size_type> offsets;          ///< Column offsets
+};
+
+/**
+ * @brief Copies the data pointers, null masks and offsets of the columns of `table` to the device.
+ *
+ * @param table The table whose columns are referenced by the expression
+ * @param stream CUDA stream used for device memory operations
+ * @return The device arrays
+ */
+device_table_arrays make_device_table_arrays(table_view const& table,
+                                             rmm::cuda_stream_view stream);
+
+/**
+ * @brief Device arrays of the value and validity pointers of the literals of an expression, as
+ * read by the statements of `ast_codegen`
+ */
+struct device_literal_arrays {
+  rmm::device_uvector<void const*> data;   ///< Pointers to the literal values
+  rmm::device_uvector<bool const*> valid;  ///< Pointers to the literal validities
+};
+
+/**
+ * @brief Copies the value and validity pointers of `literals` to the device.
+ *
+ * @param literals The literals returned by `ast_codegen::literals()`
+ * @param stream CUDA stream used for device memory operations
+ * @return The device arrays
+ */
+device_literal_arrays make_device_literal_arrays(std::vector<ast::literal const*> const& literals,
+                                                 rmm::cuda_stream_view stream);
+
+}  // namespace jit
+}  // namespace cudf
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda/std/type_traits>
+
+// Device functions used by the source generated from AST expressions for the operators whose
+// result depends on the types of their operands. They follow the operators of the AST
+// interpreter in `cudf/ast/detail/operators.hpp`, which cannot be included in JIT-compiled code.
+
+namespace cudf {
+namespace jit {
+namespace ast {
+
+template <typename LHS, typename RHS>
+__device__ inline auto floor_div(LHS lhs, RHS rhs)
+{
+  return floor(static_cast<double>(lhs) / static_cast<double>(rhs));
+}
+
+template <typename LHS, typename RHS>
+__device__ inline auto mod(LHS lhs, RHS rhs)
+{
+  using common_type = cuda::std::common_type_t<LHS, RHS>;
+  if constexpr (cuda::std::is_integral_v<common_type>) {
+    return static_cast<common_type>(lhs) % static_cast<common_type>(rhs);
+  } else {
+    return fmod(static_cast<common_type>(lhs), static_cast<common_type>(rhs));
+  }
+}
+
+template <typename LHS, typename RHS>
+__device__ inline auto pymod(LHS lhs, RHS rhs)
+{
+  using common_type = cuda::std::common_type_t<LHS, RHS>;
+  auto const l      = static_cast<common_type>(lhs);
+  auto const r      = static_cast<common_type>(rhs);
+  if constexpr (cuda::std::is_integral_v<common_type>) {
+    return ((l % r) + r) % r;
+  } else {
+    return fmod(fmod(l, r) + r, r);
+  }
+}
+
+template <typename LHS, typename RHS>
+__device__ inline auto pow(LHS lhs, RHS rhs)
+{
+  // like std::pow, integral arguments are computed in double precision
+  if constexpr (cuda::std::is_same_v<LHS, float> && cuda::std::is_same_v<RHS, float>) {
+    return ::pow(lhs, rhs);
+  } else {
+    return ::pow(static_cast<double>(lhs), static_cast<double>(rhs));
+  }
+}
+
+template <typename T>
+__device__ inline auto abs(T input)
+{
+  if constexpr (cuda::std::is_floating_point_v<T>) {
+    return ::fabs(input);
+  } else if constexpr (cuda::std::is_signed_v<T>) {
+    // integral promotion, like std::abs
+    return input < 0 ? -input : +input;
+  } else {
+    return input;
+  }
+}
+
+}  // namespace ast
+}  // namespace jit
+}  // namespace cudf
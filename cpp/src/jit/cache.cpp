@@ -14,13 +14,21 @@
  * limitations under the License.
  */
 
+#include <jit/cache.hpp>
+
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
 
 #include <cuda.h>
 #include <jitify2.hpp>
 
+#include <chrono>
 #include <cstddef>
 #include <filesystem>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace cudf {
 namespace jit {
@@ -110,20 +118,35 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   return value != nullptr ? std::stoull(value) : default_val;
 }
 
-jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
+namespace {
+
+std::mutex caches_mutex{};
+std::unordered_map<std::string, std::unique_ptr<jitify2::ProgramCache<>>> caches{};
+
+// Limits set with `cudf::set_kernel_cache_limits`, overriding the environment variables.
+std::optional<std::pair<std::size_t, std::size_t>> kernel_limits{};
+
+std::mutex statistics_mutex{};
+std::unordered_set<std::string> requested_kernels{};
+kernel_cache_statistics statistics{};
+
+std::pair<std::size_t, std::size_t> get_kernel_limits()
 {
-  static std::mutex caches_mutex{};
-  static std::unordered_map<std::string, std::unique_ptr<jitify2::ProgramCache<>>> caches{};
+  if (kernel_limits.has_value()) { return kernel_limits.value(); }
+  return {try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000),
+          try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000)};
+}
 
+}  // namespace
+
+jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
+{
   std::lock_guard<std::mutex> caches_lock(caches_mutex);
 
   auto existing_cache = caches.find(preprog.name());
 
   if (existing_cache == caches.end()) {
-    auto const kernel_limit_proc =
-      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
-    auto const kernel_limit_disk =
-      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+    auto const [kernel_limit_proc, kernel_limit_disk] = get_kernel_limits();
 
     // if kernel_limit_disk is zero, jitify will assign it the value of kernel_limit_proc.
     // to avoid this, we treat zero as "disable disk caching" by not providing the cache dir.
@@ -139,5 +162,69 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           jitify2::StringMap const& extra_headers,
+                           jitify2::StringVec const& options)
+{
+  auto key = preprog.name() + '\0' + kernel_name;
+  for (auto const& [name, source] : extra_headers) {
+    key += '\0' + name + '\0' + std::to_string(std::hash<std::string>{}(source));
+  }
+  for (auto const& option : options) {
+    key += '\0' + option;
+  }
+
+  auto& cache = get_program_cache(preprog);
+  {
+    std::lock_guard<std::mutex> statistics_lock(statistics_mutex);
+    if (requested_kernels.count(key) > 0) {
+      ++statistics.hits;
+      return cache.get_kernel(kernel_name, {}, extra_headers, options);
+    }
+  }
+
+  auto const start   = std::chrono::steady_clock::now();
+  auto kernel        = cache.get_kernel(kernel_name, {}, extra_headers, options);
+  auto const elapsed = std::chrono::steady_clock::now() - start;
+
+  std::lock_guard<std::mutex> statistics_lock(statistics_mutex);
+  // another thread may have requested the same kernel meanwhile
+  if (requested_kernels.insert(std::move(key)).second) {
+    ++statistics.misses;
+    statistics.miss_time += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+  } else {
+    ++statistics.hits;
+  }
+  return kernel;
+}
+
 }  // namespace jit
+
+kernel_cache_statistics get_kernel_cache_statistics()
+{
+  std::lock_guard<std::mutex> statistics_lock(jit::statistics_mutex);
+  return jit::statistics;
+}
+
+void reset_kernel_cache_statistics()
+{
+  std::lock_guard<std::mutex> statistics_lock(jit::statistics_mutex);
+  jit::statistics = kernel_cache_statistics{};
+}
+
+void set_kernel_cache_limits(std::size_t max_kernels_per_process, std::size_t max_kernels_on_disk)
+{
+  CUDF_EXPECTS(max_kernels_per_process > 0, "The per-process kernel cache limit must be positive.");
+  std::lock_guard<std::mutex> caches_lock(jit::caches_mutex);
+  jit::kernel_limits = std::pair{max_kernels_per_process, max_kernels_on_disk};
+  // evicts the least recently used kernels of the programs already loaded
+  for (auto& [name, cache] : jit::caches) {
+    cache->resize(max_kernels_per_process, max_kernels_on_disk);
+  }
+  // evicted kernels are not tracked, so count every kernel requested afterwards as a miss
+  std::lock_guard<std::mutex> statistics_lock(jit::statistics_mutex);
+  jit::requested_kernels.clear();
+}
+
 }  // namespace cudf
@@ -17,12 +17,49 @@
 #pragma once
 
 #include <jitify2.hpp>
+
+#include <cstddef>
+#include <filesystem>
 #include <memory>
+#include <string>
 
 namespace cudf {
 namespace jit {
 
+/**
+ * @brief Gets the JIT kernel cache directory of the current device, creating it if needed.
+ *
+ * @return The directory, or an empty path if there is no file cache
+ */
+std::filesystem::path get_cache_dir();
+
+/**
+ * @brief Parses the value of a numeric environment variable.
+ *
+ * @param env_name Name of the environment variable
+ * @param default_val Value returned if the variable is not set
+ * @return The value of the variable, or `default_val`
+ */
+std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t default_val);
+
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Gets a kernel of `preprog` from the program cache, compiling it if needed.
+ *
+ * Unlike calling `get_program_cache(preprog).get_kernel(...)` directly, this records the request
+ * in the statistics returned by `cudf::get_kernel_cache_statistics()`.
+ *
+ * @param preprog Preprocessed program containing the kernel
+ * @param kernel_name Name expression of the kernel to instantiate
+ * @param extra_headers Additional header sources, e.g. the user-defined function
+ * @param options Compiler options
+ * @return The compiled kernel
+ */
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           jitify2::StringMap const& extra_headers,
+                           jitify2::StringVec const& options);
+
 }  // namespace jit
 }  // namespace cudf
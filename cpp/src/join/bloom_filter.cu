@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/hashing.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
+
+#include <cmath>
+
+namespace cudf {
+namespace {
+
+constexpr int words_per_block = bloom_filter::bits_per_block / 32;
+
+// odd multipliers selecting the bit set in each word of a block, as in the split block Bloom
+// filters of Parquet and Impala
+__constant__ uint32_t bloom_salts[words_per_block] = {0x47b6137bU,
+                                                      0x44974d91U,
+                                                      0x8824ad5bU,
+                                                      0xa2b7289dU,
+                                                      0x705495c7U,
+                                                      0x2df1424bU,
+                                                      0x9efc4947U,
+                                                      0x5c6bfb31U};
+
+/**
+ * @brief Returns the first word of the block a row hash maps to
+ */
+__device__ inline uint32_t const* block_of(uint32_t const* bits,
+                                           std::size_t num_blocks,
+                                           hash_value_type hash)
+{
+  return bits + ((static_cast<uint64_t>(hash) * num_blocks) >> 32) * words_per_block;
+}
+
+/**
+ * @brief Remixes a row hash so that the bits set within a block are independent of the block
+ */
+__device__ inline uint32_t block_key(hash_value_type hash)
+{
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bU;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35U;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+__device__ inline uint32_t word_mask(uint32_t key, int word)
+{
+  return uint32_t{1} << ((key * bloom_salts[word]) >> 27);
+}
+
+template <typename Hasher>
+struct bloom_insert_fn {
+  Hasher hasher;
+  uint32_t* bits;
+  std::size_t num_blocks;
+  bitmask_type const* row_mask;
+
+  __device__ void operator()(size_type row_index) const
+  {
+    if (row_mask != nullptr && not bit_is_set(row_mask, row_index)) { return; }
+    auto const hash  = hasher(row_index);
+    auto const block = const_cast<uint32_t*>(block_of(bits, num_blocks, hash));
+    auto const key   = block_key(hash);
+    for (int word = 0; word < words_per_block; ++word) {
+      atomicOr(block + word, word_mask(key, word));
+    }
+  }
+};
+
+template <typename Hasher>
+struct bloom_contains_fn {
+  Hasher hasher;
+  uint32_t const* bits;
+  std::size_t num_blocks;
+  bitmask_type const* row_mask;
+
+  __device__ bool operator()(size_type row_index) const
+  {
+    if (row_mask != nullptr && not bit_is_set(row_mask, row_index)) { return false; }
+    auto const hash  = hasher(row_index);
+    auto const block = block_of(bits, num_blocks, hash);
+    auto const key   = block_key(hash);
+    for (int word = 0; word < words_per_block; ++word) {
+      auto const mask = word_mask(key, word);
+      if ((block[word] & mask) != mask) { return false; }
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Returns the validity of the rows of `keys` when rows containing nulls never match
+ */
+rmm::device_buffer unequal_nulls_row_mask(table_view const& keys,
+                                          null_equality compare_nulls,
+                                          rmm::cuda_stream_view stream)
+{
+  if (compare_nulls == null_equality::EQUAL || not has_nulls(keys)) { return {}; }
+  return cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
+}
+
+}  // namespace
+
+bloom_filter::bloom_filter(cudf::table_view const& build,
+                           null_equality compare_nulls,
+                           double bits_per_row,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+  : _compare_nulls(compare_nulls), _num_columns(build.num_columns())
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(bits_per_row > 0, "The number of bits per row of a Bloom filter must be positive");
+
+  auto const num_blocks = std::max<std::size_t>(
+    1, static_cast<std::size_t>(std::ceil(build.num_rows() * bits_per_row / bits_per_block)));
+  _bits = rmm::device_buffer(num_blocks * (bits_per_block / 8), stream, mr);
+  CUDF_CUDA_TRY(cudaMemsetAsync(_bits.data(), 0, _bits.size(), stream.value()));
+  if (build.num_rows() == 0 || build.num_columns() == 0) { return; }
+
+  auto const row_mask = unequal_nulls_row_mask(build, compare_nulls, stream);
+  auto const hasher   = cudf::experimental::row::hash::row_hasher(build, stream);
+  auto const d_hasher =
+    hasher.device_hasher<detail::MurmurHash3_32>(nullate::DYNAMIC{has_nested_nulls(build)});
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    build.num_rows(),
+    bloom_insert_fn<decltype(d_hasher)>{d_hasher,
+                                        static_cast<uint32_t*>(_bits.data()),
+                                        num_blocks,
+                                        static_cast<bitmask_type const*>(row_mask.data())});
+}
+
+bloom_filter::bloom_filter(rmm::device_buffer&& bits, null_equality compare_nulls)
+  : _bits(std::move(bits)), _compare_nulls(compare_nulls)
+{
+  CUDF_EXPECTS(_bits.size() > 0 && _bits.size() % (bits_per_block / 8) == 0,
+               "Bloom filter bits must be a positive multiple of the block size");
+}
+
+std::unique_ptr<column> bloom_filter::contains(cudf::table_view const& probe,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_num_columns < 0 || probe.num_columns() == _num_columns,
+               "Mismatch in number of columns of the Bloom filter and the probe table");
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (probe.num_rows() == 0) { return result; }
+
+  auto const row_mask = unequal_nulls_row_mask(probe, _compare_nulls, stream);
+  auto const hasher   = cudf::experimental::row::hash::row_hasher(probe, stream);
+  auto const d_hasher =
+    hasher.device_hasher<detail::MurmurHash3_32>(nullate::DYNAMIC{has_nested_nulls(probe)});
+  auto result_view = result->mutable_view();
+  thrust::tabulate(
+    rmm::exec_policy(stream),
+    result_view.begin<bool>(),
+    result_view.end<bool>(),
+    bloom_contains_fn<decltype(d_hasher)>{d_hasher,
+                                          static_cast<uint32_t const*>(_bits.data()),
+                                          num_blocks(),
+                                          static_cast<bitmask_type const*>(row_mask.data())});
+  return result;
+}
+
+}  // namespace cudf
@@ -23,6 +23,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
 #include <join/conditional_join.hpp>
 #include <join/conditional_join_kernels.cuh>
 #include <join/join_common_utils.cuh>
@@ -30,10 +31,82 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <optional>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns the number of blocks to launch `kernel`, a tiled conditional join kernel, with:
+ * enough to fill the device, but no more than there are tiles.
+ */
+template <typename Kernel>
+int tiled_join_num_blocks(Kernel kernel,
+                          size_type left_num_rows,
+                          size_type right_num_rows,
+                          std::size_t shmem_size_per_block)
+{
+  int device;
+  int num_sms;
+  int blocks_per_sm;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+  CUDF_CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &blocks_per_sm, kernel, DEFAULT_JOIN_BLOCK_SIZE, shmem_size_per_block));
+  auto const num_tiles =
+    num_conditional_join_tiles<DEFAULT_JOIN_BLOCK_SIZE>(left_num_rows, right_num_rows);
+  return static_cast<int>(
+    std::min<int64_t>(num_tiles, static_cast<int64_t>(std::max(blocks_per_sm, 1)) * num_sms));
+}
+
+/**
+ * @brief Computes the output size of the inner join of `left` and `right` with the tiled kernel.
+ */
+template <bool has_nulls>
+void launch_tiled_join_output_size(table_device_view const& left,
+                                   table_device_view const& right,
+                                   ast::detail::expression_parser const& parser,
+                                   std::size_t* output_size,
+                                   rmm::cuda_stream_view stream)
+{
+  auto const kernel = compute_tiled_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, has_nulls>;
+  auto const shmem_size_per_block = parser.shmem_per_thread * DEFAULT_JOIN_BLOCK_SIZE;
+  auto const num_blocks =
+    tiled_join_num_blocks(kernel, left.num_rows(), right.num_rows(), shmem_size_per_block);
+  kernel<<<num_blocks, DEFAULT_JOIN_BLOCK_SIZE, shmem_size_per_block, stream.value()>>>(
+    left, right, parser.device_expression_data, output_size);
+}
+
+/**
+ * @brief Writes the inner join of `left` and `right` to the output indices with the tiled kernel.
+ */
+template <bool has_nulls>
+void launch_tiled_inner_join(table_device_view const& left,
+                             table_device_view const& right,
+                             ast::detail::expression_parser const& parser,
+                             size_type* join_output_l,
+                             size_type* join_output_r,
+                             size_type* current_idx,
+                             size_type max_size,
+                             rmm::cuda_stream_view stream)
+{
+  auto const kernel = tiled_conditional_inner_join<DEFAULT_JOIN_BLOCK_SIZE, has_nulls>;
+  auto const shmem_size_per_block = parser.shmem_per_thread * DEFAULT_JOIN_BLOCK_SIZE;
+  auto const num_blocks =
+    tiled_join_num_blocks(kernel, left.num_rows(), right.num_rows(), shmem_size_per_block);
+  kernel<<<num_blocks, DEFAULT_JOIN_BLOCK_SIZE, shmem_size_per_block, stream.value()>>>(
+    left,
+    right,
+    join_output_l,
+    join_output_r,
+    current_idx,
+    parser.device_expression_data,
+    max_size);
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -95,11 +168,11 @@ conditional_join(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
-  detail::grid_1d const config(swap_tables ? right_num_rows : left_num_rows,
-                               DEFAULT_JOIN_BLOCK_SIZE);
+  // Inner joins evaluate the pairs of rows in tiles, which balances the work of the threads however
+  // skewed the matches are. The other joins need all matches of a left row in one thread, so they
+  // launch one thread per left row.
+  auto const use_tiled_join = join_type == join_kind::INNER_JOIN;
+  detail::grid_1d const config(left_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
@@ -111,14 +184,18 @@ conditional_join(table_view const& left,
   } else {
     // Allocate storage for the counter used to get the size of the join output
     rmm::device_scalar<std::size_t> size(0, stream, mr);
-    if (has_nulls) {
+    if (use_tiled_join) {
+      has_nulls ? launch_tiled_join_output_size<true>(
+                    *left_table, *right_table, parser, size.data(), stream)
+                : launch_tiled_join_output_size<false>(
+                    *left_table, *right_table, parser, size.data(), stream);
+    } else if (has_nulls) {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
         <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
           *left_table,
           *right_table,
           kernel_join_type,
           parser.device_expression_data,
-          swap_tables,
           size.data());
     } else {
       compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
@@ -127,7 +204,6 @@ conditional_join(table_view const& left,
           *right_table,
           kernel_join_type,
           parser.device_expression_data,
-          swap_tables,
           size.data());
     }
     join_size = size.value(stream);
@@ -151,7 +227,24 @@ conditional_join(table_view const& left,
 
   auto const& join_output_l = left_indices->data();
   auto const& join_output_r = right_indices->data();
-  if (has_nulls) {
+  if (use_tiled_join) {
+    has_nulls ? launch_tiled_inner_join<true>(*left_table,
+                                              *right_table,
+                                              parser,
+                                              join_output_l,
+                                              join_output_r,
+                                              write_index.data(),
+                                              join_size,
+                                              stream)
+              : launch_tiled_inner_join<false>(*left_table,
+                                               *right_table,
+                                               parser,
+                                               join_output_l,
+                                               join_output_r,
+                                               write_index.data(),
+                                               join_size,
+                                               stream);
+  } else if (has_nulls) {
     conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
       <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
         *left_table,
@@ -161,8 +254,7 @@ conditional_join(table_view const& left,
         join_output_r,
         write_index.data(),
         parser.device_expression_data,
-        join_size,
-        swap_tables);
+        join_size);
   } else {
     conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
       <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
@@ -173,8 +265,7 @@ conditional_join(table_view const& left,
         join_output_r,
         write_index.data(),
         parser.device_expression_data,
-        join_size,
-        swap_tables);
+        join_size);
   }
 
   auto join_indices = std::pair(std::move(left_indices), std::move(right_indices));
@@ -248,16 +339,20 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
   auto left_table  = table_device_view::create(left, stream);
   auto right_table = table_device_view::create(right, stream);
 
-  // For inner joins we support optimizing the join by launching one thread for
-  // whichever table is larger rather than always using the left table.
-  auto swap_tables = (join_type == join_kind::INNER_JOIN) && (right_num_rows > left_num_rows);
-  detail::grid_1d const config(swap_tables ? right_num_rows : left_num_rows,
-                               DEFAULT_JOIN_BLOCK_SIZE);
-  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
-
   // Allocate storage for the counter used to get the size of the join output
   rmm::device_scalar<std::size_t> size(0, stream, mr);
 
+  // Inner joins count the matches in tiles of pairs of rows, see `conditional_join`
+  if (join_type == join_kind::INNER_JOIN) {
+    has_nulls
+      ? launch_tiled_join_output_size<true>(*left_table, *right_table, parser, size.data(), stream)
+      : launch_tiled_join_output_size<false>(*left_table, *right_table, parser, size.data(), stream);
+    return size.value(stream);
+  }
+
+  detail::grid_1d const config(left_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+  auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
   // Determine number of output rows without actually building the output to simply
   // find what the size of the output will be.
   if (has_nulls) {
@@ -267,7 +362,6 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
         *right_table,
         join_type,
         parser.device_expression_data,
-        swap_tables,
         size.data());
   } else {
     compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
@@ -276,7 +370,6 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
         *right_table,
         join_type,
         parser.device_expression_data,
-        swap_tables,
         size.data());
   }
   return size.value(stream);
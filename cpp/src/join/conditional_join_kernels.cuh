@@ -22,6 +22,7 @@
 #include <cudf/ast/detail/expression_evaluator.cuh>
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/table/table_device_view.cuh>
 
 #include <cub/cub.cuh>
@@ -33,7 +34,8 @@ namespace detail {
  * @brief Computes the output size of joining the left table to the right table.
  *
  * This method uses a nested loop to iterate over the left and right tables and count the number of
- * matches according to a boolean expression.
+ * matches according to a boolean expression. Each thread loops over all right rows for one left
+ * row, which the left, left semi and left anti joins need to track the matches of a left row.
  *
  * @tparam block_size The number of threads per block for this kernel
  * @tparam has_nulls Whether or not the inputs may contain nulls.
@@ -43,8 +45,6 @@ namespace detail {
  * @param[in] join_type The type of join to be performed
  * @param[in] device_expression_data Container of device data required to evaluate the desired
  * expression.
- * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
- * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
  * @param[out] output_size The resulting output size
  */
 template <int block_size, bool has_nulls>
@@ -53,7 +53,6 @@ __global__ void compute_conditional_join_output_size(
   table_device_view right_table,
   join_kind join_type,
   ast::detail::expression_device_view device_expression_data,
-  bool const swap_tables,
   std::size_t* output_size)
 {
   // The (required) extern storage of the shared memory array leads to
@@ -71,19 +70,15 @@ __global__ void compute_conditional_join_output_size(
   cudf::size_type const stride         = block_size * gridDim.x;
   cudf::size_type const left_num_rows  = left_table.num_rows();
   cudf::size_type const right_num_rows = right_table.num_rows();
-  auto const outer_num_rows            = (swap_tables ? right_num_rows : left_num_rows);
-  auto const inner_num_rows            = (swap_tables ? left_num_rows : right_num_rows);
 
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
 
-  for (cudf::size_type outer_row_index = start_idx; outer_row_index < outer_num_rows;
-       outer_row_index += stride) {
+  for (cudf::size_type left_row_index = start_idx; left_row_index < left_num_rows;
+       left_row_index += stride) {
     bool found_match = false;
-    for (cudf::size_type inner_row_index = 0; inner_row_index < inner_num_rows; inner_row_index++) {
-      auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
-      auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
-      auto const right_row_index = swap_tables ? outer_row_index : inner_row_index;
+    for (cudf::size_type right_row_index = 0; right_row_index < right_num_rows; right_row_index++) {
+      auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       evaluator.evaluate(
         output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
       if (output_dest.is_valid() && output_dest.value()) {
@@ -129,8 +124,6 @@ __global__ void compute_conditional_join_output_size(
  * @param device_expression_data Container of device data required to evaluate the desired
  * expression.
  * @param[in] max_size The maximum size of the output
- * @param[in] swap_tables If true, the kernel was launched with one thread per right row and
- * the kernel needs to internally loop over left rows. Otherwise, loop over right rows.
  */
 template <cudf::size_type block_size, cudf::size_type output_cache_size, bool has_nulls>
 __global__ void conditional_join(table_device_view left_table,
@@ -140,8 +133,7 @@ __global__ void conditional_join(table_device_view left_table,
                                  cudf::size_type* join_output_r,
                                  cudf::size_type* current_idx,
                                  cudf::ast::detail::expression_device_view device_expression_data,
-                                 cudf::size_type const max_size,
-                                 bool const swap_tables)
+                                 cudf::size_type const max_size)
 {
   constexpr int num_warps = block_size / detail::warp_size;
   __shared__ cudf::size_type current_idx_shared[num_warps];
@@ -162,26 +154,22 @@ __global__ void conditional_join(table_device_view left_table,
   int const lane_id                    = threadIdx.x % detail::warp_size;
   cudf::size_type const left_num_rows  = left_table.num_rows();
   cudf::size_type const right_num_rows = right_table.num_rows();
-  auto const outer_num_rows            = (swap_tables ? right_num_rows : left_num_rows);
-  auto const inner_num_rows            = (swap_tables ? left_num_rows : right_num_rows);
 
   if (0 == lane_id) { current_idx_shared[warp_id] = 0; }
 
   __syncwarp();
 
-  cudf::size_type outer_row_index = threadIdx.x + blockIdx.x * block_size;
+  cudf::size_type left_row_index = threadIdx.x + blockIdx.x * block_size;
 
-  unsigned int const activemask = __ballot_sync(0xffffffff, outer_row_index < outer_num_rows);
+  unsigned int const activemask = __ballot_sync(0xffffffff, left_row_index < left_num_rows);
 
   auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
     left_table, right_table, device_expression_data);
 
-  if (outer_row_index < outer_num_rows) {
+  if (left_row_index < left_num_rows) {
     bool found_match = false;
-    for (size_type inner_row_index(0); inner_row_index < inner_num_rows; ++inner_row_index) {
-      auto output_dest           = cudf::ast::detail::value_expression_result<bool, has_nulls>();
-      auto const left_row_index  = swap_tables ? inner_row_index : outer_row_index;
-      auto const right_row_index = swap_tables ? outer_row_index : inner_row_index;
+    for (size_type right_row_index(0); right_row_index < right_num_rows; ++right_row_index) {
+      auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
       evaluator.evaluate(
         output_dest, left_row_index, right_row_index, 0, thread_intermediate_storage);
 
@@ -229,12 +217,7 @@ __global__ void conditional_join(table_device_view left_table,
     if ((join_type == join_kind::LEFT_JOIN || join_type == join_kind::LEFT_ANTI_JOIN ||
          join_type == join_kind::FULL_JOIN) &&
         (!found_match)) {
-      // TODO: This code assumes that swap_tables is false for all join
-      // kinds aside from inner joins. Once the code is generalized to handle
-      // other joins we'll want to switch the variable in the line below back
-      // to the left_row_index, but for now we can assume that they are
-      // equivalent inside this conditional.
-      add_pair_to_cache(outer_row_index,
+      add_pair_to_cache(left_row_index,
                         static_cast<cudf::size_type>(JoinNoneValue),
                         current_idx_shared,
                         warp_id,
@@ -258,6 +241,186 @@ __global__ void conditional_join(table_device_view left_table,
   }
 }
 
+/// The number of left rows of a tile of the tiled conditional join kernels
+constexpr cudf::size_type TILED_JOIN_LEFT_ROWS = 32;
+
+/**
+ * @brief Returns the number of tiles of the tiled conditional join kernels.
+ *
+ * A tile pairs `TILED_JOIN_LEFT_ROWS` left rows with `block_size` right rows.
+ */
+template <int block_size>
+__host__ __device__ int64_t num_conditional_join_tiles(cudf::size_type left_num_rows,
+                                                       cudf::size_type right_num_rows)
+{
+  return static_cast<int64_t>(util::div_rounding_up_unsafe(left_num_rows, TILED_JOIN_LEFT_ROWS)) *
+         util::div_rounding_up_unsafe(right_num_rows, block_size);
+}
+
+/**
+ * @brief Evaluates the predicate on every pair of rows of the tiles assigned to this block and
+ * passes the result to `pair_function`.
+ *
+ * Each block loops over tiles of `TILED_JOIN_LEFT_ROWS` left rows by `block_size` right rows, and
+ * each thread of the block pairs one right row with every left row of the tile. Every block
+ * evaluates the same number of pairs per tile however many of them match, and all threads call
+ * `pair_function` the same number of times, so that it may use warp-wide intrinsics. Pairs that
+ * fall outside of the tables are passed as not matching.
+ *
+ * @param left_table The left table
+ * @param right_table The right table
+ * @param evaluator The evaluator of the predicate
+ * @param thread_intermediate_storage The intermediate storage of this thread for `evaluator`
+ * @param pair_function Called with whether the pair matches, the left row index and the right
+ * row index of every pair
+ */
+template <int block_size, bool has_nulls, typename PairFunction>
+__device__ void for_each_tiled_pair(
+  table_device_view const& left_table,
+  table_device_view const& right_table,
+  cudf::ast::detail::expression_evaluator<has_nulls>& evaluator,
+  cudf::ast::detail::IntermediateDataType<has_nulls>* thread_intermediate_storage,
+  PairFunction pair_function)
+{
+  cudf::size_type const left_num_rows  = left_table.num_rows();
+  cudf::size_type const right_num_rows = right_table.num_rows();
+  auto const num_right_tiles = util::div_rounding_up_unsafe(right_num_rows, block_size);
+  auto const num_tiles = num_conditional_join_tiles<block_size>(left_num_rows, right_num_rows);
+
+  for (int64_t tile = blockIdx.x; tile < num_tiles; tile += gridDim.x) {
+    auto const left_begin = static_cast<int64_t>(tile / num_right_tiles) * TILED_JOIN_LEFT_ROWS;
+    auto const right_row  = static_cast<int64_t>(tile % num_right_tiles) * block_size + threadIdx.x;
+    for (cudf::size_type i = 0; i < TILED_JOIN_LEFT_ROWS; ++i) {
+      auto const left_row = left_begin + i;
+      bool is_match       = false;
+      if (left_row < left_num_rows && right_row < right_num_rows) {
+        auto output_dest = cudf::ast::detail::value_expression_result<bool, has_nulls>();
+        evaluator.evaluate(output_dest,
+                           static_cast<cudf::size_type>(left_row),
+                           static_cast<cudf::size_type>(right_row),
+                           0,
+                           thread_intermediate_storage);
+        is_match = output_dest.is_valid() && output_dest.value();
+      }
+      pair_function(
+        is_match, static_cast<cudf::size_type>(left_row), static_cast<cudf::size_type>(right_row));
+    }
+  }
+}
+
+/**
+ * @brief Computes the output size of the inner join of the left table to the right table.
+ *
+ * Unlike `compute_conditional_join_output_size`, the pairs of rows are evaluated in tiles, so the
+ * work of every block is independent of how the matches are distributed among the rows.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam has_nulls Whether or not the inputs may contain nulls.
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[in] device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[out] output_size The resulting output size
+ */
+template <int block_size, bool has_nulls>
+__global__ void compute_tiled_conditional_join_output_size(
+  table_device_view left_table,
+  table_device_view right_table,
+  ast::detail::expression_device_view device_expression_data,
+  std::size_t* output_size)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  std::size_t thread_counter{0};
+  for_each_tiled_pair<block_size>(
+    left_table,
+    right_table,
+    evaluator,
+    thread_intermediate_storage,
+    [&](bool is_match, cudf::size_type, cudf::size_type) { thread_counter += is_match; });
+
+  using BlockReduce = cub::BlockReduce<std::size_t, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  std::size_t block_counter = BlockReduce(temp_storage).Sum(thread_counter);
+
+  if (threadIdx.x == 0 && block_counter > 0) { atomicAdd(output_size, block_counter); }
+}
+
+/**
+ * @brief Performs an inner join conditioned on a predicate, evaluating the pairs of rows in tiles.
+ *
+ * Every block evaluates the same number of pairs per tile, so the throughput does not depend on
+ * how the matches are distributed among the rows. The matches of a warp are compacted with a
+ * ballot: one lane reserves room for all of them with a single atomic and every matching lane
+ * writes its pair at its rank among the matching lanes.
+ *
+ * @tparam block_size The number of threads per block for this kernel
+ * @tparam has_nulls Whether or not the inputs may contain nulls.
+ *
+ * @param[in] left_table The left table
+ * @param[in] right_table The right table
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ * @param[in,out] current_idx A global counter used by warps to reserve room in the output
+ * @param device_expression_data Container of device data required to evaluate the desired
+ * expression.
+ * @param[in] max_size The maximum size of the output
+ */
+template <int block_size, bool has_nulls>
+__global__ void tiled_conditional_inner_join(
+  table_device_view left_table,
+  table_device_view right_table,
+  cudf::size_type* join_output_l,
+  cudf::size_type* join_output_r,
+  cudf::size_type* current_idx,
+  cudf::ast::detail::expression_device_view device_expression_data,
+  cudf::size_type const max_size)
+{
+  static_assert(block_size % detail::warp_size == 0, "Blocks must consist of whole warps");
+
+  extern __shared__ char raw_intermediate_storage[];
+  cudf::ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<cudf::ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+
+  auto evaluator = cudf::ast::detail::expression_evaluator<has_nulls>(
+    left_table, right_table, device_expression_data);
+
+  int const lane_id                   = threadIdx.x % detail::warp_size;
+  unsigned int const lower_lanes_mask = (1u << lane_id) - 1;
+
+  for_each_tiled_pair<block_size>(
+    left_table,
+    right_table,
+    evaluator,
+    thread_intermediate_storage,
+    [&](bool is_match, cudf::size_type left_row_index, cudf::size_type right_row_index) {
+      auto const match_mask = __ballot_sync(0xffffffff, is_match);
+      if (match_mask == 0) { return; }
+
+      cudf::size_type warp_begin = 0;
+      if (lane_id == 0) { warp_begin = atomicAdd(current_idx, __popc(match_mask)); }
+      warp_begin = __shfl_sync(0xffffffff, warp_begin, 0);
+
+      if (is_match) {
+        auto const output_index = warp_begin + __popc(match_mask & lower_lanes_mask);
+        if (output_index < max_size) {
+          join_output_l[output_index] = left_row_index;
+          join_output_r[output_index] = right_row_index;
+        }
+      }
+    });
+}
+
 }  // namespace detail
 
 }  // namespace cudf
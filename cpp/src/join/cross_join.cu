@@ -14,8 +14,12 @@
  * limitations under the License.
  */
 
+#include <join/conditional_join.hpp>
+
 #include <cudf/column/column.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/repeat.hpp>
 #include <cudf/detail/reshape.hpp>
@@ -27,11 +31,70 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Returns a table with the columns of `left` followed by the columns of `right`.
+ */
+std::unique_ptr<table> append_columns(std::unique_ptr<table> left, std::unique_ptr<table> right)
+{
+  auto columns       = left->release();
+  auto right_columns = right->release();
+  std::move(right_columns.begin(), right_columns.end(), std::back_inserter(columns));
+  return std::make_unique<table>(std::move(columns));
+}
+
+/**
+ * @brief Gathers the pairs of rows at `left_indices` and `right_indices` into one table.
+ */
+std::unique_ptr<table> gather_pairs(table_view const& left,
+                                    table_view const& right,
+                                    device_span<size_type const> left_indices,
+                                    device_span<size_type const> right_indices,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  return append_columns(detail::gather(left,
+                                       left_indices,
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr),
+                        detail::gather(right,
+                                       right_indices,
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr));
+}
+
+/**
+ * @brief Returns the end of the tile of `tile_rows` rows starting at `begin` in a table of
+ * `num_rows` rows.
+ */
+size_type tile_end(size_type begin, size_type tile_rows, size_type num_rows)
+{
+  return static_cast<size_type>(
+    std::min(static_cast<int64_t>(begin) + tile_rows, static_cast<int64_t>(num_rows)));
+}
+
+}  // namespace
+
 /**
  * @copydoc cudf::cross_join
  *
@@ -63,14 +126,103 @@ std::unique_ptr<cudf::table> cross_join(
   auto right_tiled = detail::tile(right, left.num_rows(), stream, mr);
 
   // Concatenate all repeated/tiled columns into one table
-  auto left_repeated_columns = left_repeated->release();
-  auto right_tiled_columns   = right_tiled->release();
-  std::move(right_tiled_columns.begin(),
-            right_tiled_columns.end(),
-            std::back_inserter(left_repeated_columns));
+  return append_columns(std::move(left_repeated), std::move(right_tiled));
+}
 
-  return std::make_unique<table>(std::move(left_repeated_columns));
+/**
+ * @copydoc cudf::chunked_cross_join(cudf::table_view const&, cudf::table_view const&, size_type,
+ * cross_join_callback const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void chunked_cross_join(cudf::table_view const& left,
+                        cudf::table_view const& right,
+                        size_type max_chunk_rows,
+                        cross_join_callback const& callback,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(max_chunk_rows > 0, "The maximum number of rows of a chunk must be positive");
+
+  auto const right_num_rows = static_cast<int64_t>(right.num_rows());
+  auto const num_pairs      = static_cast<int64_t>(left.num_rows()) * right_num_rows;
+  if (num_pairs == 0) { return; }
+
+  // The indices are reused by every chunk, whose gathers are ordered on `stream`
+  auto const max_rows = static_cast<size_type>(std::min<int64_t>(num_pairs, max_chunk_rows));
+  rmm::device_uvector<size_type> left_indices(max_rows, stream);
+  rmm::device_uvector<size_type> right_indices(max_rows, stream);
+
+  for (int64_t begin = 0; begin < num_pairs; begin += max_chunk_rows) {
+    auto const chunk_rows =
+      static_cast<size_type>(std::min<int64_t>(num_pairs - begin, max_chunk_rows));
+    // Pair `p` of the product joins row `p / right_num_rows` of `left` with row
+    // `p % right_num_rows` of `right`, in the order of `cross_join`
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<int64_t>(begin),
+                      thrust::make_counting_iterator<int64_t>(begin + chunk_rows),
+                      thrust::make_zip_iterator(left_indices.begin(), right_indices.begin()),
+                      [right_num_rows] __device__(int64_t pair) {
+                        return thrust::make_tuple(static_cast<size_type>(pair / right_num_rows),
+                                                  static_cast<size_type>(pair % right_num_rows));
+                      });
+    callback(gather_pairs(left,
+                          right,
+                          {left_indices.data(), static_cast<std::size_t>(chunk_rows)},
+                          {right_indices.data(), static_cast<std::size_t>(chunk_rows)},
+                          stream,
+                          mr));
+  }
+}
+
+/**
+ * @copydoc cudf::chunked_cross_join(cudf::table_view const&, cudf::table_view const&,
+ * ast::expression const&, size_type, cross_join_callback const&, rmm::mr::device_memory_resource*)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void chunked_cross_join(cudf::table_view const& left,
+                        cudf::table_view const& right,
+                        ast::expression const& binary_predicate,
+                        size_type max_chunk_rows,
+                        cross_join_callback const& callback,
+                        rmm::cuda_stream_view stream,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(max_chunk_rows > 0, "The maximum number of rows of a chunk must be positive");
+  if (left.num_rows() == 0 || right.num_rows() == 0) { return; }
+
+  // Tiles span as many right rows as fit in a chunk, and as many left rows as fit with them, so
+  // that every tile but the last ones has about `max_chunk_rows` pairs to evaluate
+  auto const right_tile_rows = std::min(right.num_rows(), max_chunk_rows);
+  auto const left_tile_rows =
+    std::min(left.num_rows(), std::max(size_type{1}, max_chunk_rows / right_tile_rows));
+
+  for (size_type l = 0; l < left.num_rows(); l += left_tile_rows) {
+    auto const left_tile =
+      detail::slice(left, {l, tile_end(l, left_tile_rows, left.num_rows())}, stream).front();
+    for (size_type r = 0; r < right.num_rows(); r += right_tile_rows) {
+      auto const right_tile =
+        detail::slice(right, {r, tile_end(r, right_tile_rows, right.num_rows())}, stream)
+          .front();
+      auto const [left_indices, right_indices] =
+        detail::conditional_join(left_tile,
+                                 right_tile,
+                                 binary_predicate,
+                                 join_kind::INNER_JOIN,
+                                 std::nullopt,
+                                 stream,
+                                 rmm::mr::get_current_device_resource());
+      if (left_indices->is_empty()) { continue; }
+      callback(gather_pairs(left_tile, right_tile, *left_indices, *right_indices, stream, mr));
+    }
+  }
 }
+
 }  // namespace detail
 
 std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
@@ -81,4 +233,27 @@ std::unique_ptr<cudf::table> cross_join(cudf::table_view const& left,
   return detail::cross_join(left, right, cudf::default_stream_value, mr);
 }
 
+void chunked_cross_join(cudf::table_view const& left,
+                        cudf::table_view const& right,
+                        size_type max_chunk_rows,
+                        cross_join_callback const& callback,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::chunked_cross_join(
+    left, right, max_chunk_rows, callback, cudf::default_stream_value, mr);
+}
+
+void chunked_cross_join(cudf::table_view const& left,
+                        cudf::table_view const& right,
+                        ast::expression const& binary_predicate,
+                        size_type max_chunk_rows,
+                        cross_join_callback const& callback,
+                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::chunked_cross_join(
+    left, right, binary_predicate, max_chunk_rows, callback, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
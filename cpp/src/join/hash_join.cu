@@ -15,8 +15,10 @@
  */
 #include "join_common_utils.cuh"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/join.hpp>
 #include <cudf/detail/structs/utilities.hpp>
@@ -27,15 +29,21 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/scatter.h>
+#include <thrust/tabulate.h>
 #include <thrust/tuple.h>
 #include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <numeric>
@@ -43,6 +51,105 @@
 namespace cudf {
 namespace detail {
 namespace {
+/**
+ * @brief Returns whether the flattened table has list columns, which the legacy row operators
+ * cannot hash or compare.
+ */
+bool has_list_columns(cudf::table_view const& table)
+{
+  return std::any_of(table.begin(), table.end(), [](auto const& col) {
+    return structs::detail::is_or_has_nested_lists(col);
+  });
+}
+
+/**
+ * @brief Hashes every row of a table with list columns in a single batched pass.
+ *
+ * Hashing a row with list columns walks all of its nested elements. Hashing every row once up
+ * front keeps this walk out of the kernels inserting into and probing the hash table, which only
+ * read the hashes.
+ *
+ * The rows of the build and the probe table must hash alike whichever of the tables has nulls, so
+ * nulls are always checked.
+ *
+ * @param table The table to hash, preprocessed by the experimental row operators
+ * @param num_rows Number of rows of the table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ *
+ * @return The hash of every row of the table
+ */
+rmm::device_uvector<hash_value_type> hash_nested_rows(
+  std::shared_ptr<experimental::row::equality::preprocessed_table> const& table,
+  size_type num_rows,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const hasher   = experimental::row::hash::row_hasher{table};
+  auto const d_hasher = hasher.device_hasher(nullate::YES{});
+  rmm::device_uvector<hash_value_type> row_hashes(num_rows, stream, mr);
+  thrust::tabulate(rmm::exec_policy(stream), row_hashes.begin(), row_hashes.end(), d_hasher);
+  return row_hashes;
+}
+
+/**
+ * @brief Invokes `probe` with the device functors to probe the hash table built from
+ * `build_table` for the rows of `probe_table`, and returns its result.
+ *
+ * `probe` is invoked as `probe(pair_func, equality)`, where `pair_func` returns the hash table pair
+ * of a probe row and `equality` compares a probe pair to a build pair.
+ *
+ * Tables with list columns are hashed and compared with the experimental row operators. The probe
+ * rows are then hashed in a single batched pass before probing.
+ *
+ * @param build_table The flattened build table
+ * @param probe_table The flattened probe table
+ * @param hash_table Hash table built from `build_table`
+ * @param nulls_equal Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param probe The function probing the hash table
+ *
+ * @return The result of `probe`
+ */
+template <typename ProbeFunction>
+decltype(auto) probe_with(cudf::table_view const& build_table,
+                          cudf::table_view const& probe_table,
+                          cudf::detail::multimap_type const& hash_table,
+                          null_equality nulls_equal,
+                          rmm::cuda_stream_view stream,
+                          ProbeFunction&& probe)
+{
+  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
+
+  if (has_list_columns(build_table) or has_list_columns(probe_table)) {
+    auto const has_nulls = has_nested_nulls(build_table) or has_nested_nulls(probe_table);
+    auto const preprocessed_build =
+      experimental::row::equality::preprocessed_table::create(build_table, stream);
+    auto const preprocessed_probe =
+      experimental::row::equality::preprocessed_table::create(probe_table, stream);
+
+    auto const probe_hashes = hash_nested_rows(preprocessed_probe, probe_table.num_rows(), stream);
+    make_hashed_pair_function pair_func{probe_hashes.data(), empty_key_sentinel};
+
+    auto const comparator =
+      experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+    pair_equality equality{probe_build_row_equality{
+      comparator.equal_to(nullate::DYNAMIC{has_nulls}, nulls_equal)}};
+    return probe(pair_func, equality);
+  }
+
+  auto build_table_ptr = cudf::table_device_view::create(build_table, stream);
+  auto probe_table_ptr = cudf::table_device_view::create(probe_table, stream);
+
+  auto const probe_nulls =
+    cudf::nullate::DYNAMIC{cudf::has_nulls(build_table) or cudf::has_nulls(probe_table)};
+  pair_equality equality{*probe_table_ptr, *build_table_ptr, probe_nulls, nulls_equal};
+
+  row_hash hash_probe{probe_nulls, *probe_table_ptr};
+  make_pair_function pair_func{hash_probe, empty_key_sentinel};
+  return probe(pair_func, equality);
+}
+
 /**
  * @brief Calculates the exact size of the join output produced when
  * joining two tables together.
@@ -51,25 +158,24 @@ namespace {
  *
  * @tparam JoinKind The type of join to be performed
  *
- * @param build_table The right hand table
- * @param probe_table The left hand table
+ * @param build_table_num_rows Number of rows of the right hand table
+ * @param probe_table_num_rows Number of rows of the left hand table
+ * @param pair_func Device functor returning the hash table pair of a probe row
+ * @param equality Device functor comparing a probe pair to a build pair
  * @param hash_table A hash table built on the build table that maps the index
  * of every row to the hash value of that row.
- * @param nulls_equal Flag to denote nulls are equal or not.
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return The exact size of the output of the join operation
  */
-template <join_kind JoinKind>
-std::size_t compute_join_output_size(table_device_view build_table,
-                                     table_device_view probe_table,
+template <join_kind JoinKind, typename PairFunction, typename Equality>
+std::size_t compute_join_output_size(size_type build_table_num_rows,
+                                     size_type probe_table_num_rows,
+                                     PairFunction const& pair_func,
+                                     Equality const& equality,
                                      cudf::detail::multimap_type const& hash_table,
-                                     bool const has_nulls,
-                                     cudf::null_equality const nulls_equal,
                                      rmm::cuda_stream_view stream)
 {
-  const size_type build_table_num_rows{build_table.num_rows()};
-  const size_type probe_table_num_rows{probe_table.num_rows()};
 
   // If the build table is empty, we know exactly how large the output
   // will be for the different types of joins and can return immediately
@@ -86,13 +192,6 @@ std::size_t compute_join_output_size(table_device_view build_table,
     }
   }
 
-  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
-  pair_equality equality{probe_table, build_table, probe_nulls, nulls_equal};
-
-  row_hash hash_probe{probe_nulls, probe_table};
-  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  make_pair_function pair_func{hash_probe, empty_key_sentinel};
-
   auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
 
   std::size_t size;
@@ -105,83 +204,223 @@ std::size_t compute_join_output_size(table_device_view build_table,
   return size;
 }
 
+/// Number of probe rows sampled to estimate the output size of a join
+constexpr size_type join_size_sample_rows = 16 * 1024;
+/// Largest estimated output size, in multiples of the probe table size, that is used as is
+constexpr std::size_t join_size_max_estimate_ratio = 4;
+
+/**
+ * @brief Device functor returning the hash table pair of every `stride`-th row.
+ */
+template <typename PairFunction>
+struct strided_pair_function {
+  PairFunction pair_func;
+  size_type stride;
+
+  __device__ __forceinline__ auto operator()(size_type i) const noexcept
+  {
+    return pair_func(i * stride);
+  }
+};
+
+/**
+ * @brief Device functor clamping output positions to `capacity`, so that all writes beyond the
+ * capacity of an output land in a single scratch element past its end.
+ */
+struct clamp_output_index {
+  std::size_t capacity;
+
+  __device__ __forceinline__ std::size_t operator()(std::size_t i) const noexcept
+  {
+    return i < capacity ? i : capacity;
+  }
+};
+
+/**
+ * @brief Estimates the size of the join output produced when joining two tables together.
+ *
+ * Small probe tables are counted exactly. For larger ones only a strided sample of
+ * `join_size_sample_rows` probe rows is counted, which is a small fraction of the cost of a full
+ * counting pass, and the count is scaled to the whole probe table with some headroom. With skewed
+ * keys the sample can overestimate the output by orders of magnitude, so estimates larger than
+ * `join_size_max_estimate_ratio` times the probe table size are replaced by the exact count.
+ *
+ * @throw cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
+ *
+ * @tparam JoinKind The type of join to be performed
+ *
+ * @param build_table_num_rows Number of rows of the right hand table
+ * @param probe_table_num_rows Number of rows of the left hand table
+ * @param pair_func Device functor returning the hash table pair of a probe row
+ * @param equality Device functor comparing a probe pair to a build pair
+ * @param hash_table A hash table built on the build table that maps the index
+ * of every row to the hash value of that row.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return The estimated output size and whether it is exact
+ */
+template <join_kind JoinKind, typename PairFunction, typename Equality>
+std::pair<std::size_t, bool> estimate_join_output_size(
+  size_type build_table_num_rows,
+  size_type probe_table_num_rows,
+  PairFunction const& pair_func,
+  Equality const& equality,
+  cudf::detail::multimap_type const& hash_table,
+  rmm::cuda_stream_view stream)
+{
+  if (build_table_num_rows == 0 || probe_table_num_rows <= 2 * join_size_sample_rows) {
+    return {compute_join_output_size<JoinKind>(
+              build_table_num_rows, probe_table_num_rows, pair_func, equality, hash_table, stream),
+            true};
+  }
+
+  auto const stride = probe_table_num_rows / join_size_sample_rows;
+  auto iter         = cudf::detail::make_counting_transform_iterator(
+    0, strided_pair_function<PairFunction>{pair_func, stride});
+
+  std::size_t sample_size;
+  if constexpr (JoinKind == join_kind::LEFT_JOIN) {
+    sample_size =
+      hash_table.pair_count_outer(iter, iter + join_size_sample_rows, equality, stream.value());
+  } else {
+    sample_size =
+      hash_table.pair_count(iter, iter + join_size_sample_rows, equality, stream.value());
+  }
+
+  // scale the sampled size to the probe table and allow for 10% sampling error
+  auto const scaled_size = static_cast<double>(sample_size) * probe_table_num_rows /
+                           join_size_sample_rows * 1.1;
+  auto estimate = static_cast<std::size_t>(scaled_size) + 1;
+  // every probe row is part of the output of a left join
+  if constexpr (JoinKind == join_kind::LEFT_JOIN) {
+    estimate = std::max(estimate, static_cast<std::size_t>(probe_table_num_rows));
+  }
+  if (estimate > join_size_max_estimate_ratio * static_cast<std::size_t>(probe_table_num_rows)) {
+    return {compute_join_output_size<JoinKind>(
+              build_table_num_rows, probe_table_num_rows, pair_func, equality, hash_table, stream),
+            true};
+  }
+  return {estimate, false};
+}
+
 /**
  * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table`,
  * and returns the output indices of `build_table` and `probe_table` as a combined table.
  * Behavior is undefined if the provided `output_size` is smaller than the actual output size.
  *
+ * If no `output_size` is provided, the output is allocated from an estimate of its size, and the
+ * matches are retrieved in a single probe pass which discards the matches that do not fit. The
+ * pass still yields the exact output size, so only an underestimate costs a second pass.
+ *
  * @tparam JoinKind The type of join to be performed.
  *
- * @param build_table Table of build side columns to join.
- * @param probe_table Table of probe side columns to join.
- * @param hash_table Hash table built from `build_table`.
- * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_table_num_rows Number of rows of the build table.
+ * @param probe_table_num_rows Number of rows of the probe table.
+ * @param pair_func Device functor returning the hash table pair of a probe row.
+ * @param equality Device functor comparing a probe pair to a build pair.
+ * @param hash_table Hash table built from the build table.
  * @param output_size Optional value which allows users to specify the exact output size.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource used to allocate the returned vectors.
  *
  * @return Join output indices vector pair.
  */
-template <join_kind JoinKind>
+template <join_kind JoinKind, typename PairFunction, typename Equality>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
-probe_join_hash_table(cudf::table_device_view build_table,
-                      cudf::table_device_view probe_table,
+probe_join_hash_table(size_type build_table_num_rows,
+                      size_type probe_table_num_rows,
+                      PairFunction const& pair_func,
+                      Equality const& equality,
                       cudf::detail::multimap_type const& hash_table,
-                      bool has_nulls,
-                      null_equality compare_nulls,
                       std::optional<std::size_t> output_size,
                       rmm::cuda_stream_view stream,
                       rmm::mr::device_memory_resource* mr)
 {
-  // Use the output size directly if provided. Otherwise, compute the exact output size
+  // Use the output size directly if provided. Otherwise, estimate the output size
   constexpr cudf::detail::join_kind ProbeJoinKind = (JoinKind == cudf::detail::join_kind::FULL_JOIN)
                                                       ? cudf::detail::join_kind::LEFT_JOIN
                                                       : JoinKind;
 
-  std::size_t const join_size =
-    output_size ? *output_size
-                : compute_join_output_size<ProbeJoinKind>(
-                    build_table, probe_table, hash_table, has_nulls, compare_nulls, stream);
+  auto const [join_size, is_exact_size] =
+    output_size ? std::pair(*output_size, true)
+                : estimate_join_output_size<ProbeJoinKind>(build_table_num_rows,
+                                                           probe_table_num_rows,
+                                                           pair_func,
+                                                           equality,
+                                                           hash_table,
+                                                           stream);
 
   // If output size is zero, return immediately
-  if (join_size == 0) {
+  if (join_size == 0 && is_exact_size) {
     return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
                      std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
   }
 
-  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-
-  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
-  pair_equality equality{probe_table, build_table, probe_nulls, compare_nulls};
-
-  row_hash hash_probe{probe_nulls, probe_table};
-  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  make_pair_function pair_func{hash_probe, empty_key_sentinel};
-
   auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
 
-  const cudf::size_type probe_table_num_rows = probe_table.num_rows();
-
-  auto out1_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
-  auto out2_zip_begin = thrust::make_zip_iterator(
-    thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
-
-  if constexpr (JoinKind == cudf::detail::join_kind::FULL_JOIN or
-                JoinKind == cudf::detail::join_kind::LEFT_JOIN) {
-    [[maybe_unused]] auto [out1_zip_end, out2_zip_end] = hash_table.pair_retrieve_outer(
-      iter, iter + probe_table_num_rows, out1_zip_begin, out2_zip_begin, equality, stream.value());
+  // retrieves the matches into the given outputs and returns the number of matches
+  auto retrieve = [&](auto left_out, auto right_out) -> std::size_t {
+    auto out1_zip_begin =
+      thrust::make_zip_iterator(thrust::make_tuple(thrust::make_discard_iterator(), left_out));
+    auto out2_zip_begin =
+      thrust::make_zip_iterator(thrust::make_tuple(thrust::make_discard_iterator(), right_out));
+
+    if constexpr (JoinKind == cudf::detail::join_kind::FULL_JOIN or
+                  JoinKind == cudf::detail::join_kind::LEFT_JOIN) {
+      [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
+        hash_table.pair_retrieve_outer(iter,
+                                       iter + probe_table_num_rows,
+                                       out1_zip_begin,
+                                       out2_zip_begin,
+                                       equality,
+                                       stream.value());
+      return out1_zip_end - out1_zip_begin;
+    } else {
+      [[maybe_unused]] auto [out1_zip_end, out2_zip_end] =
+        hash_table.pair_retrieve(iter,
+                                 iter + probe_table_num_rows,
+                                 out1_zip_begin,
+                                 out2_zip_begin,
+                                 equality,
+                                 stream.value());
+      return out1_zip_end - out1_zip_begin;
+    }
+  };
 
+  if (is_exact_size) {
+    auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    auto const actual_size = retrieve(left_indices->begin(), right_indices->begin());
     if constexpr (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
-      auto const actual_size = out1_zip_end - out1_zip_begin;
       left_indices->resize(actual_size, stream);
       right_indices->resize(actual_size, stream);
+      left_indices->shrink_to_fit(stream);
+      right_indices->shrink_to_fit(stream);
     }
+    return std::pair(std::move(left_indices), std::move(right_indices));
+  }
+
+  // Allocate one extra element to absorb the matches beyond the estimated size
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size + 1, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size + 1, stream, mr);
+  auto const clamped_index = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<std::size_t>(0), clamp_output_index{join_size});
+  auto const actual_size =
+    retrieve(thrust::make_permutation_iterator(left_indices->begin(), clamped_index),
+             thrust::make_permutation_iterator(right_indices->begin(), clamped_index));
+
+  if (actual_size > join_size) {
+    // The estimate was too small, retry with the exact size
+    left_indices  = std::make_unique<rmm::device_uvector<size_type>>(actual_size, stream, mr);
+    right_indices = std::make_unique<rmm::device_uvector<size_type>>(actual_size, stream, mr);
+    retrieve(left_indices->begin(), right_indices->begin());
   } else {
-    hash_table.pair_retrieve(
-      iter, iter + probe_table_num_rows, out1_zip_begin, out2_zip_begin, equality, stream.value());
+    // Release the unused part of the estimated allocation
+    left_indices->resize(actual_size, stream);
+    right_indices->resize(actual_size, stream);
+    left_indices->shrink_to_fit(stream);
+    right_indices->shrink_to_fit(stream);
   }
   return std::pair(std::move(left_indices), std::move(right_indices));
 }
@@ -192,25 +431,27 @@ probe_join_hash_table(cudf::table_device_view build_table,
  * TODO: this is a temporary solution as part of `full_join_size`. To be refactored during
  * cuco integration.
  *
- * @param build_table Table of build side columns to join.
- * @param probe_table Table of probe side columns to join.
- * @param hash_table Hash table built from `build_table`.
- * @param compare_nulls Controls whether null join-key values should match or not.
+ * @param build_table_num_rows Number of rows of the build table.
+ * @param probe_table_num_rows Number of rows of the probe table.
+ * @param pair_func Device functor returning the hash table pair of a probe row.
+ * @param equality Device functor comparing a probe pair to a build pair.
+ * @param hash_table Hash table built from the build table.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource used to allocate the intermediate vectors.
  *
  * @return Output size of full join.
  */
-std::size_t get_full_join_size(cudf::table_device_view build_table,
-                               cudf::table_device_view probe_table,
+template <typename PairFunction, typename Equality>
+std::size_t get_full_join_size(size_type build_table_num_rows,
+                               size_type probe_table_num_rows,
+                               PairFunction const& pair_func,
+                               Equality const& equality,
                                cudf::detail::multimap_type const& hash_table,
-                               bool const has_nulls,
-                               null_equality const compare_nulls,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   std::size_t join_size = compute_join_output_size<cudf::detail::join_kind::LEFT_JOIN>(
-    build_table, probe_table, hash_table, has_nulls, compare_nulls, stream);
+    build_table_num_rows, probe_table_num_rows, pair_func, equality, hash_table, stream);
 
   // If output size is zero, return immediately
   if (join_size == 0) { return join_size; }
@@ -218,17 +459,8 @@ std::size_t get_full_join_size(cudf::table_device_view build_table,
   auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
   auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
 
-  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
-  pair_equality equality{probe_table, build_table, probe_nulls, compare_nulls};
-
-  row_hash hash_probe{probe_nulls, probe_table};
-  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
-  make_pair_function pair_func{hash_probe, empty_key_sentinel};
-
   auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
 
-  const cudf::size_type probe_table_num_rows = probe_table.num_rows();
-
   auto out1_zip_begin = thrust::make_zip_iterator(
     thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
   auto out2_zip_begin = thrust::make_zip_iterator(
@@ -240,8 +472,8 @@ std::size_t get_full_join_size(cudf::table_device_view build_table,
   // Release intermediate memory allocation
   left_indices->resize(0, stream);
 
-  auto const left_table_row_count  = probe_table.num_rows();
-  auto const right_table_row_count = build_table.num_rows();
+  auto const left_table_row_count  = probe_table_num_rows;
+  auto const right_table_row_count = build_table_num_rows;
 
   std::size_t left_join_complement_size;
 
@@ -277,22 +509,57 @@ std::size_t get_full_join_size(cudf::table_device_view build_table,
   }
   return join_size + left_join_complement_size;
 }
+
+/**
+ * @brief Splits the table unpacked from the output of `hash_join::pack()` into the build table and
+ * the hashes of its rows.
+ */
+std::pair<cudf::table_view, std::optional<cudf::column_view>> unpack_hash_join(
+  cudf::packed_columns const& packed)
+{
+  auto const unpacked = cudf::unpack(packed);
+  CUDF_EXPECTS(unpacked.num_columns() > 1 &&
+                 unpacked.column(unpacked.num_columns() - 1).type().id() == type_id::UINT32,
+               "Packed columns were not produced by hash_join::pack");
+
+  std::vector<size_type> build_columns(unpacked.num_columns() - 1);
+  std::iota(build_columns.begin(), build_columns.end(), 0);
+  return {unpacked.select(build_columns), unpacked.column(unpacked.num_columns() - 1)};
+}
 }  // namespace
 
 template <typename Hasher>
 hash_join<Hasher>::hash_join(cudf::table_view const& build,
                              cudf::null_equality compare_nulls,
                              rmm::cuda_stream_view stream)
-  : _is_empty{build.num_rows() == 0},
-    _composite_bitmask{cudf::detail::bitmask_and(build, stream).first},
+  : hash_join(std::pair(build, std::optional<cudf::column_view>{}), compare_nulls, stream)
+{
+}
+
+template <typename Hasher>
+hash_join<Hasher>::hash_join(cudf::packed_columns const& packed,
+                             cudf::null_equality compare_nulls,
+                             rmm::cuda_stream_view stream)
+  : hash_join(unpack_hash_join(packed), compare_nulls, stream)
+{
+}
+
+template <typename Hasher>
+hash_join<Hasher>::hash_join(
+  std::pair<cudf::table_view, std::optional<cudf::column_view>> const& build_and_hashes,
+  cudf::null_equality compare_nulls,
+  rmm::cuda_stream_view stream)
+  : _is_empty{build_and_hashes.first.num_rows() == 0},
+    _composite_bitmask{cudf::detail::bitmask_and(build_and_hashes.first, stream).first},
     _nulls_equal{compare_nulls},
-    _hash_table{compute_hash_table_size(build.num_rows()),
+    _hash_table{compute_hash_table_size(build_and_hashes.first.num_rows()),
                 cuco::sentinel::empty_key{std::numeric_limits<hash_value_type>::max()},
                 cuco::sentinel::empty_value{cudf::detail::JoinNoneValue},
                 stream.value(),
                 detail::hash_table_allocator_type{default_allocator<char>{}, stream}}
 {
   CUDF_FUNC_RANGE();
+  auto const& [build, row_hashes] = build_and_hashes;
   CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
   CUDF_EXPECTS(build.num_rows() < cudf::detail::MAX_JOIN_SIZE,
                "Build column size is too big for hash join");
@@ -304,11 +571,66 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
 
   if (_is_empty) { return; }
 
-  cudf::detail::build_join_hash_table(_build,
-                                      _hash_table,
-                                      _nulls_equal,
-                                      static_cast<bitmask_type const*>(_composite_bitmask.data()),
-                                      stream);
+  auto const bitmask = static_cast<bitmask_type const*>(_composite_bitmask.data());
+  if (row_hashes.has_value()) {
+    cudf::detail::build_join_hash_table(
+      _build,
+      device_span<hash_value_type const>(row_hashes->begin<hash_value_type>(), row_hashes->size()),
+      _hash_table,
+      _nulls_equal,
+      bitmask,
+      stream);
+  } else if (has_list_columns(_build)) {
+    auto const nested_hashes = hash_nested_rows(
+      experimental::row::equality::preprocessed_table::create(_build, stream),
+      _build.num_rows(),
+      stream);
+    cudf::detail::build_join_hash_table(_build,
+                                        device_span<hash_value_type const>{nested_hashes},
+                                        _hash_table,
+                                        _nulls_equal,
+                                        bitmask,
+                                        stream);
+  } else {
+    cudf::detail::build_join_hash_table(_build, _hash_table, _nulls_equal, bitmask, stream);
+  }
+}
+
+template <typename Hasher>
+packed_columns hash_join<Hasher>::pack(rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+
+  // pack the flattened build table, which the hash table was built from, together with the
+  // hashes of its rows so that the hash table can be rebuilt without hashing the rows again
+  auto row_hashes = make_numeric_column(data_type{type_id::UINT32},
+                                        _build.num_rows(),
+                                        mask_state::UNALLOCATED,
+                                        stream,
+                                        rmm::mr::get_current_device_resource());
+  if (not _is_empty and has_list_columns(_build)) {
+    auto const nested_hashes = hash_nested_rows(
+      experimental::row::equality::preprocessed_table::create(_build, stream),
+      _build.num_rows(),
+      stream);
+    thrust::copy(rmm::exec_policy(stream),
+                 nested_hashes.begin(),
+                 nested_hashes.end(),
+                 row_hashes->mutable_view().begin<hash_value_type>());
+  } else if (not _is_empty) {
+    auto build_table_ptr = cudf::table_device_view::create(_build, stream);
+    row_hash hash_build{nullate::DYNAMIC{cudf::has_nulls(_build)}, *build_table_ptr};
+    auto row_hashes_view = row_hashes->mutable_view();
+    thrust::tabulate(rmm::exec_policy(stream),
+                     row_hashes_view.begin<hash_value_type>(),
+                     row_hashes_view.end<hash_value_type>(),
+                     hash_build);
+  }
+
+  std::vector<column_view> columns(_build.begin(), _build.end());
+  columns.push_back(row_hashes->view());
+  return cudf::detail::pack(table_view{columns}, stream, mr);
 }
 
 template <typename Hasher>
@@ -360,16 +682,21 @@ std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = flattened_probe.flattened_columns();
 
-  auto build_table_ptr           = cudf::table_device_view::create(_build, stream);
-  auto flattened_probe_table_ptr = cudf::table_device_view::create(flattened_probe_table, stream);
-
-  return cudf::detail::compute_join_output_size<cudf::detail::join_kind::INNER_JOIN>(
-    *build_table_ptr,
-    *flattened_probe_table_ptr,
+  return probe_with(
+    _build,
+    flattened_probe_table,
     _hash_table,
-    cudf::has_nulls(flattened_probe_table) | cudf::has_nulls(_build),
     _nulls_equal,
-    stream);
+    stream,
+    [&](auto const& pair_func, auto const& equality) {
+      return cudf::detail::compute_join_output_size<cudf::detail::join_kind::INNER_JOIN>(
+        _build.num_rows(),
+        flattened_probe_table.num_rows(),
+        pair_func,
+        equality,
+        _hash_table,
+        stream);
+    });
 }
 
 template <typename Hasher>
@@ -385,16 +712,21 @@ std::size_t hash_join<Hasher>::left_join_size(cudf::table_view const& probe,
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = flattened_probe.flattened_columns();
 
-  auto build_table_ptr           = cudf::table_device_view::create(_build, stream);
-  auto flattened_probe_table_ptr = cudf::table_device_view::create(flattened_probe_table, stream);
-
-  return cudf::detail::compute_join_output_size<cudf::detail::join_kind::LEFT_JOIN>(
-    *build_table_ptr,
-    *flattened_probe_table_ptr,
+  return probe_with(
+    _build,
+    flattened_probe_table,
     _hash_table,
-    cudf::has_nulls(flattened_probe_table) | cudf::has_nulls(_build),
     _nulls_equal,
-    stream);
+    stream,
+    [&](auto const& pair_func, auto const& equality) {
+      return cudf::detail::compute_join_output_size<cudf::detail::join_kind::LEFT_JOIN>(
+        _build.num_rows(),
+        flattened_probe_table.num_rows(),
+        pair_func,
+        equality,
+        _hash_table,
+        stream);
+    });
 }
 
 template <typename Hasher>
@@ -411,17 +743,21 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
     probe, {}, {}, structs::detail::column_nullability::FORCE);
   auto const flattened_probe_table = flattened_probe.flattened_columns();
 
-  auto build_table_ptr           = cudf::table_device_view::create(_build, stream);
-  auto flattened_probe_table_ptr = cudf::table_device_view::create(flattened_probe_table, stream);
-
-  return cudf::detail::get_full_join_size(
-    *build_table_ptr,
-    *flattened_probe_table_ptr,
+  return probe_with(
+    _build,
+    flattened_probe_table,
     _hash_table,
-    cudf::has_nulls(flattened_probe_table) | cudf::has_nulls(_build),
     _nulls_equal,
     stream,
-    mr);
+    [&](auto const& pair_func, auto const& equality) {
+      return cudf::detail::get_full_join_size(_build.num_rows(),
+                                              flattened_probe_table.num_rows(),
+                                              pair_func,
+                                              equality,
+                                              _hash_table,
+                                              stream,
+                                              mr);
+    });
 }
 
 template <typename Hasher>
@@ -440,18 +776,22 @@ hash_join<Hasher>::probe_join_indices(cudf::table_view const& probe_table,
 
   CUDF_EXPECTS(!_is_empty, "Hash table of hash join is null.");
 
-  auto build_table_ptr = cudf::table_device_view::create(_build, stream);
-  auto probe_table_ptr = cudf::table_device_view::create(probe_table, stream);
-
-  auto join_indices = cudf::detail::probe_join_hash_table<JoinKind>(
-    *build_table_ptr,
-    *probe_table_ptr,
+  auto join_indices = probe_with(
+    _build,
+    probe_table,
     _hash_table,
-    cudf::has_nulls(probe_table) | cudf::has_nulls(_build),
     _nulls_equal,
-    output_size,
     stream,
-    mr);
+    [&](auto const& pair_func, auto const& equality) {
+      return cudf::detail::probe_join_hash_table<JoinKind>(_build.num_rows(),
+                                                           probe_table.num_rows(),
+                                                           pair_func,
+                                                           equality,
+                                                           _hash_table,
+                                                           output_size,
+                                                           stream,
+                                                           mr);
+    });
 
   if constexpr (JoinKind == cudf::detail::join_kind::FULL_JOIN) {
     auto complement_indices = detail::get_left_join_indices_complement(
@@ -506,6 +846,19 @@ hash_join::hash_join(cudf::table_view const& build,
 {
 }
 
+hash_join::hash_join(packed_columns const& packed,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<const impl_type>(packed, compare_nulls, stream)}
+{
+}
+
+packed_columns hash_join::pack(rmm::cuda_stream_view stream,
+                               rmm::mr::device_memory_resource* mr) const
+{
+  return _impl->pack(stream, mr);
+}
+
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
 hash_join::inner_join(cudf::table_view const& probe,
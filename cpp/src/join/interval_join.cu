@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns `keys` with `column` appended as its last column
+ */
+table_view append_column(table_view const& keys, column_view const& column)
+{
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(column);
+  return table_view{columns};
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_inner_join(table_view const& left_keys,
+                    column_view const& left_points,
+                    table_view const& right_keys,
+                    column_view const& right_starts,
+                    column_view const& right_ends,
+                    null_equality compare_nulls,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(left_keys.num_columns() == 0 || left_keys.num_rows() == left_points.size(),
+               "Mismatch in number of rows of the left keys and points");
+  CUDF_EXPECTS(right_starts.size() == right_ends.size() &&
+                 (right_keys.num_columns() == 0 || right_keys.num_rows() == right_starts.size()),
+               "Mismatch in number of rows of the right keys, starts and ends");
+  CUDF_EXPECTS(left_points.type() == right_starts.type() && left_points.type() == right_ends.type(),
+               "Mismatch in type of the points and the interval bounds");
+
+  if (left_points.is_empty() || right_starts.is_empty()) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {append_column(left_keys, left_points),
+     append_column(right_keys, right_starts),
+     append_column(right_keys, right_ends)},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+
+  auto const left   = matched.second[0];
+  auto const starts = matched.second[1];
+  auto const ends   = matched.second[2];
+
+  // Sorted by keys and then by point, the left rows with the keys of a right row and a point
+  // within its interval form the range between the lower bound of (keys, start) and the upper
+  // bound of (keys, end). Sorting nulls first keeps null points below every valid start.
+  std::vector<order> const column_order(left.num_columns(), order::ASCENDING);
+  std::vector<null_order> const null_precedence(left.num_columns(), null_order::BEFORE);
+  auto const left_order = cudf::detail::stable_sorted_order(
+    left, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  auto const sorted_left = cudf::detail::gather(left,
+                                                left_order->view(),
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                rmm::mr::get_current_device_resource());
+
+  auto const lower = cudf::detail::lower_bound(sorted_left->view(),
+                                               starts,
+                                               column_order,
+                                               null_precedence,
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+  auto const upper = cudf::detail::upper_bound(sorted_left->view(),
+                                               ends,
+                                               column_order,
+                                               null_precedence,
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+
+  // a right row with a null bound matches nothing, nor does one with a null key when nulls
+  // compare unequal
+  std::vector<column_view> masked_columns{starts.column(starts.num_columns() - 1),
+                                          ends.column(ends.num_columns() - 1)};
+  if (compare_nulls == null_equality::UNEQUAL) {
+    masked_columns.insert(masked_columns.end(), right_keys.begin(), right_keys.end());
+  }
+  auto const masked = table_view{masked_columns};
+  auto const row_mask =
+    has_nulls(masked)
+      ? cudf::detail::bitmask_and(masked, stream, rmm::mr::get_current_device_resource()).first
+      : rmm::device_buffer{};
+  auto const d_row_mask = static_cast<bitmask_type const*>(row_mask.data());
+
+  // number of left rows each right row contributes to the output, as an inclusive scan
+  auto const right_size = starts.num_rows();
+  auto output_end       = rmm::device_uvector<int64_t>(right_size, stream);
+  auto match_count =
+    [d_lower = lower->view().begin<size_type>(),
+     d_upper = upper->view().begin<size_type>(),
+     d_row_mask] __device__(size_type idx) -> int64_t {
+    auto const is_valid = d_row_mask == nullptr || bit_is_set(d_row_mask, idx);
+    return is_valid ? thrust::max(d_upper[idx] - d_lower[idx], 0) : 0;
+  };
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(right_size),
+                                   output_end.begin(),
+                                   match_count,
+                                   thrust::plus<int64_t>{});
+  auto const output_size = static_cast<std::size_t>(output_end.back_element(stream));
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+
+  // the right row of each output row is the first row whose scanned output end lies beyond it
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      output_end.begin(),
+                      output_end.end(),
+                      thrust::make_counting_iterator<int64_t>(0),
+                      thrust::make_counting_iterator<int64_t>(output_size),
+                      right_indices->begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<int64_t>(0),
+                    thrust::make_counting_iterator<int64_t>(output_size),
+                    right_indices->begin(),
+                    left_indices->begin(),
+                    [d_lower = lower->view().begin<size_type>(),
+                     d_order = left_order->view().begin<size_type>(),
+                     d_end   = output_end.data()] __device__(int64_t out_idx, size_type right_idx) {
+                      auto const begin = right_idx == 0 ? int64_t{0} : d_end[right_idx - 1];
+                      return d_order[d_lower[right_idx] + (out_idx - begin)];
+                    });
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+interval_inner_join(table_view const& left_keys,
+                    column_view const& left_points,
+                    table_view const& right_keys,
+                    column_view const& right_starts,
+                    column_view const& right_ends,
+                    null_equality compare_nulls,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::interval_inner_join(left_keys,
+                                     left_points,
+                                     right_keys,
+                                     right_starts,
+                                     right_ends,
+                                     compare_nulls,
+                                     cudf::default_stream_value,
+                                     mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <jit/ast_operators.hpp>
+#include <join/jit/predicate-udf.hpp>
+
+namespace cudf {
+namespace joins {
+namespace jit {
+
+/**
+ * @brief Evaluates the generated join predicate on pairs of left and right row indices
+ *
+ * The columns and literals referenced by the predicate are passed as arrays of their data and
+ * validity, indexed by column and by the order of the literals in the predicate.
+ */
+__global__ void filter_pairs(cuda::std::size_t size,
+                             cudf::size_type const* left_indices,
+                             cudf::size_type const* right_indices,
+                             void const* const* left_data,
+                             cudf::bitmask_type const* const* left_masks,
+                             cudf::size_type const* left_offsets,
+                             void const* const* right_data,
+                             cudf::bitmask_type const* const* right_masks,
+                             cudf::size_type const* right_offsets,
+                             void const* const* literal_data,
+                             bool const* const* literal_valid,
+                             bool* matches)
+{
+  cuda::std::size_t const start = threadIdx.x + cuda::std::size_t{blockIdx.x} * blockDim.x;
+  cuda::std::size_t const step  = cuda::std::size_t{blockDim.x} * gridDim.x;
+
+  for (cuda::std::size_t i = start; i < size; i += step) {
+    matches[i] = GENERIC_JOIN_PREDICATE(left_indices[i],
+                                        right_indices[i],
+                                        left_data,
+                                        left_masks,
+                                        left_offsets,
+                                        right_data,
+                                        right_masks,
+                                        right_offsets,
+                                        literal_data,
+                                        literal_valid);
+  }
+}
+
+}  // namespace jit
+}  // namespace joins
+}  // namespace cudf
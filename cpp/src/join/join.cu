@@ -42,9 +42,12 @@ inner_join(table_view const& left_input,
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
 
-  // now rebuild the table views with the updated ones
-  auto const left  = matched.second.front();
-  auto const right = matched.second.back();
+  // now rebuild the table views with the updated ones; the matched dictionaries share their
+  // keys so the rows can be hashed and compared by their indices
+  auto const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  auto const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
 
   // For `inner_join`, we can freely choose either the `left` or `right` table to use for
   // building/probing the hash map. Because building is typically more expensive than probing, we
@@ -73,9 +76,12 @@ left_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // now rebuild the table views with the updated ones; the matched dictionaries share their
+  // keys so the rows can be hashed and compared by their indices
+  table_view const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  table_view const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
   return hj_obj.left_join(left, std::nullopt, stream, mr);
@@ -95,9 +101,12 @@ full_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
+  // now rebuild the table views with the updated ones; the matched dictionaries share their
+  // keys so the rows can be hashed and compared by their indices
+  table_view const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  table_view const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
 
   cudf::hash_join hj_obj(right, compare_nulls, stream);
   return hj_obj.full_join(left, std::nullopt, stream, mr);
@@ -20,6 +20,8 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -69,6 +71,28 @@ class make_pair_function {
   hash_value_type const _empty_key_sentinel;
 };
 
+/**
+ * @brief Device functor to create a pair of a precomputed row hash and the row index for use with
+ * cuco data structures.
+ */
+class make_hashed_pair_function {
+ public:
+  CUDF_HOST_DEVICE make_hashed_pair_function(hash_value_type const* row_hashes,
+                                             hash_value_type const empty_key_sentinel)
+    : _row_hashes{row_hashes}, _empty_key_sentinel{empty_key_sentinel}
+  {
+  }
+
+  __device__ __forceinline__ auto operator()(size_type i) const noexcept
+  {
+    return cuco::make_pair(remap_sentinel_hash(_row_hashes[i], _empty_key_sentinel), i);
+  }
+
+ private:
+  hash_value_type const* _row_hashes;
+  hash_value_type const _empty_key_sentinel;
+};
+
 /**
  * @brief Device functor to determine if a row is valid.
  */
@@ -124,6 +148,29 @@ class pair_equality {
   Comparator _check_row_equality;
 };
 
+/**
+ * @brief Device functor comparing a probe row and a build row with a two-table comparator of the
+ * experimental row operators, for use as the `Comparator` of `pair_equality`.
+ *
+ * @tparam Comparator The type of the comparator returned by `two_table_comparator::equal_to` for
+ * the probe table as left table and the build table as right table.
+ */
+template <typename Comparator>
+class probe_build_row_equality {
+ public:
+  probe_build_row_equality(Comparator const& comparator) : _comparator{comparator} {}
+
+  __device__ __forceinline__ bool operator()(size_type probe_row,
+                                             size_type build_row) const noexcept
+  {
+    return _comparator(experimental::row::lhs_index_type{probe_row},
+                       experimental::row::rhs_index_type{build_row});
+  }
+
+ private:
+  Comparator _comparator;
+};
+
 /**
  * @brief Computes the trivial left join operation for the case when the
  * right table is empty.
@@ -145,6 +192,41 @@ get_trivial_left_join_indices(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Inserts the pairs of all rows of `build` into `hash_table`.
+ *
+ * @tparam MultimapType The type of the hash table
+ * @tparam PairFunction The type of the functor returning the pair of a row
+ *
+ * @param build Table of columns used to build join hash.
+ * @param pair_func Functor returning the hash table pair of a row index.
+ * @param hash_table Build hash table.
+ * @param nulls_equal Flag to denote nulls are equal or not.
+ * @param bitmask Bitmask to denote whether a row is valid.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename MultimapType, typename PairFunction>
+void insert_join_hash_table(cudf::table_view const& build,
+                            PairFunction const& pair_func,
+                            MultimapType& hash_table,
+                            null_equality const nulls_equal,
+                            [[maybe_unused]] bitmask_type const* bitmask,
+                            rmm::cuda_stream_view stream)
+{
+  auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
+
+  size_type const build_table_num_rows{build.num_rows()};
+  if (nulls_equal == cudf::null_equality::EQUAL or (not nullable(build))) {
+    hash_table.insert(iter, iter + build_table_num_rows, stream.value());
+  } else {
+    thrust::counting_iterator<size_type> stencil(0);
+    row_is_valid pred{bitmask};
+
+    // insert valid rows
+    hash_table.insert_if(iter, iter + build_table_num_rows, stencil, pred, stream.value());
+  }
+}
+
 /**
  * @brief Builds the hash table based on the given `build_table`.
  *
@@ -173,18 +255,39 @@ void build_join_hash_table(cudf::table_view const& build,
   auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
   make_pair_function pair_func{hash_build, empty_key_sentinel};
 
-  auto iter = cudf::detail::make_counting_transform_iterator(0, pair_func);
+  insert_join_hash_table(build, pair_func, hash_table, nulls_equal, bitmask, stream);
+}
 
-  size_type const build_table_num_rows{build_table_ptr->num_rows()};
-  if (nulls_equal == cudf::null_equality::EQUAL or (not nullable(build))) {
-    hash_table.insert(iter, iter + build_table_num_rows, stream.value());
-  } else {
-    thrust::counting_iterator<size_type> stencil(0);
-    row_is_valid pred{bitmask};
+/**
+ * @brief Builds the hash table based on the given `build_table` and precomputed hashes of its
+ * rows, e.g. the ones of a hash table built before.
+ *
+ * @tparam MultimapType The type of the hash table
+ *
+ * @param build Table of columns used to build join hash.
+ * @param row_hashes The `row_hash` of every row of `build`.
+ * @param hash_table Build hash table.
+ * @param nulls_equal Flag to denote nulls are equal or not.
+ * @param bitmask Bitmask to denote whether a row is valid.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+template <typename MultimapType>
+void build_join_hash_table(cudf::table_view const& build,
+                           device_span<hash_value_type const> row_hashes,
+                           MultimapType& hash_table,
+                           null_equality const nulls_equal,
+                           [[maybe_unused]] bitmask_type const* bitmask,
+                           rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(0 != build.num_columns(), "Selected build dataset is empty");
+  CUDF_EXPECTS(0 != build.num_rows(), "Build side table has no rows");
+  CUDF_EXPECTS(row_hashes.size() == static_cast<std::size_t>(build.num_rows()),
+               "Mismatch in number of build rows and row hashes");
 
-    // insert valid rows
-    hash_table.insert_if(iter, iter + build_table_num_rows, stencil, pred, stream.value());
-  }
+  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
+  make_hashed_pair_function pair_func{row_hashes.data(), empty_key_sentinel};
+
+  insert_join_hash_table(build, pair_func, hash_table, nulls_equal, bitmask, stream);
 }
 
 // Convenient alias for a pair of unique pointers to device uvectors.
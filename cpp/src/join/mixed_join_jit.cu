@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join_common_utils.cuh"
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/detail/join.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <jit_preprocessed_files/join/jit/kernel.cu.jit.hpp>
+
+#include <jit/ast_codegen.hpp>
+#include <jit/cache.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
+
+#include <sstream>
+#include <string>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the source of the `GENERIC_JOIN_PREDICATE` device function evaluating the
+ * expression whose statements `codegen` emitted, with `result` the id of its result.
+ */
+std::string make_predicate_source(cudf::jit::ast_codegen const& codegen, int result)
+{
+  std::ostringstream source;
+  source << "#pragma once\n\n"
+         << "__device__ __inline__ bool GENERIC_JOIN_PREDICATE(\n"
+         << "  cudf::size_type left_row,\n"
+         << "  cudf::size_type right_row,\n"
+         << "  void const* const* left_data,\n"
+         << "  cudf::bitmask_type const* const* left_masks,\n"
+         << "  cudf::size_type const* left_offsets,\n"
+         << "  void const* const* right_data,\n"
+         << "  cudf::bitmask_type const* const* right_masks,\n"
+         << "  cudf::size_type const* right_offsets,\n"
+         << "  void const* const* literal_data,\n"
+         << "  bool const* const* literal_valid)\n"
+         << "{\n"
+         << codegen.body() << "  return n" << result << " && static_cast<bool>(v" << result
+         << ");\n"
+         << "}\n";
+  return source.str();
+}
+
+/**
+ * @brief Removes the pairs of `indices` for which the JIT-compiled `binary_predicate` is false or
+ * null.
+ */
+void filter_pairs(std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                            std::unique_ptr<rmm::device_uvector<size_type>>>& indices,
+                  table_view const& left_conditional,
+                  table_view const& right_conditional,
+                  ast::expression const& binary_predicate,
+                  rmm::cuda_stream_view stream)
+{
+  auto& [left_indices, right_indices] = indices;
+  auto const num_pairs                = left_indices->size();
+  if (num_pairs == 0) { return; }
+
+  cudf::jit::ast_codegen codegen{left_conditional, &right_conditional};
+  auto const predicate_source = make_predicate_source(codegen, codegen.emit(binary_predicate));
+
+  auto const left_arrays  = cudf::jit::make_device_table_arrays(left_conditional, stream);
+  auto const right_arrays = cudf::jit::make_device_table_arrays(right_conditional, stream);
+  auto const literals     = cudf::jit::make_device_literal_arrays(codegen.literals(), stream);
+
+  rmm::device_uvector<bool> matches(num_pairs, stream);
+  cudf::jit::get_kernel(*join_jit_kernel_cu_jit,
+                        "cudf::joins::jit::filter_pairs",
+                        {{"join/jit/predicate-udf.hpp", predicate_source}},
+                        {"-arch=sm_."})                   //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(num_pairs,
+             left_indices->data(),
+             right_indices->data(),
+             left_arrays.data.data(),
+             left_arrays.masks.data(),
+             left_arrays.offsets.data(),
+             right_arrays.data.data(),
+             right_arrays.masks.data(),
+             right_arrays.offsets.data(),
+             literals.data.data(),
+             literals.valid.data(),
+             matches.data());
+
+  auto const pairs = thrust::make_zip_iterator(
+    thrust::make_tuple(left_indices->begin(), right_indices->begin()));
+  auto const pairs_end = thrust::remove_if(rmm::exec_policy(stream),
+                                           pairs,
+                                           pairs + num_pairs,
+                                           matches.begin(),
+                                           thrust::logical_not<bool>{});
+  left_indices->resize(thrust::distance(pairs, pairs_end), stream);
+  right_indices->resize(thrust::distance(pairs, pairs_end), stream);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_join(table_view const& left_equality,
+               table_view const& right_equality,
+               table_view const& left_conditional,
+               table_view const& right_conditional,
+               ast::expression const& binary_predicate,
+               null_equality compare_nulls,
+               join_kind join_type,
+               rmm::cuda_stream_view stream,
+               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_conditional.num_rows() == left_equality.num_rows(),
+               "The left conditional and equality tables must have the same number of rows.");
+  CUDF_EXPECTS(right_conditional.num_rows() == right_equality.num_rows(),
+               "The right conditional and equality tables must have the same number of rows.");
+
+  auto const has_nulls =
+    cudf::has_nulls(left_equality) || cudf::has_nulls(right_equality) ||
+    binary_predicate.may_evaluate_null(left_conditional, right_conditional, stream);
+  auto const parser = ast::detail::expression_parser{binary_predicate,
+                                                     left_conditional,
+                                                     right_conditional,
+                                                     has_nulls,
+                                                     stream,
+                                                     rmm::mr::get_current_device_resource()};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The expression must produce a boolean output.");
+
+  auto const left_num_rows  = left_conditional.num_rows();
+  auto const right_num_rows = right_conditional.num_rows();
+  if (left_num_rows == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+  if (right_num_rows == 0) {
+    return join_type == join_kind::INNER_JOIN
+             ? std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                         std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr))
+             : get_trivial_left_join_indices(left_conditional, stream, mr);
+  }
+
+  // The pairs matching on the equality columns are the candidates the predicate is evaluated on.
+  // Only these are materialized, as every one of them would be evaluated by the interpreted mixed
+  // join as well.
+  auto result = [&]() {
+    if (right_num_rows > left_num_rows) {
+      cudf::hash_join hj_obj(left_equality, compare_nulls, stream);
+      auto [right_indices, left_indices] =
+        hj_obj.inner_join(right_equality, std::nullopt, stream, mr);
+      return std::pair(std::move(left_indices), std::move(right_indices));
+    }
+    cudf::hash_join hj_obj(right_equality, compare_nulls, stream);
+    return hj_obj.inner_join(left_equality, std::nullopt, stream, mr);
+  }();
+  filter_pairs(result, left_conditional, right_conditional, binary_predicate, stream);
+
+  if (join_type == join_kind::LEFT_JOIN) {
+    // append the left rows without any match, paired with a null index
+    auto unmatched =
+      get_left_join_indices_complement(result.first, right_num_rows, left_num_rows, stream, mr);
+    std::swap(unmatched.first, unmatched.second);
+    result = concatenate_vector_pairs(result, unmatched, stream);
+  }
+  return result;
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_inner_join(table_view const& left_equality,
+                     table_view const& right_equality,
+                     table_view const& left_conditional,
+                     table_view const& right_conditional,
+                     ast::expression const& binary_predicate,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  return jit_mixed_join(left_equality,
+                        right_equality,
+                        left_conditional,
+                        right_conditional,
+                        binary_predicate,
+                        compare_nulls,
+                        join_kind::INNER_JOIN,
+                        stream,
+                        mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_left_join(table_view const& left_equality,
+                    table_view const& right_equality,
+                    table_view const& left_conditional,
+                    table_view const& right_conditional,
+                    ast::expression const& binary_predicate,
+                    null_equality compare_nulls,
+                    rmm::cuda_stream_view stream,
+                    rmm::mr::device_memory_resource* mr)
+{
+  return jit_mixed_join(left_equality,
+                        right_equality,
+                        left_conditional,
+                        right_conditional,
+                        binary_predicate,
+                        compare_nulls,
+                        join_kind::LEFT_JOIN,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_inner_join(table_view const& left_equality,
+                     table_view const& right_equality,
+                     table_view const& left_conditional,
+                     table_view const& right_conditional,
+                     ast::expression const& binary_predicate,
+                     null_equality compare_nulls,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jit_mixed_inner_join(left_equality,
+                                      right_equality,
+                                      left_conditional,
+                                      right_conditional,
+                                      binary_predicate,
+                                      compare_nulls,
+                                      cudf::default_stream_value,
+                                      mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+jit_mixed_left_join(table_view const& left_equality,
+                    table_view const& right_equality,
+                    table_view const& left_conditional,
+                    table_view const& right_conditional,
+                    ast::expression const& binary_predicate,
+                    null_equality compare_nulls,
+                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jit_mixed_left_join(left_equality,
+                                     right_equality,
+                                     left_conditional,
+                                     right_conditional,
+                                     binary_predicate,
+                                     compare_nulls,
+                                     cudf::default_stream_value,
+                                     mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/transform.h>
+
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Hash partitions the rows of `keys` together with their row indices
+ *
+ * @return The partitioned rows, whose last column holds the row index of each row in `keys`, and
+ * the offsets of the partitions followed by the number of rows
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> partition_with_row_indices(
+  table_view const& keys, size_type num_partitions, rmm::cuda_stream_view stream)
+{
+  auto const row_indices = cudf::detail::sequence(
+    keys.num_rows(), numeric_scalar<size_type>(0, true, stream), stream);
+
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  columns.push_back(row_indices->view());
+  std::vector<size_type> columns_to_hash(keys.num_columns());
+  std::iota(columns_to_hash.begin(), columns_to_hash.end(), 0);
+
+  auto result = cudf::hash_partition(table_view{columns},
+                                     columns_to_hash,
+                                     num_partitions,
+                                     hash_id::HASH_MURMUR3,
+                                     DEFAULT_HASH_SEED,
+                                     stream,
+                                     rmm::mr::get_current_device_resource());
+  result.second.push_back(keys.num_rows());
+  return result;
+}
+
+/**
+ * @brief Replaces the indices into a partition with the row indices the partition's rows had
+ * before partitioning
+ */
+void map_to_row_indices(rmm::device_uvector<size_type>& indices,
+                        column_view const& row_indices,
+                        rmm::cuda_stream_view stream)
+{
+  thrust::transform(rmm::exec_policy(stream),
+                    indices.begin(),
+                    indices.end(),
+                    indices.begin(),
+                    [row_indices = row_indices.begin<size_type>()] __device__(size_type idx) {
+                      return row_indices[idx];
+                    });
+}
+
+}  // namespace
+
+void partitioned_inner_join(table_view const& left_input,
+                            table_view const& right_input,
+                            size_type num_partitions,
+                            partitioned_join_callback const& callback,
+                            null_equality compare_nulls,
+                            rmm::cuda_stream_view stream,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "The number of partitions must be positive");
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  if (left_input.num_rows() == 0 || right_input.num_rows() == 0) { return; }
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  // Rows with equal keys hash to the same partition on both sides, so the join of the tables is
+  // the union of the joins of their corresponding partitions. Each of those only builds a hash
+  // table over a single partition of the build side.
+  auto const [left_partitioned, left_offsets] =
+    partition_with_row_indices(left, num_partitions, stream);
+  auto const [right_partitioned, right_offsets] =
+    partition_with_row_indices(right, num_partitions, stream);
+
+  std::vector<size_type> key_columns(left.num_columns());
+  std::iota(key_columns.begin(), key_columns.end(), 0);
+
+  for (size_type p = 0; p < num_partitions; p++) {
+    auto const left_part = cudf::detail::slice(
+      left_partitioned->view(), {left_offsets[p], left_offsets[p + 1]}, stream)[0];
+    auto const right_part = cudf::detail::slice(
+      right_partitioned->view(), {right_offsets[p], right_offsets[p + 1]}, stream)[0];
+    if (left_part.num_rows() == 0 || right_part.num_rows() == 0) { continue; }
+
+    auto const left_keys  = left_part.select(key_columns);
+    auto const right_keys = right_part.select(key_columns);
+
+    // build the hash table from the smaller partition, as in the unpartitioned inner join
+    auto [left_result, right_result] = [&]() {
+      if (right_keys.num_rows() > left_keys.num_rows()) {
+        cudf::hash_join hj_obj(left_keys, compare_nulls, stream);
+        auto [right_indices, left_indices] =
+          hj_obj.inner_join(right_keys, std::nullopt, stream, mr);
+        return std::pair(std::move(left_indices), std::move(right_indices));
+      }
+      cudf::hash_join hj_obj(right_keys, compare_nulls, stream);
+      return hj_obj.inner_join(left_keys, std::nullopt, stream, mr);
+    }();
+    if (left_result->is_empty()) { continue; }
+
+    map_to_row_indices(*left_result, left_part.column(left.num_columns()), stream);
+    map_to_row_indices(*right_result, right_part.column(right.num_columns()), stream);
+    callback(std::move(left_result), std::move(right_result));
+  }
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_input,
+                       table_view const& right_input,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream,
+                       rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<rmm::device_uvector<size_type>>> left_parts;
+  std::vector<std::unique_ptr<rmm::device_uvector<size_type>>> right_parts;
+  std::size_t total_size = 0;
+  partitioned_inner_join(
+    left_input,
+    right_input,
+    num_partitions,
+    [&](auto left_indices, auto right_indices) {
+      total_size += left_indices->size();
+      left_parts.push_back(std::move(left_indices));
+      right_parts.push_back(std::move(right_indices));
+    },
+    compare_nulls,
+    stream,
+    rmm::mr::get_current_device_resource());
+
+  auto left_result  = std::make_unique<rmm::device_uvector<size_type>>(total_size, stream, mr);
+  auto right_result = std::make_unique<rmm::device_uvector<size_type>>(total_size, stream, mr);
+
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < left_parts.size(); i++) {
+    thrust::copy(rmm::exec_policy(stream),
+                 left_parts[i]->begin(),
+                 left_parts[i]->end(),
+                 left_result->begin() + offset);
+    thrust::copy(rmm::exec_policy(stream),
+                 right_parts[i]->begin(),
+                 right_parts[i]->end(),
+                 right_result->begin() + offset);
+    offset += left_parts[i]->size();
+  }
+  return std::pair(std::move(left_result), std::move(right_result));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_inner_join(
+    left_keys, right_keys, num_partitions, compare_nulls, cudf::default_stream_value, mr);
+}
+
+void partitioned_inner_join(table_view const& left_keys,
+                            table_view const& right_keys,
+                            size_type num_partitions,
+                            partitioned_join_callback const& callback,
+                            null_equality compare_nulls,
+                            rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::partitioned_inner_join(
+    left_keys, right_keys, num_partitions, callback, compare_nulls, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join_common_utils.cuh"
+
+#include <cudf/detail/join.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_join(table_view const& left_input,
+                table_view const& right_input,
+                std::vector<order> const& column_order,
+                std::vector<null_order> const& null_precedence,
+                null_equality compare_nulls,
+                join_kind kind,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(is_sorted(left_input, column_order, null_precedence),
+               "Left keys of a sort-merge join must be sorted");
+  CUDF_EXPECTS(is_sorted(right_input, column_order, null_precedence),
+               "Right keys of a sort-merge join must be sorted");
+
+  // Make sure any dictionary columns have matched key sets.
+  // This will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input},
+    stream,
+    rmm::mr::get_current_device_resource());  // temporary objects returned
+
+  auto const left  = matched.second.front();
+  auto const right = matched.second.back();
+
+  auto const left_size = left.num_rows();
+  if (left_size == 0 || (kind == join_kind::INNER_JOIN && right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(
+      kind == join_kind::INNER_JOIN ? table_view{} : left, stream, mr);
+  }
+
+  // Since both sides are sorted the same way, the rows of `right` matching a row of `left` form
+  // the contiguous range between the row's lower and upper bound in `right`.
+  auto const lower = cudf::detail::lower_bound(
+    right, left, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  auto const upper = cudf::detail::upper_bound(
+    right, left, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+
+  // a null key matches nothing when nulls compare unequal
+  auto const row_mask =
+    compare_nulls == null_equality::UNEQUAL && has_nulls(left)
+      ? cudf::detail::bitmask_and(left, stream, rmm::mr::get_current_device_resource()).first
+      : rmm::device_buffer{};
+  auto const d_row_mask = static_cast<bitmask_type const*>(row_mask.data());
+
+  // number of right rows each left row contributes to the output, as an inclusive scan
+  auto output_end = rmm::device_uvector<int64_t>(left_size, stream);
+  auto match_count =
+    [d_lower      = lower->view().begin<size_type>(),
+     d_upper      = upper->view().begin<size_type>(),
+     d_row_mask,
+     is_left_join = kind == join_kind::LEFT_JOIN] __device__(size_type idx) -> int64_t {
+    auto const is_valid = d_row_mask == nullptr || bit_is_set(d_row_mask, idx);
+    auto const count    = is_valid ? d_upper[idx] - d_lower[idx] : 0;
+    return is_left_join ? thrust::max(count, 1) : count;
+  };
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<size_type>(0),
+                                   thrust::make_counting_iterator<size_type>(left_size),
+                                   output_end.begin(),
+                                   match_count,
+                                   thrust::plus<int64_t>{});
+  auto const output_size = static_cast<std::size_t>(output_end.back_element(stream));
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+
+  // the left row of each output row is the first row whose scanned output end lies beyond it,
+  // which keeps the output in the order of `left` and, for each left row, of `right`
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      output_end.begin(),
+                      output_end.end(),
+                      thrust::make_counting_iterator<int64_t>(0),
+                      thrust::make_counting_iterator<int64_t>(output_size),
+                      left_indices->begin());
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<int64_t>(0),
+    thrust::make_counting_iterator<int64_t>(output_size),
+    left_indices->begin(),
+    right_indices->begin(),
+    [d_lower = lower->view().begin<size_type>(),
+     d_upper = upper->view().begin<size_type>(),
+     d_end   = output_end.data(),
+     d_row_mask] __device__(int64_t out_idx, size_type left_idx) {
+      auto const is_valid = d_row_mask == nullptr || bit_is_set(d_row_mask, left_idx);
+      if (not is_valid || d_lower[left_idx] == d_upper[left_idx]) { return JoinNoneValue; }
+      auto const begin = left_idx == 0 ? int64_t{0} : d_end[left_idx - 1];
+      return static_cast<size_type>(d_lower[left_idx] + (out_idx - begin));
+    });
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::mr::device_memory_resource* mr)
+{
+  return sort_merge_join(left_keys,
+                         right_keys,
+                         column_order,
+                         null_precedence,
+                         compare_nulls,
+                         join_kind::INNER_JOIN,
+                         stream,
+                         mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::cuda_stream_view stream,
+                     rmm::mr::device_memory_resource* mr)
+{
+  return sort_merge_join(left_keys,
+                         right_keys,
+                         column_order,
+                         null_precedence,
+                         compare_nulls,
+                         join_kind::LEFT_JOIN,
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_inner_join(left_keys,
+                                       right_keys,
+                                       column_order,
+                                       null_precedence,
+                                       compare_nulls,
+                                       cudf::default_stream_value,
+                                       mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_left_join(table_view const& left_keys,
+                     table_view const& right_keys,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence,
+                     null_equality compare_nulls,
+                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_left_join(left_keys,
+                                      right_keys,
+                                      column_order,
+                                      null_precedence,
+                                      compare_nulls,
+                                      cudf::default_stream_value,
+                                      mr);
+}
+
+}  // namespace cudf
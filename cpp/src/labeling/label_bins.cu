@@ -206,7 +206,7 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE()
+  CUDF_FUNC_RANGE();
   CUDF_EXPECTS((input.type() == left_edges.type()) && (input.type() == right_edges.type()),
                "The input and edge columns must have the same types.");
   CUDF_EXPECTS(left_edges.size() == right_edges.size(),
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/labeling/label_bins.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Label of the values that belong to no bin
+constexpr size_type no_bin{std::numeric_limits<size_type>::max()};
+
+// Largest number of counters privatized in shared memory by each thread block of the histogram
+constexpr size_type max_shared_memory_counts = 8192;
+
+constexpr size_type histogram_block_size      = 256;
+constexpr size_type histogram_rows_per_thread = 16;
+
+/**
+ * @brief Maps a value to its bin of `num_bins` bins of equal width covering `[lower, upper]`.
+ */
+struct uniform_bins {
+  double lower;
+  double upper;
+  double bins_per_unit;  ///< `num_bins / (upper - lower)`
+  size_type num_bins;
+
+  template <typename T>
+  __device__ size_type operator()(T value) const
+  {
+    auto const v = static_cast<double>(value);
+    // also true for NaN
+    if (not(v >= lower and v <= upper)) { return no_bin; }
+    // rounding may put values just below `upper` into bin `num_bins`
+    return min(static_cast<size_type>((v - lower) * bins_per_unit), num_bins - 1);
+  }
+};
+
+uniform_bins make_uniform_bins(double lower, double upper, size_type num_bins)
+{
+  CUDF_EXPECTS(num_bins > 0, "The number of bins must be positive.");
+  CUDF_EXPECTS(lower < upper, "The lower edge must be less than the upper edge.");
+  return {lower, upper, num_bins / (upper - lower), num_bins};
+}
+
+template <typename T>
+struct uniform_bin_labeler {
+  column_device_view input;
+  uniform_bins bins;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return input.is_null(row) ? no_bin : bins(input.element<T>(row));
+  }
+};
+
+struct filter_no_bin {
+  __device__ bool operator()(size_type label) const { return label != no_bin; }
+};
+
+/**
+ * @brief Counts the elements of `input` per group and bin.
+ *
+ * The counts of a block are accumulated in shared memory and added to `counts` once when
+ * `use_shared_memory` is set, otherwise every element is added to `counts` directly.
+ *
+ * @param input Elements to count
+ * @param group_labels Group of each element, or null if there are no groups
+ * @param num_groups Number of groups
+ * @param bins Bins of the elements
+ * @param use_shared_memory Whether the `num_groups * bins.num_bins` counters fit in shared memory
+ * @param counts Count of each group and bin, `counts[group * bins.num_bins + bin]`
+ */
+template <typename T>
+__global__ void histogram_kernel(column_device_view input,
+                                 size_type const* __restrict__ group_labels,
+                                 size_type num_groups,
+                                 uniform_bins bins,
+                                 bool use_shared_memory,
+                                 int64_t* __restrict__ counts)
+{
+  extern __shared__ uint32_t block_counts[];
+
+  auto const num_counts = num_groups * bins.num_bins;
+  if (use_shared_memory) {
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_counts; i += blockDim.x) {
+      block_counts[i] = 0;
+    }
+    __syncthreads();
+  }
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto row = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+       row < input.size();
+       row += stride) {
+    if (input.is_null(row)) { continue; }
+    auto const bin = bins(input.element<T>(row));
+    if (bin == no_bin) { continue; }
+    auto const group = group_labels != nullptr ? group_labels[row] : 0;
+    if (group < 0 or group >= num_groups) { continue; }
+
+    auto const index = group * bins.num_bins + bin;
+    if (use_shared_memory) {
+      atomicAdd(&block_counts[index], 1u);
+    } else {
+      atomicAdd(reinterpret_cast<unsigned long long*>(counts + index), 1ull);
+    }
+  }
+
+  if (use_shared_memory) {
+    __syncthreads();
+    for (auto i = static_cast<size_type>(threadIdx.x); i < num_counts; i += blockDim.x) {
+      if (block_counts[i] != 0) {
+        atomicAdd(reinterpret_cast<unsigned long long*>(counts + i),
+                  static_cast<unsigned long long>(block_counts[i]));
+      }
+    }
+  }
+}
+
+struct uniform_bins_dispatcher {
+  template <typename T, typename... Args>
+  std::enable_if_t<not cudf::is_numeric<T>(), std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Uniform bins require a numeric type.");
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_numeric<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    uniform_bins bins,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto output = make_numeric_column(
+      data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
+    auto const output_begin = output->mutable_view().begin<size_type>();
+    auto const d_input      = column_device_view::create(input, stream);
+
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      output_begin,
+                      uniform_bin_labeler<T>{*d_input, bins});
+
+    auto [null_mask, null_count] =
+      valid_if(output_begin, output_begin + input.size(), filter_no_bin{}, stream, mr);
+    output->set_null_mask(std::move(null_mask), null_count);
+    return output;
+  }
+
+  template <typename T>
+  std::enable_if_t<cudf::is_numeric<T>(), std::unique_ptr<column>> operator()(
+    column_view const& input,
+    size_type const* group_labels,
+    size_type num_groups,
+    uniform_bins bins,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    auto const num_counts = num_groups * bins.num_bins;
+    auto counts           = make_numeric_column(
+      data_type{type_id::INT64}, num_counts, mask_state::UNALLOCATED, stream, mr);
+    auto const counts_begin = counts->mutable_view().begin<int64_t>();
+    thrust::fill(rmm::exec_policy(stream), counts_begin, counts_begin + num_counts, 0);
+    if (input.is_empty() or num_counts == 0) { return counts; }
+
+    auto const d_input           = column_device_view::create(input, stream);
+    auto const use_shared_memory = num_counts <= max_shared_memory_counts;
+    auto const shared_memory_size =
+      use_shared_memory ? num_counts * sizeof(uint32_t) : std::size_t{0};
+    grid_1d const grid{input.size(), histogram_block_size, histogram_rows_per_thread};
+    histogram_kernel<T><<<grid.num_blocks, grid.num_threads_per_block, shared_memory_size,
+                          stream.value()>>>(
+      *d_input, group_labels, num_groups, bins, use_shared_memory, counts_begin);
+    CUDF_CHECK_CUDA(stream.value());
+    return counts;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> label_bins(column_view const& input,
+                                   double lower,
+                                   double upper,
+                                   size_type num_bins,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  auto const bins = make_uniform_bins(lower, upper, num_bins);
+  if (input.is_empty()) { return make_empty_column(type_to_id<size_type>()); }
+
+  return type_dispatcher<dispatch_storage_type>(
+    input.type(), uniform_bins_dispatcher{}, input, bins, stream, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto const bins = make_uniform_bins(lower, upper, num_bins);
+  return type_dispatcher<dispatch_storage_type>(
+    input.type(), uniform_bins_dispatcher{}, input, nullptr, 1, bins, stream, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& group_labels,
+                                  size_type num_groups,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto const bins = make_uniform_bins(lower, upper, num_bins);
+  CUDF_EXPECTS(group_labels.type().id() == type_to_id<size_type>(),
+               "The group labels must be INT32.");
+  CUDF_EXPECTS(not group_labels.has_nulls(), "The group labels cannot contain nulls.");
+  CUDF_EXPECTS(group_labels.size() == input.size(),
+               "The input and group label columns must be of the same length.");
+  CUDF_EXPECTS(num_groups >= 0, "The number of groups cannot be negative.");
+
+  auto counts = type_dispatcher<dispatch_storage_type>(input.type(),
+                                                       uniform_bins_dispatcher{},
+                                                       input,
+                                                       group_labels.begin<size_type>(),
+                                                       num_groups,
+                                                       bins,
+                                                       stream,
+                                                       mr);
+  auto offsets = cudf::detail::sequence(num_groups + 1,
+                                        numeric_scalar<size_type>(0, true, stream),
+                                        numeric_scalar<size_type>(num_bins, true, stream),
+                                        stream,
+                                        mr);
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(counts), 0, rmm::device_buffer{}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> label_bins(column_view const& input,
+                                   double lower,
+                                   double upper,
+                                   size_type num_bins,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::label_bins(input, lower, upper, num_bins, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(input, lower, upper, num_bins, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> histogram(column_view const& input,
+                                  column_view const& group_labels,
+                                  size_type num_groups,
+                                  double lower,
+                                  double upper,
+                                  size_type num_bins,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::histogram(
+    input, group_labels, num_groups, lower, upper, num_bins, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/detail/contains.hpp>
 #include <cudf/lists/list_device_view.cuh>
@@ -39,6 +40,8 @@
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <optional>
 #include <type_traits>
 
 namespace cudf::lists {
@@ -132,10 +135,133 @@ struct search_list_fn {
   }
 };
 
+/**
+ * @brief The average list size from which sorted lists are searched by a warp per list instead of
+ * a thread per list.
+ */
+auto constexpr warp_search_min_list_size = size_type{32};
+
+/**
+ * @brief Finds, with a binary search by a single thread, the first index in `[begin, end)` for
+ * which the monotone predicate `pred` (all true, then all false) is false.
+ */
+struct thread_partition_point {
+  template <typename Predicate>
+  __device__ size_type operator()(size_type begin, size_type end, Predicate pred) const
+  {
+    while (begin < end) {
+      auto const mid = begin + (end - begin) / 2;
+      if (pred(mid)) {
+        begin = mid + 1;
+      } else {
+        end = mid;
+      }
+    }
+    return begin;
+  }
+};
+
+/**
+ * @brief Finds, with a 32-way search by all the threads of a warp, the first index in
+ * `[begin, end)` for which the monotone predicate `pred` (all true, then all false) is false.
+ *
+ * Each step tests one pivot per lane and shrinks the range by the warp size, so a list of a
+ * thousand elements takes two steps. All the threads of the warp must call it with the same
+ * arguments.
+ */
+struct warp_partition_point {
+  template <typename Predicate>
+  __device__ size_type operator()(size_type begin, size_type end, Predicate pred) const
+  {
+    auto const lane = static_cast<size_type>(threadIdx.x % cudf::detail::warp_size);
+    while (begin < end) {
+      auto const step  = (end - begin + cudf::detail::warp_size - 1) / cudf::detail::warp_size;
+      auto const pivot = begin + lane * step + step - 1;
+      // The pivots satisfying `pred` are those of the first lanes.
+      auto const num_true = __popc(__ballot_sync(0xffffffff, pivot < end && pred(pivot)));
+      begin               = begin + num_true * step;
+      end                 = min(end, begin + step - 1);
+    }
+    return begin;
+  }
+};
+
+/**
+ * @brief Functor to search for the index of a key element in a list whose elements are sorted.
+ */
+template <typename Element>
+struct sorted_search_list_fn {
+  duplicate_find_option const find_option;
+  bool const ascending;
+  bool const nulls_first;
+
+  __device__ size_type operator()(list_device_view list, thrust::optional<Element> key_opt) const
+  {
+    return search(list, key_opt, thread_partition_point{});
+  }
+
+  template <typename PartitionPoint>
+  __device__ size_type search(list_device_view const& list,
+                             thrust::optional<Element> const& key_opt,
+                             PartitionPoint partition_point) const
+  {
+    // A null list or null key will result in a null output row.
+    if (list.is_null() || !key_opt) { return NULL_SENTINEL; }
+
+    // The null elements are at one end of the list, the others are in `[begin, end)`.
+    auto const size  = list.size();
+    auto const begin = nulls_first
+                         ? partition_point(0, size, [&](auto i) { return list.is_null(i); })
+                         : size_type{0};
+    auto const end   = nulls_first
+                         ? size
+                         : partition_point(0, size, [&](auto i) { return !list.is_null(i); });
+
+    auto const key      = *key_opt;
+    auto const compares = [&](auto i, weak_ordering ordering) {
+      return cudf::relational_compare(list.template element<Element>(i), key) == ordering;
+    };
+    auto const precedes = ascending ? weak_ordering::LESS : weak_ordering::GREATER;
+    auto const follows  = ascending ? weak_ordering::GREATER : weak_ordering::LESS;
+
+    if (find_option == duplicate_find_option::FIND_FIRST) {
+      // The first element not preceding the key
+      auto const idx = partition_point(begin, end, [&](auto i) { return compares(i, precedes); });
+      return idx < end && compares(idx, weak_ordering::EQUIVALENT) ? idx : NOT_FOUND_SENTINEL;
+    }
+    // The last element not following the key
+    auto const idx = partition_point(begin, end, [&](auto i) { return !compares(i, follows); }) - 1;
+    return idx >= begin && compares(idx, weak_ordering::EQUIVALENT) ? idx : NOT_FOUND_SENTINEL;
+  }
+};
+
+/**
+ * @brief Searches every list of `lists` for its key with all the threads of a warp.
+ */
+template <typename Element, typename KeysIter>
+__global__ void warp_sorted_search_kernel(cudf::detail::lists_column_device_view lists,
+                                          KeysIter keys,
+                                          sorted_search_list_fn<Element> search_fn,
+                                          size_type* out)
+{
+  auto const tid       = static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  auto const num_warps = static_cast<int64_t>(gridDim.x) * blockDim.x / cudf::detail::warp_size;
+  for (auto idx = tid / cudf::detail::warp_size; idx < lists.size(); idx += num_warps) {
+    auto const list_idx = static_cast<size_type>(idx);
+    auto const result =
+      search_fn.search(list_device_view{lists, list_idx}, keys[list_idx], warp_partition_point{});
+    if (threadIdx.x % cudf::detail::warp_size == 0) { out[list_idx] = result; }
+  }
+}
+
 /**
  * @brief Dispatch functor to search for key element(s) in the corresponding rows of a lists column.
  */
 struct dispatch_index_of {
+  // The order of the elements within each list, if they are known to be sorted.
+  std::optional<order> const column_order{};
+  null_order const null_precedence{null_order::AFTER};
+
   template <typename Element, typename SearchKeyType>
   std::enable_if_t<is_supported_non_nested_type<Element>(), std::unique_ptr<column>> operator()(
     lists_column_view const& lists,
@@ -181,12 +307,35 @@ struct dispatch_index_of {
     auto const out_begin = out_positions->mutable_view().template begin<size_type>();
 
     auto const do_search = [&](auto const keys_iter) {
-      thrust::transform(rmm::exec_policy(stream),
-                        input_it,
-                        input_it + lists.size(),
-                        keys_iter,
-                        out_begin,
-                        search_list_fn{find_option});
+      if (!column_order) {
+        thrust::transform(rmm::exec_policy(stream),
+                          input_it,
+                          input_it + lists.size(),
+                          keys_iter,
+                          out_begin,
+                          search_list_fn{find_option});
+        return;
+      }
+
+      auto const ascending = *column_order == order::ASCENDING;
+      auto const search_fn = sorted_search_list_fn<Element>{
+        find_option, ascending, ascending == (null_precedence == null_order::BEFORE)};
+      // The unsliced child is only used to estimate the average list size.
+      if (lists.is_empty() || lists.child().size() < warp_search_min_list_size * lists.size()) {
+        thrust::transform(rmm::exec_policy(stream),
+                          input_it,
+                          input_it + lists.size(),
+                          keys_iter,
+                          out_begin,
+                          search_fn);
+        return;
+      }
+      auto constexpr block_size      = 256;
+      auto constexpr warps_per_block = block_size / cudf::detail::warp_size;
+      auto const num_blocks =
+        std::min((lists.size() + warps_per_block - 1) / warps_per_block, size_type{65536});
+      warp_sorted_search_kernel<Element><<<num_blocks, block_size, 0, stream.value()>>>(
+        cudf::detail::lists_column_device_view{*lists_cdv_ptr}, keys_iter, search_fn, out_begin);
     };
 
     if constexpr (search_key_is_scalar) {
@@ -277,6 +426,42 @@ std::unique_ptr<column> index_of(lists_column_view const& lists,
     search_keys.type(), dispatch_index_of{}, lists, search_keys, find_option, stream, mr);
 }
 
+std::unique_ptr<column> index_of(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 duplicate_find_option find_option,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return cudf::type_dispatcher(search_key.type(),
+                               dispatch_index_of{column_order, null_precedence},
+                               lists,
+                               search_key,
+                               find_option,
+                               stream,
+                               mr);
+}
+
+std::unique_ptr<column> index_of(lists_column_view const& lists,
+                                 column_view const& search_keys,
+                                 duplicate_find_option find_option,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+  return cudf::type_dispatcher(search_keys.type(),
+                               dispatch_index_of{column_order, null_precedence},
+                               lists,
+                               search_keys,
+                               find_option,
+                               stream,
+                               mr);
+}
+
 std::unique_ptr<column> contains(lists_column_view const& lists,
                                  cudf::scalar const& search_key,
                                  rmm::cuda_stream_view stream,
@@ -298,6 +483,43 @@ std::unique_ptr<column> contains(lists_column_view const& lists,
     index_of(lists, search_keys, duplicate_find_option::FIND_FIRST, stream), stream, mr);
 }
 
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  return to_contains(index_of(lists,
+                              search_key,
+                              duplicate_find_option::FIND_FIRST,
+                              column_order,
+                              null_precedence,
+                              stream),
+                     stream,
+                     mr);
+}
+
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 column_view const& search_keys,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(search_keys.size() == lists.size(),
+               "Number of search keys must match list column size.");
+
+  return to_contains(index_of(lists,
+                              search_keys,
+                              duplicate_find_option::FIND_FIRST,
+                              column_order,
+                              null_precedence,
+                              stream),
+                     stream,
+                     mr);
+}
+
 std::unique_ptr<column> contains_nulls(lists_column_view const& lists,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
@@ -371,4 +593,50 @@ std::unique_ptr<column> index_of(lists_column_view const& lists,
   return detail::index_of(lists, search_keys, find_option, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(
+    lists, search_key, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> contains(lists_column_view const& lists,
+                                 column_view const& search_keys,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains(
+    lists, search_keys, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> index_of(lists_column_view const& lists,
+                                 cudf::scalar const& search_key,
+                                 duplicate_find_option find_option,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(
+    lists, search_key, find_option, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> index_of(lists_column_view const& lists,
+                                 column_view const& search_keys,
+                                 duplicate_find_option find_option,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::index_of(
+    lists, search_keys, find_option, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf::lists
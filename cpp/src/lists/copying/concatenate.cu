@@ -21,15 +21,20 @@
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
-#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/transform.h>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform_scan.h>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 namespace lists {
@@ -37,11 +42,43 @@ namespace detail {
 
 namespace {
 
+/**
+ * @brief The offsets of a lists column to merge with `merge_offsets`.
+ */
+struct offsets_input {
+  size_type const* offsets;  ///< The offsets of the column, from its offset; null if empty
+  size_type size;            ///< The number of lists of the column
+};
+
+/**
+ * @brief Functor computing the merged offset at each position of the output offsets.
+ */
+struct merged_offset_fn {
+  offsets_input const* inputs;
+  size_type const* row_offsets;    ///< The position of the first list of each input in the output
+  size_type const* child_offsets;  ///< The position of the first child row of each input
+  size_type num_inputs;
+
+  __device__ size_type operator()(size_type index) const
+  {
+    // the last position of an input is also the first of the next, with the same value
+    auto const input_index =
+      thrust::upper_bound(thrust::seq, row_offsets, row_offsets + num_inputs, index) -
+      row_offsets - 1;
+    auto const& input = inputs[input_index];
+    auto const start  = child_offsets[input_index];
+    if (input.size == 0) { return start; }
+    return start + input.offsets[index - row_offsets[input_index]] - input.offsets[0];
+  }
+};
+
 /**
  * @brief Merges the offsets child columns of multiple list columns into one.
  *
  * Since offsets are all relative to the start of their respective column,
- * all offsets are shifted to account for the new starting position
+ * all offsets are shifted to account for the new starting position. The shifts are computed
+ * on the device and all the offsets are merged by a single transform, so the cost does not
+ * grow with a kernel launch per column.
  *
  * @param[in] columns               Vector of lists columns to concatenate
  * @param[in] total_list_count      Total number of lists contained in the columns
@@ -58,30 +95,40 @@ std::unique_ptr<column> merge_offsets(host_span<lists_column_view const> columns
   // outgoing offsets
   auto merged_offsets = cudf::make_fixed_width_column(
     data_type{type_id::INT32}, total_list_count + 1, mask_state::UNALLOCATED, stream, mr);
-  mutable_column_device_view d_merged_offsets(*merged_offsets, 0, 0);
 
-  // merge offsets
-  // TODO : this could probably be done as a single gpu operation if done as a kernel.
-  size_type shift = 0;
-  size_type count = 0;
-  std::for_each(columns.begin(), columns.end(), [&](lists_column_view const& c) {
-    if (c.size() > 0) {
-      // handle sliced columns
-      int const local_shift =
-        shift -
-        (c.offset() > 0 ? cudf::detail::get_value<size_type>(c.offsets(), c.offset(), stream) : 0);
-      column_device_view offsets(c.offsets(), nullptr, nullptr);
-      thrust::transform(
-        rmm::exec_policy(stream),
-        offsets.begin<size_type>() + c.offset(),
-        offsets.begin<size_type>() + c.offset() + c.size() + 1,
-        d_merged_offsets.begin<size_type>() + count,
-        [local_shift] __device__(size_type offset) { return offset + local_shift; });
-
-      shift += c.get_sliced_child(stream).size();
-      count += c.size();
-    }
-  });
+  std::vector<offsets_input> inputs;
+  inputs.reserve(columns.size());
+  std::vector<size_type> row_offsets(columns.size() + 1, 0);
+  for (std::size_t i = 0; i < columns.size(); ++i) {
+    auto const& c = columns[i];
+    // handle sliced columns
+    inputs.push_back({c.size() > 0 ? c.offsets_begin() : nullptr, c.size()});
+    row_offsets[i + 1] = row_offsets[i] + c.size();
+  }
+  auto const d_inputs      = cudf::detail::make_device_uvector_async(inputs, stream);
+  auto const d_row_offsets = cudf::detail::make_device_uvector_async(row_offsets, stream);
+
+  // the child rows of each column start after those of the previous columns
+  rmm::device_uvector<size_type> child_offsets(columns.size(), stream);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    d_inputs.begin(),
+    d_inputs.end(),
+    child_offsets.begin(),
+    [] __device__(offsets_input const& input) {
+      return input.size > 0 ? input.offsets[input.size] - input.offsets[0] : 0;
+    },
+    size_type{0},
+    thrust::plus<size_type>{});
+
+  auto d_merged_offsets = merged_offsets->mutable_view();
+  thrust::tabulate(rmm::exec_policy(stream),
+                   d_merged_offsets.begin<size_type>(),
+                   d_merged_offsets.end<size_type>(),
+                   merged_offset_fn{d_inputs.data(),
+                                    d_row_offsets.data(),
+                                    child_offsets.data(),
+                                    static_cast<size_type>(columns.size())});
 
   return merged_offsets;
 }
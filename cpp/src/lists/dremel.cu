@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/detail/dremel.hpp>
 #include <cudf/lists/lists_column_view.hpp>
@@ -254,7 +255,7 @@ dremel_data get_dremel_data(column_view h_col,
     cudf::detail::make_host_vector_async(d_column_offsets, stream);
   thrust::host_vector<size_type> column_ends =
     cudf::detail::make_host_vector_async(d_column_ends, stream);
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   size_t max_vals_size = 0;
   for (size_t l = 0; l < column_offsets.size(); ++l) {
@@ -446,7 +447,7 @@ dremel_data get_dremel_data(column_view h_col,
   rep_level.resize(level_vals_size, stream);
   def_level.resize(level_vals_size, stream);
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   size_type leaf_data_size = column_ends.back() - column_offsets.back();
 
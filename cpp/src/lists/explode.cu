@@ -14,8 +14,11 @@
  * limitations under the License.
  */
 
+#include "utilities.hpp"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/lists/explode.hpp>
 #include <cudf/lists/lists_column_view.hpp>
@@ -118,22 +121,13 @@ std::unique_ptr<table> explode(table_view const& input_table,
   auto sliced_child = explode_col.get_sliced_child(stream);
   rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
 
-  // Sliced columns may require rebasing of the offsets.
-  auto offsets = explode_col.offsets_begin();
-  // offsets + 1 here to skip the 0th offset, which removes a - 1 operation later.
-  auto offsets_minus_one = thrust::make_transform_iterator(
-    thrust::next(offsets), [offsets] __device__(auto i) { return (i - offsets[0]) - 1; });
-  auto counting_iter = thrust::make_counting_iterator(0);
-
-  // This looks like an off-by-one bug, but what is going on here is that we need to reduce each
-  // result from `lower_bound` by 1 to build the correct gather map. This can be accomplished by
-  // skipping the first entry and using the result of `lower_bound` directly.
-  thrust::lower_bound(rmm::exec_policy(stream),
-                      offsets_minus_one,
-                      offsets_minus_one + explode_col.size(),
-                      counting_iter,
-                      counting_iter + gather_map.size(),
-                      gather_map.begin());
+  // The gather map holds the parent row of every child element, which is the label of the list
+  // segment the element belongs to.
+  cudf::detail::label_segments(explode_col.offsets_begin(),
+                               explode_col.offsets_end(),
+                               gather_map.begin(),
+                               gather_map.end(),
+                               stream);
 
   return build_table(input_table,
                      explode_column_idx,
@@ -287,6 +281,16 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
     mr);
 }
 
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_with_parent_indices(
+  lists_column_view const& input,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto sliced_child   = input.get_sliced_child(stream);
+  auto parent_indices = lists::detail::generate_labels(input, sliced_child.size(), stream, mr);
+  return {std::make_unique<column>(sliced_child, stream, mr), std::move(parent_indices)};
+}
+
 }  // namespace detail
 
 /**
@@ -344,4 +348,15 @@ std::unique_ptr<table> explode_outer_position(table_view const& input_table,
     input_table, explode_column_idx, true, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc cudf::explode_with_parent_indices(lists_column_view const&,
+ * rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_with_parent_indices(
+  lists_column_view const& input, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode_with_parent_indices(input, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
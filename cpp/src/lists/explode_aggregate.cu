@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/unary.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/lists/explode.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Counts the elements, or only the valid elements, of every list of `input`.
+ */
+std::unique_ptr<column> list_element_counts(lists_column_view const& input,
+                                            bool valid_only,
+                                            rmm::cuda_stream_view stream)
+{
+  auto counts = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.size(), mask_state::UNALLOCATED, stream);
+  if (input.is_empty()) { return counts; }
+
+  auto const offsets  = input.offsets_begin();
+  auto const d_counts = counts->mutable_view().begin<size_type>();
+  auto const child    = input.get_sliced_child(stream);
+  if (!valid_only || !child.nullable()) {
+    thrust::transform(rmm::exec_policy(stream),
+                      offsets,
+                      offsets + input.size(),
+                      offsets + 1,
+                      d_counts,
+                      [] __device__(auto begin, auto end) { return end - begin; });
+    return counts;
+  }
+
+  // valid_before[i] is the number of valid elements of the sliced child before element `i`
+  rmm::device_uvector<size_type> valid_before(child.size() + 1, stream);
+  auto const d_child = column_device_view::create(child, stream);
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [d_child = *d_child] __device__(size_type i) {
+      return static_cast<size_type>(d_child.is_valid_nocheck(i));
+    });
+  valid_before.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), validity, validity + child.size(), valid_before.begin() + 1);
+  thrust::transform(rmm::exec_policy(stream),
+                    offsets,
+                    offsets + input.size(),
+                    offsets + 1,
+                    d_counts,
+                    [offsets, valid_before = valid_before.data()] __device__(auto begin, auto end) {
+                      return valid_before[end - offsets[0]] - valid_before[begin - offsets[0]];
+                    });
+  return counts;
+}
+
+/**
+ * @brief Reduces every list of `input` to its partial result for the aggregation `kind`.
+ */
+std::unique_ptr<column> list_partial_results(lists_column_view const& input,
+                                             aggregation::Kind kind,
+                                             rmm::cuda_stream_view stream)
+{
+  switch (kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+      return list_element_counts(input, kind == aggregation::COUNT_VALID, stream);
+    case aggregation::SUM:
+    case aggregation::MIN:
+    case aggregation::MAX: {
+      auto const output_type = kind == aggregation::SUM
+                                 ? cudf::detail::target_type(input.child().type(), kind)
+                                 : input.child().type();
+      if (input.is_empty()) { return make_empty_column(output_type); }
+      auto const agg = kind == aggregation::SUM
+                         ? make_sum_aggregation<segmented_reduce_aggregation>()
+                         : (kind == aggregation::MIN
+                              ? make_min_aggregation<segmented_reduce_aggregation>()
+                              : make_max_aggregation<segmented_reduce_aggregation>());
+      // The offsets index the unsliced child, so the segments are taken from it.
+      return segmented_reduce(input.child(),
+                              device_span<size_type const>(input.offsets_begin(), input.size() + 1),
+                              *agg,
+                              output_type,
+                              null_policy::EXCLUDE);
+    }
+    default: CUDF_FAIL("Unsupported aggregation for an exploded groupby.");
+  }
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> explode_groupby_aggregate(
+  table_view const& keys,
+  lists_column_view const& values,
+  std::vector<aggregation::Kind> const& aggregations,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(keys.num_rows() == values.size(), "Mismatch in number of rows of keys and values.");
+
+  std::vector<std::unique_ptr<column>> partials;
+  std::transform(aggregations.begin(),
+                 aggregations.end(),
+                 std::back_inserter(partials),
+                 [&](auto kind) { return list_partial_results(values, kind, stream); });
+
+  std::vector<column_view> columns(keys.begin(), keys.end());
+  std::transform(partials.begin(), partials.end(), std::back_inserter(columns), [](auto& p) {
+    return p->view();
+  });
+  auto input = table_view{columns};
+
+  // Null and empty lists explode to no row, so their rows are dropped before grouping.
+  auto const num_rows    = values.size();
+  auto const contributes = cudf::detail::make_counting_transform_iterator(
+    0,
+    [offsets     = values.offsets_begin(),
+     null_mask   = values.null_mask(),
+     mask_offset = values.offset()] __device__(size_type i) {
+      return offsets[i + 1] != offsets[i] &&
+             (null_mask == nullptr || bit_is_set(null_mask, mask_offset + i));
+    });
+  std::unique_ptr<table> filtered;
+  if (num_rows > 0 && thrust::count(rmm::exec_policy(stream),
+                                    contributes,
+                                    contributes + num_rows,
+                                    true) != num_rows) {
+    auto boolean_mask = make_numeric_column(
+      data_type{type_id::BOOL8}, num_rows, mask_state::UNALLOCATED, stream);
+    thrust::copy(rmm::exec_policy(stream),
+                 contributes,
+                 contributes + num_rows,
+                 boolean_mask->mutable_view().begin<bool>());
+    filtered = detail::apply_boolean_mask(input, boolean_mask->view(), stream);
+    input = filtered->view();
+  }
+
+  // The partial results of the rows of a group are merged: counts and sums are summed.
+  std::vector<groupby::aggregation_request> requests(aggregations.size());
+  for (std::size_t i = 0; i < aggregations.size(); ++i) {
+    requests[i].values = input.column(keys.num_columns() + i);
+    requests[i].aggregations.push_back(
+      aggregations[i] == aggregation::MIN
+        ? make_min_aggregation<groupby_aggregation>()
+        : (aggregations[i] == aggregation::MAX ? make_max_aggregation<groupby_aggregation>()
+                                               : make_sum_aggregation<groupby_aggregation>()));
+  }
+
+  groupby::groupby grouper(input.select(thrust::make_counting_iterator(0),
+                                        thrust::make_counting_iterator(keys.num_columns())));
+  auto [group_keys, group_results] = grouper.aggregate(requests, mr);
+
+  std::vector<std::unique_ptr<column>> results;
+  for (std::size_t i = 0; i < aggregations.size(); ++i) {
+    auto result = std::move(group_results[i].results.front());
+    if (aggregations[i] == aggregation::COUNT_VALID || aggregations[i] == aggregation::COUNT_ALL) {
+      result = detail::cast(result->view(), data_type{type_to_id<size_type>()}, stream, mr);
+    }
+    results.push_back(std::move(result));
+  }
+  return {std::move(group_keys), std::move(results)};
+}
+
+}  // namespace detail
+
+/**
+ * @copydoc cudf::explode_groupby_aggregate(table_view const&, lists_column_view const&,
+ * std::vector<aggregation::Kind> const&, rmm::mr::device_memory_resource*)
+ */
+std::pair<std::unique_ptr<table>, std::vector<std::unique_ptr<column>>> explode_groupby_aggregate(
+  table_view const& keys,
+  lists_column_view const& values,
+  std::vector<aggregation::Kind> const& aggregations,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::explode_groupby_aggregate(
+    keys, values, aggregations, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
@@ -69,7 +69,8 @@ std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
   // Algorithm:
   // - Generate labels for lhs and rhs child elements.
   // - Check existence for rows of the table {rhs_labels, rhs_child} in the table
-  //   {lhs_labels, lhs_child}.
+  //   {lhs_labels, lhs_child}. This builds a single hash set keyed by (label, element) over all
+  //   the lists, so no list is sorted.
   // - `reduce_by_key` with keys are rhs_labels and `logical_or` reduction on the existence reults
   //   computed in the previous step.
 
@@ -41,7 +41,9 @@ std::unique_ptr<column> distinct(lists_column_view const& input,
 {
   // Algorithm:
   // - Generate labels for the child elements.
-  // - Get distinct rows of the table {labels, child} using `stable_distinct`.
+  // - Get distinct rows of the table {labels, child} using `stable_distinct`. It inserts every
+  //   (label, element) row into a single hash set, so the cost does not grow with the list
+  //   lengths as a per-list sort would.
   // - Build the output lists column from the output distinct rows above.
 
   if (input.is_empty()) { return empty_like(input.parent()); }
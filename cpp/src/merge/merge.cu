@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
@@ -33,14 +35,18 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/pair.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
-#include <queue>
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace cudf {
@@ -431,28 +437,96 @@ table_ptr_type merge(cudf::table_view const& left_table,
   return std::make_unique<cudf::table>(std::move(merged_cols));
 }
 
-struct merge_queue_item {
-  table_view view;
-  table_ptr_type table;
-  // Priority is a separate member to ensure that moving from an object
-  // does not change its priority (which would ruin the queue invariant)
-  cudf::size_type priority = 0;
+/**
+ * @brief Computes the position of each row of the concatenated input tables in their merged
+ * order.
+ *
+ * The position of row `i` of table `t` is `i` plus, for every other table, the number of its rows
+ * which are ordered before that row. Rows which compare equal are ordered by the index of their
+ * table, so the merge is stable.
+ *
+ * @tparam Comparator The row comparator of the concatenated key columns
+ */
+template <typename Comparator>
+struct merged_position_fn {
+  size_type const* table_offsets;
+  size_type num_tables;
+  Comparator comparator;
 
-  merge_queue_item(table_view const& view, table_ptr_type&& table)
-    : view{view}, table{std::move(table)}, priority{-view.num_rows()}
+  __device__ size_type operator()(size_type row) const noexcept
   {
+    auto const table = static_cast<size_type>(
+      thrust::distance(table_offsets + 1,
+                       thrust::upper_bound(
+                         thrust::seq, table_offsets + 1, table_offsets + num_tables + 1, row)));
+
+    auto position = row - table_offsets[table];
+    for (size_type t = 0; t < num_tables; ++t) {
+      if (t == table) { continue; }
+      auto const begin = thrust::make_counting_iterator(table_offsets[t]);
+      auto const end   = thrust::make_counting_iterator(table_offsets[t + 1]);
+      auto const bound = t < table ? thrust::upper_bound(thrust::seq, begin, end, row, comparator)
+                                   : thrust::lower_bound(thrust::seq, begin, end, row, comparator);
+      position += static_cast<size_type>(thrust::distance(begin, bound));
+    }
+    return position;
   }
-
-  bool operator<(merge_queue_item const& other) const { return priority < other.priority; }
 };
 
-// Helper function to ensure that moving out of the priority_queue is "atomic"
-template <typename T>
-T top_and_pop(std::priority_queue<T>& q)
+/**
+ * @brief Merges more than two sorted tables in a single pass.
+ *
+ * The position of every input row in the merged output is computed independently with a binary
+ * search in each of the other tables, and the rows are scattered into a single gather map.
+ * Compared to merging the tables pairwise, no intermediate table is materialized.
+ */
+table_ptr_type k_way_merge(std::vector<table_view> const& tables_to_merge,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order,
+                           std::vector<cudf::null_order> const& null_precedence,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
 {
-  auto moved = std::move(const_cast<T&>(q.top()));
-  q.pop();
-  return moved;
+  auto const concatenated = cudf::detail::concatenate(tables_to_merge, stream);
+  auto const keys         = concatenated->view().select(key_cols);
+  auto const num_rows     = keys.num_rows();
+
+  std::vector<size_type> table_offsets{0};
+  std::transform(tables_to_merge.cbegin(),
+                 tables_to_merge.cend(),
+                 std::back_inserter(table_offsets),
+                 [offset = size_type{0}](auto const& tbl) mutable {
+                   return offset += tbl.num_rows();
+                 });
+  auto const d_table_offsets = cudf::detail::make_device_uvector_async(table_offsets, stream);
+
+  auto const d_keys            = table_device_view::create(keys, stream);
+  auto const d_column_order    = cudf::detail::make_device_uvector_async(column_order, stream);
+  auto const d_null_precedence = cudf::detail::make_device_uvector_async(null_precedence, stream);
+
+  auto const comparator = row_lexicographic_comparator(nullate::DYNAMIC{cudf::has_nulls(keys)},
+                                                       *d_keys,
+                                                       *d_keys,
+                                                       d_column_order.data(),
+                                                       d_null_precedence.data());
+  auto const positions = cudf::detail::make_counting_transform_iterator(
+    0,
+    merged_position_fn<decltype(comparator)>{
+      d_table_offsets.data(), static_cast<size_type>(tables_to_merge.size()), comparator});
+
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  positions,
+                  gather_map.begin());
+
+  return cudf::detail::gather(concatenated->view(),
+                              gather_map,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              mr);
 }
 
 }  // anonymous namespace
@@ -491,43 +565,28 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
     tables_to_merge, stream, rmm::mr::get_current_device_resource());
   auto merge_tables = matched.second;
 
-  // A queue of (table view, table) pairs
-  std::priority_queue<merge_queue_item> merge_queue;
-  // The table pointer is null if we do not own the table (input tables)
-  std::for_each(merge_tables.begin(), merge_tables.end(), [&](auto const& table) {
-    if (table.num_rows() > 0) merge_queue.emplace(table, table_ptr_type());
-  });
+  std::vector<table_view> non_empty_tables;
+  std::copy_if(merge_tables.begin(),
+               merge_tables.end(),
+               std::back_inserter(non_empty_tables),
+               [](auto const& table) { return table.num_rows() > 0; });
 
+  // No inputs have rows, return a table with same columns as the first one
+  if (non_empty_tables.empty()) { return empty_like(first_table); }
   // If there is only one non-empty table_view, return its copy
-  if (merge_queue.size() == 1) {
-    return std::make_unique<cudf::table>(merge_queue.top().view, stream, mr);
+  if (non_empty_tables.size() == 1) {
+    return std::make_unique<cudf::table>(non_empty_tables.front(), stream, mr);
   }
-  // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
-
-  // Pick the two smallest tables and merge them
-  // Until there is only one table left in the queue
-  while (merge_queue.size() > 1) {
-    // To delete the intermediate table at the end of the block
-    auto const left_table = top_and_pop(merge_queue);
-    // Deallocated at the end of the block
-    auto const right_table = top_and_pop(merge_queue);
-
-    // Only use mr for the output table
-    auto const& new_tbl_mr = merge_queue.empty() ? mr : rmm::mr::get_current_device_resource();
-    auto merged_table      = merge(left_table.view,
-                              right_table.view,
-                              key_cols,
-                              column_order,
-                              null_precedence,
-                              stream,
-                              new_tbl_mr);
-
-    auto const merged_table_view = merged_table->view();
-    merge_queue.emplace(merged_table_view, std::move(merged_table));
+  if (non_empty_tables.size() == 2) {
+    return merge(non_empty_tables[0],
+                 non_empty_tables[1],
+                 key_cols,
+                 column_order,
+                 null_precedence,
+                 stream,
+                 mr);
   }
-
-  return std::move(top_and_pop(merge_queue).table);
+  return k_way_merge(non_empty_tables, key_cols, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace detail
@@ -17,23 +17,37 @@
 #include <cub/cub.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
 #include <cudf/detail/scatter.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/transform.h>
+#include <thrust/transform_scan.h>
+
+#include <algorithm>
+#include <iterator>
 
 namespace cudf {
 namespace {
@@ -47,6 +61,12 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
 
+// Launch configuration for radix hash partition of partition counts above the threshold. Each
+// pass groups the rows by a digit of their partition number with at most RADIX_MAX_DIGITS values.
+constexpr size_type RADIX_ROWS_PER_BLOCK = OPTIMIZED_BLOCK_SIZE * OPTIMIZED_ROWS_PER_THREAD;
+constexpr size_type RADIX_MIN_DIGITS     = 128;
+constexpr size_type RADIX_MAX_DIGITS     = THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL;
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -448,6 +468,367 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
+/**
+ * @brief Maps a partition number to the group of `divisor` partitions that contains it for the
+ * first pass of radix partitioning.
+ */
+struct radix_high_digit {
+  size_type divisor;
+
+  __device__ size_type operator()(size_type partition_number) const
+  {
+    return partition_number / divisor;
+  }
+};
+
+/**
+ * @brief Maps a partition number to its position within its group of `divisor` partitions for
+ * the second pass of radix partitioning.
+ */
+struct radix_low_digit {
+  size_type divisor;
+
+  __device__ size_type operator()(size_type partition_number) const
+  {
+    return partition_number % divisor;
+  }
+};
+
+/**
+ * @brief The rows processed by a thread block in a pass of radix partitioning and the location of
+ * its digit counters.
+ */
+struct radix_block_rows {
+  size_type begin;   ///< First row of the block
+  size_type end;     ///< One past the last row of the block
+  size_type first;   ///< Location of the counter of digit 0 of the block
+  size_type stride;  ///< Distance between the counters of consecutive digits of the block
+};
+
+/**
+ * @brief Returns the rows processed by this thread block.
+ *
+ * Each block processes up to `RADIX_ROWS_PER_BLOCK` rows of a single segment. The digit counters
+ * of all the blocks are ordered by segment, then digit, then block, so that their exclusive scan
+ * is the output location of the first row of each digit of each block.
+ */
+__device__ inline radix_block_rows get_radix_block_rows(size_type const* segment_offsets,
+                                                        size_type const* segment_block_offsets,
+                                                        size_type num_segments,
+                                                        size_type num_digits)
+{
+  auto const block   = static_cast<size_type>(blockIdx.x);
+  auto const segment = thrust::upper_bound(thrust::seq,
+                                           segment_block_offsets + 1,
+                                           segment_block_offsets + num_segments + 1,
+                                           block) -
+                       (segment_block_offsets + 1);
+  auto const first_block = segment_block_offsets[segment];
+  auto const begin = segment_offsets[segment] + (block - first_block) * RADIX_ROWS_PER_BLOCK;
+  auto const end   = min(segment_offsets[segment + 1], begin + RADIX_ROWS_PER_BLOCK);
+  return {begin,
+          end,
+          first_block * num_digits + (block - first_block),
+          segment_block_offsets[segment + 1] - first_block};
+}
+
+/**
+ * @brief Computes the number of rows of each digit in each thread block of a pass of radix
+ * partitioning, and the offset of each row among the rows of its digit in its block.
+ *
+ * Since a pass only has `num_digits` distinct digits, the histogram fits in shared memory
+ * however many partitions there are.
+ *
+ * @param[in] partition_numbers The partition number of each row
+ * @param[in] num_digits The number of distinct digits of this pass
+ * @param[in] digit_fn Maps a partition number to its digit
+ * @param[in] segment_offsets The first row of each segment followed by the number of rows
+ * @param[in] segment_block_offsets The first block of each segment followed by the number of
+ * blocks
+ * @param[in] num_segments The number of segments
+ * @param[out] row_digit_offset The offset of each row among the rows of its digit in its block
+ * @param[out] block_digit_sizes The number of rows of each digit in each block
+ */
+template <typename DigitFn>
+__global__ void compute_radix_digit_sizes(size_type const* __restrict__ partition_numbers,
+                                          size_type const num_digits,
+                                          DigitFn const digit_fn,
+                                          size_type const* __restrict__ segment_offsets,
+                                          size_type const* __restrict__ segment_block_offsets,
+                                          size_type const num_segments,
+                                          size_type* __restrict__ row_digit_offset,
+                                          size_type* __restrict__ block_digit_sizes)
+{
+  extern __shared__ size_type shared_digit_sizes[];
+
+  auto const rows =
+    get_radix_block_rows(segment_offsets, segment_block_offsets, num_segments, num_digits);
+
+  for (size_type digit = threadIdx.x; digit < num_digits; digit += blockDim.x) {
+    shared_digit_sizes[digit] = 0;
+  }
+  __syncthreads();
+
+  for (size_type row = rows.begin + threadIdx.x; row < rows.end; row += blockDim.x) {
+    auto const digit      = digit_fn(partition_numbers[row]);
+    row_digit_offset[row] = atomicAdd(&(shared_digit_sizes[digit]), size_type(1));
+  }
+  __syncthreads();
+
+  for (size_type digit = threadIdx.x; digit < num_digits; digit += blockDim.x) {
+    block_digit_sizes[rows.first + digit * rows.stride] = shared_digit_sizes[digit];
+  }
+}
+
+/**
+ * @brief Moves the partition number and the input row index of each row to its output location
+ * in a pass of radix partitioning.
+ *
+ * @param[in] partition_numbers The partition number of each row
+ * @param[in] row_indices The input row index of each row
+ * @param[in] num_digits The number of distinct digits of this pass
+ * @param[in] digit_fn Maps a partition number to its digit
+ * @param[in] segment_offsets The first row of each segment followed by the number of rows
+ * @param[in] segment_block_offsets The first block of each segment followed by the number of
+ * blocks
+ * @param[in] num_segments The number of segments
+ * @param[in] row_digit_offset The offset of each row among the rows of its digit in its block
+ * @param[in] scanned_block_digit_sizes The exclusive scan of the number of rows of each digit in
+ * each block
+ * @param[out] output_partition_numbers The partition numbers in output order
+ * @param[out] output_row_indices The input row indices in output order
+ */
+template <typename DigitFn, typename IndexIter>
+__global__ void scatter_radix_digits(size_type const* __restrict__ partition_numbers,
+                                     IndexIter row_indices,
+                                     size_type const num_digits,
+                                     DigitFn const digit_fn,
+                                     size_type const* __restrict__ segment_offsets,
+                                     size_type const* __restrict__ segment_block_offsets,
+                                     size_type const num_segments,
+                                     size_type const* __restrict__ row_digit_offset,
+                                     size_type const* __restrict__ scanned_block_digit_sizes,
+                                     size_type* __restrict__ output_partition_numbers,
+                                     size_type* __restrict__ output_row_indices)
+{
+  extern __shared__ size_type shared_digit_offsets[];
+
+  auto const rows =
+    get_radix_block_rows(segment_offsets, segment_block_offsets, num_segments, num_digits);
+
+  for (size_type digit = threadIdx.x; digit < num_digits; digit += blockDim.x) {
+    shared_digit_offsets[digit] = scanned_block_digit_sizes[rows.first + digit * rows.stride];
+  }
+  __syncthreads();
+
+  for (size_type row = rows.begin + threadIdx.x; row < rows.end; row += blockDim.x) {
+    auto const partition_number = partition_numbers[row];
+    auto const location =
+      shared_digit_offsets[digit_fn(partition_number)] + row_digit_offset[row];
+    output_partition_numbers[location] = partition_number;
+    output_row_indices[location]       = row_indices[row];
+  }
+}
+
+/**
+ * @brief Runs a pass of radix partitioning that groups the rows of each segment by digit.
+ *
+ * @return The exclusive scan of the number of rows of each digit in each block
+ */
+template <typename DigitFn, typename IndexIter>
+rmm::device_uvector<size_type> radix_partition_pass(size_type const* partition_numbers,
+                                                    IndexIter row_indices,
+                                                    size_type num_digits,
+                                                    DigitFn digit_fn,
+                                                    size_type const* segment_offsets,
+                                                    size_type const* segment_block_offsets,
+                                                    size_type num_segments,
+                                                    size_type num_blocks,
+                                                    size_type* row_digit_offset,
+                                                    size_type* output_partition_numbers,
+                                                    size_type* output_row_indices,
+                                                    rmm::cuda_stream_view stream)
+{
+  auto block_digit_sizes = rmm::device_uvector<size_type>(num_blocks * num_digits, stream);
+  auto const smem        = num_digits * sizeof(size_type);
+
+  compute_radix_digit_sizes<<<num_blocks, OPTIMIZED_BLOCK_SIZE, smem, stream.value()>>>(
+    partition_numbers,
+    num_digits,
+    digit_fn,
+    segment_offsets,
+    segment_block_offsets,
+    num_segments,
+    row_digit_offset,
+    block_digit_sizes.data());
+
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         block_digit_sizes.begin(),
+                         block_digit_sizes.end(),
+                         block_digit_sizes.begin());
+
+  scatter_radix_digits<<<num_blocks, OPTIMIZED_BLOCK_SIZE, smem, stream.value()>>>(
+    partition_numbers,
+    row_indices,
+    num_digits,
+    digit_fn,
+    segment_offsets,
+    segment_block_offsets,
+    num_segments,
+    row_digit_offset,
+    block_digit_sizes.data(),
+    output_partition_numbers,
+    output_row_indices);
+
+  return block_digit_sizes;
+}
+
+/**
+ * @brief Computes the gather map that groups the rows by partition number with two passes of
+ * radix partitioning.
+ *
+ * The first pass groups the rows by `partition_number / low_digits` and the second pass groups
+ * the rows of each of those groups by `partition_number % low_digits`. Neither pass has more than
+ * `RADIX_MAX_DIGITS` digits, so both keep their histograms in shared memory for partition
+ * counts too large for `compute_row_partition_numbers` to do so efficiently.
+ *
+ * @param partition_numbers The partition number of each row, overwritten with the partition
+ * number of each output row
+ * @param num_partitions The number of partitions
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The gather map from the rows of the partitioned output to the rows of the input, and
+ * the offsets of the partitions in the output
+ */
+std::pair<rmm::device_uvector<size_type>, std::vector<size_type>> radix_partition_gather_map(
+  rmm::device_uvector<size_type>& partition_numbers,
+  size_type num_partitions,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows   = static_cast<size_type>(partition_numbers.size());
+  auto const low_digits = std::max(
+    RADIX_MIN_DIGITS, util::div_rounding_up_safe(num_partitions, RADIX_MAX_DIGITS));
+  auto const high_digits = util::div_rounding_up_safe(num_partitions, low_digits);
+
+  auto grouped_partition_numbers = rmm::device_uvector<size_type>(num_rows, stream);
+  auto grouped_rows              = rmm::device_uvector<size_type>(num_rows, stream);
+  auto row_digit_offset          = rmm::device_uvector<size_type>(num_rows, stream);
+
+  // The first pass treats the whole table as a single segment
+  auto const num_blocks = util::div_rounding_up_safe(num_rows, RADIX_ROWS_PER_BLOCK);
+  auto const table_offsets =
+    cudf::detail::make_device_uvector_async(std::vector<size_type>{0, num_rows}, stream);
+  auto const table_block_offsets =
+    cudf::detail::make_device_uvector_async(std::vector<size_type>{0, num_blocks}, stream);
+  auto const high_digit_offsets = radix_partition_pass(partition_numbers.data(),
+                                                       thrust::make_counting_iterator(0),
+                                                       high_digits,
+                                                       radix_high_digit{low_digits},
+                                                       table_offsets.data(),
+                                                       table_block_offsets.data(),
+                                                       1,
+                                                       num_blocks,
+                                                       row_digit_offset.data(),
+                                                       grouped_partition_numbers.data(),
+                                                       grouped_rows.data(),
+                                                       stream);
+
+  // The groups of the first pass are the segments of the second pass
+  auto group_offsets = rmm::device_uvector<size_type>(high_digits + 1, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(0),
+                    thrust::make_counting_iterator(high_digits + 1),
+                    group_offsets.begin(),
+                    [high_digit_offsets = high_digit_offsets.data(),
+                     high_digits,
+                     num_blocks,
+                     num_rows] __device__(size_type group) {
+                      return group < high_digits ? high_digit_offsets[group * num_blocks]
+                                                 : num_rows;
+                    });
+  auto group_block_offsets = rmm::device_uvector<size_type>(high_digits + 1, stream);
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(high_digits + 1),
+    group_block_offsets.begin(),
+    [group_offsets = group_offsets.data(), high_digits] __device__(size_type group) {
+      return group < high_digits
+               ? util::div_rounding_up_unsafe(group_offsets[group + 1] - group_offsets[group],
+                                              RADIX_ROWS_PER_BLOCK)
+               : 0;
+    },
+    0,
+    thrust::plus<size_type>{});
+  auto const group_num_blocks = group_block_offsets.back_element(stream);
+
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  radix_partition_pass(grouped_partition_numbers.data(),
+                       grouped_rows.data(),
+                       low_digits,
+                       radix_low_digit{low_digits},
+                       group_offsets.data(),
+                       group_block_offsets.data(),
+                       high_digits,
+                       group_num_blocks,
+                       row_digit_offset.data(),
+                       partition_numbers.data(),
+                       gather_map.data(),
+                       stream);
+
+  // The output rows are ordered by partition number
+  auto partition_offsets = rmm::device_uvector<size_type>(num_partitions, stream);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      partition_numbers.begin(),
+                      partition_numbers.end(),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_partitions),
+                      partition_offsets.begin());
+
+  return std::pair(std::move(gather_map),
+                   cudf::detail::make_std_vector_sync(partition_offsets, stream));
+}
+
+/**
+ * @brief Computes the partition number of each row of `table_to_hash`.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+rmm::device_uvector<size_type> compute_partition_numbers(table_view const& table_to_hash,
+                                                         size_type num_partitions,
+                                                         uint32_t seed,
+                                                         rmm::cuda_stream_view stream)
+{
+  auto const num_rows     = table_to_hash.num_rows();
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, nullate::DYNAMIC>(
+    nullate::DYNAMIC{hash_has_nulls}, *device_input, seed);
+
+  auto partition_numbers  = rmm::device_uvector<size_type>(num_rows, stream);
+  auto compute_partitions = [&](auto partitioner) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_rows),
+                      partition_numbers.begin(),
+                      [hasher, partitioner] __device__(size_type row_index) {
+                        return partitioner(hasher(row_index));
+                      });
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partitions(bitwise_partitioner<hash_value_type>(num_partitions));
+  } else {
+    compute_partitions(modulo_partitioner<hash_value_type>(num_partitions));
+  }
+  return partition_numbers;
+}
+
+/**
+ * @brief Returns true if the rows are grouped with `radix_partition_gather_map`.
+ */
+constexpr bool use_radix_partition(size_type num_partitions)
+{
+  return num_partitions > THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL &&
+         num_partitions <= RADIX_MAX_DIGITS * RADIX_MAX_DIGITS;
+}
+
 // NOTE hash_has_nulls must be true if table_to_hash has nulls
 template <template <typename> class hash_function, bool hash_has_nulls>
 std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
@@ -460,6 +841,21 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
 {
   auto const num_rows = table_to_hash.num_rows();
 
+  // Too many partitions for a single pass with the histograms in shared memory
+  if (use_radix_partition(num_partitions)) {
+    auto partition_numbers = compute_partition_numbers<hash_function, hash_has_nulls>(
+      table_to_hash, num_partitions, seed, stream);
+    auto [gather_map, partition_offsets] =
+      radix_partition_gather_map(partition_numbers, num_partitions, stream);
+    auto output = detail::gather(input,
+                                 gather_map,
+                                 out_of_bounds_policy::DONT_CHECK,
+                                 detail::negative_index_policy::NOT_ALLOWED,
+                                 stream,
+                                 mr);
+    return std::pair(std::move(output), std::move(partition_offsets));
+  }
+
   bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
   auto const block_size = use_optimization ? OPTIMIZED_BLOCK_SIZE : FALLBACK_BLOCK_SIZE;
   auto const rows_per_thread =
@@ -595,7 +991,8 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
         input, gather_map.begin(), output_cols, detail::gather_bitmask_op::DONT_CHECK, stream, mr);
     }
 
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
+    // Async D2H copy must finish before returning host vec
+    cudf::detail::synchronize_stream(stream);
     return std::pair(std::make_unique<table>(std::move(output_cols)), std::move(partition_offsets));
   } else {
     // Compute a scatter map from input to output such that the output rows are
@@ -612,11 +1009,307 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
     auto output = detail::scatter(
       input, row_partition_numbers.begin(), row_partition_numbers.end(), input, false, stream, mr);
 
-    stream.synchronize();  // Async D2H copy must finish before returning host vec
+    // Async D2H copy must finish before returning host vec
+    cudf::detail::synchronize_stream(stream);
     return std::pair(std::move(output), std::move(partition_offsets));
   }
 }
 
+/**
+ * @brief Computes the partition of each row of `table_to_hash` and the rows of its partitions.
+ *
+ * @return The gather map from the rows of the partitioned output to the rows of the input, and
+ * the offsets of the partitions in the output followed by the number of rows
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<rmm::device_uvector<size_type>, std::vector<size_type>> hash_partition_gather_map(
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  if (use_radix_partition(num_partitions)) {
+    auto partition_numbers = compute_partition_numbers<hash_function, hash_has_nulls>(
+      table_to_hash, num_partitions, seed, stream);
+    auto result = radix_partition_gather_map(partition_numbers, num_partitions, stream);
+    result.second.push_back(num_rows);
+    return result;
+  }
+
+  auto const block_size = FALLBACK_BLOCK_SIZE;
+  auto const grid_size =
+    util::div_rounding_up_safe(num_rows, block_size * OPTIMIZED_ROWS_PER_THREAD);
+
+  auto row_partition_numbers = rmm::device_uvector<size_type>(num_rows, stream);
+  auto block_partition_sizes = rmm::device_uvector<size_type>(grid_size * num_partitions, stream);
+  auto global_partition_sizes =
+    cudf::detail::make_zeroed_device_uvector_async<size_type>(num_partitions, stream);
+  auto row_partition_offset =
+    cudf::detail::make_zeroed_device_uvector_async<size_type>(num_rows, stream);
+
+  auto const device_input = table_device_view::create(table_to_hash, stream);
+  auto const hasher       = row_hasher<hash_function, nullate::DYNAMIC>(
+    nullate::DYNAMIC{hash_has_nulls}, *device_input, seed);
+
+  auto compute_partition_numbers = [&](auto partitioner) {
+    compute_row_partition_numbers<<<grid_size,
+                                    block_size,
+                                    num_partitions * sizeof(size_type),
+                                    stream.value()>>>(hasher,
+                                                      num_rows,
+                                                      num_partitions,
+                                                      partitioner,
+                                                      row_partition_numbers.data(),
+                                                      row_partition_offset.data(),
+                                                      block_partition_sizes.data(),
+                                                      global_partition_sizes.data());
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(bitwise_partitioner<hash_value_type>(num_partitions));
+  } else {
+    compute_partition_numbers(modulo_partitioner<hash_value_type>(num_partitions));
+  }
+
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         block_partition_sizes.begin(),
+                         block_partition_sizes.end(),
+                         block_partition_sizes.begin());
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         global_partition_sizes.begin(),
+                         global_partition_sizes.end(),
+                         global_partition_sizes.begin());
+  auto partition_offsets = cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+
+  // turn the partition number of each row into its row in the output, in place
+  compute_row_output_locations<<<grid_size,
+                                 block_size,
+                                 num_partitions * sizeof(size_type),
+                                 stream.value()>>>(
+    row_partition_numbers.data(), num_rows, num_partitions, block_partition_sizes.data());
+
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_rows),
+                  row_partition_numbers.begin(),
+                  gather_map.begin());
+
+  cudf::detail::synchronize_stream(stream);  // Async D2H copy must finish before returning host vec
+  partition_offsets.push_back(num_rows);
+  return std::pair(std::move(gather_map), std::move(partition_offsets));
+}
+
+/**
+ * @brief Returns the partition containing the output row or word `idx`, given the offsets of the
+ * partitions followed by the total size
+ */
+__device__ inline size_type partition_of(size_type const* offsets,
+                                         size_type num_partitions,
+                                         size_type idx)
+{
+  return thrust::upper_bound(thrust::seq, offsets + 1, offsets + num_partitions + 1, idx) -
+         (offsets + 1);
+}
+
+/**
+ * @brief Copies the values of a column into its buffer within the packed buffer of each
+ * partition.
+ *
+ * @tparam T An integral type of the size of the elements of the column
+ */
+template <typename T>
+struct pack_partition_values_fn {
+  T const* source;
+  size_type const* gather_map;
+  size_type const* partition_offsets;
+  size_type num_partitions;
+  uint8_t* const* partition_buffers;
+  std::size_t const* data_offsets;
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const partition = partition_of(partition_offsets, num_partitions, idx);
+    auto const output =
+      reinterpret_cast<T*>(partition_buffers[partition] + data_offsets[partition]);
+    output[idx - partition_offsets[partition]] = source[gather_map[idx]];
+  }
+};
+
+/**
+ * @brief Writes the words of the null mask of a column within the packed buffer of each
+ * partition and counts the nulls of each partition.
+ */
+struct pack_partition_mask_fn {
+  bitmask_type const* source;
+  size_type source_offset;
+  size_type const* gather_map;
+  size_type const* partition_offsets;
+  size_type const* word_offsets;
+  size_type num_partitions;
+  uint8_t* const* partition_buffers;
+  std::size_t const* mask_offsets;
+  size_type* null_counts;
+
+  __device__ void operator()(size_type word_idx) const
+  {
+    constexpr auto bits_per_word = static_cast<size_type>(detail::size_in_bits<bitmask_type>());
+    auto const partition         = partition_of(word_offsets, num_partitions, word_idx);
+    auto const word              = word_idx - word_offsets[partition];
+    auto const begin             = partition_offsets[partition] + word * bits_per_word;
+    auto const end = thrust::min(begin + bits_per_word, partition_offsets[partition + 1]);
+
+    bitmask_type bits = 0;
+    for (auto idx = begin; idx < end; ++idx) {
+      if (bit_is_set(source, source_offset + gather_map[idx])) {
+        bits |= bitmask_type{1} << (idx - begin);
+      }
+    }
+    reinterpret_cast<bitmask_type*>(partition_buffers[partition] + mask_offsets[partition])[word] =
+      bits;
+    auto const nulls = (end - begin) - __popc(bits);
+    if (nulls > 0) { atomicAdd(null_counts + partition, nulls); }
+  }
+};
+
+template <typename T>
+void pack_partition_values(column_view const& col,
+                           size_type const* gather_map,
+                           size_type const* partition_offsets,
+                           size_type num_partitions,
+                           uint8_t* const* partition_buffers,
+                           std::size_t const* data_offsets,
+                           rmm::cuda_stream_view stream)
+{
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     col.size(),
+                     pack_partition_values_fn<T>{col.head<T>() + col.offset(),
+                                                 gather_map,
+                                                 partition_offsets,
+                                                 num_partitions,
+                                                 partition_buffers,
+                                                 data_offsets});
+}
+
+/**
+ * @brief Hash partitions a table of fixed-width columns directly into the packed buffers of its
+ * partitions.
+ *
+ * The partition sizes are known once the partition of every row has been computed, so the
+ * layout of each packed partition is computed upfront and every value is copied from the input
+ * straight into its packed buffer. Compared to partitioning the table and then splitting it with
+ * `contiguous_split`, this avoids materializing the partitioned table.
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::vector<packed_columns> hash_partition_and_pack_table(table_view const& input,
+                                                          table_view const& table_to_hash,
+                                                          size_type num_partitions,
+                                                          uint32_t seed,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const partitioned = hash_partition_gather_map<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, seed, stream);
+  auto const& gather_map        = partitioned.first;
+  auto const& partition_offsets = partitioned.second;
+
+  // the packed layout of every partition: each column's values followed by its null mask
+  constexpr std::size_t split_align = 64;
+  auto const num_columns            = input.num_columns();
+  std::vector<std::size_t> data_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> mask_offsets(num_columns * num_partitions);
+  std::vector<size_type> word_offsets(num_partitions + 1, 0);
+  std::vector<rmm::device_buffer> buffers;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const num_rows = partition_offsets[p + 1] - partition_offsets[p];
+    std::size_t size    = 0;
+    for (size_type c = 0; c < num_columns; ++c) {
+      data_offsets[c * num_partitions + p] = size;
+      size += util::round_up_safe(num_rows * size_of(input.column(c).type()), split_align);
+      if (input.column(c).nullable()) {
+        mask_offsets[c * num_partitions + p] = size;
+        size += util::round_up_safe(bitmask_allocation_size_bytes(num_rows), split_align);
+      }
+    }
+    word_offsets[p + 1] = word_offsets[p] + num_bitmask_words(num_rows);
+    buffers.emplace_back(size, stream, mr);
+  }
+
+  std::vector<uint8_t*> buffer_pointers;
+  std::transform(buffers.begin(), buffers.end(), std::back_inserter(buffer_pointers), [](auto& b) {
+    return static_cast<uint8_t*>(b.data());
+  });
+  auto const d_offsets      = cudf::detail::make_device_uvector_async(partition_offsets, stream);
+  auto const d_word_offsets = cudf::detail::make_device_uvector_async(word_offsets, stream);
+  auto const d_buffers      = cudf::detail::make_device_uvector_async(buffer_pointers, stream);
+  auto const d_data_offsets = cudf::detail::make_device_uvector_async(data_offsets, stream);
+  auto const d_mask_offsets = cudf::detail::make_device_uvector_async(mask_offsets, stream);
+  auto d_null_counts =
+    cudf::detail::make_zeroed_device_uvector_async<size_type>(num_columns * num_partitions, stream);
+
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const& col        = input.column(c);
+    auto const column      = static_cast<std::size_t>(c) * num_partitions;
+    auto const pack_values = [&](auto element) {
+      pack_partition_values<decltype(element)>(col,
+                                               gather_map.data(),
+                                               d_offsets.data(),
+                                               num_partitions,
+                                               d_buffers.data(),
+                                               d_data_offsets.data() + column,
+                                               stream);
+    };
+    switch (size_of(col.type())) {
+      case 1: pack_values(int8_t{}); break;
+      case 2: pack_values(int16_t{}); break;
+      case 4: pack_values(int32_t{}); break;
+      case 8: pack_values(int64_t{}); break;
+      case 16: pack_values(__int128_t{}); break;
+      default: CUDF_FAIL("Unsupported element size in hash_partition_and_pack");
+    }
+    if (col.nullable()) {
+      thrust::for_each_n(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         word_offsets.back(),
+                         pack_partition_mask_fn{col.null_mask(),
+                                                col.offset(),
+                                                gather_map.data(),
+                                                d_offsets.data(),
+                                                d_word_offsets.data(),
+                                                num_partitions,
+                                                d_buffers.data(),
+                                                d_mask_offsets.data() + column,
+                                                d_null_counts.data() + column});
+    }
+  }
+  auto const null_counts = cudf::detail::make_std_vector_sync(d_null_counts, stream);
+
+  std::vector<packed_columns> result;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const num_rows = partition_offsets[p + 1] - partition_offsets[p];
+    auto const base     = static_cast<uint8_t const*>(buffers[p].data());
+    std::vector<column_view> columns;
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& col  = input.column(c);
+      auto const index = c * num_partitions + p;
+      auto const valid = num_rows > 0 && col.nullable();
+      columns.emplace_back(
+        col.type(),
+        num_rows,
+        num_rows > 0 ? base + data_offsets[index] : nullptr,
+        valid ? reinterpret_cast<bitmask_type const*>(base + mask_offsets[index]) : nullptr,
+        valid ? null_counts[index] : 0);
+    }
+    auto metadata = std::make_unique<packed_columns::metadata>(
+      pack_metadata(table_view{columns}, base, buffers[p].size()));
+    result.emplace_back(std::move(metadata),
+                        std::make_unique<rmm::device_buffer>(std::move(buffers[p])));
+  }
+  return result;
+}
+
 struct dispatch_map_type {
   /**
    * @brief Partitions the table `t` according to the `partition_map`.
@@ -739,6 +1432,46 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+template <template <typename> class hash_function>
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    std::vector<size_type> const& columns_to_hash,
+                                                    int num_partitions,
+                                                    uint32_t seed,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  // Return empty result if there are no partitions or nothing to hash
+  if (num_partitions <= 0 || input.num_rows() == 0 || table_to_hash.num_columns() == 0) {
+    return {};
+  }
+
+  // Only fixed-width columns can be written straight into their packed buffers. Others are
+  // partitioned into a table which is then split into packed partitions.
+  if (not std::all_of(input.begin(), input.end(), [](auto const& col) {
+        return is_fixed_width(col.type());
+      })) {
+    auto [partitioned, offsets] =
+      hash_partition<hash_function>(input, columns_to_hash, num_partitions, seed, stream, mr);
+    auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+    auto tables       = cudf::detail::contiguous_split(partitioned->view(), splits, stream, mr);
+    std::vector<packed_columns> result;
+    std::transform(tables.begin(), tables.end(), std::back_inserter(result), [](auto& t) {
+      return std::move(t.data);
+    });
+    return result;
+  }
+
+  if (has_nulls(table_to_hash)) {
+    return hash_partition_and_pack_table<hash_function, true>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  } else {
+    return hash_partition_and_pack_table<hash_function, false>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  }
+}
 }  // namespace local
 
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
@@ -788,6 +1521,31 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
+std::vector<packed_columns> hash_partition_and_pack(table_view const& input,
+                                                    std::vector<size_type> const& columns_to_hash,
+                                                    int num_partitions,
+                                                    hash_id hash_function,
+                                                    uint32_t seed,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (const size_type& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::local::hash_partition_and_pack<detail::IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::local::hash_partition_and_pack<detail::MurmurHash3_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in hash_partition_and_pack");
+  }
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/partitioning.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief The number of rows sampled per partition to compute the splitters of a range partition.
+ *
+ * More samples balance the partitions better, at the cost of sorting a larger sample.
+ */
+constexpr size_type samples_per_partition = 32;
+
+}  // namespace
+
+std::unique_ptr<table> range_partition_splitters(table_view const& sample,
+                                                 size_type num_partitions,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.");
+  CUDF_EXPECTS(num_partitions == 1 or sample.num_rows() > 0,
+               "Splitters cannot be computed from an empty sample.");
+
+  auto const sorted = detail::sort(sample, column_order, null_precedence, stream);
+
+  auto const positions = cudf::detail::make_counting_transform_iterator(
+    1, [num_rows = sample.num_rows(), num_partitions] __device__(size_type i) {
+      return static_cast<size_type>(static_cast<int64_t>(i) * num_rows / num_partitions);
+    });
+  return detail::gather(sorted->view(),
+                        positions,
+                        positions + (num_partitions - 1),
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream,
+                        mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const keys = input.select(key_cols);
+  CUDF_EXPECTS(keys.num_columns() == splitters.num_columns(),
+               "Mismatch between number of key columns and splitter columns.");
+  CUDF_EXPECTS(have_same_types(keys, splitters), "Mismatch between key and splitter types.");
+
+  if (input.num_rows() == 0) { return std::pair(empty_like(input), std::vector<size_type>{}); }
+
+  // The partition of a row is the number of splitters ordered before or equal to its keys
+  auto const partition_map = detail::upper_bound(splitters,
+                                                 keys,
+                                                 column_order,
+                                                 null_precedence,
+                                                 stream,
+                                                 rmm::mr::get_current_device_resource());
+  return detail::partition(input, partition_map->view(), splitters.num_rows() + 1, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive.");
+
+  auto const keys = input.select(key_cols);
+  if (input.num_rows() == 0) { return std::pair(empty_like(input), std::vector<size_type>{}); }
+
+  // The splitters are computed from all the keys when there are fewer than the samples
+  auto const num_samples = static_cast<int64_t>(num_partitions) * samples_per_partition;
+  std::unique_ptr<table> sample;
+  if (num_samples < keys.num_rows()) {
+    sample = detail::sample(
+      keys, static_cast<size_type>(num_samples), sample_with_replacement::FALSE, 0, stream);
+  }
+
+  auto const splitters = range_partition_splitters(sample ? sample->view() : keys,
+                                                   num_partitions,
+                                                   column_order,
+                                                   null_precedence,
+                                                   stream,
+                                                   rmm::mr::get_current_device_resource());
+  return range_partition(
+    input, key_cols, splitters->view(), column_order, null_precedence, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> range_partition_splitters(table_view const& sample,
+                                                 size_type num_partitions,
+                                                 std::vector<order> const& column_order,
+                                                 std::vector<null_order> const& null_precedence,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition_splitters(
+    sample, num_partitions, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  table_view const& splitters,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, key_cols, splitters, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_cols,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, key_cols, num_partitions, column_order, null_precedence, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
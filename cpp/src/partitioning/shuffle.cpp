@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <algorithm>
+#include <future>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Sends the outgoing tables and checks that one table was received from every rank.
+ */
+std::vector<packed_columns> exchange_checked(shuffle_transport& transport,
+                                             std::vector<packed_columns>&& outgoing,
+                                             rmm::cuda_stream_view stream)
+{
+  auto const num_ranks = transport.num_ranks();
+  auto incoming        = transport.exchange(std::move(outgoing), stream);
+  CUDF_EXPECTS(incoming.size() == static_cast<std::size_t>(num_ranks),
+               "Shuffle transport must return one table per rank");
+  return incoming;
+}
+
+/**
+ * @brief Returns the largest number of chunks of all ranks.
+ *
+ * Every rank sends its own number of chunks as a one-row table to every other rank.
+ */
+size_type exchange_num_chunks(shuffle_transport& transport,
+                              size_type num_chunks,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const rank      = transport.rank();
+  auto const num_ranks = transport.num_ranks();
+
+  auto const count = make_column_from_scalar(
+    numeric_scalar<size_type>(num_chunks, true, stream), 1, stream, mr);
+  std::vector<packed_columns> outgoing(num_ranks);
+  for (int r = 0; r < num_ranks; ++r) {
+    if (r != rank) { outgoing[r] = detail::pack(table_view{{count->view()}}, stream, mr); }
+  }
+  stream.synchronize();
+
+  auto const incoming = exchange_checked(transport, std::move(outgoing), stream);
+  auto max_num_chunks = num_chunks;
+  for (int r = 0; r < num_ranks; ++r) {
+    if (r == rank) { continue; }
+    auto const received = unpack(incoming[r]).column(0);
+    auto const h_count  = detail::make_std_vector_sync(
+      device_span<size_type const>{received.data<size_type>(), 1}, stream);
+    max_num_chunks = std::max(max_num_chunks, h_count.front());
+  }
+  return max_num_chunks;
+}
+
+}  // namespace
+
+callback_shuffle_transport::callback_shuffle_transport(int rank,
+                                                       int num_ranks,
+                                                       exchange_function exchange)
+  : _rank{rank}, _num_ranks{num_ranks}, _exchange{std::move(exchange)}
+{
+  CUDF_EXPECTS(rank >= 0 && rank < num_ranks, "Invalid rank of shuffle transport");
+}
+
+std::unique_ptr<table> hash_shuffle(table_view const& input,
+                                    std::vector<size_type> const& columns_to_hash,
+                                    shuffle_transport& transport,
+                                    size_type chunk_rows,
+                                    hash_id hash_function,
+                                    uint32_t seed,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(chunk_rows > 0, "Shuffle chunk size must be positive");
+  // Throws std::out_of_range for an invalid index, even on ranks without any row to hash
+  [[maybe_unused]] auto const keys = input.select(columns_to_hash);
+
+  auto const rank      = transport.rank();
+  auto const num_ranks = transport.num_ranks();
+  if (num_ranks == 1) { return std::make_unique<table>(input, stream, mr); }
+
+  auto const num_chunks    = util::div_rounding_up_safe(input.num_rows(), chunk_rows);
+  auto const num_exchanges = exchange_num_chunks(transport, num_chunks, stream, mr);
+
+  // Partitions the chunk, or packs an empty partition per rank once the input is exhausted
+  auto const partition_chunk = [&](size_type chunk) {
+    auto const begin = static_cast<size_type>(
+      std::min(static_cast<int64_t>(chunk) * chunk_rows, static_cast<int64_t>(input.num_rows())));
+    auto const end = static_cast<size_type>(
+      std::min(static_cast<int64_t>(begin) + chunk_rows, static_cast<int64_t>(input.num_rows())));
+    auto const rows = detail::slice(input, {begin, end}, stream).front();
+    if (rows.num_rows() > 0) {
+      return hash_partition_and_pack(
+        rows, columns_to_hash, num_ranks, hash_function, seed, stream, mr);
+    }
+    std::vector<packed_columns> partitions;
+    partitions.reserve(num_ranks);
+    for (int r = 0; r < num_ranks; ++r) {
+      partitions.push_back(detail::pack(rows, stream, mr));
+    }
+    return partitions;
+  };
+
+  // The exchanges run on their own thread and stream, while the next chunk is partitioned
+  rmm::cuda_stream exchange_stream;
+  std::future<std::vector<packed_columns>> in_flight;
+  std::vector<std::vector<packed_columns>> received(num_ranks);
+  auto const collect = [&]() {
+    auto incoming = in_flight.get();
+    exchange_stream.synchronize();
+    for (int r = 0; r < num_ranks; ++r) {
+      if (r != rank) { received[r].push_back(std::move(incoming[r])); }
+    }
+  };
+
+  for (size_type chunk = 0; chunk < num_exchanges; ++chunk) {
+    auto outgoing = partition_chunk(chunk);
+    received[rank].push_back(std::exchange(outgoing[rank], packed_columns{}));
+    stream.synchronize();
+
+    if (in_flight.valid()) { collect(); }
+    in_flight = std::async(
+      std::launch::async,
+      [&transport, stream = exchange_stream.view()](std::vector<packed_columns>&& outgoing) {
+        return exchange_checked(transport, std::move(outgoing), stream);
+      },
+      std::move(outgoing));
+  }
+  if (in_flight.valid()) { collect(); }
+
+  std::vector<table_view> views;
+  for (auto const& from_rank : received) {
+    for (auto const& partition : from_rank) {
+      auto const view = unpack(partition);
+      if (view.num_rows() > 0) { views.push_back(view); }
+    }
+  }
+  if (views.empty()) { return empty_like(input); }
+  return detail::concatenate(views, stream, mr);
+}
+
+}  // namespace cudf
@@ -18,8 +18,10 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
@@ -34,11 +36,14 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -179,6 +184,51 @@ std::unique_ptr<column> quantile(column_view const& input,
   }
 }
 
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  auto const num_valid = input.size() - input.null_count();
+  if (num_valid == 0) {
+    // the quantiles of an empty column are nulls of the output type
+    auto const empty = empty_like(input);
+    return quantile(empty->view(), q, interp, {}, exact, stream, mr);
+  }
+
+  // the positions within the sorted valid values that any interpolation may read
+  std::vector<size_type> positions;
+  positions.reserve(3 * q.size());
+  for (auto const value : q) {
+    quantile_index const idx(num_valid, value);
+    positions.insert(positions.end(), {idx.lower, idx.higher, idx.nearest});
+  }
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+  auto const rows        = select_sorted_positions(input, positions, stream);
+  auto const d_positions = make_device_uvector_async(positions, stream);
+
+  // maps each of those positions to its row, as a sort map would
+  auto const ordered_indices = cudf::detail::make_counting_transform_iterator(
+    0,
+    [positions     = d_positions.data(),
+     num_positions = static_cast<size_type>(d_positions.size()),
+     rows          = rows.data()] __device__(size_type position) {
+      auto const it =
+        thrust::lower_bound(thrust::seq, positions, positions + num_positions, position);
+      return rows[thrust::distance(positions, it)];
+    });
+
+  if (exact) {
+    return quantile<true>(input, ordered_indices, num_valid, q, interp, exact, stream, mr);
+  } else {
+    return quantile<false>(input, ordered_indices, num_valid, q, interp, exact, stream, mr);
+  }
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> quantile(column_view const& input,
@@ -192,4 +242,14 @@ std::unique_ptr<column> quantile(column_view const& input,
   return detail::quantile(input, q, interp, ordered_indices, exact, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantile_unsorted(input, q, interp, exact, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/quantiles.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// number of rows sampled to bracket the requested positions
+constexpr size_type selection_sample_size = 1 << 18;
+// inputs with fewer valid rows than this are sorted directly
+constexpr size_type min_selection_size = 16 * selection_sample_size;
+// upper bound on the number of key ranges, each of which takes a counter in shared memory
+constexpr size_type max_selection_ranges = 1024;
+constexpr size_type histogram_block_size = 256;
+constexpr size_type max_histogram_blocks = 4096;
+
+/**
+ * @brief Maps a value to an unsigned integer key that orders like the value.
+ *
+ * NaNs map to the largest key so that they sort after every other value, and -0.0 maps to the
+ * key of 0.0.
+ */
+template <typename Key, typename Rep>
+__device__ Key to_order_key(Rep value)
+{
+  if constexpr (std::is_floating_point_v<Rep>) {
+    using Bits = std::conditional_t<sizeof(Rep) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr Bits sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+    if (isnan(value)) { return std::numeric_limits<Key>::max(); }
+    if (value == Rep{0}) { value = Rep{0}; }
+    Bits bits;
+    memcpy(&bits, &value, sizeof(Rep));
+    return static_cast<Key>((bits & sign_bit) ? ~bits : (bits | sign_bit));
+  } else if constexpr (std::is_signed_v<Rep>) {
+    using Bits              = std::make_unsigned_t<Rep>;
+    constexpr Bits sign_bit = Bits{1} << (sizeof(Bits) * 8 - 1);
+    return static_cast<Key>(static_cast<Bits>(value) ^ sign_bit);
+  } else {
+    return static_cast<Key>(value);
+  }
+}
+
+// integer type holding the values of a column of type `T`
+template <typename T, typename Enable = void>
+struct order_rep {
+  using type = device_storage_type_t<T>;
+};
+
+template <typename T>
+struct order_rep<T, std::enable_if_t<cudf::is_chrono<T>()>> {
+  using type = typename T::rep;
+};
+
+template <typename Rep, typename Key>
+struct order_key_fn {
+  column_device_view input;
+
+  __device__ Key operator()(size_type row) const
+  {
+    return to_order_key<Key>(input.data<Rep>()[row]);
+  }
+};
+
+/**
+ * @brief Returns the bucket of a key among a sorted set of disjoint key ranges.
+ *
+ * Bucket `2 * j + 1` holds the keys within range `j` and bucket `2 * j` the keys between range
+ * `j - 1` and range `j`, so there are `2 * num_ranges + 1` buckets.
+ */
+template <typename Key>
+struct range_bucket_fn {
+  Key const* lows;
+  Key const* highs;
+  size_type num_ranges;
+
+  __device__ size_type operator()(Key key) const
+  {
+    auto const it = thrust::upper_bound(thrust::seq, lows, lows + num_ranges, key);
+    auto const j  = static_cast<size_type>(thrust::distance(lows, it)) - 1;
+    return (j >= 0 && key <= highs[j]) ? 2 * j + 1 : 2 * (j + 1);
+  }
+};
+
+/**
+ * @brief Counts the valid rows of `input` in each bucket of `bucket_fn`.
+ *
+ * Each block accumulates its counts in shared memory before adding them to `histogram`.
+ */
+template <typename KeyFn, typename BucketFn>
+__global__ void range_histogram_kernel(column_device_view input,
+                                       KeyFn key_fn,
+                                       BucketFn bucket_fn,
+                                       size_type num_buckets,
+                                       size_type* histogram)
+{
+  extern __shared__ size_type block_histogram[];
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_buckets; i += blockDim.x) {
+    block_histogram[i] = 0;
+  }
+  __syncthreads();
+
+  auto const stride = static_cast<size_type>(blockDim.x * gridDim.x);
+  for (auto row = static_cast<size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+       row < input.size();
+       row += stride) {
+    if (input.is_valid(row)) { atomicAdd(block_histogram + bucket_fn(key_fn(row)), 1); }
+  }
+  __syncthreads();
+
+  for (auto i = static_cast<size_type>(threadIdx.x); i < num_buckets; i += blockDim.x) {
+    if (block_histogram[i] != 0) { atomicAdd(histogram + i, block_histogram[i]); }
+  }
+}
+
+// whether the values of type `T` can be ordered through a 32 or 64-bit key
+template <typename T>
+constexpr bool is_key_orderable()
+{
+  return (cudf::is_numeric<T>() || cudf::is_chrono<T>() || cudf::is_fixed_point<T>()) &&
+         sizeof(device_storage_type_t<T>) <= sizeof(uint64_t);
+}
+
+struct select_positions_fn {
+  template <typename T, std::enable_if_t<is_key_orderable<T>()>* = nullptr>
+  rmm::device_uvector<size_type> operator()(column_view const& input,
+                                            std::vector<size_type> const& positions,
+                                            rmm::cuda_stream_view stream)
+  {
+    using Rep = typename order_rep<T>::type;
+    using Key = std::conditional_t<sizeof(Rep) <= sizeof(uint32_t), uint32_t, uint64_t>;
+
+    auto const num_valid = input.size() - input.null_count();
+    auto const d_input   = column_device_view::create(input, stream);
+    auto const key_fn    = order_key_fn<Rep, Key>{*d_input};
+
+    if (num_valid >= min_selection_size &&
+        static_cast<size_type>(positions.size()) <= max_selection_ranges) {
+      auto [lows, highs] = bracket_positions<Key>(input, *d_input, key_fn, positions, stream);
+      auto result        = select_in_ranges(*d_input, key_fn, positions, lows, highs, stream);
+      if (result.has_value()) { return std::move(result.value()); }
+    }
+
+    // a single range holding every key always contains the requested positions
+    return select_in_ranges(*d_input,
+                            key_fn,
+                            positions,
+                            std::vector<Key>{std::numeric_limits<Key>::lowest()},
+                            std::vector<Key>{std::numeric_limits<Key>::max()},
+                            stream)
+      .value();
+  }
+
+  template <typename T, std::enable_if_t<not is_key_orderable<T>()>* = nullptr>
+  rmm::device_uvector<size_type> operator()(column_view const& input,
+                                            std::vector<size_type> const& positions,
+                                            rmm::cuda_stream_view stream)
+  {
+    // fall back to sorting the whole column, with the nulls after the valid values
+    auto const sorted =
+      sorted_order(table_view{{input}}, {order::ASCENDING}, {null_order::AFTER}, stream);
+    auto const d_positions = make_device_uvector_async(positions, stream);
+    rmm::device_uvector<size_type> result(positions.size(), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   d_positions.begin(),
+                   d_positions.end(),
+                   sorted->view().begin<size_type>(),
+                   result.begin());
+    return result;
+  }
+
+  /**
+   * @brief Brackets each requested position with a range of keys drawn from a sorted sample.
+   *
+   * Overlapping ranges are merged, so the returned ranges are sorted and disjoint.
+   */
+  template <typename Key, typename KeyFn>
+  static std::pair<std::vector<Key>, std::vector<Key>> bracket_positions(
+    column_view const& input,
+    column_device_view const& d_input,
+    KeyFn key_fn,
+    std::vector<size_type> const& positions,
+    rmm::cuda_stream_view stream)
+  {
+    auto const num_rows  = input.size();
+    auto const num_valid = num_rows - input.null_count();
+
+    // sample evenly spaced rows, dropping the nulls
+    auto const sample_rows = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0), [num_rows] __device__(size_type i) {
+        return static_cast<size_type>(static_cast<int64_t>(i) * num_rows / selection_sample_size);
+      });
+    rmm::device_uvector<size_type> sample(selection_sample_size, stream);
+    auto const sample_end =
+      thrust::copy_if(rmm::exec_policy(stream),
+                      sample_rows,
+                      sample_rows + selection_sample_size,
+                      sample.begin(),
+                      [d_input] __device__(size_type row) { return d_input.is_valid(row); });
+    auto const sample_size = static_cast<size_type>(thrust::distance(sample.begin(), sample_end));
+
+    rmm::device_uvector<Key> sample_keys(sample_size, stream);
+    thrust::transform(
+      rmm::exec_policy(stream), sample.begin(), sample_end, sample_keys.begin(), key_fn);
+    thrust::sort(rmm::exec_policy(stream), sample_keys.begin(), sample_keys.end());
+    auto const h_sample = make_std_vector_sync(sample_keys, stream);
+
+    // the rank of a position within the sample is off by a few standard deviations at most,
+    // which is at most half the square root of the sample size
+    auto const margin =
+      2 * static_cast<size_type>(std::sqrt(static_cast<double>(sample_size))) + 1;
+
+    std::vector<Key> lows;
+    std::vector<Key> highs;
+    for (auto const position : positions) {
+      auto const rank =
+        static_cast<size_type>(static_cast<double>(position) * sample_size / num_valid);
+      auto const low  = rank - margin < 0 ? std::numeric_limits<Key>::lowest()
+                                          : h_sample[rank - margin];
+      auto const high = rank + margin >= sample_size ? std::numeric_limits<Key>::max()
+                                                     : h_sample[rank + margin];
+      if (!lows.empty() && low <= highs.back()) {
+        highs.back() = std::max(highs.back(), high);
+      } else {
+        lows.push_back(low);
+        highs.push_back(high);
+      }
+    }
+    return {std::move(lows), std::move(highs)};
+  }
+
+  /**
+   * @brief Finds the rows at `positions` by sorting only the rows whose keys are in the ranges.
+   *
+   * @return The rows, or an empty optional if a range does not hold the position it brackets
+   */
+  template <typename Key, typename KeyFn>
+  static std::optional<rmm::device_uvector<size_type>> select_in_ranges(
+    column_device_view const& d_input,
+    KeyFn key_fn,
+    std::vector<size_type> const& positions,
+    std::vector<Key> const& lows,
+    std::vector<Key> const& highs,
+    rmm::cuda_stream_view stream)
+  {
+    auto const num_ranges  = static_cast<size_type>(lows.size());
+    auto const num_buckets = 2 * num_ranges + 1;
+    auto const d_lows      = make_device_uvector_async(lows, stream);
+    auto const d_highs     = make_device_uvector_async(highs, stream);
+    auto const bucket_fn   = range_bucket_fn<Key>{d_lows.data(), d_highs.data(), num_ranges};
+
+    // count the keys in and between the ranges
+    auto histogram = make_zeroed_device_uvector_async<size_type>(num_buckets, stream);
+    grid_1d const config(d_input.size(), histogram_block_size);
+    range_histogram_kernel<<<std::min(config.num_blocks, max_histogram_blocks),
+                             config.num_threads_per_block,
+                             num_buckets * sizeof(size_type),
+                             stream.value()>>>(
+      d_input, key_fn, bucket_fn, num_buckets, histogram.data());
+    auto const h_histogram = make_std_vector_sync(histogram, stream);
+
+    // number of keys before each range and offset of each range within the candidates
+    std::vector<size_type> keys_before(num_ranges);
+    std::vector<size_type> candidate_offsets(num_ranges);
+    size_type total_before     = 0;
+    size_type total_candidates = 0;
+    for (size_type j = 0; j < num_ranges; ++j) {
+      total_before += h_histogram[2 * j];
+      keys_before[j]       = total_before;
+      candidate_offsets[j] = total_candidates;
+      total_before += h_histogram[2 * j + 1];
+      total_candidates += h_histogram[2 * j + 1];
+    }
+
+    // each position must fall within the range that brackets it
+    std::vector<size_type> candidate_indices;
+    candidate_indices.reserve(positions.size());
+    for (auto const position : positions) {
+      auto const it = std::upper_bound(keys_before.begin(), keys_before.end(), position);
+      if (it == keys_before.begin()) { return std::nullopt; }
+      auto const j = static_cast<size_type>(std::distance(keys_before.begin(), it)) - 1;
+      if (position >= keys_before[j] + h_histogram[2 * j + 1]) { return std::nullopt; }
+      candidate_indices.push_back(candidate_offsets[j] + position - keys_before[j]);
+    }
+
+    // gather and sort the candidates; the ranges are disjoint so one sort orders them all
+    rmm::device_uvector<size_type> candidates(total_candidates, stream);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(d_input.size()),
+                    candidates.begin(),
+                    [d_input, key_fn, bucket_fn] __device__(size_type row) {
+                      return d_input.is_valid(row) && (bucket_fn(key_fn(row)) % 2 == 1);
+                    });
+    rmm::device_uvector<Key> candidate_keys(total_candidates, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      candidates.begin(),
+                      candidates.end(),
+                      candidate_keys.begin(),
+                      key_fn);
+    thrust::sort_by_key(
+      rmm::exec_policy(stream), candidate_keys.begin(), candidate_keys.end(), candidates.begin());
+
+    auto const d_candidate_indices = make_device_uvector_async(candidate_indices, stream);
+    rmm::device_uvector<size_type> result(positions.size(), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   d_candidate_indices.begin(),
+                   d_candidate_indices.end(),
+                   candidates.begin(),
+                   result.begin());
+    return result;
+  }
+};
+
+}  // namespace
+
+rmm::device_uvector<size_type> select_sorted_positions(column_view const& input,
+                                                       std::vector<size_type> const& positions,
+                                                       rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(std::is_sorted(positions.begin(), positions.end()),
+               "positions must be sorted in ascending order");
+  CUDF_EXPECTS(positions.empty() || (positions.front() >= 0 &&
+                                     positions.back() < input.size() - input.null_count()),
+               "positions must be within the valid rows of the input");
+  if (positions.empty()) { return rmm::device_uvector<size_type>(0, stream); }
+
+  return type_dispatcher(input.type(), select_positions_fn{}, input, positions, stream);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -16,9 +16,12 @@
 
 #include <quantiles/quantiles_util.hpp>
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/quantiles.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table_view.hpp>
@@ -27,10 +30,16 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -61,7 +70,86 @@ std::unique_ptr<table> quantiles(table_view const& input,
                         mr);
 }
 
-}  // namespace detail
+/**
+ * @brief Returns the rows of a single unsorted column at the requested quantiles, finding them by
+ * selection instead of sorting the column.
+ */
+std::unique_ptr<table> select_quantiles(table_view const& input,
+                                        std::vector<double> const& q,
+                                        interpolation interp,
+                                        order column_order,
+                                        null_order null_precedence,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const col       = input.column(0);
+  auto const num_rows  = col.size();
+  auto const num_nulls = col.null_count();
+  auto const num_valid = num_rows - num_nulls;
+  auto const ascending = column_order == order::ASCENDING;
+  // null_order::BEFORE orders the nulls as smaller than every value
+  auto const nulls_first = ascending == (null_precedence == null_order::BEFORE);
+
+  // the positions within the sorted order that the quantiles read
+  std::vector<size_type> positions;
+  positions.reserve(q.size());
+  std::transform(q.begin(), q.end(), std::back_inserter(positions), [&](double value) {
+    return select_quantile<size_type>([](size_type i) { return i; }, num_rows, value, interp);
+  });
+  std::sort(positions.begin(), positions.end());
+  positions.erase(std::unique(positions.begin(), positions.end()), positions.end());
+
+  // the rank among the ascending valid values of each position that is not a null
+  auto const valid_rank = [&](size_type position) {
+    auto const rank = nulls_first ? position - num_nulls : position;
+    if (rank < 0 || rank >= num_valid) { return size_type{-1}; }
+    return ascending ? rank : num_valid - 1 - rank;
+  };
+  std::vector<size_type> valid_ranks;
+  for (auto const position : positions) {
+    if (auto const rank = valid_rank(position); rank >= 0) { valid_ranks.push_back(rank); }
+  }
+  std::sort(valid_ranks.begin(), valid_ranks.end());
+  auto const valid_rows   = select_sorted_positions(col, valid_ranks, stream);
+  auto const h_valid_rows = make_std_vector_sync(valid_rows, stream);
+
+  // any null row stands for every position taken by the nulls
+  auto const null_row = [&] {
+    if (num_nulls == 0) { return size_type{0}; }
+    auto const d_col = column_device_view::create(col, stream);
+    auto const it    = thrust::find_if(rmm::exec_policy(stream),
+                                    thrust::make_counting_iterator<size_type>(0),
+                                    thrust::make_counting_iterator<size_type>(num_rows),
+                                    [d_col = *d_col] __device__(size_type row) {
+                                      return d_col.is_null(row);
+                                    });
+    return *it;
+  }();
+
+  std::vector<size_type> rows;
+  rows.reserve(positions.size());
+  std::transform(positions.begin(), positions.end(), std::back_inserter(rows), [&](auto position) {
+    auto const rank = valid_rank(position);
+    if (rank < 0) { return null_row; }
+    auto const it = std::lower_bound(valid_ranks.begin(), valid_ranks.end(), rank);
+    return h_valid_rows[std::distance(valid_ranks.begin(), it)];
+  });
+
+  auto const d_positions = make_device_uvector_async(positions, stream);
+  auto const d_rows      = make_device_uvector_async(rows, stream);
+
+  // maps each of those positions to its row, as a sort map would
+  auto const sortmap = cudf::detail::make_counting_transform_iterator(
+    0,
+    [positions     = d_positions.data(),
+     num_positions = static_cast<size_type>(d_positions.size()),
+     rows          = d_rows.data()] __device__(size_type position) {
+      auto const it =
+        thrust::lower_bound(thrust::seq, positions, positions + num_positions, position);
+      return rows[thrust::distance(positions, it)];
+    });
+  return quantiles(input, sortmap, q, interp, stream, mr);
+}
 
 std::unique_ptr<table> quantiles(table_view const& input,
                                  std::vector<double> const& q,
@@ -69,9 +157,9 @@ std::unique_ptr<table> quantiles(table_view const& input,
                                  cudf::sorted is_input_sorted,
                                  std::vector<order> const& column_order,
                                  std::vector<null_order> const& null_precedence,
+                                 rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  CUDF_FUNC_RANGE();
   if (q.empty()) { return empty_like(input); }
 
   CUDF_EXPECTS(interp == interpolation::HIGHER || interp == interpolation::LOWER ||
@@ -81,17 +169,42 @@ std::unique_ptr<table> quantiles(table_view const& input,
   CUDF_EXPECTS(input.num_rows() > 0, "multi-column quantiles require at least one input row.");
 
   if (is_input_sorted == sorted::YES) {
-    return detail::quantiles(input,
-                             thrust::make_counting_iterator<size_type>(0),
-                             q,
-                             interp,
-                             cudf::default_stream_value,
-                             mr);
+    return detail::quantiles(
+      input, thrust::make_counting_iterator<size_type>(0), q, interp, stream, mr);
+  } else if (input.num_columns() == 1) {
+    return select_quantiles(input,
+                            q,
+                            interp,
+                            column_order.empty() ? order::ASCENDING : column_order.front(),
+                            null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+                            stream,
+                            mr);
   } else {
-    auto sorted_idx = detail::sorted_order(input, column_order, null_precedence);
+    auto sorted_idx = detail::sorted_order(input, column_order, null_precedence, stream);
     return detail::quantiles(
-      input, sorted_idx->view().data<size_type>(), q, interp, cudf::default_stream_value, mr);
+      input, sorted_idx->view().data<size_type>(), q, interp, stream, mr);
   }
 }
 
+}  // namespace detail
+
+std::unique_ptr<table> quantiles(table_view const& input,
+                                 std::vector<double> const& q,
+                                 interpolation interp,
+                                 cudf::sorted is_input_sorted,
+                                 std::vector<order> const& column_order,
+                                 std::vector<null_order> const& null_precedence,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::quantiles(input,
+                           q,
+                           interp,
+                           is_input_sorted,
+                           column_order,
+                           null_precedence,
+                           cudf::default_stream_value,
+                           mr);
+}
+
 }  // namespace cudf
@@ -16,6 +16,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
@@ -409,4 +410,14 @@ std::unique_ptr<column> percentile_approx(tdigest_column_view const& input,
   return percentile_approx(input, percentiles, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<column> update_tdigest(tdigest_column_view const& input,
+                                       column_view const& values,
+                                       int max_centroids,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tdigest::update_tdigest(
+    input, values, max_centroids, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
@@ -19,12 +19,14 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/merge.cuh>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/tdigest/tdigest_column_view.cuh>
 #include <cudf/utilities/span.hpp>
@@ -884,7 +886,7 @@ struct typed_reduce_tdigest {
   template <
     typename T,
     typename std::enable_if_t<cudf::is_numeric<T>() || cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(column_view const& col,
+  std::unique_ptr<column> operator()(column_view const& col,
                                      int delta,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
@@ -935,28 +937,26 @@ struct typed_reduce_tdigest {
     auto scalar_to_centroid =
       cudf::detail::make_counting_transform_iterator(0, make_centroid_no_nulls<T>{*d_col});
 
-    // generate the final tdigest and wrap it in a struct_scalar
-    return to_tdigest_scalar(compute_tdigests(delta,
-                                              scalar_to_centroid,
-                                              scalar_to_centroid + valid_count,
-                                              cumulative_scalar_weight{},
-                                              std::move(min_col),
-                                              std::move(max_col),
-                                              cluster_wl,
-                                              std::move(cluster_offsets),
-                                              total_clusters,
-                                              false,
-                                              stream,
-                                              mr),
-                             stream,
-                             mr);
+    // generate the final tdigest
+    return compute_tdigests(delta,
+                            scalar_to_centroid,
+                            scalar_to_centroid + valid_count,
+                            cumulative_scalar_weight{},
+                            std::move(min_col),
+                            std::move(max_col),
+                            cluster_wl,
+                            std::move(cluster_offsets),
+                            total_clusters,
+                            false,
+                            stream,
+                            mr);
   }
 
   template <
     typename T,
     typename... Args,
     typename std::enable_if_t<!cudf::is_numeric<T>() && !cudf::is_fixed_point<T>()>* = nullptr>
-  std::unique_ptr<scalar> operator()(Args&&...)
+  std::unique_ptr<column> operator()(Args&&...)
   {
     CUDF_FAIL("Non-numeric type in group_tdigest");
   }
@@ -1026,7 +1026,7 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
                   cudaMemcpyDeviceToHost,
                   stream);
 
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   // extract all means and weights into a table
   cudf::table_view tdigests_unsliced({tdv.means(), tdv.weights()});
@@ -1183,14 +1183,13 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
     mr);
 }
 
-}  // anonymous namespace
-
-std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
-                                       int max_centroids,
-                                       rmm::cuda_stream_view stream,
-                                       rmm::mr::device_memory_resource* mr)
+// generates a single-row tdigest column from a set of unsorted values.
+std::unique_ptr<column> reduce_to_tdigest_column(column_view const& col,
+                                                 int max_centroids,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
 {
-  if (col.size() == 0) { return cudf::detail::tdigest::make_empty_tdigest_scalar(stream, mr); }
+  if (col.size() == 0) { return cudf::detail::tdigest::make_empty_tdigest_column(stream, mr); }
 
   // since this isn't coming out of a groupby, we need to sort the inputs in ascending
   // order with nulls at the end.
@@ -1202,6 +1201,54 @@ std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
     col.type(), typed_reduce_tdigest{}, sorted->get_column(0), delta, stream, mr);
 }
 
+// merges row `i` of `digests` with row `i` of `batch` for every row.
+std::unique_ptr<column> merge_tdigest_pairs(column_view const& digests,
+                                            column_view const& batch,
+                                            int max_centroids,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = digests.size();
+
+  // interleave the two columns so that the digests to merge are adjacent, which makes each pair
+  // a group of the merge
+  auto const stacked = cudf::detail::concatenate(std::vector<column_view>{digests, batch}, stream);
+  auto const interleave_map = cudf::detail::make_counting_transform_iterator(
+    0, [num_rows] __device__(size_type i) { return (i % 2 == 0 ? 0 : num_rows) + i / 2; });
+  auto const interleaved = cudf::detail::gather(table_view{{stacked->view()}},
+                                                interleave_map,
+                                                interleave_map + 2 * num_rows,
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                stream);
+
+  auto h_group_offsets = cudf::detail::make_counting_transform_iterator(
+    0, [](size_type i) { return 2 * i; });
+  auto group_offsets = cudf::detail::make_counting_transform_iterator(
+    0, [] __device__(size_type i) { return 2 * i; });
+  auto group_labels = cudf::detail::make_counting_transform_iterator(
+    0, [] __device__(size_type i) { return i / 2; });
+  return merge_tdigests(tdigest_column_view(interleaved->get_column(0)),
+                        h_group_offsets,
+                        group_offsets,
+                        group_labels,
+                        2 * num_rows,
+                        num_rows,
+                        max_centroids,
+                        stream,
+                        mr);
+}
+
+}  // anonymous namespace
+
+std::unique_ptr<scalar> reduce_tdigest(column_view const& col,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  if (col.size() == 0) { return cudf::detail::tdigest::make_empty_tdigest_scalar(stream, mr); }
+  return to_tdigest_scalar(reduce_to_tdigest_column(col, max_centroids, stream, mr), stream, mr);
+}
+
 std::unique_ptr<scalar> reduce_merge_tdigest(column_view const& input,
                                              int max_centroids,
                                              rmm::cuda_stream_view stream,
@@ -1286,6 +1333,48 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& input,
                         mr);
 }
 
+std::unique_ptr<column> update_tdigest(tdigest_column_view const& input,
+                                       column_view const& values,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(input.size() == 1, "update_tdigest expects a single tdigest");
+  if (values.size() == 0) { return std::make_unique<column>(input.parent(), stream, mr); }
+
+  // only the new values are sorted; the existing digest already summarizes the previous ones
+  auto const batch = reduce_to_tdigest_column(
+    values, max_centroids, stream, rmm::mr::get_current_device_resource());
+  return merge_tdigest_pairs(input.parent(), batch->view(), max_centroids, stream, mr);
+}
+
+std::unique_ptr<column> group_update_tdigest(column_view const& input,
+                                             column_view const& values,
+                                             cudf::device_span<size_type const> group_offsets,
+                                             cudf::device_span<size_type const> group_labels,
+                                             cudf::device_span<size_type const> group_valid_counts,
+                                             size_type num_groups,
+                                             int max_centroids,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  tdigest_column_view tdv(input);
+  CUDF_EXPECTS(input.size() == num_groups, "Expected one tdigest per group");
+  if (num_groups == 0 || values.size() == 0) {
+    return std::make_unique<column>(input, stream, mr);
+  }
+
+  auto const batch = group_tdigest(values,
+                                   group_offsets,
+                                   group_labels,
+                                   group_valid_counts,
+                                   num_groups,
+                                   max_centroids,
+                                   stream,
+                                   rmm::mr::get_current_device_resource());
+  return merge_tdigest_pairs(input, batch->view(), max_centroids, stream, mr);
+}
+
 }  // namespace tdigest
 }  // namespace detail
 }  // namespace cudf
@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/reduction.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace reduction {
+namespace compound {
+namespace detail {
+/**
+ * @brief Multi-step segmented reduction for operations such as mean, variance, and standard
+ * deviation.
+ *
+ * The intermediate value of every segment (e.g. the sum, or the sum and sum of squares) and the
+ * number of valid elements of every segment are computed with one segmented reduction each. The
+ * result of a segment is then finalized from both values.
+ *
+ * A segment result is null if the segment has no more than `ddof` valid elements, or if
+ * `null_handling` is `null_policy::INCLUDE` and any element of the segment is null.
+ *
+ * @tparam ElementType  the input column data-type
+ * @tparam ResultType   the output data-type
+ * @tparam Op           the compound operator derived from `cudf::reduction::op::compound_op`
+ *
+ * @param col Input column of data to reduce
+ * @param offsets Indices to segment boundaries
+ * @param null_handling If `null_policy::INCLUDE`, all elements in a segment must be valid for the
+ * reduced value to be valid. If `null_policy::EXCLUDE`, null elements are skipped.
+ * @param ddof Delta degrees of freedom used for standard deviation and variance. The divisor used
+ * is N - ddof, where N represents the number of valid elements of the segment.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column in device memory
+ */
+template <typename ElementType, typename ResultType, typename Op>
+std::unique_ptr<column> compound_segmented_reduction(column_view const& col,
+                                                     device_span<size_type const> offsets,
+                                                     null_policy null_handling,
+                                                     size_type ddof,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  using IntermediateType  = typename Op::template intermediate<ResultType>::IntermediateType;
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+  auto dcol               = cudf::column_device_view::create(col, stream);
+  Op compound_op{};
+
+  rmm::device_uvector<IntermediateType> intermediates(num_segments, stream);
+  auto const identity = compound_op.template get_identity<IntermediateType>();
+  if (col.has_nulls()) {
+    auto it = thrust::make_transform_iterator(
+      dcol->pair_begin<ElementType, true>(),
+      compound_op.template get_null_replacing_element_transformer<ResultType>());
+    cudf::reduction::detail::segmented_reduce(it,
+                                              offsets.begin(),
+                                              offsets.end(),
+                                              intermediates.begin(),
+                                              compound_op.get_binary_op(),
+                                              identity,
+                                              stream);
+  } else {
+    auto it = thrust::make_transform_iterator(
+      dcol->begin<ElementType>(), compound_op.template get_element_transformer<ResultType>());
+    cudf::reduction::detail::segmented_reduce(it,
+                                              offsets.begin(),
+                                              offsets.end(),
+                                              intermediates.begin(),
+                                              compound_op.get_binary_op(),
+                                              identity,
+                                              stream);
+  }
+
+  // number of valid elements of each segment
+  rmm::device_uvector<size_type> valid_counts(num_segments, stream);
+  if (col.has_nulls()) {
+    auto is_valid = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [d_col = *dcol] __device__(size_type idx) -> size_type { return d_col.is_valid(idx); });
+    cudf::reduction::detail::segmented_reduce(is_valid,
+                                              offsets.begin(),
+                                              offsets.end(),
+                                              valid_counts.begin(),
+                                              cudf::DeviceSum{},
+                                              size_type{0},
+                                              stream);
+  } else {
+    thrust::transform(rmm::exec_policy(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      offsets.begin(),
+                      valid_counts.begin(),
+                      thrust::minus<size_type>{});
+  }
+
+  auto result = make_fixed_width_column(
+    data_type{type_to_id<ResultType>()}, num_segments, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    intermediates.begin(),
+                    intermediates.end(),
+                    valid_counts.begin(),
+                    result->mutable_view().template begin<ResultType>(),
+                    [ddof] __device__(IntermediateType const& value, size_type count) {
+                      return Op::template compute_result<ResultType>(value, count, ddof);
+                    });
+
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_segments),
+    [d_offsets  = offsets.begin(),
+     d_counts   = valid_counts.begin(),
+     ddof       = ddof,
+     skip_nulls = null_handling == null_policy::EXCLUDE] __device__(size_type segment) {
+      auto const count = d_counts[segment];
+      return count > ddof && (skip_nulls || count == d_offsets[segment + 1] - d_offsets[segment]);
+    },
+    stream,
+    mr);
+  if (null_count > 0) { result->set_null_mask(std::move(null_mask), null_count); }
+  return result;
+}
+
+// @brief result type dispatcher for compound segmented reduction (a.k.a. mean, var, std)
+template <typename ElementType, typename Op>
+struct segmented_result_type_dispatcher {
+  template <typename ResultType, std::enable_if_t<std::is_floating_point_v<ResultType>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     null_policy null_handling,
+                                     size_type ddof,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return compound_segmented_reduction<ElementType, ResultType, Op>(
+      col, offsets, null_handling, ddof, stream, mr);
+  }
+
+  template <typename ResultType,
+            std::enable_if_t<not std::is_floating_point_v<ResultType>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     null_policy,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL("Unsupported output data type");
+  }
+};
+
+// @brief input column element dispatcher for compound segmented reduction (a.k.a. mean, var, std)
+template <typename Op>
+struct segmented_element_type_dispatcher {
+  template <typename ElementType, std::enable_if_t<std::is_arithmetic_v<ElementType>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     data_type const output_dtype,
+                                     null_policy null_handling,
+                                     size_type ddof,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    return cudf::type_dispatcher(output_dtype,
+                                 segmented_result_type_dispatcher<ElementType, Op>(),
+                                 col,
+                                 offsets,
+                                 null_handling,
+                                 ddof,
+                                 stream,
+                                 mr);
+  }
+
+  template <typename ElementType,
+            std::enable_if_t<not std::is_arithmetic_v<ElementType>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     device_span<size_type const>,
+                                     data_type const,
+                                     null_policy,
+                                     size_type,
+                                     rmm::cuda_stream_view,
+                                     rmm::mr::device_memory_resource*)
+  {
+    CUDF_FAIL(
+      "Segmented reduction operators other than `min` and `max`"
+      " are not supported for non-arithmetic types");
+  }
+};
+
+}  // namespace detail
+}  // namespace compound
+}  // namespace reduction
+}  // namespace cudf
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/reduction_functions.hpp>
+#include <cudf/detail/reduction_operators.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/pair.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace cudf {
+namespace reduction {
+namespace {
+
+/// Accumulator of SUM and SUM_OF_SQUARES, i.e. the target type of both for a `T` column
+template <typename T>
+using sum_type = std::conditional_t<std::is_integral_v<T>, int64_t, T>;
+
+/**
+ * @brief Every statistic of the fused reduction of a column.
+ *
+ * Each one is accumulated the way the corresponding single reduction accumulates it, so that a
+ * fused result equals the result of reducing the column for that aggregation alone.
+ */
+template <typename T>
+struct summary {
+  T min_val;
+  T max_val;
+  sum_type<T> sum;
+  sum_type<T> sum_of_squares;
+  var_std<double> moments;  ///< Sum and sum of squares as FLOAT64 for MEAN, VARIANCE and STD
+
+  __host__ __device__ summary()
+    : min_val(cudf::DeviceMin::identity<T>()),
+      max_val(cudf::DeviceMax::identity<T>()),
+      sum(0),
+      sum_of_squares(0),
+      moments()
+  {
+  }
+
+  __host__ __device__ summary(T val)
+    : min_val(val),
+      max_val(val),
+      sum(static_cast<sum_type<T>>(val)),
+      sum_of_squares(static_cast<sum_type<T>>(val) * static_cast<sum_type<T>>(val)),
+      moments(static_cast<double>(val), static_cast<double>(val) * static_cast<double>(val))
+  {
+  }
+};
+
+template <typename T>
+struct summary_binary_op {
+  __device__ summary<T> operator()(summary<T> const& lhs, summary<T> const& rhs) const
+  {
+    summary<T> result;
+    result.min_val        = cudf::DeviceMin{}(lhs.min_val, rhs.min_val);
+    result.max_val        = cudf::DeviceMax{}(lhs.max_val, rhs.max_val);
+    result.sum            = lhs.sum + rhs.sum;
+    result.sum_of_squares = lhs.sum_of_squares + rhs.sum_of_squares;
+    result.moments        = lhs.moments + rhs.moments;
+    return result;
+  }
+};
+
+/**
+ * @brief Creates a summary from a T
+ */
+template <typename T>
+struct create_summary {
+  __device__ summary<T> operator()(T val) const { return summary<T>{val}; }
+};
+
+/**
+ * @brief Creates a summary from a (value, validity) pair, the identity for null elements
+ */
+template <typename T>
+struct create_summary_with_nulls {
+  __device__ summary<T> operator()(thrust::pair<T, bool> const& p) const
+  {
+    return p.second ? summary<T>{p.first} : summary<T>{};
+  }
+};
+
+/**
+ * @brief Dispatch functor computing every fusable aggregation of a column in one pass.
+ *
+ * Aggregations are fusable when the input is a non-boolean arithmetic column and the requested
+ * output type is the one the single reduction would accumulate in: the input type for MIN and
+ * MAX, the SUM target type for SUM and SUM_OF_SQUARES, and FLOAT64 for MEAN, VARIANCE and STD.
+ */
+struct fused_reduce_functor {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return std::is_arithmetic_v<T> and not std::is_same_v<T, bool>;
+  }
+
+  template <typename T>
+  static bool is_fusable(aggregation::Kind kind, data_type input_type, data_type output_type)
+  {
+    switch (kind) {
+      case aggregation::MIN:
+      case aggregation::MAX: return output_type == input_type;
+      case aggregation::SUM:
+      case aggregation::SUM_OF_SQUARES: return output_type.id() == type_to_id<sum_type<T>>();
+      case aggregation::MEAN:
+      case aggregation::VARIANCE:
+      case aggregation::STD: return output_type.id() == type_id::FLOAT64;
+      default: return false;
+    }
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const& col,
+    host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+    host_span<data_type const> output_dtypes,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr)
+  {
+    std::vector<std::unique_ptr<scalar>> results(aggs.size());
+    std::vector<bool> fusable(aggs.size());
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      fusable[i] = is_fusable<T>(aggs[i]->kind, col.type(), output_dtypes[i]);
+    }
+    // a single fusable aggregation is as fast on its own
+    if (std::count(fusable.begin(), fusable.end(), true) < 2) { return results; }
+
+    auto const d_col = column_device_view::create(col, stream);
+    auto const stats =
+      col.has_nulls()
+        ? thrust::transform_reduce(rmm::exec_policy(stream),
+                                   d_col->pair_begin<T, true>(),
+                                   d_col->pair_end<T, true>(),
+                                   create_summary_with_nulls<T>{},
+                                   summary<T>{},
+                                   summary_binary_op<T>{})
+        : thrust::transform_reduce(rmm::exec_policy(stream),
+                                   d_col->begin<T>(),
+                                   d_col->end<T>(),
+                                   create_summary<T>{},
+                                   summary<T>{},
+                                   summary_binary_op<T>{});
+
+    auto const count = col.size() - col.null_count();
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      if (not fusable[i]) { continue; }
+      auto const& agg = *aggs[i];
+      switch (agg.kind) {
+        case aggregation::MIN:
+          results[i] = make_fixed_width_scalar(stats.min_val, stream, mr);
+          break;
+        case aggregation::MAX:
+          results[i] = make_fixed_width_scalar(stats.max_val, stream, mr);
+          break;
+        case aggregation::SUM: results[i] = make_fixed_width_scalar(stats.sum, stream, mr); break;
+        case aggregation::SUM_OF_SQUARES:
+          results[i] = make_fixed_width_scalar(stats.sum_of_squares, stream, mr);
+          break;
+        case aggregation::MEAN:
+          results[i] = make_fixed_width_scalar(
+            op::mean::intermediate<double>::compute_result(stats.moments.value, count, 0),
+            stream,
+            mr);
+          break;
+        case aggregation::VARIANCE: {
+          auto const ddof = dynamic_cast<cudf::detail::var_aggregation const&>(agg)._ddof;
+          results[i]      = make_fixed_width_scalar(
+            op::variance::intermediate<double>::compute_result(stats.moments, count, ddof),
+            stream,
+            mr);
+          break;
+        }
+        case aggregation::STD: {
+          auto const ddof = dynamic_cast<cudf::detail::std_aggregation const&>(agg)._ddof;
+          results[i]      = make_fixed_width_scalar(
+            op::standard_deviation::intermediate<double>::compute_result(
+              stats.moments, count, ddof),
+            stream,
+            mr);
+          break;
+        }
+        default: break;
+      }
+    }
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not is_supported<T>()>* = nullptr>
+  std::vector<std::unique_ptr<scalar>> operator()(
+    column_view const&,
+    host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+    host_span<data_type const>,
+    rmm::cuda_stream_view,
+    rmm::mr::device_memory_resource*)
+  {
+    return std::vector<std::unique_ptr<scalar>>(aggs.size());
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> fused_reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  return type_dispatcher(col.type(), fused_reduce_functor{}, col, aggs, output_dtypes, stream, mr);
+}
+
+}  // namespace reduction
+}  // namespace cudf
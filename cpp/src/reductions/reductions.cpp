@@ -22,6 +22,7 @@
 #include <cudf/detail/reduction_functions.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -30,6 +31,8 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 struct reduce_dispatch_functor {
@@ -133,6 +136,17 @@ struct reduce_dispatch_functor {
         auto td_agg = dynamic_cast<merge_tdigest_aggregation const*>(agg.get());
         return detail::tdigest::reduce_merge_tdigest(col, td_agg->max_centroids, stream, mr);
       }
+      case aggregation::HLL: {
+        CUDF_EXPECTS(output_dtype.id() == type_id::LIST,
+                     "HLL aggregations expect output type to be LIST");
+        auto hll_agg = dynamic_cast<hll_aggregation const*>(agg.get());
+        return detail::hyperloglog::reduce_hll(col, hll_agg->precision, stream, mr);
+      }
+      case aggregation::MERGE_HLL: {
+        CUDF_EXPECTS(output_dtype.id() == type_id::LIST,
+                     "HLL aggregations expect output type to be LIST");
+        return detail::hyperloglog::reduce_merge_hll(col, stream, mr);
+      }
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -155,8 +169,8 @@ std::unique_ptr<scalar> reduce(
       "Initial value is only supported for SUM, PRODUCT, MIN, MAX, ANY, and ALL aggregation types");
   }
   // Returns default scalar if input column is non-valid. In terms of nested columns, we need to
-  // handcraft the default scalar with input column.
-  if (col.size() <= col.null_count()) {
+  // handcraft the default scalar with input column. A HLL sketch of no value is a valid sketch.
+  if (col.size() <= col.null_count() && agg->kind != aggregation::HLL) {
     if (agg->kind == aggregation::TDIGEST || agg->kind == aggregation::MERGE_TDIGEST) {
       return detail::tdigest::make_empty_tdigest_scalar();
     }
@@ -178,8 +192,56 @@ std::unique_ptr<scalar> reduce(
   return aggregation_dispatcher(
     agg->kind, reduce_dispatch_functor{col, output_dtype, init, stream, mr}, agg);
 }
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Each aggregation must have an output data type");
+  // an empty or all-null column has only default results, which the single reduce makes
+  auto results = col.size() > col.null_count()
+                   ? reduction::fused_reduce(col, aggs, output_dtypes, stream, mr)
+                   : std::vector<std::unique_ptr<scalar>>(aggs.size());
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (not results[i]) {
+      results[i] = reduce(col, aggs[i], output_dtypes[i], std::nullopt, stream, mr);
+    }
+  }
+  return results;
+}
 }  // namespace detail
 
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(col, aggs, output_dtypes, cudf::default_stream_value, mr);
+}
+
+std::vector<std::vector<std::unique_ptr<scalar>>> reduce(
+  table_view const& input,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  std::vector<std::vector<std::unique_ptr<scalar>>> results;
+  for (auto const& col : input) {
+    std::vector<data_type> output_dtypes(aggs.size());
+    std::transform(aggs.begin(), aggs.end(), output_dtypes.begin(), [&col](auto const& agg) {
+      return detail::target_type(col.type(), agg->kind);
+    });
+    results.push_back(detail::reduce(col, aggs, output_dtypes, cudf::default_stream_value, mr));
+  }
+  return results;
+}
+
 std::unique_ptr<scalar> reduce(column_view const& col,
                                std::unique_ptr<reduce_aggregation> const& agg,
                                data_type output_dtype,
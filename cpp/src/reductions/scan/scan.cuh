@@ -27,35 +27,67 @@
 namespace cudf {
 namespace detail {
 
-// logical-and scan of the null mask of the input view
-rmm::device_buffer mask_scan(column_view const& input_view,
-                             scan_type inclusive,
+/**
+ * @brief Computes the number of leading rows of a scan that can be valid.
+ *
+ * With `null_policy::INCLUDE` every output row from the first null element on (or from the row
+ * after it for an exclusive scan) is null, so only the rows before it need to be scanned.
+ *
+ * @param input Input column view of the scan
+ * @param null_handling How null row entries are to be processed
+ * @param inclusive Whether the scan is inclusive or exclusive
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Number of leading output rows that are valid, `input.size()` if there are no nulls or
+ * nulls are excluded
+ */
+size_type valid_scan_rows(column_view const& input,
+                          null_policy null_handling,
+                          scan_type inclusive,
+                          rmm::cuda_stream_view stream);
+
+/**
+ * @brief Creates the null mask of a scan including nulls.
+ *
+ * @param size Number of rows of the scan output
+ * @param valid_rows Number of leading valid rows as returned by `valid_scan_rows`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned mask
+ * @return Null mask with the first `valid_rows` bits set
+ */
+rmm::device_buffer mask_scan(size_type size,
+                             size_type valid_rows,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Dispatches a scan aggregation to `DispatchFn<Op>` for the input type.
+ *
+ * Only the first `valid_rows` rows of the output are computed by the dispatched scan; the
+ * remaining rows are null in the final result and their values are left unspecified.
+ */
 template <template <typename> typename DispatchFn>
 std::unique_ptr<column> scan_agg_dispatch(const column_view& input,
                                           std::unique_ptr<scan_aggregation> const& agg,
-                                          null_policy null_handling,
+                                          size_type valid_rows,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
 {
   switch (agg->kind) {
     case aggregation::SUM:
       return type_dispatcher<dispatch_storage_type>(
-        input.type(), DispatchFn<DeviceSum>(), input, null_handling, stream, mr);
+        input.type(), DispatchFn<DeviceSum>(), input, valid_rows, stream, mr);
     case aggregation::MIN:
       return type_dispatcher<dispatch_storage_type>(
-        input.type(), DispatchFn<DeviceMin>(), input, null_handling, stream, mr);
+        input.type(), DispatchFn<DeviceMin>(), input, valid_rows, stream, mr);
     case aggregation::MAX:
       return type_dispatcher<dispatch_storage_type>(
-        input.type(), DispatchFn<DeviceMax>(), input, null_handling, stream, mr);
+        input.type(), DispatchFn<DeviceMax>(), input, valid_rows, stream, mr);
     case aggregation::PRODUCT:
       // a product scan on a decimal type with non-zero scale would result in each element having
       // a different scale, and because scale is stored once per column, this is not possible
       if (is_fixed_point(input.type())) CUDF_FAIL("decimal32/64/128 cannot support product scan");
       return type_dispatcher<dispatch_storage_type>(
-        input.type(), DispatchFn<DeviceProduct>(), input, null_handling, stream, mr);
+        input.type(), DispatchFn<DeviceProduct>(), input, valid_rows, stream, mr);
     default: CUDF_FAIL("Unsupported aggregation operator for scan");
   }
 }
@@ -46,13 +46,14 @@ struct scan_dispatcher {
    * @tparam T type of input column
    *
    * @param input  Input column view
+   * @param valid_rows Number of leading rows to scan; the remaining rows are null
    * @param stream CUDA stream used for device memory operations and kernel launches.
    * @param mr Device memory resource used to allocate the returned column's device memory
    * @return Output column with scan results
    */
   template <typename T, std::enable_if_t<cuda::std::is_arithmetic_v<T>>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& input,
-                                     null_policy,
+                                     size_type valid_rows,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
@@ -65,7 +66,7 @@ struct scan_dispatcher {
 
     auto begin = make_null_replacement_iterator(*d_input, identity, input.has_nulls());
     thrust::exclusive_scan(
-      rmm::exec_policy(stream), begin, begin + input.size(), output.data<T>(), identity, Op{});
+      rmm::exec_policy(stream), begin, begin + valid_rows, output.data<T>(), identity, Op{});
 
     CUDF_CHECK_CUDA(stream.value());
     return output_column;
@@ -86,13 +87,14 @@ std::unique_ptr<column> scan_exclusive(const column_view& input,
                                        rmm::cuda_stream_view stream,
                                        rmm::mr::device_memory_resource* mr)
 {
-  auto output = scan_agg_dispatch<scan_dispatcher>(input, agg, null_handling, stream, mr);
+  auto const valid_rows = valid_scan_rows(input, null_handling, scan_type::EXCLUSIVE, stream);
+  auto output           = scan_agg_dispatch<scan_dispatcher>(input, agg, valid_rows, stream, mr);
 
   if (null_handling == null_policy::EXCLUDE) {
     output->set_null_mask(detail::copy_bitmask(input, stream, mr), input.null_count());
   } else if (input.nullable()) {
-    output->set_null_mask(mask_scan(input, scan_type::EXCLUSIVE, stream, mr),
-                          cudf::UNKNOWN_NULL_COUNT);
+    output->set_null_mask(mask_scan(input.size(), valid_rows, stream, mr),
+                          input.size() - valid_rows);
   }
 
   return output;
@@ -29,6 +29,7 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/fill.h>
 #include <thrust/find.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -39,29 +40,30 @@
 namespace cudf {
 namespace detail {
 
-// logical-and scan of the null mask of the input view
-rmm::device_buffer mask_scan(column_view const& input_view,
-                             scan_type inclusive,
-                             rmm::cuda_stream_view stream,
-                             rmm::mr::device_memory_resource* mr)
+size_type valid_scan_rows(column_view const& input,
+                          null_policy null_handling,
+                          scan_type inclusive,
+                          rmm::cuda_stream_view stream)
 {
-  rmm::device_buffer mask =
-    detail::create_null_mask(input_view.size(), mask_state::UNINITIALIZED, stream, mr);
-  auto d_input   = column_device_view::create(input_view, stream);
+  if (null_handling == null_policy::EXCLUDE || !input.has_nulls()) { return input.size(); }
+  auto d_input   = column_device_view::create(input, stream);
   auto valid_itr = detail::make_validity_iterator(*d_input);
+  size_type const first_null =
+    thrust::find_if_not(
+      rmm::exec_policy(stream), valid_itr, valid_itr + input.size(), thrust::identity{}) -
+    valid_itr;
+  size_type const exclusive_offset = (inclusive == scan_type::EXCLUSIVE) ? 1 : 0;
+  return std::min(input.size(), first_null + exclusive_offset);
+}
 
-  auto first_null_position = [&] {
-    size_type const first_null =
-      thrust::find_if_not(
-        rmm::exec_policy(stream), valid_itr, valid_itr + input_view.size(), thrust::identity{}) -
-      valid_itr;
-    size_type const exclusive_offset = (inclusive == scan_type::EXCLUSIVE) ? 1 : 0;
-    return std::min(input_view.size(), first_null + exclusive_offset);
-  }();
-
-  set_null_mask(static_cast<bitmask_type*>(mask.data()), 0, first_null_position, true, stream);
-  set_null_mask(
-    static_cast<bitmask_type*>(mask.data()), first_null_position, input_view.size(), false, stream);
+rmm::device_buffer mask_scan(size_type size,
+                             size_type valid_rows,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_buffer mask = detail::create_null_mask(size, mask_state::UNINITIALIZED, stream, mr);
+  set_null_mask(static_cast<bitmask_type*>(mask.data()), 0, valid_rows, true, stream);
+  set_null_mask(static_cast<bitmask_type*>(mask.data()), valid_rows, size, false, stream);
   return mask;
 }
 
@@ -104,9 +106,28 @@ struct min_max_scan_operator {
   }
 };
 
+/**
+ * @brief Points the gather map rows past the valid rows of the scan out of bounds.
+ *
+ * The output rows past `valid_rows` are null, so gathering them with `NULLIFY` avoids copying
+ * any data for them.
+ *
+ * @return The out of bounds policy to gather with the map
+ */
+out_of_bounds_policy null_scan_rows(device_span<size_type> gather_map,
+                                    size_type valid_rows,
+                                    size_type size,
+                                    rmm::cuda_stream_view stream)
+{
+  if (valid_rows == size) { return out_of_bounds_policy::DONT_CHECK; }
+  thrust::fill(rmm::exec_policy(stream), gather_map.begin() + valid_rows, gather_map.end(), size);
+  return out_of_bounds_policy::NULLIFY;
+}
+
 template <typename Op, typename T>
 struct scan_functor {
   static std::unique_ptr<column> invoke(column_view const& input_view,
+                                        size_type valid_rows,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
   {
@@ -118,7 +139,7 @@ struct scan_functor {
     auto const begin =
       make_null_replacement_iterator(*d_input, Op::template identity<T>(), input_view.has_nulls());
     thrust::inclusive_scan(
-      rmm::exec_policy(stream), begin, begin + input_view.size(), result.data<T>(), Op{});
+      rmm::exec_policy(stream), begin, begin + valid_rows, result.data<T>(), Op{});
 
     CUDF_CHECK_CUDA(stream.value());
     return output_column;
@@ -128,6 +149,7 @@ struct scan_functor {
 template <typename Op>
 struct scan_functor<Op, cudf::string_view> {
   static std::unique_ptr<column> invoke(column_view const& input_view,
+                                        size_type valid_rows,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
   {
@@ -138,14 +160,15 @@ struct scan_functor<Op, cudf::string_view> {
     thrust::inclusive_scan(
       rmm::exec_policy(stream),
       thrust::counting_iterator<size_type>(0),
-      thrust::counting_iterator<size_type>(input_view.size()),
+      thrust::counting_iterator<size_type>(valid_rows),
       result.begin(),
       min_max_scan_operator<cudf::string_view, Op>{*d_input, input_view.has_nulls()});
+    auto const policy = null_scan_rows(result, valid_rows, input_view.size(), stream);
 
     // call gather using the indices to build the output column
     auto result_table = cudf::detail::gather(cudf::table_view({input_view}),
                                              result,
-                                             out_of_bounds_policy::DONT_CHECK,
+                                             policy,
                                              negative_index_policy::NOT_ALLOWED,
                                              stream,
                                              mr);
@@ -156,6 +179,7 @@ struct scan_functor<Op, cudf::string_view> {
 template <typename Op>
 struct scan_functor<Op, cudf::struct_view> {
   static std::unique_ptr<column> invoke(column_view const& input,
+                                        size_type valid_rows,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
   {
@@ -165,9 +189,10 @@ struct scan_functor<Op, cudf::struct_view> {
       cudf::reduction::detail::comparison_binop_generator::create<Op>(input, stream);
     thrust::inclusive_scan(rmm::exec_policy(stream),
                            thrust::counting_iterator<size_type>(0),
-                           thrust::counting_iterator<size_type>(input.size()),
+                           thrust::counting_iterator<size_type>(valid_rows),
                            gather_map.begin(),
                            binop_generator.binop());
+    auto const policy = null_scan_rows(gather_map, valid_rows, input.size(), stream);
 
     // Gather the children columns of the input column. Must use `get_sliced_child` to properly
     // handle input in case it is a sliced view.
@@ -182,7 +207,7 @@ struct scan_functor<Op, cudf::struct_view> {
     // Gather the children elements of the prefix min/max struct elements for the output.
     auto scanned_children = cudf::detail::gather(table_view{input_children},
                                                  gather_map,
-                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 policy,
                                                  negative_index_policy::NOT_ALLOWED,
                                                  stream,
                                                  mr)
@@ -221,7 +246,7 @@ struct scan_dispatcher {
    * @brief Creates a new column from the input column by applying the scan operation
    *
    * @param input Input column view
-   * @param null_handling How null row entries are to be processed
+   * @param valid_rows Number of leading rows to scan; the remaining rows are null
    * @param stream CUDA stream used for device memory operations and kernel launches.
    * @param mr Device memory resource used to allocate the returned column's device memory
    * @return
@@ -230,11 +255,11 @@ struct scan_dispatcher {
    */
   template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
   std::unique_ptr<column> operator()(column_view const& input,
-                                     null_policy,
+                                     size_type valid_rows,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
   {
-    return scan_functor<Op, T>::invoke(input, stream, mr);
+    return scan_functor<Op, T>::invoke(input, valid_rows, stream, mr);
   }
 
   template <typename T, typename... Args>
@@ -253,12 +278,14 @@ std::unique_ptr<column> scan_inclusive(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  auto output = scan_agg_dispatch<scan_dispatcher>(input, agg, null_handling, stream, mr);
+  auto const valid_rows = valid_scan_rows(input, null_handling, scan_type::INCLUSIVE, stream);
+  auto output           = scan_agg_dispatch<scan_dispatcher>(input, agg, valid_rows, stream, mr);
 
   if (null_handling == null_policy::EXCLUDE) {
     output->set_null_mask(detail::copy_bitmask(input, stream, mr), input.null_count());
   } else if (input.nullable()) {
-    output->set_null_mask(mask_scan(input, scan_type::INCLUSIVE, stream, mr), UNKNOWN_NULL_COUNT);
+    output->set_null_mask(mask_scan(input.size(), valid_rows, stream, mr),
+                          input.size() - valid_rows);
   }
 
   // If the input is a structs column, we also need to push down nulls from the parent output column
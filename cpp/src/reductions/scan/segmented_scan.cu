@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/scan.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Dispatcher for running a scan operation independently within every segment
+ *
+ * @tparam Op device binary operator (e.g. min, max, sum)
+ */
+template <typename Op>
+struct segmented_scan_dispatcher {
+  template <typename T, std::enable_if_t<cuda::std::is_arithmetic_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     device_span<size_type const> labels,
+                                     scan_type inclusive,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::mr::device_memory_resource* mr)
+  {
+    auto output_column =
+      detail::allocate_like(input, input.size(), mask_allocation_policy::NEVER, stream, mr);
+    auto output = output_column->mutable_view().template begin<T>();
+
+    auto d_input  = column_device_view::create(input, stream);
+    auto identity = Op::template identity<T>();
+    auto begin    = make_null_replacement_iterator(*d_input, identity, input.has_nulls());
+
+    if (inclusive == scan_type::INCLUSIVE) {
+      thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                    labels.begin(),
+                                    labels.end(),
+                                    begin,
+                                    output,
+                                    thrust::equal_to<size_type>{},
+                                    Op{});
+    } else {
+      thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                    labels.begin(),
+                                    labels.end(),
+                                    begin,
+                                    output,
+                                    identity,
+                                    thrust::equal_to<size_type>{},
+                                    Op{});
+    }
+    return output_column;
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not cuda::std::is_arithmetic_v<T>, std::unique_ptr<column>> operator()(Args&&...)
+  {
+    CUDF_FAIL("Non-arithmetic types not supported for segmented scan");
+  }
+};
+
+/**
+ * @brief Computes the null mask of a segmented scan including nulls.
+ *
+ * An output element is valid only if no element of its segment up to it (inclusive scan) or
+ * before it (exclusive scan) is null.
+ */
+std::pair<rmm::device_buffer, size_type> segmented_mask_scan(column_view const& input,
+                                                             device_span<size_type const> labels,
+                                                             scan_type inclusive,
+                                                             rmm::cuda_stream_view stream,
+                                                             rmm::mr::device_memory_resource* mr)
+{
+  auto d_input   = column_device_view::create(input, stream);
+  auto valid_itr = detail::make_validity_iterator(*d_input);
+  rmm::device_uvector<bool> valid_prefix(input.size(), stream);
+  if (inclusive == scan_type::INCLUSIVE) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  labels.begin(),
+                                  labels.end(),
+                                  valid_itr,
+                                  valid_prefix.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  thrust::logical_and<bool>{});
+  } else {
+    thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
+                                  labels.begin(),
+                                  labels.end(),
+                                  valid_itr,
+                                  valid_prefix.begin(),
+                                  true,
+                                  thrust::equal_to<size_type>{},
+                                  thrust::logical_and<bool>{});
+  }
+  return detail::valid_if(valid_prefix.begin(), valid_prefix.end(), thrust::identity{}, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> segmented_scan(column_view const& input,
+                                       device_span<size_type const> offsets,
+                                       std::unique_ptr<scan_aggregation> const& agg,
+                                       scan_type inclusive,
+                                       null_policy null_handling,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets.size() > 0, "`offsets` should have at least 1 element.");
+  if (input.is_empty()) { return empty_like(input); }
+
+  rmm::device_uvector<size_type> labels(input.size(), stream);
+  label_segments(offsets.begin(), offsets.end(), labels.begin(), labels.end(), stream);
+
+  auto output = [&] {
+    switch (agg->kind) {
+      case aggregation::SUM:
+        return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                      segmented_scan_dispatcher<DeviceSum>{},
+                                                      input,
+                                                      labels,
+                                                      inclusive,
+                                                      stream,
+                                                      mr);
+      case aggregation::PRODUCT:
+        return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                      segmented_scan_dispatcher<DeviceProduct>{},
+                                                      input,
+                                                      labels,
+                                                      inclusive,
+                                                      stream,
+                                                      mr);
+      case aggregation::MIN:
+        return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                      segmented_scan_dispatcher<DeviceMin>{},
+                                                      input,
+                                                      labels,
+                                                      inclusive,
+                                                      stream,
+                                                      mr);
+      case aggregation::MAX:
+        return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                      segmented_scan_dispatcher<DeviceMax>{},
+                                                      input,
+                                                      labels,
+                                                      inclusive,
+                                                      stream,
+                                                      mr);
+      default: CUDF_FAIL("Unsupported aggregation operator for segmented scan");
+    }
+  }();
+
+  if (null_handling == null_policy::EXCLUDE) {
+    output->set_null_mask(detail::copy_bitmask(input, stream, mr), input.null_count());
+  } else if (input.nullable()) {
+    auto [null_mask, null_count] = segmented_mask_scan(input, labels, inclusive, stream, mr);
+    output->set_null_mask(std::move(null_mask), null_count);
+  }
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> segmented_scan(column_view const& input,
+                                       device_span<size_type const> offsets,
+                                       std::unique_ptr<scan_aggregation> const& agg,
+                                       scan_type inclusive,
+                                       null_policy null_handling,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_scan(
+    input, offsets, agg, inclusive, null_handling, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
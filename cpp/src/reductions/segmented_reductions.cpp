@@ -65,7 +65,7 @@ struct segmented_reduce_dispatch_functor {
   }
 
   template <segmented_reduce_aggregation::Kind k>
-  std::unique_ptr<column> operator()()
+  std::unique_ptr<column> operator()(segmented_reduce_aggregation const& agg)
   {
     switch (k) {
       case segmented_reduce_aggregation::SUM:
@@ -86,9 +86,22 @@ struct segmented_reduce_dispatch_functor {
       case segmented_reduce_aggregation::ALL:
         return reduction::segmented_all(
           col, offsets, output_dtype, null_handling, init, stream, mr);
-      default:
-        CUDF_FAIL("Unsupported aggregation type.");
-        // TODO: Add support for compound_ops
+      case segmented_reduce_aggregation::SUM_OF_SQUARES:
+        return reduction::segmented_sum_of_squares(
+          col, offsets, output_dtype, null_handling, stream, mr);
+      case segmented_reduce_aggregation::MEAN:
+        return reduction::segmented_mean(col, offsets, output_dtype, null_handling, stream, mr);
+      case segmented_reduce_aggregation::VARIANCE: {
+        auto var_agg = dynamic_cast<var_aggregation const*>(&agg);
+        return reduction::segmented_variance(
+          col, offsets, output_dtype, null_handling, var_agg->_ddof, stream, mr);
+      }
+      case segmented_reduce_aggregation::STD: {
+        auto var_agg = dynamic_cast<std_aggregation const*>(&agg);
+        return reduction::segmented_standard_deviation(
+          col, offsets, output_dtype, null_handling, var_agg->_ddof, stream, mr);
+      }
+      default: CUDF_FAIL("Unsupported aggregation type.");
     }
   }
 };
@@ -115,7 +128,8 @@ std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
   return aggregation_dispatcher(
     agg.kind,
     segmented_reduce_dispatch_functor{
-      segmented_values, offsets, output_dtype, null_handling, init, stream, mr});
+      segmented_values, offsets, output_dtype, null_handling, init, stream, mr},
+    agg);
 }
 }  // namespace detail
 
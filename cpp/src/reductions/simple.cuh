@@ -78,9 +78,16 @@ std::unique_ptr<scalar> simple_reduction(column_view const& col,
 
   auto result = [&] {
     if (col.has_nulls()) {
-      auto f  = simple_op.template get_null_replacing_element_transformer<ResultType>();
-      auto it = thrust::make_transform_iterator(dcol->pair_begin<ElementType, true>(), f);
-      return cudf::reduction::detail::reduce(it, col.size(), simple_op, initial_value, stream, mr);
+      if constexpr (cudf::is_fixed_width<ResultType>() and not cudf::is_fixed_point<ResultType>()) {
+        auto f = simple_op.template get_element_transformer<ResultType>();
+        return cudf::reduction::detail::reduce_valid_elements<ElementType>(
+          *dcol, f, simple_op, initial_value, stream, mr);
+      } else {
+        auto f  = simple_op.template get_null_replacing_element_transformer<ResultType>();
+        auto it = thrust::make_transform_iterator(dcol->pair_begin<ElementType, true>(), f);
+        return cudf::reduction::detail::reduce(
+          it, col.size(), simple_op, initial_value, stream, mr);
+      }
     } else {
       auto f  = simple_op.template get_element_transformer<ResultType>();
       auto it = thrust::make_transform_iterator(dcol->begin<ElementType>(), f);
@@ -131,9 +138,9 @@ std::unique_ptr<scalar> fixed_point_reduction(
 
   auto result = [&] {
     if (col.has_nulls()) {
-      auto f  = simple_op.template get_null_replacing_element_transformer<Type>();
-      auto it = thrust::make_transform_iterator(dcol->pair_begin<Type, true>(), f);
-      return cudf::reduction::detail::reduce(it, col.size(), simple_op, initial_value, stream, mr);
+      auto f = simple_op.template get_element_transformer<Type>();
+      return cudf::reduction::detail::reduce_valid_elements<Type>(
+        *dcol, f, simple_op, initial_value, stream, mr);
     } else {
       auto f  = simple_op.template get_element_transformer<Type>();
       auto it = thrust::make_transform_iterator(dcol->begin<Type>(), f);
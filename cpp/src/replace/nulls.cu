@@ -21,7 +21,9 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/group_replace_nulls.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/replace.hpp>
@@ -44,6 +46,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/distance.h>
+#include <thrust/find.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
@@ -310,8 +314,8 @@ struct replace_nulls_scalar_kernel_forwarder {
                                            rmm::mr::device_memory_resource* mr)
   {
     CUDF_EXPECTS(input.type() == replacement.type(), "Data type mismatch");
-    std::unique_ptr<cudf::column> output =
-      cudf::allocate_like(input, cudf::mask_allocation_policy::NEVER, mr);
+    std::unique_ptr<cudf::column> output = cudf::detail::allocate_like(
+      input, input.size(), cudf::mask_allocation_policy::NEVER, stream, mr);
     auto output_view = output->mutable_view();
 
     using ScalarType = cudf::scalar_type_t<col_type>;
@@ -401,6 +405,96 @@ std::unique_ptr<cudf::column> replace_nulls_policy_impl(cudf::column_view const&
   return std::move(output->release()[0]);
 }
 
+/**
+ * @brief Returns the range of rows that are still null after filling the nulls of `input`, the
+ * rows before the first valid row for PRECEDING and after the last valid row for FOLLOWING.
+ */
+std::pair<cudf::size_type, cudf::size_type> unfilled_null_range(
+  cudf::column_device_view const& input,
+  cudf::replace_policy const& replace_policy,
+  rmm::cuda_stream_view stream)
+{
+  auto const valid_it = cudf::detail::make_validity_iterator(input);
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    auto const first_valid =
+      thrust::find(rmm::exec_policy(stream), valid_it, valid_it + input.size(), true);
+    return {0, static_cast<cudf::size_type>(thrust::distance(valid_it, first_valid))};
+  }
+  auto const valid_rbegin = thrust::make_reverse_iterator(valid_it + input.size());
+  auto const last_valid =
+    thrust::find(rmm::exec_policy(stream), valid_rbegin, valid_rbegin + input.size(), true);
+  return {input.size() - static_cast<cudf::size_type>(thrust::distance(valid_rbegin, last_valid)),
+          input.size()};
+}
+
+/**
+ * @brief Fills the null rows of fixed-width columns with a single scan over the values, instead
+ * of scanning for a gather map and gathering.
+ *
+ * `output` may be the same column as `input`, which fills the nulls in place.
+ */
+struct fill_nulls_fn {
+  template <typename T>
+  static constexpr bool is_supported()
+  {
+    return cudf::is_fixed_width<T>();
+  }
+
+  template <typename T, std::enable_if_t<is_supported<T>()>* = nullptr>
+  void operator()(cudf::column_device_view const& input,
+                  cudf::mutable_column_view output,
+                  cudf::replace_policy const& replace_policy,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const in_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(input.begin<T>(), cudf::detail::make_validity_iterator(input)));
+    auto const out_begin = thrust::make_zip_iterator(
+      thrust::make_tuple(output.begin<T>(), thrust::make_discard_iterator()));
+
+    auto const func = cudf::detail::fill_nulls_functor<T>{};
+    if (replace_policy == cudf::replace_policy::PRECEDING) {
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_begin, in_begin + input.size(), out_begin, func);
+    } else {
+      auto const in_rbegin  = thrust::make_reverse_iterator(in_begin + input.size());
+      auto const out_rbegin = thrust::make_reverse_iterator(out_begin + input.size());
+      thrust::inclusive_scan(
+        rmm::exec_policy(stream), in_rbegin, in_rbegin + input.size(), out_rbegin, func);
+    }
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not is_supported<T>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Filling nulls in a single scan requires a fixed-width type");
+  }
+};
+
+std::unique_ptr<cudf::column> replace_nulls_policy_fixed_width(
+  cudf::column_view const& input,
+  cudf::replace_policy const& replace_policy,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const device_in = cudf::column_device_view::create(input, stream);
+  auto output          = cudf::detail::allocate_like(
+    input, input.size(), cudf::mask_allocation_policy::NEVER, stream, mr);
+  cudf::type_dispatcher<cudf::dispatch_storage_type>(input.type(),
+                                                     fill_nulls_fn{},
+                                                     *device_in,
+                                                     output->mutable_view(),
+                                                     replace_policy,
+                                                     stream);
+
+  auto const [null_begin, null_end] = unfilled_null_range(*device_in, replace_policy, stream);
+  auto null_mask =
+    cudf::detail::create_null_mask(input.size(), cudf::mask_state::ALL_VALID, stream, mr);
+  cudf::detail::set_null_mask(
+    static_cast<cudf::bitmask_type*>(null_mask.data()), null_begin, null_end, false, stream);
+  output->set_null_mask(std::move(null_mask), null_end - null_begin);
+  return output;
+}
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -443,9 +537,51 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   if (input.is_empty()) { return cudf::empty_like(input); }
   if (!input.has_nulls()) { return std::make_unique<cudf::column>(input, stream, mr); }
 
+  if (cudf::is_fixed_width(input.type())) {
+    return replace_nulls_policy_fixed_width(input, replace_policy, stream, mr);
+  }
   return replace_nulls_policy_impl(input, replace_policy, stream, mr);
 }
 
+void replace_nulls_in_place(mutable_column_view& input,
+                            replace_policy const& replace_policy,
+                            rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(cudf::is_fixed_width(input.type()),
+               "In-place null replacement requires a fixed-width type");
+  if (input.is_empty() or not input.has_nulls()) { return; }
+
+  auto const device_in = cudf::column_device_view::create(input, stream);
+  cudf::type_dispatcher<dispatch_storage_type>(
+    input.type(), fill_nulls_fn{}, *device_in, input, replace_policy, stream);
+
+  // rows outside the null range are valid now; the null mask is indexed including the offset
+  auto const [null_begin, null_end]   = unfilled_null_range(*device_in, replace_policy, stream);
+  auto const [valid_begin, valid_end] = replace_policy == cudf::replace_policy::PRECEDING
+                                          ? std::pair{null_end, input.size()}
+                                          : std::pair{0, null_begin};
+  set_null_mask(
+    input.null_mask(), input.offset() + valid_begin, input.offset() + valid_end, true, stream);
+  input.set_null_count(null_end - null_begin);
+}
+
+std::unique_ptr<cudf::column> segmented_replace_nulls(cudf::column_view const& input,
+                                                      cudf::column_view const& offsets,
+                                                      replace_policy const& replace_policy,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(offsets.type().id() == type_to_id<size_type>(), "Offsets must be INT32");
+  CUDF_EXPECTS(not offsets.has_nulls(), "Offsets cannot contain nulls");
+  if (input.is_empty()) { return cudf::empty_like(input); }
+  if (!input.has_nulls()) { return std::make_unique<cudf::column>(input, stream, mr); }
+
+  rmm::device_uvector<size_type> labels(input.size(), stream);
+  label_segments(
+    offsets.begin<size_type>(), offsets.end<size_type>(), labels.begin(), labels.end(), stream);
+  return cudf::groupby::detail::group_replace_nulls(input, labels, replace_policy, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -472,4 +608,20 @@ std::unique_ptr<cudf::column> replace_nulls(column_view const& input,
   return cudf::detail::replace_nulls(input, replace_policy, cudf::default_stream_value, mr);
 }
 
+void replace_nulls_in_place(mutable_column_view& input, replace_policy const& replace_policy)
+{
+  CUDF_FUNC_RANGE();
+  cudf::detail::replace_nulls_in_place(input, replace_policy, cudf::default_stream_value);
+}
+
+std::unique_ptr<cudf::column> segmented_replace_nulls(column_view const& input,
+                                                      column_view const& offsets,
+                                                      replace_policy const& replace_policy,
+                                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::segmented_replace_nulls(
+    input, offsets, replace_policy, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
@@ -20,6 +20,7 @@
 #include "nth_element.cuh"
 #include "rolling.hpp"
 #include "rolling_collect_list.cuh"
+#include "rolling_incremental.cuh"
 #include "rolling_jit.hpp"
 
 #include <reductions/struct_minmax_util.cuh>
@@ -1096,6 +1097,21 @@ struct rolling_window_launcher {
              rmm::cuda_stream_view stream,
              rmm::mr::device_memory_resource* mr)
   {
+    // large windows use the algorithms whose cost does not depend on the window size
+    if constexpr (is_incremental_rolling_supported<InputType, op>()) {
+      auto const max_window =
+        max_window_size(input.size(), preceding_window_begin, following_window_begin, stream);
+      if (max_window >= incremental_rolling_min_window) {
+        return incremental_rolling_window<InputType, op>(input,
+                                                         preceding_window_begin,
+                                                         following_window_begin,
+                                                         min_periods,
+                                                         max_window,
+                                                         stream,
+                                                         mr);
+      }
+    }
+
     auto const do_rolling = [&](auto const& device_op) {
       auto output = make_fixed_width_column(
         target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
@@ -1228,6 +1244,50 @@ struct dispatch_rolling {
 
 }  // namespace
 
+/**
+ * @brief Gets the kernel applying the user-defined rolling window function of `udf_agg` to an
+ * input of `input_type`, compiling it if needed.
+ *
+ * @param input_type Type of the input column
+ * @param udf_agg The user-defined aggregation
+ * @param preceding_window_str Type name of the preceding window sizes in the kernel
+ * @param following_window_str Type name of the following window sizes in the kernel
+ * @return The compiled kernel
+ */
+inline jitify2::Kernel get_rolling_udf_kernel(data_type input_type,
+                                              udf_aggregation const& udf_agg,
+                                              std::string const& preceding_window_str,
+                                              std::string const& following_window_str)
+{
+  std::string cuda_source;
+  switch (udf_agg.kind) {
+    case aggregation::Kind::PTX:
+      cuda_source +=
+        cudf::jit::parse_single_function_ptx(udf_agg._source,
+                                             udf_agg._function_name,
+                                             cudf::jit::get_type_name(udf_agg._output_type),
+                                             {0, 5});  // args 0 and 5 are pointers.
+      break;
+    case aggregation::Kind::CUDA:
+      cuda_source += cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
+      break;
+    default: CUDF_FAIL("Unsupported UDF type.");
+  }
+
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
+      .instantiate(cudf::jit::get_type_name(input_type),  // list of template arguments
+                   cudf::jit::get_type_name(udf_agg._output_type),
+                   udf_agg._operator_name,
+                   preceding_window_str.c_str(),
+                   following_window_str.c_str());
+
+  return cudf::jit::get_kernel(*rolling_jit_kernel_cu_jit,
+                               kernel_name,
+                               {{"rolling/jit/operation-udf.hpp", cuda_source}},
+                               {"-arch=sm_."});
+}
+
 // Applies a user-defined rolling window function to the values in a column.
 template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
 std::unique_ptr<column> rolling_window_udf(column_view const& input,
@@ -1251,22 +1311,8 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
 
   auto& udf_agg = dynamic_cast<udf_aggregation const&>(agg);
 
-  std::string hash = "prog_rolling." + std::to_string(std::hash<std::string>{}(udf_agg._source));
-
-  std::string cuda_source;
-  switch (udf_agg.kind) {
-    case aggregation::Kind::PTX:
-      cuda_source +=
-        cudf::jit::parse_single_function_ptx(udf_agg._source,
-                                             udf_agg._function_name,
-                                             cudf::jit::get_type_name(udf_agg._output_type),
-                                             {0, 5});  // args 0 and 5 are pointers.
-      break;
-    case aggregation::Kind::CUDA:
-      cuda_source += cudf::jit::parse_single_function_cuda(udf_agg._source, udf_agg._function_name);
-      break;
-    default: CUDF_FAIL("Unsupported UDF type.");
-  }
+  auto kernel =
+    get_rolling_udf_kernel(input.type(), udf_agg, preceding_window_str, following_window_str);
 
   std::unique_ptr<column> output = make_numeric_column(
     udf_agg._output_type, input.size(), cudf::mask_state::UNINITIALIZED, stream, mr);
@@ -1274,18 +1320,8 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
   auto output_view = output->mutable_view();
   rmm::device_scalar<size_type> device_valid_count{0, stream};
 
-  std::string kernel_name =
-    jitify2::reflection::Template("cudf::rolling::jit::gpu_rolling_new")  //
-      .instantiate(cudf::jit::get_type_name(input.type()),  // list of template arguments
-                   cudf::jit::get_type_name(output->type()),
-                   udf_agg._operator_name,
-                   preceding_window_str.c_str(),
-                   following_window_str.c_str());
-
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+  kernel
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
@@ -18,72 +18,71 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
 #include <thrust/extrema.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
-#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+#include <utility>
 
 namespace cudf {
 namespace detail {
 
 /**
- * @brief Creates the offsets child of the result of the `COLLECT_LIST` window aggregation
+ * @brief The windows of the rows of the result of the `COLLECT_LIST` window aggregation.
  *
- * Given the input column, the preceding/following window bounds, and `min_periods`,
- * the sizes of each list row may be computed. These values can then be used to
- * calculate the offsets for the result of `COLLECT_LIST`.
+ * The window of row `i` spans the input rows `[i - preceding[i] + 1, i + following[i] + 1)`.
+ * The rows it collects are numbered among all the collected input rows: every input row, or only
+ * the valid ones when nulls are excluded. In the latter case `valid_prefix` holds, for each input
+ * row and one past the last, the number of valid rows before it.
  *
  * Note: If `min_periods` exceeds the number of observations for a window, the size
  * is set to `0` (since the result is `null`).
  */
 template <typename PrecedingIter, typename FollowingIter>
-std::unique_ptr<column> create_collect_offsets(size_type input_size,
-                                               PrecedingIter preceding_begin,
-                                               FollowingIter following_begin,
-                                               size_type min_periods,
-                                               rmm::cuda_stream_view stream,
-                                               rmm::mr::device_memory_resource* mr)
-{
-  // Materialize offsets column.
-  auto static constexpr size_data_type = data_type{type_to_id<size_type>()};
-  auto sizes =
-    make_fixed_width_column(size_data_type, input_size, mask_state::UNALLOCATED, stream, mr);
-  auto mutable_sizes = sizes->mutable_view();
+struct collect_windows {
+  PrecedingIter preceding;
+  FollowingIter following;
+  size_type min_periods;
+  size_type const* valid_prefix;  // nullptr if null rows are collected
+
+  /**
+   * @brief Returns the number of the first row collected by the window of row `i`.
+   */
+  __device__ size_type first(size_type i) const
+  {
+    auto const begin = i - preceding[i] + 1;
+    return valid_prefix ? valid_prefix[begin] : begin;
+  }
 
-  // Consider the following preceding/following values:
-  //    preceding = [1,2,2,2,2]
-  //    following = [1,1,1,1,0]
-  // The sum of the vectors should yield the window sizes:
-  //  prec + foll = [2,3,3,3,2]
-  //
-  // If min_periods=2, all rows have at least `min_periods` observations.
-  // But if min_periods=3, rows at indices 0 and 4 have too few observations, and must return
-  // null. The sizes at these positions must be 0, i.e.
-  //  prec + foll = [0,3,3,3,0]
-  thrust::transform(rmm::exec_policy(stream),
-                    preceding_begin,
-                    preceding_begin + input_size,
-                    following_begin,
-                    mutable_sizes.begin<size_type>(),
-                    [min_periods] __device__(auto const preceding, auto const following) {
-                      return (preceding + following) < min_periods ? 0 : (preceding + following);
-                    });
-
-  // Convert `sizes` to an offsets column, via inclusive_scan():
-  return strings::detail::make_offsets_child_column(
-    sizes->view().begin<size_type>(), sizes->view().end<size_type>(), stream, mr);
-}
+  /**
+   * @brief Returns the number of rows collected by the window of row `i`.
+   */
+  __device__ size_type size(size_type i) const
+  {
+    if (preceding[i] + following[i] < min_periods) { return 0; }
+    auto const end = i + following[i] + 1;
+    return (valid_prefix ? valid_prefix[end] : end) - first(i);
+  }
+};
 
 /**
- * @brief Generate mapping of each row in the COLLECT_LIST result's child column
- * to the index of the row it belongs to.
+ * @brief Gather map of the child column of the result of the `COLLECT_LIST` window aggregation,
+ * computed on the fly from the window bounds.
  *
  *  If
  *         input col == [A,B,C,D,E]
@@ -94,58 +93,74 @@ std::unique_ptr<column> create_collect_offsets(size_type input_size,
  *   i.e. result offset column == [0,2,5,8,11,13],
  *    and result child  column == [A,B,A,B,C,B,C,D,C,D,E,D,E].
  *  Mapping back to `input`    == [0,1,0,1,2,1,2,3,2,3,4,3,4]
+ *
+ * The row of each child element is found by a binary search of the offsets, so that no
+ * intermediate as large as the child column is materialized.
  */
-std::unique_ptr<column> get_list_child_to_list_row_mapping(cudf::column_view const& offsets,
-                                                           rmm::cuda_stream_view stream);
+template <typename Windows>
+struct collect_gather_map_fn {
+  Windows windows;
+  size_type const* offsets;     // offsets of the result, one more than its rows
+  size_type num_rows;           // number of rows of the result
+  size_type const* valid_rows;  // indices of the valid input rows, nullptr if all are collected
+
+  __device__ size_type operator()(size_type child_index) const
+  {
+    // The row holding the element is the last one whose offset does not exceed it
+    auto const row = static_cast<size_type>(
+      thrust::distance(
+        offsets,
+        thrust::upper_bound(thrust::seq, offsets, offsets + num_rows + 1, child_index)) -
+      1);
+    auto const collected = windows.first(row) + (child_index - offsets[row]);
+    return valid_rows ? valid_rows[collected] : collected;
+  }
+};
 
 /**
- * @brief Create gather map to generate the child column of the result of
- * the `COLLECT_LIST` window aggregation.
+ * @brief Creates the offsets child of the result of the `COLLECT_LIST` window aggregation
+ *
+ * @throws cudf::logic_error if the result has more elements than a column can hold
  */
-template <typename PrecedingIter>
-std::unique_ptr<column> create_collect_gather_map(column_view const& child_offsets,
-                                                  column_view const& per_row_mapping,
-                                                  PrecedingIter preceding_iter,
-                                                  rmm::cuda_stream_view stream)
+template <typename Windows>
+std::unique_ptr<column> create_collect_offsets(size_type input_size,
+                                               Windows const& windows,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::mr::device_memory_resource* mr)
 {
-  auto gather_map = make_fixed_width_column(
-    data_type{type_to_id<size_type>()}, per_row_mapping.size(), mask_state::UNALLOCATED, stream);
-  thrust::transform(
+  // Consider the following preceding/following values:
+  //    preceding = [1,2,2,2,2]
+  //    following = [1,1,1,1,0]
+  // The sum of the vectors should yield the window sizes:
+  //  prec + foll = [2,3,3,3,2]
+  //
+  // If min_periods=3, rows at indices 0 and 4 have too few observations, and must return
+  // null. The sizes at these positions must be 0, i.e.
+  //  prec + foll = [0,3,3,3,0]
+  auto const sizes_begin = cudf::detail::make_counting_transform_iterator(
+    0, [windows] __device__(size_type i) { return windows.size(i); });
+
+  auto const total_size = thrust::transform_reduce(
     rmm::exec_policy(stream),
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(per_row_mapping.size()),
-    gather_map->mutable_view().template begin<size_type>(),
-    [d_offsets =
-       child_offsets.template begin<size_type>(),  // E.g. [0,   2,     5,     8,     11, 13]
-     d_groups =
-       per_row_mapping.template begin<size_type>(),  // E.g. [0,0, 1,1,1, 2,2,2, 3,3,3, 4,4]
-     d_prev = preceding_iter] __device__(auto i) {
-      auto group              = d_groups[i];
-      auto group_start_offset = d_offsets[group];
-      auto relative_index     = i - group_start_offset;
-
-      return (group - d_prev[group] + 1) + relative_index;
-    });
-  return gather_map;
+    sizes_begin,
+    sizes_begin + input_size,
+    [] __device__(size_type size) { return static_cast<int64_t>(size); },
+    int64_t{0},
+    thrust::plus<int64_t>{});
+  CUDF_EXPECTS(total_size <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds column size limit");
+
+  // Convert the sizes to an offsets column, via inclusive_scan():
+  return strings::detail::make_offsets_child_column(
+    sizes_begin, sizes_begin + input_size, stream, mr);
 }
 
 /**
- * @brief Count null entries in result of COLLECT_LIST.
- */
-size_type count_child_nulls(column_view const& input,
-                            std::unique_ptr<column> const& gather_map,
-                            rmm::cuda_stream_view stream);
-
-/**
- * @brief Purge entries for null inputs from gather_map, and adjust offsets.
+ * @brief Returns the indices of the valid rows of `input`, and for each of its rows and one past
+ * the last, the number of valid rows before it.
  */
-std::pair<std::unique_ptr<column>, std::unique_ptr<column>> purge_null_entries(
-  column_view const& input,
-  column_view const& gather_map,
-  column_view const& offsets,
-  size_type num_child_nulls,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr);
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> get_valid_rows(
+  column_view const& input, rmm::cuda_stream_view stream);
 
 template <typename PrecedingIter, typename FollowingIter>
 std::unique_ptr<column> rolling_collect_list(column_view const& input,
@@ -177,33 +192,34 @@ std::unique_ptr<column> rolling_collect_list(column_view const& input,
                                       return thrust::min(following_begin_raw[i], size - i - 1);
                                     });
 
+  // With nulls excluded, the windows collect only the valid input rows.
+  auto const exclude_nulls = null_handling == null_policy::EXCLUDE && input.has_nulls();
+
+  auto const [valid_rows, valid_prefix] =
+    exclude_nulls ? get_valid_rows(input, stream)
+                  : std::pair{rmm::device_uvector<size_type>(0, stream),
+                              rmm::device_uvector<size_type>(0, stream)};
+
+  using windows_type = collect_windows<decltype(preceding_begin), decltype(following_begin)>;
+  auto const windows = windows_type{
+    preceding_begin, following_begin, min_periods, exclude_nulls ? valid_prefix.data() : nullptr};
+
   // Materialize collect list's offsets.
-  auto offsets =
-    create_collect_offsets(input.size(), preceding_begin, following_begin, min_periods, stream, mr);
-
-  // Map each element of the collect() result's child column
-  // to the index where it appears in the input.
-  auto per_row_mapping = get_list_child_to_list_row_mapping(offsets->view(), stream);
-
-  // Generate gather map to produce the collect() result's child column.
-  auto gather_map =
-    create_collect_gather_map(offsets->view(), per_row_mapping->view(), preceding_begin, stream);
-
-  // If gather_map collects null elements, and null_policy == EXCLUDE,
-  // those elements must be filtered out, and offsets recomputed.
-  if (null_handling == null_policy::EXCLUDE && input.has_nulls()) {
-    auto num_child_nulls = count_child_nulls(input, gather_map, stream);
-    if (num_child_nulls != 0) {
-      std::tie(gather_map, offsets) =
-        purge_null_entries(input, *gather_map, *offsets, num_child_nulls, stream, mr);
-    }
-  }
+  auto offsets = create_collect_offsets(input.size(), windows, stream, mr);
+  auto const num_child_rows =
+    cudf::detail::get_value<size_type>(offsets->view(), input.size(), stream);
 
-  // gather(), to construct child column.
+  // gather(), to construct child column, with the gather map computed from the window bounds.
+  auto const gather_map_begin = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    collect_gather_map_fn<windows_type>{windows,
+                                        offsets->view().begin<size_type>(),
+                                        input.size(),
+                                        exclude_nulls ? valid_rows.data() : nullptr});
   auto gather_output = cudf::detail::gather(table_view{std::vector<column_view>{input}},
-                                            gather_map->view(),
+                                            gather_map_begin,
+                                            gather_map_begin + num_child_rows,
                                             cudf::out_of_bounds_policy::DONT_CHECK,
-                                            cudf::detail::negative_index_policy::NOT_ALLOWED,
                                             stream,
                                             mr);
 
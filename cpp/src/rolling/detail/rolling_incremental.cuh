@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <memory>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Smallest maximum window size for which rolling aggregations use the algorithms whose cost
+ * does not depend on the window size.
+ *
+ * Below this, iterating each window directly is cheaper than building the auxiliary prefix sums
+ * or sparse tables.
+ */
+constexpr size_type incremental_rolling_min_window = 64;
+
+/**
+ * @brief Returns true if the aggregation of the input type has a window-size independent
+ * implementation.
+ *
+ * SUM uses prefix sums and is restricted to integral types, where the difference of two
+ * wrapping 64-bit prefix sums is exactly the window sum. Floating point sums would not match the
+ * window-by-window results. MIN/MAX use sparse tables, COUNT_VALID a prefix count of valid rows.
+ */
+template <typename InputType, aggregation::Kind op>
+constexpr bool is_incremental_rolling_supported()
+{
+  if constexpr (op == aggregation::COUNT_VALID) {
+    return true;
+  } else if constexpr (op == aggregation::SUM) {
+    return std::is_integral_v<InputType> && !std::is_same_v<InputType, bool>;
+  } else if constexpr (op == aggregation::MIN || op == aggregation::MAX) {
+    return std::is_integral_v<InputType>;
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Computes the `[start, end)` bounds of the window of a row, clamped to the column.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct window_bounds_fn {
+  PrecedingWindowIterator preceding_window_begin;
+  FollowingWindowIterator following_window_begin;
+  size_type num_rows;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    // to prevent overflow issues when computing bounds use int64_t
+    int64_t const preceding_window = preceding_window_begin[i];
+    int64_t const following_window = following_window_begin[i];
+
+    auto const start = static_cast<size_type>(
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, i - preceding_window + 1)));
+    auto const end = static_cast<size_type>(
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, i + following_window + 1)));
+    return {min(start, end), max(start, end)};
+  }
+};
+
+/**
+ * @brief Computes the largest number of rows in any window.
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+size_type max_window_size(size_type num_rows,
+                          PrecedingWindowIterator preceding_window_begin,
+                          FollowingWindowIterator following_window_begin,
+                          rmm::cuda_stream_view stream)
+{
+  auto const bounds = window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+    preceding_window_begin, following_window_begin, num_rows};
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    [bounds] __device__(size_type i) {
+      auto const [start, end] = bounds(i);
+      return end - start;
+    },
+    size_type{0},
+    thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Computes `prefix[i]` = number of valid rows in `[0, i)` for `i` in `[0, num_rows]`.
+ */
+inline rmm::device_uvector<size_type> valid_count_prefix(column_device_view const& d_input,
+                                                         rmm::cuda_stream_view stream)
+{
+  auto const num_rows = d_input.size();
+  rmm::device_uvector<size_type> prefix(num_rows + 1, stream);
+  auto const is_valid = cudf::detail::make_counting_transform_iterator(
+    0, [d_input, num_rows] __device__(size_type i) -> size_type {
+      return i < num_rows && d_input.is_valid(i);
+    });
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), is_valid, is_valid + num_rows + 1, prefix.begin());
+  return prefix;
+}
+
+/**
+ * @brief Rolling window aggregation whose cost does not depend on the window sizes.
+ *
+ * - COUNT_VALID: difference of the prefix counts of valid rows at the window bounds.
+ * - SUM: difference of the prefix sums at the window bounds, accumulated as wrapping unsigned
+ *   64-bit integers so that overflowing prefixes still yield the exact window sum.
+ * - MIN/MAX: sparse table of the aggregate of every power-of-two sized range up to the largest
+ *   window, so every window is answered by two overlapping lookups.
+ *
+ * The results and validity match the window-by-window rolling operators.
+ *
+ * @param input Input column
+ * @param preceding_window_begin Preceding window size iterator
+ * @param following_window_begin Following window size iterator
+ * @param min_periods Minimum number of observations in a window required to have a value
+ * @param max_window Largest number of rows in any window
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column of the rolling aggregation
+ */
+template <typename InputType,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::unique_ptr<column> incremental_rolling_window(column_view const& input,
+                                                   PrecedingWindowIterator preceding_window_begin,
+                                                   FollowingWindowIterator following_window_begin,
+                                                   size_type min_periods,
+                                                   size_type max_window,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::mr::device_memory_resource* mr)
+{
+  using OutType = device_storage_type_t<target_type_t<InputType, op>>;
+
+  auto const num_rows = input.size();
+  auto const d_input  = column_device_view::create(input, stream);
+  auto const bounds   = window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+    preceding_window_begin, following_window_begin, num_rows};
+  auto const valid_prefix = valid_count_prefix(*d_input, stream);
+
+  auto output = make_fixed_width_column(
+    target_type(input.type(), op), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const out_begin = output->mutable_view().template begin<OutType>();
+  auto const rows      = thrust::make_counting_iterator<size_type>(0);
+
+  // COUNT_VALID only requires the window itself to be large enough, other aggregations require
+  // enough valid rows in the window
+  auto const is_valid = [bounds, min_periods, d_valid = valid_prefix.data()] __device__(
+                          size_type i) {
+    auto const [start, end] = bounds(i);
+    return (op == aggregation::COUNT_VALID ? end - start : d_valid[end] - d_valid[start]) >=
+           min_periods;
+  };
+
+  if constexpr (op == aggregation::COUNT_VALID) {
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      out_begin,
+                      [bounds, d_valid = valid_prefix.data()] __device__(size_type i) {
+                        auto const [start, end] = bounds(i);
+                        return static_cast<OutType>(d_valid[end] - d_valid[start]);
+                      });
+  } else if constexpr (op == aggregation::SUM) {
+    rmm::device_uvector<uint64_t> sum_prefix(num_rows + 1, stream);
+    auto const values = cudf::detail::make_counting_transform_iterator(
+      0, [d_input = *d_input, num_rows] __device__(size_type i) -> uint64_t {
+        if (i >= num_rows || d_input.is_null(i)) { return 0; }
+        return static_cast<uint64_t>(static_cast<int64_t>(d_input.element<InputType>(i)));
+      });
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), values, values + num_rows + 1, sum_prefix.begin());
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      out_begin,
+                      [bounds, d_sum = sum_prefix.data()] __device__(size_type i) {
+                        auto const [start, end] = bounds(i);
+                        auto const sum          = d_sum[end] - d_sum[start];
+                        return static_cast<OutType>(static_cast<int64_t>(sum));
+                      });
+  } else {
+    using AggOp         = typename corresponding_operator<op>::type;
+    auto const identity = AggOp::template identity<OutType>();
+
+    // level k holds the aggregate of the rows [i, i + 2^k) clamped to the column
+    auto num_levels = 1;
+    while ((size_type{1} << num_levels) <= max_window) {
+      ++num_levels;
+    }
+    rmm::device_uvector<OutType> table(static_cast<std::size_t>(num_rows) * num_levels, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      table.begin(),
+                      [d_input = *d_input, identity] __device__(size_type i) {
+                        if (d_input.is_null(i)) { return identity; }
+                        return static_cast<OutType>(d_input.element<InputType>(i));
+                      });
+    for (int level = 1; level < num_levels; ++level) {
+      auto const prev = table.data() + static_cast<std::size_t>(num_rows) * (level - 1);
+      auto const half = size_type{1} << (level - 1);
+      thrust::transform(rmm::exec_policy(stream),
+                        rows,
+                        rows + num_rows,
+                        prev + num_rows,
+                        [prev, half, num_rows] __device__(size_type i) {
+                          return i + half < num_rows ? AggOp{}(prev[i], prev[i + half]) : prev[i];
+                        });
+    }
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      out_begin,
+                      [bounds, identity, d_table = table.data(), num_rows] __device__(size_type i) {
+                        auto const [start, end] = bounds(i);
+                        if (start == end) { return identity; }
+                        auto const level = 31 - __clz(end - start);
+                        auto const d_level = d_table + static_cast<std::size_t>(num_rows) * level;
+                        return AggOp{}(d_level[start], d_level[end - (size_type{1} << level)]);
+                      });
+  }
+
+  auto [null_mask, null_count] =
+    cudf::detail::valid_if(rows, rows + num_rows, is_valid, stream, mr);
+  output->set_null_mask(std::move(null_mask), null_count);
+  return output;
+}
+
+}  // namespace detail
+}  // namespace cudf
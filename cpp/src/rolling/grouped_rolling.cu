@@ -34,6 +34,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/partition.h>
 
+#include <algorithm>
+
 namespace cudf {
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                                column_view const& input,
@@ -292,11 +294,10 @@ std::tuple<size_type, size_type> get_null_bounds_for_orderby_column(
 template <typename Calculator>
 std::unique_ptr<column> expand_to_column(Calculator const& calc,
                                          size_type const& num_rows,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+                                         rmm::cuda_stream_view stream)
 {
   auto window_column = cudf::make_fixed_width_column(
-    cudf::data_type{type_id::INT32}, num_rows, cudf::mask_state::UNALLOCATED, stream, mr);
+    cudf::data_type{type_id::INT32}, num_rows, cudf::mask_state::UNALLOCATED, stream);
 
   auto begin = cudf::detail::make_counting_transform_iterator(0, calc);
 
@@ -306,21 +307,21 @@ std::unique_ptr<column> expand_to_column(Calculator const& calc,
   return window_column;
 }
 
+/// Preceding and following window sizes of every row, shared by all the aggregations
+/// computed over the same window.
+using window_bounds_columns = std::pair<std::unique_ptr<column>, std::unique_ptr<column>>;
+
 /// Range window computation, with
 ///   1. no grouping keys specified
 ///   2. rows in ASCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+window_bounds_columns range_window_ASC(column_view const& orderby_column,
+                                       T preceding_window,
+                                       bool preceding_window_is_unbounded,
+                                       T following_window,
+                                       bool following_window_is_unbounded,
+                                       rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -356,12 +357,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -387,10 +388,9 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Given an orderby column grouped as specified in group_offsets,
@@ -473,18 +473,14 @@ get_null_bounds_for_orderby_column(column_view const& orderby_column,
 
 // Range window computation, for orderby column in ASCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_ASC(column_view const& input,
-                                         column_view const& orderby_column,
-                                         rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                         rmm::device_uvector<cudf::size_type> const& group_labels,
-                                         T preceding_window,
-                                         bool preceding_window_is_unbounded,
-                                         T following_window,
-                                         bool following_window_is_unbounded,
-                                         size_type min_periods,
-                                         rolling_aggregation const& aggr,
-                                         rmm::cuda_stream_view stream,
-                                         rmm::mr::device_memory_resource* mr)
+window_bounds_columns range_window_ASC(column_view const& orderby_column,
+                                       rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                       rmm::device_uvector<cudf::size_type> const& group_labels,
+                                       T preceding_window,
+                                       bool preceding_window_is_unbounded,
+                                       T following_window,
+                                       bool following_window_is_unbounded,
+                                       rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -527,7 +523,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -540,7 +536,7 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
     auto group_label = d_group_labels[idx];
     auto group_start = d_group_offsets[group_label];
     auto group_end   = d_group_offsets[group_label + 1];  // Cannot fall off the end, since offsets
-                                                          // is capped with `input.size()`.
+                                                          // is capped with `orderby_column.size()`.
     auto nulls_begin = d_nulls_begin[group_label];
     auto nulls_end   = d_nulls_end[group_label];
 
@@ -568,10 +564,9 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 /// Range window computation, with
@@ -579,16 +574,12 @@ std::unique_ptr<column> range_window_ASC(column_view const& input,
 ///   2. rows in DESCENDING order.
 /// Treat as one single group.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+window_bounds_columns range_window_DESC(column_view const& orderby_column,
+                                        T preceding_window,
+                                        bool preceding_window_is_unbounded,
+                                        T following_window,
+                                        bool following_window_is_unbounded,
+                                        rmm::cuda_stream_view stream)
 {
   auto [h_nulls_begin_idx, h_nulls_end_idx] = get_null_bounds_for_orderby_column(orderby_column);
 
@@ -626,12 +617,12 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto following_calculator =
     [nulls_begin_idx = h_nulls_begin_idx,
      nulls_end_idx   = h_nulls_end_idx,
-     num_rows        = input.size(),
+     num_rows        = orderby_column.size(),
      d_orderby       = orderby_column.data<T>(),
      following_window,
      following_window_is_unbounded] __device__(size_type idx) -> size_type {
@@ -660,26 +651,21 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  return cudf::detail::rolling_window(
-    input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 // Range window computation, for rows in DESCENDING order.
 template <typename T>
-std::unique_ptr<column> range_window_DESC(column_view const& input,
-                                          column_view const& orderby_column,
-                                          rmm::device_uvector<cudf::size_type> const& group_offsets,
-                                          rmm::device_uvector<cudf::size_type> const& group_labels,
-                                          T preceding_window,
-                                          bool preceding_window_is_unbounded,
-                                          T following_window,
-                                          bool following_window_is_unbounded,
-                                          size_type min_periods,
-                                          rolling_aggregation const& aggr,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::mr::device_memory_resource* mr)
+window_bounds_columns range_window_DESC(column_view const& orderby_column,
+                                        rmm::device_uvector<cudf::size_type> const& group_offsets,
+                                        rmm::device_uvector<cudf::size_type> const& group_labels,
+                                        T preceding_window,
+                                        bool preceding_window_is_unbounded,
+                                        T following_window,
+                                        bool following_window_is_unbounded,
+                                        rmm::cuda_stream_view stream)
 {
   auto [null_start, null_end] =
     get_null_bounds_for_orderby_column(orderby_column, group_offsets, stream);
@@ -724,7 +710,7 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;  // Add 1, for `preceding` to account for current row.
   };
 
-  auto preceding_column = expand_to_column(preceding_calculator, input.size(), stream, mr);
+  auto preceding_column = expand_to_column(preceding_calculator, orderby_column.size(), stream);
 
   auto following_calculator =
     [d_group_offsets = group_offsets.data(),
@@ -767,86 +753,61 @@ std::unique_ptr<column> range_window_DESC(column_view const& input,
            1;
   };
 
-  auto following_column = expand_to_column(following_calculator, input.size(), stream, mr);
+  auto following_column = expand_to_column(following_calculator, orderby_column.size(), stream);
 
-  if (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX) {
-    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
-  } else {
-    return cudf::detail::rolling_window(
-      input, preceding_column->view(), following_column->view(), min_periods, aggr, stream, mr);
-  }
+  return {std::move(preceding_column), std::move(following_column)};
 }
 
 template <typename OrderByT>
-std::unique_ptr<column> grouped_range_rolling_window_impl(
-  column_view const& input,
+window_bounds_columns range_window_bounds_impl(
   column_view const& orderby_column,
   cudf::order const& timestamp_ordering,
   rmm::device_uvector<cudf::size_type> const& group_offsets,
   rmm::device_uvector<cudf::size_type> const& group_labels,
   range_window_bounds const& preceding_window,
   range_window_bounds const& following_window,
-  size_type min_periods,
-  rolling_aggregation const& aggr,
-  rmm::cuda_stream_view stream,
-  rmm::mr::device_memory_resource* mr)
+  rmm::cuda_stream_view stream)
 {
   auto preceding_value = detail::range_comparable_value<OrderByT>(preceding_window);
   auto following_value = detail::range_comparable_value<OrderByT>(following_window);
 
   if (timestamp_ordering == cudf::order::ASCENDING) {
-    return group_offsets.is_empty() ? range_window_ASC(input,
-                                                       orderby_column,
+    return group_offsets.is_empty() ? range_window_ASC(orderby_column,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr)
-                                    : range_window_ASC(input,
-                                                       orderby_column,
+                                                       stream)
+                                    : range_window_ASC(orderby_column,
                                                        group_offsets,
                                                        group_labels,
                                                        preceding_value,
                                                        preceding_window.is_unbounded(),
                                                        following_value,
                                                        following_window.is_unbounded(),
-                                                       min_periods,
-                                                       aggr,
-                                                       stream,
-                                                       mr);
+                                                       stream);
   } else {
-    return group_offsets.is_empty() ? range_window_DESC(input,
-                                                        orderby_column,
+    return group_offsets.is_empty() ? range_window_DESC(orderby_column,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr)
-                                    : range_window_DESC(input,
-                                                        orderby_column,
+                                                        stream)
+                                    : range_window_DESC(orderby_column,
                                                         group_offsets,
                                                         group_labels,
                                                         preceding_value,
                                                         preceding_window.is_unbounded(),
                                                         following_value,
                                                         following_window.is_unbounded(),
-                                                        min_periods,
-                                                        aggr,
-                                                        stream,
-                                                        mr);
+                                                        stream);
   }
 }
 
-struct dispatch_grouped_range_rolling_window {
+struct dispatch_range_window_bounds {
   template <typename OrderByColumnType, typename... Args>
   std::enable_if_t<!detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
+                   window_bounds_columns>
   operator()(Args&&...) const
   {
     CUDF_FAIL("Unsupported OrderBy column type.");
@@ -854,33 +815,78 @@ struct dispatch_grouped_range_rolling_window {
 
   template <typename OrderByColumnType>
   std::enable_if_t<detail::is_supported_order_by_column_type<OrderByColumnType>(),
-                   std::unique_ptr<column>>
-  operator()(column_view const& input,
-             column_view const& orderby_column,
+                   window_bounds_columns>
+  operator()(column_view const& orderby_column,
              cudf::order const& timestamp_ordering,
              rmm::device_uvector<cudf::size_type> const& group_offsets,
              rmm::device_uvector<cudf::size_type> const& group_labels,
              range_window_bounds const& preceding_window,
              range_window_bounds const& following_window,
-             size_type min_periods,
-             rolling_aggregation const& aggr,
-             rmm::cuda_stream_view stream,
-             rmm::mr::device_memory_resource* mr) const
+             rmm::cuda_stream_view stream) const
   {
-    return grouped_range_rolling_window_impl<OrderByColumnType>(input,
-                                                                orderby_column,
-                                                                timestamp_ordering,
-                                                                group_offsets,
-                                                                group_labels,
-                                                                preceding_window,
-                                                                following_window,
-                                                                min_periods,
-                                                                aggr,
-                                                                stream,
-                                                                mr);
+    return range_window_bounds_impl<OrderByColumnType>(orderby_column,
+                                                       timestamp_ordering,
+                                                       group_offsets,
+                                                       group_labels,
+                                                       preceding_window,
+                                                       following_window,
+                                                       stream);
   }
 };
 
+/**
+ * @brief Computes the preceding and following window sizes of every row for range windows over
+ * the groups of `group_keys` ordered by `orderby_column`.
+ */
+window_bounds_columns range_window_bounds_columns(table_view const& group_keys,
+                                                  column_view const& orderby_column,
+                                                  cudf::order const& order,
+                                                  range_window_bounds const& preceding,
+                                                  range_window_bounds const& following,
+                                                  rmm::cuda_stream_view stream)
+{
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  using index_vector        = sort_groupby_helper::index_vector;
+
+  index_vector group_offsets(0, stream), group_labels(0, stream);
+  if (group_keys.num_columns() > 0) {
+    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
+    group_offsets = index_vector(helper.group_offsets(stream), stream);
+    group_labels  = index_vector(helper.group_labels(stream), stream);
+  }
+
+  return cudf::type_dispatcher(orderby_column.type(),
+                               dispatch_range_window_bounds{},
+                               orderby_column,
+                               order,
+                               group_offsets,
+                               group_labels,
+                               preceding,
+                               following,
+                               stream);
+}
+
+/**
+ * @brief Applies `aggr` to `input` over the range windows computed by
+ * `range_window_bounds_columns`.
+ */
+std::unique_ptr<column> range_rolling_window(column_view const& input,
+                                             window_bounds_columns const& bounds,
+                                             bool is_grouped,
+                                             cudf::order const& order,
+                                             size_type min_periods,
+                                             rolling_aggregation const& aggr,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  if (is_grouped && order == cudf::order::DESCENDING &&
+      (aggr.kind == aggregation::CUDA || aggr.kind == aggregation::PTX)) {
+    CUDF_FAIL("Ranged rolling window does NOT (yet) support UDF.");
+  }
+  return cudf::detail::rolling_window(
+    input, bounds.first->view(), bounds.second->view(), min_periods, aggr, stream, mr);
+}
+
 /**
  * @brief Functor to convert from size_type (number of days) to appropriate duration type.
  */
@@ -985,29 +991,76 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
 
   CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
 
-  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
-  using index_vector        = sort_groupby_helper::index_vector;
+  auto const bounds =
+    range_window_bounds_columns(group_keys, order_by_column, order, preceding, following, stream);
+  return range_rolling_window(
+    input, bounds, group_keys.num_columns() > 0, order, min_periods, aggr, stream, mr);
+}
 
-  index_vector group_offsets(0, stream), group_labels(0, stream);
-  if (group_keys.num_columns() > 0) {
-    sort_groupby_helper helper{group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES};
-    group_offsets = index_vector(helper.group_offsets(stream), stream);
-    group_labels  = index_vector(helper.group_labels(stream), stream);
+/**
+ * @copydoc std::vector<std::vector<std::unique_ptr<column>>> grouped_range_rolling_window(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               std::vector<rolling_request> const& requests,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               size_type min_periods,
+ *               rmm::mr::device_memory_resource* mr );
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::vector<std::vector<std::unique_ptr<column>>> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& order_by_column,
+  cudf::order const& order,
+  std::vector<rolling_request> const& requests,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  size_type min_periods,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == order_by_column.size()),
+               "Size mismatch between group_keys and orderby column.");
+  CUDF_EXPECTS(std::all_of(requests.cbegin(),
+                           requests.cend(),
+                           [&](auto const& request) {
+                             return request.values.size() == order_by_column.size();
+                           }),
+               "Size mismatch between the requests and orderby column.");
+
+  CUDF_EXPECTS((min_periods > 0), "min_periods must be positive");
+
+  std::vector<std::vector<std::unique_ptr<column>>> results(requests.size());
+  if (order_by_column.is_empty()) {
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      for (auto const& aggr : requests[i].aggregations) {
+        results[i].push_back(
+          cudf::detail::empty_output_for_rolling_aggregation(requests[i].values, *aggr));
+      }
+    }
+    return results;
   }
 
-  return cudf::type_dispatcher(order_by_column.type(),
-                               dispatch_grouped_range_rolling_window{},
-                               input,
-                               order_by_column,
-                               order,
-                               group_offsets,
-                               group_labels,
-                               preceding,
-                               following,
-                               min_periods,
-                               aggr,
-                               stream,
-                               mr);
+  // the window bounds depend only on the groups and the order-by column
+  auto const bounds =
+    range_window_bounds_columns(group_keys, order_by_column, order, preceding, following, stream);
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (auto const& aggr : requests[i].aggregations) {
+      results[i].push_back(range_rolling_window(requests[i].values,
+                                                bounds,
+                                                group_keys.num_columns() > 0,
+                                                order,
+                                                min_periods,
+                                                *aggr,
+                                                stream,
+                                                mr));
+    }
+  }
+  return results;
 }
 
 }  // namespace detail
@@ -1121,4 +1174,36 @@ std::unique_ptr<column> grouped_range_rolling_window(table_view const& group_key
                                               mr);
 }
 
+/**
+ * @copydoc grouped_range_rolling_window(
+ *               table_view const& group_keys,
+ *               column_view const& orderby_column,
+ *               cudf::order const& order,
+ *               std::vector<rolling_request> const& requests,
+ *               range_window_bounds const& preceding,
+ *               range_window_bounds const& following,
+ *               size_type min_periods,
+ *               rmm::mr::device_memory_resource* mr );
+ */
+std::vector<std::vector<std::unique_ptr<column>>> grouped_range_rolling_window(
+  table_view const& group_keys,
+  column_view const& orderby_column,
+  cudf::order const& order,
+  std::vector<rolling_request> const& requests,
+  range_window_bounds const& preceding,
+  range_window_bounds const& following,
+  size_type min_periods,
+  rmm::mr::device_memory_resource* mr)
+{
+  return detail::grouped_range_rolling_window(group_keys,
+                                              orderby_column,
+                                              order,
+                                              requests,
+                                              preceding,
+                                              following,
+                                              min_periods,
+                                              cudf::default_stream_value,
+                                              mr);
+}
+
 }  // namespace cudf
@@ -17,10 +17,13 @@
 #include "detail/rolling.cuh"
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <vector>
+
 namespace cudf {
 
 // Applies a fixed-size rolling window function to the values in a column, with default output
@@ -69,4 +72,23 @@ std::unique_ptr<column> rolling_window(column_view const& input,
     input, preceding_window, following_window, min_periods, agg, cudf::default_stream_value, mr);
 }
 
+void precompile_rolling_window_udfs(std::vector<rolling_udf_signature> const& signatures)
+{
+  CUDF_FUNC_RANGE();
+  for (auto const& signature : signatures) {
+    auto const agg = make_udf_aggregation<rolling_aggregation>(
+      signature.type, signature.source, signature.output_type);
+    auto const& udf_agg = dynamic_cast<detail::udf_aggregation const&>(*agg);
+    // the window types of fixed, variable and grouped rolling windows
+    detail::get_rolling_udf_kernel(
+      signature.input_type, udf_agg, "cudf::size_type", "cudf::size_type");
+    detail::get_rolling_udf_kernel(
+      signature.input_type, udf_agg, "cudf::size_type*", "cudf::size_type*");
+    detail::get_rolling_udf_kernel(signature.input_type,
+                                   udf_agg,
+                                   "cudf::detail::preceding_window_wrapper",
+                                   "cudf::detail::following_window_wrapper");
+  }
+}
+
 }  // namespace cudf
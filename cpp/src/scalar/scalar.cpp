@@ -17,6 +17,8 @@
 #include <cudf/column/column.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/small_allocation.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/string_view.hpp>
@@ -35,14 +37,15 @@ scalar::scalar(data_type type,
                bool is_valid,
                rmm::cuda_stream_view stream,
                rmm::mr::device_memory_resource* mr)
-  : _type(type), _is_valid(is_valid, stream, mr)
+  : _type(type), _is_valid(is_valid, stream, detail::small_allocation_resource(sizeof(bool), mr))
 {
 }
 
 scalar::scalar(scalar const& other,
                rmm::cuda_stream_view stream,
                rmm::mr::device_memory_resource* mr)
-  : _type(other.type()), _is_valid(other._is_valid, stream, mr)
+  : _type(other.type()),
+    _is_valid(other._is_valid, stream, detail::small_allocation_resource(sizeof(bool), mr))
 {
 }
 
@@ -64,14 +67,18 @@ string_scalar::string_scalar(std::string const& string,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
   : scalar(data_type(type_id::STRING), is_valid, stream, mr),
-    _data(string.data(), string.size(), stream, mr)
+    _data(string.data(),
+          string.size(),
+          stream,
+          detail::small_allocation_resource(string.size(), mr))
 {
 }
 
 string_scalar::string_scalar(string_scalar const& other,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
-  : scalar(other, stream, mr), _data(other._data, stream, mr)
+  : scalar(other, stream, mr),
+    _data(other._data, stream, detail::small_allocation_resource(other._data.size(), mr))
 {
 }
 
@@ -88,7 +95,10 @@ string_scalar::string_scalar(value_type const& source,
                              rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
   : scalar(data_type(type_id::STRING), is_valid, stream, mr),
-    _data(source.data(), source.size_bytes(), stream, mr)
+    _data(source.data(),
+          source.size_bytes(),
+          stream,
+          detail::small_allocation_resource(source.size_bytes(), mr))
 {
 }
 
@@ -117,7 +127,7 @@ std::string string_scalar::to_string(rmm::cuda_stream_view stream) const
   result.resize(_data.size());
   CUDF_CUDA_TRY(cudaMemcpyAsync(
     &result[0], _data.data(), _data.size(), cudaMemcpyDeviceToHost, stream.value()));
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
   return result;
 }
 
@@ -128,7 +138,7 @@ fixed_point_scalar<T>::fixed_point_scalar(rep_type value,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
   : scalar{data_type{type_to_id<T>(), static_cast<int32_t>(scale)}, is_valid, stream, mr},
-    _data{value, stream, mr}
+    _data{value, stream, detail::small_allocation_resource(sizeof(rep_type), mr)}
 {
 }
 
@@ -137,7 +147,8 @@ fixed_point_scalar<T>::fixed_point_scalar(rep_type value,
                                           bool is_valid,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
-  : scalar{data_type{type_to_id<T>(), 0}, is_valid, stream, mr}, _data{value, stream, mr}
+  : scalar{data_type{type_to_id<T>(), 0}, is_valid, stream, mr},
+    _data{value, stream, detail::small_allocation_resource(sizeof(rep_type), mr)}
 {
 }
 
@@ -147,7 +158,7 @@ fixed_point_scalar<T>::fixed_point_scalar(T value,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
   : scalar{data_type{type_to_id<T>(), value.scale()}, is_valid, stream, mr},
-    _data{value.value(), stream, mr}
+    _data{value.value(), stream, detail::small_allocation_resource(sizeof(rep_type), mr)}
 {
 }
 
@@ -165,7 +176,8 @@ template <typename T>
 fixed_point_scalar<T>::fixed_point_scalar(fixed_point_scalar<T> const& other,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
-  : scalar{other, stream, mr}, _data(other._data, stream, mr)
+  : scalar{other, stream, mr},
+    _data(other._data, stream, detail::small_allocation_resource(sizeof(rep_type), mr))
 {
 }
 
@@ -220,7 +232,8 @@ fixed_width_scalar<T>::fixed_width_scalar(T value,
                                           bool is_valid,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
-  : scalar(data_type(type_to_id<T>()), is_valid, stream, mr), _data(value, stream, mr)
+  : scalar(data_type(type_to_id<T>()), is_valid, stream, mr),
+    _data(value, stream, detail::small_allocation_resource(sizeof(T), mr))
 {
 }
 
@@ -237,7 +250,8 @@ template <typename T>
 fixed_width_scalar<T>::fixed_width_scalar(fixed_width_scalar<T> const& other,
                                           rmm::cuda_stream_view stream,
                                           rmm::mr::device_memory_resource* mr)
-  : scalar{other, stream, mr}, _data(other._data, stream, mr)
+  : scalar{other, stream, mr},
+    _data(other._data, stream, detail::small_allocation_resource(sizeof(T), mr))
 {
 }
 
@@ -14,8 +14,6 @@
  * limitations under the License.
  */
 
-#include <hash/unordered_multiset.cuh>
-
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
@@ -30,10 +28,9 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
 #include <thrust/count.h>
-#include <thrust/iterator/counting_iterator.h>
 #include <thrust/pair.h>
-#include <thrust/transform.h>
 #include <thrust/uninitialized_fill.h>
 
 namespace cudf {
@@ -151,30 +148,16 @@ struct multi_contains_dispatch {
       return result;
     }
 
-    auto const haystack_set    = cudf::detail::unordered_multiset<Type>::create(haystack, stream);
-    auto const needles_cdv_ptr = column_device_view::create(needles, stream);
-    auto const needles_it      = thrust::make_counting_iterator<size_type>(0);
-
-    if (needles.has_nulls()) {
-      thrust::transform(rmm::exec_policy(stream),
-                        needles_it,
-                        needles_it + needles.size(),
-                        out_begin,
-                        [haystack = haystack_set.to_device(),
-                         needles  = *needles_cdv_ptr] __device__(size_type const idx) {
-                          return needles.is_null_nocheck(idx) ||
-                                 haystack.contains(needles.template element<Type>(idx));
-                        });
-    } else {
-      thrust::transform(rmm::exec_policy(stream),
-                        needles_it,
-                        needles_it + needles.size(),
-                        out_begin,
-                        [haystack = haystack_set.to_device(),
-                         needles  = *needles_cdv_ptr] __device__(size_type const index) {
-                          return haystack.contains(needles.template element<Type>(index));
-                        });
-    }
+    // Null haystack elements are never found. NaNs are never found either, as they compare unequal
+    // to all elements.
+    auto const compare_nans =
+      std::is_floating_point_v<Type> ? nan_equality::UNEQUAL : nan_equality::ALL_EQUAL;
+    auto const contained = cudf::detail::contains(table_view{{haystack}},
+                                                  table_view{{needles}},
+                                                  null_equality::UNEQUAL,
+                                                  compare_nans,
+                                                  stream);
+    thrust::copy(rmm::exec_policy(stream), contained.begin(), contained.end(), out_begin);
 
     return result;
   }
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/search.hpp>
+#include <cudf/table/row_operators.cuh>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Assigns to every node of an Eytzinger layout of `ranks.size() - 1` sorted elements the
+ * index of the element stored at the node.
+ *
+ * The nodes are visited by an in-order traversal of the implicit binary tree rooted at node 1,
+ * whose node `i` has the children `2 * i` and `2 * i + 1`.
+ *
+ * @return The index of the element after the last one assigned in the subtree of `node`
+ */
+size_type assign_eytzinger_ranks(std::vector<size_type>& ranks, std::size_t node, size_type rank)
+{
+  if (node < ranks.size()) {
+    rank        = assign_eytzinger_ranks(ranks, 2 * node, rank);
+    ranks[node] = rank++;
+    rank        = assign_eytzinger_ranks(ranks, 2 * node + 1, rank);
+  }
+  return rank;
+}
+
+/**
+ * @brief Copies the non-null elements of a sorted column in Eytzinger order.
+ */
+struct eytzinger_keys_fn {
+  template <typename T, CUDF_ENABLE_IF(is_fixed_width<T>())>
+  rmm::device_buffer operator()(column_view const& haystack,
+                                size_type offset,
+                                rmm::device_uvector<size_type> const& ranks,
+                                rmm::cuda_stream_view stream) const
+  {
+    rmm::device_buffer keys(ranks.size() * sizeof(T), stream);
+    thrust::gather(rmm::exec_policy(stream),
+                   ranks.begin() + 1,
+                   ranks.end(),
+                   haystack.begin<T>() + offset,
+                   static_cast<T*>(keys.data()) + 1);
+    return keys;
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_fixed_width<T>())>
+  rmm::device_buffer operator()(Args&&...) const
+  {
+    CUDF_FAIL("Sorted searcher supports only fixed-width types");
+  }
+};
+
+/**
+ * @brief The type independent parameters of a search in an Eytzinger layout.
+ */
+struct search_parameters {
+  void const* keys;        ///< The non-null elements of the haystack, from index 1
+  size_type const* ranks;  ///< The haystack index of every key, the number of keys at index 0
+  size_type num_keys;      ///< The number of non-null elements of the haystack
+  bool find_first;         ///< Whether to search for the lower bound rather than the upper
+  bool descending;         ///< Whether the haystack is sorted in descending order
+  size_type null_offset;   ///< The haystack index of the first non-null element
+  size_type null_lower;    ///< The lower bound of a null needle
+  size_type null_upper;    ///< The upper bound of a null needle
+};
+
+template <typename T>
+struct eytzinger_search_fn {
+  search_parameters params;
+  column_device_view needles;
+
+  /**
+   * @brief Returns whether the bound of `needle` is after `key` in the haystack.
+   */
+  __device__ bool goes_right(T key, T needle) const noexcept
+  {
+    auto const state =
+      params.descending ? relational_compare(needle, key) : relational_compare(key, needle);
+    return params.find_first ? state == weak_ordering::LESS : state != weak_ordering::GREATER;
+  }
+
+  __device__ size_type operator()(size_type i) const noexcept
+  {
+    if (needles.is_null(i)) { return params.find_first ? params.null_lower : params.null_upper; }
+
+    auto const keys   = static_cast<T const*>(params.keys);
+    auto const needle = needles.element<T>(i);
+    int64_t node      = 1;
+    while (node <= params.num_keys) {
+      node = 2 * node + goes_right(keys[node], needle);
+    }
+    // Undo the right turns taken after the last left turn, and that left turn itself, to find
+    // the node of the bound; the root is undone if the bound is past the last key
+    node >>= __ffsll(~node);
+    return params.null_offset + params.ranks[node];
+  }
+};
+
+struct eytzinger_search_dispatch {
+  template <typename T, CUDF_ENABLE_IF(is_fixed_width<T>())>
+  void operator()(search_parameters const& params,
+                  column_device_view const& needles,
+                  size_type* out,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(needles.size()),
+                      out,
+                      eytzinger_search_fn<T>{params, needles});
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(not is_fixed_width<T>())>
+  void operator()(Args&&...) const
+  {
+    CUDF_FAIL("Sorted searcher supports only fixed-width types");
+  }
+};
+
+}  // namespace
+
+class sorted_searcher {
+ public:
+  sorted_searcher(column_view const& haystack,
+                  order column_order,
+                  null_order null_precedence,
+                  rmm::cuda_stream_view stream)
+    : _type{haystack.type()},
+      _descending{column_order == order::DESCENDING},
+      _num_rows{haystack.size()},
+      _null_count{haystack.null_count()},
+      _nulls_first{(column_order == order::ASCENDING) == (null_precedence == null_order::BEFORE)},
+      _ranks{0, stream}
+  {
+    CUDF_EXPECTS(is_fixed_width(_type), "Sorted searcher supports only fixed-width types");
+
+    std::vector<size_type> ranks(_num_rows - _null_count + 1);
+    ranks.front() = _num_rows - _null_count;
+    assign_eytzinger_ranks(ranks, 1, 0);
+    _ranks = cudf::detail::make_device_uvector_sync(ranks, stream);
+
+    _keys = type_dispatcher<dispatch_storage_type>(
+      _type, eytzinger_keys_fn{}, haystack, _nulls_first ? _null_count : 0, _ranks, stream);
+  }
+
+  std::unique_ptr<column> search(column_view const& needles,
+                                 bool find_first,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr) const
+  {
+    CUDF_EXPECTS(needles.type() == _type, "Mismatched column types");
+
+    auto result = make_numeric_column(
+      data_type{type_to_id<size_type>()}, needles.size(), mask_state::UNALLOCATED, stream, mr);
+
+    auto const num_keys = _num_rows - _null_count;
+    auto const params   = search_parameters{_keys.data(),
+                                          _ranks.data(),
+                                          num_keys,
+                                          find_first,
+                                          _descending,
+                                          _nulls_first ? _null_count : 0,
+                                          _nulls_first ? 0 : num_keys,
+                                          _nulls_first ? _null_count : _num_rows};
+    auto const d_needles = column_device_view::create(needles, stream);
+    type_dispatcher<dispatch_storage_type>(_type,
+                                           eytzinger_search_dispatch{},
+                                           params,
+                                           *d_needles,
+                                           result->mutable_view().data<size_type>(),
+                                           stream);
+    return result;
+  }
+
+ private:
+  data_type _type;
+  bool _descending;
+  size_type _num_rows;
+  size_type _null_count;
+  bool _nulls_first;
+  rmm::device_buffer _keys;
+  rmm::device_uvector<size_type> _ranks;
+};
+
+}  // namespace detail
+
+sorted_searcher::~sorted_searcher() = default;
+
+sorted_searcher::sorted_searcher(column_view const& haystack,
+                                 order column_order,
+                                 null_order null_precedence,
+                                 rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<const impl_type>(haystack, column_order, null_precedence, stream)}
+{
+}
+
+std::unique_ptr<column> sorted_searcher::lower_bound(column_view const& needles,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(needles, true, stream, mr);
+}
+
+std::unique_ptr<column> sorted_searcher::upper_bound(column_view const& needles,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->search(needles, false, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/merge.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/host_vector.h>
+#include <thrust/system/cuda/experimental/pinned_allocator.h>
+
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+namespace cudf {
+namespace {
+
+using pinned_buffer =
+  thrust::host_vector<uint8_t, thrust::system::cuda::experimental::pinned_allocator<uint8_t>>;
+
+/**
+ * @brief A packed chunk of a sorted run held in host memory.
+ */
+struct host_chunk {
+  std::vector<uint8_t> metadata;  ///< Host-side metadata of the packed table
+  pinned_buffer data;             ///< Contiguous device data of the packed table
+};
+
+/**
+ * @brief Packs `input` and copies its device data to pinned host memory.
+ */
+host_chunk spill(table_view const& input, rmm::cuda_stream_view stream)
+{
+  auto packed = detail::pack(input, stream, rmm::mr::get_current_device_resource());
+  host_chunk chunk;
+  chunk.metadata.assign(packed.metadata_->data(),
+                        packed.metadata_->data() + packed.metadata_->size());
+  chunk.data.resize(packed.gpu_data->size());
+  CUDF_CUDA_TRY(cudaMemcpyAsync(chunk.data.data(),
+                                packed.gpu_data->data(),
+                                packed.gpu_data->size(),
+                                cudaMemcpyDeviceToHost,
+                                stream.value()));
+  cudf::detail::synchronize_stream(stream);
+  return chunk;
+}
+
+/**
+ * @brief Copies a spilled chunk back to the device as a table.
+ */
+std::unique_ptr<table> load(host_chunk const& chunk, rmm::cuda_stream_view stream)
+{
+  rmm::device_buffer gpu_data(chunk.data.size(), stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    gpu_data.data(), chunk.data.data(), chunk.data.size(), cudaMemcpyHostToDevice, stream.value()));
+  auto const view = unpack(chunk.metadata.data(), static_cast<uint8_t const*>(gpu_data.data()));
+  auto result     = std::make_unique<table>(view, stream);
+  cudf::detail::synchronize_stream(stream);
+  return result;
+}
+
+}  // namespace
+
+struct external_sorter::sorted_run {
+  std::deque<host_chunk> chunks;  ///< Spilled chunks not loaded on the device yet
+  std::unique_ptr<table> window;  ///< Rows of the run on the device not emitted yet
+};
+
+external_sorter::~external_sorter() = default;
+
+external_sorter::external_sorter(std::vector<size_type> key_indices,
+                                 std::vector<order> column_order,
+                                 std::vector<null_order> null_precedence,
+                                 size_type chunk_rows)
+  : _key_indices{std::move(key_indices)},
+    _column_order{std::move(column_order)},
+    _null_precedence{std::move(null_precedence)},
+    _chunk_rows{chunk_rows}
+{
+  CUDF_EXPECTS(_chunk_rows > 0, "chunk_rows must be positive");
+  CUDF_EXPECTS(_column_order.empty() || _column_order.size() == _key_indices.size(),
+               "Mismatch between number of key columns and column_order size.");
+  CUDF_EXPECTS(_null_precedence.empty() || _null_precedence.size() == _key_indices.size(),
+               "Mismatch between number of key columns and null_precedence size.");
+  if (_column_order.empty()) { _column_order.resize(_key_indices.size(), order::ASCENDING); }
+  if (_null_precedence.empty()) {
+    _null_precedence.resize(_key_indices.size(), null_order::BEFORE);
+  }
+}
+
+void external_sorter::push(table_view const& input,
+                           rmm::cuda_stream_view stream,
+                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _finished, "Cannot push to an external_sorter after finish");
+  std::vector<data_type> types(input.num_columns());
+  std::transform(
+    input.begin(), input.end(), types.begin(), [](auto const& col) { return col.type(); });
+  if (_types.empty()) {
+    _types = std::move(types);
+  } else {
+    CUDF_EXPECTS(_types == types, "Pushed tables must have the same column types");
+  }
+  if (input.num_rows() == 0) { return; }
+
+  auto const sorted = detail::stable_sort_by_key(
+    input, input.select(_key_indices), _column_order, _null_precedence, stream, mr);
+
+  auto run = std::make_unique<sorted_run>();
+  std::vector<size_type> splits;
+  for (size_type row = _chunk_rows; row < sorted->num_rows(); row += _chunk_rows) {
+    splits.push_back(row);
+  }
+  for (auto const& chunk : split(sorted->view(), splits)) {
+    run->chunks.push_back(spill(chunk, stream));
+  }
+  _runs.push_back(std::move(run));
+}
+
+void external_sorter::finish(chunk_callback const& emit,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not _finished, "external_sorter::finish may only be called once");
+  _finished = true;
+
+  auto emit_chunks = [&](table_view const& sorted) {
+    for (size_type row = 0; row < sorted.num_rows(); row += _chunk_rows) {
+      auto const end = std::min(row + _chunk_rows, sorted.num_rows());
+      emit(std::make_unique<table>(slice(sorted, {row, end}).front(), stream, mr));
+    }
+  };
+
+  while (true) {
+    // keep one chunk of every unfinished run on the device
+    std::vector<sorted_run*> active;
+    for (auto& run : _runs) {
+      if ((!run->window || run->window->num_rows() == 0) && !run->chunks.empty()) {
+        run->window = load(run->chunks.front(), stream);
+        run->chunks.pop_front();
+      }
+      if (run->window && run->window->num_rows() > 0) { active.push_back(run.get()); }
+    }
+    if (active.empty()) { break; }
+
+    // Every row not exceeding the smallest last row among the runs that still have chunks in
+    // host memory precedes all the rows not loaded yet, so those rows can be emitted.
+    std::vector<table_view> last_rows;
+    for (auto run : active) {
+      if (run->chunks.empty()) { continue; }
+      auto const size = run->window->num_rows();
+      last_rows.push_back(slice(run->window->view(), {size - 1, size}).front());
+    }
+
+    std::vector<table_view> ready;
+    std::vector<size_type> counts;
+    if (last_rows.empty()) {
+      for (auto run : active) {
+        ready.push_back(run->window->view());
+        counts.push_back(run->window->num_rows());
+      }
+    } else {
+      auto const frontier = detail::merge(last_rows,
+                                          _key_indices,
+                                          _column_order,
+                                          _null_precedence,
+                                          stream,
+                                          rmm::mr::get_current_device_resource());
+      auto const needle   = slice(frontier->view(), {0, 1}).front().select(_key_indices);
+      for (auto run : active) {
+        auto const window = run->window->view();
+        auto const bound  = detail::upper_bound(window.select(_key_indices),
+                                               needle,
+                                               _column_order,
+                                               _null_precedence,
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+        auto const count  = detail::get_value<size_type>(bound->view(), 0, stream);
+        ready.push_back(slice(window, {0, count}).front());
+        counts.push_back(count);
+      }
+    }
+
+    auto const merged =
+      ready.size() == 1
+        ? std::make_unique<table>(ready.front(), stream, rmm::mr::get_current_device_resource())
+        : detail::merge(ready,
+                        _key_indices,
+                        _column_order,
+                        _null_precedence,
+                        stream,
+                        rmm::mr::get_current_device_resource());
+    emit_chunks(merged->view());
+
+    for (std::size_t i = 0; i < active.size(); ++i) {
+      auto const window = active[i]->window->view();
+      active[i]->window =
+        counts[i] == window.num_rows()
+          ? nullptr
+          : std::make_unique<table>(slice(window, {counts[i], window.num_rows()}).front(), stream);
+    }
+  }
+  _runs.clear();
+}
+
+size_type external_sorter::num_runs() const { return static_cast<size_type>(_runs.size()); }
+
+std::size_t external_sorter::spilled_bytes() const
+{
+  return std::accumulate(_runs.cbegin(), _runs.cend(), std::size_t{0}, [](auto sum, auto& run) {
+    return std::accumulate(
+      run->chunks.cbegin(), run->chunks.cend(), sum, [](auto total, auto const& chunk) {
+        return total + chunk.data.size() + chunk.metadata.size();
+      });
+  });
+}
+
+}  // namespace cudf
@@ -342,6 +342,7 @@ std::unique_ptr<column> rank(column_view const& input,
                              null_policy null_handling,
                              null_order null_precedence,
                              bool percentage,
+                             rmm::cuda_stream_view stream,
                              rmm::mr::device_memory_resource* mr)
 {
   return detail::rank(input,
@@ -350,7 +351,7 @@ std::unique_ptr<column> rank(column_view const& input,
                       null_handling,
                       null_precedence,
                       percentage,
-                      cudf::default_stream_value,
+                      stream,
                       mr);
 }
 }  // namespace cudf
@@ -14,17 +14,33 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <cub/block/block_merge_sort.cuh>
+#include <cub/warp/warp_merge_sort.cuh>
+
+#include <limits>
 
 namespace cudf {
 namespace detail {
@@ -56,6 +72,281 @@ rmm::device_uvector<size_type> get_segment_indices(size_type num_rows,
   return segment_ids;
 }
 
+// Segments of up to WARP_SORT_MAX_SIZE elements are sorted by a group of WARP_SORT_THREADS
+// threads, and segments of up to BLOCK_SORT_MAX_SIZE elements by a thread block. The longer
+// segments are sorted together by a device-wide sort.
+constexpr int WARP_SORT_THREADS         = 8;
+constexpr int WARP_SORT_ITEMS           = 4;
+constexpr size_type WARP_SORT_MAX_SIZE  = WARP_SORT_THREADS * WARP_SORT_ITEMS;
+constexpr int BLOCK_SORT_THREADS        = 256;
+constexpr int BLOCK_SORT_ITEMS          = 8;
+constexpr size_type BLOCK_SORT_MAX_SIZE = BLOCK_SORT_THREADS * BLOCK_SORT_ITEMS;
+constexpr int WARP_SORTS_PER_BLOCK      = BLOCK_SORT_THREADS / WARP_SORT_THREADS;
+constexpr size_type PADDING_INDEX       = std::numeric_limits<size_type>::max();
+
+/**
+ * @brief Compares the elements of a fixed-width column by index, as `sorted_order` does.
+ *
+ * Equivalent elements are ordered by index, which makes every sort using this comparator stable.
+ * The padding index of partially filled warp and block sorts compares greater than any index.
+ */
+template <typename T>
+struct segment_element_less {
+  column_device_view const d_keys;
+  bool const has_nulls;
+  bool const ascending;
+  null_order const null_precedence;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (lhs == PADDING_INDEX or rhs == PADDING_INDEX) {
+      return lhs != PADDING_INDEX and rhs == PADDING_INDEX;
+    }
+    auto const state = [&] {
+      if (has_nulls) {
+        auto const lhs_is_null = d_keys.is_null(lhs);
+        auto const rhs_is_null = d_keys.is_null(rhs);
+        if (lhs_is_null or rhs_is_null) {
+          return null_compare(lhs_is_null, rhs_is_null, null_precedence);
+        }
+      }
+      return relational_compare(d_keys.element<T>(lhs), d_keys.element<T>(rhs));
+    }();
+    if (state == weak_ordering::EQUIVALENT) { return lhs < rhs; }
+    return state == (ascending ? weak_ordering::LESS : weak_ordering::GREATER);
+  }
+};
+
+/**
+ * @brief Sorts every segment of `segments` with a group of WARP_SORT_THREADS threads.
+ *
+ * @param segments Indices of the segments to sort, of at most WARP_SORT_MAX_SIZE elements
+ * @param num_segments Number of segments to sort
+ * @param bounds Offsets of the segments
+ * @param less Comparator of the elements
+ * @param indices The sorted order, sorted in place within every segment
+ */
+template <typename Comparator>
+__global__ void warp_sort_segments(size_type const* segments,
+                                   size_type num_segments,
+                                   size_type const* bounds,
+                                   Comparator less,
+                                   size_type* indices)
+{
+  using warp_sort = cub::WarpMergeSort<size_type, WARP_SORT_ITEMS, WARP_SORT_THREADS>;
+  __shared__ typename warp_sort::TempStorage temp_storage[WARP_SORTS_PER_BLOCK];
+
+  auto const group = static_cast<int>(threadIdx.x) / WARP_SORT_THREADS;
+  auto const lane  = static_cast<int>(threadIdx.x) % WARP_SORT_THREADS;
+  auto const idx   = static_cast<int64_t>(blockIdx.x) * WARP_SORTS_PER_BLOCK + group;
+  // every thread of a group takes the same branch
+  if (idx >= num_segments) { return; }
+
+  auto const segment = segments[idx];
+  auto const begin   = bounds[segment];
+  auto const size    = bounds[segment + 1] - begin;
+
+  size_type keys[WARP_SORT_ITEMS];
+  for (int i = 0; i < WARP_SORT_ITEMS; ++i) {
+    auto const pos = lane * WARP_SORT_ITEMS + i;
+    keys[i]        = pos < size ? begin + pos : PADDING_INDEX;
+  }
+  warp_sort{temp_storage[group]}.Sort(keys, less, size, PADDING_INDEX);
+  for (int i = 0; i < WARP_SORT_ITEMS; ++i) {
+    auto const pos = lane * WARP_SORT_ITEMS + i;
+    if (pos < size) { indices[begin + pos] = keys[i]; }
+  }
+}
+
+/**
+ * @brief Sorts every segment of `segments` with a thread block.
+ *
+ * @param segments Indices of the segments to sort, of at most BLOCK_SORT_MAX_SIZE elements
+ * @param bounds Offsets of the segments
+ * @param less Comparator of the elements
+ * @param indices The sorted order, sorted in place within every segment
+ */
+template <typename Comparator>
+__global__ void block_sort_segments(size_type const* segments,
+                                    size_type const* bounds,
+                                    Comparator less,
+                                    size_type* indices)
+{
+  using block_sort = cub::BlockMergeSort<size_type, BLOCK_SORT_THREADS, BLOCK_SORT_ITEMS>;
+  __shared__ typename block_sort::TempStorage temp_storage;
+
+  auto const segment = segments[blockIdx.x];
+  auto const begin   = bounds[segment];
+  auto const size    = bounds[segment + 1] - begin;
+
+  size_type keys[BLOCK_SORT_ITEMS];
+  for (int i = 0; i < BLOCK_SORT_ITEMS; ++i) {
+    auto const pos = static_cast<int>(threadIdx.x) * BLOCK_SORT_ITEMS + i;
+    keys[i]        = pos < size ? begin + pos : PADDING_INDEX;
+  }
+  block_sort{temp_storage}.Sort(keys, less, size, PADDING_INDEX);
+  for (int i = 0; i < BLOCK_SORT_ITEMS; ++i) {
+    auto const pos = static_cast<int>(threadIdx.x) * BLOCK_SORT_ITEMS + i;
+    if (pos < size) { indices[begin + pos] = keys[i]; }
+  }
+}
+
+/**
+ * @brief Sorts the elements of all segments longer than BLOCK_SORT_MAX_SIZE with one device-wide
+ * sort by (segment, element), then scatters them back to the positions of these segments.
+ */
+template <typename Comparator>
+void sort_large_segments(size_type num_rows,
+                         device_span<size_type const> bounds,
+                         Comparator const& less,
+                         size_type* indices,
+                         rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> row_segments(num_rows, stream);
+  thrust::upper_bound(rmm::exec_policy(stream),
+                      bounds.begin(),
+                      bounds.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      row_segments.begin());
+
+  // bounds starts at 0, so the upper bound of every row is its segment plus one
+  rmm::device_uvector<size_type> large_rows(num_rows, stream);
+  auto const large_rows_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    large_rows.begin(),
+    [bounds = bounds.data(), row_segments = row_segments.data()] __device__(size_type row) {
+      auto const segment = row_segments[row] - 1;
+      return bounds[segment + 1] - bounds[segment] > BLOCK_SORT_MAX_SIZE;
+    });
+  large_rows.resize(thrust::distance(large_rows.begin(), large_rows_end), stream);
+
+  rmm::device_uvector<size_type> sorted_rows(large_rows.size(), stream);
+  thrust::copy(rmm::exec_policy(stream), large_rows.begin(), large_rows.end(), sorted_rows.begin());
+  thrust::sort(rmm::exec_policy(stream),
+               sorted_rows.begin(),
+               sorted_rows.end(),
+               [row_segments = row_segments.data(), less] __device__(size_type lhs, size_type rhs) {
+                 return row_segments[lhs] != row_segments[rhs]
+                          ? row_segments[lhs] < row_segments[rhs]
+                          : less(lhs, rhs);
+               });
+  thrust::scatter(rmm::exec_policy(stream),
+                  sorted_rows.begin(),
+                  sorted_rows.end(),
+                  large_rows.begin(),
+                  indices);
+}
+
+/**
+ * @brief Sorts the segments of a fixed-width column, bucketed by their number of elements.
+ */
+struct bucketed_segmented_sort_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void operator()(column_view const& keys,
+                  device_span<size_type const> bounds,
+                  order column_order,
+                  null_order null_precedence,
+                  size_type* indices,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_keys = column_device_view::create(keys, stream);
+    auto const less   = segment_element_less<T>{
+      *d_keys, keys.has_nulls(), column_order == order::ASCENDING, null_precedence};
+    auto const num_segments = static_cast<size_type>(bounds.size()) - 1;
+
+    // Segments of at most one element are already sorted
+    rmm::device_uvector<size_type> segments(num_segments, stream);
+    auto const select_segments = [&](size_type* output, size_type min_size, size_type max_size) {
+      auto const output_end =
+        thrust::copy_if(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(num_segments),
+                        output,
+                        [bounds = bounds.data(), min_size, max_size] __device__(size_type s) {
+                          auto const size = bounds[s + 1] - bounds[s];
+                          return size > min_size and size <= max_size;
+                        });
+      return static_cast<size_type>(thrust::distance(output, output_end));
+    };
+    auto const small_segments  = segments.data();
+    auto const num_small       = select_segments(small_segments, 1, WARP_SORT_MAX_SIZE);
+    auto const medium_segments = small_segments + num_small;
+    auto const num_medium =
+      select_segments(medium_segments, WARP_SORT_MAX_SIZE, BLOCK_SORT_MAX_SIZE);
+    auto const num_large = select_segments(
+      medium_segments + num_medium, BLOCK_SORT_MAX_SIZE, std::numeric_limits<size_type>::max());
+
+    if (num_small > 0) {
+      auto const num_blocks = util::div_rounding_up_safe(num_small, WARP_SORTS_PER_BLOCK);
+      warp_sort_segments<<<num_blocks, BLOCK_SORT_THREADS, 0, stream.value()>>>(
+        small_segments, num_small, bounds.data(), less, indices);
+    }
+    if (num_medium > 0) {
+      block_sort_segments<<<num_medium, BLOCK_SORT_THREADS, 0, stream.value()>>>(
+        medium_segments, bounds.data(), less, indices);
+    }
+    if (num_large > 0) { sort_large_segments(keys.size(), bounds, less, indices, stream); }
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_fixed_width<T>())>
+  void operator()(column_view const&,
+                  device_span<size_type const>,
+                  order,
+                  null_order,
+                  size_type*,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Bucketed segmented sort supports only fixed-width keys");
+  }
+};
+
+/**
+ * @brief Returns the stable segmented sorted order of a single fixed-width column, sorting every
+ * segment with a warp-level, block-level or device-level sort depending on its size.
+ *
+ * Like `get_segment_indices`, the rows before the first offset and after the last one form
+ * segments of their own.
+ */
+std::unique_ptr<column> bucketed_segmented_sorted_order(column_view const& keys,
+                                                        column_view const& segment_offsets,
+                                                        order column_order,
+                                                        null_order null_precedence,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = keys.size();
+
+  // The offsets clamped to the rows, between a first offset of 0 and a last one of num_rows
+  rmm::device_uvector<size_type> bounds(segment_offsets.size() + 2, stream);
+  bounds.set_element_to_zero_async(0, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    segment_offsets.begin<size_type>(),
+                    segment_offsets.end<size_type>(),
+                    bounds.begin() + 1,
+                    [num_rows] __device__(size_type offset) {
+                      return offset < 0 ? 0 : (offset > num_rows ? num_rows : offset);
+                    });
+  bounds.set_element(bounds.size() - 1, num_rows, stream);
+
+  auto result = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const indices = result->mutable_view().begin<size_type>();
+  thrust::sequence(rmm::exec_policy(stream), indices, indices + num_rows, 0);
+
+  type_dispatcher(keys.type(),
+                  bucketed_segmented_sort_fn{},
+                  keys,
+                  device_span<size_type const>{bounds},
+                  column_order,
+                  null_precedence,
+                  indices,
+                  stream);
+  return result;
+}
+
 std::unique_ptr<column> segmented_sorted_order_common(
   table_view const& keys,
   column_view const& segment_offsets,
@@ -67,6 +358,23 @@ std::unique_ptr<column> segmented_sorted_order_common(
 {
   CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
                "segment offsets should be size_type");
+  CUDF_EXPECTS(column_order.empty() or column_order.size() == std::size_t(keys.num_columns()),
+               "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(
+    null_precedence.empty() or null_precedence.size() == std::size_t(keys.num_columns()),
+    "Mismatch between number of columns and null_precedence size.");
+
+  // Most segments, like the rows of a lists column, are short enough to be sorted by a warp
+  if (keys.num_columns() == 1 and keys.num_rows() > 0 and is_fixed_width(keys.column(0).type())) {
+    return bucketed_segmented_sorted_order(
+      keys.column(0),
+      segment_offsets,
+      column_order.empty() ? order::ASCENDING : column_order.front(),
+      null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+      stream,
+      mr);
+  }
+
   // Get segment id of each element in all segments.
   auto segment_ids = get_segment_indices(keys.num_rows(), segment_offsets, stream);
 
@@ -192,11 +500,12 @@ std::unique_ptr<column> segmented_sorted_order(table_view const& keys,
                                                column_view const& segment_offsets,
                                                std::vector<order> const& column_order,
                                                std::vector<null_order> const& null_precedence,
+                                               rmm::cuda_stream_view stream,
                                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::segmented_sorted_order(
-    keys, segment_offsets, column_order, null_precedence, cudf::default_stream_value, mr);
+    keys, segment_offsets, column_order, null_precedence, stream, mr);
 }
 
 std::unique_ptr<column> stable_segmented_sorted_order(
@@ -204,11 +513,12 @@ std::unique_ptr<column> stable_segmented_sorted_order(
   column_view const& segment_offsets,
   std::vector<order> const& column_order,
   std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::stable_segmented_sorted_order(
-    keys, segment_offsets, column_order, null_precedence, cudf::default_stream_value, mr);
+    keys, segment_offsets, column_order, null_precedence, stream, mr);
 }
 
 std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
@@ -216,11 +526,12 @@ std::unique_ptr<table> segmented_sort_by_key(table_view const& values,
                                              column_view const& segment_offsets,
                                              std::vector<order> const& column_order,
                                              std::vector<null_order> const& null_precedence,
+                                             rmm::cuda_stream_view stream,
                                              rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::segmented_sort_by_key(
-    values, keys, segment_offsets, column_order, null_precedence, cudf::default_stream_value, mr);
+    values, keys, segment_offsets, column_order, null_precedence, stream, mr);
 }
 
 std::unique_ptr<table> stable_segmented_sort_by_key(table_view const& values,
@@ -228,11 +539,12 @@ std::unique_ptr<table> stable_segmented_sort_by_key(table_view const& values,
                                                     column_view const& segment_offsets,
                                                     std::vector<order> const& column_order,
                                                     std::vector<null_order> const& null_precedence,
+                                                    rmm::cuda_stream_view stream,
                                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::stable_segmented_sort_by_key(
-    values, keys, segment_offsets, column_order, null_precedence, cudf::default_stream_value, mr);
+    values, keys, segment_offsets, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_properties.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
@@ -28,6 +29,8 @@
 #include <thrust/functional.h>
 #include <thrust/sort.h>
 
+#include <memory>
+
 namespace cudf {
 namespace detail {
 std::unique_ptr<column> sorted_order(table_view const& input,
@@ -60,6 +63,40 @@ std::unique_ptr<table> sort_by_key(table_view const& values,
                         mr);
 }
 
+namespace {
+
+/**
+ * @brief Marks the first column of a sorted table as sorted, keeping the properties of the input
+ * column that sorting does not change.
+ */
+void set_sorted_properties(table& output,
+                           column_view const& input,
+                           std::vector<order> const& column_order,
+                           std::vector<null_order> const& null_precedence)
+{
+  auto properties = input.properties() ? std::make_shared<column_properties>(*input.properties())
+                                       : std::make_shared<column_properties>();
+  properties->sorted_order = column_order.empty() ? order::ASCENDING : column_order.front();
+  properties->sorted_null_precedence =
+    null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+  output.get_column(0).set_properties(std::move(properties));
+}
+
+}  // namespace
+
+bool is_known_sorted(table_view const& input,
+                     std::vector<order> const& column_order,
+                     std::vector<null_order> const& null_precedence)
+{
+  if (input.num_columns() != 1) { return false; }
+  auto const& col = input.column(0);
+  if (not col.properties()) { return false; }
+  return col.properties()->is_sorted(
+    column_order.empty() ? order::ASCENDING : column_order.front(),
+    null_precedence.empty() ? null_order::BEFORE : null_precedence.front(),
+    col.has_nulls());
+}
+
 struct inplace_column_sort_fn {
   template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
   void operator()(mutable_column_view& col, bool ascending, rmm::cuda_stream_view stream) const
@@ -86,6 +123,12 @@ std::unique_ptr<table> sort(table_view const& input,
                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
+  // the copy keeps the properties of the input, including its order
+  if (is_known_sorted(input, column_order, null_precedence)) {
+    return std::make_unique<table>(input, stream, mr);
+  }
+
+  std::unique_ptr<table> result;
   // fast-path sort conditions: single, non-floating-point, fixed-width column with no nulls
   if (input.num_columns() == 1 && !input.column(0).has_nulls() &&
       cudf::is_fixed_width(input.column(0).type()) &&
@@ -97,10 +140,14 @@ std::unique_ptr<table> sort(table_view const& input,
       output->type(), inplace_column_sort_fn{}, view, ascending, stream);
     std::vector<std::unique_ptr<column>> columns;
     columns.emplace_back(std::move(output));
-    return std::make_unique<table>(std::move(columns));
+    result = std::make_unique<table>(std::move(columns));
+  } else {
+    result = detail::sort_by_key(input, input, column_order, null_precedence, stream, mr);
   }
-  return detail::sort_by_key(
-    input, input, column_order, null_precedence, cudf::default_stream_value, mr);
+  if (result->num_columns() > 0) {
+    set_sorted_properties(*result, input.column(0), column_order, null_precedence);
+  }
+  return result;
 }
 
 }  // namespace detail
@@ -108,30 +155,32 @@ std::unique_ptr<table> sort(table_view const& input,
 std::unique_ptr<column> sorted_order(table_view const& input,
                                      std::vector<order> const& column_order,
                                      std::vector<null_order> const& null_precedence,
+                                     rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sorted_order(input, column_order, null_precedence, cudf::default_stream_value, mr);
+  return detail::sorted_order(input, column_order, null_precedence, stream, mr);
 }
 
 std::unique_ptr<table> sort(table_view const& input,
                             std::vector<order> const& column_order,
                             std::vector<null_order> const& null_precedence,
+                            rmm::cuda_stream_view stream,
                             rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort(input, column_order, null_precedence, cudf::default_stream_value, mr);
+  return detail::sort(input, column_order, null_precedence, stream, mr);
 }
 
 std::unique_ptr<table> sort_by_key(table_view const& values,
                                    table_view const& keys,
                                    std::vector<order> const& column_order,
                                    std::vector<null_order> const& null_precedence,
+                                   rmm::cuda_stream_view stream,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::sort_by_key(
-    values, keys, column_order, null_precedence, cudf::default_stream_value, mr);
+  return detail::sort_by_key(values, keys, column_order, null_precedence, stream, mr);
 }
 
 }  // namespace cudf
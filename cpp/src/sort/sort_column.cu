@@ -128,6 +128,9 @@ std::unique_ptr<column> sorted_order<false>(column_view const& input,
                                             rmm::cuda_stream_view stream,
                                             rmm::mr::device_memory_resource* mr)
 {
+  if (input.type().id() == type_id::STRING) {
+    return prefix_sorted_order(input, column_order, null_precedence, false, stream, mr);
+  }
   auto sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.size(), mask_state::UNALLOCATED, stream, mr);
   mutable_column_view indices_view = sorted_indices->mutable_view();
@@ -18,8 +18,11 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
@@ -34,6 +37,8 @@
 #include <thrust/sort.h>
 #include <thrust/swap.h>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -81,6 +86,56 @@ std::unique_ptr<column> sorted_order(column_view const& input,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr);
 
+/**
+ * @brief Sorts the indices of a strings column by radix sorting a prefix of every string first.
+ *
+ * The first 8 bytes of each string form a big-endian 64-bit key that is radix sorted. The strings
+ * are only compared to each other within the runs of rows having the same key, using a
+ * segmented sort.
+ *
+ * @param input Strings column to sort
+ * @param column_order Ascending or descending sort order
+ * @param null_precedence How null rows are to be ordered
+ * @param stable True if sort should be stable
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Sorted indices for the input column
+ */
+std::unique_ptr<column> prefix_sorted_order(column_view const& input,
+                                            order column_order,
+                                            null_order null_precedence,
+                                            bool stable,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr);
+
+/**
+ * @brief Indicates whether the rows of `input` can be sorted by `normalized_sorted_order`.
+ *
+ * That is the case for fixed-width columns other than floating point and DECIMAL128.
+ */
+bool is_normalizable(table_view const& input);
+
+/**
+ * @brief Stably sorts the indices of a table by radix sorting normalized keys.
+ *
+ * The value and null flag of every column are encoded into bit fields of unsigned 64-bit words,
+ * most significant column first, such that comparing the words as unsigned integers orders the
+ * rows as the lexicographic row comparator does for `column_order` and `null_precedence`. The
+ * words are then radix sorted from the least significant to the most significant one.
+ *
+ * @param input Table to sort, for which `is_normalizable` holds
+ * @param column_order Ascending or descending sort order of each column, or empty
+ * @param null_precedence How null rows are to be ordered in each column, or empty
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Stably sorted indices for the input table
+ */
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr);
+
 /**
  * @copydoc
  * sorted_order(table_view&,std::vector<order>,std::vector<null_order>,rmm::mr::device_memory_resource*)
@@ -108,6 +163,21 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  // rows known to be sorted are already in order, which is also a stable order
+  if (is_known_sorted(input, column_order, null_precedence)) {
+    std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
+      data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
+    thrust::sequence(rmm::exec_policy(stream),
+                     mutable_indices_view.begin<size_type>(),
+                     mutable_indices_view.end<size_type>(),
+                     0);
+    return sorted_indices;
+  }
+
+  // dictionary keys are sorted so the indices order the rows the same way as the keys
+  input = dictionary::detail::replace_dictionaries_with_indices(input);
+
   // fast-path for single column sort
   if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
     auto const single_col = input.column(0);
@@ -117,6 +187,26 @@ std::unique_ptr<column> sorted_order(table_view input,
                   : sorted_order<false>(single_col, col_order, null_prec, stream, mr);
   }
 
+  // fast-path for fixed-width multi-column sort; a radix sort is stable either way
+  if (is_normalizable(input)) {
+    return normalized_sorted_order(input, column_order, null_precedence, stream, mr);
+  }
+
+  // Struct columns order their rows as their validity followed by their fields do once the parent
+  // nulls are pushed down, so flattening them gives a table of flat columns. When those are all
+  // fixed-width, the rows are sorted by their normalized keys instead of recursing into the
+  // struct children in every comparison.
+  auto const is_struct = [](column_view const& col) { return col.type().id() == type_id::STRUCT; };
+  if (std::any_of(input.begin(), input.end(), is_struct) and
+      std::none_of(input.begin(), input.end(), structs::detail::is_or_has_nested_lists)) {
+    auto const flattened =
+      structs::detail::flatten_nested_columns(input, column_order, null_precedence);
+    if (is_normalizable(flattened)) {
+      return normalized_sorted_order(
+        flattened, flattened.orders(), flattened.null_orders(), stream, mr);
+    }
+  }
+
   std::unique_ptr<column> sorted_indices = cudf::make_numeric_column(
     data_type(type_to_id<size_type>()), input.num_rows(), mask_state::UNALLOCATED, stream, mr);
   mutable_column_view mutable_indices_view = sorted_indices->mutable_view();
@@ -141,7 +231,7 @@ std::unique_ptr<column> sorted_order(table_view input,
                  comparator);
   }
   // protection for temporary d_column_order and d_null_precedence
-  stream.synchronize();
+  cudf::detail::synchronize_stream(stream);
 
   return sorted_indices;
 }
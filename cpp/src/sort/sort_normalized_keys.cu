@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <sort/sort_impl.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr int word_bits = 64;
+
+/**
+ * @brief Layout of the normalized key of one column
+ */
+struct key_field {
+  int value_bits;     ///< Number of bits of the value
+  bool has_null_bit;  ///< Whether a null flag bit precedes the value
+  bool descending;    ///< Whether all the bits of the field are inverted
+  bool nulls_before;  ///< Whether nulls order before the values before any inversion
+};
+
+/**
+ * @brief Maps a signed or unsigned integer to an unsigned integer of the same order
+ */
+template <typename R>
+__device__ uint64_t to_ordered_bits(R value)
+{
+  using U   = std::make_unsigned_t<R>;
+  auto bits = static_cast<U>(value);
+  if constexpr (std::is_signed_v<R>) { bits ^= static_cast<U>(U{1} << (sizeof(U) * 8 - 1)); }
+  return static_cast<uint64_t>(bits);
+}
+
+/**
+ * @brief Type-dispatched functor returning the order preserving bits of an element
+ */
+struct ordered_bits_fn {
+  template <typename T>
+  __device__ uint64_t operator()(column_device_view const& col, size_type row) const
+  {
+    if constexpr (std::is_same_v<T, bool>) {
+      return col.element<bool>(row) ? 1 : 0;
+    } else if constexpr (cudf::is_timestamp<T>()) {
+      return to_ordered_bits(col.element<T>(row).time_since_epoch().count());
+    } else if constexpr (cudf::is_duration<T>()) {
+      return to_ordered_bits(col.element<T>(row).count());
+    } else if constexpr (cudf::is_fixed_point<T>()) {
+      using Rep = device_storage_type_t<T>;
+      if constexpr (sizeof(Rep) <= sizeof(uint64_t)) {
+        return to_ordered_bits(col.element<Rep>(row));
+      } else {
+        return 0;
+      }
+    } else if constexpr (std::is_integral_v<T>) {
+      return to_ordered_bits(col.element<T>(row));
+    } else {
+      return 0;
+    }
+  }
+};
+
+/**
+ * @brief Writes the normalized key of a row into the key words
+ *
+ * Word `w` of row `i` is stored at `d_words[w * num_rows + i]`, zero-initialized.
+ */
+struct normalize_row_fn {
+  table_device_view d_input;
+  key_field const* d_fields;
+  uint64_t* d_words;
+  size_type num_rows;
+
+  __device__ void operator()(size_type row) const
+  {
+    int position = 0;  // in bits from the most significant bit of the first word
+    auto append  = [&](uint64_t value, int num_bits) {
+      while (num_bits > 0) {
+        auto const word   = position / word_bits;
+        auto const space  = word_bits - position % word_bits;
+        auto const length = min(space, num_bits);
+        auto const chunk  = (value >> (num_bits - length)) &
+                           (length == word_bits ? ~uint64_t{0} : (uint64_t{1} << length) - 1);
+        d_words[static_cast<std::size_t>(word) * num_rows + row] |= chunk << (space - length);
+        position += length;
+        num_bits -= length;
+      }
+    };
+
+    for (size_type i = 0; i < d_input.num_columns(); ++i) {
+      auto const& col    = d_input.column(i);
+      auto const field   = d_fields[i];
+      auto const is_null = field.has_null_bit and col.is_null(row);
+      auto const inverse = field.descending ? ~uint64_t{0} : uint64_t{0};
+      if (field.has_null_bit) { append((is_null != field.nulls_before ? 1 : 0) ^ inverse, 1); }
+      auto const value =
+        is_null ? 0 : cudf::type_dispatcher(col.type(), ordered_bits_fn{}, col, row);
+      append(value ^ inverse, field.value_bits);
+    }
+  }
+};
+
+}  // namespace
+
+bool is_normalizable(table_view const& input)
+{
+  return std::all_of(input.begin(), input.end(), [](column_view const& col) {
+    return cudf::is_fixed_width(col.type()) and not cudf::is_floating_point(col.type()) and
+           col.type().id() != type_id::DECIMAL128;
+  });
+}
+
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+
+  std::vector<key_field> fields(input.num_columns());
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    fields[i]       = key_field{
+      col.type().id() == type_id::BOOL8 ? 1 : static_cast<int>(cudf::size_of(col.type()) * 8),
+      col.has_nulls(),
+      not column_order.empty() and column_order[i] == order::DESCENDING,
+      null_precedence.empty() or null_precedence[i] == null_order::BEFORE};
+  }
+  auto const total_bits =
+    std::accumulate(fields.begin(), fields.end(), 0, [](int bits, key_field const& field) {
+      return bits + field.value_bits + (field.has_null_bit ? 1 : 0);
+    });
+  auto const num_words = (total_bits + word_bits - 1) / word_bits;
+
+  auto const d_fields = cudf::detail::make_device_uvector_async(fields, stream);
+  auto const d_input  = table_device_view::create(input, stream);
+  rmm::device_uvector<uint64_t> words(static_cast<std::size_t>(num_words) * num_rows, stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(words.data(), 0, words.size() * sizeof(uint64_t), stream.value()));
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_rows,
+                     normalize_row_fn{*d_input, d_fields.data(), words.data(), num_rows});
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const d_indices = sorted_indices->mutable_view().begin<size_type>();
+  thrust::sequence(rmm::exec_policy(stream), d_indices, d_indices + num_rows, 0);
+
+  // Least significant word first; each radix sort keeps the order of the previous ones for equal
+  // words, so after the most significant word the rows are sorted by the whole key
+  rmm::device_uvector<uint64_t> sort_keys(num_rows, stream);
+  for (auto word = num_words - 1; word >= 0; --word) {
+    auto const d_word = words.data() + static_cast<std::size_t>(word) * num_rows;
+    thrust::gather(
+      rmm::exec_policy(stream), d_indices, d_indices + num_rows, d_word, sort_keys.begin());
+    thrust::stable_sort_by_key(
+      rmm::exec_policy(stream), sort_keys.begin(), sort_keys.end(), d_indices);
+  }
+  return sorted_indices;
+}
+
+}  // namespace detail
+}  // namespace cudf
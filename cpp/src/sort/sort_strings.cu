@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_view.hpp>
+
+#include <sort/sort_impl.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes the big-endian prefix key of each string.
+ *
+ * Comparing two keys as unsigned integers orders the rows like comparing their strings, except
+ * that strings sharing their first 8 bytes, or differing only in trailing zero bytes within
+ * them, get equal keys. Nulls are given the smallest or the largest key before the keys are
+ * inverted for a descending order, following `null_order`.
+ */
+struct prefix_key_fn {
+  column_device_view const d_strings;
+  bool descending;
+  bool nulls_before;
+
+  __device__ uint64_t operator()(size_type row) const
+  {
+    uint64_t key = 0;
+    if (d_strings.is_null(row)) {
+      key = nulls_before ? 0 : ~uint64_t{0};
+    } else {
+      auto const str   = d_strings.element<string_view>(row);
+      auto const bytes = reinterpret_cast<unsigned char const*>(str.data());
+      auto const size  = str.size_bytes() < 8 ? str.size_bytes() : 8;
+      for (size_type i = 0; i < size; ++i) {
+        key |= static_cast<uint64_t>(bytes[i]) << (56 - 8 * i);
+      }
+    }
+    return descending ? ~key : key;
+  }
+};
+
+/**
+ * @brief Returns true for the first row of every run of equal keys.
+ */
+struct segment_start_fn {
+  uint64_t const* keys;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return row == 0 || keys[row] != keys[row - 1];
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> prefix_sorted_order(column_view const& input,
+                                            order column_order,
+                                            null_order null_precedence,
+                                            bool stable,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.size();
+  auto const d_input  = column_device_view::create(input, stream);
+
+  rmm::device_uvector<uint64_t> keys(num_rows, stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    keys.begin(),
+                    prefix_key_fn{*d_input,
+                                  column_order == order::DESCENDING,
+                                  null_precedence == null_order::BEFORE});
+
+  auto sorted_indices = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto indices = sorted_indices->mutable_view();
+  thrust::sequence(rmm::exec_policy(stream), indices.begin<size_type>(), indices.end<size_type>());
+  // radix sort of the prefixes; stable so that ties keep their input order for a stable sort
+  thrust::stable_sort_by_key(
+    rmm::exec_policy(stream), keys.begin(), keys.end(), indices.begin<size_type>());
+
+  rmm::device_uvector<size_type> offsets(num_rows + 1, stream);
+  auto const offsets_end = thrust::copy_if(rmm::exec_policy(stream),
+                                           thrust::make_counting_iterator<size_type>(0),
+                                           thrust::make_counting_iterator<size_type>(num_rows),
+                                           offsets.begin(),
+                                           segment_start_fn{keys.data()});
+  auto const num_segments = static_cast<size_type>(thrust::distance(offsets.begin(), offsets_end));
+  if (num_segments == num_rows) { return sorted_indices; }
+  offsets.set_element_async(num_segments, num_rows, stream);
+
+  // only the runs of tied prefixes still need to be sorted by comparing the strings
+  auto const gathered = detail::gather(table_view{{input}},
+                                       indices,
+                                       out_of_bounds_policy::DONT_CHECK,
+                                       negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       rmm::mr::get_current_device_resource());
+  auto const segment_offsets =
+    column_view(data_type{type_to_id<size_type>()}, num_segments + 1, offsets.data());
+  auto const segment_order =
+    stable ? detail::stable_segmented_sorted_order(gathered->view(),
+                                                   segment_offsets,
+                                                   {column_order},
+                                                   {null_precedence},
+                                                   stream,
+                                                   rmm::mr::get_current_device_resource())
+           : detail::segmented_sorted_order(gathered->view(),
+                                            segment_offsets,
+                                            {column_order},
+                                            {null_precedence},
+                                            stream,
+                                            rmm::mr::get_current_device_resource());
+
+  auto result = cudf::make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream),
+                 segment_order->view().begin<size_type>(),
+                 segment_order->view().end<size_type>(),
+                 indices.begin<size_type>(),
+                 result->mutable_view().begin<size_type>());
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
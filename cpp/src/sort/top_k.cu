@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/extrema.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/tabulate.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+
+// Number of rows sampled to choose a threshold; inputs up to twice this size are sorted in full
+constexpr size_type sample_size = 4096;
+
+/**
+ * @brief Returns the first `k` indices of the stable sorted order of `keys`.
+ */
+std::unique_ptr<column> first_k_of_sorted_order(table_view const& keys,
+                                                size_type k,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  auto const sorted = stable_sorted_order(keys, column_order, null_precedence, stream);
+  return std::make_unique<column>(cudf::detail::slice(sorted->view(), 0, k), stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative");
+  auto const num_rows = keys.num_rows();
+  k                   = std::min(k, num_rows);
+
+  auto const has_dictionary = std::any_of(
+    keys.begin(), keys.end(), [](column_view const& col) { return is_dictionary(col.type()); });
+  if (k == 0 or num_rows <= 2 * sample_size or has_dictionary) {
+    return first_k_of_sorted_order(keys, k, column_order, null_precedence, stream, mr);
+  }
+
+  // Sort evenly spaced rows of the keys to choose threshold rows from
+  auto const stride     = num_rows / sample_size;
+  auto const sample_map = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    [stride] __device__(size_type i) { return i * stride; });
+  auto const sample = cudf::detail::gather(
+    keys, sample_map, sample_map + sample_size, out_of_bounds_policy::DONT_CHECK, stream);
+  auto const sample_order =
+    stable_sorted_order(sample->view(), column_order, null_precedence, stream);
+
+  auto const comparator = cudf::experimental::row::lexicographic::two_table_comparator(
+    keys, sample->view(), column_order, null_precedence, stream);
+  auto const d_less = comparator.less(nullate::DYNAMIC{has_nested_nulls(keys)});
+
+  // The k-th sorted row is expected near rank `k * sample_size / num_rows` of the sorted sample.
+  // Starting past it, the rows not ordered after the threshold usually include the top k in a
+  // single pass; otherwise the threshold is raised until it reaches the largest sample row.
+  auto rank = std::min<int64_t>(
+    sample_size - 1, 2 * (static_cast<int64_t>(k) * sample_size / num_rows) + 1);
+  while (true) {
+    auto const threshold = static_cast<rhs_index_type>(
+      get_value<size_type>(sample_order->view(), static_cast<size_type>(rank), stream));
+    auto const is_candidate = [d_less, threshold] __device__(size_type i) {
+      return not d_less(threshold, static_cast<lhs_index_type>(i));
+    };
+    auto const num_candidates =
+      static_cast<size_type>(thrust::count_if(rmm::exec_policy(stream),
+                                              thrust::make_counting_iterator<size_type>(0),
+                                              thrust::make_counting_iterator<size_type>(num_rows),
+                                              is_candidate));
+
+    if (num_candidates >= k) {
+      // The candidates keep their original order, so stably sorting them ranks the top k rows as
+      // stably sorting all the keys does
+      rmm::device_uvector<size_type> candidates(num_candidates, stream);
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      candidates.begin(),
+                      is_candidate);
+      auto const candidate_keys  = cudf::detail::gather(keys,
+                                                       candidates.begin(),
+                                                       candidates.end(),
+                                                       out_of_bounds_policy::DONT_CHECK,
+                                                       stream);
+      auto const candidate_order =
+        stable_sorted_order(candidate_keys->view(), column_order, null_precedence, stream);
+
+      auto result = make_numeric_column(
+        data_type{type_to_id<size_type>()}, k, mask_state::UNALLOCATED, stream, mr);
+      thrust::gather(rmm::exec_policy(stream),
+                     candidate_order->view().begin<size_type>(),
+                     candidate_order->view().begin<size_type>() + k,
+                     candidates.begin(),
+                     result->mutable_view().begin<size_type>());
+      return result;
+    }
+    if (rank == sample_size - 1) { break; }
+    rank = std::min<int64_t>(sample_size - 1, 2 * rank + 1);
+  }
+
+  // more than k rows are ordered after every sampled row
+  return first_k_of_sorted_order(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  auto const indices = top_k_order(keys, k, column_order, null_precedence, stream);
+  return detail::gather(keys,
+                        indices->view(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+std::unique_ptr<column> segmented_top_k_order(table_view const& keys,
+                                              column_view const& segment_offsets,
+                                              size_type k,
+                                              std::vector<order> const& column_order,
+                                              std::vector<null_order> const& null_precedence,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative");
+  CUDF_EXPECTS(segment_offsets.type() == data_type(type_to_id<size_type>()),
+               "segment offsets should be size_type");
+  auto const num_segments = std::max(segment_offsets.size() - 1, 0);
+  auto const sorted =
+    stable_segmented_sorted_order(keys, segment_offsets, column_order, null_precedence, stream);
+
+  // Each output list holds the first min(k, size) indices of its sorted segment
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_segments + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const d_offsets     = offsets->mutable_view().begin<size_type>();
+  auto const d_seg_offsets = segment_offsets.begin<size_type>();
+  auto const list_sizes    = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), [d_seg_offsets, k] __device__(size_type i) {
+      return thrust::min(k, d_seg_offsets[i + 1] - d_seg_offsets[i]);
+    });
+  CUDF_CUDA_TRY(cudaMemsetAsync(d_offsets, 0, sizeof(size_type), stream.value()));
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), list_sizes, list_sizes + num_segments, d_offsets + 1);
+  auto const num_indices = get_value<size_type>(offsets->view(), num_segments, stream);
+
+  rmm::device_uvector<size_type> labels(num_indices, stream);
+  cudf::detail::label_segments(
+    d_offsets, d_offsets + num_segments + 1, labels.begin(), labels.end(), stream);
+
+  auto indices = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_indices, mask_state::UNALLOCATED, stream, mr);
+  auto const d_labels = labels.data();
+  auto const d_sorted = sorted->view().begin<size_type>();
+  thrust::tabulate(rmm::exec_policy(stream),
+                   indices->mutable_view().begin<size_type>(),
+                   indices->mutable_view().end<size_type>(),
+                   [d_labels, d_offsets, d_seg_offsets, d_sorted] __device__(size_type i) {
+                     auto const segment = d_labels[i];
+                     return d_sorted[d_seg_offsets[segment] + i - d_offsets[segment]];
+                   });
+
+  return make_lists_column(
+    num_segments, std::move(offsets), std::move(indices), 0, rmm::device_buffer{}, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<column> segmented_top_k_order(table_view const& keys,
+                                              column_view const& segment_offsets,
+                                              size_type k,
+                                              std::vector<order> const& column_order,
+                                              std::vector<null_order> const& null_precedence,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::segmented_top_k_order(
+    keys, segment_offsets, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chunked_compression.hpp"
+
+#include <io/comp/nvcomp_adapter.hpp>
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf::detail {
+namespace {
+
+io::nvcomp::compression_type to_nvcomp_compression(io::compression_type compression)
+{
+  switch (compression) {
+    case io::compression_type::SNAPPY: return io::nvcomp::compression_type::SNAPPY;
+    case io::compression_type::LZ4: return io::nvcomp::compression_type::LZ4;
+    case io::compression_type::ZSTD: return io::nvcomp::compression_type::ZSTD;
+    default: CUDF_FAIL("Unsupported chunked compression type");
+  }
+}
+
+}  // namespace
+
+bool is_chunked_compression_supported(io::compression_type compression)
+{
+  return compression == io::compression_type::SNAPPY or
+         compression == io::compression_type::LZ4 or compression == io::compression_type::ZSTD;
+}
+
+std::size_t compressed_chunks::compressed_size() const
+{
+  return std::accumulate(sizes.begin(), sizes.end(), std::size_t{0});
+}
+
+void compressed_chunks::copy_compacted(void* destination, rmm::cuda_stream_view stream) const
+{
+  auto const d_data  = static_cast<uint8_t const*>(data.data());
+  auto const dst     = static_cast<uint8_t*>(destination);
+  std::size_t offset = 0;
+  for (std::size_t chunk = 0; chunk < sizes.size(); ++chunk) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(dst + offset,
+                                  d_data + chunk * slot_size,
+                                  sizes[chunk],
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    offset += sizes[chunk];
+  }
+}
+
+compressed_chunks compress_chunks(host_span<device_span<uint8_t const> const> inputs,
+                                  io::compression_type compression,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const nvcomp_type = to_nvcomp_compression(compression);
+  auto const num_chunks  = std::accumulate(
+    inputs.begin(), inputs.end(), std::size_t{0}, [](auto sum, auto const& input) {
+      return sum + num_compression_chunks(input.size());
+    });
+  auto const slot_size =
+    io::nvcomp::batched_compress_get_max_output_chunk_size(nvcomp_type, compression_chunk_size);
+
+  rmm::device_buffer compressed(num_chunks * slot_size, stream);
+  auto const d_compressed = static_cast<uint8_t*>(compressed.data());
+  std::vector<device_span<uint8_t const>> d_input_chunks;
+  std::vector<device_span<uint8_t>> d_output_chunks;
+  d_input_chunks.reserve(num_chunks);
+  d_output_chunks.reserve(num_chunks);
+  for (auto const& input : inputs) {
+    for (std::size_t offset = 0; offset < input.size(); offset += compression_chunk_size) {
+      d_input_chunks.push_back(
+        input.subspan(offset, std::min(compression_chunk_size, input.size() - offset)));
+      d_output_chunks.push_back({d_compressed + d_output_chunks.size() * slot_size, slot_size});
+    }
+  }
+  if (num_chunks == 0) { return {std::move(compressed), slot_size, {}}; }
+
+  auto const d_inputs  = make_device_uvector_async(d_input_chunks, stream);
+  auto const d_outputs = make_device_uvector_async(d_output_chunks, stream);
+  rmm::device_uvector<io::decompress_status> d_statuses(num_chunks, stream);
+  io::nvcomp::batched_compress(
+    nvcomp_type, d_inputs, d_outputs, d_statuses, compression_chunk_size, stream);
+  auto const statuses = make_std_vector_sync(d_statuses, stream);
+
+  std::vector<std::size_t> sizes(num_chunks);
+  std::transform(statuses.begin(), statuses.end(), sizes.begin(), [](auto const& status) {
+    CUDF_EXPECTS(status.status == 0, "Error in chunked compression");
+    return static_cast<std::size_t>(status.bytes_written);
+  });
+  return {std::move(compressed), slot_size, std::move(sizes)};
+}
+
+void decompress_chunks(device_span<uint8_t const> compressed,
+                       host_span<std::size_t const> chunk_sizes,
+                       host_span<device_span<uint8_t> const> outputs,
+                       io::compression_type compression,
+                       rmm::cuda_stream_view stream)
+{
+  std::vector<device_span<uint8_t const>> d_input_chunks;
+  std::vector<device_span<uint8_t>> d_output_chunks;
+  std::size_t total_size        = 0;
+  std::size_t compressed_offset = 0;
+  for (auto const& output : outputs) {
+    for (std::size_t offset = 0; offset < output.size(); offset += compression_chunk_size) {
+      auto const chunk = d_input_chunks.size();
+      CUDF_EXPECTS(chunk < chunk_sizes.size(), "Missing compressed chunks");
+      d_input_chunks.push_back(compressed.subspan(compressed_offset, chunk_sizes[chunk]));
+      d_output_chunks.push_back(
+        output.subspan(offset, std::min(compression_chunk_size, output.size() - offset)));
+      compressed_offset += chunk_sizes[chunk];
+    }
+    total_size += output.size();
+  }
+  CUDF_EXPECTS(d_input_chunks.size() == chunk_sizes.size(), "Unexpected compressed chunks");
+  if (d_input_chunks.empty()) { return; }
+
+  auto const num_chunks = d_input_chunks.size();
+  auto const d_inputs   = make_device_uvector_async(d_input_chunks, stream);
+  auto const d_outputs  = make_device_uvector_async(d_output_chunks, stream);
+  rmm::device_uvector<io::decompress_status> d_statuses(num_chunks, stream);
+  io::nvcomp::batched_decompress(to_nvcomp_compression(compression),
+                                 d_inputs,
+                                 d_outputs,
+                                 d_statuses,
+                                 compression_chunk_size,
+                                 total_size,
+                                 stream);
+  auto const statuses = make_std_vector_sync(d_statuses, stream);
+  CUDF_EXPECTS(std::all_of(statuses.begin(),
+                           statuses.end(),
+                           [](auto const& status) { return status.status == 0; }),
+               "Error in chunked decompression");
+}
+
+}  // namespace cudf::detail
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cudf::detail {
+
+// Size of the chunks compressed independently; nvCOMP limits the chunk size of LZ4 and Zstandard
+constexpr std::size_t compression_chunk_size = std::size_t{1} << 20;
+
+/**
+ * @brief Returns the number of chunks a buffer of `size` bytes is compressed in.
+ */
+constexpr std::size_t num_compression_chunks(std::size_t size)
+{
+  return (size + compression_chunk_size - 1) / compression_chunk_size;
+}
+
+/**
+ * @brief Returns whether `compression` can compress device buffers in chunks.
+ */
+bool is_chunked_compression_supported(io::compression_type compression);
+
+/**
+ * @brief Chunks compressed by `compress_chunks`.
+ *
+ * Each chunk is stored at the start of a slot of `slot_size` bytes of `data`, in the order of the
+ * buffers and of the chunks within each buffer.
+ */
+struct compressed_chunks {
+  rmm::device_buffer data;
+  std::size_t slot_size;
+  std::vector<std::size_t> sizes;  // compressed size of each chunk
+
+  /**
+   * @brief Returns the total compressed size of the chunks.
+   */
+  [[nodiscard]] std::size_t compressed_size() const;
+
+  /**
+   * @brief Copies the compressed chunks back to back to host or device memory.
+   *
+   * @param destination Memory of at least `compressed_size()` bytes
+   * @param stream CUDA stream used for the copies
+   */
+  void copy_compacted(void* destination, rmm::cuda_stream_view stream) const;
+};
+
+/**
+ * @brief Compresses buffers in chunks of `compression_chunk_size` bytes with a single nvCOMP
+ * batch.
+ *
+ * @throws cudf::logic_error if `compression` is not supported or if a chunk fails to compress
+ *
+ * @param inputs The device buffers to compress
+ * @param compression The compression to apply
+ * @param stream CUDA stream used for the compression, synchronized before returning
+ * @return The compressed chunks, in temporary memory of the current device resource
+ */
+compressed_chunks compress_chunks(host_span<device_span<uint8_t const> const> inputs,
+                                  io::compression_type compression,
+                                  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Decompresses chunks compressed by `compress_chunks` with a single nvCOMP batch.
+ *
+ * @throws cudf::logic_error if the number of chunks does not match the outputs or if a chunk
+ * fails to decompress
+ *
+ * @param compressed The compressed chunks, back to back
+ * @param chunk_sizes The compressed size of each chunk
+ * @param outputs The device buffers to decompress to, of their uncompressed sizes
+ * @param compression The compression of the chunks
+ * @param stream CUDA stream used for the decompression, synchronized before returning
+ */
+void decompress_chunks(device_span<uint8_t const> compressed,
+                       host_span<std::size_t const> chunk_sizes,
+                       host_span<device_span<uint8_t> const> outputs,
+                       io::compression_type compression,
+                       rmm::cuda_stream_view stream);
+
+}  // namespace cudf::detail
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chunked_compression.hpp"
+
+#include <cudf/compressed_table.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+namespace cudf {
+namespace {
+
+// Alignment of the decompressed slices, as of the buffers of `cudf::contiguous_split`
+constexpr std::size_t slice_alignment = 256;
+
+}  // namespace
+
+compressed_table::compressed_table(table_view const& input,
+                                   io::compression_type compression,
+                                   size_type slice_rows,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+  : _num_rows{input.num_rows()},
+    _slice_rows{slice_rows},
+    _compression{compression},
+    _data{0, stream, mr}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(detail::is_chunked_compression_supported(compression),
+               "Unsupported compressed table compression type");
+  CUDF_EXPECTS(slice_rows > 0, "Compressed table slice size must be positive");
+
+  std::vector<size_type> splits;
+  for (auto row = static_cast<int64_t>(slice_rows); row < _num_rows; row += slice_rows) {
+    splits.push_back(static_cast<size_type>(row));
+  }
+  // The uncompressed slices are temporary
+  auto const packed =
+    detail::contiguous_split(input, splits, stream, rmm::mr::get_current_device_resource());
+
+  std::vector<device_span<uint8_t const>> buffers;
+  buffers.reserve(packed.size());
+  for (auto const& slice : packed) {
+    buffers.emplace_back(static_cast<uint8_t const*>(slice.data.gpu_data->data()),
+                         slice.data.gpu_data->size());
+  }
+  auto const chunks = detail::compress_chunks(buffers, compression, stream);
+  _data             = rmm::device_buffer(chunks.compressed_size(), stream, mr);
+  chunks.copy_compacted(_data.data(), stream);
+  _chunk_sizes = chunks.sizes;
+
+  _slices.reserve(packed.size());
+  std::size_t first_chunk       = 0;
+  std::size_t compressed_offset = 0;
+  for (std::size_t i = 0; i < packed.size(); ++i) {
+    auto const size = buffers[i].size();
+    _slices.push_back({*packed[i].data.metadata, size, first_chunk, compressed_offset});
+    for (std::size_t chunk = 0; chunk < detail::num_compression_chunks(size); ++chunk) {
+      compressed_offset += _chunk_sizes[first_chunk++];
+    }
+  }
+}
+
+std::size_t compressed_table::uncompressed_size() const noexcept
+{
+  return std::accumulate(
+    _slices.begin(), _slices.end(), std::size_t{0}, [](auto sum, auto const& slice) {
+      return sum + slice.size;
+    });
+}
+
+std::unique_ptr<table> compressed_table::decompress(rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr) const
+{
+  return decompress(0, _num_rows, stream, mr);
+}
+
+std::unique_ptr<table> compressed_table::decompress(size_type begin,
+                                                    size_type end,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(begin >= 0 and begin <= end and end <= _num_rows,
+               "Row range out of bounds of the compressed table");
+  if (_slices.empty()) { return std::make_unique<table>(); }
+
+  // An empty range still decompresses one slice, for the types of the columns
+  auto const num_slices  = static_cast<size_type>(_slices.size());
+  auto const first_slice = std::min(begin / _slice_rows, num_slices - 1);
+  auto const last_slice =
+    std::max(first_slice + 1, util::div_rounding_up_safe(end, _slice_rows));
+
+  std::vector<std::size_t> offsets;
+  std::size_t decompressed_size = 0;
+  for (auto s = first_slice; s < last_slice; ++s) {
+    offsets.push_back(decompressed_size);
+    decompressed_size += util::round_up_safe(_slices[s].size, slice_alignment);
+  }
+  // The decompressed slices are temporary
+  rmm::device_buffer decompressed(decompressed_size, stream);
+  auto const d_decompressed = static_cast<uint8_t*>(decompressed.data());
+  std::vector<device_span<uint8_t>> outputs;
+  for (auto s = first_slice; s < last_slice; ++s) {
+    outputs.emplace_back(d_decompressed + offsets[s - first_slice], _slices[s].size);
+  }
+
+  auto const& first         = _slices[first_slice];
+  auto const is_last        = last_slice == num_slices;
+  auto const chunks_end     = is_last ? _chunk_sizes.size() : _slices[last_slice].first_chunk;
+  auto const compressed_end = is_last ? _data.size() : _slices[last_slice].compressed_offset;
+  detail::decompress_chunks(
+    {static_cast<uint8_t const*>(_data.data()) + first.compressed_offset,
+     compressed_end - first.compressed_offset},
+    host_span<std::size_t const>{_chunk_sizes.data() + first.first_chunk,
+                                 chunks_end - first.first_chunk},
+    outputs,
+    _compression,
+    stream);
+
+  std::vector<table_view> views;
+  for (auto s = first_slice; s < last_slice; ++s) {
+    auto const slice_begin = s * _slice_rows;
+    auto const view =
+      unpack(_slices[s].metadata.data(), d_decompressed + offsets[s - first_slice]);
+    auto const rows_begin = std::clamp(begin - slice_begin, 0, view.num_rows());
+    auto const rows_end   = std::clamp(end - slice_begin, rows_begin, view.num_rows());
+    views.push_back(detail::slice(view, {rows_begin, rows_end}, stream).front());
+  }
+  return views.size() == 1 ? std::make_unique<table>(views.front(), stream, mr)
+                           : detail::concatenate(views, stream, mr);
+}
+
+}  // namespace cudf
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "chunked_compression.hpp"
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/spilling.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace cudf {
+namespace {
+
+struct pinned_host_deleter {
+  void operator()(uint8_t* ptr) const { cudaFreeHost(ptr); }
+};
+
+using pinned_host_buffer = std::unique_ptr<uint8_t[], pinned_host_deleter>;
+
+pinned_host_buffer make_pinned_host_buffer(std::size_t size)
+{
+  void* ptr = nullptr;
+  CUDF_CUDA_TRY(cudaMallocHost(&ptr, size));
+  return pinned_host_buffer{static_cast<uint8_t*>(ptr)};
+}
+
+/**
+ * @brief Marks the current thread as spilling while alive.
+ *
+ * Allocations made to spill a table may fail and call back into `spill_manager::spill`, which
+ * must not spill recursively: the thread holds the lock of the table it spills.
+ */
+class spilling_scope {
+ public:
+  spilling_scope() : was_spilling{std::exchange(is_spilling, true)} {}
+  ~spilling_scope() { is_spilling = was_spilling; }
+
+  static bool is_active() { return is_spilling; }
+
+ private:
+  bool const was_spilling;
+  static thread_local bool is_spilling;
+};
+
+thread_local bool spilling_scope::is_spilling = false;
+
+}  // namespace
+
+/**
+ * @brief Host copy of the device data of a spilled table.
+ *
+ * A compressed copy stores the chunks of `detail::compression_chunk_size` bytes compressed back
+ * to back; `chunk_sizes` holds their compressed sizes.
+ */
+struct spillable_table::host_copy {
+  pinned_host_buffer data;
+  std::size_t size;
+  io::compression_type compression;
+  std::vector<std::size_t> chunk_sizes;
+};
+
+namespace {
+
+std::unique_ptr<spillable_table::host_copy> copy_to_host(device_span<uint8_t const> data,
+                                                         rmm::cuda_stream_view stream)
+{
+  auto spill = std::make_unique<spillable_table::host_copy>(spillable_table::host_copy{
+    make_pinned_host_buffer(data.size()), data.size(), io::compression_type::NONE, {}});
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    spill->data.get(), data.data(), data.size(), cudaMemcpyDeviceToHost, stream.value()));
+  stream.synchronize();
+  return spill;
+}
+
+std::unique_ptr<spillable_table::host_copy> compress_to_host(device_span<uint8_t const> data,
+                                                             io::compression_type compression,
+                                                             rmm::cuda_stream_view stream)
+{
+  auto const chunks = detail::compress_chunks(
+    host_span<device_span<uint8_t const> const>{&data, 1}, compression, stream);
+  auto spill = std::make_unique<spillable_table::host_copy>(spillable_table::host_copy{
+    make_pinned_host_buffer(chunks.compressed_size()), data.size(), compression, chunks.sizes});
+  chunks.copy_compacted(spill->data.get(), stream);
+  stream.synchronize();
+  return spill;
+}
+
+rmm::device_buffer copy_to_device(spillable_table::host_copy const& spill,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  rmm::device_buffer data(spill.size, stream, mr);
+  if (spill.compression == io::compression_type::NONE) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      data.data(), spill.data.get(), spill.size, cudaMemcpyHostToDevice, stream.value()));
+    stream.synchronize();
+    return data;
+  }
+
+  auto const compressed_size =
+    std::accumulate(spill.chunk_sizes.begin(), spill.chunk_sizes.end(), std::size_t{0});
+  rmm::device_buffer compressed(compressed_size, stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(compressed.data(),
+                                spill.data.get(),
+                                compressed_size,
+                                cudaMemcpyHostToDevice,
+                                stream.value()));
+  device_span<uint8_t> const output{static_cast<uint8_t*>(data.data()), spill.size};
+  detail::decompress_chunks({static_cast<uint8_t const*>(compressed.data()), compressed_size},
+                            spill.chunk_sizes,
+                            host_span<device_span<uint8_t> const>{&output, 1},
+                            spill.compression,
+                            stream);
+  return data;
+}
+
+}  // namespace
+
+spillable_table::accessor::accessor(accessor&& other) noexcept
+  : _table{std::exchange(other._table, nullptr)}, _view{other._view}
+{
+}
+
+spillable_table::accessor::~accessor()
+{
+  if (_table != nullptr) { _table->release_accessor(); }
+}
+
+spillable_table::spillable_table(packed_columns&& packed, spill_manager* manager)
+  : _manager{manager},
+    _size{packed.gpu_data->size()},
+    _packed{std::move(packed)},
+    _view{cudf::unpack(_packed)},
+    _last_access{manager->next_access()}
+{
+}
+
+spillable_table::~spillable_table() { _manager->unregister(this); }
+
+spillable_table::accessor spillable_table::access(rmm::cuda_stream_view stream,
+                                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_spill != nullptr) {
+    _packed.gpu_data = std::make_unique<rmm::device_buffer>(copy_to_device(*_spill, stream, mr));
+    _view            = cudf::unpack(_packed);
+    _spill.reset();
+    _is_spilled = false;
+  }
+  ++_accessors;
+  _last_access = _manager->next_access();
+  return accessor{this, _view};
+}
+
+std::size_t spillable_table::spill(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  // Spilled tables are skipped before locking: a table being reloaded is still marked as spilled,
+  // and its reload may allocate device memory and spill on the same thread
+  if (is_spilled()) { return 0; }
+  // Tables being spilled or accessed by other threads are skipped rather than waited for
+  std::unique_lock<std::mutex> lock(_mutex, std::try_to_lock);
+  if (not lock.owns_lock() or _spill != nullptr or _accessors > 0 or _size == 0) { return 0; }
+  spilling_scope const scope;
+
+  device_span<uint8_t const> const data{static_cast<uint8_t const*>(_packed.gpu_data->data()),
+                                        _size};
+  auto const compression = _manager->compression();
+  if (compression != io::compression_type::NONE) {
+    try {
+      _spill = compress_to_host(data, compression, stream);
+    } catch (rmm::bad_alloc const&) {
+      // Not enough device memory to compress, the table is spilled uncompressed
+    } catch (cudf::logic_error const&) {
+      // The compression is not available in this nvCOMP build
+    }
+  }
+  if (_spill == nullptr) { _spill = copy_to_host(data, stream); }
+
+  _packed.gpu_data = std::make_unique<rmm::device_buffer>();
+  _view            = table_view{};
+  _is_spilled      = true;
+  return _size;
+}
+
+void spillable_table::release_accessor()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  --_accessors;
+}
+
+spill_manager::spill_manager(io::compression_type compression) : _compression{compression}
+{
+  CUDF_EXPECTS(compression == io::compression_type::NONE or
+                 detail::is_chunked_compression_supported(compression),
+               "Unsupported spill compression type");
+}
+
+std::unique_ptr<spillable_table> spill_manager::make_spillable(packed_columns&& packed)
+{
+  CUDF_FUNC_RANGE();
+  std::unique_ptr<spillable_table> table{new spillable_table(std::move(packed), this)};
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.insert(table.get());
+  return table;
+}
+
+std::unique_ptr<spillable_table> spill_manager::make_spillable(table_view const& input,
+                                                               rmm::cuda_stream_view stream,
+                                                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return make_spillable(cudf::detail::pack(input, stream, mr));
+}
+
+std::size_t spill_manager::spill(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (spilling_scope::is_active()) { return 0; }
+  spilling_scope const scope;
+
+  // The tables cannot be destroyed while the lock is held
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::vector<spillable_table*> tables(_tables.begin(), _tables.end());
+  std::sort(tables.begin(), tables.end(), [](auto const lhs, auto const rhs) {
+    return lhs->_last_access < rhs->_last_access;
+  });
+
+  std::size_t spilled = 0;
+  for (auto table : tables) {
+    if (spilled >= bytes) { break; }
+    spilled += table->spill(stream);
+  }
+  return spilled;
+}
+
+std::size_t spill_manager::device_size() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return std::accumulate(_tables.begin(), _tables.end(), std::size_t{0}, [](auto sum, auto table) {
+    return table->is_spilled() ? sum : sum + table->size();
+  });
+}
+
+void spill_manager::unregister(spillable_table* table)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _tables.erase(table);
+}
+
+}  // namespace cudf
@@ -27,35 +27,51 @@
 
 #include <thrust/copy.h>
 #include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
 
+#include <limits>
+#include <memory>
 #include <utility>
 #include <vector>
 
 namespace cudf {
 namespace detail {
 
-rmm::device_uvector<size_type> get_distinct_indices(table_view const& input,
-                                                    duplicate_keep_option keep,
-                                                    null_equality nulls_equal,
-                                                    nan_equality nans_equal,
-                                                    rmm::cuda_stream_view stream,
-                                                    rmm::mr::device_memory_resource* mr)
-{
-  if (input.num_rows() == 0 or input.num_columns() == 0) {
-    return rmm::device_uvector<size_type>(0, stream, mr);
-  }
-
-  auto map = hash_map_type{compute_hash_table_size(input.num_rows()),
-                           cuco::sentinel::empty_key{COMPACTION_EMPTY_KEY_SENTINEL},
-                           cuco::sentinel::empty_value{COMPACTION_EMPTY_VALUE_SENTINEL},
-                           detail::hash_table_allocator_type{default_allocator<char>{}, stream},
-                           stream.value()};
+namespace {
 
-  auto const preprocessed_input =
-    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
-  auto const has_nulls = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+/**
+ * @brief Inserts the indices of all the rows of a table into a hash map keyed by row equality.
+ *
+ * Only one index of every group of rows comparing equal ends up in the map.
+ *
+ * @param preprocessed_input The preprocessed input rows for row hashing and row comparisons
+ * @param num_rows The number of input rows
+ * @param has_nulls Indicate whether the input rows has any nulls at any nested levels
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The map from the index of a distinct row to itself
+ */
+std::unique_ptr<hash_map_type> insert_distinct_rows(
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_input,
+  size_type num_rows,
+  nullate::DYNAMIC has_nulls,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream)
+{
+  auto map = std::make_unique<hash_map_type>(
+    compute_hash_table_size(num_rows),
+    cuco::sentinel::empty_key{COMPACTION_EMPTY_KEY_SENTINEL},
+    cuco::sentinel::empty_value{COMPACTION_EMPTY_VALUE_SENTINEL},
+    detail::hash_table_allocator_type{default_allocator<char>{}, stream},
+    stream.value());
 
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
   auto const key_hasher = experimental::compaction_hash(row_hasher.device_hasher(has_nulls));
@@ -67,7 +83,7 @@ rmm::device_uvector<size_type> get_distinct_indices(table_view const& input,
 
   auto const insert_keys = [&](auto const value_comp) {
     auto const key_equal = row_comp.equal_to(has_nulls, nulls_equal, value_comp);
-    map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
+    map->insert(pair_iter, pair_iter + num_rows, key_hasher, key_equal, stream.value());
   };
 
   if (nans_equal == nan_equality::ALL_EQUAL) {
@@ -78,6 +94,83 @@ rmm::device_uvector<size_type> get_distinct_indices(table_view const& input,
     using nan_unequal_comparator = cudf::experimental::row::equality::physical_equality_comparator;
     insert_keys(nan_unequal_comparator{});
   }
+  return map;
+}
+
+/**
+ * @brief Writes, for every row, the index of the row of its group that was inserted into `map`.
+ *
+ * Rows that do not compare equal to themselves, because of nulls or NaNs compared unequal, are
+ * groups of their own and get their own index.
+ *
+ * @param map The map the rows were inserted into with `insert_distinct_rows`
+ * @param preprocessed_input The preprocessed input rows for row hashing and row comparisons
+ * @param num_rows The number of input rows
+ * @param has_nulls Indicate whether the input rows has any nulls at any nested levels
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param output The index of the inserted row of the group of every row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void find_inserted_rows(
+  hash_map_type& map,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_input,
+  size_type num_rows,
+  nullate::DYNAMIC has_nulls,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  size_type* output,
+  rmm::cuda_stream_view stream)
+{
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
+  auto const key_hasher = experimental::compaction_hash(row_hasher.device_hasher(has_nulls));
+
+  auto const row_comp = cudf::experimental::row::equality::self_comparator(preprocessed_input);
+
+  auto const rows      = thrust::make_counting_iterator<size_type>(0);
+  auto const find_keys = [&](auto const value_comp) {
+    auto const key_equal = row_comp.equal_to(has_nulls, nulls_equal, value_comp);
+    map.find(rows, rows + num_rows, output, key_hasher, key_equal, stream.value());
+  };
+
+  if (nans_equal == nan_equality::ALL_EQUAL) {
+    using nan_equal_comparator =
+      cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+    find_keys(nan_equal_comparator{});
+  } else {
+    using nan_unequal_comparator = cudf::experimental::row::equality::physical_equality_comparator;
+    find_keys(nan_unequal_comparator{});
+  }
+
+  thrust::transform(rmm::exec_policy(stream),
+                    output,
+                    output + num_rows,
+                    rows,
+                    output,
+                    [] __device__(size_type const found, size_type const idx) {
+                      return found == COMPACTION_EMPTY_VALUE_SENTINEL ? idx : found;
+                    });
+}
+
+}  // namespace
+
+rmm::device_uvector<size_type> get_distinct_indices(table_view const& input,
+                                                    duplicate_keep_option keep,
+                                                    null_equality nulls_equal,
+                                                    nan_equality nans_equal,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return rmm::device_uvector<size_type>(0, stream, mr);
+  }
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const map_ptr   = insert_distinct_rows(
+    preprocessed_input, input.num_rows(), has_nulls, nulls_equal, nans_equal, stream);
+  auto& map            = *map_ptr;
 
   auto output_indices = rmm::device_uvector<size_type>(map.get_size(), stream, mr);
 
@@ -126,6 +219,137 @@ rmm::device_uvector<size_type> get_distinct_indices(table_view const& input,
   return output_indices;
 }
 
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>>
+get_distinct_indices_and_counts(table_view const& input,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::mr::device_memory_resource* mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return {rmm::device_uvector<size_type>(0, stream, mr),
+            rmm::device_uvector<size_type>(0, stream, mr)};
+  }
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const map       = insert_distinct_rows(
+    preprocessed_input, input.num_rows(), has_nulls, nulls_equal, nans_equal, stream);
+
+  // Reduction results with `KEEP_NONE` are the group sizes at the index of the row of each group
+  // found in the map, and `0` everywhere else.
+  auto const group_sizes = hash_reduce_by_row(*map,
+                                               preprocessed_input,
+                                               input.num_rows(),
+                                               has_nulls,
+                                               duplicate_keep_option::KEEP_NONE,
+                                               nulls_equal,
+                                               nans_equal,
+                                               stream);
+
+  auto const num_distinct = map->get_size();
+  auto indices            = rmm::device_uvector<size_type>(num_distinct, stream, mr);
+  auto counts             = rmm::device_uvector<size_type>(num_distinct, stream, mr);
+  auto const is_group     = [group_sizes = group_sizes.begin()] __device__(auto const idx) {
+    return group_sizes[idx] > size_type{0};
+  };
+  auto const indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                           thrust::make_counting_iterator(0),
+                                           thrust::make_counting_iterator(input.num_rows()),
+                                           indices.begin(),
+                                           is_group);
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+  counts.resize(indices.size(), stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 indices.begin(),
+                 indices.end(),
+                 group_sizes.begin(),
+                 counts.begin());
+  return {std::move(indices), std::move(counts)};
+}
+
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> get_distinct_row_codes(
+  table_view const& input,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  auto const num_rows = input.num_rows();
+  if (num_rows == 0 or input.num_columns() == 0) {
+    return {rmm::device_uvector<size_type>(0, stream, mr),
+            rmm::device_uvector<size_type>(0, stream, mr)};
+  }
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const map       = insert_distinct_rows(
+    preprocessed_input, num_rows, has_nulls, nulls_equal, nans_equal, stream);
+
+  auto first_rows = rmm::device_uvector<size_type>(num_rows, stream);
+  find_inserted_rows(*map,
+                     preprocessed_input,
+                     num_rows,
+                     has_nulls,
+                     nulls_equal,
+                     nans_equal,
+                     first_rows.data(),
+                     stream);
+
+  // Replace the inserted row of every group by its first row, so that the codes do not depend on
+  // which row won the insertion
+  auto group_rows = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::uninitialized_fill(rmm::exec_policy(stream),
+                             group_rows.begin(),
+                             group_rows.end(),
+                             std::numeric_limits<size_type>::max());
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::make_counting_iterator(0),
+                   thrust::make_counting_iterator(num_rows),
+                   [inserted = first_rows.begin(), group_rows = group_rows.begin()] __device__(
+                     size_type const idx) { atomicMin(&group_rows[inserted[idx]], idx); });
+  thrust::transform(rmm::exec_policy(stream),
+                    first_rows.begin(),
+                    first_rows.end(),
+                    first_rows.begin(),
+                    [group_rows = group_rows.begin()] __device__(size_type const inserted) {
+                      return group_rows[inserted];
+                    });
+
+  // The code of a group is the number of groups whose first row comes before its own
+  auto const is_first_row = [first_rows = first_rows.begin()] __device__(size_type const idx) {
+    return first_rows[idx] == idx;
+  };
+  auto& group_codes = group_rows;
+  thrust::transform_exclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator(0),
+                                   thrust::make_counting_iterator(num_rows),
+                                   group_codes.begin(),
+                                   [is_first_row] __device__(size_type const idx) {
+                                     return static_cast<size_type>(is_first_row(idx));
+                                   },
+                                   size_type{0},
+                                   thrust::plus<size_type>{});
+
+  auto indices           = rmm::device_uvector<size_type>(map->get_size(), stream, mr);
+  auto const indices_end = thrust::copy_if(rmm::exec_policy(stream),
+                                           thrust::make_counting_iterator(0),
+                                           thrust::make_counting_iterator(num_rows),
+                                           indices.begin(),
+                                           is_first_row);
+  indices.resize(thrust::distance(indices.begin(), indices_end), stream);
+
+  auto codes = rmm::device_uvector<size_type>(num_rows, stream, mr);
+  thrust::gather(rmm::exec_policy(stream),
+                 first_rows.begin(),
+                 first_rows.end(),
+                 group_codes.begin(),
+                 codes.begin());
+  return {std::move(indices), std::move(codes)};
+}
+
 std::unique_ptr<table> distinct(table_view const& input,
                                 std::vector<size_type> const& keys,
                                 duplicate_keep_option keep,
@@ -150,16 +374,42 @@ std::unique_ptr<table> distinct(table_view const& input,
 
 }  // namespace detail
 
+std::unique_ptr<column> distinct_indices(table_view const& input,
+                                         duplicate_keep_option keep,
+                                         null_equality nulls_equal,
+                                         nan_equality nans_equal,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<column>(detail::get_distinct_indices(
+    input, keep, nulls_equal, nans_equal, stream, mr));
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> distinct_indices_and_counts(
+  table_view const& input,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  auto [indices, counts] = detail::get_distinct_indices_and_counts(
+    input, nulls_equal, nans_equal, stream, mr);
+  return {std::make_unique<column>(std::move(indices)),
+          std::make_unique<column>(std::move(counts))};
+}
+
 std::unique_ptr<table> distinct(table_view const& input,
                                 std::vector<size_type> const& keys,
                                 duplicate_keep_option keep,
                                 null_equality nulls_equal,
                                 nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::distinct(
-    input, keys, keep, nulls_equal, nans_equal, cudf::default_stream_value, mr);
+  return detail::distinct(input, keys, keep, nulls_equal, nans_equal, stream, mr);
 }
 
 }  // namespace cudf
@@ -89,20 +89,47 @@ std::unique_ptr<table> drop_nulls(table_view const& input,
 std::unique_ptr<table> drop_nulls(table_view const& input,
                                   std::vector<size_type> const& keys,
                                   cudf::size_type keep_threshold,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::drop_nulls(input, keys, keep_threshold, cudf::default_stream_value, mr);
+  return cudf::detail::drop_nulls(input, keys, keep_threshold, stream, mr);
 }
 /*
  * Filters a table to remove null elements.
  */
 std::unique_ptr<table> drop_nulls(table_view const& input,
                                   std::vector<size_type> const& keys,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::drop_nulls(input, keys, keys.size(), stream, mr);
+}
+
+/*
+ * Filters a table to remove null elements, sharing the input if it has none.
+ */
+std::unique_ptr<table> drop_nulls(table const& input,
+                                  std::vector<size_type> const& keys,
+                                  cudf::size_type keep_threshold,
+                                  rmm::cuda_stream_view stream,
                                   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return cudf::detail::drop_nulls(input, keys, keys.size(), cudf::default_stream_value, mr);
+  if (not cudf::has_nulls(input.select(keys))) { return input.share(); }
+  return cudf::detail::drop_nulls(input.view(), keys, keep_threshold, stream, mr);
+}
+
+/*
+ * Filters a table to remove null elements, sharing the input if it has none.
+ */
+std::unique_ptr<table> drop_nulls(table const& input,
+                                  std::vector<size_type> const& keys,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return cudf::drop_nulls(input, keys, keys.size(), stream, mr);
 }
 
 }  // namespace cudf
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/expression_evaluator.cuh>
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/null_mask.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Kernel evaluating a boolean expression on a table into a bitmask of the passing rows.
+ *
+ * The rows are strided by whole warps, so each warp writes the bits of its rows as one word of
+ * `passing_rows`. A row passes if the expression is valid and true on it. The block size must be
+ * a multiple of the warp size.
+ *
+ * @tparam max_block_size The size of the thread block, used to set launch bounds.
+ * @tparam has_nulls Whether or not the expression may evaluate to null.
+ *
+ * @param table The table device view used for evaluation.
+ * @param device_expression_data Container of device data required to evaluate the expression.
+ * @param passing_rows The bitmask of the rows passing the expression.
+ */
+template <cudf::size_type max_block_size, bool has_nulls>
+__launch_bounds__(max_block_size) __global__
+  void evaluate_filter_kernel(table_device_view const table,
+                              ast::detail::expression_device_view device_expression_data,
+                              bitmask_type* passing_rows)
+{
+  extern __shared__ char raw_intermediate_storage[];
+  ast::detail::IntermediateDataType<has_nulls>* intermediate_storage =
+    reinterpret_cast<ast::detail::IntermediateDataType<has_nulls>*>(raw_intermediate_storage);
+
+  auto thread_intermediate_storage =
+    &intermediate_storage[threadIdx.x * device_expression_data.num_intermediates];
+  auto const start_idx =
+    static_cast<cudf::thread_index_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const stride = static_cast<cudf::thread_index_type>(blockDim.x * gridDim.x);
+  auto const lane   = threadIdx.x % cudf::detail::warp_size;
+  auto evaluator =
+    cudf::ast::detail::expression_evaluator<has_nulls>(table, device_expression_data);
+
+  // the first row of the warp decides whether the warp iterates, so the ballot is warp-uniform
+  for (thread_index_type row_index = start_idx; row_index - lane < table.num_rows();
+       row_index += stride) {
+    auto passes = false;
+    if (row_index < table.num_rows()) {
+      auto output_dest = ast::detail::value_expression_result<bool, has_nulls>();
+      evaluator.evaluate(
+        output_dest, static_cast<cudf::size_type>(row_index), thread_intermediate_storage);
+      passes = output_dest.is_valid() && output_dest.value();
+    }
+    auto const word = __ballot_sync(0xffff'ffff, passes);
+    if (lane == 0) { passing_rows[word_index(static_cast<cudf::size_type>(row_index))] = word; }
+  }
+}
+
+// Returns true if the bit of row i is set. This is the filter functor for filter.
+struct passing_rows_filter {
+  bitmask_type const* passing_rows;
+
+  __device__ inline bool operator()(cudf::size_type i) const { return bit_is_set(passing_rows, i); }
+};
+
+}  // namespace
+
+/*
+ * Filters a table_view using a boolean expression.
+ *
+ * Evaluates the expression into a bitmask of the passing rows, then calls copy_if() with the
+ * `passing_rows_filter` functor.
+ */
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  auto const has_nulls = predicate.may_evaluate_null(input, stream);
+
+  auto const parser = ast::detail::expression_parser{predicate, input, has_nulls, stream, mr};
+  CUDF_EXPECTS(parser.output_type().id() == type_id::BOOL8,
+               "The expression must produce a boolean output.");
+
+  if (input.num_rows() == 0) { return empty_like(input); }
+
+  // The passing rows take one bit each, instead of the byte and the null bit of a BOOL8 column
+  auto passing_rows = rmm::device_buffer(bitmask_allocation_size_bytes(input.num_rows()),
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+
+  // Configure kernel parameters
+  auto const& device_expression_data = parser.device_expression_data;
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  auto constexpr MAX_BLOCK_SIZE = 128;
+  // Whole warps are required by the ballot writing the bitmask
+  auto const block_size =
+    parser.shmem_per_thread != 0
+      ? std::min(MAX_BLOCK_SIZE,
+                 shmem_limit_per_block / parser.shmem_per_thread / warp_size * warp_size)
+      : MAX_BLOCK_SIZE;
+  CUDF_EXPECTS(block_size > 0, "The expression requires too much shared memory.");
+  auto const config          = cudf::detail::grid_1d{input.num_rows(), block_size};
+  auto const shmem_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+  // Execute the kernel
+  auto table_device            = table_device_view::create(input, stream);
+  auto const passing_rows_data = static_cast<bitmask_type*>(passing_rows.data());
+  if (has_nulls) {
+    evaluate_filter_kernel<MAX_BLOCK_SIZE, true>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, passing_rows_data);
+  } else {
+    evaluate_filter_kernel<MAX_BLOCK_SIZE, false>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_per_block, stream.value()>>>(
+        *table_device, device_expression_data, passing_rows_data);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+
+  return detail::copy_if(input, passing_rows_filter{passing_rows_data}, stream, mr);
+}
+
+}  // namespace detail
+
+/*
+ * Filters a table_view using a boolean expression.
+ */
+std::unique_ptr<table> filter(table_view const& input,
+                              ast::expression const& predicate,
+                              rmm::cuda_stream_view stream,
+                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter(input, predicate, stream, mr);
+}
+}  // namespace cudf
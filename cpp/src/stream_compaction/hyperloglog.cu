@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/hyperloglog/hyperloglog.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/count.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform_reduce.h>
+
+#include <limits>
+
+namespace cudf {
+namespace detail {
+namespace hyperloglog {
+namespace {
+
+constexpr int min_precision = 4;
+constexpr int max_precision = 18;
+
+// seeds of the two 32-bit row hashes forming the 64-bit hash of a row
+constexpr uint32_t high_hash_seed = 0x5bd1e995;
+constexpr uint32_t low_hash_seed  = 0x1b873593;
+
+/**
+ * @brief Atomically stores `value` in the byte register at `index` if it is larger.
+ *
+ * The registers are updated through a compare-and-swap of the aligned 32-bit word holding them.
+ */
+__device__ void atomic_max_register(uint8_t* registers, std::size_t index, uint8_t value)
+{
+  auto const address = reinterpret_cast<uintptr_t>(registers + index);
+  auto word          = reinterpret_cast<unsigned int*>(address & ~uintptr_t{3});
+  auto const shift   = static_cast<unsigned int>(address & 3) * 8;
+  auto old           = *word;
+  unsigned int assumed;
+  do {
+    assumed = old;
+    if (((assumed >> shift) & 0xffu) >= value) { return; }
+    old = atomicCAS(
+      word, assumed, (assumed & ~(0xffu << shift)) | (static_cast<unsigned int>(value) << shift));
+  } while (assumed != old);
+}
+
+/**
+ * @brief Inserts the hash of every valid row into the sketch of its group.
+ *
+ * The first `precision` bits of the hash select the register, which records the largest position
+ * of the leading set bit among the remaining bits.
+ */
+template <typename RowHasher>
+struct insert_fn {
+  column_device_view const d_values;
+  RowHasher const high_hasher;
+  RowHasher const low_hasher;
+  size_type const* group_labels;  ///< nullptr for a single group
+  uint8_t* registers;
+  int precision;
+
+  __device__ void operator()(size_type row) const
+  {
+    if (d_values.is_null(row)) { return; }
+    auto const hash =
+      (static_cast<uint64_t>(high_hasher(row)) << 32) | static_cast<uint64_t>(low_hasher(row));
+    auto const index = hash >> (64 - precision);
+    auto const rest  = hash << precision;
+    auto const rank  = rest == 0 ? 64 - precision + 1 : __clzll(static_cast<long long>(rest)) + 1;
+    auto const group = group_labels == nullptr ? 0 : group_labels[row];
+    auto const reg   = (static_cast<std::size_t>(group) << precision) | index;
+    atomic_max_register(registers, reg, static_cast<uint8_t>(rank));
+  }
+};
+
+/**
+ * @brief Merges every register of every valid sketch into the sketch of its group.
+ */
+struct merge_fn {
+  column_device_view const d_sketches;
+  size_type const* offsets;
+  uint8_t const* child;
+  size_type const* group_labels;  ///< nullptr for a single group
+  uint8_t* registers;
+  int precision;
+
+  __device__ void operator()(std::size_t idx) const
+  {
+    auto const row = static_cast<size_type>(idx >> precision);
+    if (d_sketches.is_null(row)) { return; }
+    auto const reg   = idx & ((std::size_t{1} << precision) - 1);
+    auto const value = child[offsets[row] + reg];
+    auto const group = group_labels == nullptr ? 0 : group_labels[row];
+    atomic_max_register(registers, (static_cast<std::size_t>(group) << precision) | reg, value);
+  }
+};
+
+/**
+ * @brief Returns the number of registers of a sketch, or 0 for a null sketch.
+ */
+struct sketch_size_fn {
+  column_device_view const d_sketches;
+  size_type const* offsets;
+
+  __device__ size_type operator()(size_type row) const
+  {
+    return d_sketches.is_null(row) ? 0 : offsets[row + 1] - offsets[row];
+  }
+};
+
+/**
+ * @brief Estimates the number of distinct values inserted in a sketch.
+ *
+ * Uses the harmonic mean of the registers and the linear counting correction for small
+ * cardinalities. No large range correction is needed with 64-bit hashes.
+ */
+struct estimate_fn {
+  size_type const* offsets;
+  uint8_t const* child;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    auto const begin = offsets[row];
+    auto const m     = offsets[row + 1] - begin;
+    if (m == 0) { return 0; }
+    double sum      = 0;
+    size_type zeros = 0;
+    for (size_type i = 0; i < m; ++i) {
+      auto const value = child[begin + i];
+      sum += ldexp(1.0, -static_cast<int>(value));
+      zeros += value == 0;
+    }
+    auto const alpha = m == 16   ? 0.673
+                       : m == 32 ? 0.697
+                       : m == 64 ? 0.709
+                                 : 0.7213 / (1 + 1.079 / m);
+    auto estimate    = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+      estimate = m * log(static_cast<double>(m) / static_cast<double>(zeros));
+    }
+    return llround(estimate);
+  }
+};
+
+/**
+ * @brief Makes a column of `num_groups` sketches with all their registers set to zero.
+ */
+std::unique_ptr<column> make_empty_sketches(size_type num_groups,
+                                            int precision,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::mr::device_memory_resource* mr)
+{
+  auto const num_registers = static_cast<std::size_t>(num_groups) << precision;
+  CUDF_EXPECTS(num_registers <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Size of the HLL sketches exceeds the column size limit");
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<offset_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::sequence(rmm::exec_policy(stream),
+                   offsets->mutable_view().begin<offset_type>(),
+                   offsets->mutable_view().end<offset_type>(),
+                   0,
+                   offset_type{1} << precision);
+  auto registers = make_numeric_column(data_type{type_id::UINT8},
+                                       static_cast<size_type>(num_registers),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    registers->mutable_view().data<uint8_t>(), 0, num_registers, stream.value()));
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(registers), 0, rmm::device_buffer{}, stream, mr);
+}
+
+std::unique_ptr<column> build_sketches(column_view const& values,
+                                       size_type const* group_labels,
+                                       size_type num_groups,
+                                       int precision,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(precision >= min_precision && precision <= max_precision,
+               "HLL precision must be in the range [4, 18]");
+  auto sketches = make_empty_sketches(num_groups, precision, stream, mr);
+  if (values.size() == values.null_count()) { return sketches; }
+
+  auto const input      = table_view{{values}};
+  bool const nullable   = has_nulls(input);
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(input, stream);
+  auto const d_values   = column_device_view::create(values, stream);
+  auto registers        = sketches->child(lists_column_view::child_column_index).mutable_view();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    values.size(),
+    insert_fn<decltype(row_hasher.device_hasher<MurmurHash3_32>(nullable, high_hash_seed))>{
+      *d_values,
+      row_hasher.device_hasher<MurmurHash3_32>(nullable, high_hash_seed),
+      row_hasher.device_hasher<MurmurHash3_32>(nullable, low_hash_seed),
+      group_labels,
+      registers.data<uint8_t>(),
+      precision});
+  return sketches;
+}
+
+std::unique_ptr<column> merge_sketches(column_view const& sketches,
+                                       size_type const* group_labels,
+                                       size_type num_groups,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST, "HLL sketches must be a LIST column");
+  auto const lcv = lists_column_view(sketches);
+  CUDF_EXPECTS(lcv.child().type().id() == type_id::UINT8,
+               "HLL sketches must be a LIST<UINT8> column");
+
+  auto const d_sketches = column_device_view::create(sketches, stream);
+  auto const offsets    = lcv.offsets_begin();
+  auto const size_fn    = sketch_size_fn{*d_sketches, offsets};
+  auto const num_registers =
+    thrust::transform_reduce(rmm::exec_policy(stream),
+                             thrust::make_counting_iterator<size_type>(0),
+                             thrust::make_counting_iterator<size_type>(sketches.size()),
+                             size_fn,
+                             size_type{0},
+                             thrust::maximum<size_type>{});
+  if (num_registers == 0) {
+    auto offsets_column = make_numeric_column(
+      data_type{type_to_id<offset_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+    CUDF_CUDA_TRY(cudaMemsetAsync(offsets_column->mutable_view().data<offset_type>(),
+                                  0,
+                                  sizeof(offset_type) * (num_groups + 1),
+                                  stream.value()));
+    return make_lists_column(num_groups,
+                             std::move(offsets_column),
+                             make_empty_column(type_id::UINT8),
+                             num_groups,
+                             create_null_mask(num_groups, mask_state::ALL_NULL, stream, mr),
+                             stream,
+                             mr);
+  }
+
+  auto const precision = __builtin_ctz(static_cast<unsigned int>(num_registers));
+  CUDF_EXPECTS((num_registers & (num_registers - 1)) == 0 && precision >= min_precision &&
+                 precision <= max_precision,
+               "Invalid number of registers in the HLL sketches");
+  auto const mismatches =
+    thrust::count_if(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     thrust::make_counting_iterator<size_type>(sketches.size()),
+                     [size_fn, d_sketches = *d_sketches, num_registers] __device__(size_type row) {
+                       return d_sketches.is_valid(row) && size_fn(row) != num_registers;
+                     });
+  CUDF_EXPECTS(mismatches == 0, "All HLL sketches must have the same number of registers");
+
+  auto result    = make_empty_sketches(num_groups, precision, stream, mr);
+  auto registers = result->child(lists_column_view::child_column_index).mutable_view();
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<std::size_t>(0),
+                     static_cast<std::size_t>(sketches.size()) << precision,
+                     merge_fn{*d_sketches,
+                              offsets,
+                              lcv.child().data<uint8_t>(),
+                              group_labels,
+                              registers.data<uint8_t>(),
+                              precision});
+  return result;
+}
+
+/**
+ * @brief Turns a column holding a single sketch into a list scalar.
+ */
+std::unique_ptr<scalar> to_scalar(std::unique_ptr<column>&& sketches,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  auto const is_valid = sketches->null_count() == 0;
+  auto contents       = sketches->release();
+  return std::make_unique<list_scalar>(
+    std::move(*contents.children[lists_column_view::child_column_index]), is_valid, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_hll(column_view const& values,
+                                  cudf::device_span<size_type const> group_labels,
+                                  size_type num_groups,
+                                  int precision,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  return build_sketches(values, group_labels.data(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> group_merge_hll(column_view const& sketches,
+                                        cudf::device_span<size_type const> group_labels,
+                                        size_type num_groups,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  return merge_sketches(sketches, group_labels.data(), num_groups, stream, mr);
+}
+
+std::unique_ptr<scalar> reduce_hll(column_view const& values,
+                                   int precision,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  return to_scalar(build_sketches(values, nullptr, 1, precision, stream, mr), stream, mr);
+}
+
+std::unique_ptr<scalar> reduce_merge_hll(column_view const& sketches,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  return to_scalar(merge_sketches(sketches, nullptr, 1, stream, mr), stream, mr);
+}
+
+}  // namespace hyperloglog
+
+std::unique_ptr<column> estimate_distinct_count(lists_column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(sketches.child().type().id() == type_id::UINT8,
+               "HLL sketches must be a LIST<UINT8> column");
+  auto result = make_numeric_column(data_type{type_id::INT64},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches.parent(), stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  if (sketches.size() == 0) { return result; }
+  thrust::tabulate(rmm::exec_policy(stream),
+                   result->mutable_view().begin<int64_t>(),
+                   result->mutable_view().end<int64_t>(),
+                   hyperloglog::estimate_fn{sketches.offsets_begin(),
+                                            sketches.child().data<uint8_t>()});
+  return result;
+}
+
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const sketches = hyperloglog::build_sketches(
+    input, nullptr, 1, precision, stream, rmm::mr::get_current_device_resource());
+  auto const estimates = estimate_distinct_count(
+    lists_column_view(sketches->view()), stream, rmm::mr::get_current_device_resource());
+  return static_cast<size_type>(detail::get_value<int64_t>(estimates->view(), 0, stream));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> estimate_distinct_count(lists_column_view const& sketches,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_distinct_count(sketches, stream, mr);
+}
+
+cudf::size_type approx_distinct_count(column_view const& input,
+                                      int precision,
+                                      rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::approx_distinct_count(input, precision, stream);
+}
+
+}  // namespace cudf
@@ -37,10 +37,31 @@
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+/**
+ * @brief Returns `ufn` of each string, or 0 for null strings.
+ *
+ * @tparam UnaryFunction Device function that returns an integer given a string_view.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
+ */
+template <typename UnaryFunction, typename Nullate>
+struct count_fn {
+  column_device_view const d_strings;
+  Nullate const has_nulls;
+  UnaryFunction const ufn;
+
+  __device__ int32_t operator()(size_type idx) const
+  {
+    if (has_nulls && d_strings.is_null_nocheck(idx)) { return 0; }
+    return static_cast<int32_t>(ufn(d_strings.element<string_view>(idx)));
+  }
+};
+
 /**
  * @brief Returns a numeric column containing lengths of each string in
  * based on the provided unary function.
@@ -72,15 +93,19 @@ std::unique_ptr<column> counts_fn(strings_column_view const& strings,
   auto strings_column = cudf::column_device_view::create(strings.parent(), stream);
   auto d_strings      = *strings_column;
   // fill in the lengths
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<cudf::size_type>(0),
-                    thrust::make_counting_iterator<cudf::size_type>(strings.size()),
-                    d_lengths,
-                    [d_strings, ufn] __device__(size_type idx) {
-                      return d_strings.is_null(idx)
-                               ? 0
-                               : static_cast<int32_t>(ufn(d_strings.element<string_view>(idx)));
-                    });
+  auto const count_strings = [&](auto const has_nulls) {
+    using Nullate = std::decay_t<decltype(has_nulls)>;
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(strings.size()),
+                      d_lengths,
+                      count_fn<UnaryFunction, Nullate>{d_strings, has_nulls, ufn});
+  };
+  if (strings.has_nulls()) {
+    count_strings(nullate::YES{});
+  } else {
+    count_strings(nullate::NO{});
+  }
   results->set_null_count(strings.null_count());  // reset null count
   return results;
 }
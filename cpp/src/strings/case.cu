@@ -18,12 +18,16 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/detail/char_tables.hpp>
 #include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -32,6 +36,12 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -49,6 +59,7 @@ struct upper_lower_fn {
   const special_case_mapping* d_special_case_mapping;
   int32_t* d_offsets{};
   char* d_chars{};
+  size_type* d_sizes{};  // output sizes when the strings are written in a single pass
 
   __device__ special_case_mapping get_special_case_mapping(uint32_t code_point)
   {
@@ -104,10 +115,102 @@ struct upper_lower_fn {
           d_buffer += detail::from_char_utf8(new_char, d_buffer);
       }
     }
-    if (!d_buffer) d_offsets[idx] = bytes;
+    if (!d_buffer) {
+      d_offsets[idx] = bytes;
+    } else if (d_sizes) {
+      d_sizes[idx] = static_cast<size_type>(d_buffer - (d_chars + d_offsets[idx]));
+    }
   }
 };
 
+/**
+ * @brief Maximum ratio of the size in bytes of a converted character to its original size.
+ *
+ * The largest expansion is a 2-byte character with a special case mapping to three 2-byte
+ * characters.
+ */
+constexpr size_type MAX_CASE_EXPANSION = 3;
+
+/**
+ * @brief Number of bytes converted by each thread in `convert_case_ascii`.
+ */
+constexpr size_type BYTES_PER_THREAD = 8;
+
+/**
+ * @brief Byte-wise case conversion for ASCII-only chars.
+ *
+ * ASCII characters have no special case mappings so each byte converts to exactly one byte
+ * and the output offsets are the same as the input offsets.
+ */
+struct ascii_case_fn {
+  char const* d_input;
+  char* d_output;
+  size_type const size;
+  bool const to_upper;  // convert lower case characters
+  bool const to_lower;  // convert upper case characters
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const begin = idx * BYTES_PER_THREAD;
+    auto const end   = std::min(begin + BYTES_PER_THREAD, size);
+    for (auto pos = begin; pos < end; ++pos) {
+      auto const ch       = d_input[pos];
+      auto const is_upper = (ch >= 'A') && (ch <= 'Z');
+      auto const is_lower = (ch >= 'a') && (ch <= 'z');
+      // upper and lower case ASCII letters only differ by the 0x20 bit
+      d_output[pos] = ((is_upper && to_lower) || (is_lower && to_upper)) ? (ch ^ 0x20) : ch;
+    }
+  }
+};
+
+/**
+ * @brief Case conversion for a strings column with only ASCII characters.
+ *
+ * @param input Strings to convert; all chars must be ASCII
+ * @param case_flag The character type to convert (upper, lower, or both)
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New strings column with characters converted.
+ */
+std::unique_ptr<column> convert_case_ascii(strings_column_view const& input,
+                                           character_flags_table_type case_flag,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  // the output offsets are the input offsets rebased to 0 for a sliced column
+  auto const first_offset =
+    cudf::detail::get_value<offset_type>(input.offsets(), input.offset(), stream);
+
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, input.size() + 1, mask_state::UNALLOCATED, stream, mr);
+  auto d_offsets      = offsets_column->mutable_view().data<offset_type>();
+  thrust::transform(rmm::exec_policy(stream),
+                    input.offsets_begin(),
+                    input.offsets_end(),
+                    d_offsets,
+                    [first_offset] __device__(offset_type offset) {
+                      return offset - first_offset;
+                    });
+  auto const bytes =
+    cudf::detail::get_value<offset_type>(offsets_column->view(), input.size(), stream);
+
+  auto chars_column = create_chars_child_column(bytes, stream, mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     cudf::util::div_rounding_up_safe(bytes, BYTES_PER_THREAD),
+                     ascii_case_fn{input.chars_begin() + first_offset,
+                                   chars_column->mutable_view().data<char>(),
+                                   bytes,
+                                   IS_LOWER(case_flag) != 0,
+                                   IS_UPPER(case_flag) != 0});
+
+  return make_strings_column(input.size(),
+                             std::move(offsets_column),
+                             std::move(chars_column),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr));
+}
+
 /**
  * @brief Utility method for converting upper and lower case characters
  * in a strings column.
@@ -125,6 +228,9 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
 {
   if (strings.is_empty()) return make_empty_column(type_id::STRING);
 
+  // most data is ASCII which can be converted byte-wise without the lookup tables
+  if (is_all_ascii(strings, stream)) { return convert_case_ascii(strings, case_flag, stream, mr); }
+
   auto strings_column = column_device_view::create(strings.parent(), stream);
   auto d_column       = *strings_column;
 
@@ -135,8 +241,14 @@ std::unique_ptr<column> convert_case(strings_column_view const& strings,
                          get_character_cases_table(),
                          get_special_case_mapping_table()};
 
-  // this utility calls the functor to build the offsets and chars columns
-  auto children = cudf::strings::detail::make_strings_children(functor, strings.size(), stream, mr);
+  // each string is written once into a buffer sized from the maximum expansion
+  auto const d_offsets = strings.offsets_begin();
+  auto const bounds    = cudf::detail::make_counting_transform_iterator(
+    0, [d_offsets] __device__(size_type idx) {
+      return static_cast<int64_t>(MAX_CASE_EXPANSION) * (d_offsets[idx + 1] - d_offsets[idx]);
+    });
+  auto children = cudf::strings::detail::make_strings_children_bounded(
+    functor, bounds, strings.size(), stream, mr);
 
   return make_strings_column(strings.size(),
                              std::move(children.first),
@@ -61,12 +61,44 @@ std::unique_ptr<column> all_characters_of_type(
   auto d_results    = results_view.data<bool>();
   // get the static character types table
   auto d_flags = detail::get_character_flags_table();
+  // returns true if the character flag is verified and passes
+  auto check_flag = [types, verify_types] __device__(auto flag, bool& check) {
+    if ((verify_types & flag) ||                   // should flag be verified
+        (flag == 0 && verify_types == ALL_TYPES))  // special edge case
+    {
+      check = (types & flag) > 0;
+      return true;
+    }
+    return false;
+  };
+
+  // the code-point of an ASCII character is its byte so the UTF-8 decode can be skipped
+  if (is_all_ascii(strings, stream)) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      [d_column, d_flags, check_flag] __device__(size_type idx) {
+                        if (d_column.is_null(idx)) return false;
+                        auto const d_str      = d_column.element<string_view>(idx);
+                        auto const bytes      = reinterpret_cast<uint8_t const*>(d_str.data());
+                        bool check            = !d_str.empty();  // require at least one character
+                        size_type check_count = 0;
+                        for (size_type pos = 0; check && (pos < d_str.size_bytes()); ++pos) {
+                          check_count += check_flag(d_flags[bytes[pos]], check);
+                        }
+                        return check && (check_count > 0);
+                      });
+    results->set_null_count(strings.null_count());
+    return results;
+  }
+
   // set the output values by checking the character types for each string
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(strings_count),
                     d_results,
-                    [d_column, d_flags, types, verify_types, d_results] __device__(size_type idx) {
+                    [d_column, d_flags, check_flag] __device__(size_type idx) {
                       if (d_column.is_null(idx)) return false;
                       auto d_str            = d_column.element<string_view>(idx);
                       bool check            = !d_str.empty();  // require at least one character
@@ -75,12 +107,7 @@ std::unique_ptr<column> all_characters_of_type(
                         auto code_point = detail::utf8_to_codepoint(*itr);
                         // lookup flags in table by code-point
                         auto flag = code_point <= 0x00FFFF ? d_flags[code_point] : 0;
-                        if ((verify_types & flag) ||                   // should flag be verified
-                            (flag == 0 && verify_types == ALL_TYPES))  // special edge case
-                        {
-                          check = (types & flag) > 0;
-                          ++check_count;
-                        }
+                        check_count += check_flag(flag, check);
                       }
                       return check && (check_count > 0);
                     });
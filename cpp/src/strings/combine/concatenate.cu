@@ -17,7 +17,6 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/detail/valid_if.cuh>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/strings/combine.hpp>
 #include <cudf/strings/detail/combine.hpp>
@@ -25,6 +24,7 @@
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -32,11 +32,9 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
-#include <thrust/execution_policy.h>
-#include <thrust/iterator/counting_iterator.h>
-#include <thrust/logical.h>
-
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace cudf {
 namespace strings {
@@ -57,18 +55,17 @@ struct concat_strings_base {
    * and apply the separator. The null-replacement string `d_narep` is
    * used in place of any string in a row that contains a null entry.
    *
+   * The strings of the row are read only once per pass: a null string without
+   * a replacement ends the row in the size pass and the row is then skipped in
+   * the write pass.
+   *
    * @param idx The current row to process
    * @param d_separator String to place in between each column's row
    */
   __device__ void process_row(size_type idx, string_view const d_separator)
   {
-    if (!d_narep.is_valid() &&
-        thrust::any_of(thrust::seq, d_table.begin(), d_table.end(), [idx](auto const& col) {
-          return col.is_null(idx);
-        })) {
-      if (!d_chars) d_offsets[idx] = 0;
-      return;
-    }
+    // the row is null or empty, so there is nothing to write
+    if (d_chars && (d_offsets[idx] == d_offsets[idx + 1])) return;
 
     char* d_buffer       = d_chars ? d_chars + d_offsets[idx] : nullptr;
     offset_type bytes    = 0;
@@ -78,6 +75,12 @@ struct concat_strings_base {
       auto const d_column     = *itr;
       bool const null_element = d_column.is_null(idx);
 
+      // the output row is null
+      if (null_element && !d_narep.is_valid()) {
+        if (!d_chars) d_offsets[idx] = 0;
+        return;
+      }
+
       if (write_separator && (separate_nulls == separator_on_nulls::YES || !null_element)) {
         if (d_buffer) d_buffer = detail::copy_string(d_buffer, d_separator);
         bytes += d_separator.size_bytes();
@@ -97,6 +100,31 @@ struct concat_strings_base {
   }
 };
 
+/**
+ * @brief Creates the null mask of the output strings from the null masks of the input columns.
+ *
+ * A row is null if it is null in any of `nullable_columns`. The returned mask is allocated even
+ * if no row is null.
+ *
+ * @param nullable_columns The columns whose nulls are not replaced
+ * @param strings_count Number of output strings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned mask
+ * @return The null mask and the null count of the output strings
+ */
+std::pair<rmm::device_buffer, size_type> make_null_mask(table_view const& nullable_columns,
+                                                        size_type strings_count,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::mr::device_memory_resource* mr)
+{
+  auto result = cudf::detail::bitmask_and(nullable_columns, stream, mr);
+  if (result.first.is_empty()) {
+    result.first =
+      cudf::detail::create_null_mask(strings_count, mask_state::ALL_VALID, stream, mr);
+  }
+  return result;
+}
+
 /**
  * @brief Single separator concatenate functor
  */
@@ -143,17 +171,9 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
   concat_strings_fn fn{*d_table, d_separator, d_narep, separate_nulls};
   auto children = make_strings_children(fn, strings_count, stream, mr);
 
-  // create resulting null mask
-  auto [null_mask, null_count] = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(strings_count),
-    [d_table = *d_table, d_narep] __device__(size_type idx) {
-      if (d_narep.is_valid()) return true;
-      return !thrust::any_of(
-        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
-    },
-    stream,
-    mr);
+  // create resulting null mask: a row is null if any of its strings is null and not replaced
+  auto [null_mask, null_count] = make_null_mask(
+    narep.is_valid(stream) ? table_view{} : strings_columns, strings_count, stream, mr);
 
   return make_strings_column(strings_count,
                              std::move(children.first),
@@ -238,18 +258,15 @@ std::unique_ptr<column> concatenate(table_view const& strings_columns,
     *d_table, separator_col_view, separator_rep, col_rep, separate_nulls};
   auto children = make_strings_children(mscf, strings_count, stream, mr);
 
-  // Create resulting null mask
-  auto [null_mask, null_count] = cudf::detail::valid_if(
-    thrust::make_counting_iterator<size_type>(0),
-    thrust::make_counting_iterator<size_type>(strings_count),
-    [d_table = *d_table, separator_col_view, separator_rep, col_rep] __device__(size_type idx) {
-      if (!separator_col_view.is_valid(idx) && !separator_rep.is_valid()) return false;
-      if (col_rep.is_valid()) return true;
-      return !thrust::any_of(
-        thrust::seq, d_table.begin(), d_table.end(), [idx](auto col) { return col.is_null(idx); });
-    },
-    stream,
-    mr);
+  // Create resulting null mask: a row is null if any of its strings or its separator is null
+  // and not replaced
+  std::vector<column_view> nullable_columns;
+  if (!col_narep.is_valid(stream)) {
+    nullable_columns.insert(nullable_columns.end(), strings_columns.begin(), strings_columns.end());
+  }
+  if (!separator_narep.is_valid(stream)) { nullable_columns.push_back(separators.parent()); }
+  auto [null_mask, null_count] =
+    make_null_mask(table_view{nullable_columns}, strings_count, stream, mr);
 
   return make_strings_column(strings_count,
                              std::move(children.first),
@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
@@ -29,14 +30,30 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+
+#include <tuple>
 
 namespace cudf {
 namespace strings {
 namespace detail {
 
 namespace {
+/**
+ * @brief Lists having more strings than this are joined by a warp of threads each.
+ *
+ * Otherwise a single thread joins each list, and a few long lists would keep the few threads
+ * joining them busy long after the threads joining the other lists are done.
+ */
+constexpr size_type LONG_LIST_THRESHOLD = 64;
+
 /**
  * @brief Compute string sizes, string validities, and concatenate strings functor.
  *
@@ -45,6 +62,9 @@ namespace {
  * of the given lists column and apply the separator. The null-replacement string scalar
  * `string_narep_dv` (if valid) is used in place of any null string.
  *
+ * Lists longer than `LONG_LIST_THRESHOLD` are skipped by `operator()` and processed instead by
+ * `process_long_list` with a warp per list.
+ *
  * @tparam Functor The functor which can check for validity of the input list at a given list index
  * as well as access to the separator corresponding to the list index.
  */
@@ -59,6 +79,7 @@ struct compute_size_and_concatenate_fn {
   output_if_empty_list const empty_list_policy;
 
   offset_type* d_offsets{nullptr};
+  bool* d_validities{nullptr};
 
   // If d_chars == nullptr: only compute sizes and validities of the output strings.
   // If d_chars != nullptr: only concatenate strings.
@@ -72,6 +93,31 @@ struct compute_size_and_concatenate_fn {
     return empty_list_policy == output_if_empty_list::NULL_ELEMENT && start_idx == end_idx;
   }
 
+  /**
+   * @brief Sets the size and validity of the output string `idx` in the first pass.
+   *
+   * If all the elements are null, the output should be the same as having an empty list input:
+   * a null or an empty string.
+   */
+  __device__ void set_size(size_type const idx,
+                           size_type const size_bytes,
+                           bool const has_valid_element) const noexcept
+  {
+    auto const is_valid =
+      has_valid_element || empty_list_policy == output_if_empty_list::EMPTY_STRING;
+    d_offsets[idx]    = has_valid_element ? size_bytes : 0;
+    d_validities[idx] = is_valid;
+  }
+
+  /**
+   * @brief Sets the output string `idx` to null in the first pass.
+   */
+  __device__ void set_null(size_type const idx) const noexcept
+  {
+    d_offsets[idx]    = 0;
+    d_validities[idx] = false;
+  }
+
   __device__ void operator()(size_type const idx) const noexcept
   {
     // If this is the second pass, and the row `idx` is known to be a null or empty string
@@ -80,9 +126,10 @@ struct compute_size_and_concatenate_fn {
     // Indices of the strings within the list row
     auto const start_idx = list_offsets[idx];
     auto const end_idx   = list_offsets[idx + 1];
+    if (end_idx - start_idx > LONG_LIST_THRESHOLD) { return; }
 
     if (!d_chars && output_is_null(idx, start_idx, end_idx)) {
-      d_offsets[idx] = 0;
+      set_null(idx);
       return;
     }
 
@@ -96,9 +143,10 @@ struct compute_size_and_concatenate_fn {
       bool null_element = strings_dv.is_null(str_idx);
       has_valid_element = has_valid_element || !null_element;
 
+      // An element is null and narep is invalid, so the output row is null
       if (!d_chars && (null_element && !string_narep_dv.is_valid())) {
-        size_bytes = 0;
-        break;
+        set_null(idx);
+        return;
       }
 
       if (write_separator && (separate_nulls == separator_on_nulls::YES || !null_element)) {
@@ -116,12 +164,157 @@ struct compute_size_and_concatenate_fn {
         write_separator || (separate_nulls == separator_on_nulls::YES) || !null_element;
     }
 
-    // If there are all null elements, the output should be the same as having an empty list input:
-    // a null or an empty string
-    if (!d_chars) { d_offsets[idx] = has_valid_element ? size_bytes : 0; }
+    if (!d_chars) { set_size(idx, size_bytes, has_valid_element); }
+  }
+
+  /**
+   * @brief Processes the list row `idx` with all the threads of a warp.
+   *
+   * Each thread handles one of every `warp_size` strings of the list. The position in the output
+   * of each string and its separator is the sum of the sizes of those before it, computed as a
+   * scan across the warp.
+   *
+   * @param idx The list row, the same for all the threads of the warp
+   * @param lane The thread's lane within the warp
+   */
+  __device__ void process_long_list(size_type const idx, size_type const lane) const noexcept
+  {
+    if (d_chars && (d_offsets[idx] == d_offsets[idx + 1])) { return; }
+
+    auto const start_idx = list_offsets[idx];
+    auto const end_idx   = list_offsets[idx + 1];
+
+    if (!d_chars && output_is_null(idx, start_idx, end_idx)) {
+      if (lane == 0) { set_null(idx); }
+      return;
+    }
+
+    auto const separator = func.separator(idx);
+    char* output_ptr     = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    auto size_bytes      = size_type{0};
+    // Whether any string before the current ones is valid
+    bool has_valid_element = false;
+
+    for (auto first_idx = start_idx; first_idx < end_idx; first_idx += cudf::detail::warp_size) {
+      auto const str_idx      = first_idx + lane;
+      auto const in_list      = str_idx < end_idx;
+      bool const null_element = in_list && strings_dv.is_null(str_idx);
+      auto const valid_lanes  = __ballot_sync(0xffff'ffff, in_list && !null_element);
+
+      if (!string_narep_dv.is_valid() && __any_sync(0xffff'ffff, null_element)) {
+        if (!d_chars && lane == 0) { set_null(idx); }
+        return;
+      }
+
+      auto const valid_before = has_valid_element || (valid_lanes & ((1u << lane) - 1)) != 0;
+      bool const write_separator =
+        in_list && (separate_nulls == separator_on_nulls::YES ? str_idx > start_idx
+                                                              : !null_element && valid_before);
+      auto const d_str = !in_list       ? string_view{}
+                         : null_element ? string_narep_dv.value()
+                                        : strings_dv.element<string_view>(str_idx);
+      auto const bytes = (write_separator ? separator.size_bytes() : 0) + d_str.size_bytes();
+
+      // Inclusive scan of the sizes across the warp
+      auto position = bytes;
+      for (size_type i = 1; i < cudf::detail::warp_size; i *= 2) {
+        auto const before = __shfl_up_sync(0xffff'ffff, position, i);
+        if (lane >= i) { position += before; }
+      }
+      auto const total_bytes = __shfl_sync(0xffff'ffff, position, cudf::detail::warp_size - 1);
+
+      if (output_ptr && in_list) {
+        auto output = output_ptr + size_bytes + position - bytes;
+        if (write_separator) { output = detail::copy_string(output, separator); }
+        detail::copy_string(output, d_str);
+      }
+      size_bytes += total_bytes;
+      has_valid_element = has_valid_element || valid_lanes != 0;
+    }
+
+    if (!d_chars && lane == 0) { set_size(idx, size_bytes, has_valid_element); }
   }
 };
 
+/**
+ * @brief Processes the long lists of `long_rows` with a warp per list.
+ */
+template <typename CompFn>
+__global__ void process_long_lists_kernel(CompFn const comp_fn,
+                                          size_type const* long_rows,
+                                          size_type num_long_rows)
+{
+  auto const tid      = cudf::thread_index_type{blockIdx.x} * blockDim.x + threadIdx.x;
+  auto const warp_idx = tid / cudf::detail::warp_size;
+  if (warp_idx >= num_long_rows) { return; }
+  comp_fn.process_long_list(long_rows[warp_idx],
+                            static_cast<size_type>(tid % cudf::detail::warp_size));
+}
+
+/**
+ * @brief Creates the offsets and chars children and the validities of the output strings.
+ *
+ * This is `make_strings_children` with the lists longer than `LONG_LIST_THRESHOLD` processed by
+ * `process_long_lists_kernel` in each pass. The validities are computed in the first pass too.
+ *
+ * @return The offsets and chars children and the validity of each output string
+ */
+template <typename CompFn>
+auto make_joined_children(CompFn comp_fn,
+                          size_type num_rows,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
+{
+  auto offsets_column = make_numeric_column(
+    data_type{type_id::INT32}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  auto const offsets_view = offsets_column->mutable_view();
+  rmm::device_uvector<bool> validities(num_rows, stream);
+  comp_fn.d_offsets    = offsets_view.template data<offset_type>();
+  comp_fn.d_validities = validities.data();
+
+  rmm::device_uvector<size_type> long_rows(num_rows, stream);
+  auto const long_rows_end = thrust::copy_if(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(num_rows),
+    long_rows.begin(),
+    [list_offsets = comp_fn.list_offsets] __device__(size_type idx) {
+      return list_offsets[idx + 1] - list_offsets[idx] > LONG_LIST_THRESHOLD;
+    });
+  auto const num_long_rows =
+    static_cast<size_type>(thrust::distance(long_rows.begin(), long_rows_end));
+
+  auto const process_fn = [&] {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       num_rows,
+                       comp_fn);
+    if (num_long_rows > 0) {
+      constexpr size_type block_size = 256;
+      cudf::detail::grid_1d const grid{num_long_rows, block_size / cudf::detail::warp_size};
+      process_long_lists_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+        comp_fn, long_rows.data(), num_long_rows);
+    }
+  };
+
+  // Compute the offsets values and the validities
+  process_fn();
+  thrust::exclusive_scan(rmm::exec_policy(stream),
+                         comp_fn.d_offsets,
+                         comp_fn.d_offsets + num_rows + 1,
+                         comp_fn.d_offsets);
+
+  // Fill the chars column, unless it is empty and the offsets would be overwritten
+  auto const bytes  = cudf::detail::get_value<offset_type>(offsets_view, num_rows, stream);
+  auto chars_column = create_chars_child_column(bytes, stream, mr);
+  if (bytes > 0) {
+    comp_fn.d_chars = chars_column->mutable_view().template data<char>();
+    process_fn();
+  }
+
+  return std::tuple(std::move(offsets_column), std::move(chars_column), std::move(validities));
+}
+
 /**
  * @brief Functor accompanying with `compute_size_and_concatenate_fn` for computing output string
  * sizes, output string validities, and concatenating strings within list elements; used when the
@@ -142,33 +335,6 @@ struct scalar_separator_fn {
   }
 };
 
-template <typename CompFn>
-struct validities_fn {
-  CompFn comp_fn;
-
-  validities_fn(CompFn comp_fn) : comp_fn(comp_fn) {}
-
-  __device__ bool operator()(size_type idx)
-  {
-    auto const start_idx = comp_fn.list_offsets[idx];
-    auto const end_idx   = comp_fn.list_offsets[idx + 1];
-    bool valid_output    = !comp_fn.output_is_null(idx, start_idx, end_idx);
-    if (valid_output) {
-      bool check_elements = false;
-      for (size_type str_idx = start_idx; str_idx < end_idx; ++str_idx) {
-        bool const valid_element = comp_fn.strings_dv.is_valid(str_idx);
-        check_elements           = check_elements || valid_element;
-        // if an element is null and narep is invalid, the output row is null
-        if (!valid_element && !comp_fn.string_narep_dv.is_valid()) { return false; }
-      }
-      // handle empty-list-as-null output policy setting
-      valid_output =
-        check_elements || comp_fn.empty_list_policy == output_if_empty_list::EMPTY_STRING;
-    }
-    return valid_output;
-  }
-};
-
 }  // namespace
 
 std::unique_ptr<column> join_list_elements(lists_column_view const& lists_strings_column,
@@ -206,13 +372,10 @@ std::unique_ptr<column> join_list_elements(lists_column_view const& lists_string
                                                     separate_nulls,
                                                     empty_list_policy};
 
-  auto [offsets_column, chars_column] = make_strings_children(comp_fn, num_rows, stream, mr);
-  auto [null_mask, null_count] =
-    cudf::detail::valid_if(thrust::counting_iterator<size_type>(0),
-                           thrust::counting_iterator<size_type>(num_rows),
-                           validities_fn{comp_fn},
-                           stream,
-                           mr);
+  auto [offsets_column, chars_column, validities] =
+    make_joined_children(comp_fn, num_rows, stream, mr);
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    validities.begin(), validities.end(), thrust::identity<bool>{}, stream, mr);
 
   return make_strings_column(
     num_rows, std::move(offsets_column), std::move(chars_column), null_count, std::move(null_mask));
@@ -281,13 +444,10 @@ std::unique_ptr<column> join_list_elements(lists_column_view const& lists_string
                                                     separate_nulls,
                                                     empty_list_policy};
 
-  auto [offsets_column, chars_column] = make_strings_children(comp_fn, num_rows, stream, mr);
-  auto [null_mask, null_count] =
-    cudf::detail::valid_if(thrust::counting_iterator<size_type>(0),
-                           thrust::counting_iterator<size_type>(num_rows),
-                           validities_fn{comp_fn},
-                           stream,
-                           mr);
+  auto [offsets_column, chars_column, validities] =
+    make_joined_children(comp_fn, num_rows, stream, mr);
+  auto [null_mask, null_count] = cudf::detail::valid_if(
+    validities.begin(), validities.end(), thrust::identity<bool>{}, stream, mr);
 
   return make_strings_column(
     num_rows, std::move(offsets_column), std::move(chars_column), null_count, std::move(null_mask));
@@ -15,6 +15,8 @@
  */
 
 #include <strings/count_matches.hpp>
+#include <strings/regex/redfa.cuh>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/regex/utilities.cuh>
 
 #include <cudf/column/column.hpp>
@@ -24,10 +26,15 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/contains.hpp>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace strings {
@@ -56,9 +63,21 @@ struct contains_fn {
   }
 };
 
+/**
+ * @brief This functor handles both contains_re and match_re for patterns compiled to a DFA.
+ */
+struct contains_dfa_fn {
+  column_device_view const d_strings;
+  redfa_device const d_dfa;
+
+  __device__ bool operator()(size_type const idx) const
+  {
+    return d_strings.is_valid(idx) && d_dfa.is_match(d_strings.element<string_view>(idx));
+  }
+};
+
 std::unique_ptr<column> contains_impl(strings_column_view const& input,
-                                      std::string_view pattern,
-                                      regex_flags const flags,
+                                      regex_program const& prog,
                                       bool const beginning_only,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
@@ -71,11 +90,22 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                      mr);
   if (input.is_empty()) { return results; }
 
-  auto d_prog = reprog_device::create(pattern, flags, stream);
-
   auto d_results       = results->mutable_view().data<bool>();
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
+  // a table-driven DFA needs no working memory and a single lookup per character
+  auto const d_dfa = regex_device_builder::create_dfa_device(prog, beginning_only, stream);
+  if (d_dfa) {
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      d_results,
+                      contains_dfa_fn{*d_strings, *d_dfa});
+    return results;
+  }
+
+  auto d_prog = regex_device_builder::create_prog_device(prog, stream);
+
   launch_transform_kernel(
     contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
 
@@ -86,33 +116,30 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
 
 std::unique_ptr<column> contains_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_impl(input, pattern, flags, false, stream, mr);
+  return contains_impl(input, prog, false, stream, mr);
 }
 
 std::unique_ptr<column> matches_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
-  return contains_impl(input, pattern, flags, true, stream, mr);
+  return contains_impl(input, prog, true, stream, mr);
 }
 
 std::unique_ptr<column> count_re(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   // compile regex into device object
-  auto d_prog = reprog_device::create(pattern, flags, stream);
+  auto d_prog = regex_device_builder::create_prog_device(prog, stream);
 
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
@@ -134,7 +161,16 @@ std::unique_ptr<column> contains_re(strings_column_view const& strings,
                                     rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::contains_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::contains_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> contains_re(strings_column_view const& strings,
+                                    regex_program const& prog,
+                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> matches_re(strings_column_view const& strings,
@@ -143,7 +179,16 @@ std::unique_ptr<column> matches_re(strings_column_view const& strings,
                                    rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::matches_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::matches_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> matches_re(strings_column_view const& strings,
+                                   regex_program const& prog,
+                                   rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::matches_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> count_re(strings_column_view const& strings,
@@ -152,7 +197,16 @@ std::unique_ptr<column> count_re(strings_column_view const& strings,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::count_re(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::count_re(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> count_re(strings_column_view const& strings,
+                                 regex_program const& prog,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::count_re(strings, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -21,6 +21,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -35,6 +36,7 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
@@ -175,13 +177,10 @@ struct format_compiler {
  */
 __device__ thrust::pair<int32_t, size_type> parse_int(char const* str, size_type bytes)
 {
-  int32_t value = 0;
-  while (bytes-- > 0) {
-    char chr = *str++;
-    if (chr < '0' || chr > '9') break;
-    value = (value * 10) + static_cast<int32_t>(chr - '0');
-  }
-  return thrust::make_pair(value, bytes + 1);
+  int32_t value    = 0;
+  auto const end   = parse_digits(str, str + std::max(bytes, 0), value);
+  auto const count = static_cast<size_type>(thrust::distance(str, end));
+  return thrust::make_pair(value, bytes - count);
 }
 
 /**
@@ -19,6 +19,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
@@ -75,10 +76,22 @@ __device__ inline double stod(string_view const& d_str)
   // Parse and store the mantissa as much as we can,
   // until we are about to exceed the limit of uint64_t
   constexpr uint64_t max_holding = (std::numeric_limits<uint64_t>::max() - 9L) / 10L;
-  uint64_t digits                = 0;
-  int exp_off                    = 0;
-  bool decimal                   = false;
+  // highest value where another 8 digits can be appended without exceeding max_holding
+  constexpr uint64_t max_chunk_holding = (max_holding - 99999999UL) / 100000000UL;
+  uint64_t digits                      = 0;
+  int exp_off                          = 0;
+  bool decimal                         = false;
   while (in_ptr < end) {
+    // convert 8 digits at a time while they fit
+    if ((end - in_ptr >= 8) && (digits <= max_chunk_holding)) {
+      auto const chunk = load_eight_bytes(in_ptr);
+      if (is_eight_digits(chunk)) {
+        digits = (digits * 100000000UL) + parse_eight_digits(chunk);
+        exp_off -= decimal ? 8 : 0;
+        in_ptr += 8;
+        continue;
+      }
+    }
     char ch = *in_ptr;
     if (ch == '.') {
       decimal = true;
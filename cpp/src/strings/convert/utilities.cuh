@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/detail/convert/parse_digits.cuh>
 #include <cudf/strings/string_view.cuh>
 
 namespace cudf {
@@ -32,22 +33,16 @@ namespace detail {
  */
 __device__ inline int64_t string_to_integer(string_view const& d_str)
 {
-  int64_t value   = 0;
-  size_type bytes = d_str.size_bytes();
-  if (bytes == 0) return value;
+  uint64_t value = 0;
+  if (d_str.empty()) return 0;
   const char* ptr = d_str.data();
   int sign        = 1;
   if (*ptr == '-' || *ptr == '+') {
     sign = (*ptr == '-' ? -1 : 1);
     ++ptr;
-    --bytes;
   }
-  for (size_type idx = 0; idx < bytes; ++idx) {
-    char chr = *ptr++;
-    if (chr < '0' || chr > '9') break;
-    value = (value * 10) + static_cast<int64_t>(chr - '0');
-  }
-  return value * static_cast<int64_t>(sign);
+  parse_digits(ptr, d_str.data() + d_str.size_bytes(), value);
+  return static_cast<int64_t>(value) * static_cast<int64_t>(sign);
 }
 
 /**
@@ -71,6 +66,14 @@ __device__ inline size_type integer_to_string(IntegerType value, char* d_buffer)
   constexpr int MAX_DIGITS = cuda::std::numeric_limits<IntegerType>::digits10 + 1;
   char digits[MAX_DIGITS];  // place-holder for digit chars
   int digits_idx = 0;
+  // two digits per division halves the number of (slow) integer divisions
+  constexpr IntegerType base_squared = base * base;
+  while ((value / base_squared) != 0) {
+    auto const two_digits = cudf::util::absolute_value(value % base_squared);
+    digits[digits_idx++]  = '0' + (two_digits % base);
+    digits[digits_idx++]  = '0' + (two_digits / base);
+    value                 = value / base_squared;
+  }
   while (value != 0) {
     assert(digits_idx < MAX_DIGITS);
     digits[digits_idx++] = '0' + cudf::util::absolute_value(value % base);
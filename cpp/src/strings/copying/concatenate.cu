@@ -16,11 +16,12 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/synchronize.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/detail/concatenate.hpp>
+#include <cudf/strings/detail/offsets_accessor.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
@@ -37,6 +38,8 @@
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -60,9 +63,8 @@ struct chars_size_transform {
   __device__ size_t operator()(column_device_view const& col) const
   {
     if (col.size() > 0) {
-      constexpr auto offsets_index = strings_column_view::offsets_column_index;
-      auto d_offsets               = col.child(offsets_index).data<int32_t>();
-      return d_offsets[col.size() + col.offset()] - d_offsets[col.offset()];
+      auto const d_offsets = make_offsets_accessor(col);
+      return d_offsets[col.size()] - d_offsets[0];
     } else {
       return 0;
     }
@@ -100,7 +102,8 @@ auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_s
                                    chars_size_transform{},
                                    thrust::plus{});
   auto const output_chars_size = d_partition_offsets.back_element(stream);
-  stream.synchronize();  // ensure copy of output_chars_size is complete before returning
+  // ensure copy of output_chars_size is complete before returning
+  cudf::detail::synchronize_stream(stream);
 
   return std::make_tuple(std::move(device_view_owners),
                          device_views_ptr,
@@ -110,13 +113,13 @@ auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_s
                          output_chars_size);
 }
 
-template <size_type block_size, bool Nullable>
+template <size_type block_size, bool Nullable, typename OffsetType>
 __global__ void fused_concatenate_string_offset_kernel(column_device_view const* input_views,
                                                        size_t const* input_offsets,
                                                        size_t const* partition_offsets,
                                                        size_type const num_input_views,
                                                        size_type const output_size,
-                                                       int32_t* output_data,
+                                                       OffsetType* output_data,
                                                        bitmask_type* output_mask,
                                                        size_type* out_valid_count)
 {
@@ -133,14 +136,13 @@ __global__ void fused_concatenate_string_offset_kernel(column_device_view const*
              thrust::seq, input_offsets, input_offsets + num_input_views, output_index);
     size_type const partition_index = offset_it - input_offsets;
 
-    auto const offset_index      = output_index - *offset_it;
-    auto const& input_view       = input_views[partition_index];
-    constexpr auto offsets_child = strings_column_view::offsets_column_index;
-    auto const* input_data       = input_view.child(offsets_child).data<int32_t>();
+    auto const offset_index = output_index - *offset_it;
+    auto const& input_view  = input_views[partition_index];
+    auto const input_data   = make_offsets_accessor(input_view);  // handles parent offset
     output_data[output_index] =
-      input_data[offset_index + input_view.offset()]  // handle parent offset
-      - input_data[input_view.offset()]               // subract first offset if non-zero
-      + partition_offsets[partition_index];           // add offset of source column
+      input_data[offset_index]               // offset within the source column
+      - input_data[0]                        // subract first offset if non-zero
+      + partition_offsets[partition_index];  // add offset of source column
 
     if (Nullable) {
       bool const bit_is_set       = input_view.is_valid(offset_index);
@@ -189,13 +191,10 @@ __global__ void fused_concatenate_string_chars_kernel(column_device_view const*
     auto const offset_index = output_index - *offset_it;
     auto const& input_view  = input_views[partition_index];
 
-    constexpr auto offsets_child   = strings_column_view::offsets_column_index;
-    auto const* input_offsets_data = input_view.child(offsets_child).data<int32_t>();
-
     constexpr auto chars_child   = strings_column_view::chars_column_index;
     auto const* input_chars_data = input_view.child(chars_child).data<char>();
 
-    auto const first_char     = input_offsets_data[input_view.offset()];
+    auto const first_char     = make_offsets_accessor(input_view)[0];
     output_data[output_index] = input_chars_data[offset_index + first_char];
 
     output_index += blockDim.x * gridDim.x;
@@ -225,6 +224,10 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
 
   bool const has_nulls =
     std::any_of(columns.begin(), columns.end(), [](auto const& col) { return col.has_nulls(); });
+  // The output keeps 64-bit offsets if any input has them
+  bool const has_int64_offsets = std::any_of(columns.begin(), columns.end(), [](auto const& col) {
+    return !col.is_empty() && strings_column_view(col).offsets().type().id() == type_id::INT64;
+  });
 
   // create chars column
   auto chars_column = create_chars_child_column(total_bytes, stream, mr);
@@ -232,9 +235,12 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
   chars_column->set_null_count(0);
 
   // create offsets column
-  auto offsets_column = make_numeric_column(
-    data_type{type_id::INT32}, offsets_count, mask_state::UNALLOCATED, stream, mr);
-  auto d_new_offsets = offsets_column->mutable_view().data<int32_t>();
+  auto offsets_column =
+    make_numeric_column(data_type{has_int64_offsets ? type_id::INT64 : type_id::INT32},
+                        offsets_count,
+                        mask_state::UNALLOCATED,
+                        stream,
+                        mr);
   offsets_column->set_null_count(0);
 
   rmm::device_buffer null_mask{0, stream, mr};
@@ -249,17 +255,27 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
 
     constexpr size_type block_size{256};
     cudf::detail::grid_1d config(offsets_count, block_size);
-    auto const kernel = has_nulls ? fused_concatenate_string_offset_kernel<block_size, true>
-                                  : fused_concatenate_string_offset_kernel<block_size, false>;
-    kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-      d_views,
-      d_input_offsets.data(),
-      d_partition_offsets.data(),
-      static_cast<size_type>(columns.size()),
-      strings_count,
-      d_new_offsets,
-      reinterpret_cast<bitmask_type*>(null_mask.data()),
-      d_valid_count.data());
+    auto const launch_kernel = [&](auto* d_new_offsets) {
+      using OffsetType = std::remove_pointer_t<decltype(d_new_offsets)>;
+      auto const kernel =
+        has_nulls ? fused_concatenate_string_offset_kernel<block_size, true, OffsetType>
+                  : fused_concatenate_string_offset_kernel<block_size, false, OffsetType>;
+      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_views,
+        d_input_offsets.data(),
+        d_partition_offsets.data(),
+        static_cast<size_type>(columns.size()),
+        strings_count,
+        d_new_offsets,
+        reinterpret_cast<bitmask_type*>(null_mask.data()),
+        d_valid_count.data());
+    };
+    auto const d_new_offsets = offsets_column->mutable_view();
+    if (has_int64_offsets) {
+      launch_kernel(d_new_offsets.data<int64_t>());
+    } else {
+      launch_kernel(d_new_offsets.data<int32_t>());
+    }
 
     if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
   }
@@ -287,14 +303,12 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
         column_view offsets_child = column->child(strings_column_view::offsets_column_index);
         column_view chars_child   = column->child(strings_column_view::chars_column_index);
 
-        auto bytes_offset =
-          cudf::detail::get_value<offset_type>(offsets_child, column_offset, stream);
+        auto bytes_offset = get_offset_value(offsets_child, column_offset, stream);
 
         // copy the chars column data
         auto d_chars = chars_child.data<char>() + bytes_offset;
         auto const bytes =
-          cudf::detail::get_value<offset_type>(offsets_child, column_size + column_offset, stream) -
-          bytes_offset;
+          get_offset_value(offsets_child, column_size + column_offset, stream) - bytes_offset;
 
         CUDF_CUDA_TRY(
           cudaMemcpyAsync(d_new_chars, d_chars, bytes, cudaMemcpyDeviceToDevice, stream.value()));
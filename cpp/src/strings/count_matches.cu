@@ -19,6 +19,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/strings/string_view.cuh>
 
 namespace cudf {
@@ -28,9 +29,12 @@ namespace detail {
 namespace {
 /**
  * @brief Kernel counts the total matches for the given regex in each string.
+ *
+ * The positions of the matches are also recorded if `d_positions` is set.
  */
 struct count_fn {
   column_device_view const d_strings;
+  match_pair* d_positions;
 
   __device__ int32_t operator()(size_type const idx,
                                 reprog_device const prog,
@@ -41,13 +45,19 @@ struct count_fn {
     auto const nchars = d_str.length();
     int32_t count     = 0;
 
+    auto const d_matches =
+      d_positions ? d_positions + match_positions_offset(d_strings, idx) : nullptr;
+
     size_type begin = 0;
     size_type end   = -1;
     while ((begin <= nchars) && (prog.find(thread_idx, d_str, begin, end) > 0)) {
+      if (d_matches) { d_matches[count] = match_pair{begin, end}; }
       ++count;
       begin = end + (begin == end);
       end   = -1;
     }
+    // mark the end of the matches unless they fill the positions of this string
+    if (d_matches && count <= d_str.size_bytes()) { d_matches[count] = match_pair{-1, -1}; }
     return count;
   }
 };
@@ -59,6 +69,16 @@ std::unique_ptr<column> count_matches(column_device_view const& d_strings,
                                       size_type output_size,
                                       rmm::cuda_stream_view stream,
                                       rmm::mr::device_memory_resource* mr)
+{
+  return count_matches(d_strings, d_prog, output_size, device_span<match_pair>{}, stream, mr);
+}
+
+std::unique_ptr<column> count_matches(column_device_view const& d_strings,
+                                      reprog_device& d_prog,
+                                      size_type output_size,
+                                      device_span<match_pair> positions,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
 {
   assert(output_size >= d_strings.size() and "Unexpected output size");
 
@@ -69,11 +89,29 @@ std::unique_ptr<column> count_matches(column_device_view const& d_strings,
 
   auto d_results = results->mutable_view().data<int32_t>();
 
-  launch_transform_kernel(count_fn{d_strings}, d_prog, d_results, d_strings.size(), stream);
+  auto const d_positions = positions.empty() ? nullptr : positions.data();
+  launch_transform_kernel(
+    count_fn{d_strings, d_positions}, d_prog, d_results, d_strings.size(), stream);
 
   return results;
 }
 
+rmm::device_uvector<match_pair> create_match_positions(strings_column_view const& input,
+                                                       rmm::cuda_stream_view stream)
+{
+  if (input.is_empty() || input.num_children() == 0) { return {0, stream}; }
+
+  // the bytes of the strings, plus one position for each string
+  auto const first_offset =
+    cudf::detail::get_value<offset_type>(input.offsets(), input.offset(), stream);
+  auto const last_offset =
+    cudf::detail::get_value<offset_type>(input.offsets(), input.offset() + input.size(), stream);
+  auto const size = static_cast<std::size_t>(last_offset - first_offset) + input.size();
+
+  if (size * sizeof(match_pair) > MAX_MATCH_POSITIONS_MEM) { return {0, stream}; }
+  return {size, stream};
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
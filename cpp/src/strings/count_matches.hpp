@@ -17,8 +17,13 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <thrust/pair.h>
 
 namespace cudf {
 
@@ -29,6 +34,11 @@ namespace detail {
 
 class reprog_device;
 
+using match_pair = thrust::pair<cudf::size_type, cudf::size_type>;
+
+/// Maximum memory size for recording match positions in `count_matches`
+constexpr std::size_t MAX_MATCH_POSITIONS_MEM = std::size_t{1} << 30;
+
 /**
  * @brief Returns a column of regex match counts for each string in the given column.
  *
@@ -48,6 +58,44 @@ std::unique_ptr<column> count_matches(
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a column of regex match counts for each string in the given column, and records
+ * the character positions of the matches.
+ *
+ * The positions are recorded in a buffer created by `create_match_positions` for the same strings.
+ * Use `match_reader` to read them instead of evaluating the regex again to find the matches.
+ *
+ * @param d_strings Device view of the input strings column.
+ * @param d_prog Regex instance to evaluate on each string.
+ * @param output_size Number of rows for the output column.
+ * @param positions Buffer receiving the match positions. If empty, no positions are recorded.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return Integer column of match counts
+ */
+std::unique_ptr<column> count_matches(
+  column_device_view const& d_strings,
+  reprog_device& d_prog,
+  size_type output_size,
+  device_span<match_pair> positions,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Creates the buffer for `count_matches` to record the positions of the regex matches of
+ * the given strings.
+ *
+ * A string of `n` bytes has at most `n + 1` matches, which is the number of positions reserved
+ * for each string. The returned buffer is empty, and no positions are recorded, if this would
+ * require more than `MAX_MATCH_POSITIONS_MEM` bytes.
+ *
+ * @param input Strings column the regex is evaluated on.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return Temporary buffer for the match positions
+ */
+rmm::device_uvector<match_pair> create_match_positions(strings_column_view const& input,
+                                                       rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
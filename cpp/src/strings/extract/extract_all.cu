@@ -15,6 +15,7 @@
  */
 
 #include <strings/count_matches.hpp>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/regex/utilities.cuh>
 
 #include <cudf/column/column_device_view.cuh>
@@ -23,6 +24,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/extract.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -49,6 +51,7 @@ namespace {
 struct extract_fn {
   column_device_view const d_strings;
   offset_type const* d_offsets;
+  match_pair const* d_positions;
   string_index_pair* d_indices;
 
   __device__ void operator()(size_type const idx,
@@ -61,17 +64,16 @@ struct extract_fn {
     auto d_output        = d_indices + d_offsets[idx];
     size_type output_idx = 0;
 
-    auto const d_str  = d_strings.element<string_view>(idx);
-    auto const nchars = d_str.length();
+    match_reader matches(d_strings, idx, d_positions, d_prog, prog_idx);
+    auto const& d_str = matches.string();
 
-    size_type begin = 0;
-    size_type end   = nchars;
     // match the regex
-    while ((begin < end) && d_prog.find(prog_idx, d_str, begin, end) > 0) {
+    while (auto const match = matches.next()) {
       // extract each group into the output
       for (auto group_idx = 0; group_idx < groups; ++group_idx) {
         // result is an optional containing the bounds of the extracted string at group_idx
-        auto const extracted = d_prog.extract(prog_idx, d_str, begin, end, group_idx);
+        auto const extracted =
+          d_prog.extract(prog_idx, d_str, match->first, match->second, group_idx);
 
         d_output[group_idx + output_idx] = [&] {
           if (!extracted) { return string_index_pair{nullptr, 0}; }
@@ -81,8 +83,6 @@ struct extract_fn {
         }();
       }
       // continue to next match
-      begin = end;
-      end   = nchars;
       output_idx += groups;
     }
   }
@@ -97,8 +97,7 @@ struct extract_fn {
  */
 std::unique_ptr<column> extract_all_record(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -106,14 +105,15 @@ std::unique_ptr<column> extract_all_record(
   auto const d_strings     = column_device_view::create(input.parent(), stream);
 
   // Compile regex into device object.
-  auto d_prog = reprog_device::create(pattern, flags, stream);
+  auto d_prog = regex_device_builder::create_prog_device(prog, stream);
   // The extract pattern should always include groups.
   auto const groups = d_prog->group_counts();
   CUDF_EXPECTS(groups > 0, "extract_all requires group indicators in the regex pattern.");
 
-  // Get the match counts for each string.
+  // Get the match counts for each string, recording the match positions.
   // This column will become the output lists child offsets column.
-  auto offsets   = count_matches(*d_strings, *d_prog, strings_count + 1, stream, mr);
+  auto positions = create_match_positions(input, stream);
+  auto offsets   = count_matches(*d_strings, *d_prog, strings_count + 1, positions, stream, mr);
   auto d_offsets = offsets->mutable_view().data<offset_type>();
 
   // Compute null output rows
@@ -146,8 +146,11 @@ std::unique_ptr<column> extract_all_record(
 
   rmm::device_uvector<string_index_pair> indices(total_groups, stream);
 
-  launch_for_each_kernel(
-    extract_fn{*d_strings, d_offsets, indices.data()}, *d_prog, strings_count, stream);
+  auto const d_positions = positions.is_empty() ? nullptr : positions.data();
+  launch_for_each_kernel(extract_fn{*d_strings, d_offsets, d_positions, indices.data()},
+                         *d_prog,
+                         strings_count,
+                         stream);
 
   auto strings_output = make_strings_column(indices.begin(), indices.end(), stream, mr);
 
@@ -171,7 +174,16 @@ std::unique_ptr<column> extract_all_record(strings_column_view const& strings,
                                            rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::extract_all_record(strings, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::extract_all_record(strings, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> extract_all_record(strings_column_view const& strings,
+                                           regex_program const& prog,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_all_record(strings, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -25,10 +25,12 @@
 #include <cudf/strings/json.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <io/utilities/parsing_utils.cuh>
 
@@ -40,6 +42,13 @@
 #include <thrust/scan.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -630,17 +639,16 @@ class path_state : private parser {
 };
 
 /**
- * @brief Preprocess the incoming JSONPath string on the host to generate a
- * command buffer for use by the GPU.
+ * @brief Parse a JSONPath string on the host into the operators of a command buffer.
  *
- * @param json_path The incoming json path
- * @param stream Cuda stream to perform any gpu actions on
- * @returns A pair containing the command buffer, and maximum stack depth required.
+ * The names of the operators point into `h_json_path`.
+ *
+ * @param h_json_path The incoming json path
+ * @returns A pair containing the operators, and maximum stack depth required. The operators are
+ * empty if the query is empty.
  */
-std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
-  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+std::pair<std::vector<path_operator>, int> parse_path_operators(std::string const& h_json_path)
 {
-  std::string h_json_path = json_path.to_string(stream);
   path_state p_state(h_json_path.data(), static_cast<size_type>(h_json_path.size()));
 
   std::vector<path_operator> h_operators;
@@ -653,11 +661,6 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
       CUDF_FAIL("Encountered invalid JSONPath input string");
     }
     if (op.type == path_operator_type::CHILD_WILDCARD) { max_stack_depth++; }
-    // convert pointer to device pointer
-    if (op.name.size_bytes() > 0) {
-      op.name =
-        string_view(json_path.data() + (op.name.data() - h_json_path.data()), op.name.size_bytes());
-    }
     if (op.type == path_operator_type::ROOT) {
       CUDF_EXPECTS(h_operators.size() == 0, "Root operator ($) can only exist at the root");
     }
@@ -671,11 +674,49 @@ std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_comma
   } while (op.type != path_operator_type::END);
 
   auto const is_empty = h_operators.size() == 1 && h_operators[0].type == path_operator_type::END;
-  return is_empty
-           ? std::pair(thrust::nullopt, 0)
-           : std::pair(
-               thrust::make_optional(cudf::detail::make_device_uvector_sync(h_operators, stream)),
-               max_stack_depth);
+  return is_empty ? std::pair(std::vector<path_operator>{}, 0)
+                  : std::pair(std::move(h_operators), max_stack_depth);
+}
+
+/**
+ * @brief Point the names of operators parsed from `h_json_path` to the device copy of the path.
+ *
+ * @param operators Operators returned by `parse_path_operators(h_json_path)`
+ * @param h_json_path Host copy of the json path
+ * @param json_path The incoming json path
+ */
+void to_device_names(host_span<path_operator> operators,
+                     std::string const& h_json_path,
+                     cudf::string_scalar const& json_path)
+{
+  for (auto& op : operators) {
+    if (op.name.size_bytes() > 0) {
+      op.name =
+        string_view(json_path.data() + (op.name.data() - h_json_path.data()), op.name.size_bytes());
+    }
+  }
+}
+
+/**
+ * @brief Preprocess the incoming JSONPath string on the host to generate a
+ * command buffer for use by the GPU.
+ *
+ * @param json_path The incoming json path
+ * @param stream Cuda stream to perform any gpu actions on
+ * @returns A pair containing the command buffer, and maximum stack depth required.
+ */
+std::pair<thrust::optional<rmm::device_uvector<path_operator>>, int> build_command_buffer(
+  cudf::string_scalar const& json_path, rmm::cuda_stream_view stream)
+{
+  std::string h_json_path = json_path.to_string(stream);
+  auto [h_operators, max_stack_depth] = parse_path_operators(h_json_path);
+  if (h_operators.empty()) { return std::pair(thrust::nullopt, 0); }
+
+  // convert pointers to device pointers
+  to_device_names(h_operators, h_json_path, json_path);
+  return std::pair(
+    thrust::make_optional(cudf::detail::make_device_uvector_sync(h_operators, stream)),
+    max_stack_depth);
 }
 
 #define PARSE_TRY(_x)                                                       \
@@ -956,6 +997,166 @@ __launch_bounds__(block_size) __global__
   }
 }
 
+// depth of the path prefixes whose parse states are shared across the queries of
+// get_json_object_multiple_paths_kernel
+constexpr int max_shared_prefix_depth = 8;
+
+/**
+ * @brief Whether an operator selects a single element without producing output when it succeeds,
+ * so that the parse state after it can be shared by queries starting with the same operators.
+ */
+CUDF_HOST_DEVICE inline bool is_prefix_operator(path_operator const& op)
+{
+  return op.type == path_operator_type::ROOT || op.type == path_operator_type::CHILD ||
+         op.type == path_operator_type::CHILD_INDEX;
+}
+
+/**
+ * @brief Apply a prefix operator to a json string, as `parse_json_path` does.
+ *
+ * @param j_state The json string and associated parser, advanced to the selected element
+ * @param op The operator to apply, for which `is_prefix_operator` is true
+ * @returns SUCCESS if an element was selected without producing output. Otherwise
+ * `parse_json_path` must apply the operator to handle the result.
+ */
+__device__ parse_result apply_prefix_operator(json_state& j_state, path_operator const& op)
+{
+  switch (op.type) {
+    case path_operator_type::ROOT: return j_state.next_element();
+
+    case path_operator_type::CHILD: {
+      auto const result = j_state.child_element(op.expected_type);
+      if (result != parse_result::SUCCESS) { return result; }
+      return j_state.next_matching_element(op.name, true);
+    }
+
+    case path_operator_type::CHILD_INDEX: {
+      string_view const any{"*", 1};
+      auto result = j_state.child_element(op.expected_type);
+      if (result == parse_result::SUCCESS) { result = j_state.next_matching_element(any, true); }
+      for (int idx = 1; idx <= op.index && result == parse_result::SUCCESS; idx++) {
+        result = j_state.next_matching_element(any, false);
+      }
+      return result;
+    }
+
+    default: return parse_result::ERROR;
+  }
+}
+
+/**
+ * @brief Output buffers of one query of `get_json_object_multiple_paths_kernel`.
+ */
+struct json_path_output {
+  offset_type* offsets;    // sizes in the size computation step, offsets in the output step
+  char* chars;             // output characters, only used in the output step
+  bitmask_type* validity;  // output validity, only used in the output step
+};
+
+/**
+ * @brief Kernel for running multiple JSONPath queries on each row.
+ *
+ * Each thread applies all the queries to a row in turn, so that the row is read from device memory
+ * once. The queries are sorted by their operators, and the parse states after the leading
+ * operators of a query are reused by the next query when both start with the same operators.
+ *
+ * Like `get_json_object_kernel`, this kernel operates in a 2-pass way.
+ *
+ * @param col Device view of the incoming string
+ * @param commands Command buffers of all the queries
+ * @param command_offsets Offset of the command buffer of each query in `commands`
+ * @param shared_prefixes Number of leading prefix operators of each query equal to the ones of the
+ * previous query
+ * @param outputs Output buffers of each query
+ * @param num_paths Number of queries
+ * @param out_valid_counts Output count of # of valid bits of each query, zero-initialized. Only
+ * set in the output step
+ * @param options Options controlling behavior
+ */
+template <int block_size>
+__launch_bounds__(block_size) __global__
+  void get_json_object_multiple_paths_kernel(column_device_view col,
+                                             path_operator const* const commands,
+                                             size_type const* command_offsets,
+                                             size_type const* shared_prefixes,
+                                             json_path_output const* outputs,
+                                             size_type num_paths,
+                                             thrust::optional<size_type*> out_valid_counts,
+                                             get_json_object_options options)
+{
+  size_type tid    = threadIdx.x + (blockDim.x * blockIdx.x);
+  size_type stride = blockDim.x * gridDim.x;
+
+  auto active_threads = __ballot_sync(0xffffffff, tid < col.size());
+  while (tid < col.size()) {
+    string_view const str = col.element<string_view>(tid);
+
+    // parse states after the leading prefix operators of the previous query
+    json_state prefix_states[max_shared_prefix_depth + 1];
+    prefix_states[0] = json_state(str.data(), str.size_bytes(), options);
+    int cached_depth = 0;
+
+    for (size_type path_idx = 0; path_idx < num_paths; path_idx++) {
+      auto const& out       = outputs[path_idx];
+      bool is_valid         = false;
+      size_type output_size = 0;
+      if (str.size_bytes() > 0) {
+        char* dst = out_valid_counts.has_value() ? out.chars + out.offsets[tid] : nullptr;
+        size_t const dst_size =
+          out_valid_counts.has_value() ? out.offsets[tid + 1] - out.offsets[tid] : 0;
+        path_operator const* path_commands = commands + command_offsets[path_idx];
+
+        // resume after the operators shared with the previous query, and cache the states after
+        // the following prefix operators for the next query
+        int depth = min(shared_prefixes[path_idx], cached_depth);
+        while (depth < max_shared_prefix_depth && is_prefix_operator(path_commands[depth])) {
+          json_state j_state{prefix_states[depth]};
+          if (apply_prefix_operator(j_state, path_commands[depth]) != parse_result::SUCCESS) {
+            break;
+          }
+          prefix_states[++depth] = json_state{j_state};
+        }
+        cached_depth = depth;
+
+        json_output output{dst_size, dst};
+        auto const result = parse_json_path<max_command_stack_depth>(
+          prefix_states[depth], path_commands + depth, output);
+        output_size = output.output_len.value_or(0);
+        if (output.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+      }
+
+      if (!out_valid_counts.has_value()) {
+        out.offsets[tid] = static_cast<offset_type>(output_size);
+      } else {
+        uint32_t mask = __ballot_sync(active_threads, is_valid);
+        // 0th lane of the warp writes the validity
+        if (!(tid % cudf::detail::warp_size)) {
+          out.validity[cudf::word_index(tid)] = mask;
+          atomicAdd(out_valid_counts.value() + path_idx, __popc(mask));
+        }
+      }
+    }
+
+    tid += stride;
+    active_threads = __ballot_sync(active_threads, tid < col.size());
+  }
+}
+
+/**
+ * @brief Create a strings column of all nulls, the result of an empty query.
+ */
+std::unique_ptr<cudf::column> make_all_nulls_column(size_type size,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  return std::make_unique<column>(
+    data_type{type_id::STRING},
+    size,
+    rmm::device_buffer{0, stream, mr},  // no data
+    cudf::detail::create_null_mask(size, mask_state::ALL_NULL, stream, mr),
+    size);  // null count
+}
+
 /**
  * @copydoc cudf::strings::detail::get_json_object
  */
@@ -977,12 +1178,7 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
 
   // if the query is empty, return a string column containing all nulls
   if (!std::get<0>(preprocess).has_value()) {
-    return std::make_unique<column>(
-      data_type{type_id::STRING},
-      col.size(),
-      rmm::device_buffer{0, stream, mr},  // no data
-      cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr),
-      col.size());  // null count
+    return make_all_nulls_column(col.size(), stream, mr);
   }
 
   constexpr int block_size = 512;
@@ -1036,6 +1232,176 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                              std::move(validity));
 }
 
+/**
+ * @copydoc cudf::strings::detail::get_json_object(cudf::strings_column_view const&,
+ * host_span<cudf::string_scalar const>, get_json_object_options, rmm::cuda_stream_view,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             host_span<cudf::string_scalar const> json_paths,
+                                             get_json_object_options options,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  auto const num_paths = static_cast<size_type>(json_paths.size());
+
+  // preprocess the json_paths into operators. the host copies of the paths are made first, as the
+  // names of the operators point into them
+  std::vector<std::string> h_json_paths;
+  h_json_paths.reserve(num_paths);
+  std::transform(json_paths.begin(),
+                 json_paths.end(),
+                 std::back_inserter(h_json_paths),
+                 [stream](auto const& json_path) { return json_path.to_string(stream); });
+  std::vector<std::vector<path_operator>> h_operators;
+  for (auto const& h_json_path : h_json_paths) {
+    auto [operators, max_stack_depth] = parse_path_operators(h_json_path);
+    CUDF_EXPECTS(max_stack_depth <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    h_operators.push_back(std::move(operators));
+  }
+
+  if (col.is_empty()) {
+    std::vector<std::unique_ptr<cudf::column>> results;
+    std::generate_n(std::back_inserter(results), num_paths, [] {
+      return make_empty_column(type_id::STRING);
+    });
+    return std::make_unique<cudf::table>(std::move(results));
+  }
+
+  // evaluate the non-empty queries sorted by their operators, so that queries sharing leading
+  // operators are next to each other
+  auto const host_name = [](path_operator const& op) {
+    return std::string_view(op.name.data(), op.name.size_bytes());
+  };
+  auto const op_less = [&](path_operator const& lhs, path_operator const& rhs) {
+    return std::tuple(lhs.type, lhs.expected_type, host_name(lhs), lhs.index) <
+           std::tuple(rhs.type, rhs.expected_type, host_name(rhs), rhs.index);
+  };
+  auto const op_equal = [&](path_operator const& lhs, path_operator const& rhs) {
+    return !op_less(lhs, rhs) && !op_less(rhs, lhs);
+  };
+  std::vector<size_type> order;
+  for (size_type idx = 0; idx < num_paths; idx++) {
+    if (!h_operators[idx].empty()) { order.push_back(idx); }
+  }
+  std::stable_sort(order.begin(), order.end(), [&](size_type lhs, size_type rhs) {
+    return std::lexicographical_compare(h_operators[lhs].begin(),
+                                        h_operators[lhs].end(),
+                                        h_operators[rhs].begin(),
+                                        h_operators[rhs].end(),
+                                        op_less);
+  });
+
+  // concatenate the command buffers in evaluation order
+  std::vector<path_operator> h_commands;
+  std::vector<size_type> h_command_offsets;
+  std::vector<size_type> h_shared_prefixes;
+  for (auto const idx : order) {
+    auto& operators = h_operators[idx];
+    size_type shared_prefix = 0;
+    if (!h_command_offsets.empty()) {
+      auto const& prev = h_operators[order[h_command_offsets.size() - 1]];
+      auto const size  = std::min(prev.size(), operators.size());
+      while (static_cast<size_t>(shared_prefix) < size &&
+             is_prefix_operator(operators[shared_prefix]) &&
+             op_equal(operators[shared_prefix], prev[shared_prefix])) {
+        shared_prefix++;
+      }
+    }
+    h_command_offsets.push_back(static_cast<size_type>(h_commands.size()));
+    h_shared_prefixes.push_back(shared_prefix);
+    h_commands.insert(h_commands.end(), operators.begin(), operators.end());
+  }
+  // convert pointers to device pointers, now that the operators have been compared
+  for (size_t i = 0; i < order.size(); i++) {
+    to_device_names({h_commands.data() + h_command_offsets[i], h_operators[order[i]].size()},
+                    h_json_paths[order[i]],
+                    json_paths[order[i]]);
+  }
+
+  // empty queries return a string column containing all nulls
+  std::vector<std::unique_ptr<cudf::column>> results(num_paths);
+  for (size_type idx = 0; idx < num_paths; idx++) {
+    if (h_operators[idx].empty()) { results[idx] = make_all_nulls_column(col.size(), stream, mr); }
+  }
+  if (order.empty()) { return std::make_unique<cudf::table>(std::move(results)); }
+
+  auto const d_commands        = cudf::detail::make_device_uvector_async(h_commands, stream);
+  auto const d_command_offsets = cudf::detail::make_device_uvector_async(h_command_offsets, stream);
+  auto const d_shared_prefixes = cudf::detail::make_device_uvector_async(h_shared_prefixes, stream);
+
+  // allocate output offsets buffers.
+  std::vector<std::unique_ptr<cudf::column>> offsets;
+  std::vector<json_path_output> h_outputs;
+  for (size_t i = 0; i < order.size(); i++) {
+    offsets.push_back(cudf::make_fixed_width_column(
+      data_type{type_id::INT32}, col.size() + 1, mask_state::UNALLOCATED, stream, mr));
+    h_outputs.push_back(
+      json_path_output{offsets.back()->mutable_view().head<offset_type>(), nullptr, nullptr});
+  }
+
+  constexpr int block_size = 512;
+  cudf::detail::grid_1d const grid{col.size(), block_size};
+  auto cdv = column_device_view::create(col.parent(), stream);
+  // preprocess sizes (returned in the offsets buffers)
+  auto const d_sizes_outputs = cudf::detail::make_device_uvector_async(h_outputs, stream);
+  get_json_object_multiple_paths_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *cdv,
+      d_commands.data(),
+      d_command_offsets.data(),
+      d_shared_prefixes.data(),
+      d_sizes_outputs.data(),
+      static_cast<size_type>(order.size()),
+      thrust::nullopt,
+      options);
+
+  // convert sizes to offsets, and allocate output string columns
+  std::vector<std::unique_ptr<cudf::column>> chars;
+  std::vector<rmm::device_buffer> validities;
+  for (size_t i = 0; i < order.size(); i++) {
+    cudf::mutable_column_view offsets_view(*offsets[i]);
+    thrust::exclusive_scan(rmm::exec_policy(stream),
+                           offsets_view.head<offset_type>(),
+                           offsets_view.head<offset_type>() + col.size() + 1,
+                           offsets_view.head<offset_type>(),
+                           0);
+    size_type const output_size =
+      cudf::detail::get_value<offset_type>(offsets_view, col.size(), stream);
+
+    chars.push_back(create_chars_child_column(output_size, stream, mr));
+    validities.push_back(
+      cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr));
+    h_outputs[i].chars    = chars.back()->mutable_view().head<char>();
+    h_outputs[i].validity = static_cast<bitmask_type*>(validities.back().data());
+  }
+
+  // compute results
+  auto const d_outputs = cudf::detail::make_device_uvector_async(h_outputs, stream);
+  auto d_valid_counts =
+    cudf::detail::make_zeroed_device_uvector_async<size_type>(order.size(), stream);
+  get_json_object_multiple_paths_kernel<block_size>
+    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+      *cdv,
+      d_commands.data(),
+      d_command_offsets.data(),
+      d_shared_prefixes.data(),
+      d_outputs.data(),
+      static_cast<size_type>(order.size()),
+      d_valid_counts.data(),
+      options);
+
+  auto const h_valid_counts = cudf::detail::make_std_vector_sync(d_valid_counts, stream);
+  for (size_t i = 0; i < order.size(); i++) {
+    results[order[i]] = make_strings_column(col.size(),
+                                            std::move(offsets[i]),
+                                            std::move(chars[i]),
+                                            col.size() - h_valid_counts[i],
+                                            std::move(validities[i]));
+  }
+  return std::make_unique<cudf::table>(std::move(results));
+}
 }  // namespace
 }  // namespace detail
 
@@ -1051,5 +1417,19 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc cudf::strings::get_json_object(cudf::strings_column_view const&,
+ * host_span<cudf::string_scalar const>, get_json_object_options,
+ * rmm::mr::device_memory_resource*)
+ */
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             host_span<cudf::string_scalar const> json_paths,
+                                             get_json_object_options options,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_object(col, json_paths, options, cudf::default_stream_value, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
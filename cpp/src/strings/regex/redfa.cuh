@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <strings/regex/regcomp.h>
+
+#include <cudf/strings/detail/char_tables.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/string_view.cuh>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Table-driven DFA stored on the device.
+ *
+ * Unlike `reprog_device`, evaluating a string needs no working memory: each character is a
+ * single lookup in the transition table.
+ */
+class redfa_device {
+ public:
+  /**
+   * @brief Copies the tables of the given DFA to the device.
+   *
+   * @param dfa DFA built by `reprog::create_dfa`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The DFA device object
+   */
+  static std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> create(
+    redfa const& dfa, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns true if the given string contains a match of the regex.
+   *
+   * @param d_str The string to search
+   * @return true if a match is found
+   */
+  __device__ inline bool is_match(string_view const d_str) const
+  {
+    auto state     = 0;
+    auto ptr       = d_str.data();
+    auto const end = ptr + d_str.size_bytes();
+    while (ptr < end) {
+      auto const flags = _state_flags[state];
+      if (flags & (DFA_ACCEPT | DFA_DEAD)) { return flags & DFA_ACCEPT; }
+      state = _transitions[state * _classes_count + _symbol_classes[next_symbol(ptr)]];
+    }
+    return _state_flags[state] & DFA_ACCEPT_AT_END;
+  }
+
+ private:
+  /**
+   * @brief Returns the DFA symbol of the character at `ptr` and advances `ptr` past it.
+   */
+  __device__ inline int32_t next_symbol(char const*& ptr) const
+  {
+    int32_t const byte = static_cast<uint8_t>(*ptr);
+    if (byte < DFA_ASCII_SYMBOLS) {
+      ++ptr;
+      return byte;
+    }
+    char_utf8 chr = 0;
+    ptr += to_char_utf8(ptr, chr);
+    auto const codept = utf8_to_codepoint(chr);
+    if (codept > 0x00FFFF) { return DFA_SYMBOLS_COUNT - 1; }
+    auto const fl = _codepoint_flags[codept];
+    return DFA_ASCII_SYMBOLS + (IS_ALPHANUM(fl) ? 1 : 0) + (IS_SPACE(fl) ? 2 : 0) +
+           (IS_DIGIT(fl) ? 4 : 0);
+  }
+
+  redfa_device() = default;
+
+  int32_t _classes_count{};
+  uint8_t const* _codepoint_flags{};  // table of character types
+  uint8_t const* _symbol_classes{};   // class of each symbol
+  uint8_t const* _state_flags{};      // flags of each state
+  int16_t const* _transitions{};      // next state for each (state, class)
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
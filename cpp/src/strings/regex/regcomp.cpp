@@ -24,7 +24,9 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <map>
 #include <numeric>
+#include <optional>
 #include <stack>
 #include <string>
 #include <tuple>
@@ -1059,6 +1061,190 @@ void reprog::check_for_errors()
   }
 }
 
+namespace {
+
+/**
+ * @brief Returns the builtin class category of a DFA symbol.
+ *
+ * The category holds the alphanumeric, space and digit bits of the character's codepoint flags.
+ * For ASCII characters these match the entries of the codepoint flags table.
+ */
+int32_t symbol_category(int32_t symbol)
+{
+  if (symbol >= DFA_ASCII_SYMBOLS) { return symbol - DFA_ASCII_SYMBOLS; }
+  auto const is_alphanum = std::isalnum(symbol) != 0;
+  auto const is_space    = (symbol >= '\t' && symbol <= '\r') || (symbol >= 0x1c && symbol <= ' ');
+  auto const is_digit    = std::isdigit(symbol) != 0;
+  return static_cast<int32_t>(is_alphanum) | (static_cast<int32_t>(is_space) << 1) |
+         (static_cast<int32_t>(is_digit) << 2);
+}
+
+/**
+ * @brief Host equivalent of `reclass_device::is_match` for a DFA symbol.
+ */
+bool symbol_matches(reclass const& cls, int32_t symbol)
+{
+  auto const ch = symbol < DFA_ASCII_SYMBOLS ? static_cast<char32_t>(symbol) : char32_t{0};
+  if (symbol < DFA_ASCII_SYMBOLS &&
+      std::any_of(cls.literals.begin(), cls.literals.end(), [ch](auto const& literal) {
+        return ch >= literal.first && ch <= literal.last;
+      })) {
+    return true;
+  }
+  // builtins never match codepoints beyond the flags table
+  if (!cls.builtins || symbol == DFA_SYMBOLS_COUNT - 1) { return false; }
+  auto const category    = symbol_category(symbol);
+  auto const is_alphanum = (category & 1) != 0;
+  auto const is_space    = (category & 2) != 0;
+  auto const is_digit    = (category & 4) != 0;
+  return ((cls.builtins & CCLASS_W) && (ch == '_' || is_alphanum)) ||
+         ((cls.builtins & CCLASS_S) && is_space) || ((cls.builtins & CCLASS_D) && is_digit) ||
+         ((cls.builtins & NCCLASS_W) && ch != '\n' && ch != '_' && !is_alphanum) ||
+         ((cls.builtins & NCCLASS_S) && !is_space) ||
+         ((cls.builtins & NCCLASS_D) && ch != '\n' && !is_digit);
+}
+
+}  // namespace
+
+std::optional<redfa> reprog::create_dfa(bool anchored) const
+{
+  // the DFA matches characters through symbols so every literal must be ASCII
+  for (auto const& inst : _insts) {
+    switch (inst.type) {
+      case CHAR:
+        if (inst.u1.c >= static_cast<char32_t>(DFA_ASCII_SYMBOLS)) { return std::nullopt; }
+        break;
+      case CCLASS:
+      case NCCLASS: {
+        auto const& literals = _classes[inst.u1.cls_id].literals;
+        if (std::any_of(literals.begin(), literals.end(), [](auto const& literal) {
+              return literal.last >= static_cast<char32_t>(DFA_ASCII_SYMBOLS);
+            })) {
+          return std::nullopt;
+        }
+        break;
+      }
+      case BOL:
+        if (inst.u1.c == '^') { return std::nullopt; }  // multiline
+        break;
+      case EOL:
+        if (inst.u1.c == '$') { return std::nullopt; }  // multiline
+        break;
+      case BOW:
+      case NBOW: return std::nullopt;
+      default: break;
+    }
+  }
+
+  auto const consumes = [this](int32_t id, int32_t symbol) {
+    auto const& inst = _insts[id];
+    switch (inst.type) {
+      case CHAR: return static_cast<int32_t>(inst.u1.c) == symbol;
+      case ANY: return symbol != '\n';
+      case ANYNL: return true;
+      case CCLASS: return symbol_matches(_classes[inst.u1.cls_id], symbol);
+      case NCCLASS: return !symbol_matches(_classes[inst.u1.cls_id], symbol);
+      default: return false;
+    }
+  };
+
+  // symbols consumed by the same instructions share a class
+  redfa dfa;
+  std::vector<std::vector<bool>> class_symbols;  // consumed instructions of each class
+  std::vector<int32_t> class_symbol;             // a symbol of each class
+  dfa.symbol_classes.resize(DFA_SYMBOLS_COUNT);
+  for (int32_t symbol = 0; symbol < DFA_SYMBOLS_COUNT; ++symbol) {
+    std::vector<bool> consumed(_insts.size());
+    for (int32_t id = 0; id < insts_count(); ++id) {
+      consumed[id] = consumes(id, symbol);
+    }
+    auto const found = std::find(class_symbols.begin(), class_symbols.end(), consumed);
+    dfa.symbol_classes[symbol] = static_cast<uint8_t>(std::distance(class_symbols.begin(), found));
+    if (found == class_symbols.end()) {
+      class_symbols.push_back(std::move(consumed));
+      class_symbol.push_back(symbol);
+    }
+  }
+  dfa.classes_count = static_cast<int32_t>(class_symbols.size());
+
+  // follows the non-character instructions like regexec does before matching a character
+  auto const closure = [this](std::vector<int32_t> const& ids, bool at_begin, bool at_end) {
+    std::vector<bool> visited(_insts.size());
+    std::vector<int32_t> result;
+    std::stack<int32_t> pending;
+    for (auto id : ids) {
+      pending.push(id);
+    }
+    while (!pending.empty()) {
+      auto const id = pending.top();
+      pending.pop();
+      if (visited[id]) { continue; }
+      visited[id]      = true;
+      auto const& inst = _insts[id];
+      switch (inst.type) {
+        case OR:
+          pending.push(inst.u1.right_id);
+          pending.push(inst.u2.left_id);
+          break;
+        case LBRA:
+        case RBRA: pending.push(inst.u2.next_id); break;
+        case BOL:
+          if (at_begin) { pending.push(inst.u2.next_id); }
+          break;
+        case EOL:
+          if (at_end) { pending.push(inst.u2.next_id); }
+          break;
+        default: result.push_back(id);
+      }
+    }
+    return result;
+  };
+  auto const has_end = [this](std::vector<int32_t> const& ids) {
+    return std::any_of(ids.begin(), ids.end(), [this](auto id) { return _insts[id].type == END; });
+  };
+
+  // a DFA state is the set of instructions pending before a character and whether that
+  // character is the first one of the string
+  using dfa_state = std::pair<std::vector<int32_t>, bool>;
+  std::map<dfa_state, int16_t> state_ids;
+  std::vector<dfa_state> states;
+  auto const get_state = [&](dfa_state&& state) {
+    std::sort(state.first.begin(), state.first.end());
+    state.first.erase(std::unique(state.first.begin(), state.first.end()), state.first.end());
+    auto const found = state_ids.find(state);
+    if (found != state_ids.end()) { return static_cast<int32_t>(found->second); }
+    auto const id = static_cast<int32_t>(states.size());
+    if (id < DFA_MAX_STATES) {
+      state_ids.emplace(state, static_cast<int16_t>(id));
+      states.push_back(std::move(state));
+    }
+    return id;
+  };
+
+  get_state({{_startinst_id}, true});
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    auto const [ids, at_begin] = states[index];
+    auto const active          = closure(ids, at_begin, false);
+    uint8_t flags              = has_end(active) ? DFA_ACCEPT : 0;
+    flags |= has_end(closure(ids, at_begin, true)) ? DFA_ACCEPT_AT_END : 0;
+    flags |= ids.empty() ? DFA_DEAD : 0;
+    dfa.state_flags.push_back(flags);
+
+    for (int32_t cls = 0; cls < dfa.classes_count; ++cls) {
+      std::vector<int32_t> next_ids;
+      for (auto id : active) {
+        if (consumes(id, class_symbol[cls])) { next_ids.push_back(_insts[id].u2.next_id); }
+      }
+      // a match may start at any character unless anchored
+      if (!anchored) { next_ids.push_back(_startinst_id); }
+      auto const next = get_state({std::move(next_ids), false});
+      if (next >= DFA_MAX_STATES) { return std::nullopt; }
+      dfa.transitions.push_back(static_cast<int16_t>(next));
+    }
+  }
+  return dfa;
+}
+
 #ifndef NDEBUG
 void reprog::print(regex_flags const flags)
 {
@@ -17,6 +17,7 @@
 
 #include <cudf/strings/regex/flags.hpp>
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -91,6 +92,33 @@ struct reinst {
   int32_t reserved4;
 };
 
+constexpr int32_t DFA_ASCII_SYMBOLS{128};
+constexpr int32_t DFA_SYMBOLS_COUNT{DFA_ASCII_SYMBOLS + 9};
+constexpr int32_t DFA_MAX_STATES{1024};       // larger DFAs fall back to the NFA evaluation
+constexpr uint8_t DFA_ACCEPT{1 << 0};         // a match ends before the next character
+constexpr uint8_t DFA_ACCEPT_AT_END{1 << 1};  // a match ends at the end of the string
+constexpr uint8_t DFA_DEAD{1 << 2};           // no match is possible anymore
+
+/**
+ * @brief Table-driven DFA equivalent to a regex program.
+ *
+ * The DFA only reports whether a string contains a match so it is built just for programs
+ * whose match existence does not depend on capture positions or word boundaries.
+ *
+ * Input characters are mapped to symbols: ASCII characters map to themselves and other
+ * characters map to `DFA_ASCII_SYMBOLS + (alphanumeric | space << 1 | digit << 2)` using their
+ * codepoint flags, or to `DFA_SYMBOLS_COUNT - 1` for codepoints beyond the flags table.
+ * Symbols the program cannot tell apart share a class, which indexes the transition table.
+ */
+struct redfa {
+  std::vector<uint8_t> symbol_classes;  // class of each symbol
+  int32_t classes_count{};              // number of distinct classes
+  std::vector<int16_t> transitions;     // next state for each (state, class)
+  std::vector<uint8_t> state_flags;     // DFA_ACCEPT, DFA_ACCEPT_AT_END and DFA_DEAD per state
+
+  [[nodiscard]] int32_t states_count() const { return static_cast<int32_t>(state_flags.size()); }
+};
+
 /**
  * @brief Regex program handles parsing a pattern into a vector
  * of chained instructions.
@@ -134,6 +162,15 @@ class reprog {
   void set_start_inst(int32_t id);
   [[nodiscard]] int32_t get_start_inst() const;
 
+  /**
+   * @brief Builds a DFA reporting whether a string contains a match of this program.
+   *
+   * @param anchored Only consider matches starting at the beginning of the string
+   * @return The DFA, or no value if this program has instructions the DFA cannot express
+   *         (word boundaries, multiline anchors, non-ASCII literals) or too many states
+   */
+  [[nodiscard]] std::optional<redfa> create_dfa(bool anchored) const;
+
   void finalize();
   void check_for_errors();
 #ifndef NDEBUG
@@ -39,7 +39,6 @@ struct relist;
 using match_pair   = thrust::pair<cudf::size_type, cudf::size_type>;
 using match_result = thrust::optional<match_pair>;
 
-constexpr int32_t MAX_SHARED_MEM      = 2048;  ///< Memory size for storing prog instruction data
 constexpr std::size_t MAX_WORKING_MEM = 0x01FFFFFFFF;  ///< Memory size for state data
 constexpr int32_t MINIMUM_THREADS     = 256;  // Minimum threads for computing working memory
 
@@ -101,6 +100,16 @@ class reprog_device {
   static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
     std::string_view pattern, regex_flags const re_flags, rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Create the device program instance from a compiled host program.
+   *
+   * @param h_prog The compiled host program.
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The program device object.
+   */
+  static std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> create(
+    reprog& h_prog, rmm::cuda_stream_view stream);
+
   /**
    * @brief Called automatically by the unique_ptr returned from create().
    */
@@ -127,6 +136,8 @@ class reprog_device {
   /**
    * @brief Returns the size needed for working memory for the given thread count.
    *
+   * No working memory is needed if `set_shared_memory` placed the state data in shared memory.
+   *
    * @param num_threads Number of threads to be executed in parallel
    * @return Size of working memory in bytes
    */
@@ -161,13 +172,21 @@ class reprog_device {
   void set_working_memory(void* buffer, int32_t thread_count, int32_t max_insts = 0);
 
   /**
-   * @brief Returns the size of shared memory required to hold this instance.
+   * @brief Chooses what to place in the shared memory of kernels launched with `block_size`
+   * threads per block and returns the size of that shared memory.
+   *
+   * The shared memory available to a block is what it can use without reducing the number of
+   * blocks resident on a multiprocessor of the current device. This instance is placed in it
+   * when it fits, so that the instructions are not read from global memory on every step. The
+   * state data of each thread of the block is placed after it when that fits too, in which case
+   * no working memory is needed. Otherwise, 0 is returned and everything stays in global memory.
+   *
+   * The kernels must call `store()` and `load()` with their shared memory.
    *
-   * This can be called on the CPU for specifying the shared-memory size in the
-   * kernel launch parameters.
-   * This may return 0 if the MAX_SHARED_MEM value is exceeded.
+   * @param block_size Number of threads per block of the kernels
+   * @return Size of shared memory in bytes to launch the kernels with
    */
-  [[nodiscard]] int32_t compute_shared_memory_size() const;
+  int32_t set_shared_memory(int32_t block_size);
 
   /**
    * @brief Returns the thread count passed on `set_working_memory`.
@@ -177,14 +196,15 @@ class reprog_device {
   /**
    * @brief Store this object into the given device pointer (e.g. shared memory).
    *
-   * No data is stored if MAX_SHARED_MEM is exceeded for this object.
+   * No data is stored if `set_shared_memory` did not place this object in shared memory.
    */
   __device__ inline void store(void* buffer) const;
 
   /**
    * @brief Load an instance of this class from a device buffer (e.g. shared memory).
    *
-   * Data is loaded from the given buffer if MAX_SHARED_MEM is not exceeded for the given object.
+   * Data is loaded from the given buffer if `set_shared_memory` placed the given object in shared
+   * memory, and the state data is then also read from the buffer if it was placed there.
    * Otherwise, a copy of the object is returned.
    */
   [[nodiscard]] __device__ static inline reprog_device load(reprog_device const prog, void* buffer);
@@ -266,6 +286,11 @@ class reprog_device {
                                          cudf::size_type& end,
                                          cudf::size_type const group_id = 0) const;
 
+  /**
+   * @brief Returns the size of this instance in shared memory, aligned for the state data.
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE inline std::size_t shared_prog_size() const;
+
   reprog_device(reprog&);
 
   int32_t _startinst_id;          // first instruction id
@@ -283,6 +308,8 @@ class reprog_device {
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
   int32_t _thread_count{};   // threads available in working memory
+  bool _prog_in_shmem{};     // whether kernels load this instance from shared memory
+  bool _relists_in_shmem{};  // whether the state data is in shared memory after it
 };
 
 }  // namespace detail
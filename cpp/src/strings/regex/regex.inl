@@ -178,9 +178,14 @@ __device__ __forceinline__ bool reprog_device::is_empty() const
   return insts_counts() == 0 || get_inst(0).type == END;
 }
 
+CUDF_HOST_DEVICE inline std::size_t reprog_device::shared_prog_size() const
+{
+  return cudf::util::round_up_unsafe(_prog_size, sizeof(relist::restate));
+}
+
 __device__ __forceinline__ void reprog_device::store(void* buffer) const
 {
-  if (_prog_size > MAX_SHARED_MEM) { return; }
+  if (!_prog_in_shmem) { return; }
 
   auto ptr = static_cast<u_char*>(buffer);
 
@@ -217,8 +222,13 @@ __device__ __forceinline__ void reprog_device::store(void* buffer) const
 
 __device__ __forceinline__ reprog_device reprog_device::load(reprog_device const prog, void* buffer)
 {
-  return (prog._prog_size > MAX_SHARED_MEM) ? reprog_device(prog)
-                                            : reinterpret_cast<reprog_device*>(buffer)[0];
+  if (!prog._prog_in_shmem) { return reprog_device(prog); }
+  auto result = reinterpret_cast<reprog_device*>(buffer)[0];
+  // the state data of the threads of the block follows the instance
+  if (prog._relists_in_shmem) {
+    result._buffer = static_cast<u_char*>(buffer) + prog.shared_prog_size();
+  }
+  return result;
 }
 
 /**
@@ -419,11 +429,15 @@ __device__ __forceinline__ int32_t reprog_device::call_regexec(int32_t const thr
                                                                cudf::size_type& end,
                                                                cudf::size_type const group_id) const
 {
+  // state data in shared memory is only for the threads of the block
+  auto const stride = _relists_in_shmem ? static_cast<int32_t>(blockDim.x) : _thread_count;
+  auto const index  = _relists_in_shmem ? static_cast<int32_t>(threadIdx.x) : thread_idx;
+
   auto gp_ptr = reinterpret_cast<u_char*>(_buffer);
-  relist list1(static_cast<int16_t>(_max_insts), _thread_count, gp_ptr, thread_idx);
+  relist list1(static_cast<int16_t>(_max_insts), stride, gp_ptr, index);
 
-  gp_ptr += relist::alloc_size(_max_insts, _thread_count);
-  relist list2(static_cast<int16_t>(_max_insts), _thread_count, gp_ptr, thread_idx);
+  gp_ptr += relist::alloc_size(_max_insts, stride);
+  relist list2(static_cast<int16_t>(_max_insts), stride, gp_ptr, index);
 
   reljunk jnk(&list1, &list2, get_inst(_startinst_id));
   return regexec(dstr, jnk, begin, end, group_id);
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <strings/regex/regex_program_impl.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace strings {
+
+std::unique_ptr<regex_program> regex_program::create(std::string_view pattern, regex_flags flags)
+{
+  auto p = new regex_program(pattern, flags);
+  return std::unique_ptr<regex_program>(p);
+}
+
+regex_program::~regex_program()                          = default;
+regex_program::regex_program(regex_program&& other)      = default;
+regex_program& regex_program::operator=(regex_program&& other) = default;
+
+regex_program::regex_program(std::string_view pattern, regex_flags flags)
+  : _pattern(pattern),
+    _flags(flags),
+    _impl(std::make_unique<regex_program_impl>(detail::reprog::create_from(pattern, flags)))
+{
+}
+
+std::string regex_program::pattern() const { return _pattern; }
+
+regex_flags regex_program::flags() const { return _flags; }
+
+int32_t regex_program::instructions_count() const { return _impl->prog.insts_count(); }
+
+int32_t regex_program::groups_count() const { return _impl->prog.groups_count(); }
+
+}  // namespace strings
+}  // namespace cudf
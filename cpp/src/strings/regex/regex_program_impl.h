@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <strings/regex/regcomp.h>
+
+#include <cudf/strings/regex/regex_program.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace strings {
+
+namespace detail {
+class reprog_device;
+class redfa_device;
+}  // namespace detail
+
+using device_prog_ptr =
+  std::unique_ptr<detail::reprog_device, std::function<void(detail::reprog_device*)>>;
+using device_dfa_ptr =
+  std::unique_ptr<detail::redfa_device, std::function<void(detail::redfa_device*)>>;
+
+/**
+ * @brief Host side state of a regex_program
+ *
+ * Holds the compiled host program along with the device copies created from it.
+ */
+struct regex_program::regex_program_impl {
+  detail::reprog prog;  ///< Compiled host program
+
+  std::mutex mutex;                                                ///< Guards the members below
+  std::map<cudaStream_t, device_prog_ptr> d_progs;                 ///< Device programs per stream
+  std::map<bool, std::optional<detail::redfa>> dfas;               ///< Host DFAs by anchoring
+  std::map<std::pair<cudaStream_t, bool>, device_dfa_ptr> d_dfas;  ///< Device DFAs per stream
+
+  regex_program_impl(detail::reprog&& p) : prog(std::move(p)) {}
+};
+
+/**
+ * @brief Creates the device objects used to evaluate a regex_program
+ *
+ * The device copies are cached in the program per stream so they are created only once.
+ */
+struct regex_device_builder {
+  /**
+   * @brief Returns the device program of `p` for use on `stream`
+   *
+   * The returned object may be modified (e.g. `set_working_memory`) without affecting
+   * other callers of the same program.
+   *
+   * @param p Regex program
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Device program object
+   */
+  static device_prog_ptr create_prog_device(regex_program const& p, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the device DFA of `p` for use on `stream`
+   *
+   * @param p Regex program
+   * @param anchored True to match only at the beginning of each string
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Device DFA object or nullptr if the pattern cannot be evaluated with a DFA
+   */
+  static device_dfa_ptr create_dfa_device(regex_program const& p,
+                                          bool anchored,
+                                          rmm::cuda_stream_view stream);
+};
+
+}  // namespace strings
+}  // namespace cudf
@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <strings/regex/redfa.cuh>
 #include <strings/regex/regcomp.h>
 #include <strings/regex/regex.cuh>
+#include <strings/regex/regex_program_impl.h>
 
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/strings/detail/char_tables.hpp>
@@ -26,6 +28,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <mutex>
 #include <numeric>
 
 namespace cudf {
@@ -56,7 +59,12 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
 {
   // compile pattern into host object
   reprog h_prog = reprog::create_from(pattern, flags);
+  return reprog_device::create(h_prog, stream);
+}
 
+std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_device::create(
+  reprog& h_prog, rmm::cuda_stream_view stream)
+{
   // compute size to hold all the member data
   auto const insts_count   = h_prog.insts_count();
   auto const classes_count = h_prog.classes_count();
@@ -140,7 +148,7 @@ void reprog_device::destroy() { delete this; }
 
 std::size_t reprog_device::working_memory_size(int32_t num_threads) const
 {
-  return relist::alloc_size(_insts_count, num_threads) * 2;
+  return _relists_in_shmem ? 0 : relist::alloc_size(_insts_count, num_threads) * 2;
 }
 
 std::pair<std::size_t, int32_t> reprog_device::compute_strided_working_memory(
@@ -167,11 +175,111 @@ void reprog_device::set_working_memory(void* buffer, int32_t thread_count, int32
   _max_insts    = _max_insts > 0 ? _max_insts : _insts_count;
 }
 
-int32_t reprog_device::compute_shared_memory_size() const
+int32_t reprog_device::set_shared_memory(int32_t block_size)
 {
-  return _prog_size < MAX_SHARED_MEM ? static_cast<int32_t>(_prog_size) : 0;
+  int device;
+  int shmem_per_sm;
+  int shmem_per_block;
+  int shmem_reserved;
+  int threads_per_sm;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_per_sm, cudaDevAttrMaxSharedMemoryPerMultiprocessor, device));
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device));
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_reserved, cudaDevAttrReservedSharedMemoryPerBlock, device));
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&threads_per_sm, cudaDevAttrMaxThreadsPerMultiProcessor, device));
+
+  // shared memory of each block when the multiprocessor holds as many blocks as it has threads for
+  auto const blocks_per_sm = std::max(1, threads_per_sm / block_size);
+  auto const available     = static_cast<std::size_t>(
+    std::max(0, std::min(shmem_per_block, shmem_per_sm / blocks_per_sm - shmem_reserved)));
+
+  // Example: a 100 instruction program (~2KB) fits the ~20KB available to each of the 8 blocks of
+  // 256 threads resident on an A100, but its state data for 256 threads (~500KB) does not
+  auto const prog_size    = shared_prog_size();
+  auto const relists_size = relist::alloc_size(_max_insts, block_size) * 2;
+  _prog_in_shmem          = prog_size <= available;
+  _relists_in_shmem       = prog_size + relists_size <= available;
+
+  if (_relists_in_shmem) { return static_cast<int32_t>(prog_size + relists_size); }
+  return _prog_in_shmem ? static_cast<int32_t>(_prog_size) : 0;
+}
+
+std::unique_ptr<redfa_device, std::function<void(redfa_device*)>> redfa_device::create(
+  redfa const& dfa, rmm::cuda_stream_view stream)
+{
+  // flat buffer: [transitions][state flags][symbol classes]
+  auto const transitions_size = dfa.transitions.size() * sizeof(dfa.transitions[0]);
+  auto const flags_size       = dfa.state_flags.size();
+  auto const memsize          = transitions_size + flags_size + dfa.symbol_classes.size();
+
+  std::vector<u_char> h_buffer(memsize);
+  memcpy(h_buffer.data(), dfa.transitions.data(), transitions_size);
+  memcpy(h_buffer.data() + transitions_size, dfa.state_flags.data(), flags_size);
+  memcpy(h_buffer.data() + transitions_size + flags_size,
+         dfa.symbol_classes.data(),
+         dfa.symbol_classes.size());
+
+  auto d_buffer = new rmm::device_buffer(memsize, stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyHostToDevice, stream.value()));
+
+  auto d_ptr              = static_cast<u_char const*>(d_buffer->data());
+  auto d_dfa              = new redfa_device();
+  d_dfa->_classes_count   = dfa.classes_count;
+  d_dfa->_codepoint_flags = get_character_flags_table();
+  d_dfa->_transitions     = reinterpret_cast<int16_t const*>(d_ptr);
+  d_dfa->_state_flags     = d_ptr + transitions_size;
+  d_dfa->_symbol_classes  = d_ptr + transitions_size + flags_size;
+
+  // build deleter to cleanup device memory
+  auto deleter = [d_buffer](redfa_device* t) {
+    delete t;
+    delete d_buffer;
+  };
+  return std::unique_ptr<redfa_device, std::function<void(redfa_device*)>>(d_dfa, deleter);
 }
 
 }  // namespace detail
+
+device_prog_ptr regex_device_builder::create_prog_device(regex_program const& p,
+                                                         rmm::cuda_stream_view stream)
+{
+  auto& impl = *p._impl;
+  std::lock_guard<std::mutex> lock(impl.mutex);
+  auto itr = impl.d_progs.find(stream.value());
+  if (itr == impl.d_progs.end()) {
+    itr = impl.d_progs.emplace(stream.value(), detail::reprog_device::create(impl.prog, stream))
+            .first;
+  }
+  // callers get their own copy since they may set its working memory
+  return device_prog_ptr(new detail::reprog_device(*itr->second),
+                         [](detail::reprog_device* t) { t->destroy(); });
+}
+
+device_dfa_ptr regex_device_builder::create_dfa_device(regex_program const& p,
+                                                       bool anchored,
+                                                       rmm::cuda_stream_view stream)
+{
+  auto& impl = *p._impl;
+  std::lock_guard<std::mutex> lock(impl.mutex);
+  auto dfa = impl.dfas.find(anchored);
+  if (dfa == impl.dfas.end()) {
+    dfa = impl.dfas.emplace(anchored, impl.prog.create_dfa(anchored)).first;
+  }
+  if (!dfa->second.has_value()) { return nullptr; }
+
+  auto const key = std::make_pair(stream.value(), anchored);
+  auto itr       = impl.d_dfas.find(key);
+  if (itr == impl.d_dfas.end()) {
+    itr = impl.d_dfas.emplace(key, detail::redfa_device::create(dfa->second.value(), stream)).first;
+  }
+  return device_dfa_ptr(new detail::redfa_device(*itr->second),
+                        [](detail::redfa_device* t) { delete t; });
+}
+
 }  // namespace strings
 }  // namespace cudf
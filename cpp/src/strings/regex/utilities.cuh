@@ -18,10 +18,13 @@
 
 #include <strings/regex/regex.cuh>
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -34,6 +37,87 @@ namespace detail {
 
 constexpr auto regex_launch_kernel_block_size = 256;
 
+/**
+ * @brief Returns the offset of the positions of the matches of a string in the buffer created by
+ * `create_match_positions`.
+ *
+ * @param d_strings Strings column the regex is evaluated on
+ * @param idx Index of the string
+ */
+__device__ inline int64_t match_positions_offset(column_device_view const& d_strings,
+                                                 size_type idx)
+{
+  auto const d_offsets =
+    d_strings.child(strings_column_view::offsets_column_index).data<offset_type>() +
+    d_strings.offset();
+  return static_cast<int64_t>(d_offsets[idx] - d_offsets[0]) + idx;
+}
+
+/**
+ * @brief Returns the matches of a regex in a string in order, as found by `count_matches`.
+ *
+ * The matches are read from the positions recorded by `count_matches` if given, instead of
+ * evaluating the regex again.
+ */
+class match_reader {
+ public:
+  /**
+   * @brief Constructor for the matches of a non-null string.
+   *
+   * @param d_strings Strings column the regex is evaluated on
+   * @param idx Index of the string
+   * @param d_positions Match positions recorded by `count_matches`, or nullptr
+   * @param prog Regex to evaluate if no positions were recorded
+   * @param prog_idx Index of the working memory of the regex
+   */
+  __device__ match_reader(column_device_view const& d_strings,
+                          size_type idx,
+                          match_pair const* d_positions,
+                          reprog_device const& prog,
+                          int32_t prog_idx)
+    : d_str_{d_strings.element<string_view>(idx)},
+      d_matches_{d_positions ? d_positions + match_positions_offset(d_strings, idx) : nullptr},
+      prog_{prog},
+      prog_idx_{prog_idx},
+      nchars_{d_matches_ ? 0 : d_str_.length()}
+  {
+  }
+
+  /**
+   * @brief Returns the character positions of the next match, or nothing after the last match.
+   */
+  __device__ match_result next()
+  {
+    if (d_matches_) {
+      if (count_ > d_str_.size_bytes() || d_matches_[count_].first < 0) { return {}; }
+      return d_matches_[count_++];
+    }
+    if ((begin_ > nchars_) || (prog_.find(prog_idx_, d_str_, begin_, end_) <= 0)) {
+      begin_ = nchars_ + 1;  // no more matches
+      return {};
+    }
+    auto const match = match_pair{begin_, end_};
+    begin_           = end_ + (begin_ == end_);
+    end_             = -1;
+    return match;
+  }
+
+  /**
+   * @brief Returns the string the matches are read from.
+   */
+  [[nodiscard]] __device__ string_view const& string() const { return d_str_; }
+
+ private:
+  string_view const d_str_;
+  match_pair const* const d_matches_;
+  reprog_device const& prog_;
+  int32_t const prog_idx_;
+  size_type const nchars_;
+  size_type count_ = 0;  // matches read from d_matches_
+  size_type begin_ = 0;  // start of the next regex evaluation
+  size_type end_   = -1;
+};
+
 template <typename ForEachFunction>
 __global__ void for_each_kernel(ForEachFunction fn, reprog_device const d_prog, size_type size)
 {
@@ -55,12 +139,12 @@ void launch_for_each_kernel(ForEachFunction fn,
                             size_type size,
                             rmm::cuda_stream_view stream)
 {
+  auto const shmem_size = d_prog.set_shared_memory(regex_launch_kernel_block_size);
   auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(size);
 
   auto d_buffer = rmm::device_buffer(buffer_size, stream);
   d_prog.set_working_memory(d_buffer.data(), thread_count);
 
-  auto const shmem_size = d_prog.compute_shared_memory_size();
   cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
   for_each_kernel<<<grid.num_blocks, grid.num_threads_per_block, shmem_size, stream.value()>>>(
     fn, d_prog, size);
@@ -91,12 +175,12 @@ void launch_transform_kernel(TransformFunction fn,
                              size_type size,
                              rmm::cuda_stream_view stream)
 {
+  auto const shmem_size = d_prog.set_shared_memory(regex_launch_kernel_block_size);
   auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(size);
 
   auto d_buffer = rmm::device_buffer(buffer_size, stream);
   d_prog.set_working_memory(d_buffer.data(), thread_count);
 
-  auto const shmem_size = d_prog.compute_shared_memory_size();
   cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
   transform_kernel<<<grid.num_blocks, grid.num_threads_per_block, shmem_size, stream.value()>>>(
     fn, d_prog, d_output, size);
@@ -114,12 +198,12 @@ auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
   auto d_offsets             = offsets->mutable_view().template data<int32_t>();
   size_and_exec_fn.d_offsets = d_offsets;
 
+  auto const shmem_size = d_prog.set_shared_memory(regex_launch_kernel_block_size);
   auto [buffer_size, thread_count] = d_prog.compute_strided_working_memory(strings_count);
 
   auto d_buffer = rmm::device_buffer(buffer_size, stream);
   d_prog.set_working_memory(d_buffer.data(), thread_count);
-  auto const shmem_size = d_prog.compute_shared_memory_size();
-  cudf::detail::grid_1d grid{thread_count, 256};
+  cudf::detail::grid_1d grid{thread_count, regex_launch_kernel_block_size};
 
   // Compute the output size for each row
   if (strings_count > 0) {
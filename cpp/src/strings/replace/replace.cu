@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 
+#include <strings/search/aho_corasick.cuh>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/char_tables.hpp>
@@ -60,6 +63,15 @@ namespace {
  */
 constexpr size_type BYTES_PER_VALID_ROW_THRESHOLD = 64;
 
+/**
+ * @brief Row byte-length above which the character-level parallel algorithm is used regardless
+ * of the average row length.
+ *
+ * A thread scanning a row this long would stall the row-level parallel kernel even when most
+ * of the other rows are short.
+ */
+constexpr size_type LONG_ROW_BYTES_THRESHOLD = 16384;
+
 /**
  * @brief Function logic for the row-level parallelism replace API.
  *
@@ -72,6 +84,7 @@ struct replace_row_parallel_fn {
   int32_t const max_repl;
   int32_t* d_offsets{};
   char* d_chars{};
+  size_type* d_sizes{};  // output sizes when the strings are written in a single pass
 
   __device__ void operator()(size_type idx)
   {
@@ -100,10 +113,15 @@ struct replace_row_parallel_fn {
       position = d_str.find(d_target, position + d_target.size_bytes());
       --max_n;
     }
-    if (out_ptr)  // copy whats left (or right depending on your point of view)
+    if (out_ptr) {  // copy whats left (or right depending on your point of view)
       memcpy(out_ptr, in_ptr + last_pos, d_str.size_bytes() - last_pos);
-    else
+      if (d_sizes) {
+        d_sizes[idx] = static_cast<size_type>(out_ptr - (d_chars + d_offsets[idx])) +
+                       d_str.size_bytes() - last_pos;
+      }
+    } else {
       d_offsets[idx] = bytes;
+    }
   }
 };
 
@@ -527,10 +545,24 @@ std::unique_ptr<column> replace_row_parallel(strings_column_view const& strings,
                                              rmm::mr::device_memory_resource* mr)
 {
   auto d_strings = column_device_view::create(strings.parent(), stream);
+  auto fn        = replace_row_parallel_fn{*d_strings, d_target, d_repl, maxrepl};
+
+  // The output size of each string is bound by the number of targets that fit in it.
+  // Writing the strings in a single pass saves searching each string twice.
+  auto const d_offsets    = strings.offsets_begin();
+  auto const target_bytes = d_target.size_bytes();
+  auto const extra_bytes  = std::max(d_repl.size_bytes() - target_bytes, 0);
+  auto const bounds       = cudf::detail::make_counting_transform_iterator(
+    0, [d_offsets, target_bytes, extra_bytes, maxrepl] __device__(size_type idx) {
+      auto const bytes = d_offsets[idx + 1] - d_offsets[idx];
+      auto const count = bytes / target_bytes;
+      return static_cast<int64_t>(bytes) +
+             static_cast<int64_t>(extra_bytes) * ((maxrepl < 0) ? count : std::min(count, maxrepl));
+    });
 
   // this utility calls the given functor to build the offsets and chars columns
-  auto children = cudf::strings::detail::make_strings_children(
-    replace_row_parallel_fn{*d_strings, d_target, d_repl, maxrepl}, strings.size(), stream, mr);
+  auto children = cudf::strings::detail::make_strings_children_bounded(
+    fn, bounds, strings.size(), stream, mr);
 
   return make_strings_column(strings.size(),
                              std::move(children.first),
@@ -577,7 +609,10 @@ std::unique_ptr<column> replace<replace_algorithm::AUTO>(strings_column_view con
   size_type const chars_bytes = chars_end - chars_start;
 
   auto const avg_bytes_per_row = chars_bytes / std::max(strings_count - strings.null_count(), 1);
-  return (avg_bytes_per_row < BYTES_PER_VALID_ROW_THRESHOLD)
+  auto const row_parallel =
+    (avg_bytes_per_row < BYTES_PER_VALID_ROW_THRESHOLD) &&
+    get_long_string_indices(strings, LONG_ROW_BYTES_THRESHOLD, stream).is_empty();
+  return row_parallel
            ? replace_row_parallel(strings, d_target, d_repl, maxrepl, stream, mr)
            : replace_char_parallel(
                strings, chars_start, chars_end, d_target, d_repl, maxrepl, stream, mr);
@@ -709,10 +744,14 @@ namespace {
  * @brief Function logic for the replace_multi API.
  *
  * This will perform the multi-replace operation on each string.
+ *
+ * The targets are found with a single pass over the string using their automaton. The match
+ * with the smallest position is replaced first and ties are resolved by the order of the
+ * targets. The search then resumes after the replaced target.
  */
 struct replace_multi_fn {
   column_device_view const d_strings;
-  column_device_view const d_targets;
+  aho_corasick_device const d_targets;
   column_device_view const d_repls;
   int32_t* d_offsets{};
   char* d_chars{};
@@ -731,26 +770,40 @@ struct replace_multi_fn {
     size_type lpos  = 0;
     char* out_ptr   = d_chars ? d_chars + d_offsets[idx] : nullptr;
 
-    // check each character against each target
+    int32_t state = 0;
+
+    // best target found so far along with its position and size
+    int32_t match_tgt = -1;
+    size_type match_pos{0};
+    size_type match_size{0};
     while (spos < d_str.size_bytes()) {
-      for (int tgt_idx = 0; tgt_idx < d_targets.size(); ++tgt_idx) {
-        auto const d_tgt = d_targets.element<string_view>(tgt_idx);
-        if ((d_tgt.size_bytes() <= (d_str.size_bytes() - spos)) &&    // check fit
-            (d_tgt.compare(in_ptr + spos, d_tgt.size_bytes()) == 0))  // and match
-        {
-          auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
-                                                    : d_repls.element<string_view>(tgt_idx);
-          bytes += d_repl.size_bytes() - d_tgt.size_bytes();
-          if (out_ptr) {
-            out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, spos - lpos);
-            out_ptr = copy_string(out_ptr, d_repl);
-            lpos    = spos + d_tgt.size_bytes();
-          }
-          spos += d_tgt.size_bytes() - 1;
-          break;
+      state = d_targets.next_state(state, static_cast<uint8_t>(in_ptr[spos]));
+      d_targets.for_each_match(state, [&](auto tgt_idx, auto size, auto) {
+        auto const pos = spos + 1 - size;
+        if (match_tgt < 0 || pos < match_pos || (pos == match_pos && tgt_idx < match_tgt)) {
+          match_tgt  = tgt_idx;
+          match_pos  = pos;
+          match_size = size;
         }
-      }
+      });
       ++spos;
+      // no target found later can start at or before the best match
+      if (match_tgt < 0 ||
+          ((match_pos + d_targets.max_target_size() > spos) && (spos < d_str.size_bytes()))) {
+        continue;
+      }
+      auto const d_repl = (d_repls.size() == 1) ? d_repls.element<string_view>(0)
+                                                : d_repls.element<string_view>(match_tgt);
+      bytes += d_repl.size_bytes() - match_size;
+      if (out_ptr) {
+        out_ptr = copy_and_increment(out_ptr, in_ptr + lpos, match_pos - lpos);
+        out_ptr = copy_string(out_ptr, d_repl);
+      }
+      // restart the search after the replaced target
+      lpos      = match_pos + match_size;
+      spos      = lpos;
+      state     = 0;
+      match_tgt = -1;
     }
     if (out_ptr)  // copy remainder
       memcpy(out_ptr, in_ptr + lpos, d_str.size_bytes() - lpos);
@@ -776,7 +829,7 @@ std::unique_ptr<column> replace(strings_column_view const& strings,
     CUDF_EXPECTS(repls.size() == targets.size(), "Sizes for targets and repls must match");
 
   auto d_strings = column_device_view::create(strings.parent(), stream);
-  auto d_targets = column_device_view::create(targets.parent(), stream);
+  auto d_targets = aho_corasick_device::create(targets, stream);
   auto d_repls   = column_device_view::create(repls.parent(), stream);
 
   // this utility calls the given functor to build the offsets and chars columns
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <strings/search/aho_corasick.cuh>
+
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+std::unique_ptr<aho_corasick_device, std::function<void(aho_corasick_device*)>>
+aho_corasick_device::create(strings_column_view const& targets, rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  auto const h_offsets = cudf::detail::make_std_vector_sync(
+    device_span<offset_type const>(targets.offsets_begin(), targets.size() + 1), stream);
+  auto const h_chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(targets.chars_begin() + h_offsets.front(),
+                            h_offsets.back() - h_offsets.front()),
+    stream);
+
+  // build the trie; state 0 is the root
+  std::vector<std::map<uint8_t, int32_t>> children(1);
+  std::vector<std::vector<int32_t>> outputs(1);
+  std::vector<size_type> sizes(1, 0);
+  std::vector<size_type> lengths(1, 0);
+  size_type max_target_size = 0;
+  for (size_type idx = 0; idx < targets.size(); ++idx) {
+    auto const begin = h_chars.data() + (h_offsets[idx] - h_offsets.front());
+    auto const size  = h_offsets[idx + 1] - h_offsets[idx];
+    if (size == 0) { continue; }
+    int32_t state = 0;
+    for (size_type pos = 0; pos < size; ++pos) {
+      auto const byte = static_cast<uint8_t>(begin[pos]);
+      auto const next = children[state].find(byte);
+      if (next != children[state].end()) {
+        state = next->second;
+        continue;
+      }
+      auto const child = static_cast<int32_t>(children.size());
+      children[state].emplace(byte, child);
+      children.emplace_back();
+      outputs.emplace_back();
+      sizes.push_back(pos + 1);
+      // count characters by their leading bytes
+      lengths.push_back(lengths[state] + ((byte & 0xC0) != 0x80));
+      state = child;
+    }
+    outputs[state].push_back(idx);
+    max_target_size = std::max(max_target_size, size);
+  }
+  auto const states_count = static_cast<int32_t>(children.size());
+
+  // compute the failure and dictionary links in breadth-first order
+  std::vector<int32_t> fail(states_count, 0);
+  std::vector<int32_t> dict(states_count, 0);
+  std::queue<int32_t> queue;
+  for (auto const& [byte, child] : children[0]) {
+    queue.push(child);
+  }
+  while (!queue.empty()) {
+    auto const state = queue.front();
+    queue.pop();
+    for (auto const& [byte, child] : children[state]) {
+      auto suffix = fail[state];
+      while (suffix > 0 && children[suffix].count(byte) == 0) {
+        suffix = fail[suffix];
+      }
+      auto const next = children[suffix].find(byte);
+      fail[child]     = next != children[suffix].end() ? next->second : 0;
+      dict[child]     = outputs[fail[child]].empty() ? dict[fail[child]] : fail[child];
+      queue.push(child);
+    }
+  }
+
+  // flatten into [edge offsets][edge states][fail][dict][output offsets][outputs][sizes]
+  // [lengths][edge bytes]
+  std::vector<int32_t> h_data(states_count + 1);
+  std::vector<uint8_t> h_edge_bytes;
+  for (int32_t state = 0; state < states_count; ++state) {
+    h_data[state + 1] = h_data[state] + static_cast<int32_t>(children[state].size());
+  }
+  auto const edges_count = h_data.back();
+  for (int32_t state = 0; state < states_count; ++state) {
+    for (auto const& [byte, child] : children[state]) {
+      h_data.push_back(child);
+      h_edge_bytes.push_back(byte);
+    }
+  }
+  h_data.insert(h_data.end(), fail.begin(), fail.end());
+  h_data.insert(h_data.end(), dict.begin(), dict.end());
+  auto const output_offsets = h_data.size();
+  h_data.push_back(0);
+  for (int32_t state = 0; state < states_count; ++state) {
+    h_data.push_back(h_data.back() + static_cast<int32_t>(outputs[state].size()));
+  }
+  auto const outputs_count = h_data.back();
+  for (auto const& out : outputs) {
+    h_data.insert(h_data.end(), out.begin(), out.end());
+  }
+  h_data.insert(h_data.end(), sizes.begin(), sizes.end());
+  h_data.insert(h_data.end(), lengths.begin(), lengths.end());
+
+  auto const data_size = h_data.size() * sizeof(int32_t);
+  auto d_buffer        = new rmm::device_buffer(data_size + h_edge_bytes.size(), stream);
+  auto const d_data    = static_cast<int32_t*>(d_buffer->data());
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    d_data, h_data.data(), data_size, cudaMemcpyHostToDevice, stream.value()));
+  CUDF_CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<uint8_t*>(d_data) + data_size,
+                                h_edge_bytes.data(),
+                                h_edge_bytes.size(),
+                                cudaMemcpyHostToDevice,
+                                stream.value()));
+
+  auto d_automaton              = new aho_corasick_device();
+  d_automaton->_max_target_size = max_target_size;
+  d_automaton->_edge_offsets    = d_data;
+  d_automaton->_edge_states     = d_data + states_count + 1;
+  d_automaton->_fail            = d_automaton->_edge_states + edges_count;
+  d_automaton->_dict            = d_automaton->_fail + states_count;
+  d_automaton->_output_offsets  = d_data + output_offsets;
+  d_automaton->_outputs         = d_automaton->_output_offsets + states_count + 1;
+  d_automaton->_sizes           = d_automaton->_outputs + outputs_count;
+  d_automaton->_lengths         = d_automaton->_sizes + states_count;
+  d_automaton->_edge_bytes      = reinterpret_cast<uint8_t const*>(d_data) + data_size;
+
+  // build deleter to cleanup device memory
+  auto deleter = [d_buffer](aho_corasick_device* t) {
+    delete t;
+    delete d_buffer;
+  };
+  return std::unique_ptr<aho_corasick_device, std::function<void(aho_corasick_device*)>>(
+    d_automaton, deleter);
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
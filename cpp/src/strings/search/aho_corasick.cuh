@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Aho-Corasick automaton for finding all of a set of target strings in a single pass
+ * over each string.
+ *
+ * The automaton is a trie of the target strings where each node is a state. A state also has a
+ * failure link to the state of its longest proper suffix in the trie and a dictionary link to
+ * the nearest state along the failure links that ends a target. Evaluating a string is a
+ * single transition per byte, so the work is proportional to the string size plus the number
+ * of matches rather than to the number of targets.
+ *
+ * Empty targets are not added to the automaton and therefore never reported.
+ */
+class aho_corasick_device {
+ public:
+  /**
+   * @brief Builds the automaton for the given targets and copies it to the device.
+   *
+   * @param targets Strings to search for; must not contain nulls
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The automaton device object
+   */
+  static std::unique_ptr<aho_corasick_device, std::function<void(aho_corasick_device*)>> create(
+    strings_column_view const& targets, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Returns the size in bytes of the longest target.
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE size_type max_target_size() const { return _max_target_size; }
+
+  /**
+   * @brief Returns the state reached from `state` after consuming `byte`.
+   *
+   * The initial state is 0.
+   */
+  [[nodiscard]] __device__ inline int32_t next_state(int32_t state, uint8_t byte) const
+  {
+    while (true) {
+      // edges of each state are sorted by byte
+      auto begin = _edge_offsets[state];
+      auto end   = _edge_offsets[state + 1];
+      while (begin < end) {
+        auto const mid = begin + (end - begin) / 2;
+        if (_edge_bytes[mid] < byte) {
+          begin = mid + 1;
+        } else {
+          end = mid;
+        }
+      }
+      if (begin < _edge_offsets[state + 1] && _edge_bytes[begin] == byte) {
+        return _edge_states[begin];
+      }
+      if (state == 0) { return 0; }
+      state = _fail[state];
+    }
+  }
+
+  /**
+   * @brief Calls `fn(target_index, size_bytes, length)` for every target ending at `state`.
+   *
+   * Targets ending at the same state are reported in ascending index order. Longer targets
+   * are reported before shorter ones.
+   */
+  template <typename Fn>
+  __device__ inline void for_each_match(int32_t state, Fn fn) const
+  {
+    if (_output_offsets[state] == _output_offsets[state + 1]) { state = _dict[state]; }
+    while (state > 0) {
+      for (auto idx = _output_offsets[state]; idx < _output_offsets[state + 1]; ++idx) {
+        fn(_outputs[idx], _sizes[state], _lengths[state]);
+      }
+      state = _dict[state];
+    }
+  }
+
+ private:
+  aho_corasick_device() = default;
+
+  size_type _max_target_size{};      // size in bytes of the longest target
+  int32_t const* _edge_offsets{};    // edges of each state
+  int32_t const* _edge_states{};     // target state of each edge
+  int32_t const* _fail{};            // longest proper suffix state of each state
+  int32_t const* _dict{};            // nearest state along the failure links with outputs
+  int32_t const* _output_offsets{};  // outputs of each state
+  int32_t const* _outputs{};         // indices of the targets ending at each state
+  size_type const* _sizes{};         // size in bytes of the string of each state
+  size_type const* _lengths{};       // number of characters of the string of each state
+  uint8_t const* _edge_bytes{};      // byte of each edge
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -21,6 +21,7 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/find.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -35,12 +36,169 @@
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/replace.h>
 #include <thrust/transform.h>
 
+#include <limits>
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
 namespace {
+
+/**
+ * @brief Threshold to decide on searching a string with a single thread or a block of threads.
+ *
+ * Rows with more bytes than this are searched by `THREADS_PER_LONG_STRING` threads so that a
+ * few long strings in a column of short strings do not stall the whole kernel.
+ */
+constexpr size_type LONG_STRING_THRESHOLD = 16384;
+
+/**
+ * @brief Number of threads searching each long string.
+ */
+constexpr size_type THREADS_PER_LONG_STRING = 256;
+
+/**
+ * @brief Find the first or last byte position of `d_target` in the long rows of `d_strings`.
+ *
+ * This executes as `THREADS_PER_LONG_STRING` threads per string. Each thread checks every
+ * `THREADS_PER_LONG_STRING`-th byte position and the first (or last) position found by any
+ * of the threads is kept.
+ */
+struct find_long_fn {
+  column_device_view const d_strings;
+  string_view const d_target;
+  size_type const* d_indices;
+  bool const forward;
+  size_type* d_positions;  // initialized to `max()` if forward and -1 otherwise
+
+  __device__ void operator()(std::size_t idx) const
+  {
+    auto const row     = static_cast<size_type>(idx / THREADS_PER_LONG_STRING);
+    auto const str_idx = d_indices[row];
+    if (d_strings.is_null(str_idx)) { return; }
+    auto const d_str = d_strings.element<string_view>(str_idx);
+    auto const last  = d_str.size_bytes() - d_target.size_bytes();
+    auto const tid   = static_cast<size_type>(idx % THREADS_PER_LONG_STRING);
+    if (tid > last) { return; }
+
+    auto const is_match = [&](size_type pos) {
+      return d_target.compare(d_str.data() + pos, d_target.size_bytes()) == 0;
+    };
+    if (forward) {
+      for (auto pos = tid; pos <= last; pos += THREADS_PER_LONG_STRING) {
+        if (is_match(pos)) {
+          atomicMin(d_positions + row, pos);
+          return;
+        }
+      }
+    } else {
+      for (auto pos = last - ((last - tid) % THREADS_PER_LONG_STRING); pos >= 0;
+           pos -= THREADS_PER_LONG_STRING) {
+        if (is_match(pos)) {
+          atomicMax(d_positions + row, pos);
+          return;
+        }
+      }
+    }
+  }
+};
+
+/**
+ * @brief Count the characters before the byte position found in each long string.
+ *
+ * This executes as `THREADS_PER_LONG_STRING` threads per string and accumulates into
+ * `d_results` which is initialized to 0 for the strings where the target was found.
+ */
+struct count_long_fn {
+  column_device_view const d_strings;
+  size_type const* d_indices;
+  size_type const* d_positions;
+  int32_t* d_results;
+
+  __device__ void operator()(std::size_t idx) const
+  {
+    auto const row      = static_cast<size_type>(idx / THREADS_PER_LONG_STRING);
+    auto const position = d_positions[row];
+    if (position < 0) { return; }
+    auto const str_idx = d_indices[row];
+    auto const d_str   = d_strings.element<string_view>(str_idx);
+    size_type count    = 0;
+    for (auto pos = static_cast<size_type>(idx % THREADS_PER_LONG_STRING); pos < position;
+         pos += THREADS_PER_LONG_STRING) {
+      count += is_begin_utf8_char(static_cast<uint8_t>(d_str.data()[pos]));
+    }
+    if (count > 0) { atomicAdd(d_results + str_idx, count); }
+  }
+};
+
+/**
+ * @brief Search for `d_target` in each long row of `input` using a block of threads per row.
+ *
+ * @param input Strings column to search
+ * @param d_strings Device view of `input`
+ * @param d_target Non-empty string to search for
+ * @param forward True to find the first position and false to find the last position
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The indices of the long rows and the byte position of `d_target` in each of them
+ *         or -1 if it is not found
+ */
+std::pair<rmm::device_uvector<size_type>, rmm::device_uvector<size_type>> find_long_strings(
+  strings_column_view const& input,
+  column_device_view const& d_strings,
+  string_view const d_target,
+  bool forward,
+  rmm::cuda_stream_view stream)
+{
+  auto indices = get_long_string_indices(input, LONG_STRING_THRESHOLD, stream);
+  auto const count = static_cast<size_type>(indices.size());
+  auto positions   = rmm::device_uvector<size_type>(count, stream);
+  if (count == 0) { return std::make_pair(std::move(indices), std::move(positions)); }
+
+  auto constexpr not_found = std::numeric_limits<size_type>::max();
+  thrust::fill(
+    rmm::exec_policy(stream), positions.begin(), positions.end(), forward ? not_found : -1);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<std::size_t>(0),
+    static_cast<std::size_t>(count) * THREADS_PER_LONG_STRING,
+    find_long_fn{d_strings, d_target, indices.data(), forward, positions.data()});
+  if (forward) {
+    thrust::replace(rmm::exec_policy(stream), positions.begin(), positions.end(), not_found, -1);
+  }
+  return std::make_pair(std::move(indices), std::move(positions));
+}
+
+/**
+ * @brief Returns the character position of `d_target` in each string or -1 for null strings.
+ *
+ * Strings longer than `LONG_STRING_THRESHOLD` bytes also return -1 if `search_long` is true
+ * since they are searched by `find_long_strings`.
+ *
+ * @tparam FindFunction Returns integer character position value given a string and target.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
+ */
+template <typename FindFunction, typename Nullate>
+struct find_position_fn {
+  column_device_view const d_strings;
+  Nullate const has_nulls;
+  FindFunction const pfn;
+  string_view const d_target;
+  size_type const start;
+  size_type const stop;
+  bool const search_long;
+
+  __device__ int32_t operator()(size_type idx) const
+  {
+    if (has_nulls && d_strings.is_null_nocheck(idx)) { return -1; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    if (search_long && d_str.size_bytes() > LONG_STRING_THRESHOLD) { return -1; }
+    return static_cast<int32_t>(pfn(d_str, d_target, start, stop));
+  }
+};
+
 /**
  * @brief Utility to return integer column indicating the position of
  * target string within each string in a strings column.
@@ -54,6 +212,7 @@ namespace {
  * @param start First character position to start the search.
  * @param stop Last character position (exclusive) to end the search.
  * @param pfn Functor used for locating `target` in each string.
+ * @param forward True if `pfn` locates the first occurrence and false if it locates the last.
  * @param stream CUDA stream used for device memory operations and kernel launches.
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return New integer column with character position values.
@@ -64,6 +223,7 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                 size_type start,
                                 size_type stop,
                                 FindFunction& pfn,
+                                bool forward,
                                 rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
@@ -84,18 +244,44 @@ std::unique_ptr<column> find_fn(strings_column_view const& strings,
                                      mr);
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<int32_t>();
+  // long strings are searched separately when the whole string is searched
+  auto const search_long = (target.size() > 0) && (start == 0) && (stop < 0);
   // set the position values by evaluating the passed function
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(strings_count),
-                    d_results,
-                    [d_strings, pfn, d_target, start, stop] __device__(size_type idx) {
-                      int32_t position = -1;
-                      if (!d_strings.is_null(idx))
-                        position = static_cast<int32_t>(
-                          pfn(d_strings.element<string_view>(idx), d_target, start, stop));
-                      return position;
-                    });
+  auto const find_positions = [&](auto const has_nulls) {
+    using Nullate = std::decay_t<decltype(has_nulls)>;
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(strings_count),
+                      d_results,
+                      find_position_fn<FindFunction, Nullate>{
+                        d_strings, has_nulls, pfn, d_target, start, stop, search_long});
+  };
+  if (strings.has_nulls()) {
+    find_positions(nullate::YES{});
+  } else {
+    find_positions(nullate::NO{});
+  }
+
+  if (search_long) {
+    auto const [indices, positions] =
+      find_long_strings(strings, d_strings, d_target, forward, stream);
+    if (!indices.is_empty()) {
+      // convert the byte positions into character positions
+      thrust::for_each_n(rmm::exec_policy(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         static_cast<size_type>(indices.size()),
+                         [d_indices   = indices.data(),
+                          d_positions = positions.data(),
+                          d_results] __device__(size_type row) {
+                           d_results[d_indices[row]] = d_positions[row] < 0 ? -1 : 0;
+                         });
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<std::size_t>(0),
+        indices.size() * THREADS_PER_LONG_STRING,
+        count_long_fn{d_strings, indices.data(), positions.data(), d_results});
+    }
+  }
   results->set_null_count(strings.null_count());
   return results;
 }
@@ -119,7 +305,7 @@ std::unique_ptr<column> find(
     return d_string.find(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn(strings, target, start, stop, pfn, true, stream, mr);
 }
 
 std::unique_ptr<column> rfind(
@@ -139,7 +325,7 @@ std::unique_ptr<column> rfind(
     return d_string.rfind(d_target, begin, end - begin);
   };
 
-  return find_fn(strings, target, start, stop, pfn, stream, mr);
+  return find_fn(strings, target, start, stop, pfn, false, stream, mr);
 }
 
 }  // namespace detail
@@ -184,22 +370,28 @@ constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 64;
  * @brief Check if `d_target` appears in a row in `d_strings`.
  *
  * This executes as a warp per string/row.
+ *
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
  */
+template <typename Nullate>
 struct contains_warp_fn {
   column_device_view const d_strings;
+  Nullate const has_nulls;
   string_view const d_target;
   bool* d_results;
 
   __device__ void operator()(std::size_t idx)
   {
     auto const str_idx = static_cast<size_type>(idx / cudf::detail::warp_size);
-    if (d_strings.is_null(str_idx)) { return; }
+    if (has_nulls && d_strings.is_null_nocheck(str_idx)) { return; }
     // get the string for this warp
     auto const d_str = d_strings.element<string_view>(str_idx);
+    // long strings are checked by `contains_long_strings`
+    if (d_str.size_bytes() > LONG_STRING_THRESHOLD) { return; }
     // each thread of the warp will check just part of the string
     auto found = false;
     for (auto i = static_cast<size_type>(idx % cudf::detail::warp_size);
-         !found && (i + d_target.size_bytes()) < d_str.size_bytes();
+         !found && (i + d_target.size_bytes()) <= d_str.size_bytes();
          i += cudf::detail::warp_size) {
       // check the target matches this part of the d_str data
       if (d_target.compare(d_str.data() + i, d_target.size_bytes()) == 0) { found = true; }
@@ -233,16 +425,69 @@ std::unique_ptr<column> contains_warp_parallel(strings_column_view const& input,
 
   if (!d_target.empty()) {
     // launch warp per string
-    auto d_strings = column_device_view::create(input.parent(), stream);
-    thrust::for_each_n(rmm::exec_policy(stream),
-                       thrust::make_counting_iterator<std::size_t>(0),
-                       static_cast<std::size_t>(input.size()) * cudf::detail::warp_size,
-                       contains_warp_fn{*d_strings, d_target, results_view.data<bool>()});
+    auto d_strings        = column_device_view::create(input.parent(), stream);
+    auto const find_warps = [&](auto const has_nulls) {
+      using Nullate = std::decay_t<decltype(has_nulls)>;
+      thrust::for_each_n(
+        rmm::exec_policy(stream),
+        thrust::make_counting_iterator<std::size_t>(0),
+        static_cast<std::size_t>(input.size()) * cudf::detail::warp_size,
+        contains_warp_fn<Nullate>{*d_strings, has_nulls, d_target, results_view.data<bool>()});
+    };
+    if (input.has_nulls()) {
+      find_warps(nullate::YES{});
+    } else {
+      find_warps(nullate::NO{});
+    }
   }
   results->set_null_count(input.null_count());
   return results;
 }
 
+/**
+ * @brief Set the output for each long string in `input` that contains `target`.
+ *
+ * The long strings are searched with a block of threads per string.
+ * This is a no-op if `target` is empty since those rows are already true.
+ */
+void contains_long_strings(strings_column_view const& input,
+                           string_scalar const& target,
+                           bool* d_results,
+                           rmm::cuda_stream_view stream)
+{
+  if (input.is_empty() || target.size() == 0) { return; }
+  auto d_strings = column_device_view::create(input.parent(), stream);
+  auto d_target  = string_view(target.data(), target.size());
+  auto const [indices, positions] =
+    find_long_strings(input, *d_strings, d_target, true, stream);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    static_cast<size_type>(indices.size()),
+    [d_indices = indices.data(), d_positions = positions.data(), d_results] __device__(
+      size_type row) { d_results[d_indices[row]] = d_positions[row] >= 0; });
+}
+
+/**
+ * @brief Returns `pfn` of each string and `d_target`, or false for null strings.
+ *
+ * @tparam BoolFunction Return bool value given two strings.
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls.
+ */
+template <typename BoolFunction, typename Nullate>
+struct contains_scalar_fn {
+  column_device_view const d_strings;
+  Nullate const has_nulls;
+  BoolFunction const pfn;
+  string_view const d_target;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    if (has_nulls && d_strings.is_null_nocheck(idx)) { return false; }
+    return bool{pfn(d_strings.element<string_view>(idx), d_target)};
+  }
+};
+
 /**
  * @brief Utility to return a bool column indicating the presence of
  * a given target string in a strings column.
@@ -291,15 +536,20 @@ std::unique_ptr<column> contains_fn(strings_column_view const& strings,
   auto results_view = results->mutable_view();
   auto d_results    = results_view.data<bool>();
   // set the bool values by evaluating the passed function
-  thrust::transform(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator<size_type>(0),
-                    thrust::make_counting_iterator<size_type>(strings_count),
-                    d_results,
-                    [d_strings, pfn, d_target] __device__(size_type idx) {
-                      if (!d_strings.is_null(idx))
-                        return bool{pfn(d_strings.element<string_view>(idx), d_target)};
-                      return false;
-                    });
+  auto const check_strings = [&](auto const has_nulls) {
+    using Nullate = std::decay_t<decltype(has_nulls)>;
+    thrust::transform(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(strings_count),
+      d_results,
+      contains_scalar_fn<BoolFunction, Nullate>{d_strings, has_nulls, pfn, d_target});
+  };
+  if (strings.has_nulls()) {
+    check_strings(nullate::YES{});
+  } else {
+    check_strings(nullate::NO{});
+  }
   results->set_null_count(strings.null_count());
   return results;
 }
@@ -373,15 +623,22 @@ std::unique_ptr<column> contains(
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
   // use warp parallel when the average string width is greater than the threshold
-  if (!input.is_empty() && ((input.chars_size() / input.size()) > AVG_CHAR_BYTES_THRESHOLD)) {
-    return contains_warp_parallel(input, target, stream, mr);
-  }
-
-  // benchmark measurements showed this to be faster for smaller strings
-  auto pfn = [] __device__(string_view d_string, string_view d_target) {
-    return d_string.find(d_target) != string_view::npos;
-  };
-  return contains_fn(input, target, pfn, stream, mr);
+  auto results = [&] {
+    if (!input.is_empty() && ((input.chars_size() / input.size()) > AVG_CHAR_BYTES_THRESHOLD)) {
+      return contains_warp_parallel(input, target, stream, mr);
+    }
+    // benchmark measurements showed this to be faster for smaller strings
+    auto pfn = [] __device__(string_view d_string, string_view d_target) {
+      // long strings are checked by `contains_long_strings`
+      if (d_string.size_bytes() > LONG_STRING_THRESHOLD) { return false; }
+      return d_string.find(d_target) != string_view::npos;
+    };
+    return contains_fn(input, target, pfn, stream, mr);
+  }();
+
+  // a few long strings would otherwise dominate the run time of the functions above
+  contains_long_strings(input, target, results->mutable_view().data<bool>(), stream);
+  return results;
 }
 
 std::unique_ptr<column> contains(
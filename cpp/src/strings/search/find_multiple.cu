@@ -14,26 +14,96 @@
  * limitations under the License.
  */
 
+#include <strings/search/aho_corasick.cuh>
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
+namespace {
+
+/**
+ * @brief Finds every target in each string using the automaton of the targets.
+ *
+ * Each call records the character position of the first occurrence of each target found
+ * in the string. The output is expected to be initialized for targets that are not found.
+ */
+struct find_multiple_fn {
+  column_device_view const d_strings;
+  aho_corasick_device const d_automaton;
+  size_type const targets_count;
+  size_type* d_results;
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const d_out = d_results + (static_cast<std::size_t>(idx) * targets_count);
+    auto const bytes = d_str.data();
+
+    int32_t state = 0;
+    size_type chars{0};  // number of characters up to and including the current byte
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      auto const byte = static_cast<uint8_t>(bytes[pos]);
+      chars += is_begin_utf8_char(byte);
+      state = d_automaton.next_state(state, byte);
+      d_automaton.for_each_match(state, [&](auto target, auto, auto length) {
+        if (d_out[target] < 0) { d_out[target] = chars - length; }
+      });
+    }
+  }
+};
+
+/**
+ * @brief Sets the output of each string to true for each target found in it.
+ */
+struct contains_multiple_fn {
+  column_device_view const d_strings;
+  aho_corasick_device const d_automaton;
+  bool** d_results;
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const bytes = d_str.data();
+
+    int32_t state = 0;
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      state = d_automaton.next_state(state, static_cast<uint8_t>(bytes[pos]));
+      d_automaton.for_each_match(
+        state, [&](auto target, auto, auto) { d_results[target][idx] = true; });
+    }
+  }
+};
+
+}  // namespace
+
 std::unique_ptr<column> find_multiple(
   strings_column_view const& input,
   strings_column_view const& targets,
@@ -55,19 +125,27 @@ std::unique_ptr<column> find_multiple(
   // create output column
   auto results = make_numeric_column(
     data_type{type_id::INT32}, total_count, rmm::device_buffer{0, stream, mr}, 0, stream, mr);
+  auto d_results = results->mutable_view().begin<int32_t>();
 
-  // fill output column with position values
+  // empty targets are found at position 0 of every non-null string; all others are not found
+  // until the search below finds them
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<size_type>(0),
                     thrust::make_counting_iterator<size_type>(total_count),
-                    results->mutable_view().begin<int32_t>(),
+                    d_results,
                     [d_strings, d_targets, targets_count] __device__(size_type idx) {
                       size_type str_idx = idx / targets_count;
                       if (d_strings.is_null(str_idx)) return -1;
-                      string_view d_str = d_strings.element<string_view>(str_idx);
                       string_view d_tgt = d_targets.element<string_view>(idx % targets_count);
-                      return d_str.find(d_tgt);
+                      return d_tgt.empty() ? 0 : -1;
                     });
+
+  // search for all the targets in a single pass over each string
+  auto const d_automaton = aho_corasick_device::create(targets, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     find_multiple_fn{d_strings, *d_automaton, targets_count, d_results});
   results->set_null_count(0);
 
   auto offsets = cudf::detail::sequence(strings_count + 1,
@@ -84,6 +162,48 @@ std::unique_ptr<column> find_multiple(
                            mr);
 }
 
+std::unique_ptr<table> contains_multiple(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  auto const strings_count = input.size();
+  auto const targets_count = targets.size();
+  CUDF_EXPECTS(targets_count > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  auto const h_offsets = cudf::detail::make_std_vector_sync(
+    device_span<offset_type const>(targets.offsets_begin(), targets_count + 1), stream);
+
+  std::vector<std::unique_ptr<column>> results(targets_count);
+  std::vector<bool*> h_results(targets_count);
+  for (size_type idx = 0; idx < targets_count; ++idx) {
+    results[idx] = make_numeric_column(data_type{type_id::BOOL8},
+                                       strings_count,
+                                       cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                       input.null_count(),
+                                       stream,
+                                       mr);
+
+    // empty targets are found in every string; all others are false until found below
+    h_results[idx]      = results[idx]->mutable_view().data<bool>();
+    auto const is_empty = h_offsets[idx + 1] == h_offsets[idx];
+    thrust::fill_n(rmm::exec_policy(stream), h_results[idx], strings_count, is_empty);
+  }
+  if (strings_count == 0) { return std::make_unique<table>(std::move(results)); }
+
+  auto const d_results   = cudf::detail::make_device_uvector_async(h_results, stream);
+  auto const d_strings   = column_device_view::create(input.parent(), stream);
+  auto const d_automaton = aho_corasick_device::create(targets, stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     strings_count,
+                     contains_multiple_fn{*d_strings, *d_automaton, d_results.data()});
+
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external API
@@ -95,5 +215,13 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
   return detail::find_multiple(input, targets, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<table> contains_multiple(strings_column_view const& input,
+                                         strings_column_view const& targets,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_multiple(input, targets, cudf::default_stream_value, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
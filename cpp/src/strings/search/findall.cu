@@ -15,6 +15,7 @@
  */
 
 #include <strings/count_matches.hpp>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/regex/utilities.cuh>
 
 #include <cudf/column/column.hpp>
@@ -24,6 +25,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/findall.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -56,8 +58,9 @@ namespace {
  */
 struct findall_fn {
   column_device_view const d_strings;
-  size_type const* d_counts;  ///< match counts for each string
-  indices_span d_indices;     ///< 2D-span: output matches added here
+  size_type const* d_counts;      ///< match counts for each string
+  match_pair const* d_positions;  ///< match positions recorded by count_matches, if any
+  indices_span d_indices;         ///< 2D-span: output matches added here
 
   __device__ void operator()(size_type const idx, reprog_device const prog, int32_t const prog_idx)
   {
@@ -66,20 +69,16 @@ struct findall_fn {
     auto d_output = d_indices[idx];
 
     if (d_strings.is_valid(idx)) {
-      auto const d_str  = d_strings.element<string_view>(idx);
-      auto const nchars = d_str.length();
+      match_reader matches(d_strings, idx, d_positions, prog, prog_idx);
+      auto const& d_str = matches.string();
 
-      int32_t begin = 0;
-      int32_t end   = -1;
       for (auto col_idx = 0; col_idx < match_count; ++col_idx) {
-        if (prog.find(prog_idx, d_str, begin, end) > 0) {
-          auto const begin_offset = d_str.byte_offset(begin);
-          auto const end_offset   = d_str.byte_offset(end);
-          d_output[col_idx] =
-            string_index_pair{d_str.data() + begin_offset, end_offset - begin_offset};
-        }
-        begin = end + (begin == end);
-        end   = nchars;
+        auto const match = matches.next();
+        if (!match) { break; }
+        auto const begin_offset = d_str.byte_offset(match->first);
+        auto const end_offset   = d_str.byte_offset(match->second);
+        d_output[col_idx] =
+          string_index_pair{d_str.data() + begin_offset, end_offset - begin_offset};
       }
     }
     // fill the remaining entries for this row with nulls
@@ -91,18 +90,19 @@ struct findall_fn {
 }  // namespace
 
 std::unique_ptr<table> findall(strings_column_view const& input,
-                               std::string_view pattern,
-                               regex_flags const flags,
+                               regex_program const& prog,
                                rmm::cuda_stream_view stream,
                                rmm::mr::device_memory_resource* mr)
 {
   auto const strings_count = input.size();
 
   // compile regex into device object
-  auto const d_prog = reprog_device::create(pattern, flags, stream);
+  auto const d_prog = regex_device_builder::create_prog_device(prog, stream);
 
+  // record the match positions while counting, to find the matches once
   auto const d_strings = column_device_view::create(input.parent(), stream);
-  auto find_counts     = count_matches(*d_strings, *d_prog, strings_count, stream);
+  auto positions       = create_match_positions(input, stream);
+  auto find_counts     = count_matches(*d_strings, *d_prog, strings_count, positions, stream);
   auto d_find_counts   = find_counts->view().data<size_type>();
 
   size_type const columns_count = thrust::reduce(
@@ -122,8 +122,11 @@ std::unique_ptr<table> findall(strings_column_view const& input,
   } else {
     // place all matching strings into the indices vector
     auto d_indices = indices_span(indices.data(), strings_count, columns_count);
-    launch_for_each_kernel(
-      findall_fn{*d_strings, d_find_counts, d_indices}, *d_prog, strings_count, stream);
+    auto const d_positions = positions.is_empty() ? nullptr : positions.data();
+    launch_for_each_kernel(findall_fn{*d_strings, d_find_counts, d_positions, d_indices},
+                           *d_prog,
+                           strings_count,
+                           stream);
     results.resize(columns_count);
   }
 
@@ -157,7 +160,16 @@ std::unique_ptr<table> findall(strings_column_view const& input,
                                rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall(input, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::findall(input, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<table> findall(strings_column_view const& input,
+                               regex_program const& prog,
+                               rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall(input, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -15,6 +15,7 @@
  */
 
 #include <strings/count_matches.hpp>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/regex/utilities.cuh>
 
 #include <cudf/column/column.hpp>
@@ -24,6 +25,7 @@
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/findall.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -49,27 +51,23 @@ namespace {
 struct findall_fn {
   column_device_view const d_strings;
   offset_type const* d_offsets;
+  match_pair const* d_positions;
   string_index_pair* d_indices;
 
   __device__ void operator()(size_type const idx, reprog_device const prog, int32_t const prog_idx)
   {
     if (d_strings.is_null(idx)) { return; }
-    auto const d_str  = d_strings.element<string_view>(idx);
-    auto const nchars = d_str.length();
+    match_reader matches(d_strings, idx, d_positions, prog, prog_idx);
+    auto const& d_str = matches.string();
 
     auto d_output        = d_indices + d_offsets[idx];
     size_type output_idx = 0;
 
-    size_type begin = 0;
-    size_type end   = nchars;
-    while ((begin < end) && (prog.find(prog_idx, d_str, begin, end) > 0)) {
-      auto const spos = d_str.byte_offset(begin);  // convert
-      auto const epos = d_str.byte_offset(end);    // to bytes
+    while (auto const match = matches.next()) {
+      auto const spos = d_str.byte_offset(match->first);   // convert
+      auto const epos = d_str.byte_offset(match->second);  // to bytes
 
       d_output[output_idx++] = string_index_pair{d_str.data() + spos, (epos - spos)};
-
-      begin = end + (begin == end);
-      end   = nchars;
     }
   }
 };
@@ -78,13 +76,16 @@ std::unique_ptr<column> findall_util(column_device_view const& d_strings,
                                      reprog_device& d_prog,
                                      size_type total_matches,
                                      offset_type const* d_offsets,
+                                     match_pair const* d_positions,
                                      rmm::cuda_stream_view stream,
                                      rmm::mr::device_memory_resource* mr)
 {
   rmm::device_uvector<string_index_pair> indices(total_matches, stream);
 
-  launch_for_each_kernel(
-    findall_fn{d_strings, d_offsets, indices.data()}, d_prog, d_strings.size(), stream);
+  launch_for_each_kernel(findall_fn{d_strings, d_offsets, d_positions, indices.data()},
+                         d_prog,
+                         d_strings.size(),
+                         stream);
 
   return make_strings_column(indices.begin(), indices.end(), stream, mr);
 }
@@ -94,8 +95,7 @@ std::unique_ptr<column> findall_util(column_device_view const& d_strings,
 //
 std::unique_ptr<column> findall_record(
   strings_column_view const& input,
-  std::string_view pattern,
-  regex_flags const flags,
+  regex_program const& prog,
   rmm::cuda_stream_view stream,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
 {
@@ -103,10 +103,11 @@ std::unique_ptr<column> findall_record(
   auto const d_strings     = column_device_view::create(input.parent(), stream);
 
   // compile regex into device object
-  auto const d_prog = reprog_device::create(pattern, flags, stream);
+  auto const d_prog = regex_device_builder::create_prog_device(prog, stream);
 
-  // Create lists offsets column
-  auto offsets   = count_matches(*d_strings, *d_prog, strings_count + 1, stream, mr);
+  // Create lists offsets column, recording the match positions while counting
+  auto positions = create_match_positions(input, stream);
+  auto offsets   = count_matches(*d_strings, *d_prog, strings_count + 1, positions, stream, mr);
   auto d_offsets = offsets->mutable_view().data<offset_type>();
 
   // Convert counts into offsets
@@ -117,7 +118,9 @@ std::unique_ptr<column> findall_record(
   auto const total_matches =
     cudf::detail::get_value<size_type>(offsets->view(), strings_count, stream);
 
-  auto strings_output = findall_util(*d_strings, *d_prog, total_matches, d_offsets, stream, mr);
+  auto const d_positions = positions.is_empty() ? nullptr : positions.data();
+  auto strings_output =
+    findall_util(*d_strings, *d_prog, total_matches, d_offsets, d_positions, stream, mr);
 
   // Build the lists column from the offsets and the strings
   return make_lists_column(strings_count,
@@ -139,7 +142,16 @@ std::unique_ptr<column> findall_record(strings_column_view const& input,
                                        rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::findall_record(input, pattern, flags, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, flags);
+  return detail::findall_record(input, *h_prog, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> findall_record(strings_column_view const& input,
+                                       regex_program const& prog,
+                                       rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::findall_record(input, prog, cudf::default_stream_value, mr);
 }
 
 }  // namespace strings
@@ -35,6 +35,7 @@
 #include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/count.h>
+#include <thrust/extrema.h>
 #include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
@@ -43,6 +44,8 @@
 #include <thrust/reduce.h>
 #include <thrust/transform.h>
 
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -790,6 +793,155 @@ std::unique_ptr<table> whitespace_split_fn(size_type strings_count,
   return std::make_unique<table>(std::move(results));
 }
 
+/**
+ * @brief Largest positive `maxsplit` for which split() locates the tokens in a single pass.
+ *
+ * The single pass needs working memory for `maxsplit + 1` tokens per string, even if no string
+ * has that many tokens.
+ */
+constexpr size_type SINGLE_PASS_MAX_SPLIT = 15;
+
+/**
+ * @brief The tokenizer function for splitting into a known number of columns.
+ *
+ * Each string is scanned once by a thread, which stores the first `columns_count - 1` tokens and
+ * the remainder of the string, like split() with `maxsplit = columns_count - 1`. The columns past
+ * the tokens of a string are null.
+ *
+ * The tokens are stored so that `d_tokens[col * strings_count + string_index]` is the token at
+ * column `col` for string at `string_index`.
+ */
+struct split_columns_tokenizer_fn {
+  column_device_view const d_strings;
+  string_view const d_delimiter;  // empty to split on whitespace
+  size_type const columns_count;
+  size_type* d_columns_counts;  // number of columns needed for each string
+  string_index_pair* d_tokens;
+
+  __device__ size_type delimiter_tokens(string_view const& d_str,
+                                        string_index_pair* d_str_tokens) const
+  {
+    auto const delim_size = d_delimiter.size_bytes();
+    auto const end_ptr    = d_str.data() + d_str.size_bytes();
+    auto str_ptr          = d_str.data();  // start of the current token
+    size_type col         = 0;
+    // overlapping delimiters are skipped, as in split_tokenizer_fn::count_tokens
+    for (auto ptr = str_ptr; (col + 1 < columns_count) && (ptr + delim_size <= end_ptr);) {
+      if (d_delimiter.compare(ptr, delim_size) == 0) {
+        d_str_tokens[d_strings.size() * (col++)] =
+          string_index_pair{str_ptr, static_cast<size_type>(ptr - str_ptr)};
+        ptr += delim_size;
+        str_ptr = ptr;
+      } else {
+        ++ptr;
+      }
+    }
+    d_str_tokens[d_strings.size() * (col++)] =
+      string_index_pair{str_ptr, static_cast<size_type>(end_ptr - str_ptr)};
+    return col;
+  }
+
+  __device__ size_type whitespace_tokens(string_view const& d_str,
+                                         string_index_pair* d_str_tokens) const
+  {
+    whitespace_string_tokenizer tokenizer(d_str);
+    size_type col = 0;
+    position_pair token{0, 0};
+    while ((col < columns_count) && tokenizer.next_token()) {
+      token = tokenizer.get_token();
+      d_str_tokens[d_strings.size() * (col++)] =
+        string_index_pair{d_str.data() + token.first, (token.second - token.first)};
+    }
+    // the last column holds the remainder of the string
+    if (col == columns_count)
+      d_str_tokens[d_strings.size() * (col - 1)] =
+        string_index_pair{d_str.data() + token.first, (d_str.size_bytes() - token.first)};
+    return col;
+  }
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto d_str_tokens = d_tokens + idx;
+    size_type col     = 0;
+    if (d_strings.is_valid(idx)) {
+      auto const d_str = d_strings.element<string_view>(idx);
+      col = d_delimiter.empty() ? whitespace_tokens(d_str, d_str_tokens)
+                                : delimiter_tokens(d_str, d_str_tokens);
+      // a valid string needs a column even if it has no tokens
+      d_columns_counts[idx] = thrust::max(col, size_type{1});
+    } else {
+      d_columns_counts[idx] = 0;
+    }
+    for (; col < columns_count; ++col)
+      d_str_tokens[d_strings.size() * col] = string_index_pair{nullptr, 0};
+  }
+};
+
+/**
+ * @brief Split function locating the tokens of each string in a single pass over the chars.
+ *
+ * Unlike split_fn() and whitespace_split_fn(), the tokens are not counted before they are
+ * located since the number of output columns is bounded by `columns_count`. All the tokens are
+ * stored in one (column, row) buffer from which the output columns are built.
+ *
+ * @param strings_column The strings to split
+ * @param d_delimiter Delimiter to split on or empty to split on whitespace
+ * @param columns_count Maximum number of output columns
+ * @param exact If true, the output has `columns_count` columns. Otherwise the trailing columns
+ *        that are null in every row are not returned, as with split().
+ * @return table of columns for the output of the split
+ */
+std::unique_ptr<table> split_columns_fn(strings_column_view const& strings_column,
+                                        string_view const& d_delimiter,
+                                        size_type columns_count,
+                                        bool exact,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  auto const strings_count = strings_column.size();
+  auto d_strings           = column_device_view::create(strings_column.parent(), stream);
+
+  // get the positions for every token
+  rmm::device_uvector<size_type> columns_counts(strings_count, stream);
+  rmm::device_uvector<string_index_pair> tokens(
+    static_cast<std::size_t>(columns_count) * strings_count, stream);
+  string_index_pair* d_tokens = tokens.data();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    strings_count,
+    split_columns_tokenizer_fn{
+      *d_strings, d_delimiter, columns_count, columns_counts.data(), d_tokens});
+
+  std::vector<std::unique_ptr<column>> results;
+  if (!exact) {
+    columns_count = thrust::reduce(rmm::exec_policy(stream),
+                                   columns_counts.begin(),
+                                   columns_counts.end(),
+                                   0,
+                                   thrust::maximum{});
+    // boundary case: if no columns, return one null column (custrings issue #119)
+    if (columns_count == 0) {
+      results.push_back(std::make_unique<column>(
+        data_type{type_id::STRING},
+        strings_count,
+        rmm::device_buffer{0, stream, mr},  // no data
+        cudf::detail::create_null_mask(strings_count, mask_state::ALL_NULL, stream, mr),
+        strings_count));
+    }
+  }
+
+  // Create each column.
+  // - Each pair points to a string for that column for each row.
+  // - Create the strings column from the vector using the strings factory.
+  for (size_type col = 0; col < columns_count; ++col) {
+    auto column_tokens = d_tokens + (static_cast<std::size_t>(col) * strings_count);
+    results.emplace_back(
+      make_strings_column(column_tokens, column_tokens + strings_count, stream, mr));
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace
 
 std::unique_ptr<table> split(
@@ -804,6 +956,12 @@ std::unique_ptr<table> split(
   size_type max_tokens = 0;
   if (maxsplit > 0) max_tokens = maxsplit + 1;  // makes consistent with Pandas
 
+  string_view d_delimiter(delimiter.data(), delimiter.size());
+  // a small maxsplit bounds the columns well enough to skip counting the tokens
+  if (maxsplit > 0 && maxsplit <= SINGLE_PASS_MAX_SPLIT && !strings_column.is_empty()) {
+    return split_columns_fn(strings_column, d_delimiter, max_tokens, false, stream, mr);
+  }
+
   auto strings_device_view = column_device_view::create(strings_column.parent(), stream);
   if (delimiter.size() == 0) {
     return whitespace_split_fn(strings_column.size(),
@@ -812,11 +970,32 @@ std::unique_ptr<table> split(
                                mr);
   }
 
-  string_view d_delimiter(delimiter.data(), delimiter.size());
   return split_fn(
     strings_column, split_tokenizer_fn{*strings_device_view, d_delimiter, max_tokens}, stream, mr);
 }
 
+std::unique_ptr<table> split_to_columns(
+  strings_column_view const& strings_column,
+  size_type num_columns,
+  string_scalar const& delimiter      = string_scalar(""),
+  rmm::cuda_stream_view stream        = cudf::default_stream_value,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource())
+{
+  CUDF_EXPECTS(num_columns > 0, "Parameter num_columns must be positive");
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  if (strings_column.is_empty()) {
+    std::vector<std::unique_ptr<column>> results;
+    for (size_type col = 0; col < num_columns; ++col) {
+      results.push_back(make_empty_column(type_id::STRING));
+    }
+    return std::make_unique<table>(std::move(results));
+  }
+
+  string_view d_delimiter(delimiter.data(), delimiter.size());
+  return split_columns_fn(strings_column, d_delimiter, num_columns, true, stream, mr);
+}
+
 std::unique_ptr<table> rsplit(
   strings_column_view const& strings_column,
   string_scalar const& delimiter      = string_scalar(""),
@@ -864,5 +1043,15 @@ std::unique_ptr<table> rsplit(strings_column_view const& strings_column,
   return detail::rsplit(strings_column, delimiter, maxsplit, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<table> split_to_columns(strings_column_view const& strings_column,
+                                        size_type num_columns,
+                                        string_scalar const& delimiter,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_to_columns(
+    strings_column, num_columns, delimiter, cudf::default_stream_value, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
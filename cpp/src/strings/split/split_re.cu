@@ -15,6 +15,7 @@
  */
 
 #include <strings/count_matches.hpp>
+#include <strings/regex/regex_program_impl.h>
 #include <strings/regex/utilities.cuh>
 
 #include <cudf/column/column.hpp>
@@ -24,6 +25,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/split/split_re.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
@@ -60,25 +62,25 @@ struct token_reader_fn {
   column_device_view const d_strings;
   split_direction const direction;
   offset_type const* d_token_offsets;
+  match_pair const* d_positions;
   string_index_pair* d_tokens;
 
   __device__ void operator()(size_type const idx, reprog_device const prog, int32_t const prog_idx)
   {
     if (d_strings.is_null(idx)) { return; }
-    auto const d_str = d_strings.element<string_view>(idx);
+    match_reader matches(d_strings, idx, d_positions, prog, prog_idx);
+    auto const& d_str = matches.string();
 
     auto const token_offset = d_token_offsets[idx];
     auto const token_count  = d_token_offsets[idx + 1] - token_offset;
     auto const d_result     = d_tokens + token_offset;  // store tokens here
 
     size_type token_idx = 0;
-    size_type begin     = 0;  // characters
-    size_type end       = -1;
     size_type last_pos  = 0;  // bytes
-    while (prog.find(prog_idx, d_str, begin, end) > 0) {
+    while (auto const match = matches.next()) {
       // get the token (characters just before this match)
       auto const token =
-        string_index_pair{d_str.data() + last_pos, d_str.byte_offset(begin) - last_pos};
+        string_index_pair{d_str.data() + last_pos, d_str.byte_offset(match->first) - last_pos};
       // store it if we have space
       if (token_idx < token_count - 1) {
         d_result[token_idx++] = token;
@@ -90,9 +92,7 @@ struct token_reader_fn {
         d_result[token_idx - 1] = token;
       }
       // setup for next match
-      last_pos = d_str.byte_offset(end);
-      begin    = end + (begin == end);
-      end      = -1;
+      last_pos = d_str.byte_offset(match->second);
     }
 
     // set the last token to the remainder of the string
@@ -122,6 +122,7 @@ struct token_reader_fn {
  * @param max_tokens The maximum number of tokens for each split.
  * @param offsets The number of matches on input.
  *                The offsets for each token in each string on output.
+ * @param d_positions Match positions recorded by `count_matches`, or nullptr
  * @param stream CUDA stream used for kernel launches.
  */
 rmm::device_uvector<string_index_pair> generate_tokens(column_device_view const& d_strings,
@@ -129,6 +130,7 @@ rmm::device_uvector<string_index_pair> generate_tokens(column_device_view const&
                                                        split_direction direction,
                                                        size_type maxsplit,
                                                        mutable_column_view& offsets,
+                                                       match_pair const* d_positions,
                                                        rmm::cuda_stream_view stream)
 {
   auto const strings_count = d_strings.size();
@@ -152,10 +154,11 @@ rmm::device_uvector<string_index_pair> generate_tokens(column_device_view const&
   rmm::device_uvector<string_index_pair> tokens(total_tokens, stream);
   if (total_tokens == 0) { return tokens; }
 
-  launch_for_each_kernel(token_reader_fn{d_strings, direction, d_offsets, tokens.data()},
-                         d_prog,
-                         d_strings.size(),
-                         stream);
+  launch_for_each_kernel(
+    token_reader_fn{d_strings, direction, d_offsets, d_positions, tokens.data()},
+    d_prog,
+    d_strings.size(),
+    stream);
 
   return tokens;
 }
@@ -184,13 +187,13 @@ struct tokens_transform_fn {
 };
 
 std::unique_ptr<table> split_re(strings_column_view const& input,
-                                std::string_view pattern,
+                                regex_program const& prog,
                                 split_direction direction,
                                 size_type maxsplit,
                                 rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(!pattern.empty(), "Parameter pattern must not be empty");
+  CUDF_EXPECTS(!prog.pattern().empty(), "Parameter pattern must not be empty");
 
   auto const strings_count = input.size();
 
@@ -200,17 +203,20 @@ std::unique_ptr<table> split_re(strings_column_view const& input,
     return std::make_unique<table>(std::move(results));
   }
 
-  // create the regex device prog from the given pattern
-  auto d_prog    = reprog_device::create(pattern, stream);
+  // create the regex device prog from the given program
+  auto d_prog    = regex_device_builder::create_prog_device(prog, stream);
   auto d_strings = column_device_view::create(input.parent(), stream);
 
-  // count the number of delimiters matched in each string
-  auto offsets      = count_matches(*d_strings, *d_prog, strings_count + 1, stream);
+  // count the number of delimiters matched in each string, recording their positions
+  auto positions    = create_match_positions(input, stream);
+  auto offsets      = count_matches(*d_strings, *d_prog, strings_count + 1, positions, stream);
   auto offsets_view = offsets->mutable_view();
   auto d_offsets    = offsets_view.data<offset_type>();
 
   // get the split tokens from the input column; this also converts the counts into offsets
-  auto tokens = generate_tokens(*d_strings, *d_prog, direction, maxsplit, offsets_view, stream);
+  auto const d_positions = positions.is_empty() ? nullptr : positions.data();
+  auto tokens =
+    generate_tokens(*d_strings, *d_prog, direction, maxsplit, offsets_view, d_positions, stream);
 
   // the output column count is the maximum number of tokens generated for any input string
   auto const columns_count = thrust::transform_reduce(
@@ -252,26 +258,29 @@ std::unique_ptr<table> split_re(strings_column_view const& input,
 }
 
 std::unique_ptr<column> split_record_re(strings_column_view const& input,
-                                        std::string_view pattern,
+                                        regex_program const& prog,
                                         split_direction direction,
                                         size_type maxsplit,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(!pattern.empty(), "Parameter pattern must not be empty");
+  CUDF_EXPECTS(!prog.pattern().empty(), "Parameter pattern must not be empty");
 
   auto const strings_count = input.size();
 
-  // create the regex device prog from the given pattern
-  auto d_prog    = reprog_device::create(pattern, stream);
+  // create the regex device prog from the given program
+  auto d_prog    = regex_device_builder::create_prog_device(prog, stream);
   auto d_strings = column_device_view::create(input.parent(), stream);
 
-  // count the number of delimiters matched in each string
-  auto offsets      = count_matches(*d_strings, *d_prog, strings_count + 1, stream, mr);
+  // count the number of delimiters matched in each string, recording their positions
+  auto positions    = create_match_positions(input, stream);
+  auto offsets      = count_matches(*d_strings, *d_prog, strings_count + 1, positions, stream, mr);
   auto offsets_view = offsets->mutable_view();
 
   // get the split tokens from the input column; this also converts the counts into offsets
-  auto tokens = generate_tokens(*d_strings, *d_prog, direction, maxsplit, offsets_view, stream);
+  auto const d_positions = positions.is_empty() ? nullptr : positions.data();
+  auto tokens =
+    generate_tokens(*d_strings, *d_prog, direction, maxsplit, offsets_view, d_positions, stream);
 
   // convert the tokens into one big strings column
   auto strings_output = make_strings_column(tokens.begin(), tokens.end(), stream, mr);
@@ -289,39 +298,39 @@ std::unique_ptr<column> split_record_re(strings_column_view const& input,
 }  // namespace
 
 std::unique_ptr<table> split_re(strings_column_view const& input,
-                                std::string_view pattern,
+                                regex_program const& prog,
                                 size_type maxsplit,
                                 rmm::cuda_stream_view stream,
                                 rmm::mr::device_memory_resource* mr)
 {
-  return split_re(input, pattern, split_direction::FORWARD, maxsplit, stream, mr);
+  return split_re(input, prog, split_direction::FORWARD, maxsplit, stream, mr);
 }
 
 std::unique_ptr<column> split_record_re(strings_column_view const& input,
-                                        std::string_view pattern,
+                                        regex_program const& prog,
                                         size_type maxsplit,
                                         rmm::cuda_stream_view stream,
                                         rmm::mr::device_memory_resource* mr)
 {
-  return split_record_re(input, pattern, split_direction::FORWARD, maxsplit, stream, mr);
+  return split_record_re(input, prog, split_direction::FORWARD, maxsplit, stream, mr);
 }
 
 std::unique_ptr<table> rsplit_re(strings_column_view const& input,
-                                 std::string_view pattern,
+                                 regex_program const& prog,
                                  size_type maxsplit,
                                  rmm::cuda_stream_view stream,
                                  rmm::mr::device_memory_resource* mr)
 {
-  return split_re(input, pattern, split_direction::BACKWARD, maxsplit, stream, mr);
+  return split_re(input, prog, split_direction::BACKWARD, maxsplit, stream, mr);
 }
 
 std::unique_ptr<column> rsplit_record_re(strings_column_view const& input,
-                                         std::string_view pattern,
+                                         regex_program const& prog,
                                          size_type maxsplit,
                                          rmm::cuda_stream_view stream,
                                          rmm::mr::device_memory_resource* mr)
 {
-  return split_record_re(input, pattern, split_direction::BACKWARD, maxsplit, stream, mr);
+  return split_record_re(input, prog, split_direction::BACKWARD, maxsplit, stream, mr);
 }
 
 }  // namespace detail
@@ -334,7 +343,17 @@ std::unique_ptr<table> split_re(strings_column_view const& input,
                                 rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::split_re(input, pattern, maxsplit, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, regex_flags::MULTILINE);
+  return detail::split_re(input, *h_prog, maxsplit, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<table> split_re(strings_column_view const& input,
+                                regex_program const& prog,
+                                size_type maxsplit,
+                                rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_re(input, prog, maxsplit, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> split_record_re(strings_column_view const& input,
@@ -343,7 +362,17 @@ std::unique_ptr<column> split_record_re(strings_column_view const& input,
                                         rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::split_record_re(input, pattern, maxsplit, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, regex_flags::MULTILINE);
+  return detail::split_record_re(input, *h_prog, maxsplit, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> split_record_re(strings_column_view const& input,
+                                        regex_program const& prog,
+                                        size_type maxsplit,
+                                        rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record_re(input, prog, maxsplit, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<table> rsplit_re(strings_column_view const& input,
@@ -352,7 +381,17 @@ std::unique_ptr<table> rsplit_re(strings_column_view const& input,
                                  rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::rsplit_re(input, pattern, maxsplit, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, regex_flags::MULTILINE);
+  return detail::rsplit_re(input, *h_prog, maxsplit, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<table> rsplit_re(strings_column_view const& input,
+                                 regex_program const& prog,
+                                 size_type maxsplit,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rsplit_re(input, prog, maxsplit, cudf::default_stream_value, mr);
 }
 
 std::unique_ptr<column> rsplit_record_re(strings_column_view const& input,
@@ -361,7 +400,17 @@ std::unique_ptr<column> rsplit_record_re(strings_column_view const& input,
                                          rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::rsplit_record_re(input, pattern, maxsplit, cudf::default_stream_value, mr);
+  auto const h_prog = regex_program::create(pattern, regex_flags::MULTILINE);
+  return detail::rsplit_record_re(input, *h_prog, maxsplit, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<column> rsplit_record_re(strings_column_view const& input,
+                                         regex_program const& prog,
+                                         size_type maxsplit,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::rsplit_record_re(input, prog, maxsplit, cudf::default_stream_value, mr);
 }
 }  // namespace strings
 }  // namespace cudf
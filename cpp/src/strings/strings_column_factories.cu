@@ -126,6 +126,9 @@ std::unique_ptr<column> make_strings_column(size_type num_strings,
   CUDF_EXPECTS(num_strings == offsets_column->size() - 1,
                "Invalid offsets column size for strings column.");
   CUDF_EXPECTS(offsets_column->null_count() == 0, "Offsets column should not contain nulls");
+  CUDF_EXPECTS(offsets_column->type().id() == type_id::INT32 ||
+                 offsets_column->type().id() == type_id::INT64,
+               "Offsets column must be INT32 or INT64");
   CUDF_EXPECTS(chars_column->null_count() == 0, "Chars column should not contain nulls");
 
   std::vector<std::unique_ptr<column>> children;
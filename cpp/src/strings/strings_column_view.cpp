@@ -34,6 +34,8 @@ column_view strings_column_view::offsets() const
 
 strings_column_view::offset_iterator strings_column_view::offsets_begin() const
 {
+  CUDF_EXPECTS(offsets().type().id() == type_id::INT32,
+               "offsets_begin() requires INT32 offsets, use an offsets_accessor for INT64");
   return offsets().begin<offset_type>() + offset();
 }
 
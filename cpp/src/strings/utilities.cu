@@ -19,6 +19,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/strings/detail/char_tables.hpp>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/utilities/error.hpp>
@@ -27,7 +28,10 @@
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/transform.h>
 
 namespace cudf {
@@ -64,6 +68,50 @@ rmm::device_uvector<string_view> create_string_vector_from_column(
   return strings_vector;
 }
 
+/**
+ * @copydoc get_long_string_indices
+ */
+rmm::device_uvector<size_type> get_long_string_indices(strings_column_view const& input,
+                                                       size_type threshold,
+                                                       rmm::cuda_stream_view stream)
+{
+  if (input.is_empty()) { return rmm::device_uvector<size_type>(0, stream); }
+  auto const d_offsets = input.offsets_begin();
+  auto const is_long   = [d_offsets, threshold] __device__(size_type idx) {
+    return (d_offsets[idx + 1] - d_offsets[idx]) > threshold;
+  };
+  auto const count = thrust::count_if(rmm::exec_policy(stream),
+                                      thrust::make_counting_iterator<size_type>(0),
+                                      thrust::make_counting_iterator<size_type>(input.size()),
+                                      is_long);
+  auto indices     = rmm::device_uvector<size_type>(count, stream);
+  thrust::copy_if(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(input.size()),
+                  indices.begin(),
+                  is_long);
+  return indices;
+}
+
+/**
+ * @copydoc is_all_ascii
+ */
+bool is_all_ascii(strings_column_view const& input, rmm::cuda_stream_view stream)
+{
+  if (input.chars_size() == 0) { return true; }
+  return thrust::none_of(rmm::exec_policy(stream),
+                         input.chars_begin(),
+                         input.chars_end(),
+                         [] __device__(char ch) { return (static_cast<uint8_t>(ch) & 0x80) != 0; });
+}
+
+int64_t get_offset_value(column_view const& offsets, size_type index, rmm::cuda_stream_view stream)
+{
+  return offsets.type().id() == type_id::INT64
+           ? cudf::detail::get_value<int64_t>(offsets, index, stream)
+           : cudf::detail::get_value<int32_t>(offsets, index, stream);
+}
+
 std::unique_ptr<column> create_chars_child_column(cudf::size_type total_bytes,
                                                   rmm::cuda_stream_view stream,
                                                   rmm::mr::device_memory_resource* mr)
@@ -89,4 +89,15 @@ std::vector<std::unique_ptr<column>> table::release()
   return std::move(_columns);
 }
 
+// Share the buffers of the columns with a new table
+std::unique_ptr<table> table::share() const
+{
+  std::vector<std::unique_ptr<column>> columns;
+  columns.reserve(_columns.size());
+  for (auto const& c : _columns) {
+    columns.emplace_back(c->share());
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
 }  // namespace cudf
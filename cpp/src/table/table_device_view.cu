@@ -15,14 +15,54 @@
  */
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/device_view_cache.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <memory>
+#include <type_traits>
+#include <utility>
+
 namespace cudf {
 namespace detail {
+namespace {
+
+/**
+ * @brief Copies the views of the columns of a table to device memory.
+ *
+ * The views of immutable tables created on the default stream are reused from the device view
+ * cache.
+ *
+ * @return The owner of the device memory, and the device pointer to the views of the columns
+ */
+template <typename ColumnDeviceView, typename HostTableView>
+std::pair<std::shared_ptr<rmm::device_buffer>, ColumnDeviceView*> create_column_device_views(
+  HostTableView source_view, rmm::cuda_stream_view stream)
+{
+  if constexpr (std::is_same_v<ColumnDeviceView, column_device_view>) {
+    if (is_device_view_cache_enabled(stream)) {
+      using cache_type = device_view_cache<column_device_view*>;
+      auto& cache      = cache_type::instance();
+      auto const key   = device_view_cache_key(source_view);
+      if (auto const cached = cache.find(key)) { return {cached->second, cached->first}; }
+
+      auto [storage, d_columns] = contiguous_copy_column_device_views<column_device_view>(
+        source_view, stream, device_view_cache_resource());
+      std::shared_ptr<rmm::device_buffer> shared_storage = std::move(storage);
+      cache.insert(key, {d_columns, shared_storage});
+      return {shared_storage, d_columns};
+    }
+  }
+  auto [storage, d_columns] =
+    contiguous_copy_column_device_views<ColumnDeviceView, HostTableView>(source_view, stream);
+  return {std::move(storage), d_columns};
+}
+
+}  // namespace
+
 template <typename ColumnDeviceView, typename HostTableView>
 void table_device_view_base<ColumnDeviceView, HostTableView>::destroy()
 {
@@ -39,10 +79,10 @@ table_device_view_base<ColumnDeviceView, HostTableView>::table_device_view_base(
   // objects and copied into device memory for the table_device_view's
   // _columns member.
   if (source_view.num_columns() > 0) {
-    std::unique_ptr<rmm::device_buffer> descendant_storage_owner;
+    std::shared_ptr<rmm::device_buffer> descendant_storage_owner;
     std::tie(descendant_storage_owner, _columns) =
-      contiguous_copy_column_device_views<ColumnDeviceView, HostTableView>(source_view, stream);
-    _descendant_storage = descendant_storage_owner.release();
+      create_column_device_views<ColumnDeviceView, HostTableView>(source_view, stream);
+    _descendant_storage = new std::shared_ptr<rmm::device_buffer>(descendant_storage_owner);
   }
 }
 
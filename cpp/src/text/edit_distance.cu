@@ -20,46 +20,141 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/pair.h>
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <algorithm>
+#include <limits>
+#include <vector>
+
 namespace nvtext {
 namespace detail {
 namespace {
 
+/**
+ * @brief Maximum number of characters in the shorter string of a pair for which
+ * the edit distance is computed with the bit-parallel algorithm.
+ */
+constexpr cudf::size_type MAX_BIT_PARALLEL_LENGTH = 64;
+
+/**
+ * @brief Compute the edit-distance between two strings using Myers' bit-parallel algorithm.
+ *
+ * Each bit of the 64-bit state vectors holds the vertical delta of one row of the dynamic
+ * programming matrix so each column of the matrix is computed with a few bitwise operations.
+ * This is the global edit-distance variant described by Hyyrö in
+ * "Explaining and extending the bit-parallel approximate string matching algorithm of Myers".
+ *
+ * The computation stops early and returns `max_distance + 1` once the distance cannot be
+ * within `max_distance` since it can decrease by at most one for each remaining character.
+ *
+ * @param d_pattern The shorter string with at most `MAX_BIT_PARALLEL_LENGTH` characters
+ * @param pattern_length Number of characters in `d_pattern`
+ * @param d_text The longer string
+ * @param text_length Number of characters in `d_text`
+ * @param max_distance Maximum distance of interest
+ * @return Edit distance value or `max_distance + 1` if it is greater than `max_distance`
+ */
+__device__ int32_t compute_distance_bit_parallel(cudf::string_view const& d_pattern,
+                                                 cudf::size_type pattern_length,
+                                                 cudf::string_view const& d_text,
+                                                 cudf::size_type text_length,
+                                                 int32_t max_distance)
+{
+  cudf::char_utf8 pattern[MAX_BIT_PARALLEL_LENGTH];
+  thrust::copy(thrust::seq, d_pattern.begin(), d_pattern.end(), pattern);
+
+  auto const last_bit = uint64_t{1} << (pattern_length - 1);
+  uint64_t pv         = ~uint64_t{0};  // positive vertical deltas
+  uint64_t mv         = 0;             // negative vertical deltas
+  int32_t score       = pattern_length;
+  auto remaining      = text_length;
+  for (auto const chr : d_text) {
+    uint64_t eq = 0;  // pattern positions matching this character
+    for (cudf::size_type j = 0; j < pattern_length; ++j) {
+      eq |= static_cast<uint64_t>(pattern[j] == chr) << j;
+    }
+    auto const xv = eq | mv;
+    auto const xh = (((eq & pv) + pv) ^ pv) | eq;
+    auto ph       = mv | ~(xh | pv);
+    auto mh       = pv & xh;
+    if (ph & last_bit) {
+      ++score;
+    } else if (mh & last_bit) {
+      --score;
+    }
+    ph = (ph << 1) | 1;  // the first row of the matrix increases by one for each column
+    mh = mh << 1;
+    pv = mh | ~(xv | ph);
+    mv = ph & xv;
+    if (score - (--remaining) > max_distance) { return max_distance + 1; }
+  }
+  return score;
+}
+
+/**
+ * @brief Returns the number of int16 values `compute_distance` needs for the given strings.
+ *
+ * Only pairs computed by the dynamic programming algorithm need a temporary buffer.
+ */
+__device__ cudf::size_type compute_buffer_size(cudf::string_view const& d_str,
+                                               cudf::string_view const& d_tgt)
+{
+  auto const length = std::min(d_str.length(), d_tgt.length());
+  // just need 3 int16's for each character of the shorter string
+  return length > MAX_BIT_PARALLEL_LENGTH ? length * 3 : 0;
+}
+
 /**
  * @brief Compute the edit-distance between two strings
  *
- * The temporary buffer must be able to hold 3 int16 values for each character
- * in the smaller of the two provided strings.
+ * The temporary buffer must be able to hold the number of int16 values
+ * returned by `compute_buffer_size` for the two strings.
  *
  * @param d_str First string
  * @param d_tgt Second string
  * @param buffer Temporary memory buffer used for the calculation.
+ * @param max_distance Distances greater than this may be returned as `max_distance + 1`
  * @return Edit distance value
  */
 __device__ int32_t compute_distance(cudf::string_view const& d_str,
                                     cudf::string_view const& d_tgt,
-                                    int16_t* buffer)
+                                    int16_t* buffer,
+                                    int32_t max_distance = std::numeric_limits<int32_t>::max())
 {
   auto const str_length = d_str.length();
   auto const tgt_length = d_tgt.length();
   if (str_length == 0) return tgt_length;
   if (tgt_length == 0) return str_length;
+  // the distance is at least the difference in the lengths
+  auto const length_diff =
+    str_length < tgt_length ? tgt_length - str_length : str_length - tgt_length;
+  if (length_diff > max_distance) { return max_distance + 1; }
+
+  if (std::min(str_length, tgt_length) <= MAX_BIT_PARALLEL_LENGTH) {
+    return str_length < tgt_length
+             ? compute_distance_bit_parallel(d_str, str_length, d_tgt, tgt_length, max_distance)
+             : compute_distance_bit_parallel(d_tgt, tgt_length, d_str, str_length, max_distance);
+  }
 
   auto itr_A = str_length < tgt_length ? d_str.begin() : d_tgt.begin();
   auto itr_B = str_length < tgt_length ? d_tgt.begin() : d_str.begin();
@@ -143,6 +238,46 @@ struct edit_distance_matrix_levenshtein_algorithm {
   }
 };
 
+/**
+ * @brief Compute the edit distance of the pairs in a range of rows of the distance matrix.
+ *
+ * Only pairs in the upper half of the matrix are computed. All other pairs are
+ * set to `max_distance + 1` so they are not within the threshold.
+ */
+struct edit_distance_pairs_fn {
+  cudf::column_device_view d_strings;
+  cudf::size_type first_row;  // row of the matrix for idx==0
+  int32_t max_distance;       // pairs further apart than this are not needed
+  int16_t* d_buffer;          // compute buffer for each pair
+  int64_t const* d_offsets;   // locate sub-buffer for each pair
+  int32_t* d_results;         // edit distance values
+
+  __device__ thrust::pair<cudf::string_view, cudf::string_view> get_pair(cudf::size_type idx) const
+  {
+    auto const row = first_row + idx / d_strings.size();
+    auto const col = idx % d_strings.size();
+    return thrust::make_pair(
+      d_strings.is_null(row) ? cudf::string_view{} : d_strings.element<cudf::string_view>(row),
+      d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col));
+  }
+
+  __device__ bool is_upper(cudf::size_type idx) const
+  {
+    return (first_row + idx / d_strings.size()) < (idx % d_strings.size());
+  }
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (!is_upper(idx)) {
+      d_results[idx] = max_distance + 1;
+      return;
+    }
+    auto const strs = get_pair(idx);
+    d_results[idx] =
+      compute_distance(strs.first, strs.second, d_buffer + d_offsets[idx], max_distance);
+  }
+};
+
 }  // namespace
 
 /**
@@ -184,8 +319,7 @@ std::unique_ptr<cudf::column> edit_distance(cudf::strings_column_view const& str
                       auto d_tgt = d_targets.size() == 1
                                      ? d_targets.element<cudf::string_view>(0)
                                      : d_targets.element<cudf::string_view>(idx);
-                      // just need 3 int16's for each character of the shorter string
-                      return static_cast<int32_t>(std::min(d_str.length(), d_tgt.length()) * 3);
+                      return static_cast<int32_t>(compute_buffer_size(d_str, d_tgt));
                     });
 
   // get the total size of the temporary compute buffer
@@ -246,8 +380,7 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
       cudf::string_view const d_str2 =
         d_strings.is_null(col) ? cudf::string_view{} : d_strings.element<cudf::string_view>(col);
       if (d_str1.empty() || d_str2.empty()) return;
-      // the temp size needed is 3 int16s per character of the shorter string
-      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = std::min(d_str1.length(), d_str2.length()) * 3;
+      d_offsets[idx - ((row + 1) * (row + 2)) / 2] = compute_buffer_size(d_str1, d_str2);
     });
 
   // get the total size for the compute buffer
@@ -297,6 +430,111 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
                                  mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance_pairs
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(cudf::strings_column_view const& strings,
+                                                 cudf::size_type max_distance,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(max_distance >= 0, "max_distance must not be negative");
+  auto const strings_count = strings.size();
+
+  std::vector<std::unique_ptr<cudf::column>> rows;
+  std::vector<std::unique_ptr<cudf::column>> cols;
+  std::vector<std::unique_ptr<cudf::column>> distances;
+
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+
+  // The matrix is processed a range of rows at a time to bound the working memory.
+  // Only the pairs within max_distance are kept from each range.
+  constexpr int64_t max_chunk_pairs = 1 << 24;
+  auto const chunk_rows = static_cast<cudf::size_type>(
+    std::max(int64_t{1}, max_chunk_pairs / std::max(strings_count, cudf::size_type{1})));
+  for (cudf::size_type first_row = 0; first_row < strings_count - 1; first_row += chunk_rows) {
+    auto const last_row = std::min(first_row + chunk_rows, strings_count - 1);
+    auto const pairs    = (last_row - first_row) * strings_count;
+
+    edit_distance_pairs_fn fn{*d_strings, first_row, max_distance, nullptr, nullptr, nullptr};
+
+    // only pairs computed with the dynamic programming algorithm need a compute buffer
+    rmm::device_uvector<int64_t> offsets(pairs, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<cudf::size_type>(0),
+                      thrust::make_counting_iterator<cudf::size_type>(pairs),
+                      offsets.begin(),
+                      [fn, max_distance] __device__(auto idx) {
+                        if (!fn.is_upper(idx)) { return int64_t{0}; }
+                        auto const strs = fn.get_pair(idx);
+                        auto const diff = strs.first.length() - strs.second.length();
+                        if (diff > max_distance || -diff > max_distance) { return int64_t{0}; }
+                        return static_cast<int64_t>(compute_buffer_size(strs.first, strs.second));
+                      });
+    auto const compute_size =
+      thrust::reduce(rmm::exec_policy(stream), offsets.begin(), offsets.end(), int64_t{0});
+    thrust::exclusive_scan(
+      rmm::exec_policy(stream), offsets.begin(), offsets.end(), offsets.begin());
+    rmm::device_uvector<int16_t> compute_buffer(compute_size, stream);
+
+    rmm::device_uvector<int32_t> results(pairs, stream);
+    fn.d_buffer  = compute_buffer.data();
+    fn.d_offsets = offsets.data();
+    fn.d_results = results.data();
+    thrust::for_each_n(
+      rmm::exec_policy(stream), thrust::make_counting_iterator<cudf::size_type>(0), pairs, fn);
+
+    // keep only the pairs within max_distance
+    auto const is_within = [max_distance] __device__(auto d) { return d <= max_distance; };
+    auto const count =
+      thrust::count_if(rmm::exec_policy(stream), results.begin(), results.end(), is_within);
+    rmm::device_uvector<cudf::size_type> indices(count, stream);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(pairs),
+                    results.begin(),
+                    indices.begin(),
+                    is_within);
+
+    auto const make_output = [count, stream] {
+      return cudf::make_numeric_column(
+        cudf::data_type{cudf::type_id::INT32}, count, cudf::mask_state::UNALLOCATED, stream);
+    };
+    rows.push_back(make_output());
+    cols.push_back(make_output());
+    distances.push_back(make_output());
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator<cudf::size_type>(0),
+                       count,
+                       [d_indices   = indices.data(),
+                        d_results   = results.data(),
+                        d_rows      = rows.back()->mutable_view().data<int32_t>(),
+                        d_cols      = cols.back()->mutable_view().data<int32_t>(),
+                        d_distances = distances.back()->mutable_view().data<int32_t>(),
+                        first_row,
+                        strings_count] __device__(auto idx) {
+                         auto const pair_idx = d_indices[idx];
+                         d_rows[idx]         = first_row + pair_idx / strings_count;
+                         d_cols[idx]         = pair_idx % strings_count;
+                         d_distances[idx]    = d_results[pair_idx];
+                       });
+  }
+
+  // combine the pairs found in each range of rows
+  auto const combine = [stream, mr](std::vector<std::unique_ptr<cudf::column>> const& columns) {
+    if (columns.empty()) { return cudf::make_empty_column(cudf::type_id::INT32); }
+    std::vector<cudf::column_view> views(columns.size());
+    std::transform(
+      columns.begin(), columns.end(), views.begin(), [](auto const& col) { return col->view(); });
+    return cudf::detail::concatenate(views, stream, mr);
+  };
+  std::vector<std::unique_ptr<cudf::column>> results;
+  results.push_back(combine(rows));
+  results.push_back(combine(cols));
+  results.push_back(combine(distances));
+  return std::make_unique<cudf::table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external APIs
@@ -322,4 +560,15 @@ std::unique_ptr<cudf::column> edit_distance_matrix(cudf::strings_column_view con
   return detail::edit_distance_matrix(strings, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc nvtext::edit_distance_pairs
+ */
+std::unique_ptr<cudf::table> edit_distance_pairs(cudf::strings_column_view const& strings,
+                                                 cudf::size_type max_distance,
+                                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::edit_distance_pairs(strings, max_distance, cudf::default_stream_value, mr);
+}
+
 }  // namespace nvtext
@@ -20,7 +20,9 @@
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -32,12 +34,16 @@
 #include <nvtext/generate_ngrams.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
 namespace nvtext {
@@ -264,4 +270,234 @@ std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_vie
   return detail::generate_character_ngrams(strings, ngrams, cudf::default_stream_value, mr);
 }
 
+namespace detail {
+namespace {
+
+/**
+ * @brief Computes MurmurHash3_32 of bytes that are not contiguous in memory.
+ *
+ * The bytes are added one at a time in order and the result of `hash()` is the same
+ * value `MurmurHash3_32<cudf::string_view>` returns for a string of the same bytes.
+ * This allows hashing an ngram without first copying its pieces into a single string.
+ */
+class murmur_hash_stream {
+ public:
+  __device__ murmur_hash_stream(uint32_t seed) : h{seed} {}
+
+  __device__ void add(cudf::string_view const& d_str)
+  {
+    auto const data = reinterpret_cast<uint8_t const*>(d_str.data());
+    for (cudf::size_type i = 0; i < d_str.size_bytes(); ++i) {
+      block |= static_cast<uint32_t>(data[i]) << (8 * (length % 4));
+      if ((++length % 4) == 0) {
+        h ^= mix(block);
+        h = cudf::detail::rotate_bits_left(h, rot_c2);
+        h = h * 5 + c3;
+        block = 0;
+      }
+    }
+  }
+
+  [[nodiscard]] __device__ uint32_t hash() const
+  {
+    auto result = h;
+    if (length % 4) { result ^= mix(block); }
+    result ^= static_cast<uint32_t>(length);
+    result ^= result >> 16;
+    result *= 0x85ebca6b;
+    result ^= result >> 13;
+    result *= 0xc2b2ae35;
+    result ^= result >> 16;
+    return result;
+  }
+
+ private:
+  [[nodiscard]] __device__ uint32_t mix(uint32_t k1) const
+  {
+    k1 *= c1;
+    k1 = cudf::detail::rotate_bits_left(k1, rot_c1);
+    return k1 * c2;
+  }
+
+  static constexpr uint32_t c1     = 0xcc9e2d51;
+  static constexpr uint32_t c2     = 0x1b873593;
+  static constexpr uint32_t c3     = 0xe6546b64;
+  static constexpr uint32_t rot_c1 = 15;
+  static constexpr uint32_t rot_c2 = 13;
+
+  uint32_t h;
+  uint32_t block{0};  // bytes not yet filling a 4-byte block
+  cudf::size_type length{0};
+};
+
+/**
+ * @brief Hashes the ngram that `ngram_generator_fn` would generate for each index.
+ *
+ * The `d_indices` identify the non-empty strings the ngrams are built from.
+ */
+struct ngram_hash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type const* d_indices;
+  cudf::size_type ngrams;
+  cudf::string_view const d_separator;
+  uint32_t seed;
+
+  __device__ cudf::hash_value_type operator()(cudf::size_type idx) const
+  {
+    murmur_hash_stream hasher(seed);
+    for (cudf::size_type n = 0; n < ngrams; ++n) {
+      hasher.add(d_strings.element<cudf::string_view>(d_indices[n + idx]));
+      if ((n + 1) < ngrams) { hasher.add(d_separator); }
+    }
+    return hasher.hash();
+  }
+};
+
+/**
+ * @brief Hashes the character ngrams of each string into the output.
+ */
+struct character_ngram_hash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::size_type ngrams;
+  uint32_t seed;
+  int32_t const* d_ngram_offsets;
+  cudf::hash_value_type* d_hashes;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) return;
+    auto const d_str        = d_strings.element<cudf::string_view>(idx);
+    auto itr                = d_str.begin();
+    auto const ngram_offset = d_ngram_offsets[idx];
+    auto const ngram_count  = d_ngram_offsets[idx + 1] - ngram_offset;
+    auto const hasher       = cudf::detail::MurmurHash3_32<cudf::string_view>{seed};
+    auto d_output           = d_hashes + ngram_offset;
+    for (cudf::size_type n = 0; n < ngram_count; ++n, ++itr) {
+      auto const begin = itr.byte_offset();
+      auto const end   = (itr + ngrams).byte_offset();
+      *d_output++      = hasher(cudf::string_view(d_str.data() + begin, end - begin));
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> hash_ngrams(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::string_scalar const& separator,
+                                          uint32_t seed,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(separator.is_valid(stream), "Parameter separator must be valid");
+  cudf::string_view const d_separator(separator.data(), separator.size());
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  if (strings.is_empty()) { return cudf::make_empty_column(cudf::type_id::UINT32); }
+
+  // nulls and empty strings are skipped just like generate_ngrams
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+  rmm::device_uvector<cudf::size_type> indices(strings.size(), stream);
+  auto const end = thrust::copy_if(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings.size()),
+                                   indices.begin(),
+                                   [d_strings = *d_strings] __device__(cudf::size_type idx) {
+                                     return d_strings.is_valid(idx) &&
+                                            !d_strings.element<cudf::string_view>(idx).empty();
+                                   });
+  auto const strings_count = static_cast<cudf::size_type>(thrust::distance(indices.begin(), end));
+  CUDF_EXPECTS(strings_count >= ngrams, "Insufficient number of strings to generate ngrams");
+
+  // hash the ngrams of the non-empty strings gathered through the indices
+  auto const ngrams_count = strings_count - ngrams + 1;
+  auto hashes             = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          ngrams_count,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(ngrams_count),
+                    hashes->mutable_view().data<cudf::hash_value_type>(),
+                    ngram_hash_fn{*d_strings, indices.data(), ngrams, d_separator, seed});
+  return hashes;
+}
+
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    uint32_t seed,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(ngrams > 1, "Parameter ngrams should be an integer value of 2 or greater");
+
+  auto const strings_count = strings.size();
+  auto const d_strings = cudf::column_device_view::create(strings.parent(), stream);
+
+  // create the list offsets from the number of ngrams in each string
+  auto offsets   = cudf::make_numeric_column(cudf::data_type{cudf::type_id::INT32},
+                                           strings_count + 1,
+                                           cudf::mask_state::UNALLOCATED,
+                                           stream,
+                                           mr);
+  auto d_offsets = offsets->mutable_view().data<int32_t>();
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    d_offsets,
+    [d_strings = *d_strings, strings_count, ngrams] __device__(auto idx) {
+      if ((idx == strings_count) || d_strings.is_null(idx)) return 0;
+      auto const length = d_strings.element<cudf::string_view>(idx).length();
+      return std::max(0, static_cast<int32_t>(length + 1 - ngrams));
+    },
+    cudf::size_type{0},
+    thrust::plus<cudf::size_type>());
+  auto const total_ngrams =
+    cudf::detail::get_value<int32_t>(offsets->view(), strings_count, stream);
+
+  // hash each ngram directly from the string without building the ngram strings
+  auto hashes = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          total_ngrams,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    character_ngram_hash_fn{
+      *d_strings, ngrams, seed, d_offsets, hashes->mutable_view().data<cudf::hash_value_type>()});
+
+  return cudf::make_lists_column(strings_count,
+                                 std::move(offsets),
+                                 std::move(hashes),
+                                 strings.null_count(),
+                                 cudf::detail::copy_bitmask(strings.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> hash_ngrams(cudf::strings_column_view const& strings,
+                                          cudf::size_type ngrams,
+                                          cudf::string_scalar const& separator,
+                                          uint32_t seed,
+                                          rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_ngrams(strings, ngrams, separator, seed, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view const& strings,
+                                                    cudf::size_type ngrams,
+                                                    uint32_t seed,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngrams(strings, ngrams, seed, cudf::default_stream_value, mr);
+}
+
 }  // namespace nvtext
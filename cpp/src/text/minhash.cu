@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nvtext/minhash.hpp>
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/get_value.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/hash_functions.cuh>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+
+#include <limits>
+
+namespace nvtext {
+namespace detail {
+namespace {
+
+/**
+ * @brief Number of threads computing the hashes of each string.
+ */
+constexpr cudf::size_type THREADS_PER_STRING = cudf::detail::warp_size;
+
+__device__ bool is_whitespace(char ch) { return ch <= ' '; }
+
+/**
+ * @brief Compute the minhash values of each string for each seed.
+ *
+ * This executes as `THREADS_PER_STRING` threads per string. Each thread hashes the
+ * n-grams starting at every `THREADS_PER_STRING`-th byte position and the minimum for
+ * each seed is combined into the output with an atomic operation.
+ *
+ * An n-gram is made of `width` consecutive units which are either characters or words.
+ * The output is expected to be initialized to the maximum hash value.
+ */
+struct minhash_fn {
+  cudf::column_device_view const d_strings;
+  cudf::device_span<cudf::hash_value_type const> const seeds;
+  cudf::size_type const width;
+  bool const word_ngrams;
+  cudf::hash_value_type* d_hashes;
+
+  __device__ bool is_unit_begin(cudf::string_view const& d_str, cudf::size_type pos) const
+  {
+    auto const data = d_str.data();
+    if (!word_ngrams) { return cudf::strings::detail::is_begin_utf8_char(data[pos]); }
+    return !is_whitespace(data[pos]) && (pos == 0 || is_whitespace(data[pos - 1]));
+  }
+
+  __device__ cudf::size_type unit_end(cudf::string_view const& d_str, cudf::size_type pos) const
+  {
+    auto const data = d_str.data();
+    auto const size = d_str.size_bytes();
+    ++pos;
+    while (pos < size && (word_ngrams ? !is_whitespace(data[pos])
+                                      : !cudf::strings::detail::is_begin_utf8_char(data[pos]))) {
+      ++pos;
+    }
+    return pos;
+  }
+
+  /**
+   * @brief Returns true if no unit begins before `pos` in the string.
+   */
+  __device__ bool is_first_unit(cudf::string_view const& d_str, cudf::size_type pos) const
+  {
+    if (!word_ngrams) { return pos == 0; }
+    auto const data = d_str.data();
+    while (pos > 0 && is_whitespace(data[pos - 1])) {
+      --pos;
+    }
+    return pos == 0;
+  }
+
+  __device__ void operator()(std::size_t idx) const
+  {
+    auto const str_idx = static_cast<cudf::size_type>(idx / THREADS_PER_STRING);
+    if (d_strings.is_null(str_idx)) { return; }
+    auto const d_str    = d_strings.element<cudf::string_view>(str_idx);
+    auto const size     = d_str.size_bytes();
+    auto const d_output = d_hashes + (static_cast<std::size_t>(str_idx) * seeds.size());
+
+    for (auto pos = static_cast<cudf::size_type>(idx % THREADS_PER_STRING); pos < size;
+         pos += THREADS_PER_STRING) {
+      if (!is_unit_begin(d_str, pos)) { continue; }
+
+      // find the end of the n-gram starting at this unit
+      auto end   = unit_end(d_str, pos);
+      cudf::size_type units = 1;
+      for (auto itr = end; units < width && itr < size;) {
+        if (is_unit_begin(d_str, itr)) {
+          end = unit_end(d_str, itr);
+          itr = end;
+          ++units;
+        } else {
+          ++itr;
+        }
+      }
+      // only the first unit of a string with fewer than width units is hashed
+      if (units < width && !is_first_unit(d_str, pos)) { continue; }
+
+      auto const ngram = cudf::string_view(d_str.data() + pos, end - pos);
+      for (std::size_t seed_idx = 0; seed_idx < seeds.size(); ++seed_idx) {
+        auto const hasher = cudf::detail::MurmurHash3_32<cudf::string_view>{seeds[seed_idx]};
+        atomicMin(d_output + seed_idx, hasher(ngram));
+      }
+    }
+  }
+};
+
+/**
+ * @brief Returns a lists column with `count` values per row as the child `values`.
+ */
+std::unique_ptr<cudf::column> make_fixed_size_lists(std::unique_ptr<cudf::column>&& values,
+                                                    cudf::size_type count,
+                                                    cudf::column_view const& input,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::mr::device_memory_resource* mr)
+{
+  auto offsets = cudf::detail::sequence(input.size() + 1,
+                                        cudf::numeric_scalar<cudf::offset_type>(0),
+                                        cudf::numeric_scalar<cudf::offset_type>(count),
+                                        stream,
+                                        mr);
+  return cudf::make_lists_column(input.size(),
+                                 std::move(offsets),
+                                 std::move(values),
+                                 input.null_count(),
+                                 cudf::detail::copy_bitmask(input, stream, mr),
+                                 stream,
+                                 mr);
+}
+
+std::unique_ptr<cudf::column> minhash_ngrams(cudf::strings_column_view const& input,
+                                             cudf::device_span<cudf::hash_value_type const> seeds,
+                                             cudf::size_type width,
+                                             bool word_ngrams,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(!seeds.empty(), "Parameter seeds cannot be empty");
+  CUDF_EXPECTS(static_cast<std::size_t>(input.size()) * seeds.size() <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "The number of seeds times the number of input rows exceeds the column size limit");
+
+  auto const output_size = static_cast<cudf::size_type>(input.size() * seeds.size());
+  auto hashes           = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
+                                          output_size,
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  auto d_hashes         = hashes->mutable_view().data<cudf::hash_value_type>();
+  thrust::fill_n(rmm::exec_policy(stream),
+                 d_hashes,
+                 output_size,
+                 std::numeric_limits<cudf::hash_value_type>::max());
+
+  auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<std::size_t>(0),
+                     static_cast<std::size_t>(input.size()) * THREADS_PER_STRING,
+                     minhash_fn{*d_strings, seeds, width, word_ngrams, d_hashes});
+
+  return make_fixed_size_lists(
+    std::move(hashes), static_cast<cudf::size_type>(seeds.size()), input.parent(), stream, mr);
+}
+
+/**
+ * @brief Compute the bucket ID of each band of each row.
+ */
+struct buckets_fn {
+  uint32_t const* d_values;
+  cudf::size_type const bands;
+  cudf::size_type const band_size;
+
+  __device__ uint64_t operator()(cudf::size_type idx) const
+  {
+    auto const band   = idx % bands;
+    auto const values = d_values + (static_cast<std::size_t>(idx) * band_size);
+    // the band index seeds the hash so equal values in different bands differ
+    auto hash = static_cast<uint32_t>(band);
+    for (cudf::size_type i = 0; i < band_size; ++i) {
+      hash = cudf::detail::MurmurHash3_32<uint32_t>{hash}(values[i]);
+    }
+    return (static_cast<uint64_t>(band) << 32) | hash;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
+                                      cudf::device_span<cudf::hash_value_type const> seeds,
+                                      cudf::size_type width,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width >= 2, "Parameter width should be an integer value of 2 or greater");
+  return minhash_ngrams(input, seeds, width, false, stream, mr);
+}
+
+std::unique_ptr<cudf::column> word_minhash(cudf::strings_column_view const& input,
+                                           cudf::device_span<cudf::hash_value_type const> seeds,
+                                           cudf::size_type width,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(width >= 1, "Parameter width should be an integer value of 1 or greater");
+  return minhash_ngrams(input, seeds, width, true, stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_buckets(cudf::lists_column_view const& signatures,
+                                              cudf::size_type bands,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(signatures.child().type().id() == cudf::type_id::UINT32,
+               "signatures must be a lists column of UINT32 values");
+  CUDF_EXPECTS(bands > 0, "Parameter bands must be positive");
+  auto const rows = signatures.size();
+  if (rows == 0) {
+    return make_fixed_size_lists(
+      cudf::make_empty_column(cudf::type_id::UINT64), bands, signatures.parent(), stream, mr);
+  }
+
+  // every row must have the same number of values
+  auto const d_offsets = signatures.offsets_begin();
+  auto const first =
+    cudf::detail::get_value<cudf::offset_type>(signatures.offsets(), signatures.offset(), stream);
+  auto const last = cudf::detail::get_value<cudf::offset_type>(
+    signatures.offsets(), signatures.offset() + rows, stream);
+  CUDF_EXPECTS((last - first) % rows == 0, "signatures must have the same number of values");
+  auto const row_size = (last - first) / rows;
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              thrust::make_counting_iterator<cudf::size_type>(0),
+                              thrust::make_counting_iterator<cudf::size_type>(rows),
+                              [d_offsets, row_size] __device__(auto idx) {
+                                return d_offsets[idx + 1] - d_offsets[idx] == row_size;
+                              }),
+               "signatures must have the same number of values");
+  CUDF_EXPECTS(row_size % bands == 0, "bands must evenly divide the number of signature values");
+
+  auto const output_size = rows * bands;
+  auto buckets           = cudf::make_numeric_column(
+    cudf::data_type{cudf::type_id::UINT64}, output_size, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto const d_values = signatures.child().data<uint32_t>() + first;
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<cudf::size_type>(0),
+                    thrust::make_counting_iterator<cudf::size_type>(output_size),
+                    buckets->mutable_view().data<uint64_t>(),
+                    buckets_fn{d_values, bands, row_size / bands});
+
+  return make_fixed_size_lists(std::move(buckets), bands, signatures.parent(), stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
+                                      cudf::device_span<cudf::hash_value_type const> seeds,
+                                      cudf::size_type width,
+                                      rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash(input, seeds, width, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<cudf::column> word_minhash(cudf::strings_column_view const& input,
+                                           cudf::device_span<cudf::hash_value_type const> seeds,
+                                           cudf::size_type width,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::word_minhash(input, seeds, width, cudf::default_stream_value, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_buckets(cudf::lists_column_view const& signatures,
+                                              cudf::size_type bands,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_buckets(signatures, bands, cudf::default_stream_value, mr);
+}
+
+}  // namespace nvtext
@@ -31,16 +31,21 @@
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/detail/utilities.hpp>
+#include <cudf/strings/detail/utf8.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform_reduce.h>
+#include <thrust/transform_scan.h>
 
 #include <limits>
 
@@ -168,6 +173,116 @@ struct codepoint_to_utf8_fn {
   }
 };
 
+/**
+ * @brief Locates the whitespace-delimited tokens in each string's normalized code-points.
+ *
+ * This functor returns the number of tokens in each string when `d_token_positions`
+ * is not set. Otherwise, it records the code-point positions of each token.
+ */
+struct codepoint_tokens_fn {
+  cudf::column_device_view const d_strings;  // input strings
+  uint32_t const* cp_data;                   // full code-point array
+  int32_t const* d_cp_offsets;               // offsets to each string's code-point array
+  int32_t const* d_token_offsets{};          // offsets into d_token_positions for each string
+  position_pair* d_token_positions{};        // token positions in cp_data
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return 0; }
+    auto positions = d_token_positions ? d_token_positions + d_token_offsets[idx] : nullptr;
+    cudf::size_type count = 0;
+    cudf::size_type begin = -1;  // start of the current token
+    for (auto pos = d_cp_offsets[idx]; pos <= d_cp_offsets[idx + 1]; ++pos) {
+      // the normalizer has already changed all the whitespace to spaces
+      auto const is_space = (pos == d_cp_offsets[idx + 1]) || (cp_data[pos] <= ' ');
+      if (!is_space && begin < 0) { begin = pos; }
+      if (is_space && begin >= 0) {
+        if (positions) { positions[count] = position_pair{begin, pos}; }
+        ++count;
+        begin = -1;
+      }
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Builds the ngrams of the tokens found by `codepoint_tokens_fn` for each string.
+ *
+ * This is the same as the `ngram_builder_fn` used by `ngrams_tokenize` except the tokens
+ * are converted from code-points to UTF-8 as they are written to the output.
+ *
+ * This functor can be called to compute the size of memory needed to write out
+ * each set of ngrams per string. Once the memory offsets (d_chars_offsets) are
+ * set and the output memory is allocated (d_chars), the ngrams for each string
+ * can be generated into the output buffer.
+ */
+struct codepoint_ngram_builder_fn {
+  uint32_t const* cp_data;                 // full code-point array
+  cudf::string_view const d_separator;     // separator to place between them 'grams
+  cudf::size_type ngrams;                  // ngram number to generate (1=tokens, 2=bi-gram)
+  int32_t const* d_token_offsets;          // offsets for token position for each string
+  position_pair const* d_token_positions;  // token positions for each string
+  int32_t const* d_chars_offsets{};        // offsets for each string's ngrams
+  char* d_chars{};                         // write ngram strings to here
+  int32_t const* d_ngram_offsets{};        // offsets for sizes of each string's ngrams
+  int32_t* d_ngram_sizes{};                // write ngram sizes to here
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    auto token_positions        = d_token_positions + d_token_offsets[idx];
+    auto token_count            = d_token_offsets[idx + 1] - d_token_offsets[idx];
+    cudf::size_type nbytes      = 0;  // total number of output bytes needed for this string
+    cudf::size_type ngram_index = 0;
+    char* out_ptr               = d_chars ? d_chars + d_chars_offsets[idx] : nullptr;
+    int32_t* d_sizes            = d_ngram_sizes ? d_ngram_sizes + d_ngram_offsets[idx] : nullptr;
+    for (cudf::size_type token_index = (ngrams - 1); token_index < token_count; ++token_index) {
+      cudf::size_type length = 0;  // calculate size of each ngram in bytes
+      for (cudf::size_type n = (ngrams - 1); n >= 0; --n) {
+        auto const item = token_positions[token_index - n];
+        for (auto pos = item.first; pos < item.second; ++pos) {
+          auto const chr   = cudf::strings::detail::codepoint_to_utf8(cp_data[pos]);
+          auto const width = out_ptr ? cudf::strings::detail::from_char_utf8(chr, out_ptr)
+                                     : cudf::strings::detail::bytes_in_char_utf8(chr);
+          if (out_ptr) { out_ptr += width; }
+          length += width;
+        }
+        if (n > 0) {  // include the separator (except for the last one)
+          if (out_ptr) { out_ptr = cudf::strings::detail::copy_string(out_ptr, d_separator); }
+          length += d_separator.size_bytes();
+        }
+      }
+      if (d_sizes) { d_sizes[ngram_index++] = length; }
+      nbytes += length;
+    }
+    return nbytes;
+  }
+};
+
+/**
+ * @brief Runs the character normalizer over the input strings.
+ *
+ * @return The normalized code-points and the offsets to each string's code-points
+ */
+uvector_pair normalize_codepoints(cudf::strings_column_view const& strings,
+                                  bool do_lower_case,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const cp_metadata = get_codepoint_metadata(stream);
+  auto const aux_table   = get_aux_codepoint_data(stream);
+  auto const normalizer  = data_normalizer(cp_metadata.data(), aux_table.data(), do_lower_case);
+  auto const offsets     = strings.offsets();
+  auto const d_offsets   = offsets.data<uint32_t>() + strings.offset();
+  auto const offset      = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
+  auto const d_chars     = strings.chars().data<char>() + offset;
+  auto result            = normalizer.normalize(d_chars, d_offsets, strings.size(), stream);
+
+  CUDF_EXPECTS(
+    result.first->size() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+    "output too large for strings column");
+  return result;
+}
+
 }  // namespace
 
 // detail API
@@ -203,20 +318,7 @@ std::unique_ptr<cudf::column> normalize_characters(cudf::strings_column_view con
   if (strings.is_empty()) return cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
 
   // create the normalizer and call it
-  auto result = [&] {
-    auto const cp_metadata = get_codepoint_metadata(stream);
-    auto const aux_table   = get_aux_codepoint_data(stream);
-    auto const normalizer  = data_normalizer(cp_metadata.data(), aux_table.data(), do_lower_case);
-    auto const offsets     = strings.offsets();
-    auto const d_offsets   = offsets.data<uint32_t>() + strings.offset();
-    auto const offset      = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
-    auto const d_chars     = strings.chars().data<char>() + offset;
-    return normalizer.normalize(d_chars, d_offsets, strings.size(), stream);
-  }();
-
-  CUDF_EXPECTS(
-    result.first->size() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
-    "output too large for strings column");
+  auto const result = normalize_codepoints(strings, do_lower_case, stream);
 
   // convert the result into a strings column
   // - the cp_chars are the new 4-byte code-point values for all the characters in the output
@@ -237,6 +339,102 @@ std::unique_ptr<cudf::column> normalize_characters(cudf::strings_column_view con
                                    cudf::detail::copy_bitmask(strings.parent(), stream, mr));
 }
 
+/**
+ * @copydoc nvtext::normalize_and_tokenize
+ */
+std::unique_ptr<cudf::column> normalize_and_tokenize(cudf::strings_column_view const& strings,
+                                                     bool do_lower_case,
+                                                     cudf::size_type ngrams,
+                                                     cudf::string_scalar const& separator,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_EXPECTS(separator.is_valid(stream), "Parameter separator must be valid");
+  cudf::string_view d_separator(separator.data(), separator.size());
+  CUDF_EXPECTS(ngrams >= 1, "Parameter ngrams should be an integer value of 1 or greater");
+  if (strings.is_empty()) return cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  auto const strings_count = strings.size();
+
+  // the tokens are located directly in the normalized code-points
+  auto const result         = normalize_codepoints(strings, do_lower_case, stream);
+  uint32_t const* cp_chars  = result.first->data();
+  int32_t const* cp_offsets = reinterpret_cast<int32_t const*>(result.second->data());
+
+  auto d_strings = cudf::column_device_view::create(strings.parent(), stream);
+
+  // get the number of tokens per string to get the token-offsets
+  rmm::device_uvector<int32_t> token_offsets(strings_count + 1, stream);
+  auto d_token_offsets = token_offsets.data();
+  thrust::transform_inclusive_scan(rmm::exec_policy(stream),
+                                   thrust::make_counting_iterator<cudf::size_type>(0),
+                                   thrust::make_counting_iterator<cudf::size_type>(strings_count),
+                                   d_token_offsets + 1,
+                                   codepoint_tokens_fn{*d_strings, cp_chars, cp_offsets},
+                                   thrust::plus<int32_t>());
+  token_offsets.set_element_to_zero_async(0, stream);
+  auto const total_tokens = token_offsets.back_element(stream);
+
+  // get the token positions (in code-points) per string
+  rmm::device_uvector<position_pair> token_positions(total_tokens, stream);
+  auto d_token_positions = token_positions.data();
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    strings_count,
+    codepoint_tokens_fn{*d_strings, cp_chars, cp_offsets, d_token_offsets, d_token_positions});
+
+  // compute the number of ngrams per string to get the total number of ngrams to generate
+  rmm::device_uvector<int32_t> ngram_offsets(strings_count + 1, stream);
+  auto d_ngram_offsets = ngram_offsets.data();
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+    d_ngram_offsets + 1,
+    [d_token_offsets, ngrams] __device__(cudf::size_type idx) {
+      auto token_count = d_token_offsets[idx + 1] - d_token_offsets[idx];
+      return (token_count >= ngrams) ? token_count - ngrams + 1 : 0;
+    },
+    thrust::plus<int32_t>());
+  ngram_offsets.set_element_to_zero_async(0, stream);
+  auto const total_ngrams = ngram_offsets.back_element(stream);
+
+  // compute the total size of the ngrams for each string to locate their output memory
+  rmm::device_uvector<int32_t> chars_offsets(strings_count + 1, stream);
+  auto d_chars_offsets = chars_offsets.data();
+  thrust::transform_inclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count),
+    d_chars_offsets + 1,
+    codepoint_ngram_builder_fn{cp_chars, d_separator, ngrams, d_token_offsets, d_token_positions},
+    thrust::plus<int32_t>());
+  chars_offsets.set_element_to_zero_async(0, stream);
+  auto const output_chars_size = chars_offsets.back_element(stream);
+
+  // generate the ngrams into the chars column while recording the size of each ngram
+  rmm::device_uvector<int32_t> ngram_sizes(total_ngrams, stream);
+  auto chars_column =
+    cudf::strings::detail::create_chars_child_column(output_chars_size, stream, mr);
+  thrust::for_each_n(rmm::exec_policy(stream),
+                     thrust::make_counting_iterator<cudf::size_type>(0),
+                     strings_count,
+                     codepoint_ngram_builder_fn{cp_chars,
+                                                d_separator,
+                                                ngrams,
+                                                d_token_offsets,
+                                                d_token_positions,
+                                                d_chars_offsets,
+                                                chars_column->mutable_view().data<char>(),
+                                                d_ngram_offsets,
+                                                ngram_sizes.data()});
+
+  auto offsets_column = cudf::strings::detail::make_offsets_child_column(
+    ngram_sizes.begin(), ngram_sizes.end(), stream, mr);
+  return cudf::make_strings_column(
+    total_ngrams, std::move(offsets_column), std::move(chars_column), 0, rmm::device_buffer{});
+}
+
 }  // namespace detail
 
 // external APIs
@@ -259,4 +457,18 @@ std::unique_ptr<cudf::column> normalize_characters(cudf::strings_column_view con
   return detail::normalize_characters(strings, do_lower_case, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc nvtext::normalize_and_tokenize
+ */
+std::unique_ptr<cudf::column> normalize_and_tokenize(cudf::strings_column_view const& strings,
+                                                     bool do_lower_case,
+                                                     cudf::size_type ngrams,
+                                                     cudf::string_scalar const& separator,
+                                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::normalize_and_tokenize(
+    strings, do_lower_case, ngrams, separator, cudf::default_stream_value, mr);
+}
+
 }  // namespace nvtext
@@ -22,6 +22,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/hash_functions.cuh>
 #include <cudf/strings/detail/combine.hpp>
 #include <cudf/strings/detail/utilities.cuh>
@@ -46,6 +47,8 @@
 #include <thrust/scan.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+
 namespace nvtext {
 namespace detail {
 
@@ -76,6 +79,15 @@ __device__ cudf::string_view get_first_token(cudf::string_view const& d_str)
   return cudf::string_view(begin, size);
 }
 
+/**
+ * @brief Tokens with more bytes than this are encoded by a warp instead of a single thread.
+ *
+ * Each pass over a token computes the rank of every adjacent pair so the work per token
+ * grows quadratically with its size. A few long tokens would otherwise stall the threads
+ * encoding the much shorter tokens around them.
+ */
+constexpr cudf::size_type LONG_TOKEN_THRESHOLD = 64;
+
 /**
  * @brief Main byte pair encoding algorithm function for each string.
  *
@@ -170,6 +182,142 @@ struct byte_pair_encoding_fn {
     return hasher(d_hash_str);  // return the hash for the temp string
   }
 
+  /**
+   * @brief Return the rank of the merge pair formed by `lhs` and `rhs`.
+   *
+   * @return The rank or the max value of cudf::size_type if the pair is not in `d_map`
+   */
+  __device__ cudf::size_type get_rank(cudf::string_view const& lhs, cudf::string_view const& rhs)
+  {
+    auto const map_itr = d_map.find(compute_hash(lhs, rhs));
+    return map_itr != d_map.end() ? static_cast<cudf::size_type>(map_itr->second)
+                                  : cuda::std::numeric_limits<cudf::size_type>::max();
+  }
+
+  /**
+   * @brief Remove every occurrence of the merge pair `min_rank` from the string.
+   *
+   * The first occurrence is at `min_itr` and occurrences are removed left to right
+   * so a pair overlapping a removed pair is not removed.
+   *
+   * @param begin Start of the byte indices for the string
+   * @param end End of the byte indices for the string
+   * @param d_str The string being encoded
+   * @param min_itr Position of the right half of the first occurrence of the pair
+   * @param min_size Number of bytes in the right half of the first occurrence of the pair
+   * @param min_rank Rank of the merge pair to remove
+   */
+  template <typename Iterator>
+  __device__ void remove_pairs(Iterator begin,
+                               Iterator end,
+                               cudf::string_view const& d_str,
+                               Iterator min_itr,
+                               cudf::size_type min_size,
+                               cudf::size_type min_rank)
+  {
+    // remove the first pair we found
+    auto itr = min_itr;
+    *itr     = 0;
+
+    // continue scanning for other occurrences in the remainder of the string
+    itr += min_size;
+    if (itr >= end) { return; }
+
+    auto const d_pair = dissect_merge_pair(min_rank);
+
+    auto lhs = next_substr(itr, end, d_str);
+    itr += lhs.size_bytes();
+    while (itr < end) {
+      auto rhs = next_substr(itr, end, d_str);
+      if (d_pair.first == lhs && d_pair.second == rhs) {
+        *itr = 0;  // removes the pair from this string
+        itr += rhs.size_bytes();
+        if (itr >= end) { break; }  // done checking for pairs
+        // skip to the next adjacent pair
+        rhs = next_substr(itr, end, d_str);
+      }
+      // next substring
+      lhs = rhs;
+      itr += rhs.size_bytes();
+    }
+  }
+
+  /**
+   * @brief Byte encode a long string using all the threads of a warp.
+   *
+   * This produces the same encoding as the operator() below. In each pass the lanes compute
+   * the ranks of all the adjacent pairs in parallel and the minimum rank is found with a warp
+   * reduction. The first lane then removes the occurrences of that pair.
+   *
+   * All the threads of the warp must call this function with the same `idx`.
+   *
+   * @param idx The index of the string in `d_strings` to encode
+   * @param lane The thread's lane within the warp
+   */
+  __device__ void encode_warp(cudf::size_type idx, cudf::size_type lane)
+  {
+    if (d_strings.is_null(idx)) { return; }  // output size is set by operator()
+    auto const d_str = get_first_token(d_strings.element<cudf::string_view>(idx));
+
+    auto const offset = d_strings.child(cudf::strings_column_view::offsets_column_index)
+                          .element<cudf::offset_type>(idx);
+    auto const d_indices = d_byte_indices + offset;
+    auto const size      = d_str.size_bytes();
+
+    for (auto pos = lane; pos < size; pos += cudf::detail::warp_size) {
+      auto const byte = static_cast<uint8_t>(d_str.data()[pos]);
+      d_indices[pos]  = cudf::strings::detail::is_begin_utf8_char(byte) ? pos : 0;
+    }
+    __syncwarp();
+
+    auto const begin = d_indices;
+    auto const end   = d_indices + size;
+
+    // the rank and position of a pair are combined so the minimum rank and
+    // the first position with that rank are found with a single reduction
+    auto const no_pair = cuda::std::numeric_limits<uint64_t>::max();
+    while (true) {
+      auto min_pair = no_pair;
+      // each lane checks the pairs whose right half starts at its positions
+      for (auto pos = lane; pos < size; pos += cudf::detail::warp_size) {
+        if (pos == 0 || d_indices[pos] == 0) { continue; }
+        auto lhs_pos = pos - 1;
+        while (lhs_pos > 0 && d_indices[lhs_pos] == 0) {
+          --lhs_pos;
+        }
+        auto const lhs  = cudf::string_view(d_str.data() + lhs_pos, pos - lhs_pos);
+        auto const rhs  = next_substr(begin + pos, end, d_str);
+        auto const rank = get_rank(lhs, rhs);
+        if (rank < cuda::std::numeric_limits<cudf::size_type>::max()) {
+          auto const pair = (static_cast<uint64_t>(rank) << 32) | static_cast<uint32_t>(pos);
+          min_pair        = std::min(min_pair, pair);
+        }
+      }
+      for (auto delta = cudf::detail::warp_size / 2; delta > 0; delta /= 2) {
+        min_pair = std::min(min_pair, __shfl_xor_sync(0xffffffff, min_pair, delta));
+      }
+      if (min_pair == no_pair) { break; }  // no more adjacent pairs found in d_map
+
+      if (lane == 0) {
+        auto const min_rank = static_cast<cudf::size_type>(min_pair >> 32);
+        auto const min_itr  = begin + static_cast<cudf::size_type>(min_pair & 0xffffffff);
+        auto const min_size = next_substr(min_itr, end, d_str).size_bytes();
+        remove_pairs(begin, end, d_str, min_itr, min_size, min_rank);
+      }
+      __syncwarp();
+    }
+
+    // compute and store the output size for this string's encoding
+    cudf::size_type count = 0;
+    for (auto pos = lane; pos < size; pos += cudf::detail::warp_size) {
+      count += (d_indices[pos] != 0);
+    }
+    for (auto delta = cudf::detail::warp_size / 2; delta > 0; delta /= 2) {
+      count += __shfl_xor_sync(0xffffffff, count, delta);
+    }
+    if (lane == 0) { d_sizes[idx] = size + count; }
+  }
+
   /**
    * @brief Byte encode each string.
    *
@@ -185,6 +333,9 @@ struct byte_pair_encoding_fn {
    * by simply counting the number of non-zero indices values remaining. This saves
    * an extra kernel launch normally required to compute the offsets of the output column.
    *
+   * Strings longer than `LONG_TOKEN_THRESHOLD` bytes are skipped since they are
+   * encoded by `encode_warp` instead.
+   *
    * @param idx The index of the string in `d_strings` to encode
    */
   __device__ void operator()(cudf::size_type idx)
@@ -193,7 +344,9 @@ struct byte_pair_encoding_fn {
       d_sizes[idx] = 0;
       return;
     }
-    auto const d_str = get_first_token(d_strings.element<cudf::string_view>(idx));
+    auto const d_token = d_strings.element<cudf::string_view>(idx);
+    if (d_token.size_bytes() > LONG_TOKEN_THRESHOLD) { return; }
+    auto const d_str = get_first_token(d_token);
     if (d_str.empty()) {
       d_sizes[idx] = 0;
       return;
@@ -234,16 +387,12 @@ struct byte_pair_encoding_fn {
         auto const rhs = next_substr(itr, end, d_str);
         if (rhs.empty()) break;  // no more adjacent pairs
 
-        auto const hash    = compute_hash(lhs, rhs);
-        auto const map_itr = d_map.find(hash);
-        if (map_itr != d_map.end()) {
-          // found a match; record the rank (and other min_ vars)
-          auto const rank = static_cast<cudf::size_type>(map_itr->second);
-          if (rank < min_rank) {
-            min_rank = rank;
-            min_itr  = itr;
-            min_size = rhs.size_bytes();
-          }
+        // record the rank (and other min_ vars) of the lowest ranked match
+        auto const rank = get_rank(lhs, rhs);
+        if (rank < min_rank) {
+          min_rank = rank;
+          min_itr  = itr;
+          min_size = rhs.size_bytes();
         }
         // next substring
         lhs = rhs;
@@ -252,31 +401,7 @@ struct byte_pair_encoding_fn {
 
       // if any pair matched, remove every occurrence from the string
       if (min_rank < cuda::std::numeric_limits<cudf::size_type>::max()) {
-        // remove the first pair we found
-        itr  = min_itr;
-        *itr = 0;
-
-        // continue scanning for other occurrences in the remainder of the string
-        itr += min_size;
-        if (itr < end) {
-          auto const d_pair = dissect_merge_pair(min_rank);
-
-          lhs = next_substr(itr, end, d_str);
-          itr += lhs.size_bytes();
-          while (itr < end) {
-            auto rhs = next_substr(itr, end, d_str);
-            if (d_pair.first == lhs && d_pair.second == rhs) {
-              *itr = 0;  // removes the pair from this string
-              itr += rhs.size_bytes();
-              if (itr >= end) { break; }  // done checking for pairs
-              // skip to the next adjacent pair
-              rhs = next_substr(itr, end, d_str);
-            }
-            // next substring
-            lhs = rhs;
-            itr += rhs.size_bytes();
-          }
-        }
+        remove_pairs(begin, end, d_str, min_itr, min_size, min_rank);
       }
     }
 
@@ -291,6 +416,23 @@ struct byte_pair_encoding_fn {
   }
 };
 
+/**
+ * @brief Encode the long strings identified by `d_long_indices` with a warp per string.
+ *
+ * @param fn The encoding function for all the strings
+ * @param d_long_indices Indices of the strings to encode
+ * @param long_count Number of strings to encode
+ */
+__global__ void byte_pair_encoding_long_kernel(byte_pair_encoding_fn fn,
+                                               cudf::size_type const* d_long_indices,
+                                               cudf::size_type long_count)
+{
+  auto const tid      = static_cast<cudf::size_type>(threadIdx.x + blockIdx.x * blockDim.x);
+  auto const warp_idx = tid / cudf::detail::warp_size;
+  if (warp_idx >= long_count) { return; }
+  fn.encode_warp(d_long_indices[warp_idx], tid % cudf::detail::warp_size);
+}
+
 /**
  * @brief Build the output string encoding.
  *
@@ -379,6 +521,19 @@ std::unique_ptr<cudf::column> byte_pair_encoding(
   thrust::for_each_n(
     rmm::exec_policy(stream), thrust::make_counting_iterator<cudf::size_type>(0), input.size(), fn);
 
+  // the long strings skipped above are encoded using a warp per string
+  auto const long_indices =
+    cudf::strings::detail::get_long_string_indices(input, LONG_TOKEN_THRESHOLD, stream);
+  if (!long_indices.is_empty()) {
+    auto const long_count    = static_cast<cudf::size_type>(long_indices.size());
+    constexpr int block_size = 256;
+    cudf::detail::grid_1d const grid{long_count * cudf::detail::warp_size, block_size};
+    byte_pair_encoding_long_kernel<<<grid.num_blocks,
+                                     grid.num_threads_per_block,
+                                     0,
+                                     stream.value()>>>(fn, long_indices.data(), long_count);
+  }
+
   // build the output: add spaces between the remaining pairs in each string
   thrust::exclusive_scan(
     rmm::exec_policy(stream), d_offsets, d_offsets + input.size() + 1, d_offsets);
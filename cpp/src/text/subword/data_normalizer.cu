@@ -275,15 +275,17 @@ data_normalizer::data_normalizer(codepoint_metadata_type const* cp_metadata,
 uvector_pair data_normalizer::normalize(char const* d_strings,
                                         uint32_t const* d_offsets,
                                         uint32_t num_strings,
-                                        rmm::cuda_stream_view stream) const
+                                        rmm::cuda_stream_view stream,
+                                        rmm::mr::device_memory_resource* mr) const
 {
   if (num_strings == 0)
-    return std::pair(std::make_unique<rmm::device_uvector<uint32_t>>(0, stream),
-                     std::make_unique<rmm::device_uvector<uint32_t>>(0, stream));
+    return std::pair(std::make_unique<rmm::device_uvector<uint32_t>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<uint32_t>>(0, stream, mr));
 
   // copy offsets to working memory
   size_t const num_offsets = num_strings + 1;
-  auto d_strings_offsets   = std::make_unique<rmm::device_uvector<uint32_t>>(num_offsets, stream);
+  auto d_strings_offsets =
+    std::make_unique<rmm::device_uvector<uint32_t>>(num_offsets, stream, mr);
   thrust::transform(rmm::exec_policy(stream),
                     thrust::make_counting_iterator<uint32_t>(0),
                     thrust::make_counting_iterator<uint32_t>(num_offsets),
@@ -294,15 +296,16 @@ uvector_pair data_normalizer::normalize(char const* d_strings,
                     });
   uint32_t const bytes_count = d_strings_offsets->element(num_strings, stream);
   if (bytes_count == 0)  // if no bytes, nothing to do
-    return std::pair(std::make_unique<rmm::device_uvector<uint32_t>>(0, stream),
-                     std::make_unique<rmm::device_uvector<uint32_t>>(0, stream));
+    return std::pair(std::make_unique<rmm::device_uvector<uint32_t>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<uint32_t>>(0, stream, mr));
 
   cudf::detail::grid_1d const grid{static_cast<cudf::size_type>(bytes_count), THREADS_PER_BLOCK, 1};
   size_t const threads_on_device  = grid.num_threads_per_block * grid.num_blocks;
   size_t const max_new_char_total = MAX_NEW_CHARS * threads_on_device;
 
-  auto d_code_points = std::make_unique<rmm::device_uvector<uint32_t>>(max_new_char_total, stream);
-  rmm::device_uvector<uint32_t> d_chars_per_thread(threads_on_device, stream);
+  auto d_code_points =
+    std::make_unique<rmm::device_uvector<uint32_t>>(max_new_char_total, stream, mr);
+  rmm::device_uvector<uint32_t> d_chars_per_thread(threads_on_device, stream, mr);
 
   kernel_data_normalizer<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
     reinterpret_cast<const unsigned char*>(d_strings),
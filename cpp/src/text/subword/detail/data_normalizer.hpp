@@ -20,6 +20,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 using uvector_pair = std::pair<std::unique_ptr<rmm::device_uvector<uint32_t>>,
                                std::unique_ptr<rmm::device_uvector<uint32_t>>>;
@@ -80,14 +81,17 @@ class data_normalizer {
    *        the `d_strings` parameter.
    * @param num_strings The number of strings identified in `d_strings`.
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned and working memory.
    * @return Two pointers to GPU data buffers. The first is a pointer
    *         to the code points array and the second is a pointer to the offsets
    *         used to locate the code points for each string.
    */
-  uvector_pair normalize(char const* d_strings,
-                         uint32_t const* d_offsets,
-                         uint32_t num_strings,
-                         rmm::cuda_stream_view stream) const;
+  uvector_pair normalize(
+    char const* d_strings,
+    uint32_t const* d_offsets,
+    uint32_t num_strings,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource()) const;
 
  private:
   bool const do_lower_case;
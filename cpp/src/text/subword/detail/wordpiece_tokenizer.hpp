@@ -19,6 +19,7 @@
 #include <text/subword/detail/data_normalizer.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 
 namespace nvtext {
 
@@ -83,12 +84,15 @@ class wordpiece_tokenizer {
    *        the `d_strings` parameter.
    * @param num_strings The number of strings in `d_strings`.
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned and working memory.
    * @return Pointer to token-ids and token-id offsets
    */
-  uvector_pair tokenize(char const* d_strings,
-                        uint32_t const* d_offsets,
-                        uint32_t num_strings,
-                        rmm::cuda_stream_view stream);
+  uvector_pair tokenize(
+    char const* d_strings,
+    uint32_t const* d_offsets,
+    uint32_t num_strings,
+    rmm::cuda_stream_view stream,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_current_device_resource());
 
  private:
   /**
@@ -99,8 +103,11 @@ class wordpiece_tokenizer {
    *        The data is modified to contain the token ids and token counts
    *        per string.
    * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the working memory.
    */
-  void tokenize(uvector_pair& cps_and_offsets, rmm::cuda_stream_view stream);
+  void tokenize(uvector_pair& cps_and_offsets,
+                rmm::cuda_stream_view stream,
+                rmm::mr::device_memory_resource* mr);
 
   hashed_vocabulary const& vocab_table;
   data_normalizer normalizer;  // removes punctuation, accents, etc
@@ -18,6 +18,7 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -27,6 +28,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
 
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
@@ -125,50 +127,47 @@ __global__ void kernel_compute_tensor_metadata(
   }
 }
 
-}  // namespace
+/**
+ * @brief The output tensor rows computed from the tokens of each string.
+ */
+struct tensor_rows {
+  uvector_pair tokens;                                  ///< token-ids and their offsets per string
+  rmm::device_uvector<uint32_t> row2tensor;             ///< string index of each output row
+  rmm::device_uvector<uint32_t> row2row_within_tensor;  ///< row index within each string
 
-tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
-                                  hashed_vocabulary const& vocab_table,
-                                  uint32_t max_sequence_length,
-                                  uint32_t stride,
-                                  bool do_lower_case,
-                                  bool do_truncate,
-                                  uint32_t max_rows_tensor,
-                                  rmm::cuda_stream_view stream,
-                                  rmm::mr::device_memory_resource* mr)
+  [[nodiscard]] uint32_t size() const { return static_cast<uint32_t>(row2tensor.size()); }
+};
+
+/**
+ * @brief Tokenize the strings and compute which string goes with each output row.
+ *
+ * All memory is allocated using `mr` and is only needed until the output tensors are built.
+ */
+tensor_rows tokenize_rows(cudf::strings_column_view const& strings,
+                          wordpiece_tokenizer& tokenizer,
+                          uint32_t max_sequence_length,
+                          uint32_t stride,
+                          bool do_truncate,
+                          rmm::cuda_stream_view stream,
+                          rmm::mr::device_memory_resource* mr)
 {
-  CUDF_EXPECTS(stride <= max_sequence_length,
-               "stride must be less than or equal to max_sequence_length");
-  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
-                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
-               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
   auto const strings_count = strings.size();
-  if (strings_count == 0 || strings.chars_size() == 0)
-    return tokenizer_result{0,
-                            max_sequence_length,
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
-                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
 
   auto const offsets   = strings.offsets();
   auto const d_offsets = offsets.data<uint32_t>() + strings.offset();
   auto const offset    = cudf::detail::get_value<int32_t>(offsets, strings.offset(), stream);
   auto const d_chars   = strings.chars().data<char>() + offset;
 
-  // Create tokenizer
-  wordpiece_tokenizer tokenizer(
-    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case);
   // Run tokenizer
-  auto const tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream);
+  auto tokens = tokenizer.tokenize(d_chars, d_offsets, strings_count, stream, mr);
   // assign output components
-  uint32_t const* device_token_ids = tokens.first->data();
-  uint32_t const* device_offsets   = tokens.second->data();
+  uint32_t const* device_offsets = tokens.second->data();
 
   // Format output from tokenizer
   // Each string can create 1 or more tensor entries.
   // Compute the string-per-tensor offsets values by scanning
   // over the number of tokens for each string.
-  rmm::device_uvector<uint32_t> offsets_per_tensor(strings_count + 1, stream);
+  rmm::device_uvector<uint32_t> offsets_per_tensor(strings_count + 1, stream, mr);
   auto d_offsets_per_tensor = offsets_per_tensor.data();
 
   thrust::transform_exclusive_scan(
@@ -189,9 +188,9 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
   uint32_t const nrows_tensor_token_ids = offsets_per_tensor.element(strings_count, stream);
 
   // compute global_row to tensor, and global_row to within_tensor_row correspondence
-  rmm::device_uvector<uint32_t> row2tensor(nrows_tensor_token_ids, stream);
+  rmm::device_uvector<uint32_t> row2tensor(nrows_tensor_token_ids, stream, mr);
   auto d_row2tensor = row2tensor.data();
-  rmm::device_uvector<uint32_t> row2row_within_tensor(nrows_tensor_token_ids, stream);
+  rmm::device_uvector<uint32_t> row2row_within_tensor(nrows_tensor_token_ids, stream, mr);
   auto d_row2row_within_tensor = row2row_within_tensor.data();
   thrust::for_each_n(
     rmm::exec_policy(stream),
@@ -206,6 +205,101 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
       }
     });
 
+  return tensor_rows{std::move(tokens), std::move(row2tensor), std::move(row2row_within_tensor)};
+}
+
+/**
+ * @brief Write the final token-ids, attention mask, and metadata for the given rows.
+ */
+void compute_tensors(tensor_rows const& rows,
+                     uint32_t max_sequence_length,
+                     uint32_t stride,
+                     bool do_truncate,
+                     uint32_t* tensor_token_ids,
+                     uint32_t* tensor_attention_mask,
+                     uint32_t* tensor_metadata,
+                     rmm::cuda_stream_view stream)
+{
+  uint32_t const nrows_tensor_token_ids = rows.size();
+
+  // compute final-tensor, mask, and metadata
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{
+    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
+  kernel_compute_tensor_metadata<<<grid.num_blocks,
+                                   grid.num_threads_per_block,
+                                   0,
+                                   stream.value()>>>(rows.tokens.first->data(),
+                                                     rows.tokens.second->data(),
+                                                     rows.row2tensor.data(),
+                                                     rows.row2row_within_tensor.data(),
+                                                     max_sequence_length,
+                                                     nrows_tensor_token_ids,
+                                                     stride,
+                                                     do_truncate,
+                                                     tensor_token_ids,
+                                                     tensor_attention_mask,
+                                                     tensor_metadata);
+}
+
+/**
+ * @brief Returns the working memory size needed to tokenize a batch.
+ *
+ * The wordpiece_tokenizer needs about 21x the number of character bytes and the
+ * offsets and row maps add 16 bytes per output row.
+ */
+std::size_t workspace_size(std::size_t max_batch_bytes, uint32_t max_rows_tensor)
+{
+  constexpr std::size_t allocation_alignment = 256;
+  // allow for the padding added to each of the temporary allocations
+  constexpr std::size_t padding = 16 * allocation_alignment;
+  auto const size =
+    21 * max_batch_bytes + 16 * (static_cast<std::size_t>(max_rows_tensor) + 1) + padding;
+  return cudf::util::round_up_safe(size, allocation_alignment);
+}
+
+void validate_parameters(uint32_t max_sequence_length, uint32_t stride, uint32_t max_rows_tensor)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  CUDF_EXPECTS(max_sequence_length * max_rows_tensor <
+                 static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+               "max_sequence_length x max_rows_tensor is too large for cudf output column size");
+}
+
+}  // namespace
+
+tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
+                                  hashed_vocabulary const& vocab_table,
+                                  uint32_t max_sequence_length,
+                                  uint32_t stride,
+                                  bool do_lower_case,
+                                  bool do_truncate,
+                                  uint32_t max_rows_tensor,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::mr::device_memory_resource* mr)
+{
+  validate_parameters(max_sequence_length, stride, max_rows_tensor);
+  auto const strings_count = strings.size();
+  if (strings_count == 0 || strings.chars_size() == 0)
+    return tokenizer_result{0,
+                            max_sequence_length,
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32}),
+                            cudf::make_empty_column(cudf::data_type{cudf::type_id::UINT32})};
+
+  // Create tokenizer
+  wordpiece_tokenizer tokenizer(
+    vocab_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case);
+  auto const rows = tokenize_rows(strings,
+                                  tokenizer,
+                                  max_sequence_length,
+                                  stride,
+                                  do_truncate,
+                                  stream,
+                                  rmm::mr::get_current_device_resource());
+  uint32_t const nrows_tensor_token_ids = rows.size();
+
   // create output data columns
   auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
                                                     nrows_tensor_token_ids * max_sequence_length,
@@ -224,25 +318,14 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                                    stream,
                                                    mr);
 
-  // compute final-tensor, mask, and metadata
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d const grid{
-    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
-  kernel_compute_tensor_metadata<<<grid.num_blocks,
-                                   grid.num_threads_per_block,
-                                   0,
-                                   stream.value()>>>(
-    device_token_ids,
-    device_offsets,
-    d_row2tensor,
-    d_row2row_within_tensor,
-    max_sequence_length,
-    nrows_tensor_token_ids,
-    stride,
-    do_truncate,
-    tensor_token_ids->mutable_view().data<uint32_t>(),
-    tensor_attention_mask->mutable_view().data<uint32_t>(),
-    tensor_metadata->mutable_view().data<uint32_t>());
+  compute_tensors(rows,
+                  max_sequence_length,
+                  stride,
+                  do_truncate,
+                  tensor_token_ids->mutable_view().data<uint32_t>(),
+                  tensor_attention_mask->mutable_view().data<uint32_t>(),
+                  tensor_metadata->mutable_view().data<uint32_t>(),
+                  stream);
 
   return tokenizer_result{nrows_tensor_token_ids,
                           max_sequence_length,
@@ -274,4 +357,94 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+struct subword_tokenizer::impl {
+  impl(hashed_vocabulary const& vocabulary_table,
+       uint32_t max_sequence_length,
+       uint32_t stride,
+       bool do_lower_case,
+       bool do_truncate,
+       uint32_t max_rows_tensor,
+       std::size_t max_batch_bytes,
+       rmm::mr::device_memory_resource* mr)
+    : max_sequence_length{max_sequence_length},
+      stride{stride},
+      do_truncate{do_truncate},
+      max_rows_tensor{max_rows_tensor},
+      tokenizer(
+        vocabulary_table, max_rows_tensor, max_sequence_length, stride, do_truncate, do_lower_case),
+      workspace(mr, detail::workspace_size(max_batch_bytes, max_rows_tensor))
+  {
+  }
+
+  uint32_t const max_sequence_length;
+  uint32_t const stride;
+  bool const do_truncate;
+  uint32_t const max_rows_tensor;
+  detail::wordpiece_tokenizer tokenizer;
+  // all the working memory for a batch is allocated from here
+  rmm::mr::pool_memory_resource<rmm::mr::device_memory_resource> workspace;
+};
+
+subword_tokenizer::~subword_tokenizer() = default;
+
+subword_tokenizer::subword_tokenizer(hashed_vocabulary const& vocabulary_table,
+                                     uint32_t max_sequence_length,
+                                     uint32_t stride,
+                                     bool do_lower_case,
+                                     bool do_truncate,
+                                     uint32_t max_rows_tensor,
+                                     std::size_t max_batch_bytes,
+                                     rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_parameters(max_sequence_length, stride, max_rows_tensor);
+  _impl = std::make_unique<impl>(vocabulary_table,
+                                 max_sequence_length,
+                                 stride,
+                                 do_lower_case,
+                                 do_truncate,
+                                 max_rows_tensor,
+                                 max_batch_bytes,
+                                 mr);
+}
+
+uint32_t subword_tokenizer::tokenize(cudf::strings_column_view const& input,
+                                     cudf::mutable_column_view tensor_token_ids,
+                                     cudf::mutable_column_view tensor_attention_mask,
+                                     cudf::mutable_column_view tensor_metadata,
+                                     rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  auto const max_rows        = static_cast<std::size_t>(_impl->max_rows_tensor);
+  auto const max_tokens      = max_rows * _impl->max_sequence_length;
+  auto const is_valid_output = [](cudf::mutable_column_view const& col, std::size_t size) {
+    return col.type().id() == cudf::type_id::UINT32 && static_cast<std::size_t>(col.size()) >= size;
+  };
+  CUDF_EXPECTS(is_valid_output(tensor_token_ids, max_tokens) &&
+                 is_valid_output(tensor_attention_mask, max_tokens) &&
+                 is_valid_output(tensor_metadata, max_rows * 3),
+               "output tensors must be UINT32 columns large enough for max_rows_tensor rows");
+  if (input.size() == 0 || input.chars_size() == 0) { return 0; }
+
+  auto const rows = detail::tokenize_rows(input,
+                                          _impl->tokenizer,
+                                          _impl->max_sequence_length,
+                                          _impl->stride,
+                                          _impl->do_truncate,
+                                          stream,
+                                          &_impl->workspace);
+  CUDF_EXPECTS(rows.size() <= _impl->max_rows_tensor,
+               "tokenized batch has more rows than max_rows_tensor");
+
+  detail::compute_tensors(rows,
+                          _impl->max_sequence_length,
+                          _impl->stride,
+                          _impl->do_truncate,
+                          tensor_token_ids.data<uint32_t>(),
+                          tensor_attention_mask.data<uint32_t>(),
+                          tensor_metadata.data<uint32_t>(),
+                          stream);
+  return rows.size();
+}
+
 }  // namespace nvtext
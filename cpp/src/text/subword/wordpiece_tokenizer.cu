@@ -417,10 +417,11 @@ wordpiece_tokenizer::wordpiece_tokenizer(hashed_vocabulary const& vocab_table,
 uvector_pair wordpiece_tokenizer::tokenize(char const* d_strings,
                                            uint32_t const* d_offsets,
                                            uint32_t num_strings,
-                                           rmm::cuda_stream_view stream)
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
 {
-  auto cps_and_offsets = normalizer.normalize(d_strings, d_offsets, num_strings, stream);
-  tokenize(cps_and_offsets, stream);
+  auto cps_and_offsets = normalizer.normalize(d_strings, d_offsets, num_strings, stream, mr);
+  tokenize(cps_and_offsets, stream, mr);
   return uvector_pair(std::move(cps_and_offsets.first), std::move(cps_and_offsets.second));
 }
 
@@ -432,7 +433,9 @@ struct tranform_fn {  // just converting uint8 value to uint32
   __device__ uint32_t operator()(uint8_t count) { return count; }
 };
 
-void wordpiece_tokenizer::tokenize(uvector_pair& cps_and_offsets, rmm::cuda_stream_view stream)
+void wordpiece_tokenizer::tokenize(uvector_pair& cps_and_offsets,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::mr::device_memory_resource* mr)
 {
   uint32_t* device_code_points     = cps_and_offsets.first->data();
   size_t const num_code_points     = cps_and_offsets.first->size();
@@ -441,9 +444,9 @@ void wordpiece_tokenizer::tokenize(uvector_pair& cps_and_offsets, rmm::cuda_stre
 
   const size_t four_byte_cp_chunks = 1 + (num_code_points - 1) / sizeof(uint32_t);
   const size_t rounded_num_cps     = sizeof(uint32_t) * four_byte_cp_chunks;
-  rmm::device_uvector<uint8_t> device_tokens_per_word(rounded_num_cps, stream);
-  rmm::device_uvector<uint32_t> device_token_ids(num_code_points, stream);
-  rmm::device_uvector<uint32_t> device_word_indices(2 * num_code_points, stream);
+  rmm::device_uvector<uint8_t> device_tokens_per_word(rounded_num_cps, stream, mr);
+  rmm::device_uvector<uint32_t> device_token_ids(num_code_points, stream, mr);
+  rmm::device_uvector<uint32_t> device_word_indices(2 * num_code_points, stream, mr);
 
   // make device_start_word_indices and device_end_word_indices contiguous
   uint32_t* device_start_word_indices = device_word_indices.data();
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <jit_preprocessed_files/transform/jit/compute_column_kernel.cu.jit.hpp>
+
+#include <jit/ast_codegen.hpp>
+#include <jit/cache.hpp>
+#include <jit/type.hpp>
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <sstream>
+#include <string>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the source of the `GENERIC_AST_EXPRESSION` device function evaluating the
+ * expression whose statements `codegen` emitted, with `result` the id of its result.
+ *
+ * The function writes the result of a valid row to `output` and returns its validity.
+ */
+std::string make_expression_source(cudf::jit::ast_codegen const& codegen,
+                                   int result,
+                                   data_type output_type)
+{
+  std::ostringstream source;
+  source << "#pragma once\n\n"
+         << "__device__ __inline__ bool GENERIC_AST_EXPRESSION(\n"
+         << "  cudf::size_type left_row,\n"
+         << "  void const* const* left_data,\n"
+         << "  cudf::bitmask_type const* const* left_masks,\n"
+         << "  cudf::size_type const* left_offsets,\n"
+         << "  void const* const* literal_data,\n"
+         << "  bool const* const* literal_valid,\n"
+         << "  void* output)\n"
+         << "{\n"
+         << codegen.body() << "  if (n" << result << ") { static_cast<"
+         << cudf::jit::get_type_name(output_type) << "*>(output)[left_row] = v" << result
+         << "; }\n"
+         << "  return n" << result << ";\n"
+         << "}\n";
+  return source.str();
+}
+
+}  // namespace
+
+std::unique_ptr<column> jit_compute_column(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  auto const has_nulls = expr.may_evaluate_null(table, stream);
+
+  // the parser validates the operand types and infers the output type
+  auto const parser = ast::detail::expression_parser{
+    expr, table, has_nulls, stream, rmm::mr::get_current_device_resource()};
+  auto const output_type = parser.output_type();
+  CUDF_EXPECTS(is_numeric(output_type), "JIT-compiled expressions only support numeric outputs");
+
+  auto output = cudf::make_fixed_width_column(output_type,
+                                              table.num_rows(),
+                                              has_nulls ? mask_state::UNINITIALIZED
+                                                        : mask_state::UNALLOCATED,
+                                              stream,
+                                              mr);
+
+  // generated before checking for an empty table, so unsupported expressions always throw
+  cudf::jit::ast_codegen codegen{table, nullptr};
+  auto const expression_source =
+    make_expression_source(codegen, codegen.emit(expr), output_type);
+  if (table.num_rows() == 0) { return output; }
+
+  auto const arrays   = cudf::jit::make_device_table_arrays(table, stream);
+  auto const literals = cudf::jit::make_device_literal_arrays(codegen.literals(), stream);
+  auto output_view    = output->mutable_view();
+
+  // the occupancy-maximizing block size is a whole number of warps, as the kernel requires
+  cudf::jit::get_kernel(*transform_jit_compute_column_kernel_cu_jit,
+                        "cudf::transformation::jit::compute_column",
+                        {{"transform/jit/expression-udf.hpp", expression_source}},
+                        {"-arch=sm_."})                   //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(table.num_rows(),
+             arrays.data.data(),
+             arrays.masks.data(),
+             arrays.offsets.data(),
+             literals.data.data(),
+             literals.valid.data(),
+             output_view.head(),
+             output_view.null_mask());
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> jit_compute_column(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jit_compute_column(table, expr, cudf::default_stream_value, mr);
+}
+
+}  // namespace cudf
@@ -19,51 +19,89 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/null_mask.hpp>
-#include <cudf/detail/search.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
 #include <memory>
-#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace cudf {
 namespace detail {
 
-std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(
-  table_view const& input_table, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(table_view const& input_table,
+                                                                  encode_key_order key_order,
+                                                                  rmm::cuda_stream_view stream,
+                                                                  rmm::mr::device_memory_resource* mr)
 {
-  auto const num_cols = input_table.num_columns();
+  // The codes are assigned while finding the distinct rows, in the order of their first rows
+  auto [distinct_indices, codes] = cudf::detail::get_distinct_row_codes(
+    input_table, null_equality::EQUAL, nan_equality::ALL_EQUAL, stream, mr);
 
-  std::vector<size_type> drop_keys(num_cols);
-  std::iota(drop_keys.begin(), drop_keys.end(), 0);
+  auto const gather_rows = [&](auto const& source, auto const& gather_map, auto* resource) {
+    return cudf::detail::gather(source,
+                                gather_map,
+                                out_of_bounds_policy::DONT_CHECK,
+                                negative_index_policy::NOT_ALLOWED,
+                                stream,
+                                resource);
+  };
+  auto const distinct_map = device_span<size_type const>{distinct_indices};
 
-  auto distinct_keys = cudf::detail::distinct(input_table,
-                                              drop_keys,
-                                              duplicate_keep_option::KEEP_ANY,
-                                              null_equality::EQUAL,
-                                              nan_equality::ALL_EQUAL,
-                                              stream,
-                                              mr);
+  if (key_order == encode_key_order::FIRST_APPEARANCE) {
+    return std::pair(gather_rows(input_table, distinct_map, mr),
+                     std::make_unique<column>(std::move(codes), rmm::device_buffer{}, 0));
+  }
 
-  std::vector<order> column_order(num_cols, order::ASCENDING);
-  std::vector<null_order> null_precedence(num_cols, null_order::AFTER);
-  auto sorted_unique_keys =
-    cudf::detail::sort(distinct_keys->view(), column_order, null_precedence, stream, mr);
+  // Only the distinct rows are sorted, then every code is replaced by the position of its row
+  // among the sorted distinct rows
+  auto const unsorted_keys =
+    gather_rows(input_table, distinct_map, rmm::mr::get_current_device_resource());
+  auto const num_keys = unsorted_keys->num_rows();
+  std::vector<order> column_order(input_table.num_columns(), order::ASCENDING);
+  std::vector<null_order> null_precedence(input_table.num_columns(), null_order::AFTER);
+  auto const sorted_order = cudf::detail::sorted_order(unsorted_keys->view(),
+                                                       column_order,
+                                                       null_precedence,
+                                                       stream,
+                                                       rmm::mr::get_current_device_resource());
 
-  auto indices_column = cudf::detail::lower_bound(
-    sorted_unique_keys->view(), input_table, column_order, null_precedence, stream, mr);
+  rmm::device_uvector<size_type> sorted_codes(num_keys, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_keys),
+                  sorted_order->view().begin<size_type>(),
+                  sorted_codes.begin());
+  thrust::transform(rmm::exec_policy(stream),
+                    codes.begin(),
+                    codes.end(),
+                    codes.begin(),
+                    [sorted_codes = sorted_codes.begin()] __device__(size_type const code) {
+                      return sorted_codes[code];
+                    });
 
-  return std::pair(std::move(sorted_unique_keys), std::move(indices_column));
+  return std::pair(gather_rows(unsorted_keys->view(), sorted_order->view(), mr),
+                   std::make_unique<column>(std::move(codes), rmm::device_buffer{}, 0));
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(
+  table_view const& input_table, rmm::cuda_stream_view stream, rmm::mr::device_memory_resource* mr)
+{
+  return encode(input_table, encode_key_order::SORTED, stream, mr);
 }
 
 }  // namespace detail
@@ -74,4 +112,11 @@ std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
   return detail::encode(input, cudf::default_stream_value, mr);
 }
 
+std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::column>> encode(
+  cudf::table_view const& input, encode_key_order key_order, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::encode(input, key_order, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
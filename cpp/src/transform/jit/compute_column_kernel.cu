@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Include Jitify's cstddef header first
+#include <cstddef>
+
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+
+#include <jit/ast_operators.hpp>
+#include <transform/jit/expression-udf.hpp>
+
+namespace cudf {
+namespace transformation {
+namespace jit {
+
+/**
+ * @brief Evaluates the generated expression on every row of a table
+ *
+ * The columns and literals referenced by the expression are passed as arrays of their data and
+ * validity, indexed by column and by the order of the literals in the expression. The rows are
+ * strided by whole warps, so the validity of a warp is written as one word of `output_mask`,
+ * which is null if the expression cannot evaluate to null. The block size must be a multiple of
+ * the warp size.
+ */
+__global__ void compute_column(cudf::size_type size,
+                               void const* const* left_data,
+                               cudf::bitmask_type const* const* left_masks,
+                               cudf::size_type const* left_offsets,
+                               void const* const* literal_data,
+                               bool const* const* literal_valid,
+                               void* output,
+                               cudf::bitmask_type* output_mask)
+{
+  constexpr unsigned int warp_size = 32;
+
+  auto const start = threadIdx.x + cudf::thread_index_type{blockIdx.x} * blockDim.x;
+  auto const step  = cudf::thread_index_type{blockDim.x} * gridDim.x;
+  auto const lane  = threadIdx.x % warp_size;
+
+  // the first row of the warp decides whether the warp iterates, so the ballot is warp-uniform
+  for (auto row = start; row - lane < size; row += step) {
+    bool const valid = row < size && GENERIC_AST_EXPRESSION(static_cast<cudf::size_type>(row),
+                                                            left_data,
+                                                            left_masks,
+                                                            left_offsets,
+                                                            literal_data,
+                                                            literal_valid,
+                                                            output);
+    if (output_mask != nullptr) {
+      auto const word = __ballot_sync(0xffff'ffff, valid);
+      if (lane == 0) { output_mask[cudf::word_index(static_cast<cudf::size_type>(row))] = word; }
+    }
+  }
+}
+
+}  // namespace jit
+}  // namespace transformation
+}  // namespace cudf
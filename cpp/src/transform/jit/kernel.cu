@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -50,6 +50,24 @@ __global__ void kernel(cudf::size_type size, TypeOut* out_data, TypeIn* in_data)
   }
 }
 
+template <typename TypeOut, typename TypeIn>
+__global__ void batched_kernel(cudf::size_type size,
+                               cudf::size_type num_columns,
+                               TypeOut* const* out_data,
+                               TypeIn const* const* in_data)
+{
+  // The elements of all the columns are strided over as one range
+  auto const start = threadIdx.x + static_cast<int64_t>(blockIdx.x) * blockDim.x;
+  auto const step  = static_cast<int64_t>(blockDim.x) * gridDim.x;
+  auto const count = static_cast<int64_t>(size) * num_columns;
+
+  for (auto i = start; i < count; i += step) {
+    auto const column = static_cast<cudf::size_type>(i / size);
+    auto const row    = static_cast<cudf::size_type>(i % size);
+    GENERIC_UNARY_OP(&out_data[column][row], in_data[column][row]);
+  }
+}
+
 }  // namespace jit
 }  // namespace transformation
 }  // namespace cudf
@@ -17,21 +17,28 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/optional.h>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 
+#include <algorithm>
+
 namespace cudf {
 namespace detail {
 
@@ -315,12 +322,12 @@ struct row_size_functor {
    *                 1 bit per row for validity if applicable.
    */
   template <typename T>
-  __device__ size_type operator()(column_device_view const& col, row_span const& span)
+  __device__ int64_t operator()(column_device_view const& col, row_span const& span)
   {
     auto const num_rows{span.row_end - span.row_start};
     auto const element_size  = sizeof(device_storage_type_t<T>) * CHAR_BIT;
     auto const validity_size = col.nullable() ? 1 : 0;
-    return (element_size + validity_size) * num_rows;
+    return static_cast<int64_t>(element_size + validity_size) * num_rows;
   }
 };
 
@@ -332,8 +339,8 @@ struct row_size_functor {
  *                 1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<string_view>(column_device_view const& col,
-                                                               row_span const& span)
+__device__ int64_t row_size_functor::operator()<string_view>(column_device_view const& col,
+                                                             row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
   if (num_rows == 0) {
@@ -354,8 +361,10 @@ __device__ size_type row_size_functor::operator()<string_view>(column_device_vie
   auto const offsets_size  = sizeof(offset_type) * CHAR_BIT;
   auto const validity_size = col.nullable() ? 1 : 0;
   auto const chars_size =
-    (offsets.data<offset_type>()[row_end] - offsets.data<offset_type>()[row_start]) * CHAR_BIT;
-  return ((offsets_size + validity_size) * num_rows) + chars_size;
+    static_cast<int64_t>(offsets.data<offset_type>()[row_end] -
+                         offsets.data<offset_type>()[row_start]) *
+    CHAR_BIT;
+  return static_cast<int64_t>(offsets_size + validity_size) * num_rows + chars_size;
 }
 
 /**
@@ -366,14 +375,14 @@ __device__ size_type row_size_functor::operator()<string_view>(column_device_vie
  *                 1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<list_view>(column_device_view const& col,
-                                                             row_span const& span)
+__device__ int64_t row_size_functor::operator()<list_view>(column_device_view const& col,
+                                                           row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
 
   auto const offsets_size  = sizeof(offset_type) * CHAR_BIT;
   auto const validity_size = col.nullable() ? 1 : 0;
-  return (offsets_size + validity_size) * num_rows;
+  return static_cast<int64_t>(offsets_size + validity_size) * num_rows;
 }
 
 /**
@@ -382,42 +391,63 @@ __device__ size_type row_size_functor::operator()<list_view>(column_device_view
  * Computed as :   1 bit per row for validity if applicable.
  */
 template <>
-__device__ size_type row_size_functor::operator()<struct_view>(column_device_view const& col,
-                                                               row_span const& span)
+__device__ int64_t row_size_functor::operator()<struct_view>(column_device_view const& col,
+                                                             row_span const& span)
 {
   auto const num_rows{span.row_end - span.row_start};
-  return (col.nullable() ? 1 : 0) * num_rows;  // cost of validity
+  return static_cast<int64_t>(col.nullable() ? 1 : 0) * num_rows;  // cost of validity
 }
 
 /**
- * @brief Kernel for computing per-row sizes in bits.
+ * @brief Functor returning the span of the single row `row`.
+ */
+struct single_row_span {
+  __device__ row_span operator()(size_type row) const { return row_span{row, row + 1}; }
+};
+
+/**
+ * @brief Functor returning the span of rows between two consecutive bounds.
+ */
+struct bounded_row_span {
+  size_type const* bounds;
+  __device__ row_span operator()(size_type i) const { return row_span{bounds[i], bounds[i + 1]}; }
+};
+
+/**
+ * @brief Kernel for computing the sizes in bits of spans of rows.
+ *
+ * Each thread computes the size of one span of rows, whatever its number of rows: the offsets
+ * of strings and lists columns are only read at the bounds of the spans.
  *
  * @param cols An span of column_device_views representing a column hierarchy
  * @param info An span of column_info structs corresponding the elements in `cols`
- * @param output Output span of size (# rows) where per-row bit sizes are stored
+ * @param spans Iterator to the span of rows of each output element
+ * @param output Output span where the sizes in bits of the spans are stored
  * @param max_branch_depth Maximum depth of the span stack needed per-thread
  */
+template <typename SpanIterator, typename SizeType>
 __global__ void compute_row_sizes(device_span<column_device_view const> cols,
                                   device_span<column_info const> info,
-                                  device_span<size_type> output,
+                                  SpanIterator spans,
+                                  device_span<SizeType> output,
                                   size_type max_branch_depth)
 {
   extern __shared__ row_span thread_branch_stacks[];
   int const tid = threadIdx.x + blockIdx.x * blockDim.x;
 
-  auto const num_rows = output.size();
-  if (tid >= num_rows) { return; }
+  auto const num_spans = output.size();
+  if (tid >= num_spans) { return; }
 
   // branch stack. points to the last list prior to branching.
   row_span* my_branch_stack = thread_branch_stacks + (threadIdx.x * max_branch_depth);
   size_type branch_depth{0};
 
-  // current row span - always starts at 1 row.
-  row_span cur_span{tid, tid + 1};
+  // current row span - always starts at the span of this thread.
+  row_span const span = spans[tid];
+  row_span cur_span   = span;
 
   // output size
-  size_type& size = output[tid];
-  size            = 0;
+  int64_t size = 0;
 
   size_type last_branch_depth{0};
   for (size_type idx = 0; idx < cols.size(); idx++) {
@@ -439,7 +469,7 @@ __global__ void compute_row_sizes(device_span<column_device_view const> cols,
     if (info[idx].depth == 0) {
       branch_depth      = 0;
       last_branch_depth = 0;
-      cur_span          = row_span{tid, tid + 1};
+      cur_span          = span;
     }
 
     // add the contributing size of this row
@@ -456,6 +486,61 @@ __global__ void compute_row_sizes(device_span<column_device_view const> cols,
 
     last_branch_depth = info[idx].branch_depth_end;
   }
+
+  output[tid] = static_cast<SizeType>(size);
+}
+
+/**
+ * @brief Computes the sizes in bits of spans of rows of a flattened column hierarchy.
+ *
+ * @param cols The flattened column hierarchy
+ * @param info Per-column information about the hierarchy
+ * @param h_info Information about the whole hierarchy
+ * @param spans Iterator to the span of rows of each output element
+ * @param output Output span where the sizes in bits of the spans are stored
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename SpanIterator, typename SizeType>
+void compute_span_sizes(std::vector<cudf::column_view> const& cols,
+                        std::vector<column_info> const& info,
+                        hierarchy_info const& h_info,
+                        SpanIterator spans,
+                        device_span<SizeType> output,
+                        rmm::cuda_stream_view stream)
+{
+  if (output.empty()) { return; }
+
+  // create a contiguous block of column_device_views
+  auto d_cols = contiguous_copy_column_device_views<column_device_view>(cols, stream);
+
+  // move stack info to the gpu
+  rmm::device_uvector<column_info> d_info = cudf::detail::make_device_uvector_async(info, stream);
+
+  // each thread needs to maintain a stack of row spans of size max_branch_depth. we will use
+  // shared memory to do this rather than allocating a potentially gigantic temporary buffer
+  // of memory of size (# input rows * sizeof(row_span) * max_branch_depth).
+  auto const shmem_per_thread = sizeof(row_span) * h_info.max_branch_depth;
+  int device_id;
+  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
+  int shmem_limit_per_block;
+  CUDF_CUDA_TRY(
+    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
+  constexpr int max_block_size = 256;
+  auto const block_size =
+    shmem_per_thread != 0
+      ? std::min(max_block_size, shmem_limit_per_block / static_cast<int>(shmem_per_thread))
+      : max_block_size;
+  auto const shared_mem_size = shmem_per_thread * block_size;
+  // should we be aborting if we reach some extremely small block size, or just if we hit 0?
+  CUDF_EXPECTS(block_size > 0, "Encountered a column hierarchy too complex for row_bit_count");
+
+  cudf::detail::grid_1d grid{static_cast<size_type>(output.size()), block_size, 1};
+  compute_row_sizes<<<grid.num_blocks, block_size, shared_mem_size, stream.value()>>>(
+    {std::get<1>(d_cols), cols.size()},
+    {d_info.data(), info.size()},
+    spans,
+    output,
+    h_info.max_branch_depth);
 }
 
 }  // anonymous namespace
@@ -493,38 +578,78 @@ std::unique_ptr<column> row_bit_count(table_view const& t,
     return output;
   }
 
-  // create a contiguous block of column_device_views
-  auto d_cols = contiguous_copy_column_device_views<column_device_view>(cols, stream);
+  auto const row_spans = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0), single_row_span{});
+  compute_span_sizes(
+    cols,
+    info,
+    h_info,
+    row_spans,
+    device_span<size_type>{mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())},
+    stream);
 
-  // move stack info to the gpu
-  rmm::device_uvector<column_info> d_info = cudf::detail::make_device_uvector_async(info, stream);
+  return output;
+}
 
-  // each thread needs to maintain a stack of row spans of size max_branch_depth. we will use
-  // shared memory to do this rather than allocating a potentially gigantic temporary buffer
-  // of memory of size (# input rows * sizeof(row_span) * max_branch_depth).
-  auto const shmem_per_thread = sizeof(row_span) * h_info.max_branch_depth;
-  int device_id;
-  CUDF_CUDA_TRY(cudaGetDevice(&device_id));
-  int shmem_limit_per_block;
-  CUDF_CUDA_TRY(
-    cudaDeviceGetAttribute(&shmem_limit_per_block, cudaDevAttrMaxSharedMemoryPerBlock, device_id));
-  constexpr int max_block_size = 256;
-  auto const block_size =
-    shmem_per_thread != 0
-      ? std::min(max_block_size, shmem_limit_per_block / static_cast<int>(shmem_per_thread))
-      : max_block_size;
-  auto const shared_mem_size = shmem_per_thread * block_size;
-  // should we be aborting if we reach some extremely small block size, or just if we hit 0?
-  CUDF_EXPECTS(block_size > 0, "Encountered a column hierarchy too complex for row_bit_count");
+/**
+ * @copydoc cudf::detail::estimate_split_sizes
+ *
+ */
+std::vector<std::size_t> estimate_split_sizes(table_view const& t,
+                                              host_span<size_type const> splits,
+                                              rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(std::is_sorted(splits.begin(), splits.end()), "Split indices must be sorted");
+  CUDF_EXPECTS(splits.empty() || (splits.front() >= 0 && splits.back() <= t.num_rows()),
+               "Split indices must be in the range [0, num_rows]");
 
-  cudf::detail::grid_1d grid{t.num_rows(), block_size, 1};
-  compute_row_sizes<<<grid.num_blocks, block_size, shared_mem_size, stream.value()>>>(
-    {std::get<1>(d_cols), cols.size()},
-    {d_info.data(), info.size()},
-    {mcv.data<size_type>(), static_cast<std::size_t>(t.num_rows())},
-    h_info.max_branch_depth);
+  std::vector<size_type> bounds;
+  bounds.reserve(splits.size() + 2);
+  bounds.push_back(0);
+  bounds.insert(bounds.end(), splits.begin(), splits.end());
+  bounds.push_back(t.num_rows());
+  auto const num_spans = bounds.size() - 1;
 
-  return output;
+  std::vector<cudf::column_view> cols;
+  std::vector<column_info> info;
+  hierarchy_info h_info;
+  flatten_hierarchy(t.begin(), t.end(), cols, info, h_info, stream);
+  CUDF_EXPECTS(info.size() == cols.size(), "Size/info mismatch");
+
+  std::vector<int64_t> bit_counts(num_spans);
+  if (h_info.complex_type_count <= 0) {
+    // only fixed-width types, every row has the same size
+    for (std::size_t i = 0; i < num_spans; ++i) {
+      auto const num_rows = bounds[i + 1] - bounds[i];
+      bit_counts[i]       = static_cast<int64_t>(h_info.simple_per_row_size) * num_rows;
+    }
+  } else {
+    auto const d_bounds = cudf::detail::make_device_uvector_async(bounds, stream);
+    rmm::device_uvector<int64_t> d_bit_counts(num_spans, stream);
+    compute_span_sizes(cols,
+                       info,
+                       h_info,
+                       thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                                       bounded_row_span{d_bounds.data()}),
+                       device_span<int64_t>{d_bit_counts},
+                       stream);
+    bit_counts = cudf::detail::make_std_vector_sync(d_bit_counts, stream);
+  }
+
+  std::vector<std::size_t> sizes(num_spans);
+  std::transform(bit_counts.begin(), bit_counts.end(), sizes.begin(), [](auto bits) {
+    return static_cast<std::size_t>(util::div_rounding_up_safe<int64_t>(bits, CHAR_BIT));
+  });
+  return sizes;
+}
+
+/**
+ * @copydoc cudf::detail::estimate_size
+ *
+ */
+std::size_t estimate_size(table_view const& t, rmm::cuda_stream_view stream)
+{
+  return estimate_split_sizes(t, {}, stream).front();
 }
 
 }  // namespace detail
@@ -538,4 +663,25 @@ std::unique_ptr<column> row_bit_count(table_view const& t, rmm::mr::device_memor
   return detail::row_bit_count(t, cudf::default_stream_value, mr);
 }
 
+/**
+ * @copydoc cudf::estimate_size
+ *
+ */
+std::size_t estimate_size(table_view const& t)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_size(t, cudf::default_stream_value);
+}
+
+/**
+ * @copydoc cudf::estimate_split_sizes
+ *
+ */
+std::vector<std::size_t> estimate_split_sizes(table_view const& t,
+                                              std::vector<size_type> const& splits)
+{
+  CUDF_FUNC_RANGE();
+  return detail::estimate_split_sizes(t, splits, cudf::default_stream_value);
+}
+
 }  // namespace cudf
@@ -16,9 +16,14 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -31,10 +36,28 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace cudf {
 namespace transformation {
 namespace jit {
 
+/**
+ * @brief Returns the CUDA source of `udf` applying the unary operation `GENERIC_UNARY_OP`.
+ */
+std::string get_unary_operation_source(std::string const& udf,
+                                       data_type output_type,
+                                       bool is_ptx)
+{
+  return is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
+                                                       "GENERIC_UNARY_OP",
+                                                       cudf::jit::get_type_name(output_type),
+                                                       {0})
+                : cudf::jit::parse_single_function_cuda(udf,  //
+                                                        "GENERIC_UNARY_OP");
+}
+
 void unary_operation(mutable_column_view output,
                      column_view input,
                      const std::string& udf,
@@ -47,23 +70,58 @@ void unary_operation(mutable_column_view output,
       .instantiate(cudf::jit::get_type_name(output.type()),  // list of template arguments
                    cudf::jit::get_type_name(input.type()));
 
-  std::string cuda_source =
-    is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
-                                                  "GENERIC_UNARY_OP",
-                                                  cudf::jit::get_type_name(output_type),
-                                                  {0})
-           : cudf::jit::parse_single_function_cuda(udf,  //
-                                                   "GENERIC_UNARY_OP");
-
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+  std::string cuda_source = get_unary_operation_source(udf, output_type, is_ptx);
+
+  cudf::jit::get_kernel(*transform_jit_kernel_cu_jit,
+                        kernel_name,
+                        {{"transform/jit/operation-udf.hpp", cuda_source}},
+                        {"-arch=sm_."})                   //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(output.size(),                                //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
 
+void batched_unary_operation(mutable_table_view output,
+                             table_view input,
+                             const std::string& udf,
+                             bool is_ptx,
+                             rmm::cuda_stream_view stream)
+{
+  auto const output_type = output.column(0).type();
+  std::string kernel_name =
+    jitify2::reflection::Template("cudf::transformation::jit::batched_kernel")  //
+      .instantiate(cudf::jit::get_type_name(output_type),  // list of template arguments
+                   cudf::jit::get_type_name(input.column(0).type()));
+
+  std::string cuda_source = get_unary_operation_source(udf, output_type, is_ptx);
+
+  // The data of every column is reached through one array of pointers per table
+  auto output_data = std::vector<void const*>{};
+  auto input_data  = std::vector<void const*>{};
+  std::transform(output.begin(),
+                 output.end(),
+                 std::back_inserter(output_data),
+                 [](auto const& column) { return cudf::jit::get_data_ptr(column); });
+  std::transform(input.begin(),
+                 input.end(),
+                 std::back_inserter(input_data),
+                 [](auto const& column) { return cudf::jit::get_data_ptr(column); });
+  auto const d_output_data = cudf::detail::make_device_uvector_async(output_data, stream);
+  auto const d_input_data  = cudf::detail::make_device_uvector_async(input_data, stream);
+
+  cudf::jit::get_kernel(*transform_jit_kernel_cu_jit,
+                        kernel_name,
+                        {{"transform/jit/operation-udf.hpp", cuda_source}},
+                        {"-arch=sm_."})                   //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(input.num_rows(),                             //
+             input.num_columns(),
+             d_output_data.data(),
+             d_input_data.data());
+  cudf::detail::synchronize_stream(stream);  // the pointer arrays are freed on return
+}
+
 }  // namespace jit
 }  // namespace transformation
 
@@ -90,6 +148,63 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+void transform(table_view const& input,
+               std::string const& unary_udf,
+               mutable_table_view output,
+               bool is_ptx,
+               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(input.num_columns() == output.num_columns(), "Mismatched number of columns.");
+  CUDF_EXPECTS(input.num_rows() == output.num_rows(), "Mismatched number of rows.");
+  if (input.num_columns() == 0) { return; }
+
+  auto const input_type  = input.column(0).type();
+  auto const output_type = output.column(0).type();
+  CUDF_EXPECTS(is_fixed_width(input_type), "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(is_fixed_width(output_type), "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(
+    std::all_of(input.begin(),
+                input.end(),
+                [input_type](auto const& column) { return column.type() == input_type; }),
+    "All input columns must have the same type.");
+  CUDF_EXPECTS(
+    std::all_of(output.begin(),
+                output.end(),
+                [output_type](auto const& column) { return column.type() == output_type; }),
+    "All output columns must have the same type.");
+
+  if (input.num_rows() == 0) { return; }
+
+  // transform
+  transformation::jit::batched_unary_operation(output, input, unary_udf, is_ptx, stream);
+}
+
+std::unique_ptr<table> transform(table_view const& input,
+                                 std::string const& unary_udf,
+                                 data_type output_type,
+                                 bool is_ptx,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  std::vector<std::unique_ptr<column>> output_columns;
+  std::transform(input.begin(),
+                 input.end(),
+                 std::back_inserter(output_columns),
+                 [output_type, stream, mr](auto const& column) {
+                   return make_fixed_width_column(output_type,
+                                                  column.size(),
+                                                  cudf::detail::copy_bitmask(column, stream, mr),
+                                                  cudf::UNKNOWN_NULL_COUNT,
+                                                  stream,
+                                                  mr);
+                 });
+  auto output = std::make_unique<table>(std::move(output_columns));
+
+  detail::transform(input, unary_udf, output->mutable_view(), is_ptx, stream);
+
+  return output;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -102,4 +217,23 @@ std::unique_ptr<column> transform(column_view const& input,
   return detail::transform(input, unary_udf, output_type, is_ptx, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<table> transform(table_view const& input,
+                                 std::string const& unary_udf,
+                                 data_type output_type,
+                                 bool is_ptx,
+                                 rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transform(input, unary_udf, output_type, is_ptx, cudf::default_stream_value, mr);
+}
+
+void transform(table_view const& input,
+               std::string const& unary_udf,
+               mutable_table_view output,
+               bool is_ptx)
+{
+  CUDF_FUNC_RANGE();
+  detail::transform(input, unary_udf, output, is_ptx, cudf::default_stream_value);
+}
+
 }  // namespace cudf
@@ -13,14 +13,18 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
 #include <cudf/detail/transpose.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/transpose.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -30,8 +34,171 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 namespace cudf {
 namespace detail {
+namespace {
+constexpr size_type transpose_tile_dim   = 32;
+constexpr size_type transpose_block_rows = 8;
+constexpr size_type max_column_tiles     = 65535;
+
+/**
+ * @brief Transposes a table of fixed-width columns one square tile at a time.
+ *
+ * Each block stages a tile of `transpose_tile_dim` rows of `transpose_tile_dim` columns in shared
+ * memory so that both the reads along the input columns and the writes along the output rows are
+ * coalesced. The validity of the tile is staged alongside it, and each warp packs the validity of
+ * the output row it writes with a ballot and ORs it into the output null mask, which must be zero
+ * initialized. Blocks stride over the column tiles to support tables wider than the grid.
+ *
+ * @tparam T Integer type as wide as the element type of the table
+ * @param input_data Data of each input column, already adjusted for the column offset
+ * @param input_masks Null mask of each input column, `nullptr` if the column has none
+ * @param input_offsets Offset of each input column, used to index its null mask
+ * @param num_columns Number of columns of the input
+ * @param num_rows Number of rows of the input
+ * @param output_data Output data, holding the input rows one after the other
+ * @param output_mask Output null mask, `nullptr` if the input has no nulls
+ */
+template <typename T>
+__global__ void transpose_tiles_kernel(T const* const* input_data,
+                                       bitmask_type const* const* input_masks,
+                                       size_type const* input_offsets,
+                                       size_type num_columns,
+                                       size_type num_rows,
+                                       T* output_data,
+                                       bitmask_type* output_mask)
+{
+  // pad the tiles by one element so that reading a tile column does not hit a single bank
+  __shared__ T tile[transpose_tile_dim][transpose_tile_dim + 1];
+  __shared__ bool valid[transpose_tile_dim][transpose_tile_dim + 1];
+
+  auto const row_start = static_cast<size_type>(blockIdx.x) * transpose_tile_dim;
+  auto const lane      = static_cast<size_type>(threadIdx.x);
+
+  for (auto col_start = static_cast<size_type>(blockIdx.y) * transpose_tile_dim;
+       col_start < num_columns;
+       col_start += static_cast<size_type>(gridDim.y) * transpose_tile_dim) {
+    for (auto j = static_cast<size_type>(threadIdx.y); j < transpose_tile_dim;
+         j += transpose_block_rows) {
+      auto const col = col_start + j;
+      auto const row = row_start + lane;
+      if (col < num_columns && row < num_rows) {
+        tile[j][lane] = input_data[col][row];
+        if (output_mask != nullptr) {
+          valid[j][lane] = input_masks[col] == nullptr ||
+                           bit_is_set(input_masks[col], row + input_offsets[col]);
+        }
+      }
+    }
+    __syncthreads();
+
+    for (auto j = static_cast<size_type>(threadIdx.y); j < transpose_tile_dim;
+         j += transpose_block_rows) {
+      auto const row       = row_start + j;
+      auto const col       = col_start + lane;
+      auto const in_bounds = row < num_rows && col < num_columns;
+      if (in_bounds) { output_data[row * num_columns + col] = tile[lane][j]; }
+
+      if (output_mask != nullptr) {
+        // bit `i` is the validity of output element `row * num_columns + col_start + i`; bits past
+        // the end of the output row are zero so ORing them into the next row is harmless
+        auto const bits = __ballot_sync(0xffff'ffffu, in_bounds && valid[lane][j]);
+        if (lane == 0 && bits != 0) {
+          auto const bit_index = row * num_columns + col_start;
+          auto const word      = word_index(bit_index);
+          auto const shift     = intra_word_index(bit_index);
+          atomicOr(output_mask + word, bits << shift);
+          if (shift != 0) {
+            auto const high_bits = bits >> (size_in_bits<bitmask_type>() - shift);
+            if (high_bits != 0) { atomicOr(output_mask + word + 1, high_bits); }
+          }
+        }
+      }
+    }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief Transposes a table of fixed-width columns of the same type into a single column.
+ *
+ * The elements are moved as integers of the same width, so one kernel serves every type
+ * of a given size.
+ */
+template <typename T>
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  auto const num_columns = input.num_columns();
+  auto const num_rows    = input.num_rows();
+  auto const nullable    = has_nulls(input);
+
+  std::vector<T const*> input_data;
+  std::vector<bitmask_type const*> input_masks;
+  std::vector<size_type> input_offsets;
+  input_data.reserve(num_columns);
+  input_masks.reserve(num_columns);
+  input_offsets.reserve(num_columns);
+  for (auto const& col : input) {
+    input_data.push_back(static_cast<T const*>(col.head()) + col.offset());
+    input_masks.push_back(col.nullable() ? col.null_mask() : nullptr);
+    input_offsets.push_back(col.offset());
+  }
+  auto const d_input_data    = make_device_uvector_async(input_data, stream);
+  auto const d_input_masks   = make_device_uvector_async(input_masks, stream);
+  auto const d_input_offsets = make_device_uvector_async(input_offsets, stream);
+
+  // the output mask starts all null and the kernel sets the valid bits
+  auto output = make_fixed_width_column(input.column(0).type(),
+                                        num_rows * num_columns,
+                                        nullable ? mask_state::ALL_NULL : mask_state::UNALLOCATED,
+                                        stream,
+                                        mr);
+  auto output_view = output->mutable_view();
+
+  dim3 const grid(util::div_rounding_up_safe(num_rows, transpose_tile_dim),
+                  std::min(util::div_rounding_up_safe(num_columns, transpose_tile_dim),
+                           max_column_tiles));
+  dim3 const block(transpose_tile_dim, transpose_block_rows);
+  transpose_tiles_kernel<T><<<grid, block, 0, stream.value()>>>(
+    d_input_data.data(),
+    d_input_masks.data(),
+    d_input_offsets.data(),
+    num_columns,
+    num_rows,
+    static_cast<T*>(output_view.head()),
+    nullable ? output_view.null_mask() : nullptr);
+  CUDF_CHECK_CUDA(stream.value());
+
+  if (nullable) {
+    output->set_null_count(std::accumulate(
+      input.begin(), input.end(), size_type{0}, [](size_type sum, column_view const& col) {
+        return sum + col.null_count();
+      }));
+  }
+  return output;
+}
+
+std::unique_ptr<column> transpose_fixed_width(table_view const& input,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::mr::device_memory_resource* mr)
+{
+  switch (size_of(input.column(0).type())) {
+    case 1: return transpose_fixed_width<uint8_t>(input, stream, mr);
+    case 2: return transpose_fixed_width<uint16_t>(input, stream, mr);
+    case 4: return transpose_fixed_width<uint32_t>(input, stream, mr);
+    case 8: return transpose_fixed_width<uint64_t>(input, stream, mr);
+    case 16: return transpose_fixed_width<__int128_t>(input, stream, mr);
+    default: CUDF_FAIL("Unsupported fixed-width type size");
+  }
+}
+}  // namespace
+
 std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input,
                                                          rmm::cuda_stream_view stream,
                                                          rmm::mr::device_memory_resource* mr)
@@ -48,7 +215,12 @@ std::pair<std::unique_ptr<column>, table_view> transpose(table_view const& input
       input.begin(), input.end(), [dtype](auto const& col) { return dtype == col.type(); }),
     "Column type mismatch");
 
-  auto output_column = cudf::detail::interleave_columns(input, stream, mr);
+  CUDF_EXPECTS(static_cast<std::size_t>(input.num_rows()) * input.num_columns() <=
+                 static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds column size limit");
+
+  auto output_column = is_fixed_width(dtype) ? transpose_fixed_width(input, stream, mr)
+                                             : cudf::detail::interleave_columns(input, stream, mr);
   auto one_iter      = thrust::make_counting_iterator<size_type>(1);
   auto splits_iter   = thrust::make_transform_iterator(
     one_iter, [width = input.num_columns()](size_type idx) { return idx * width; });
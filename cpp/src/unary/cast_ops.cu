@@ -402,6 +402,7 @@ std::unique_ptr<column> cast(column_view const& input,
 {
   CUDF_EXPECTS(is_fixed_width(type), "Unary cast type must be fixed-width.");
 
+  if (input.type() == type) { return std::make_unique<column>(input, stream, mr); }
   return type_dispatcher(input.type(), detail::dispatch_unary_cast_from{input}, type, stream, mr);
 }
 
@@ -415,4 +416,14 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, cudf::default_stream_value, mr);
 }
 
+std::unique_ptr<column> cast(column const& input,
+                             data_type type,
+                             rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(is_fixed_width(type), "Unary cast type must be fixed-width.");
+  if (input.type() == type) { return input.share(); }
+  return detail::cast(input.view(), type, cudf::default_stream_value, mr);
+}
+
 }  // namespace cudf
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/device_resources.hpp>
+#include <cudf/detail/utilities/device_view_cache.hpp>
+#include <cudf/detail/utilities/getenv_or.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/pool_memory_resource.hpp>
+
+#include <string>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using device_view_pool_resource = rmm::mr::pool_memory_resource<rmm::mr::cuda_memory_resource>;
+
+// Initial size of the pool of each device: views are small, typically a few hundred bytes
+constexpr std::size_t initial_pool_size = std::size_t{1} << 20;
+
+template <typename T>
+void append_to_key(std::string& key, T const& value)
+{
+  key.append(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+void append_to_key(std::string& key, column_view const& source)
+{
+  append_to_key(key, source.type().id());
+  append_to_key(key, source.type().scale());
+  append_to_key(key, source.size());
+  append_to_key(key, source.head());
+  append_to_key(key, source.null_mask());
+  append_to_key(key, source.offset());
+  append_to_key(key, source.num_children());
+  for (auto child = source.child_begin(); child != source.child_end(); ++child) {
+    append_to_key(key, *child);
+  }
+}
+
+std::string make_key(char kind)
+{
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  std::string key(1, kind);
+  append_to_key(key, device);
+  return key;
+}
+
+}  // namespace
+
+bool is_device_view_cache_enabled(rmm::cuda_stream_view stream)
+{
+  return stream == cudf::default_stream_value and device_view_cache_capacity() > 0;
+}
+
+std::size_t device_view_cache_capacity()
+{
+  static std::size_t const capacity = getenv_or("LIBCUDF_DEVICE_VIEW_CACHE_SIZE", std::size_t{256});
+  return capacity;
+}
+
+rmm::mr::device_memory_resource* device_view_cache_resource()
+{
+  return get_or_create_device_resource<device_view_pool_resource>(initial_pool_size);
+}
+
+std::string device_view_cache_key(column_view const& source)
+{
+  auto key = make_key('c');
+  append_to_key(key, source);
+  return key;
+}
+
+std::string device_view_cache_key(table_view const& source)
+{
+  auto key = make_key('t');
+  append_to_key(key, source.num_rows());
+  append_to_key(key, source.num_columns());
+  for (auto const& column : source) {
+    append_to_key(key, column);
+  }
+  return key;
+}
+
+}  // namespace detail
+}  // namespace cudf
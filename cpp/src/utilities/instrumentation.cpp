@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/synchronize.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+/**
+ * @brief Allocation counts of a thread since its outermost observed call started.
+ */
+struct thread_allocations {
+  std::size_t allocated{0};     ///< Total bytes allocated
+  std::int64_t outstanding{0};  ///< Bytes allocated minus bytes freed
+  std::int64_t peak{0};         ///< Maximum of `outstanding`
+};
+
+thread_local thread_allocations this_thread_allocations;
+
+/// Name of the outermost API running on the thread, while any instrumentation is on
+thread_local char const* this_thread_api{nullptr};
+
+/**
+ * @brief Device memory resource that counts the bytes each thread allocates through it.
+ */
+class counting_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  explicit counting_resource_adaptor(rmm::mr::device_memory_resource* upstream)
+    : _upstream{upstream}
+  {
+  }
+
+  [[nodiscard]] rmm::mr::device_memory_resource* get_upstream() const noexcept { return _upstream; }
+
+  [[nodiscard]] bool supports_streams() const noexcept override
+  {
+    return _upstream->supports_streams();
+  }
+
+  [[nodiscard]] bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    auto const ptr = _upstream->allocate(bytes, stream);
+    auto& counts   = this_thread_allocations;
+    counts.allocated += bytes;
+    counts.outstanding += static_cast<std::int64_t>(bytes);
+    counts.peak = std::max(counts.peak, counts.outstanding);
+    return ptr;
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    _upstream->deallocate(ptr, bytes, stream);
+    this_thread_allocations.outstanding -= static_cast<std::int64_t>(bytes);
+  }
+
+  [[nodiscard]] bool do_is_equal(
+    rmm::mr::device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  [[nodiscard]] std::pair<std::size_t, std::size_t> do_get_mem_info(
+    rmm::cuda_stream_view stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource* const _upstream;
+};
+
+std::mutex observer_mutex;
+std::shared_ptr<api_call_observer> installed_observer;
+std::atomic<bool> is_observed{false};
+counting_resource_adaptor* installed_resource{nullptr};
+
+std::mutex sync_points_mutex;
+std::vector<sync_point_info> recorded_sync_points;
+std::atomic<bool> is_recording_sync_points{false};
+
+/**
+ * @brief Every counting resource ever installed.
+ *
+ * A resource stays alive after its observer is removed because the memory allocated through it
+ * may still be in use and is freed through it.
+ */
+std::vector<std::unique_ptr<counting_resource_adaptor>> counting_resources;
+
+}  // namespace
+
+void set_api_call_observer(std::shared_ptr<api_call_observer> observer)
+{
+  std::lock_guard<std::mutex> lock(observer_mutex);
+  if (observer and installed_resource == nullptr) {
+    counting_resources.push_back(
+      std::make_unique<counting_resource_adaptor>(rmm::mr::get_current_device_resource()));
+    installed_resource = counting_resources.back().get();
+    rmm::mr::set_current_device_resource(installed_resource);
+  } else if (not observer and installed_resource != nullptr) {
+    rmm::mr::set_current_device_resource(installed_resource->get_upstream());
+    installed_resource = nullptr;
+  }
+  installed_observer = std::move(observer);
+  is_observed        = static_cast<bool>(installed_observer);
+}
+
+std::shared_ptr<api_call_observer> get_api_call_observer()
+{
+  std::lock_guard<std::mutex> lock(observer_mutex);
+  return installed_observer;
+}
+
+void start_recording_sync_points()
+{
+  std::lock_guard<std::mutex> lock(sync_points_mutex);
+  recorded_sync_points.clear();
+  is_recording_sync_points = true;
+}
+
+std::vector<sync_point_info> stop_recording_sync_points()
+{
+  std::lock_guard<std::mutex> lock(sync_points_mutex);
+  is_recording_sync_points = false;
+  return std::exchange(recorded_sync_points, {});
+}
+
+namespace detail {
+
+void synchronize_stream(rmm::cuda_stream_view stream)
+{
+  if (not is_recording_sync_points.load(std::memory_order_relaxed)) {
+    stream.synchronize();
+    return;
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  stream.synchronize();
+  auto const elapsed_ms =
+    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  std::lock_guard<std::mutex> lock(sync_points_mutex);
+  // recording may have stopped while the stream was synchronized
+  if (is_recording_sync_points) {
+    recorded_sync_points.push_back(
+      {this_thread_api != nullptr ? this_thread_api : "", stream, elapsed_ms});
+  }
+}
+
+struct api_call_scope::measurement {
+  char const* name;
+  std::shared_ptr<api_call_observer> observer;
+  rmm::cuda_stream_view stream;
+  cudaEvent_t start{};
+  cudaEvent_t stop{};
+};
+
+api_call_scope::api_call_scope(char const* name)
+{
+  if (not is_observed.load(std::memory_order_relaxed) and
+      not is_recording_sync_points.load(std::memory_order_relaxed)) {
+    return;
+  }
+  // calls made by another call are part of it
+  if (this_thread_api != nullptr) { return; }
+
+  if (auto observer = get_api_call_observer(); observer) {
+    auto call = std::make_unique<measurement>(
+      measurement{name, std::move(observer), cudf::default_stream_value});
+    CUDF_CUDA_TRY(cudaEventCreate(&call->start));
+    CUDF_CUDA_TRY(cudaEventCreate(&call->stop));
+    CUDF_CUDA_TRY(cudaEventRecord(call->start, call->stream.value()));
+
+    this_thread_allocations = thread_allocations{};
+    _measurement            = std::move(call);
+  }
+  this_thread_api = name;
+  _is_outermost   = true;
+}
+
+api_call_scope::~api_call_scope()
+{
+  if (not _is_outermost) { return; }
+  this_thread_api = nullptr;
+  if (not _measurement) { return; }
+
+  auto const& counts = this_thread_allocations;
+  auto const& call   = *_measurement;
+  float elapsed_ms   = 0;
+  if (cudaEventRecord(call.stop, call.stream.value()) == cudaSuccess and
+      cudaEventSynchronize(call.stop) == cudaSuccess) {
+    cudaEventElapsedTime(&elapsed_ms, call.start, call.stop);
+  }
+  cudaEventDestroy(call.start);
+  cudaEventDestroy(call.stop);
+
+  // an exception thrown by the observer cannot leave a destructor
+  try {
+    call.observer->on_api_call({call.name,
+                                call.stream,
+                                elapsed_ms,
+                                counts.allocated,
+                                static_cast<std::size_t>(counts.peak)});
+  } catch (...) {
+  }
+}
+
+}  // namespace detail
+}  // namespace cudf
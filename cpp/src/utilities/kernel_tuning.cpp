@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <jit/cache.hpp>
+
+#include <cudf/detail/utilities/kernel_tuning.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/// Name of the file of tuned block sizes in the JIT kernel cache directory
+constexpr char const* tuning_file_name = "kernel_tuning.txt";
+
+/// Number of timed launches of each candidate block size, after one untimed warm-up launch
+constexpr int timed_launches = 3;
+
+/**
+ * @brief Block sizes tuned for a device.
+ */
+struct device_tunings {
+  std::string device_name;                           ///< Device name, keying the lines of the file
+  std::filesystem::path file;                        ///< Tuning file, empty if there is none
+  std::unordered_map<std::string, int> block_sizes;  ///< Tuned block size of each kernel
+};
+
+std::mutex tunings_mutex;
+std::unordered_map<int, device_tunings> tunings;  // loaded tunings of each device ordinal
+
+// Set with `cudf::set_kernel_tuning`, overriding the environment variable.
+std::optional<bool> tuning_enabled{};
+
+bool is_tuning_enabled()
+{
+  if (tuning_enabled.has_value()) { return tuning_enabled.value(); }
+  return jit::try_parse_numeric_env_var("LIBCUDF_KERNEL_TUNING", 0) != 0;
+}
+
+/**
+ * @brief Returns the tunings of `device`, loading them from its tuning file on first use.
+ *
+ * Each line of the file is the device name, the kernel name and the block size, separated by
+ * tabs. Devices of the same compute capability share the file, so the lines of other devices are
+ * skipped. Later lines override earlier ones and malformed lines are ignored.
+ *
+ * The caller must hold `tunings_mutex`.
+ */
+device_tunings& get_device_tunings(int device)
+{
+  auto const existing = tunings.find(device);
+  if (existing != tunings.end()) { return existing->second; }
+
+  cudaDeviceProp props;
+  CUDF_CUDA_TRY(cudaGetDeviceProperties(&props, device));
+  device_tunings loaded{props.name, {}, {}};
+
+  auto const cache_dir = jit::get_cache_dir();
+  if (not cache_dir.empty()) {
+    loaded.file = cache_dir / tuning_file_name;
+    std::ifstream input(loaded.file);
+    std::string line;
+    while (std::getline(input, line)) {
+      auto const name_end   = line.find('\t');
+      auto const kernel_end = line.find('\t', name_end + 1);
+      if (name_end == std::string::npos or kernel_end == std::string::npos or
+          line.compare(0, name_end, loaded.device_name) != 0) {
+        continue;
+      }
+      try {
+        loaded.block_sizes[line.substr(name_end + 1, kernel_end - name_end - 1)] =
+          std::stoi(line.substr(kernel_end + 1));
+      } catch (std::exception const&) {
+        // a malformed block size is ignored like a malformed line
+      }
+    }
+  }
+  return tunings.emplace(device, std::move(loaded)).first->second;
+}
+
+/**
+ * @brief Owns a pair of CUDA events timing a launch.
+ */
+struct launch_timer {
+  launch_timer()
+  {
+    CUDF_CUDA_TRY(cudaEventCreate(&start));
+    CUDF_CUDA_TRY(cudaEventCreate(&stop));
+  }
+  ~launch_timer()
+  {
+    cudaEventDestroy(start);
+    cudaEventDestroy(stop);
+  }
+  launch_timer(launch_timer const&) = delete;
+  launch_timer& operator=(launch_timer const&) = delete;
+
+  /**
+   * @brief Returns the time in milliseconds of calling `launch` with `block_size`.
+   */
+  float time(std::function<void(int)> const& launch, int block_size, rmm::cuda_stream_view stream)
+  {
+    CUDF_CUDA_TRY(cudaEventRecord(start, stream.value()));
+    launch(block_size);
+    CUDF_CUDA_TRY(cudaEventRecord(stop, stream.value()));
+    CUDF_CUDA_TRY(cudaEventSynchronize(stop));
+    float elapsed_ms;
+    CUDF_CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, start, stop));
+    return elapsed_ms;
+  }
+
+  cudaEvent_t start{};
+  cudaEvent_t stop{};
+};
+
+}  // namespace
+
+int launch_tuned_kernel(std::string const& kernel_name,
+                        std::size_t num_work_items,
+                        std::vector<int> const& block_sizes,
+                        std::function<void(int)> const& launch,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not block_sizes.empty(), "A tunable kernel needs at least one block size.");
+
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+
+  auto block_size = block_sizes.front();
+  auto tune       = false;
+  {
+    std::lock_guard<std::mutex> tunings_lock(tunings_mutex);
+    auto const& device_tunings = get_device_tunings(device);
+    auto const tuned           = device_tunings.block_sizes.find(kernel_name);
+    // a block size tuned for other candidates is not used
+    if (tuned != device_tunings.block_sizes.end() and
+        std::find(block_sizes.begin(), block_sizes.end(), tuned->second) != block_sizes.end()) {
+      block_size = tuned->second;
+    } else {
+      tune = block_sizes.size() > 1 and num_work_items >= kernel_tuning_min_work_items and
+             is_tuning_enabled();
+    }
+  }
+
+  if (not tune) {
+    launch(block_size);
+    return block_size;
+  }
+
+  // The output of the last launch is as valid as that of any other
+  launch_timer timer;
+  auto fastest_ms = std::numeric_limits<float>::max();
+  for (auto const candidate : block_sizes) {
+    launch(candidate);  // loads the kernel and warms up the caches
+    for (int i = 0; i < timed_launches; ++i) {
+      auto const elapsed_ms = timer.time(launch, candidate, stream);
+      if (elapsed_ms < fastest_ms) {
+        fastest_ms = elapsed_ms;
+        block_size = candidate;
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> tunings_lock(tunings_mutex);
+  auto& device_tunings = get_device_tunings(device);
+  // another thread may have tuned the same kernel meanwhile, which only duplicates a line
+  device_tunings.block_sizes[kernel_name] = block_size;
+  if (not device_tunings.file.empty()) {
+    // failing to write the file only means the kernel is tuned again by the next process
+    std::ofstream output(device_tunings.file, std::ios::app);
+    output << device_tunings.device_name << '\t' << kernel_name << '\t' << block_size << '\n';
+  }
+  return block_size;
+}
+
+}  // namespace detail
+
+void set_kernel_tuning(bool enable)
+{
+  std::lock_guard<std::mutex> tunings_lock(detail::tunings_mutex);
+  detail::tuning_enabled = enable;
+}
+
+void clear_kernel_tunings()
+{
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+
+  std::lock_guard<std::mutex> tunings_lock(detail::tunings_mutex);
+  auto const file = detail::get_device_tunings(device).file;
+  // the devices sharing the file of the current device forget their tunings too
+  for (auto it = detail::tunings.begin(); it != detail::tunings.end();) {
+    it = it->second.file == file ? detail::tunings.erase(it) : std::next(it);
+  }
+  if (not file.empty()) {
+    std::error_code error;
+    std::filesystem::remove(file, error);
+  }
+}
+
+}  // namespace cudf
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/device_resources.hpp>
+#include <cudf/detail/utilities/small_allocation.hpp>
+
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+#include <rmm/mr/device/fixed_size_memory_resource.hpp>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using small_block_resource = rmm::mr::fixed_size_memory_resource<rmm::mr::cuda_memory_resource>;
+
+// Number of blocks carved from each slab: a 64KiB slab of 256-byte blocks
+constexpr std::size_t blocks_per_slab = 256;
+
+}  // namespace
+
+rmm::mr::device_memory_resource* small_allocation_resource(std::size_t bytes,
+                                                           rmm::mr::device_memory_resource* mr)
+{
+  if (bytes == 0 or bytes > max_small_allocation_size or
+      mr != rmm::mr::get_current_device_resource()) {
+    return mr;
+  }
+  return get_or_create_device_resource<small_block_resource>(max_small_allocation_size,
+                                                             blocks_per_slab);
+}
+
+}  // namespace detail
+}  // namespace cudf
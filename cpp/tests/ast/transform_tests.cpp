@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
@@ -25,6 +26,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -37,6 +39,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <list>
 #include <random>
 #include <type_traits>
 #include <vector>
@@ -397,6 +400,101 @@ TEST_F(TransformTest, StringComparison)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringLiteralOperators)
+{
+  auto c_0   = cudf::test::strings_column_wrapper({"apple", "banana", "grape", "", "pea"},
+                                                {1, 1, 1, 1, 0});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0           = cudf::ast::column_reference(0);
+  auto prefix              = cudf::string_scalar("ap");
+  auto suffix              = cudf::string_scalar("pe");
+  auto substring           = cudf::string_scalar("an");
+  auto equal_value         = cudf::string_scalar("grape");
+  auto prefix_literal      = cudf::ast::literal(prefix);
+  auto suffix_literal      = cudf::ast::literal(suffix);
+  auto substring_literal   = cudf::ast::literal(substring);
+  auto equal_value_literal = cudf::ast::literal(equal_value);
+
+  auto starts_with =
+    cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, prefix_literal);
+  auto ends_with =
+    cudf::ast::operation(cudf::ast::ast_operator::ENDS_WITH, col_ref_0, suffix_literal);
+  auto contains =
+    cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, substring_literal);
+  auto equal =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_0, equal_value_literal);
+
+  auto validity = std::vector<bool>{1, 1, 1, 1, 0};
+  cudf::test::expect_columns_equal(
+    column_wrapper<bool>({true, false, false, false, false}, validity.begin()),
+    cudf::compute_column(table, starts_with)->view(),
+    verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<bool>({false, false, true, false, false}, validity.begin()),
+    cudf::compute_column(table, ends_with)->view(),
+    verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<bool>({false, true, false, false, false}, validity.begin()),
+    cudf::compute_column(table, contains)->view(),
+    verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<bool>({false, false, true, false, false}, validity.begin()),
+    cudf::compute_column(table, equal)->view(),
+    verbosity);
+}
+
+TEST_F(TransformTest, ExtractDatetimeFields)
+{
+  // 1970-01-01 00:00:00, 2020-01-02 03:04:05, 2000-02-29 12:00:00, 1969-12-31 23:59:59
+  auto c_0 = cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    0, 1577934245, 951825600, -1};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto year      = cudf::ast::operation(cudf::ast::ast_operator::EXTRACT_YEAR, col_ref_0);
+  auto month     = cudf::ast::operation(cudf::ast::ast_operator::EXTRACT_MONTH, col_ref_0);
+  auto day       = cudf::ast::operation(cudf::ast::ast_operator::EXTRACT_DAY, col_ref_0);
+  auto hour      = cudf::ast::operation(cudf::ast::ast_operator::EXTRACT_HOUR, col_ref_0);
+
+  cudf::test::expect_columns_equal(column_wrapper<int16_t>{1970, 2020, 2000, 1969},
+                                   cudf::compute_column(table, year)->view(),
+                                   verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<int16_t>{1, 1, 2, 12}, cudf::compute_column(table, month)->view(), verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<int16_t>{1, 2, 29, 31}, cudf::compute_column(table, day)->view(), verbosity);
+  cudf::test::expect_columns_equal(
+    column_wrapper<int16_t>{0, 3, 12, 23}, cudf::compute_column(table, hour)->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringAndDatetimeFilter)
+{
+  auto c_0 = cudf::test::strings_column_wrapper({"bolt", "nut", "bracket", "bearing"});
+  auto c_1 = cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    1577934245, 1577934245, 951825600, 1577934245};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // name LIKE 'b%' AND YEAR(shipped) = 2020
+  auto col_ref_0      = cudf::ast::column_reference(0);
+  auto col_ref_1      = cudf::ast::column_reference(1);
+  auto prefix         = cudf::string_scalar("b");
+  auto year_value     = cudf::numeric_scalar<int16_t>(2020);
+  auto prefix_literal = cudf::ast::literal(prefix);
+  auto year_literal   = cudf::ast::literal(year_value);
+  auto starts_with =
+    cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, prefix_literal);
+  auto year       = cudf::ast::operation(cudf::ast::ast_operator::EXTRACT_YEAR, col_ref_1);
+  auto year_equal = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, year, year_literal);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, starts_with, year_equal);
+
+  auto expected = column_wrapper<bool>{true, false, false, true};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
 TEST_F(TransformTest, CopyColumn)
 {
   auto c_0   = column_wrapper<int32_t>{3, 0, 1, 50};
@@ -640,4 +738,187 @@ TEST_F(TransformTest, NullLogicalOr)
   cudf::test::expect_columns_equal(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, CommonSubexpressions)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 1, 0, 1}};
+  auto c_1   = column_wrapper<int32_t>{10, 7, 20, 0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  // (c_0 + c_1) * (c_0 + c_1) - (c_0 + c_1), with separately constructed identical sums
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto sum_0      = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto sum_1      = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto sum_2      = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, sum_0, sum_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::SUB, product, sum_2);
+
+  auto parser = cudf::ast::detail::expression_parser{
+    expression, table, true, cudf::default_stream_value, rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.device_expression_data.operators.size(), 3);
+  EXPECT_EQ(parser.device_expression_data.num_intermediates, 2);
+
+  auto expected = column_wrapper<int32_t>{{156, 702, 0, 2450}, {1, 1, 0, 1}};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ConstantFolding)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto table = cudf::table_view{{c_0}};
+
+  // c_0 * (2 + 3 * 4) folds to c_0 * 14
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto two        = cudf::numeric_scalar<int32_t>(2);
+  auto three      = cudf::numeric_scalar<int32_t>(3);
+  auto four       = cudf::numeric_scalar<int32_t>(4);
+  auto literal_2  = cudf::ast::literal(two);
+  auto literal_3  = cudf::ast::literal(three);
+  auto literal_4  = cudf::ast::literal(four);
+  auto product    = cudf::ast::operation(cudf::ast::ast_operator::MUL, literal_3, literal_4);
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, literal_2, product);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::MUL, col_ref_0, sum);
+
+  auto parser = cudf::ast::detail::expression_parser{
+    expression, table, false, cudf::default_stream_value, rmm::mr::get_current_device_resource()};
+  EXPECT_EQ(parser.device_expression_data.operators.size(), 1);
+
+  auto expected = column_wrapper<int32_t>{42, 280, 14, 700};
+  auto result   = cudf::compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ConstantFoldingNulls)
+{
+  auto c_0   = column_wrapper<bool>{true, false, true, false};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto null_value = cudf::numeric_scalar<bool>(true, false);
+  auto true_value = cudf::numeric_scalar<bool>(true);
+  auto null_lit   = cudf::ast::literal(null_value);
+  auto true_lit   = cudf::ast::literal(true_value);
+
+  // NOT(null) folds to null, and NULL_LOGICAL_OR(null, true) is left to the device
+  auto not_null = cudf::ast::operation(cudf::ast::ast_operator::NOT, null_lit);
+  auto null_or =
+    cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_OR, null_lit, true_lit);
+  auto and_null = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, col_ref_0, not_null);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_AND, col_ref_0, null_or);
+
+  auto expected = column_wrapper<bool>{{true, false, true, false}, {1, 1, 1, 1}};
+  auto result   = cudf::compute_column(table, expression);
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+
+  auto expected_null = column_wrapper<bool>{{false, false, false, false}, {0, 0, 0, 0}};
+  auto result_null   = cudf::compute_column(table, and_null);
+  cudf::test::expect_columns_equal(expected_null, result_null->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitDeepTreeNulls)
+{
+  auto constexpr num_rows = 1000;
+  auto constexpr depth    = 100;
+
+  // unsigned, so the values wrap around instead of overflowing
+  auto values = thrust::make_counting_iterator(0);
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto c_0   = column_wrapper<uint64_t>(values, values + num_rows, valids);
+  auto c_1   = column_wrapper<uint64_t>(values, values + num_rows);
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<uint64_t>(3);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  // Chain ((((c_0 + c_1) * 3) - c_0) + c_1) ...
+  auto expressions = std::list<cudf::ast::operation>();
+  expressions.push_back(cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1));
+  for (int i = 1; i < depth; ++i) {
+    switch (i % 3) {
+      case 0:
+        expressions.push_back(
+          cudf::ast::operation(cudf::ast::ast_operator::ADD, expressions.back(), col_ref_1));
+        break;
+      case 1:
+        expressions.push_back(
+          cudf::ast::operation(cudf::ast::ast_operator::MUL, expressions.back(), literal));
+        break;
+      default:
+        expressions.push_back(
+          cudf::ast::operation(cudf::ast::ast_operator::SUB, expressions.back(), col_ref_0));
+    }
+  }
+
+  auto expected = cudf::compute_column(table, expressions.back());
+  auto result   = cudf::jit_compute_column(table, expressions.back());
+
+  cudf::test::expect_columns_equal(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitMathOperators)
+{
+  auto c_0   = column_wrapper<double>{{4.0, -2.5, 9.0, 0.25, -7.0}, {1, 1, 0, 1, 1}};
+  auto c_1   = column_wrapper<double>{1.5, 3.0, -2.0, 2.0, 4.0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto abs        = cudf::ast::operation(cudf::ast::ast_operator::ABS, col_ref_0);
+  auto sqrt       = cudf::ast::operation(cudf::ast::ast_operator::SQRT, abs);
+  auto pow        = cudf::ast::operation(cudf::ast::ast_operator::POW, sqrt, col_ref_1);
+  auto pymod      = cudf::ast::operation(cudf::ast::ast_operator::PYMOD, col_ref_0, col_ref_1);
+  auto floor_div  = cudf::ast::operation(cudf::ast::ast_operator::FLOOR_DIV, pow, col_ref_1);
+  auto sum        = cudf::ast::operation(cudf::ast::ast_operator::ADD, pymod, floor_div);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::SIN, sum);
+
+  auto expected = cudf::compute_column(table, expression);
+  auto result   = cudf::jit_compute_column(table, expression);
+
+  cudf::test::expect_columns_equivalent(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitNullLogicalAnd)
+{
+  auto c_0   = column_wrapper<bool>{{false, false, true, true, false, false, true, true},
+                                  {1, 1, 1, 1, 1, 0, 1, 0}};
+  auto c_1   = column_wrapper<bool>{{false, true, false, true, true, true, false, true},
+                                  {1, 1, 1, 1, 0, 1, 0, 0}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto expression =
+    cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_AND, col_ref_0, col_ref_1);
+
+  auto expected = column_wrapper<bool>{{false, false, false, true, false, false, false, true},
+                                       {1, 1, 1, 1, 1, 0, 1, 0}};
+  auto result   = cudf::jit_compute_column(table, expression);
+
+  cudf::test::expect_columns_equal(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitUnsupported)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50};
+  auto c_1   = cudf::test::strings_column_wrapper{"a", "b", "c", "d"};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0   = cudf::ast::column_reference(0);
+  auto col_ref_1   = cudf::ast::column_reference(1);
+  auto right_ref_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+
+  auto string_expression = cudf::ast::operation(cudf::ast::ast_operator::IDENTITY, col_ref_1);
+  EXPECT_THROW(cudf::jit_compute_column(table, string_expression), cudf::logic_error);
+  auto right_expression =
+    cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, right_ref_0);
+  EXPECT_THROW(cudf::jit_compute_column(table, right_expression), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -296,6 +297,42 @@ TYPED_TEST(FixedPointCompiledTest, FixedPointBinaryOpAdd6)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected1, result1->view());
 }
 
+TYPED_TEST(FixedPointCompiledTest, FixedPointBinaryOpRescaledOperands)
+{
+  using namespace numeric;
+  using decimalXX = TypeParam;
+  using RepType   = device_storage_type_t<decimalXX>;
+
+  auto const lhs = fp_wrapper<RepType>{{99, 11, 22, 33}, scale_type{-1}};
+  auto const rhs = fp_wrapper<RepType>{{99, 110, 200, 400}, scale_type{-2}};
+  // sliced to exercise the column offsets
+  auto const lhs_view = cudf::slice(lhs, {1, 4})[0];
+  auto const rhs_view = cudf::slice(rhs, {1, 4})[0];
+
+  auto const expected_sub = fp_wrapper<RepType>{{0, 200, -700}, scale_type{-3}};
+  auto const expected_mul = fp_wrapper<RepType>{{121, 440, 1320}, scale_type{-2}};
+  auto const expected_eq  = wrapper<bool>{true, false, false};
+  auto const expected_lt  = wrapper<bool>{false, false, true};
+
+  auto const sub = cudf::binary_operation(lhs_view,
+                                          rhs_view,
+                                          cudf::binary_operator::SUB,
+                                          cudf::data_type{type_to_id<decimalXX>(), -3});
+  auto const mul = cudf::binary_operation(lhs_view,
+                                          rhs_view,
+                                          cudf::binary_operator::MUL,
+                                          cudf::data_type{type_to_id<decimalXX>(), -2});
+  auto const eq  = cudf::binary_operation(
+    lhs_view, rhs_view, cudf::binary_operator::EQUAL, cudf::data_type{type_id::BOOL8});
+  auto const lt  = cudf::binary_operation(
+    lhs_view, rhs_view, cudf::binary_operator::LESS, cudf::data_type{type_id::BOOL8});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_sub, sub->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_mul, mul->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_eq, eq->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_lt, lt->view());
+}
+
 TYPED_TEST(FixedPointCompiledTest, FixedPointCast)
 {
   using namespace numeric;
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/binaryop.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -738,6 +739,34 @@ TEST_F(BinaryOperationCompiledTest_NullOpsString, NullMin_Vector_Vector)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
 }
 
+using BinaryOperationCompiledTest_NullOpsSliced =
+  BinaryOperationCompiledTest_NullOps<cudf::test::Types<int32_t, int32_t, int32_t>>;
+TEST_F(BinaryOperationCompiledTest_NullOpsSliced, NullMax_Sliced_Vector_Vector)
+{
+  // The offsets of the operands are not multiples of the bitmask word size
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto const lhs_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const rhs_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> lhs(sequence, sequence + 200, lhs_valids);
+  cudf::test::fixed_width_column_wrapper<int32_t> rhs(sequence, sequence + 200, rhs_valids);
+  auto const lhs_slice = cudf::slice(lhs, {5, 180}).front();
+  auto const rhs_slice = cudf::slice(rhs, {17, 192}).front();
+
+  // Both operands are null for the rows `i` where `i + 5` is a multiple of 3 and `i + 17` of 5
+  auto const expected_values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i + 17) % 5 != 0 ? i + 17 : i + 5; });
+  auto const expected_valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i + 5) % 3 != 0 or (i + 17) % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> expected(
+    expected_values, expected_values + 175, expected_valids);
+
+  auto const result = cudf::binary_operation(
+    lhs_slice, rhs_slice, cudf::binary_operator::NULL_MAX, data_type(type_id::INT32));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
 }  // namespace cudf::test::binop
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -30,6 +30,13 @@
 #include <rmm/device_buffer.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {
 };
 
@@ -743,4 +750,148 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+namespace {
+/**
+ * @brief Creates a column of `num_rows` integers where row `i` is null if `(i + phase) % period`
+ * is zero
+ */
+std::unique_ptr<cudf::column> make_periodic_nulls_column(cudf::size_type num_rows,
+                                                         int period,
+                                                         int phase)
+{
+  auto const values = thrust::make_counting_iterator<int32_t>(0);
+  auto const valids = cudf::detail::make_counting_transform_iterator(
+    0, [period, phase](auto i) { return (i + phase) % period != 0; });
+  return cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows, valids)
+    .release();
+}
+
+/**
+ * @brief Checks `bitmask_and` and `bitmask_or` of `size` rows of the given periodic nulls columns,
+ * sliced at the given offsets, against the validity computed row by row on the host
+ */
+void expect_periodic_bitmask_binops(std::vector<std::unique_ptr<cudf::column>> const& columns,
+                                    std::vector<std::pair<int, int>> const& periods_and_phases,
+                                    std::vector<cudf::size_type> const& offsets,
+                                    cudf::size_type size)
+{
+  std::vector<cudf::column_view> sliced;
+  for (size_t c = 0; c < columns.size(); ++c) {
+    sliced.push_back(cudf::slice(*columns[c], {offsets[c], offsets[c] + size}).front());
+  }
+  auto const input = cudf::table_view(sliced);
+
+  auto const is_valid = [&](size_t c, cudf::size_type row) {
+    auto const [period, phase] = periods_and_phases[c];
+    return (offsets[c] + row + phase) % period != 0;
+  };
+  std::vector<bool> expected_and(size, true);
+  std::vector<bool> expected_or(size, false);
+  for (cudf::size_type row = 0; row < size; ++row) {
+    for (size_t c = 0; c < columns.size(); ++c) {
+      expected_and[row] = expected_and[row] && is_valid(c, row);
+      expected_or[row]  = expected_or[row] || is_valid(c, row);
+    }
+  }
+
+  auto const values = thrust::make_counting_iterator<int32_t>(offsets[0]);
+  auto const expect_mask = [&](std::pair<rmm::device_buffer, cudf::size_type> const& result,
+                               std::vector<bool> const& expected_valids) {
+    auto const& [mask, null_count] = result;
+    auto const expected_null_count = static_cast<cudf::size_type>(
+      std::count(expected_valids.begin(), expected_valids.end(), false));
+    EXPECT_EQ(null_count, expected_null_count);
+
+    auto const result_view = cudf::column_view(sliced[0].type(),
+                                               size,
+                                               sliced[0].data<int32_t>(),
+                                               static_cast<cudf::bitmask_type const*>(mask.data()),
+                                               null_count);
+    cudf::test::fixed_width_column_wrapper<int32_t> expected(
+      values, values + size, expected_valids.begin());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result_view, expected);
+  };
+  expect_mask(cudf::bitmask_and(input), expected_and);
+  expect_mask(cudf::bitmask_or(input), expected_or);
+}
+}  // namespace
+
+TEST_F(MergeBitmaskTest, SlicedWordAligned)
+{
+  constexpr cudf::size_type num_rows = 3000;
+  constexpr cudf::size_type size     = 1000 + 13;  // the last word has slack bits
+  std::vector<std::pair<int, int>> const periods_and_phases{{3, 0}, {5, 1}, {7, 2}};
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (auto const& [period, phase] : periods_and_phases) {
+    columns.push_back(make_periodic_nulls_column(num_rows, period, phase));
+  }
+
+  // 16-byte aligned offsets take the vectorized path, other multiples of the word size the
+  // word-by-word path and the remaining offsets the shifting path
+  for (cudf::size_type offset : {0, 128, 256, 1024, 32, 64, 96, 160, 1, 7, 31, 33, 100}) {
+    expect_periodic_bitmask_binops(columns, periods_and_phases, {offset, offset, offset}, size);
+  }
+  // word-aligned offsets, only some of which are 16-byte aligned
+  expect_periodic_bitmask_binops(columns, periods_and_phases, {0, 32, 128}, size);
+  expect_periodic_bitmask_binops(columns, periods_and_phases, {128, 256, 512}, size);
+  // a single unaligned offset takes the shifting path for all the masks
+  expect_periodic_bitmask_binops(columns, periods_and_phases, {128, 256, 515}, size);
+  // sizes shorter than a vector and than a word
+  expect_periodic_bitmask_binops(columns, periods_and_phases, {128, 128, 128}, 100);
+  expect_periodic_bitmask_binops(columns, periods_and_phases, {32, 64, 0}, 20);
+}
+
+TEST_F(MergeBitmaskTest, SlicedAlignedMatchesShifted)
+{
+  constexpr cudf::size_type num_rows = 3000;
+  constexpr cudf::size_type size     = 2000 + 5;
+  constexpr int shift                = 3;
+  std::vector<std::pair<int, int>> const periods_and_phases{{3, 0}, {5, 1}, {11, 4}};
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  std::vector<std::unique_ptr<cudf::column>> shifted_columns;
+  for (auto const& [period, phase] : periods_and_phases) {
+    // the same validities, starting `shift` rows later in the column
+    auto const shifted_phase = ((phase - shift) % period + period) % period;
+    columns.push_back(make_periodic_nulls_column(num_rows, period, phase));
+    shifted_columns.push_back(make_periodic_nulls_column(num_rows, period, shifted_phase));
+  }
+
+  for (cudf::size_type offset : {0, 32, 128, 512}) {
+    auto const slice_table = [&](auto const& cols, cudf::size_type begin) {
+      std::vector<cudf::column_view> sliced;
+      for (auto const& col : cols) {
+        sliced.push_back(cudf::slice(*col, {begin, begin + size}).front());
+      }
+      return sliced;
+    };
+    auto const aligned = cudf::table_view(slice_table(columns, offset));
+    auto const shifted = cudf::table_view(slice_table(shifted_columns, offset + shift));
+
+    for (auto const is_and : {true, false}) {
+      auto const [aligned_mask, aligned_null_count] =
+        is_and ? cudf::bitmask_and(aligned) : cudf::bitmask_or(aligned);
+      auto const [shifted_mask, shifted_null_count] =
+        is_and ? cudf::bitmask_and(shifted) : cudf::bitmask_or(shifted);
+      EXPECT_EQ(aligned_null_count, shifted_null_count);
+
+      // compare the masks through columns sharing the same values
+      auto const data = aligned.column(0).data<int32_t>();
+      auto const type = aligned.column(0).type();
+      auto const aligned_view =
+        cudf::column_view(type,
+                          size,
+                          data,
+                          static_cast<cudf::bitmask_type const*>(aligned_mask.data()),
+                          aligned_null_count);
+      auto const shifted_view =
+        cudf::column_view(type,
+                          size,
+                          data,
+                          static_cast<cudf::bitmask_type const*>(shifted_mask.data()),
+                          shifted_null_count);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(aligned_view, shifted_view);
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
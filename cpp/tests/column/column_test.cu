@@ -31,6 +31,8 @@
 #include <cudf_test/type_list_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
 #include <thrust/execution_policy.h>
 #include <thrust/sequence.h>
 
@@ -309,6 +311,69 @@ TYPED_TEST(TypedColumnTest, CopyConstructorWithMask)
   EXPECT_NE(original_view.null_mask(), copy_view.null_mask());
 }
 
+TYPED_TEST(TypedColumnTest, ShareCopiesOnWrite)
+{
+  cudf::column original{
+    this->type(), this->num_elements(), std::move(this->data), std::move(this->all_valid_mask)};
+  auto const original_view = original.view();
+
+  auto shared = original.share();
+  verify_column_views(*shared);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(original, *shared);
+
+  // Verify shallow copy
+  EXPECT_EQ(original_view.head(), shared->view().head());
+  EXPECT_EQ(original_view.null_mask(), shared->view().null_mask());
+
+  // The shared buffers are copied before they are written
+  auto const mutable_shared = shared->mutable_view();
+  EXPECT_NE(original_view.head(), mutable_shared.head());
+  EXPECT_NE(original_view.null_mask(), mutable_shared.null_mask());
+  cudf::set_null_mask(mutable_shared.null_mask(), 0, shared->size(), false);
+  EXPECT_EQ(shared->size(), shared->null_count());
+  EXPECT_EQ(0, original.null_count());
+
+  // The original column owns its buffers alone again
+  EXPECT_EQ(original_view.head(), original.mutable_view().head());
+}
+
+TYPED_TEST(TypedColumnTest, ShareWriteOtherOwner)
+{
+  cudf::column original{
+    this->type(), this->num_elements(), std::move(this->data), std::move(this->all_valid_mask)};
+  cudf::column const expected{original};
+  auto shared = original.share();
+
+  // Once the shared column has its own copy, the original owns its buffers alone and is written in
+  // place, here on another stream
+  auto const mutable_shared = shared->mutable_view();
+  EXPECT_NE(original.view().head(), mutable_shared.head());
+  auto const mutable_original = original.mutable_view();
+  rmm::cuda_stream other_stream;
+  CUDF_CUDA_TRY(cudaMemsetAsync(mutable_original.head(),
+                                0xff,
+                                mutable_original.size() * cudf::size_of(mutable_original.type()),
+                                other_stream.value()));
+  cudf::set_null_mask(mutable_original.null_mask(), 0, mutable_original.size(), false);
+  other_stream.synchronize();
+
+  EXPECT_EQ(original.size(), original.null_count());
+  EXPECT_EQ(0, shared->null_count());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *shared);
+}
+
+TYPED_TEST(TypedColumnTest, ReleaseShared)
+{
+  cudf::column original{this->type(), this->num_elements(), std::move(this->data)};
+  auto const original_data = original.view().head();
+  auto shared              = original.share();
+
+  auto contents = shared->release();
+  EXPECT_NE(original_data, contents.data->data());
+  CUDF_TEST_EXPECT_EQUAL_BUFFERS(original_data, contents.data->data(), contents.data->size());
+  EXPECT_EQ(original_data, original.view().head());
+}
+
 TYPED_TEST(TypedColumnTest, MoveConstructorNoMask)
 {
   cudf::column original{this->type(), this->num_elements(), std::move(this->data)};
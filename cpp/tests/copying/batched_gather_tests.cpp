@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+struct BatchedGatherTest : public cudf::test::BaseFixture {
+  void run_test(std::vector<cudf::table_view> const& tables,
+                std::vector<cudf::column_view> const& maps,
+                cudf::out_of_bounds_policy policy = cudf::out_of_bounds_policy::DONT_CHECK)
+  {
+    auto results = cudf::batched_gather(tables, maps, policy);
+    ASSERT_EQ(results.size(), tables.size());
+    for (std::size_t i = 0; i < tables.size(); ++i) {
+      auto expected = cudf::gather(tables[i], maps[i], policy);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), results[i]->view());
+    }
+  }
+};
+
+TEST_F(BatchedGatherTest, FixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> a1({1, 2, 3, 4, 5, 6}, null_at(2));
+  cudf::test::fixed_width_column_wrapper<double> b1{1.5, 2.5, 3.5, 4.5, 5.5, 6.5};
+  cudf::test::fixed_width_column_wrapper<int64_t> a2({10, 20, 30}, nulls_at({0, 2}));
+  cudf::test::fixed_width_column_wrapper<double> b2{-1.0, -2.0, -3.0};
+  cudf::test::fixed_point_column_wrapper<__int128_t> c1({11, 22, 33, 44, 55, 66},
+                                                        numeric::scale_type{-2});
+  cudf::test::fixed_point_column_wrapper<__int128_t> c2({7, 8, 9}, numeric::scale_type{-2});
+  cudf::test::fixed_width_column_wrapper<int32_t> map1{5, 0, 2, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int16_t> map2{2, 1};
+
+  this->run_test({cudf::table_view{{a1, b1, c1}}, cudf::table_view{{a2, b2, c2}}}, {map1, map2});
+}
+
+TEST_F(BatchedGatherTest, Strings)
+{
+  cudf::test::strings_column_wrapper s1({"This", "is", "not", "a", "string", "type"},
+                                        null_at(5));
+  cudf::test::strings_column_wrapper s2{"", "éé", "bbb"};
+  cudf::test::fixed_width_column_wrapper<int32_t> i1{1, 2, 3, 4, 5, 6};
+  cudf::test::fixed_width_column_wrapper<int32_t> i2{7, 8, 9};
+  cudf::test::fixed_width_column_wrapper<int32_t> map1{5, 4, 0, 0, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> map2{2, 0, 1, 2};
+
+  this->run_test({cudf::table_view{{s1, i1}}, cudf::table_view{{i2, s2}}}, {map1, map2});
+
+  auto sliced = cudf::slice(s1, {1, 5});
+  cudf::test::fixed_width_column_wrapper<int32_t> map3{3, 2, 1, 0};
+  this->run_test({cudf::table_view{{sliced}}, cudf::table_view{{s2}}}, {map3, map2});
+}
+
+TEST_F(BatchedGatherTest, ManySmallTables)
+{
+  auto const num_tables = 1000;
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> maps;
+  std::vector<cudf::table_view> tables;
+  for (int t = 0; t < num_tables; ++t) {
+    auto const num_rows = 1 + t % 70;
+    auto values         = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto i) { return static_cast<int64_t>(t * 100 + i); });
+    auto strings = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto i) { return std::string(i % 5, static_cast<char>('a' + t % 26)); });
+    auto valids = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto i) { return (i + t) % 3 != 0; });
+    columns.push_back(cudf::test::fixed_width_column_wrapper<int64_t>(
+                        values, values + num_rows, valids)
+                        .release());
+    columns.push_back(
+      cudf::test::strings_column_wrapper(strings, strings + num_rows, valids).release());
+    tables.push_back(
+      cudf::table_view{{columns[columns.size() - 2]->view(), columns.back()->view()}});
+
+    auto indices = cudf::detail::make_counting_transform_iterator(
+      0, [num_rows](auto i) { return (i * 7) % num_rows; });
+    maps.emplace_back(indices, indices + (t % 45));
+  }
+  std::vector<cudf::column_view> map_views(maps.begin(), maps.end());
+
+  this->run_test(tables, map_views);
+}
+
+TEST_F(BatchedGatherTest, Nullify)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{1, 2, 3, 4};
+  cudf::test::strings_column_wrapper s1{"a", "bb", "ccc", "dddd"};
+  cudf::test::fixed_width_column_wrapper<int32_t> a2({5, 6}, null_at(1));
+  cudf::test::strings_column_wrapper s2({"e", "ff"}, null_at(0));
+  cudf::test::fixed_width_column_wrapper<int32_t> map1{-1, 4, 0, -5, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> map2{1, 2, -2};
+
+  this->run_test({cudf::table_view{{a1, s1}}, cudf::table_view{{a2, s2}}},
+                 {map1, map2},
+                 cudf::out_of_bounds_policy::NULLIFY);
+}
+
+TEST_F(BatchedGatherTest, NestedTypes)
+{
+  // list columns are gathered by table alongside the batched columns
+  cudf::test::lists_column_wrapper<int32_t> l1{{1, 2}, {3}, {}, {4, 5, 6}};
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{1, 2, 3, 4};
+  cudf::test::strings_column_wrapper s2{"e", "ff"};
+  cudf::test::lists_column_wrapper<int32_t> l2{{7}, {8, 9}};
+  cudf::test::fixed_width_column_wrapper<int32_t> map1{3, 0, 0};
+  cudf::test::fixed_width_column_wrapper<int32_t> map2{1};
+
+  this->run_test({cudf::table_view{{l1, a1}}, cudf::table_view{{s2, l2}}}, {map1, map2});
+}
+
+TEST_F(BatchedGatherTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{1, 2, 3};
+  cudf::test::strings_column_wrapper s1{"a", "bb", "ccc"};
+  cudf::test::fixed_width_column_wrapper<int32_t> a2{};
+  cudf::test::strings_column_wrapper s2{};
+  cudf::test::fixed_width_column_wrapper<int32_t> empty_map{};
+  cudf::test::fixed_width_column_wrapper<int32_t> map{0, 2};
+
+  this->run_test({cudf::table_view{{a1, s1}}, cudf::table_view{{a2, s2}}}, {empty_map, empty_map});
+  this->run_test({cudf::table_view{{a1, s1}}, cudf::table_view{}}, {map, empty_map});
+  EXPECT_TRUE(cudf::batched_gather({}, {}).empty());
+}
+
+TEST_F(BatchedGatherTest, Errors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a1{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> map{0, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> null_map({0, 2}, null_at(0));
+  std::vector<cudf::table_view> tables{cudf::table_view{{a1}}};
+
+  std::vector<cudf::column_view> maps{map, map};
+  EXPECT_THROW(cudf::batched_gather(tables, maps), cudf::logic_error);
+  std::vector<cudf::column_view> null_maps{null_map};
+  EXPECT_THROW(cudf::batched_gather(tables, null_maps), cudf::logic_error);
+}
@@ -337,6 +337,37 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
   }
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  // split a table into many small, mostly sliced tables, some of them empty
+  auto const num_rows = 20000;
+  auto iter           = thrust::make_counting_iterator(0);
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  column_wrapper<int8_t> col1(iter, iter + num_rows);
+  column_wrapper<int64_t> col2(iter, iter + num_rows, valids);
+  auto reps = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<__int128_t>(i) << 70; });
+  cudf::test::fixed_point_column_wrapper<__int128_t> col3(
+    reps, reps + num_rows, valids, numeric::scale_type{-1});
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, 'a' + (i % 26)); });
+  s_col_wrapper col4(strings, strings + num_rows, valids);
+  column_wrapper<bool> col5(iter, iter + num_rows);
+  TView input{{col1, col2, col3, col4, col5}};
+
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type split = 0; split < num_rows; split += (split * 7) % 13) {
+    splits.push_back(split);
+    if (splits.size() % 2 == 0) { splits.push_back(split); }
+    ++split;
+  }
+  auto const tables = cudf::split(input, splits);
+  ASSERT_GT(tables.size(), 2000u);
+
+  auto result = cudf::concatenate(tables);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, result->view());
+}
+
 struct OverflowTest : public cudf::test::BaseFixture {
 };
 
@@ -1493,6 +1524,29 @@ TEST_F(ListsColumnTest, SlicedColumnsWithNulls)
   }
 }
 
+TEST_F(ListsColumnTest, ConcatenateManySlicedLists)
+{
+  auto const num_rows = 5000;
+  auto sizes          = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<cudf::size_type>(i % 4); });
+  std::vector<cudf::size_type> h_offsets(num_rows + 1, 0);
+  std::partial_sum(sizes, sizes + num_rows, h_offsets.begin() + 1);
+  auto iter = thrust::make_counting_iterator(0);
+  column_wrapper<int32_t> offsets(h_offsets.begin(), h_offsets.end());
+  column_wrapper<int32_t> values(iter, iter + h_offsets.back());
+  auto const lists = cudf::make_lists_column(
+    num_rows, offsets.release(), values.release(), 0, rmm::device_buffer{});
+
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type split = 1; split < num_rows; split += 1 + split % 5) {
+    splits.push_back(split);
+  }
+  auto const pieces = cudf::split(*lists, splits);
+
+  auto result = cudf::concatenate(pieces);
+  cudf::test::expect_columns_equivalent(*result, *lists);
+}
+
 TEST_F(ListsColumnTest, ListOfStructs)
 {
   using namespace cudf::test;
@@ -19,6 +19,7 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column.hpp>
@@ -473,6 +474,74 @@ TEST_F(CopyTestUntyped, CopyIfElseTypeMismatch)
   EXPECT_THROW(cudf::copy_if_else(lhs_w, rhs_w, mask_w), cudf::logic_error);
 }
 
+struct TableCopyIfElseTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(TableCopyIfElseTest, MatchesColumns)
+{
+  constexpr cudf::size_type num_rows = 1000;
+
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, static_cast<char>('a' + i % 26)); });
+
+  wrapper<int8_t> lhs_col1(sequence, sequence + num_rows + 10);
+  wrapper<int64_t> lhs_col2(sequence, sequence + num_rows + 10, valids);
+  cudf::test::strings_column_wrapper lhs_col3(strings, strings + num_rows + 10, valids);
+  auto const lhs =
+    cudf::slice(cudf::table_view({lhs_col1, lhs_col2, lhs_col3}), {10, num_rows + 10}).front();
+
+  wrapper<int8_t> rhs_col1(sequence + 5, sequence + num_rows + 5, valids);
+  wrapper<int64_t> rhs_col2(sequence + 3, sequence + num_rows + 3);
+  cudf::test::strings_column_wrapper rhs_col3(strings + 7, strings + num_rows + 7);
+  auto const rhs = cudf::table_view({rhs_col1, rhs_col2, rhs_col3});
+
+  auto const mask_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 < 2; });
+  auto const mask_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<bool> mask_w(
+    mask_values, mask_values + num_rows, mask_valids);
+
+  auto const results = cudf::copy_if_else(lhs, rhs, mask_w);
+
+  ASSERT_EQ(results->num_columns(), lhs.num_columns());
+  for (cudf::size_type c = 0; c < lhs.num_columns(); ++c) {
+    auto const expected = cudf::copy_if_else(lhs.column(c), rhs.column(c), mask_w);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, results->get_column(c));
+  }
+}
+
+TEST_F(TableCopyIfElseTest, Empty)
+{
+  wrapper<int32_t> col{};
+  cudf::test::fixed_width_column_wrapper<bool> mask_w{};
+  auto const input = cudf::table_view({col, col});
+
+  auto const results = cudf::copy_if_else(input, input, mask_w);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, results->view());
+}
+
+TEST_F(TableCopyIfElseTest, BadInputs)
+{
+  wrapper<int32_t> int_col{1, 2, 3};
+  wrapper<float> float_col{1, 2, 3};
+  wrapper<int32_t> short_col{1, 2};
+  cudf::test::fixed_width_column_wrapper<bool> mask_w{1, 0, 1};
+  auto const input = cudf::table_view({int_col});
+
+  EXPECT_THROW(cudf::copy_if_else(input, cudf::table_view({float_col}), mask_w),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::copy_if_else(input, cudf::table_view({int_col, int_col}), mask_w),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::copy_if_else(input, cudf::table_view({short_col}), mask_w),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::copy_if_else(input, input, int_col), cudf::logic_error);
+}
+
 struct StringsCopyIfElseTest : public cudf::test::BaseFixture {
 };
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, NVIDIA CORPORATION.
+ * Copyright (c) 2021-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,10 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
 namespace cudf {
 namespace test {
 
@@ -37,6 +41,42 @@ struct PackUnpackTest : public BaseFixture {
     EXPECT_EQ(
       std::equal(metadata.data(), metadata.data() + metadata.size(), packed.metadata_->data()),
       true);
+
+    // verify chunked_pack produces the same packed table
+    run_chunked_test(t, packed);
+  }
+  void run_chunked_test(cudf::table_view const& t,
+                        packed_columns const& expected,
+                        std::size_t user_buffer_size = 1024 * 1024)
+  {
+    cudf::chunked_pack packer(t, user_buffer_size);
+    auto const total_size = packer.get_total_contiguous_size();
+    EXPECT_EQ(total_size, expected.gpu_data->size());
+
+    rmm::device_buffer user_buffer(user_buffer_size, cudf::default_stream_value);
+    rmm::device_buffer gpu_data(total_size, cudf::default_stream_value);
+    std::size_t offset = 0;
+    while (packer.has_next()) {
+      auto const bytes_copied = packer.next(
+        {static_cast<uint8_t*>(user_buffer.data()), user_buffer.size()});
+      EXPECT_LE(offset + bytes_copied, total_size);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(static_cast<uint8_t*>(gpu_data.data()) + offset,
+                                    user_buffer.data(),
+                                    bytes_copied,
+                                    cudaMemcpyDeviceToDevice,
+                                    cudf::default_stream_value.value()));
+      offset += bytes_copied;
+    }
+    EXPECT_EQ(offset, total_size);
+
+    auto const metadata = packer.build_metadata();
+    EXPECT_EQ(metadata.size(), expected.metadata_->size());
+    EXPECT_EQ(
+      std::equal(metadata.data(), metadata.data() + metadata.size(), expected.metadata_->data()),
+      true);
+
+    auto unpacked = unpack(metadata.data(), static_cast<uint8_t const*>(gpu_data.data()));
+    cudf::test::expect_tables_equal(t, unpacked);
   }
   void run_test(std::vector<column_view> const& t) { run_test(cudf::table_view{t}); }
 };
@@ -81,6 +121,43 @@ TEST_F(PackUnpackTest, MultiColumnWithStrings)
 }
 // clang-format on
 
+TEST_F(PackUnpackTest, ChunkedMultipleChunks)
+{
+  // spans several chunks of the user buffer, with buffers crossing chunk boundaries
+  auto const num_rows = 300'000;
+  auto iter           = thrust::make_counting_iterator(0);
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  fixed_width_column_wrapper<int64_t> col1(iter, iter + num_rows, valids);
+  fixed_width_column_wrapper<int8_t> col2(iter, iter + num_rows);
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, 'a' + (i % 26)); });
+  strings_column_wrapper col3(strings, strings + num_rows, valids);
+  cudf::table_view t({col1, col2, col3});
+
+  auto packed = pack(t);
+  this->run_chunked_test(t, packed);
+  this->run_chunked_test(t, packed, 3 * 1024 * 1024 + 17);
+}
+
+TEST_F(PackUnpackTest, ChunkedErrors)
+{
+  fixed_width_column_wrapper<int64_t> col1({1, 2, 3, 4, 5, 6, 7});
+  cudf::table_view t({col1});
+
+  EXPECT_THROW(cudf::chunked_pack(t, 1024), cudf::logic_error);
+
+  auto const user_buffer_size = 1024 * 1024;
+  cudf::chunked_pack packer(t, user_buffer_size);
+  rmm::device_buffer user_buffer(user_buffer_size + 1, cudf::default_stream_value);
+  EXPECT_THROW(packer.build_metadata(), cudf::logic_error);
+  EXPECT_THROW(packer.next({static_cast<uint8_t*>(user_buffer.data()), user_buffer.size()}),
+               cudf::logic_error);
+  packer.next({static_cast<uint8_t*>(user_buffer.data()), user_buffer_size});
+  EXPECT_FALSE(packer.has_next());
+  EXPECT_THROW(packer.next({static_cast<uint8_t*>(user_buffer.data()), user_buffer_size}),
+               cudf::logic_error);
+}
+
 TEST_F(PackUnpackTest, EmptyColumns)
 {
   {
@@ -21,9 +21,11 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -112,3 +114,88 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, SampleWithoutReplacementSmallFraction)
+{
+  cudf::size_type const table_size = 100000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::table_view input({col1});
+
+  for (cudf::size_type const n_samples : {1, 10, 1000}) {
+    auto out_table  = cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 7);
+    EXPECT_EQ(out_table->num_rows(), n_samples);
+    // every row is sampled at most once
+    EXPECT_EQ(cudf::distinct_count(
+                out_table->get_column(0), cudf::null_policy::INCLUDE, cudf::nan_policy::NAN_IS_VALID),
+              n_samples);
+  }
+}
+
+TEST_F(SampleTest, BernoulliSample)
+{
+  cudf::size_type const table_size = 10000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::table_view input({col1});
+
+  EXPECT_EQ(cudf::bernoulli_sample(input, 0.0)->num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::bernoulli_sample(input, 1.0)->view());
+
+  auto const out = cudf::bernoulli_sample(input, 0.1, 3);
+  // the sampled rows keep their input order
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), cudf::sort(out->view())->view());
+  EXPECT_GT(out->num_rows(), 800);
+  EXPECT_LT(out->num_rows(), 1200);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), cudf::bernoulli_sample(input, 0.1, 3)->view());
+
+  // sampling the batches of a table with their row offsets equals sampling the table
+  auto const batches = cudf::split(input, {2500, 7000});
+  std::vector<std::unique_ptr<cudf::table>> batch_samples;
+  std::vector<cudf::table_view> batch_views;
+  int64_t first_row_index = 0;
+  for (auto const& batch : batches) {
+    batch_samples.push_back(cudf::bernoulli_sample(batch, 0.1, 3, first_row_index));
+    batch_views.push_back(batch_samples.back()->view());
+    first_row_index += batch.num_rows();
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), cudf::concatenate(batch_views)->view());
+
+  EXPECT_THROW(cudf::bernoulli_sample(input, 1.5), cudf::logic_error);
+  EXPECT_THROW(cudf::bernoulli_sample(input, -0.5), cudf::logic_error);
+}
+
+TEST_F(SampleTest, ReservoirSampler)
+{
+  cudf::size_type const table_size = 10000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::test::strings_column_wrapper col2(
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return std::to_string(i); }),
+    cudf::detail::make_counting_transform_iterator(table_size,
+                                                   [](auto i) { return std::to_string(i); }));
+  cudf::table_view input({col1, col2});
+
+  for (cudf::size_type const n_samples : {0, 1, 100, 5000}) {
+    cudf::reservoir_sampler sampler(n_samples, 11);
+    for (auto const& batch : cudf::split(input, {10, 10, 3000, 9990})) {
+      sampler.add(batch);
+    }
+    EXPECT_EQ(sampler.num_rows_seen(), table_size);
+
+    auto const expected =
+      cudf::sample(input, n_samples, cudf::sample_with_replacement::FALSE, 11);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), sampler.sample()->view());
+  }
+
+  // the reservoir holds all rows while fewer than n were added
+  cudf::reservoir_sampler sampler(100, 11);
+  EXPECT_EQ(sampler.sample()->num_columns(), 0);
+  sampler.add(cudf::slice(input, {0, 30})[0]);
+  auto const sorted = cudf::sort(sampler.sample()->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(input, {0, 30})[0], sorted->view());
+
+  cudf::test::fixed_width_column_wrapper<float> other({1.f});
+  EXPECT_THROW(sampler.add(cudf::table_view({other})), cudf::logic_error);
+  EXPECT_THROW(cudf::reservoir_sampler(-1), cudf::logic_error);
+}
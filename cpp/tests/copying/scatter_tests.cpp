@@ -670,6 +670,53 @@ TEST_F(BooleanMaskScatterString, WithNUll)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_table, got->view());
 }
 
+class BooleanMaskScatterTable : public cudf::test::BaseFixture {
+};
+
+TEST_F(BooleanMaskScatterTable, SlicedColumnsAndMaskNulls)
+{
+  constexpr cudf::size_type num_rows = 1000;
+
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 4, static_cast<char>('a' + i % 26)); });
+  cudf::test::fixed_width_column_wrapper<int16_t> source_col1(
+    sequence, sequence + num_rows + 10, valids);
+  cudf::test::fixed_width_column_wrapper<double> source_col2(sequence, sequence + num_rows + 10);
+  cudf::test::strings_column_wrapper source_col3(strings, strings + num_rows + 10, valids);
+  auto const source_table =
+    cudf::slice(cudf::table_view({source_col1, source_col2, source_col3}), {10, num_rows + 10})
+      .front();
+
+  cudf::test::fixed_width_column_wrapper<int16_t> target_col1(sequence + 7,
+                                                              sequence + num_rows + 7);
+  cudf::test::fixed_width_column_wrapper<double> target_col2(
+    sequence + 3, sequence + num_rows + 3, valids);
+  cudf::test::strings_column_wrapper target_col3(strings + 5, strings + num_rows + 5);
+  auto const target_table = cudf::table_view({target_col1, target_col2, target_col3});
+
+  auto const mask_values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 < 2; });
+  auto const mask_valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<bool> mask(
+    mask_values, mask_values + num_rows, mask_valids);
+
+  std::vector<cudf::size_type> h_scatter_map;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    if (mask_values[i] && mask_valids[i]) { h_scatter_map.push_back(i); }
+  }
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> scatter_map(h_scatter_map.begin(),
+                                                                      h_scatter_map.end());
+  auto const expected = cudf::scatter(source_table, scatter_map, target_table);
+
+  auto got = cudf::boolean_mask_scatter(source_table, target_table, mask);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
 class BooleanMaskScatterFails : public cudf::test::BaseFixture {
 };
 
@@ -16,8 +16,10 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -269,6 +271,49 @@ TYPED_TEST(TypedDatetimeOpsTest, TestExtractingGeneratedNullableDatetimeComponen
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*extract_second(timestamps), expected_seconds);
 }
 
+TYPED_TEST(TypedDatetimeOpsTest, TestExtractingComponentsInOnePass)
+{
+  using T = TypeParam;
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto start = milliseconds(-2500000000000);  // Sat, 11 Oct 1890 19:33:20 GMT
+  auto stop  = milliseconds(2500000000000);   // Mon, 22 Mar 2049 04:26:40 GMT
+  auto timestamps =
+    generate_timestamps<T, true>(this->size(), time_point_ms(start), time_point_ms(stop));
+
+  auto const components = std::vector<datetime_component>{datetime_component::SECOND,
+                                                          datetime_component::YEAR,
+                                                          datetime_component::MONTH,
+                                                          datetime_component::DAY,
+                                                          datetime_component::WEEKDAY,
+                                                          datetime_component::HOUR,
+                                                          datetime_component::MINUTE,
+                                                          datetime_component::DAY_OF_YEAR,
+                                                          datetime_component::QUARTER,
+                                                          datetime_component::YEAR};
+  auto const results = extract_components(timestamps, components);
+
+  ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(components.size()));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), *extract_second(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), *extract_year(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), *extract_month(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(3), *extract_day(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(4), *extract_weekday(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(5), *extract_hour(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(6), *extract_minute(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(7), *day_of_year(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(8), *extract_quarter(timestamps));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(9), *extract_year(timestamps));
+
+  auto const empty = extract_components(
+    cudf::slice(timestamps, {0, 0}).front(), {datetime_component::YEAR, datetime_component::DAY});
+  ASSERT_EQ(empty->num_columns(), 2);
+  EXPECT_EQ(empty->num_rows(), 0);
+  EXPECT_EQ(extract_components(timestamps, {})->num_columns(), 0);
+}
+
 TEST_F(BasicDatetimeOpsTest, TestLastDayOfMonthWithSeconds)
 {
   using namespace cudf::test;
@@ -999,4 +1044,60 @@ TYPED_TEST(TypedDatetimeOpsTest, TestRoundDatetime)
                                  expected_nanosecond);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+
+  auto const utc = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {
+      1656676800L,  // 2022-07-01 12:00:00 UTC
+      0L,           // null
+      1669896000L,  // 2022-12-01 12:00:00 UTC
+    },
+    {true, false, true}};
+  auto const new_york = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {
+      1656662400L,  // 2022-07-01 08:00:00 EDT
+      0L,           // null
+      1669878000L,  // 2022-12-01 07:00:00 EST
+    },
+    {true, false, true}};
+  auto const paris = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {
+      1656684000L,  // 2022-07-01 14:00:00 CEST
+      0L,           // null
+      1669899600L,  // 2022-12-01 13:00:00 CET
+    },
+    {true, false, true}};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "UTC", "America/New_York"), new_york);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(new_york, "America/New_York", "UTC"), utc);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(new_york, "America/New_York", "Europe/Paris"),
+                                 paris);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc, "UTC", "UTC"), utc);
+
+  auto const utc_ms = fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+    1656676800123L, 1669896000456L};
+  auto const new_york_ms = fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>{
+    1656662400123L, 1669878000456L};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*convert_timezone(utc_ms, "", "America/New_York"), new_york_ms);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezoneInvalidInput)
+{
+  using namespace cudf::datetime;
+
+  auto const days =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_D, cudf::timestamp_D::rep>{19174};
+  EXPECT_THROW(convert_timezone(days, "UTC", "Europe/Paris"), cudf::logic_error);
+
+  auto const integers = cudf::test::fixed_width_column_wrapper<int64_t>{1656676800L};
+  EXPECT_THROW(convert_timezone(integers, "UTC", "Europe/Paris"), cudf::logic_error);
+
+  auto const seconds =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{1656676800L};
+  EXPECT_THROW(convert_timezone(seconds, "UTC", "Not/A_Timezone"), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/dictionary/dictionary_builder.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <utility>
+
+struct DictionaryBuilderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DictionaryBuilderTest, StringsColumn)
+{
+  cudf::dictionary::dictionary_builder builder(cudf::data_type{cudf::type_id::STRING});
+
+  cudf::test::strings_column_wrapper batch1({"fff", "aaa", "ddd", "aaa", "fff"});
+  auto const indices1 = builder.add(batch1);
+  cudf::test::fixed_width_column_wrapper<uint32_t> indices1_expected({0, 1, 2, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices1->view(), indices1_expected);
+
+  cudf::test::strings_column_wrapper batch2({"ccc", "ddd", "bbb", "ccc", "fff"});
+  auto const indices2 = builder.add(batch2);
+  cudf::test::fixed_width_column_wrapper<uint32_t> indices2_expected({3, 2, 4, 3, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(indices2->view(), indices2_expected);
+
+  cudf::test::strings_column_wrapper keys_expected({"fff", "aaa", "ddd", "ccc", "bbb"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(builder.keys(), keys_expected);
+
+  // the indices of the first batch remain valid after adding the second
+  for (auto const& [indices, batch] : {std::pair{indices1->view(), cudf::column_view{batch1}},
+                                       std::pair{indices2->view(), cudf::column_view{batch2}}}) {
+    auto const dictionary = builder.make_dictionary(indices);
+    cudf::dictionary_column_view view(dictionary->view());
+    cudf::test::strings_column_wrapper sorted_keys({"aaa", "bbb", "ccc", "ddd", "fff"});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), sorted_keys);
+    auto const decoded = cudf::dictionary::decode(view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), batch);
+  }
+}
+
+TEST_F(DictionaryBuilderTest, WithNull)
+{
+  cudf::dictionary::dictionary_builder builder(cudf::data_type{cudf::type_id::INT64});
+
+  cudf::test::fixed_width_column_wrapper<int64_t> batch1{{555, 0, 333, 111, 0, 555},
+                                                         {1, 1, 0, 1, 0, 1}};
+  auto const indices1 = builder.add(batch1);
+  cudf::test::fixed_width_column_wrapper<uint32_t> indices1_expected{{0, 1, 0, 2, 0, 0},
+                                                                     {1, 1, 0, 1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices1->view(), indices1_expected);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> batch2{{333, 111, 222}, {1, 0, 1}};
+  auto const indices2 = builder.add(batch2);
+  cudf::test::fixed_width_column_wrapper<uint32_t> indices2_expected{{3, 0, 4}, {1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices2->view(), indices2_expected);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> keys_expected{555, 0, 111, 333, 222};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(builder.keys(), keys_expected);
+
+  auto const dictionary = builder.make_dictionary(indices1->view());
+  cudf::dictionary_column_view view(dictionary->view());
+  cudf::test::fixed_width_column_wrapper<int64_t> sorted_keys{0, 111, 222, 333, 555};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.keys(), sorted_keys);
+  auto const decoded = cudf::dictionary::decode(view);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(decoded->view(), batch1);
+}
+
+TEST_F(DictionaryBuilderTest, Empty)
+{
+  cudf::dictionary::dictionary_builder builder(cudf::data_type{cudf::type_id::FLOAT32});
+
+  cudf::test::fixed_width_column_wrapper<float> empty{};
+  auto const indices = builder.add(empty);
+  EXPECT_EQ(indices->size(), 0);
+  EXPECT_EQ(builder.keys().size(), 0);
+
+  auto const dictionary = builder.make_dictionary(indices->view());
+  EXPECT_EQ(dictionary->size(), 0);
+}
+
+TEST_F(DictionaryBuilderTest, Errors)
+{
+  EXPECT_THROW(
+    cudf::dictionary::dictionary_builder(cudf::data_type{cudf::type_id::DICTIONARY32}),
+    cudf::logic_error);
+
+  cudf::dictionary::dictionary_builder builder(cudf::data_type{cudf::type_id::INT32});
+  cudf::test::fixed_width_column_wrapper<int64_t> wrong_type{1, 2, 3};
+  EXPECT_THROW(builder.add(wrong_type), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> indices{0, 1};
+  EXPECT_THROW(builder.make_dictionary(indices), cudf::logic_error);
+}
@@ -16,6 +16,7 @@
 
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
@@ -69,6 +70,39 @@ TEST_F(DictionaryEncodeTest, EncodeWithNull)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.indices(), expected);
 }
 
+TEST_F(DictionaryEncodeTest, EncodeKeys)
+{
+  cudf::test::strings_column_wrapper strings({"b", "a", "b", "", "c"}, {1, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5});
+
+  auto results = cudf::dictionary::encode_keys(cudf::table_view({strings, ints}));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 0, 1, 0, 2}, {1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(0), expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view().column(1), ints);
+}
+
+TEST_F(DictionaryEncodeTest, EncodeJoinKeys)
+{
+  cudf::test::strings_column_wrapper left({"b", "a", "d", "a"});
+  cudf::test::strings_column_wrapper right({"d", "c", "", "b"}, {1, 1, 0, 1});
+
+  auto [left_codes, right_codes] =
+    cudf::dictionary::encode_keys(cudf::table_view({left}), cudf::table_view({right}));
+
+  // the dictionary is shared by both tables
+  cudf::test::fixed_width_column_wrapper<int32_t> left_expected({1, 0, 3, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> right_expected({3, 2, 0, 1}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(left_codes->view().column(0), left_expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(right_codes->view().column(0), right_expected);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4});
+  EXPECT_THROW(cudf::dictionary::encode_keys(cudf::table_view({left}), cudf::table_view({ints})),
+               cudf::logic_error);
+  EXPECT_THROW(
+    cudf::dictionary::encode_keys(cudf::table_view({left}), cudf::table_view({right, ints})),
+    cudf::logic_error);
+}
+
 TEST_F(DictionaryEncodeTest, InvalidEncode)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> input{0, 1, 2, 3, -1, -2, -3};
@@ -138,4 +138,45 @@ TYPED_TEST(EncodeNumericTests, TableEncodeWithNulls)
   cudf::test::expect_columns_equal(result.second->view(), expect);
 }
 
+TEST_F(EncodeStringTest, FirstAppearanceOrder)
+{
+  cudf::test::strings_column_wrapper input{{"b", "a", "b", "c", "x", "a"}, {1, 1, 1, 1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect{0, 1, 0, 2, 3, 1};
+  cudf::test::strings_column_wrapper expect_keys{{"b", "a", "c", ""}, {1, 1, 1, 0}};
+  auto const result =
+    cudf::encode(cudf::table_view({input}), cudf::encode_key_order::FIRST_APPEARANCE);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.first->view().column(0), expect_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second->view(), expect);
+}
+
+TEST_F(EncodeStringTest, SortedKeyOrder)
+{
+  cudf::test::strings_column_wrapper input{{"ef", "a", "c", "d", "ef", "a"}, {1, 0, 1, 1, 0, 1}};
+  auto const expect = cudf::encode(cudf::table_view({input}));
+  auto const result = cudf::encode(cudf::table_view({input}), cudf::encode_key_order::SORTED);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.first->view(), expect.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second->view(), expect.second->view());
+}
+
+TYPED_TEST(EncodeNumericTests, TableFirstAppearanceWithNulls)
+{
+  auto col_1 = cudf::test::fixed_width_column_wrapper<TypeParam>({1, 0, 2, 0, 1}, {1, 0, 1, 0, 1});
+  auto col_2 = cudf::test::fixed_width_column_wrapper<TypeParam>({1, 3, 2, 0, 1}, {1, 1, 1, 0, 1});
+  auto input = cudf::table_view({col_1, col_2});
+
+  auto expect_keys_col1 =
+    cudf::test::fixed_width_column_wrapper<TypeParam>({1, 0, 2, 0}, {1, 0, 1, 0});
+  auto expect_keys_col2 =
+    cudf::test::fixed_width_column_wrapper<TypeParam>({1, 3, 2, 0}, {1, 1, 1, 0});
+  auto expect_keys = cudf::table_view({expect_keys_col1, expect_keys_col2});
+  auto expect      = cudf::test::fixed_width_column_wrapper<cudf::size_type>({0, 1, 2, 3, 0});
+
+  auto const result = cudf::encode(input, cudf::encode_key_order::FIRST_APPEARANCE);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.first->view(), expect_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.second->view(), expect);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
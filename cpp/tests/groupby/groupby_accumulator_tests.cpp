@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+
+using namespace cudf::test::iterators;
+
+namespace {
+using K = int32_t;
+using V = int32_t;
+
+std::vector<cudf::groupby::accumulation_request> make_requests()
+{
+  std::vector<cudf::groupby::accumulation_request> requests(1);
+  requests[0].values_index = 1;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_m2_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+
+/**
+ * @brief Sorts the keys and every result column by the keys so that the groups of the
+ * accumulator and of the groupby can be compared.
+ */
+std::vector<std::unique_ptr<cudf::column>> sorted_by_key(
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>>&& result)
+{
+  auto const keys = result.first->view();
+  std::vector<std::unique_ptr<cudf::column>> sorted;
+  sorted.push_back(std::move(cudf::sort_by_key(keys, keys)->release().front()));
+  for (auto const& col : result.second.front().results) {
+    sorted.push_back(std::move(cudf::sort_by_key(cudf::table_view{{col->view()}}, keys)
+                                 ->release()
+                                 .front()));
+  }
+  return sorted;
+}
+}  // namespace
+
+struct groupby_accumulator_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_accumulator_test, MatchesGroupbyOverConcatenatedBatches)
+{
+  cudf::test::fixed_width_column_wrapper<K> keys0{1, 2, 3, 1, 2};
+  cudf::test::fixed_width_column_wrapper<V> vals0({0, 1, 2, 3, 4}, null_at(3));
+  cudf::test::fixed_width_column_wrapper<K> keys1{2, 4, 4, 1};
+  cudf::test::fixed_width_column_wrapper<V> vals1{5, 6, 7, 8};
+  cudf::test::fixed_width_column_wrapper<K> keys2{5, 3, 3};
+  cudf::test::fixed_width_column_wrapper<V> vals2({9, 10, 11}, null_at(0));
+
+  std::vector<cudf::table_view> const batches{cudf::table_view{{keys0, vals0}},
+                                              cudf::table_view{{keys1, vals1}},
+                                              cudf::table_view{{keys2, vals2}}};
+
+  cudf::groupby::groupby_accumulator acc({0}, make_requests());
+  for (auto const& batch : batches) {
+    acc.update(batch);
+  }
+  auto const accumulated = sorted_by_key(acc.finalize());
+
+  auto const all = cudf::concatenate(batches);
+  auto requests  = make_requests();
+  std::vector<cudf::groupby::aggregation_request> gb_requests(1);
+  gb_requests[0].values       = all->get_column(1).view();
+  gb_requests[0].aggregations = std::move(requests[0].aggregations);
+  auto const expected =
+    sorted_by_key(cudf::groupby::groupby(cudf::table_view{{all->get_column(0).view()}})
+                    .aggregate(gb_requests));
+
+  ASSERT_EQ(accumulated.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected[i], *accumulated[i]);
+  }
+}
+
+TEST_F(groupby_accumulator_test, FinalizeWithoutUpdate)
+{
+  cudf::groupby::groupby_accumulator acc({0}, make_requests());
+  EXPECT_THROW(acc.finalize(), cudf::logic_error);
+}
+
+TEST_F(groupby_accumulator_test, MismatchedBatchTypes)
+{
+  cudf::test::fixed_width_column_wrapper<K> keys{1, 2};
+  cudf::test::fixed_width_column_wrapper<V> vals{3, 4};
+  cudf::test::fixed_width_column_wrapper<int64_t> wide_vals{3, 4};
+
+  cudf::groupby::groupby_accumulator acc({0}, make_requests());
+  acc.update(cudf::table_view{{keys, vals}});
+  EXPECT_THROW(acc.update(cudf::table_view{{keys, wide_vals}}), cudf::logic_error);
+}
+
+TEST_F(groupby_accumulator_test, UnsupportedAggregation)
+{
+  std::vector<cudf::groupby::accumulation_request> requests(1);
+  requests[0].values_index = 1;
+  requests[0].aggregations.push_back(cudf::make_median_aggregation<cudf::groupby_aggregation>());
+  EXPECT_THROW(cudf::groupby::groupby_accumulator({0}, std::move(requests)), cudf::logic_error);
+}
@@ -92,5 +92,30 @@ TYPED_TEST(groupby_group_keys_and_values_test, some_nulls)
   test_groups(keys, expect_grouped_keys, expect_group_offsets, values, expect_grouped_values);
 }
 
+TEST_F(groupby_group_keys_test, exported_plan)
+{
+  using K = int32_t;
+
+  fixed_width_column_wrapper<K> keys({1, 1, 2, 1, 2, 3, 2}, null_at(5));
+  fixed_width_column_wrapper<K> vals{0, 1, 2, 3, 4, 5, 6};
+
+  auto const plan = groupby::groupby(table_view({keys})).export_plan();
+  groupby::groupby gb_obj(table_view({keys}), plan);
+
+  fixed_width_column_wrapper<K> expect_grouped_keys{1, 1, 1, 2, 2, 2};
+  fixed_width_column_wrapper<K> expect_grouped_vals{0, 1, 3, 2, 4, 6};
+  std::vector<size_type> expect_group_offsets = {0, 3, 6};
+
+  auto const groups = gb_obj.get_groups(table_view({vals}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(groups.keys->view().column(0), expect_grouped_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(groups.values->view().column(0), expect_grouped_vals);
+  EXPECT_EQ(groups.offsets, expect_group_offsets);
+
+  fixed_width_column_wrapper<K> other_keys{1, 2, 1};
+  EXPECT_THROW(groupby::groupby(table_view({other_keys}), plan), cudf::logic_error);
+  EXPECT_THROW(groupby::groupby(table_view({keys}), plan, null_policy::INCLUDE),
+               cudf::logic_error);
+}
+
 }  // namespace test
 }  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
 
 using namespace cudf::test::iterators;
 
@@ -48,7 +49,11 @@ auto compute_M2(cudf::column_view const& keys, cudf::column_view const& values)
 
   auto gb_obj = cudf::groupby::groupby(cudf::table_view({keys}));
   auto result = gb_obj.aggregate(requests);
-  return std::pair(std::move(result.first->release()[0]), std::move(result.second[0].results[0]));
+
+  // the order of the groups is unspecified, so compare them sorted by key
+  auto const groups = cudf::table_view({result.first->get_column(0), *result.second[0].results[0]});
+  auto sorted       = cudf::sort_by_key(groups, result.first->view())->release();
+  return std::pair(std::move(sorted[0]), std::move(sorted[1]));
 }
 }  // namespace
 
@@ -22,6 +22,9 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+
+#include <limits>
 
 using namespace cudf::test::iterators;
 
@@ -56,6 +59,37 @@ TYPED_TEST(groupby_sum_test, basic)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, many_groups)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // more groups than are aggregated in shared memory by the hash groupby
+  auto constexpr num_groups = 3000;
+  auto constexpr num_rows   = 3 * num_groups;
+
+  auto const key_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % num_groups; });
+  auto const val_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto const expect_iter =
+    cudf::detail::make_counting_transform_iterator(0, [val_iter](auto i) {
+      return val_iter[i] + val_iter[i + num_groups] + val_iter[i + 2 * num_groups];
+    });
+
+  fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+  fixed_width_column_wrapper<V> vals(val_iter, val_iter + num_rows);
+
+  fixed_width_column_wrapper<K> expect_keys(key_iter, key_iter + num_groups);
+  fixed_width_column_wrapper<R> expect_vals(expect_iter, expect_iter + num_groups);
+
+  auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+
+  auto agg2 = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 TYPED_TEST(groupby_sum_test, empty_cols)
 {
   using V = TypeParam;
@@ -74,6 +108,39 @@ TYPED_TEST(groupby_sum_test, empty_cols)
   test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
 }
 
+TYPED_TEST(groupby_sum_test, with_min_max_count)
+{
+  using V = TypeParam;
+  using R = cudf::detail::target_type_t<V, aggregation::SUM>;
+
+  // the sort groupby computes these reductions of a numeric column in a single pass
+  fixed_width_column_wrapper<K> keys{1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 4};
+  fixed_width_column_wrapper<V> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, nulls_at({3, 8, 10}));
+
+  fixed_width_column_wrapper<K> expect_keys{1, 2, 3, 4};
+  fixed_width_column_wrapper<R> expect_sums({6, 19, 9, 0}, null_at(3));
+  fixed_width_column_wrapper<V> expect_mins({0, 1, 2, 0}, null_at(3));
+  fixed_width_column_wrapper<V> expect_maxes({6, 9, 7, 0}, null_at(3));
+  fixed_width_column_wrapper<size_type> expect_counts{2, 4, 2, 0};
+
+  std::vector<groupby::aggregation_request> requests(1);
+  requests[0].values = vals;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_min_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<groupby_aggregation>());
+  // WAR to force groupby to use sort implementation
+  requests[0].aggregations.push_back(make_nth_element_aggregation<groupby_aggregation>(0));
+
+  auto const result = groupby::groupby(table_view({keys})).aggregate(requests);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view({expect_keys}), result.first->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_sums, *result.second[0].results[0]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_mins, *result.second[0].results[1]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_maxes, *result.second[0].results[2]);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expect_counts, *result.second[0].results[3]);
+}
+
 TYPED_TEST(groupby_sum_test, zero_valid_keys)
 {
   using V = TypeParam;
@@ -238,5 +305,32 @@ TYPED_TEST(FixedPointTestAllReps, GroupByHashSumDecimalAsValue)
   }
 }
 
+struct groupby_sum_decimal128_test : public cudf::test::BaseFixture {
+};
+
+TEST_F(groupby_sum_decimal128_test, CarryAcrossWords)
+{
+  using namespace numeric;
+  using RepType    = __int128_t;
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<RepType>;
+
+  auto constexpr low_max = static_cast<RepType>(std::numeric_limits<uint64_t>::max());
+  auto constexpr two_64  = low_max + 1;
+  auto const scale       = scale_type{-2};
+
+  // the sums carry into, or borrow from, the high 64 bits
+  auto const keys = fixed_width_column_wrapper<K>{1, 2, 3, 1, 2, 3, 1, 4, 4};
+  auto const vals = fp_wrapper{
+    {low_max, -1, two_64, 1, 1, -two_64, low_max, 0, 0}, {1, 1, 1, 1, 1, 1, 1, 0, 1}, scale};
+
+  auto const expect_keys = fixed_width_column_wrapper<K>{1, 2, 3, 4};
+  auto const expect_vals = fp_wrapper{{2 * low_max + 1, 0, 0, 0}, scale};
+
+  auto agg = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg));
+  auto agg2 = cudf::make_sum_aggregation<groupby_aggregation>();
+  test_single_agg(keys, vals, expect_keys, expect_vals, std::move(agg2), force_use_sort_impl::YES);
+}
+
 }  // namespace test
 }  // namespace cudf
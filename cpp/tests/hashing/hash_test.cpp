@@ -1105,4 +1105,173 @@ TYPED_TEST(MD5HashTestFloatTyped, TestListExtremes)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), verbosity);
 }
 
+class XXHash64Test : public cudf::test::BaseFixture {
+};
+
+TEST_F(XXHash64Test, Strings)
+{
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy"});
+  fixed_width_column_wrapper<uint64_t> const expected({17241709254077376921ul,
+                                                      14534496656690829792ul,
+                                                      17291005374665645904ul,
+                                                      8192060544336983731ul});
+  auto const output = cudf::hash(cudf::table_view({strings_col}), cudf::hash_id::HASH_XXHASH64, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected, verbosity);
+}
+
+TEST_F(XXHash64Test, MultiValueNullsWithSeed)
+{
+  strings_column_wrapper const strings_col({"",
+                                            "The quick brown fox",
+                                            "jumps over the lazy dog.",
+                                            "All work and no play makes Jack a dull boy",
+                                            ""},
+                                           {1, 1, 1, 1, 0});
+  fixed_width_column_wrapper<int32_t> const ints_col(
+    {0, 100, -100, std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min()});
+
+  // each element's hash is the seed for the next; a null passes the seed through
+  fixed_width_column_wrapper<uint64_t> const expected({5333022629466737987ul,
+                                                      6923444916845418808ul,
+                                                      7316197137724241447ul,
+                                                      2943317723390206568ul,
+                                                      2073849959933241805ul});
+  auto const output =
+    cudf::hash(cudf::table_view({strings_col, ints_col}), cudf::hash_id::HASH_XXHASH64, 42);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected, verbosity);
+}
+
+TEST_F(XXHash64Test, ListValues)
+{
+  using LCW           = cudf::test::lists_column_wrapper<int32_t>;
+  auto const validity = std::vector<bool>{1, 0, 1};
+  LCW const col{LCW{1, 2}, LCW{3}, LCW{}, LCW({1, 0, 2}, validity.begin())};
+
+  fixed_width_column_wrapper<uint64_t> const expected({5198315416625828423ul,
+                                                      11933525719469662909ul,
+                                                      4246796580750024372ul,
+                                                      12550872538265562195ul});
+  auto const output = cudf::hash(cudf::table_view({col}), cudf::hash_id::HASH_XXHASH64, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected, verbosity);
+}
+
+TEST_F(XXHash64Test, FloatingPointNormalized)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fixed_width_column_wrapper<double> const col1({0.0, 1.5, nan});
+  fixed_width_column_wrapper<double> const col2({-0.0, 1.5, -nan});
+
+  auto const output1 = cudf::hash(cudf::table_view({col1}), cudf::hash_id::HASH_XXHASH64);
+  auto const output2 = cudf::hash(cudf::table_view({col2}), cudf::hash_id::HASH_XXHASH64);
+  EXPECT_EQ(output1->type().id(), cudf::type_id::UINT64);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view(), verbosity);
+}
+
+class SHAHashTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SHAHashTest, Strings)
+{
+  strings_column_wrapper const strings_col(
+    {"",
+     "abc",
+     "A very long (greater than 128 bytes/char string) to test a multi hash-step data point in the "
+     "MD5 hash function. This string needed to be longer.",
+     "All work and no play makes Jack a dull boy"});
+  auto const input = cudf::table_view({strings_col});
+
+  strings_column_wrapper const sha1_expected({"da39a3ee5e6b4b0d3255bfef95601890afd80709",
+                                              "a9993e364706816aba3e25717850c26c9cd0d89d",
+                                              "20bfa89b2f495def2cc203d4d5b3fa02f51ebcac",
+                                              "a62ca720fbab830c8890044eacbeac216f1ca2e4"});
+  strings_column_wrapper const sha256_expected(
+    {"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+     "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+     "13a6e32951123d739600384a56747f8a211be54b308fadc393065632c333a796",
+     "2ce9936a4a2234bf8a76c37d92e01d549d03949792242e7f8a1ad68575e4e4a8"});
+  strings_column_wrapper const sha512_expected(
+    {"cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+     "47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e",
+     "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+     "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f",
+     "47bc37a9875d2b7bba129d77250a614c2964bfa4cb83fc7666dda64becb35960"
+     "2afd2c31e5a07ce78e3f3213f7b1619096f38a4b539ed692373499469500a895",
+     "bae9eb4b5c05a4c5f85750b70b2f0ce78e387f992f0927a017eb40bd180a1300"
+     "4f6252a6bbf9816f195fb7d86668c393dc0985aaf7168f48e8b905f3b9b02df2"});
+
+  auto const sha1_output   = cudf::hash(input, cudf::hash_id::HASH_SHA1);
+  auto const sha256_output = cudf::hash(input, cudf::hash_id::HASH_SHA256);
+  auto const sha512_output = cudf::hash(input, cudf::hash_id::HASH_SHA512);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha1_output->view(), sha1_expected, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output->view(), sha256_expected, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha512_output->view(), sha512_expected, verbosity);
+}
+
+TEST_F(SHAHashTest, MultiValueLongStrings)
+{
+  // The elements of a row are hashed as a single message; whole chunks of the long string are
+  // hashed directly after completing the partial chunk started by the first column
+  std::string const long_string(1000, 'x');
+  strings_column_wrapper const strings_col1({"abc", "abc", "", "abc"}, {1, 1, 1, 0});
+  strings_column_wrapper const strings_col2({long_string, "abc", "", long_string});
+  auto const input = cudf::table_view({strings_col1, strings_col2});
+
+  strings_column_wrapper const sha1_expected({"05709dc74695e668245331c8d59388124554866c",
+                                              "f8c1d87006fbf7e5cc4b026c3138bc046883dc71",
+                                              "da39a3ee5e6b4b0d3255bfef95601890afd80709",
+                                              "c3efa690fa3fdd2e2526853eed670538ea127638"});
+  strings_column_wrapper const sha256_expected(
+    {"fa259cba84b8396f10d600b864507f0f17ed30c99d4295a4637adf2b17a83f46",
+     "bbb59da3af939f7af5f360f2ceb80a496e3bae1cd87dde426db0ae40677e1c2c",
+     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+     "44f8354494a5ba03ba1792a8d3e9c534c47a9181980fde7a3f44b06ef2ae7c7f"});
+  strings_column_wrapper const sha512_expected(
+    {"0b7fba5e9940c413d58ecb87ab58b2cc4d7a551f18b494870ea7468e04857e33"
+     "bbbe22f5a1047f53d273ac2d9255192eeab019d061d4d3656fc03fd9502f3f14",
+     "f3c41e7b63ee869596fc28bad64120612c520f65928ab4d126c72c6998b551b8"
+     "ff1ceddfed4373e6717554dc89d1eee6f0ab22fd3675e561aba9ae26a3eec53b",
+     "cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+     "47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e",
+     "ae13575c5d98bfa689617bb19f0f55efdd52b39397fd620bcd1fbc03fda979e6"
+     "b69bfba24698176eafe766d31c48b70273b03198064323082e04cc4eb9126310"});
+
+  auto const sha1_output   = cudf::hash(input, cudf::hash_id::HASH_SHA1);
+  auto const sha256_output = cudf::hash(input, cudf::hash_id::HASH_SHA256);
+  auto const sha512_output = cudf::hash(input, cudf::hash_id::HASH_SHA512);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha1_output->view(), sha1_expected, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha256_output->view(), sha256_expected, verbosity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sha512_output->view(), sha512_expected, verbosity);
+}
+
+TEST_F(SHAHashTest, Integers)
+{
+  fixed_width_column_wrapper<int32_t> const ints_col({0, 100, -100});
+  auto const input = cudf::table_view({ints_col});
+
+  strings_column_wrapper const expected(
+    {"df3f619804a92fdb4057192dc43dd748ea778adc52bc498ce80524c014b81119",
+     "40e736c02a102a050e1555781b4171020a4279adaa7ed9ca3cc9633a0ade9c37",
+     "76aa0c2e5a1d299f82a3df17919d4d517a9e8c61b3f68d1b5c14685317e16ce0"});
+  auto const output = cudf::hash(input, cudf::hash_id::HASH_SHA256);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(output->view(), expected, verbosity);
+}
+
+TEST_F(SHAHashTest, Empty)
+{
+  strings_column_wrapper const strings_col;
+  auto const input = cudf::table_view({strings_col});
+
+  for (auto hid : {cudf::hash_id::HASH_MD5,
+                   cudf::hash_id::HASH_SHA1,
+                   cudf::hash_id::HASH_SHA256,
+                   cudf::hash_id::HASH_SHA512}) {
+    auto const output = cudf::hash(input, hid);
+    EXPECT_EQ(output->size(), 0);
+    EXPECT_EQ(output->type().id(), cudf::type_id::STRING);
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/interop.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace cudf::test;
+
+struct ArrowDeviceTest : public BaseFixture {
+};
+
+std::unique_ptr<cudf::table> make_device_test_table()
+{
+  auto valids = iterators::null_at(1);
+  fixed_width_column_wrapper<int32_t> ints({1, 2, 3, 4, 5}, valids);
+  fixed_width_column_wrapper<double> doubles{1.5, 2.5, 3.5, 4.5, 5.5};
+  fixed_width_column_wrapper<bool> bools({true, false, true, true, false}, valids);
+  fixed_point_column_wrapper<int64_t> decimals({100, 200, 300, 400, 500}, numeric::scale_type{-2});
+  strings_column_wrapper strings({"a", "", "bcd", "efgh", "ij"}, valids);
+  lists_column_wrapper<int32_t> lists({{1, 2}, {}, {3}, {4, 5, 6}, {7}}, valids);
+  fixed_width_column_wrapper<int16_t> fields{10, 20, 30, 40, 50};
+  strings_column_wrapper names{"v", "w", "x", "y", "z"};
+  structs_column_wrapper structs({fields, names}, {1, 1, 0, 1, 1});
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(ints.release());
+  columns.push_back(doubles.release());
+  columns.push_back(bools.release());
+  columns.push_back(decimals.release());
+  columns.push_back(strings.release());
+  columns.push_back(lists.release());
+  columns.push_back(structs.release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+TEST_F(ArrowDeviceTest, Schema)
+{
+  auto table = make_device_test_table();
+  std::vector<cudf::column_metadata> metadata{
+    {"ints"}, {"doubles"}, {"bools"}, {"decimals"}, {"strings"}, {"lists"}, {"structs"}};
+  metadata[5].children_meta = {{"offsets"}, {"element"}};
+  metadata[6].children_meta = {{"field"}, {"name"}};
+
+  auto schema = cudf::to_arrow_schema(table->view(), metadata);
+
+  EXPECT_EQ(std::string{schema->format}, "+s");
+  ASSERT_EQ(schema->n_children, 7);
+  std::vector<std::string> const formats{"i", "g", "b", "d:18,2,64", "u", "+l", "+s"};
+  for (std::size_t i = 0; i < formats.size(); ++i) {
+    EXPECT_EQ(std::string{schema->children[i]->format}, formats[i]);
+    EXPECT_EQ(std::string{schema->children[i]->name}, metadata[i].name);
+    EXPECT_EQ(schema->children[i]->flags, ARROW_FLAG_NULLABLE);
+  }
+  ASSERT_EQ(schema->children[5]->n_children, 1);
+  EXPECT_EQ(std::string{schema->children[5]->children[0]->format}, "i");
+  EXPECT_EQ(std::string{schema->children[5]->children[0]->name}, "element");
+  ASSERT_EQ(schema->children[6]->n_children, 2);
+  EXPECT_EQ(std::string{schema->children[6]->children[0]->format}, "s");
+  EXPECT_EQ(std::string{schema->children[6]->children[1]->name}, "name");
+
+  EXPECT_THROW(cudf::to_arrow_schema(table->view(), std::vector<cudf::column_metadata>(2)),
+               cudf::logic_error);
+}
+
+TEST_F(ArrowDeviceTest, RoundTrip)
+{
+  auto table    = make_device_test_table();
+  auto expected = cudf::table{table->view()};
+  auto schema   = cudf::to_arrow_schema(table->view());
+
+  auto const* ints_data = table->get_column(0).view().head();
+  auto const* ints_mask = table->get_column(0).view().null_mask();
+  auto array            = cudf::to_arrow_device(std::move(*table));
+
+  EXPECT_EQ(array->device_type, ARROW_DEVICE_CUDA);
+  EXPECT_NE(array->sync_event, nullptr);
+  EXPECT_EQ(array->array.length, 5);
+  ASSERT_EQ(array->array.n_children, 7);
+  // the exported buffers are the ones of the table
+  EXPECT_EQ(array->array.children[0]->buffers[1], ints_data);
+  EXPECT_EQ(array->array.children[0]->buffers[0], ints_mask);
+  EXPECT_EQ(array->array.children[0]->null_count, 1);
+
+  auto result = cudf::from_arrow_device(schema.get(), array.get());
+  EXPECT_EQ(result->column(0).head(), ints_data);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.view(), *result);
+}
+
+TEST_F(ArrowDeviceTest, SlicedTable)
+{
+  auto table    = make_device_test_table();
+  auto expected = cudf::table{cudf::slice(table->view(), {1, 4})[0]};
+  auto schema   = cudf::to_arrow_schema(table->view());
+  auto array    = cudf::to_arrow_device(std::move(*table));
+
+  // slice the exported table through the offset of the root array
+  array->array.offset = 1;
+  array->array.length = 3;
+  auto result         = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.view(), *result);
+
+}
+
+TEST_F(ArrowDeviceTest, EmptyTable)
+{
+  strings_column_wrapper strings{};
+  lists_column_wrapper<int32_t> lists{};
+  auto table = cudf::table{cudf::table_view{{strings, lists}}};
+  auto empty = cudf::empty_like(table.view());
+
+  auto schema = cudf::to_arrow_schema(empty->view());
+  auto array  = cudf::to_arrow_device(std::move(*empty));
+  EXPECT_EQ(array->array.length, 0);
+  auto result = cudf::from_arrow_device(schema.get(), array.get());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table.view(), *result);
+}
+
+TEST_F(ArrowDeviceTest, Errors)
+{
+  auto table  = make_device_test_table();
+  auto schema = cudf::to_arrow_schema(table->view());
+  auto array  = cudf::to_arrow_device(std::move(*table));
+
+  array->device_type = ARROW_DEVICE_CPU;
+  EXPECT_THROW(cudf::from_arrow_device(schema.get(), array.get()), cudf::logic_error);
+  array->device_type = ARROW_DEVICE_CUDA;
+
+  fixed_width_column_wrapper<int32_t, int32_t> days{1, 2, 3};
+  auto durations = cudf::table{cudf::table_view{{cudf::bit_cast(
+    days, cudf::data_type{cudf::type_id::DURATION_DAYS})}}};
+  EXPECT_THROW(cudf::to_arrow_schema(durations.view()), cudf::logic_error);
+  EXPECT_THROW(cudf::to_arrow_device(std::move(durations)), cudf::logic_error);
+}
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/interop.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -484,3 +485,85 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   // Verify that from_dlpack(to_dlpack(input)) == input
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TYPED_TEST(DLPackNumericTests, MatrixToDlpack)
+{
+  using T = TypeParam;
+  fixed_width_column_wrapper<T> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<T> col2({4, 5, 6, 7});
+  cudf::table_view input({col1, col2});
+
+  // Write the columns directly into the matrix
+  cudf::dlpack_matrix matrix(cudf::data_type{cudf::type_to_id<T>()}, 4, 2);
+  auto columns = matrix.mutable_view();
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    auto target = columns.column(i);
+    cudf::copy_range_in_place(input.column(i), target, 0, 4, 0);
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, matrix.view());
+
+  auto const* data = matrix.view().column(0).head();
+  unique_managed_tensor tensor(matrix.release());
+  EXPECT_EQ(0, matrix.view().num_columns());
+
+  // The tensor owns the matrix memory instead of a copy of it
+  EXPECT_EQ(data, tensor->dl_tensor.data);
+  EXPECT_EQ(2, tensor->dl_tensor.ndim);
+  EXPECT_EQ(4, tensor->dl_tensor.strides[1]);
+  auto result = cudf::from_dlpack(tensor.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result->view());
+}
+
+TYPED_TEST(DLPackNumericTests, ViewFromDlpack)
+{
+  using T = TypeParam;
+  fixed_width_column_wrapper<T> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<T> col2({4, 5, 6, 7});
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  auto result = cudf::view_from_dlpack(tensor.get());
+  EXPECT_EQ(tensor->dl_tensor.data, result.column(0).head());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result);
+}
+
+TYPED_TEST(DLPackNumericTests, StridedViewFromDlpack)
+{
+  // Device buffer with stride > rows and byte_offset > 0
+  using T = TypeParam;
+  fixed_width_column_wrapper<T> padded({0, 1, 2, 3, 4, 0, 5, 6, 7, 8});
+  cudf::dlpack_matrix matrix(cudf::data_type{cudf::type_to_id<T>()}, 10, 1);
+  auto target = matrix.mutable_view().column(0);
+  cudf::copy_range_in_place(padded, target, 0, 10, 0);
+  unique_managed_tensor tensor(matrix.release());
+
+  int64_t shape[2]      = {4, 2};
+  int64_t strides[2]    = {1, 5};
+  auto& dl_tensor       = tensor->dl_tensor;
+  dl_tensor.ndim        = 2;
+  dl_tensor.shape       = shape;
+  dl_tensor.strides     = strides;
+  dl_tensor.byte_offset = sizeof(T);
+
+  fixed_width_column_wrapper<T> col1({1, 2, 3, 4});
+  fixed_width_column_wrapper<T> col2({5, 6, 7, 8});
+  cudf::table_view expected({col1, col2});
+
+  auto result = cudf::view_from_dlpack(tensor.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result);
+
+  // Stop referring to the local shape and strides before the tensor is deleted
+  dl_tensor.shape   = nullptr;
+  dl_tensor.strides = nullptr;
+}
+
+TEST_F(DLPackUntypedTests, HostTensorViewFromDlpack)
+{
+  fixed_width_column_wrapper<int32_t> col({1, 2, 3, 4});
+  cudf::table_view input({col});
+  unique_managed_tensor tensor(cudf::to_dlpack(input));
+
+  // Host memory cannot be viewed without a copy
+  tensor->dl_tensor.device.device_type = kDLCPU;
+  EXPECT_THROW(cudf::view_from_dlpack(tensor.get()), cudf::logic_error);
+}
@@ -576,6 +576,24 @@ TEST_P(ToArrowTestSlice, SliceTest)
   ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
 }
 
+TEST_P(ToArrowTestSlice, AsyncSliceTest)
+{
+  auto tables             = get_tables(10000);
+  auto cudf_table_view    = tables.first->view();
+  auto arrow_table        = tables.second;
+  auto const [start, end] = GetParam();
+
+  auto sliced_cudf_table    = cudf::slice(cudf_table_view, {start, end})[0];
+  auto expected_arrow_table = arrow_table->Slice(start, end - start);
+  auto struct_meta          = cudf::column_metadata{"f"};
+  struct_meta.children_meta = {{"integral"}, {"string"}};
+  auto got_arrow_table      = cudf::to_arrow_async(
+    sliced_cudf_table, {{"a"}, {"b"}, {"c"}, {"d"}, {"e"}, struct_meta}, cudf::default_stream_value);
+  cudf::default_stream_value.synchronize();
+
+  ASSERT_EQ(expected_arrow_table->Equals(*got_arrow_table, true), true);
+}
+
 INSTANTIATE_TEST_CASE_P(ToArrowTest,
                         ToArrowTestSlice,
                         ::testing::Values(std::make_tuple(0, 10000),
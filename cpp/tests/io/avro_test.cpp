@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <io/avro/avro.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/io/avro.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+cudf::test::TempDirTestEnvironment* const temp_env =
+  static_cast<cudf::test::TempDirTestEnvironment*>(
+    ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+namespace {
+
+std::string const test_schema =
+  R"({"type": "record", "name": "test", "fields": [)"
+  R"({"name": "id", "type": "long"}, {"name": "name", "type": "string"}]})";
+
+/**
+ * @brief Appends a zigzag varint encoded Avro long
+ */
+void append_long(std::string& out, int64_t value)
+{
+  auto v = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (v >= 0x80) {
+    out.push_back(static_cast<char>((v & 0x7f) | 0x80));
+    v >>= 7;
+  }
+  out.push_back(static_cast<char>(v));
+}
+
+/**
+ * @brief Appends a length-prefixed Avro string
+ */
+void append_string(std::string& out, std::string const& str)
+{
+  append_long(out, static_cast<int64_t>(str.size()));
+  out += str;
+}
+
+/**
+ * @brief Wraps data in a raw deflate stream made of a single stored (uncompressed) block
+ */
+std::string deflate_stored(std::string const& data)
+{
+  auto const len = static_cast<uint16_t>(data.size());
+  std::string out{'\x01'};  // last block, stored
+  out.push_back(static_cast<char>(len & 0xff));
+  out.push_back(static_cast<char>(len >> 8));
+  out.push_back(static_cast<char>(~len & 0xff));
+  out.push_back(static_cast<char>((~len >> 8) & 0xff));
+  return out + data;
+}
+
+std::string row_name(int64_t id) { return "row " + std::to_string(id); }
+
+/**
+ * @brief Writes an Avro file of `(id, name)` records, numbered from `first_id`
+ *
+ * @param filepath Path of the file to write
+ * @param block_rows Number of records in each block of the file
+ * @param first_id Value of the `id` field of the first record
+ * @param codec Compression codec of the blocks, "null" or "deflate"
+ * @param schema Schema JSON stored in the file header
+ */
+void write_avro_file(std::string const& filepath,
+                     std::vector<int> const& block_rows,
+                     int64_t first_id,
+                     std::string const& codec  = "null",
+                     std::string const& schema = test_schema)
+{
+  std::string const sync_marker(16, '\x5a');
+
+  std::string out{"Obj\x01"};
+  append_long(out, 2);
+  append_string(out, "avro.schema");
+  append_string(out, schema);
+  append_string(out, "avro.codec");
+  append_string(out, codec);
+  append_long(out, 0);
+  out += sync_marker;
+
+  auto id = first_id;
+  for (auto const num_rows : block_rows) {
+    std::string data;
+    for (int i = 0; i < num_rows; ++i, ++id) {
+      append_long(data, id);
+      append_string(data, row_name(id));
+    }
+    if (codec == "deflate") { data = deflate_stored(data); }
+    append_long(out, num_rows);
+    append_long(out, static_cast<int64_t>(data.size()));
+    out += data;
+    out += sync_marker;
+  }
+
+  std::ofstream file(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+  file.write(out.data(), static_cast<std::streamsize>(out.size()));
+}
+
+/**
+ * @brief Returns the table of the `num_rows` records numbered from `first_id`
+ */
+std::unique_ptr<cudf::table> expected_table(int64_t first_id, int num_rows)
+{
+  std::vector<int64_t> ids(num_rows);
+  std::vector<std::string> names(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    ids[i]   = first_id + i;
+    names[i] = row_name(first_id + i);
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(
+    cudf::test::fixed_width_column_wrapper<int64_t>(ids.begin(), ids.end()).release());
+  columns.push_back(cudf::test::strings_column_wrapper(names.begin(), names.end()).release());
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+/**
+ * @brief Reads all the chunks of a chunked reader, returning them with their concatenation
+ */
+std::pair<std::vector<cudf_io::table_with_metadata>, std::unique_ptr<cudf::table>> read_all_chunks(
+  cudf_io::chunked_avro_reader const& reader)
+{
+  std::vector<cudf_io::table_with_metadata> chunks;
+  std::vector<cudf::table_view> views;
+  while (reader.has_next()) {
+    chunks.push_back(reader.read_chunk());
+    views.push_back(chunks.back().tbl->view());
+  }
+  return {std::move(chunks), cudf::concatenate(views)};
+}
+
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(AvroReaderTest, ReadAvro)
+{
+  auto const filepath = temp_env->get_temp_dir() + "ReadAvro.avro";
+  write_avro_file(filepath, {3, 4}, 0);
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath}).build();
+  auto const result = cudf_io::read_avro(options);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected_table(0, 7)->view());
+  EXPECT_EQ(result.metadata.column_names, (std::vector<std::string>{"id", "name"}));
+}
+
+TEST_F(AvroReaderTest, ReadAvroDeflate)
+{
+  auto const filepath = temp_env->get_temp_dir() + "ReadAvroDeflate.avro";
+  write_avro_file(filepath, {5, 2}, 10, "deflate");
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath}).build();
+  auto const result = cudf_io::read_avro(options);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected_table(10, 7)->view());
+}
+
+TEST_F(AvroReaderTest, ReadAvroSkipRows)
+{
+  auto const filepath = temp_env->get_temp_dir() + "ReadAvroSkipRows.avro";
+  write_avro_file(filepath, {3, 4, 5}, 0);
+
+  auto const options = cudf_io::avro_reader_options::builder(cudf_io::source_info{filepath})
+                         .skip_rows(4)
+                         .num_rows(8)
+                         .build();
+  auto const result = cudf_io::read_avro(options);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected_table(4, 8)->view());
+}
+
+TEST_F(AvroReaderTest, ChunkedMultipleFiles)
+{
+  auto const dir = temp_env->get_temp_dir();
+  std::vector<std::string> const filepaths{dir + "ChunkedMultipleFiles0.avro",
+                                           dir + "ChunkedMultipleFiles1.avro",
+                                           dir + "ChunkedMultipleFiles2.avro"};
+  write_avro_file(filepaths[0], {3, 4}, 0);
+  write_avro_file(filepaths[1], {5}, 7);
+  write_avro_file(filepaths[2], {}, 0);  // holds no blocks
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepaths}).build();
+  auto const reader          = cudf_io::chunked_avro_reader(0, options);
+  auto const [chunks, table] = read_all_chunks(reader);
+
+  // without a limit, the blocks of all the files are read in a single chunk
+  EXPECT_EQ(chunks.size(), 1UL);
+  EXPECT_EQ(chunks[0].metadata.per_file_user_data.size(), 2UL);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table->view(), expected_table(0, 12)->view());
+
+  // no rows are left to read
+  EXPECT_FALSE(reader.has_next());
+  EXPECT_EQ(reader.read_chunk().tbl->num_rows(), 0);
+}
+
+TEST_F(AvroReaderTest, ChunkedMemoryLimit)
+{
+  auto const dir = temp_env->get_temp_dir();
+  std::vector<std::string> const filepaths{dir + "ChunkedMemoryLimit0.avro",
+                                           dir + "ChunkedMemoryLimit1.avro"};
+  write_avro_file(filepaths[0], {3, 4}, 0);
+  write_avro_file(filepaths[1], {5, 6}, 7);
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepaths}).build();
+
+  {
+    // every block exceeds the limit on its own, so each block forms a chunk
+    auto const reader          = cudf_io::chunked_avro_reader(1, options);
+    auto const [chunks, table] = read_all_chunks(reader);
+
+    ASSERT_EQ(chunks.size(), 4UL);
+    int64_t first_id = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      auto const num_rows = std::vector<int>{3, 4, 5, 6}[i];
+      CUDF_TEST_EXPECT_TABLES_EQUIVALENT(chunks[i].tbl->view(),
+                                         expected_table(first_id, num_rows)->view());
+      first_id += num_rows;
+    }
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table->view(), expected_table(0, 18)->view());
+  }
+  {
+    // a large limit reads all the blocks together
+    auto const reader          = cudf_io::chunked_avro_reader(1024 * 1024, options);
+    auto const [chunks, table] = read_all_chunks(reader);
+
+    EXPECT_EQ(chunks.size(), 1UL);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table->view(), expected_table(0, 18)->view());
+  }
+}
+
+TEST_F(AvroReaderTest, ChunkedMixedCodecs)
+{
+  auto const dir = temp_env->get_temp_dir();
+  std::vector<std::string> const filepaths{dir + "ChunkedMixedCodecs0.avro",
+                                           dir + "ChunkedMixedCodecs1.avro",
+                                           dir + "ChunkedMixedCodecs2.avro",
+                                           dir + "ChunkedMixedCodecs3.avro"};
+  write_avro_file(filepaths[0], {3}, 0, "null");
+  write_avro_file(filepaths[1], {4, 2}, 3, "deflate");
+  write_avro_file(filepaths[2], {5}, 9, "deflate");
+  write_avro_file(filepaths[3], {1}, 14, "null");
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepaths}).build();
+  auto const reader          = cudf_io::chunked_avro_reader(0, options);
+  auto const [chunks, table] = read_all_chunks(reader);
+
+  // a chunk never mixes codecs, but consecutive files with the same codec share a chunk
+  ASSERT_EQ(chunks.size(), 3UL);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(chunks[0].tbl->view(), expected_table(0, 3)->view());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(chunks[1].tbl->view(), expected_table(3, 11)->view());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(chunks[2].tbl->view(), expected_table(14, 1)->view());
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(table->view(), expected_table(0, 15)->view());
+}
+
+TEST_F(AvroReaderTest, ChunkedSchemaMismatch)
+{
+  auto const dir = temp_env->get_temp_dir();
+  std::vector<std::string> const filepaths{dir + "ChunkedSchemaMismatch0.avro",
+                                           dir + "ChunkedSchemaMismatch1.avro"};
+  std::string const other_schema =
+    R"({"type": "record", "name": "test", "fields": [)"
+    R"({"name": "id", "type": "long"}, {"name": "label", "type": "string"}]})";
+  write_avro_file(filepaths[0], {3}, 0);
+  write_avro_file(filepaths[1], {3}, 3, "null", other_schema);
+
+  auto const options =
+    cudf_io::avro_reader_options::builder(cudf_io::source_info{filepaths}).build();
+  EXPECT_THROW(cudf_io::chunked_avro_reader(0, options), cudf::logic_error);
+}
+
+TEST_F(AvroReaderTest, SchemaCache)
+{
+  auto const make_schema = [](int i) {
+    return R"({"type": "record", "name": "cache_test", "fields": [{"name": "field)" +
+           std::to_string(i) + R"(", "type": "long"}]})";
+  };
+
+  auto const first = cudf_io::avro::parse_schema(make_schema(0));
+  ASSERT_NE(first, nullptr);
+  ASSERT_EQ(first->columns.size(), 1UL);
+  EXPECT_EQ(first->columns[0].name, "field0");
+
+  // the same schema is parsed only once
+  EXPECT_EQ(cudf_io::avro::parse_schema(make_schema(0)), first);
+  auto const second = cudf_io::avro::parse_schema(make_schema(1));
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(second, first);
+  EXPECT_EQ(second->columns[0].name, "field1");
+
+  // an invalid schema is not cached
+  EXPECT_EQ(cudf_io::avro::parse_schema(R"({"type": "record", "fields": [)"), nullptr);
+
+  // parsing more distinct schemas than the cache holds clears it
+  for (std::size_t i = 2; i < cudf_io::avro::max_cached_schemas + 2; ++i) {
+    ASSERT_NE(cudf_io::avro::parse_schema(make_schema(static_cast<int>(i))), nullptr);
+  }
+  auto const reparsed = cudf_io::avro::parse_schema(make_schema(0));
+  ASSERT_NE(reparsed, nullptr);
+  EXPECT_NE(reparsed, first);
+  EXPECT_EQ(reparsed->columns[0].name, "field0");
+  EXPECT_EQ(cudf_io::avro::parse_schema(make_schema(0)), reparsed);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
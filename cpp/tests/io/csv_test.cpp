@@ -21,10 +21,12 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/text/data_chunk_source_factories.hpp>
 #include <cudf/strings/convert/convert_datetime.hpp>
 #include <cudf/strings/convert/convert_fixed_point.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -1031,6 +1033,130 @@ TEST_F(CsvReaderTest, SkiprowsNrows)
   expect_column_data_equal(std::vector<int32_t>{5, 6}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, Bzip2MultipleBlocks)
+{
+  // 60000 rows of "i % 10,i % 3", compressed with 100k blocks so that the data spans three blocks
+  constexpr uint8_t input_buffer[] = {
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xf6, 0xbf, 0xd4, 0x7c, 0x00, 0x71,
+    0xe9, 0x58, 0x00, 0x00, 0x10, 0x00, 0x04, 0x7f, 0xe0, 0x40, 0x01, 0xdc, 0x00, 0x02, 0x06, 0x81,
+    0xa0, 0x40, 0xd0, 0x34, 0x08, 0x1a, 0x06, 0x80, 0x52, 0xaa, 0x7f, 0xaa, 0x88, 0x3f, 0xd5, 0x4f,
+    0x53, 0xe4, 0x09, 0x7b, 0x81, 0x2f, 0x90, 0x25, 0xa0, 0x4b, 0x20, 0x96, 0x81, 0x2d, 0x02, 0x5a,
+    0x04, 0xb2, 0x09, 0x64, 0x12, 0xd0, 0x25, 0xa0, 0x4b, 0x40, 0x96, 0x41, 0x2d, 0x02, 0x5a, 0x04,
+    0xb4, 0x09, 0x64, 0x12, 0xd0, 0x25, 0xa0, 0x4b, 0x40, 0x96, 0x81, 0x2d, 0x02, 0x5a, 0x04, 0xb4,
+    0x09, 0x68, 0x12, 0xd0, 0x25, 0xa0, 0x4b, 0x40, 0x96, 0x81, 0x2f, 0x20, 0x4b, 0x20, 0x96, 0x81,
+    0x2f, 0x70, 0x25, 0xf6, 0x82, 0x5f, 0x90, 0x25, 0xfb, 0x02, 0x5d, 0x02, 0x5f, 0xd0, 0x25, 0xe4,
+    0x09, 0x74, 0x09, 0x74, 0x09, 0x72, 0x09, 0x74, 0x09, 0x74, 0x09, 0x72, 0x09, 0x74, 0x09, 0x74,
+    0x09, 0x74, 0x09, 0x74, 0x09, 0x74, 0x09, 0x74, 0x09, 0x74, 0x09, 0x72, 0x09, 0x74, 0x09, 0x74,
+    0x09, 0x74, 0x09, 0x74, 0x09, 0x74, 0x09, 0x74, 0x09, 0x78, 0x50, 0x81, 0xf3, 0xca, 0x0a, 0x8c,
+    0x50, 0x81, 0xe8, 0x85, 0x47, 0xaa, 0x42, 0x07, 0xa2, 0xa0, 0xa8, 0xff, 0x31, 0x41, 0x59, 0x26,
+    0x53, 0x59, 0x26, 0x92, 0x7b, 0x15, 0x00, 0x5c, 0xc1, 0x58, 0x00, 0x00, 0x10, 0x00, 0x04, 0x7f,
+    0xe0, 0x40, 0x01, 0xdc, 0x00, 0x02, 0x06, 0x81, 0xa0, 0x40, 0xd0, 0x34, 0x08, 0x1a, 0x06, 0x80,
+    0x52, 0xa9, 0xfa, 0xa9, 0x03, 0xfd, 0x51, 0x37, 0xd4, 0x09, 0x79, 0x02, 0x5f, 0x50, 0x25, 0xa0,
+    0x4b, 0x40, 0x96, 0x81, 0x2d, 0x02, 0x5a, 0x04, 0xb4, 0x09, 0x68, 0x12, 0xd0, 0x25, 0xa0, 0x4b,
+    0x40, 0x96, 0x81, 0x2d, 0x02, 0x5a, 0x04, 0xb4, 0x09, 0x68, 0x12, 0xc8, 0x25, 0xa0, 0x4b, 0x40,
+    0x96, 0x81, 0x2c, 0x82, 0x5a, 0x04, 0xb4, 0x09, 0x68, 0x12, 0xc8, 0x25, 0x90, 0x4b, 0x40, 0x96,
+    0x81, 0x2f, 0x3e, 0x20, 0x97, 0x90, 0x25, 0xa0, 0x4b, 0xd4, 0x09, 0x7e, 0x40, 0x97, 0xec, 0x09,
+    0x7f, 0x40, 0x97, 0x20, 0x97, 0xb8, 0x12, 0xf9, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d,
+    0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5c, 0x82, 0x5d, 0x02, 0x5d, 0x02, 0x5d,
+    0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5d, 0x02, 0x5f, 0x3d, 0xc0, 0x97, 0xb8,
+    0x12, 0xf6, 0x82, 0x5e, 0x8a, 0x10, 0x3e, 0x10, 0xa8, 0xf2, 0x90, 0x81, 0xe5, 0x05, 0x47, 0x85,
+    0x08, 0x1e, 0x15, 0x05, 0x47, 0xf9, 0x8a, 0x0a, 0xc9, 0x32, 0x9a, 0xcd, 0xd1, 0x57, 0xca, 0xe8,
+    0x01, 0x81, 0xc6, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x23, 0xff, 0x02, 0x00, 0x0d, 0xdc, 0x12, 0xa8,
+    0x40, 0xd0, 0x34, 0x08, 0x1a, 0x06, 0x80, 0x9a, 0xa4, 0xa6, 0x83, 0xf5, 0x4c, 0x0a, 0x55, 0x53,
+    0xff, 0x55, 0x4c, 0x8d, 0xfa, 0xa1, 0xd2, 0x29, 0x7a, 0x45, 0x2e, 0xa1, 0x4b, 0x81, 0x4b, 0x88,
+    0xa5, 0xc8, 0x13, 0x2a, 0x26, 0x54, 0x4d, 0x28, 0x9a, 0x51, 0x32, 0xa2, 0x65, 0x44, 0xca, 0x89,
+    0xa5, 0x13, 0x2a, 0x26, 0x54, 0x4c, 0xa8, 0x9a, 0x51, 0x34, 0xa2, 0x65, 0x44, 0xca, 0x89, 0x95,
+    0x13, 0x4a, 0x26, 0x54, 0x4c, 0xa8, 0x99, 0x51, 0x34, 0xa2, 0x69, 0x44, 0xca, 0x89, 0x95, 0x13,
+    0xe4, 0xa2, 0x69, 0x44, 0xca, 0x89, 0xfa, 0x8a, 0x5f, 0x11, 0x4b, 0xec, 0x29, 0x7e, 0x85, 0x2d,
+    0x45, 0x2f, 0xf0, 0xa5, 0xdc, 0x29, 0x6c, 0x29, 0x6a, 0x29, 0x6a, 0x29, 0x6c, 0x29, 0x6c, 0x44,
+    0xe9, 0x44, 0xe5, 0x44, 0xe5, 0x44, 0xe9, 0x44, 0xe5, 0x44, 0xd8, 0x52, 0xd8, 0x52, 0xd8, 0x52,
+    0xd4, 0x52, 0xd8, 0x52, 0xd8, 0x13, 0xa5, 0x13, 0x95, 0x13, 0x95, 0x13, 0xa5, 0x13, 0xe0, 0x82,
+    0x9d, 0xd4, 0x83, 0x21, 0x4b, 0x32, 0x42, 0x16, 0x29, 0x06, 0x29, 0x54, 0x99, 0x52, 0x90, 0x78,
+    0x2e, 0xe4, 0x8a, 0x70, 0xa1, 0x20, 0x5b, 0xe2, 0xbd, 0x08};
+
+  cudf_io::csv_reader_options in_opts =
+    cudf_io::csv_reader_options::builder(
+      cudf_io::source_info{reinterpret_cast<char const*>(input_buffer), sizeof(input_buffer)})
+      .names({"A", "B"})
+      .dtypes({dtype<int32_t>(), dtype<int32_t>()})
+      .header(-1)
+      .compression(cudf_io::compression_type::BZIP2);
+  auto result = cudf_io::read_csv(in_opts);
+
+  const auto view = result.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  ASSERT_EQ(60000, view.num_rows());
+
+  std::vector<int32_t> expected_a(view.num_rows());
+  std::vector<int32_t> expected_b(view.num_rows());
+  for (size_t i = 0; i < expected_a.size(); ++i) {
+    expected_a[i] = i % 10;
+    expected_b[i] = i % 3;
+  }
+  expect_column_data_equal(expected_a, view.column(0));
+  expect_column_data_equal(expected_b, view.column(1));
+}
+
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  // Quoted fields hold delimiters, escaped quotes and row terminators, so that chunks end both
+  // within and outside of quotes
+  std::string data = "id,value,text\n";
+  for (int i = 0; i < 2000; ++i) {
+    data += std::to_string(i) + "," + std::to_string(i * 0.5) + ",";
+    data += (i % 10 == 0) ? "\"a,\"\"b\"\"\nc" + std::to_string(i) + "\"\n"
+                          : "t" + std::to_string(i) + "\n";
+  }
+
+  cudf_io::csv_reader_options const options =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{data.data(), data.size()});
+  auto const expected = cudf_io::read_csv(options);
+
+  auto const source = cudf::io::text::make_source(data);
+  auto reader       = cudf_io::chunked_csv_reader(*source, options, 256);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    if (chunk.tbl->num_rows() == 0) { continue; }
+    ASSERT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    chunks.emplace_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 1u);
+
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(), expected.tbl->view());
+}
+
+TEST_F(CsvReaderTest, SinglePassInference)
+{
+  // Covers integers, floats with nulls, quoted strings, booleans, an all-null column and a column
+  // with a user-specified type
+  std::string data = "int,float,text,flag,empty,fixed\n";
+  for (int i = 0; i < 1000; ++i) {
+    data += std::to_string(i - 500) + ",";
+    data += (i % 7 == 0) ? "," : " " + std::to_string(i * 0.25) + ",";
+    data += (i % 5 == 0) ? "\"q,\"\"" + std::to_string(i) + "\"\"\","
+                         : "s" + std::to_string(i) + ",";
+    data += (i % 2 == 0) ? "True,," : "false,,";
+    data += std::to_string(i) + "\n";
+  }
+
+  cudf_io::csv_reader_options options =
+    cudf_io::csv_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .dtypes({{"fixed", dtype<int16_t>()}});
+  auto const expected = cudf_io::read_csv(options);
+
+  options.enable_single_pass_inference(true);
+  auto const result = cudf_io::read_csv(options);
+
+  EXPECT_EQ(result.metadata.column_names, expected.metadata.column_names);
+  EXPECT_EQ(type_id::INT16, result.tbl->get_column(5).type().id());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected.tbl->view());
+}
+
 TEST_F(CsvReaderTest, ByteRange)
 {
   auto filepath = temp_env->get_temp_dir() + "ByteRange.csv";
@@ -1096,6 +1222,39 @@ TEST_F(CsvReaderTest, BlanksAndComments)
   expect_column_data_equal(std::vector<int32_t>{1, 3, 4, 5, 8, 9}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, QuotedTerminatorsAndComments)
+{
+  // Terminators and comment characters within quotes, quotes within comments, and escaped quotes
+  std::string csv_in{
+    "1,\"a\nb\"\n"
+    "#comment, \"with a quote\n"
+    "2,\"c\"\"d\"\n"
+    "3,\"e\n#f\"\n"
+    "\n"
+    "4,g\n"};
+
+  auto const make_builder = [&]() {
+    return cudf_io::csv_reader_options::builder(
+             cudf_io::source_info{csv_in.c_str(), csv_in.size()})
+      .names({"A", "B"})
+      .dtypes({dtype<int32_t>(), dtype<cudf::string_view>()})
+      .header(-1)
+      .comment('#');
+  };
+  // The whole input is tokenized at once, while a row limit gathers the rows chunk by chunk
+  cudf_io::csv_reader_options const whole_opts   = make_builder();
+  cudf_io::csv_reader_options const chunked_opts = make_builder().nrows(4);
+  auto const whole                               = cudf_io::read_csv(whole_opts);
+  auto const chunked                             = cudf_io::read_csv(chunked_opts);
+
+  auto const view = whole.tbl->view();
+  ASSERT_EQ(2, view.num_columns());
+  expect_column_data_equal(std::vector<int32_t>{1, 2, 3, 4}, view.column(0));
+  expect_column_data_equal(std::vector<std::string>{"a\nb", "c\"d", "e\n#f", "g"},
+                           view.column(1));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(view, chunked.tbl->view());
+}
+
 TEST_F(CsvReaderTest, EmptyFile)
 {
   auto filepath = temp_env->get_temp_dir() + "EmptyFile.csv";
@@ -1823,6 +1982,33 @@ TEST_F(CsvReaderTest, StringsWithWriterSimple)
   check_string_column(input_table.column(1), result_table.column(1));
 }
 
+TEST_F(CsvReaderTest, ChunkedWriteToHostBuffer)
+{
+  // Rows grow in length so that later chunks do not fit in the earlier staging buffers
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i / 10, 'x') + std::to_string(i); });
+  auto const ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto int_column    = column_wrapper<int32_t>(ints, ints + 1000, validity);
+  auto string_column = column_wrapper<cudf::string_view>(strings, strings + 1000);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column, string_column});
+
+  auto write = [&](cudf::size_type rows_per_chunk) {
+    std::vector<char> out_buffer;
+    cudf_io::csv_writer_options writer_options =
+      cudf_io::csv_writer_options::builder(cudf_io::sink_info(&out_buffer), input_table)
+        .include_header(false)
+        .rows_per_chunk(rows_per_chunk);
+    cudf_io::write_csv(writer_options);
+    return out_buffer;
+  };
+
+  auto const expected = write(input_table.num_rows());
+  EXPECT_EQ(write(64), expected);
+  EXPECT_EQ(write(8), expected);
+}
+
 TEST_F(CsvReaderTest, StringsEmbeddedDelimiter)
 {
   std::vector<std::string> names{"line", "verse"};
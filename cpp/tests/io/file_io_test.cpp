@@ -18,7 +18,14 @@
 #include <cudf_test/cudf_gtest.hpp>
 
 #include <src/io/utilities/file_io_utilities.hpp>
+#include <src/io/utilities/pinned_memory_pool.hpp>
+#include <src/io/utilities/thread_pool.hpp>
 
+#include <cudf/io/cufile_config.hpp>
+#include <cudf/io/pinned_memory.hpp>
+
+#include <atomic>
+#include <stdexcept>
 #include <type_traits>
 
 // Base test fixture for tests
@@ -43,4 +50,121 @@ TEST_F(CuFileIOTest, SliceSize)
   }
 }
 
+TEST_F(CuFileIOTest, RuntimeConfig)
+{
+  auto const thread_count = cudf::io::get_cufile_thread_count();
+  auto const slice_size   = cudf::io::get_cufile_slice_size();
+
+  cudf::io::set_cufile_thread_count(4);
+  cudf::io::set_cufile_slice_size(1 << 20);
+  EXPECT_EQ(cudf::io::get_cufile_thread_count(), 4u);
+  EXPECT_EQ(cudf::io::get_cufile_slice_size(), 1u << 20);
+  EXPECT_THROW(cudf::io::set_cufile_thread_count(0), cudf::logic_error);
+
+  cudf::io::set_cufile_thread_count(thread_count);
+  cudf::io::set_cufile_slice_size(slice_size);
+}
+
+struct PinnedMemoryPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(PinnedMemoryPoolTest, AllocateAndReuse)
+{
+  using cudf::io::detail::make_pinned_buffer;
+
+  constexpr std::size_t pool_size = 1 << 20;
+  cudf::io::set_pinned_memory_pool_size(pool_size);
+  auto const initial = cudf::io::get_pinned_memory_pool_stats();
+  {
+    auto first  = make_pinned_buffer<uint8_t>(1000);
+    auto second = make_pinned_buffer<uint8_t>(2000);
+    auto stats  = cudf::io::get_pinned_memory_pool_stats();
+    EXPECT_EQ(stats.pool_size, pool_size);
+    // allocations are rounded up to 256 bytes
+    EXPECT_EQ(stats.bytes_in_use, 1024u + 2048u);
+    EXPECT_EQ(stats.num_allocations, initial.num_allocations + 2);
+    EXPECT_THROW(cudf::io::set_pinned_memory_pool_size(2 * pool_size), cudf::logic_error);
+
+    // does not fit in the pool
+    auto large = make_pinned_buffer<uint8_t>(2 * pool_size);
+    EXPECT_NE(large, nullptr);
+    stats = cudf::io::get_pinned_memory_pool_stats();
+    EXPECT_EQ(stats.num_fallback_allocations, initial.num_fallback_allocations + 1);
+    EXPECT_EQ(stats.bytes_in_use, 1024u + 2048u);
+
+    // the freed block is reused by the next allocation that fits
+    auto const first_ptr = first.get();
+    first.reset();
+    auto third = make_pinned_buffer<uint8_t>(512);
+    EXPECT_EQ(third.get(), first_ptr);
+  }
+  auto const stats = cudf::io::get_pinned_memory_pool_stats();
+  EXPECT_EQ(stats.bytes_in_use, 0u);
+  EXPECT_GE(stats.peak_bytes_in_use, 1024u + 2048u);
+
+  // the pool can be resized once all allocations are freed
+  EXPECT_NO_THROW(cudf::io::set_pinned_memory_pool_size(2 * pool_size));
+}
+
+struct ThreadPoolTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ThreadPoolTest, NestedTasks)
+{
+  cudf::detail::thread_pool pool(4);
+  pool.sleep_duration = 10;
+
+  // tasks submitted from the workers are queued locally and stolen by the idle workers
+  constexpr int num_tasks = 64;
+  std::atomic<int> sum{0};
+  std::vector<std::future<void>> outer;
+  for (int i = 0; i < num_tasks; ++i) {
+    outer.push_back(pool.submit([&pool, &sum, i]() {
+      for (int j = 0; j < num_tasks; ++j) {
+        pool.push_task([&sum, i, j]() { sum += i * num_tasks + j; });
+      }
+    }));
+  }
+  for (auto& task : outer) {
+    task.get();
+  }
+  pool.wait_for_tasks();
+  EXPECT_EQ(sum, (num_tasks * num_tasks) * (num_tasks * num_tasks - 1) / 2);
+}
+
+TEST_F(ThreadPoolTest, Continuations)
+{
+  cudf::detail::thread_pool pool(2);
+  pool.sleep_duration = 10;
+
+  std::promise<int> input;
+  auto doubled  = pool.then(input.get_future(), [](std::future<int> f) { return 2 * f.get(); });
+  auto plus_one = pool.then(std::move(doubled), [](std::future<int> f) { return f.get() + 1; });
+  auto failed   = pool.then(pool.submit([]() -> int { throw std::runtime_error("failed"); }),
+                            [](std::future<int> f) { return f.get(); });
+  input.set_value(20);
+  EXPECT_EQ(plus_one.get(), 41);
+  EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, ResetKeepsQueuedTasks)
+{
+  cudf::detail::thread_pool pool(2);
+  pool.sleep_duration = 10;
+
+  pool.paused = true;
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 16; ++i) {
+    results.push_back(pool.submit([i]() { return i; }));
+  }
+  pool.reset(3);
+  EXPECT_EQ(pool.get_thread_count(), 3);
+  pool.paused = false;
+  int sum     = 0;
+  for (auto& result : results) {
+    sum += result.get();
+  }
+  EXPECT_EQ(sum, 16 * 15 / 2);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
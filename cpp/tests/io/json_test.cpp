@@ -18,11 +18,14 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/io/text/data_chunk_source_factories.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -30,6 +33,7 @@
 #include <arrow/io/api.h>
 
 #include <fstream>
+#include <limits>
 #include <type_traits>
 
 #define wrapper cudf::test::fixed_width_column_wrapper
@@ -915,6 +919,47 @@ TEST_F(JsonReaderTest, BadDtypeParams)
   EXPECT_THROW(cudf_io::read_json(options_map), cudf::logic_error);
 }
 
+TEST_F(JsonReaderTest, JsonLinesStreamReader)
+{
+  // Keys appear in both orders, a run of records lacks "b" entirely, and one record is longer than
+  // the chunk size
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    auto const has_b = i % 7 != 3 and (i < 500 or i >= 520);
+    auto const b     = "\"b\":\"" + std::string(i == 100 ? 200 : 1 + i % 5, 'x') + "\"";
+    auto const a     = "\"a\":" + std::to_string(i);
+    if (not has_b) {
+      data += "{" + a + "}\n";
+    } else if (i % 2 == 0) {
+      data += "{" + a + "," + b + "}\n";
+    } else {
+      data += "{" + b + "," + a + "}\n";
+    }
+  }
+
+  cudf_io::json_reader_options const options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{data.data(), data.size()})
+      .lines(true);
+  auto const expected = cudf_io::read_json(options);
+
+  auto const source = cudf_io::text::make_source(data);
+  auto reader       = cudf_io::json_lines_stream_reader(*source, options, 64);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    auto chunk = reader.read_chunk();
+    if (chunk.tbl->num_rows() == 0) { continue; }
+    ASSERT_EQ(chunk.metadata.column_names, expected.metadata.column_names);
+    chunks.emplace_back(std::move(chunk.tbl));
+  }
+  EXPECT_GT(chunks.size(), 1u);
+
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(), expected.tbl->view());
+}
+
 TEST_F(JsonReaderTest, ExperimentalParam)
 {
   cudf_io::json_reader_options const options =
@@ -924,4 +969,91 @@ TEST_F(JsonReaderTest, ExperimentalParam)
   EXPECT_THROW(cudf_io::read_json(options), cudf::logic_error);
 }
 
+struct JsonWriterTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(JsonWriterTest, NestedColumns)
+{
+  int_wrapper ints{{1, 2, 3}, {true, false, true}};
+  float64_wrapper floats{1.5, std::numeric_limits<double>::quiet_NaN(), -2};
+  cudf::test::strings_column_wrapper strings{"plain", "quote\" and\nnewline", "tab\t\x01"};
+  int_wrapper struct_ints{10, 20, 30};
+  cudf::test::strings_column_wrapper struct_strings{"x", "y", "z"};
+  cudf::test::structs_column_wrapper structs{{struct_ints, struct_strings}, {true, true, false}};
+  auto const second_null = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i != 1;
+  });
+  cudf::test::lists_column_wrapper<int> lists{{1, 2}, {}, {{3, 4}, second_null}};
+  auto const input = cudf::table_view{{ints, floats, strings, structs, lists}};
+
+  cudf_io::table_metadata metadata;
+  metadata.schema_info = {cudf_io::column_name_info{"i"},
+                          cudf_io::column_name_info{"f"},
+                          cudf_io::column_name_info{"s"},
+                          cudf_io::column_name_info{"st"},
+                          cudf_io::column_name_info{"l"}};
+  metadata.schema_info[3].children = {cudf_io::column_name_info{"a"},
+                                      cudf_io::column_name_info{"b"}};
+
+  std::vector<char> out_buffer;
+  cudf_io::json_writer_options const options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+      .metadata(&metadata);
+  cudf_io::write_json(options);
+
+  std::string const expected =
+    "{\"i\":1,\"f\":1.5,\"s\":\"plain\",\"st\":{\"a\":10,\"b\":\"x\"},\"l\":[1,2]}\n"
+    "{\"s\":\"quote\\\" and\\nnewline\",\"st\":{\"a\":20,\"b\":\"y\"},\"l\":[]}\n"
+    "{\"i\":3,\"f\":-2.0,\"s\":\"tab\\t\\u0001\",\"l\":[3,null]}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, IncludeNullsAndChunks)
+{
+  int_wrapper ints{{1, 2, 3, 4, 5}, {true, false, true, false, true}};
+  bool_wrapper bools{true, false, true, false, true};
+  auto const input = cudf::table_view{{ints, bools}};
+
+  std::vector<char> out_buffer;
+  cudf_io::json_writer_options const options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info(&out_buffer), input)
+      .include_nulls(true)
+      .rows_per_chunk(2);
+  cudf_io::write_json(options);
+
+  // columns without names are named by their index
+  std::string const expected =
+    "{\"0\":1,\"1\":true}\n"
+    "{\"0\":null,\"1\":false}\n"
+    "{\"0\":3,\"1\":true}\n"
+    "{\"0\":null,\"1\":false}\n"
+    "{\"0\":5,\"1\":true}\n";
+  EXPECT_EQ(std::string(out_buffer.data(), out_buffer.size()), expected);
+}
+
+TEST_F(JsonWriterTest, RoundTrip)
+{
+  int64_wrapper ints{5, -3, 7};
+  cudf::test::strings_column_wrapper strings{"a", "b c", "d"};
+  auto const input = cudf::table_view{{ints, strings}};
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"ints", "strings"};
+
+  auto const filepath = temp_env->get_temp_dir() + "JsonWriterRoundTrip.json";
+  cudf_io::json_writer_options const out_options =
+    cudf_io::json_writer_options::builder(cudf_io::sink_info{filepath}, input)
+      .metadata(&metadata);
+  cudf_io::write_json(out_options);
+
+  cudf_io::json_reader_options const in_options =
+    cudf_io::json_reader_options::builder(cudf_io::source_info{filepath})
+      .dtypes(std::vector<data_type>{dtype<int64_t>(), dtype<cudf::string_view>()})
+      .lines(true);
+  auto const result = cudf_io::read_json(in_options);
+
+  EXPECT_EQ(result.metadata.column_names, metadata.column_names);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), ints);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1), strings);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -20,6 +20,8 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/cudf_gtest.hpp>
 
+#include <cudf/detail/utilities/vector_factories.hpp>
+
 #include <rmm/cuda_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
@@ -231,3 +233,72 @@ TEST_F(JsonTest, TokenStream)
     EXPECT_EQ(golden_token_stream[i].second, tokens_gpu[i]) << "Mismatch at #" << i;
   }
 }
+
+TEST_F(JsonTest, TreeRepresentation)
+{
+  using cuio_json::NodeIndexT;
+  using cuio_json::PdaTokenT;
+  using cuio_json::SymbolOffsetT;
+  using cuio_json::SymbolT;
+
+  constexpr std::size_t single_item = 1;
+
+  // Prepare cuda stream for data transfers & kernels
+  rmm::cuda_stream stream{};
+  rmm::cuda_stream_view stream_view(stream);
+
+  // Test input
+  std::string const input = R"([{"a":1,"b":[2,{}]},{"b":[3],"a":"x"}])";
+
+  // Prepare input & output buffers
+  auto const d_input = cudf::detail::make_device_uvector_async(
+    cudf::host_span<SymbolT const>{input.data(), input.size()}, stream_view);
+  rmm::device_uvector<PdaTokenT> tokens{input.size(), stream_view};
+  rmm::device_uvector<SymbolOffsetT> token_indices{input.size(), stream_view};
+  hostdevice_vector<SymbolOffsetT> num_tokens_out{single_item, stream_view};
+
+  // Parse the JSON and get the token stream
+  cuio_json::detail::get_token_stream(
+    d_input, tokens.data(), token_indices.data(), num_tokens_out.device_ptr(), stream_view);
+  num_tokens_out.device_to_host(stream_view);
+  stream_view.synchronize();
+
+  // Build the tree representation and assign the nodes to columns
+  auto const tree = cuio_json::detail::get_tree_representation(
+    {tokens.data(), num_tokens_out[0]}, {token_indices.data(), num_tokens_out[0]}, stream_view);
+  auto const col_ids = cuio_json::detail::get_column_ids(d_input, tree, stream_view);
+
+  // Golden tree representation
+  using node_t = cuio_json::node_t;
+  std::vector<cuio_json::NodeT> const golden_categories = {node_t::NC_LIST,
+                                                           node_t::NC_STRUCT,
+                                                           node_t::NC_FN,
+                                                           node_t::NC_VAL,
+                                                           node_t::NC_FN,
+                                                           node_t::NC_LIST,
+                                                           node_t::NC_VAL,
+                                                           node_t::NC_STRUCT,
+                                                           node_t::NC_STRUCT,
+                                                           node_t::NC_FN,
+                                                           node_t::NC_LIST,
+                                                           node_t::NC_VAL,
+                                                           node_t::NC_FN,
+                                                           node_t::NC_STR};
+  std::vector<NodeIndexT> const golden_parents = {-1, 0, 1, 2, 1, 4, 5, 5, 0, 8, 9, 10, 8, 12};
+  std::vector<cuio_json::TreeDepthT> const golden_levels = {
+    0, 1, 2, 3, 2, 3, 4, 4, 1, 2, 3, 4, 2, 3};
+  std::vector<SymbolOffsetT> const golden_range_begin = {
+    0, 1, 3, 6, 9, 12, 13, 15, 20, 22, 25, 26, 30, 34};
+  std::vector<SymbolOffsetT> const golden_range_end = {
+    38, 19, 4, 7, 10, 18, 14, 17, 37, 23, 28, 27, 31, 35};
+  std::vector<NodeIndexT> const golden_col_ids = {0, 1, 2, 4, 3, 5, 7, 6, 1, 3, 5, 7, 2, 4};
+
+  EXPECT_EQ(golden_categories,
+            cudf::detail::make_std_vector_sync(tree.node_categories, stream_view));
+  EXPECT_EQ(golden_parents, cudf::detail::make_std_vector_sync(tree.parent_node_ids, stream_view));
+  EXPECT_EQ(golden_levels, cudf::detail::make_std_vector_sync(tree.node_levels, stream_view));
+  EXPECT_EQ(golden_range_begin,
+            cudf::detail::make_std_vector_sync(tree.node_range_begin, stream_view));
+  EXPECT_EQ(golden_range_end, cudf::detail::make_std_vector_sync(tree.node_range_end, stream_view));
+  EXPECT_EQ(golden_col_ids, cudf::detail::make_std_vector_sync(col_ids, stream_view));
+}
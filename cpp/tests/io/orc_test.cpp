@@ -33,6 +33,7 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <numeric>
 #include <type_traits>
 
 #define NVCOMP_ZSTD_HEADER <nvcomp/zstd.h>
@@ -42,6 +43,17 @@
 #define ZSTD_SUPPORTED 0
 #endif
 
+// ZSTD compression requires nvcomp 2.4.0 or newer
+#if ZSTD_SUPPORTED
+#include NVCOMP_ZSTD_HEADER
+#endif
+#if ZSTD_SUPPORTED and (NVCOMP_MAJOR_VERSION > 2 or \
+                        (NVCOMP_MAJOR_VERSION == 2 and NVCOMP_MINOR_VERSION >= 4))
+#define ZSTD_COMPRESSION_SUPPORTED 1
+#else
+#define ZSTD_COMPRESSION_SUPPORTED 0
+#endif
+
 namespace cudf_io = cudf::io;
 
 template <typename T, typename SourceElementT = T>
@@ -532,6 +544,39 @@ TEST_F(OrcWriterTest, Strings)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcWriterTest, StringDictionaryCardinality)
+{
+  constexpr auto num_rows = 100000;
+  // few distinct strings, distinct strings, and distinct strings in the first rowgroups only
+  auto const low_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "day_" + std::to_string(i % 7); });
+  auto const high_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row_" + std::to_string(i); });
+  auto const mixed_card = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i < 20000 ? i : i % 3); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+
+  str_col col0(low_card, low_card + num_rows, valids);
+  str_col col1(high_card, high_card + num_rows);
+  str_col col2(mixed_card, mixed_card + num_rows, valids);
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  int32_col col3(sequence, sequence + num_rows);
+  table_view expected({col0, col1, col2, col3});
+
+  std::vector<char> out_buffer;
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+      .stripe_size_rows(30000);
+  cudf_io::write_orc(out_opts);
+
+  cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+    cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+  auto result = cudf_io::read_orc(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, SlicedTable)
 {
   // This test checks for writing zero copy, offsetted views into existing cudf tables
@@ -610,6 +655,35 @@ TEST_F(OrcWriterTest, HostBuffer)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(OrcWriterTest, NvcompCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto const ints         = random_values<int64_t>(num_rows);
+  auto const strings      = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 1000); });
+  int64_col col0(ints.begin(), ints.end());
+  str_col col1(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  std::vector<cudf_io::compression_type> codecs{cudf_io::compression_type::LZ4};
+#if ZSTD_COMPRESSION_SUPPORTED
+  codecs.push_back(cudf_io::compression_type::ZSTD);
+#endif
+  for (auto const codec : codecs) {
+    std::vector<char> out_buffer;
+    cudf_io::orc_writer_options out_opts =
+      cudf_io::orc_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(codec);
+    cudf_io::write_orc(out_opts);
+
+    cudf_io::orc_reader_options in_opts = cudf_io::orc_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto const result = cudf_io::read_orc(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 TEST_F(OrcWriterTest, negTimestampsNano)
 {
   // This is a separate test because ORC format has a bug where writing a timestamp between -1 and 0
@@ -1133,6 +1207,171 @@ TEST_F(OrcReaderTest, zstdCompressionRegression)
   EXPECT_EQ(1920800, result.tbl->num_rows());
 }
 
+TEST_F(OrcReaderTest, ReadWithFilter)
+{
+  // Each write produces a stripe with non-overlapping values in the first column
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto halves =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i + 0.5; });
+  int32_col a0(sequence, sequence + 1000);
+  int32_col a1(sequence + 2000, sequence + 3000);
+  float64_col b0(halves, halves + 1000);
+  float64_col b1(halves + 2000, halves + 3000);
+  auto const table0 = table_view{{a0, b0}};
+  auto const table1 = table_view{{a1, b1}};
+
+  auto filepath = temp_env->get_temp_filepath("ReadWithFilter.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(table0).write(table1);
+
+  auto lit_int   = cudf::numeric_scalar<int32_t>(2995);
+  auto lit_dbl   = cudf::numeric_scalar<double>(3.0);
+  auto int_value = cudf::ast::literal(lit_int);
+  auto dbl_value = cudf::ast::literal(lit_dbl);
+  auto col0      = cudf::ast::column_reference(0);
+  auto col1      = cudf::ast::column_reference(1);
+
+  // col0 >= 2995 || col1 < 3.0
+  {
+    auto lhs    = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col0, int_value);
+    auto rhs    = cudf::ast::operation(cudf::ast::ast_operator::LESS, col1, dbl_value);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, lhs, rhs);
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    auto const result = cudf_io::read_orc(read_opts);
+
+    int32_col expected_a{0, 1, 2, 2995, 2996, 2997, 2998, 2999};
+    float64_col expected_b{0.5, 1.5, 2.5, 2995.5, 2996.5, 2997.5, 2998.5, 2999.5};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table_view({expected_a, expected_b}));
+  }
+
+  // No row can match; the schema is still returned
+  {
+    auto lit_none    = cudf::numeric_scalar<int32_t>(1500);
+    auto none_value  = cudf::ast::literal(lit_none);
+    auto filter_none = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col0, none_value);
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter_none);
+    auto const result = cudf_io::read_orc(read_opts);
+
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+  }
+}
+
+TEST_F(OrcReaderTest, ReadWithBloomFilter)
+{
+  // Even values only, so that the statistics of every row group cover the odd values
+  constexpr auto num_rows = 10000;
+  auto evens   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 2; });
+  auto halves  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 0.5; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "str" + std::to_string(i); });
+  int64_col col0(evens, evens + num_rows);
+  float64_col col1(halves, halves + num_rows);
+  str_col col2(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  for (auto& col_meta : expected_metadata.column_metadata) {
+    col_meta.set_bloom_filter(true);
+  }
+
+  // Without statistics, only the Bloom filters can rule out a stripe
+  auto filepath = temp_env->get_temp_filepath("ReadWithBloomFilter.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .enable_statistics(cudf_io::statistics_freq::STATISTICS_NONE)
+      .stripe_size_rows(4096)
+      .row_index_stride(1024)
+      .bloom_filter_fpp(0.01);
+  cudf_io::write_orc(out_opts);
+
+  // The Bloom filter streams do not disturb reading the data
+  {
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+    auto const result = cudf_io::read_orc(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+
+  auto const read_equal = [&](cudf::size_type col_idx, auto& value) {
+    auto col_ref = cudf::ast::column_reference(col_idx);
+    auto lit     = cudf::ast::literal(value);
+    auto filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+    cudf_io::orc_reader_options read_opts =
+      cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_orc(read_opts);
+  };
+
+  // Values in every stripe are found, i.e. the filters have no false negatives
+  for (int64_t row : {0, 1023, 1024, 4095, 4096, 9999}) {
+    auto int_value    = cudf::numeric_scalar<int64_t>(row * 2);
+    auto const result = read_equal(0, int_value);
+    ASSERT_EQ(result.tbl->num_rows(), 1);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), int64_col{row * 2});
+
+    auto dbl_value        = cudf::numeric_scalar<double>(row * 0.5);
+    auto const dbl_result = read_equal(1, dbl_value);
+    ASSERT_EQ(dbl_result.tbl->num_rows(), 1);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(dbl_result.tbl->get_column(0), int64_col{row * 2});
+  }
+
+  // Missing values within the range of every row group yield no rows
+  for (int64_t value : {1, 2049, 19997}) {
+    auto int_value    = cudf::numeric_scalar<int64_t>(value);
+    auto const result = read_equal(0, int_value);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+  }
+}
+
+TEST_F(OrcReaderTest, ChunkedRead)
+{
+  srand(31533);
+  auto table1 = create_random_fixed_table<int>(3, 5, true);
+  auto table2 = create_random_fixed_table<int>(3, 5, true);
+  auto table3 = create_random_fixed_table<int>(3, 5, true);
+
+  // Each chunked write produces a stripe
+  auto filepath = temp_env->get_temp_filepath("ChunkedRead.orc");
+  cudf_io::chunked_orc_writer_options opts =
+    cudf_io::chunked_orc_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::orc_chunked_writer(opts).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::orc_reader_options read_opts =
+    cudf_io::orc_reader_options::builder(cudf_io::source_info{filepath});
+
+  // A limit smaller than any stripe reads one stripe per chunk
+  {
+    auto reader = cudf_io::chunked_orc_reader(1, read_opts);
+    for (auto const& expected : {table1->view(), table2->view(), table3->view()}) {
+      ASSERT_TRUE(reader.has_next());
+      auto const chunk = reader.read_chunk();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, chunk.tbl->view());
+    }
+    EXPECT_FALSE(reader.has_next());
+
+    // Reading past the end returns an empty table with the same schema
+    auto const past_end = reader.read_chunk();
+    EXPECT_EQ(past_end.tbl->num_rows(), 0);
+    EXPECT_EQ(past_end.tbl->num_columns(), 3);
+  }
+
+  // No limit reads the whole file at once
+  {
+    auto reader = cudf_io::chunked_orc_reader(0, read_opts);
+    ASSERT_TRUE(reader.has_next());
+    auto const chunk = reader.read_chunk();
+    EXPECT_FALSE(reader.has_next());
+
+    auto const expected = cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), chunk.tbl->view());
+  }
+}
+
 TEST_F(OrcReaderTest, MultipleInputs)
 {
   srand(31537);
@@ -1264,6 +1503,43 @@ TEST_F(OrcStatisticsTest, Overflow)
   check_sum_exist(3, true);
   check_sum_exist(4, true);
 }
+TEST_F(OrcStatisticsTest, StripeMetadata)
+{
+  constexpr uint64_t num_rows    = 10000;
+  constexpr uint64_t stripe_rows = 4000;
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t, typename decltype(sequence)::value_type> col1(sequence,
+                                                                         sequence + num_rows);
+  column_wrapper<int64_t, typename decltype(sequence)::value_type> col2(sequence,
+                                                                         sequence + num_rows);
+  table_view tbl({col1, col2});
+
+  auto filepath = temp_env->get_temp_filepath("OrcStripeMetadata.orc");
+  cudf_io::orc_writer_options out_opts =
+    cudf_io::orc_writer_options::builder(cudf_io::sink_info{filepath}, tbl)
+      .stripe_size_rows(stripe_rows);
+  cudf_io::write_orc(out_opts);
+
+  auto const metadata = cudf_io::read_orc_metadata(cudf_io::source_info{filepath});
+  EXPECT_EQ(metadata.num_rows, num_rows);
+  ASSERT_EQ(metadata.column_names.size(), 3);
+  ASSERT_EQ(metadata.stripes.size(), 3);
+
+  uint64_t rows = 0;
+  for (auto const& stripe : metadata.stripes) {
+    rows += stripe.num_rows;
+    ASSERT_EQ(stripe.column_lengths.size(), metadata.column_names.size());
+    // the column streams add up to the index and data sections of the stripe
+    EXPECT_EQ(std::accumulate(stripe.column_lengths.begin(), stripe.column_lengths.end(), 0ul),
+              stripe.index_length + stripe.data_length);
+    // 64-bit values take more space than 32-bit ones
+    EXPECT_GT(stripe.column_lengths[2], stripe.column_lengths[1]);
+  }
+  EXPECT_EQ(rows, num_rows);
+  EXPECT_EQ(metadata.stripes[0].num_rows, stripe_rows);
+}
+
 struct OrcWriterTestStripes
   : public OrcWriterTest,
     public ::testing::WithParamInterface<std::tuple<size_t, cudf::size_type>> {
@@ -23,28 +23,48 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_metadata.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <src/io/parquet/compact_protocol_reader.hpp>
+#include <src/io/parquet/host_read_batch.hpp>
 #include <src/io/parquet/parquet.hpp>
+#include <src/io/parquet/row_group_selection.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <atomic>
+#include <cstring>
 #include <fstream>
 #include <type_traits>
 
+// ZSTD compression requires nvcomp 2.4.0 or newer
+#define NVCOMP_ZSTD_HEADER <nvcomp/zstd.h>
+#if __has_include(NVCOMP_ZSTD_HEADER)
+#include NVCOMP_ZSTD_HEADER
+#endif
+#if defined(NVCOMP_MAJOR_VERSION) and \
+  (NVCOMP_MAJOR_VERSION > 2 or (NVCOMP_MAJOR_VERSION == 2 and NVCOMP_MINOR_VERSION >= 4))
+#define ZSTD_COMPRESSION_SUPPORTED 1
+#else
+#define ZSTD_COMPRESSION_SUPPORTED 0
+#endif
+
 namespace cudf_io = cudf::io;
 
 template <typename T, typename SourceElementT = T>
@@ -676,6 +696,79 @@ TEST_F(ParquetWriterTest, MultiColumnWithNulls)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, DeltaAndByteStreamSplitEncodings)
+{
+  constexpr auto num_rows = 20000;
+
+  auto col0_data = random_values<int32_t>(num_rows);
+  auto col1_data = random_values<int64_t>(num_rows);
+  auto col3_data = random_values<float>(num_rows);
+  auto col4_data = random_values<double>(num_rows);
+  auto sequence  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return cudf::timestamp_ms{cudf::duration_ms{1'000'000'000'000 + i * 17}}; });
+  auto valid_odd =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto valid_most =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 129 != 3; });
+
+  column_wrapper<int32_t> col0{col0_data.begin(), col0_data.end(), valid_most};
+  column_wrapper<int64_t> col1{col1_data.begin(), col1_data.end()};
+  column_wrapper<cudf::timestamp_ms> col2{sequence, sequence + num_rows, valid_odd};
+  column_wrapper<float> col3{col3_data.begin(), col3_data.end(), valid_odd};
+  column_wrapper<double> col4{col4_data.begin(), col4_data.end(), valid_most};
+
+  auto expected = table_view{{col0, col1, col2, col3, col4}};
+
+  cudf_io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("int32s").set_encoding(
+    cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  expected_metadata.column_metadata[1].set_name("int64s").set_encoding(
+    cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  expected_metadata.column_metadata[2].set_name("timestamps").set_encoding(
+    cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  expected_metadata.column_metadata[3].set_name("floats").set_encoding(
+    cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+  expected_metadata.column_metadata[4].set_name("doubles").set_encoding(
+    cudf_io::column_encoding::BYTE_STREAM_SPLIT);
+
+  auto filepath = temp_env->get_temp_filepath("DeltaAndByteStreamSplitEncodings.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .max_page_size_rows(5000);
+  cudf_io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  auto const expected_encodings = std::vector<cudf::io::parquet::Encoding>{
+    cudf::io::parquet::Encoding::DELTA_BINARY_PACKED,
+    cudf::io::parquet::Encoding::DELTA_BINARY_PACKED,
+    cudf::io::parquet::Encoding::DELTA_BINARY_PACKED,
+    cudf::io::parquet::Encoding::BYTE_STREAM_SPLIT,
+    cudf::io::parquet::Encoding::BYTE_STREAM_SPLIT};
+  for (size_t c = 0; c < expected_encodings.size(); c++) {
+    auto const& chunk_meta = fmd.row_groups[0].columns[c].meta_data;
+    auto const ph          = read_page_header(
+      source, {chunk_meta.data_page_offset, sizeof(cudf::io::parquet::PageHeader), 0});
+    EXPECT_EQ(ph.data_page_header.encoding, expected_encodings[c]);
+  }
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+  auto result = cudf_io::read_parquet(in_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // encodings that do not match the physical type are rejected
+  cudf_io::table_input_metadata invalid_metadata(expected);
+  invalid_metadata.column_metadata[3].set_encoding(cudf_io::column_encoding::DELTA_BINARY_PACKED);
+  cudf_io::parquet_writer_options invalid_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .metadata(&invalid_metadata);
+  EXPECT_THROW(cudf_io::write_parquet(invalid_opts), cudf::logic_error);
+}
+
 TEST_F(ParquetWriterTest, Strings)
 {
   std::vector<const char*> strings{
@@ -1073,6 +1166,35 @@ TEST_F(ParquetWriterTest, HostBuffer)
   cudf::test::expect_metadata_equal(expected_metadata, result.metadata);
 }
 
+TEST_F(ParquetWriterTest, NvcompCompression)
+{
+  constexpr auto num_rows = 100 << 10;
+  auto const ints         = random_values<int64_t>(num_rows);
+  auto const strings      = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 1000); });
+  column_wrapper<int64_t> col0(ints.begin(), ints.end());
+  column_wrapper<cudf::string_view> col1(strings, strings + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  std::vector<cudf_io::compression_type> codecs{cudf_io::compression_type::LZ4};
+#if ZSTD_COMPRESSION_SUPPORTED
+  codecs.push_back(cudf_io::compression_type::ZSTD);
+#endif
+  for (auto const codec : codecs) {
+    std::vector<char> out_buffer;
+    cudf_io::parquet_writer_options out_opts =
+      cudf_io::parquet_writer_options::builder(cudf_io::sink_info(&out_buffer), expected)
+        .compression(codec);
+    cudf_io::write_parquet(out_opts);
+
+    cudf_io::parquet_reader_options in_opts = cudf_io::parquet_reader_options::builder(
+      cudf_io::source_info(out_buffer.data(), out_buffer.size()));
+    auto const result = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, NonNullable)
 {
   srand(31337);
@@ -2188,6 +2310,248 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_opts), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, ChunkedReadRowGroups)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(5, 5, true);
+  auto table2 = create_random_fixed_table<int>(5, 5, true);
+  auto table3 = create_random_fixed_table<int>(5, 5, true);
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadRowGroups.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(*table1).write(*table2).write(*table3);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath});
+
+  // A limit smaller than a single row group yields one row group per chunk
+  {
+    auto reader = cudf_io::chunked_parquet_reader(1, read_opts);
+    std::vector<table_view> expected{*table1, *table2, *table3};
+    std::size_t num_chunks = 0;
+    while (reader.has_next()) {
+      auto const chunk = reader.read_chunk();
+      ASSERT_LT(num_chunks, expected.size());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*chunk.tbl, expected[num_chunks]);
+      ++num_chunks;
+    }
+    EXPECT_EQ(num_chunks, expected.size());
+
+    // Reading past the end returns an empty table with the same schema
+    auto const empty = reader.read_chunk();
+    EXPECT_EQ(empty.tbl->num_rows(), 0);
+    EXPECT_EQ(empty.tbl->num_columns(), table1->num_columns());
+  }
+
+  // Reading ahead does not change the returned chunks
+  {
+    read_opts.set_pipeline_depth(2);
+    auto reader = cudf_io::chunked_parquet_reader(1, read_opts);
+    std::vector<table_view> expected{*table1, *table2, *table3};
+    std::size_t num_chunks = 0;
+    while (reader.has_next()) {
+      auto const chunk = reader.read_chunk();
+      ASSERT_LT(num_chunks, expected.size());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*chunk.tbl, expected[num_chunks]);
+      ++num_chunks;
+    }
+    EXPECT_EQ(num_chunks, expected.size());
+    read_opts.set_pipeline_depth(0);
+  }
+
+  // No limit reads the whole file at once
+  {
+    auto reader = cudf_io::chunked_parquet_reader(0, read_opts);
+    ASSERT_TRUE(reader.has_next());
+    auto const result = reader.read_chunk();
+    EXPECT_FALSE(reader.has_next());
+    auto const full_table =
+      cudf::concatenate(std::vector<table_view>({*table1, *table2, *table3}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+  }
+
+  // Explicitly selected row groups are honored and returned in order
+  {
+    read_opts.set_row_groups({{2, 0}});
+    auto reader = cudf_io::chunked_parquet_reader(1, read_opts);
+    std::vector<table_view> expected{*table3, *table1};
+    std::size_t num_chunks = 0;
+    while (reader.has_next()) {
+      auto const chunk = reader.read_chunk();
+      ASSERT_LT(num_chunks, expected.size());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*chunk.tbl, expected[num_chunks]);
+      ++num_chunks;
+    }
+    EXPECT_EQ(num_chunks, expected.size());
+  }
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadWithFilter)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using dbl_col = cudf::test::fixed_width_column_wrapper<double>;
+
+  // Each write produces a row group with non-overlapping values in the first column
+  int_col a0{0, 1, 2, 3, 4};
+  dbl_col b0{0.5, 1.5, 2.5, 3.5, 4.5};
+  int_col a1{10, 11, 12, 13, 14};
+  dbl_col b1{10.5, 11.5, 12.5, 13.5, 14.5};
+  int_col a2{24, 23, 22, 21, 20};
+  dbl_col b2{24.5, 23.5, 22.5, 21.5, 20.5};
+  auto const table0 = table_view{{a0, b0}};
+  auto const table1 = table_view{{a1, b1}};
+  auto const table2 = table_view{{a2, b2}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadWithFilter.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table0).write(table1).write(table2);
+
+  // col0 < 12 || col1 >= 23.0
+  auto lit_int    = cudf::numeric_scalar<int32_t>(12);
+  auto lit_dbl    = cudf::numeric_scalar<double>(23.0);
+  auto int_value  = cudf::ast::literal(lit_int);
+  auto dbl_value  = cudf::ast::literal(lit_dbl);
+  auto col0       = cudf::ast::column_reference(0);
+  auto col1       = cudf::ast::column_reference(1);
+  auto lhs        = cudf::ast::operation(cudf::ast::ast_operator::LESS, col0, int_value);
+  auto rhs        = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col1, dbl_value);
+  auto filter_or  = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, lhs, rhs);
+  auto filter_lhs = cudf::ast::operation(cudf::ast::ast_operator::LESS, int_value, col0);
+
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter_or);
+    auto const result = cudf_io::read_parquet(read_opts);
+
+    int_col expected_a{0, 1, 2, 3, 4, 10, 11, 24, 23};
+    dbl_col expected_b{0.5, 1.5, 2.5, 3.5, 4.5, 10.5, 11.5, 24.5, 23.5};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table_view({expected_a, expected_b}));
+  }
+
+  // Literal on the left-hand side: 12 < col0
+  {
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter_lhs);
+    auto const result = cudf_io::read_parquet(read_opts);
+
+    int_col expected_a{13, 14, 24, 23, 22, 21, 20};
+    dbl_col expected_b{13.5, 14.5, 24.5, 23.5, 22.5, 21.5, 20.5};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table_view({expected_a, expected_b}));
+  }
+
+  // No row can match; the schema is still returned
+  {
+    auto lit_none    = cudf::numeric_scalar<int32_t>(100);
+    auto none_value  = cudf::ast::literal(lit_none);
+    auto filter_none = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col0, none_value);
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter_none);
+    auto const result = cudf_io::read_parquet(read_opts);
+
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 2);
+  }
+}
+
+TEST_F(ParquetChunkedWriterTest, BloomFilters)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int64_t>;
+  using dbl_col = cudf::test::fixed_width_column_wrapper<double>;
+
+  // The row groups have overlapping [min, max] ranges, so only the Bloom filters can tell them apart
+  auto evens = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  auto odds  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i + 1; });
+  auto halves =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i + 0.5; });
+  int_col a0(evens, evens + 100);
+  int_col a1(odds, odds + 100);
+  dbl_col b0(halves, halves + 100);
+  dbl_col b1(halves + 100, halves + 200);
+  auto const table0 = table_view{{a0, b0}};
+  auto const table1 = table_view{{a1, b1}};
+
+  cudf_io::table_input_metadata metadata(table0);
+  metadata.column_metadata[0].set_name("keys").set_bloom_filter(true);
+  metadata.column_metadata[1].set_name("values");
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedBloomFilters.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath})
+      .metadata(&metadata);
+  cudf_io::parquet_chunked_writer(args).write(table0).write(table1);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 2);
+  for (auto const& rg : fmd.row_groups) {
+    EXPECT_GT(rg.columns[0].meta_data.bloom_filter_offset, 0);
+    EXPECT_EQ(rg.columns[1].meta_data.bloom_filter_offset, 0);
+  }
+
+  auto lit_key   = cudf::numeric_scalar<int64_t>(51);
+  auto key_value = cudf::ast::literal(lit_key);
+  auto col0      = cudf::ast::column_reference(0);
+
+  // col0 == 51
+  {
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col0, key_value);
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    auto const result = cudf_io::read_parquet(read_opts);
+
+    int_col expected_a{51};
+    dbl_col expected_b{125.5};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, table_view({expected_a, expected_b}));
+  }
+
+  // col0 != 51 must keep every row group that has other values
+  {
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, col0, key_value);
+    cudf_io::parquet_reader_options read_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    auto const result = cudf_io::read_parquet(read_opts);
+
+    EXPECT_EQ(result.tbl->num_rows(), 199);
+  }
+}
+
+TEST_F(ParquetChunkedWriterTest, ReadDictionaryColumns)
+{
+  using str_col = cudf::test::strings_column_wrapper;
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+  // Each write produces a row group with its own dictionary, and the dictionaries overlap
+  str_col s0({"cat", "dog", "", "cat", "bird", "dog"}, {1, 1, 1, 0, 1, 1});
+  int_col i0{0, 1, 2, 3, 4, 5};
+  str_col s1({"fish", "cat", "cat", "ant", "fish", "dog"}, {1, 1, 0, 1, 1, 1});
+  int_col i1{6, 7, 8, 9, 10, 11};
+  auto const table0 = table_view{{s0, i0}};
+  auto const table1 = table_view{{s1, i1}};
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadDictionaryColumns.parquet");
+  cudf_io::chunked_parquet_writer_options args =
+    cudf_io::chunked_parquet_writer_options::builder(cudf_io::sink_info{filepath});
+  cudf_io::parquet_chunked_writer(args).write(table0).write(table1);
+
+  cudf_io::parquet_reader_options read_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .keep_dictionary_encoding(true);
+  auto const result = cudf_io::read_parquet(read_opts);
+
+  ASSERT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::DICTIONARY32);
+  auto const dictionary = cudf::dictionary_column_view(result.tbl->get_column(0).view());
+  str_col expected_keys{"", "ant", "bird", "cat", "dog", "fish"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(dictionary.keys(), expected_keys);
+
+  auto const expected = cudf::concatenate(std::vector<cudf::column_view>{s0, s1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(dictionary), *expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(1).view(),
+                                 *cudf::concatenate(std::vector<cudf::column_view>{i0, i1}));
+}
+
 TEST_F(ParquetWriterTest, DecimalWrite)
 {
   constexpr cudf::size_type num_rows = 500;
@@ -3332,6 +3696,125 @@ TEST_F(ParquetWriterTest, CheckPageRows)
   EXPECT_EQ(ph.data_page_header.num_values, page_rows);
 }
 
+TEST_F(ParquetWriterTest, DictionaryFallback)
+{
+  constexpr auto num_rows       = 30000;
+  constexpr auto num_dict_rows  = 10000;
+  constexpr auto max_dictionary = 4 * 1024;
+  // few distinct values in the first rows, then all distinct values that overflow the dictionary
+  auto mixed = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i < num_dict_rows ? i % 100 : i; });
+  auto sequence = thrust::make_counting_iterator(0);
+  column_wrapper<int> col0(mixed, mixed + num_rows);
+  column_wrapper<int> col1(sequence, sequence + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  auto const filepath = temp_env->get_temp_filepath("DictionaryFallback.parquet");
+  const cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .max_dictionary_size(max_dictionary);
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 1);
+  auto const& dict_chunk  = fmd.row_groups[0].columns[0];
+  auto const& plain_chunk = fmd.row_groups[0].columns[1];
+
+  // the pages of the first rows use the dictionary, the remaining pages fall back to PLAIN
+  EXPECT_GT(dict_chunk.meta_data.dictionary_page_offset, 0);
+  auto const oi = read_offset_index(source, dict_chunk);
+  ASSERT_GT(oi.page_locations.size(), 1);
+  for (auto const& page_loc : oi.page_locations) {
+    auto const ph = read_page_header(source, page_loc);
+    EXPECT_EQ(ph.data_page_header.encoding,
+              page_loc.first_row_index < num_dict_rows
+                ? cudf::io::parquet::Encoding::PLAIN_DICTIONARY
+                : cudf::io::parquet::Encoding::PLAIN);
+  }
+
+  // the sample of the all distinct column skips the dictionary
+  EXPECT_EQ(plain_chunk.meta_data.dictionary_page_offset, 0);
+  for (auto const& page_loc : read_offset_index(source, plain_chunk).page_locations) {
+    auto const ph = read_page_header(source, page_loc);
+    EXPECT_EQ(ph.data_page_header.encoding, cudf::io::parquet::Encoding::PLAIN);
+  }
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ReadMetadata)
+{
+  constexpr auto num_rows       = 10000;
+  constexpr auto row_group_rows = 5000;
+  auto sequence                 = thrust::make_counting_iterator(0);
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "string" + std::to_string(i % 10); });
+  column_wrapper<int> col0(sequence, sequence + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints");
+  expected_metadata.column_metadata[1].set_name("strings");
+
+  auto const filepath = temp_env->get_temp_filepath("ReadMetadata.parquet");
+  const cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .row_group_size_rows(row_group_rows);
+  cudf::io::write_parquet(out_opts);
+
+  auto const metadata = cudf::io::read_parquet_metadata(cudf::io::source_info{filepath});
+  EXPECT_EQ(metadata.num_rows, num_rows);
+
+  ASSERT_EQ(metadata.schema.children.size(), 2);
+  EXPECT_EQ(metadata.schema.children[0].name, "ints");
+  EXPECT_EQ(metadata.schema.children[0].physical_type, "INT32");
+  EXPECT_EQ(metadata.schema.children[0].repetition, "REQUIRED");
+  EXPECT_EQ(metadata.schema.children[1].name, "strings");
+  EXPECT_EQ(metadata.schema.children[1].physical_type, "BYTE_ARRAY");
+  EXPECT_TRUE(metadata.schema.children[1].children.empty());
+
+  ASSERT_EQ(metadata.row_groups.size(), 2);
+  for (size_t r = 0; r < metadata.row_groups.size(); ++r) {
+    auto const& row_group = metadata.row_groups[r];
+    EXPECT_EQ(row_group.num_rows, row_group_rows);
+    ASSERT_EQ(row_group.columns.size(), 2);
+    for (auto const& chunk : row_group.columns) {
+      EXPECT_EQ(chunk.num_values, row_group_rows);
+      EXPECT_GT(chunk.compressed_size, 0);
+      EXPECT_GT(chunk.uncompressed_size, 0);
+      EXPECT_NE(std::find(chunk.encodings.begin(), chunk.encodings.end(), "PLAIN"),
+                chunk.encodings.end());
+    }
+    // the few distinct strings are dictionary encoded
+    auto const& strings_encodings = row_group.columns[1].encodings;
+    EXPECT_NE(std::find(strings_encodings.begin(), strings_encodings.end(), "PLAIN_DICTIONARY"),
+              strings_encodings.end());
+
+    // statistics of the integers are PLAIN encoded little-endian values
+    auto const& stats = row_group.columns[0].statistics;
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->null_count, 0);
+    ASSERT_TRUE(stats->min_value.has_value() and stats->max_value.has_value());
+    int32_t min = 0;
+    int32_t max = 0;
+    ASSERT_EQ(stats->min_value->size(), sizeof(min));
+    ASSERT_EQ(stats->max_value->size(), sizeof(max));
+    std::memcpy(&min, stats->min_value->data(), sizeof(min));
+    std::memcpy(&max, stats->max_value->data(), sizeof(max));
+    EXPECT_EQ(min, static_cast<int32_t>(r * row_group_rows));
+    EXPECT_EQ(max, static_cast<int32_t>((r + 1) * row_group_rows - 1));
+  }
+}
+
 TEST_F(ParquetWriterTest, Decimal128Stats)
 {
   // check that decimal128 min and max statistics are written in network byte order
@@ -4053,6 +4536,66 @@ TEST_F(ParquetWriterTest, CheckColumnOffsetIndexStruct)
   }
 }
 
+TEST_F(ParquetWriterTest, ColumnStatisticsOptOut)
+{
+  constexpr auto num_rows = 50000;
+
+  auto sequence = thrust::make_counting_iterator(0);
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i % 1000); });
+
+  auto col0 = cudf::test::fixed_width_column_wrapper<int32_t>(sequence, sequence + num_rows);
+  auto col1 = cudf::test::fixed_width_column_wrapper<double>(sequence, sequence + num_rows);
+  auto col2 = cudf::test::strings_column_wrapper(strings, strings + num_rows);
+
+  auto const expected = table_view{{col0, col1, col2}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[1].set_statistics(false);
+
+  auto const filepath = temp_env->get_temp_filepath("ColumnStatisticsOptOut.parquet");
+  const cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(&expected_metadata)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .max_page_size_rows(10000);
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+
+  read_footer(source, &fmd);
+
+  for (auto const& rg : fmd.row_groups) {
+    for (size_t c = 0; c < rg.columns.size(); c++) {
+      auto const& chunk = rg.columns[c];
+      if (c == 1) {
+        EXPECT_TRUE(chunk.meta_data.statistics_blob.empty());
+        EXPECT_EQ(chunk.column_index_length, 0);
+      } else {
+        EXPECT_FALSE(parse_statistics(chunk).min_value.empty());
+        EXPECT_GT(read_column_index(source, chunk).min_values.size(), 1u);
+      }
+
+      // page headers of the opted out column carry no statistics either, so the pages are
+      // still found at the offsets of the offset index
+      auto const oi    = read_offset_index(source, chunk);
+      int64_t num_vals = 0;
+      for (auto const& page_loc : oi.page_locations) {
+        auto const ph = read_page_header(source, page_loc);
+        EXPECT_EQ(ph.type, cudf::io::parquet::PageType::DATA_PAGE);
+        EXPECT_EQ(page_loc.first_row_index, num_vals);
+        num_vals += ph.data_page_header.num_values;
+      }
+    }
+  }
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetReaderTest, EmptyColumnsParam)
 {
   srand(31337);
@@ -4210,6 +4753,485 @@ TEST_F(ParquetReaderTest, NestedByteArray)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetReaderTest, MultipleFilesMetadataCache)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+  constexpr int num_files = 16;
+  std::vector<std::string> filepaths;
+  std::vector<int_col> columns;
+  for (int f = 0; f < num_files; ++f) {
+    columns.emplace_back(int_col{f, f + 1, f + 2});
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultipleFilesMetadataCache" + std::to_string(f) + ".parquet"));
+    cudf_io::parquet_writer_options out_opts = cudf_io::parquet_writer_options::builder(
+      cudf_io::sink_info{filepaths.back()}, table_view{{columns.back()}});
+    cudf_io::write_parquet(out_opts);
+  }
+  auto const expected = [&]() {
+    std::vector<cudf::column_view> views(columns.begin(), columns.end());
+    return cudf::concatenate(views);
+  };
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepaths})
+      .use_metadata_cache(true);
+  // The second read uses the cached footers
+  for (int i = 0; i < 2; ++i) {
+    auto const result = cudf_io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), *expected());
+  }
+
+  // A rewritten file is parsed again
+  columns[3] = int_col{30, 31, 32, 33, 34, 35, 36};
+  cudf_io::parquet_writer_options out_opts = cudf_io::parquet_writer_options::builder(
+    cudf_io::sink_info{filepaths[3]}, table_view{{columns[3]}});
+  cudf_io::write_parquet(out_opts);
+  auto const result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), *expected());
+}
+
+class CountingSource : public cudf::io::datasource {
+ public:
+  std::vector<char> const& data;
+  std::atomic<int> num_reads{0};
+
+  explicit CountingSource(std::vector<char> const& data) : data(data) {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    size = std::min(size, data.size() - offset);
+    return std::make_unique<non_owning_buffer>(
+      reinterpret_cast<uint8_t const*>(data.data()) + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    auto const read_size = std::min(size, data.size() - offset);
+    std::memcpy(dst, data.data() + offset, read_size);
+    return read_size;
+  }
+
+  [[nodiscard]] size_t size() const override { return data.size(); }
+};
+
+TEST_F(ParquetReaderTest, CachedSource)
+{
+  constexpr auto num_rows = 10000;
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  std::vector<char> out_buffer;
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{&out_buffer}, expected);
+  cudf_io::write_parquet(out_opts);
+
+  CountingSource source{out_buffer};
+  {
+    // the whole file fits in one block, so only the first read reaches the source
+    cudf_io::cached_source_options cache_opts;
+    cache_opts.block_size = 1 << 20;
+    auto cached           = cudf_io::datasource::create_cached(&source, cache_opts);
+    for (int i = 0; i < 2; ++i) {
+      auto const result = cudf_io::read_parquet(
+        cudf_io::parquet_reader_options::builder(cudf_io::source_info{cached.get()}));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    }
+    EXPECT_EQ(source.num_reads.load(), 1);
+  }
+  {
+    // all reads bypass the cache and are split into concurrent reads
+    cudf_io::cached_source_options cache_opts;
+    cache_opts.block_size           = 256;
+    cache_opts.max_cached_read_size = 0;
+    cache_opts.num_parallel_reads   = 4;
+    auto cached                     = cudf_io::datasource::create_cached(&source, cache_opts);
+    auto const result               = cudf_io::read_parquet(
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{cached.get()}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+  {
+    // small blocks and cache; the reads must still return the right data after evictions
+    cudf_io::cached_source_options cache_opts;
+    cache_opts.block_size         = 512;
+    cache_opts.cache_size         = 2048;
+    cache_opts.num_parallel_reads = 2;
+    auto cached                   = cudf_io::datasource::create_cached(&source, cache_opts);
+    for (int i = 0; i < 2; ++i) {
+      auto const result = cudf_io::read_parquet(
+        cudf_io::parquet_reader_options::builder(cudf_io::source_info{cached.get()}));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+    }
+  }
+}
+
+TEST_F(ParquetReaderTest, SkipRowsNumRows)
+{
+  constexpr auto num_rows = 20000;
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows, validity);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  // several row groups of several pages, with offset indexes
+  auto const filepath = temp_env->get_temp_filepath("SkipRowsNumRows.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(6000)
+      .max_page_size_rows(1000)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf_io::write_parquet(out_opts);
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const ranges{
+    {0, 10}, {999, 2}, {1500, 3000}, {5999, 6002}, {12345, -1}, {19999, 1}, {0, num_rows}};
+  for (auto const& [skip_rows, num_rows_to_read] : ranges) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+        .skip_rows(skip_rows)
+        .num_rows(num_rows_to_read);
+    auto const result = cudf_io::read_parquet(in_opts);
+
+    auto const end   = num_rows_to_read < 0 ? num_rows : skip_rows + num_rows_to_read;
+    auto const slice = cudf::slice(expected, {skip_rows, end}).front();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(slice, result.tbl->view());
+  }
+
+  // past the end of the file
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).skip_rows(num_rows);
+  EXPECT_EQ(cudf_io::read_parquet(in_opts).tbl->num_rows(), 0);
+}
+
+TEST_F(ParquetReaderTest, SkipRowsNumRowsList)
+{
+  constexpr auto num_rows = 10000;
+
+  auto col0          = make_parquet_list_col<int>(0, num_rows, 2, 3, true);
+  auto const expected = table_view{{*col0}};
+
+  auto const filepath = temp_env->get_temp_filepath("SkipRowsNumRowsList.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(3000)
+      .max_page_size_rows(500)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf_io::write_parquet(out_opts);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(4321)
+      .num_rows(2000);
+  auto const result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {4321, 6321}).front(), result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, SelectRowGroupsBeyondSizeType)
+{
+  using cudf::io::detail::parquet::select_row_groups;
+
+  // three sources of 2^30-row row groups, 5 * 2^30 rows in total
+  constexpr int64_t rg_rows = int64_t{1} << 30;
+  std::vector<std::vector<int64_t>> const row_group_num_rows{
+    {rg_rows, rg_rows}, {rg_rows}, {rg_rows, rg_rows}};
+
+  auto const [all_row_groups, all_rows] = select_row_groups({}, row_group_num_rows);
+  EXPECT_EQ(all_rows, 5 * rg_rows);
+  ASSERT_EQ(all_row_groups.size(), 5);
+  for (size_t i = 0; i < all_row_groups.size(); ++i) {
+    EXPECT_EQ(all_row_groups[i].start_row, static_cast<size_t>(i * rg_rows));
+  }
+  EXPECT_EQ(all_row_groups.back().source_index, 2);
+  EXPECT_EQ(all_row_groups.back().index, 1);
+
+  auto const [row_groups, rows] = select_row_groups({{1}, {0}, {0, 1}}, row_group_num_rows);
+  EXPECT_EQ(rows, 4 * rg_rows);
+  ASSERT_EQ(row_groups.size(), 4);
+  EXPECT_EQ(row_groups.back().start_row, static_cast<size_t>(3 * rg_rows));
+
+  EXPECT_THROW(select_row_groups({{2}, {}, {}}, row_group_num_rows), cudf::logic_error);
+  EXPECT_THROW(select_row_groups({{0}}, row_group_num_rows), cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, HostReadBatchesSpanSources)
+{
+  using cudf::io::detail::parquet::make_host_read_batches;
+  using read_info = cudf::io::detail::parquet::host_read_batch::read_info;
+
+  // chunks of three small files, the third file's dictionary page read separately
+  std::vector<read_info> const reads{{0, 4, 100, 0, 2},
+                                     {1, 4, 200, 2, 4},
+                                     {2, 4, 50, 4, 4},
+                                     {2, 500, 150, 4, 5}};
+  auto const batches = make_host_read_batches(reads, 1000);
+  ASSERT_EQ(batches.size(), 1);
+  EXPECT_EQ(batches[0].size, 500);
+  ASSERT_EQ(batches[0].reads.size(), reads.size());
+  for (size_t r = 0; r < reads.size(); ++r) {
+    EXPECT_EQ(batches[0].reads[r].source, reads[r].source);
+  }
+
+  // the dictionary read stays in the batch of the data it precedes
+  auto const split_batches = make_host_read_batches(reads, 320);
+  ASSERT_EQ(split_batches.size(), 2);
+  EXPECT_EQ(split_batches[0].size, 300);
+  EXPECT_EQ(split_batches[1].size, 200);
+  EXPECT_EQ(split_batches[1].reads.front().first_chunk, 4);
+  EXPECT_EQ(split_batches[1].reads.front().last_chunk, 4);
+
+  // a read larger than the batch size gets a batch of its own
+  auto const large_batches = make_host_read_batches({{0, 0, 10, 0, 1}, {1, 0, 2000, 1, 2}}, 1000);
+  ASSERT_EQ(large_batches.size(), 2);
+  EXPECT_EQ(large_batches[1].size, 2000);
+}
+
+TEST_F(ParquetReaderTest, MultipleSmallSources)
+{
+  using int_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+  // the chunks of all files share a single host read batch
+  constexpr int num_files = 20;
+  std::vector<std::string> filepaths;
+  std::vector<int_col> columns;
+  for (int f = 0; f < num_files; ++f) {
+    columns.emplace_back(int_col{f, f * 2, f * 3, f * 4});
+    filepaths.push_back(
+      temp_env->get_temp_filepath("MultipleSmallSources" + std::to_string(f) + ".parquet"));
+    cudf_io::parquet_writer_options out_opts = cudf_io::parquet_writer_options::builder(
+      cudf_io::sink_info{filepaths.back()}, table_view{{columns.back()}});
+    cudf_io::write_parquet(out_opts);
+  }
+  std::vector<cudf::column_view> views(columns.begin(), columns.end());
+  auto const expected = cudf::concatenate(views);
+
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepaths});
+  auto const result = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), *expected);
+}
+
+TEST_F(ParquetReaderTest, SkipRowsNumRowsErrors)
+{
+  auto const source = cudf_io::source_info{nullptr, 0};
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).skip_rows(-1), cudf::logic_error);
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).num_rows(-2), cudf::logic_error);
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).row_groups({{0}}).skip_rows(1),
+               cudf::logic_error);
+  EXPECT_THROW(cudf_io::parquet_reader_options::builder(source).num_rows(1).row_groups({{0}}),
+               cudf::logic_error);
+}
+
+TEST_F(ParquetReaderTest, LateMaterialization)
+{
+  constexpr auto num_rows = 60000;
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  cudf::test::strings_column_wrapper col1(strings, strings + num_rows, validity);
+  column_wrapper<double> col2(sequence, sequence + num_rows, validity);
+  auto col3           = make_parquet_list_col<int>(0, num_rows, 2, 3, true);
+  auto const expected = table_view{{col0, col1, col2, *col3}};
+
+  auto const filepath = temp_env->get_temp_filepath("LateMaterialization.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(20000)
+      .max_page_size_rows(1000)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf_io::write_parquet(out_opts);
+
+  // col0 < 10 || col2 >= 55000.0 || (col0 > 30000 && col0 < 30010)
+  auto lit_low    = cudf::numeric_scalar<int32_t>(10);
+  auto lit_high   = cudf::numeric_scalar<double>(55000.0);
+  auto lit_mid0   = cudf::numeric_scalar<int32_t>(30000);
+  auto lit_mid1   = cudf::numeric_scalar<int32_t>(30010);
+  auto low_value  = cudf::ast::literal(lit_low);
+  auto high_value = cudf::ast::literal(lit_high);
+  auto mid0_value = cudf::ast::literal(lit_mid0);
+  auto mid1_value = cudf::ast::literal(lit_mid1);
+  auto ref0       = cudf::ast::column_reference(0);
+  auto ref2       = cudf::ast::column_reference(2);
+  auto low        = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, low_value);
+  auto high       = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref2, high_value);
+  auto mid0       = cudf::ast::operation(cudf::ast::ast_operator::GREATER, ref0, mid0_value);
+  auto mid1       = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, mid1_value);
+  auto mid        = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, mid0, mid1);
+  auto low_high   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, low, high);
+  auto filter     = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, low_high, mid);
+  auto no_rows    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, low, high);
+
+  for (auto const* expr : {&filter, &no_rows}) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(*expr);
+    auto const early = cudf_io::read_parquet(in_opts);
+    in_opts.enable_late_materialization(true);
+    auto const late = cudf_io::read_parquet(in_opts);
+
+    CUDF_TEST_EXPECT_TABLES_EQUAL(early.tbl->view(), late.tbl->view());
+    EXPECT_EQ(early.metadata.column_names, late.metadata.column_names);
+  }
+
+  // along with a range of rows
+  cudf_io::parquet_reader_options in_opts =
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath})
+      .skip_rows(5)
+      .num_rows(50000)
+      .filter(filter);
+  auto const early = cudf_io::read_parquet(in_opts);
+  in_opts.enable_late_materialization(true);
+  auto const late = cudf_io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(early.tbl->view(), late.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, FilterPages)
+{
+  constexpr auto num_rows = 20000;
+
+  // the values of both numeric columns increase with the row, and rows [4000, 5000) are null
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i < 4000 || i >= 5000; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  column_wrapper<int32_t> col0(sequence, sequence + num_rows);
+  column_wrapper<double> col1(sequence, sequence + num_rows, validity);
+  cudf::test::strings_column_wrapper col2(strings, strings + num_rows, validity);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  // several row groups of several pages, with page indexes
+  auto const filepath = temp_env->get_temp_filepath("FilterPages.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .row_group_size_rows(6000)
+      .max_page_size_rows(1000)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf_io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_GT(fmd.row_groups.size(), 1);
+  auto const ci = read_column_index(source, fmd.row_groups[0].columns[1]);
+  ASSERT_GT(ci.null_pages.size(), 1);
+  EXPECT_TRUE(ci.null_pages[4]);
+
+  auto const read_filtered = [&](cudf::ast::expression const& filter) {
+    cudf_io::parquet_reader_options in_opts =
+      cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}).filter(filter);
+    return cudf_io::read_parquet(in_opts);
+  };
+
+  auto ref0 = cudf::ast::column_reference(0);
+  auto ref1 = cudf::ast::column_reference(1);
+
+  // (col0 >= 2500 && col0 < 2700) || col0 >= 13990, within and across row groups
+  {
+    auto lit_begin   = cudf::numeric_scalar<int32_t>(2500);
+    auto lit_end     = cudf::numeric_scalar<int32_t>(2700);
+    auto lit_tail    = cudf::numeric_scalar<int32_t>(13990);
+    auto begin_value = cudf::ast::literal(lit_begin);
+    auto end_value   = cudf::ast::literal(lit_end);
+    auto tail_value  = cudf::ast::literal(lit_tail);
+
+    auto begin  = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, begin_value);
+    auto end    = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, end_value);
+    auto tail   = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, ref0, tail_value);
+    auto middle = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, begin, end);
+    auto filter = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_OR, middle, tail);
+
+    auto const result = read_filtered(filter);
+    auto const slices = cudf::slice(expected, {2500, 2700, 13990, num_rows});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(slices)->view(), result.tbl->view());
+  }
+
+  // 3500.0 < col1 < 5500.0 spans a page holding only nulls
+  {
+    auto lit_low    = cudf::numeric_scalar<double>(3500.0);
+    auto lit_high   = cudf::numeric_scalar<double>(5500.0);
+    auto low_value  = cudf::ast::literal(lit_low);
+    auto high_value = cudf::ast::literal(lit_high);
+    auto low        = cudf::ast::operation(cudf::ast::ast_operator::GREATER, ref1, low_value);
+    auto high       = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref1, high_value);
+    auto filter     = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, low, high);
+
+    auto const result = read_filtered(filter);
+    auto const slices = cudf::slice(expected, {3501, 4000, 5000, 5500});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(slices)->view(), result.tbl->view());
+  }
+
+  // no page can satisfy col0 > 1000 && col0 < 1000
+  {
+    auto lit_value = cudf::numeric_scalar<int32_t>(1000);
+    auto value     = cudf::ast::literal(lit_value);
+    auto above     = cudf::ast::operation(cudf::ast::ast_operator::GREATER, ref0, value);
+    auto below     = cudf::ast::operation(cudf::ast::ast_operator::LESS, ref0, value);
+    auto filter    = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, above, below);
+
+    auto const result = read_filtered(filter);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), 3);
+  }
+}
+
+TEST_F(ParquetReaderTest, DeeplyNestedLists)
+{
+  constexpr cudf::size_type num_rows = 20000;
+
+  // row i holds i % 3 lists of 2 lists, the k-th of which holds k % 4 values; long runs of
+  // repetition and definition levels alternate with short ones
+  std::vector<cudf::size_type> offsets0{0};
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    offsets0.push_back(offsets0.back() + i % 3);
+  }
+  std::vector<cudf::size_type> offsets1{0};
+  for (cudf::size_type i = 0; i < offsets0.back(); ++i) {
+    offsets1.push_back(offsets1.back() + 2);
+  }
+  std::vector<cudf::size_type> offsets2{0};
+  for (cudf::size_type i = 0; i < offsets1.back(); ++i) {
+    offsets2.push_back(offsets2.back() + i % 4);
+  }
+
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto const make_offsets = [](std::vector<cudf::size_type> const& offsets) {
+    return column_wrapper<cudf::size_type>(offsets.begin(), offsets.end()).release();
+  };
+  auto values = column_wrapper<int32_t>(sequence, sequence + offsets2.back(), validity).release();
+  auto level2 = cudf::make_lists_column(
+    offsets1.back(), make_offsets(offsets2), std::move(values), 0, rmm::device_buffer{});
+  auto level1 = cudf::make_lists_column(
+    offsets0.back(), make_offsets(offsets1), std::move(level2), 0, rmm::device_buffer{});
+  auto level0 = cudf::make_lists_column(
+    num_rows, make_offsets(offsets0), std::move(level1), 0, rmm::device_buffer{});
+  auto const expected = table_view{{*level0}};
+
+  auto const filepath = temp_env->get_temp_filepath("DeeplyNestedLists.parquet");
+  cudf_io::parquet_writer_options out_opts =
+    cudf_io::parquet_writer_options::builder(cudf_io::sink_info{filepath}, expected)
+      .max_page_size_rows(1000);
+  cudf_io::write_parquet(out_opts);
+
+  auto const result = cudf_io::read_parquet(
+    cudf_io::parquet_reader_options::builder(cudf_io::source_info{filepath}));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, ByteArrayStats)
 {
   // check that byte array min and max statistics are written as expected. If a byte array is
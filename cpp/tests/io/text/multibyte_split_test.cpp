@@ -27,9 +27,15 @@
 #include <cudf/io/text/multibyte_split.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
+#include <fstream>
+
 using namespace cudf;
 using namespace test;
 
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
 // 😀 | F0 9F 98 80 | 11110000 10011111 10011000 10000000
 // 😎 | F0 9F 98 8E | 11110000 10011111 10011000 10001110
 
@@ -91,6 +97,87 @@ TEST_F(MultibyteSplitTest, DelimiterAtEndByteRange)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
 }
 
+TEST_F(MultibyteSplitTest, MultipleDelimiters)
+{
+  auto delimiters = std::vector<std::string>{"\n", "\r\n"};
+  auto host_input = std::string("abc\ndef\r\n\r\nghi\n");
+
+  auto expected = strings_column_wrapper{"abc\n", "def\r\n", "\r\n", "ghi\n", ""};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersShorterInsideLonger)
+{
+  // "b" completes while "abc" is still partially matched
+  auto delimiters = std::vector<std::string>{"b", "abc"};
+  auto host_input = std::string("xabdabcb");
+
+  auto expected = strings_column_wrapper{"xab", "dab", "c", "b", ""};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, EmptyDelimiters)
+{
+  auto source = cudf::io::text::make_source(std::string("abc"));
+
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{"a", ""}),
+               cudf::logic_error);
+}
+
+TEST_F(MultibyteSplitTest, OffsetsOnly)
+{
+  auto delimiters = std::vector<std::string>{".."};
+  auto host_input = std::string("abc..def..ghi..jkl..");
+
+  auto source = cudf::io::text::make_source(host_input);
+
+  auto out = cudf::io::text::multibyte_split_offsets(*source, delimiters);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int64_t>{0, 5, 10, 15, 20, 20}, *out);
+
+  auto out_range = cudf::io::text::multibyte_split_offsets(
+    *source, delimiters, cudf::io::text::byte_range_info{2, 9});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<int64_t>{5, 10, 15}, *out_range);
+}
+
+TEST_F(MultibyteSplitTest, GzipFileSource)
+{
+  // two concatenated gzip members holding "abc\ndef\nghi\n" and "jkl\nmno"
+  std::vector<unsigned char> const compressed{
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x4b, 0x4c, 0x4a, 0xe6, 0x4a,
+    0x49, 0x4d, 0xe3, 0x4a, 0xcf, 0xc8, 0xe4, 0x02, 0x00, 0x2b, 0xa9, 0x89, 0xc2, 0x0c, 0x00,
+    0x00, 0x00, 0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcb, 0xca, 0xce,
+    0xe1, 0xca, 0xcd, 0xcb, 0x07, 0x00, 0xf7, 0x2b, 0x9a, 0x85, 0x07, 0x00, 0x00, 0x00};
+
+  auto const filepath = temp_env->get_temp_filepath("GzipFileSource.txt.gz");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+    outfile.write(reinterpret_cast<char const*>(compressed.data()), compressed.size());
+  }
+
+  auto expected = strings_column_wrapper{"abc\n", "def\n", "ghi\n", "jkl\n", "mno"};
+
+  auto source = cudf::io::text::make_source_from_file(filepath, cudf::io::compression_type::GZIP);
+  auto out    = cudf::io::text::multibyte_split(*source, std::string("\n"));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+
+  auto expected_range = strings_column_wrapper{"def\n", "ghi\n", "jkl\n"};
+  auto out_range      = cudf::io::text::multibyte_split(
+    *source, std::string("\n"), cudf::io::text::byte_range_info{4, 10});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_range, *out_range);
+}
+
 TEST_F(MultibyteSplitTest, LargeInput)
 {
   auto host_input    = std::string();
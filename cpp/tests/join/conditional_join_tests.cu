@@ -494,6 +494,30 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestSkewedMatchesAcrossTiles)
+{
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, col_ref_0, col_ref_1);
+
+  // The first left row matches every right row, the others only a few of them
+  std::vector<TypeParam> left(40, 99);
+  left[0] = 0;
+  std::vector<TypeParam> right(300);
+  for (std::size_t i = 0; i < right.size(); ++i) {
+    right[i] = static_cast<TypeParam>(i % 100);
+  }
+
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected;
+  for (cudf::size_type l = 0; l < static_cast<cudf::size_type>(left.size()); ++l) {
+    for (cudf::size_type r = 0; r < static_cast<cudf::size_type>(right.size()); ++r) {
+      if (left[l] <= right[r]) { expected.push_back({l, r}); }
+    }
+  }
+
+  this->test({left}, {right}, expression, expected);
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -14,9 +14,13 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
@@ -26,6 +30,10 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
+
 template <typename T, typename SourceT = T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T, SourceT>;
 
@@ -142,3 +150,105 @@ TEST_F(CrossJoinEmptyResult, NoRows)
   EXPECT_EQ(join_table_reverse->num_columns(), table_a.num_columns() + table_b.num_columns());
   EXPECT_EQ(join_table_reverse->num_rows(), 0);
 }
+
+class ChunkedCrossJoin : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+// Collects the chunks of a chunked cross join, checking their size, and concatenates them
+struct chunk_collector {
+  cudf::size_type max_chunk_rows;
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+
+  cudf::cross_join_callback callback()
+  {
+    return [this](std::unique_ptr<cudf::table> chunk) {
+      EXPECT_GT(chunk->num_rows(), 0);
+      EXPECT_LE(chunk->num_rows(), max_chunk_rows);
+      chunks.push_back(std::move(chunk));
+    };
+  }
+
+  std::unique_ptr<cudf::table> concatenated() const
+  {
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk->view());
+    }
+    return cudf::concatenate(views);
+  }
+};
+
+}  // namespace
+
+TEST_F(ChunkedCrossJoin, MatchesCrossJoin)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto a_0            = column_wrapper<int32_t>(sequence, sequence + 7);
+  auto a_1            = cudf::test::strings_column_wrapper({"a", "b", "c", "d", "e", "f", "g"},
+                                                {true, false, true, true, true, true, false});
+  auto b_0            = column_wrapper<float>({5.0, .7, .6, .5, .4});
+
+  auto table_a  = cudf::table_view{{a_0, a_1}};
+  auto table_b  = cudf::table_view{{b_0}};
+  auto expected = cudf::cross_join(table_a, table_b);
+
+  for (cudf::size_type const max_chunk_rows : {1, 3, 5, 12, 35, 100}) {
+    chunk_collector collector{max_chunk_rows};
+    cudf::chunked_cross_join(table_a, table_b, max_chunk_rows, collector.callback());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), collector.concatenated()->view());
+  }
+}
+
+TEST_F(ChunkedCrossJoin, Filtered)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto a_0            = column_wrapper<int32_t>(sequence, sequence + 20);
+  auto a_1            = column_wrapper<int64_t>(sequence, sequence + 20);
+  auto b_0            = column_wrapper<int32_t>({3, 11, 0, 19, 7, 7, 25});
+
+  auto table_a = cudf::table_view{{a_0, a_1}};
+  auto table_b = cudf::table_view{{b_0}};
+
+  auto const left_ref  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const right_ref = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const predicate = cudf::ast::operation(cudf::ast::ast_operator::LESS, left_ref, right_ref);
+
+  auto const [left_indices, right_indices] =
+    cudf::conditional_inner_join(table_a, table_b, predicate);
+  auto const left_map  = cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                          static_cast<cudf::size_type>(left_indices->size()),
+                                          left_indices->data()};
+  auto const right_map = cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                                           static_cast<cudf::size_type>(right_indices->size()),
+                                           right_indices->data()};
+  auto left_rows       = cudf::gather(table_a, left_map)->release();
+  auto right_rows      = cudf::gather(table_b, right_map)->release();
+  std::move(right_rows.begin(), right_rows.end(), std::back_inserter(left_rows));
+  auto const expected = cudf::table(std::move(left_rows));
+
+  for (cudf::size_type const max_chunk_rows : {1, 4, 7, 30, 1000}) {
+    chunk_collector collector{max_chunk_rows};
+    cudf::chunked_cross_join(table_a, table_b, predicate, max_chunk_rows, collector.callback());
+    // the order of the matching pairs is unspecified
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::sort(expected.view()),
+                                  *cudf::sort(collector.concatenated()->view()));
+  }
+}
+
+TEST_F(ChunkedCrossJoin, EmptyAndInvalid)
+{
+  auto a_0 = column_wrapper<int32_t>{};
+  auto b_0 = column_wrapper<int32_t>{1, 2, 3};
+
+  auto table_a = cudf::table_view{{a_0}};
+  auto table_b = cudf::table_view{{b_0}};
+
+  auto const fail = [](std::unique_ptr<cudf::table>) { FAIL() << "unexpected chunk"; };
+  cudf::chunked_cross_join(table_a, table_b, 10, fail);
+  cudf::chunked_cross_join(table_b, table_a, 10, fail);
+
+  EXPECT_THROW(cudf::chunked_cross_join(table_b, table_b, 0, fail), cudf::logic_error);
+  EXPECT_THROW(cudf::chunked_cross_join(table_b, cudf::table_view{}, 10, fail), cudf::logic_error);
+}
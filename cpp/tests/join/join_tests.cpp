@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/dictionary/encode.hpp>
@@ -37,7 +38,10 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
 #include <limits>
+#include <thread>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -754,6 +758,146 @@ TEST_F(JoinTest, InnerJoinNoNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, PartitionedInnerJoin)
+{
+  auto sorted_pairs = [](auto const& result) {
+    using indices_span   = cudf::device_span<cudf::size_type const>;
+    auto const left_col  = cudf::column_view{indices_span{*result.first}};
+    auto const right_col = cudf::column_view{indices_span{*result.second}};
+    auto const pairs     = cudf::table_view{{left_col, right_col}};
+    return cudf::gather(pairs, *cudf::sorted_order(pairs));
+  };
+
+  column_wrapper<int32_t> col0_0({3, 1, 2, 0, 2, 5, 7, 3, 1, 0, 4, 2},
+                                 cudf::test::iterators::nulls_at({3, 9}));
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0", "s2", "s7", "s1", "s1", "s4", "s3", "s0"});
+  column_wrapper<int32_t> col1_0({2, 2, 0, 4, 3, 1, 3, 5, 0, 2},
+                                 cudf::test::iterators::nulls_at({2}));
+  strcol_wrapper col1_1({"s1", "s0", "s4", "s2", "s1", "s1", "s1", "s2", "s4", "s0"});
+
+  auto const left  = cudf::table_view{{col0_0, col0_1}};
+  auto const right = cudf::table_view{{col1_0, col1_1}};
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = sorted_pairs(cudf::inner_join(left, right, compare_nulls));
+    for (cudf::size_type num_partitions : {1, 3, 16}) {
+      auto const result =
+        sorted_pairs(cudf::partitioned_inner_join(left, right, num_partitions, compare_nulls));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(*expected, *result);
+    }
+  }
+
+  // the callback receives the matches of each partition separately
+  std::size_t num_matches = 0;
+  cudf::partitioned_inner_join(left, right, 4, [&](auto left_indices, auto right_indices) {
+    EXPECT_EQ(left_indices->size(), right_indices->size());
+    num_matches += left_indices->size();
+  });
+  EXPECT_EQ(num_matches, cudf::inner_join(left, right).first->size());
+}
+
+TEST_F(JoinTest, SortMergeInnerJoin)
+{
+  column_wrapper<int32_t> col0_0({0, 0, 1, 1, 3, 3, 5}, cudf::test::iterators::nulls_at({0}));
+  strcol_wrapper col0_1({"s0", "s0", "s1", "s2", "s0", "s3", "s1"});
+  column_wrapper<int32_t> col1_0({0, 1, 1, 1, 3, 4}, cudf::test::iterators::nulls_at({0}));
+  strcol_wrapper col1_1({"s0", "s1", "s1", "s2", "s3", "s0"});
+
+  auto const left  = cudf::table_view{{col0_0, col0_1}};
+  auto const right = cudf::table_view{{col1_0, col1_1}};
+
+  using indices_span = cudf::device_span<cudf::size_type const>;
+  {
+    auto const [left_indices, right_indices] = cudf::sort_merge_inner_join(left, right);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 2, 2, 3, 5},
+                                   cudf::column_view{indices_span{*left_indices}});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 1, 2, 3, 4},
+                                   cudf::column_view{indices_span{*right_indices}});
+  }
+  {
+    auto const [left_indices, right_indices] =
+      cudf::sort_merge_inner_join(left, right, {}, {}, cudf::null_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{2, 2, 3, 5},
+                                   cudf::column_view{indices_span{*left_indices}});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{1, 2, 3, 4},
+                                   cudf::column_view{indices_span{*right_indices}});
+  }
+}
+
+TEST_F(JoinTest, SortMergeLeftJoin)
+{
+  column_wrapper<int32_t> col0_0{{5, 3, 3, 1, 0}};
+  column_wrapper<int32_t> col1_0{{4, 3, 1, 1}};
+
+  auto const left       = cudf::table_view{{col0_0}};
+  auto const right      = cudf::table_view{{col1_0}};
+  auto const descending = std::vector<cudf::order>{cudf::order::DESCENDING};
+
+  using indices_span = cudf::device_span<cudf::size_type const>;
+  auto const [left_indices, right_indices] = cudf::sort_merge_left_join(left, right, descending);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 1, 2, 3, 3, 4},
+                                 cudf::column_view{indices_span{*left_indices}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{NoneValue, 1, 1, 2, 3, NoneValue},
+                                 cudf::column_view{indices_span{*right_indices}});
+
+  // the inputs must be sorted in the given order
+  EXPECT_THROW(cudf::sort_merge_left_join(left, right), cudf::logic_error);
+}
+
+TEST_F(JoinTest, IntervalInnerJoin)
+{
+  column_wrapper<int32_t> col0_0{{0, 0, 1, 1, 0, 1}};
+  column_wrapper<int32_t> points({1, 5, 2, 3, 3, 0}, cudf::test::iterators::nulls_at({5}));
+  column_wrapper<int32_t> col1_0{{0, 1, 1, 0}};
+  column_wrapper<int32_t> starts({0, 2, 4, 0}, cudf::test::iterators::nulls_at({3}));
+  column_wrapper<int32_t> ends{{4, 3, 1, 9}};
+
+  using indices_span = cudf::device_span<cudf::size_type const>;
+  {
+    auto const [left_indices, right_indices] = cudf::interval_inner_join(
+      cudf::table_view{{col0_0}}, points, cudf::table_view{{col1_0}}, starts, ends);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 4, 2, 3},
+                                   cudf::column_view{indices_span{*left_indices}});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 0, 1, 1},
+                                   cudf::column_view{indices_span{*right_indices}});
+  }
+  {
+    // without equality keys, every point within an interval matches it
+    auto const [left_indices, right_indices] =
+      cudf::interval_inner_join(cudf::table_view{}, points, cudf::table_view{}, starts, ends);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 2, 3, 4, 2, 3, 4},
+                                   cudf::column_view{indices_span{*left_indices}});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<int32_t>{0, 0, 0, 0, 1, 1, 1},
+                                   cudf::column_view{indices_span{*right_indices}});
+  }
+}
+
+TEST_F(JoinTest, BloomFilter)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}, {1, 1, 1, 0, 1}};
+  strcol_wrapper col0_1({"s1", "s1", "s0", "s4", "s0"});
+
+  auto const build = cudf::table_view{{col0_0, col0_1}};
+  cudf::bloom_filter filter(build, cudf::null_equality::UNEQUAL);
+
+  // a Bloom filter has no false negatives, and rows with nulls never match when nulls are unequal
+  auto const expected = column_wrapper<bool>{true, true, true, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *filter.contains(build));
+
+  // a filter rebuilt from the bits of another one answers the same
+  cudf::bloom_filter copy(rmm::device_buffer(filter.data(), cudf::default_stream_value),
+                          cudf::null_equality::UNEQUAL);
+  EXPECT_EQ(filter.num_blocks(), copy.num_blocks());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *copy.contains(build));
+
+  cudf::bloom_filter equal_nulls(build);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(column_wrapper<bool>{true, true, true, true, true},
+                                 *equal_nulls.contains(build));
+
+  EXPECT_THROW(filter.contains(cudf::table_view{{col0_0}}), cudf::logic_error);
+  EXPECT_THROW(cudf::bloom_filter(build, cudf::null_equality::EQUAL, 0.0), cudf::logic_error);
+}
+
 TEST_F(JoinTest, InnerJoinWithNulls)
 {
   column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 2}};
@@ -1509,6 +1653,219 @@ TEST_F(JoinTest, HashJoinLargeOutputSize)
   EXPECT_EQ(col_size * col_size, output_size);
 }
 
+TEST_F(JoinTest, HashJoinConcurrentProbes)
+{
+  constexpr int num_threads          = 8;
+  constexpr cudf::size_type num_rows = 10'000;
+
+  auto build_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 2; });
+  column_wrapper<int32_t> build(build_keys, build_keys + num_rows);
+  cudf::hash_join hash_join(cudf::table_view{{build}}, cudf::null_equality::EQUAL);
+
+  // every thread probes the shared hash join with its own keys on its own stream
+  CVector probes;
+  for (int t = 0; t < num_threads; t++) {
+    auto keys = cudf::detail::make_counting_transform_iterator(
+      0, [t](auto i) { return (i * num_threads + t) % num_rows; });
+    probes.push_back(column_wrapper<int32_t>(keys, keys + num_rows).release());
+  }
+
+  using join_result = decltype(hash_join.inner_join(cudf::table_view{}));
+  std::vector<join_result> inner_results(num_threads);
+  std::vector<join_result> left_results(num_threads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.emplace_back([&, t]() {
+      rmm::cuda_stream stream;
+      auto const probe = cudf::table_view{{probes[t]->view()}};
+      inner_results[t] = hash_join.inner_join(probe, std::nullopt, stream.view());
+      left_results[t]  = hash_join.left_join(probe, std::nullopt, stream.view());
+      stream.synchronize();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto const as_column = [](auto const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices->size()),
+                             indices->data()};
+  };
+  for (int t = 0; t < num_threads; t++) {
+    auto const probe = cudf::table_view{{probes[t]->view()}};
+    auto const inner = hash_join.inner_join(probe);
+    auto const left  = hash_join.left_join(probe);
+    auto const [inner_gold, inner_test] =
+      gather_maps_as_tables(as_column(inner.first), as_column(inner.second), inner_results[t]);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*inner_gold, *inner_test);
+    auto const [left_gold, left_test] =
+      gather_maps_as_tables(as_column(left.first), as_column(left.second), left_results[t]);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*left_gold, *left_test);
+  }
+}
+
+TEST_F(JoinTest, HashJoinPacked)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 3}};
+  strcol_wrapper col0_1({"s0", "s1", "s2", "s4", "s1"});
+
+  column_wrapper<int32_t> col1_0{{2, 2, 0, 4, 3}};
+  strcol_wrapper col1_1({"s1", "s0", "s1", "s2", "s1"}, {1, 0, 1, 1, 1});
+
+  auto const probe = cudf::table_view{{col0_0, col0_1}};
+  auto const build = cudf::table_view{{col1_0, col1_1}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::UNEQUAL);
+  auto const packed = hash_join.pack();
+  cudf::hash_join unpacked_join(packed, cudf::null_equality::UNEQUAL);
+
+  {
+    auto result = unpacked_join.inner_join(probe);
+    column_wrapper<int32_t> col_gold_0{{4}};
+    column_wrapper<int32_t> col_gold_1{{4}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto result = unpacked_join.full_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 1, 2, 3, 4, NoneValue, NoneValue, NoneValue, NoneValue}};
+    column_wrapper<int32_t> col_gold_1{{NoneValue, NoneValue, NoneValue, NoneValue, 4, 0, 1, 2, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  // a table packed by cudf::pack has no row hashes
+  auto const not_a_hash_join = cudf::pack(build);
+  EXPECT_THROW(cudf::hash_join(not_a_hash_join, cudf::null_equality::UNEQUAL), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinEstimatedOutputSize)
+{
+  // large enough for the output size to be estimated from a sample of the probe rows
+  constexpr cudf::size_type probe_size = 100'000;
+  auto const as_column                 = [](auto const& indices) {
+    return cudf::column_view{cudf::data_type{cudf::type_id::INT32},
+                             static_cast<cudf::size_type>(indices->size()),
+                             indices->data()};
+  };
+
+  column_wrapper<int32_t> build{{0, 1, 1, 2, 3, 3, 3, 4}};
+  cudf::hash_join hash_join(cudf::table_view{{build}}, cudf::null_equality::EQUAL);
+
+  // keys spread evenly over the probe rows are estimated well by sampling
+  auto even_keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int32_t> even_probe(even_keys, even_keys + probe_size);
+  // matches only on rows a strided sample can miss make the estimate too small
+  auto skewed_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 6 == 1 ? 3 : -1; });
+  column_wrapper<int32_t> skewed_probe(skewed_keys, skewed_keys + probe_size);
+
+  for (auto const& probe : {cudf::table_view{{even_probe}}, cudf::table_view{{skewed_probe}}}) {
+    auto const inner_size   = hash_join.inner_join_size(probe);
+    auto const inner        = hash_join.inner_join(probe);
+    auto const exact_inner  = hash_join.inner_join(probe, inner_size);
+    auto const [gold, test] = gather_maps_as_tables(
+      as_column(exact_inner.first), as_column(exact_inner.second), inner);
+    EXPECT_EQ(inner_size, inner.first->size());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*gold, *test);
+
+    auto const left_size              = hash_join.left_join_size(probe);
+    auto const left                   = hash_join.left_join(probe);
+    auto const exact_left             = hash_join.left_join(probe, left_size);
+    auto const [left_gold, left_test] = gather_maps_as_tables(
+      as_column(exact_left.first), as_column(exact_left.second), left);
+    EXPECT_EQ(left_size, left.first->size());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*left_gold, *left_test);
+    EXPECT_EQ(inner.first->capacity(), inner.first->size());
+    EXPECT_EQ(left.first->capacity(), left.first->size());
+  }
+
+  // a heavy key on exactly the sampled rows makes the sampled estimate far too large
+  auto heavy_keys = cudf::detail::make_counting_transform_iterator(0, [](auto) { return 5; });
+  column_wrapper<int32_t> heavy_build(heavy_keys, heavy_keys + 100);
+  cudf::hash_join heavy_hash_join(cudf::table_view{{heavy_build}}, cudf::null_equality::EQUAL);
+  auto sampled_keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 6 == 0 ? 5 : -1; });
+  column_wrapper<int32_t> sampled_probe(sampled_keys, sampled_keys + probe_size);
+  auto const probe      = cudf::table_view{{sampled_probe}};
+  auto const inner_size = heavy_hash_join.inner_join_size(probe);
+  auto const inner      = heavy_hash_join.inner_join(probe);
+  EXPECT_EQ(inner_size, inner.first->size());
+  EXPECT_EQ(inner.first->capacity(), inner.first->size());
+  auto const left_size = heavy_hash_join.left_join_size(probe);
+  auto const left      = heavy_hash_join.left_join(probe);
+  EXPECT_EQ(left_size, left.first->size());
+  EXPECT_EQ(left.first->capacity(), left.first->size());
+}
+
+TEST_F(JoinTest, HashJoinWithListsAndNulls)
+{
+  using lists_wrapper = cudf::test::lists_column_wrapper<int32_t>;
+  using cudf::test::iterators::null_at;
+
+  lists_wrapper col0_0{{{1, 2}, {3}, {}, {5}, {}}, null_at(4)};
+  column_wrapper<int32_t> col0_1{{0, 1, 2, 3, 4}};
+
+  lists_wrapper col1_0{{{3}, {1, 2}, {1, 2}, {}, {2, 1}}, null_at(3)};
+  column_wrapper<int32_t> col1_1{{1, 0, 0, 4, 0}};
+
+  auto const probe = cudf::table_view{{col0_0, col0_1}};
+  auto const build = cudf::table_view{{col1_0, col1_1}};
+
+  cudf::hash_join hash_join(build, cudf::null_equality::EQUAL);
+
+  {
+    auto output_size = hash_join.inner_join_size(probe);
+    EXPECT_EQ(4, output_size);
+    auto result = hash_join.inner_join(probe, output_size);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 1, 4}};
+    column_wrapper<int32_t> col_gold_1{{1, 2, 0, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto output_size = hash_join.left_join_size(probe);
+    EXPECT_EQ(6, output_size);
+    auto result = hash_join.left_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 1, 2, 3, 4}};
+    column_wrapper<int32_t> col_gold_1{{1, 2, 0, NoneValue, NoneValue, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    auto output_size = hash_join.full_join_size(probe);
+    EXPECT_EQ(7, output_size);
+    auto result = hash_join.full_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 1, 2, 3, 4, NoneValue}};
+    column_wrapper<int32_t> col_gold_1{{1, 2, 0, NoneValue, NoneValue, 3, 4}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    // the row hashes of list keys survive packing
+    cudf::hash_join unpacked_join(hash_join.pack(), cudf::null_equality::EQUAL);
+    auto result = unpacked_join.inner_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 1, 4}};
+    column_wrapper<int32_t> col_gold_1{{1, 2, 0, 3}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+
+  {
+    cudf::hash_join unequal_join(build, cudf::null_equality::UNEQUAL);
+    auto result = unequal_join.inner_join(probe);
+    column_wrapper<int32_t> col_gold_0{{0, 0, 1}};
+    column_wrapper<int32_t> col_gold_1{{1, 2, 0}};
+    auto const [sorted_gold, sorted_result] = gather_maps_as_tables(col_gold_0, col_gold_1, result);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+  }
+}
+
 struct JoinDictionaryTest : public cudf::test::BaseFixture {
 };
 
@@ -542,6 +542,84 @@ TYPED_TEST(MixedLeftJoinTest, Basic2)
              {{0, JoinNoneValue}, {1, JoinNoneValue}, {2, JoinNoneValue}, {3, 3}});
 }
 
+/**
+ * Tests of mixed inner joins evaluating the predicate with a JIT-compiled kernel, which must
+ * produce the same pairs as the interpreted mixed inner join.
+ */
+template <typename T>
+struct JitMixedInnerJoinTest : public MixedInnerJoinTest<T> {
+  PairJoinReturn join(cudf::table_view left_equality,
+                      cudf::table_view right_equality,
+                      cudf::table_view left_conditional,
+                      cudf::table_view right_conditional,
+                      cudf::ast::operation predicate,
+                      cudf::null_equality compare_nulls = cudf::null_equality::EQUAL) override
+  {
+    return cudf::jit_mixed_inner_join(
+      left_equality, right_equality, left_conditional, right_conditional, predicate, compare_nulls);
+  }
+};
+
+TYPED_TEST_SUITE(JitMixedInnerJoinTest, cudf::test::IntegralTypesNotBool);
+
+TYPED_TEST(JitMixedInnerJoinTest, BasicNullEqualityUnequal)
+{
+  this->test_nulls({{{0, 1, 2}, {1, 1, 0}}, {{3, 4, 5}, {1, 1, 1}}, {{10, 20, 30}, {1, 1, 1}}},
+                   {{{0, 1, 3}, {1, 1, 0}}, {{5, 4, 5}, {1, 1, 1}}, {{30, 40, 30}, {1, 1, 1}}},
+                   {0},
+                   {1, 2},
+                   left_zero_eq_right_zero,
+                   {0, 1, 0},
+                   {{1, 1}},
+                   cudf::null_equality::UNEQUAL);
+};
+
+TYPED_TEST(JitMixedInnerJoinTest, BasicInequality)
+{
+  auto const col_ref_left_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::LEFT);
+  auto const col_ref_right_1 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto const col_ref_right_2 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+
+  auto scalar_1        = cudf::numeric_scalar<TypeParam>(35);
+  auto const literal_1 = cudf::ast::literal(scalar_1);
+
+  auto const op1 =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_1, col_ref_right_1);
+  auto const op2 = cudf::ast::operation(cudf::ast::ast_operator::LESS, literal_1, col_ref_right_2);
+
+  auto const predicate = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, op1, op2);
+
+  this->test({{0, 1, 2, 4}, {3, 4, 5, 6}, {10, 20, 30, 40}},
+             {{0, 1, 3, 4}, {5, 4, 5, 7}, {30, 40, 50, 60}},
+             {0},
+             {1, 2},
+             predicate,
+             {0, 0, 0, 1},
+             {{3, 3}});
+}
+
+TYPED_TEST(JitMixedInnerJoinTest, NullLogicalOr)
+{
+  auto const col_ref_left_1  = cudf::ast::column_reference(1, cudf::ast::table_reference::LEFT);
+  auto const col_ref_right_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+
+  auto const op1 =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_1, col_ref_right_1);
+  auto const op2 =
+    cudf::ast::operation(cudf::ast::ast_operator::NOT_EQUAL, col_ref_left_0, col_ref_right_1);
+
+  // a null comparison does not discard the pair when the other comparison is true
+  auto const predicate = cudf::ast::operation(cudf::ast::ast_operator::NULL_LOGICAL_OR, op1, op2);
+
+  this->test_nulls({{{0, 1, 2}, {1, 1, 1}}, {{3, 4, 5}, {1, 0, 1}}},
+                   {{{0, 1, 2}, {1, 1, 1}}, {{3, 5, 2}, {1, 1, 1}}},
+                   {0},
+                   {0, 1},
+                   predicate,
+                   {1, 1, 0},
+                   {{0, 0}, {1, 1}});
+}
+
 /**
  * Tests of mixed full joins.
  */
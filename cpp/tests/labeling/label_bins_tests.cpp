@@ -435,6 +435,97 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+/*
+ * Uniform bins tests.
+ */
+
+TEST(UniformBinErrorTests, TestInvalidBins)
+{
+  fwc_wrapper<double> input{0.5, 1.5};
+
+  EXPECT_THROW(cudf::label_bins(input, 0., 2., 0), cudf::logic_error);
+  EXPECT_THROW(cudf::label_bins(input, 2., 2., 4), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, 2., 0., 4), cudf::logic_error);
+}
+
+TEST(UniformBinErrorTests, TestInvalidGroupLabels)
+{
+  fwc_wrapper<double> input{0.5, 1.5};
+
+  EXPECT_THROW(cudf::histogram(input, fwc_wrapper<int64_t>{0, 1}, 2, 0., 2., 2), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, fwc_wrapper<int32_t>{0}, 2, 0., 2., 2), cudf::logic_error);
+  EXPECT_THROW(cudf::histogram(input, fwc_wrapper<int32_t>{{0, 1}, {1, 0}}, 2, 0., 2., 2),
+               cudf::logic_error);
+}
+
+template <typename T>
+struct UniformBinTestFixture : public BinTestFixture {
+};
+
+TYPED_TEST_SUITE(UniformBinTestFixture, NumericTypesNotBool);
+
+TYPED_TEST(UniformBinTestFixture, TestLabels)
+{
+  using T = TypeParam;
+  fwc_wrapper<T> input{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, {1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}};
+
+  auto result = cudf::label_bins(input, 2., 8., 3);
+
+  // the last bin includes the upper edge
+  fwc_wrapper<cudf::size_type> expected{{0, 0, 0, 0, 0, 1, 2, 2, 2, 0, 0},
+                                        {0, 0, 1, 1, 0, 1, 1, 1, 1, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TYPED_TEST(UniformBinTestFixture, TestHistogram)
+{
+  using T = TypeParam;
+  fwc_wrapper<T> input{{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}, {1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}};
+
+  auto result = cudf::histogram(input, 2., 8., 3);
+
+  fwc_wrapper<int64_t> expected{2, 1, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TYPED_TEST(UniformBinTestFixture, TestGroupedHistogram)
+{
+  using T   = TypeParam;
+  using LCW = cudf::test::lists_column_wrapper<int64_t>;
+  fwc_wrapper<T> input{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  fwc_wrapper<cudf::size_type> group_labels{0, 2, 0, 2, 0, 2, 0, 2, 0, 5};
+
+  auto result = cudf::histogram(input, group_labels, 3, 0., 10., 2);
+
+  LCW expected{{3, 2}, {0, 0}, {2, 2}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST(UniformBinTests, TestNaN)
+{
+  fwc_wrapper<double> input{0.5, std::numeric_limits<double>::quiet_NaN(), 1.5};
+
+  auto result = cudf::label_bins(input, 0., 2., 2);
+
+  fwc_wrapper<cudf::size_type> expected{{0, 0, 1}, {1, 0, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+TEST(UniformBinTests, TestManyBinsHistogram)
+{
+  // more counters than fit in shared memory
+  auto const num_bins = 10000;
+  std::vector<double> values(2 * num_bins);
+  std::iota(values.begin(), values.end(), 0.);
+  fwc_wrapper<double> input(values.begin(), values.end());
+
+  auto result = cudf::histogram(input, 0., 2. * num_bins, num_bins);
+
+  std::vector<int64_t> expected_counts(num_bins, 2);
+  fwc_wrapper<int64_t> expected(expected_counts.begin(), expected_counts.end());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
@@ -28,6 +28,8 @@
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace test {
 
@@ -487,6 +489,81 @@ TYPED_TEST(TypedContainsTest, ScalarNullSearchKey)
   }
 }
 
+TYPED_TEST(TypedContainsTest, SortedScalarKey)
+{
+  using T = TypeParam;
+
+  auto search_key_one = create_scalar_search_key<T>(1);
+  {
+    // Ascending, nulls first: [ [x,1,1,2], [0,3], [], [1], [x,x,4] ]
+    auto numerals     = fixed_width_column_wrapper<T>{{x, 1, 1, 2, 0, 3, 1, x, x, 4},
+                                                  nulls_at({0, 7, 8})};
+    auto search_space = make_lists_column(
+      5, indices{0, 4, 6, 6, 7, 10}.release(), numerals.release(), 0, {});
+
+    auto contains = lists::contains(
+      search_space->view(), *search_key_one, order::ASCENDING, null_order::BEFORE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(bools{1, 0, 0, 1, 0}, *contains);
+    auto first = lists::index_of(
+      search_space->view(), *search_key_one, FIND_FIRST, order::ASCENDING, null_order::BEFORE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices{1, absent, absent, 0, absent}, *first);
+    auto last = lists::index_of(
+      search_space->view(), *search_key_one, FIND_LAST, order::ASCENDING, null_order::BEFORE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices{2, absent, absent, 0, absent}, *last);
+  }
+  {
+    // Descending, nulls last: [ [2,1,1,x], [3,0], [], [1], [4,x,x] ]
+    auto numerals     = fixed_width_column_wrapper<T>{{2, 1, 1, x, 3, 0, 1, 4, x, x},
+                                                  nulls_at({3, 8, 9})};
+    auto search_space = make_lists_column(
+      5, indices{0, 4, 6, 6, 7, 10}.release(), numerals.release(), 0, {});
+
+    auto first = lists::index_of(
+      search_space->view(), *search_key_one, FIND_FIRST, order::DESCENDING, null_order::BEFORE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices{1, absent, absent, 0, absent}, *first);
+    auto last = lists::index_of(
+      search_space->view(), *search_key_one, FIND_LAST, order::DESCENDING, null_order::BEFORE);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices{2, absent, absent, 0, absent}, *last);
+  }
+}
+
+TEST_F(ContainsTest, SortedLongLists)
+{
+  // Long lists are searched by a warp per list: list `i` holds [0,0,2,2,4,4,...,98,98] and is
+  // searched for `i`, found at `i` and `i + 1` when `i` is even.
+  auto constexpr num_lists = 100;
+  auto constexpr list_size = 100;
+
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return ((i % list_size) / 2) * 2; });
+  auto numerals = fixed_width_column_wrapper<int32_t>(values, values + num_lists * list_size);
+  auto const offsets =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * list_size; });
+  auto search_space = make_lists_column(num_lists,
+                                        indices(offsets, offsets + num_lists + 1).release(),
+                                        numerals.release(),
+                                        0,
+                                        {});
+  auto const keys_begin = thrust::make_counting_iterator(0);
+  auto search_keys      = fixed_width_column_wrapper<int32_t>(keys_begin, keys_begin + num_lists);
+
+  auto const first_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? i : absent; });
+  auto const last_begin = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? i + 1 : absent; });
+
+  auto first = lists::index_of(
+    search_space->view(), search_keys, FIND_FIRST, order::ASCENDING, null_order::AFTER);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices(first_begin, first_begin + num_lists), *first);
+  auto last = lists::index_of(
+    search_space->view(), search_keys, FIND_LAST, order::ASCENDING, null_order::AFTER);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(indices(last_begin, last_begin + num_lists), *last);
+  auto contains =
+    lists::contains(search_space->view(), search_keys, order::ASCENDING, null_order::AFTER);
+  auto const linear_contains = lists::contains(search_space->view(), search_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*linear_contains, *contains);
+}
+
 TEST_F(ContainsTest, ScalarTypeRelatedExceptions)
 {
   {
@@ -16,11 +16,14 @@
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/lists/explode.hpp>
+#include <cudf/sorting.hpp>
 
 using namespace cudf::test;
 using FCW = fixed_width_column_wrapper<int32_t>;
@@ -1183,3 +1186,73 @@ TEST_F(ExplodeOuterTest, SlicedList)
   auto pos_ret = cudf::explode_outer_position(sliced_t[0], 0);
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
+
+TEST_F(ExplodeTest, WithParentIndices)
+{
+  constexpr auto null = 0;
+
+  auto valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? true : false; });
+
+  LCW a({LCW{1, 2}, LCW({3, null, 5}, valids), LCW{}, LCW{9}, LCW{}, LCW{6, 7}},
+        iterators::null_at(4));
+
+  auto const sliced = cudf::slice(a, {1, 6}).front();
+  auto [elements, parent_indices] =
+    cudf::explode_with_parent_indices(cudf::lists_column_view{sliced});
+
+  FCW expected_elements({3, null, 5, 9, 6, 7}, iterators::null_at(1));
+  FCW expected_parent_indices{0, 0, 0, 2, 4, 4};
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(elements->view(), expected_elements);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(parent_indices->view(), expected_parent_indices);
+
+  // Gathering the other columns with the parent indices gives the rows of `explode`
+  FCW b{100, 200, 300, 400, 500, 600};
+  auto const sliced_b = cudf::slice(b, {1, 6}).front();
+  auto const gathered = cudf::gather(cudf::table_view({sliced_b}), parent_indices->view());
+  auto const exploded = cudf::explode(cudf::table_view({sliced, sliced_b}), 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exploded->view().column(0), elements->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(exploded->view().column(1), gathered->view().column(0));
+}
+
+TEST_F(ExplodeTest, GroupbyAggregate)
+{
+  constexpr auto null = 0;
+
+  auto valids = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? true : false; });
+
+  FCW keys{1, 2, 1, 3, 2};
+  LCW values({LCW{5, 10, 15}, LCW({20, null}, valids), LCW{30}, LCW{}, LCW{7}},
+             iterators::null_at(4));
+
+  auto [group_keys, results] =
+    cudf::explode_groupby_aggregate(cudf::table_view({keys}),
+                                    cudf::lists_column_view{values},
+                                    {cudf::aggregation::SUM,
+                                     cudf::aggregation::MIN,
+                                     cudf::aggregation::MAX,
+                                     cudf::aggregation::COUNT_VALID,
+                                     cudf::aggregation::COUNT_ALL});
+
+  std::vector<cudf::column_view> result_views;
+  for (auto const& result : results) {
+    result_views.push_back(result->view());
+  }
+  auto const sorted_keys    = cudf::sort(group_keys->view());
+  auto const sorted_results = cudf::sort_by_key(cudf::table_view(result_views), group_keys->view());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_keys->view().column(0), FCW{1, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_results->view().column(0),
+                                 fixed_width_column_wrapper<int64_t>{60, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_results->view().column(1), FCW{5, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_results->view().column(2), FCW{30, 20});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_results->view().column(3), FCW{4, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sorted_results->view().column(4), FCW{4, 2});
+
+  EXPECT_THROW(cudf::explode_groupby_aggregate(cudf::table_view({keys}),
+                                               cudf::lists_column_view{values},
+                                               {cudf::aggregation::MEAN}),
+               cudf::logic_error);
+}
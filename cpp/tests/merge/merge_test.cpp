@@ -27,6 +27,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
@@ -876,6 +877,32 @@ TEST_F(MergeTest, StructsNestedWithNulls)
   // clang-format on
 }
 
+TEST_F(MergeTest, ManyTablesStableWithNulls)
+{
+  using cudf::test::iterators::nulls_at;
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0({1, 3, 5, 0}, nulls_at({3}));
+  cudf::test::strings_column_wrapper values0{"a0", "b0", "c0", "d0"};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{3, 3, 4};
+  cudf::test::strings_column_wrapper values1{"a1", "b1", "c1"};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys2({0, 3, 0}, nulls_at({2}));
+  cudf::test::strings_column_wrapper values2{"a2", "b2", "c2"};
+
+  auto const result = cudf::merge({cudf::table_view{{keys0, values0}},
+                                   cudf::table_view{{keys1, values1}},
+                                   cudf::table_view{{keys2, values2}}},
+                                  {0},
+                                  {cudf::order::ASCENDING},
+                                  {cudf::null_order::AFTER});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_keys({0, 1, 3, 3, 3, 3, 4, 5, 0, 0},
+                                                                nulls_at({8, 9}));
+  cudf::test::strings_column_wrapper expected_values{
+    "a2", "a0", "b0", "a1", "b1", "b2", "c1", "c0", "d0", "c2"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({expected_keys, expected_values}),
+                                result->view());
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {
 };
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
@@ -333,6 +334,13 @@ TYPED_TEST(HashPartitionFixedWidth, LargeInput)
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_IDENTITY);
 }
 
+TYPED_TEST(HashPartitionFixedWidth, ManyPartitions)
+{
+  // more partitions than fit in a single pass of the shared memory histograms
+  run_fixed_width_test<TypeParam>(2, 20000, 8192, cudf::hash_id::HASH_MURMUR3);
+  run_fixed_width_test<TypeParam>(2, 20000, 3000, cudf::hash_id::HASH_MURMUR3, true);
+}
+
 TYPED_TEST(HashPartitionFixedWidth, HasNulls)
 {
   run_fixed_width_test<TypeParam>(10, 1000, 10, cudf::hash_id::HASH_MURMUR3, true);
@@ -360,4 +368,37 @@ TEST_F(HashPartition, FixedPointColumnsToHash)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(first_result->get_column(1).view(), first_input.column(1));
 }
 
+TEST_F(HashPartition, PartitionAndPack)
+{
+  auto const num_rows = 1000;
+  auto const sequence = thrust::make_counting_iterator(0);
+  auto const valids   = thrust::make_transform_iterator(sequence, [](auto i) { return i % 7; });
+  fixed_width_column_wrapper<int32_t> keys(sequence, sequence + num_rows);
+  fixed_width_column_wrapper<double> doubles(sequence, sequence + num_rows, valids);
+  fixed_width_column_wrapper<int8_t> bytes(sequence, sequence + num_rows, valids);
+  auto const strings_data = thrust::make_transform_iterator(
+    sequence, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+  strings_column_wrapper strings(strings_data, strings_data + num_rows, valids);
+
+  auto const columns_to_hash = std::vector<cudf::size_type>({0});
+
+  // fixed-width tables are packed directly, others through contiguous_split
+  for (cudf::size_type const num_partitions : {7, 2000}) {
+    for (auto const& input : {cudf::table_view({keys, doubles, bytes}),
+                              cudf::table_view({keys, doubles, strings})}) {
+      auto const [expected, offsets] = cudf::hash_partition(input, columns_to_hash, num_partitions);
+      auto const packed = cudf::hash_partition_and_pack(input, columns_to_hash, num_partitions);
+      ASSERT_EQ(static_cast<std::size_t>(num_partitions), packed.size());
+
+      auto splits = std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end());
+      auto const expected_partitions = cudf::split(expected->view(), splits);
+      for (cudf::size_type p = 0; p < num_partitions; ++p) {
+        // the order of the rows within a partition is unspecified
+        auto const result = cudf::unpack(packed[p]);
+        CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::sort(expected_partitions[p]), *cudf::sort(result));
+      }
+    }
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
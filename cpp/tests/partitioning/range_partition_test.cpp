@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/partitioning.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+struct RangePartitionTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+/**
+ * @brief Returns the partitions of `partitioned`, each sorted by `key_cols`.
+ */
+std::vector<std::unique_ptr<cudf::table>> sorted_partitions(
+  cudf::table_view const& partitioned,
+  std::vector<cudf::size_type> const& offsets,
+  std::vector<cudf::size_type> const& key_cols,
+  std::vector<cudf::order> const& column_order = {})
+{
+  std::vector<std::unique_ptr<cudf::table>> result;
+  for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+    auto const partition = cudf::slice(partitioned, {offsets[i], offsets[i + 1]}).front();
+    result.push_back(cudf::sort_by_key(partition, partition.select(key_cols), column_order));
+  }
+  return result;
+}
+}  // namespace
+
+TEST_F(RangePartitionTest, Splitters)
+{
+  fixed_width_column_wrapper<int32_t> sample{7, 1, 9, 4, 3, 8, 2, 6};
+
+  auto const result = cudf::range_partition_splitters(cudf::table_view{{sample}}, 4);
+
+  fixed_width_column_wrapper<int32_t> expected{3, 6, 8};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, result->view());
+
+  auto const single = cudf::range_partition_splitters(cudf::table_view{{sample}}, 1);
+  EXPECT_EQ(0, single->num_rows());
+}
+
+TEST_F(RangePartitionTest, WithSplitters)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9, 3, 6, 8};
+  strings_column_wrapper values{"a", "b", "c", "d", "e", "f"};
+  fixed_width_column_wrapper<int32_t> splitters{3, 6};
+
+  auto const [result, offsets] =
+    cudf::range_partition(cudf::table_view{{keys, values}}, {0}, cudf::table_view{{splitters}});
+
+  EXPECT_EQ(offsets, (std::vector<cudf::size_type>{0, 1, 3, 6}));
+
+  auto const partitions = sorted_partitions(result->view(), offsets, {0});
+  fixed_width_column_wrapper<int32_t> keys0{1};
+  strings_column_wrapper values0{"b"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({keys0, values0}), partitions[0]->view());
+  fixed_width_column_wrapper<int32_t> keys1{3, 5};
+  strings_column_wrapper values1{"d", "a"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({keys1, values1}), partitions[1]->view());
+  fixed_width_column_wrapper<int32_t> keys2{6, 8, 9};
+  strings_column_wrapper values2{"e", "f", "c"};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({keys2, values2}), partitions[2]->view());
+}
+
+TEST_F(RangePartitionTest, DescendingWithNulls)
+{
+  using cudf::test::iterators::null_at;
+
+  fixed_width_column_wrapper<int64_t> keys({0, 4, 1, 7}, null_at(0));
+  fixed_width_column_wrapper<int64_t> splitters{5};
+
+  auto const [result, offsets] = cudf::range_partition(cudf::table_view{{keys}},
+                                                       {0},
+                                                       cudf::table_view{{splitters}},
+                                                       {cudf::order::DESCENDING},
+                                                       {cudf::null_order::BEFORE});
+
+  EXPECT_EQ(offsets, (std::vector<cudf::size_type>{0, 1, 4}));
+
+  auto const partitions =
+    sorted_partitions(result->view(), offsets, {0}, {cudf::order::DESCENDING});
+  fixed_width_column_wrapper<int64_t> keys0{7};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{keys0}}, partitions[0]->view());
+  fixed_width_column_wrapper<int64_t> keys1({4, 1, 0}, null_at(2));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{keys1}}, partitions[1]->view());
+}
+
+TEST_F(RangePartitionTest, Sampled)
+{
+  cudf::size_type constexpr num_rows = 1000;
+  auto const keys_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return num_rows - 1 - i; });
+  auto const values_it = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys(keys_it, keys_it + num_rows);
+  fixed_width_column_wrapper<int32_t> values(values_it, values_it + num_rows);
+  auto const input = cudf::table_view{{keys, values}};
+
+  auto const [result, offsets] = cudf::range_partition(input, {0}, 4);
+
+  ASSERT_EQ(offsets.size(), 5u);
+  EXPECT_EQ(offsets.front(), 0);
+  EXPECT_EQ(offsets.back(), num_rows);
+  for (std::size_t i = 0; i + 1 < offsets.size(); ++i) {
+    EXPECT_LT(offsets[i], offsets[i + 1]);
+  }
+
+  // Sorting each partition sorts the whole table
+  auto const partitions = sorted_partitions(result->view(), offsets, {0});
+  std::vector<cudf::table_view> views;
+  for (auto const& partition : partitions) {
+    views.push_back(partition->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(),
+                                cudf::sort_by_key(input, input.select({0}))->view());
+}
+
+TEST_F(RangePartitionTest, EmptyInput)
+{
+  fixed_width_column_wrapper<int32_t> keys{};
+  fixed_width_column_wrapper<int32_t> splitters{3, 6};
+
+  auto const [result, offsets] =
+    cudf::range_partition(cudf::table_view{{keys}}, {0}, cudf::table_view{{splitters}});
+
+  EXPECT_TRUE(offsets.empty());
+  EXPECT_EQ(0, result->num_rows());
+}
+
+TEST_F(RangePartitionTest, Errors)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9};
+  fixed_width_column_wrapper<int64_t> splitters{3};
+  auto const input = cudf::table_view{{keys}};
+
+  EXPECT_THROW(cudf::range_partition(input, {0}, cudf::table_view{{splitters}}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {0}, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::range_partition(input, {1}, 2), std::out_of_range);
+  fixed_width_column_wrapper<int32_t> empty{};
+  EXPECT_THROW(cudf::range_partition_splitters(cudf::table_view{{empty}}, 2), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
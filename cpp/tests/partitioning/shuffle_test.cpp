@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/shuffle.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <utility>
+
+using cudf::test::fixed_width_column_wrapper;
+using cudf::test::strings_column_wrapper;
+
+namespace {
+
+// Exchanges the packed tables between threads of this process, each thread standing for a rank
+class local_exchange {
+ public:
+  explicit local_exchange(int num_ranks)
+    : num_ranks{num_ranks},
+      mailboxes{std::vector<std::vector<cudf::packed_columns>>(num_ranks),
+                std::vector<std::vector<cudf::packed_columns>>(num_ranks)}
+  {
+    for (auto& mailbox : mailboxes) {
+      for (auto& to_rank : mailbox) {
+        to_rank.resize(num_ranks);
+      }
+    }
+  }
+
+  cudf::callback_shuffle_transport transport(int rank)
+  {
+    return cudf::callback_shuffle_transport{
+      rank, num_ranks, [this, rank](auto&& outgoing, rmm::cuda_stream_view) {
+        return exchange(rank, std::move(outgoing));
+      }};
+  }
+
+ private:
+  std::vector<cudf::packed_columns> exchange(int rank, std::vector<cudf::packed_columns>&& outgoing)
+  {
+    std::unique_lock lock{mutex};
+    // A rank enters the next exchange only once all ranks entered this one, so two mailboxes
+    // are enough
+    auto const round = generation;
+    auto& mailbox    = mailboxes[round % 2];
+    for (int r = 0; r < num_ranks; ++r) {
+      mailbox[r][rank] = std::move(outgoing[r]);
+    }
+    if (++arrived == num_ranks) {
+      arrived = 0;
+      ++generation;
+      cv.notify_all();
+    } else {
+      cv.wait(lock, [&] { return generation != round; });
+    }
+    return std::exchange(mailbox[rank], std::vector<cudf::packed_columns>(num_ranks));
+  }
+
+  int const num_ranks;
+  std::mutex mutex;
+  std::condition_variable cv;
+  int arrived         = 0;
+  uint64_t generation = 0;
+  std::vector<std::vector<std::vector<cudf::packed_columns>>> mailboxes;
+};
+
+// Shuffles the parts of a table, one thread per rank, and checks each rank gets the rows of its
+// hash partition of every part
+void shuffle_and_check(std::vector<cudf::table_view> const& parts,
+                       std::vector<cudf::size_type> const& columns_to_hash,
+                       cudf::size_type chunk_rows)
+{
+  auto const num_ranks = static_cast<int>(parts.size());
+  local_exchange exchange{num_ranks};
+  std::vector<std::future<std::unique_ptr<cudf::table>>> results;
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    results.push_back(std::async(std::launch::async, [&, rank] {
+      auto transport = exchange.transport(rank);
+      return cudf::hash_shuffle(parts[rank], columns_to_hash, transport, chunk_rows);
+    }));
+  }
+
+  std::vector<std::vector<cudf::table_view>> expected_parts(num_ranks);
+  std::vector<std::unique_ptr<cudf::table>> partitioned;
+  for (auto const& part : parts) {
+    if (part.num_rows() == 0) { continue; }
+    auto [table, offsets] = cudf::hash_partition(part, columns_to_hash, num_ranks);
+    auto const splits     = std::vector<cudf::size_type>(offsets.begin() + 1, offsets.end());
+    auto const split      = cudf::split(table->view(), splits);
+    for (int rank = 0; rank < num_ranks; ++rank) {
+      expected_parts[rank].push_back(split[rank]);
+    }
+    partitioned.push_back(std::move(table));
+  }
+
+  for (int rank = 0; rank < num_ranks; ++rank) {
+    auto const result   = results[rank].get();
+    auto const expected = cudf::concatenate(expected_parts[rank]);
+    // the order of the rows within a partition is unspecified
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::sort(*expected), *cudf::sort(*result));
+  }
+}
+
+}  // namespace
+
+class HashShuffle : public cudf::test::BaseFixture {
+};
+
+TEST_F(HashShuffle, FixedWidth)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> keys(sequence, sequence + 1000);
+  fixed_width_column_wrapper<double> doubles(sequence, sequence + 1000);
+  auto const input = cudf::table_view{{keys, doubles}};
+  auto const parts = cudf::split(input, {250, 500, 750});
+
+  for (cudf::size_type const chunk_rows : {1, 64, 250, cudf::default_shuffle_chunk_rows}) {
+    shuffle_and_check(parts, {0}, chunk_rows);
+  }
+}
+
+TEST_F(HashShuffle, Strings)
+{
+  auto const sequence     = thrust::make_counting_iterator(0);
+  auto const strings_data = thrust::make_transform_iterator(
+    sequence, [](auto i) { return std::string(i % 5, 'a' + i % 26); });
+  auto const valids =
+    thrust::make_transform_iterator(sequence, [](auto i) { return i % 7 != 0; });
+  fixed_width_column_wrapper<int16_t> keys(sequence, sequence + 300);
+  strings_column_wrapper strings(strings_data, strings_data + 300, valids);
+  auto const input = cudf::table_view{{keys, strings}};
+
+  shuffle_and_check(cudf::split(input, {100, 200}), {0, 1}, 32);
+}
+
+TEST_F(HashShuffle, UnevenParts)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int64_t> keys(sequence, sequence + 500);
+  auto const input = cudf::table_view{{keys}};
+
+  // ranks with fewer chunks send empty partitions until the others are done
+  shuffle_and_check(cudf::split(input, {0, 20, 20}), {0}, 16);
+}
+
+TEST_F(HashShuffle, SingleRank)
+{
+  fixed_width_column_wrapper<int32_t> keys({5, 3, 1, 4, 2});
+  auto const input = cudf::table_view{{keys}};
+  auto transport   = cudf::callback_shuffle_transport{0, 1, [](auto&&, rmm::cuda_stream_view) {
+    return std::vector<cudf::packed_columns>{};
+  }};
+
+  auto const result = cudf::hash_shuffle(input, {0}, transport);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, *result);
+}
+
+TEST_F(HashShuffle, InvalidArguments)
+{
+  fixed_width_column_wrapper<int32_t> keys({1, 2, 3});
+  auto const input = cudf::table_view{{keys}};
+  local_exchange exchange{2};
+  auto transport = exchange.transport(0);
+
+  EXPECT_THROW(cudf::hash_shuffle(input, {0}, transport, 0), cudf::logic_error);
+  EXPECT_THROW(cudf::hash_shuffle(input, {1}, transport), std::out_of_range);
+  EXPECT_THROW(exchange.transport(2), cudf::logic_error);
+}
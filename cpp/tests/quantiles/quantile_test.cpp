@@ -14,8 +14,11 @@
  * limitations under the License.
  */
 
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/quantiles.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -469,6 +472,72 @@ TEST_F(QuantileDictionaryTest, TestValid)
                                       fixed_width_column_wrapper<double>{3.5, 5.5, 7.5});
 };
 
+// quantile_unsorted matches quantile over the sorted order of the valid values
+void expect_unsorted_matches_sorted(cudf::column_view const& input, std::vector<double> const& q)
+{
+  auto const sorted_indices = cudf::sorted_order(
+    cudf::table_view{{input}}, {order::ASCENDING}, {null_order::AFTER});
+  auto const valid_indices =
+    cudf::slice(sorted_indices->view(), {0, input.size() - input.null_count()}).front();
+
+  for (auto const interp : {cudf::interpolation::LINEAR,
+                            cudf::interpolation::LOWER,
+                            cudf::interpolation::HIGHER,
+                            cudf::interpolation::MIDPOINT,
+                            cudf::interpolation::NEAREST}) {
+    for (auto const exact : {true, false}) {
+      auto const expected = cudf::quantile(input, q, interp, valid_indices, exact);
+      auto const actual   = cudf::quantile_unsorted(input, q, interp, exact);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, *actual);
+    }
+  }
+}
+
+template <typename T>
+struct QuantileUnsortedTest : public BaseFixture {
+};
+
+TYPED_TEST_SUITE(QuantileUnsortedTest, TestTypes);
+
+TYPED_TEST(QuantileUnsortedTest, Small)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> input({7, 1, 9, 3, 3, 0, 8, 2, 6, 5},
+                                                       {1, 1, 0, 1, 1, 1, 0, 1, 1, 1});
+  expect_unsorted_matches_sorted(input, {0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0});
+}
+
+TYPED_TEST(QuantileUnsortedTest, AllNull)
+{
+  fixed_width_column_wrapper<TypeParam, int32_t> input({1, 2, 3}, {0, 0, 0});
+  auto const expected = fixed_width_column_wrapper<double>({0, 0}, {0, 0});
+  auto const actual   = cudf::quantile_unsorted(input, {0.5, 0.25});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *actual);
+}
+
+struct QuantileUnsortedLargeTest : public BaseFixture {
+};
+
+// large enough to find the quantiles by sampling rather than by sorting every value
+TEST_F(QuantileUnsortedLargeTest, Integers)
+{
+  constexpr cudf::size_type num_rows = 5'000'000;
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>((i * 7919L) % 1'000'003) - 500'000; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<int64_t> input(values, values + num_rows, valids);
+  expect_unsorted_matches_sorted(input, {0.0, 0.01, 0.3, 0.5, 0.5001, 0.99, 1.0});
+}
+
+TEST_F(QuantileUnsortedLargeTest, Doubles)
+{
+  constexpr cudf::size_type num_rows = 5'000'000;
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 104729L) % 65'521) / 7.0 - 1000.0; });
+  fixed_width_column_wrapper<double> input(values, values + num_rows);
+  expect_unsorted_matches_sorted(input, {0.25, 0.5, 0.75});
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
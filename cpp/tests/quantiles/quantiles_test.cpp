@@ -27,6 +27,7 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/quantiles.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/utilities/error.hpp>
 
 using namespace cudf;
@@ -173,3 +174,26 @@ TYPED_TEST(QuantilesTest, TestMultiColumnAssumedSorted)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
 }
+
+TYPED_TEST(QuantilesTest, TestSingleColumnUnsorted)
+{
+  using T = TypeParam;
+
+  fixed_width_column_wrapper<T, int32_t> input_a(
+    {5, 3, 0, 4, 1, 5, 2, 3, 0, 1, 4, 2}, {1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0});
+  auto input = table_view({input_a});
+
+  std::vector<double> const q{0.0, 0.1, 0.25, 0.5, 0.7, 0.9, 1.0};
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+      auto const sorted_input = sort(input, {column_order}, {null_precedence});
+      for (auto const interp :
+           {interpolation::NEAREST, interpolation::LOWER, interpolation::HIGHER}) {
+        auto const expected = quantiles(sorted_input->view(), q, interp, sorted::YES);
+        auto const actual =
+          quantiles(input, q, interp, sorted::NO, {column_order}, {null_precedence});
+        CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), actual->view());
+      }
+    }
+  }
+}
@@ -20,6 +20,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -295,6 +296,33 @@ TYPED_TEST(SumReductionTest, Sum)
                  .second);
 }
 
+TYPED_TEST(SumReductionTest, SumSlicedWithNulls)
+{
+  using T = TypeParam;
+  std::vector<int> int_values(3000);
+  std::vector<bool> host_bools(3000);
+  for (int i = 0; i < 3000; ++i) {
+    int_values[i] = i % 17 - 8;
+    host_bools[i] = i % 7 != 0;
+  }
+  std::vector<T> v                                    = convert_values<T>(int_values);
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+
+  // The offset of the slice is not a multiple of the bitmask word size
+  auto const sliced = cudf::slice(col_nulls, {13, 2990}).front();
+  auto const r      = replace_nulls(v, host_bools, T{0});
+  T expected_value  = std::accumulate(r.begin() + 13, r.begin() + 2990, T{0});
+
+  EXPECT_EQ(
+    this->template reduction_test<T>(sliced, cudf::make_sum_aggregation<reduce_aggregation>())
+      .first,
+    expected_value);
+  EXPECT_EQ(
+    this->template reduction_test<T>(sliced, cudf::make_min_aggregation<reduce_aggregation>())
+      .first,
+    convert_int<T>(-8));
+}
+
 using ReductionTypes = cudf::test::Types<int16_t, int32_t, float, double>;
 TYPED_TEST_SUITE(ReductionTest, cudf::test::NumericTypes);
 
@@ -627,6 +655,46 @@ TYPED_TEST(MultiStepReductionTest, DISABLED_var_std)
     std_nulls);
 }
 
+#ifdef NDEBUG
+TYPED_TEST(MultiStepReductionTest, FusedMatchesSingle)
+#else
+TYPED_TEST(MultiStepReductionTest, DISABLED_FusedMatchesSingle)
+#endif
+{
+  using T = TypeParam;
+  std::vector<int> int_values({-3, 2, 1, 0, 5, -3, -2, 28});
+  std::vector<bool> host_bools({1, 1, 0, 1, 1, 1, 0, 1});
+
+  std::vector<T> v = convert_values<T>(int_values);
+  cudf::test::fixed_width_column_wrapper<T> col(v.begin(), v.end());
+  cudf::test::fixed_width_column_wrapper<T> col_nulls = construct_null_column(v, host_bools);
+  cudf::test::fixed_width_column_wrapper<T> col_all_nulls =
+    construct_null_column(v, std::vector<bool>(v.size(), false));
+  cudf::table_view const input{{col, col_nulls, col_all_nulls}};
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<reduce_aggregation>(1));
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>(1));
+  aggs.push_back(cudf::make_product_aggregation<reduce_aggregation>());  // not fused
+
+  auto const results = cudf::reduce(input, aggs);
+  ASSERT_EQ(results.size(), static_cast<std::size_t>(input.num_columns()));
+  for (cudf::size_type c = 0; c < input.num_columns(); ++c) {
+    ASSERT_EQ(results[c].size(), aggs.size());
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      auto const output_dtype = cudf::detail::target_type(input.column(c).type(), aggs[i]->kind);
+      auto const expected     = cudf::reduce(input.column(c), aggs[i], output_dtype);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::make_column_from_scalar(*expected, 1),
+                                     *cudf::make_column_from_scalar(*results[c][i], 1));
+    }
+  }
+}
+
 // ----------------------------------------------------------------------------
 
 template <typename T>
@@ -757,3 +757,28 @@ TEST_F(StructScanTest, StructScanMinMaxWithNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
   }
 }
+
+struct ScanIncludeNullsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(ScanIncludeNullsTest, RowsAfterFirstNull)
+{
+  using INTS_CW = cudf::test::fixed_width_column_wrapper<int32_t>;
+  auto const input = INTS_CW{{1, 2, 0 /*NULL*/, 4, 5}, cudf::test::iterators::null_at(2)};
+
+  auto result = cudf::scan(input,
+                           cudf::make_sum_aggregation<scan_aggregation>(),
+                           scan_type::INCLUSIVE,
+                           null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    INTS_CW{{1, 3, 0, 0, 0}, cudf::test::iterators::nulls_at({2, 3, 4})}, result->view());
+  EXPECT_EQ(result->null_count(), 3);
+
+  result = cudf::scan(input,
+                      cudf::make_sum_aggregation<scan_aggregation>(),
+                      scan_type::EXCLUSIVE,
+                      null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    INTS_CW{{0, 1, 3, 0, 0}, cudf::test::iterators::nulls_at({3, 4})}, result->view());
+  EXPECT_EQ(result->null_count(), 2);
+}
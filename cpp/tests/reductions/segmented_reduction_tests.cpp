@@ -25,6 +25,7 @@
 
 #include <thrust/device_vector.h>
 
+#include <cmath>
 #include <limits>
 
 namespace cudf {
@@ -818,6 +819,110 @@ TEST_F(SegmentedReductionTestUntyped, EmptyInputWithOffsets)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect_bool);
 }
 
+TYPED_TEST(SegmentedReductionTest, SumOfSquaresExcludeNulls)
+{
+  // [1, 2, 3], [1, null, 3], [1], [null], [null, null], []
+  auto const input   = fixed_width_column_wrapper<TypeParam>{{1, 2, 3, 1, XXX, 3, 1, XXX, XXX, XXX},
+                                                           {1, 1, 1, 1, 0, 1, 1, 0, 0, 0}};
+  auto const offsets = std::vector<size_type>{0, 3, 6, 7, 8, 10, 10};
+  auto const d_offsets = thrust::device_vector<size_type>(offsets);
+  auto const expect =
+    fixed_width_column_wrapper<TypeParam>{{14, 10, 1, XXX, XXX, XXX}, {1, 1, 1, 0, 0, 0}};
+
+  auto res = segmented_reduce(input,
+                              d_offsets,
+                              *make_sum_of_squares_aggregation<segmented_reduce_aggregation>(),
+                              data_type{type_to_id<TypeParam>()},
+                              null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*res, expect);
+}
+
+TEST_F(SegmentedReductionTestUntyped, MeanVarStd)
+{
+  // [1, 2, 3, 6], [1, null, 3], [4], [null], []
+  auto const input = fixed_width_column_wrapper<int32_t>{{1, 2, 3, 6, 1, XXX, 3, 4, XXX},
+                                                         {1, 1, 1, 1, 1, 0, 1, 1, 0}};
+  auto const offsets   = std::vector<size_type>{0, 4, 7, 8, 9, 9};
+  auto const d_offsets = thrust::device_vector<size_type>(offsets);
+  auto const dtype     = data_type{type_id::FLOAT64};
+
+  auto res = segmented_reduce(input,
+                              d_offsets,
+                              *make_mean_aggregation<segmented_reduce_aggregation>(),
+                              dtype,
+                              null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res, fixed_width_column_wrapper<double>{{3., 2., 4., XXX, XXX}, {1, 1, 1, 0, 0}});
+
+  res = segmented_reduce(input,
+                         d_offsets,
+                         *make_mean_aggregation<segmented_reduce_aggregation>(),
+                         dtype,
+                         null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res, fixed_width_column_wrapper<double>{{3., XXX, 4., XXX, XXX}, {1, 0, 1, 0, 0}});
+
+  // a segment with a single valid element has no sample variance
+  res = segmented_reduce(input,
+                         d_offsets,
+                         *make_variance_aggregation<segmented_reduce_aggregation>(1),
+                         dtype,
+                         null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *res, fixed_width_column_wrapper<double>{{14. / 3, 2., XXX, XXX, XXX}, {1, 1, 0, 0, 0}});
+
+  res = segmented_reduce(input,
+                         d_offsets,
+                         *make_std_aggregation<segmented_reduce_aggregation>(0),
+                         dtype,
+                         null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(
+    *res,
+    fixed_width_column_wrapper<double>{{std::sqrt(3.5), 1., 0., XXX, XXX}, {1, 1, 1, 0, 0}});
+}
+
+TEST_F(SegmentedReductionTestUntyped, ScanSum)
+{
+  // [1, 2, 3], [4, null, 6, 7], [], [8]
+  auto const input =
+    fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, XXX, 6, 7, 8}, {1, 1, 1, 1, 0, 1, 1, 1}};
+  auto const offsets   = std::vector<size_type>{0, 3, 7, 7, 8};
+  auto const d_offsets = thrust::device_vector<size_type>(offsets);
+  auto const agg       = make_sum_aggregation<scan_aggregation>();
+
+  auto res = segmented_scan(input, d_offsets, agg, scan_type::INCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res,
+    fixed_width_column_wrapper<int32_t>{{1, 3, 6, 4, XXX, 10, 17, 8}, {1, 1, 1, 1, 0, 1, 1, 1}});
+
+  res = segmented_scan(input, d_offsets, agg, scan_type::INCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res,
+    fixed_width_column_wrapper<int32_t>{{1, 3, 6, 4, XXX, XXX, XXX, 8}, {1, 1, 1, 1, 0, 0, 0, 1}});
+
+  res = segmented_scan(input, d_offsets, agg, scan_type::EXCLUSIVE, null_policy::EXCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res,
+    fixed_width_column_wrapper<int32_t>{{0, 1, 3, 0, XXX, 4, 10, 0}, {1, 1, 1, 1, 0, 1, 1, 1}});
+
+  res = segmented_scan(input, d_offsets, agg, scan_type::EXCLUSIVE, null_policy::INCLUDE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *res,
+    fixed_width_column_wrapper<int32_t>{{0, 1, 3, 0, 4, XXX, XXX, 0}, {1, 1, 1, 1, 1, 0, 0, 1}});
+}
+
+TEST_F(SegmentedReductionTestUntyped, ScanMax)
+{
+  // [3, 1, 4], [1, 5, 9, 2]
+  auto const input     = fixed_width_column_wrapper<int64_t>{3, 1, 4, 1, 5, 9, 2};
+  auto const offsets   = std::vector<size_type>{0, 3, 7};
+  auto const d_offsets = thrust::device_vector<size_type>(offsets);
+
+  auto res = segmented_scan(
+    input, d_offsets, make_max_aggregation<scan_aggregation>(), scan_type::INCLUSIVE);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*res, fixed_width_column_wrapper<int64_t>{3, 3, 4, 1, 5, 9, 9});
+}
+
 template <typename T>
 struct SegmentedReductionFixedPointTest : public cudf::test::BaseFixture {
 };
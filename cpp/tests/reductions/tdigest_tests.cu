@@ -14,6 +14,10 @@
  * limitations under the License.
  */
 
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/tdigest/tdigest.hpp>
+#include <cudf/quantiles.hpp>
 #include <cudf/reduction.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -164,5 +168,57 @@ TEST_F(ReductionTDigestMerge, FewHeavyCentroids)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
 }
 
+struct ReductionTDigestUpdate : public cudf::test::BaseFixture {
+};
+
+TEST_F(ReductionTDigestUpdate, MatchesMerge)
+{
+  auto const delta   = 1000;
+  auto const values0 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 7919) % 10007); });
+  auto const values1 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<double>((i * 104729) % 20011) - 5000.0; });
+  auto const valids1 =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  cudf::test::fixed_width_column_wrapper<double> batch0(values0, values0 + 5000);
+  cudf::test::fixed_width_column_wrapper<double> batch1(values1, values1 + 7000, valids1);
+
+  // adding a batch to a digest is the same as merging the digests of both batches
+  auto const digest0  = reduce_op{}(batch0, delta);
+  auto const digest1  = reduce_op{}(batch1, delta);
+  auto const digests  = cudf::concatenate(std::vector<column_view>{*digest0, *digest1});
+  auto const expected = reduce_merge_op{}(*digests, delta);
+
+  auto const result =
+    cudf::update_tdigest(cudf::tdigest::tdigest_column_view(*digest0), batch1, delta);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
+
+TEST_F(ReductionTDigestUpdate, FromEmpty)
+{
+  auto const delta = 1000;
+  cudf::test::fixed_width_column_wrapper<double> batch{8, 1, 6, 3, 5, 4, 7, 2};
+
+  auto const empty    = cudf::detail::tdigest::make_empty_tdigest_column();
+  auto const digest   = reduce_op{}(batch, delta);
+  auto const digests  = cudf::concatenate(std::vector<column_view>{*empty, *digest});
+  auto const expected = reduce_merge_op{}(*digests, delta);
+
+  auto const result =
+    cudf::update_tdigest(cudf::tdigest::tdigest_column_view(*empty), batch, delta);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
+
+TEST_F(ReductionTDigestUpdate, EmptyBatch)
+{
+  cudf::test::fixed_width_column_wrapper<double> batch{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<double> empty_batch{};
+  auto const digest = reduce_op{}(batch, 1000);
+
+  auto const result =
+    cudf::update_tdigest(cudf::tdigest::tdigest_column_view(*digest), empty_batch, 1000);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *digest);
+}
+
 }  // namespace test
 }  // namespace cudf
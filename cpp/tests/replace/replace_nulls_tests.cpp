@@ -231,6 +231,28 @@ TEST_F(ReplaceNullsPolicyStringTest, PrecedingFillLeadingNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
 }
 
+TEST_F(ReplaceNullsPolicyStringTest, Segmented)
+{
+  cudf::test::strings_column_wrapper input({"head", "", "", "mid", "", "tail"},
+                                           {1, 0, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{0, 2, 6};
+
+  cudf::test::strings_column_wrapper expected({"head", "head", "", "mid", "mid", "tail"},
+                                              {1, 1, 0, 1, 1, 1});
+
+  auto result = cudf::segmented_replace_nulls(input, offsets, cudf::replace_policy::PRECEDING);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected);
+}
+
+TEST_F(ReplaceNullsPolicyStringTest, InPlaceThrows)
+{
+  cudf::column input{cudf::test::strings_column_wrapper({"a", ""}, {1, 0})};
+  auto view = input.mutable_view();
+  EXPECT_THROW(cudf::replace_nulls_in_place(view, cudf::replace_policy::PRECEDING),
+               cudf::logic_error);
+}
+
 TEST_F(ReplaceNullsPolicyStringTest, FollowingFillTrailingNulls)
 {
   cudf::test::strings_column_wrapper input({"head", "", "", "mid", "mid", "", ""},
@@ -489,6 +511,56 @@ TYPED_TEST(ReplaceNullsPolicyTest, FollowingFillLargeArray)
     cudf::replace_policy::FOLLOWING);
 }
 
+TYPED_TEST(ReplaceNullsPolicyTest, InPlace)
+{
+  auto const col         = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4, 5, 6});
+  auto const mask        = cudf::test::make_type_param_vector<cudf::valid_type>({0, 1, 0, 0, 1, 0});
+  auto const preceding   = cudf::test::make_type_param_vector<TypeParam>({1, 2, 2, 2, 5, 5});
+  auto const following   = cudf::test::make_type_param_vector<TypeParam>({2, 2, 5, 5, 5, 6});
+  auto const preceding_m = cudf::test::make_type_param_vector<cudf::valid_type>({0, 1, 1, 1, 1, 1});
+  auto const following_m = cudf::test::make_type_param_vector<cudf::valid_type>({1, 1, 1, 1, 1, 0});
+
+  cudf::column input_p{
+    cudf::test::fixed_width_column_wrapper<TypeParam>(col.begin(), col.end(), mask.begin())};
+  auto view_p = input_p.mutable_view();
+  cudf::replace_nulls_in_place(view_p, cudf::replace_policy::PRECEDING);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    view_p,
+    cudf::test::fixed_width_column_wrapper<TypeParam>(
+      preceding.begin(), preceding.end(), preceding_m.begin()));
+
+  cudf::column input_f{
+    cudf::test::fixed_width_column_wrapper<TypeParam>(col.begin(), col.end(), mask.begin())};
+  auto view_f = input_f.mutable_view();
+  cudf::replace_nulls_in_place(view_f, cudf::replace_policy::FOLLOWING);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    view_f,
+    cudf::test::fixed_width_column_wrapper<TypeParam>(
+      following.begin(), following.end(), following_m.begin()));
+}
+
+TYPED_TEST(ReplaceNullsPolicyTest, Segmented)
+{
+  auto const col         = cudf::test::make_type_param_vector<TypeParam>({1, 2, 3, 4, 5, 6, 7});
+  auto const mask        = std::vector<cudf::valid_type>{1, 0, 1, 0, 0, 1, 0};
+  auto const offsets     = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 3, 7};
+  auto const preceding   = cudf::test::make_type_param_vector<TypeParam>({1, 1, 3, 4, 5, 6, 6});
+  auto const following   = cudf::test::make_type_param_vector<TypeParam>({1, 3, 3, 6, 6, 6, 7});
+  auto const preceding_m = std::vector<cudf::valid_type>{1, 1, 1, 0, 0, 1, 1};
+  auto const following_m = std::vector<cudf::valid_type>{1, 1, 1, 1, 1, 1, 0};
+
+  auto const input =
+    cudf::test::fixed_width_column_wrapper<TypeParam>(col.begin(), col.end(), mask.begin());
+  auto result = cudf::segmented_replace_nulls(input, offsets, cudf::replace_policy::PRECEDING);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<TypeParam>(
+                                   preceding.begin(), preceding.end(), preceding_m.begin()));
+  result = cudf::segmented_replace_nulls(input, offsets, cudf::replace_policy::FOLLOWING);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result,
+                                 cudf::test::fixed_width_column_wrapper<TypeParam>(
+                                   following.begin(), following.end(), following_m.begin()));
+}
+
 template <typename T>
 struct ReplaceNullsFixedPointTest : public cudf::test::BaseFixture {
 };
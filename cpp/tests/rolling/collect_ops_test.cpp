@@ -31,6 +31,7 @@
 
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
 #include <vector>
@@ -1285,6 +1286,55 @@ TYPED_TEST(TypedCollectListTest, GroupedTimeRangeRollingWindowOnStructsWithMinPe
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result->view(), result_with_nulls_excluded->view());
 }
 
+TEST_F(CollectListTest, RollingWindowWithLargeWindowsExcludingNulls)
+{
+  using namespace cudf;
+  using namespace cudf::test;
+
+  auto constexpr num_rows    = 5'000;
+  auto constexpr preceding   = 1'000;
+  auto constexpr following   = 500;
+  auto constexpr min_periods = 1'200;
+
+  auto const values = thrust::make_counting_iterator(0);
+  auto const valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i % 3 != 0;
+  });
+  auto const input_column = fixed_width_column_wrapper<int32_t>(values, values + num_rows, valids);
+
+  // Windows truncated at the ends of the column have too few observations.
+  std::vector<size_type> expected_offsets{0};
+  std::vector<int32_t> expected_child;
+  std::vector<bool> expected_validity;
+  for (size_type i = 0; i < num_rows; ++i) {
+    auto const begin = std::max(0, i - preceding + 1);
+    auto const end   = std::min(num_rows, i + following + 1);
+    expected_validity.push_back(end - begin >= min_periods);
+    for (auto j = begin; expected_validity.back() && j < end; ++j) {
+      if (valids[j]) { expected_child.push_back(j); }
+    }
+    expected_offsets.push_back(static_cast<size_type>(expected_child.size()));
+  }
+  auto const expected_null_count = static_cast<size_type>(
+    std::count(expected_validity.begin(), expected_validity.end(), false));
+  auto const expected_result = make_lists_column(
+    num_rows,
+    fixed_width_column_wrapper<size_type>(expected_offsets.begin(), expected_offsets.end())
+      .release(),
+    fixed_width_column_wrapper<int32_t>(expected_child.begin(), expected_child.end()).release(),
+    expected_null_count,
+    cudf::test::detail::make_null_mask(expected_validity.begin(), expected_validity.end()));
+
+  auto const result = rolling_window(
+    input_column,
+    preceding,
+    following,
+    min_periods,
+    *make_collect_list_aggregation<rolling_aggregation>(null_policy::EXCLUDE));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_result->view(), result->view());
+}
+
 // The results of `collect_set` are unordered lists.
 // Thus, we have to sort the lists for comparison.
 namespace {
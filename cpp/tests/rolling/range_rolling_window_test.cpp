@@ -317,6 +317,52 @@ TYPED_TEST(TypedIntegralRangeRollingTest, OrderByDesc)
   verify_results_for_descending(exec);
 }
 
+TEST_F(RangeRollingTest, MultipleRequests)
+{
+  // Confirm that aggregations computed together over the same window match
+  // the ones computed separately.
+  using namespace cudf;
+
+  // clang-format off
+  auto gby_column  = int_col { 0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+  auto agg_column  = int_col {{0, 8, 4, 6, 2, 9, 3, 5, 1, 7},
+                              {1, 1, 1, 1, 1, 1, 1, 1, 1, 0}};
+  auto agg_column2 = int_col { 3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+  auto oby_column  = int_col { 1, 5, 6, 8, 9, 2, 2, 3, 4, 9};
+  // clang-format on
+
+  auto const grouping_keys = table_view{std::vector<column_view>{gby_column}};
+  auto const preceding     = range_window_bounds::get(numeric_scalar<int32_t>(2));
+  auto const following     = range_window_bounds::get(numeric_scalar<int32_t>(1));
+
+  std::vector<rolling_request> requests(2);
+  requests[0].values = agg_column;
+  requests[0].aggregations.push_back(make_sum_aggregation<rolling_aggregation>());
+  requests[0].aggregations.push_back(make_min_aggregation<rolling_aggregation>());
+  requests[0].aggregations.push_back(make_count_aggregation<rolling_aggregation>());
+  requests[1].values = agg_column2;
+  requests[1].aggregations.push_back(make_max_aggregation<rolling_aggregation>());
+
+  auto const results = grouped_range_rolling_window(
+    grouping_keys, oby_column, order::ASCENDING, requests, preceding, following, 1);
+
+  ASSERT_EQ(results.size(), requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    ASSERT_EQ(results[i].size(), requests[i].aggregations.size());
+    for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      auto const expected = grouped_range_rolling_window(grouping_keys,
+                                                         oby_column,
+                                                         order::ASCENDING,
+                                                         requests[i].values,
+                                                         preceding,
+                                                         following,
+                                                         1,
+                                                         *requests[i].aggregations[j]);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(results[i][j]->view(), expected->view());
+    }
+  }
+}
+
 template <typename T>
 struct TypedRangeRollingNullsTest : public RangeRollingTest {
 };
@@ -30,6 +30,7 @@
 #include <cudf/rolling.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <src/rolling/detail/rolling.hpp>
 
@@ -1172,6 +1173,33 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data, windows larger than the threshold of the window-size independent algorithms
+TYPED_TEST(RollingTest, RandomLargeWindowWithInvalid)
+{
+  size_type num_rows        = 5000;
+  size_type max_window_size = 300;
+
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  fixed_width_column_wrapper<TypeParam> input(col_data.begin(), col_data.end(), col_valid.begin());
+
+  cudf::test::UniformRandomGenerator<size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<size_type> preceding_window(num_rows);
+  std::vector<size_type> following_window(num_rows);
+
+  std::generate(preceding_window.begin(), preceding_window.end(), generator);
+  std::generate(following_window.begin(), following_window.end(), generator);
+
+  this->run_test_col_agg(input, preceding_window, following_window, 100);
+  this->run_test_col_agg(input, {max_window_size}, {max_window_size}, 100);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -1383,6 +1411,28 @@ TEST_F(RollingTestUdf, DynamicWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*output, expected);
 }
 
+TEST_F(RollingTestUdf, Precompiled)
+{
+  size_type size = 100;
+
+  fixed_width_column_wrapper<int32_t> input(thrust::make_counting_iterator(0),
+                                            thrust::make_counting_iterator(size));
+
+  cudf::precompile_rolling_window_udfs({{cudf::udf_type::CUDA,
+                                         this->cuda_func,
+                                         cudf::data_type{cudf::type_id::INT32},
+                                         cudf::data_type{cudf::type_id::INT64}}});
+  cudf::reset_kernel_cache_statistics();
+
+  auto cuda_udf_agg = cudf::make_udf_aggregation<cudf::rolling_aggregation>(
+    cudf::udf_type::CUDA, this->cuda_func, cudf::data_type{cudf::type_id::INT64});
+  auto output = cudf::rolling_window(input, 2, 2, 4, *cuda_udf_agg);
+
+  auto const statistics = cudf::get_kernel_cache_statistics();
+  EXPECT_EQ(statistics.hits, 1u);
+  EXPECT_EQ(statistics.misses, 0u);
+}
+
 template <typename T>
 struct FixedPointTests : public cudf::test::BaseFixture {
 };
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+struct RowConversion : public cudf::test::BaseFixture {
+};
+
+namespace {
+std::vector<cudf::data_type> schema_of(cudf::table_view const& tbl)
+{
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : tbl) {
+    schema.push_back(col.type());
+  }
+  return schema;
+}
+}  // namespace
+
+TEST_F(RowConversion, FixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> a({1, 2, 3, 4, 5}, nulls_at({1, 3}));
+  cudf::test::fixed_width_column_wrapper<int64_t> b({10, 20, 30, 40, 50}, nulls_at({0}));
+  cudf::test::fixed_width_column_wrapper<int16_t> c{-1, -2, -3, -4, -5};
+  cudf::test::fixed_width_column_wrapper<double> d({1.5, 2.5, 3.5, 4.5, 5.5}, nulls_at({4}));
+  cudf::test::fixed_width_column_wrapper<bool> e{true, false, true, false, true};
+  cudf::table_view in({a, b, c, d, e});
+  auto const schema = schema_of(in);
+
+  auto const rows = cudf::convert_to_rows(in);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), in.num_rows());
+
+  auto const out = cudf::convert_from_rows(cudf::lists_column_view{*rows.front()}, schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(in, *out);
+}
+
+TEST_F(RowConversion, FixedWidthOptimized)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5}, nulls_at({2}));
+  cudf::test::fixed_width_column_wrapper<float> b{1.f, 2.f, 3.f, 4.f, 5.f};
+  cudf::test::fixed_width_column_wrapper<uint8_t> c({7, 8, 9, 10, 11}, nulls_at({0, 4}));
+  cudf::table_view in({a, b, c});
+  auto const schema = schema_of(in);
+
+  auto const rows = cudf::convert_to_rows_fixed_width_optimized(in);
+  ASSERT_EQ(rows.size(), 1u);
+
+  auto const out =
+    cudf::convert_from_rows_fixed_width_optimized(cudf::lists_column_view{*rows.front()}, schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(in, *out);
+
+  // Both paths produce the same rows
+  auto const tiled_rows = cudf::convert_to_rows(in);
+  ASSERT_EQ(tiled_rows.size(), 1u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*rows.front(), *tiled_rows.front());
+}
+
+TEST_F(RowConversion, ManyRows)
+{
+  constexpr cudf::size_type num_rows = 100'000;
+  auto const values = thrust::make_counting_iterator(0);
+  auto const nulls  = thrust::make_transform_iterator(values, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> a(values, values + num_rows, nulls);
+  cudf::test::fixed_width_column_wrapper<int64_t> b(values, values + num_rows);
+  cudf::test::fixed_width_column_wrapper<int16_t> c(values, values + num_rows, nulls);
+  cudf::table_view in({a, b, c});
+  auto const schema = schema_of(in);
+
+  auto const rows = cudf::convert_to_rows(in);
+  ASSERT_EQ(rows.size(), 1u);
+
+  auto const out = cudf::convert_from_rows(cudf::lists_column_view{*rows.front()}, schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(in, *out);
+}
+
+TEST_F(RowConversion, Strings)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> a({1, 2, 3, 4, 5}, nulls_at({3}));
+  cudf::test::strings_column_wrapper b(
+    {"", "hello", "a much longer string than the others", "x", "abc"}, nulls_at({2}));
+  cudf::test::fixed_width_column_wrapper<int64_t> c{10, 20, 30, 40, 50};
+  cudf::test::strings_column_wrapper d{"one", "two", "three", "four", "five"};
+  cudf::table_view in({a, b, c, d});
+  auto const schema = schema_of(in);
+
+  auto const rows = cudf::convert_to_rows(in);
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_EQ(rows.front()->size(), in.num_rows());
+
+  auto const out = cudf::convert_from_rows(cudf::lists_column_view{*rows.front()}, schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(in, *out);
+}
+
+TEST_F(RowConversion, ManyStrings)
+{
+  constexpr cudf::size_type num_rows = 10'000;
+  auto const values  = thrust::make_counting_iterator(0);
+  auto const strings =
+    thrust::make_transform_iterator(values, [](auto i) { return std::to_string(i); });
+  auto const nulls   = thrust::make_transform_iterator(values, [](auto i) { return i % 5 != 0; });
+  cudf::test::strings_column_wrapper a(strings, strings + num_rows, nulls);
+  cudf::test::fixed_width_column_wrapper<int32_t> b(values, values + num_rows);
+  cudf::test::strings_column_wrapper c(strings, strings + num_rows);
+  cudf::table_view in({a, b, c});
+  auto const schema = schema_of(in);
+
+  auto const rows = cudf::convert_to_rows(in);
+  ASSERT_EQ(rows.size(), 1u);
+
+  auto const out = cudf::convert_from_rows(cudf::lists_column_view{*rows.front()}, schema);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(in, *out);
+}
+
+TEST_F(RowConversion, UnsupportedType)
+{
+  cudf::test::lists_column_wrapper<int32_t> a{{1, 2}, {3}};
+  cudf::table_view in({a});
+
+  EXPECT_THROW(cudf::convert_to_rows(in), cudf::logic_error);
+  EXPECT_THROW(cudf::convert_to_rows_fixed_width_optimized(in), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
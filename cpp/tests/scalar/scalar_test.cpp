@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,10 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/mr/device/statistics_resource_adaptor.hpp>
 
 template <typename T>
 struct TypedScalarTest : public cudf::test::BaseFixture {
@@ -297,4 +301,36 @@ TEST_F(StructScalarTest, BasicNulls)
   }
 }
 
+struct SmallScalarAllocationTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(SmallScalarAllocationTest, BypassesCurrentResource)
+{
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics_mr(
+    rmm::mr::get_current_device_resource());
+  auto const previous_mr = rmm::mr::set_current_device_resource(&statistics_mr);
+  {
+    cudf::numeric_scalar<int64_t> number(42);
+    cudf::string_scalar string("small");
+    EXPECT_EQ(42, number.value());
+    EXPECT_EQ("small", string.to_string());
+  }
+  rmm::mr::set_current_device_resource(previous_mr);
+
+  EXPECT_EQ(0, statistics_mr.get_allocations_counter().total);
+}
+
+TEST_F(SmallScalarAllocationTest, UsesExplicitResource)
+{
+  rmm::mr::statistics_resource_adaptor<rmm::mr::device_memory_resource> statistics_mr(
+    rmm::mr::get_current_device_resource());
+  {
+    cudf::numeric_scalar<int64_t> number(42, true, cudf::default_stream_value, &statistics_mr);
+    EXPECT_EQ(42, number.value());
+  }
+
+  // the validity and the value
+  EXPECT_EQ(2, statistics_mr.get_allocations_counter().total);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -17,13 +17,17 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
+
 struct SearchTest : public cudf::test::BaseFixture {
 };
 
@@ -1710,6 +1714,21 @@ TEST_F(SearchTest, multi_contains_none_with_nulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, multi_contains_nans)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+  fixed_width_column_wrapper<double> haystack{{1.0, nan, 3.0, 5.0}, {1, 1, 1, 0}};
+  fixed_width_column_wrapper<double> needles{nan, 3.0, 4.0, 5.0};
+
+  // NaNs compare unequal to all elements
+  fixed_width_column_wrapper<bool> expect{0, 1, 0, 0};
+
+  auto result = cudf::contains(haystack, needles);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+}
+
 TEST_F(SearchTest, multi_contains_some_string_with_nulls)
 {
   std::vector<const char*> h_haystack_strings{"0", "1", nullptr, "19", "23", "29", "71"};
@@ -1872,4 +1891,154 @@ TYPED_TEST(FixedPointTestAllReps, FixedPointUpperBound)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, sorted_searcher_with_nulls)
+{
+  using cudf::test::iterators::null_at;
+  using cudf::test::iterators::nulls_at;
+
+  fixed_width_column_wrapper<int32_t> column({0, 0, 10, 20, 20, 20, 30, 40, 50}, nulls_at({0, 1}));
+  fixed_width_column_wrapper<int32_t> values({0, 10, 15, 20, 25, 50, 60, 0}, null_at(7));
+
+  cudf::sorted_searcher const searcher(column);
+
+  fixed_width_column_wrapper<size_type> expect_lower{2, 2, 3, 3, 6, 8, 9, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.lower_bound(values), expect_lower);
+  fixed_width_column_wrapper<size_type> expect_upper{2, 3, 3, 6, 6, 9, 9, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.upper_bound(values), expect_upper);
+}
+
+TEST_F(SearchTest, sorted_searcher_descending)
+{
+  using cudf::test::iterators::null_at;
+
+  fixed_width_column_wrapper<int64_t> column({50, 40, 30, 20, 20, 10, 0}, null_at(6));
+  fixed_width_column_wrapper<int64_t> values({60, 40, 20, 5, 0}, null_at(4));
+
+  cudf::sorted_searcher const searcher(column, cudf::order::DESCENDING, cudf::null_order::BEFORE);
+
+  fixed_width_column_wrapper<size_type> expect_lower{0, 1, 3, 6, 6};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.lower_bound(values), expect_lower);
+  fixed_width_column_wrapper<size_type> expect_upper{0, 2, 5, 6, 7};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.upper_bound(values), expect_upper);
+}
+
+TEST_F(SearchTest, sorted_searcher_nans)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  auto const inf = std::numeric_limits<double>::infinity();
+
+  fixed_width_column_wrapper<double> column{-1.0, 0.0, 2.5, nan, nan};
+  fixed_width_column_wrapper<double> values{nan, 2.5, inf};
+
+  cudf::sorted_searcher const searcher(column);
+
+  fixed_width_column_wrapper<size_type> expect_lower{3, 2, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.lower_bound(values), expect_lower);
+  fixed_width_column_wrapper<size_type> expect_upper{5, 3, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.upper_bound(values), expect_upper);
+}
+
+TEST_F(SearchTest, sorted_searcher_matches_lower_and_upper_bound)
+{
+  auto const column_it =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 3; });
+  auto const values_it =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i - 1; });
+  // a haystack size which does not fill the last level of the search tree
+  fixed_width_column_wrapper<int32_t> column(column_it, column_it + 1000);
+  fixed_width_column_wrapper<int32_t> values(values_it, values_it + 340);
+
+  cudf::sorted_searcher const searcher(column);
+
+  auto const expect_lower = cudf::lower_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.lower_bound(values), *expect_lower);
+  auto const expect_upper = cudf::upper_bound({cudf::table_view{{column}}},
+                                              {cudf::table_view{{values}}},
+                                              {cudf::order::ASCENDING},
+                                              {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*searcher.upper_bound(values), *expect_upper);
+}
+
+TEST_F(SearchTest, sorted_searcher_mismatched_types)
+{
+  fixed_width_column_wrapper<int32_t> column{10, 20, 30};
+  fixed_width_column_wrapper<int64_t> values{20};
+
+  cudf::sorted_searcher const searcher(column);
+  EXPECT_THROW(searcher.lower_bound(values), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper strings{"a", "b"};
+  EXPECT_THROW(cudf::sorted_searcher{strings}, cudf::logic_error);
+}
+
+TEST_F(SearchTest, table_contains)
+{
+  using cudf::test::iterators::null_at;
+
+  fixed_width_column_wrapper<int32_t> haystack_ints({10, 20, 30, 0}, null_at(3));
+  cudf::test::strings_column_wrapper haystack_strings{"a", "b", "c", "d"};
+  fixed_width_column_wrapper<int32_t> needles_ints({20, 20, 40, 0}, null_at(3));
+  cudf::test::strings_column_wrapper needles_strings{"b", "c", "a", "d"};
+  auto const haystack = cudf::table_view{{haystack_ints, haystack_strings}};
+  auto const needles  = cudf::table_view{{needles_ints, needles_strings}};
+
+  auto const result = cudf::contains(haystack, needles);
+  fixed_width_column_wrapper<bool> expect{true, false, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+
+  auto const result_unequal_nulls =
+    cudf::contains(haystack, needles, cudf::null_equality::UNEQUAL);
+  fixed_width_column_wrapper<bool> expect_unequal_nulls{true, false, false, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result_unequal_nulls, expect_unequal_nulls);
+
+  EXPECT_THROW(cudf::contains(haystack, cudf::table_view{{needles_ints}}), cudf::logic_error);
+}
+
+TEST_F(SearchTest, table_contains_nans)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+
+  fixed_width_column_wrapper<double> haystack{1.0, nan, 3.0};
+  fixed_width_column_wrapper<double> needles{nan, 3.0, 4.0};
+
+  auto const result = cudf::contains(cudf::table_view{{haystack}}, cudf::table_view{{needles}});
+  fixed_width_column_wrapper<bool> expect{true, true, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
+
+  auto const result_unequal_nans = cudf::contains(cudf::table_view{{haystack}},
+                                                  cudf::table_view{{needles}},
+                                                  cudf::null_equality::EQUAL,
+                                                  cudf::nan_equality::UNEQUAL);
+  fixed_width_column_wrapper<bool> expect_unequal_nans{false, true, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result_unequal_nans, expect_unequal_nans);
+}
+
+TEST_F(SearchTest, row_hash_set_many_needles)
+{
+  using cudf::test::iterators::null_at;
+
+  // The haystack has no nulls, which the set must not assume of the needles
+  fixed_width_column_wrapper<int32_t> haystack_ints{1, 2, 3};
+  fixed_width_column_wrapper<int64_t> haystack_children{10, 20, 30};
+  cudf::test::structs_column_wrapper haystack_structs{{haystack_children}};
+  cudf::row_hash_set const set(cudf::table_view{{haystack_ints, haystack_structs}});
+
+  fixed_width_column_wrapper<int32_t> needles_ints0{3, 1, 2};
+  fixed_width_column_wrapper<int64_t> needles_children0{30, 20, 20};
+  cudf::test::structs_column_wrapper needles_structs0{{needles_children0}};
+  fixed_width_column_wrapper<bool> expect0{true, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *set.contains(cudf::table_view{{needles_ints0, needles_structs0}}), expect0);
+
+  fixed_width_column_wrapper<int32_t> needles_ints1({1, 0, 2}, null_at(1));
+  fixed_width_column_wrapper<int64_t> needles_children1{10, 20, 20};
+  cudf::test::structs_column_wrapper needles_structs1({needles_children1}, {1, 1, 0});
+  fixed_width_column_wrapper<bool> expect1{true, false, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *set.contains(cudf::table_view{{needles_ints1, needles_structs1}}), expect1);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
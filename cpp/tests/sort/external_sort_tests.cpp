@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct ExternalSort : public BaseFixture {
+};
+
+namespace {
+std::vector<std::unique_ptr<table>> sort_runs(std::vector<table_view> const& runs,
+                                              std::vector<order> const& column_order,
+                                              size_type chunk_rows)
+{
+  external_sorter sorter({0}, column_order, {}, chunk_rows);
+  for (auto const& run : runs) {
+    sorter.push(run);
+  }
+  EXPECT_GT(sorter.spilled_bytes(), 0u);
+
+  std::vector<std::unique_ptr<table>> chunks;
+  sorter.finish([&](std::unique_ptr<table>&& chunk) { chunks.push_back(std::move(chunk)); });
+  return chunks;
+}
+}  // namespace
+
+TEST_F(ExternalSort, MergesRunsInChunks)
+{
+  // keys are distinct apart from the nulls, so the sorted keys do not depend on the merge order
+  size_type const num_rows = 1000;
+  auto keys_begin          = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                    [](int32_t i) { return (i * 7919) % 10007; });
+  auto valids              = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](int32_t i) { return i % 97 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(keys_begin, keys_begin + num_rows, valids);
+  fixed_width_column_wrapper<int32_t> payload(thrust::make_counting_iterator(0),
+                                              thrust::make_counting_iterator(num_rows));
+  auto const input = table_view{{keys, payload}};
+  auto const runs  = split(input, {300, 310, 700});
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    auto const chunks = sort_runs(runs, {column_order}, 64);
+    std::vector<table_view> views;
+    for (auto const& chunk : chunks) {
+      EXPECT_LE(chunk->num_rows(), 64);
+      views.push_back(chunk->view());
+    }
+    auto const expected = stable_sort_by_key(input, input.select({0}), {column_order});
+    auto const result   = concatenate(views);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), result->get_column(0));
+  }
+}
+
+TEST_F(ExternalSort, SingleRunAndEmpty)
+{
+  fixed_width_column_wrapper<int64_t> keys{5, 1, 4, 3, 2};
+  auto const input = table_view{{keys}};
+
+  auto const empty  = slice(input, {0, 0}).front();
+
+  auto const chunks = sort_runs({input, empty}, {order::ASCENDING}, 2);
+  ASSERT_EQ(chunks.size(), 3u);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks[0]->get_column(0),
+                                 fixed_width_column_wrapper<int64_t>{1, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks[1]->get_column(0),
+                                 fixed_width_column_wrapper<int64_t>{3, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(chunks[2]->get_column(0), fixed_width_column_wrapper<int64_t>{5});
+}
+
+TEST_F(ExternalSort, Errors)
+{
+  fixed_width_column_wrapper<int32_t> keys{1, 2};
+  fixed_width_column_wrapper<float> other{1, 2};
+  EXPECT_THROW(external_sorter({0}, {}, {}, 0), logic_error);
+  EXPECT_THROW(external_sorter({0}, {order::ASCENDING, order::ASCENDING}), logic_error);
+
+  external_sorter sorter({0});
+  sorter.push(table_view{{keys}});
+  EXPECT_THROW(sorter.push(table_view{{other}}), logic_error);
+  sorter.finish([](std::unique_ptr<table>&&) {});
+  EXPECT_THROW(sorter.finish([](std::unique_ptr<table>&&) {}), logic_error);
+  EXPECT_THROW(sorter.push(table_view{{keys}}), logic_error);
+}
+
+}  // namespace test
+}  // namespace cudf
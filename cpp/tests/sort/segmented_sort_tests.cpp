@@ -24,6 +24,7 @@
 #include <cudf/detail/sorting.hpp>
 #include <cudf/sorting.hpp>
 
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -268,5 +269,52 @@ TEST_F(SegmentedSortInt, ErrorsMismatchArgSizes)
   CUDF_EXPECT_NO_THROW(cudf::segmented_sort_by_key(input1, input1, col2));
 }
 
+TEST_F(SegmentedSortInt, BucketedSegmentSizes)
+{
+  // segments sorted by warps, by blocks and by the device-wide sort
+  std::vector<size_type> const sizes{0, 1, 5, 32, 33, 100, 2048, 2049, 5000, 3, 17};
+  std::vector<size_type> h_offsets{0};
+  std::vector<size_type> h_segment_ids;
+  for (std::size_t s = 0; s < sizes.size(); ++s) {
+    h_offsets.push_back(h_offsets.back() + sizes[s]);
+    h_segment_ids.insert(h_segment_ids.end(), sizes[s], static_cast<size_type>(s));
+  }
+  auto const num_rows = h_offsets.back();
+  auto const values   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<float>((i * 7919) % 101); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  fixed_width_column_wrapper<float> keys(values, values + num_rows, valids);
+  column_wrapper<int> offsets(h_offsets.begin(), h_offsets.end());
+  column_wrapper<int> segment_ids(h_segment_ids.begin(), h_segment_ids.end());
+
+  for (auto const column_order : {order::ASCENDING, order::DESCENDING}) {
+    for (auto const null_precedence : {null_order::BEFORE, null_order::AFTER}) {
+      auto const expected = cudf::stable_sorted_order(table_view{{segment_ids, keys}},
+                                                      {order::ASCENDING, column_order},
+                                                      {null_order::BEFORE, null_precedence});
+      auto const results  = cudf::stable_segmented_sorted_order(
+        table_view{{keys}}, offsets, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected->view());
+    }
+  }
+}
+
+TEST_F(SegmentedSortInt, BucketedNaNs)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  // clang-format off
+  column_wrapper<double>      col1{{nan, 1., 0., nan, -1., 2., nan, 3., 1.}};
+  column_wrapper<int>     segments{{0,            4,                    9}};
+  column_wrapper<int> expected_asc{{2, 1, 0, 3, 4, 8, 5, 7, 6}};
+  column_wrapper<int> expected_des{{0, 3, 1, 2, 6, 7, 5, 8, 4}};
+  // clang-format on
+  auto results = cudf::stable_segmented_sorted_order(table_view{{col1}}, segments);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected_asc);
+  results =
+    cudf::stable_segmented_sorted_order(table_view{{col1}}, segments, {order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected_des);
+}
+
 }  // namespace test
 }  // namespace cudf
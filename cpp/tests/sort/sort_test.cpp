@@ -20,14 +20,19 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_properties.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
+#include <rmm/cuda_stream.hpp>
+
 #include <thrust/host_vector.h>
 #include <thrust/sort.h>
 
+#include <memory>
 #include <type_traits>
 #include <vector>
 
@@ -387,6 +392,36 @@ TYPED_TEST(Sort, WithNullableStructColumn)
   }
 }
 
+TYPED_TEST(Sort, StructColumnDescendingNullsAfter)
+{
+  // Struct columns of fixed-width fields are sorted by their flattened, normalized keys
+  using fwcw = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+  /*
+       +----------+
+       |s{a, b}   |
+       +----------+
+     0 | { 1,  2} |
+     1 |@{ 2,  2} |
+     2 | { 1,  1} |
+     3 | { 2,  @} |
+     4 | { 2,  0} |
+       +----------+
+  */
+  auto col_a = fwcw{1, 2, 1, 2, 2};
+  auto col_b = fwcw{{2, 2, 1, 0, 0}, {1, 1, 1, 0, 1}};
+  auto s     = cudf::test::structs_column_wrapper{{col_a, col_b}, {1, 0, 1, 1, 1}};
+  auto const input = table_view({s});
+
+  std::vector<order> column_order{order::DESCENDING};
+  std::vector<null_order> null_precedence{null_order::AFTER};
+  fixed_width_column_wrapper<int32_t> expected{{1, 3, 4, 0, 2}};
+
+  auto got = stable_sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  run_sort_test(input, expected, column_order, null_precedence);
+}
+
 TYPED_TEST(Sort, WithSingleStructColumn)
 {
   using T = TypeParam;
@@ -810,6 +845,49 @@ TYPED_TEST(FixedPointTestAllReps, FixedPointSortedOrderGather)
 struct SortCornerTest : public BaseFixture {
 };
 
+TEST_F(SortCornerTest, FixedWidthKeysAcrossWords)
+{
+  // 65 + 32 + 1 bits of normalized key, so the int32 column straddles two key words
+  fixed_width_column_wrapper<int64_t> col0{{5, 0, -3, 5, -3, 0}, {1, 0, 1, 1, 1, 0}};
+  fixed_width_column_wrapper<int32_t> col1{2, 7, 1, 2, 0, 7};
+  fixed_width_column_wrapper<bool> col2{1, 0, 0, 0, 1, 1};
+  table_view input{{col0, col1, col2}};
+
+  std::vector<order> column_order{order::ASCENDING, order::DESCENDING, order::ASCENDING};
+  std::vector<null_order> null_precedence{
+    null_order::BEFORE, null_order::BEFORE, null_order::BEFORE};
+
+  fixed_width_column_wrapper<int32_t> expected{1, 5, 2, 4, 3, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected,
+                                 sorted_order(input, column_order, null_precedence)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected,
+                                 stable_sorted_order(input, column_order, null_precedence)->view());
+  run_sort_test(input, expected, column_order, null_precedence);
+
+  // nulls order last when a column with null_order::BEFORE is descending
+  std::vector<order> descending{order::DESCENDING, order::DESCENDING, order::ASCENDING};
+  fixed_width_column_wrapper<int32_t> expected_descending{3, 0, 2, 4, 1, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_descending,
+                                 sorted_order(input, descending, null_precedence)->view());
+}
+
+TEST_F(SortCornerTest, StringsWithTiedPrefixes)
+{
+  strings_column_wrapper col(
+    {"banana", "applesauce1", "", "applesauce0", "", "apple", "applesauce", "b"},
+    {1, 1, 0, 1, 1, 1, 1, 1});
+  table_view input{{col}};
+
+  fixed_width_column_wrapper<int32_t> expected_asc{{2, 4, 5, 6, 3, 1, 7, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_asc, sorted_order(input)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_asc, stable_sorted_order(input)->view());
+
+  fixed_width_column_wrapper<int32_t> expected_desc{{0, 7, 1, 3, 6, 5, 4, 2}};
+  std::vector<order> column_order{order::DESCENDING};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, sorted_order(input, column_order)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, stable_sorted_order(input, column_order)->view());
+}
+
 TEST_F(SortCornerTest, WithEmptyStructColumn)
 {
   using int_col = fixed_width_column_wrapper<int32_t>;
@@ -861,6 +939,74 @@ TEST_F(SortCornerTest, WithEmptyStructColumn)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected3, got3->view());
 };
 
+TEST_F(SortCornerTest, DictionaryKeys)
+{
+  dictionary_column_wrapper<std::string> col(
+    {"pear", "apple", "", "fig", "apple", "pear", "kiwi"}, {1, 1, 0, 1, 1, 1, 1});
+  fixed_width_column_wrapper<int32_t> col1{3, 2, 1, 0, 1, 2, 3};
+  table_view input{{col, col1}};
+
+  fixed_width_column_wrapper<int32_t> expected{2, 4, 1, 3, 6, 5, 0};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, sorted_order(input)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, stable_sorted_order(input)->view());
+
+  std::vector<order> column_order{order::DESCENDING, order::ASCENDING};
+  fixed_width_column_wrapper<int32_t> expected_desc{5, 0, 6, 3, 4, 1, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc, sorted_order(input, column_order)->view());
+}
+
+TEST_F(SortCornerTest, OnUserStream)
+{
+  fixed_width_column_wrapper<int32_t> keys{{3, 1, 4, 1, 5, 9, 2, 6}, {1, 1, 1, 0, 1, 1, 1, 1}};
+  strings_column_wrapper values{"a", "b", "c", "d", "e", "f", "g", "h"};
+  table_view input{{keys, values}};
+
+  rmm::cuda_stream stream;
+  auto const indices = stable_sorted_order(input.select({0}), {}, {}, stream.view());
+  auto const sorted  = sort_by_key(input, input.select({0}), {}, {}, stream.view());
+  stream.synchronize();
+
+  fixed_width_column_wrapper<int32_t> expected_indices{3, 1, 6, 0, 2, 4, 7, 5};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_indices, indices->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::gather(input, indices->view())->view(), sorted->view());
+}
+
+TEST_F(SortCornerTest, ColumnProperties)
+{
+  fixed_width_column_wrapper<int32_t> col{{3, 1, 4, 1, 5}, {1, 1, 1, 0, 1}};
+  std::vector<null_order> nulls_after{null_order::AFTER};
+
+  // the output of sort is known to be sorted in the requested order
+  auto const sorted           = sort(table_view{{col}}, {order::DESCENDING}, nulls_after);
+  auto const& sorted_property = sorted->get_column(0).properties();
+  ASSERT_NE(nullptr, sorted_property);
+  EXPECT_TRUE(sorted_property->is_sorted(order::DESCENDING, null_order::AFTER, true));
+  EXPECT_FALSE(sorted_property->is_sorted(order::DESCENDING, null_order::BEFORE, true));
+  EXPECT_FALSE(sorted_property->is_sorted(order::ASCENDING, null_order::AFTER, true));
+  EXPECT_NE(nullptr, sorted->view().column(0).properties());
+
+  // copies keep the properties, mutable views drop them
+  auto copy = column(sorted->get_column(0));
+  EXPECT_EQ(sorted_property, copy.properties());
+  [[maybe_unused]] auto const mutable_view = copy.mutable_view();
+  EXPECT_EQ(nullptr, copy.properties());
+
+  // rows known to be sorted are not sorted again, even when the properties are wrong
+  auto properties          = std::make_shared<column_properties>();
+  properties->sorted_order = order::ASCENDING;
+  auto const unsorted      = column_view{col}.with_properties(properties);
+  fixed_width_column_wrapper<int32_t> identity{0, 1, 2, 3, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(identity, sorted_order(table_view{{unsorted}})->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(identity, stable_sorted_order(table_view{{unsorted}})->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(col, sort(table_view{{unsorted}})->view().column(0));
+  EXPECT_TRUE(is_sorted(table_view{{unsorted}}, {}, {}));
+
+  // other orders are still computed
+  fixed_width_column_wrapper<int32_t> expected_desc{4, 2, 0, 1, 3};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_desc,
+                                 sorted_order(table_view{{unsorted}}, {order::DESCENDING})->view());
+}
+
 }  // namespace test
 }  // namespace cudf
 
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <vector>
+
+namespace cudf {
+namespace test {
+
+struct TopK : public BaseFixture {
+};
+
+namespace {
+// Distinct-ish pseudo-random keys in [0, 10007) with many repeats
+auto make_keys(size_type num_rows)
+{
+  auto values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](int32_t i) { return (i * 7919) % 10007; });
+  auto valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](int32_t i) { return i % 101 != 0; });
+  return fixed_width_column_wrapper<int32_t>(values, values + num_rows, valids);
+}
+
+void expect_first_k_of_sorted_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence)
+{
+  auto const sorted   = stable_sorted_order(keys, column_order, null_precedence);
+  auto const expected = slice(sorted->view(), {0, std::min(k, keys.num_rows())}).front();
+  auto const result   = top_k_order(keys, k, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result);
+}
+}  // namespace
+
+TEST_F(TopK, Small)
+{
+  fixed_width_column_wrapper<int32_t> col{5, 3, 8, 1, 3};
+  table_view const keys{{col}};
+
+  fixed_width_column_wrapper<int32_t> expected_order{3, 1, 4};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_order, *top_k_order(keys, 3));
+
+  fixed_width_column_wrapper<int32_t> expected_rows{8, 5};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_view{{expected_rows}},
+                                top_k(keys, 2, {order::DESCENDING})->view());
+
+  EXPECT_EQ(top_k_order(keys, 0)->size(), 0);
+  EXPECT_EQ(top_k_order(keys, 10)->size(), keys.num_rows());
+  EXPECT_THROW(top_k_order(keys, -1), cudf::logic_error);
+}
+
+TEST_F(TopK, Large)
+{
+  auto const col = make_keys(100000);
+  table_view const keys{{col}};
+
+  for (auto k : {1, 100, 5000, 99999}) {
+    expect_first_k_of_sorted_order(keys, k, {order::ASCENDING}, {null_order::BEFORE});
+    expect_first_k_of_sorted_order(keys, k, {order::ASCENDING}, {null_order::AFTER});
+    expect_first_k_of_sorted_order(keys, k, {order::DESCENDING}, {null_order::AFTER});
+  }
+}
+
+TEST_F(TopK, LargeMultiColumn)
+{
+  auto const col0 = make_keys(50000);
+  auto const seq  = thrust::make_counting_iterator(0);
+  fixed_width_column_wrapper<int32_t> col1(seq, seq + 50000);
+  table_view const keys{{col0, col1}};
+
+  expect_first_k_of_sorted_order(
+    keys, 1000, {order::ASCENDING, order::DESCENDING}, {null_order::AFTER, null_order::AFTER});
+}
+
+TEST_F(TopK, Segmented)
+{
+  fixed_width_column_wrapper<int32_t> col{3, 1, 2, 5, 4, 9};
+  fixed_width_column_wrapper<size_type> offsets{0, 3, 3, 6};
+
+  lists_column_wrapper<size_type> expected{{1, 2}, {}, {4, 3}};
+  auto const result = segmented_top_k_order(table_view{{col}}, offsets, 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+
+  lists_column_wrapper<size_type> expected_desc{{0, 2, 1}, {}, {5, 3, 4}};
+  auto const result_desc =
+    segmented_top_k_order(table_view{{col}}, offsets, 5, {order::DESCENDING});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected_desc, *result_desc);
+}
+
+}  // namespace test
+}  // namespace cudf
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/compressed_table.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+struct CompressedTableTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(CompressedTableTest, RoundTrip)
+{
+  auto const sequence     = thrust::make_counting_iterator(0);
+  auto const valids       = thrust::make_transform_iterator(sequence, [](auto i) { return i % 3; });
+  auto const strings_data = thrust::make_transform_iterator(
+    sequence, [](auto i) { return std::string(i % 4, 'a' + i % 26); });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(sequence, sequence + 1000, valids);
+  cudf::test::strings_column_wrapper strings(strings_data, strings_data + 1000, valids);
+  cudf::table_view const input{{ints, strings}};
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const ranges{
+    {0, 1}, {99, 101}, {250, 750}, {333, 666}, {999, 1000}};
+
+  for (cudf::size_type const slice_rows : {1, 100, 333, 1000, 1 << 20}) {
+    cudf::compressed_table const compressed{input, cudf::io::compression_type::LZ4, slice_rows};
+    EXPECT_EQ(compressed.num_rows(), input.num_rows());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(input, compressed.decompress()->view());
+
+    for (auto const& [begin, end] : ranges) {
+      auto const expected = cudf::slice(input, {begin, end}).front();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected, compressed.decompress(begin, end)->view());
+    }
+  }
+}
+
+TEST_F(CompressedTableTest, EmptyRanges)
+{
+  cudf::test::fixed_width_column_wrapper<int64_t> ints{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  cudf::table_view const input{{ints}};
+  cudf::compressed_table const compressed{input, cudf::io::compression_type::LZ4, 2};
+
+  for (cudf::size_type const row : {0, 2, 3, 5}) {
+    auto const expected = cudf::slice(input, {row, row}).front();
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, compressed.decompress(row, row)->view());
+  }
+
+  cudf::test::fixed_width_column_wrapper<int64_t> empty{};
+  cudf::compressed_table const empty_compressed{cudf::table_view{{empty}}};
+  EXPECT_EQ(empty_compressed.num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{empty}}, empty_compressed.decompress()->view());
+}
+
+TEST_F(CompressedTableTest, CompressesRepeatedValues)
+{
+  auto const repeated =
+    cudf::make_column_from_scalar(cudf::numeric_scalar<int64_t>(42), 1 << 20);
+  cudf::table_view const input{{repeated->view()}};
+  cudf::compressed_table const compressed{input};
+
+  EXPECT_LT(compressed.compressed_size(), compressed.uncompressed_size() / 10);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, compressed.decompress()->view());
+}
+
+TEST_F(CompressedTableTest, InvalidArguments)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3};
+  cudf::table_view const input{{ints}};
+
+  EXPECT_THROW(cudf::compressed_table(input, cudf::io::compression_type::NONE), cudf::logic_error);
+  EXPECT_THROW(cudf::compressed_table(input, cudf::io::compression_type::LZ4, 0),
+               cudf::logic_error);
+
+  cudf::compressed_table const compressed{input};
+  EXPECT_THROW((void)compressed.decompress(-1, 2), cudf::logic_error);
+  EXPECT_THROW((void)compressed.decompress(2, 1), cudf::logic_error);
+  EXPECT_THROW((void)compressed.decompress(0, 4), cudf::logic_error);
+}
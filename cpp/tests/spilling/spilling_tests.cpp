@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/spilling.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/mr/device/limiting_resource_adaptor.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <memory>
+#include <vector>
+
+struct SpillingTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+
+// Column of 1MiB of data
+std::unique_ptr<cudf::column> make_column(int32_t init)
+{
+  return cudf::sequence(
+    1 << 18, cudf::numeric_scalar<int32_t>(init), cudf::numeric_scalar<int32_t>(1));
+}
+
+}  // namespace
+
+TEST_F(SpillingTest, SpillAndReload)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{{1, 2, 3, 4, 5}, {1, 0, 1, 1, 0}};
+  cudf::test::strings_column_wrapper strings{{"a", "", "ccc", "dddd", "e"}, {1, 1, 0, 1, 1}};
+  cudf::table_view const input{{ints, strings}};
+
+  cudf::spill_manager manager;
+  auto const table = manager.make_spillable(input);
+  EXPECT_FALSE(table->is_spilled());
+  EXPECT_EQ(manager.device_size(), table->size());
+
+  EXPECT_EQ(table->spill(), table->size());
+  EXPECT_TRUE(table->is_spilled());
+  EXPECT_EQ(manager.device_size(), std::size_t{0});
+  // nothing is left to spill
+  EXPECT_EQ(table->spill(), std::size_t{0});
+
+  {
+    auto const accessor = table->access();
+    EXPECT_FALSE(table->is_spilled());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(input, accessor.view());
+    // the table is not spilled while accessed
+    EXPECT_EQ(table->spill(), std::size_t{0});
+  }
+  EXPECT_EQ(table->spill(), table->size());
+}
+
+TEST_F(SpillingTest, EmptyTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::table_view const input{{ints}};
+
+  cudf::spill_manager manager;
+  auto const table = manager.make_spillable(input);
+  EXPECT_EQ(table->spill(), std::size_t{0});
+  EXPECT_FALSE(table->is_spilled());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, table->access().view());
+}
+
+TEST_F(SpillingTest, LeastRecentlyAccessedFirst)
+{
+  auto const first  = make_column(0);
+  auto const second = make_column(1);
+  auto const third  = make_column(2);
+
+  cudf::spill_manager manager;
+  auto const first_table  = manager.make_spillable(cudf::table_view{{*first}});
+  auto const second_table = manager.make_spillable(cudf::table_view{{*second}});
+  auto const third_table  = manager.make_spillable(cudf::table_view{{*third}});
+  first_table->access();
+
+  // the second table is the least recently accessed, then the third one
+  EXPECT_EQ(manager.spill(1), second_table->size());
+  EXPECT_TRUE(second_table->is_spilled());
+  EXPECT_EQ(manager.spill(1), third_table->size());
+  EXPECT_TRUE(third_table->is_spilled());
+  EXPECT_FALSE(first_table->is_spilled());
+
+  // tables being accessed are skipped
+  auto const accessor = first_table->access();
+  EXPECT_EQ(manager.spill(1), std::size_t{0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*first, accessor.view().column(0));
+}
+
+TEST_F(SpillingTest, SpillOnAllocationFailure)
+{
+  auto const first  = make_column(0);
+  auto const second = make_column(1);
+
+  cudf::spill_manager manager;
+  rmm::mr::limiting_resource_adaptor<rmm::mr::device_memory_resource> limited{
+    rmm::mr::get_current_device_resource(), 5 << 19};
+  cudf::spilling_resource_adaptor<rmm::mr::device_memory_resource> mr{&limited, &manager};
+
+  auto const first_table =
+    manager.make_spillable(cudf::table_view{{*first}}, cudf::default_stream_value, &mr);
+  auto const second_table =
+    manager.make_spillable(cudf::table_view{{*second}}, cudf::default_stream_value, &mr);
+  EXPECT_FALSE(first_table->is_spilled());
+
+  // the allocation only succeeds once the least recently accessed table is spilled
+  rmm::device_buffer buffer(1 << 20, cudf::default_stream_value, &mr);
+  EXPECT_TRUE(first_table->is_spilled());
+  EXPECT_FALSE(second_table->is_spilled());
+
+  // reloading the first table spills the second one
+  auto const accessor = first_table->access(cudf::default_stream_value, &mr);
+  EXPECT_TRUE(second_table->is_spilled());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*first, accessor.view().column(0));
+
+  // nothing is left to spill
+  EXPECT_THROW(rmm::device_buffer(1 << 20, cudf::default_stream_value, &mr), rmm::bad_alloc);
+}
+
+TEST_F(SpillingTest, InvalidCompression)
+{
+  EXPECT_THROW(cudf::spill_manager{cudf::io::compression_type::GZIP}, cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
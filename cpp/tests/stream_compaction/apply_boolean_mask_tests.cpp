@@ -14,12 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -31,6 +33,9 @@
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <vector>
 
 struct ApplyBooleanMask : public cudf::test::BaseFixture {
 };
@@ -373,4 +378,69 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, FilterExpression)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 0, 1, 1, 1}};
+  cudf::test::strings_column_wrapper col2{"a", "b", "c", "d", "e", "f"};
+  cudf::table_view input{{col1, col2}};
+
+  // col1 > 8 is null on the third row, which is dropped
+  auto threshold  = cudf::numeric_scalar<int32_t>(8);
+  auto literal    = cudf::ast::literal(threshold);
+  auto col_ref    = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, literal);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected{10, 40, 10};
+  cudf::test::strings_column_wrapper col2_expected{"a", "b", "f"};
+  cudf::table_view expected{{col1_expected, col2_expected}};
+
+  auto got = cudf::filter(input, expression);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, got->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    cudf::apply_boolean_mask(input, cudf::compute_column(input, expression)->view())->view(),
+    got->view());
+}
+
+TEST_F(ApplyBooleanMask, FilterExpressionLarge)
+{
+  auto const size = 10000;
+  auto values     = thrust::make_counting_iterator(0);
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(values, values + size, validity);
+  cudf::table_view input{{col1}};
+
+  // col1 % 3 == 0
+  auto divisor         = cudf::numeric_scalar<int32_t>(3);
+  auto zero            = cudf::numeric_scalar<int32_t>(0);
+  auto divisor_literal = cudf::ast::literal(divisor);
+  auto zero_literal    = cudf::ast::literal(zero);
+  auto col_ref         = cudf::ast::column_reference(0);
+  auto modulo     = cudf::ast::operation(cudf::ast::ast_operator::MOD, col_ref, divisor_literal);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, modulo, zero_literal);
+
+  auto expected_values = std::vector<int32_t>{};
+  for (auto i = 0; i < size; ++i) {
+    if (i % 7 != 0 && i % 3 == 0) { expected_values.push_back(i); }
+  }
+  cudf::test::fixed_width_column_wrapper<int32_t> col1_expected(expected_values.begin(),
+                                                                expected_values.end());
+
+  auto got = cudf::filter(input, expression);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(col1_expected, got->get_column(0));
+}
+
+TEST_F(ApplyBooleanMask, FilterExpressionNotBoolean)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{10, 40, 70};
+  cudf::table_view input{{col1}};
+
+  auto col_ref    = cudf::ast::column_reference(0);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref, col_ref);
+
+  EXPECT_THROW(cudf::filter(input, expression), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cmath>
+#include <vector>
+
+struct ApproxDistinctCount : public cudf::test::BaseFixture {
+};
+
+namespace {
+constexpr double tolerance = 0.05;
+
+void expect_near_count(int64_t expected, int64_t result)
+{
+  EXPECT_LE(std::abs(static_cast<double>(result - expected)), tolerance * expected);
+}
+
+std::vector<int64_t> to_host_estimates(cudf::column_view const& sketches)
+{
+  auto const estimates = cudf::estimate_distinct_count(cudf::lists_column_view{sketches});
+  return cudf::test::to_host<int64_t>(estimates->view()).first;
+}
+}  // namespace
+
+TEST_F(ApproxDistinctCount, Column)
+{
+  auto values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return i % 50000; });
+  auto valids = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return i < 100000; });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(values, values + 120000, valids);
+
+  expect_near_count(50000, cudf::approx_distinct_count(input));
+  expect_near_count(50000, cudf::approx_distinct_count(input, 16));
+
+  cudf::test::strings_column_wrapper small({"a", "b", "a", "c", "b"});
+  EXPECT_EQ(3, cudf::approx_distinct_count(small));
+  EXPECT_THROW(cudf::approx_distinct_count(small, 3), cudf::logic_error);
+}
+
+TEST_F(ApproxDistinctCount, MergedSketchesMatchSingleSketch)
+{
+  auto values = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                                [](auto i) { return i % 20000; });
+  auto keys   = thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                              [](auto i) { return i % 2; });
+  cudf::test::fixed_width_column_wrapper<int64_t> values_col(values, values + 60000);
+  cudf::test::fixed_width_column_wrapper<int32_t> keys_col(keys, keys + 60000);
+
+  // one sketch per key, each summarizing 10000 distinct values
+  cudf::groupby::groupby gb(cudf::table_view{{keys_col}});
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values_col;
+  requests[0].aggregations.push_back(cudf::make_hll_aggregation<cudf::groupby_aggregation>());
+  auto const result   = gb.aggregate(requests);
+  auto const sketches = result.second[0].results[0]->view();
+  for (auto const estimate : to_host_estimates(sketches)) {
+    expect_near_count(10000, estimate);
+  }
+
+  auto const list_type = cudf::data_type{cudf::type_id::LIST};
+  auto const merged =
+    cudf::reduce(sketches, cudf::make_merge_hll_aggregation<cudf::reduce_aggregation>(), list_type);
+  auto const direct =
+    cudf::reduce(values_col, cudf::make_hll_aggregation<cudf::reduce_aggregation>(), list_type);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(static_cast<cudf::list_scalar*>(direct.get())->view(),
+                                 static_cast<cudf::list_scalar*>(merged.get())->view());
+
+  auto const merged_column = cudf::make_column_from_scalar(*merged, 1);
+  expect_near_count(20000, to_host_estimates(merged_column->view()).front());
+}
+
+TEST_F(ApproxDistinctCount, NullsAndEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> all_nulls({1, 2, 3}, {0, 0, 0});
+  auto const list_type = cudf::data_type{cudf::type_id::LIST};
+  auto const sketch =
+    cudf::reduce(all_nulls, cudf::make_hll_aggregation<cudf::reduce_aggregation>(6), list_type);
+  ASSERT_TRUE(sketch->is_valid());
+  EXPECT_EQ(64, static_cast<cudf::list_scalar*>(sketch.get())->view().size());
+  EXPECT_EQ(0, cudf::approx_distinct_count(all_nulls));
+
+
+  // an empty sketch of 16 registers and a null sketch
+  cudf::test::lists_column_wrapper<uint8_t> sketches(
+    {{0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {}}, cudf::test::iterators::null_at(1));
+  auto const estimates = cudf::estimate_distinct_count(cudf::lists_column_view{sketches});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int64_t>({0, 0}, cudf::test::iterators::null_at(1)),
+    estimates->view());
+}
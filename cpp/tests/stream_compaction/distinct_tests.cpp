@@ -124,6 +124,47 @@ TEST_F(DistinctKeepFirstLastNone, StringKeyColumn)
   }
 }
 
+TEST_F(DistinctKeepFirstLastNone, Indices)
+{
+  auto const keys =
+    strings_col{{"all", "new", "new", "all", "" /*NULL*/, "the", "strings"}, null_at(4)};
+  auto const input = cudf::table_view{{keys}};
+
+  auto const sorted_indices = [&](auto keep) {
+    auto const indices = cudf::distinct_indices(input, keep);
+    return cudf::sort(cudf::table_view{{*indices}});
+  };
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col({0, 1, 4, 5, 6}),
+                                 sorted_indices(KEEP_FIRST)->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col({2, 3, 4, 5, 6}),
+                                 sorted_indices(KEEP_LAST)->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(int32s_col({4, 5, 6}), sorted_indices(KEEP_NONE)->get_column(0));
+  EXPECT_EQ(5, cudf::distinct_indices(input)->size());
+}
+
+TEST_F(DistinctKeepAny, IndicesAndCounts)
+{
+  auto const keys =
+    strings_col{{"all", "new", "new", "all", "" /*NULL*/, "the", "strings"}, null_at(4)};
+  auto const input = cudf::table_view{{keys}};
+
+  auto const [indices, counts] = cudf::distinct_indices_and_counts(input);
+  auto const distinct_keys     = cudf::gather(input, *indices);
+  auto const result_sort       = cudf::sort_by_key(
+    cudf::table_view{{distinct_keys->get_column(0), *counts}}, distinct_keys->view());
+
+  auto const exp_keys_sort =
+    strings_col{{"" /*NULL*/, "all", "new", "strings", "the"}, null_at(0)};
+  auto const exp_counts_sort = int32s_col{{1, 2, 2, 1, 1}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{exp_keys_sort, exp_counts_sort}},
+                                *result_sort);
+
+  auto const [empty_indices, empty_counts] =
+    cudf::distinct_indices_and_counts(cudf::table_view{{strings_col{}}});
+  EXPECT_EQ(0, empty_indices->size());
+  EXPECT_EQ(0, empty_counts->size());
+}
+
 TEST_F(DistinctKeepAny, EmptyInputTable)
 {
   int32s_col col(std::initializer_list<int32_t>{});
@@ -64,6 +64,23 @@ TEST_F(DropNullsTest, NoNull)
   CUDF_TEST_EXPECT_TABLES_EQUAL(input, got->view());
 }
 
+TEST_F(DropNullsTest, NoNullSharesTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10}, {1, 1, 1, 1, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"a", "b", "c", "d", "e", "f"}, {1, 1, 0, 1, 1, 1}};
+  cudf::table input{cudf::table_view{{col1, col2}}};
+
+  auto got = cudf::drop_nulls(input, {0});
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input.view(), got->view());
+  EXPECT_EQ(input.view().column(0).head(), got->view().column(0).head());
+  EXPECT_EQ(input.view().column(1).null_mask(), got->view().column(1).null_mask());
+
+  // nulls in the keys are dropped as for a table_view
+  auto const dropped = cudf::drop_nulls(input, {0, 1});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::drop_nulls(input.view(), {0, 1}), dropped->view());
+}
+
 TEST_F(DropNullsTest, MixedSetOfRows)
 {
   cudf::test::fixed_width_column_wrapper<int16_t> col1{{true, false, true, false, true, false},
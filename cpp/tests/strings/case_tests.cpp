@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/capitalize.hpp>
 #include <cudf/strings/case.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -97,6 +98,30 @@ TEST_F(StringsCaseTest, Swapcase)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsCaseTest, Ascii)
+{
+  // ASCII-only columns are converted byte-wise
+  cudf::test::strings_column_wrapper strings(
+    {"Examples aBc", "123 456", "", "ARE THE", "[at]-{zA}@`", "test Strings"}, {1, 1, 0, 1, 1, 1});
+  auto const sliced = cudf::slice(strings, {1, 6}).front();
+  auto strings_view = cudf::strings_column_view(sliced);
+
+  auto results = cudf::strings::to_lower(strings_view);
+  cudf::test::strings_column_wrapper expected_lower(
+    {"123 456", "", "are the", "[at]-{za}@`", "test strings"}, {1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_lower);
+
+  results = cudf::strings::to_upper(strings_view);
+  cudf::test::strings_column_wrapper expected_upper(
+    {"123 456", "", "ARE THE", "[AT]-{ZA}@`", "TEST STRINGS"}, {1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_upper);
+
+  results = cudf::strings::swapcase(strings_view);
+  cudf::test::strings_column_wrapper expected_swap(
+    {"123 456", "", "are the", "[AT]-{Za}@`", "TEST sTRINGS"}, {1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_swap);
+}
+
 TEST_F(StringsCaseTest, Capitalize)
 {
   cudf::test::strings_column_wrapper strings(
@@ -204,6 +229,37 @@ TEST_F(StringsCaseTest, MultiCharLower)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsCaseTest, MultiCharSlicedWithNulls)
+{
+  cudf::test::strings_column_wrapper input(
+    {"abc", "H\u00e9llo", "", "\u0149\u00e9", "", "\u1f52 \ufb05", "", "\u0130\u00d6", "xyz"},
+    {1, 1, 0, 1, 1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(input, {1, 8}).front();
+  auto const view   = cudf::strings_column_view(sliced);
+
+  auto results = cudf::strings::to_upper(view);
+  cudf::test::strings_column_wrapper expected_upper({"H\u00c9LLO",
+                                                     "",
+                                                     "\u02bc\u004e\u00c9",
+                                                     "",
+                                                     "\u03a5\u0313\u0300 \u0053\u0054",
+                                                     "",
+                                                     "\u0130\u00d6"},
+                                                    {1, 0, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_upper);
+
+  results = cudf::strings::to_lower(view);
+  cudf::test::strings_column_wrapper expected_lower({"h\u00e9llo",
+                                                     "",
+                                                     "\u0149\u00e9",
+                                                     "",
+                                                     "\u1f52 \ufb05",
+                                                     "",
+                                                     "\u0069\u0307\u00f6"},
+                                                    {1, 0, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_lower);
+}
+
 TEST_F(StringsCaseTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/combine.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -24,6 +26,10 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 
+#include <optional>
+#include <string>
+#include <vector>
+
 using namespace cudf::test::iterators;
 
 struct StringsListsConcatenateTest : public cudf::test::BaseFixture {
@@ -582,3 +588,107 @@ TEST_F(StringsListsConcatenateTest, SlicedListsWithColumnSeparators)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected, verbosity);
   }
 }
+
+namespace {
+/**
+ * @brief Joins the strings of each list on the host, as `join_list_elements` with a scalar
+ * separator and `output_if_empty_list::EMPTY_STRING` does.
+ */
+std::vector<std::optional<std::string>> host_join_list_elements(
+  std::vector<std::vector<std::optional<std::string>>> const& lists,
+  std::string const& separator,
+  std::optional<std::string> const& narep,
+  cudf::strings::separator_on_nulls separate_nulls)
+{
+  std::vector<std::optional<std::string>> results;
+  for (auto const& list : lists) {
+    std::string result;
+    bool is_null         = false;
+    bool has_valid       = false;
+    bool write_separator = false;
+    for (auto const& str : list) {
+      if (!str && !narep) {
+        is_null = true;
+        break;
+      }
+      if (write_separator &&
+          (separate_nulls == cudf::strings::separator_on_nulls::YES || str.has_value())) {
+        result += separator;
+        write_separator = false;
+      }
+      result += str ? *str : *narep;
+      has_valid       = has_valid || str.has_value();
+      write_separator = write_separator ||
+                        separate_nulls == cudf::strings::separator_on_nulls::YES ||
+                        str.has_value();
+    }
+    if (is_null) {
+      results.emplace_back(std::nullopt);
+    } else {
+      results.emplace_back(has_valid ? result : std::string{});
+    }
+  }
+  return results;
+}
+}  // namespace
+
+TEST_F(StringsListsConcatenateTest, LongLists)
+{
+  // Lists longer than a warp of threads are joined by a warp each, and shorter lists by a thread
+  std::vector<cudf::size_type> const list_sizes{3, 100, 0, 65, 200, 64, 33, 70, 1000};
+  std::vector<std::vector<std::optional<std::string>>> h_lists;
+  std::vector<std::string> h_strings;
+  std::vector<bool> h_valids;
+  std::vector<cudf::size_type> h_offsets{0};
+  for (std::size_t i = 0; i < list_sizes.size(); ++i) {
+    h_lists.emplace_back();
+    for (cudf::size_type j = 0; j < list_sizes[i]; ++j) {
+      // one list has nulls only
+      auto const is_valid = i != 7 && (i * 7 + j) % 11 != 0;
+      h_strings.emplace_back(1 + (i + j) % 5, static_cast<char>('a' + j % 26));
+      h_valids.push_back(is_valid);
+      h_lists.back().emplace_back(is_valid ? std::optional{h_strings.back()} : std::nullopt);
+    }
+    h_offsets.push_back(static_cast<cudf::size_type>(h_strings.size()));
+  }
+  auto strings = STR_COL(h_strings.begin(), h_strings.end(), h_valids.begin());
+  auto offsets =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>(h_offsets.begin(), h_offsets.end());
+  auto const string_lists = cudf::make_lists_column(static_cast<cudf::size_type>(h_lists.size()),
+                                                    offsets.release(),
+                                                    strings.release(),
+                                                    0,
+                                                    rmm::device_buffer{});
+  auto const string_lv = cudf::lists_column_view(string_lists->view());
+
+  auto const to_column = [](std::vector<std::optional<std::string>> const& h_results) {
+    auto const valids = cudf::detail::make_counting_transform_iterator(
+      0, [&](auto i) { return h_results[i].has_value(); });
+    auto const values = cudf::detail::make_counting_transform_iterator(
+      0, [&](auto i) { return h_results[i].value_or(""); });
+    return STR_COL(values, values + h_results.size(), valids);
+  };
+
+  for (auto const separate_nulls :
+       {cudf::strings::separator_on_nulls::YES, cudf::strings::separator_on_nulls::NO}) {
+    for (auto const& narep : {std::optional<std::string>{}, std::optional<std::string>{"__"}}) {
+      auto const d_narep = cudf::string_scalar(narep.value_or(""), narep.has_value());
+      auto const results = cudf::strings::join_list_elements(
+        string_lv, cudf::string_scalar("+"), d_narep, separate_nulls);
+      auto const expected =
+        to_column(host_join_list_elements(h_lists, "+", narep, separate_nulls));
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected, verbosity);
+    }
+  }
+
+  // The separators of a column are applied the same way
+  auto const separators = STR_COL{"+", "+", "+", "+", "+", "+", "+", "+", "+"};
+  auto const results    = cudf::strings::join_list_elements(string_lv,
+                                                         cudf::strings_column_view(separators),
+                                                         cudf::string_scalar("", false),
+                                                         cudf::string_scalar("__"));
+
+  auto const expected = to_column(host_join_list_elements(
+    h_lists, "+", std::string{"__"}, cudf::strings::separator_on_nulls::YES));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected, verbosity);
+}
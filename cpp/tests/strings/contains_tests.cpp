@@ -16,6 +16,7 @@
 
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -27,6 +28,7 @@
 #include <thrust/iterator/transform_iterator.h>
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 struct StringsContainsTests : public cudf::test::BaseFixture {
@@ -373,6 +375,42 @@ TEST_F(StringsContainsTests, CountTest)
   }
 }
 
+TEST_F(StringsContainsTests, CountManyRows)
+{
+  // enough rows for many blocks, so that the state data of each block's threads is exercised
+  // whether it is in shared memory (small pattern) or in global memory (log pattern)
+  std::vector<std::string> const h_rows{
+    "2022-05-01 12:00:01 ERROR [main] disk full 12:30",
+    "2022-05-01 12:00:02 INFO [worker-3] done",
+    "no timestamp here",
+    ""};
+  auto const num_rows = 10000;
+  auto const rows_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator(0), [&h_rows](auto idx) {
+      return h_rows[idx % h_rows.size()];
+    });
+  cudf::test::strings_column_wrapper strings(rows_begin, rows_begin + num_rows);
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto const expected = [num_rows](std::vector<int32_t> const& counts) {
+    auto const counts_begin =
+      thrust::make_transform_iterator(thrust::make_counting_iterator(0),
+                                      [&counts](auto idx) { return counts[idx % counts.size()]; });
+    return cudf::test::fixed_width_column_wrapper<int32_t>(counts_begin, counts_begin + num_rows);
+  };
+  {
+    auto results = cudf::strings::count_re(strings_view, "\\d+:\\d+");
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected({2, 1, 0, 0}));
+  }
+  {
+    auto results = cudf::strings::count_re(
+      strings_view,
+      "(\\d{4})-(\\d{2})-(\\d{2}) (\\d{2}):(\\d{2}):(\\d{2}) (ERROR|WARN|INFO) "
+      "\\[([a-z]+(-\\d+)?)\\] ([a-z ]+)");
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected({1, 1, 0, 0}));
+  }
+}
+
 TEST_F(StringsContainsTests, FixedQuantifier)
 {
   auto input = cudf::test::strings_column_wrapper({"a", "aa", "aaa", "aaaa", "aaaaa", "aaaaaa"});
@@ -521,6 +559,85 @@ TEST_F(StringsContainsTests, DotAll)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_count);
 }
 
+TEST_F(StringsContainsTests, SimplePatterns)
+{
+  // patterns without word boundaries or multiline anchors are evaluated with a DFA
+  auto input = cudf::test::strings_column_wrapper(
+    {"abc123", "", "éa1", "xyz", "a\nb", "123-4567", "", "ab€c"}, {1, 1, 1, 1, 1, 1, 0, 1});
+  auto view = cudf::strings_column_view(input);
+
+  auto results  = cudf::strings::contains_re(view, "a[bc]?\\d");
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 1, 0, 0, 0, 0, 0},
+                                                               {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::contains_re(view, "c\\d+$");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::contains_re(view, "a.b");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::contains_re(view, "b\\W");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0, 0, 0, 1},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::contains_re(view, "^$");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 1, 0, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results  = cudf::strings::matches_re(view, "\\d{3}-\\d{4}");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0, 1, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::matches_re(view, "(a|x)[a-z]");
+  expected = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 1, 0, 0, 0, 1},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  results  = cudf::strings::matches_re(view, ".a", cudf::strings::regex_flags::DOTALL);
+  expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 1, 0, 0, 0, 0, 0},
+                                                          {1, 1, 1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsContainsTests, RegexProgram)
+{
+  auto input = cudf::test::strings_column_wrapper({"abc 123", "", "def", "a1b2", "xyz"},
+                                                  {1, 1, 1, 1, 0});
+  auto view  = cudf::strings_column_view(input);
+
+  auto const prog = cudf::strings::regex_program::create("\\d");
+  EXPECT_EQ(prog->pattern(), "\\d");
+  EXPECT_EQ(prog->flags(), cudf::strings::regex_flags::DEFAULT);
+  EXPECT_EQ(prog->groups_count(), 0);
+
+  // the same program is reused by each call
+  for (int i = 0; i < 2; ++i) {
+    auto results           = cudf::strings::contains_re(view, *prog);
+    auto expected_contains = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 1, 0},
+                                                                          {1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_contains);
+    results               = cudf::strings::matches_re(view, *prog);
+    auto expected_matches = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 0, 0, 0},
+                                                                         {1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_matches);
+    results             = cudf::strings::count_re(view, *prog);
+    auto expected_count = cudf::test::fixed_width_column_wrapper<int32_t>({3, 0, 0, 2, 0},
+                                                                          {1, 1, 1, 1, 0});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_count);
+  }
+
+  auto const prog_ml =
+    cudf::strings::regex_program::create("^d", cudf::strings::regex_flags::MULTILINE);
+  EXPECT_EQ(prog_ml->flags(), cudf::strings::regex_flags::MULTILINE);
+  auto results  = cudf::strings::contains_re(view, *prog_ml);
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>({0, 0, 1, 0, 0}, {1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  EXPECT_THROW(cudf::strings::regex_program::create("(3?)+"), cudf::logic_error);
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
@@ -16,12 +16,17 @@
 
 #include <tests/strings/utilities.h>
 
+#include <src/strings/count_matches.hpp>
+
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/extract.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table_view.hpp>
@@ -231,6 +236,46 @@ TEST_F(StringsExtractTests, ExtractAllTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), expected);
 }
 
+TEST_F(StringsExtractTests, ExtractAllEmptyMatches)
+{
+  cudf::test::strings_column_wrapper input({"bab", "", "aa", "b", "", "xaax"}, {1, 1, 1, 1, 0, 1});
+  auto view = cudf::strings_column_view(input);
+
+  auto results = cudf::strings::extract_all_record(view, "(a*)");
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"", "a", "", ""},
+                LCW{""},
+                LCW{"aa", ""},
+                LCW{"", ""},
+                LCW{},
+                LCW{"", "aa", "", ""}},
+               {1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
+TEST_F(StringsExtractTests, ExtractAllMatchPositionsFallback)
+{
+  // too many bytes to record the match positions so the regex is evaluated again for the output
+  std::string const str = "abc 12 de 345 f";
+  auto const num_rows   = static_cast<cudf::size_type>(
+    cudf::strings::detail::MAX_MATCH_POSITIONS_MEM / sizeof(cudf::strings::detail::match_pair) /
+      (str.size() + 1) +
+    1);
+  auto input = cudf::make_column_from_scalar(cudf::string_scalar(str), num_rows);
+
+  auto results =
+    cudf::strings::extract_all_record(cudf::strings_column_view(input->view()), "(\\d+) (\\w+)");
+  EXPECT_EQ(results->size(), num_rows);
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"12", "de", "345", "f"}, LCW{"12", "de", "345", "f"}});
+  auto const first = cudf::slice(results->view(), {0, 2}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(first, expected);
+  auto const last = cudf::slice(results->view(), {num_rows - 2, num_rows}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(last, expected);
+}
+
 TEST_F(StringsExtractTests, Errors)
 {
   cudf::test::strings_column_wrapper input({"this column intentionally left blank"});
@@ -14,11 +14,14 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/types.hpp>
@@ -33,10 +36,13 @@
 
 #include <thrust/execution_policy.h>
 #include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 
 #include <cstring>
+#include <limits>
 #include <vector>
 
 struct StringsFactoriesTest : public cudf::test::BaseFixture {
@@ -222,3 +228,125 @@ TEST_F(StringsFactoriesTest, StringPairWithNullsAndEmpty)
   auto result = cudf::make_strings_column(pairs);
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->view(), data);
 }
+
+namespace {
+/**
+ * @brief Writes each string twice, for checking the strings children utilities
+ */
+struct repeat_twice_fn {
+  cudf::column_device_view const d_strings;
+  int32_t* d_offsets{};
+  char* d_chars{};
+  cudf::size_type* d_sizes{};
+
+  __device__ void operator()(cudf::size_type idx)
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) { d_offsets[idx] = 0; }
+      return;
+    }
+    auto const d_str = d_strings.element<cudf::string_view>(idx);
+    auto const bytes = 2 * d_str.size_bytes();
+    if (!d_chars) {
+      d_offsets[idx] = bytes;
+      return;
+    }
+    auto d_output = d_chars + d_offsets[idx];
+    memcpy(d_output, d_str.data(), d_str.size_bytes());
+    memcpy(d_output + d_str.size_bytes(), d_str.data(), d_str.size_bytes());
+    if (d_sizes) { d_sizes[idx] = bytes; }
+  }
+};
+
+/**
+ * @brief Output size bound of `repeat_twice_fn`: `factor` times the input size plus `extra` bytes
+ */
+struct repeat_twice_bound_fn {
+  int32_t const* d_offsets;
+  int64_t const factor;
+  int64_t const extra;
+
+  __device__ int64_t operator()(cudf::size_type idx) const
+  {
+    return factor * (d_offsets[idx + 1] - d_offsets[idx]) + extra;
+  }
+};
+
+/**
+ * @brief Builds the output of `repeat_twice_fn` with `make_strings_children_bounded`
+ */
+std::unique_ptr<cudf::column> make_repeat_twice_column(cudf::column_view const& input,
+                                                       int64_t bound_factor,
+                                                       int64_t bound_extra)
+{
+  auto const strings    = cudf::strings_column_view(input);
+  auto const d_input    = cudf::column_device_view::create(input);
+  auto const bounds     = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    repeat_twice_bound_fn{strings.offsets_begin(), bound_factor, bound_extra});
+  auto [offsets, chars] = cudf::strings::detail::make_strings_children_bounded(
+    repeat_twice_fn{*d_input}, bounds, input.size(), cudf::default_stream_value);
+  return cudf::make_strings_column(input.size(),
+                                   std::move(offsets),
+                                   std::move(chars),
+                                   input.null_count(),
+                                   cudf::copy_bitmask(input));
+}
+
+/**
+ * @brief Builds the output of `repeat_twice_fn` with `make_strings_children`
+ */
+std::unique_ptr<cudf::column> make_repeat_twice_column(cudf::column_view const& input)
+{
+  auto const d_input    = cudf::column_device_view::create(input);
+  auto [offsets, chars] = cudf::strings::detail::make_strings_children(
+    repeat_twice_fn{*d_input}, input.size(), cudf::default_stream_value);
+  return cudf::make_strings_column(input.size(),
+                                   std::move(offsets),
+                                   std::move(chars),
+                                   input.null_count(),
+                                   cudf::copy_bitmask(input));
+}
+}  // namespace
+
+TEST_F(StringsFactoriesTest, StringsChildrenBounded)
+{
+  cudf::test::strings_column_wrapper input(
+    {"", "abc", "", "dé", "", "fghij", "klmnopq", "", "r", "stüvw"},
+    {1, 1, 0, 1, 1, 1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper expected(
+    {"", "abcabc", "", "dédé", "", "fghijfghij", "", "", "rr", "stüvwstüvw"},
+    {1, 1, 0, 1, 1, 1, 0, 1, 1, 1});
+
+  auto const sliced          = cudf::slice(input, {1, 9}).front();
+  auto const sliced_expected = cudf::slice(expected, {1, 9}).front();
+
+  for (auto const& [view, expected_view] :
+       {std::pair{cudf::column_view(input), cudf::column_view(expected)},
+        std::pair{sliced, sliced_expected}}) {
+    auto const two_pass = make_repeat_twice_column(view);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(two_pass->view(), expected_view);
+
+    // exact bounds leave no gaps to compact
+    auto results = make_repeat_twice_column(view, 2, 0);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), two_pass->view());
+    // loose bounds, also given to the null rows
+    results = make_repeat_twice_column(view, 3, 5);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), two_pass->view());
+    // a total bound just over the size_type limit takes the two-pass path
+    auto const extra =
+      static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()) / view.size() + 1;
+    results = make_repeat_twice_column(view, 0, extra);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->view(), two_pass->view());
+  }
+}
+
+TEST_F(StringsFactoriesTest, StringsChildrenBoundedEmptyOutput)
+{
+  cudf::test::strings_column_wrapper input({"", "", "", ""}, {1, 0, 1, 0});
+  auto const sliced = cudf::slice(input, {1, 4}).front();
+
+  auto const results = make_repeat_twice_column(sliced, 2, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), sliced);
+  EXPECT_EQ(results->child(cudf::strings_column_view::chars_column_index).size(), 0);
+}
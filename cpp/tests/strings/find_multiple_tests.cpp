@@ -18,6 +18,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
@@ -56,6 +57,39 @@ TEST_F(StringsFindMultipleTest, FindMultiple)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsFindMultipleTest, ContainsMultiple)
+{
+  std::vector<const char*> h_strings{"Héllo", "thesé", nullptr, "lease", "test strings", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  std::vector<const char*> h_targets{"é", "a", "e", "i", "o", "u", "es", "", "ease"};
+  cudf::test::strings_column_wrapper targets(h_targets.begin(), h_targets.end());
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_multiple(strings_view, targets_view);
+  EXPECT_EQ(results->num_columns(), static_cast<cudf::size_type>(h_targets.size()));
+
+  std::vector<bool> validity{1, 1, 0, 1, 1, 1};
+  using BCW = cudf::test::fixed_width_column_wrapper<bool>;
+  std::vector<BCW> expected;
+  expected.emplace_back(BCW({1, 1, 0, 0, 0, 0}, validity.begin()));
+  expected.emplace_back(BCW({0, 0, 0, 1, 0, 0}, validity.begin()));
+  expected.emplace_back(BCW({0, 1, 0, 1, 1, 0}, validity.begin()));
+  expected.emplace_back(BCW({0, 0, 0, 0, 1, 0}, validity.begin()));
+  expected.emplace_back(BCW({1, 0, 0, 0, 0, 0}, validity.begin()));
+  expected.emplace_back(BCW({0, 0, 0, 0, 0, 0}, validity.begin()));
+  expected.emplace_back(BCW({0, 1, 0, 0, 1, 0}, validity.begin()));
+  expected.emplace_back(BCW({1, 1, 0, 1, 1, 1}, validity.begin()));
+  expected.emplace_back(BCW({0, 0, 0, 1, 0, 0}, validity.begin()));
+  for (std::size_t idx = 0; idx < expected.size(); ++idx) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(idx), expected[idx]);
+  }
+}
+
 TEST_F(StringsFindMultipleTest, ZeroSizeStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -82,4 +116,7 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
 
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
+
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, empty_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::contains_multiple(strings_view, strings_view), cudf::logic_error);
 }
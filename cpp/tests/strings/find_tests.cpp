@@ -26,6 +26,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct StringsFindTest : public cudf::test::BaseFixture {
@@ -102,6 +103,42 @@ TEST_F(StringsFindTest, ContainsLongStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected2);
 }
 
+TEST_F(StringsFindTest, VeryLongStrings)
+{
+  // strings longer than the internal threshold are searched by a block of threads per string
+  std::string const prefix(20000, 'a');
+  std::string const middle(5000, 'b');
+  std::vector<std::string> h_strings{prefix + "éxyz" + middle + "xyz",
+                                     "short xyz",
+                                     prefix + middle,
+                                     "xyz" + prefix + "é",
+                                     "",
+                                     prefix + "é" + middle + "xyz"};
+  auto const validity = std::vector<bool>{1, 1, 1, 1, 0, 1};
+  cudf::test::strings_column_wrapper strings(h_strings.begin(), h_strings.end(), validity.begin());
+  auto strings_view = cudf::strings_column_view(strings);
+  auto const target = cudf::string_scalar("xyz");
+
+  auto results = cudf::strings::find(strings_view, target);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({20001, 6, -1, 0, -1, 25001},
+                                                           validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::rfind(strings_view, target);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_r({25004, 6, -1, 0, -1, 25001},
+                                                             validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_r);
+
+  results = cudf::strings::contains(strings_view, target);
+  cudf::test::fixed_width_column_wrapper<bool> expected_c({1, 1, 0, 1, 0, 1}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_c);
+
+  // target at the very end of the string
+  results = cudf::strings::contains(strings_view, cudf::string_scalar("bxyz"));
+  cudf::test::fixed_width_column_wrapper<bool> expected_e({1, 0, 0, 0, 0, 1}, validity.begin());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_e);
+}
+
 TEST_F(StringsFindTest, StartsWith)
 {
   cudf::test::strings_column_wrapper strings({"Héllo", "thesé", "", "lease", "tést strings", ""},
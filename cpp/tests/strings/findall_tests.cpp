@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/findall.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -22,6 +25,8 @@
 #include <cudf_test/table_utilities.hpp>
 #include <tests/strings/utilities.h>
 
+#include <src/strings/count_matches.hpp>
+
 #include <thrust/iterator/transform_iterator.h>
 
 #include <vector>
@@ -99,6 +104,46 @@ TEST_F(StringsFindallTests, FindallRecord)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(StringsFindallTests, EmptyMatches)
+{
+  cudf::test::strings_column_wrapper input({"bab", "", "aa", "b", "", "xaax"}, {1, 1, 1, 1, 0, 1});
+  auto view = cudf::strings_column_view(input);
+
+  auto results = cudf::strings::findall_record(view, "a*");
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"", "a", "", ""},
+                LCW{""},
+                LCW{"aa", ""},
+                LCW{"", ""},
+                LCW{},
+                LCW{"", "aa", "", ""}},
+               {1, 1, 1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
+TEST_F(StringsFindallTests, MatchPositionsFallback)
+{
+  // too many bytes to record the match positions so the regex is evaluated again for the output
+  std::string const str = "abc 12 de 345 f";
+  auto const num_rows   = static_cast<cudf::size_type>(
+    cudf::strings::detail::MAX_MATCH_POSITIONS_MEM / sizeof(cudf::strings::detail::match_pair) /
+      (str.size() + 1) +
+    1);
+  auto input = cudf::make_column_from_scalar(cudf::string_scalar(str), num_rows);
+
+  auto results =
+    cudf::strings::findall_record(cudf::strings_column_view(input->view()), "(\\d+)");
+  EXPECT_EQ(results->size(), num_rows);
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  LCW expected({LCW{"12", "345"}, LCW{"12", "345"}});
+  auto const first = cudf::slice(results->view(), {0, 2}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(first, expected);
+  auto const last = cudf::slice(results->view(), {num_rows - 2, num_rows}).front();
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(last, expected);
+}
+
 TEST_F(StringsFindallTests, Multiline)
 {
   cudf::test::strings_column_wrapper input({"abc\nfff\nabc", "fff\nabc\nlll", "abc", "", "abc\n"});
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+
+#include <string>
+#include <vector>
+
+namespace {
+using strs_col   = cudf::test::strings_column_wrapper;
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+// Returns a copy of an unsliced strings column with INT64 offsets
+std::unique_ptr<cudf::column> with_int64_offsets(cudf::strings_column_view const& input)
+{
+  auto offsets = cudf::cast(input.offsets(), cudf::data_type{cudf::type_id::INT64});
+  return cudf::make_strings_column(input.size(),
+                                   std::move(offsets),
+                                   std::make_unique<cudf::column>(input.chars()),
+                                   input.null_count(),
+                                   cudf::copy_bitmask(input.parent()));
+}
+
+cudf::type_id offsets_type(cudf::column_view const& input)
+{
+  return cudf::strings_column_view(input).offsets().type().id();
+}
+}  // namespace
+
+struct StringsInt64OffsetsTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(StringsInt64OffsetsTest, Concatenate)
+{
+  auto const input  = strs_col({"abc", "", "de", "fghij", "k"}, {1, 0, 1, 1, 1});
+  auto const wide   = with_int64_offsets(input);
+  auto const other  = strs_col{"lm", "nopq"};
+  auto const sliced = cudf::slice(wide->view(), {1, 4}).front();
+
+  auto const results =
+    cudf::concatenate(std::vector<cudf::column_view>{sliced, other, wide->view()});
+  auto const expected = strs_col({"", "de", "fghij", "lm", "nopq", "abc", "", "de", "fghij", "k"},
+                                 {0, 1, 1, 1, 1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  EXPECT_EQ(offsets_type(*results), cudf::type_id::INT64);
+
+  // columns of INT32 offsets only keep INT32 offsets
+  auto const narrow = cudf::concatenate(std::vector<cudf::column_view>{input, other});
+  EXPECT_EQ(offsets_type(*narrow), cudf::type_id::INT32);
+}
+
+TEST_F(StringsInt64OffsetsTest, ConcatenateLongStrings)
+{
+  // long strings are copied with a memcpy per column instead of the fused kernel
+  auto const long_str = std::string(1 << 20, 'x');
+  auto const input    = strs_col{long_str, "a", long_str};
+  auto const wide     = with_int64_offsets(input);
+
+  auto const results  = cudf::concatenate(std::vector<cudf::column_view>{wide->view(), input});
+  auto const expected = cudf::concatenate(std::vector<cudf::column_view>{input, input});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+  EXPECT_EQ(offsets_type(*results), cudf::type_id::INT64);
+}
+
+TEST_F(StringsInt64OffsetsTest, Gather)
+{
+  auto const long_str = std::string(100, 'y');
+  auto const input    = strs_col({"abc", "", "de", long_str, "k"}, {1, 0, 1, 1, 1});
+  auto const wide     = with_int64_offsets(input);
+  auto const map      = int32s_col{4, 0, 1, 3, 3, 2};
+
+  auto const results  = cudf::gather(cudf::table_view{{wide->view()}}, map);
+  auto const expected = cudf::gather(cudf::table_view{{input}}, map);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected->get_column(0));
+  EXPECT_EQ(offsets_type(results->get_column(0)), cudf::type_id::INT64);
+
+  auto const sliced         = cudf::slice(wide->view(), {2, 5}).front();
+  auto const sliced_results = cudf::gather(cudf::table_view{{sliced}}, int32s_col{2, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(sliced_results->get_column(0), strs_col{"k", "de"});
+}
+
+TEST_F(StringsInt64OffsetsTest, Overflow)
+{
+  // 2048 copies of a 1MB string exceed the size_type limit of the chars child
+  auto const long_str = std::string(1 << 20, 'x');
+  auto const input    = strs_col{long_str};
+  auto const wide     = with_int64_offsets(input);
+
+  std::vector<cudf::column_view> const views(2048, wide->view());
+  EXPECT_THROW(cudf::concatenate(views), cudf::logic_error);
+
+  auto const zeros = thrust::make_constant_iterator(0);
+  auto const map   = int32s_col(zeros, zeros + 2048);
+  EXPECT_THROW(cudf::gather(cudf::table_view{{wide->view()}}, map), cudf::logic_error);
+}
+
+TEST_F(StringsInt64OffsetsTest, OffsetsIteratorRequiresInt32)
+{
+  auto const input = strs_col{"abc", "de"};
+  auto const wide  = with_int64_offsets(input);
+  EXPECT_THROW((void)cudf::strings_column_view(wide->view()).offsets_begin(), cudf::logic_error);
+  EXPECT_NO_THROW((void)cudf::strings_column_view(input).offsets_begin());
+}
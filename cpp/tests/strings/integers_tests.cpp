@@ -238,6 +238,35 @@ TEST_F(StringsConvertTest, ToInteger)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_u32);
 }
 
+TEST_F(StringsConvertTest, ToIntegerLongDigits)
+{
+  // runs of 8 or more digits are converted 8 digits at a time
+  cudf::test::strings_column_wrapper strings({"9223372036854775807",
+                                              "-9223372036854775807",
+                                              "00000000000000000042",
+                                              "12345678x90",
+                                              "123456789012",
+                                              "+1234567890123456"});
+  auto results = cudf::strings::to_integers(cudf::strings_column_view(strings),
+                                            cudf::data_type{cudf::type_id::INT64});
+  cudf::test::fixed_width_column_wrapper<int64_t> expected({9223372036854775807L,
+                                                            -9223372036854775807L,
+                                                            42L,
+                                                            12345678L,
+                                                            123456789012L,
+                                                            1234567890123456L});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  auto strs = cudf::strings::from_integers(expected);
+  cudf::test::strings_column_wrapper expected_strs({"9223372036854775807",
+                                                    "-9223372036854775807",
+                                                    "42",
+                                                    "12345678",
+                                                    "123456789012",
+                                                    "1234567890123456"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*strs, expected_strs);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
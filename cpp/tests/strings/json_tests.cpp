@@ -22,6 +22,9 @@
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <string>
+#include <vector>
+
 // reference:  https://jsonpath.herokuapp.com/
 
 // clang-format off
@@ -1012,4 +1015,46 @@ TEST_F(JsonPathTests, MissingFieldsAsNulls)
   do_test("$.tup[*].array", "[[1,2],[3,4]]", "[[1,2],null,[3,4],null]");
   do_test("$.x[*].array", "", "null", false);
   do_test("$.tup[*].a.x", "[\"5\"]", "[null,null,null,\"5\"]");
-}
\ No newline at end of file
+}
+
+TEST_F(JsonPathTests, MultiplePaths)
+{
+  cudf::test::strings_column_wrapper input{
+    {json_string, R"({"store": {"bicycle": {"price": 7}}, "expensive": 3})", "", "{}", "["},
+    {1, 1, 1, 0, 1}};
+
+  // paths sharing leading operators, in no particular order, with an empty and a repeated path
+  std::vector<std::string> const paths{"$.store.book[*].title",
+                                       "$.expensive",
+                                       "$.store.bicycle.price",
+                                       "",
+                                       "$.store.book[1].author",
+                                       "$.store.bicycle",
+                                       "$.store.book[2]['isbn']",
+                                       "$.store.bicycle.price",
+                                       "$.store.missing.price",
+                                       "$"};
+  std::vector<cudf::string_scalar> json_paths(paths.begin(), paths.end());
+
+  auto do_test = [&](cudf::strings::get_json_object_options options) {
+    auto const results =
+      cudf::strings::get_json_object(cudf::strings_column_view(input), json_paths, options);
+    ASSERT_EQ(results->num_columns(), static_cast<cudf::size_type>(paths.size()));
+    for (size_t i = 0; i < paths.size(); i++) {
+      auto const expected = cudf::strings::get_json_object(
+        cudf::strings_column_view(input), cudf::string_scalar(paths[i]), options);
+      CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*expected, results->get_column(i).view());
+    }
+  };
+
+  cudf::strings::get_json_object_options options;
+  do_test(options);
+  options.set_missing_fields_as_nulls(true);
+  do_test(options);
+
+  // invalid paths fail as with a single path
+  std::vector<cudf::string_scalar> invalid_paths{cudf::string_scalar("$.a"),
+                                                 cudf::string_scalar("$.store[")};
+  EXPECT_THROW(cudf::strings::get_json_object(cudf::strings_column_view(input), invalid_paths),
+               cudf::logic_error);
+}
@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/replace.hpp>
 #include <cudf/strings/strings_column_view.hpp>
@@ -135,6 +136,39 @@ TEST_F(StringsReplaceTest, ReplaceReplLimitInputSliced)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceGrowingSlicedWithNulls)
+{
+  // the replacement is longer than the target so the row-parallel output is written into
+  // strings sized from the most targets each row can hold
+  cudf::test::strings_column_wrapper input(
+    {"aaaa", "abab", "", "bbb", "", "a", "aaa", "bab", "ba"}, {1, 1, 0, 1, 1, 1, 1, 0, 1});
+  cudf::test::strings_column_wrapper expected({"XYZXYZXYZXYZ", "XYZbXYZb", "", "bbb", "", "XYZ",
+                                               "XYZXYZXYZ", "", "bXYZ"},
+                                              {1, 1, 0, 1, 1, 1, 1, 0, 1});
+  cudf::test::strings_column_wrapper expected_limit(
+    {"XYZXYZaa", "XYZbXYZb", "", "bbb", "", "XYZ", "XYZXYZa", "", "bXYZ"},
+    {1, 1, 0, 1, 1, 1, 1, 0, 1});
+
+  auto const target = cudf::string_scalar("a");
+  auto const repl   = cudf::string_scalar("XYZ");
+  for (auto const& [begin, end] : {std::pair{0, 9}, std::pair{1, 8}, std::pair{2, 5}}) {
+    auto const view = cudf::strings_column_view(cudf::slice(input, {begin, end}).front());
+    auto const sliced_expected       = cudf::slice(expected, {begin, end}).front();
+    auto const sliced_expected_limit = cudf::slice(expected_limit, {begin, end}).front();
+
+    auto results = cudf::strings::detail::replace<algorithm::ROW_PARALLEL>(view, target, repl);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, sliced_expected);
+    auto char_parallel =
+      cudf::strings::detail::replace<algorithm::CHAR_PARALLEL>(view, target, repl);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, *char_parallel);
+
+    results = cudf::strings::detail::replace<algorithm::ROW_PARALLEL>(view, target, repl, 2);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, sliced_expected_limit);
+    char_parallel = cudf::strings::detail::replace<algorithm::CHAR_PARALLEL>(view, target, repl, 2);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, *char_parallel);
+  }
+}
+
 TEST_F(StringsReplaceTest, ReplaceTargetOverlap)
 {
   auto corpus      = build_corpus();
@@ -340,6 +374,37 @@ TEST_F(StringsReplaceTest, ReplaceMulti)
   }
 }
 
+TEST_F(StringsReplaceTest, ReplaceMultiOverlap)
+{
+  cudf::test::strings_column_wrapper input({"xabcd abc", "cab", "bcbc", "", "abé"});
+  auto sv = cudf::strings_column_view(input);
+
+  cudf::test::strings_column_wrapper repls_column({"1", "2", "3", "4"});
+  auto repls = cudf::strings_column_view(repls_column);
+  {
+    // matches at the same position are replaced by the first target in the list
+    cudf::test::strings_column_wrapper targets({"ab", "abc", "bc", "c"});
+    auto results = cudf::strings::replace(sv, cudf::strings_column_view(targets), repls);
+    cudf::test::strings_column_wrapper expected({"x14d 14", "41", "33", "", "1é"});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    cudf::test::strings_column_wrapper targets({"abc", "ab", "bc", "é"});
+    auto results = cudf::strings::replace(sv, cudf::strings_column_view(targets), repls);
+    cudf::test::strings_column_wrapper expected({"x1d 1", "c2", "33", "", "24"});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // empty targets are ignored
+    cudf::test::strings_column_wrapper targets({"", "b"});
+    cudf::test::strings_column_wrapper repls2({"X", "_"});
+    auto results = cudf::strings::replace(
+      sv, cudf::strings_column_view(targets), cudf::strings_column_view(repls2));
+    cudf::test::strings_column_wrapper expected({"xa_cd a_c", "ca_", "_c_c", "", "a_é"});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(StringsReplaceTest, EmptyStringsColumn)
 {
   cudf::column_view zero_size_strings_column(
@@ -132,6 +132,56 @@ TEST_F(StringsSplitTest, SplitWhitespaceWithMax)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*results, *expected);
 }
 
+TEST_F(StringsSplitTest, SplitToColumns)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"a,b,c", "d,e", "", "f,g,h,i", "j,,", "k"}, cudf::test::iterators::null_at(2));
+  cudf::strings_column_view strings_view(strings);
+
+  using cudf::test::iterators::nulls_at;
+  cudf::test::strings_column_wrapper expected1({"a", "d", "", "f", "j", "k"}, nulls_at({2}));
+  cudf::test::strings_column_wrapper expected2({"b", "e", "", "g", "", ""}, nulls_at({2, 5}));
+  cudf::test::strings_column_wrapper expected3({"c", "", "", "h,i", "", ""}, nulls_at({1, 2, 5}));
+  auto expected = cudf::table_view({expected1, expected2, expected3});
+
+  auto results = cudf::strings::split_to_columns(strings_view, 3, cudf::string_scalar(","));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
+
+  // columns past the tokens of every row are all nulls
+  cudf::test::strings_column_wrapper expected3_of5({"c", "", "", "h", "", ""}, nulls_at({1, 2, 5}));
+  cudf::test::strings_column_wrapper expected4_of5({"", "", "", "i", "", ""},
+                                                   nulls_at({0, 1, 2, 4, 5}));
+  cudf::test::strings_column_wrapper expected5_of5({"", "", "", "", "", ""},
+                                                   cudf::test::iterators::all_nulls());
+  results = cudf::strings::split_to_columns(strings_view, 5, cudf::string_scalar(","));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(
+    *results,
+    cudf::table_view({expected1, expected2, expected3_of5, expected4_of5, expected5_of5}));
+
+  // the same as split() with maxsplit == num_columns - 1
+  auto const split_results = cudf::strings::split(strings_view, cudf::string_scalar(","), 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*split_results, expected);
+
+  results = cudf::strings::split_to_columns(strings_view, 1, cudf::string_scalar(","));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, cudf::table_view({strings}));
+}
+
+TEST_F(StringsSplitTest, SplitToColumnsWhitespace)
+{
+  cudf::test::strings_column_wrapper strings({"a bc d", " a  bc ", "", "  ", "ab"});
+  cudf::strings_column_view strings_view(strings);
+
+  using cudf::test::iterators::nulls_at;
+  cudf::test::strings_column_wrapper expected1({"a", "a", "", "", "ab"}, nulls_at({2, 3}));
+  cudf::test::strings_column_wrapper expected2({"bc d", "bc ", "", "", ""}, nulls_at({2, 3, 4}));
+  auto expected = cudf::table_view({expected1, expected2});
+
+  auto results = cudf::strings::split_to_columns(strings_view, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*results, expected);
+  auto const split_results = cudf::strings::split(strings_view, cudf::string_scalar(""), 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*split_results, expected);
+}
+
 TEST_F(StringsSplitTest, RSplit)
 {
   std::vector<const char*> h_strings{
@@ -585,6 +635,9 @@ TEST_F(StringsSplitTest, SplitZeroSizeStringsColumns)
   results = cudf::strings::rsplit(zero_size_strings_column);
   EXPECT_TRUE(results->num_columns() == 1);
   EXPECT_TRUE(results->num_rows() == 0);
+  results = cudf::strings::split_to_columns(zero_size_strings_column, 3);
+  EXPECT_TRUE(results->num_columns() == 3);
+  EXPECT_TRUE(results->num_rows() == 0);
   results = cudf::strings::split_re(zero_size_strings_column, "\\s");
   EXPECT_TRUE(results->num_columns() == 1);
   EXPECT_TRUE(results->num_rows() == 0);
@@ -817,6 +870,9 @@ TEST_F(StringsSplitTest, InvalidParameter)
                cudf::logic_error);
   EXPECT_THROW(cudf::strings::rsplit(strings_view, cudf::string_scalar("", false)),
                cudf::logic_error);
+  EXPECT_THROW(cudf::strings::split_to_columns(strings_view, 2, cudf::string_scalar("", false)),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::strings::split_to_columns(strings_view, 0), cudf::logic_error);
   EXPECT_THROW(cudf::strings::split_record(strings_view, cudf::string_scalar("", false)),
                cudf::logic_error);
   EXPECT_THROW(cudf::strings::rsplit_record(strings_view, cudf::string_scalar("", false)),
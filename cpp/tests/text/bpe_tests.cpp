@@ -92,6 +92,36 @@ TEST_F(TextBPETokenize, BytePairEncodingSeparator)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(TextBPETokenize, BytePairEncodingLongTokens)
+{
+  auto mpt = cudf::test::strings_column_wrapper({"e n",
+                                                 "i t",
+                                                 "i s",
+                                                 "e s",
+                                                 "en t",
+                                                 "c e",
+                                                 "es t",
+                                                 "en ce",
+                                                 "T h",
+                                                 "Th is",
+                                                 "t est",
+                                                 "s ent"});
+  nvtext::bpe_merge_pairs merge_pairs{cudf::strings_column_view(mpt)};
+
+  // tokens longer than 64 bytes are encoded by a warp per token
+  std::string const word("Thisistestsentence");
+  std::string const long_word = word + word + word + word;
+  cudf::test::strings_column_wrapper input(
+    {word, long_word, word + " " + long_word + " " + word, "   " + long_word});
+  auto results = nvtext::byte_pair_encoding(cudf::strings_column_view(input), merge_pairs);
+
+  std::string const encoded("This is test sent ence");
+  std::string const long_encoded = encoded + " " + encoded + " " + encoded + " " + encoded;
+  auto expected = cudf::test::strings_column_wrapper(
+    {encoded, long_encoded, encoded + " " + long_encoded + " " + encoded, " " + long_encoded});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+}
+
 TEST_F(TextBPETokenize, BPE_Empty)
 {
   auto mpt = cudf::test::strings_column_wrapper({"i s", "i t"});
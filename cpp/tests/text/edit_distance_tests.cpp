@@ -81,6 +81,47 @@ TEST_F(TextEditDistanceTest, EditDistanceMatrix)
   }
 }
 
+TEST_F(TextEditDistanceTest, EditDistanceLongStrings)
+{
+  // mix of pairs computed with the bit-parallel algorithm and with the full matrix
+  cudf::test::strings_column_wrapper strings(
+    {"the quick brown fox jumps over the lazy dog and then runs far away into the woods",
+     "the quick brown fox jumps over the lazy dog and then runs far away into the woods",
+     "the quick brown fox jumped over the lazy dogs and then ran far away into the wood",
+     "a quick brown fox",
+     ""});
+  cudf::test::strings_column_wrapper targets(
+    {"the quick brown fox jumped over the lazy dogs and then ran far away into the wood",
+     "a quick brown fox",
+     "the quick brown fox jumps over the lazy dog and then runs far away into the woods!!",
+     "a slow brown fox",
+     "the quick brown fox jumps over the lazy dog and then runs far away into the woods!!"});
+  auto results =
+    nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({6, 65, 8, 5, 83});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(TextEditDistanceTest, EditDistancePairs)
+{
+  std::vector<const char*> h_strings{"hello", "hallo", "world", "hella", nullptr, "help", "yellow"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  auto results = nvtext::edit_distance_pairs(cudf::strings_column_view(strings), 2);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_first({0, 0, 0, 0, 1, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_second({1, 3, 5, 6, 3, 5});
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_distance({1, 1, 2, 2, 2, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_first);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_second);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2), expected_distance);
+
+  results = nvtext::edit_distance_pairs(cudf::strings_column_view(strings), 0);
+  EXPECT_EQ(results->num_rows(), 0);
+}
+
 TEST_F(TextEditDistanceTest, EmptyTest)
 {
   auto strings = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -89,6 +130,9 @@ TEST_F(TextEditDistanceTest, EmptyTest)
   EXPECT_EQ(results->size(), 0);
   results = nvtext::edit_distance_matrix(strings_view);
   EXPECT_EQ(results->size(), 0);
+  auto pairs = nvtext::edit_distance_pairs(strings_view, 1);
+  EXPECT_EQ(pairs->num_columns(), 3);
+  EXPECT_EQ(pairs->num_rows(), 0);
 }
 
 TEST_F(TextEditDistanceTest, ErrorsTest)
@@ -99,4 +143,6 @@ TEST_F(TextEditDistanceTest, ErrorsTest)
     nvtext::edit_distance(cudf::strings_column_view(strings), cudf::strings_column_view(targets)),
     cudf::logic_error);
   EXPECT_THROW(nvtext::edit_distance_matrix(cudf::strings_column_view(strings)), cudf::logic_error);
+  EXPECT_THROW(nvtext::edit_distance_pairs(cudf::strings_column_view(strings), -1),
+               cudf::logic_error);
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <nvtext/minhash.hpp>
+
+#include <limits>
+
+struct MinHashTest : public cudf::test::BaseFixture {
+};
+
+namespace {
+cudf::device_span<cudf::hash_value_type const> to_span(cudf::column_view const& seeds)
+{
+  return cudf::device_span<cudf::hash_value_type const>(seeds.data<cudf::hash_value_type>(),
+                                                         seeds.size());
+}
+}  // namespace
+
+TEST_F(MinHashTest, Basic)
+{
+  auto validity = cudf::test::iterators::null_at(3);
+  cudf::test::strings_column_wrapper input(
+    {"the quick brown fox", "the quick brown fox", "", "", "abc"}, validity);
+  cudf::test::fixed_width_column_wrapper<cudf::hash_value_type> seeds({0, 1, 2});
+
+  auto results = nvtext::minhash(cudf::strings_column_view(input), to_span(seeds));
+  EXPECT_EQ(5, results->size());
+  EXPECT_EQ(1, results->null_count());
+  EXPECT_EQ(15, cudf::lists_column_view(results->view()).child().size());
+
+  // identical strings have identical signatures
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(results->view(), {0, 1}).front(),
+                                 cudf::slice(results->view(), {1, 2}).front());
+
+  // empty strings have no n-grams
+  auto const max_hash = std::numeric_limits<cudf::hash_value_type>::max();
+  cudf::test::lists_column_wrapper<cudf::hash_value_type> expected_empty{
+    {max_hash, max_hash, max_hash}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(results->view(), {2, 3}).front(), expected_empty);
+}
+
+TEST_F(MinHashTest, SameNgrams)
+{
+  cudf::test::fixed_width_column_wrapper<cudf::hash_value_type> seeds({7, 11, 13, 17});
+
+  // both strings have only the n-gram "aaaa"
+  cudf::test::strings_column_wrapper input1({"aaaa", "téstést"});
+  cudf::test::strings_column_wrapper input2({"aaaaaa", "téstéstést"});
+  auto results1 = nvtext::minhash(cudf::strings_column_view(input1), to_span(seeds), 4);
+  auto results2 = nvtext::minhash(cudf::strings_column_view(input2), to_span(seeds), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results1->view(), results2->view());
+
+  // surrounding whitespace is not part of any word n-gram
+  cudf::test::strings_column_wrapper words1({"hello world", "one two one two", "single"});
+  cudf::test::strings_column_wrapper words2({"  hello world\n", "one two one two one", " single "});
+  results1 = nvtext::word_minhash(cudf::strings_column_view(words1), to_span(seeds), 2);
+  results2 = nvtext::word_minhash(cudf::strings_column_view(words2), to_span(seeds), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results1->view(), results2->view());
+}
+
+TEST_F(MinHashTest, Buckets)
+{
+  cudf::test::strings_column_wrapper input(
+    {"the quick brown fox", "a different string", "the quick brown fox"});
+  cudf::test::fixed_width_column_wrapper<cudf::hash_value_type> seeds({1, 2, 3, 4, 5, 6});
+  auto signatures = nvtext::minhash(cudf::strings_column_view(input), to_span(seeds));
+
+  auto results = nvtext::minhash_buckets(cudf::lists_column_view(signatures->view()), 3);
+  EXPECT_EQ(3, results->size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::slice(results->view(), {0, 1}).front(),
+                                 cudf::slice(results->view(), {2, 3}).front());
+
+  // the band index is in the upper bits of each bucket ID
+  auto const buckets =
+    cudf::test::to_host<uint64_t>(cudf::lists_column_view(results->view()).child());
+  for (std::size_t idx = 0; idx < buckets.first.size(); ++idx) {
+    EXPECT_EQ(idx % 3, buckets.first[idx] >> 32);
+  }
+
+  auto sliced = cudf::slice(signatures->view(), {1, 3}).front();
+  results     = nvtext::minhash_buckets(cudf::lists_column_view(sliced), 2);
+  EXPECT_EQ(2, results->size());
+  EXPECT_EQ(4, cudf::lists_column_view(results->view()).child().size());
+}
+
+TEST_F(MinHashTest, ErrorsTest)
+{
+  cudf::test::strings_column_wrapper input({"this string intentionally left blank"});
+  cudf::test::fixed_width_column_wrapper<cudf::hash_value_type> seeds({1, 2, 3, 4});
+  cudf::test::fixed_width_column_wrapper<cudf::hash_value_type> no_seeds;
+  auto const view = cudf::strings_column_view(input);
+  EXPECT_THROW(nvtext::minhash(view, to_span(seeds), 1), cudf::logic_error);
+  EXPECT_THROW(nvtext::word_minhash(view, to_span(seeds), 0), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash(view, to_span(no_seeds)), cudf::logic_error);
+
+  auto signatures = nvtext::minhash(view, to_span(seeds));
+  auto const lcv  = cudf::lists_column_view(signatures->view());
+  EXPECT_THROW(nvtext::minhash_buckets(lcv, 3), cudf::logic_error);
+  EXPECT_THROW(nvtext::minhash_buckets(lcv, 0), cudf::logic_error);
+}
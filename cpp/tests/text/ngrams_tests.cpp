@@ -15,6 +15,7 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf_test/base_fixture.hpp>
@@ -100,6 +101,48 @@ TEST_F(TextGenerateNgramsTest, NgramsWithNulls)
   }
 }
 
+TEST_F(TextGenerateNgramsTest, HashNgrams)
+{
+  std::vector<const char*> h_strings{"the", "fox", "", "jumped", nullptr, "thé", "dog"};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+
+  cudf::strings_column_view strings_view(strings);
+  {
+    // hashes of ["the_fox", "fox_jumped", "jumped_thé", "thé_dog"]
+    auto const results = nvtext::hash_ngrams(strings_view);
+    cudf::test::fixed_width_column_wrapper<uint32_t> expected{
+      719089685u, 3928848026u, 4028703914u, 3538669312u};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // hashes of ["the fox", "fox jumped"] using seed 1
+    auto const sliced  = cudf::slice(strings, {0, 4}).front();
+    auto const results = nvtext::hash_ngrams(
+      cudf::strings_column_view(sliced), 2, cudf::string_scalar(" "), 1);
+    cudf::test::fixed_width_column_wrapper<uint32_t> expected{885610193u, 393177846u};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+  {
+    // hashes of [["the"], ["fox"], [], ["jum", "ump", "mpe", "ped"], null, ["thé"], ["dog"]]
+    auto const results = nvtext::hash_character_ngrams(strings_view, 3);
+    using LCW          = cudf::test::lists_column_wrapper<uint32_t>;
+    auto const validity =
+      thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+    LCW expected({LCW{3162218338},
+                  LCW{2673099881},
+                  LCW{},
+                  LCW{935170141, 756829943, 2710774007, 974613234},
+                  LCW{},
+                  LCW{161175387},
+                  LCW{2982218203}},
+                 validity);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+  }
+}
+
 TEST_F(TextGenerateNgramsTest, Empty)
 {
   cudf::column_view zero_size_strings_column(
@@ -108,6 +151,10 @@ TEST_F(TextGenerateNgramsTest, Empty)
   cudf::test::expect_strings_empty(results->view());
   results = nvtext::generate_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
   cudf::test::expect_strings_empty(results->view());
+  results = nvtext::hash_ngrams(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(results->size(), 0);
+  results = nvtext::hash_character_ngrams(cudf::strings_column_view(zero_size_strings_column));
+  EXPECT_EQ(results->size(), 0);
 }
 
 TEST_F(TextGenerateNgramsTest, Errors)
@@ -117,6 +164,9 @@ TEST_F(TextGenerateNgramsTest, Errors)
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 1), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 1),
                cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_ngrams(cudf::strings_column_view(strings), 1), cudf::logic_error);
+  EXPECT_THROW(nvtext::hash_character_ngrams(cudf::strings_column_view(strings), 1),
+               cudf::logic_error);
   // not enough strings to generate ngrams
   EXPECT_THROW(nvtext::generate_ngrams(cudf::strings_column_view(strings), 3), cudf::logic_error);
   EXPECT_THROW(nvtext::generate_character_ngrams(cudf::strings_column_view(strings), 3),
@@ -160,3 +160,34 @@ TEST_F(TextNormalizeTest, NormalizeSlicedColumn)
   cudf::test::strings_column_wrapper expected2({" $ 41 . 07", " [ a , b ] ", " 丏  丟 "});
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected2);
 }
+
+TEST_F(TextNormalizeTest, NormalizeAndTokenize)
+{
+  cudf::test::strings_column_wrapper strings(
+    {"abc£def", "éè â îô\taeio", "", "ACEN U", "P^NP", "$41.07", "[a,b]", "丏丟"},
+    {1, 1, 0, 1, 1, 1, 1, 1});
+
+  std::vector<cudf::column_view> sliced = cudf::split(strings, {5});
+  auto results = nvtext::normalize_and_tokenize(cudf::strings_column_view(sliced.front()), true);
+  cudf::test::strings_column_wrapper expected(
+    {"abc£def", "ee", "a", "io", "aeio", "acen", "u", "p", "^", "np"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = nvtext::normalize_and_tokenize(cudf::strings_column_view(sliced.front()), true, 2);
+  cudf::test::strings_column_wrapper expected_bigrams(
+    {"ee_a", "a_io", "io_aeio", "acen_u", "p_^", "^_np"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_bigrams);
+
+  results = nvtext::normalize_and_tokenize(
+    cudf::strings_column_view(sliced[1]), false, 3, cudf::string_scalar(" "));
+  cudf::test::strings_column_wrapper expected_trigrams(
+    {"$ 41 .", "41 . 07", "[ a ,", "a , b", ", b ]"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_trigrams);
+
+  auto empty = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
+  results    = nvtext::normalize_and_tokenize(cudf::strings_column_view(empty->view()), true);
+  EXPECT_EQ(results->size(), 0);
+
+  EXPECT_THROW(nvtext::normalize_and_tokenize(cudf::strings_column_view(strings), true, 0),
+               cudf::logic_error);
+}
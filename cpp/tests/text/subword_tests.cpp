@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <cudf_test/base_fixture.hpp>
@@ -383,3 +385,75 @@ TEST(TextSubwordTest, ZeroHashBinCoefficient)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
+
+TEST(TextSubwordTest, TokenizerReusesWorkspace)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  uint32_t max_sequence_length = 8;
+  uint32_t stride              = 6;
+  uint32_t max_rows            = 4;
+  nvtext::subword_tokenizer tokenizer(*vocab,
+                                      max_sequence_length,
+                                      stride,
+                                      true,   // do_lower_case
+                                      false,  // do_truncate
+                                      max_rows,
+                                      64);  // max_batch_bytes
+
+  auto const make_output = [](cudf::size_type size) {
+    return cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32}, size);
+  };
+  auto token_ids = make_output(max_rows * max_sequence_length);
+  auto attn_mask = make_output(max_rows * max_sequence_length);
+  auto metadata  = make_output(max_rows * 3);
+
+  cudf::test::strings_column_wrapper batch0(
+    {"This is a test.", "This is a test. This is a tést."});
+  // larger than max_batch_bytes
+  cudf::test::strings_column_wrapper batch1(
+    {"A test this is. A test this is. A test this is. A test this is. A test this is."});
+  cudf::test::strings_column_wrapper batch2({"tést"});
+
+  for (auto const& input : {cudf::strings_column_view{batch0},
+                            cudf::strings_column_view{batch1},
+                            cudf::strings_column_view{batch2}}) {
+    auto const expected = nvtext::subword_tokenize(
+      input, *vocab, max_sequence_length, stride, true, false, max_rows);
+    auto const nrows = tokenizer.tokenize(
+      input, token_ids->mutable_view(), attn_mask->mutable_view(), metadata->mutable_view());
+    EXPECT_EQ(expected.nrows_tensor, nrows);
+
+    auto const tokens = static_cast<cudf::size_type>(nrows * max_sequence_length);
+    auto const rows   = static_cast<cudf::size_type>(nrows * 3);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_token_ids->view(),
+                                   cudf::slice(token_ids->view(), {0, tokens}).front());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_attention_mask->view(),
+                                   cudf::slice(attn_mask->view(), {0, tokens}).front());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected.tensor_metadata->view(),
+                                   cudf::slice(metadata->view(), {0, rows}).front());
+  }
+
+  cudf::test::strings_column_wrapper empty;
+  EXPECT_EQ(uint32_t{0},
+            tokenizer.tokenize(cudf::strings_column_view{empty},
+                               token_ids->mutable_view(),
+                               attn_mask->mutable_view(),
+                               metadata->mutable_view()));
+
+  // output too small and too many rows for the output
+  auto small = make_output(max_sequence_length);
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{batch0},
+                                  small->mutable_view(),
+                                  attn_mask->mutable_view(),
+                                  metadata->mutable_view()),
+               cudf::logic_error);
+  cudf::test::strings_column_wrapper many({"a", "a", "a", "a", "a"});
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view{many},
+                                  token_ids->mutable_view(),
+                                  attn_mask->mutable_view(),
+                                  metadata->mutable_view()),
+               cudf::logic_error);
+}
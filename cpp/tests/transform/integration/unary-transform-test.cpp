@@ -17,7 +17,10 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
@@ -225,6 +228,38 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, Transform_Table_INT32_INT64)
+{
+  // c = a * a - a
+  const char cuda[] =
+    "__device__ inline void f(long* output,int input){*output = long(input)*input - input;}";
+
+  auto op         = [](int32_t a) { return int64_t{a} * a - a; };
+  auto const size = 1000;
+
+  auto data_0 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto data_1 = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 50000 - i; });
+  auto valid  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  cudf::test::fixed_width_column_wrapper<int32_t> in_0(data_0, data_0 + size);
+  cudf::test::fixed_width_column_wrapper<int32_t> in_1(data_1, data_1 + size, valid);
+  auto const input = cudf::table_view{{in_0, in_1}};
+
+  auto const out = cudf::transform(input, cuda, data_type(type_id::INT64), false);
+
+  ASSERT_EQ(out->num_columns(), 2);
+  ASSERT_UNARY<int64_t, int32_t>(out->get_column(0), in_0, op);
+  ASSERT_UNARY<int64_t, int32_t>(out->get_column(1), in_1, op);
+
+  // the same results written into caller-provided columns
+  auto out_0 = cudf::make_numeric_column(data_type(type_id::INT64), size);
+  auto out_1 = cudf::make_numeric_column(data_type(type_id::INT64), size);
+  cudf::transform(input, cuda, cudf::mutable_table_view{{*out_0, *out_1}}, false);
+
+  ASSERT_UNARY<int64_t, int32_t>(out_0->view(), in_0, op);
+  EXPECT_THROW(
+    cudf::transform(input, cuda, cudf::mutable_table_view{{*out_0}}, false), cudf::logic_error);
+}
+
 }  // namespace transformation
 }  // namespace test
 }  // namespace cudf
@@ -17,6 +17,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/transform.hpp>
 #include <cudf/types.hpp>
@@ -34,6 +35,9 @@
 #include <thrust/tabulate.h>
 #include <thrust/transform.h>
 
+#include <numeric>
+#include <vector>
+
 using namespace cudf;
 
 template <typename T>
@@ -716,3 +720,69 @@ TEST_F(RowBitCount, EmptyTable)
     CUDF_EXPECTS(result != nullptr && result->size() == 0, "Expected an empty column");
   }
 }
+
+// sums the bits of `row_bit_count` over each slice and rounds them up to bytes
+std::vector<std::size_t> expected_split_sizes(table_view const& t,
+                                              std::vector<size_type> const& splits)
+{
+  auto const bit_counts = cudf::test::to_host<size_type>(*cudf::row_bit_count(t)).first;
+  std::vector<size_type> bounds{0};
+  bounds.insert(bounds.end(), splits.begin(), splits.end());
+  bounds.push_back(t.num_rows());
+  std::vector<std::size_t> sizes;
+  for (std::size_t i = 0; i + 1 < bounds.size(); ++i) {
+    auto const bits = std::accumulate(
+      bit_counts.begin() + bounds[i], bit_counts.begin() + bounds[i + 1], std::size_t{0});
+    sizes.push_back((bits + CHAR_BIT - 1) / CHAR_BIT);
+  }
+  return sizes;
+}
+
+TEST_F(RowBitCount, EstimateSizeFixedWidth)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col0{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+                                                       {1, 0, 1, 1, 0, 1, 1, 1, 1, 1}};
+  table_view t({col0, col1});
+
+  // 16 + 32 + 1 bits per row
+  EXPECT_EQ(cudf::estimate_size(t), std::size_t{(49 * 10 + 7) / 8});
+  EXPECT_EQ(cudf::estimate_split_sizes(t, {3}),
+            (std::vector<std::size_t>{(49 * 3 + 7) / 8, (49 * 7 + 7) / 8}));
+  EXPECT_EQ(cudf::estimate_size(cudf::slice(t, {2, 6}).front()), std::size_t{(49 * 4 + 7) / 8});
+}
+
+TEST_F(RowBitCount, EstimateSplitSizes)
+{
+  auto [col0, col0_sizes] = build_nested_and_expected_column({1, 1, 0, 1, 1, 1, 1, 1});
+  auto [col1, col1_sizes] = build_struct_column();
+  auto [col2, col2_sizes] = build_list_column<int16_t>();
+  table_view t({*col0, *col1, *col2});
+
+  for (auto const& splits : std::vector<std::vector<size_type>>{
+         {}, {1}, {0, 2}, {1, 1, 3}, {0, 1, 2, 3, 4}, {t.num_rows()}}) {
+    EXPECT_EQ(cudf::estimate_split_sizes(t, splits), expected_split_sizes(t, splits));
+  }
+  EXPECT_EQ(cudf::estimate_size(t), expected_split_sizes(t, {}).front());
+
+  cudf::test::strings_column_wrapper strings({"a", "bb", "ccc", "", "d"});
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3, 4, 5};
+  EXPECT_EQ(cudf::estimate_split_sizes(table_view{{ints, strings}}, {2, 4}),
+            (std::vector<std::size_t>{19, 19, 9}));
+}
+
+TEST_F(RowBitCount, EstimateSizeEmptyAndInvalid)
+{
+  EXPECT_EQ(cudf::estimate_size(cudf::table_view{}), 0u);
+
+  auto strings = cudf::make_empty_column(type_id::STRING);
+  auto ints    = cudf::make_empty_column(type_id::INT32);
+  cudf::table_view empty({*strings, *ints});
+  EXPECT_EQ(cudf::estimate_size(empty), 0u);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col{1, 2, 3};
+  table_view t({col});
+  EXPECT_THROW(cudf::estimate_split_sizes(t, {2, 1}), cudf::logic_error);
+  EXPECT_THROW(cudf::estimate_split_sizes(t, {4}), cudf::logic_error);
+  EXPECT_THROW(cudf::estimate_split_sizes(t, {-1}), cudf::logic_error);
+}
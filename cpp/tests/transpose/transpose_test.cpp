@@ -13,10 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/copying.hpp>
 #include <cudf/transpose.hpp>
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
 #include <algorithm>
@@ -187,6 +189,10 @@ TYPED_TEST(TransposeTest, Fat) { run_test<TypeParam>(1000, 10, false); }
 
 TYPED_TEST(TransposeTest, FatNulls) { run_test<TypeParam>(1000, 10, true); }
 
+TYPED_TEST(TransposeTest, Ragged) { run_test<TypeParam>(37, 1025, false); }
+
+TYPED_TEST(TransposeTest, RaggedNulls) { run_test<TypeParam>(37, 1025, true); }
+
 TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
@@ -203,4 +209,29 @@ TEST_F(TransposeTestError, MismatchedColumns)
   EXPECT_THROW(cudf::transpose(input), cudf::logic_error);
 }
 
+class TransposeTestSliced : public cudf::test::BaseFixture {
+};
+
+TEST_F(TransposeTestSliced, SlicedColumns)
+{
+  using cudf::test::iterators::nulls_at;
+  cudf::test::fixed_width_column_wrapper<int64_t> col1({1, 2, 3, 4, 5, 6}, nulls_at({0, 4}));
+  cudf::test::fixed_width_column_wrapper<int64_t> col2({7, 8, 9, 10, 11, 12}, nulls_at({2}));
+  auto const sliced1 = cudf::slice(col1, {1, 5}).front();
+  auto const sliced2 = cudf::slice(col2, {1, 5}).front();
+
+  auto const result       = cudf::transpose(cudf::table_view{{sliced1, sliced2}});
+  auto const& result_view = std::get<1>(result);
+  ASSERT_EQ(result_view.num_columns(), 4);
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected0{2, 8};
+  cudf::test::fixed_width_column_wrapper<int64_t> expected1({3, 9}, nulls_at({1}));
+  cudf::test::fixed_width_column_wrapper<int64_t> expected2{4, 10};
+  cudf::test::fixed_width_column_wrapper<int64_t> expected3({5, 11}, nulls_at({0}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(0), expected0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(1), expected1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(2), expected2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result_view.column(3), expected3);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
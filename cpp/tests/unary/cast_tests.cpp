@@ -193,6 +193,27 @@ inline auto make_data_type()
   return cudf::data_type{cudf::type_to_id<T>()};
 }
 
+struct CastSameType : public cudf::test::BaseFixture {
+};
+
+TEST_F(CastSameType, SharesColumn)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> wrapper{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  cudf::column const input{wrapper};
+
+  auto const shared = cudf::cast(input, make_data_type<int32_t>());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, *shared);
+  EXPECT_EQ(input.view().head(), shared->view().head());
+
+  auto const copied = cudf::cast(input.view(), make_data_type<int32_t>());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input, *copied);
+  EXPECT_NE(input.view().head(), copied->view().head());
+
+  auto const casted = cudf::cast(input, make_data_type<int64_t>());
+  cudf::test::fixed_width_column_wrapper<int64_t> expected{{1, 2, 3, 4}, {1, 0, 1, 1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *casted);
+}
+
 struct CastTimestampsSimple : public cudf::test::BaseFixture {
 };
 
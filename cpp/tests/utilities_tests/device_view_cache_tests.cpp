@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/utilities/device_view_cache.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <rmm/cuda_stream.hpp>
+
+#include <string>
+
+struct DeviceViewCacheTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(DeviceViewCacheTest, Keys)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{1, 2, 3, 4};
+  cudf::test::strings_column_wrapper strings{"a", "bb", "ccc", "dddd"};
+
+  // the same views have the same keys
+  EXPECT_EQ(cudf::detail::device_view_cache_key(strings),
+            cudf::detail::device_view_cache_key(cudf::column_view{strings}));
+  EXPECT_EQ(cudf::detail::device_view_cache_key(cudf::table_view{{ints, strings}}),
+            cudf::detail::device_view_cache_key(cudf::table_view{{ints, strings}}));
+
+  // views of other data, slices and tables of other columns have other keys
+  cudf::test::strings_column_wrapper other_strings{"a", "bb", "ccc", "dddd"};
+  auto const sliced = cudf::slice(strings, {1, 3}).front();
+  EXPECT_NE(cudf::detail::device_view_cache_key(strings),
+            cudf::detail::device_view_cache_key(other_strings));
+  EXPECT_NE(cudf::detail::device_view_cache_key(strings),
+            cudf::detail::device_view_cache_key(sliced));
+  EXPECT_NE(cudf::detail::device_view_cache_key(cudf::table_view{{ints, strings}}),
+            cudf::detail::device_view_cache_key(cudf::table_view{{ints}}));
+  EXPECT_NE(cudf::detail::device_view_cache_key(cudf::table_view{{strings}}),
+            cudf::detail::device_view_cache_key(strings));
+}
+
+TEST_F(DeviceViewCacheTest, FindAndEvict)
+{
+  using cache_type = cudf::detail::device_view_cache<int>;
+  cache_type cache;
+  auto const capacity = cudf::detail::device_view_cache_capacity();
+  if (capacity == 0) { GTEST_SKIP() << "The device view cache is disabled"; }
+
+  EXPECT_FALSE(cache.find("0").has_value());
+  for (std::size_t i = 0; i <= capacity; ++i) {
+    cache.insert(std::to_string(i), cache_type::entry{static_cast<int>(i), nullptr});
+    // keep the first view the most recently used
+    EXPECT_TRUE(cache.find("0").has_value());
+  }
+
+  EXPECT_EQ(cache.find("0")->first, 0);
+  EXPECT_EQ(cache.find(std::to_string(capacity))->first, static_cast<int>(capacity));
+  // the least recently used view was evicted
+  EXPECT_FALSE(cache.find("1").has_value());
+}
+
+TEST_F(DeviceViewCacheTest, DefaultStreamOnly)
+{
+  rmm::cuda_stream stream;
+  EXPECT_FALSE(cudf::detail::is_device_view_cache_enabled(stream.view()));
+  EXPECT_EQ(cudf::detail::is_device_view_cache_enabled(cudf::default_stream_value),
+            cudf::detail::device_view_cache_capacity() > 0);
+}
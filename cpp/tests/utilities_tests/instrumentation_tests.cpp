@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/sync_utilities.hpp>
+
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/instrumentation.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <string>
+#include <vector>
+
+namespace {
+struct recording_observer : public cudf::api_call_observer {
+  void on_api_call(cudf::api_call_info const& info) override { calls.push_back(info); }
+
+  std::vector<cudf::api_call_info> calls;
+};
+}  // namespace
+
+struct InstrumentationTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(InstrumentationTest, ReportsOutermostCalls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 3, 9, 1, 7};
+  cudf::table_view input{{col}};
+
+  auto const resource = rmm::mr::get_current_device_resource();
+  auto observer       = std::make_shared<recording_observer>();
+  cudf::set_api_call_observer(observer);
+  EXPECT_EQ(cudf::get_api_call_observer(), observer);
+  EXPECT_NE(rmm::mr::get_current_device_resource(), resource);
+
+  auto const sorted = cudf::sort(input);
+  auto const order  = cudf::sorted_order(input);
+
+  cudf::set_api_call_observer(nullptr);
+  EXPECT_EQ(cudf::get_api_call_observer(), nullptr);
+  EXPECT_EQ(rmm::mr::get_current_device_resource(), resource);
+  auto const unobserved = cudf::sort(input);
+
+  ASSERT_EQ(observer->calls.size(), 2u);
+  EXPECT_EQ(std::string(observer->calls[0].name), "sort");
+  EXPECT_EQ(std::string(observer->calls[1].name), "sorted_order");
+  for (auto const& call : observer->calls) {
+    EXPECT_GE(call.elapsed_ms, 0.f);
+    EXPECT_GE(call.bytes_allocated, 5 * sizeof(int32_t));
+    EXPECT_GE(call.peak_bytes, 5 * sizeof(int32_t));
+    EXPECT_LE(call.peak_bytes, call.bytes_allocated);
+  }
+}
+
+TEST_F(InstrumentationTest, RecordsSyncPoints)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 3, 9, 1, 7};
+  cudf::test::fixed_width_column_wrapper<bool> mask{true, false, true, false, true};
+  cudf::table_view input{{col}};
+
+  cudf::start_recording_sync_points();
+  auto const filtered    = cudf::apply_boolean_mask(input, mask);
+  auto const sync_points = cudf::stop_recording_sync_points();
+  EXPECT_EQ(filtered->num_rows(), 3);
+
+  ASSERT_FALSE(sync_points.empty());
+  for (auto const& sync_point : sync_points) {
+    EXPECT_EQ(std::string(sync_point.api), "apply_boolean_mask");
+    EXPECT_GE(sync_point.elapsed_ms, 0.f);
+  }
+
+  // nothing is recorded once stopped
+  auto const unrecorded = cudf::apply_boolean_mask(input, mask);
+  cudf::start_recording_sync_points();
+  EXPECT_TRUE(cudf::stop_recording_sync_points().empty());
+}
+
+TEST_F(InstrumentationTest, SyncPointChecker)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{5, 3, 9, 1, 7};
+
+  cudf::test::sync_point_checker no_syncs;
+  auto const result = cudf::cast(col, cudf::data_type{cudf::type_id::INT64});
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+
+#include <cudf/detail/utilities/kernel_tuning.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/kernel_cache.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+struct KernelTuningTest : public cudf::test::BaseFixture {
+  void SetUp() override
+  {
+    cache_dir = std::filesystem::temp_directory_path() / "cudf_kernel_tuning_test";
+    std::filesystem::remove_all(cache_dir);
+    setenv("LIBCUDF_KERNEL_CACHE_PATH", cache_dir.c_str(), 1);
+    cudf::clear_kernel_tunings();
+  }
+
+  void TearDown() override
+  {
+    cudf::clear_kernel_tunings();
+    cudf::set_kernel_tuning(false);
+    unsetenv("LIBCUDF_KERNEL_CACHE_PATH");
+    std::filesystem::remove_all(cache_dir);
+  }
+
+  /// Launches the test "kernel", which records the block sizes it is launched with
+  int launch(std::string const& name, std::size_t num_work_items)
+  {
+    return cudf::detail::launch_tuned_kernel(
+      name,
+      num_work_items,
+      block_sizes,
+      [&](int block_size) { launched.push_back(block_size); },
+      cudf::default_stream_value);
+  }
+
+  std::filesystem::path cache_dir;
+  std::vector<int> const block_sizes{128, 64, 256};
+  std::vector<int> launched;
+};
+
+TEST_F(KernelTuningTest, DisabledUsesDefault)
+{
+  cudf::set_kernel_tuning(false);
+  EXPECT_EQ(launch("kernel", cudf::detail::kernel_tuning_min_work_items), 128);
+  EXPECT_EQ(launched, std::vector<int>{128});
+}
+
+TEST_F(KernelTuningTest, SmallLaunchUsesDefault)
+{
+  cudf::set_kernel_tuning(true);
+  EXPECT_EQ(launch("kernel", cudf::detail::kernel_tuning_min_work_items - 1), 128);
+  EXPECT_EQ(launched, std::vector<int>{128});
+}
+
+TEST_F(KernelTuningTest, TunesOnce)
+{
+  cudf::set_kernel_tuning(true);
+  auto const tuned = launch("kernel", cudf::detail::kernel_tuning_min_work_items);
+  EXPECT_NE(std::find(block_sizes.begin(), block_sizes.end(), tuned), block_sizes.end());
+  for (auto const block_size : block_sizes) {
+    EXPECT_GT(std::count(launched.begin(), launched.end(), block_size), 1);
+  }
+
+  // the tuned block size is used without tuning again, even when tuning is disabled
+  cudf::set_kernel_tuning(false);
+  launched.clear();
+  EXPECT_EQ(launch("kernel", 1), tuned);
+  EXPECT_EQ(launched, std::vector<int>{tuned});
+
+  // the tunings of other kernels are separate
+  launched.clear();
+  EXPECT_EQ(launch("other kernel", cudf::detail::kernel_tuning_min_work_items), 128);
+  EXPECT_EQ(launched, std::vector<int>{128});
+}
+
+TEST_F(KernelTuningTest, PersistsTunings)
+{
+  cudf::set_kernel_tuning(true);
+  auto const tuned = launch("kernel", cudf::detail::kernel_tuning_min_work_items);
+
+  auto const files = std::vector<std::filesystem::directory_entry>(
+    std::filesystem::recursive_directory_iterator(cache_dir), {});
+  auto const file = std::find_if(files.begin(), files.end(), [](auto const& entry) {
+    return entry.path().filename() == "kernel_tuning.txt";
+  });
+  ASSERT_NE(file, files.end());
+  std::ifstream input(file->path());
+  std::string const contents(std::istreambuf_iterator<char>{input}, {});
+  EXPECT_NE(contents.find("\tkernel\t" + std::to_string(tuned) + "\n"), std::string::npos);
+
+  // cleared tunings are tuned again
+  cudf::clear_kernel_tunings();
+  EXPECT_FALSE(std::filesystem::exists(file->path()));
+  launched.clear();
+  launch("kernel", cudf::detail::kernel_tuning_min_work_items);
+  EXPECT_GT(launched.size(), block_sizes.size());
+}
+
+TEST_F(KernelTuningTest, NoBlockSizes)
+{
+  EXPECT_THROW(cudf::detail::launch_tuned_kernel(
+                 "kernel", 1, {}, [](int) {}, cudf::default_stream_value),
+               cudf::logic_error);
+}
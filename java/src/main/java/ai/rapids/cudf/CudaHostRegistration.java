@@ -0,0 +1,67 @@
+/*
+ *
+ *  Copyright (c) 2022, NVIDIA CORPORATION.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+package ai.rapids.cudf;
+
+/**
+ * A host buffer registered with CUDA through {@link HostMemoryBuffer#registerWithCuda()}.
+ *
+ * The registration holds a reference to the buffer, so the memory stays valid while it is
+ * registered. Closing the registration unregisters the memory and releases the reference. Make
+ * sure any asynchronous copies from or to the buffer have completed before closing.
+ */
+public final class CudaHostRegistration implements AutoCloseable {
+  private final HostMemoryBuffer buffer;
+  private final boolean registered;
+  private boolean closed = false;
+
+  CudaHostRegistration(HostMemoryBuffer buffer) {
+    buffer.incRefCount();
+    try {
+      // buffers from the pinned memory pool are already page-locked and are left as they are
+      registered = HostMemoryBufferNativeUtils.hostRegister(buffer.getAddress(),
+          buffer.getLength());
+    } catch (Throwable t) {
+      buffer.close();
+      throw t;
+    }
+    this.buffer = buffer;
+  }
+
+  /**
+   * Get the registered buffer.
+   */
+  public HostMemoryBuffer getBuffer() {
+    return buffer;
+  }
+
+  @Override
+  public synchronized void close() {
+    if (closed) {
+      return;
+    }
+    closed = true;
+    try {
+      if (registered) {
+        HostMemoryBufferNativeUtils.hostUnregister(buffer.getAddress());
+      }
+    } finally {
+      buffer.close();
+    }
+  }
+}
@@ -44,6 +44,16 @@ public final class HostColumnVector extends HostColumnVectorCore {
    */
   static final int OFFSET_SIZE = DType.INT32.getSizeInBytes();
 
+  /**
+   * The number of buffers of a column that is not nested: data, validity and offsets
+   */
+  private static final int DEVICE_BUFFER_COUNT = 3;
+
+  /**
+   * The alignment of the buffers packed into a single device allocation
+   */
+  private static final long DEVICE_BUFFER_ALIGNMENT = 256;
+
   private int refCount;
 
   /**
@@ -184,16 +194,7 @@ public final class HostColumnVector extends HostColumnVectorCore {
       if (!type.isNestedType()) {
         HostMemoryBuffer hdata = this.offHeap.data;
         if (hdata != null) {
-          long dataLen = rows * type.getSizeInBytes();
-          if (type.equals(DType.STRING)) {
-            // This needs a different type
-            dataLen = getEndStringOffset(rows - 1);
-            if (dataLen == 0 && getNullCount() == 0) {
-              // This is a work around to an issue where a column of all empty strings must have at
-              // least one byte or it will not be interpreted correctly.
-              dataLen = 1;
-            }
-          }
+          long dataLen = getDeviceDataLength();
           data = DeviceMemoryBuffer.allocate(dataLen);
           data.copyFromHostBuffer(hdata, 0, dataLen);
         }
@@ -233,6 +234,164 @@ public final class HostColumnVector extends HostColumnVectorCore {
     }
   }
 
+  /**
+   * Copy the data to the device asynchronously on the given stream.
+   *
+   * The copies have not necessarily completed when this returns. Work queued on the same stream
+   * sees the data, but the host buffers must not be modified or closed before the stream is
+   * synchronized. The copies are only truly asynchronous, and run at full bandwidth, when the
+   * host buffers are pinned or registered with {@link HostMemoryBuffer#registerWithCuda()}.
+   * Nested columns are copied synchronously.
+   * @param stream CUDA stream to copy and allocate on
+   * @return the column on the device
+   */
+  public ColumnVector copyToDevice(Cuda.Stream stream) {
+    if (rows == 0 || type.isNestedType()) {
+      return copyToDevice();
+    }
+    DeviceMemoryBuffer[] buffers = new DeviceMemoryBuffer[DEVICE_BUFFER_COUNT];
+    try {
+      HostMemoryBuffer[] hostBuffers = getHostBuffers();
+      long[] lengths = getDeviceBufferLengths();
+      for (int i = 0; i < DEVICE_BUFFER_COUNT; i++) {
+        if (hostBuffers[i] != null) {
+          buffers[i] = DeviceMemoryBuffer.allocate(lengths[i], stream);
+          buffers[i].copyFromHostBufferAsync(0, hostBuffers[i], 0, lengths[i], stream);
+        }
+      }
+      ColumnVector ret = new ColumnVector(type, rows, nullCount, buffers[0], buffers[1],
+          buffers[2]);
+      Arrays.fill(buffers, null);
+      return ret;
+    } finally {
+      closeBuffers(buffers);
+    }
+  }
+
+  /**
+   * Copy the columns of a host table to the device in a single transfer.
+   *
+   * The buffers of all the columns are packed into one pinned host buffer, when the pinned memory
+   * pool has room for it, and copied into one device allocation, instead of issuing a copy and an
+   * allocation per buffer. The copy has completed when this returns. Nested columns are copied
+   * separately.
+   * @param stream CUDA stream to copy and allocate on
+   * @param columns the columns to copy, all with the same number of rows
+   * @return a table of the columns on the device
+   */
+  public static Table copyTableToDevice(Cuda.Stream stream, HostColumnVector... columns) {
+    assert columns != null && columns.length > 0 : "HostColumnVectors can't be null or empty";
+    // lay out the buffers of the packed columns in a single block, aligned as RMM aligns them
+    long[][] lengths = new long[columns.length][];
+    long[][] offsets = new long[columns.length][];
+    long totalLength = 0;
+    for (int i = 0; i < columns.length; i++) {
+      if (columns[i].rows == 0 || columns[i].type.isNestedType()) {
+        continue;
+      }
+      lengths[i] = columns[i].getDeviceBufferLengths();
+      offsets[i] = new long[DEVICE_BUFFER_COUNT];
+      for (int j = 0; j < DEVICE_BUFFER_COUNT; j++) {
+        offsets[i][j] = totalLength;
+        totalLength = alignDeviceBufferOffset(totalLength + lengths[i][j]);
+      }
+    }
+
+    ColumnVector[] deviceColumns = new ColumnVector[columns.length];
+    DeviceMemoryBuffer packed = null;
+    try {
+      if (totalLength > 0) {
+        try (HostMemoryBuffer staging = HostMemoryBuffer.allocate(totalLength)) {
+          for (int i = 0; i < columns.length; i++) {
+            if (lengths[i] == null) {
+              continue;
+            }
+            HostMemoryBuffer[] hostBuffers = columns[i].getHostBuffers();
+            for (int j = 0; j < DEVICE_BUFFER_COUNT; j++) {
+              if (hostBuffers[j] != null) {
+                staging.copyFromHostBuffer(offsets[i][j], hostBuffers[j], 0, lengths[i][j]);
+              }
+            }
+          }
+          packed = DeviceMemoryBuffer.allocate(totalLength, stream);
+          packed.copyFromHostBuffer(0, staging, 0, totalLength, stream);
+        }
+      }
+
+      for (int i = 0; i < columns.length; i++) {
+        HostColumnVector column = columns[i];
+        if (lengths[i] == null) {
+          deviceColumns[i] = column.copyToDevice();
+          continue;
+        }
+        DeviceMemoryBuffer[] buffers = new DeviceMemoryBuffer[DEVICE_BUFFER_COUNT];
+        try {
+          for (int j = 0; j < DEVICE_BUFFER_COUNT; j++) {
+            if (lengths[i][j] > 0) {
+              buffers[j] = packed.slice(offsets[i][j], lengths[i][j]);
+            }
+          }
+          deviceColumns[i] = new ColumnVector(column.type, column.rows, column.nullCount,
+              buffers[0], buffers[1], buffers[2]);
+          Arrays.fill(buffers, null);
+        } finally {
+          closeBuffers(buffers);
+        }
+      }
+      return new Table(deviceColumns);
+    } finally {
+      if (packed != null) {
+        packed.close();
+      }
+      for (ColumnVector column : deviceColumns) {
+        if (column != null) {
+          column.close();
+        }
+      }
+    }
+  }
+
+  private static long alignDeviceBufferOffset(long offset) {
+    return (offset + DEVICE_BUFFER_ALIGNMENT - 1) & ~(DEVICE_BUFFER_ALIGNMENT - 1);
+  }
+
+  private static void closeBuffers(DeviceMemoryBuffer[] buffers) {
+    for (DeviceMemoryBuffer buffer : buffers) {
+      if (buffer != null) {
+        buffer.close();
+      }
+    }
+  }
+
+  private HostMemoryBuffer[] getHostBuffers() {
+    return new HostMemoryBuffer[] {offHeap.data, offHeap.valid, offHeap.offsets};
+  }
+
+  /**
+   * The number of bytes of each buffer of a column that is not nested to copy to the device, or
+   * 0 for the buffers the column does not have.
+   */
+  private long[] getDeviceBufferLengths() {
+    return new long[] {
+        offHeap.data == null ? 0 : getDeviceDataLength(),
+        offHeap.valid == null ? 0 : ColumnView.getValidityBufferSize((int) rows),
+        offHeap.offsets == null ? 0 : OFFSET_SIZE * (rows + 1)};
+  }
+
+  private long getDeviceDataLength() {
+    if (type.equals(DType.STRING)) {
+      // This needs a different type
+      long dataLen = getEndStringOffset(rows - 1);
+      if (dataLen == 0 && getNullCount() == 0) {
+        // This is a work around to an issue where a column of all empty strings must have at
+        // least one byte or it will not be interpreted correctly.
+        dataLen = 1;
+      }
+      return dataLen;
+    }
+    return rows * type.getSizeInBytes();
+  }
+
   /////////////////////////////////////////////////////////////////////////////
   // BUILDER
   /////////////////////////////////////////////////////////////////////////////
@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2019-2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -598,6 +598,17 @@ public class HostMemoryBuffer extends MemoryBuffer {
         CudaMemcpyKind.DEVICE_TO_HOST, stream);
   }
 
+  /**
+   * Page-lock this buffer with CUDA so copies between it and the device run at full bandwidth
+   * and truly asynchronously, without staging through a pinned bounce buffer. Registering is
+   * expensive, so it is meant for large buffers that are reused for many copies. The buffer stays
+   * registered, and open, until the returned registration is closed.
+   * @return the registration, which must be closed before the memory can be released
+   */
+  public final CudaHostRegistration registerWithCuda() {
+    return new CudaHostRegistration(this);
+  }
+
   /**
    * Slice off a part of the host buffer.
    * @param offset where to start the slice at.
@@ -1,6 +1,6 @@
 /*
  *
- *  Copyright (c) 2020, NVIDIA CORPORATION.
+ *  Copyright (c) 2020-2022, NVIDIA CORPORATION.
  *
  *  Licensed under the Apache License, Version 2.0 (the "License");
  *  you may not use this file except in compliance with the License.
@@ -54,4 +54,18 @@ class HostMemoryBufferNativeUtils {
    * @param length size of the mapped region in bytes
    */
   static native void munmap(long address, long length);
+
+  /**
+   * Page-lock a host memory range and make it accessible to the device with cudaHostRegister.
+   * @param address start of the range
+   * @param length size of the range in bytes
+   * @return true if the range was registered, false if it was already page-locked
+   */
+  static native boolean hostRegister(long address, long length);
+
+  /**
+   * Unregister a host memory range registered with {@link #hostRegister(long, long)}.
+   * @param address start of the registered range
+   */
+  static native void hostUnregister(long address);
 }
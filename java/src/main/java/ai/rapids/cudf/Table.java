@@ -722,6 +722,15 @@ public final class Table implements AutoCloseable {
                                                  long columnHandle,
                                                  boolean checkCount);
 
+  private static native long[] castColumns(long tableHandle, int[] types, int[] scales);
+
+  private static native long[] isNullColumns(long tableHandle);
+
+  private static native long[] replaceNullsScalars(long tableHandle, long[] scalarHandles);
+
+  private static native long[] binaryOpColumnsScalar(long tableHandle, long scalarHandle, int op,
+                                                     int[] types, int[] scales);
+
   private static native long rowBitCount(long tableHandle) throws CudfException;
 
   private static native long[] explode(long tableHandle, int index);
@@ -1695,6 +1704,73 @@ public final class Table implements AutoCloseable {
     return new Table(repeatColumnCount(this.nativeHandle, counts.getNativeView(), checkCount));
   }
 
+  /////////////////////////////////////////////////////////////////////////////
+  // COLUMN-WISE OPERATIONS
+  //
+  // These apply the same element-wise operation as the ColumnView method of the same name to
+  // every column of the table with a single native call, which matters for wide tables with few
+  // rows.
+  /////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Cast every column of this table, as {@link ColumnView#castTo(DType)} does.
+   * @param types the type to cast each column to, one per column
+   * @return a new table of the cast columns
+   */
+  public Table castTo(DType... types) {
+    assert types.length == columns.length : "One type is needed per column";
+    int[] typeIds = new int[types.length];
+    int[] scales = new int[types.length];
+    for (int i = 0; i < types.length; i++) {
+      typeIds[i] = types[i].typeId.getNativeId();
+      scales[i] = types[i].getScale();
+    }
+    return new Table(castColumns(nativeHandle, typeIds, scales));
+  }
+
+  /**
+   * Returns a table of boolean columns that are true where the corresponding column of this table
+   * is null, as {@link ColumnView#isNull()} does.
+   */
+  public Table isNull() {
+    return new Table(isNullColumns(nativeHandle));
+  }
+
+  /**
+   * Replace the nulls of every column of this table, as {@link ColumnView#replaceNulls(Scalar)}
+   * does.
+   * @param replacements the value to replace the nulls of each column with, one per column
+   * @return a new table with the nulls replaced
+   */
+  public Table replaceNulls(Scalar... replacements) {
+    assert replacements.length == columns.length : "One replacement is needed per column";
+    long[] scalarHandles = new long[replacements.length];
+    for (int i = 0; i < replacements.length; i++) {
+      scalarHandles[i] = replacements[i].getScalarHandle();
+    }
+    return new Table(replaceNullsScalars(nativeHandle, scalarHandles));
+  }
+
+  /**
+   * Apply a binary operation between every column of this table and a scalar, as
+   * {@link ColumnView#binaryOp(BinaryOp, BinaryOperable, DType)} does.
+   * @param op the operation, with each column on the left hand side
+   * @param rhs the scalar on the right hand side
+   * @param outTypes the type of the result of each column, one per column
+   * @return a new table of the results
+   */
+  public Table binaryOp(BinaryOp op, Scalar rhs, DType... outTypes) {
+    assert outTypes.length == columns.length : "One output type is needed per column";
+    int[] typeIds = new int[outTypes.length];
+    int[] scales = new int[outTypes.length];
+    for (int i = 0; i < outTypes.length; i++) {
+      typeIds[i] = outTypes[i].typeId.getNativeId();
+      scales[i] = outTypes[i].getScale();
+    }
+    return new Table(binaryOpColumnsScalar(nativeHandle, rhs.getScalarHandle(), op.nativeId,
+        typeIds, scales));
+  }
+
   /**
    * Partition this table using the mapping in partitionMap. partitionMap must be an integer
    * column. The number of rows in partitionMap must be the same as this table.  Each row
@@ -106,6 +106,100 @@ std::size_t calc_device_memory_size(cudf::column_view const &view) {
 
 } // anonymous namespace
 
+namespace cudf::jni {
+
+std::unique_ptr<cudf::column> cast_to(JNIEnv *env, cudf::column_view const &column,
+                                      cudf::data_type n_data_type) {
+  if (n_data_type == column.type()) {
+    return std::make_unique<cudf::column>(column);
+  }
+  if (n_data_type.id() == cudf::type_id::STRING) {
+    switch (column.type().id()) {
+      case cudf::type_id::BOOL8: return cudf::strings::from_booleans(column);
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64: return cudf::strings::from_floats(column);
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64: return cudf::strings::from_integers(column);
+      case cudf::type_id::DECIMAL32:
+      case cudf::type_id::DECIMAL64:
+      case cudf::type_id::DECIMAL128: return cudf::strings::from_fixed_point(column);
+      default: throw_java_exception(env, ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  }
+  if (column.type().id() == cudf::type_id::STRING) {
+    switch (n_data_type.id()) {
+      case cudf::type_id::BOOL8: return cudf::strings::to_booleans(column);
+      case cudf::type_id::FLOAT32:
+      case cudf::type_id::FLOAT64: return cudf::strings::to_floats(column, n_data_type);
+      case cudf::type_id::INT8:
+      case cudf::type_id::UINT8:
+      case cudf::type_id::INT16:
+      case cudf::type_id::UINT16:
+      case cudf::type_id::INT32:
+      case cudf::type_id::UINT32:
+      case cudf::type_id::INT64:
+      case cudf::type_id::UINT64: return cudf::strings::to_integers(column, n_data_type);
+      case cudf::type_id::DECIMAL32:
+      case cudf::type_id::DECIMAL64:
+      case cudf::type_id::DECIMAL128: return cudf::strings::to_fixed_point(column, n_data_type);
+      default: throw_java_exception(env, ILLEGAL_ARG_CLASS, "Invalid data type");
+    }
+  }
+  if (cudf::is_timestamp(n_data_type) && cudf::is_numeric(column.type())) {
+    // This is a temporary workaround to allow Java to cast from integral types into a timestamp
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    if (n_data_type.id() == cudf::type_id::TIMESTAMP_DAYS) {
+      if (column.type().id() != cudf::type_id::INT32) {
+        throw_java_exception(env, ILLEGAL_ARG_CLASS,
+                             "Numeric cast to TIMESTAMP_DAYS requires INT32");
+      }
+    } else {
+      if (column.type().id() != cudf::type_id::INT64) {
+        throw_java_exception(env, ILLEGAL_ARG_CLASS,
+                             "Numeric cast to non-day timestamp requires INT64");
+      }
+    }
+    cudf::data_type duration_type = timestamp_to_duration(n_data_type);
+    cudf::column_view duration_view = cudf::column_view(
+        duration_type, column.size(), column.head(), column.null_mask(), column.null_count());
+    return cudf::cast(duration_view, n_data_type);
+  }
+  if (cudf::is_timestamp(column.type()) && cudf::is_numeric(n_data_type)) {
+    // This is a temporary workaround to allow Java to cast from timestamp types to integral types
+    // without forcing an intermediate duration column to be manifested.  Ultimately this style of
+    // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
+    cudf::data_type duration_type = timestamp_to_duration(column.type());
+    cudf::column_view duration_view = cudf::column_view(
+        duration_type, column.size(), column.head(), column.null_mask(), column.null_count());
+    return cudf::cast(duration_view, n_data_type);
+  }
+  return cudf::cast(column, n_data_type);
+}
+
+std::unique_ptr<cudf::column> binary_op_vs(cudf::column_view const &lhs, cudf::scalar const &rhs,
+                                           cudf::binary_operator op, cudf::data_type out_type) {
+  if (lhs.type().id() == cudf::type_id::STRUCT) {
+    auto [new_mask, new_null_count] = cudf::binops::scalar_col_valid_mask_and(lhs, rhs);
+    auto out = make_fixed_width_column(out_type, lhs.size(), std::move(new_mask), new_null_count);
+    auto rhsv = cudf::make_column_from_scalar(rhs, 1);
+    auto out_view = out->mutable_view();
+    cudf::binops::compiled::detail::apply_sorting_struct_binary_op(out_view, lhs, rhsv->view(),
+                                                                   false, true, op);
+    return out;
+  }
+
+  return cudf::binary_operation(lhs, rhs, op, out_type);
+}
+
+} // namespace cudf::jni
+
 extern "C" {
 
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnView_upperStrings(JNIEnv *env, jobject j_object,
@@ -1027,79 +1121,7 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnView_castTo(JNIEnv *env, jclas
     cudf::jni::auto_set_device(env);
     cudf::column_view *column = reinterpret_cast<cudf::column_view *>(handle);
     cudf::data_type n_data_type = cudf::jni::make_data_type(type, scale);
-    if (n_data_type == column->type()) {
-      return ptr_as_jlong(new cudf::column(*column));
-    }
-    if (n_data_type.id() == cudf::type_id::STRING) {
-      switch (column->type().id()) {
-        case cudf::type_id::BOOL8: return release_as_jlong(cudf::strings::from_booleans(*column));
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64: return release_as_jlong(cudf::strings::from_floats(*column));
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64: return release_as_jlong(cudf::strings::from_integers(*column));
-        case cudf::type_id::DECIMAL32:
-        case cudf::type_id::DECIMAL64:
-        case cudf::type_id::DECIMAL128:
-          return release_as_jlong(cudf::strings::from_fixed_point(*column));
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (column->type().id() == cudf::type_id::STRING) {
-      switch (n_data_type.id()) {
-        case cudf::type_id::BOOL8: return release_as_jlong(cudf::strings::to_booleans(*column));
-        case cudf::type_id::FLOAT32:
-        case cudf::type_id::FLOAT64:
-          return release_as_jlong(cudf::strings::to_floats(*column, n_data_type));
-        case cudf::type_id::INT8:
-        case cudf::type_id::UINT8:
-        case cudf::type_id::INT16:
-        case cudf::type_id::UINT16:
-        case cudf::type_id::INT32:
-        case cudf::type_id::UINT32:
-        case cudf::type_id::INT64:
-        case cudf::type_id::UINT64:
-          return release_as_jlong(cudf::strings::to_integers(*column, n_data_type));
-        case cudf::type_id::DECIMAL32:
-        case cudf::type_id::DECIMAL64:
-        case cudf::type_id::DECIMAL128:
-          return release_as_jlong(cudf::strings::to_fixed_point(*column, n_data_type));
-        default: JNI_THROW_NEW(env, "java/lang/IllegalArgumentException", "Invalid data type", 0);
-      }
-    } else if (cudf::is_timestamp(n_data_type) && cudf::is_numeric(column->type())) {
-      // This is a temporary workaround to allow Java to cast from integral types into a timestamp
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      if (n_data_type.id() == cudf::type_id::TIMESTAMP_DAYS) {
-        if (column->type().id() != cudf::type_id::INT32) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException",
-                        "Numeric cast to TIMESTAMP_DAYS requires INT32", 0);
-        }
-      } else {
-        if (column->type().id() != cudf::type_id::INT64) {
-          JNI_THROW_NEW(env, "java/lang/IllegalArgumentException",
-                        "Numeric cast to non-day timestamp requires INT64", 0);
-        }
-      }
-      cudf::data_type duration_type = cudf::jni::timestamp_to_duration(n_data_type);
-      cudf::column_view duration_view = cudf::column_view(
-          duration_type, column->size(), column->head(), column->null_mask(), column->null_count());
-      return release_as_jlong(cudf::cast(duration_view, n_data_type));
-    } else if (cudf::is_timestamp(column->type()) && cudf::is_numeric(n_data_type)) {
-      // This is a temporary workaround to allow Java to cast from timestamp types to integral types
-      // without forcing an intermediate duration column to be manifested.  Ultimately this style of
-      // "reinterpret" casting will be supported via https://github.com/rapidsai/cudf/pull/5358
-      cudf::data_type duration_type = cudf::jni::timestamp_to_duration(column->type());
-      cudf::column_view duration_view = cudf::column_view(
-          duration_type, column->size(), column->head(), column->null_mask(), column->null_count());
-      return release_as_jlong(cudf::cast(duration_view, n_data_type));
-    } else {
-      return release_as_jlong(cudf::cast(*column, n_data_type));
-    }
+    return release_as_jlong(cudf::jni::cast_to(env, *column, n_data_type));
   }
   CATCH_STD(env, 0);
 }
@@ -1356,18 +1378,7 @@ JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_ColumnView_binaryOpVS(JNIEnv *env, j
     cudf::data_type n_data_type = cudf::jni::make_data_type(out_dtype, scale);
     cudf::binary_operator op = static_cast<cudf::binary_operator>(int_op);
 
-    if (lhs->type().id() == cudf::type_id::STRUCT) {
-      auto [new_mask, new_null_count] = cudf::binops::scalar_col_valid_mask_and(*lhs, *rhs);
-      auto out =
-          make_fixed_width_column(n_data_type, lhs->size(), std::move(new_mask), new_null_count);
-      auto rhsv = cudf::make_column_from_scalar(*rhs, 1);
-      auto out_view = out->mutable_view();
-      cudf::binops::compiled::detail::apply_sorting_struct_binary_op(out_view, *lhs, rhsv->view(),
-                                                                     false, true, op);
-      return release_as_jlong(out);
-    }
-
-    return release_as_jlong(cudf::binary_operation(*lhs, *rhs, op, n_data_type));
+    return release_as_jlong(cudf::jni::binary_op_vs(*lhs, *rhs, op, n_data_type));
   }
   CATCH_STD(env, 0);
 }
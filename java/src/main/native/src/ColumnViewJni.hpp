@@ -14,8 +14,14 @@
  * limitations under the License.
  */
 
+#pragma once
+
+#include <jni.h>
+
+#include <cudf/binaryop.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <rmm/cuda_stream_view.hpp>
 
@@ -91,4 +97,31 @@ void post_process_list_overlap(cudf::column_view const &lhs, cudf::column_view c
 std::unique_ptr<cudf::column> lists_distinct_by_key(cudf::lists_column_view const &input,
                                                     rmm::cuda_stream_view stream);
 
+/**
+ * @brief Casts a column to a type the way `ColumnView.castTo` does.
+ *
+ * Besides `cudf::cast`, this converts to and from strings and reinterprets integers as timestamps
+ * and timestamps as integers.
+ *
+ * @param env The JNI environment used to throw `IllegalArgumentException` for invalid casts.
+ * @param column The column to cast.
+ * @param type The type to cast to.
+ * @return The cast column.
+ */
+std::unique_ptr<cudf::column> cast_to(JNIEnv *env, cudf::column_view const &column,
+                                      cudf::data_type type);
+
+/**
+ * @brief Applies a binary operator to a column and a scalar the way `ColumnView.binaryOp` does,
+ * including the comparison of struct columns.
+ *
+ * @param lhs The column on the left of the operator.
+ * @param rhs The scalar on the right of the operator.
+ * @param op The operator.
+ * @param out_type The type of the result.
+ * @return The result column.
+ */
+std::unique_ptr<cudf::column> binary_op_vs(cudf::column_view const &lhs, cudf::scalar const &rhs,
+                                           cudf::binary_operator op, cudf::data_type out_type);
+
 } // namespace cudf::jni
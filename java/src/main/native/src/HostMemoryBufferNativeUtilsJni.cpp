@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021, NVIDIA CORPORATION.
+ * Copyright (c) 2019-2022, NVIDIA CORPORATION.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,10 @@
 #include <sys/mman.h>
 #include <sys/types.h>
 
+#include <cuda_runtime.h>
+
+#include <cudf/utilities/error.hpp>
+
 #include "jni_utils.hpp"
 
 extern "C" {
@@ -71,4 +75,30 @@ JNIEXPORT void JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_munmap(JN
   CATCH_STD(env, );
 }
 
+JNIEXPORT jboolean JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_hostRegister(
+    JNIEnv *env, jclass, jlong address, jlong length) {
+  JNI_NULL_CHECK(env, address, "address is NULL", false);
+  try {
+    auto const rc = cudaHostRegister(reinterpret_cast<void *>(address), length,
+                                     cudaHostRegisterPortable);
+    if (rc == cudaErrorHostMemoryAlreadyRegistered) {
+      // pinned allocations and buffers registered elsewhere are already page-locked
+      cudaGetLastError();
+      return false;
+    }
+    CUDF_CUDA_TRY(rc);
+    return true;
+  }
+  CATCH_STD(env, false);
+}
+
+JNIEXPORT void JNICALL Java_ai_rapids_cudf_HostMemoryBufferNativeUtils_hostUnregister(
+    JNIEnv *env, jclass, jlong address) {
+  JNI_NULL_CHECK(env, address, "address is NULL", );
+  try {
+    CUDF_CUDA_TRY(cudaHostUnregister(reinterpret_cast<void *>(address)));
+  }
+  CATCH_STD(env, );
+}
+
 } // extern "C"
@@ -38,19 +38,21 @@
 #include <cudf/replace.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/rolling.hpp>
+#include <cudf/row_conversion.hpp>
 #include <cudf/search.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
+#include <cudf/unary.hpp>
 #include <cudf/utilities/span.hpp>
 #include <rmm/cuda_stream_view.hpp>
 #include <thrust/iterator/counting_iterator.h>
 
+#include "ColumnViewJni.hpp"
 #include "cudf_jni_apis.hpp"
 #include "dtype_utils.hpp"
 #include "jni_compiled_expr.hpp"
 #include "jni_utils.hpp"
-#include "row_conversion.hpp"
 
 namespace cudf {
 namespace jni {
@@ -1029,6 +1031,20 @@ cudf::table_view remove_validity_if_needed(cudf::table_view *input_table_view) {
   return cudf::table_view(views);
 }
 
+/**
+ * @brief Applies `fn(index, column)` to every column of a table and returns the results as a new
+ * table, so Java makes a single native call for the whole table.
+ */
+template <typename Fn>
+jlongArray transform_columns(JNIEnv *env, cudf::table_view const &input, Fn fn) {
+  std::vector<std::unique_ptr<cudf::column>> results;
+  results.reserve(input.num_columns());
+  for (cudf::size_type i = 0; i < input.num_columns(); i++) {
+    results.push_back(fn(i, input.column(i)));
+  }
+  return convert_table_for_return(env, std::make_unique<cudf::table>(std::move(results)));
+}
+
 } // namespace
 
 } // namespace jni
@@ -2935,7 +2951,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_dropDuplicates(JNIEnv *en
     auto result =
         cudf::distinct(*input, keys_indices, keep_option,
                        nulls_equal ? cudf::null_equality::EQUAL : cudf::null_equality::UNEQUAL,
-                       cudf::nan_equality::ALL_EQUAL, rmm::mr::get_current_device_resource());
+                       cudf::nan_equality::ALL_EQUAL);
     return convert_table_for_return(env, result);
   }
   CATCH_STD(env, 0);
@@ -2964,7 +2980,7 @@ Java_ai_rapids_cudf_Table_convertToRowsFixedWidthOptimized(JNIEnv *env, jclass,
     cudf::jni::auto_set_device(env);
     auto const n_input_table = reinterpret_cast<cudf::table_view const *>(input_table);
     std::vector<std::unique_ptr<cudf::column>> cols =
-        cudf::jni::convert_to_rows_fixed_width_optimized(*n_input_table);
+        cudf::convert_to_rows_fixed_width_optimized(*n_input_table);
     int num_columns = cols.size();
     cudf::jni::native_jlongArray outcol_handles(env, num_columns);
     std::transform(cols.begin(), cols.end(), outcol_handles.begin(),
@@ -3018,7 +3034,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_convertToRows(JNIEnv *env
   try {
     cudf::jni::auto_set_device(env);
     auto const n_input_table = reinterpret_cast<cudf::table_view const *>(input_table);
-    std::vector<std::unique_ptr<cudf::column>> cols = cudf::jni::convert_to_rows(*n_input_table);
+    std::vector<std::unique_ptr<cudf::column>> cols = cudf::convert_to_rows(*n_input_table);
     int num_columns = cols.size();
     cudf::jni::native_jlongArray outcol_handles(env, num_columns);
     std::transform(cols.begin(), cols.end(), outcol_handles.begin(),
@@ -3046,7 +3062,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_convertFromRowsFixedWidth
     std::transform(n_types.begin(), n_types.end(), n_scale.begin(), std::back_inserter(types_vec),
                    [](jint type, jint scale) { return cudf::jni::make_data_type(type, scale); });
     std::unique_ptr<cudf::table> result =
-        cudf::jni::convert_from_rows_fixed_width_optimized(list_input, types_vec);
+        cudf::convert_from_rows_fixed_width_optimized(list_input, types_vec);
     return convert_table_for_return(env, result);
   }
   CATCH_STD(env, 0);
@@ -3071,7 +3087,7 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_convertFromRows(JNIEnv *e
     std::vector<cudf::data_type> types_vec;
     std::transform(n_types.begin(), n_types.end(), n_scale.begin(), std::back_inserter(types_vec),
                    [](jint type, jint scale) { return cudf::jni::make_data_type(type, scale); });
-    std::unique_ptr<cudf::table> result = cudf::jni::convert_from_rows(list_input, types_vec);
+    std::unique_ptr<cudf::table> result = cudf::convert_from_rows(list_input, types_vec);
     return convert_table_for_return(env, result);
   }
   CATCH_STD(env, 0);
@@ -3104,6 +3120,82 @@ JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_repeatColumnCount(JNIEnv
   CATCH_STD(env, 0);
 }
 
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_castColumns(JNIEnv *env, jclass,
+                                                                   jlong input_jtable,
+                                                                   jintArray j_types,
+                                                                   jintArray j_scales) {
+  JNI_NULL_CHECK(env, input_jtable, "input table is null", 0);
+  JNI_NULL_CHECK(env, j_types, "types are null", 0);
+  JNI_NULL_CHECK(env, j_scales, "scales are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto const input = reinterpret_cast<cudf::table_view const *>(input_jtable);
+    cudf::jni::native_jintArray n_types(env, j_types);
+    cudf::jni::native_jintArray n_scales(env, j_scales);
+    JNI_ARG_CHECK(env, n_types.size() == input->num_columns(), "one type is needed per column",
+                  0);
+    JNI_ARG_CHECK(env, n_scales.size() == n_types.size(), "types and scales do not match", 0);
+    return cudf::jni::transform_columns(env, *input, [&](auto i, auto const &column) {
+      return cudf::jni::cast_to(env, column, cudf::jni::make_data_type(n_types[i], n_scales[i]));
+    });
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_isNullColumns(JNIEnv *env, jclass,
+                                                                     jlong input_jtable) {
+  JNI_NULL_CHECK(env, input_jtable, "input table is null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto const input = reinterpret_cast<cudf::table_view const *>(input_jtable);
+    return cudf::jni::transform_columns(
+        env, *input, [](auto, auto const &column) { return cudf::is_null(column); });
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_replaceNullsScalars(
+    JNIEnv *env, jclass, jlong input_jtable, jlongArray j_scalars) {
+  JNI_NULL_CHECK(env, input_jtable, "input table is null", 0);
+  JNI_NULL_CHECK(env, j_scalars, "replacement scalars are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto const input = reinterpret_cast<cudf::table_view const *>(input_jtable);
+    cudf::jni::native_jpointerArray<cudf::scalar> n_scalars(env, j_scalars);
+    JNI_ARG_CHECK(env, n_scalars.size() == input->num_columns(),
+                  "one replacement is needed per column", 0);
+    return cudf::jni::transform_columns(env, *input, [&](auto i, auto const &column) {
+      return cudf::replace_nulls(column, *n_scalars[i]);
+    });
+  }
+  CATCH_STD(env, 0);
+}
+
+JNIEXPORT jlongArray JNICALL Java_ai_rapids_cudf_Table_binaryOpColumnsScalar(
+    JNIEnv *env, jclass, jlong input_jtable, jlong j_scalar, jint int_op, jintArray j_types,
+    jintArray j_scales) {
+  JNI_NULL_CHECK(env, input_jtable, "input table is null", 0);
+  JNI_NULL_CHECK(env, j_scalar, "rhs is null", 0);
+  JNI_NULL_CHECK(env, j_types, "types are null", 0);
+  JNI_NULL_CHECK(env, j_scales, "scales are null", 0);
+  try {
+    cudf::jni::auto_set_device(env);
+    auto const input = reinterpret_cast<cudf::table_view const *>(input_jtable);
+    auto const rhs = reinterpret_cast<cudf::scalar const *>(j_scalar);
+    auto const op = static_cast<cudf::binary_operator>(int_op);
+    cudf::jni::native_jintArray n_types(env, j_types);
+    cudf::jni::native_jintArray n_scales(env, j_scales);
+    JNI_ARG_CHECK(env, n_types.size() == input->num_columns(),
+                  "one output type is needed per column", 0);
+    JNI_ARG_CHECK(env, n_scales.size() == n_types.size(), "types and scales do not match", 0);
+    return cudf::jni::transform_columns(env, *input, [&](auto i, auto const &column) {
+      return cudf::jni::binary_op_vs(column, *rhs, op,
+                                     cudf::jni::make_data_type(n_types[i], n_scales[i]));
+    });
+  }
+  CATCH_STD(env, 0);
+}
+
 JNIEXPORT jlong JNICALL Java_ai_rapids_cudf_Table_bound(JNIEnv *env, jclass, jlong input_jtable,
                                                         jlong values_jtable,
                                                         jbooleanArray desc_flags,
@@ -6565,4 +6565,43 @@ public class ColumnVectorTest extends CudfTestBase {
       assertColumnsAreEqual(expectedCv, actualCv);
     }
   }
+
+  @Test
+  void testCopyToDeviceOnStream() {
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         HostColumnVector ints = HostColumnVector.fromBoxedInts(1, null, 3, 4);
+         HostColumnVector strings = HostColumnVector.fromStrings("a", "bcd", null, "");
+         ColumnVector expectedInts = ColumnVector.fromBoxedInts(1, null, 3, 4);
+         ColumnVector expectedStrings = ColumnVector.fromStrings("a", "bcd", null, "");
+         ColumnVector actualInts = ints.copyToDevice(stream);
+         ColumnVector actualStrings = strings.copyToDevice(stream)) {
+      stream.sync();
+      assertColumnsAreEqual(expectedInts, actualInts);
+      assertColumnsAreEqual(expectedStrings, actualStrings);
+    }
+  }
+
+  @Test
+  void testCopyTableToDevice() {
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         HostColumnVector ints = HostColumnVector.fromBoxedInts(1, null, 3, 4);
+         HostColumnVector doubles = HostColumnVector.fromDoubles(1.5, 2.5, 3.5, 4.5);
+         HostColumnVector strings = HostColumnVector.fromStrings("a", "bcd", null, "");
+         HostColumnVector lists = HostColumnVector.fromLists(
+             new HostColumnVector.ListType(true,
+                 new HostColumnVector.BasicType(true, DType.INT32)),
+             Arrays.asList(1), Arrays.asList(2, 3), null, Arrays.asList());
+         Table expected = new Table.TestBuilder()
+             .column(1, null, 3, 4)
+             .column(1.5, 2.5, 3.5, 4.5)
+             .column("a", "bcd", null, "")
+             .column(new HostColumnVector.ListType(true,
+                     new HostColumnVector.BasicType(true, DType.INT32)),
+                 Arrays.asList(1), Arrays.asList(2, 3), null, Arrays.asList())
+             .build();
+         Table actual = HostColumnVector.copyTableToDevice(stream, ints, doubles, strings,
+             lists)) {
+      assertTablesAreEqual(expected, actual);
+    }
+  }
 }
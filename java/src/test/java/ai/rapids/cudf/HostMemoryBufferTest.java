@@ -298,4 +298,33 @@ public class HostMemoryBufferTest extends CudfTestBase {
       assertArrayEquals(data, result);
     }
   }
+
+  @Test
+  public void registeredAsyncCopyTest() {
+    long length = 1 * 1024 * 1024;
+    byte[] data = rba((int)length);
+    byte[] result = new byte[data.length];
+    try (Cuda.Stream stream = new Cuda.Stream(true);
+         HostMemoryBuffer hostBuffer = HostMemoryBuffer.allocate(data.length, false);
+         CudaHostRegistration registration = hostBuffer.registerWithCuda();
+         DeviceMemoryBuffer devBuffer = DeviceMemoryBuffer.allocate(data.length)) {
+      hostBuffer.setBytes(0, data, 0, data.length);
+      devBuffer.copyFromHostBufferAsync(registration.getBuffer(), stream);
+      hostBuffer.copyFromDeviceBufferAsync(devBuffer, stream);
+      stream.sync();
+      hostBuffer.getBytes(result, 0, 0, result.length);
+      assertArrayEquals(data, result);
+    }
+  }
+
+  @Test
+  public void registerPinnedBufferTest() {
+    long length = 1024;
+    initPinnedPoolIfNeeded(length);
+    try (HostMemoryBuffer hostBuffer = PinnedMemoryPool.allocate(length)) {
+      // already page-locked, so registering and unregistering leave it as it is
+      hostBuffer.registerWithCuda().close();
+      hostBuffer.registerWithCuda().close();
+    }
+  }
 }
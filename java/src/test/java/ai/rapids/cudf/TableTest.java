@@ -2583,6 +2583,51 @@ public class TableTest extends CudfTestBase {
         table.lowerBound(nullsAreSmallest, values, descFlags);
   }
 
+  @Test
+  void testColumnWiseOperations() {
+    try (Table t = new Table.TestBuilder()
+            .column(1, null, 3)
+            .column(1.5, 2.5, null)
+            .column("a", null, "c")
+            .build();
+         Table castExpected = new Table.TestBuilder()
+            .column(1L, null, 3L)
+            .column(1, 2, null)
+            .column("a", null, "c")
+            .build();
+         Table cast = t.castTo(DType.INT64, DType.INT32, DType.STRING);
+         Table isNullExpected = new Table.TestBuilder()
+            .column(false, true, false)
+            .column(false, false, true)
+            .column(false, true, false)
+            .build();
+         Table isNull = t.isNull();
+         Scalar intReplacement = Scalar.fromInt(-1);
+         Scalar doubleReplacement = Scalar.fromDouble(-1.0);
+         Scalar stringReplacement = Scalar.fromString("");
+         Table replacedExpected = new Table.TestBuilder()
+            .column(1, -1, 3)
+            .column(1.5, 2.5, -1.0)
+            .column("a", "", "c")
+            .build();
+         Table replaced = t.replaceNulls(intReplacement, doubleReplacement, stringReplacement);
+         Scalar two = Scalar.fromInt(2);
+         Table numbers = new Table.TestBuilder()
+            .column(1, null, 3)
+            .column(1.5, 2.5, null)
+            .build();
+         Table multipliedExpected = new Table.TestBuilder()
+            .column(2L, null, 6L)
+            .column(3.0, 5.0, null)
+            .build();
+         Table multiplied = numbers.binaryOp(BinaryOp.MUL, two, DType.INT64, DType.FLOAT64)) {
+      assertTablesAreEqual(castExpected, cast);
+      assertTablesAreEqual(isNullExpected, isNull);
+      assertTablesAreEqual(replacedExpected, replaced);
+      assertTablesAreEqual(multipliedExpected, multiplied);
+    }
+  }
+
   @Test
   void testRepeat() {
     try (Table t = new Table.TestBuilder()